@@ -79,7 +79,7 @@ extern "C" {
  * All integers ranging from 0 to @ref NRF_802154_RESERVED_DRX_ID_UPPER_BOUND (inclusive)
  * can be used by the application as identifiers of delayed reception windows.
  */
-#define NRF_802154_RESERVED_DRX_ID_UPPER_BOUND (UINT32_MAX - 4)
+#define NRF_802154_RESERVED_DRX_ID_UPPER_BOUND (UINT32_MAX - 12)
 
 /**
  * @brief Initializes the 802.15.4 driver.
@@ -114,6 +114,41 @@ void nrf_802154_channel_set(uint8_t channel);
  */
 uint8_t nrf_802154_channel_get(void);
 
+#if (NRF_802154_DUAL_CHANNEL_RX_ENABLED && !NRF_802154_SERIALIZATION_HOST) || defined(DOXYGEN)
+/**
+ * @brief Sets the secondary channel of the dual-channel reception.
+ *
+ * When a secondary channel is set, the receiver alternates between the channel set by
+ * @ref nrf_802154_channel_set and the secondary channel every
+ * @ref NRF_802154_DUAL_CHANNEL_RX_DWELL_US. When a frame starts being received, the receiver
+ * stays on its channel until the frame and its ACK are handled. Received frames report
+ * the channel they were received on in their metadata. All other operations, including
+ * transmissions, use the channel set by @ref nrf_802154_channel_set.
+ *
+ * @note The dual-channel reception is disabled by default.
+ * @note Frames transmitted on one of the channels while the receiver listens on the other one are
+ *       not received.
+ * @note This function is available if @ref NRF_802154_DUAL_CHANNEL_RX_ENABLED is enabled.
+ *
+ * @param[in]  channel  Secondary channel number (11-26), or 0 to disable the dual-channel
+ *                      reception.
+ *
+ * @retval true   The secondary channel was set.
+ * @retval false  @p channel is invalid.
+ */
+bool nrf_802154_dual_channel_rx_set(uint8_t channel);
+
+/**
+ * @brief Gets the secondary channel of the dual-channel reception.
+ *
+ * @note This function is available if @ref NRF_802154_DUAL_CHANNEL_RX_ENABLED is enabled.
+ *
+ * @returns  Secondary channel number, or 0 if the dual-channel reception is disabled.
+ */
+uint8_t nrf_802154_dual_channel_rx_get(void);
+
+#endif // NRF_802154_DUAL_CHANNEL_RX_ENABLED && !NRF_802154_SERIALIZATION_HOST
+
 /**
  * @brief Sets the transmit power.
  *
@@ -131,6 +166,21 @@ void nrf_802154_tx_power_set(int8_t power);
  */
 int8_t nrf_802154_tx_power_get(void);
 
+#if (NRF_802154_TX_POWER_SPLIT_CACHE_ENABLED && !NRF_802154_SERIALIZATION_HOST) || \
+    defined(DOXYGEN)
+
+/**
+ * @brief Invalidates the cached transmit power split for all channels.
+ *
+ * This function must be called after the FEM configuration is changed, so that subsequent
+ * transmissions use the transmit power split calculated for the new configuration.
+ *
+ * @note This function is available only if @ref NRF_802154_TX_POWER_SPLIT_CACHE_ENABLED is set.
+ */
+void nrf_802154_tx_power_split_cache_invalidate(void);
+
+#endif
+
 #if !NRF_802154_SERIALIZATION_HOST || defined(DOXYGEN)
 
 /**
@@ -337,6 +387,46 @@ void nrf_802154_extended_address_set(const uint8_t * p_extended_address);
  */
 void nrf_802154_short_address_set(const uint8_t * p_short_address);
 
+#if (NRF_802154_SECONDARY_IDENTITIES > 0) || defined(DOXYGEN)
+
+/**
+ * @brief Sets a secondary identity of the device.
+ *
+ * Frames destined to any configured secondary identity are accepted in the same way as frames
+ * destined to the primary identity. ACK frames sent in response to such frames are generated
+ * using the matched identity.
+ *
+ * @param[in]  index            Index of the secondary identity, lower than
+ *                              @ref NRF_802154_SECONDARY_IDENTITIES.
+ * @param[in]  p_pan_id         Pointer to the PAN ID (2 bytes, little-endian).
+ * @param[in]  p_short_address  Pointer to the short address (2 bytes, little-endian).
+ * @param[in]  p_extended_addr  Pointer to the extended address (8 bytes, little-endian).
+ *
+ * This function makes a copy of the PAN ID and the addresses.
+ *
+ * @retval  true   The secondary identity was set.
+ * @retval  false  The @p index is out of range.
+ */
+bool nrf_802154_secondary_identity_set(uint8_t         index,
+                                       const uint8_t * p_pan_id,
+                                       const uint8_t * p_short_address,
+                                       const uint8_t * p_extended_addr);
+
+/**
+ * @brief Clears a secondary identity of the device.
+ *
+ * Frames destined only to the cleared identity are rejected by the frame filter.
+ *
+ * @param[in]  index  Index of the secondary identity, lower than
+ *                    @ref NRF_802154_SECONDARY_IDENTITIES.
+ *
+ * @retval  true   The secondary identity was cleared.
+ * @retval  false  The @p index is out of range.
+ */
+bool nrf_802154_secondary_identity_clear(uint8_t index);
+
+#endif // (NRF_802154_SECONDARY_IDENTITIES > 0) || defined(DOXYGEN)
+
 #if !NRF_802154_SERIALIZATION_HOST || defined(DOXYGEN)
 /**
  * @}
@@ -442,6 +532,52 @@ bool nrf_802154_receive_at(uint64_t rx_time,
  */
 bool nrf_802154_receive_at_cancel(uint32_t id);
 
+#if NRF_802154_DELAYED_TRX_TIMELINE_ENABLED || defined(DOXYGEN)
+
+/**
+ * @brief Schedules a series of delayed transmissions and reception windows.
+ *
+ * This function allows the higher layer to program many future operations, like the slots of
+ * a whole TSCH slotframe or a series of CSL receive windows, with a single call. The operations
+ * are kept ordered by their time and each one is handed over to the delayed transmission or
+ * the delayed reception mechanism as soon as it can be scheduled there. Each operation behaves
+ * as if it was requested by @ref nrf_802154_transmit_raw_at or @ref nrf_802154_receive_at and its
+ * result is notified in the same way. If an operation cannot be scheduled when its turn comes,
+ * @ref nrf_802154_transmit_failed with @ref NRF_802154_TX_ERROR_TIMESLOT_DENIED or
+ * @ref nrf_802154_receive_failed with @ref NRF_802154_RX_ERROR_DELAYED_TIMESLOT_DENIED is called.
+ *
+ * The operations are copied by the driver, but the frames to transmit must remain valid until
+ * their transmissions are notified. The identifiers of reception windows must follow the rules
+ * described for @ref nrf_802154_receive_at.
+ *
+ * @note This function is available if @ref NRF_802154_DELAYED_TRX_TIMELINE_ENABLED is enabled.
+ *
+ * @param[in]  p_ops      Pointer to an array of operations to schedule. The operations do not
+ *                        need to be sorted.
+ * @param[in]  ops_count  Number of operations in @p p_ops.
+ *
+ * @retval  true   All operations were added to the timeline.
+ * @retval  false  None of the operations was added, because there is not enough space in
+ *                 the timeline or one of the operations is invalid.
+ */
+bool nrf_802154_timeline_schedule(const nrf_802154_timeline_op_t * p_ops, uint32_t ops_count);
+
+/**
+ * @brief Removes from the timeline all operations that have not been scheduled yet.
+ *
+ * Operations already handed over to the delayed transmission or reception mechanism are not
+ * affected and can be cancelled with @ref nrf_802154_transmit_at_cancel or
+ * @ref nrf_802154_receive_at_cancel. Removed operations are not notified.
+ *
+ * @note This function is available if @ref NRF_802154_DELAYED_TRX_TIMELINE_ENABLED is enabled.
+ *
+ * @retval  true   At least one operation was removed.
+ * @retval  false  The timeline was empty.
+ */
+bool nrf_802154_timeline_clear(void);
+
+#endif // NRF_802154_DELAYED_TRX_TIMELINE_ENABLED
+
 #if NRF_802154_USE_RAW_API || defined(DOXYGEN)
 
 /**
@@ -601,6 +737,12 @@ bool nrf_802154_transmit(const uint8_t                        * p_data,
  * A successfully scheduled transmission can be cancelled by a call
  * to @ref nrf_802154_transmit_at_cancel.
  *
+ * If the Radio Scheduler provides more than one delayed transmission slot
+ * (@ref NRF_802154_RSCH_DLY_TS_OP_DTX_SLOTS), transmissions of consecutive slots can be chained:
+ * each of them is scheduled in the Radio Scheduler as soon as this function is called, so that
+ * the hardware trigger of a transmission is prepared while the preceding one is still ongoing.
+ * A chained transmission aborts the preceding one if it has not finished by then.
+ *
  * @param[in]  p_data      Pointer to the array with data to transmit. The first byte must contain
  *                         the frame length (including FCS). The following bytes contain data.
  *                         The CRC is computed automatically by the radio hardware. Therefore,
@@ -624,16 +766,15 @@ bool nrf_802154_transmit_raw_at(uint8_t                                 * p_data
                                 const nrf_802154_transmit_at_metadata_t * p_metadata);
 
 /**
- * @brief Cancels a delayed transmission scheduled by a call to @ref nrf_802154_transmit_raw_at.
+ * @brief Cancels delayed transmissions scheduled by calls to @ref nrf_802154_transmit_raw_at.
  *
- * If a delayed transmission has been scheduled but the transmission has not been started yet,
- * a call to this function prevents the transmission. If the transmission is ongoing,
- * it will not be aborted.
+ * If delayed transmissions have been scheduled but have not been started yet, a call to this
+ * function prevents all of them. If a transmission is ongoing, it will not be aborted.
  *
- * If a delayed transmission has not been scheduled (or has already finished), this function does
- * not change state and returns false.
+ * If no delayed transmission has been scheduled (or all have already finished), this function
+ * does not change state and returns false.
  *
- * @retval  true    The delayed transmission was scheduled and successfully cancelled.
+ * @retval  true    At least one delayed transmission was scheduled and successfully cancelled.
  * @retval  false   No delayed transmission was scheduled.
  */
 bool nrf_802154_transmit_at_cancel(void);
@@ -659,6 +800,75 @@ bool nrf_802154_transmit_at_cancel(void);
  */
 bool nrf_802154_energy_detection(uint32_t time_us);
 
+/**
+ * @brief Changes the radio state to energy detection and scans multiple channels.
+ *
+ * The energy detection procedure is performed on each channel selected in @p channel_mask, in
+ * ascending channel order, without the higher layer intervention between the channels. When all
+ * the channels are scanned, the driver returns to the channel set by @ref nrf_802154_channel_set
+ * and the results are reported to the higher layer by @ref nrf_802154_energy_scan_done.
+ *
+ * @note @ref nrf_802154_energy_scan_done can be called before this function returns a result.
+ * @note If the procedure is aborted, @ref nrf_802154_energy_detection_failed is called and
+ *       no partial results are reported.
+ * @note The notes of @ref nrf_802154_energy_detection regarding the procedure duration apply
+ *       to each of the scanned channels.
+ *
+ * @param[in]  channel_mask   Mask of channels to scan. Bit n corresponds to channel n. Only
+ *                            channels 11-26 are taken into account.
+ * @param[in]  dwell_time_us  Duration of energy detection procedure on each channel. The given
+ *                            value is rounded up to multiplication of 8 symbols (128 us).
+ *
+ * @retval  true   The energy scan procedure was scheduled.
+ * @retval  false  The driver could not schedule the energy scan procedure or @p channel_mask
+ *                 does not contain any valid channel.
+ */
+bool nrf_802154_energy_scan(uint32_t channel_mask, uint32_t dwell_time_us);
+
+#if (NRF_802154_ED_RING_ENABLED && !NRF_802154_SERIALIZATION_HOST) || defined(DOXYGEN)
+
+/**
+ * @brief Enables or disables storing of the energy detection samples.
+ *
+ * @note Storing of the energy detection samples is disabled by default.
+ *
+ * When enabled, the energy detection procedures started by @ref nrf_802154_energy_detection and
+ * @ref nrf_802154_energy_scan report every 128 us sample separately. Each sample is appended with
+ * its timestamp and channel to a ring of @ref NRF_802154_ED_RING_SIZE samples, which the higher
+ * layer drains with @ref nrf_802154_energy_detection_ring_read. The results of the procedures are
+ * reported as usual. A short gap, in which the energy is not measured, occurs between
+ * the consecutive samples.
+ *
+ * Enabling the storing discards the content of the ring and clears the counter of lost samples.
+ *
+ * @note This function is available if @ref NRF_802154_ED_RING_ENABLED is enabled.
+ *
+ * @param[in]  enabled  If the storing is to be enabled.
+ */
+void nrf_802154_energy_detection_ring_set(bool enabled);
+
+/**
+ * @brief Moves the energy detection samples from the ring to the given buffer.
+ *
+ * @note This function must not be called concurrently with itself or with
+ *       @ref nrf_802154_energy_detection_ring_set.
+ *
+ * @param[out]  p_samples  Pointer to the buffer to be filled with the samples.
+ * @param[in]   count      Capacity of the buffer in samples.
+ *
+ * @returns  Number of samples written to @p p_samples.
+ */
+uint32_t nrf_802154_energy_detection_ring_read(nrf_802154_ed_sample_t * p_samples, uint32_t count);
+
+/**
+ * @brief Gets the number of energy detection samples dropped because the ring was full.
+ *
+ * @returns  Number of lost samples.
+ */
+uint32_t nrf_802154_energy_detection_ring_lost_count_get(void);
+
+#endif // NRF_802154_ED_RING_ENABLED && !NRF_802154_SERIALIZATION_HOST
+
 /**
  * @brief Changes the radio state to @ref RADIO_STATE_CCA.
  *
@@ -808,6 +1018,49 @@ bool nrf_802154_rssi_measure_begin(void);
  */
 int8_t nrf_802154_rssi_last_get(void);
 
+#if NRF_802154_NOISE_FLOOR_ENABLED || defined(DOXYGEN)
+/**
+ * @brief Gets the noise floor estimate of a channel.
+ *
+ * The estimate is an exponential moving average of RSSI samples taken by the driver in the
+ * background when it leaves an idle reception on the channel.
+ *
+ * @note This function is available if @ref NRF_802154_NOISE_FLOOR_ENABLED is enabled.
+ *
+ * @param[in]   channel        Channel for which the estimate is requested.
+ * @param[out]  p_noise_floor  Pointer to the estimated noise floor in dBm.
+ *
+ * @retval true   The estimate was retrieved.
+ * @retval false  The channel is invalid or no sample was taken on it yet.
+ */
+bool nrf_802154_channel_noise_floor_get(uint8_t channel, int8_t * p_noise_floor);
+
+/**
+ * @brief Discards the noise floor estimates of all channels.
+ *
+ * @note This function is available if @ref NRF_802154_NOISE_FLOOR_ENABLED is enabled.
+ */
+void nrf_802154_channel_noise_floor_reset(void);
+
+#endif // NRF_802154_NOISE_FLOOR_ENABLED
+
+#if NRF_802154_CCA_ADAPTIVE_ENABLED || defined(DOXYGEN)
+/**
+ * @brief Gets the CCA energy detection threshold currently adapted for a channel.
+ *
+ * @note This function is available if @ref NRF_802154_CCA_ADAPTIVE_ENABLED is enabled.
+ *
+ * @param[in]   channel          Channel for which the threshold is requested.
+ * @param[out]  p_threshold_dbm  Pointer to the threshold in dBm.
+ *
+ * @retval true   The threshold was retrieved.
+ * @retval false  The noise floor of the channel is not estimated yet, so the threshold set by
+ *                @ref nrf_802154_cca_cfg_set is used.
+ */
+bool nrf_802154_cca_adaptive_threshold_dbm_get(uint8_t channel, int8_t * p_threshold_dbm);
+
+#endif // NRF_802154_CCA_ADAPTIVE_ENABLED
+
 #endif // !NRF_802154_SERIALIZATION_HOST
 
 /**
@@ -840,6 +1093,51 @@ void nrf_802154_promiscuous_set(bool enabled);
  */
 bool nrf_802154_promiscuous_get(void);
 
+#if NRF_802154_SNIFFER_ENABLED || defined(DOXYGEN)
+
+/**
+ * @brief Enables or disables the sniffer mode.
+ *
+ * @note The sniffer mode is disabled by default.
+ *
+ * In the sniffer mode, the driver does not notify the higher layer about received frames.
+ * Instead, it appends each of them with its timestamp, RSSI, LQI and channel to a ring of
+ * @ref NRF_802154_SNIFFER_RING_SIZE bytes and releases the receive buffer immediately.
+ * The higher layer drains the ring in bulk with @ref nrf_802154_sniffer_read. The sniffer mode is
+ * usually combined with the promiscuous mode and with the auto ACK disabled.
+ *
+ * Enabling the sniffer mode discards the content of the ring and clears the counter of lost
+ * frames.
+ *
+ * @param[in]  enabled  If the sniffer mode is to be enabled.
+ */
+void nrf_802154_sniffer_set(bool enabled);
+
+/**
+ * @brief Moves complete frame records from the sniffer ring to the given buffer.
+ *
+ * Each record consists of an @ref nrf_802154_sniffer_record_t header followed by the PSDU of
+ * the frame without the FCS field. Records are written back-to-back and are never split.
+ *
+ * @note This function must not be called concurrently with itself or with
+ *       @ref nrf_802154_sniffer_set.
+ *
+ * @param[out]  p_buffer  Pointer to the buffer to be filled with the records.
+ * @param[in]   size      Size of the buffer.
+ *
+ * @returns  Number of bytes written to @p p_buffer.
+ */
+uint32_t nrf_802154_sniffer_read(uint8_t * p_buffer, uint32_t size);
+
+/**
+ * @brief Gets the number of frames dropped in the sniffer mode because the ring was full.
+ *
+ * @returns  Number of lost frames.
+ */
+uint32_t nrf_802154_sniffer_lost_count_get(void);
+
+#endif // NRF_802154_SNIFFER_ENABLED
+
 /**
  * @}
  * @defgroup nrf_802154_autoack Auto ACK management
@@ -1057,6 +1355,49 @@ bool nrf_802154_pending_bit_for_addr_set(const uint8_t * p_addr, bool extended);
  */
 bool nrf_802154_pending_bit_for_addr_clear(const uint8_t * p_addr, bool extended);
 
+/**
+ * @brief Adds addresses of multiple peer nodes to the pending bit list.
+ *
+ * This function has the same effect as calling @ref nrf_802154_pending_bit_for_addr_set for every
+ * address in @p p_addrs, but the whole batch is applied in a single critical section. When
+ * the driver is serialized, the batch is transferred in as few requests as possible.
+ *
+ * @note This function makes a copy of the given addresses.
+ * @note The radio interrupt is blocked while the batch is applied. Keep the batch size reasonable.
+ *
+ * @param[in]  p_addrs   Array of bytes containing @p count addresses of the nodes placed one after
+ *                       another (each little-endian).
+ * @param[in]  count     Number of addresses in @p p_addrs.
+ * @param[in]  extended  If the given addresses are extended MAC addresses or short MAC addresses.
+ *
+ * @returns  Number of addresses that are present in the list after the call. If it is less than
+ *           @p count, there was not enough memory to store all the addresses.
+ */
+uint32_t nrf_802154_pending_bit_for_addr_set_batch(const uint8_t * p_addrs,
+                                                   uint32_t        count,
+                                                   bool            extended);
+
+/**
+ * @brief Removes addresses of multiple peer nodes from the pending bit list.
+ *
+ * This function has the same effect as calling @ref nrf_802154_pending_bit_for_addr_clear for
+ * every address in @p p_addrs, but the whole batch is applied in a single critical section. When
+ * the driver is serialized, the batch is transferred in as few requests as possible.
+ *
+ * @note The radio interrupt is blocked while the batch is applied. Keep the batch size reasonable.
+ *
+ * @param[in]  p_addrs   Array of bytes containing @p count addresses of the nodes placed one after
+ *                       another (each little-endian).
+ * @param[in]  count     Number of addresses in @p p_addrs.
+ * @param[in]  extended  If the given addresses are extended MAC addresses or short MAC addresses.
+ *
+ * @returns  Number of addresses removed from the list. Addresses missing from the list are not
+ *           counted.
+ */
+uint32_t nrf_802154_pending_bit_for_addr_clear_batch(const uint8_t * p_addrs,
+                                                     uint32_t        count,
+                                                     bool            extended);
+
 /**
  * @brief Removes all addresses of a given type from the pending bit list.
  *
@@ -1231,6 +1572,32 @@ void nrf_802154_csma_ca_max_backoffs_set(uint8_t max_backoffs);
  */
 uint8_t nrf_802154_csma_ca_max_backoffs_get(void);
 
+/**
+ * @brief Sets the maximum number of retransmissions of a frame for which no valid ACK was received.
+ *
+ * When a frame transmitted with @ref nrf_802154_transmit_csma_ca_raw requests an ACK and no valid
+ * ACK is received, the driver repeats the CSMA-CA procedure and retransmits the frame up to
+ * @p max_frame_retries times before notifying the failure. The number of retransmissions performed
+ * is reported in @ref nrf_802154_transmit_done_metadata_t::retries.
+ *
+ * @note This function is available if @ref NRF_802154_CSMA_CA_ENABLED is enabled.
+ *
+ * @param[in] max_frame_retries  Maximum number of frame retries (macMaxFrameRetries).
+ *
+ * @retval true   When value provided by @p max_frame_retries has been set successfully.
+ * @retval false  Otherwise.
+ */
+bool nrf_802154_csma_ca_max_frame_retries_set(uint8_t max_frame_retries);
+
+/**
+ * @brief Gets the maximum number of retransmissions of a frame for which no valid ACK was received.
+ *
+ * @note This function is available if @ref NRF_802154_CSMA_CA_ENABLED is enabled.
+ *
+ * @return Current maximum number of frame retries.
+ */
+uint8_t nrf_802154_csma_ca_max_frame_retries_get(void);
+
 #endif // NRF_802154_CSMA_CA_ENABLED
 
 #if !NRF_802154_SERIALIZATION_HOST || defined(DOXYGEN)
@@ -1343,6 +1710,31 @@ void nrf_802154_stat_counters_get(nrf_802154_stat_counters_t * p_stat_counters);
  */
 void nrf_802154_stat_counters_subtract(const nrf_802154_stat_counters_t * p_stat_counters);
 
+/**
+ * @brief Gets the number of receive buffers that are currently free.
+ *
+ * A buffer is not free from the moment a frame is received into it until the frame is released
+ * with @ref nrf_802154_buffer_free_raw or a related function.
+ *
+ * @returns  Number of free receive buffers, in range from 0 to @ref NRF_802154_RX_BUFFERS.
+ */
+uint32_t nrf_802154_stat_rx_buffers_free_get(void);
+
+#if NRF_802154_CSMA_CA_ENABLED || defined(DOXYGEN)
+/**
+ * @brief Gets the channel occupancy estimated by the CSMA-CA procedure.
+ *
+ * The occupancy is a running ratio of CCA attempts of the CSMA-CA procedure that found
+ * the channel busy, weighted towards the most recent attempts.
+ *
+ * @note This function is available if @ref NRF_802154_CSMA_CA_ENABLED is enabled.
+ *
+ * @returns  Estimated channel occupancy in percent, in range from 0 to 100.
+ */
+uint8_t nrf_802154_stat_channel_occupancy_get(void);
+
+#endif // NRF_802154_CSMA_CA_ENABLED
+
 #endif // !NRF_802154_SERIALIZATION_HOST
 
 /**
@@ -1352,6 +1744,36 @@ void nrf_802154_stat_counters_subtract(const nrf_802154_stat_counters_t * p_stat
  */
 void nrf_802154_stat_timestamps_get(nrf_802154_stat_timestamps_t * p_stat_timestamps);
 
+/**
+ * @brief Gets latency histograms gathered by the driver.
+ *
+ * @note The histograms are collected if @ref NRF_802154_STATS_HISTOGRAMS_ENABLED is enabled.
+ *       Otherwise all bins are zero.
+ *
+ * @param[out] p_stat_histograms Structure that will be filled with current histograms.
+ */
+void nrf_802154_stat_histograms_get(nrf_802154_stat_histograms_t * p_stat_histograms);
+
+/**
+ * @brief Gets a performance counter registered on the core that runs the driver.
+ *
+ * The counters are registered through the @c nrfx_perf_counters registry by the driver,
+ * the serialization and the nrfx drivers. Calling this function with increasing @p index
+ * from 0 until it returns false collects all of them.
+ *
+ * @note The counters are registered if @c NRFX_PERF_COUNTERS_ENABLED is enabled.
+ *       Otherwise there are none.
+ *
+ * @param[in]  index      Index of the counter.
+ * @param[out] p_counter  Structure that will be filled with the snapshot of the counter.
+ *                        Longer histograms are truncated to
+ *                        @ref NRF_802154_PERF_COUNTER_VALUES_MAX bins.
+ *
+ * @retval true   The counter was retrieved.
+ * @retval false  There is no counter with the given @p index.
+ */
+bool nrf_802154_perf_counter_get(uint32_t index, nrf_802154_perf_counter_t * p_counter);
+
 #if !NRF_802154_SERIALIZATION_HOST || defined(DOXYGEN)
 /**
  * @brief Resets current stat counters to 0.
@@ -1362,6 +1784,69 @@ void nrf_802154_stat_timestamps_get(nrf_802154_stat_timestamps_t * p_stat_timest
  */
 void nrf_802154_stat_counters_reset(void);
 
+/**
+ * @brief Resets all bins of the latency histograms to 0.
+ */
+void nrf_802154_stat_histograms_reset(void);
+
+#if NRF_802154_STATS_RADIO_TIME_ENABLED || defined(DOXYGEN)
+/**
+ * @brief Gets the times the radio spent in each of its states on each channel.
+ *
+ * @note This function is available if @ref NRF_802154_STATS_RADIO_TIME_ENABLED is enabled.
+ *
+ * @param[out] p_stat_radio_times Structure that will be filled with the accumulated times.
+ */
+void nrf_802154_stat_radio_times_get(nrf_802154_stat_radio_times_t * p_stat_radio_times);
+
+/**
+ * @brief Resets the times accumulated by the radio time accounting to 0.
+ *
+ * @note This function is available if @ref NRF_802154_STATS_RADIO_TIME_ENABLED is enabled.
+ */
+void nrf_802154_stat_radio_times_reset(void);
+
+#endif // NRF_802154_STATS_RADIO_TIME_ENABLED
+
+#if NRF_802154_STATS_TIMESLOT_ENABLED || defined(DOXYGEN)
+/**
+ * @brief Gets the statistics of timeslots granted to the driver by the Radio Scheduler.
+ *
+ * @note This function is available if @ref NRF_802154_STATS_TIMESLOT_ENABLED is enabled.
+ *
+ * @param[out] p_stat_timeslots Structure that will be filled with the timeslot statistics.
+ */
+void nrf_802154_stat_timeslots_get(nrf_802154_stat_timeslots_t * p_stat_timeslots);
+
+/**
+ * @brief Resets the timeslot statistics to 0.
+ *
+ * @note This function is available if @ref NRF_802154_STATS_TIMESLOT_ENABLED is enabled.
+ */
+void nrf_802154_stat_timeslots_reset(void);
+
+#endif // NRF_802154_STATS_TIMESLOT_ENABLED
+
+#if NRF_802154_STATS_CRITICAL_SECTION_ENABLED || defined(DOXYGEN)
+/**
+ * @brief Gets the statistics of durations of critical sections of the driver.
+ *
+ * @note This function is available if @ref NRF_802154_STATS_CRITICAL_SECTION_ENABLED is enabled.
+ *
+ * @param[out] p_stat_critical_sections Structure that will be filled with the statistics.
+ */
+void nrf_802154_stat_critical_sections_get(
+    nrf_802154_stat_critical_sections_t * p_stat_critical_sections);
+
+/**
+ * @brief Resets the critical section statistics to 0.
+ *
+ * @note This function is available if @ref NRF_802154_STATS_CRITICAL_SECTION_ENABLED is enabled.
+ */
+void nrf_802154_stat_critical_sections_reset(void);
+
+#endif // NRF_802154_STATS_CRITICAL_SECTION_ENABLED
+
 #endif // !NRF_802154_SERIALIZATION_HOST
 
 /**
@@ -1430,6 +1915,151 @@ void nrf_802154_ifs_min_lifs_period_set(uint16_t period);
 
 #endif // NRF_802154_IFS_ENABLED
 
+/**
+ * @}
+ * @defgroup nrf_802154_tx_queue Transmit queue feature
+ * @{
+ */
+#if NRF_802154_TX_QUEUE_ENABLED || defined(DOXYGEN)
+#if NRF_802154_USE_RAW_API || defined(DOXYGEN)
+
+/**
+ * @brief Adds a frame to the transmit queue.
+ *
+ * Frames in the queue are transmitted in the order they were added. The transmission of the next
+ * frame is requested by the driver as soon as the previous one ends, without waiting for
+ * the higher layer. If @ref NRF_802154_IFS_ENABLED is enabled, the interframe spacing is inserted
+ * between the frames as needed.
+ *
+ * The result of each transmission is notified by @ref nrf_802154_transmitted_raw or
+ * @ref nrf_802154_transmit_failed, as for @ref nrf_802154_transmit_raw. A failure of one frame
+ * does not stop the transmission of the following ones. Frames that are still in the queue when
+ * the driver is requested to enter another state are notified with
+ * @ref NRF_802154_TX_ERROR_ABORTED.
+ *
+ * @note This function is available if @ref NRF_802154_TX_QUEUE_ENABLED is enabled and
+ *       @ref NRF_802154_USE_RAW_API is enabled.
+ *
+ * @param[in]  p_data      Pointer to the frame to transmit. See also @ref nrf_802154_transmit_raw.
+ *                         The buffer must not be modified until the result of its transmission
+ *                         is notified.
+ * @param[in]  p_metadata  Pointer to metadata structure. See also @ref nrf_802154_transmit_raw.
+ *
+ * @retval  true   The frame was added to the queue.
+ * @retval  false  The queue already holds @ref NRF_802154_TX_QUEUE_DEPTH frames or the frame
+ *                 properties are invalid.
+ */
+bool nrf_802154_transmit_raw_queued(uint8_t                              * p_data,
+                                    const nrf_802154_transmit_metadata_t * p_metadata);
+
+#endif // NRF_802154_USE_RAW_API
+#endif // NRF_802154_TX_QUEUE_ENABLED
+
+/**
+ * @}
+ * @defgroup nrf_802154_indirect_tx Indirect transmission feature
+ * @{
+ */
+#if NRF_802154_INDIRECT_TX_ENABLED || defined(DOXYGEN)
+#if NRF_802154_USE_RAW_API || defined(DOXYGEN)
+
+/**
+ * @brief Adds a frame to the indirect transmission queue.
+ *
+ * The frame is held by the driver until a frame whose source address matches the destination
+ * address of the queued frame is received and acknowledged with the pending bit set. Then, the
+ * driver requests the transmission of the queued frame right after the ACK is sent, without
+ * waiting for the higher layer. This shortens the time a polling device must keep its receiver
+ * on. If @ref NRF_802154_IFS_ENABLED is enabled, the interframe spacing is inserted as needed.
+ *
+ * The pending bit itself is still controlled by the higher layer with
+ * @ref nrf_802154_ack_data_set. The polling frame is notified by @ref nrf_802154_received_raw
+ * as usual. The result of the transmission of the queued frame is notified by
+ * @ref nrf_802154_transmitted_raw or @ref nrf_802154_transmit_failed, as for
+ * @ref nrf_802154_transmit_raw. Once its transmission is requested, the frame is removed from
+ * the queue, so a failed attempt must be queued again by the higher layer. If the driver cannot
+ * start the transmission, for example because it is busy with another operation, the frame is
+ * kept in the queue until the next poll.
+ *
+ * @note This function is available if @ref NRF_802154_INDIRECT_TX_ENABLED is enabled and
+ *       @ref NRF_802154_USE_RAW_API is enabled.
+ *
+ * @param[in]  p_data      Pointer to the frame to transmit. See also @ref nrf_802154_transmit_raw.
+ *                         The frame must contain the destination address. The buffer must not
+ *                         be modified until the result of its transmission is notified or
+ *                         the frame is removed with @ref nrf_802154_transmit_raw_indirect_cancel.
+ * @param[in]  p_metadata  Pointer to metadata structure. See also @ref nrf_802154_transmit_raw.
+ *
+ * @retval  true   The frame was added to the queue.
+ * @retval  false  The queue already holds @ref NRF_802154_INDIRECT_TX_QUEUE_DEPTH frames,
+ *                 the frame has no destination address or the frame properties are invalid.
+ */
+bool nrf_802154_transmit_raw_indirect(uint8_t                              * p_data,
+                                      const nrf_802154_transmit_metadata_t * p_metadata);
+
+/**
+ * @brief Removes a frame from the indirect transmission queue.
+ *
+ * This function is intended to drop frames whose transaction persistence time has expired.
+ * No notification is issued for the removed frame.
+ *
+ * @note This function is available if @ref NRF_802154_INDIRECT_TX_ENABLED is enabled and
+ *       @ref NRF_802154_USE_RAW_API is enabled.
+ *
+ * @param[in]  p_data  Pointer to the frame passed to @ref nrf_802154_transmit_raw_indirect.
+ *
+ * @retval  true   The frame was removed from the queue.
+ * @retval  false  The frame is not in the queue or its transmission has already been requested.
+ */
+bool nrf_802154_transmit_raw_indirect_cancel(const uint8_t * p_data);
+
+#endif // NRF_802154_USE_RAW_API
+#endif // NRF_802154_INDIRECT_TX_ENABLED
+
+/**
+ * @}
+ * @defgroup nrf_802154_wakeup_tx Wake-up frame transmission feature
+ * @{
+ */
+#if NRF_802154_WAKEUP_TX_ENABLED || defined(DOXYGEN)
+#if NRF_802154_USE_RAW_API || defined(DOXYGEN)
+
+/**
+ * @brief Transmits a train of wake-up frames.
+ *
+ * The driver transmits the frame repeatedly, back-to-back, for @p duration_us, so that a device
+ * that samples the channel at least once in that time receives one of the copies. Before each
+ * copy is sent, the Rendezvous Time IE of the frame is set to the time left from the end of that
+ * copy to the end of the train, where the higher layer is expected to transmit the announced
+ * frame. Only the first copy is preceded by CCA, if requested by @p p_metadata. If
+ * @ref NRF_802154_IFS_ENABLED is enabled, the interframe spacing is inserted as needed.
+ *
+ * The end of the train is notified by @ref nrf_802154_transmitted_raw, once the last copy that
+ * fits in @p duration_us is transmitted. If the train is interrupted, the failure is notified by
+ * @ref nrf_802154_transmit_failed. No notification is issued for the other copies.
+ *
+ * @note This function is available if @ref NRF_802154_WAKEUP_TX_ENABLED is enabled and
+ *       @ref NRF_802154_USE_RAW_API is enabled.
+ *
+ * @param[in]  p_data       Pointer to the wake-up frame. See also @ref nrf_802154_transmit_raw.
+ *                          The frame must not request an ACK. The buffer must not be modified
+ *                          until the end of the train is notified.
+ * @param[in]  p_metadata   Pointer to metadata structure. See also @ref nrf_802154_transmit_raw.
+ * @param[in]  duration_us  Duration of the train in microseconds. It must not exceed the longest
+ *                          rendezvous time that can be announced, that is 0xffff units of
+ *                          10 symbols.
+ *
+ * @retval  true   The transmission of the first frame of the train was requested.
+ * @retval  false  Another train is running, the frame requests an ACK, the duration is too long,
+ *                 the frame properties are invalid or the driver cannot start the transmission.
+ */
+bool nrf_802154_transmit_raw_wakeup_train(uint8_t                              * p_data,
+                                          const nrf_802154_transmit_metadata_t * p_metadata,
+                                          uint32_t                               duration_us);
+
+#endif // NRF_802154_USE_RAW_API
+#endif // NRF_802154_WAKEUP_TX_ENABLED
+
 /**
  * @}
  * @defgroup nrf_802154_capabilities Radio driver run-time capabilities feature.
@@ -1467,6 +2097,27 @@ void nrf_802154_security_global_frame_counter_set(uint32_t frame_counter);
  */
 void nrf_802154_security_global_frame_counter_set_if_larger(uint32_t frame_counter);
 
+#if (NRF_802154_SECURITY_FRAME_COUNTER_RESERVATION_ENABLED && !NRF_802154_SERIALIZATION_HOST) || \
+    defined(DOXYGEN)
+
+/**
+ * @brief Confirms that a Global MAC Frame Counter high-water mark has been persisted.
+ *
+ * The higher layer calls this function after it stored the high-water mark requested by
+ * @ref nrf_802154_security_frame_counter_reservation_requested. The driver then uses frame
+ * counter values below @p high_water_mark. Frames that would need a frame counter value
+ * above the confirmed high-water mark are not secured.
+ *
+ * After reset, the higher layer must restore the frame counter by calling
+ * @ref nrf_802154_security_global_frame_counter_set with the last persisted high-water mark.
+ *
+ * @param[in] high_water_mark Persisted high-water mark. Smaller values than the current one
+ *                            are ignored.
+ */
+void nrf_802154_security_global_frame_counter_reservation_confirm(uint32_t high_water_mark);
+
+#endif
+
 /**
  * @brief Store the 802.15.4 MAC Security Key inside the nRF 802.15.4 Radio Driver.
  *
@@ -1532,6 +2183,149 @@ void nrf_802154_csl_writer_period_set(uint16_t period);
  */
 void nrf_802154_csl_writer_anchor_time_set(uint64_t anchor_time);
 
+#if NRF_802154_LINK_METRICS_SERIES_ENABLED || defined(DOXYGEN)
+
+/**
+ * @brief Configures, reconfigures or removes a Link Metrics Forward Tracking Series.
+ *
+ * Once configured, the driver accounts every received frame of @p frame_types coming from
+ * the initiator in the series, updating its PDU count and averaged RSSI, LQI and link margin.
+ * Configuring an already configured series clears its accumulated values.
+ *
+ * @param[in]  series_id    Identifier of the series.
+ * @param[in]  p_addr       Pointer to the address of the initiator of the series. Ignored if
+ *                          @p frame_types is zero.
+ * @param[in]  extended     If the given address is an extended MAC address or a short MAC address.
+ * @param[in]  frame_types  Frame types accounted in the series. Zero removes the series.
+ *
+ * @retval true   The series was configured or removed.
+ * @retval false  There is no room for another series, or the series to remove does not exist.
+ */
+bool nrf_802154_link_metrics_series_configure(uint8_t                     series_id,
+                                              const uint8_t             * p_addr,
+                                              bool                        extended,
+                                              nrf_802154_lm_frame_types_t frame_types);
+
+/**
+ * @brief Gets the values accumulated in a Link Metrics Forward Tracking Series.
+ *
+ * @param[in]   series_id  Identifier of the series.
+ * @param[out]  p_series   Pointer to the structure to be filled with the accumulated values.
+ *
+ * @retval true   The values were retrieved.
+ * @retval false  The series is not configured.
+ */
+bool nrf_802154_link_metrics_series_get(uint8_t series_id, nrf_802154_lm_series_t * p_series);
+
+#endif // NRF_802154_LINK_METRICS_SERIES_ENABLED
+
+/**
+ * @}
+ * @defgroup nrf_802154_csl_receiver Autonomous CSL receiver
+ * @{
+ */
+#if NRF_802154_CSL_RECEIVER_ENABLED || defined(DOXYGEN)
+
+/**
+ * @brief Starts opening CSL sample windows autonomously.
+ *
+ * When started, the driver opens a receive window of @p window_duration every CSL period on its
+ * own, without involvement of the higher layer. Windows are centered on the times given by
+ * the equation @c anchor_time + @c n * @c csl_period, where @c n is an integer. The period and
+ * the anchor time are also passed to the CSL writer, so that the CSL IEs injected into
+ * transmitted frames, including Enh-ACKs, describe the same windows.
+ *
+ * Frames received in the windows are notified as usual by @ref nrf_802154_received_raw or
+ * @ref nrf_802154_received. Windows that end without a frame are not notified. At the end of such
+ * a window the driver enters the @ref RADIO_STATE_SLEEP state if it is idle. A window that cannot
+ * be opened due to another operation is skipped silently.
+ *
+ * If the CSL receiver is already running, it is restarted with the new parameters. This can be
+ * used to resynchronize it.
+ *
+ * @note The CSL receiver uses one of the slots for delayed reception windows. The number of
+ *       windows that can be scheduled with @ref nrf_802154_receive_at at the same time is reduced
+ *       by one while it is running.
+ * @note This function is available if @ref NRF_802154_CSL_RECEIVER_ENABLED is enabled.
+ *
+ * @param[in]  period           CSL period, in units of 10 symbols (160 us).
+ * @param[in]  anchor_time      Absolute time used by the SL Timer, in microseconds (us), of the
+ *                              middle of any of the CSL windows.
+ * @param[in]  window_duration  Duration of each CSL window, in microseconds (us).
+ * @param[in]  channel          Radio channel on which the windows are opened.
+ *
+ * @retval  true   The CSL receiver has been started.
+ * @retval  false  The parameters are invalid. The window must be shorter than the period.
+ */
+bool nrf_802154_csl_receiver_start(uint16_t period,
+                                   uint64_t anchor_time,
+                                   uint32_t window_duration,
+                                   uint8_t  channel);
+
+/**
+ * @brief Stops the CSL receiver started with @ref nrf_802154_csl_receiver_start.
+ *
+ * A window that is open at the moment of this call is not closed, but its end is not handled
+ * by the driver. The configuration of the CSL writer is left unchanged.
+ *
+ * @note This function is available if @ref NRF_802154_CSL_RECEIVER_ENABLED is enabled.
+ */
+void nrf_802154_csl_receiver_stop(void);
+
+#endif // NRF_802154_CSL_RECEIVER_ENABLED
+
+/**
+ * @}
+ * @defgroup nrf_802154_beacon_tx Autonomous beacon transmitter
+ * @{
+ */
+#if NRF_802154_BEACON_TX_ENABLED || defined(DOXYGEN)
+
+/**
+ * @brief Starts transmitting a beacon periodically.
+ *
+ * When started, the driver transmits the beacon every @c period, starting at @c tx_time, on its
+ * own, without involvement of the higher layer. Beacons are transmitted as delayed transmissions
+ * at precise times. Before each beacon is requested, the driver prepares it from @p p_template:
+ * - the sequence number is incremented from the one in @p p_template, unless it is suppressed,
+ * - the ASN of the TSCH Synchronization IE, if present, is set to @c asn advanced by
+ *   @c asn_increment for every period since @c tx_time.
+ *
+ * The security and the header IEs, such as the CSL IE, are processed by the driver during each
+ * transmission, as for frames transmitted with @ref nrf_802154_transmit_raw_at. After each beacon
+ * the radio enters the receive state, as after any other transmission.
+ *
+ * The results of the transmissions of the beacons are not notified. A beacon that cannot be
+ * transmitted due to another operation is skipped silently. If the beacon transmitter is already
+ * running, it is restarted with the new beacon and parameters.
+ *
+ * @note The beacon transmitter uses one of the slots for delayed transmissions while a beacon is
+ *       pending. The number of transmissions that can be scheduled with
+ *       @ref nrf_802154_transmit_raw_at at the same time is reduced by one during that time.
+ * @note This function is available if @ref NRF_802154_BEACON_TX_ENABLED is enabled.
+ *
+ * @param[in]  p_template  Pointer to a buffer that contains PHR and PSDU of the beacon. The beacon
+ *                         is copied, so the buffer can be reused once this function returns.
+ * @param[in]  p_config    Pointer to the description of the periodic transmission.
+ *
+ * @retval  true   The beacon transmitter has been started.
+ * @retval  false  The frame is not a beacon or the period is too short to transmit the beacon and
+ *                 to prepare the next one.
+ */
+bool nrf_802154_beacon_tx_start(const uint8_t                       * p_template,
+                                const nrf_802154_beacon_tx_config_t * p_config);
+
+/**
+ * @brief Stops the beacon transmitter started with @ref nrf_802154_beacon_tx_start.
+ *
+ * A beacon whose transmission is already requested is still transmitted.
+ *
+ * @note This function is available if @ref NRF_802154_BEACON_TX_ENABLED is enabled.
+ */
+void nrf_802154_beacon_tx_stop(void);
+
+#endif // NRF_802154_BEACON_TX_ENABLED
+
 /**
  * @}
  * @defgroup nrf_802154_test_modes Test modes
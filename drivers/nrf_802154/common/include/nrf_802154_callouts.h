@@ -99,6 +99,16 @@ extern void nrf_802154_energy_detected(uint8_t result);
  */
 extern void nrf_802154_energy_detection_failed(nrf_802154_ed_error_t error);
 
+/**
+ * @brief Notifies that the multi-channel energy scan procedure finished.
+ *
+ * @note If the scan is aborted, @ref nrf_802154_energy_detection_failed is called instead.
+ *
+ * @param[in]  p_result  Pointer to structure containing the results of the scan.
+ *                       The pointer is valid within the @ref nrf_802154_energy_scan_done only.
+ */
+extern void nrf_802154_energy_scan_done(const nrf_802154_energy_scan_result_t * p_result);
+
 /**
  * @brief Notifies about the start of the ACK frame transmission.
  *
@@ -150,6 +160,29 @@ extern void nrf_802154_tx_ack_started(const uint8_t * p_data);
  */
 extern void nrf_802154_received_raw(uint8_t * p_data, int8_t power, uint8_t lqi);
 
+#if NRF_802154_RX_METADATA_ENABLED || defined(DOXYGEN)
+/**
+ * @brief Notifies that a frame was received, together with its metadata.
+ *
+ * This callout is called instead of @ref nrf_802154_received_raw if
+ * @ref NRF_802154_RX_METADATA_ENABLED is enabled. The metadata contains everything the driver
+ * learns about the frame while receiving it, so the higher layer does not need to query
+ * the RSSI, the LQI or the timestamp and does not need to parse the frame again.
+ *
+ * @note The metadata pointed to by @p p_metadata is stored with the receive buffer. It remains
+ *       valid until @ref nrf_802154_buffer_free_raw is called for @p p_data.
+ * @note Default implementation of this function provided by the nRF 802.15.4 Radio Driver calls
+ *       @ref nrf_802154_received_raw .
+ *
+ * @param[in]  p_data      Pointer to a buffer that contains PHR and PSDU of the received frame.
+ *                         See also @ref nrf_802154_received_raw.
+ * @param[in]  p_metadata  Pointer to the metadata of the received frame.
+ */
+extern void nrf_802154_received_ext(uint8_t                              * p_data,
+                                    const nrf_802154_received_metadata_t * p_metadata);
+
+#endif // NRF_802154_RX_METADATA_ENABLED
+
 #endif // !NRF_802154_SERIALIZATION_HOST
 
 /**
@@ -340,6 +373,28 @@ extern void nrf_802154_transmit_failed(uint8_t
  */
 extern void nrf_802154_tx_started(const uint8_t * p_frame);
 
+#if NRF_802154_RX_HEADER_NOTIFY_ENABLED || defined(DOXYGEN)
+/**
+ * @brief Notifies that the header of a frame being received has been parsed.
+ *
+ * The function is called once per frame, after the destination addressing fields are received
+ * and the frame passes the address filter, while the rest of the frame is still on air.
+ *
+ * @note This function is called from the radio interrupt context and should be very short
+ *       to prevent dropping frames by the driver.
+ * @note Only the bytes of the frame up to the end of the destination addressing fields are valid
+ *       when this function is called. The frame may still be dropped afterwards, for example
+ *       because of a CRC error. The final result is notified with @ref nrf_802154_received_raw
+ *       or @ref nrf_802154_receive_failed.
+ *
+ * @param[in]  p_data    Pointer to a buffer that contains PHR and the received part of PSDU.
+ * @param[in]  p_header  Pointer to the parsed header fields of the frame.
+ */
+extern void nrf_802154_rx_header_received(const uint8_t                * p_data,
+                                          const nrf_802154_rx_header_t * p_header);
+
+#endif
+
 /**
  * @brief Perform some additional operations during initialization of the RADIO peripheral.
  *
@@ -349,6 +404,24 @@ extern void nrf_802154_tx_started(const uint8_t * p_frame);
  */
 extern void nrf_802154_custom_part_of_radio_init(void);
 
+#if NRF_802154_SECURITY_FRAME_COUNTER_RESERVATION_ENABLED || defined(DOXYGEN)
+/**
+ * @brief Requests persisting a new Global MAC Frame Counter high-water mark.
+ *
+ * The higher layer is expected to store @p high_water_mark in persistent storage and then call
+ * @ref nrf_802154_security_global_frame_counter_reservation_confirm. The request is made ahead
+ * of time, when half of the currently reserved block is used, so that the confirmation can be
+ * delayed until the storage is available.
+ *
+ * @note This function may be called from the radio interrupt context. It must not block;
+ *       the persistent storage write must be deferred.
+ *
+ * @param[in]  high_water_mark  Value the frame counter shall not reach before it is persisted.
+ */
+extern void nrf_802154_security_frame_counter_reservation_requested(uint32_t high_water_mark);
+
+#endif
+
 #endif // !NRF_802154_SERIALIZATION_HOST
 
 #endif /* NRF_802154_CALLOUTS_H_ */
@@ -57,6 +57,187 @@ extern "C" {
  */
 
 /**
+ * @defgroup nrf_802154_config_profile Memory footprint profiles
+ * @{
+ *
+ * A profile sizes the internal tables of the driver and selects the optional features together
+ * for a given role of the device. Each option set by a profile is only a default; an option
+ * defined explicitly by the build system still takes precedence.
+ *
+ * The options with the largest RAM impact and their approximate cost per unit:
+ *  - @ref NRF_802154_RX_BUFFERS: 128 B and one notification slot,
+ *  - @ref NRF_802154_RX_BUFFERS_SHORT: @ref NRF_802154_RX_BUFFER_SHORT_PSDU_SIZE + 1 B and one
+ *    notification slot,
+ *  - @ref NRF_802154_PENDING_SHORT_ADDRESSES: 12 B, doubled by
+ *    @ref NRF_802154_ACK_DATA_HASH_ENABLED,
+ *  - @ref NRF_802154_PENDING_EXTENDED_ADDRESSES: 18 B, doubled by
+ *    @ref NRF_802154_ACK_DATA_HASH_ENABLED,
+ *  - @ref NRF_802154_SECURITY_KEY_STORAGE_SIZE: 36 B,
+ *  - @ref NRF_802154_TX_WORK_BUFFERS: 128 B,
+ *  - @ref NRF_802154_TX_QUEUE_DEPTH: 24 B,
+ *  - @ref NRF_802154_INDIRECT_TX_QUEUE_DEPTH: 40 B,
+ *  - @ref NRF_802154_ANT_DIV_PEER_TABLE_SIZE: 12 B,
+ *  - @ref NRF_802154_DELAYED_TRX_TIMELINE_SIZE: 32 B.
+ *
+ * Static RAM of the driver, excluding the service layer, with the remaining options left at their
+ * defaults, as measured with a 64-bit host build. A 32-bit target uses slightly less.
+ *
+ * | Profile                                    | Static RAM |
+ * |--------------------------------------------|------------|
+ * | @ref NRF_802154_CONFIG_PROFILE_END_DEVICE  | 3.6 kB     |
+ * | @ref NRF_802154_CONFIG_PROFILE_ROUTER      | 5.5 kB     |
+ * | @ref NRF_802154_CONFIG_PROFILE_COORDINATOR | 11.5 kB    |
+ * | @ref NRF_802154_CONFIG_PROFILE_CUSTOM      | 6.4 kB     |
+ *
+ * The exact RAM consumption of a build is reported by the linker map file of the application.
+ */
+
+/** @brief Every option uses its own default value. */
+#define NRF_802154_CONFIG_PROFILE_CUSTOM      0
+
+/** @brief Low-RAM end device that polls its parent and does not keep data for other nodes. */
+#define NRF_802154_CONFIG_PROFILE_END_DEVICE  1
+
+/** @brief Router that forwards traffic and transmits to sleepy children in CSL windows. */
+#define NRF_802154_CONFIG_PROFILE_ROUTER      2
+
+/** @brief Coordinator or border router that serves many children and sends beacons. */
+#define NRF_802154_CONFIG_PROFILE_COORDINATOR 3
+
+/**
+ * @def NRF_802154_CONFIG_PROFILE
+ *
+ * Memory footprint profile of the driver. One of @ref NRF_802154_CONFIG_PROFILE_CUSTOM,
+ * @ref NRF_802154_CONFIG_PROFILE_END_DEVICE, @ref NRF_802154_CONFIG_PROFILE_ROUTER and
+ * @ref NRF_802154_CONFIG_PROFILE_COORDINATOR.
+ *
+ */
+#ifndef NRF_802154_CONFIG_PROFILE
+#define NRF_802154_CONFIG_PROFILE NRF_802154_CONFIG_PROFILE_CUSTOM
+#endif
+
+#if NRF_802154_CONFIG_PROFILE == NRF_802154_CONFIG_PROFILE_END_DEVICE
+
+#ifndef NRF_802154_RX_BUFFERS
+#define NRF_802154_RX_BUFFERS 4
+#endif
+#ifndef NRF_802154_RX_BUFFERS_SHORT
+#define NRF_802154_RX_BUFFERS_SHORT 2
+#endif
+#ifndef NRF_802154_PENDING_SHORT_ADDRESSES
+#define NRF_802154_PENDING_SHORT_ADDRESSES 1
+#endif
+#ifndef NRF_802154_PENDING_EXTENDED_ADDRESSES
+#define NRF_802154_PENDING_EXTENDED_ADDRESSES 1
+#endif
+#ifndef NRF_802154_DELAYED_TRX_ENABLED
+#define NRF_802154_DELAYED_TRX_ENABLED 0
+#endif
+#ifndef NRF_802154_CSL_RECEIVER_ENABLED
+#define NRF_802154_CSL_RECEIVER_ENABLED 0
+#endif
+#ifndef NRF_802154_BEACON_TX_ENABLED
+#define NRF_802154_BEACON_TX_ENABLED 0
+#endif
+#ifndef NRF_802154_ANT_DIV_PEER_TABLE_ENABLED
+#define NRF_802154_ANT_DIV_PEER_TABLE_ENABLED 0
+#endif
+#ifndef NRF_802154_TX_QUEUE_ENABLED
+#define NRF_802154_TX_QUEUE_ENABLED 0
+#endif
+#ifndef NRF_802154_INDIRECT_TX_ENABLED
+#define NRF_802154_INDIRECT_TX_ENABLED 0
+#endif
+#ifndef NRF_802154_ENH_ACK_TEMPLATES_ENABLED
+#define NRF_802154_ENH_ACK_TEMPLATES_ENABLED 0
+#endif
+
+#elif NRF_802154_CONFIG_PROFILE == NRF_802154_CONFIG_PROFILE_ROUTER
+
+#ifndef NRF_802154_RX_BUFFERS
+#define NRF_802154_RX_BUFFERS 8
+#endif
+#ifndef NRF_802154_RX_BUFFERS_SHORT
+#define NRF_802154_RX_BUFFERS_SHORT 4
+#endif
+#ifndef NRF_802154_PENDING_SHORT_ADDRESSES
+#define NRF_802154_PENDING_SHORT_ADDRESSES 10
+#endif
+#ifndef NRF_802154_PENDING_EXTENDED_ADDRESSES
+#define NRF_802154_PENDING_EXTENDED_ADDRESSES 10
+#endif
+#ifndef NRF_802154_CSL_RECEIVER_ENABLED
+#define NRF_802154_CSL_RECEIVER_ENABLED 0
+#endif
+#ifndef NRF_802154_BEACON_TX_ENABLED
+#define NRF_802154_BEACON_TX_ENABLED 0
+#endif
+#ifndef NRF_802154_ANT_DIV_PEER_TABLE_ENABLED
+#define NRF_802154_ANT_DIV_PEER_TABLE_ENABLED 0
+#endif
+#ifndef NRF_802154_TX_QUEUE_ENABLED
+#define NRF_802154_TX_QUEUE_ENABLED 1
+#endif
+#ifndef NRF_802154_TX_QUEUE_DEPTH
+#define NRF_802154_TX_QUEUE_DEPTH 4
+#endif
+#ifndef NRF_802154_INDIRECT_TX_ENABLED
+#define NRF_802154_INDIRECT_TX_ENABLED 0
+#endif
+
+#elif NRF_802154_CONFIG_PROFILE == NRF_802154_CONFIG_PROFILE_COORDINATOR
+
+#ifndef NRF_802154_RX_BUFFERS
+#define NRF_802154_RX_BUFFERS 16
+#endif
+#ifndef NRF_802154_RX_BUFFERS_SHORT
+#define NRF_802154_RX_BUFFERS_SHORT 8
+#endif
+#ifndef NRF_802154_PENDING_SHORT_ADDRESSES
+#define NRF_802154_PENDING_SHORT_ADDRESSES 32
+#endif
+#ifndef NRF_802154_PENDING_EXTENDED_ADDRESSES
+#define NRF_802154_PENDING_EXTENDED_ADDRESSES 32
+#endif
+#ifndef NRF_802154_ACK_DATA_HASH_ENABLED
+#define NRF_802154_ACK_DATA_HASH_ENABLED 1
+#endif
+#ifndef NRF_802154_CSL_RECEIVER_ENABLED
+#define NRF_802154_CSL_RECEIVER_ENABLED 0
+#endif
+#if !defined(CONFIG_NRF_802154_SL_OPENSOURCE)
+#ifndef NRF_802154_BEACON_TX_ENABLED
+#define NRF_802154_BEACON_TX_ENABLED 1
+#endif
+#ifndef NRF_802154_DELAYED_TRX_TIMELINE_ENABLED
+#define NRF_802154_DELAYED_TRX_TIMELINE_ENABLED 1
+#endif
+#endif
+#ifndef NRF_802154_ANT_DIV_PEER_TABLE_ENABLED
+#define NRF_802154_ANT_DIV_PEER_TABLE_ENABLED 1
+#endif
+#ifndef NRF_802154_ANT_DIV_PEER_TABLE_SIZE
+#define NRF_802154_ANT_DIV_PEER_TABLE_SIZE 32
+#endif
+#ifndef NRF_802154_TX_QUEUE_ENABLED
+#define NRF_802154_TX_QUEUE_ENABLED 1
+#endif
+#ifndef NRF_802154_TX_QUEUE_DEPTH
+#define NRF_802154_TX_QUEUE_DEPTH 8
+#endif
+#ifndef NRF_802154_INDIRECT_TX_ENABLED
+#define NRF_802154_INDIRECT_TX_ENABLED 1
+#endif
+#ifndef NRF_802154_INDIRECT_TX_QUEUE_DEPTH
+#define NRF_802154_INDIRECT_TX_QUEUE_DEPTH 16
+#endif
+
+#elif NRF_802154_CONFIG_PROFILE != NRF_802154_CONFIG_PROFILE_CUSTOM
+#error "Unsupported NRF_802154_CONFIG_PROFILE"
+#endif
+
+/**
+ * @}
  * @defgroup nrf_802154_config_radio Radio driver configuration
  * @{
  */
@@ -148,6 +329,26 @@ extern "C" {
 #define NRF_802154_SWI_PRIORITY 4
 #endif
 
+/**
+ * @def NRF_802154_NOTIFICATION_HYBRID_ENABLED
+ *
+ * If notifications are to be called directly when the driver already runs at the priority of
+ * the software interrupt used for notifications.
+ *
+ * When this option is enabled, a notification issued at the priority of the software interrupt
+ * is passed to the next higher layer right away instead of being deferred to the software
+ * interrupt. This saves one interrupt and queue hop per notification. Notifications issued
+ * at any other priority, issued while previous notifications are pending, or issued from within
+ * a notification are deferred as usual.
+ *
+ * @note This option is applicable only if notifications are passed through the software
+ *       interrupt.
+ *
+ */
+#ifndef NRF_802154_NOTIFICATION_HYBRID_ENABLED
+#define NRF_802154_NOTIFICATION_HYBRID_ENABLED 0
+#endif
+
 /**
  * @def NRF_802154_ECB_PRIORITY
  *
@@ -158,6 +359,16 @@ extern "C" {
 #define NRF_802154_ECB_PRIORITY 3
 #endif
 
+/**
+ * @def NRF_802154_CCM_PRIORITY
+ *
+ * Interrupt priority for CCM peripheral used for frame encryption.
+ *
+ */
+#ifndef NRF_802154_CCM_PRIORITY
+#define NRF_802154_CCM_PRIORITY 3
+#endif
+
 /**
  * @def NRF_802154_USE_RAW_API
  *
@@ -175,7 +386,8 @@ extern "C" {
 /**
  * @def NRF_802154_PENDING_SHORT_ADDRESSES
  *
- * The number of slots containing short addresses of nodes for which the pending data is stored.
+ * The number of slots containing short addresses of nodes for which the pending data or
+ * the Enh-Ack IE data is stored.
  *
  */
 #ifndef NRF_802154_PENDING_SHORT_ADDRESSES
@@ -185,13 +397,46 @@ extern "C" {
 /**
  * @def NRF_802154_PENDING_EXTENDED_ADDRESSES
  *
- * The number of slots containing extended addresses of nodes for which the pending data is stored.
+ * The number of slots containing extended addresses of nodes for which the pending data or
+ * the Enh-Ack IE data is stored.
  *
  */
 #ifndef NRF_802154_PENDING_EXTENDED_ADDRESSES
 #define NRF_802154_PENDING_EXTENDED_ADDRESSES 10
 #endif
 
+/**
+ * @def NRF_802154_ACK_DATA_HASH_ENABLED
+ *
+ * If set to 1, the ACK data list that stores addresses for the pending bit and IE data uses
+ * an open-addressing hash table instead of sorted arrays. Adding, removing and searching for
+ * an address take constant time on average, which is beneficial when
+ * @ref NRF_802154_PENDING_SHORT_ADDRESSES or @ref NRF_802154_PENDING_EXTENDED_ADDRESSES are large.
+ *
+ * @note The hash table reserves twice as many slots as the number of addresses it can store,
+ *       which doubles the memory used by the ACK data list.
+ *
+ */
+#ifndef NRF_802154_ACK_DATA_HASH_ENABLED
+#define NRF_802154_ACK_DATA_HASH_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_SECONDARY_IDENTITIES
+ *
+ * The number of secondary identities of the device. Each secondary identity consists of a PAN ID,
+ * a short address and an extended address, and is accepted by the frame filter in addition to
+ * the primary identity configured with @ref nrf_802154_pan_id_set,
+ * @ref nrf_802154_short_address_set and @ref nrf_802154_extended_address_set.
+ *
+ * @note Every configured secondary identity is checked in the RADIO IRQ handler for each received
+ *       frame.
+ *
+ */
+#ifndef NRF_802154_SECONDARY_IDENTITIES
+#define NRF_802154_SECONDARY_IDENTITIES 0
+#endif
+
 /**
  * @def NRF_802154_RX_BUFFERS
  *
@@ -202,6 +447,54 @@ extern "C" {
 #define NRF_802154_RX_BUFFERS 16
 #endif
 
+/**
+ * @def NRF_802154_RX_BUFFERS_SHORT
+ *
+ * The number of short buffers that hold received frames with a PSDU of at most
+ * @ref NRF_802154_RX_BUFFER_SHORT_PSDU_SIZE bytes.
+ *
+ * The RADIO peripheral reads the address of the receive buffer before the PHR is received, so
+ * frames are always received into one of @ref NRF_802154_RX_BUFFERS full-size buffers. A short
+ * frame is moved to a free short buffer as soon as it is received and its full-size buffer is
+ * returned to the receiver. Short frames like ACKs, data requests or short data frames then do
+ * not withhold full-size buffers while they are processed by the higher layer.
+ *
+ * Up to @ref NRF_802154_RX_BUFFERS + @ref NRF_802154_RX_BUFFERS_SHORT received frames can be
+ * passed to the higher layer at a time.
+ *
+ */
+#ifndef NRF_802154_RX_BUFFERS_SHORT
+#define NRF_802154_RX_BUFFERS_SHORT 0
+#endif
+
+/**
+ * @def NRF_802154_RX_BUFFER_SHORT_PSDU_SIZE
+ *
+ * The maximum length of the PSDU of a frame held by a short receive buffer.
+ *
+ * @note This option is used only if @ref NRF_802154_RX_BUFFERS_SHORT is greater than 0.
+ *
+ */
+#ifndef NRF_802154_RX_BUFFER_SHORT_PSDU_SIZE
+#define NRF_802154_RX_BUFFER_SHORT_PSDU_SIZE 31
+#endif
+
+/**
+ * @def NRF_802154_FILTER_STAGED_ENABLED
+ *
+ * If set to 1, the destination PAN ID of a received frame is verified in a separate bit counter
+ * match stage, before the destination address is received. Reception of a frame destined to a
+ * foreign PAN is then terminated up to 8 bytes earlier, at the cost of one more bit counter
+ * interrupt for every frame that is received from the node's own PAN.
+ *
+ * @note The additional stage is skipped in the promiscuous mode and for frames that do not
+ *       contain both the destination PAN ID and the destination address.
+ *
+ */
+#ifndef NRF_802154_FILTER_STAGED_ENABLED
+#define NRF_802154_FILTER_STAGED_ENABLED 0
+#endif
+
 /**
  * @def NRF_802154_NOTIFY_CRCERROR
  *
@@ -241,6 +534,66 @@ extern "C" {
 #endif
 #endif
 
+/**
+ * @def NRF_802154_DELAYED_TRX_TIMELINE_ENABLED
+ *
+ * If the timeline of delayed transmissions and receptions is available. The timeline allows
+ * scheduling many future operations at once with @ref nrf_802154_timeline_schedule.
+ * It requires @ref NRF_802154_DELAYED_TRX_ENABLED.
+ *
+ */
+#ifndef NRF_802154_DELAYED_TRX_TIMELINE_ENABLED
+#define NRF_802154_DELAYED_TRX_TIMELINE_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_DELAYED_TRX_TIMELINE_SIZE
+ *
+ * Maximum number of operations held by the timeline of delayed transmissions and receptions.
+ * Operations already handed over to the delayed transmission and reception window features
+ * do not count toward this limit.
+ *
+ */
+#ifndef NRF_802154_DELAYED_TRX_TIMELINE_SIZE
+#define NRF_802154_DELAYED_TRX_TIMELINE_SIZE 16
+#endif
+
+/**
+ * @def NRF_802154_SKIPLIST_LEVELS
+ *
+ * Number of levels of the ordered skip lists used by the driver, such as the timeline of delayed
+ * transmissions and receptions. Ordered insertion and removal take logarithmic time for up to
+ * 4^NRF_802154_SKIPLIST_LEVELS items. Each level costs one pointer in every list item.
+ *
+ */
+#ifndef NRF_802154_SKIPLIST_LEVELS
+#define NRF_802154_SKIPLIST_LEVELS 4
+#endif
+
+/**
+ * @def NRF_802154_CSL_RECEIVER_ENABLED
+ *
+ * If the autonomous CSL receiver is available. The CSL receiver opens CSL sample windows
+ * periodically without the involvement of the higher layer. See
+ * @ref nrf_802154_csl_receiver_start. It requires @ref NRF_802154_DELAYED_TRX_ENABLED.
+ *
+ */
+#ifndef NRF_802154_CSL_RECEIVER_ENABLED
+#define NRF_802154_CSL_RECEIVER_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_BEACON_TX_ENABLED
+ *
+ * If the autonomous beacon transmitter is available. The beacon transmitter sends a beacon
+ * registered by the higher layer periodically without the involvement of the higher layer. See
+ * @ref nrf_802154_beacon_tx_start. It requires @ref NRF_802154_DELAYED_TRX_ENABLED.
+ *
+ */
+#ifndef NRF_802154_BEACON_TX_ENABLED
+#define NRF_802154_BEACON_TX_ENABLED 0
+#endif
+
 /**
  * @def NRF_802154_TEST_MODES_ENABLED
  *
@@ -263,6 +616,147 @@ extern "C" {
 #define NRF_802154_PAN_COORD_GET_ENABLED 0
 #endif
 
+/**
+ * @def NRF_802154_TX_POWER_SPLIT_CACHE_ENABLED
+ *
+ * Enables caching of the transmit power split into components for each channel.
+ *
+ * When this option is enabled, the driver stores the result of the transmit power split for
+ * the last power requested on each channel, so that preparing a transmission with the same
+ * power does not need to consult the FEM calibration data again. The cache is invalidated by
+ * @ref nrf_802154_tx_power_set. If the FEM configuration is changed at run time, the cache must
+ * be invalidated with @ref nrf_802154_tx_power_split_cache_invalidate.
+ *
+ */
+#ifndef NRF_802154_TX_POWER_SPLIT_CACHE_ENABLED
+#define NRF_802154_TX_POWER_SPLIT_CACHE_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_VERIFY_PERIPHS_ALLOC_AGAINST_NRFX
+ *
+ * Verifies at build time that nrfx driver instances enabled in nrfx_config.h do not use
+ * the TIMER, RTC and EGU instances reserved by the driver.
+ *
+ * Such an nrfx instance cannot be used next to the driver, while its control block still takes
+ * static RAM. When this option is enabled, the build fails with an error for every peripheral
+ * type with an overlapping instance.
+ */
+#ifndef NRF_802154_VERIFY_PERIPHS_ALLOC_AGAINST_NRFX
+#define NRF_802154_VERIFY_PERIPHS_ALLOC_AGAINST_NRFX 0
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_fem FEM timing configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_FEM_RX_READY_OFFSET_US
+ *
+ * Offset, in microseconds, of the moment at which the LNA must be ready for a reception or
+ * an energy detection, relative to the end of the RADIO ramp up.
+ *
+ * The FEM implementation activates the LNA ahead of that moment by its own settling time. A
+ * positive offset shortens the time the LNA is on before the receiver is able to use it, while
+ * a negative one adds margin for a FEM that settles slower than specified.
+ *
+ */
+#ifndef NRF_802154_FEM_RX_READY_OFFSET_US
+#define NRF_802154_FEM_RX_READY_OFFSET_US 0
+#endif
+
+/**
+ * @def NRF_802154_FEM_TX_READY_OFFSET_US
+ *
+ * Offset, in microseconds, of the moment at which the PA must be ready for a frame transmission
+ * without CCA, relative to the end of the RADIO ramp up.
+ *
+ * See @ref NRF_802154_FEM_RX_READY_OFFSET_US.
+ *
+ */
+#ifndef NRF_802154_FEM_TX_READY_OFFSET_US
+#define NRF_802154_FEM_TX_READY_OFFSET_US 0
+#endif
+
+/**
+ * @def NRF_802154_FEM_ACK_TX_READY_OFFSET_US
+ *
+ * Offset, in microseconds, of the moment at which the PA must be ready for an ACK transmission,
+ * relative to the end of the RADIO ramp up.
+ *
+ * See @ref NRF_802154_FEM_RX_READY_OFFSET_US.
+ *
+ */
+#ifndef NRF_802154_FEM_ACK_TX_READY_OFFSET_US
+#define NRF_802154_FEM_ACK_TX_READY_OFFSET_US 0
+#endif
+
+/**
+ * @def NRF_802154_FEM_CCA_READY_OFFSET_US
+ *
+ * Offset, in microseconds, of the moment at which the LNA must be ready for a CCA, either
+ * standalone or preceding a transmission, relative to the end of the RADIO ramp up.
+ *
+ * See @ref NRF_802154_FEM_RX_READY_OFFSET_US.
+ *
+ */
+#ifndef NRF_802154_FEM_CCA_READY_OFFSET_US
+#define NRF_802154_FEM_CCA_READY_OFFSET_US 0
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_timing_model Procedure timing model configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_TIMING_MODEL_ENABLED
+ *
+ * Configures if the durations of transmissions and CCAs requested from the radio scheduler
+ * are calibrated on the device. See @ref nrf_802154_timing_model.
+ *
+ */
+#ifndef NRF_802154_TIMING_MODEL_ENABLED
+#define NRF_802154_TIMING_MODEL_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_TIMING_MODEL_MIN_SAMPLES
+ *
+ * Configures the number of measurements of a procedure needed before the measured overhead is
+ * used instead of the static one.
+ *
+ */
+#ifndef NRF_802154_TIMING_MODEL_MIN_SAMPLES
+#define NRF_802154_TIMING_MODEL_MIN_SAMPLES 16U
+#endif
+
+/**
+ * @def NRF_802154_TIMING_MODEL_MARGIN_US
+ *
+ * Configures the margin in microseconds added to the largest measured overhead of a procedure.
+ *
+ */
+#ifndef NRF_802154_TIMING_MODEL_MARGIN_US
+#define NRF_802154_TIMING_MODEL_MARGIN_US 4U
+#endif
+
+/**
+ * @def NRF_802154_TIMING_MODEL_TIMESTAMP_GET
+ *
+ * Expression providing the 32-bit timestamp of the procedure boundaries in microseconds.
+ * By default the lower word of the current time of the SL timer is used. A source with
+ * a resolution coarser than a few microseconds only inflates the measured overheads, in which
+ * case the static ones are kept.
+ *
+ */
+#ifndef NRF_802154_TIMING_MODEL_TIMESTAMP_GET
+#define NRF_802154_TIMING_MODEL_TIMESTAMP_GET() ((uint32_t)nrf_802154_sl_timer_current_time_get())
+#endif
+
 /**
  * @}
  * @defgroup nrf_802154_config_csma CSMA/CA procedure configuration
@@ -334,6 +828,26 @@ extern "C" {
 #define NRF_802154_CSMA_CA_MAX_CSMA_BACKOFFS_DEFAULT 4
 #endif
 
+/**
+ * @def NRF_802154_CSMA_CA_MAX_FRAME_RETRIES_DEFAULT
+ *
+ * The default maximum number of retransmissions performed by the driver after the transmission
+ * of a frame requesting an ACK fails because no valid ACK was received (see IEEE 802.15.4-2015:
+ * 6.7.4.3, macMaxFrameRetries).
+ *
+ * Each retransmission is preceded by a new CSMA-CA procedure. The higher layer is notified
+ * only about the final outcome of the transmission.
+ *
+ * @note The maximum number of frame retries may be changed from default by calling the
+ *       @ref nrf_802154_csma_ca_max_frame_retries_set function.
+ * @note Retransmissions are performed only for frames transmitted with
+ *       @ref nrf_802154_transmit_csma_ca_raw.
+ *
+ */
+#ifndef NRF_802154_CSMA_CA_MAX_FRAME_RETRIES_DEFAULT
+#define NRF_802154_CSMA_CA_MAX_FRAME_RETRIES_DEFAULT 0
+#endif
+
 /**
  * @def NRF_802154_CSMA_CA_WAIT_FOR_TIMESLOT
  *
@@ -351,6 +865,35 @@ extern "C" {
 #define NRF_802154_CSMA_CA_WAIT_FOR_TIMESLOT 1
 #endif
 
+/**
+ * @def NRF_802154_CSMA_CA_COEX_LEAD_TIME_US
+ *
+ * Time in microseconds before the end of a CSMA-CA backoff period at which the transmit request
+ * is raised to the Coex arbiter in the @ref NRF_802154_COEX_TX_REQUEST_MODE_PREDICTIVE mode.
+ * It should cover the grant latency of the arbiter, so that the grant is already present
+ * when the CCA starts.
+ *
+ */
+#ifndef NRF_802154_CSMA_CA_COEX_LEAD_TIME_US
+#define NRF_802154_CSMA_CA_COEX_LEAD_TIME_US 200
+#endif
+
+/**
+ * @def NRF_802154_CSMA_CA_ADAPTIVE_BE_ENABLED
+ *
+ * Enables adapting the initial backoff exponent of the CSMA-CA procedure to the channel occupancy.
+ *
+ * The driver keeps a running ratio of CCA attempts of the CSMA-CA procedure that found the channel
+ * busy. When this option is enabled, each CSMA-CA procedure starts with a backoff exponent
+ * scaled between macMinBe and macMaxBe proportionally to that ratio, instead of starting with
+ * macMinBe. The ratio is available through @ref nrf_802154_stat_channel_occupancy_get regardless
+ * of this option.
+ *
+ */
+#ifndef NRF_802154_CSMA_CA_ADAPTIVE_BE_ENABLED
+#define NRF_802154_CSMA_CA_ADAPTIVE_BE_ENABLED 0
+#endif
+
 /**
  * @}
  * @defgroup nrf_802154_config_timeout ACK timeout feature configuration
@@ -388,16 +931,59 @@ extern "C" {
 #endif
 
 /**
- * @def NRF_802154_MAX_ACK_IE_SIZE
+ * @def NRF_802154_ACK_TIMEOUT_HW_WINDOW_ENABLED
  *
- * The maximum supported size of the 802.15.4-2015 IE header and content fields in an Enh-Ack.
+ * Indicates whether the ACK wait window is to be enforced by the hardware. If enabled, the TIMER
+ * used by the driver disables the receiver through (D)PPI when the ACK timeout expires, unless
+ * an ACK has started being received. The radio stops listening at the end of the window regardless
+ * of the interrupt latency. The timeout is still reported by the ACK timeout feature.
+ *
+ * @note This option requires @ref NRF_802154_ACK_TIMEOUT_ENABLED.
  *
  */
-#ifndef NRF_802154_MAX_ACK_IE_SIZE
-#define NRF_802154_MAX_ACK_IE_SIZE 8
+#ifndef NRF_802154_ACK_TIMEOUT_HW_WINDOW_ENABLED
+#define NRF_802154_ACK_TIMEOUT_HW_WINDOW_ENABLED 0
 #endif
 
-/**
+#if NRF_802154_ACK_TIMEOUT_HW_WINDOW_ENABLED && !NRF_802154_ACK_TIMEOUT_ENABLED
+#error "NRF_802154_ACK_TIMEOUT_HW_WINDOW_ENABLED requires NRF_802154_ACK_TIMEOUT_ENABLED"
+#endif
+
+/**
+ * @def NRF_802154_MAX_ACK_IE_SIZE
+ *
+ * The maximum supported size of the 802.15.4-2015 IE header and content fields in an Enh-Ack.
+ *
+ */
+#ifndef NRF_802154_MAX_ACK_IE_SIZE
+#define NRF_802154_MAX_ACK_IE_SIZE 8
+#endif
+
+/**
+ * @def NRF_802154_ENH_ACK_TEMPLATES_ENABLED
+ *
+ * If set to 1, the Enh-Ack generator keeps a cache of Enh-Ack frames already prepared for recent
+ * peers. When a frame from a cached peer is received, the Enh-Ack is copied from the cache and
+ * only the sequence number, the frame counter, and the MIC are updated.
+ *
+ */
+#ifndef NRF_802154_ENH_ACK_TEMPLATES_ENABLED
+#define NRF_802154_ENH_ACK_TEMPLATES_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_ENH_ACK_TEMPLATES_NUM
+ *
+ * The number of Enh-Ack templates stored by the Enh-Ack generator.
+ *
+ * @note This option is used only when @ref NRF_802154_ENH_ACK_TEMPLATES_ENABLED is set to 1.
+ *
+ */
+#ifndef NRF_802154_ENH_ACK_TEMPLATES_NUM
+#define NRF_802154_ENH_ACK_TEMPLATES_NUM 4
+#endif
+
+/**
  * @}
  * @defgroup nrf_802154_config_ifs Interframe spacing feature configuration
  * @{
@@ -416,6 +1002,184 @@ extern "C" {
 #endif
 #endif
 
+/**
+ * @def NRF_802154_IFS_HW_TRIGGER_ENABLED
+ *
+ * Indicates whether the interframe spacing is to be enforced by the hardware. If enabled, a frame
+ * that must wait for the IFS is prepared for transmission right away and its radio ramp up is
+ * triggered through (D)PPI by a timer compare. The compare is set relative to the end of the
+ * previous frame captured by the timer coordinator, so the gap does not depend on the interrupt
+ * latency.
+ *
+ * @note This option requires @ref NRF_802154_IFS_ENABLED and
+ *       @ref NRF_802154_FRAME_TIMESTAMP_ENABLED.
+ *
+ */
+#ifndef NRF_802154_IFS_HW_TRIGGER_ENABLED
+#define NRF_802154_IFS_HW_TRIGGER_ENABLED 0
+#endif
+
+#if NRF_802154_IFS_HW_TRIGGER_ENABLED && \
+    (!NRF_802154_IFS_ENABLED || !NRF_802154_FRAME_TIMESTAMP_ENABLED)
+#error \
+    "NRF_802154_IFS_HW_TRIGGER_ENABLED requires NRF_802154_IFS_ENABLED and NRF_802154_FRAME_TIMESTAMP_ENABLED"
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_ant_div_peer Per-peer antenna selection configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_ANT_DIV_PEER_TABLE_ENABLED
+ *
+ * Indicates whether the per-peer antenna selection feature is to be enabled in the driver.
+ *
+ * When this feature is enabled, the driver remembers the antenna selected as the best one by
+ * the antenna diversity module for the last frame received from each peer. A frame transmitted
+ * when the antenna diversity TX mode is @ref NRF_802154_SL_ANT_DIV_MODE_MANUAL uses the antenna
+ * remembered for its destination address. The antenna selected manually is used for peers whose
+ * best antenna is not known.
+ *
+ */
+#ifndef NRF_802154_ANT_DIV_PEER_TABLE_ENABLED
+#define NRF_802154_ANT_DIV_PEER_TABLE_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_ANT_DIV_PEER_TABLE_SIZE
+ *
+ * Number of peers for which the best antenna is remembered. When the table is full, the entry
+ * that was updated least recently is replaced.
+ *
+ */
+#ifndef NRF_802154_ANT_DIV_PEER_TABLE_SIZE
+#define NRF_802154_ANT_DIV_PEER_TABLE_SIZE 16
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_tx_queue Transmit queue feature configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_TX_QUEUE_ENABLED
+ *
+ * Indicates whether the transmit queue feature is to be enabled in the driver. The feature allows
+ * submitting several frames with @ref nrf_802154_transmit_raw_queued. The frames are transmitted
+ * one after another without waiting for the higher layer between them.
+ *
+ */
+#ifndef NRF_802154_TX_QUEUE_ENABLED
+#define NRF_802154_TX_QUEUE_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_TX_QUEUE_DEPTH
+ *
+ * Maximum number of frames held by the transmit queue, including the frame being transmitted.
+ *
+ */
+#ifndef NRF_802154_TX_QUEUE_DEPTH
+#define NRF_802154_TX_QUEUE_DEPTH 4
+#endif
+
+/**
+ * @def NRF_802154_TX_WORK_BUFFERS
+ *
+ * Number of work buffers in which frames are modified before transmission. Each frame keeps
+ * its work buffer until its transmission is done, so with more than one buffer the next frame
+ * can be prepared without overwriting the contents prepared for the current one.
+ *
+ */
+#ifndef NRF_802154_TX_WORK_BUFFERS
+#define NRF_802154_TX_WORK_BUFFERS (NRF_802154_TX_QUEUE_ENABLED ? 2 : 1)
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_indirect_tx Indirect transmission feature configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_INDIRECT_TX_ENABLED
+ *
+ * Indicates whether the indirect transmission feature is to be enabled in the driver. The feature
+ * allows the higher layer to hand over frames for sleepy devices with
+ * @ref nrf_802154_transmit_raw_indirect. The driver transmits such a frame by itself as soon as
+ * it acknowledges a frame from the destination of the queued frame with the pending bit set.
+ *
+ */
+#ifndef NRF_802154_INDIRECT_TX_ENABLED
+#define NRF_802154_INDIRECT_TX_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_INDIRECT_TX_QUEUE_DEPTH
+ *
+ * Maximum number of frames held by the indirect transmission queue.
+ *
+ */
+#ifndef NRF_802154_INDIRECT_TX_QUEUE_DEPTH
+#define NRF_802154_INDIRECT_TX_QUEUE_DEPTH 8
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_wakeup_tx Wake-up frame transmission feature configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_WAKEUP_TX_ENABLED
+ *
+ * Indicates whether the wake-up frame transmission feature is to be enabled in the driver.
+ * The feature allows the higher layer to start a train of wake-up frames with
+ * @ref nrf_802154_transmit_raw_wakeup_train. The driver transmits the frames back-to-back
+ * and updates the Rendezvous Time IE of each frame before it is sent.
+ *
+ * @note This feature requires @ref NRF_802154_IE_WRITER_ENABLED to be enabled.
+ *
+ */
+#ifndef NRF_802154_WAKEUP_TX_ENABLED
+#define NRF_802154_WAKEUP_TX_ENABLED 0
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_rx_metadata Received frame metadata configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_RX_METADATA_ENABLED
+ *
+ * Indicates whether the driver is to deliver received frames with their metadata through
+ * @ref nrf_802154_received_ext. The metadata is computed once, when the frame is received,
+ * and stored with the receive buffer, so the higher layer does not need to parse the frame again.
+ *
+ */
+#ifndef NRF_802154_RX_METADATA_ENABLED
+#define NRF_802154_RX_METADATA_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_RX_HEADER_NOTIFY_ENABLED
+ *
+ * Indicates whether the driver is to notify the higher layer through
+ * @ref nrf_802154_rx_header_received as soon as the destination addressing fields of a frame
+ * being received are parsed and accepted by the filter. The notification is issued while the rest
+ * of the frame is still being received, so the higher layer can, for example, start a route lookup
+ * before the frame ends.
+ *
+ */
+#ifndef NRF_802154_RX_HEADER_NOTIFY_ENABLED
+#define NRF_802154_RX_HEADER_NOTIFY_ENABLED 0
+#endif
+
 /**
  * @}
  * @defgroup nrf_802154_config_transmission Transmission start notification feature configuration
@@ -454,6 +1218,173 @@ extern "C" {
 #define NRF_802154_STATS_COUNT_RECEIVED_PREAMBLES 1
 #endif
 
+/**
+ * @def NRF_802154_STATS_HISTOGRAMS_ENABLED
+ *
+ * Configures if the driver collects latency histograms. The histograms are stored in
+ * @ref nrf_802154_stat_histograms_t and can be retrieved by a call to
+ * @ref nrf_802154_stat_histograms_get.
+ */
+#ifndef NRF_802154_STATS_HISTOGRAMS_ENABLED
+#define NRF_802154_STATS_HISTOGRAMS_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_STATS_HISTOGRAMS_TIME_GET
+ *
+ * Expression providing the current time in microseconds used to measure durations collected
+ * in the latency histograms. By default the current time of the High Precision Timer is used.
+ */
+#ifndef NRF_802154_STATS_HISTOGRAMS_TIME_GET
+#define NRF_802154_STATS_HISTOGRAMS_TIME_GET() nrf_802154_hp_timer_current_time_get()
+#endif
+
+/**
+ * @def NRF_802154_STATS_HISTOGRAMS_CYCLES_GET
+ *
+ * Expression providing the current value of a CPU cycle counter used to measure durations of
+ * time-critical handlers collected in the latency histograms. By default the cycle counter of
+ * the DWT unit is used, which is enabled during the driver initialization when
+ * @ref NRF_802154_STATS_HISTOGRAMS_ENABLED is set.
+ */
+#ifndef NRF_802154_STATS_HISTOGRAMS_CYCLES_GET
+#define NRF_802154_STATS_HISTOGRAMS_CYCLES_GET() (DWT->CYCCNT)
+#endif
+
+/**
+ * @def NRF_802154_STATS_RADIO_TIME_ENABLED
+ *
+ * Configures if the driver accounts the time the radio spends receiving, transmitting, ramping
+ * up and idle on each channel. The accumulated times can be retrieved by a call to
+ * @ref nrf_802154_stat_radio_times_get.
+ */
+#ifndef NRF_802154_STATS_RADIO_TIME_ENABLED
+#define NRF_802154_STATS_RADIO_TIME_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_STATS_TIMESLOT_ENABLED
+ *
+ * Configures if the driver collects statistics of the timeslots granted by the Radio Scheduler,
+ * such as the number of preemptions and the time the driver waited for the radio. This is useful
+ * in multiprotocol builds. The statistics can be retrieved by a call to
+ * @ref nrf_802154_stat_timeslots_get.
+ */
+#ifndef NRF_802154_STATS_TIMESLOT_ENABLED
+#define NRF_802154_STATS_TIMESLOT_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_STATS_CRITICAL_SECTION_ENABLED
+ *
+ * Configures if the driver measures the durations of its critical sections, during which the
+ * RADIO IRQ is disabled. The longest critical section is reported together with the caller that
+ * entered it, which helps to find requests and notifications that risk missing ACK deadlines.
+ * The statistics can be retrieved by a call to @ref nrf_802154_stat_critical_sections_get.
+ */
+#ifndef NRF_802154_STATS_CRITICAL_SECTION_ENABLED
+#define NRF_802154_STATS_CRITICAL_SECTION_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_STATS_CRITICAL_SECTION_CYCLES_GET
+ *
+ * Expression providing the current value of a CPU cycle counter used to measure durations of
+ * critical sections. By default the cycle counter of the DWT unit is used, which is enabled during
+ * the driver initialization when @ref NRF_802154_STATS_CRITICAL_SECTION_ENABLED is set.
+ */
+#ifndef NRF_802154_STATS_CRITICAL_SECTION_CYCLES_GET
+#define NRF_802154_STATS_CRITICAL_SECTION_CYCLES_GET() (DWT->CYCCNT)
+#endif
+
+/**
+ * @def NRF_802154_STATS_CRITICAL_SECTION_CALLER_GET
+ *
+ * Expression providing the identifier of the caller entering a critical section. It is evaluated
+ * in @ref nrf_802154_critical_section_enter and @ref nrf_802154_critical_section_forcefully_enter.
+ * By default the return address is used, which can be resolved to a function with the map file.
+ */
+#ifndef NRF_802154_STATS_CRITICAL_SECTION_CALLER_GET
+#if defined(__GNUC__)
+#define NRF_802154_STATS_CRITICAL_SECTION_CALLER_GET() \
+    ((uint32_t)(uintptr_t)__builtin_return_address(0))
+#else
+#define NRF_802154_STATS_CRITICAL_SECTION_CALLER_GET() 0U
+#endif
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_trace Event tracing configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_TRACE_ENABLED
+ *
+ * Configures if the radio core records timestamped events in the trace ring buffer.
+ * Each event costs only a few instructions and does not disable interrupts, so the tracer can
+ * be used to profile IRQ latency and state machine timing without disturbing the ACK timing.
+ */
+#ifndef NRF_802154_TRACE_ENABLED
+#define NRF_802154_TRACE_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_TRACE_BUFFER_LEN
+ *
+ * Configures the number of events stored in the trace ring buffer. When the buffer is full
+ * the oldest events are overwritten.
+ *
+ * @note This value must be a power of 2.
+ */
+#ifndef NRF_802154_TRACE_BUFFER_LEN
+#define NRF_802154_TRACE_BUFFER_LEN 256U
+#endif
+
+/**
+ * @def NRF_802154_TRACE_TIMESTAMP_GET
+ *
+ * Expression providing the 32-bit timestamp of a trace event.
+ * By default the current time of the High Precision Timer is used.
+ */
+#ifndef NRF_802154_TRACE_TIMESTAMP_GET
+#define NRF_802154_TRACE_TIMESTAMP_GET() nrf_802154_hp_timer_current_time_get()
+#endif
+
+/**
+ * @def NRF_802154_TRX_CAPTURE_ENABLED
+ *
+ * Configures if the sequence of the callbacks of the trx module is captured, together with
+ * the timestamps and the received frame contents, in a binary buffer that can be replayed
+ * against the driver in simulation. See @ref nrf_802154_trx_capture.
+ */
+#ifndef NRF_802154_TRX_CAPTURE_ENABLED
+#define NRF_802154_TRX_CAPTURE_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_TRX_CAPTURE_BUFFER_SIZE
+ *
+ * Configures the size of the capture buffer in bytes. When the buffer is full the capture stops
+ * and further records are only counted, so that the captured sequence stays contiguous.
+ *
+ * @note This value must be a multiple of 4.
+ */
+#ifndef NRF_802154_TRX_CAPTURE_BUFFER_SIZE
+#define NRF_802154_TRX_CAPTURE_BUFFER_SIZE 4096U
+#endif
+
+/**
+ * @def NRF_802154_TRX_CAPTURE_TIMESTAMP_GET
+ *
+ * Expression providing the 32-bit timestamp of a captured callback in microseconds.
+ * By default the lower word of the current time of the SL timer is used.
+ */
+#ifndef NRF_802154_TRX_CAPTURE_TIMESTAMP_GET
+#define NRF_802154_TRX_CAPTURE_TIMESTAMP_GET() ((uint32_t)nrf_802154_sl_timer_current_time_get())
+#endif
+
 /**
  * @}
  * @defgroup nrf_802154_config_security Security configuration
@@ -470,6 +1401,43 @@ extern "C" {
 #define NRF_802154_SECURITY_KEY_STORAGE_SIZE 3
 #endif
 
+/**
+ * @def NRF_802154_SECURITY_KEY_INDEX_SIZE
+ *
+ * Configures the number of buckets of the hash index used to look up keys in the Key Storage
+ * by their key ID mode and key ID. Must be a power of two. Setting it to a value close to
+ * @ref NRF_802154_SECURITY_KEY_STORAGE_SIZE keeps the lookup of a key constant-time regardless
+ * of the number of stored keys.
+ */
+#ifndef NRF_802154_SECURITY_KEY_INDEX_SIZE
+#define NRF_802154_SECURITY_KEY_INDEX_SIZE 4
+#endif
+
+/**
+ * @def NRF_802154_SECURITY_FRAME_COUNTER_RESERVATION_ENABLED
+ *
+ * Enables reservation of Global MAC Frame Counter blocks. When enabled, the driver uses the Global
+ * MAC Frame Counter only below a high-water mark confirmed by the higher layer. The driver asks
+ * for a new high-water mark through @ref nrf_802154_security_frame_counter_reservation_requested
+ * ahead of time, so that the higher layer can persist it without blocking the radio path and
+ * restore a monotonic frame counter after reset.
+ */
+#ifndef NRF_802154_SECURITY_FRAME_COUNTER_RESERVATION_ENABLED
+#define NRF_802154_SECURITY_FRAME_COUNTER_RESERVATION_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_SECURITY_FRAME_COUNTER_RESERVATION_BLOCK_SIZE
+ *
+ * Configures the number of frame counter values reserved by a single high-water mark request.
+ * A new request is made when less than half of the block remains. A larger block reduces the
+ * number of persistent storage writes at the cost of skipping more frame counter values after
+ * reset.
+ */
+#ifndef NRF_802154_SECURITY_FRAME_COUNTER_RESERVATION_BLOCK_SIZE
+#define NRF_802154_SECURITY_FRAME_COUNTER_RESERVATION_BLOCK_SIZE 1024
+#endif
+
 /**
  * @def NRF_802154_SECURITY_WRITER_ENABLED
  *
@@ -490,13 +1458,49 @@ extern "C" {
 #define NRF_802154_ENCRYPTION_ENABLED 1
 #endif
 
+/**
+ * @def NRF_802154_ENCRYPTION_ACCELERATOR_CCM
+ *
+ * Enables CCM peripheral to be used as hardware accelerator for on-the-fly AES-CCM* encryption.
+ * The whole transformation of a frame is performed by the peripheral without per-block
+ * interrupts. Requires a CCM peripheral that supports the IEEE 802.15.4 packet format.
+ */
+#ifndef NRF_802154_ENCRYPTION_ACCELERATOR_CCM
+#define NRF_802154_ENCRYPTION_ACCELERATOR_CCM 0
+#endif
+
 /**
  * @def NRF_802154_ENCRYPTION_ACCELERATOR_ECB
  *
  * Enables ECB peripheral to be used as hardware accelerator for on-the-fly AES-CCM* encryption.
+ * Enabled by default unless @ref NRF_802154_ENCRYPTION_ACCELERATOR_CCM is enabled.
  */
 #ifndef NRF_802154_ENCRYPTION_ACCELERATOR_ECB
-#define NRF_802154_ENCRYPTION_ACCELERATOR_ECB 1
+#define NRF_802154_ENCRYPTION_ACCELERATOR_ECB (!NRF_802154_ENCRYPTION_ACCELERATOR_CCM)
+#endif
+
+/**
+ * @def NRF_802154_RX_DECRYPTION_ENABLED
+ *
+ * Enables the decryption and authentication of received frames. A secured frame is processed
+ * with the key found in the security PIB before it is passed to the higher layer. The result
+ * is reported in the @c security_status field of the frame metadata and, if the frame is
+ * authentic, its MAC payload is replaced with the plaintext.
+ *
+ * @note Only frames with an extended source address are processed, because the address
+ *       of the originator is a part of the CCM* nonce.
+ * @note This option requires @ref NRF_802154_RX_METADATA_ENABLED,
+ *       @ref NRF_802154_ENCRYPTION_ENABLED and @ref NRF_802154_ENCRYPTION_ACCELERATOR_ECB.
+ */
+#ifndef NRF_802154_RX_DECRYPTION_ENABLED
+#define NRF_802154_RX_DECRYPTION_ENABLED 0
+#endif
+
+#if NRF_802154_RX_DECRYPTION_ENABLED && \
+    !(NRF_802154_RX_METADATA_ENABLED && NRF_802154_ENCRYPTION_ENABLED && \
+    NRF_802154_ENCRYPTION_ACCELERATOR_ECB)
+#error \
+    "NRF_802154_RX_DECRYPTION_ENABLED requires RX metadata, encryption and the ECB accelerator"
 #endif
 
 /**
@@ -516,6 +1520,68 @@ extern "C" {
 #define NRF_802154_IE_WRITER_ENABLED 1
 #endif
 
+/**
+ * @def NRF_802154_LINK_METRICS_SERIES_ENABLED
+ *
+ * Enables accumulation of Link Metrics Forward Tracking Series in the driver. When enabled,
+ * the driver updates the PDU count and the averaged RSSI, LQI and link margin of each configured
+ * series for every matching frame received from the series initiator, so that the higher layer
+ * does not need to inspect every frame.
+ */
+#ifndef NRF_802154_LINK_METRICS_SERIES_ENABLED
+#define NRF_802154_LINK_METRICS_SERIES_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_LINK_METRICS_SERIES_NUM
+ *
+ * Configures the number of Link Metrics Forward Tracking Series that can be accumulated
+ * simultaneously.
+ */
+#ifndef NRF_802154_LINK_METRICS_SERIES_NUM
+#define NRF_802154_LINK_METRICS_SERIES_NUM 4
+#endif
+
+/**
+ * @def NRF_802154_SNIFFER_ENABLED
+ *
+ * Enables the sniffer mode. In the sniffer mode, received frames and their metadata are
+ * appended to a ring that the higher layer drains in bulk, instead of being notified one by one.
+ */
+#ifndef NRF_802154_SNIFFER_ENABLED
+#define NRF_802154_SNIFFER_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_SNIFFER_RING_SIZE
+ *
+ * Configures the size of the sniffer ring in bytes. It must be a power of two.
+ */
+#ifndef NRF_802154_SNIFFER_RING_SIZE
+#define NRF_802154_SNIFFER_RING_SIZE 4096
+#endif
+
+/**
+ * @def NRF_802154_ED_RING_ENABLED
+ *
+ * Enables the energy detection sample ring. When the ring is enabled by
+ * @ref nrf_802154_energy_detection_ring_set, every 128 us sample of the energy detection and of
+ * the energy scan procedures is appended with its timestamp and channel to a ring that the higher
+ * layer drains in bulk.
+ */
+#ifndef NRF_802154_ED_RING_ENABLED
+#define NRF_802154_ED_RING_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_ED_RING_SIZE
+ *
+ * Configures the size of the energy detection sample ring in samples. It must be a power of two.
+ */
+#ifndef NRF_802154_ED_RING_SIZE
+#define NRF_802154_ED_RING_SIZE 256
+#endif
+
 /**
  * @def NRF_802154_CARRIER_FUNCTIONS_ENABLED
  *
@@ -526,6 +1592,105 @@ extern "C" {
 #define NRF_802154_CARRIER_FUNCTIONS_ENABLED 1
 #endif
 
+/**
+ * @def NRF_802154_FAST_CHANNEL_HOP_ENABLED
+ *
+ * Enables the fast channel hop of an ongoing reception.
+ *
+ * When this option is enabled and the channel is changed with @ref nrf_802154_channel_set while
+ * the driver is receiving and no frame is being received at the moment, the receiver keeps its
+ * configuration. Only the frequency is updated and the next ramp up is chained to the RADIO
+ * DISABLED event through (D)PPI. Otherwise, the reception is terminated and reinitialized on
+ * the new channel.
+ *
+ */
+#ifndef NRF_802154_FAST_CHANNEL_HOP_ENABLED
+#define NRF_802154_FAST_CHANNEL_HOP_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_DUAL_CHANNEL_RX_ENABLED
+ *
+ * Enables the dual-channel reception. When a secondary channel is set by
+ * @ref nrf_802154_dual_channel_rx_set, the receiver alternates between the channel set by
+ * @ref nrf_802154_channel_set and the secondary channel every
+ * @ref NRF_802154_DUAL_CHANNEL_RX_DWELL_US, using the fast channel hop. A frame whose reception
+ * has started keeps the receiver on its channel until the frame and its ACK are handled.
+ *
+ * @note This option requires @ref NRF_802154_FAST_CHANNEL_HOP_ENABLED to be enabled.
+ */
+#ifndef NRF_802154_DUAL_CHANNEL_RX_ENABLED
+#define NRF_802154_DUAL_CHANNEL_RX_ENABLED 0
+#endif
+
+#if NRF_802154_DUAL_CHANNEL_RX_ENABLED && !NRF_802154_FAST_CHANNEL_HOP_ENABLED
+#error "NRF_802154_DUAL_CHANNEL_RX_ENABLED requires NRF_802154_FAST_CHANNEL_HOP_ENABLED"
+#endif
+
+/**
+ * @def NRF_802154_DUAL_CHANNEL_RX_DWELL_US
+ *
+ * Configures the time in microseconds the receiver listens on each channel of the dual-channel
+ * reception, including the ramp up. Frames are detected if their synchronization header of
+ * 160 us is transmitted while the receiver listens on their channel, so the dwell time should not
+ * be much longer than the synchronization header.
+ */
+#ifndef NRF_802154_DUAL_CHANNEL_RX_DWELL_US
+#define NRF_802154_DUAL_CHANNEL_RX_DWELL_US 320
+#endif
+
+/**
+ * @def NRF_802154_NOISE_FLOOR_ENABLED
+ *
+ * Enables the background noise floor monitor. When enabled, the driver samples RSSI whenever it
+ * leaves an idle reception, for example to transmit a frame or to go to sleep, and maintains
+ * a noise floor estimate per channel. No additional radio time is used. The estimate can be
+ * retrieved by a call to @ref nrf_802154_channel_noise_floor_get.
+ */
+#ifndef NRF_802154_NOISE_FLOOR_ENABLED
+#define NRF_802154_NOISE_FLOOR_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_NOISE_FLOOR_AVERAGING_SHIFT
+ *
+ * Configures the averaging of the noise floor estimate. Each RSSI sample contributes with
+ * the weight of 2^-NRF_802154_NOISE_FLOOR_AVERAGING_SHIFT.
+ */
+#ifndef NRF_802154_NOISE_FLOOR_AVERAGING_SHIFT
+#define NRF_802154_NOISE_FLOOR_AVERAGING_SHIFT 3
+#endif
+
+/**
+ * @def NRF_802154_CCA_ADAPTIVE_ENABLED
+ *
+ * Enables the adaptation of the CCA energy detection threshold. When enabled, each CCA uses
+ * the threshold of @ref NRF_802154_CCA_ADAPTIVE_MARGIN_DB above the noise floor of the channel,
+ * corrected by a bias of up to +/-6 dB. The bias grows when the CCA mostly reports a busy channel
+ * while the transmitted frames are acknowledged, and decreases when ACKs are frequently missing.
+ * The threshold never exceeds the limit of 10 dB above the receiver sensitivity set by
+ * the 802.15.4 specification. Until the noise floor of the channel is estimated, the threshold
+ * set by @ref nrf_802154_cca_cfg_set is used.
+ *
+ * @note This option requires @ref NRF_802154_NOISE_FLOOR_ENABLED to be enabled.
+ */
+#ifndef NRF_802154_CCA_ADAPTIVE_ENABLED
+#define NRF_802154_CCA_ADAPTIVE_ENABLED 0
+#endif
+
+#if NRF_802154_CCA_ADAPTIVE_ENABLED && !NRF_802154_NOISE_FLOOR_ENABLED
+#error "NRF_802154_CCA_ADAPTIVE_ENABLED requires NRF_802154_NOISE_FLOOR_ENABLED"
+#endif
+
+/**
+ * @def NRF_802154_CCA_ADAPTIVE_MARGIN_DB
+ *
+ * Configures the margin in dB of the adaptive CCA energy detection threshold over the noise floor.
+ */
+#ifndef NRF_802154_CCA_ADAPTIVE_MARGIN_DB
+#define NRF_802154_CCA_ADAPTIVE_MARGIN_DB 10
+#endif
+
 /**
  * @}
  * @defgroup nrf_802154_config_apiversions API version configuration options
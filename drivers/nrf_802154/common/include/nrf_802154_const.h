@@ -154,6 +154,7 @@
 #define FCS_SIZE                        2                                            ///< Size of the FCS field.
 #define FRAME_COUNTER_SIZE              4                                            ///< Size of the Frame Counter field.
 #define IE_HEADER_SIZE                  2                                            ///< Size of the obligatory IE Header field elements.
+#define ASN_SIZE                        5                                            ///< Size of the Absolute Slot Number field.
 #define IMM_ACK_LENGTH                  5                                            ///< Length of the ACK frame.
 #define KEY_ID_MODE_1_SIZE              1                                            ///< Size of the 0x01 Key Identifier Mode field.
 #define KEY_ID_MODE_2_SIZE              5                                            ///< Size of the 0x10 Key Identifier Mode field.
@@ -192,6 +193,9 @@
 
 #define NRF_802154_RESERVED_CSMACA_ID   (UINT32_MAX - 2)                             ///< Delayed timeslot identifier reserved for CSMA/CA procedure.
 #define NRF_802154_RESERVED_DTX_ID      (UINT32_MAX - 3)                             ///< Delayed timeslot identifier reserved for delayed transmissions.
+#define NRF_802154_RESERVED_CSL_RX_ID   (UINT32_MAX - 4)                             ///< Reception window identifier reserved for the autonomous CSL receiver.
+#define NRF_802154_RESERVED_DTX2_ID     (UINT32_MAX - 5)                             ///< Delayed timeslot identifier reserved for the second delayed transmission slot. Further slots use consecutive lower identifiers.
+#define NRF_802154_DTX_EXTRA_IDS_NUM    7                                            ///< Number of identifiers reserved for delayed transmission slots other than the first one.
 
 #define IE_VENDOR_ID                    0x00                                         ///< Vendor-specific IE identifier
 #define IE_VENDOR_SIZE_MIN              3                                            ///< Vendor-specific IE minimum length
@@ -216,6 +220,23 @@
 #define IE_CSL_PERIOD_MAX               0xffff                                       ///< Maximum CSL IE phase/period value
 #define IE_CSL_SIZE_MIN                 4                                            ///< Minimal size of the CSL IE
 #define IE_CSL_ID                       0x1a                                         ///< CSL IE identifier
+#define IE_RENDEZVOUS_TIME_ID           0x1d                                         ///< Rendezvous Time IE identifier
+#define IE_RENDEZVOUS_TIME_SIZE_MIN     2                                            ///< Minimal size of the Rendezvous Time IE
+#define IE_RENDEZVOUS_TIME_MAX          0xffff                                       ///< Maximum Rendezvous Time IE value
+#define IE_RENDEZVOUS_SYMBOLS_PER_UNIT  10                                           ///< Number of symbols per rendezvous time unit
+
+#define IE_PAYLOAD_LENGTH_MASK          0x07ff                                       ///< Payload IE length mask
+#define IE_PAYLOAD_GROUP_ID_SHIFT       11                                           ///< Bit offset of Group ID field in a Payload IE header.
+#define IE_PAYLOAD_GROUP_ID_MASK        0x0f                                         ///< Payload IE Group ID mask, applied after the shift
+#define IE_PAYLOAD_MLME_GROUP_ID        0x01                                         ///< MLME Payload IE Group ID
+#define IE_PAYLOAD_TERMINATION_GROUP_ID 0x0f                                         ///< Payload Termination IE Group ID
+#define IE_NESTED_LONG_BIT              0x8000                                       ///< Bit indicating the long format of a nested IE header.
+#define IE_NESTED_SHORT_LENGTH_MASK     0x00ff                                       ///< Short nested IE length mask
+#define IE_NESTED_SHORT_SUB_ID_SHIFT    8                                            ///< Bit offset of Sub-ID field in a short nested IE header.
+#define IE_NESTED_SHORT_SUB_ID_MASK     0x7f                                         ///< Short nested IE Sub-ID mask, applied after the shift
+#define IE_NESTED_LONG_LENGTH_MASK      0x07ff                                       ///< Long nested IE length mask
+#define IE_TSCH_SYNC_SUB_ID             0x1a                                         ///< TSCH Synchronization nested IE Sub-ID
+#define IE_TSCH_SYNC_SIZE_MIN           6                                            ///< Minimal size of the TSCH Synchronization IE
 
 #define IE_HT1                          0x7e                                         ///< Information Element Header Termination type 1
 #define IE_HT2                          0x7f                                         ///< Information Element Header Termination type 2
@@ -235,6 +256,9 @@ typedef enum
     REQ_ORIG_ACK_TIMEOUT,
     REQ_ORIG_DELAYED_TRX,
     REQ_ORIG_IFS,
+    REQ_ORIG_TX_QUEUE,
+    REQ_ORIG_INDIRECT_TX,
+    REQ_ORIG_WAKEUP_TX,
 } req_originator_t;
 
 #endif // NRF_802154_CONST_H_
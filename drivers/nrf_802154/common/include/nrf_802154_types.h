@@ -231,7 +231,8 @@ typedef uint8_t nrf_802154_coex_rx_request_mode_t;
  * - @ref NRF_802154_COEX_TX_REQUEST_MODE_FRAME_READY,
  * - @ref NRF_802154_COEX_TX_REQUEST_MODE_CCA_START,
  * - @ref NRF_802154_COEX_TX_REQUEST_MODE_CCA_DONE,
- * - @ref NRF_802154_COEX_TX_REQUEST_MODE_ON_CCA_TOGGLE
+ * - @ref NRF_802154_COEX_TX_REQUEST_MODE_ON_CCA_TOGGLE,
+ * - @ref NRF_802154_COEX_TX_REQUEST_MODE_PREDICTIVE
  */
 typedef uint8_t nrf_802154_coex_tx_request_mode_t;
 
@@ -239,6 +240,7 @@ typedef uint8_t nrf_802154_coex_tx_request_mode_t;
 #define NRF_802154_COEX_TX_REQUEST_MODE_CCA_START     0x02 // !< Coex requests to arbiter in transmit mode before CCA is started.
 #define NRF_802154_COEX_TX_REQUEST_MODE_CCA_DONE      0x03 // !< Coex requests to arbiter in transmit mode after CCA is finished.
 #define NRF_802154_COEX_TX_REQUEST_MODE_ON_CCA_TOGGLE 0x04 // !< Coex requests to arbiter in transmit mode before CCA is started and releases the request if CCA reports busy channel.
+#define NRF_802154_COEX_TX_REQUEST_MODE_PREDICTIVE    0x05 // !< Coex requests to arbiter in transmit mode ahead of the transmission: NRF_802154_CSMA_CA_COEX_LEAD_TIME_US before the CSMA-CA backoff ends, and for the ACK as soon as a received frame requesting it is destined to this device.
 
 /**
  * @brief Mode of handling Interframe spacing.
@@ -332,6 +334,12 @@ typedef struct
     uint64_t last_ack_end_timestamp;
     /**@brief Time stamp when last bit of received frame was received. */
     uint64_t last_rx_end_timestamp;
+    /**@brief Time stamp when the SFD of last transmitted frame was sent on the air. */
+    uint64_t last_tx_start_timestamp;
+    /**@brief Time stamp when the SFD of last acknowledge frame was received. */
+    uint64_t last_ack_start_timestamp;
+    /**@brief Time stamp when the SFD of last received frame was received. */
+    uint64_t last_rx_start_timestamp;
 } nrf_802154_stat_timestamps_t;
 
 /**
@@ -346,6 +354,170 @@ typedef struct
     nrf_802154_stat_timestamps_t timestamps;
 } nrf_802154_stats_t;
 
+/**
+ * @brief Number of bins of each histogram in @ref nrf_802154_stat_histograms_t.
+ */
+#define NRF_802154_STAT_HISTOGRAM_BINS 16U
+
+/**
+ * @brief Type of structure holding a histogram of statistic samples.
+ *
+ * Unless stated otherwise, bin 0 counts samples equal to 0 and bin n counts samples
+ * in range [ 2^(n-1) .. 2^n - 1 ]. The last bin also counts all greater samples.
+ */
+typedef struct
+{
+    /**@brief Number of samples in each bin. */
+    uint32_t bins[NRF_802154_STAT_HISTOGRAM_BINS];
+} nrf_802154_stat_histogram_t;
+
+/**
+ * @brief Type of structure holding histograms of latencies of the Radio Driver.
+ */
+typedef struct
+{
+    /**@brief Duration of the RADIO IRQ handler, in microseconds. */
+    nrf_802154_stat_histogram_t radio_irq_duration;
+    /**@brief Time from the end of a received or transmitted frame, when its notification is
+     *        enqueued, to the delivery of the notification, in microseconds. */
+    nrf_802154_stat_histogram_t notification_latency;
+    /**@brief Margin between the moment the ACK transmission was armed and the moment its ramp-up
+     *        started, in microseconds. Bin 0 also counts ACKs armed too late. */
+    nrf_802154_stat_histogram_t ack_turnaround_margin;
+    /**@brief Number of backoffs of finished CSMA-CA procedures. Bin n counts procedures with
+     *        n backoffs. */
+    nrf_802154_stat_histogram_t csma_ca_backoffs;
+    /**@brief Duration of handling of the BCMATCH event of a received frame, in CPU cycles. */
+    nrf_802154_stat_histogram_t bcmatch_handler_cycles;
+    /**@brief Duration of handling of a received frame once its CRC is verified, in CPU cycles. */
+    nrf_802154_stat_histogram_t rx_frame_handler_cycles;
+    /**@brief Duration of generation of an ACK frame, including preparation of its security,
+     *        in CPU cycles. */
+    nrf_802154_stat_histogram_t ack_generation_cycles;
+    /**@brief Duration of preparation of the AES-CCM* transformation of an ACK frame,
+     *        in CPU cycles. */
+    nrf_802154_stat_histogram_t ack_security_prepare_cycles;
+} nrf_802154_stat_histograms_t;
+
+/**
+ * @brief Maximum length of the name of a performance counter in @ref nrf_802154_perf_counter_t.
+ */
+#define NRF_802154_PERF_COUNTER_NAME_MAX_LEN 31U
+
+/**
+ * @brief Maximum number of values of a performance counter in @ref nrf_802154_perf_counter_t.
+ */
+#define NRF_802154_PERF_COUNTER_VALUES_MAX 32U
+
+/**
+ * @brief Types of performance counters.
+ *
+ * Possible values:
+ * - @ref NRF_802154_PERF_COUNTER_TYPE_COUNTER,
+ * - @ref NRF_802154_PERF_COUNTER_TYPE_HISTOGRAM,
+ *
+ * The values match @c nrfx_perf_counter_type_t.
+ */
+typedef uint8_t nrf_802154_perf_counter_type_t;
+
+#define NRF_802154_PERF_COUNTER_TYPE_COUNTER   0x00 // !< Single event counter.
+#define NRF_802154_PERF_COUNTER_TYPE_HISTOGRAM 0x01 // !< Array of histogram bins.
+
+/**
+ * @brief Type of structure holding a snapshot of a registered performance counter.
+ */
+typedef struct
+{
+    /**@brief Null-terminated name of the counter, truncated to
+     *        @ref NRF_802154_PERF_COUNTER_NAME_MAX_LEN characters. */
+    char                           name[NRF_802154_PERF_COUNTER_NAME_MAX_LEN + 1];
+    /**@brief Type of the counter. */
+    nrf_802154_perf_counter_type_t type;
+    /**@brief Number of valid elements of @ref values, at most
+     *        @ref NRF_802154_PERF_COUNTER_VALUES_MAX. */
+    uint8_t                        length;
+    /**@brief Value of the counter or the bins of the histogram. */
+    uint32_t                       values[NRF_802154_PERF_COUNTER_VALUES_MAX];
+} nrf_802154_perf_counter_t;
+
+/**
+ * @brief Number of channels reported in @ref nrf_802154_stat_radio_times_t.
+ */
+#define NRF_802154_STAT_RADIO_TIME_CHANNELS 16U
+
+/**
+ * @brief Type of structure holding times the radio spent in each of its states on a channel.
+ *
+ * All times are in microseconds.
+ */
+typedef struct
+{
+    /**@brief Time spent receiving, including listening, CCA and energy detection. */
+    uint64_t rx_time;
+    /**@brief Time spent transmitting frames, ACKs and carrier signals. */
+    uint64_t tx_time;
+    /**@brief Time spent ramping up the receiver or the transmitter. */
+    uint64_t ramp_up_time;
+    /**@brief Time the radio was enabled, but neither receiving nor transmitting. */
+    uint64_t idle_time;
+} nrf_802154_stat_radio_time_t;
+
+/**
+ * @brief Type of structure holding times the radio spent in each of its states.
+ */
+typedef struct
+{
+    /**@brief Times per channel. Element 0 refers to channel 11. */
+    nrf_802154_stat_radio_time_t channels[NRF_802154_STAT_RADIO_TIME_CHANNELS];
+} nrf_802154_stat_radio_times_t;
+
+/**
+ * @brief Type of structure holding statistics of timeslots granted by the Radio Scheduler.
+ *
+ * All times are in microseconds. The average time the driver waited for a timeslot is
+ * @c total_denied_time divided by @c requests.
+ */
+typedef struct
+{
+    /**@brief Number of times the driver started waiting for a timeslot, either because it needed
+     *        the radio again or because its timeslot was preempted. */
+    uint32_t requests;
+    /**@brief Number of granted timeslots. */
+    uint32_t granted;
+    /**@brief Number of timeslots that ended while the driver still needed the radio. */
+    uint32_t preemptions;
+    /**@brief Number of frames being received or transmitted when a timeslot ended. */
+    uint32_t lost_frames;
+    /**@brief Total time the driver needed the radio, but had no timeslot. */
+    uint64_t total_denied_time;
+    /**@brief Longest continuous time the driver needed the radio, but had no timeslot. */
+    uint64_t max_denied_time;
+    /**@brief Total duration of granted timeslots. */
+    uint64_t granted_time;
+} nrf_802154_stat_timeslots_t;
+
+/**
+ * @brief Type of structure holding statistics of critical sections of the driver.
+ *
+ * All durations are in CPU cycles and cover the outermost critical sections only. The average
+ * duration is @c total_cycles divided by @c count.
+ */
+typedef struct
+{
+    /**@brief Number of completed critical sections. */
+    uint32_t count;
+    /**@brief Duration of the longest critical section. */
+    uint32_t max_cycles;
+    /**@brief Total duration of all critical sections. */
+    uint64_t total_cycles;
+    /**@brief Identifier of the caller that entered the longest critical section,
+     *        see @ref NRF_802154_STATS_CRITICAL_SECTION_CALLER_GET. */
+    uint32_t max_caller;
+    /**@brief Priority of the context that entered the longest critical section,
+     *        or INT8_MAX for the thread mode. */
+    int8_t   max_priority;
+} nrf_802154_stat_critical_sections_t;
+
 /**
  * @brief Type holding the value of Key Id Mode of the key stored in nRF 802.15.4 Radio Driver.
  */
@@ -442,6 +614,57 @@ typedef struct
     uint8_t                              extra_cca_attempts; // !< Maximum number of additional CCA attempts that can be performed if the first attempt returns busy channel. Ignored if @ref cca equals @c false.
 } nrf_802154_transmit_at_metadata_t;
 
+/**
+ * @brief Types of operations in the timeline of delayed operations.
+ *
+ * Possible values:
+ * - @ref NRF_802154_TIMELINE_OP_TX,
+ * - @ref NRF_802154_TIMELINE_OP_RX.
+ */
+typedef uint8_t nrf_802154_timeline_op_type_t;
+
+#define NRF_802154_TIMELINE_OP_TX 0x00 // !< Delayed transmission.
+#define NRF_802154_TIMELINE_OP_RX 0x01 // !< Delayed reception window.
+
+/**
+ * @brief Structure that describes an operation in the timeline of delayed operations.
+ */
+typedef struct
+{
+    nrf_802154_timeline_op_type_t type; // !< Type of the operation.
+    uint64_t                      time; // !< Absolute time used by the SL Timer, in microseconds (us), at which the operation is to be performed.
+
+    union
+    {
+        struct
+        {
+            uint8_t                         * p_data;   // !< Pointer to a buffer containing PHR and PSDU of the frame to be transmitted.
+            nrf_802154_transmit_at_metadata_t metadata; // !< Detailed properties of the frame to be transmitted.
+        } tx;                                           // !< Parameters of a delayed transmission.
+
+        struct
+        {
+            uint32_t timeout; // !< Reception timeout (counted from @c time), in microseconds (us).
+            uint8_t  channel; // !< Radio channel on which the frame is to be received.
+            uint32_t id;      // !< Identifier of the reception window.
+        } rx;                 // !< Parameters of a delayed reception window.
+    } data;                   // !< Parameters of the operation, depending on its type.
+} nrf_802154_timeline_op_t;
+
+/**
+ * @brief Structure that describes the periodic transmission of a beacon.
+ */
+typedef struct
+{
+    uint64_t                       tx_time;       // !< Absolute time used by the SL Timer, in microseconds (us), at which the first beacon is to be transmitted.
+    uint32_t                       period;        // !< Interval between consecutive beacons, in microseconds (us).
+    bool                           cca;           // !< If the driver is to perform a CCA procedure before each beacon.
+    uint8_t                        channel;       // !< Radio channel on which the beacons are transmitted.
+    nrf_802154_tx_power_metadata_t tx_power;      // !< Information about the TX power to be used.
+    uint64_t                       asn;           // !< Absolute Slot Number written to the TSCH Synchronization IE of the first beacon. Ignored if the beacon has no such IE.
+    uint32_t                       asn_increment; // !< Number of timeslots by which the Absolute Slot Number advances from one beacon to the next.
+} nrf_802154_beacon_tx_config_t;
+
 /**
  * @brief Structure with transmit request metadata for transmission preceded by CSMA-CA procedure.
  */
@@ -457,6 +680,7 @@ typedef struct
 typedef struct
 {
     nrf_802154_transmitted_frame_props_t frame_props; // !< Properties of the returned frame.
+    uint8_t                              retries;     // !< Number of retransmissions performed by the driver because no valid ACK was received.
 
     union
     {
@@ -494,6 +718,146 @@ typedef struct
 
 #endif
 
+/**
+ * @brief Number of channels covered by the multi-channel energy scan.
+ */
+#define NRF_802154_ENERGY_SCAN_CHANNELS 16U
+
+/**
+ * @brief Structure that holds results of the multi-channel energy scan procedure.
+ *
+ * Bit n of @p channel_mask corresponds to channel n. The result for channel n is stored in
+ * @p ed_dbm at index (n - 11). Entries for channels not set in @p channel_mask are undefined.
+ */
+typedef struct
+{
+    uint32_t channel_mask;                            // !< Mask of the scanned channels.
+    int8_t   ed_dbm[NRF_802154_ENERGY_SCAN_CHANNELS]; // !< Maximum detected ED in dBm per channel.
+} nrf_802154_energy_scan_result_t;
+
+/**
+ * @brief Frame types accounted in a Link Metrics Forward Tracking Series.
+ *
+ * Bitwise OR of the following values:
+ * - @ref NRF_802154_LM_FRAME_TYPE_DATA,
+ * - @ref NRF_802154_LM_FRAME_TYPE_DATA_REQUEST,
+ * - @ref NRF_802154_LM_FRAME_TYPE_ACK
+ *
+ * The values match the Thread Forward Series Flags. MLE Link Probes are MAC Data frames
+ * and are accounted with @ref NRF_802154_LM_FRAME_TYPE_DATA.
+ */
+typedef uint8_t nrf_802154_lm_frame_types_t;
+
+#define NRF_802154_LM_FRAME_TYPE_DATA         0x02 // !< MAC Data frames.
+#define NRF_802154_LM_FRAME_TYPE_DATA_REQUEST 0x04 // !< MAC Data Request command frames.
+#define NRF_802154_LM_FRAME_TYPE_ACK          0x08 // !< ACK frames received in response to frames sent to the initiator.
+
+/**
+ * @brief Structure that holds the values accumulated in a Link Metrics Forward Tracking Series.
+ */
+typedef struct
+{
+    uint32_t pdu_count;   // !< Number of frames accounted in the series.
+    uint8_t  lqi;         // !< Average LQI of the accounted frames.
+    uint8_t  link_margin; // !< Average link margin of the accounted frames in dB.
+    int8_t   rssi;        // !< Average RSSI of the accounted frames in dBm.
+} nrf_802154_lm_series_t;
+
+/**
+ * @brief Header of a frame record read from the sniffer ring.
+ *
+ * Each header is followed by @c length bytes of the received PSDU without the FCS field.
+ * Records are stored back-to-back, so the header of the next record starts right after the PSDU
+ * of the previous one and is not necessarily aligned.
+ */
+typedef struct
+{
+    uint64_t timestamp; // !< Timestamp of the end of the frame in microseconds (us), or @ref NRF_802154_NO_TIMESTAMP.
+    int8_t   rssi;      // !< RSSI of the frame in dBm.
+    uint8_t  lqi;       // !< LQI of the frame.
+    uint8_t  channel;   // !< Channel on which the frame was received.
+    uint8_t  length;    // !< Number of PSDU bytes that follow the header.
+} nrf_802154_sniffer_record_t;
+
+/**
+ * @brief Energy detection sample read from the energy detection sample ring.
+ */
+typedef struct
+{
+    uint64_t timestamp; // !< Time at which the sample ended in microseconds (us).
+    int8_t   ed_dbm;    // !< Detected energy in dBm.
+    uint8_t  channel;   // !< Channel on which the sample was taken.
+} nrf_802154_ed_sample_t;
+
+/**
+ * @brief Value of an offset in @ref nrf_802154_received_metadata_t indicating that the field
+ *        is not present in the frame.
+ */
+#define NRF_802154_RX_METADATA_NO_OFFSET 0xFF
+
+/**
+ * @brief Results of the security processing of a received frame.
+ */
+typedef uint8_t nrf_802154_rx_security_status_t;
+
+#define NRF_802154_RX_SECURITY_STATUS_UNSECURED     0x00 // !< The frame is not secured.
+#define NRF_802154_RX_SECURITY_STATUS_NOT_PROCESSED 0x01 // !< The frame is secured, but it was passed to the higher layer as it was received.
+#define NRF_802154_RX_SECURITY_STATUS_KEY_NOT_FOUND 0x02 // !< The frame is secured with a key that is not present in the security PIB.
+#define NRF_802154_RX_SECURITY_STATUS_AUTH_FAILED   0x03 // !< The MIC of the frame does not match. The frame was passed as it was received.
+#define NRF_802154_RX_SECURITY_STATUS_VERIFIED      0x04 // !< The MIC of the frame matches. The MAC payload contains the plaintext.
+
+/**
+ * @brief Structure that holds the metadata of a received frame.
+ *
+ * Offsets are counted from the beginning of the buffer that contains the frame, that is from PHR.
+ * The security fields describe the auxiliary security header as it was received. Unless
+ * @ref NRF_802154_RX_DECRYPTION_ENABLED is enabled, the driver does not decrypt received frames.
+ */
+typedef struct
+{
+    uint64_t                        timestamp;            // !< Timestamp taken when the last symbol of the frame was received, in microseconds (us), or @ref NRF_802154_NO_TIMESTAMP.
+    int8_t                          rssi;                 // !< RSSI of the frame in dBm.
+    uint8_t                         lqi;                  // !< LQI of the frame.
+    uint8_t                         channel;              // !< Channel on which the frame was received.
+    bool                            parsed;               // !< If the frame was parsed successfully. If not, all offsets are @ref NRF_802154_RX_METADATA_NO_OFFSET.
+    uint8_t                         dst_panid_offset;     // !< Offset of the destination PAN ID.
+    uint8_t                         dst_addr_offset;      // !< Offset of the destination address.
+    uint8_t                         dst_addr_size;        // !< Size of the destination address or 0 if it is not present.
+    uint8_t                         src_panid_offset;     // !< Offset of the source PAN ID.
+    uint8_t                         src_addr_offset;      // !< Offset of the source address.
+    uint8_t                         src_addr_size;        // !< Size of the source address or 0 if it is not present.
+    uint8_t                         sec_ctrl_offset;      // !< Offset of the Security Control field.
+    uint8_t                         frame_counter_offset; // !< Offset of the Frame Counter field.
+    uint8_t                         key_id_offset;        // !< Offset of the Key Identifier field.
+    uint8_t                         header_ie_offset;     // !< Offset of the first Header IE.
+    uint8_t                         mac_payload_offset;   // !< Offset of the MAC payload.
+    bool                            security_enabled;     // !< If the Security Enabled bit is set in the frame.
+    uint8_t                         security_level;       // !< Security level of the frame or 0 if security is not enabled.
+    uint8_t                         key_id_mode;          // !< Key identifier mode of the frame or 0 if security is not enabled.
+    uint8_t                         mic_size;             // !< Size of the Message Integrity Code.
+    bool                            ack_sent;             // !< If the frame was acknowledged by the driver.
+    bool                            ack_frame_pending;    // !< If the ACK sent for the frame had the Frame Pending bit set.
+    nrf_802154_rx_security_status_t security_status;      // !< Result of the security processing of the frame.
+} nrf_802154_received_metadata_t;
+
+/**
+ * @brief Header of a frame that is still being received.
+ *
+ * Offsets are counted from the beginning of the buffer that contains the frame, that is from PHR.
+ * An offset of a field that is not present in the frame is @ref NRF_802154_RX_METADATA_NO_OFFSET.
+ */
+typedef struct
+{
+    uint8_t psdu_length;      // !< Length of the PSDU as indicated by PHR.
+    uint8_t frame_type;       // !< Frame type taken from the Frame Control field.
+    bool    dsn_present;      // !< If the Sequence Number field is present in the frame.
+    uint8_t dsn;              // !< Sequence number of the frame or 0 if it is not present.
+    uint8_t dst_panid_offset; // !< Offset of the destination PAN ID.
+    uint8_t dst_addr_offset;  // !< Offset of the destination address.
+    uint8_t dst_addr_size;    // !< Size of the destination address or 0 if it is not present.
+    bool    ack_requested;    // !< If the Acknowledgment Request bit is set in the frame.
+} nrf_802154_rx_header_t;
+
 /**
  *@}
  **/
@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2023, Nordic Semiconductor ASA
+# All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+#
+# 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+#    contributors may be used to endorse or promote products derived from this
+#    software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+
+"""Decoder of the nRF 802.15.4 driver event trace.
+
+The trace is recorded by the driver built with NRF_802154_TRACE_ENABLED. Dump the
+g_nrf_802154_trace variable to a binary file with a debugger, for example in GDB:
+
+    dump binary value trace.bin g_nrf_802154_trace
+
+and decode it with:
+
+    nrf_802154_trace_decode.py trace.bin
+
+Event names are read from nrf_802154_trace.h, so the decoder follows the driver sources.
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+DEFAULT_HEADER = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                              '..', 'src', 'nrf_802154_trace.h')
+
+CORE_STATES = {
+    0: 'SLEEP',
+    1: 'FALLING_ASLEEP',
+    2: 'RX',
+    3: 'TX_ACK',
+    4: 'CCA_TX',
+    5: 'TX',
+    6: 'RX_ACK',
+    7: 'ED',
+    8: 'CCA',
+    9: 'CONTINUOUS_CARRIER',
+    10: 'MODULATED_CARRIER',
+}
+
+
+def event_names_read(header_path):
+    names = {}
+    with open(header_path, encoding='utf-8') as header:
+        for match in re.finditer(r'NRF_802154_TRACE_EVENT_(\w+)\s*=\s*(\d+)U?', header.read()):
+            names[int(match.group(2))] = match.group(1)
+    return names
+
+
+def entries_read(dump):
+    if len(dump) < 4 or (len(dump) - 4) % 8:
+        raise ValueError('dump size {} does not match a trace buffer'.format(len(dump)))
+
+    count = (len(dump) - 4) // 8
+    if count & (count - 1):
+        raise ValueError('trace buffer length {} is not a power of 2'.format(count))
+
+    (idx,) = struct.unpack_from('<I', dump, 0)
+    first = max(idx - count, 0)
+
+    for seq in range(first, idx):
+        event, timestamp = struct.unpack_from('<II', dump, 4 + 8 * (seq % count))
+        yield seq, (event >> 16) & 0xFF, event & 0xFFFF, timestamp
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode nRF 802.15.4 driver event trace.')
+    parser.add_argument('dump', help='binary dump of g_nrf_802154_trace')
+    parser.add_argument('--header', default=DEFAULT_HEADER,
+                        help='path to nrf_802154_trace.h (default: %(default)s)')
+    args = parser.parse_args()
+
+    names = event_names_read(args.header)
+
+    with open(args.dump, 'rb') as dump_file:
+        dump = dump_file.read()
+
+    prev_timestamp = None
+
+    print('{:>10} {:>12} {:>8}  {:<16} {}'.format('seq', 'timestamp', 'delta', 'event', 'param'))
+
+    for seq, event_id, param, timestamp in entries_read(dump):
+        if event_id == 0:
+            # Slot claimed, but not written yet.
+            continue
+
+        name  = names.get(event_id, 'UNKNOWN_{}'.format(event_id))
+        delta = '' if prev_timestamp is None else (timestamp - prev_timestamp) & 0xFFFFFFFF
+
+        if name == 'CORE_STATE':
+            param = CORE_STATES.get(param, param)
+
+        print('{:>10} {:>12} {:>8}  {:<16} {}'.format(seq, timestamp, delta, name, param))
+
+        prev_timestamp = timestamp
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
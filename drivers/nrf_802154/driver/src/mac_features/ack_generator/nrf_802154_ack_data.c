@@ -53,15 +53,28 @@
 /// Maximum number of Extended Addresses of nodes for which there is ACK data to set.
 #define NUM_EXTENDED_ADDRESSES NRF_802154_PENDING_EXTENDED_ADDRESSES
 
-/// Structure representing pending bit setting variables.
-typedef struct
-{
-    bool     enabled;                                                      /// If setting pending bit is enabled.
-    uint8_t  short_addr[NUM_SHORT_ADDRESSES][SHORT_ADDRESS_SIZE];          /// Array of short addresses of nodes for which there is pending data in the buffer.
-    uint8_t  extended_addr[NUM_EXTENDED_ADDRESSES][EXTENDED_ADDRESS_SIZE]; /// Array of extended addresses of nodes for which there is pending data in the buffer.
-    uint32_t num_of_short_addr;                                            /// Current number of short addresses of nodes for which there is pending data in the buffer.
-    uint32_t num_of_ext_addr;                                              /// Current number of extended addresses of nodes for which there is pending data in the buffer.
-} pending_bit_arrays_t;
+#if NRF_802154_ACK_DATA_HASH_ENABLED
+
+/// Number of hash table slots for Short Addresses. Keeps the load factor at or below 0.5.
+#define NUM_SHORT_SLOTS        (2 * NUM_SHORT_ADDRESSES)
+/// Number of hash table slots for Extended Addresses. Keeps the load factor at or below 0.5.
+#define NUM_EXTENDED_SLOTS     (2 * NUM_EXTENDED_ADDRESSES)
+/// Multiplier of the Fibonacci hashing used to spread addresses over the hash table slots.
+#define ADDR_HASH_MULTIPLIER   0x9E3779B1UL
+
+#else
+
+/// Number of array slots for Short Addresses.
+#define NUM_SHORT_SLOTS        NUM_SHORT_ADDRESSES
+/// Number of array slots for Extended Addresses.
+#define NUM_EXTENDED_SLOTS     NUM_EXTENDED_ADDRESSES
+
+#endif // NRF_802154_ACK_DATA_HASH_ENABLED
+
+/// Flag indicating that the pending bit is to be set for a given address.
+#define ACK_DATA_FLAG_PENDING_BIT (1U << NRF_802154_ACK_DATA_PENDING_BIT)
+/// Flag indicating that IE data is stored for a given address.
+#define ACK_DATA_FLAG_IE          (1U << NRF_802154_ACK_DATA_IE)
 
 // Structure representing a single IE record.
 typedef struct
@@ -70,32 +83,39 @@ typedef struct
     uint8_t len;                                /// Length of the buffer.
 } ie_data_t;
 
-// Structure representing IE records sent in an ACK message to a given short address.
+// Structure representing all ACK data stored for a single peer node.
 typedef struct
 {
-    uint8_t   addr[SHORT_ADDRESS_SIZE]; /// Short address of peer node.
-    ie_data_t ie_data;                  /// Pointer to IE records.
-} ack_short_ie_data_t;
+    uint8_t   flags;   /// Bitmask of ACK_DATA_FLAG_* values describing which data is valid.
+    ie_data_t ie_data; /// IE records sent in an ACK message to the peer node.
+} ack_data_record_t;
 
-// Structure representing IE records sent in an ACK message to a given extended address.
+// Structure representing ACK data sent in an ACK message to a given short address.
 typedef struct
 {
-    uint8_t   addr[EXTENDED_ADDRESS_SIZE]; /// Extended address of peer node.
-    ie_data_t ie_data;                     /// Pointer to IE records.
-} ack_ext_ie_data_t;
+    uint8_t           addr[SHORT_ADDRESS_SIZE]; /// Short address of peer node.
+    ack_data_record_t record;                   /// ACK data for the peer node.
+} ack_short_data_t;
 
-// Structure representing IE data setting variables.
+// Structure representing ACK data sent in an ACK message to a given extended address.
 typedef struct
 {
-    ack_short_ie_data_t short_data[NUM_SHORT_ADDRESSES];  /// Array of short addresses and IE records sent to these addresses.
-    ack_ext_ie_data_t   ext_data[NUM_EXTENDED_ADDRESSES]; /// Array of extended addresses and IE records sent to these addresses.
-    uint32_t            num_of_short_data;                /// Current number of short addresses stored in @p short_data.
-    uint32_t            num_of_ext_data;                  /// Current number of extended addresses stored in @p ext_data.
-} ie_arrays_t;
+    uint8_t           addr[EXTENDED_ADDRESS_SIZE]; /// Extended address of peer node.
+    ack_data_record_t record;                      /// ACK data for the peer node.
+} ack_ext_data_t;
 
-// TODO: Combine below arrays to perform binary search only once per Ack generation.
-static pending_bit_arrays_t        m_pending_bit;
-static ie_arrays_t                 m_ie;
+// Structure representing ACK data setting variables.
+typedef struct
+{
+    bool             enabled;                          /// If setting pending bit is enabled.
+    ack_short_data_t short_data[NUM_SHORT_SLOTS];      /// Array of short addresses and ACK data sent to these addresses.
+    ack_ext_data_t   ext_data[NUM_EXTENDED_SLOTS];     /// Array of extended addresses and ACK data sent to these addresses.
+    uint32_t         num_of_short_data;                /// Current number of short addresses stored in @p short_data.
+    uint32_t         num_of_ext_data;                  /// Current number of extended addresses stored in @p ext_data.
+    uint32_t         ie_data_rev;                      /// Revision of the IE data, incremented on every IE data update.
+} ack_data_arrays_t;
+
+static ack_data_arrays_t           m_ack_data;
 static nrf_802154_src_addr_match_t m_src_matching_method;
 
 /***************************************************************************************************
@@ -191,45 +211,300 @@ static int8_t addr_compare(const uint8_t * p_first_addr,
 }
 
 /**
- * @brief Perform a binary search for an address in a list of addresses.
+ * @brief Get the parameters of the address array of a given length.
+ *
+ * @param[in]  extended         Indication if the array of extended or short addresses is requested.
+ * @param[out] pp_addr_array_len Pointer to the current number of entries in the array.
+ * @param[out] p_entry_size     Size of a single entry of the array.
+ *
+ * @returns  Pointer to the first entry of the array.
+ */
+static uint8_t * addr_array_get(bool extended, uint32_t ** pp_addr_array_len, uint8_t * p_entry_size)
+{
+    if (extended)
+    {
+        *pp_addr_array_len = &m_ack_data.num_of_ext_data;
+        *p_entry_size      = sizeof(ack_ext_data_t);
+        return (uint8_t *)m_ack_data.ext_data;
+    }
+    else
+    {
+        *pp_addr_array_len = &m_ack_data.num_of_short_data;
+        *p_entry_size      = sizeof(ack_short_data_t);
+        return (uint8_t *)m_ack_data.short_data;
+    }
+}
+
+/**
+ * @brief Get the ACK data record stored at a given location.
+ *
+ * @param[in]  location     Index of the entry in the address array.
+ * @param[in]  extended     Indication if the entry is stored in the extended or short address array.
+ *
+ * @returns  Pointer to the ACK data record.
+ */
+static ack_data_record_t * record_get(uint32_t location, bool extended)
+{
+    return extended ? &m_ack_data.ext_data[location].record :
+           &m_ack_data.short_data[location].record;
+}
+
+#if NRF_802154_ACK_DATA_HASH_ENABLED
+
+/**
+ * @brief Calculate the home slot of an address in the hash table.
+ *
+ * @param[in]  p_addr           Pointer to the address.
+ * @param[in]  extended         Indication if @p p_addr is an extended or a short address.
+ *
+ * @returns  Index of the first slot to be probed for @p p_addr.
+ */
+static uint32_t addr_hash(const uint8_t * p_addr, bool extended)
+{
+    uint32_t key;
+
+    if (extended)
+    {
+        key = *(uint32_t *)(p_addr) ^
+              (*(uint32_t *)(p_addr + sizeof(uint32_t)) * ADDR_HASH_MULTIPLIER);
+    }
+    else
+    {
+        key = *(uint16_t *)(p_addr);
+    }
+
+    key *= ADDR_HASH_MULTIPLIER;
+
+    return (key >> 16) % (extended ? NUM_EXTENDED_SLOTS : NUM_SHORT_SLOTS);
+}
+
+/**
+ * @brief Check if a hash table slot is empty.
+ *
+ * A slot is considered empty when it holds no ACK data.
+ *
+ * @param[in]  location     Index of the slot.
+ * @param[in]  extended     Indication if the slot belongs to the extended or the short address table.
+ *
+ * @retval true   Slot is empty.
+ * @retval false  Slot is occupied.
+ */
+static bool slot_is_empty(uint32_t location, bool extended)
+{
+    return record_get(location, extended)->flags == 0U;
+}
+
+/**
+ * @brief Search for an address in the hash table using linear probing.
  *
  * @param[in]  p_addr           Pointer to an address that is searched for.
- * @param[in]  p_addr_array     Pointer to a list of addresses to be searched.
- * @param[out] p_location       If the address @p p_addr appears in the list, this is its index in the address list.
- *                              Otherwise, it is the index which @p p_addr would have if it was placed in the list
- *                              (ascending order assumed).
+ * @param[out] p_location       If the address @p p_addr appears in the table, this is its slot index.
+ *                              Otherwise, it is the index of the slot in which @p p_addr is to be
+ *                              placed if it was added to the table.
  * @param[in]  extended         Indication if @p p_addr is an extended or a short addresses.
  *
- * @retval true   Address @p p_addr is in the list.
- * @retval false  Address @p p_addr is not in the list.
+ * @retval true   Address @p p_addr is in the table.
+ * @retval false  Address @p p_addr is not in the table.
  */
-static bool addr_binary_search(const uint8_t       * p_addr,
-                               const uint8_t       * p_addr_array,
-                               uint32_t            * p_location,
-                               nrf_802154_ack_data_t data_type,
-                               bool                  extended)
+static bool addr_find(const uint8_t * p_addr, uint32_t * p_location, bool extended)
 {
-    uint32_t addr_array_len = 0;
-    uint8_t  entry_size     = 0;
+    uint32_t * p_addr_array_len;
+    uint8_t    entry_size;
+    uint8_t  * p_addr_array = addr_array_get(extended, &p_addr_array_len, &entry_size);
+    uint32_t   num_slots    = extended ? NUM_EXTENDED_SLOTS : NUM_SHORT_SLOTS;
+    uint32_t   location     = addr_hash(p_addr, extended);
 
-    switch (data_type)
+    // The load factor never exceeds 0.5, so an empty slot always terminates the probing.
+    while (!slot_is_empty(location, extended))
     {
-        case NRF_802154_ACK_DATA_PENDING_BIT:
-            entry_size     = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
-            addr_array_len = extended ?
-                             m_pending_bit.num_of_ext_addr : m_pending_bit.num_of_short_addr;
-            break;
+        if (addr_compare(p_addr, p_addr_array + entry_size * location, extended) == 0)
+        {
+            *p_location = location;
+            return true;
+        }
 
-        case NRF_802154_ACK_DATA_IE:
-            entry_size     = extended ? sizeof(ack_ext_ie_data_t) : sizeof(ack_short_ie_data_t);
-            addr_array_len = extended ? m_ie.num_of_ext_data : m_ie.num_of_short_data;
-            break;
+        location = (location + 1) % num_slots;
+    }
 
-        default:
-            assert(false);
+    *p_location = location;
+    return false;
+}
+
+/**
+ * @brief Add an address to the hash table.
+ *
+ * The ACK data record of the added entry is cleared. The caller is responsible for setting
+ * at least one data flag of the record, otherwise the slot is considered empty.
+ *
+ * @param[in]  p_addr           Pointer to the address to be added.
+ * @param[in]  location         Index of the slot returned by @ref addr_find for @p p_addr.
+ * @param[in]  extended         Indication if @p p_addr is an extended or a short addresses.
+ *
+ * @retval true   Address @p p_addr has been added to the table successfully.
+ * @retval false  Address @p p_addr could not be added to the table.
+ */
+static bool addr_add(const uint8_t * p_addr, uint32_t location, bool extended)
+{
+    uint32_t * p_addr_array_len;
+    uint8_t    entry_size;
+    uint8_t  * p_addr_array       = addr_array_get(extended, &p_addr_array_len, &entry_size);
+    uint32_t   max_addr_array_len = extended ? NUM_EXTENDED_ADDRESSES : NUM_SHORT_ADDRESSES;
+
+    if (*p_addr_array_len == max_addr_array_len)
+    {
+        return false;
+    }
+
+    memcpy(p_addr_array + entry_size * location,
+           p_addr,
+           extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE);
+
+    record_get(location, extended)->flags = 0U;
+
+    (*p_addr_array_len)++;
+
+    return true;
+}
+
+/**
+ * @brief Remove an address from the hash table.
+ *
+ * Entries following the removed one in the probing sequence are shifted back, so that no
+ * tombstones are needed and the search never has to skip deleted slots.
+ *
+ * @param[in]  location     Index of the slot to be emptied.
+ * @param[in]  extended     Indication if address to remove is an extended or a short address.
+ *
+ * @retval true   Address has been removed from the table successfully.
+ * @retval false  Address could not removed from the table.
+ */
+static bool addr_remove(uint32_t location, bool extended)
+{
+    uint32_t * p_addr_array_len;
+    uint8_t    entry_size;
+    uint8_t  * p_addr_array = addr_array_get(extended, &p_addr_array_len, &entry_size);
+    uint32_t   num_slots    = extended ? NUM_EXTENDED_SLOTS : NUM_SHORT_SLOTS;
+    uint32_t   hole         = location;
+    uint32_t   next         = location;
+
+    if (*p_addr_array_len == 0)
+    {
+        return false;
+    }
+
+    record_get(hole, extended)->flags = 0U;
+
+    while (true)
+    {
+        next = (next + 1) % num_slots;
+
+        if (slot_is_empty(next, extended))
+        {
             break;
+        }
+
+        uint32_t home = addr_hash(p_addr_array + entry_size * next, extended);
+
+        // The entry stays in place if its home slot lies cyclically within (hole, next].
+        bool stays = (hole <= next) ? ((hole < home) && (home <= next)) :
+                     ((hole < home) || (home <= next));
+
+        if (!stays)
+        {
+            memcpy(p_addr_array + entry_size * hole, p_addr_array + entry_size * next, entry_size);
+            record_get(next, extended)->flags = 0U;
+            hole = next;
+        }
+    }
+
+    (*p_addr_array_len)--;
+
+    return true;
+}
+
+/**
+ * @brief Clear a data flag in all entries of the hash table and remove the emptied entries.
+ *
+ * Emptied slots may break the probing sequences of the remaining entries. Therefore, starting
+ * from a slot that was empty before any flag was cleared, and which thus cannot be a part of
+ * any probing sequence, every remaining entry is reinserted. That places each entry at or before
+ * its current slot in its probing sequence.
+ *
+ * @param[in]  extended     Indication if the extended or the short address table is to be modified.
+ * @param[in]  flag         Data flag to be cleared.
+ */
+static void addr_array_flag_clear(bool extended, uint8_t flag)
+{
+    uint32_t * p_addr_array_len;
+    uint8_t    entry_size;
+    uint8_t  * p_addr_array = addr_array_get(extended, &p_addr_array_len, &entry_size);
+    uint32_t   num_slots    = extended ? NUM_EXTENDED_SLOTS : NUM_SHORT_SLOTS;
+    uint32_t   start        = 0;
+    uint32_t   kept         = 0;
+
+    // The load factor never exceeds 0.5, so there is always an empty slot.
+    while (!slot_is_empty(start, extended))
+    {
+        start++;
     }
 
+    for (uint32_t i = 0; i < num_slots; i++)
+    {
+        record_get(i, extended)->flags &= (uint8_t)~flag;
+    }
+
+    for (uint32_t i = 1; i < num_slots; i++)
+    {
+        uint32_t location = (start + i) % num_slots;
+        uint32_t new_location;
+
+        if (slot_is_empty(location, extended))
+        {
+            continue;
+        }
+
+        // Temporarily empty the slot so that the search below can return it as well.
+        ack_data_record_t * p_record = record_get(location, extended);
+        uint8_t             flags    = p_record->flags;
+
+        p_record->flags = 0U;
+        (void)addr_find(p_addr_array + entry_size * location, &new_location, extended);
+
+        if (new_location != location)
+        {
+            memcpy(p_addr_array + entry_size * new_location,
+                   p_addr_array + entry_size * location,
+                   entry_size);
+        }
+
+        record_get(new_location, extended)->flags = flags;
+        kept++;
+    }
+
+    *p_addr_array_len = kept;
+}
+
+#else // NRF_802154_ACK_DATA_HASH_ENABLED
+
+/**
+ * @brief Perform a binary search for an address in a list of addresses.
+ *
+ * @param[in]  p_addr           Pointer to an address that is searched for.
+ * @param[out] p_location       If the address @p p_addr appears in the list, this is its index in the address list.
+ *                              Otherwise, it is the index which @p p_addr would have if it was placed in the list
+ *                              (ascending order assumed).
+ * @param[in]  extended         Indication if @p p_addr is an extended or a short addresses.
+ *
+ * @retval true   Address @p p_addr is in the list.
+ * @retval false  Address @p p_addr is not in the list.
+ */
+static bool addr_find(const uint8_t * p_addr, uint32_t * p_location, bool extended)
+{
+    uint32_t * p_addr_array_len;
+    uint8_t    entry_size;
+    uint8_t  * p_addr_array   = addr_array_get(extended, &p_addr_array_len, &entry_size);
+    uint32_t   addr_array_len = *p_addr_array_len;
+
     // The actual algorithm
     int32_t  low      = 0;
     uint32_t midpoint = 0;
@@ -281,97 +556,179 @@ static bool addr_binary_search(const uint8_t       * p_addr,
 }
 
 /**
- * @brief Find an address in a list of addresses.
+ * @brief Add an address to the address list in ascending order.
  *
- * @param[in]  p_addr           Pointer to an address that is searched for.
- * @param[out] p_location       If the address @p p_addr appears in the list, this is its index in the address list.
- *                              Otherwise, it is the index which @p p_addr would have if it was placed in the list
- *                              (ascending order assumed).
+ * The ACK data record of the added entry is cleared.
+ *
+ * @param[in]  p_addr           Pointer to the address to be added.
+ * @param[in]  location         Index of the location where @p p_addr should be added.
  * @param[in]  extended         Indication if @p p_addr is an extended or a short addresses.
  *
- * @retval true   Address @p p_addr is in the list.
- * @retval false  Address @p p_addr is not in the list.
+ * @retval true   Address @p p_addr has been added to the list successfully.
+ * @retval false  Address @p p_addr could not be added to the list.
+ */
+static bool addr_add(const uint8_t * p_addr, uint32_t location, bool extended)
+{
+    uint32_t * p_addr_array_len;
+    uint8_t    entry_size;
+    uint8_t  * p_addr_array       = addr_array_get(extended, &p_addr_array_len, &entry_size);
+    uint32_t   max_addr_array_len = extended ? NUM_EXTENDED_ADDRESSES : NUM_SHORT_ADDRESSES;
+
+    if (*p_addr_array_len == max_addr_array_len)
+    {
+        return false;
+    }
+
+    memmove(p_addr_array + entry_size * (location + 1),
+            p_addr_array + entry_size * (location),
+            (*p_addr_array_len - location) * entry_size);
+
+    memcpy(p_addr_array + entry_size * location,
+           p_addr,
+           extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE);
+
+    record_get(location, extended)->flags = 0U;
+
+    (*p_addr_array_len)++;
+
+    return true;
+}
+
+/**
+ * @brief Remove an address from the address list keeping it in ascending order.
+ *
+ * @param[in]  location     Index of the element to be removed from the list.
+ * @param[in]  extended     Indication if address to remove is an extended or a short address.
+ *
+ * @retval true   Address @p p_addr has been removed from the list successfully.
+ * @retval false  Address @p p_addr could not removed from the list.
+ */
+static bool addr_remove(uint32_t location, bool extended)
+{
+    uint32_t * p_addr_array_len;
+    uint8_t    entry_size;
+    uint8_t  * p_addr_array = addr_array_get(extended, &p_addr_array_len, &entry_size);
+
+    if (*p_addr_array_len == 0)
+    {
+        return false;
+    }
+
+    memmove(p_addr_array + entry_size * location,
+            p_addr_array + entry_size * (location + 1),
+            (*p_addr_array_len - location - 1) * entry_size);
+
+    (*p_addr_array_len)--;
+
+    return true;
+}
+
+/**
+ * @brief Clear a data flag in all entries of the address list and remove the emptied entries.
+ *
+ * @param[in]  extended     Indication if the extended or the short address list is to be modified.
+ * @param[in]  flag         Data flag to be cleared.
  */
-static bool addr_index_find(const uint8_t       * p_addr,
-                            uint32_t            * p_location,
-                            nrf_802154_ack_data_t data_type,
-                            bool                  extended)
+static void addr_array_flag_clear(bool extended, uint8_t flag)
 {
-    uint8_t * p_addr_array;
-    bool      valid_data_type = true;
+    uint32_t * p_addr_array_len;
+    uint8_t    entry_size;
+    uint8_t  * p_addr_array = addr_array_get(extended, &p_addr_array_len, &entry_size);
+    uint32_t   kept         = 0;
+
+    for (uint32_t i = 0; i < *p_addr_array_len; i++)
+    {
+        ack_data_record_t * p_record = record_get(i, extended);
+
+        p_record->flags &= (uint8_t)~flag;
+
+        if (p_record->flags != 0U)
+        {
+            if (kept != i)
+            {
+                memcpy(p_addr_array + entry_size * kept,
+                       p_addr_array + entry_size * i,
+                       entry_size);
+            }
+
+            kept++;
+        }
+    }
+
+    *p_addr_array_len = kept;
+}
+
+#endif // NRF_802154_ACK_DATA_HASH_ENABLED
 
+/**
+ * @brief Convert ACK data type to the corresponding record flag.
+ *
+ * @param[in]  data_type    Type of ACK data.
+ *
+ * @returns  Record flag matching @p data_type or 0 if @p data_type is invalid.
+ */
+static uint8_t data_type_flag_get(nrf_802154_ack_data_t data_type)
+{
     switch (data_type)
     {
         case NRF_802154_ACK_DATA_PENDING_BIT:
-            p_addr_array = extended ? (uint8_t *)m_pending_bit.extended_addr :
-                           (uint8_t *)m_pending_bit.short_addr;
-            break;
+            return ACK_DATA_FLAG_PENDING_BIT;
 
         case NRF_802154_ACK_DATA_IE:
-            p_addr_array = extended ? (uint8_t *)m_ie.ext_data : (uint8_t *)m_ie.short_data;
-            break;
+            return ACK_DATA_FLAG_IE;
 
         default:
-            valid_data_type = false;
             assert(false);
-            break;
+            return 0U;
     }
-
-    if (!valid_data_type)
-    {
-        return false;
-    }
-
-    return addr_binary_search(p_addr, p_addr_array, p_location, data_type, extended);
 }
 
 /**
  * @brief Thread implementation of the address matching algorithm.
  *
  * @param[in]  p_frame_data  Pointer to the frame parser data for which the ACK frame is being prepared.
+ * @param[in]  p_lookup      Pointer to the result of the lookup for the source address of the frame.
  *
  * @retval true   Pending bit is to be set.
  * @retval false  Pending bit is to be cleared.
  */
-static bool addr_match_thread(const nrf_802154_frame_parser_data_t * p_frame_data)
+static bool addr_match_thread(const nrf_802154_frame_parser_data_t * p_frame_data,
+                              const nrf_802154_ack_data_lookup_t   * p_lookup)
 {
-    uint32_t        location;
-    bool            extended   = nrf_802154_frame_parser_src_addr_is_extended(p_frame_data);
     const uint8_t * p_src_addr = nrf_802154_frame_parser_src_addr_get(p_frame_data);
 
     // The pending bit is set by default.
-    if (!m_pending_bit.enabled || (NULL == p_src_addr))
+    if (!m_ack_data.enabled || (NULL == p_src_addr))
     {
         return true;
     }
 
-    return addr_index_find(p_src_addr, &location, NRF_802154_ACK_DATA_PENDING_BIT, extended);
+    return p_lookup->pending_bit;
 }
 
 /**
  * @brief Zigbee implementation of the address matching algorithm.
  *
  * @param[in]  p_frame_data  Pointer to the frame parser data for which the ACK frame is being prepared.
+ * @param[in]  p_lookup      Pointer to the result of the lookup for the source address of the frame.
  *
  * @retval true   Pending bit is to be set.
  * @retval false  Pending bit is to be cleared.
  */
-static bool addr_match_zigbee(const nrf_802154_frame_parser_data_t * p_frame_data)
+static bool addr_match_zigbee(const nrf_802154_frame_parser_data_t * p_frame_data,
+                              const nrf_802154_ack_data_lookup_t   * p_lookup)
 {
     uint8_t         src_addr_type;
-    uint32_t        location;
     const uint8_t * p_cmd;
-    const uint8_t * p_src_addr;
     bool            ret = false;
 
     // If ack data generator module is disabled do not perform check, return true by default.
-    if (!m_pending_bit.enabled)
+    if (!m_ack_data.enabled)
     {
         return true;
     }
 
     // Check the frame type.
-    p_src_addr    = nrf_802154_frame_parser_src_addr_get(p_frame_data);
     src_addr_type = nrf_802154_frame_parser_src_addr_type_get(p_frame_data);
 
     p_cmd = nrf_802154_frame_parser_mac_command_id_get(p_frame_data);
@@ -383,10 +740,7 @@ static bool addr_match_zigbee(const nrf_802154_frame_parser_data_t * p_frame_dat
         if (src_addr_type == SRC_ADDR_TYPE_SHORT)
         {
             // Return true if address is not found on the m_pending_bits list.
-            ret = !addr_index_find(p_src_addr,
-                                   &location,
-                                   NRF_802154_ACK_DATA_PENDING_BIT,
-                                   false);
+            ret = !p_lookup->pending_bit;
         }
         else
         {
@@ -413,185 +767,21 @@ static bool addr_match_standard_compliant(const nrf_802154_frame_parser_data_t *
     return true;
 }
 
-/**
- * @brief Add an address to the address list in ascending order.
- *
- * @param[in]  p_addr           Pointer to the address to be added.
- * @param[in]  location         Index of the location where @p p_addr should be added.
- * @param[in]  extended         Indication if @p p_addr is an extended or a short addresses.
- *
- * @retval true   Address @p p_addr has been added to the list successfully.
- * @retval false  Address @p p_addr could not be added to the list.
- */
-static bool addr_add(const uint8_t       * p_addr,
-                     uint32_t              location,
-                     nrf_802154_ack_data_t data_type,
-                     bool                  extended)
-{
-    uint32_t * p_addr_array_len;
-    uint32_t   max_addr_array_len;
-    uint8_t  * p_addr_array;
-    uint8_t    entry_size;
-    bool       valid_data_type = true;
-
-    switch (data_type)
-    {
-        case NRF_802154_ACK_DATA_PENDING_BIT:
-            if (extended)
-            {
-                p_addr_array       = (uint8_t *)m_pending_bit.extended_addr;
-                max_addr_array_len = NUM_EXTENDED_ADDRESSES;
-                p_addr_array_len   = &m_pending_bit.num_of_ext_addr;
-                entry_size         = EXTENDED_ADDRESS_SIZE;
-            }
-            else
-            {
-                p_addr_array       = (uint8_t *)m_pending_bit.short_addr;
-                max_addr_array_len = NUM_SHORT_ADDRESSES;
-                p_addr_array_len   = &m_pending_bit.num_of_short_addr;
-                entry_size         = SHORT_ADDRESS_SIZE;
-            }
-            break;
-
-        case NRF_802154_ACK_DATA_IE:
-            if (extended)
-            {
-                p_addr_array       = (uint8_t *)m_ie.ext_data;
-                max_addr_array_len = NUM_EXTENDED_ADDRESSES;
-                p_addr_array_len   = &m_ie.num_of_ext_data;
-                entry_size         = sizeof(ack_ext_ie_data_t);
-            }
-            else
-            {
-                p_addr_array       = (uint8_t *)m_ie.short_data;
-                max_addr_array_len = NUM_SHORT_ADDRESSES;
-                p_addr_array_len   = &m_ie.num_of_short_data;
-                entry_size         = sizeof(ack_short_ie_data_t);
-            }
-            break;
-
-        default:
-            valid_data_type = false;
-            assert(false);
-            break;
-    }
-
-    if (!valid_data_type || (*p_addr_array_len == max_addr_array_len))
-    {
-        return false;
-    }
-
-    memmove(p_addr_array + entry_size * (location + 1),
-            p_addr_array + entry_size * (location),
-            (*p_addr_array_len - location) * entry_size);
-
-    memcpy(p_addr_array + entry_size * location,
-           p_addr,
-           extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE);
-
-    (*p_addr_array_len)++;
-
-    return true;
-}
-
-/**
- * @brief Remove an address from the address list keeping it in ascending order.
- *
- * @param[in]  location     Index of the element to be removed from the list.
- * @param[in]  extended     Indication if address to remove is an extended or a short address.
- *
- * @retval true   Address @p p_addr has been removed from the list successfully.
- * @retval false  Address @p p_addr could not removed from the list.
- */
-static bool addr_remove(uint32_t location, nrf_802154_ack_data_t data_type, bool extended)
-{
-    uint32_t * p_addr_array_len;
-    uint8_t  * p_addr_array;
-    uint8_t    entry_size;
-    bool       valid_data_type = true;
-
-    switch (data_type)
-    {
-        case NRF_802154_ACK_DATA_PENDING_BIT:
-            if (extended)
-            {
-                p_addr_array     = (uint8_t *)m_pending_bit.extended_addr;
-                p_addr_array_len = &m_pending_bit.num_of_ext_addr;
-                entry_size       = EXTENDED_ADDRESS_SIZE;
-            }
-            else
-            {
-                p_addr_array     = (uint8_t *)m_pending_bit.short_addr;
-                p_addr_array_len = &m_pending_bit.num_of_short_addr;
-                entry_size       = SHORT_ADDRESS_SIZE;
-            }
-            break;
-
-        case NRF_802154_ACK_DATA_IE:
-            if (extended)
-            {
-                p_addr_array     = (uint8_t *)m_ie.ext_data;
-                p_addr_array_len = &m_ie.num_of_ext_data;
-                entry_size       = sizeof(ack_ext_ie_data_t);
-            }
-            else
-            {
-                p_addr_array     = (uint8_t *)m_ie.short_data;
-                p_addr_array_len = &m_ie.num_of_short_data;
-                entry_size       = sizeof(ack_short_ie_data_t);
-            }
-            break;
-
-        default:
-            valid_data_type = false;
-            assert(false);
-            break;
-    }
-
-    if (!valid_data_type || (*p_addr_array_len == 0))
-    {
-        return false;
-    }
-
-    memmove(p_addr_array + entry_size * location,
-            p_addr_array + entry_size * (location + 1),
-            (*p_addr_array_len - location - 1) * entry_size);
-
-    (*p_addr_array_len)--;
-
-    return true;
-}
-
-static void ie_data_add(uint32_t location, bool extended, const uint8_t * p_data, uint8_t data_len)
-{
-    if (extended)
-    {
-        memcpy(m_ie.ext_data[location].ie_data.p_data, p_data, data_len);
-        m_ie.ext_data[location].ie_data.len = data_len;
-    }
-    else
-    {
-        memcpy(m_ie.short_data[location].ie_data.p_data, p_data, data_len);
-        m_ie.short_data[location].ie_data.len = data_len;
-    }
-}
-
 /***************************************************************************************************
  * @section Public API
  **************************************************************************************************/
 
 void nrf_802154_ack_data_init(void)
 {
-    memset(&m_pending_bit, 0, sizeof(m_pending_bit));
-    memset(&m_ie, 0, sizeof(m_ie));
+    memset(&m_ack_data, 0, sizeof(m_ack_data));
 
-    m_pending_bit.enabled = true;
+    m_ack_data.enabled    = true;
     m_src_matching_method = NRF_802154_SRC_ADDR_MATCH_THREAD;
 }
 
 void nrf_802154_ack_data_enable(bool enabled)
 {
-    m_pending_bit.enabled = enabled;
+    m_ack_data.enabled = enabled;
 }
 
 bool nrf_802154_ack_data_for_addr_set(const uint8_t       * p_addr,
@@ -601,15 +791,27 @@ bool nrf_802154_ack_data_for_addr_set(const uint8_t       * p_addr,
                                       uint8_t               data_len)
 {
     uint32_t location = 0;
+    uint8_t  flag     = data_type_flag_get(data_type);
 
-    if (addr_index_find(p_addr, &location, data_type, extended) ||
-        addr_add(p_addr, location, data_type, extended))
+    if (flag == 0U)
     {
+        return false;
+    }
+
+    if (addr_find(p_addr, &location, extended) ||
+        addr_add(p_addr, location, extended))
+    {
+        ack_data_record_t * p_record = record_get(location, extended);
+
         if (data_type == NRF_802154_ACK_DATA_IE)
         {
-            ie_data_add(location, extended, p_data, data_len);
+            memcpy(p_record->ie_data.p_data, p_data, data_len);
+            p_record->ie_data.len = data_len;
+            m_ack_data.ie_data_rev++;
         }
 
+        p_record->flags |= flag;
+
         return true;
     }
     else
@@ -622,46 +824,49 @@ bool nrf_802154_ack_data_for_addr_clear(const uint8_t       * p_addr,
                                         bool                  extended,
                                         nrf_802154_ack_data_t data_type)
 {
-    uint32_t location = 0;
+    uint32_t            location = 0;
+    uint8_t             flag     = data_type_flag_get(data_type);
+    ack_data_record_t * p_record;
 
-    if (addr_index_find(p_addr, &location, data_type, extended))
+    if ((flag == 0U) || !addr_find(p_addr, &location, extended))
     {
-        return addr_remove(location, data_type, extended);
+        return false;
     }
-    else
+
+    p_record = record_get(location, extended);
+
+    if ((p_record->flags & flag) == 0U)
     {
         return false;
     }
+
+    p_record->flags &= (uint8_t)~flag;
+
+    if (flag == ACK_DATA_FLAG_IE)
+    {
+        m_ack_data.ie_data_rev++;
+    }
+
+    if (p_record->flags == 0U)
+    {
+        return addr_remove(location, extended);
+    }
+
+    return true;
 }
 
 void nrf_802154_ack_data_reset(bool extended, nrf_802154_ack_data_t data_type)
 {
-    switch (data_type)
-    {
-        case NRF_802154_ACK_DATA_PENDING_BIT:
-            if (extended)
-            {
-                m_pending_bit.num_of_ext_addr = 0;
-            }
-            else
-            {
-                m_pending_bit.num_of_short_addr = 0;
-            }
-            break;
+    uint8_t flag = data_type_flag_get(data_type);
 
-        case NRF_802154_ACK_DATA_IE:
-            if (extended)
-            {
-                m_ie.num_of_ext_data = 0;
-            }
-            else
-            {
-                m_ie.num_of_short_data = 0;
-            }
-            break;
+    if (flag != 0U)
+    {
+        addr_array_flag_clear(extended, flag);
+    }
 
-        default:
-            break;
+    if (flag == ACK_DATA_FLAG_IE)
+    {
+        m_ack_data.ie_data_rev++;
     }
 }
 
@@ -681,19 +886,47 @@ void nrf_802154_ack_data_src_addr_matching_method_set(nrf_802154_src_addr_match_
 
 }
 
-bool nrf_802154_ack_data_pending_bit_should_be_set(
-    const nrf_802154_frame_parser_data_t * p_frame_data)
+void nrf_802154_ack_data_lookup(const uint8_t                * p_src_addr,
+                                bool                           src_addr_extended,
+                                nrf_802154_ack_data_lookup_t * p_lookup)
+{
+    uint32_t location;
+
+    p_lookup->pending_bit = false;
+    p_lookup->p_ie_data   = NULL;
+    p_lookup->ie_data_len = 0U;
+    p_lookup->ie_data_rev = m_ack_data.ie_data_rev;
+
+    if ((NULL == p_src_addr) || !addr_find(p_src_addr, &location, src_addr_extended))
+    {
+        return;
+    }
+
+    const ack_data_record_t * p_record = record_get(location, src_addr_extended);
+
+    p_lookup->pending_bit = (p_record->flags & ACK_DATA_FLAG_PENDING_BIT) != 0U;
+
+    if ((p_record->flags & ACK_DATA_FLAG_IE) != 0U)
+    {
+        p_lookup->p_ie_data   = p_record->ie_data.p_data;
+        p_lookup->ie_data_len = p_record->ie_data.len;
+    }
+}
+
+bool nrf_802154_ack_data_pending_bit_resolve(
+    const nrf_802154_frame_parser_data_t * p_frame_data,
+    const nrf_802154_ack_data_lookup_t   * p_lookup)
 {
     bool ret;
 
     switch (m_src_matching_method)
     {
         case NRF_802154_SRC_ADDR_MATCH_THREAD:
-            ret = addr_match_thread(p_frame_data);
+            ret = addr_match_thread(p_frame_data, p_lookup);
             break;
 
         case NRF_802154_SRC_ADDR_MATCH_ZIGBEE:
-            ret = addr_match_zigbee(p_frame_data);
+            ret = addr_match_zigbee(p_frame_data, p_lookup);
             break;
 
         case NRF_802154_SRC_ADDR_MATCH_ALWAYS_1:
@@ -708,33 +941,32 @@ bool nrf_802154_ack_data_pending_bit_should_be_set(
     return ret;
 }
 
+bool nrf_802154_ack_data_pending_bit_should_be_set(
+    const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+    nrf_802154_ack_data_lookup_t lookup;
+
+    nrf_802154_ack_data_lookup(nrf_802154_frame_parser_src_addr_get(p_frame_data),
+                               nrf_802154_frame_parser_src_addr_is_extended(p_frame_data),
+                               &lookup);
+
+    return nrf_802154_ack_data_pending_bit_resolve(p_frame_data, &lookup);
+}
+
 const uint8_t * nrf_802154_ack_data_ie_get(const uint8_t * p_src_addr,
                                            bool            src_addr_extended,
                                            uint8_t       * p_ie_length)
 {
-    uint32_t location;
+    nrf_802154_ack_data_lookup_t lookup;
 
     if (NULL == p_src_addr)
     {
         return NULL;
     }
 
-    if (addr_index_find(p_src_addr, &location, NRF_802154_ACK_DATA_IE, src_addr_extended))
-    {
-        if (src_addr_extended)
-        {
-            *p_ie_length = m_ie.ext_data[location].ie_data.len;
-            return m_ie.ext_data[location].ie_data.p_data;
-        }
-        else
-        {
-            *p_ie_length = m_ie.short_data[location].ie_data.len;
-            return m_ie.short_data[location].ie_data.p_data;
-        }
-    }
-    else
-    {
-        *p_ie_length = 0;
-        return NULL;
-    }
+    nrf_802154_ack_data_lookup(p_src_addr, src_addr_extended, &lookup);
+
+    *p_ie_length = lookup.ie_data_len;
+
+    return lookup.p_ie_data;
 }
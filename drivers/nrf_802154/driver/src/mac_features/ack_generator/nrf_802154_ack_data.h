@@ -36,6 +36,7 @@
  * @brief Module that contains an ACK data generator for the nRF 802.15.4 radio driver.
  *
  * @note  The current implementation supports setting pending bit and IEs in 802.15.4-2015 Enh-Ack frames.
+ *        Both kinds of data are kept in a single list with one entry per peer address.
  */
 
 #ifndef NRF_802154_ACK_DATA_H
@@ -47,6 +48,20 @@
 #include "nrf_802154_types.h"
 #include "mac_features/nrf_802154_frame_parser.h"
 
+/**
+ * @brief Structure holding the ACK data found for a single peer address.
+ *
+ * It is filled by @ref nrf_802154_ack_data_lookup, so that all the data required to generate
+ * an ACK frame is obtained with a single search in the ACK data list.
+ */
+typedef struct
+{
+    bool            pending_bit; ///< If the address is present in the pending bit list.
+    const uint8_t * p_ie_data;   ///< Pointer to the IE data stored for the address or NULL.
+    uint8_t         ie_data_len; ///< Length of the IE data pointed by @p p_ie_data.
+    uint32_t        ie_data_rev; ///< Revision of the IE data list, changed on every IE update.
+} nrf_802154_ack_data_lookup_t;
+
 /**
  * @brief Initializes the ACK data generator module.
  */
@@ -74,6 +89,10 @@ void nrf_802154_ack_data_enable(bool enabled);
  *
  * @retval true   Address successfully added to the list.
  * @retval false  Address not added to the list (list is full).
+ *
+ * @note The pending bit and the IE data for a given address share a single list entry. Hence,
+ *       the list capacity defined by @ref NRF_802154_PENDING_SHORT_ADDRESSES and
+ *       @ref NRF_802154_PENDING_EXTENDED_ADDRESSES applies to both data types combined.
  */
 bool nrf_802154_ack_data_for_addr_set(const uint8_t       * p_addr,
                                       bool                  extended,
@@ -121,6 +140,34 @@ void nrf_802154_ack_data_reset(bool extended, nrf_802154_ack_data_t data_type);
  */
 void nrf_802154_ack_data_src_addr_matching_method_set(nrf_802154_src_addr_match_t match_method);
 
+/**
+ * @brief Searches the ACK data list for all the data stored for a given address.
+ *
+ * @param[in]  p_src_addr         Pointer to the source address to search for in the list.
+ *                                If NULL, @p p_lookup is filled as if no data was found.
+ * @param[in]  src_addr_extended  If the source address is extended.
+ * @param[out] p_lookup           Pointer to the structure to be filled with the found data.
+ */
+void nrf_802154_ack_data_lookup(const uint8_t                * p_src_addr,
+                                bool                           src_addr_extended,
+                                nrf_802154_ack_data_lookup_t * p_lookup);
+
+/**
+ * @brief Checks if a pending bit is to be set in the ACK frame using a previous lookup result.
+ *
+ * This function applies the selected source address matching algorithm to the data obtained
+ * with @ref nrf_802154_ack_data_lookup without searching the ACK data list again.
+ *
+ * @param[in]  p_frame_data  Pointer to the frame parser data for which the ACK frame is being prepared.
+ * @param[in]  p_lookup      Pointer to the lookup result for the source address of the frame.
+ *
+ * @retval true   Pending bit is to be set.
+ * @retval false  Pending bit is to be cleared.
+ */
+bool nrf_802154_ack_data_pending_bit_resolve(
+    const nrf_802154_frame_parser_data_t * p_frame_data,
+    const nrf_802154_ack_data_lookup_t   * p_lookup);
+
 /**
  * @brief Checks if a pending bit is to be set in the ACK frame sent in response to a given frame.
  *
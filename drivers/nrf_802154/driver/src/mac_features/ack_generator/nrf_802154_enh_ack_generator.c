@@ -43,6 +43,7 @@
 #include <assert.h>
 #include <string.h>
 
+#include "mac_features/nrf_802154_filter.h"
 #include "mac_features/nrf_802154_frame_parser.h"
 #include "mac_features/nrf_802154_ie_writer.h"
 #include "mac_features/nrf_802154_security_pib.h"
@@ -66,8 +67,7 @@ static ack_state_t m_ack_state;
 
 static uint8_t                        m_ack[ENH_ACK_MAX_SIZE + PHR_SIZE];
 static nrf_802154_frame_parser_data_t m_ack_data;
-static const uint8_t                * mp_ie_data;
-static uint8_t                        m_ie_data_len;
+static nrf_802154_ack_data_lookup_t   m_ack_data_lookup;
 
 static void ack_state_set(ack_state_t state_to_set)
 {
@@ -112,7 +112,7 @@ static void fcf_security_enabled_set(const nrf_802154_frame_parser_data_t * p_fr
 
 static void fcf_frame_pending_set(const nrf_802154_frame_parser_data_t * p_frame_data)
 {
-    if (nrf_802154_ack_data_pending_bit_should_be_set(p_frame_data))
+    if (nrf_802154_ack_data_pending_bit_resolve(p_frame_data, &m_ack_data_lookup))
     {
         m_ack[FRAME_PENDING_OFFSET] |= FRAME_PENDING_BIT;
     }
@@ -227,7 +227,8 @@ static uint8_t destination_set(const nrf_802154_frame_parser_data_t * p_frame_da
         }
         else
         {
-            p_dst_panid = nrf_802154_pib_pan_id_get();
+            p_dst_panid = nrf_802154_pib_identity_pan_id_get(
+                nrf_802154_filter_matched_identity_get());
         }
 
         memcpy(p_ack_dst_panid, p_dst_panid, PAN_ID_SIZE);
@@ -470,6 +471,185 @@ static bool encryption_prepare(const nrf_802154_frame_parser_data_t * p_ack_data
 #endif  // NRF_802154_ENCRYPTION_ENABLED
 }
 
+#if NRF_802154_ENH_ACK_TEMPLATES_ENABLED
+
+/***************************************************************************************************
+ * @section Enh-Ack templates
+ **************************************************************************************************/
+
+// Structure representing an Enh-Ack prepared earlier in response to a frame from a recent peer.
+typedef struct
+{
+    bool                           valid;                            ///< If the template is used.
+    uint32_t                       ie_data_rev;                      ///< Revision of the ACK IEs.
+    nrf_802154_frame_parser_data_t ack_data;                         ///< Parser data of @p ack.
+    uint8_t                        ack[ENH_ACK_MAX_SIZE + PHR_SIZE]; ///< Enh-Ack without FCS.
+} enh_ack_template_t;
+
+static enh_ack_template_t m_templates[NRF_802154_ENH_ACK_TEMPLATES_NUM];
+static uint8_t            m_template_next; ///< Index of the template to be replaced next.
+
+static bool template_is_cacheable(const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+    // With security level zero the whole auxiliary security header is copied from the frame,
+    // including the frame counter, so such an Enh-Ack cannot be reused.
+    return !nrf_802154_frame_parser_security_enabled_bit_is_set(p_frame_data) ||
+           (nrf_802154_frame_parser_sec_ctrl_sec_lvl_get(p_frame_data) != SECURITY_LEVEL_NONE);
+}
+
+static bool template_mhr_matches(const enh_ack_template_t * p_template)
+{
+    uint8_t addr_end = nrf_802154_frame_parser_addressing_end_offset_get(&m_ack_data);
+    uint8_t dsn_end  = PHR_SIZE + FCF_SIZE;
+
+    if (nrf_802154_frame_parser_addressing_end_offset_get(&p_template->ack_data) != addr_end)
+    {
+        return false;
+    }
+
+    // The Frame Pending bit is resolved for each frame separately, so it is not compared.
+    for (uint8_t i = PHR_SIZE; i < PHR_SIZE + FCF_SIZE; i++)
+    {
+        uint8_t mask = (i == FRAME_PENDING_OFFSET) ? (uint8_t)~FRAME_PENDING_BIT : UINT8_MAX;
+
+        if ((m_ack[i] & mask) != (p_template->ack[i] & mask))
+        {
+            return false;
+        }
+    }
+
+    // Both frame control fields are equal, so the Enh-Acks either both have the sequence number
+    // or both have it suppressed.
+    if (!nrf_802154_frame_parser_dsn_suppress_bit_is_set(&m_ack_data))
+    {
+        dsn_end += DSN_SIZE;
+    }
+
+    return memcmp(&m_ack[dsn_end], &p_template->ack[dsn_end], addr_end - dsn_end) == 0;
+}
+
+static bool template_sec_matches(const enh_ack_template_t             * p_template,
+                                 const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+    if (!nrf_802154_frame_parser_security_enabled_bit_is_set(p_frame_data))
+    {
+        return true;
+    }
+
+    // The Security Control field and the Key ID of an Enh-Ack are copied from the frame.
+    const uint8_t * p_frame_sec_ctrl    = nrf_802154_frame_parser_sec_ctrl_get(p_frame_data);
+    const uint8_t * p_template_sec_ctrl = nrf_802154_frame_parser_sec_ctrl_get(
+        &p_template->ack_data);
+
+    if ((p_frame_sec_ctrl == NULL) || (p_template_sec_ctrl == NULL) ||
+        (*p_frame_sec_ctrl != *p_template_sec_ctrl))
+    {
+        return false;
+    }
+
+    uint8_t key_id_size = key_id_size_get(nrf_802154_frame_parser_sec_ctrl_key_id_mode_get(
+                                              p_frame_data));
+
+    if (key_id_size == 0U)
+    {
+        return true;
+    }
+
+    return memcmp(nrf_802154_frame_parser_key_id_get(p_frame_data),
+                  nrf_802154_frame_parser_key_id_get(&p_template->ack_data),
+                  key_id_size) == 0;
+}
+
+static const enh_ack_template_t * template_find(
+    const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+    if (!template_is_cacheable(p_frame_data))
+    {
+        return NULL;
+    }
+
+    for (uint32_t i = 0; i < NRF_802154_ENH_ACK_TEMPLATES_NUM; i++)
+    {
+        const enh_ack_template_t * p_template = &m_templates[i];
+
+        if (p_template->valid &&
+            (p_template->ie_data_rev == m_ack_data_lookup.ie_data_rev) &&
+            template_mhr_matches(p_template) &&
+            template_sec_matches(p_template, p_frame_data))
+        {
+            return p_template;
+        }
+    }
+
+    return NULL;
+}
+
+static bool template_apply(const enh_ack_template_t * p_template)
+{
+    uint8_t addr_end = nrf_802154_frame_parser_addressing_end_offset_get(&m_ack_data);
+    uint8_t ack_end  = p_template->ack[PHR_OFFSET] + PHR_SIZE - FCS_SIZE;
+    uint8_t fc_bytes_written;
+
+    // Frame Control field, sequence number and addressing fields are already set. Copy the rest.
+    memcpy(&m_ack[addr_end], &p_template->ack[addr_end], ack_end - addr_end);
+
+    m_ack[PHR_OFFSET]  = p_template->ack[PHR_OFFSET];
+    m_ack_data         = p_template->ack_data;
+    m_ack_data.p_frame = m_ack;
+
+    if (!frame_counter_set(&m_ack_data, &fc_bytes_written))
+    {
+        return false;
+    }
+
+#if NRF_802154_IE_WRITER_ENABLED
+    if (m_ack_data_lookup.p_ie_data != NULL)
+    {
+        uint8_t * p_ack_ie = m_ack + m_ack_data.helper.aux_sec_hdr_end_offset;
+
+        nrf_802154_ie_writer_prepare(p_ack_ie, p_ack_ie + m_ack_data_lookup.ie_data_len);
+    }
+#endif
+
+    return true;
+}
+
+static void template_store(const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+    enh_ack_template_t * p_template = NULL;
+
+    if (!template_is_cacheable(p_frame_data))
+    {
+        return;
+    }
+
+    // Prefer a template that can no longer be used over the oldest one.
+    for (uint32_t i = 0; i < NRF_802154_ENH_ACK_TEMPLATES_NUM; i++)
+    {
+        if (!m_templates[i].valid ||
+            (m_templates[i].ie_data_rev != m_ack_data_lookup.ie_data_rev))
+        {
+            p_template = &m_templates[i];
+            break;
+        }
+    }
+
+    if (p_template == NULL)
+    {
+        p_template      = &m_templates[m_template_next];
+        m_template_next = (m_template_next + 1U) % NRF_802154_ENH_ACK_TEMPLATES_NUM;
+    }
+
+    memcpy(p_template->ack, m_ack, m_ack[PHR_OFFSET] + PHR_SIZE - FCS_SIZE);
+
+    p_template->ack_data         = m_ack_data;
+    p_template->ack_data.p_frame = p_template->ack;
+    p_template->ie_data_rev      = m_ack_data_lookup.ie_data_rev;
+    p_template->valid            = true;
+}
+
+#endif // NRF_802154_ENH_ACK_TEMPLATES_ENABLED
+
 /***************************************************************************************************
  * @section Enhanced ACK generation
  **************************************************************************************************/
@@ -498,15 +678,14 @@ static void addr_end_process(const nrf_802154_frame_parser_data_t * p_frame_data
     // Set source address and PAN ID.
     source_set();
 
-    // Having the frame's source address, presence of IEs can be determined.
-    // coverity[unchecked_value]
-    mp_ie_data = nrf_802154_ack_data_ie_get(
-        nrf_802154_frame_parser_src_addr_get(p_frame_data),
-        nrf_802154_frame_parser_src_addr_is_extended(p_frame_data),
-        &m_ie_data_len);
+    // Having the frame's source address, presence of IEs can be determined. The same lookup
+    // result is used later to determine the Frame Pending bit.
+    nrf_802154_ack_data_lookup(nrf_802154_frame_parser_src_addr_get(p_frame_data),
+                               nrf_802154_frame_parser_src_addr_is_extended(p_frame_data),
+                               &m_ack_data_lookup);
 
     // Update the IE present bit in Frame Control field knowing if IEs should be present.
-    fcf_ie_present_set(mp_ie_data != NULL);
+    fcf_ie_present_set(m_ack_data_lookup.p_ie_data != NULL);
 
     bool result = nrf_802154_frame_parser_valid_data_extend(&m_ack_data,
                                                             m_ack[PHR_OFFSET] + PHR_SIZE,
@@ -540,11 +719,13 @@ static bool aux_sec_hdr_process(const nrf_802154_frame_parser_data_t * p_frame_d
 static void ie_process(const nrf_802154_frame_parser_data_t * p_frame_data)
 {
     // Set IE header.
-    ie_header_set(mp_ie_data, m_ie_data_len, &m_ack_data);
-    m_ack[PHR_OFFSET] += m_ie_data_len;
+    ie_header_set(m_ack_data_lookup.p_ie_data, m_ack_data_lookup.ie_data_len, &m_ack_data);
+    m_ack[PHR_OFFSET] += m_ack_data_lookup.ie_data_len;
 
     // Terminate the IE header if needed.
-    m_ack[PHR_OFFSET] += ie_header_terminate(mp_ie_data, m_ie_data_len, &m_ack_data) + FCS_SIZE;
+    m_ack[PHR_OFFSET] += ie_header_terminate(m_ack_data_lookup.p_ie_data,
+                                             m_ack_data_lookup.ie_data_len,
+                                             &m_ack_data) + FCS_SIZE;
 
     bool result = nrf_802154_frame_parser_valid_data_extend(&m_ack_data,
                                                             m_ack[PHR_OFFSET] + PHR_SIZE,
@@ -554,6 +735,32 @@ static void ie_process(const nrf_802154_frame_parser_data_t * p_frame_data)
     (void)result;
 }
 
+static bool aux_sec_hdr_and_ie_process(const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+#if NRF_802154_ENH_ACK_TEMPLATES_ENABLED
+    const enh_ack_template_t * p_template = template_find(p_frame_data);
+
+    if (p_template != NULL)
+    {
+        // The rest of the Enh-Ack is known already. Only the frame counter has to be updated.
+        return template_apply(p_template);
+    }
+#endif
+
+    if (!aux_sec_hdr_process(p_frame_data))
+    {
+        return false;
+    }
+
+    ie_process(p_frame_data);
+
+#if NRF_802154_ENH_ACK_TEMPLATES_ENABLED
+    template_store(p_frame_data);
+#endif
+
+    return true;
+}
+
 static bool encryption_process(void)
 {
     return encryption_prepare(&m_ack_data);
@@ -585,14 +792,12 @@ static uint8_t * ack_process(
     if ((frame_parse_level >= PARSE_LEVEL_AUX_SEC_HDR_END) &&
         (ack_parse_level < PARSE_LEVEL_AUX_SEC_HDR_END))
     {
-        if (!aux_sec_hdr_process(p_frame_data))
+        if (!aux_sec_hdr_and_ie_process(p_frame_data))
         {
             // Failure to set auxiliary security header, the ACK cannot be created. Exit immediately
             *p_processing_done = true;
             return NULL;
         }
-
-        ie_process(p_frame_data);
     }
 
     if (frame_parse_level == PARSE_LEVEL_FULL)
@@ -624,16 +829,18 @@ static uint8_t * ack_process(
 
 void nrf_802154_enh_ack_generator_init(void)
 {
-    // Intentionally empty.
+#if NRF_802154_ENH_ACK_TEMPLATES_ENABLED
+    memset(m_templates, 0U, sizeof(m_templates));
+    m_template_next = 0U;
+#endif
 }
 
 void nrf_802154_enh_ack_generator_reset(void)
 {
     memset(m_ack, 0U, sizeof(m_ack));
     (void)nrf_802154_frame_parser_data_init(m_ack, 0U, PARSE_LEVEL_NONE, &m_ack_data);
-    mp_ie_data    = 0U;
-    m_ie_data_len = 0U;
-    m_ack_state   = ACK_STATE_RESET;
+    memset(&m_ack_data_lookup, 0U, sizeof(m_ack_data_lookup));
+    m_ack_state = ACK_STATE_RESET;
 }
 
 uint8_t * nrf_802154_enh_ack_generator_create(
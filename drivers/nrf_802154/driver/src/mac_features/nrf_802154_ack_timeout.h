@@ -38,6 +38,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 #include "nrf_802154_types.h"
 
@@ -66,6 +67,20 @@ void nrf_802154_ack_timeout_deinit(void);
  */
 void nrf_802154_ack_timeout_time_set(uint32_t time);
 
+#if NRF_802154_ACK_TIMEOUT_HW_WINDOW_ENABLED
+
+/**
+ * @brief Gets the length of the ACK wait window enforced by the hardware.
+ *
+ * The window ends when the ACK timeout expires for an ACK that would be received right after
+ * the transmitted frame.
+ *
+ * @returns  Length of the ACK wait window in microseconds, counted from the end of the frame.
+ */
+uint32_t nrf_802154_ack_timeout_window_get(void);
+
+#endif // NRF_802154_ACK_TIMEOUT_HW_WINDOW_ENABLED
+
 /**
  * @brief Aborts a started ACK timeout procedure.
  *
@@ -82,8 +97,10 @@ bool nrf_802154_ack_timeout_abort(nrf_802154_term_t term_lvl, req_originator_t r
  * @brief Handles a transmitted event.
  *
  * @param[in]  p_frame  Pointer to the buffer that contains the transmitted frame.
+ *
+ * @retval  true  Always succeeds.
  */
-void nrf_802154_ack_timeout_transmitted_hook(const uint8_t * p_frame);
+bool nrf_802154_ack_timeout_transmitted_hook(const uint8_t * p_frame);
 
 /**
  * @brief Handles a TX failed event.
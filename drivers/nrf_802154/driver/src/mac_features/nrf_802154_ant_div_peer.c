@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the table of the best antennas for the peers of the 802.15.4 driver.
+ *
+ */
+
+#include "nrf_802154_ant_div_peer.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_utils.h"
+
+#if NRF_802154_ANT_DIV_PEER_TABLE_ENABLED
+
+/**
+ * @brief Entry of the peer antenna table.
+ */
+typedef struct
+{
+    uint8_t                         addr[EXTENDED_ADDRESS_SIZE]; ///< Address of the peer.
+    uint8_t                         addr_size;                   ///< Address size, 0 if free.
+    nrf_802154_sl_ant_div_antenna_t antenna;                     ///< Best antenna for the peer.
+    uint32_t                        stamp;                       ///< @ref m_stamp at last update.
+} peer_entry_t;
+
+static peer_entry_t m_peers[NRF_802154_ANT_DIV_PEER_TABLE_SIZE]; ///< Peer antenna table.
+static uint32_t     m_stamp;                                     ///< Counter of table updates.
+
+/**
+ * @brief Finds the entry of the peer with the given address.
+ *
+ * @param[in]  p_addr     Pointer to the address of the peer.
+ * @param[in]  addr_size  Size of the address.
+ *
+ * @returns  Pointer to the entry of the peer or NULL if the peer is not in the table.
+ */
+static peer_entry_t * peer_find(const uint8_t * p_addr, uint8_t addr_size)
+{
+    for (uint32_t i = 0; i < NUMELTS(m_peers); i++)
+    {
+        if ((m_peers[i].addr_size == addr_size) &&
+            (0 == memcmp(m_peers[i].addr, p_addr, addr_size)))
+        {
+            return &m_peers[i];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Finds the entry to be used for a new peer.
+ *
+ * @returns  Pointer to a free entry or, if the table is full, to the entry updated least recently.
+ */
+static peer_entry_t * peer_slot_get(void)
+{
+    peer_entry_t * p_oldest = &m_peers[0];
+
+    for (uint32_t i = 0; i < NUMELTS(m_peers); i++)
+    {
+        if (m_peers[i].addr_size == 0U)
+        {
+            return &m_peers[i];
+        }
+
+        if ((m_stamp - m_peers[i].stamp) > (m_stamp - p_oldest->stamp))
+        {
+            p_oldest = &m_peers[i];
+        }
+    }
+
+    return p_oldest;
+}
+
+void nrf_802154_ant_div_peer_init(void)
+{
+    memset(m_peers, 0, sizeof(m_peers));
+    m_stamp = 0U;
+}
+
+void nrf_802154_ant_div_peer_rx_frame_update(
+    const nrf_802154_frame_parser_data_t * p_frame_data,
+    nrf_802154_sl_ant_div_antenna_t        antenna)
+{
+    const uint8_t * p_addr    = nrf_802154_frame_parser_src_addr_get(p_frame_data);
+    uint8_t         addr_size = nrf_802154_frame_parser_src_addr_size_get(p_frame_data);
+    peer_entry_t  * p_entry;
+
+    if ((p_addr == NULL) || (addr_size == 0U) || (antenna == NRF_802154_SL_ANT_DIV_ANTENNA_NONE))
+    {
+        return;
+    }
+
+    p_entry = peer_find(p_addr, addr_size);
+
+    if (p_entry == NULL)
+    {
+        p_entry = peer_slot_get();
+
+        memcpy(p_entry->addr, p_addr, addr_size);
+        p_entry->addr_size = addr_size;
+    }
+
+    p_entry->antenna = antenna;
+    p_entry->stamp   = ++m_stamp;
+}
+
+nrf_802154_sl_ant_div_antenna_t nrf_802154_ant_div_peer_tx_antenna_get(const uint8_t * p_frame)
+{
+    nrf_802154_frame_parser_data_t frame_data;
+    const uint8_t                * p_addr;
+    const peer_entry_t           * p_entry;
+
+    bool result = nrf_802154_frame_parser_data_init(p_frame,
+                                                    p_frame[PHR_OFFSET] + PHR_SIZE,
+                                                    PARSE_LEVEL_DST_ADDRESSING_END,
+                                                    &frame_data);
+
+    if (!result)
+    {
+        return NRF_802154_SL_ANT_DIV_ANTENNA_NONE;
+    }
+
+    p_addr = nrf_802154_frame_parser_dst_addr_get(&frame_data);
+
+    if (p_addr == NULL)
+    {
+        return NRF_802154_SL_ANT_DIV_ANTENNA_NONE;
+    }
+
+    p_entry = peer_find(p_addr, nrf_802154_frame_parser_dst_addr_size_get(&frame_data));
+
+    return (p_entry != NULL) ? p_entry->antenna : NRF_802154_SL_ANT_DIV_ANTENNA_NONE;
+}
+
+#endif // NRF_802154_ANT_DIV_PEER_TABLE_ENABLED
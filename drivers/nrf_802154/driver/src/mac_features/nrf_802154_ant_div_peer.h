@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @defgroup nrf_802154_ant_div_peer Per-peer antenna selection
+ * @{
+ * @ingroup nrf_802154
+ * @brief Table of the best antennas for the peers of the 802.15.4 driver.
+ */
+
+#ifndef NRF_802154_ANT_DIV_PEER_H_
+#define NRF_802154_ANT_DIV_PEER_H_
+
+#include <stdint.h>
+
+#include "nrf_802154_sl_ant_div.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+
+/**
+ * @brief Initializes the per-peer antenna selection feature.
+ */
+void nrf_802154_ant_div_peer_init(void);
+
+/**
+ * @brief Remembers the antenna on which a frame was received from a peer.
+ *
+ * The antenna is remembered for the source address of the frame. Frames without the source
+ * address are ignored, and so is @ref NRF_802154_SL_ANT_DIV_ANTENNA_NONE passed as @p antenna.
+ *
+ * @param[in]  p_frame_data  Pointer to the parser data of the received frame. The frame must be
+ *                           parsed at least to the @ref PARSE_LEVEL_ADDRESSING_END level.
+ * @param[in]  antenna       Antenna selected as the best one for the reception of the frame.
+ */
+void nrf_802154_ant_div_peer_rx_frame_update(
+    const nrf_802154_frame_parser_data_t * p_frame_data,
+    nrf_802154_sl_ant_div_antenna_t        antenna);
+
+/**
+ * @brief Gets the antenna to be used for transmission of the given frame.
+ *
+ * @param[in]  p_frame  Pointer to the buffer that contains the PHR and PSDU of the frame.
+ *
+ * @returns  Antenna remembered for the destination address of the frame or
+ *           @ref NRF_802154_SL_ANT_DIV_ANTENNA_NONE if the antenna for the destination is unknown.
+ */
+nrf_802154_sl_ant_div_antenna_t nrf_802154_ant_div_peer_tx_antenna_get(const uint8_t * p_frame);
+
+/**
+ *@}
+ **/
+
+#endif // NRF_802154_ANT_DIV_PEER_H_
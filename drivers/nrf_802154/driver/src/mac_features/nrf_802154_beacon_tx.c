@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the autonomous beacon transmitter of the 802.15.4 driver.
+ *
+ * The beacon transmitter requests a delayed transmission shortly before each beacon is due.
+ * Each beacon is prepared from the template registered by the higher layer: the sequence number
+ * is incremented and the ASN in the TSCH Synchronization IE is advanced. The security and
+ * the header IEs are processed by the driver during the transmission, as for any other frame.
+ *
+ */
+
+#include "nrf_802154_beacon_tx.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_procedures_duration.h"
+#include "nrf_802154_request.h"
+#include "nrf_802154_sl_timer.h"
+#include "nrf_802154_utils_byteorder.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+
+#if NRF_802154_BEACON_TX_ENABLED
+
+#if !NRF_802154_DELAYED_TRX_ENABLED
+#error NRF_802154_BEACON_TX_ENABLED requires NRF_802154_DELAYED_TRX_ENABLED
+#endif
+
+#define BEACON_TX_REQUEST_LEAD_US 2000U ///< Time between requesting a beacon transmission and its start [us].
+
+static volatile bool                 m_running;                             ///< Whether the beacon transmitter is running.
+static uint8_t                       m_template[MAX_PACKET_SIZE + PHR_SIZE]; ///< Beacon registered by the higher layer.
+static uint8_t                       m_frame[MAX_PACKET_SIZE + PHR_SIZE];    ///< Beacon being transmitted.
+static nrf_802154_beacon_tx_config_t m_config;                              ///< Description of the periodic transmission.
+static uint8_t                       m_asn_offset;                          ///< Offset of the ASN in the beacon, 0 if absent.
+static uint8_t                       m_dsn;                                 ///< Sequence number of the next beacon.
+static uint32_t                      m_beacon_idx;                          ///< Number of periods since the first beacon.
+static uint64_t                      m_next_tx_time;                        ///< Time of the next beacon to be requested [us].
+static nrf_802154_sl_timer_t         m_timer;                               ///< Timer requesting the next beacon.
+
+static void timer_fired(nrf_802154_sl_timer_t * p_timer);
+
+/**
+ * @brief Finds the ASN field of the TSCH Synchronization IE in a beacon.
+ *
+ * Payload IEs follow the Header Termination 1 IE. The TSCH Synchronization IE is a short nested
+ * IE in the MLME Payload IE.
+ *
+ * @param[in]  p_frame_data  Pointer to the parser data of the beacon.
+ *
+ * @return Offset of the ASN field from the PHR, or 0 if the beacon contains no such field.
+ */
+static uint8_t asn_offset_find(const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+    const uint8_t * p_iterator = nrf_802154_frame_parser_ie_header_get(p_frame_data);
+    const uint8_t * p_end      = nrf_802154_frame_parser_mfr_get(p_frame_data) -
+                                 nrf_802154_frame_parser_mic_size_get(p_frame_data);
+
+    if (p_iterator == NULL)
+    {
+        return 0U;
+    }
+
+    while (!nrf_802154_frame_parser_ie_iterator_end(p_iterator, p_end))
+    {
+        p_iterator = nrf_802154_frame_parser_ie_iterator_next(p_iterator);
+    }
+
+    if ((p_iterator >= p_end) || (nrf_802154_frame_parser_ie_id_get(p_iterator) != IE_HT1))
+    {
+        return 0U;
+    }
+
+    p_iterator = nrf_802154_frame_parser_ie_content_address_get(p_iterator);
+
+    while ((p_iterator + IE_HEADER_SIZE) <= p_end)
+    {
+        uint16_t        header   = little_16_to_host((uint8_t *)p_iterator);
+        uint8_t         group_id = (header >> IE_PAYLOAD_GROUP_ID_SHIFT) &
+                                   IE_PAYLOAD_GROUP_ID_MASK;
+        const uint8_t * p_nested = p_iterator + IE_HEADER_SIZE;
+        const uint8_t * p_next   = p_nested + (header & IE_PAYLOAD_LENGTH_MASK);
+
+        if ((group_id == IE_PAYLOAD_TERMINATION_GROUP_ID) || (p_next > p_end))
+        {
+            break;
+        }
+
+        while ((group_id == IE_PAYLOAD_MLME_GROUP_ID) && ((p_nested + IE_HEADER_SIZE) <= p_next))
+        {
+            uint16_t nested_header = little_16_to_host((uint8_t *)p_nested);
+            uint16_t length;
+
+            if (nested_header & IE_NESTED_LONG_BIT)
+            {
+                length = nested_header & IE_NESTED_LONG_LENGTH_MASK;
+            }
+            else
+            {
+                uint8_t sub_id = (nested_header >> IE_NESTED_SHORT_SUB_ID_SHIFT) &
+                                 IE_NESTED_SHORT_SUB_ID_MASK;
+
+                length = nested_header & IE_NESTED_SHORT_LENGTH_MASK;
+
+                if ((sub_id == IE_TSCH_SYNC_SUB_ID) && (length >= IE_TSCH_SYNC_SIZE_MIN) &&
+                    ((p_nested + IE_HEADER_SIZE + length) <= p_next))
+                {
+                    return (uint8_t)(p_nested + IE_HEADER_SIZE - p_frame_data->p_frame);
+                }
+            }
+
+            p_nested += IE_HEADER_SIZE + length;
+        }
+
+        p_iterator = p_next;
+    }
+
+    return 0U;
+}
+
+/**
+ * @brief Arms the timer to request the beacon due at @ref m_next_tx_time.
+ *
+ * Beacons that are too close to be requested in time are skipped.
+ */
+static void timer_arm(void)
+{
+    nrf_802154_sl_timer_ret_t ret;
+
+    m_timer.action_type              = NRF_802154_SL_TIMER_ACTION_TYPE_CALLBACK;
+    m_timer.action.callback.callback = timer_fired;
+
+    while (true)
+    {
+        m_timer.trigger_time = m_next_tx_time - BEACON_TX_REQUEST_LEAD_US;
+
+        ret = nrf_802154_sl_timer_add(&m_timer);
+
+        if (ret != NRF_802154_SL_TIMER_RET_TOO_LATE)
+        {
+            break;
+        }
+
+        m_next_tx_time += m_config.period;
+        m_beacon_idx++;
+    }
+
+    assert(ret == NRF_802154_SL_TIMER_RET_SUCCESS);
+    (void)ret;
+}
+
+/**
+ * @brief Prepares the next beacon from the template.
+ */
+static void beacon_prepare(void)
+{
+    memcpy(m_frame, m_template, m_template[PHR_OFFSET] + PHR_SIZE);
+
+    if ((m_frame[DSN_SUPPRESS_OFFSET] & DSN_SUPPRESS_BIT) == 0U)
+    {
+        m_frame[DSN_OFFSET] = m_dsn++;
+    }
+
+    if (m_asn_offset != 0U)
+    {
+        uint64_t asn = m_config.asn + (uint64_t)m_beacon_idx * m_config.asn_increment;
+
+        host_32_to_little((uint32_t)asn, &m_frame[m_asn_offset]);
+        m_frame[m_asn_offset + sizeof(uint32_t)] = (uint8_t)(asn >> 32);
+    }
+}
+
+static void timer_fired(nrf_802154_sl_timer_t * p_timer)
+{
+    (void)p_timer;
+
+    if (!m_running)
+    {
+        return;
+    }
+
+    nrf_802154_transmit_at_metadata_t metadata =
+    {
+        .frame_props        = NRF_802154_TRANSMITTED_FRAME_PROPS_DEFAULT_INIT,
+        .cca                = m_config.cca,
+        .channel            = m_config.channel,
+        .tx_power           = m_config.tx_power,
+        .extra_cca_attempts = 0U,
+    };
+
+    beacon_prepare();
+
+    // A beacon that cannot be scheduled is skipped. The higher layer is not involved.
+    (void)nrf_802154_request_transmit_raw_at(m_frame, m_next_tx_time, &metadata);
+
+    m_next_tx_time += m_config.period;
+    m_beacon_idx++;
+    timer_arm();
+}
+
+void nrf_802154_beacon_tx_init(void)
+{
+    m_running = false;
+    nrf_802154_sl_timer_init(&m_timer);
+}
+
+void nrf_802154_beacon_tx_deinit(void)
+{
+    m_running = false;
+    nrf_802154_sl_timer_deinit(&m_timer);
+}
+
+bool nrf_802154_beacon_tx_module_start(const uint8_t                       * p_template,
+                                       const nrf_802154_beacon_tx_config_t * p_config)
+{
+    nrf_802154_frame_parser_data_t frame_data;
+    uint8_t                        psdu_length = p_template[PHR_OFFSET];
+
+    if ((psdu_length > MAX_PACKET_SIZE) ||
+        !nrf_802154_frame_parser_data_init(p_template,
+                                           psdu_length + PHR_SIZE,
+                                           PARSE_LEVEL_FULL,
+                                           &frame_data) ||
+        (nrf_802154_frame_parser_frame_type_get(&frame_data) != FRAME_TYPE_BEACON))
+    {
+        return false;
+    }
+
+    // The previous beacon must be over before the next one is prepared in the same buffer.
+    if (p_config->period <= (BEACON_TX_REQUEST_LEAD_US +
+                             nrf_802154_tx_duration_get(psdu_length, p_config->cca, false)))
+    {
+        return false;
+    }
+
+    nrf_802154_beacon_tx_module_stop();
+
+    memcpy(m_template, p_template, psdu_length + PHR_SIZE);
+
+    m_config       = *p_config;
+    m_asn_offset   = asn_offset_find(&frame_data);
+    m_dsn          = p_template[DSN_OFFSET];
+    m_beacon_idx   = 0U;
+    m_next_tx_time = p_config->tx_time;
+    m_running      = true;
+
+    timer_arm();
+
+    return true;
+}
+
+void nrf_802154_beacon_tx_module_stop(void)
+{
+    m_running = false;
+
+    (void)nrf_802154_sl_timer_remove(&m_timer);
+}
+
+bool nrf_802154_beacon_tx_transmit_done_hook(const uint8_t * p_frame)
+{
+    return p_frame == m_frame;
+}
+
+#endif // NRF_802154_BEACON_TX_ENABLED
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file contains declarations of the autonomous beacon transmitter of the 802.15.4 driver.
+ *
+ */
+
+#ifndef NRF_802154_BEACON_TX_H
+#define NRF_802154_BEACON_TX_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_types.h"
+
+/**
+ * @brief Initializes the autonomous beacon transmitter.
+ */
+void nrf_802154_beacon_tx_init(void);
+
+/**
+ * @brief Deinitializes the autonomous beacon transmitter.
+ */
+void nrf_802154_beacon_tx_deinit(void);
+
+/**
+ * @brief Starts transmitting a beacon periodically.
+ *
+ * @param[in]  p_template  Pointer to a buffer that contains PHR and PSDU of the beacon.
+ *                         The beacon is copied.
+ * @param[in]  p_config    Pointer to the description of the periodic transmission.
+ *
+ * @retval  true   The beacon transmitter has been started.
+ * @retval  false  The beacon or the parameters are invalid.
+ */
+bool nrf_802154_beacon_tx_module_start(const uint8_t                       * p_template,
+                                       const nrf_802154_beacon_tx_config_t * p_config);
+
+/**
+ * @brief Stops transmitting the beacon.
+ */
+void nrf_802154_beacon_tx_module_stop(void);
+
+/**
+ * @brief Handles the end of the transmission of a frame.
+ *
+ * This function is called by the notification module before the result of a transmission is
+ * notified to the higher layer.
+ *
+ * @param[in]  p_frame  Pointer to the buffer that contains the PHR and PSDU of the frame whose
+ *                      transmission has ended.
+ *
+ * @retval  true   The frame is a beacon sent by the beacon transmitter. The result is not to be
+ *                 notified to the higher layer.
+ * @retval  false  The frame does not belong to the beacon transmitter.
+ */
+bool nrf_802154_beacon_tx_transmit_done_hook(const uint8_t * p_frame);
+
+#endif // NRF_802154_BEACON_TX_H
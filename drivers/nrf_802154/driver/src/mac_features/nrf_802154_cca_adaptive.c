@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the adaptation of the CCA energy detection threshold of the 802.15.4
+ *   driver.
+ *
+ */
+
+#include "nrf_802154_cca_adaptive.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_nrfx_addons.h"
+#include "mac_features/nrf_802154_noise_floor.h"
+
+#if NRF_802154_CCA_ADAPTIVE_ENABLED
+
+#define CCA_ADAPTIVE_WINDOW        16U  ///< Number of CCA attempts after which the bias is revised.
+#define CCA_ADAPTIVE_BIAS_MIN      (-6) ///< Lowest bias of the threshold in dB.
+#define CCA_ADAPTIVE_BIAS_MAX      6    ///< Highest bias of the threshold in dB.
+
+/** Highest threshold allowed by IEEE Std. 802.15.4: 10 dB above the receiver sensitivity. */
+#define CCA_ADAPTIVE_THRESHOLD_MAX (PHY_MIN_RECEIVER_SENSITIVITY + 10)
+
+/** Lowest threshold that can be written to the CCACTRL register. */
+#define CCA_ADAPTIVE_THRESHOLD_MIN ED_RSSIOFFS
+
+static uint8_t  m_cca_attempts; ///< CCA attempts in the current window.
+static uint8_t  m_cca_busy;     ///< CCA attempts that found the channel busy in the current window.
+static uint16_t m_acked;        ///< Acknowledged transmissions in the current window.
+static uint16_t m_not_acked;    ///< Unacknowledged transmissions in the current window.
+static int8_t   m_bias;         ///< Bias of the threshold over the noise floor and margin in dB.
+
+/**
+ * @brief Revises the bias of the threshold once the window of CCA attempts is complete.
+ */
+static void bias_revise(void)
+{
+    uint32_t transmissions = (uint32_t)m_acked + m_not_acked;
+
+    if ((transmissions > 0U) && ((uint32_t)m_not_acked * 4U >= transmissions))
+    {
+        // Frequently missing ACKs hint at collisions with transmissions the CCA did not detect.
+        if (m_bias > CCA_ADAPTIVE_BIAS_MIN)
+        {
+            m_bias--;
+        }
+    }
+    else if ((uint32_t)m_cca_busy * 2U > CCA_ADAPTIVE_WINDOW)
+    {
+        // The channel is mostly reported busy while the transmitted frames get through, so
+        // the threshold is likely too close to the noise floor.
+        if (m_bias < CCA_ADAPTIVE_BIAS_MAX)
+        {
+            m_bias++;
+        }
+    }
+    else
+    {
+        // Intentionally empty: the threshold is adequate.
+    }
+
+    m_cca_attempts = 0U;
+    m_cca_busy     = 0U;
+    m_acked        = 0U;
+    m_not_acked    = 0U;
+}
+
+void nrf_802154_cca_adaptive_init(void)
+{
+    m_cca_attempts = 0U;
+    m_cca_busy     = 0U;
+    m_acked        = 0U;
+    m_not_acked    = 0U;
+    m_bias         = 0;
+}
+
+void nrf_802154_cca_adaptive_cca_result_update(bool busy)
+{
+    m_cca_attempts++;
+
+    if (busy)
+    {
+        m_cca_busy++;
+    }
+
+    if (m_cca_attempts >= CCA_ADAPTIVE_WINDOW)
+    {
+        bias_revise();
+    }
+}
+
+void nrf_802154_cca_adaptive_ack_result_update(bool acked)
+{
+    uint16_t * p_counter = acked ? &m_acked : &m_not_acked;
+
+    if (*p_counter < UINT16_MAX)
+    {
+        (*p_counter)++;
+    }
+}
+
+bool nrf_802154_cca_adaptive_threshold_get(uint8_t channel, int8_t * p_threshold_dbm)
+{
+    int8_t noise_floor;
+
+    if (!nrf_802154_noise_floor_get(channel, &noise_floor))
+    {
+        return false;
+    }
+
+    int32_t threshold = (int32_t)noise_floor + NRF_802154_CCA_ADAPTIVE_MARGIN_DB + m_bias;
+
+    if (threshold > CCA_ADAPTIVE_THRESHOLD_MAX)
+    {
+        threshold = CCA_ADAPTIVE_THRESHOLD_MAX;
+    }
+
+    if (threshold < CCA_ADAPTIVE_THRESHOLD_MIN)
+    {
+        threshold = CCA_ADAPTIVE_THRESHOLD_MIN;
+    }
+
+    *p_threshold_dbm = (int8_t)threshold;
+
+    return true;
+}
+
+bool nrf_802154_cca_adaptive_ed_threshold_get(uint8_t channel, uint8_t * p_ed_threshold)
+{
+    int8_t threshold_dbm;
+
+    if (!nrf_802154_cca_adaptive_threshold_get(channel, &threshold_dbm))
+    {
+        return false;
+    }
+
+    *p_ed_threshold = (uint8_t)(threshold_dbm - ED_RSSIOFFS);
+
+    return true;
+}
+
+#endif // NRF_802154_CCA_ADAPTIVE_ENABLED
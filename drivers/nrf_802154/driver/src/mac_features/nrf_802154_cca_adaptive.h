@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @defgroup nrf_802154_cca_adaptive Adaptive CCA threshold
+ * @{
+ * @ingroup nrf_802154
+ * @brief Adaptation of the CCA energy detection threshold to the channel noise floor.
+ */
+
+#ifndef NRF_802154_CCA_ADAPTIVE_H_
+#define NRF_802154_CCA_ADAPTIVE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Initializes the adaptive CCA threshold feature.
+ */
+void nrf_802154_cca_adaptive_init(void);
+
+/**
+ * @brief Accounts the result of a CCA performed before a transmission.
+ *
+ * @param[in]  busy  If the CCA found the channel busy.
+ */
+void nrf_802154_cca_adaptive_cca_result_update(bool busy);
+
+/**
+ * @brief Accounts the result of a transmission that requested an ACK.
+ *
+ * @param[in]  acked  If a matching ACK was received.
+ */
+void nrf_802154_cca_adaptive_ack_result_update(bool acked);
+
+/**
+ * @brief Gets the adapted CCA energy detection threshold of a channel in dBm.
+ *
+ * @param[in]   channel            Channel for which the threshold is requested.
+ * @param[out]  p_threshold_dbm    Pointer to the threshold in dBm.
+ *
+ * @retval true   The threshold was retrieved.
+ * @retval false  There is no noise floor estimate of the channel yet.
+ */
+bool nrf_802154_cca_adaptive_threshold_get(uint8_t channel, int8_t * p_threshold_dbm);
+
+/**
+ * @brief Gets the adapted CCA energy detection threshold of a channel as a CCACTRL register value.
+ *
+ * @param[in]   channel         Channel for which the threshold is requested.
+ * @param[out]  p_ed_threshold  Pointer to the threshold to be written to the CCACTRL register.
+ *
+ * @retval true   The threshold was retrieved.
+ * @retval false  There is no noise floor estimate of the channel yet.
+ */
+bool nrf_802154_cca_adaptive_ed_threshold_get(uint8_t channel, uint8_t * p_ed_threshold);
+
+/**
+ *@}
+ **/
+
+#endif // NRF_802154_CCA_ADAPTIVE_H_
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the autonomous CSL receiver of the 802.15.4 driver.
+ *
+ * The CSL receiver requests a delayed reception window shortly before each CSL sample window
+ * and puts the radio to sleep when the window ends without a frame.
+ *
+ */
+
+#include "nrf_802154_csl_receiver.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_request.h"
+#include "mac_features/nrf_802154_ie_writer.h"
+#include "nrf_802154_sl_timer.h"
+
+#if NRF_802154_CSL_RECEIVER_ENABLED
+
+#if !NRF_802154_DELAYED_TRX_ENABLED
+#error NRF_802154_CSL_RECEIVER_ENABLED requires NRF_802154_DELAYED_TRX_ENABLED
+#endif
+
+#define CSL_US_PER_UNIT            (IE_CSL_SYMBOLS_PER_UNIT * PHY_US_PER_SYMBOL) ///< Duration of a unit of CSL period [us].
+#define CSL_WINDOW_REQUEST_LEAD_US 2000U                                         ///< Time between requesting a CSL window and its start [us].
+
+static volatile bool         m_running;           ///< Whether the CSL receiver is running.
+static uint32_t              m_period_us;         ///< CSL period [us].
+static uint32_t              m_window_duration;   ///< Duration of a CSL window [us].
+static uint8_t               m_channel;           ///< Channel on which the CSL windows are opened.
+static uint64_t              m_next_window_start; ///< Start time of the next CSL window to be requested [us].
+static nrf_802154_sl_timer_t m_timer;             ///< Timer requesting the next CSL window.
+
+static void timer_fired(nrf_802154_sl_timer_t * p_timer);
+
+/**
+ * @brief Arms the timer to request the window starting at @ref m_next_window_start.
+ *
+ * Windows that are too close to be requested in time are skipped.
+ */
+static void timer_arm(void)
+{
+    nrf_802154_sl_timer_ret_t ret;
+
+    m_timer.action_type              = NRF_802154_SL_TIMER_ACTION_TYPE_CALLBACK;
+    m_timer.action.callback.callback = timer_fired;
+
+    while (true)
+    {
+        m_timer.trigger_time = m_next_window_start - CSL_WINDOW_REQUEST_LEAD_US;
+
+        ret = nrf_802154_sl_timer_add(&m_timer);
+
+        if (ret != NRF_802154_SL_TIMER_RET_TOO_LATE)
+        {
+            break;
+        }
+
+        m_next_window_start += m_period_us;
+    }
+
+    assert(ret == NRF_802154_SL_TIMER_RET_SUCCESS);
+    (void)ret;
+}
+
+static void timer_fired(nrf_802154_sl_timer_t * p_timer)
+{
+    (void)p_timer;
+
+    if (!m_running)
+    {
+        return;
+    }
+
+    // The previous window is normally over at this point. If it was extended by an incoming
+    // frame, stop tracking it, so that the identifier can be reused.
+    (void)nrf_802154_request_receive_at_cancel(NRF_802154_RESERVED_CSL_RX_ID);
+
+    // A window that cannot be scheduled is skipped. The higher layer is not involved.
+    (void)nrf_802154_request_receive_at(m_next_window_start,
+                                        m_window_duration,
+                                        m_channel,
+                                        NRF_802154_RESERVED_CSL_RX_ID);
+
+    m_next_window_start += m_period_us;
+    timer_arm();
+}
+
+/**
+ * @brief Finds the start time of the earliest CSL window that can still be requested in time.
+ *
+ * @param[in]  anchor_time  Time of the middle of any of the CSL windows.
+ *
+ * @return Start time of the window [us].
+ */
+static uint64_t first_window_start_get(uint64_t anchor_time)
+{
+    uint64_t earliest = nrf_802154_sl_timer_current_time_get() + CSL_WINDOW_REQUEST_LEAD_US;
+    uint64_t start    = anchor_time - m_window_duration / 2U;
+
+    if (start < earliest)
+    {
+        start += ((earliest - start) / m_period_us + 1U) * m_period_us;
+    }
+    else
+    {
+        start -= ((start - earliest) / m_period_us) * m_period_us;
+    }
+
+    return start;
+}
+
+void nrf_802154_csl_receiver_init(void)
+{
+    m_running = false;
+    nrf_802154_sl_timer_init(&m_timer);
+}
+
+void nrf_802154_csl_receiver_deinit(void)
+{
+    m_running = false;
+    nrf_802154_sl_timer_deinit(&m_timer);
+}
+
+bool nrf_802154_csl_receiver_module_start(uint16_t period,
+                                          uint64_t anchor_time,
+                                          uint32_t window_duration,
+                                          uint8_t  channel)
+{
+    uint32_t period_us = (uint32_t)period * CSL_US_PER_UNIT;
+
+    if ((window_duration == 0U) || (window_duration >= period_us))
+    {
+        return false;
+    }
+
+    nrf_802154_csl_receiver_module_stop();
+
+#if NRF_802154_IE_WRITER_ENABLED
+    nrf_802154_ie_writer_csl_period_set(period);
+    nrf_802154_ie_writer_csl_anchor_time_set(anchor_time);
+#endif
+
+    m_period_us         = period_us;
+    m_window_duration   = window_duration;
+    m_channel           = channel;
+    m_next_window_start = first_window_start_get(anchor_time);
+    m_running           = true;
+
+    timer_arm();
+
+    return true;
+}
+
+void nrf_802154_csl_receiver_module_stop(void)
+{
+    m_running = false;
+
+    (void)nrf_802154_sl_timer_remove(&m_timer);
+    (void)nrf_802154_request_receive_at_cancel(NRF_802154_RESERVED_CSL_RX_ID);
+}
+
+void nrf_802154_csl_receiver_window_end_hook(nrf_802154_rx_error_t error)
+{
+    if (m_running && (error == NRF_802154_RX_ERROR_DELAYED_TIMEOUT))
+    {
+        // Nothing was received in the window. Go to sleep unless the radio is busy.
+        (void)nrf_802154_request_sleep(NRF_802154_TERM_NONE);
+    }
+}
+
+#endif // NRF_802154_CSL_RECEIVER_ENABLED
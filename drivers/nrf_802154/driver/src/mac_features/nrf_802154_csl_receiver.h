@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file contains declarations of the autonomous CSL receiver of the 802.15.4 driver.
+ *
+ */
+
+#ifndef NRF_802154_CSL_RECEIVER_H
+#define NRF_802154_CSL_RECEIVER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_types.h"
+
+/**
+ * @brief Initializes the autonomous CSL receiver.
+ */
+void nrf_802154_csl_receiver_init(void);
+
+/**
+ * @brief Deinitializes the autonomous CSL receiver.
+ */
+void nrf_802154_csl_receiver_deinit(void);
+
+/**
+ * @brief Starts opening CSL windows periodically.
+ *
+ * @param[in]  period           CSL period, in units of 10 symbols.
+ * @param[in]  anchor_time      Time of the middle of any of the CSL windows [us].
+ * @param[in]  window_duration  Duration of each CSL window [us].
+ * @param[in]  channel          Radio channel on which the windows are opened.
+ *
+ * @retval  true   The CSL receiver has been started.
+ * @retval  false  The parameters are invalid.
+ */
+bool nrf_802154_csl_receiver_module_start(uint16_t period,
+                                          uint64_t anchor_time,
+                                          uint32_t window_duration,
+                                          uint8_t  channel);
+
+/**
+ * @brief Stops opening CSL windows.
+ */
+void nrf_802154_csl_receiver_module_stop(void);
+
+/**
+ * @brief Handles the end of a CSL window that was not ended by a frame reception.
+ *
+ * This function is called by the delayed reception window feature instead of notifying
+ * the higher layer.
+ *
+ * @param[in]  error  Reason why the window ended.
+ */
+void nrf_802154_csl_receiver_window_end_hook(nrf_802154_rx_error_t error);
+
+#endif // NRF_802154_CSL_RECEIVER_H
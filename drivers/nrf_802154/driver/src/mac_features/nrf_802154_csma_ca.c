@@ -55,12 +55,18 @@
 #include "nrf_802154_pib.h"
 #include "nrf_802154_request.h"
 #include "nrf_802154_tx_power.h"
+#include "nrf_802154_tx_work_buffer.h"
 #include "nrf_802154_stats.h"
 #include "platform/nrf_802154_random.h"
 #include "rsch/nrf_802154_rsch.h"
 #include "nrf_802154_sl_timer.h"
 #include "nrf_802154_sl_atomics.h"
 
+/// Weight of the latest CCA attempt in the channel occupancy estimate, as a power of 2 divisor.
+#define OCCUPANCY_WEIGHT_SHIFT 4U
+/// Channel occupancy estimate corresponding to the channel busy all the time.
+#define OCCUPANCY_MAX          UINT16_MAX
+
 /**
  * @brief States of the CSMA-CA procedure.
  */
@@ -80,6 +86,14 @@ static nrf_802154_transmitted_frame_props_t m_data_props; ///< Structure contain
 static nrf_802154_fal_tx_power_split_t      m_tx_power;   ///< Power to be used when transmitting the frame split into components.
 static csma_ca_state_t                      m_state;      ///< The current state of the CSMA-CA procedure.
 
+static uint8_t   m_frame_retries;                         ///< The number of retransmissions of the current frame performed so far.
+static bool      m_retry_pending;                         ///< Indicates if the current frame is awaiting an ACK and may be retransmitted.
+static uint8_t * mp_retry_frame;                          ///< Pointer to a buffer containing PHR and PSDU of the frame subject to retransmissions.
+
+static uint16_t m_occupancy;                              ///< Running ratio of busy CCA attempts, scaled to @ref OCCUPANCY_MAX.
+
+static nrf_802154_sl_timer_t m_coex_timer;                ///< Timer raising the Coex request ahead of the end of the backoff.
+
 /**
  * @brief Perform appropriate actions for busy channel conditions.
  *
@@ -114,12 +128,19 @@ static void priority_leverage(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
 
+    nrf_802154_coex_tx_request_mode_t mode = nrf_802154_pib_coex_tx_request_mode_get();
+
     bool first_transmit_attempt     = (0 == m_nb);
-    bool coex_requires_boosted_prio = (nrf_802154_pib_coex_tx_request_mode_get() ==
-                                       NRF_802154_COEX_TX_REQUEST_MODE_CCA_START);
+    bool coex_requires_boosted_prio = (mode == NRF_802154_COEX_TX_REQUEST_MODE_CCA_START);
+
+    // In the predictive mode the timer leverages the priority ahead of the end of the backoff.
+    // If it did not fire yet, the priority must be leveraged now.
+    bool coex_request_is_late = (mode == NRF_802154_COEX_TX_REQUEST_MODE_PREDICTIVE) &&
+                                (nrf_802154_sl_timer_remove(&m_coex_timer) ==
+                                 NRF_802154_SL_TIMER_RET_SUCCESS);
 
     // Leverage priority only after the first backoff in the specified Coex TX request mode
-    if (first_transmit_attempt && coex_requires_boosted_prio)
+    if ((first_transmit_attempt && coex_requires_boosted_prio) || coex_request_is_late)
     {
         // It should always be possible to update this timeslot's priority here
         if (!nrf_802154_rsch_delayed_timeslot_priority_update(NRF_802154_RESERVED_CSMACA_ID,
@@ -132,6 +153,60 @@ static void priority_leverage(void)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
 
+/**
+ * @brief Raises the Coex request for the CCA ahead of the end of the backoff.
+ *
+ * @param[in]  p_timer  Pointer to the timer that fired.
+ */
+static void coex_request_timer_fired(nrf_802154_sl_timer_t * p_timer)
+{
+    (void)p_timer;
+
+    // The backoff might have ended or been aborted in the meantime. In such a case, updating
+    // the priority fails and it is handled when the timeslot starts.
+    (void)nrf_802154_rsch_delayed_timeslot_priority_update(NRF_802154_RESERVED_CSMACA_ID,
+                                                           RSCH_PRIO_TX);
+}
+
+/**
+ * @brief Update the channel occupancy estimate with the result of a CCA attempt.
+ *
+ * @param[in]  busy  If the CCA attempt found the channel busy.
+ */
+static void occupancy_update(bool busy)
+{
+    uint32_t occupancy = m_occupancy;
+
+    occupancy -= occupancy >> OCCUPANCY_WEIGHT_SHIFT;
+    occupancy += busy ? (OCCUPANCY_MAX >> OCCUPANCY_WEIGHT_SHIFT) : 0U;
+
+    m_occupancy = (uint16_t)occupancy;
+}
+
+/**
+ * @brief Get the backoff exponent the CSMA-CA procedure starts with.
+ *
+ * @return macMinBe, or a value between macMinBe and macMaxBe proportional to the channel
+ *         occupancy if @ref NRF_802154_CSMA_CA_ADAPTIVE_BE_ENABLED is enabled.
+ */
+static uint8_t initial_be_get(void)
+{
+    uint8_t min_be = nrf_802154_pib_csmaca_min_be_get();
+
+#if NRF_802154_CSMA_CA_ADAPTIVE_BE_ENABLED
+    uint8_t max_be = nrf_802154_pib_csmaca_max_be_get();
+
+    if (max_be > min_be)
+    {
+        uint32_t be_range = (uint32_t)(max_be - min_be);
+
+        min_be += (uint8_t)(((be_range * m_occupancy) + (OCCUPANCY_MAX / 2U)) / OCCUPANCY_MAX);
+    }
+#endif
+
+    return min_be;
+}
+
 /**
  * @brief Notify MAC layer that CSMA-CA failed
  *
@@ -143,6 +218,7 @@ static void notify_failed(nrf_802154_tx_error_t error)
     nrf_802154_transmit_done_metadata_t metadata = {};
 
     metadata.frame_props = m_data_props;
+    metadata.retries     = m_frame_retries;
 
     nrf_802154_notify_transmit_failed(mp_data, error, &metadata);
 }
@@ -267,7 +343,8 @@ static void random_backoff_start(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
 
-    uint64_t backoff_us = backoff_periods_calc() * UNIT_BACKOFF_PERIOD;
+    uint64_t backoff_us        = backoff_periods_calc() * UNIT_BACKOFF_PERIOD;
+    bool     coex_timer_needed = false;
 
     rsch_dly_ts_param_t backoff_ts_param =
     {
@@ -297,6 +374,12 @@ static void random_backoff_start(void)
             backoff_ts_param.prio = RSCH_PRIO_IDLE_LISTENING;
             break;
 
+        case NRF_802154_COEX_TX_REQUEST_MODE_PREDICTIVE:
+            // Coex should be requested only for the end of the backoff period
+            coex_timer_needed     = (backoff_us > NRF_802154_CSMA_CA_COEX_LEAD_TIME_US);
+            backoff_ts_param.prio = coex_timer_needed ? RSCH_PRIO_IDLE_LISTENING : RSCH_PRIO_TX;
+            break;
+
         default:
             assert(false);
             break;
@@ -308,6 +391,17 @@ static void random_backoff_start(void)
         assert(false);
     }
 
+    if (coex_timer_needed)
+    {
+        m_coex_timer.trigger_time = backoff_ts_param.trigger_time -
+                                    NRF_802154_CSMA_CA_COEX_LEAD_TIME_US;
+
+        nrf_802154_sl_timer_ret_t ret = nrf_802154_sl_timer_add(&m_coex_timer);
+
+        assert(ret == NRF_802154_SL_TIMER_RET_SUCCESS);
+        (void)ret;
+    }
+
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
 
@@ -328,6 +422,8 @@ static bool channel_busy(void)
 
         if (m_nb > nrf_802154_pib_csmaca_max_backoffs_get())
         {
+            nrf_802154_stat_histogram_bin_increment(csma_ca_backoffs, m_nb);
+
             mp_data = NULL;
             bool ret = csma_ca_state_set(CSMA_CA_STATE_BACKOFF, CSMA_CA_STATE_IDLE);
 
@@ -345,6 +441,20 @@ static bool channel_busy(void)
     return result;
 }
 
+void nrf_802154_csma_ca_init(void)
+{
+    nrf_802154_sl_timer_init(&m_coex_timer);
+
+    m_coex_timer.action_type              = NRF_802154_SL_TIMER_ACTION_TYPE_CALLBACK;
+    m_coex_timer.action.callback.callback = coex_request_timer_fired;
+}
+
+void nrf_802154_csma_ca_deinit(void)
+{
+    (void)nrf_802154_sl_timer_remove(&m_coex_timer);
+    nrf_802154_sl_timer_deinit(&m_coex_timer);
+}
+
 bool nrf_802154_csma_ca_start(uint8_t                                      * p_data,
                               const nrf_802154_transmit_csma_ca_metadata_t * p_metadata)
 {
@@ -361,10 +471,13 @@ bool nrf_802154_csma_ca_start(uint8_t                                      * p_d
     assert(result);
     (void)result;
 
-    mp_data      = p_data;
-    m_data_props = p_metadata->frame_props;
-    m_nb         = 0;
-    m_be         = nrf_802154_pib_csmaca_min_be_get();
+    mp_data         = p_data;
+    m_data_props    = p_metadata->frame_props;
+    m_nb            = 0;
+    m_be            = initial_be_get();
+    m_frame_retries = 0;
+    m_retry_pending = false;
+    mp_retry_frame  = p_data;
     (void)nrf_802154_tx_power_convert_metadata_to_tx_power_split(nrf_802154_pib_channel_get(),
                                                                  p_metadata->tx_power,
                                                                  &m_tx_power);
@@ -396,6 +509,7 @@ bool nrf_802154_csma_ca_abort(nrf_802154_term_t term_lvl, req_originator_t req_o
         // pointer - it might be needed to notify failure.
         nrf_802154_sl_atomic_store_u8(&m_state, CSMA_CA_STATE_ABORTED);
         nrf_802154_rsch_delayed_timeslot_cancel(NRF_802154_RESERVED_CSMACA_ID, false);
+        (void)nrf_802154_sl_timer_remove(&m_coex_timer);
     }
     else
     {
@@ -446,6 +560,11 @@ bool nrf_802154_csma_ca_tx_failed_hook(uint8_t * p_frame, nrf_802154_tx_error_t
             }
             else if (p_frame == mp_data)
             {
+                if (error == NRF_802154_TX_ERROR_BUSY_CHANNEL)
+                {
+                    occupancy_update(true);
+                }
+
                 // The procedure is active and transmission attempt failed. Try again
                 result = channel_busy();
             }
@@ -467,12 +586,73 @@ bool nrf_802154_csma_ca_tx_started_hook(uint8_t * p_frame)
 
     if (mp_data == p_frame)
     {
-        mp_data = NULL;
+        nrf_802154_stat_histogram_bin_increment(csma_ca_backoffs, m_nb);
+        occupancy_update(false);
+
+        mp_data         = NULL;
+        m_retry_pending = true;
         nrf_802154_sl_atomic_store_u8(&m_state, CSMA_CA_STATE_IDLE);
     }
+    else if (mp_retry_frame != p_frame)
+    {
+        // A transmission not preceded by this CSMA-CA procedure has started. Forget the frame
+        // so that its retry count is not reported for an unrelated transmission.
+        m_retry_pending = false;
+        mp_retry_frame  = NULL;
+    }
+    else
+    {
+        // Intentionally empty.
+    }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
     return true;
 }
 
+bool nrf_802154_csma_ca_frame_retry_tx_failed_hook(uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    bool result = true;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    if (m_retry_pending && (p_frame == mp_retry_frame))
+    {
+        m_retry_pending = false;
+
+        bool ack_missing = ((error == NRF_802154_TX_ERROR_NO_ACK) ||
+                            (error == NRF_802154_TX_ERROR_INVALID_ACK));
+
+        if (ack_missing &&
+            (m_frame_retries < nrf_802154_pib_csmaca_max_frame_retries_get()) &&
+            csma_ca_state_set(CSMA_CA_STATE_IDLE, CSMA_CA_STATE_BACKOFF))
+        {
+            // The frame in the buffer already contains the dynamic data and security applied
+            // during the previous attempt. Retransmit it unchanged after a new CSMA-CA procedure.
+            nrf_802154_tx_work_buffer_frame_props_get(p_frame, &m_data_props);
+
+            mp_data = p_frame;
+            m_nb    = 0;
+            m_be    = initial_be_get();
+            m_frame_retries++;
+
+            random_backoff_start();
+            result = false;
+        }
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+
+    return result;
+}
+
+uint8_t nrf_802154_csma_ca_frame_retries_get(const uint8_t * p_frame)
+{
+    return (p_frame == mp_retry_frame) ? m_frame_retries : 0U;
+}
+
+uint8_t nrf_802154_csma_ca_channel_occupancy_get(void)
+{
+    return (uint8_t)(((uint32_t)m_occupancy * 100U + (OCCUPANCY_MAX / 2U)) / OCCUPANCY_MAX);
+}
+
 #endif // NRF_802154_CSMA_CA_ENABLED
@@ -48,6 +48,16 @@
  * @brief CSMA-CA procedure.
  */
 
+/**
+ * @brief Initializes the CSMA-CA module.
+ */
+void nrf_802154_csma_ca_init(void);
+
+/**
+ * @brief Deinitializes the CSMA-CA module.
+ */
+void nrf_802154_csma_ca_deinit(void);
+
 /**
  * @brief Starts the CSMA-CA procedure for the transmission of a given frame.
  *
@@ -111,6 +121,44 @@ bool nrf_802154_csma_ca_tx_failed_hook(uint8_t * p_frame, nrf_802154_tx_error_t
  */
 bool nrf_802154_csma_ca_tx_started_hook(uint8_t * p_frame);
 
+/**
+ * @brief Handles a TX failed event of a frame that may be retransmitted.
+ *
+ * If the frame transmitted by the CSMA-CA procedure was not acknowledged and the number of
+ * retransmissions performed so far is lower than the configured maximum number of frame retries,
+ * the CSMA-CA procedure is started again for the same frame.
+ *
+ * @note This hook must be called after all other TX failed hooks, as it restarts
+ *       the transmission procedure.
+ *
+ * @param[in]  p_frame  Pointer to a buffer that contains PHR and PSDU of the frame
+ *                      that was not transmitted.
+ * @param[in]  error    Cause of failed transmission.
+ *
+ * @retval  true   TX failed event is to be propagated to the MAC layer.
+ * @retval  false  TX failed event is not to be propagated to the MAC layer. The frame is
+ *                 retransmitted.
+ */
+bool nrf_802154_csma_ca_frame_retry_tx_failed_hook(uint8_t * p_frame, nrf_802154_tx_error_t error);
+
+/**
+ * @brief Gets the number of retransmissions performed for a given frame.
+ *
+ * @param[in]  p_frame  Pointer to a buffer that contains PHR and PSDU of the frame.
+ *
+ * @return Number of retransmissions of @p p_frame performed by the CSMA-CA module, or 0 if
+ *         the frame was not transmitted by the CSMA-CA module.
+ */
+uint8_t nrf_802154_csma_ca_frame_retries_get(const uint8_t * p_frame);
+
+/**
+ * @brief Gets the channel occupancy estimated from the CCA attempts of the CSMA-CA procedure.
+ *
+ * @return Running ratio of CCA attempts that found the channel busy in percent, in range
+ *         from 0 to 100.
+ */
+uint8_t nrf_802154_csma_ca_channel_occupancy_get(void);
+
 /**
  *@}
  **/
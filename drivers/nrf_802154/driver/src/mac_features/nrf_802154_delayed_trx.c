@@ -44,11 +44,13 @@
 
 #include <assert.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include "../nrf_802154_debug.h"
 #include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
+#include "nrf_802154_csl_receiver.h"
 #include "nrf_802154_frame_parser.h"
 #include "nrf_802154_notification.h"
 #include "nrf_802154_pib.h"
@@ -61,6 +63,7 @@
 #include "nrf_802154_sl_timer.h"
 #include "nrf_802154_sl_utils.h"
 #include "nrf_802154_sl_atomics.h"
+#include "nrf_802154_skiplist.h"
 
 #ifdef NRF_802154_USE_INTERNAL_INCLUDES
 #include "nrf_802154_delayed_trx_internal.h"
@@ -144,6 +147,10 @@ typedef struct
  */
 static dly_op_data_t m_dly_rx_data[NRF_802154_RSCH_DLY_TS_OP_DRX_SLOTS];
 
+#if NRF_802154_RSCH_DLY_TS_OP_DTX_SLOTS > (NRF_802154_DTX_EXTRA_IDS_NUM + 1)
+#error NRF_802154_RSCH_DLY_TS_OP_DTX_SLOTS exceeds the number of reserved delayed TX identifiers
+#endif
+
 /**
  * @brief Array of slots for TX delayed operations.
  */
@@ -159,6 +166,39 @@ static nrf_802154_queue_t m_dly_rx_id_q;
  */
 static dly_op_data_t * m_dly_rx_id_q_mem[NRF_802154_RSCH_DLY_TS_OP_DRX_SLOTS];
 
+#if NRF_802154_DELAYED_TRX_TIMELINE_ENABLED
+
+/**
+ * @brief Timeline entry holding a delayed operation that has not been requested yet.
+ */
+typedef struct
+{
+    nrf_802154_skiplist_membership_capability_t membership; ///< Membership in @ref m_timeline.
+    nrf_802154_timeline_op_t                    op;         ///< Delayed operation.
+    bool                                        in_use;     ///< Whether the entry holds an operation.
+} timeline_entry_t;
+
+/**
+ * @brief Pool of timeline entries.
+ */
+static timeline_entry_t m_timeline_entries[NRF_802154_DELAYED_TRX_TIMELINE_SIZE];
+
+/**
+ * @brief List of timeline entries ordered by the time of their operations.
+ */
+static nrf_802154_skiplist_t m_timeline;
+
+static void timeline_process(void);
+
+#else
+
+static inline void timeline_process(void)
+{
+    // Intentionally empty
+}
+
+#endif // NRF_802154_DELAYED_TRX_TIMELINE_ENABLED
+
 /**
  * @brief Search for a RX delayed operation with given ID.
  *
@@ -251,15 +291,31 @@ static bool dly_op_state_set(dly_op_data_t        * p_dly_op_data,
  */
 static dly_op_data_t * dly_tx_data_by_id_search(rsch_dly_ts_id_t id)
 {
-    // Note that this function only supports a single slot.
-    if (id == m_dly_tx_data[0].id)
+    for (uint32_t i = 0; i < sizeof(m_dly_tx_data) / sizeof(m_dly_tx_data[0]); i++)
     {
-        return &m_dly_tx_data[0];
+        if (id == m_dly_tx_data[i].id)
+        {
+            return &m_dly_tx_data[i];
+        }
     }
 
     return NULL;
 }
 
+/**
+ * @brief Get the delayed timeslot identifier reserved for a TX delayed operation slot.
+ *
+ * @param[in]  p_dly_op_data  TX delayed operation slot.
+ *
+ * @return Identifier of the slot.
+ */
+static rsch_dly_ts_id_t dly_tx_id_get(const dly_op_data_t * p_dly_op_data)
+{
+    uint32_t idx = (uint32_t)(p_dly_op_data - m_dly_tx_data);
+
+    return (idx == 0U) ? NRF_802154_RESERVED_DTX_ID : (NRF_802154_RESERVED_DTX2_ID - (idx - 1U));
+}
+
 /**
  * @brief Retrieve an available slot from a pool.
  *
@@ -328,6 +384,26 @@ static dly_op_data_t * ongoing_dly_rx_slot_get(void)
     return p_dly_op_data;
 }
 
+/**
+ * @brief Get the ongoing TX delayed operation slot.
+ *
+ * Timeslots of TX delayed operations start one at a time, so at most one slot can be ongoing.
+ *
+ * @return Pointer to a slot or NULL if no TX delayed operation is ongoing at the moment.
+ */
+static dly_op_data_t * ongoing_dly_tx_slot_get(void)
+{
+    for (uint32_t i = 0; i < sizeof(m_dly_tx_data) / sizeof(m_dly_tx_data[0]); i++)
+    {
+        if (m_dly_tx_data[i].state == DELAYED_TRX_OP_STATE_ONGOING)
+        {
+            return &m_dly_tx_data[i];
+        }
+    }
+
+    return NULL;
+}
+
 static bool dly_ts_slot_release(dly_op_data_t * p_dly_op_data, bool handler)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
@@ -415,6 +491,31 @@ static bool dly_op_request(const rsch_dly_ts_param_t * p_dly_ts_param,
     return result;
 }
 
+/**
+ * Notify MAC layer that a delayed reception window failed or ended without a frame.
+ *
+ * Windows opened autonomously by the CSL receiver are reported to the CSL receiver instead.
+ *
+ * @param[in]  error  Reason of the failure.
+ * @param[in]  id     Identifier of the reception window.
+ */
+static void dly_rx_failed_notify(nrf_802154_rx_error_t error, uint32_t id)
+{
+#if NRF_802154_CSL_RECEIVER_ENABLED
+    if (id == NRF_802154_RESERVED_CSL_RX_ID)
+    {
+        nrf_802154_csl_receiver_window_end_hook(error);
+        return;
+    }
+#endif
+
+    bool notified = nrf_802154_notify_receive_failed(error, id, false);
+
+    // It should always be possible to notify DRX result
+    assert(notified);
+    (void)notified;
+}
+
 /**
  * Notify MAC layer that no frame was received before timeout.
  *
@@ -449,15 +550,10 @@ static void notify_rx_timeout(nrf_802154_sl_timer_t * p_timer)
     }
     else
     {
-        bool notified = nrf_802154_notify_receive_failed(
-            NRF_802154_RX_ERROR_DELAYED_TIMEOUT,
-            p_dly_op_data->id,
-            false);
-
-        // It should always be possible to notify DRX result
-        assert(notified);
-        (void)notified;
+        uint32_t id = p_dly_op_data->id;
 
+        // Release the slot before the notification, so that the window is no longer considered
+        // ongoing by the operations requested in response to the timeout.
         p_dly_op_data->id = NRF_802154_RESERVED_INVALID_ID;
 
         bool result = dly_op_state_set(p_dly_op_data,
@@ -466,6 +562,10 @@ static void notify_rx_timeout(nrf_802154_sl_timer_t * p_timer)
 
         assert(result);
         (void)result;
+
+        dly_rx_failed_notify(NRF_802154_RX_ERROR_DELAYED_TIMEOUT, id);
+
+        timeline_process();
     }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
@@ -480,8 +580,7 @@ static void dly_tx_result_notify(bool result)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
 
-    // Currently there's only a single delayed transmission possible at a time
-    dly_op_data_t * p_dly_op_data = dly_tx_data_by_id_search(NRF_802154_RESERVED_DTX_ID);
+    dly_op_data_t * p_dly_op_data = ongoing_dly_tx_slot_get();
 
     assert(p_dly_op_data != NULL);
 
@@ -518,13 +617,7 @@ static void dly_rx_all_ongoing_abort(void)
             continue;
         }
 
-        bool notified = nrf_802154_notify_receive_failed(NRF_802154_RX_ERROR_DELAYED_ABORTED,
-                                                         p_dly_op_data->id,
-                                                         false);
-
-        // It should always be possible to notify DRX result
-        assert(notified);
-        (void)notified;
+        dly_rx_failed_notify(NRF_802154_RX_ERROR_DELAYED_ABORTED, p_dly_op_data->id);
 
         p_dly_op_data->id = NRF_802154_RESERVED_INVALID_ID;
 
@@ -576,17 +669,13 @@ static void dly_rx_result_notify(bool result)
         ret = nrf_802154_sl_timer_add(&p_dly_op_data->rx.timeout_timer);
         assert(ret == NRF_802154_SL_TIMER_RET_SUCCESS);
         (void)ret;
+
+        // Windows aborted above released their slots.
+        timeline_process();
     }
     else
     {
-        bool notified = nrf_802154_notify_receive_failed(
-            NRF_802154_RX_ERROR_DELAYED_TIMESLOT_DENIED,
-            p_dly_op_data->id,
-            false);
-
-        // It should always be possible to notify DRX result
-        assert(notified);
-        (void)notified;
+        dly_rx_failed_notify(NRF_802154_RX_ERROR_DELAYED_TIMESLOT_DENIED, p_dly_op_data->id);
     }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
@@ -681,6 +770,8 @@ static void tx_timeslot_started_callback(rsch_dly_ts_id_t dly_ts_id)
     assert(result);
     (void)result;
 
+    timeline_process();
+
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
 
@@ -723,11 +814,251 @@ static void rx_timeslot_started_callback(rsch_dly_ts_id_t dly_ts_id)
                                   DELAYED_TRX_OP_STATE_ONGOING,
                                   DELAYED_TRX_OP_STATE_STOPPED);
         assert(result);
+
+        timeline_process();
     }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
 
+#if NRF_802154_DELAYED_TRX_TIMELINE_ENABLED
+
+/**
+ * @brief Orders timeline entries by the time of their operations.
+ */
+static int_fast8_t timeline_entry_compare(const void * p_a, const void * p_b)
+{
+    uint64_t time_a = ((const timeline_entry_t *)p_a)->op.time;
+    uint64_t time_b = ((const timeline_entry_t *)p_b)->op.time;
+
+    if (time_a < time_b)
+    {
+        return -1;
+    }
+
+    return (time_a > time_b) ? 1 : 0;
+}
+
+/**
+ * @brief Checks if a delayed operation slot is available for an operation of the given type.
+ *
+ * @param[in]  type  Type of the timeline operation.
+ *
+ * @retval  true   A slot is available.
+ * @retval  false  All slots are in use.
+ */
+static bool timeline_op_slot_available(nrf_802154_timeline_op_type_t type)
+{
+    dly_op_data_t * p_pool   = m_dly_rx_data;
+    uint32_t        pool_len = sizeof(m_dly_rx_data) / sizeof(m_dly_rx_data[0]);
+
+    if (type == NRF_802154_TIMELINE_OP_TX)
+    {
+        p_pool   = m_dly_tx_data;
+        pool_len = sizeof(m_dly_tx_data) / sizeof(m_dly_tx_data[0]);
+    }
+
+    for (uint32_t i = 0; i < pool_len; i++)
+    {
+        if (p_pool[i].state == DELAYED_TRX_OP_STATE_STOPPED)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Requests the delayed operation held by a timeline entry.
+ *
+ * @param[in]  p_op  Operation to request.
+ *
+ * @retval  true   The operation was scheduled.
+ * @retval  false  The operation could not be scheduled.
+ */
+static bool timeline_op_request(const nrf_802154_timeline_op_t * p_op)
+{
+    if (p_op->type == NRF_802154_TIMELINE_OP_TX)
+    {
+        return nrf_802154_delayed_trx_transmit(p_op->data.tx.p_data,
+                                               p_op->time,
+                                               &p_op->data.tx.metadata);
+    }
+
+    return nrf_802154_delayed_trx_receive(p_op->time,
+                                          p_op->data.rx.timeout,
+                                          p_op->data.rx.channel,
+                                          p_op->data.rx.id);
+}
+
+/**
+ * @brief Notifies the higher layer that a timeline operation could not be scheduled.
+ *
+ * @param[in]  p_op  Operation that failed.
+ */
+static void timeline_op_failed_notify(const nrf_802154_timeline_op_t * p_op)
+{
+    if (p_op->type == NRF_802154_TIMELINE_OP_TX)
+    {
+        nrf_802154_transmit_done_metadata_t metadata = {};
+
+        metadata.frame_props = p_op->data.tx.metadata.frame_props;
+        nrf_802154_notify_transmit_failed(p_op->data.tx.p_data,
+                                          NRF_802154_TX_ERROR_TIMESLOT_DENIED,
+                                          &metadata);
+    }
+    else
+    {
+        dly_rx_failed_notify(NRF_802154_RX_ERROR_DELAYED_TIMESLOT_DENIED, p_op->data.rx.id);
+    }
+}
+
+/**
+ * @brief Requests the earliest operations of the timeline for which delayed operation slots
+ *        are available.
+ *
+ * This function is called whenever an operation is added to the timeline or a delayed operation
+ * slot is released.
+ */
+static void timeline_process(void)
+{
+    bool processed;
+
+    do
+    {
+        nrf_802154_mcu_critical_state_t mcu_cs;
+        nrf_802154_timeline_op_t        op;
+        bool                            failed = false;
+
+        processed = false;
+
+        nrf_802154_mcu_critical_enter(mcu_cs);
+
+        timeline_entry_t * p_entry =
+            (timeline_entry_t *)nrf_802154_skiplist_head_peek(&m_timeline);
+
+        if ((p_entry != NULL) && timeline_op_slot_available(p_entry->op.type))
+        {
+            bool removed = nrf_802154_skiplist_remove(&m_timeline,
+                                                      p_entry,
+                                                      offsetof(timeline_entry_t, membership),
+                                                      timeline_entry_compare);
+
+            assert(removed);
+            (void)removed;
+
+            op              = p_entry->op;
+            p_entry->in_use = false;
+            processed       = true;
+
+            failed = !timeline_op_request(&op);
+        }
+
+        nrf_802154_mcu_critical_exit(mcu_cs);
+
+        if (failed)
+        {
+            timeline_op_failed_notify(&op);
+        }
+    }
+    while (processed);
+}
+
+static void timeline_init(void)
+{
+    nrf_802154_skiplist_init(&m_timeline);
+
+    for (uint32_t i = 0; i < NRF_802154_DELAYED_TRX_TIMELINE_SIZE; i++)
+    {
+        m_timeline_entries[i].in_use = false;
+    }
+}
+
+bool nrf_802154_delayed_trx_timeline_schedule(const nrf_802154_timeline_op_t * p_ops,
+                                              uint32_t                         ops_count)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    uint32_t                        free_count = 0U;
+    bool                            result     = false;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    for (uint32_t i = 0; i < NRF_802154_DELAYED_TRX_TIMELINE_SIZE; i++)
+    {
+        if (!m_timeline_entries[i].in_use)
+        {
+            free_count++;
+        }
+    }
+
+    if (ops_count <= free_count)
+    {
+        uint32_t op_idx = 0U;
+
+        for (uint32_t i = 0; (i < NRF_802154_DELAYED_TRX_TIMELINE_SIZE) && (op_idx < ops_count);
+             i++)
+        {
+            timeline_entry_t * p_entry = &m_timeline_entries[i];
+
+            if (!p_entry->in_use)
+            {
+                p_entry->op     = p_ops[op_idx++];
+                p_entry->in_use = true;
+
+                nrf_802154_skiplist_insert_ordered(&m_timeline,
+                                                   p_entry,
+                                                   offsetof(timeline_entry_t, membership),
+                                                   timeline_entry_compare);
+            }
+        }
+
+        result = true;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    if (result)
+    {
+        timeline_process();
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+
+    return result;
+}
+
+bool nrf_802154_delayed_trx_timeline_clear(void)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    bool                            result = false;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    for (uint32_t i = 0; i < NRF_802154_DELAYED_TRX_TIMELINE_SIZE; i++)
+    {
+        timeline_entry_t * p_entry = &m_timeline_entries[i];
+
+        if (p_entry->in_use)
+        {
+            (void)nrf_802154_skiplist_remove(&m_timeline,
+                                             p_entry,
+                                             offsetof(timeline_entry_t, membership),
+                                             timeline_entry_compare);
+            p_entry->in_use = false;
+            result          = true;
+        }
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+#endif // NRF_802154_DELAYED_TRX_TIMELINE_ENABLED
+
 #ifdef TEST
 #include "string.h"
 void nrf_802154_delayed_trx_module_reset(void)
@@ -736,6 +1067,10 @@ void nrf_802154_delayed_trx_module_reset(void)
     memset(m_dly_tx_data, 0, sizeof(m_dly_tx_data));
     memset(&m_dly_rx_id_q, 0, sizeof(m_dly_rx_id_q));
     memset(m_dly_rx_id_q_mem, 0, sizeof(m_dly_rx_id_q_mem));
+#if NRF_802154_DELAYED_TRX_TIMELINE_ENABLED
+    memset(m_timeline_entries, 0, sizeof(m_timeline_entries));
+    memset(&m_timeline, 0, sizeof(m_timeline));
+#endif
 }
 
 #endif // TEST
@@ -759,6 +1094,10 @@ void nrf_802154_delayed_trx_init(void)
         m_dly_tx_data[i].state = DELAYED_TRX_OP_STATE_STOPPED;
         m_dly_tx_data[i].id    = NRF_802154_RESERVED_INVALID_ID;
     }
+
+#if NRF_802154_DELAYED_TRX_TIMELINE_ENABLED
+    timeline_init();
+#endif
 }
 
 void nrf_802154_delayed_trx_deinit(void)
@@ -797,7 +1136,7 @@ bool nrf_802154_delayed_trx_transmit(uint8_t                                 * p
         p_dly_tx_data->tx.params.immediate          = true;
         p_dly_tx_data->tx.params.extra_cca_attempts = p_metadata->extra_cca_attempts;
         p_dly_tx_data->tx.channel                   = p_metadata->channel;
-        p_dly_tx_data->id                           = NRF_802154_RESERVED_DTX_ID;
+        p_dly_tx_data->id                           = dly_tx_id_get(p_dly_tx_data);
 
         rsch_dly_ts_param_t dly_ts_param =
         {
@@ -808,7 +1147,7 @@ bool nrf_802154_delayed_trx_transmit(uint8_t                                 * p
             .op               = RSCH_DLY_TS_OP_DTX,
             .type             = RSCH_DLY_TS_TYPE_PRECISE,
             .started_callback = tx_timeslot_started_callback,
-            .id               = NRF_802154_RESERVED_DTX_ID,
+            .id               = p_dly_tx_data->id,
         };
 
         result = dly_op_request(&dly_ts_param, p_dly_tx_data);
@@ -859,19 +1198,30 @@ bool nrf_802154_delayed_trx_receive(uint64_t rx_time,
 
 bool nrf_802154_delayed_trx_transmit_cancel(void)
 {
-    // This function does not provide any ID because it assumes that only a single delayed
-    // transmission can be scheduled at a time. Therefore use the first (and only) entry
-    // of m_dly_tx_data
-    dly_op_data_t * p_dly_op_data = &m_dly_tx_data[0];
-    bool            result        = false;
+    // This function does not provide any ID, so it cancels all pending delayed transmissions.
+    bool result = false;
 
-    if (dly_ts_slot_release(p_dly_op_data, false))
+    for (uint32_t i = 0; i < sizeof(m_dly_tx_data) / sizeof(m_dly_tx_data[0]); i++)
     {
-        result = dly_op_state_set(p_dly_op_data,
-                                  DELAYED_TRX_OP_STATE_PENDING,
-                                  DELAYED_TRX_OP_STATE_STOPPED);
+        dly_op_data_t * p_dly_op_data = &m_dly_tx_data[i];
 
-        assert(result);
+        if ((p_dly_op_data->id != NRF_802154_RESERVED_INVALID_ID) &&
+            dly_ts_slot_release(p_dly_op_data, false))
+        {
+            bool state_set = dly_op_state_set(p_dly_op_data,
+                                              DELAYED_TRX_OP_STATE_PENDING,
+                                              DELAYED_TRX_OP_STATE_STOPPED);
+
+            assert(state_set);
+            (void)state_set;
+
+            result = true;
+        }
+    }
+
+    if (result)
+    {
+        timeline_process();
     }
 
     return result;
@@ -902,6 +1252,8 @@ bool nrf_802154_delayed_trx_receive_cancel(uint32_t id)
 
         nrf_802154_sl_atomic_store_u8((uint8_t *)&p_dly_op_data->state,
                                       DELAYED_TRX_OP_STATE_STOPPED);
+
+        timeline_process();
     }
 
     return stopped;
@@ -924,6 +1276,7 @@ bool nrf_802154_delayed_trx_abort(nrf_802154_term_t term_lvl, req_originator_t r
     }
 
     dly_rx_all_ongoing_abort();
+    timeline_process();
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
     return true;
@@ -141,6 +141,38 @@ bool nrf_802154_delayed_trx_receive(uint64_t rx_time,
  */
 bool nrf_802154_delayed_trx_receive_cancel(uint32_t id);
 
+#if NRF_802154_DELAYED_TRX_TIMELINE_ENABLED
+
+/**
+ * @brief Adds a series of delayed operations to the timeline.
+ *
+ * The timeline keeps the operations ordered by time. The earliest operation is requested with
+ * @ref nrf_802154_delayed_trx_transmit or @ref nrf_802154_delayed_trx_receive as soon as a slot
+ * for its type of operation is available. If such a request fails, the failure of the operation
+ * is notified and the next operation is processed.
+ *
+ * @param[in]  p_ops      Pointer to an array of operations to add. The operations are copied.
+ * @param[in]  ops_count  Number of operations in @p p_ops.
+ *
+ * @retval  true   All operations were added to the timeline.
+ * @retval  false  There is not enough space in the timeline. No operation was added.
+ */
+bool nrf_802154_delayed_trx_timeline_schedule(const nrf_802154_timeline_op_t * p_ops,
+                                              uint32_t                         ops_count);
+
+/**
+ * @brief Removes all operations from the timeline.
+ *
+ * Operations already requested with @ref nrf_802154_delayed_trx_transmit or
+ * @ref nrf_802154_delayed_trx_receive are not affected.
+ *
+ * @retval  true   At least one operation was removed.
+ * @retval  false  The timeline was empty.
+ */
+bool nrf_802154_delayed_trx_timeline_clear(void);
+
+#endif // NRF_802154_DELAYED_TRX_TIMELINE_ENABLED
+
 /**
  * @brief Aborts an ongoing delayed reception procedure.
  *
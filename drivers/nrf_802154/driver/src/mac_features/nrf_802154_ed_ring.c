@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the energy detection sample ring of the 802.15.4 driver.
+ *
+ */
+
+#include "nrf_802154_ed_ring.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_nrfx_addons.h"
+#include "nrf_802154_types.h"
+#include "nrf_802154_utils.h"
+
+#if NRF_802154_ED_RING_ENABLED
+
+#define RING_MASK (NRF_802154_ED_RING_SIZE - 1U) ///< Mask of indices of the ring.
+
+#if (NRF_802154_ED_RING_SIZE & RING_MASK) != 0U
+#error NRF_802154_ED_RING_SIZE must be a power of two
+#endif
+
+static nrf_802154_ed_sample_t m_ring[NRF_802154_ED_RING_SIZE]; ///< Storage of the samples.
+static volatile uint32_t      m_head;                          ///< Free-running write index.
+static volatile uint32_t      m_tail;                          ///< Free-running read index.
+static volatile uint32_t      m_lost;                          ///< Number of lost samples.
+static volatile bool          m_enabled;                       ///< If the storing is enabled.
+
+void nrf_802154_ed_ring_init(void)
+{
+    m_head    = 0U;
+    m_tail    = 0U;
+    m_lost    = 0U;
+    m_enabled = false;
+}
+
+void nrf_802154_ed_ring_set(bool enabled)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    if (enabled && !m_enabled)
+    {
+        m_head = 0U;
+        m_tail = 0U;
+        m_lost = 0U;
+    }
+
+    m_enabled = enabled;
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+bool nrf_802154_ed_ring_is_enabled(void)
+{
+    return m_enabled;
+}
+
+void nrf_802154_ed_ring_sample_store(int8_t ed_dbm, uint8_t channel, uint64_t timestamp)
+{
+    uint32_t head = m_head;
+
+    if ((head - m_tail) >= NRF_802154_ED_RING_SIZE)
+    {
+        m_lost++;
+        return;
+    }
+
+    nrf_802154_ed_sample_t * p_sample = &m_ring[head & RING_MASK];
+
+    p_sample->timestamp = timestamp;
+    p_sample->ed_dbm    = ed_dbm;
+    p_sample->channel   = channel;
+
+    // Make sure the sample is complete before the reader may see it.
+    __DMB();
+
+    m_head = head + 1U;
+}
+
+uint32_t nrf_802154_ed_ring_read(nrf_802154_ed_sample_t * p_samples, uint32_t count)
+{
+    uint32_t tail    = m_tail;
+    uint32_t head    = m_head;
+    uint32_t written = 0U;
+
+    // Make sure samples are not read before the write index that publishes them.
+    __DMB();
+
+    while ((tail != head) && (written < count))
+    {
+        p_samples[written++] = m_ring[tail & RING_MASK];
+        tail++;
+    }
+
+    // Make sure the samples are copied before the writer may overwrite them.
+    __DMB();
+
+    m_tail = tail;
+
+    return written;
+}
+
+uint32_t nrf_802154_ed_ring_lost_count_get(void)
+{
+    return m_lost;
+}
+
+#endif // NRF_802154_ED_RING_ENABLED
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @defgroup nrf_802154_ed_ring Energy detection sample ring
+ * @{
+ * @ingroup nrf_802154
+ * @brief Ring of timestamped energy detection samples of the 802.15.4 driver.
+ */
+
+#ifndef NRF_802154_ED_RING_H_
+#define NRF_802154_ED_RING_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_types.h"
+
+/**
+ * @brief Initializes the energy detection sample ring.
+ */
+void nrf_802154_ed_ring_init(void);
+
+/**
+ * @brief Enables or disables storing of the energy detection samples.
+ *
+ * Enabling the storing discards the samples remaining in the ring and clears the counter
+ * of lost samples.
+ *
+ * @param[in]  enabled  If the storing is to be enabled.
+ */
+void nrf_802154_ed_ring_set(bool enabled);
+
+/**
+ * @brief Checks if storing of the energy detection samples is enabled.
+ *
+ * @retval true   The storing is enabled.
+ * @retval false  The storing is disabled.
+ */
+bool nrf_802154_ed_ring_is_enabled(void);
+
+/**
+ * @brief Appends an energy detection sample to the ring.
+ *
+ * This function is intended to be called by the core module only, and it is the only writer
+ * of the ring. If there is no room for the sample, the sample is counted as lost.
+ *
+ * @param[in]  ed_dbm     Detected energy in dBm.
+ * @param[in]  channel    Channel on which the sample was taken.
+ * @param[in]  timestamp  Timestamp of the end of the sample.
+ */
+void nrf_802154_ed_ring_sample_store(int8_t ed_dbm, uint8_t channel, uint64_t timestamp);
+
+/**
+ * @brief Moves samples from the ring to the given buffer.
+ *
+ * @param[out]  p_samples  Pointer to the buffer to be filled with the samples.
+ * @param[in]   count      Capacity of the buffer in samples.
+ *
+ * @returns  Number of samples written to @p p_samples.
+ */
+uint32_t nrf_802154_ed_ring_read(nrf_802154_ed_sample_t * p_samples, uint32_t count);
+
+/**
+ * @brief Gets the number of samples that were lost because the ring was full.
+ *
+ * @returns  Number of lost samples.
+ */
+uint32_t nrf_802154_ed_ring_lost_count_get(void);
+
+/**
+ *@}
+ **/
+
+#endif // NRF_802154_ED_RING_H_
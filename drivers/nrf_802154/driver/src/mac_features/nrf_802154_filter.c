@@ -296,26 +296,30 @@ static nrf_802154_rx_error_t dst_addressing_fcf_check(
     return result;
 }
 
+static uint8_t m_matched_identity; ///< Identity matched by the last frame destination address.
+
 /**
  * Verify if destination PAN Id of incoming frame allows processing by this node.
  *
  * @param[in] p_panid     Pointer of PAN ID of incoming frame.
  * @param[in] frame_type  Type of the frame being filtered.
+ * @param[in] identity    Identity of this node to verify the PAN Id against.
  *
  * @retval true   PAN Id of incoming frame allows further processing of the frame.
  * @retval false  PAN Id of incoming frame does not allow further processing.
  */
-static bool dst_pan_id_check(const uint8_t * p_panid, uint8_t frame_type)
+static bool dst_pan_id_check(const uint8_t * p_panid, uint8_t frame_type, uint8_t identity)
 {
-    bool result;
+    bool            result;
+    const uint8_t * p_own_panid = nrf_802154_pib_identity_pan_id_get(identity);
 
-    if ((0 == memcmp(p_panid, nrf_802154_pib_pan_id_get(), PAN_ID_SIZE)) ||
+    if ((0 == memcmp(p_panid, p_own_panid, PAN_ID_SIZE)) ||
         (0 == memcmp(p_panid, BROADCAST_ADDRESS, PAN_ID_SIZE)))
     {
         result = true;
     }
     else if ((FRAME_TYPE_BEACON == frame_type) &&
-             (0 == memcmp(nrf_802154_pib_pan_id_get(), BROADCAST_ADDRESS, PAN_ID_SIZE)))
+             (0 == memcmp(p_own_panid, BROADCAST_ADDRESS, PAN_ID_SIZE)))
     {
         result = true;
     }
@@ -331,15 +335,18 @@ static bool dst_pan_id_check(const uint8_t * p_panid, uint8_t frame_type)
  * Verify if destination short address of incoming frame allows processing by this node.
  *
  * @param[in] p_dst_addr  Pointer of destination address of incoming frame.
+ * @param[in] identity    Identity of this node to verify the address against.
  *
  * @retval true   Destination address of incoming frame allows further processing of the frame.
  * @retval false  Destination address of incoming frame does not allow further processing.
  */
-static bool dst_short_addr_check(const uint8_t * p_dst_addr)
+static bool dst_short_addr_check(const uint8_t * p_dst_addr, uint8_t identity)
 {
     bool result;
 
-    if ((0 == memcmp(p_dst_addr, nrf_802154_pib_short_address_get(), SHORT_ADDRESS_SIZE)) ||
+    if ((0 == memcmp(p_dst_addr,
+                     nrf_802154_pib_identity_short_address_get(identity),
+                     SHORT_ADDRESS_SIZE)) ||
         (0 == memcmp(p_dst_addr, BROADCAST_ADDRESS, SHORT_ADDRESS_SIZE)))
     {
         result = true;
@@ -356,15 +363,18 @@ static bool dst_short_addr_check(const uint8_t * p_dst_addr)
  * Verify if destination extended address of incoming frame allows processing by this node.
  *
  * @param[in] p_dst_addr  Pointer of destination address of incoming frame.
+ * @param[in] identity    Identity of this node to verify the address against.
  *
  * @retval true   Destination address of incoming frame allows further processing of the frame.
  * @retval false  Destination address of incoming frame does not allow further processing.
  */
-static bool dst_extended_addr_check(const uint8_t * p_dst_addr)
+static bool dst_extended_addr_check(const uint8_t * p_dst_addr, uint8_t identity)
 {
     bool result;
 
-    if (0 == memcmp(p_dst_addr, nrf_802154_pib_extended_address_get(), EXTENDED_ADDRESS_SIZE))
+    if (0 == memcmp(p_dst_addr,
+                    nrf_802154_pib_identity_extended_address_get(identity),
+                    EXTENDED_ADDRESS_SIZE))
     {
         result = true;
     }
@@ -376,10 +386,45 @@ static bool dst_extended_addr_check(const uint8_t * p_dst_addr)
     return result;
 }
 
+/**
+ * @brief Verify if the destination PAN ID of incoming frame allows processing by this node.
+ *
+ * @param[in] p_frame_data  Pointer to a frame parser data.
+ *
+ * @retval NRF_802154_RX_ERROR_NONE               The frame has no destination PAN ID or the PAN ID
+ *                                                is accepted by any identity of this node.
+ * @retval NRF_802154_RX_ERROR_INVALID_DEST_ADDR  The destination PAN ID is rejected by this node.
+ */
+static nrf_802154_rx_error_t dst_panid_check(const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+    const uint8_t * p_dst_panid = nrf_802154_frame_parser_dst_panid_get(p_frame_data);
+    uint8_t         frame_type  = nrf_802154_frame_parser_frame_type_get(p_frame_data);
+
+    if (p_dst_panid == NULL)
+    {
+        return NRF_802154_RX_ERROR_NONE;
+    }
+
+    for (uint8_t identity = 0U; identity < NRF_802154_PIB_IDENTITIES_NUM; identity++)
+    {
+        if (nrf_802154_pib_identity_is_used(identity) &&
+            dst_pan_id_check(p_dst_panid, frame_type, identity))
+        {
+            return NRF_802154_RX_ERROR_NONE;
+        }
+    }
+
+    return NRF_802154_RX_ERROR_INVALID_DEST_ADDR;
+}
+
 /**
  * Verify if destination addressing of incoming frame allows processing by this node.
  * This function checks addressing according to IEEE 802.15.4-2015.
  *
+ * The frame is accepted if its destination PAN ID and destination address both match the same
+ * identity of this node. The matched identity is stored for
+ * @ref nrf_802154_filter_matched_identity_get.
+ *
  * @param[in]  p_frame_data Pointer to the frame parser data.
  *
  * @retval NRF_802154_RX_ERROR_NONE               Destination address of incoming frame allows further processing of the frame.
@@ -392,40 +437,54 @@ static nrf_802154_rx_error_t dst_addr_check(const nrf_802154_frame_parser_data_t
     const uint8_t * p_dst_addr  = nrf_802154_frame_parser_dst_addr_get(p_frame_data);
     uint8_t         frame_type  = nrf_802154_frame_parser_frame_type_get(p_frame_data);
 
-    if (p_dst_panid != NULL)
+    uint8_t dst_addr_size =
+        p_dst_addr ? nrf_802154_frame_parser_dst_addr_size_get(p_frame_data) : 0U;
+
+    m_matched_identity = NRF_802154_PIB_IDENTITY_PRIMARY;
+
+    for (uint8_t identity = 0U; identity < NRF_802154_PIB_IDENTITIES_NUM; identity++)
     {
-        if (!dst_pan_id_check(p_dst_panid, frame_type))
+        bool accepted;
+
+        if (!nrf_802154_pib_identity_is_used(identity))
         {
-            return NRF_802154_RX_ERROR_INVALID_DEST_ADDR;
+            continue;
         }
-    }
 
-    uint8_t dst_addr_size =
-        p_dst_addr ? nrf_802154_frame_parser_dst_addr_size_get(p_frame_data) : 0U;
+        if ((p_dst_panid != NULL) && !dst_pan_id_check(p_dst_panid, frame_type, identity))
+        {
+            continue;
+        }
 
-    switch (dst_addr_size)
-    {
-        case SHORT_ADDRESS_SIZE:
-            return dst_short_addr_check(p_dst_addr) ? NRF_802154_RX_ERROR_NONE :
-                   NRF_802154_RX_ERROR_INVALID_DEST_ADDR;
-
-        case EXTENDED_ADDRESS_SIZE:
-            return dst_extended_addr_check(p_dst_addr) ? NRF_802154_RX_ERROR_NONE :
-                   NRF_802154_RX_ERROR_INVALID_DEST_ADDR;
-
-        case 0:
-            // Allow frames destined to the Pan Coordinator without destination address or
-            // beacon frames without destination address
-            return (nrf_802154_pib_pan_coord_get() ||
-                    (frame_type ==
-                     FRAME_TYPE_BEACON)) ? NRF_802154_RX_ERROR_NONE :
-                   NRF_802154_RX_ERROR_INVALID_DEST_ADDR;
+        switch (dst_addr_size)
+        {
+            case SHORT_ADDRESS_SIZE:
+                accepted = dst_short_addr_check(p_dst_addr, identity);
+                break;
+
+            case EXTENDED_ADDRESS_SIZE:
+                accepted = dst_extended_addr_check(p_dst_addr, identity);
+                break;
+
+            case 0:
+                // Allow frames destined to the Pan Coordinator without destination address or
+                // beacon frames without destination address
+                accepted = nrf_802154_pib_pan_coord_get() || (frame_type == FRAME_TYPE_BEACON);
+                break;
+
+            default:
+                assert(false);
+                return NRF_802154_RX_ERROR_INVALID_FRAME;
+        }
 
-        default:
-            assert(false);
+        if (accepted)
+        {
+            m_matched_identity = identity;
+            return NRF_802154_RX_ERROR_NONE;
+        }
     }
 
-    return NRF_802154_RX_ERROR_INVALID_FRAME;
+    return NRF_802154_RX_ERROR_INVALID_DEST_ADDR;
 }
 
 nrf_802154_rx_error_t nrf_802154_filter_frame_part(
@@ -467,6 +526,18 @@ nrf_802154_rx_error_t nrf_802154_filter_frame_part(
         return result;
     }
 
+    if (filter_mode & NRF_802154_FILTER_MODE_DST_PANID)
+    {
+        assert(nrf_802154_frame_parser_parse_level_get(p_frame_data) >= PARSE_LEVEL_FCF_OFFSETS);
+
+        result = dst_panid_check(p_frame_data);
+    }
+
+    if (result != NRF_802154_RX_ERROR_NONE)
+    {
+        return result;
+    }
+
     if (filter_mode & NRF_802154_FILTER_MODE_DST_ADDR)
     {
         assert(nrf_802154_frame_parser_parse_level_get(
@@ -477,3 +548,8 @@ nrf_802154_rx_error_t nrf_802154_filter_frame_part(
 
     return result;
 }
+
+uint8_t nrf_802154_filter_matched_identity_get(void)
+{
+    return m_matched_identity;
+}
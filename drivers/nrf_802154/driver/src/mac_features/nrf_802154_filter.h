@@ -58,18 +58,22 @@
  * Possible values:
  * @ref NRF_802154_FILTER_MODE_FCF
  * @ref NRF_802154_FILTER_MODE_DST_ADDR
+ * @ref NRF_802154_FILTER_MODE_DST_PANID
  */
 typedef uint32_t nrf_802154_filter_mode_t;
 
 /**@brief Filter the frame based on the content of the FCF field. */
-#define NRF_802154_FILTER_MODE_FCF      (1UL << 0)
+#define NRF_802154_FILTER_MODE_FCF       (1UL << 0)
 
 /**@brief Filter the frame based on the content of the destination addressing fields. */
-#define NRF_802154_FILTER_MODE_DST_ADDR (1UL << 1)
+#define NRF_802154_FILTER_MODE_DST_ADDR  (1UL << 1)
+
+/**@brief Filter the frame based on the content of the destination PAN ID field only. */
+#define NRF_802154_FILTER_MODE_DST_PANID (1UL << 2)
 
 /**@brief Perform all filtering tests. */
-#define NRF_802154_FILTER_MODE_ALL      (NRF_802154_FILTER_MODE_FCF | \
-                                         NRF_802154_FILTER_MODE_DST_ADDR)
+#define NRF_802154_FILTER_MODE_ALL       (NRF_802154_FILTER_MODE_FCF | \
+                                          NRF_802154_FILTER_MODE_DST_ADDR)
 
 /**
  * @brief Verifies if the given part of the frame is valid.
@@ -82,6 +86,11 @@ typedef uint32_t nrf_802154_filter_mode_t;
  * In the @c NRF_802154_FILTER_MODE_DST_ADDR filter mode the function will only check if the
  * destination address matches the address of the current node. If the incoming frame has no address
  * and the node is a coordinator the frame will be accepted. No validation of FCF is performend.
+ * In the @c NRF_802154_FILTER_MODE_DST_PANID filter mode the function will only check if the
+ * destination PAN ID matches the PAN ID of the current node. It allows a frame destined to
+ * a foreign PAN to be rejected before its destination address is received. Frames without
+ * the destination PAN ID are accepted. The @c NRF_802154_FILTER_MODE_DST_ADDR filter mode
+ * checks the destination PAN ID as well.
  *
  * To perform a full filtering procedure it is necessary to call this function on the incoming frame
  * with both @c NRF_802154_FILTER_MODE_FCF and @c NRF_802154_FILTER_MODE_DST_ADDR scopes in
@@ -100,6 +109,17 @@ nrf_802154_rx_error_t nrf_802154_filter_frame_part(
     const nrf_802154_frame_parser_data_t * p_frame_data,
     nrf_802154_filter_mode_t               filter_mode);
 
+/**
+ * @brief Gets the identity of this node matched by the last filtered destination address.
+ *
+ * The identity is updated each time the destination address of a frame is filtered with
+ * @c NRF_802154_FILTER_MODE_DST_ADDR mode. It equals @ref NRF_802154_PIB_IDENTITY_PRIMARY if
+ * the frame was rejected or secondary identities are not used.
+ *
+ * @return Index of the identity that accepted the last filtered frame.
+ */
+uint8_t nrf_802154_filter_matched_identity_get(void);
+
 /**
  *@}
  **/
@@ -51,18 +51,41 @@
  * @section Helper functions
  **************************************************************************************************/
 
-// Addressing
+// Frame Control Field
 
-static bool src_addr_is_present(const nrf_802154_frame_parser_data_t * p_parser_data)
+/**
+ * @brief Fields of the Frame Control Field that determine the layout of the addressing fields.
+ *
+ * The fields are decoded once per frame in @ref fcf_parse and shared by all the helpers
+ * that compute the addressing offsets.
+ */
+typedef struct
 {
-    return nrf_802154_frame_parser_src_addr_type_get(p_parser_data) != SRC_ADDR_TYPE_NONE;
+    uint8_t frame_version;     ///< Masked Frame Version field.
+    uint8_t dst_addr_type;     ///< Masked Destination Addressing Mode field.
+    uint8_t src_addr_type;     ///< Masked Source Addressing Mode field.
+    bool    panid_compression; ///< If the PAN ID Compression bit is set.
+} fcf_fields_t;
+
+static void fcf_fields_decode(const nrf_802154_frame_parser_data_t * p_parser_data,
+                              fcf_fields_t                         * p_fields)
+{
+    p_fields->frame_version     = nrf_802154_frame_parser_frame_version_get(p_parser_data);
+    p_fields->dst_addr_type     = nrf_802154_frame_parser_dst_addr_type_get(p_parser_data);
+    p_fields->src_addr_type     = nrf_802154_frame_parser_src_addr_type_get(p_parser_data);
+    p_fields->panid_compression = nrf_802154_frame_parser_panid_compression_is_set(p_parser_data);
 }
 
-static uint8_t src_addr_size_get(const nrf_802154_frame_parser_data_t * p_parser_data)
+// Addressing
+
+static bool src_addr_is_present(const fcf_fields_t * p_fields)
 {
-    uint8_t addr_type = nrf_802154_frame_parser_src_addr_type_get(p_parser_data);
+    return p_fields->src_addr_type != SRC_ADDR_TYPE_NONE;
+}
 
-    switch (addr_type)
+static uint8_t src_addr_size_get(const fcf_fields_t * p_fields)
+{
+    switch (p_fields->src_addr_type)
     {
         case SRC_ADDR_TYPE_EXTENDED:
             return EXTENDED_ADDRESS_SIZE;
@@ -78,16 +101,14 @@ static uint8_t src_addr_size_get(const nrf_802154_frame_parser_data_t * p_parser
     }
 }
 
-static bool dst_addr_is_present(const nrf_802154_frame_parser_data_t * p_parser_data)
+static bool dst_addr_is_present(const fcf_fields_t * p_fields)
 {
-    return nrf_802154_frame_parser_dst_addr_type_get(p_parser_data) != DEST_ADDR_TYPE_NONE;
+    return p_fields->dst_addr_type != DEST_ADDR_TYPE_NONE;
 }
 
-static uint8_t dst_addr_size_get(const nrf_802154_frame_parser_data_t * p_parser_data)
+static uint8_t dst_addr_size_get(const fcf_fields_t * p_fields)
 {
-    uint8_t addr_type = nrf_802154_frame_parser_dst_addr_type_get(p_parser_data);
-
-    switch (addr_type)
+    switch (p_fields->dst_addr_type)
     {
         case DEST_ADDR_TYPE_EXTENDED:
             return EXTENDED_ADDRESS_SIZE;
@@ -103,16 +124,22 @@ static uint8_t dst_addr_size_get(const nrf_802154_frame_parser_data_t * p_parser
     }
 }
 
+static bool addrs_are_extended(const fcf_fields_t * p_fields)
+{
+    return (p_fields->dst_addr_type == DEST_ADDR_TYPE_EXTENDED) &&
+           (p_fields->src_addr_type == SRC_ADDR_TYPE_EXTENDED);
+}
+
 // PAN ID
-static bool dst_panid_is_present(const nrf_802154_frame_parser_data_t * p_parser_data)
+static bool dst_panid_is_present(const fcf_fields_t * p_fields)
 {
-    bool panid_compression = nrf_802154_frame_parser_panid_compression_is_set(p_parser_data);
+    bool panid_compression = p_fields->panid_compression;
 
-    switch (nrf_802154_frame_parser_frame_version_get(p_parser_data))
+    switch (p_fields->frame_version)
     {
         case FRAME_VERSION_0:
         case FRAME_VERSION_1:
-            if (!dst_addr_is_present(p_parser_data))
+            if (!dst_addr_is_present(p_fields))
             {
                 return false;
             }
@@ -121,23 +148,22 @@ static bool dst_panid_is_present(const nrf_802154_frame_parser_data_t * p_parser
 
         case FRAME_VERSION_2:
         default:
-            if (nrf_802154_frame_parser_dst_addr_is_extended(p_parser_data) &&
-                nrf_802154_frame_parser_src_addr_is_extended(p_parser_data))
+            if (addrs_are_extended(p_fields))
             {
                 return panid_compression ? false : true;
             }
 
-            if (src_addr_is_present(p_parser_data) && dst_addr_is_present(p_parser_data))
+            if (src_addr_is_present(p_fields) && dst_addr_is_present(p_fields))
             {
                 return true;
             }
 
-            if (src_addr_is_present(p_parser_data))
+            if (src_addr_is_present(p_fields))
             {
                 return false;
             }
 
-            if (dst_addr_is_present(p_parser_data))
+            if (dst_addr_is_present(p_fields))
             {
                 return panid_compression ? false : true;
             }
@@ -146,15 +172,15 @@ static bool dst_panid_is_present(const nrf_802154_frame_parser_data_t * p_parser
     }
 }
 
-static bool src_panid_is_present(const nrf_802154_frame_parser_data_t * p_parser_data)
+static bool src_panid_is_present(const fcf_fields_t * p_fields)
 {
-    bool panid_compression = nrf_802154_frame_parser_panid_compression_is_set(p_parser_data);
+    bool panid_compression = p_fields->panid_compression;
 
-    switch (nrf_802154_frame_parser_frame_version_get(p_parser_data))
+    switch (p_fields->frame_version)
     {
         case FRAME_VERSION_0:
         case FRAME_VERSION_1:
-            if (!src_addr_is_present(p_parser_data))
+            if (!src_addr_is_present(p_fields))
             {
                 return false;
             }
@@ -163,18 +189,17 @@ static bool src_panid_is_present(const nrf_802154_frame_parser_data_t * p_parser
 
         case FRAME_VERSION_2:
         default:
-            if (nrf_802154_frame_parser_dst_addr_is_extended(p_parser_data) &&
-                nrf_802154_frame_parser_src_addr_is_extended(p_parser_data))
+            if (addrs_are_extended(p_fields))
             {
                 return false;
             }
 
-            if (src_addr_is_present(p_parser_data) && dst_addr_is_present(p_parser_data))
+            if (src_addr_is_present(p_fields) && dst_addr_is_present(p_fields))
             {
                 return panid_compression ? false : true;
             }
 
-            if (src_addr_is_present(p_parser_data))
+            if (src_addr_is_present(p_fields))
             {
                 return panid_compression ? false : true;
             }
@@ -234,8 +259,9 @@ static uint8_t mic_size_get(const nrf_802154_frame_parser_data_t * p_parser_data
 
 static bool fcf_parse(nrf_802154_frame_parser_data_t * p_parser_data)
 {
-    uint8_t offset = PHR_SIZE + FCF_SIZE;
-    uint8_t addr_size;
+    uint8_t      offset = PHR_SIZE + FCF_SIZE;
+    uint8_t      addr_size;
+    fcf_fields_t fcf;
 
     if (offset > p_parser_data->valid_data_len)
     {
@@ -243,23 +269,25 @@ static bool fcf_parse(nrf_802154_frame_parser_data_t * p_parser_data)
         return false;
     }
 
+    fcf_fields_decode(p_parser_data, &fcf);
+
     if (nrf_802154_frame_parser_dsn_suppress_bit_is_set(p_parser_data) == false)
     {
         offset += DSN_SIZE;
     }
 
-    if (dst_panid_is_present(p_parser_data))
+    if (dst_panid_is_present(&fcf))
     {
         p_parser_data->mhr.dst.panid_offset = offset;
         offset                             += PAN_ID_SIZE;
     }
 
-    if (dst_addr_is_present(p_parser_data))
+    if (dst_addr_is_present(&fcf))
     {
         p_parser_data->mhr.dst.addr_offset = offset;
     }
 
-    addr_size = dst_addr_size_get(p_parser_data);
+    addr_size = dst_addr_size_get(&fcf);
 
     if (addr_size == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
     {
@@ -270,18 +298,18 @@ static bool fcf_parse(nrf_802154_frame_parser_data_t * p_parser_data)
     offset                                         += addr_size;
     p_parser_data->helper.dst_addressing_end_offset = offset;
 
-    if (src_panid_is_present(p_parser_data))
+    if (src_panid_is_present(&fcf))
     {
         p_parser_data->mhr.src.panid_offset = offset;
         offset                             += PAN_ID_SIZE;
     }
 
-    if (src_addr_is_present(p_parser_data))
+    if (src_addr_is_present(&fcf))
     {
         p_parser_data->mhr.src.addr_offset = offset;
     }
 
-    addr_size = src_addr_size_get(p_parser_data);
+    addr_size = src_addr_size_get(&fcf);
 
     if (addr_size == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
     {
@@ -304,6 +332,7 @@ static bool sec_ctrl_parse(nrf_802154_frame_parser_data_t * p_parser_data)
 
     if (nrf_802154_frame_parser_security_enabled_bit_is_set(p_parser_data) == false)
     {
+        p_parser_data->helper.mic_size               = 0U;
         p_parser_data->helper.aux_sec_hdr_end_offset = offset;
         return true;
     }
@@ -365,7 +394,8 @@ static bool full_parse(nrf_802154_frame_parser_data_t * p_parser_data)
         p_parser_data->mhr.header_ie_offset = offset;
 
         p_ie_header = &p_parser_data->p_frame[offset];
-        p_end_addr  = nrf_802154_frame_parser_mfr_get(p_parser_data) - mic_size_get(p_parser_data);
+        p_end_addr  = nrf_802154_frame_parser_mfr_get(p_parser_data) -
+                      p_parser_data->helper.mic_size;
         p_iterator  = nrf_802154_frame_parser_header_ie_iterator_begin(p_ie_header);
 
         while (!nrf_802154_frame_parser_ie_iterator_end(p_iterator, p_end_addr))
@@ -44,6 +44,7 @@
 #include "mac_features/nrf_802154_delayed_trx.h"
 #include "nrf_802154_core.h"
 #include "nrf_802154_nrfx_addons.h"
+#include "nrf_802154_procedures_duration.h"
 #include "nrf_802154_tx_work_buffer.h"
 #include "nrf_802154_utils_byteorder.h"
 #include "nrf_802154_sl_timer.h"
@@ -409,6 +410,129 @@ static void link_metrics_ie_write_reset(void)
     mp_lm_lqi_addr    = NULL;
 }
 
+#if NRF_802154_WAKEUP_TX_ENABLED
+
+#define RENDEZVOUS_US_PER_UNIT (IE_RENDEZVOUS_SYMBOLS_PER_UNIT * PHY_US_PER_SYMBOL)
+
+static uint8_t * mp_rendezvous_time_addr;   ///< Cached Rendezvous Time information element rendezvous time field address
+static uint8_t   m_rendezvous_psdu_length;  ///< Length of the PSDU of the frame in which the rendezvous time is written
+static uint64_t  m_rendezvous_time;         ///< Time at which the frame announced by the Rendezvous Time IE starts
+static bool      m_rendezvous_time_set;     ///< Information if the rendezvous time was set
+
+/**
+ * @brief Writes the rendezvous time to previously set memory address.
+ *
+ * The rendezvous time is the time from the end of the frame being transmitted to the
+ * rendezvous time set with @ref nrf_802154_ie_writer_rendezvous_time_set, in units of 10 symbols.
+ *
+ * @param[inout]  p_written  Flag set to true if Rendezvous Time IE was written. If the IE is not
+ *                           written, the flag is not modified.
+ */
+static void rendezvous_time_ie_write_commit(bool * p_written)
+{
+    if ((mp_rendezvous_time_addr == NULL) || (m_rendezvous_psdu_length == 0U) ||
+        !m_rendezvous_time_set)
+    {
+        // Rendezvous time writer not armed. Nothing to be done.
+        return;
+    }
+
+    // As for the CSL phase, this function is expected to execute 64us before the first bit of MHR.
+    uint64_t frame_end_us  = nrf_802154_sl_timer_current_time_get() + 64 +
+                             nrf_802154_frame_duration_get(m_rendezvous_psdu_length, false, false);
+    uint32_t rendezvous_us = 0U;
+
+#if defined(CONFIG_SOC_SERIES_BSIM_NRFXX)
+    frame_end_us += m_csl_time_to_radio_address_us;
+#endif
+
+    if (m_rendezvous_time > frame_end_us)
+    {
+        uint64_t diff = m_rendezvous_time - frame_end_us;
+
+        rendezvous_us = (diff > (uint64_t)IE_RENDEZVOUS_TIME_MAX * RENDEZVOUS_US_PER_UNIT) ?
+                        (IE_RENDEZVOUS_TIME_MAX * RENDEZVOUS_US_PER_UNIT) : (uint32_t)diff;
+    }
+
+    // Round down so that the receiver never wakes up after the announced frame starts.
+    host_16_to_little(rendezvous_us / RENDEZVOUS_US_PER_UNIT, mp_rendezvous_time_addr);
+
+    *p_written = true;
+}
+
+/**
+ * @brief Finds and prepare memory address where the rendezvous time will be written.
+ *
+ * @param[in]  p_iterator  Information Element parser iterator.
+ *
+ * @retval  true  The write prepare operation to Rendezvous Time IE was successful.
+ * @retval  false An improperly formatted Rendezvous Time IE was detected.
+ */
+static bool rendezvous_time_ie_write_prepare(const uint8_t * p_iterator)
+{
+    assert(p_iterator != NULL);
+
+    if (nrf_802154_frame_parser_ie_length_get(p_iterator) < IE_RENDEZVOUS_TIME_SIZE_MIN)
+    {
+        // The IE is too small to be a valid Rendezvous Time IE.
+        return false;
+    }
+
+    mp_rendezvous_time_addr =
+        (uint8_t *)nrf_802154_frame_parser_ie_content_address_get(p_iterator);
+
+    return true;
+}
+
+/**
+ * @brief Resets rendezvous time writer to pristine state.
+ */
+static void rendezvous_time_ie_write_reset(void)
+{
+    mp_rendezvous_time_addr  = NULL;
+    m_rendezvous_psdu_length = 0U;
+}
+
+/**
+ * @brief Latches the length of the frame whose Rendezvous Time IE is to be written.
+ *
+ * @param[in]  p_frame  Pointer to the buffer that contains the PHR and PSDU of the frame.
+ */
+static void rendezvous_time_ie_frame_set(const uint8_t * p_frame)
+{
+    m_rendezvous_psdu_length = p_frame[PHR_OFFSET];
+}
+
+#else
+
+/**
+ * @brief Writes the rendezvous time to previously set memory address.
+ */
+static void rendezvous_time_ie_write_commit(bool * p_written)
+{
+    // Intentionally empty
+    (void)p_written;
+}
+
+/**
+ * @brief Resets rendezvous time writer to pristine state.
+ */
+static void rendezvous_time_ie_write_reset(void)
+{
+    // Intentionally empty
+}
+
+/**
+ * @brief Latches the length of the frame whose Rendezvous Time IE is to be written.
+ */
+static void rendezvous_time_ie_frame_set(const uint8_t * p_frame)
+{
+    // Intentionally empty
+    (void)p_frame;
+}
+
+#endif // NRF_802154_WAKEUP_TX_ENABLED
+
 /**
  * @brief Performs IE write preparations.
  *
@@ -451,6 +575,12 @@ static void ie_writer_prepare(uint8_t * p_ie_header, const uint8_t * p_end_addr)
                 result = csl_ie_write_prepare(p_iterator);
                 break;
 
+#if NRF_802154_WAKEUP_TX_ENABLED
+            case IE_RENDEZVOUS_TIME_ID:
+                result = rendezvous_time_ie_write_prepare(p_iterator);
+                break;
+#endif
+
             default:
                 break;
         }
@@ -478,6 +608,7 @@ static void ie_writer_commit(bool * p_written)
 
     csl_ie_write_commit(p_written);
     link_metrics_ie_write_commit(p_written);
+    rendezvous_time_ie_write_commit(p_written);
 }
 
 void nrf_802154_ie_writer_reset(void)
@@ -486,6 +617,7 @@ void nrf_802154_ie_writer_reset(void)
 
     csl_ie_write_reset();
     link_metrics_ie_write_reset();
+    rendezvous_time_ie_write_reset();
 }
 
 void nrf_802154_ie_writer_prepare(uint8_t * p_ie_header, const uint8_t * p_end_addr)
@@ -498,6 +630,7 @@ void nrf_802154_ie_writer_prepare(uint8_t * p_ie_header, const uint8_t * p_end_a
 
 bool nrf_802154_ie_writer_tx_setup(
     uint8_t                                 * p_frame,
+    const nrf_802154_frame_parser_data_t    * p_frame_data,
     nrf_802154_transmit_params_t            * p_params,
     nrf_802154_transmit_failed_notification_t notify_function)
 {
@@ -518,24 +651,17 @@ bool nrf_802154_ie_writer_tx_setup(
     const uint8_t * p_mfr_addr;
     uint8_t       * p_ie_header;
 
-    nrf_802154_frame_parser_data_t frame_data;
+    assert(nrf_802154_frame_parser_parse_level_get(p_frame_data) == PARSE_LEVEL_FULL);
 
-    bool result = nrf_802154_frame_parser_data_init(p_frame,
-                                                    p_frame[PHR_OFFSET] + PHR_SIZE,
-                                                    PARSE_LEVEL_FULL,
-                                                    &frame_data);
-
-    assert(result);
-    (void)result;
-
-    p_ie_header = (uint8_t *)nrf_802154_frame_parser_ie_header_get(&frame_data);
-    p_mfr_addr  = nrf_802154_frame_parser_mfr_get(&frame_data);
+    p_ie_header = (uint8_t *)nrf_802154_frame_parser_ie_header_get(p_frame_data);
+    p_mfr_addr  = nrf_802154_frame_parser_mfr_get(p_frame_data);
 
     if (p_ie_header == NULL)
     {
         return true;
     }
 
+    rendezvous_time_ie_frame_set(p_frame);
     nrf_802154_ie_writer_prepare(p_ie_header, p_mfr_addr);
 
     return true;
@@ -614,4 +740,19 @@ void nrf_802154_ie_writer_csl_anchor_time_set(uint64_t anchor_time)
 
 #endif // NRF_802154_DELAYED_TRX_ENABLED
 
+#if NRF_802154_WAKEUP_TX_ENABLED
+
+void nrf_802154_ie_writer_rendezvous_time_set(uint64_t rendezvous_time)
+{
+    m_rendezvous_time     = rendezvous_time;
+    m_rendezvous_time_set = true;
+}
+
+void nrf_802154_ie_writer_rendezvous_time_clear(void)
+{
+    m_rendezvous_time_set = false;
+}
+
+#endif // NRF_802154_WAKEUP_TX_ENABLED
+
 #endif // NRF_802154_IE_WRITER_ENABLED
@@ -39,6 +39,7 @@
 #include <stdbool.h>
 
 #include "nrf_802154_types_internal.h"
+#include "mac_features/nrf_802154_frame_parser.h"
 
 /**
  * @defgroup nrf_802154_ie_writer Radio driver Information Element data injection feature.
@@ -88,6 +89,7 @@ void nrf_802154_ie_writer_prepare(uint8_t * p_ie_header, const uint8_t * p_end_a
  *
  * @param[in]  p_frame          Pointer to the buffer that contains the PHR and PSDU
  *                              of the transmitted frame.
+ * @param[in]  p_frame_data     Pointer to the parser data of @p p_frame.
  * @param[in]  p_params         Pointer to the transmission parameters.
  * @param[in]  notify_function  Function to be called to notify transmission failure.
  *
@@ -95,6 +97,7 @@ void nrf_802154_ie_writer_prepare(uint8_t * p_ie_header, const uint8_t * p_end_a
  */
 bool nrf_802154_ie_writer_tx_setup(
     uint8_t                                 * p_frame,
+    const nrf_802154_frame_parser_data_t    * p_frame_data,
     nrf_802154_transmit_params_t            * p_params,
     nrf_802154_transmit_failed_notification_t notify_function);
 
@@ -147,6 +150,20 @@ void nrf_802154_ie_writer_csl_period_set(uint16_t period);
  */
 void nrf_802154_ie_writer_csl_anchor_time_set(uint64_t anchor_time);
 
+/**
+ * @brief Sets the time based on which the rendezvous time is injected into the Rendezvous Time
+ *        information element.
+ *
+ * @param[in]  rendezvous_time  Time at which the frame announced by the Rendezvous Time IE starts,
+ *                              in microseconds.
+ */
+void nrf_802154_ie_writer_rendezvous_time_set(uint64_t rendezvous_time);
+
+/**
+ * @brief Stops injecting the rendezvous time into the Rendezvous Time information element.
+ */
+void nrf_802154_ie_writer_rendezvous_time_clear(void);
+
 /**
  *@}
  **/
@@ -45,7 +45,9 @@
 #include <string.h>
 
 #include "nrf_802154_pib.h"
+#include "nrf_802154_procedures_duration.h"
 #include "nrf_802154_request.h"
+#include "nrf_802154_stats.h"
 #include "mac_features/nrf_802154_frame_parser.h"
 #include "nrf_802154_sl_timer.h"
 #include "nrf_802154_sl_utils.h"
@@ -89,6 +91,11 @@ static uint8_t               m_last_frame_length;        ///< Length in bytes of
 static ifs_operation_t       m_context;                  ///< Context passed to the timer.
 static nrf_802154_sl_timer_t m_timer;                    ///< Interframe space timer.
 
+#if NRF_802154_IFS_HW_TRIGGER_ENABLED
+static uint64_t m_hw_trigger_time;                       ///< Time at which the radio ramp up of the frame waiting for the IFS is to be triggered.
+static bool     m_hw_trigger_pending;                    ///< Whether the frame examined last waits for the IFS.
+#endif
+
 /**
  * Set state of IFS procedure.
  *
@@ -108,6 +115,8 @@ static bool ifs_state_is(ifs_state_t expected_state_mask)
     return ((m_state & expected_state_mask) != 0);
 }
 
+#if !NRF_802154_IFS_HW_TRIGGER_ENABLED
+
 static void ifs_tx_result_notify(bool result)
 {
     if (!result)
@@ -137,6 +146,8 @@ static void callback_fired(nrf_802154_sl_timer_t * p_timer)
     }
 }
 
+#endif
+
 /**@brief Checks if the IFS is needed by comparing the addresses of the actual and the last frames. */
 static bool is_ifs_needed_by_address(const uint8_t * p_frame)
 {
@@ -212,6 +223,36 @@ static uint16_t ifs_needed_by_time(uint64_t current_timestamp)
     return ifs_period;
 }
 
+#if NRF_802154_IFS_HW_TRIGGER_ENABLED
+
+/**@brief Gets the time from the radio ramp up trigger to the start of the frame on air. */
+static uint32_t ifs_hw_trigger_lead_get(bool cca)
+{
+    return cca ? (RX_RAMP_UP_TIME + CCA_TIME + RX_TX_TURNAROUND_TIME) : TX_RAMP_UP_TIME;
+}
+
+/**@brief Gets the end of the last transmitted frame or of its ACK, as captured by the timer
+ *        coordinator. Falls back to the current time if no timestamp is available.
+ */
+static uint64_t ifs_last_frame_end_get(const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+    uint64_t timestamp;
+
+    if (nrf_802154_frame_parser_ar_bit_is_set(p_frame_data))
+    {
+        nrf_802154_stat_timestamp_read(&timestamp, last_ack_end_timestamp);
+    }
+    else
+    {
+        nrf_802154_stat_timestamp_read(&timestamp, last_tx_end_timestamp);
+    }
+
+    return (timestamp == NRF_802154_NO_TIMESTAMP) ?
+           nrf_802154_sl_timer_current_time_get() : timestamp;
+}
+
+#endif
+
 void nrf_802154_ifs_init(void)
 {
     m_state                    = IFS_STATE_STOPPED;
@@ -219,6 +260,9 @@ void nrf_802154_ifs_init(void)
     m_last_frame_timestamp     = 0;
     m_last_frame_length        = 0;
     m_context                  = (ifs_operation_t){ .p_data = NULL };
+#if NRF_802154_IFS_HW_TRIGGER_ENABLED
+    m_hw_trigger_pending = false;
+#endif
 
     nrf_802154_sl_timer_init(&m_timer);
 }
@@ -237,6 +281,10 @@ bool nrf_802154_ifs_pretransmission(
 
     nrf_802154_ifs_mode_t mode;
 
+#if NRF_802154_IFS_HW_TRIGGER_ENABLED
+    m_hw_trigger_pending = false;
+#endif
+
     if (p_params->immediate)
     {
         return true;
@@ -269,6 +317,13 @@ bool nrf_802154_ifs_pretransmission(
         return true;
     }
 
+#if NRF_802154_IFS_HW_TRIGGER_ENABLED
+    // The frame is transmitted right away, but its ramp up waits for the timer armed by the core.
+    m_hw_trigger_time    = m_last_frame_timestamp + dt - ifs_hw_trigger_lead_get(p_params->cca);
+    m_hw_trigger_pending = true;
+
+    return true;
+#else
     if (!ifs_state_set(IFS_STATE_STOPPED, IFS_STATE_ARMED))
     {
         assert(false);
@@ -290,14 +345,13 @@ bool nrf_802154_ifs_pretransmission(
     }
 
     return false;
+#endif
 }
 
-void nrf_802154_ifs_transmitted_hook(const uint8_t * p_frame)
+bool nrf_802154_ifs_transmitted_hook(const uint8_t * p_frame)
 {
     assert(p_frame[0] != 0U);
 
-    m_last_frame_timestamp = nrf_802154_sl_timer_current_time_get();
-
     nrf_802154_frame_parser_data_t frame_data;
     const uint8_t                * addr;
 
@@ -306,6 +360,13 @@ void nrf_802154_ifs_transmitted_hook(const uint8_t * p_frame)
                                                     PARSE_LEVEL_ADDRESSING_END,
                                                     &frame_data);
 
+#if NRF_802154_IFS_HW_TRIGGER_ENABLED
+    m_last_frame_timestamp = result ? ifs_last_frame_end_get(&frame_data) :
+                             nrf_802154_sl_timer_current_time_get();
+#else
+    m_last_frame_timestamp = nrf_802154_sl_timer_current_time_get();
+#endif
+
     if (result)
     {
         addr                       = nrf_802154_frame_parser_dst_addr_get(&frame_data);
@@ -321,7 +382,7 @@ void nrf_802154_ifs_transmitted_hook(const uint8_t * p_frame)
     {
         // If the transmitted frame has no address, we consider that enough time has passed so no IFS insertion will be needed.
         m_last_frame_length = 0;
-        return;
+        return true;
     }
 
     if (m_is_last_address_extended)
@@ -334,6 +395,8 @@ void nrf_802154_ifs_transmitted_hook(const uint8_t * p_frame)
     }
 
     m_last_frame_length = p_frame[0];
+
+    return true;
 }
 
 bool nrf_802154_ifs_abort(nrf_802154_term_t term_lvl, req_originator_t req_orig)
@@ -348,6 +411,11 @@ bool nrf_802154_ifs_abort(nrf_802154_term_t term_lvl, req_originator_t req_orig)
     {
         if (term_lvl >= NRF_802154_TERM_802154)
         {
+#if NRF_802154_IFS_HW_TRIGGER_ENABLED
+            // A ramp up that has not been triggered yet belongs to the terminated operation.
+            (void)nrf_802154_sl_timer_remove(&m_timer);
+#endif
+
             if (ifs_state_set(IFS_STATE_ARMED, IFS_STATE_ABORTING))
             {
                 ifs_operation_t * p_op = (ifs_operation_t *)m_timer.user_data.p_pointer;
@@ -373,4 +441,27 @@ bool nrf_802154_ifs_abort(nrf_802154_term_t term_lvl, req_originator_t req_orig)
     return result;
 }
 
+#if NRF_802154_IFS_HW_TRIGGER_ENABLED
+
+bool nrf_802154_ifs_hw_trigger_is_pending(void)
+{
+    return m_hw_trigger_pending;
+}
+
+bool nrf_802154_ifs_hw_trigger_arm(uint32_t ppi_channel)
+{
+    assert(m_hw_trigger_pending);
+
+    m_hw_trigger_pending = false;
+
+    m_timer.trigger_time                = m_hw_trigger_time;
+    m_timer.action_type                 = NRF_802154_SL_TIMER_ACTION_TYPE_HARDWARE;
+    m_timer.action.hardware.ppi_channel = ppi_channel;
+    m_timer.user_data.p_pointer         = NULL;
+
+    return nrf_802154_sl_timer_add(&m_timer) == NRF_802154_SL_TIMER_RET_SUCCESS;
+}
+
+#endif // NRF_802154_IFS_HW_TRIGGER_ENABLED
+
 #endif // NRF_802154_IFS_ENABLED
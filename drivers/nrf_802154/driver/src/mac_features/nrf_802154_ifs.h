@@ -38,6 +38,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 #include "nrf_802154_types_internal.h"
 
@@ -59,6 +60,10 @@ void nrf_802154_ifs_deinit(void);
  * @param[in]  p_params         Pointer to the transmission parameters.
  * @param[in]  notify_function  Function to be called to notify transmission failure.
  *
+ * @note When @ref NRF_802154_IFS_HW_TRIGGER_ENABLED is set, a frame that needs the IFS is not
+ *       delayed by this function. Instead, the transmission is started right away and its radio
+ *       ramp up is armed with @ref nrf_802154_ifs_hw_trigger_arm.
+ *
  * @retval     true      Frame will be transmitted right away.
  * @retval     false     Frame is delayed and will be transmistted after a needed IFS.
  */
@@ -72,8 +77,10 @@ bool nrf_802154_ifs_pretransmission(
  *        frame for the sake of future analysis by the @ref nrf_802154_ifs_pretransmission
  *
  * @param[in]  p_frame  Pointer to the buffer that contains the PHR and PSDU of the transmitted frame.
+ *
+ * @retval  true  Always succeeds.
  */
-void nrf_802154_ifs_transmitted_hook(const uint8_t * p_frame);
+bool nrf_802154_ifs_transmitted_hook(const uint8_t * p_frame);
 
 /**
  * @brief Aborts an ongoing IFS-delayed transmission.
@@ -87,4 +94,28 @@ void nrf_802154_ifs_transmitted_hook(const uint8_t * p_frame);
  */
 bool nrf_802154_ifs_abort(nrf_802154_term_t term_lvl, req_originator_t req_orig);
 
+#if NRF_802154_IFS_HW_TRIGGER_ENABLED
+
+/**
+ * @brief Checks if the frame examined by the last @ref nrf_802154_ifs_pretransmission call
+ *        must have its radio ramp up triggered by the hardware at the end of the IFS.
+ *
+ * @retval  true   The ramp up must be armed with @ref nrf_802154_ifs_hw_trigger_arm.
+ * @retval  false  No IFS is needed and the ramp up can be triggered right away.
+ */
+bool nrf_802154_ifs_hw_trigger_is_pending(void);
+
+/**
+ * @brief Arms the timer that triggers the radio ramp up at the end of the IFS.
+ *
+ * @param[in]  ppi_channel  (D)PPI channel that triggers the radio ramp up.
+ *
+ * @retval  true   The timer is armed and will trigger @p ppi_channel at the end of the IFS.
+ * @retval  false  The end of the IFS is too close or has already passed. The ramp up must be
+ *                 triggered by the caller.
+ */
+bool nrf_802154_ifs_hw_trigger_arm(uint32_t ppi_channel);
+
+#endif // NRF_802154_IFS_HW_TRIGGER_ENABLED
+
 #endif // NRF_802154_IFS_H
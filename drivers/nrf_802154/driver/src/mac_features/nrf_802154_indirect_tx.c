@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the indirect transmission feature of the 802.15.4 driver.
+ *
+ * The feature holds frames addressed to devices that poll for data. When the core acknowledges
+ * a frame from such a device with the pending bit set, the oldest frame queued for that device is
+ * selected and its transmission is requested right after the ACK, from the radio interrupt
+ * context, so that the frame arrives while the polling device still listens.
+ *
+ */
+
+#include "nrf_802154_indirect_tx.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_pib.h"
+#include "nrf_802154_request.h"
+#include "nrf_802154_tx_power.h"
+#include "nrf_802154_utils.h"
+
+#if NRF_802154_INDIRECT_TX_ENABLED
+
+#if NRF_802154_INDIRECT_TX_QUEUE_DEPTH < 1
+#error NRF_802154_INDIRECT_TX_QUEUE_DEPTH must be at least 1
+#endif
+
+#define NO_ENTRY UINT32_MAX ///< Index indicating that no entry is selected.
+
+/**
+ * @brief States of an entry of the indirect transmission queue.
+ */
+typedef enum
+{
+    ENTRY_STATE_FREE,      ///< The entry holds no frame.
+    ENTRY_STATE_QUEUED,    ///< The frame waits for a poll from its destination.
+    ENTRY_STATE_SELECTED,  ///< The frame is selected to answer a poll that has just been acknowledged.
+    ENTRY_STATE_IN_FLIGHT, ///< The frame is handed over for transmission.
+} entry_state_t;
+
+/**
+ * @brief Frame held by the indirect transmission queue.
+ */
+typedef struct
+{
+    uint8_t                    * p_data;                          ///< Pointer to a buffer that contains PHR and PSDU of the frame.
+    nrf_802154_transmit_params_t params;                          ///< Transmission parameters of the frame.
+    uint32_t                     seq;                             ///< Sequence number keeping the order in which frames were queued.
+    uint8_t                      dst_addr[EXTENDED_ADDRESS_SIZE]; ///< Destination address of the frame.
+    uint8_t                      dst_addr_size;                   ///< Size of the destination address.
+    entry_state_t                state;                           ///< State of the entry.
+} indirect_tx_entry_t;
+
+static indirect_tx_entry_t m_entries[NRF_802154_INDIRECT_TX_QUEUE_DEPTH]; ///< Frames held by the queue.
+static uint32_t            m_next_seq;                                    ///< Sequence number of the next queued frame.
+static uint32_t            m_selected;                                    ///< Index of the selected entry.
+static bool                m_rejected;                                    ///< Whether the last transmit request was rejected.
+
+static void tx_result_notify(bool result)
+{
+    if (!result)
+    {
+        m_rejected = true;
+    }
+}
+
+/**
+ * @brief Finds the oldest queued frame addressed to the given device.
+ *
+ * @param[in]  p_addr     Pointer to the address of the device.
+ * @param[in]  addr_size  Size of the address.
+ *
+ * @returns  Index of the entry or @ref NO_ENTRY if no frame is queued for the device.
+ */
+static uint32_t oldest_entry_find(const uint8_t * p_addr, uint8_t addr_size)
+{
+    uint32_t result = NO_ENTRY;
+
+    for (uint32_t i = 0; i < NRF_802154_INDIRECT_TX_QUEUE_DEPTH; i++)
+    {
+        const indirect_tx_entry_t * p_entry = &m_entries[i];
+
+        if ((p_entry->state != ENTRY_STATE_QUEUED) ||
+            (p_entry->dst_addr_size != addr_size) ||
+            (memcmp(p_entry->dst_addr, p_addr, addr_size) != 0))
+        {
+            continue;
+        }
+
+        // Sequence numbers are compared as a difference to stay correct when they wrap around.
+        if ((result == NO_ENTRY) ||
+            ((int32_t)(p_entry->seq - m_entries[result].seq) < 0))
+        {
+            result = i;
+        }
+    }
+
+    return result;
+}
+
+void nrf_802154_indirect_tx_init(void)
+{
+    for (uint32_t i = 0; i < NRF_802154_INDIRECT_TX_QUEUE_DEPTH; i++)
+    {
+        m_entries[i].state = ENTRY_STATE_FREE;
+    }
+
+    m_next_seq = 0U;
+    m_selected = NO_ENTRY;
+    m_rejected = false;
+}
+
+void nrf_802154_indirect_tx_deinit(void)
+{
+    nrf_802154_indirect_tx_init();
+}
+
+bool nrf_802154_indirect_tx_push(uint8_t                              * p_data,
+                                 const nrf_802154_transmit_metadata_t * p_metadata)
+{
+    nrf_802154_frame_parser_data_t  frame_data;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    const uint8_t                 * p_dst_addr;
+    uint8_t                         dst_addr_size;
+    bool                            result = false;
+
+    (void)nrf_802154_frame_parser_data_init(p_data,
+                                            p_data[PHR_OFFSET] + PHR_SIZE,
+                                            PARSE_LEVEL_DST_ADDRESSING_END,
+                                            &frame_data);
+
+    p_dst_addr    = nrf_802154_frame_parser_dst_addr_get(&frame_data);
+    dst_addr_size = nrf_802154_frame_parser_dst_addr_size_get(&frame_data);
+
+    if ((p_dst_addr == NULL) || (dst_addr_size == 0U) || (dst_addr_size > EXTENDED_ADDRESS_SIZE))
+    {
+        return false;
+    }
+
+    indirect_tx_entry_t entry =
+    {
+        .p_data = p_data,
+        .params =
+        {
+            .frame_props        = p_metadata->frame_props,
+            .tx_power           = {0},
+            .cca                = p_metadata->cca,
+            .immediate          = false,
+            .extra_cca_attempts = 0U,
+        },
+        .dst_addr_size = dst_addr_size,
+        .state         = ENTRY_STATE_QUEUED,
+    };
+
+    memcpy(entry.dst_addr, p_dst_addr, dst_addr_size);
+
+    (void)nrf_802154_tx_power_convert_metadata_to_tx_power_split(nrf_802154_pib_channel_get(),
+                                                                 p_metadata->tx_power,
+                                                                 &entry.params.tx_power);
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    for (uint32_t i = 0; i < NRF_802154_INDIRECT_TX_QUEUE_DEPTH; i++)
+    {
+        if (m_entries[i].state == ENTRY_STATE_FREE)
+        {
+            entry.seq    = m_next_seq++;
+            m_entries[i] = entry;
+            result       = true;
+            break;
+        }
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+bool nrf_802154_indirect_tx_cancel(const uint8_t * p_data)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    bool                            result = false;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    for (uint32_t i = 0; i < NRF_802154_INDIRECT_TX_QUEUE_DEPTH; i++)
+    {
+        if ((m_entries[i].state == ENTRY_STATE_QUEUED) && (m_entries[i].p_data == p_data))
+        {
+            m_entries[i].state = ENTRY_STATE_FREE;
+            result             = true;
+            break;
+        }
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+bool nrf_802154_indirect_tx_poll_detect(const nrf_802154_frame_parser_data_t * p_frame_data,
+                                        const uint8_t                        * p_ack)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    const uint8_t                 * p_src_addr;
+    uint8_t                         src_addr_size;
+    uint32_t                        index;
+
+    if ((p_ack == NULL) || ((p_ack[FRAME_PENDING_OFFSET] & FRAME_PENDING_BIT) == 0U))
+    {
+        return false;
+    }
+
+    if (nrf_802154_frame_parser_parse_level_get(p_frame_data) < PARSE_LEVEL_ADDRESSING_END)
+    {
+        return false;
+    }
+
+    p_src_addr    = nrf_802154_frame_parser_src_addr_get(p_frame_data);
+    src_addr_size = nrf_802154_frame_parser_src_addr_size_get(p_frame_data);
+
+    if ((p_src_addr == NULL) || (src_addr_size == 0U))
+    {
+        return false;
+    }
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    index = (m_selected == NO_ENTRY) ? oldest_entry_find(p_src_addr, src_addr_size) : NO_ENTRY;
+
+    if (index != NO_ENTRY)
+    {
+        m_entries[index].state = ENTRY_STATE_SELECTED;
+        m_selected             = index;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return index != NO_ENTRY;
+}
+
+void nrf_802154_indirect_tx_poll_respond(void)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    indirect_tx_entry_t           * p_entry = NULL;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    if (m_selected != NO_ENTRY)
+    {
+        p_entry        = &m_entries[m_selected];
+        p_entry->state = ENTRY_STATE_IN_FLIGHT;
+        m_selected     = NO_ENTRY;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    if (p_entry == NULL)
+    {
+        return;
+    }
+
+    m_rejected = false;
+
+    (void)nrf_802154_request_transmit(NRF_802154_TERM_NONE,
+                                      REQ_ORIG_INDIRECT_TX,
+                                      p_entry->p_data,
+                                      &p_entry->params,
+                                      tx_result_notify);
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    // A failed frame setup is notified by the core before the request returns, which frees
+    // the entry. A frame that was not handed over at all waits for the next poll.
+    if (m_rejected && (p_entry->state == ENTRY_STATE_IN_FLIGHT))
+    {
+        p_entry->state = ENTRY_STATE_QUEUED;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_indirect_tx_transmit_done_hook(const uint8_t * p_frame)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    for (uint32_t i = 0; i < NRF_802154_INDIRECT_TX_QUEUE_DEPTH; i++)
+    {
+        if ((m_entries[i].state == ENTRY_STATE_IN_FLIGHT) && (m_entries[i].p_data == p_frame))
+        {
+            m_entries[i].state = ENTRY_STATE_FREE;
+            break;
+        }
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+#endif // NRF_802154_INDIRECT_TX_ENABLED
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file contains declarations of the indirect transmission feature of the 802.15.4 driver.
+ *
+ */
+
+#ifndef NRF_802154_INDIRECT_TX_H
+#define NRF_802154_INDIRECT_TX_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_types_internal.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+
+/**
+ * @brief Initializes the indirect transmission feature.
+ */
+void nrf_802154_indirect_tx_init(void);
+
+/**
+ * @brief Deinitializes the indirect transmission feature.
+ */
+void nrf_802154_indirect_tx_deinit(void);
+
+/**
+ * @brief Adds a frame to the indirect transmission queue.
+ *
+ * @param[in]  p_data      Pointer to a buffer that contains PHR and PSDU of the frame.
+ * @param[in]  p_metadata  Pointer to metadata structure. Contains detailed properties of data
+ *                         to transmit.
+ *
+ * @retval  true   The frame was added to the queue.
+ * @retval  false  The queue is full or the frame has no destination address.
+ */
+bool nrf_802154_indirect_tx_push(uint8_t                              * p_data,
+                                 const nrf_802154_transmit_metadata_t * p_metadata);
+
+/**
+ * @brief Removes a frame from the indirect transmission queue.
+ *
+ * @param[in]  p_data  Pointer to a buffer that contains PHR and PSDU of the frame.
+ *
+ * @retval  true   The frame was removed from the queue.
+ * @retval  false  The frame is not in the queue or its transmission has already been requested.
+ */
+bool nrf_802154_indirect_tx_cancel(const uint8_t * p_data);
+
+/**
+ * @brief Checks if the transmitted ACK answers a poll for which a frame is queued.
+ *
+ * This function is to be called by the core once the ACK is transmitted, before the received
+ * frame is passed to the higher layer. If a queued frame is addressed to the source of the
+ * received frame and the ACK has the pending bit set, the frame is selected for transmission.
+ *
+ * @param[in]  p_frame_data  Pointer to the parser data of the acknowledged frame.
+ * @param[in]  p_ack         Pointer to a buffer that contains PHR and PSDU of the transmitted ACK.
+ *
+ * @retval  true   A frame is selected. @ref nrf_802154_indirect_tx_poll_respond is to be called.
+ * @retval  false  No frame is to be transmitted.
+ */
+bool nrf_802154_indirect_tx_poll_detect(const nrf_802154_frame_parser_data_t * p_frame_data,
+                                        const uint8_t                        * p_ack);
+
+/**
+ * @brief Requests the transmission of the frame selected by
+ *        @ref nrf_802154_indirect_tx_poll_detect.
+ *
+ * This function is to be called in a context in which the transmission can be requested
+ * directly, after the received frame is passed to the higher layer.
+ */
+void nrf_802154_indirect_tx_poll_respond(void);
+
+/**
+ * @brief Removes the frame from the indirect transmission queue once its transmission result
+ *        is notified.
+ *
+ * This function is to be called in the context in which the transmission result is reported
+ * to the notification module.
+ *
+ * @param[in]  p_frame  Pointer to the buffer that contains the PHR and PSDU of the frame whose
+ *                      transmission has ended.
+ */
+void nrf_802154_indirect_tx_transmit_done_hook(const uint8_t * p_frame);
+
+#endif // NRF_802154_INDIRECT_TX_H
@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the Link Metrics Forward Tracking Series accumulators of the 802.15.4
+ *   driver.
+ *
+ */
+
+#include "nrf_802154_lm_series.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_nrfx_addons.h"
+#include "nrf_802154_utils.h"
+
+#if NRF_802154_LINK_METRICS_SERIES_ENABLED
+
+/**
+ * @brief Accumulator of a single series.
+ */
+typedef struct
+{
+    uint8_t                     addr[EXTENDED_ADDRESS_SIZE]; ///< Address of the initiator.
+    uint8_t                     addr_size;                   ///< Address size.
+    uint8_t                     series_id;                   ///< Identifier of the series.
+    nrf_802154_lm_frame_types_t frame_types;                 ///< Accounted frames, 0 if free.
+    uint32_t                    pdu_count;                   ///< Number of accounted frames.
+    uint32_t                    lqi_sum;                     ///< Sum of LQI values.
+    uint32_t                    margin_sum;                  ///< Sum of link margins in dB.
+    int32_t                     rssi_sum;                    ///< Sum of RSSI values in dBm.
+} series_entry_t;
+
+static series_entry_t m_series[NRF_802154_LINK_METRICS_SERIES_NUM]; ///< Series accumulators.
+
+/**
+ * @brief Finds the accumulator of the series with the given identifier.
+ *
+ * @param[in]  series_id  Identifier of the series.
+ *
+ * @returns  Pointer to the accumulator or NULL if the series is not configured.
+ */
+static series_entry_t * series_find(uint8_t series_id)
+{
+    for (uint32_t i = 0; i < NUMELTS(m_series); i++)
+    {
+        if ((m_series[i].frame_types != 0U) && (m_series[i].series_id == series_id))
+        {
+            return &m_series[i];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Accounts a frame in all series of the given initiator that track the given frame type.
+ *
+ * @param[in]  p_addr      Pointer to the address of the initiator.
+ * @param[in]  addr_size   Size of the address.
+ * @param[in]  frame_type  Type of the frame to account.
+ * @param[in]  rssi        RSSI of the frame in dBm.
+ * @param[in]  lqi         LQI of the frame.
+ */
+static void series_update(const uint8_t             * p_addr,
+                          uint8_t                     addr_size,
+                          nrf_802154_lm_frame_types_t frame_type,
+                          int8_t                      rssi,
+                          uint8_t                     lqi)
+{
+    int16_t margin = (int16_t)rssi - ED_RSSIOFFS;
+
+    if (margin < 0)
+    {
+        margin = 0;
+    }
+
+    for (uint32_t i = 0; i < NUMELTS(m_series); i++)
+    {
+        series_entry_t * p_entry = &m_series[i];
+
+        if (((p_entry->frame_types & frame_type) != 0U) &&
+            (p_entry->addr_size == addr_size) &&
+            (0 == memcmp(p_entry->addr, p_addr, addr_size)))
+        {
+            p_entry->pdu_count++;
+            p_entry->lqi_sum    += lqi;
+            p_entry->margin_sum += (uint32_t)margin;
+            p_entry->rssi_sum   += rssi;
+        }
+    }
+}
+
+void nrf_802154_lm_series_init(void)
+{
+    memset(m_series, 0, sizeof(m_series));
+}
+
+bool nrf_802154_lm_series_configure(uint8_t                     series_id,
+                                    const uint8_t             * p_addr,
+                                    bool                        extended,
+                                    nrf_802154_lm_frame_types_t frame_types)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    series_entry_t                * p_entry;
+    bool                            result = true;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    p_entry = series_find(series_id);
+
+    if (p_entry == NULL)
+    {
+        for (uint32_t i = 0; (i < NUMELTS(m_series)) && (frame_types != 0U); i++)
+        {
+            if (m_series[i].frame_types == 0U)
+            {
+                p_entry = &m_series[i];
+                break;
+            }
+        }
+    }
+
+    if (p_entry == NULL)
+    {
+        result = false;
+    }
+    else
+    {
+        uint8_t addr_size = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+
+        memset(p_entry, 0, sizeof(*p_entry));
+
+        if (frame_types != 0U)
+        {
+            memcpy(p_entry->addr, p_addr, addr_size);
+            p_entry->addr_size   = addr_size;
+            p_entry->series_id   = series_id;
+            p_entry->frame_types = frame_types;
+        }
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+bool nrf_802154_lm_series_get(uint8_t series_id, nrf_802154_lm_series_t * p_series)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    const series_entry_t          * p_entry;
+    bool                            result = false;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    p_entry = series_find(series_id);
+
+    if (p_entry != NULL)
+    {
+        uint32_t count = p_entry->pdu_count;
+
+        p_series->pdu_count   = count;
+        p_series->lqi         = (count != 0U) ? (uint8_t)(p_entry->lqi_sum / count) : 0U;
+        p_series->link_margin = (count != 0U) ? (uint8_t)(p_entry->margin_sum / count) : 0U;
+        p_series->rssi        = (count != 0U) ? (int8_t)(p_entry->rssi_sum / (int32_t)count) : 0;
+
+        result = true;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+void nrf_802154_lm_series_rx_frame_update(const nrf_802154_frame_parser_data_t * p_frame_data,
+                                          int8_t                                 rssi,
+                                          uint8_t                                lqi)
+{
+    const uint8_t             * p_addr    = nrf_802154_frame_parser_src_addr_get(p_frame_data);
+    uint8_t                     addr_size = nrf_802154_frame_parser_src_addr_size_get(p_frame_data);
+    const uint8_t             * p_cmd;
+    nrf_802154_lm_frame_types_t frame_type;
+
+    if ((p_addr == NULL) || (addr_size == 0U))
+    {
+        return;
+    }
+
+    p_cmd = nrf_802154_frame_parser_mac_command_id_get(p_frame_data);
+
+    if (nrf_802154_frame_parser_frame_type_get(p_frame_data) == FRAME_TYPE_DATA)
+    {
+        frame_type = NRF_802154_LM_FRAME_TYPE_DATA;
+    }
+    else if ((p_cmd != NULL) && (*p_cmd == MAC_CMD_DATA_REQ))
+    {
+        frame_type = NRF_802154_LM_FRAME_TYPE_DATA_REQUEST;
+    }
+    else
+    {
+        return;
+    }
+
+    series_update(p_addr, addr_size, frame_type, rssi, lqi);
+}
+
+void nrf_802154_lm_series_ack_update(const uint8_t * p_tx_frame, int8_t rssi, uint8_t lqi)
+{
+    nrf_802154_frame_parser_data_t frame_data;
+    const uint8_t                * p_addr;
+
+    bool result = nrf_802154_frame_parser_data_init(p_tx_frame,
+                                                    p_tx_frame[PHR_OFFSET] + PHR_SIZE,
+                                                    PARSE_LEVEL_DST_ADDRESSING_END,
+                                                    &frame_data);
+
+    if (!result)
+    {
+        return;
+    }
+
+    p_addr = nrf_802154_frame_parser_dst_addr_get(&frame_data);
+
+    if (p_addr == NULL)
+    {
+        return;
+    }
+
+    series_update(p_addr,
+                  nrf_802154_frame_parser_dst_addr_size_get(&frame_data),
+                  NRF_802154_LM_FRAME_TYPE_ACK,
+                  rssi,
+                  lqi);
+}
+
+#endif // NRF_802154_LINK_METRICS_SERIES_ENABLED
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @defgroup nrf_802154_lm_series Link Metrics Forward Tracking Series
+ * @{
+ * @ingroup nrf_802154
+ * @brief Accumulators of Link Metrics Forward Tracking Series of the 802.15.4 driver.
+ */
+
+#ifndef NRF_802154_LM_SERIES_H_
+#define NRF_802154_LM_SERIES_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_types.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+
+/**
+ * @brief Initializes the Link Metrics Forward Tracking Series feature.
+ */
+void nrf_802154_lm_series_init(void);
+
+/**
+ * @brief Configures, reconfigures or removes a Link Metrics Forward Tracking Series.
+ *
+ * Configuring a series clears its accumulated values.
+ *
+ * @param[in]  series_id    Identifier of the series.
+ * @param[in]  p_addr       Pointer to the address of the initiator of the series.
+ * @param[in]  extended     If the given address is an extended MAC address or a short MAC address.
+ * @param[in]  frame_types  Frame types accounted in the series. Zero removes the series.
+ *
+ * @retval true   The series was configured or removed.
+ * @retval false  There is no room for another series, or the series to remove does not exist.
+ */
+bool nrf_802154_lm_series_configure(uint8_t                     series_id,
+                                    const uint8_t             * p_addr,
+                                    bool                        extended,
+                                    nrf_802154_lm_frame_types_t frame_types);
+
+/**
+ * @brief Gets the values accumulated in a Link Metrics Forward Tracking Series.
+ *
+ * @param[in]   series_id  Identifier of the series.
+ * @param[out]  p_series   Pointer to the structure to be filled with the accumulated values.
+ *
+ * @retval true   The values were retrieved.
+ * @retval false  The series does not exist.
+ */
+bool nrf_802154_lm_series_get(uint8_t series_id, nrf_802154_lm_series_t * p_series);
+
+/**
+ * @brief Accounts a received frame in the matching series.
+ *
+ * @param[in]  p_frame_data  Pointer to the parser data of the received frame. The frame must be
+ *                           parsed to the @ref PARSE_LEVEL_FULL level.
+ * @param[in]  rssi          RSSI of the received frame in dBm.
+ * @param[in]  lqi           LQI of the received frame.
+ */
+void nrf_802154_lm_series_rx_frame_update(const nrf_802154_frame_parser_data_t * p_frame_data,
+                                          int8_t                                 rssi,
+                                          uint8_t                                lqi);
+
+/**
+ * @brief Accounts a received ACK in the matching series.
+ *
+ * The ACK is accounted for the destination of the transmitted frame it acknowledges.
+ *
+ * @param[in]  p_tx_frame  Pointer to the buffer that contains the PHR and PSDU of the frame
+ *                         acknowledged by the ACK.
+ * @param[in]  rssi        RSSI of the received ACK in dBm.
+ * @param[in]  lqi         LQI of the received ACK.
+ */
+void nrf_802154_lm_series_ack_update(const uint8_t * p_tx_frame, int8_t rssi, uint8_t lqi);
+
+/**
+ *@}
+ **/
+
+#endif // NRF_802154_LM_SERIES_H_
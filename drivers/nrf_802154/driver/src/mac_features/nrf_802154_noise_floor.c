@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the channel noise floor monitor of the 802.15.4 driver.
+ *
+ */
+
+#include "nrf_802154_noise_floor.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+
+#if NRF_802154_NOISE_FLOOR_ENABLED
+
+#define NOISE_FLOOR_CHANNEL_MIN 11U       ///< Lowest channel with a noise floor estimate.
+#define NOISE_FLOOR_CHANNELS    16U       ///< Number of channels with a noise floor estimate.
+#define NOISE_FLOOR_FRAC_BITS   4U        ///< Fractional bits of the stored estimates.
+#define NOISE_FLOOR_INVALID     INT16_MIN ///< Marker of a channel without an estimate.
+
+/** Noise floor estimates in 1/2^NOISE_FLOOR_FRAC_BITS dBm. A single halfword is read and written
+ *  at a time, so an estimate can be read from any context. */
+static volatile int16_t m_noise_floor[NOISE_FLOOR_CHANNELS];
+
+void nrf_802154_noise_floor_init(void)
+{
+    nrf_802154_noise_floor_reset();
+}
+
+void nrf_802154_noise_floor_sample_add(uint8_t channel, int8_t rssi)
+{
+    uint8_t idx = channel - NOISE_FLOOR_CHANNEL_MIN;
+
+    if (idx >= NOISE_FLOOR_CHANNELS)
+    {
+        return;
+    }
+
+    int32_t sample   = (int32_t)rssi * (1 << NOISE_FLOOR_FRAC_BITS);
+    int32_t estimate = m_noise_floor[idx];
+
+    if (estimate == NOISE_FLOOR_INVALID)
+    {
+        estimate = sample;
+    }
+    else
+    {
+        estimate += (sample - estimate) / (1 << NRF_802154_NOISE_FLOOR_AVERAGING_SHIFT);
+    }
+
+    m_noise_floor[idx] = (int16_t)estimate;
+}
+
+bool nrf_802154_noise_floor_get(uint8_t channel, int8_t * p_noise_floor)
+{
+    uint8_t idx = channel - NOISE_FLOOR_CHANNEL_MIN;
+
+    if (idx >= NOISE_FLOOR_CHANNELS)
+    {
+        return false;
+    }
+
+    int32_t estimate = m_noise_floor[idx];
+
+    if (estimate == NOISE_FLOOR_INVALID)
+    {
+        return false;
+    }
+
+    // Round to the nearest dBm.
+    estimate += (estimate >= 0) ? (1 << (NOISE_FLOOR_FRAC_BITS - 1)) :
+                -(1 << (NOISE_FLOOR_FRAC_BITS - 1));
+
+    *p_noise_floor = (int8_t)(estimate / (1 << NOISE_FLOOR_FRAC_BITS));
+
+    return true;
+}
+
+void nrf_802154_noise_floor_reset(void)
+{
+    for (uint32_t i = 0; i < NOISE_FLOOR_CHANNELS; i++)
+    {
+        m_noise_floor[i] = NOISE_FLOOR_INVALID;
+    }
+}
+
+#endif // NRF_802154_NOISE_FLOOR_ENABLED
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @defgroup nrf_802154_noise_floor Channel noise floor monitor
+ * @{
+ * @ingroup nrf_802154
+ * @brief Background estimation of the noise floor of the 802.15.4 channels.
+ */
+
+#ifndef NRF_802154_NOISE_FLOOR_H_
+#define NRF_802154_NOISE_FLOOR_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Initializes the noise floor monitor.
+ */
+void nrf_802154_noise_floor_init(void);
+
+/**
+ * @brief Accounts an RSSI sample of an idle channel in the noise floor estimate of the channel.
+ *
+ * The estimate is an exponential moving average with the weight of a new sample equal to
+ * 2^-@ref NRF_802154_NOISE_FLOOR_AVERAGING_SHIFT. The first sample initializes the estimate.
+ *
+ * @param[in]  channel  Channel on which the sample was taken.
+ * @param[in]  rssi     RSSI sample in dBm.
+ */
+void nrf_802154_noise_floor_sample_add(uint8_t channel, int8_t rssi);
+
+/**
+ * @brief Gets the noise floor estimate of a channel.
+ *
+ * @param[in]   channel        Channel for which the estimate is requested.
+ * @param[out]  p_noise_floor  Pointer to the estimated noise floor in dBm.
+ *
+ * @retval true   The estimate was retrieved.
+ * @retval false  The channel is invalid or no sample was taken on it yet.
+ */
+bool nrf_802154_noise_floor_get(uint8_t channel, int8_t * p_noise_floor);
+
+/**
+ * @brief Discards the noise floor estimates of all channels.
+ */
+void nrf_802154_noise_floor_reset(void);
+
+/**
+ *@}
+ **/
+
+#endif // NRF_802154_NOISE_FLOOR_H_
@@ -169,6 +169,16 @@ void nrf_802154_ack_timeout_time_set(uint32_t time)
     m_timeout = time;
 }
 
+#if NRF_802154_ACK_TIMEOUT_HW_WINDOW_ENABLED
+
+uint32_t nrf_802154_ack_timeout_window_get(void)
+{
+    // Matches the timeout scheduled by timeout_timer_start(), reduced by the frame duration
+    return m_timeout + IMM_ACK_DURATION;
+}
+
+#endif // NRF_802154_ACK_TIMEOUT_HW_WINDOW_ENABLED
+
 bool nrf_802154_ack_timeout_tx_started_hook(uint8_t * p_frame)
 {
     mp_frame = p_frame;
@@ -201,11 +211,13 @@ bool nrf_802154_ack_timeout_abort(nrf_802154_term_t term_lvl, req_originator_t r
     return result;
 }
 
-void nrf_802154_ack_timeout_transmitted_hook(const uint8_t * p_frame)
+bool nrf_802154_ack_timeout_transmitted_hook(const uint8_t * p_frame)
 {
     assert((p_frame == mp_frame) || (!m_procedure_is_active));
 
     timeout_timer_stop();
+
+    return true;
 }
 
 void nrf_802154_ack_timeout_rx_ack_started_hook(void)
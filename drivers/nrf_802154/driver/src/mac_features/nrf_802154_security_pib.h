@@ -110,6 +110,13 @@ void nrf_802154_security_pib_global_frame_counter_set(uint32_t frame_counter);
  */
 void nrf_802154_security_pib_global_frame_counter_set_if_larger(uint32_t frame_counter);
 
+/**
+ * @brief Confirms that the Global MAC Frame Counter high-water mark has been persisted.
+ *
+ * @param[in] high_water_mark Persisted high-water mark.
+ */
+void nrf_802154_security_pib_global_frame_counter_reservation_confirm(uint32_t high_water_mark);
+
 /**
  * @brief Get the next 802.15.4 global frame counter.
  *
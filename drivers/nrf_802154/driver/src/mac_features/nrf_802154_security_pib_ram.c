@@ -34,6 +34,7 @@
 
 #include "nrf_802154_security_pib.h"
 
+#include "nrf_802154_callouts.h"
 #include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 #include "nrf_802154_sl_atomics.h"
@@ -42,6 +43,17 @@
 #include <stdbool.h>
 #include <assert.h>
 
+#if (NRF_802154_SECURITY_KEY_INDEX_SIZE == 0) || \
+    ((NRF_802154_SECURITY_KEY_INDEX_SIZE & (NRF_802154_SECURITY_KEY_INDEX_SIZE - 1)) != 0)
+#error "NRF_802154_SECURITY_KEY_INDEX_SIZE must be a power of two"
+#endif
+
+#if NRF_802154_SECURITY_KEY_STORAGE_SIZE >= UINT8_MAX
+#error "NRF_802154_SECURITY_KEY_STORAGE_SIZE must be lower than 255"
+#endif
+
+#define INDEX_NONE UINT8_MAX ///< Marks the end of a hash index chain.
+
 typedef struct
 {
     uint8_t                  key[AES_CCM_KEY_SIZE];
@@ -50,10 +62,19 @@ typedef struct
     uint32_t                 frame_counter;
     bool                     use_global_frame_counter;
     bool                     taken;
+    volatile uint8_t         next; ///< Next entry in the same hash index chain.
 } table_entry_t;
 
-static table_entry_t m_key_storage[NRF_802154_SECURITY_KEY_STORAGE_SIZE];
-static uint32_t      m_global_frame_counter;
+static table_entry_t    m_key_storage[NRF_802154_SECURITY_KEY_STORAGE_SIZE];
+static volatile uint8_t m_key_index[NRF_802154_SECURITY_KEY_INDEX_SIZE];
+static uint32_t         m_global_frame_counter;
+
+#if NRF_802154_SECURITY_FRAME_COUNTER_RESERVATION_ENABLED
+#define FC_RESERVATION_BLOCK_SIZE NRF_802154_SECURITY_FRAME_COUNTER_RESERVATION_BLOCK_SIZE
+
+static volatile uint32_t m_fc_limit;     ///< Confirmed high-water mark of the global frame counter.
+static volatile uint32_t m_fc_requested; ///< Last high-water mark requested to be persisted.
+#endif
 
 static bool mode_is_valid(nrf_802154_key_id_mode_t mode)
 {
@@ -88,6 +109,30 @@ static int id_length_get(nrf_802154_key_id_mode_t mode)
     }
 }
 
+/**
+ * @brief Calculates the hash index bucket of a key ID.
+ *
+ * @param[in]  mode  Key ID mode.
+ * @param[in]  p_id  Pointer to the key ID of length determined by @p mode. May be NULL for mode 0.
+ *
+ * @return  Index of the bucket in @ref m_key_index.
+ */
+static uint32_t bucket_get(nrf_802154_key_id_mode_t mode, const uint8_t * p_id)
+{
+    /* FNV-1a over the key ID mode and the key ID. */
+    uint32_t hash = 2166136261UL;
+    int      len  = (p_id == NULL) ? 0 : id_length_get(mode);
+
+    hash = (hash ^ (uint8_t)mode) * 16777619UL;
+
+    for (int i = 0; i < len; i++)
+    {
+        hash = (hash ^ p_id[i]) * 16777619UL;
+    }
+
+    return (hash ^ (hash >> 16)) & (NRF_802154_SECURITY_KEY_INDEX_SIZE - 1);
+}
+
 static bool key_matches(table_entry_t * p_key, nrf_802154_key_id_t * p_id)
 {
     if (!p_key->taken)
@@ -115,17 +160,35 @@ static bool key_matches(table_entry_t * p_key, nrf_802154_key_id_t * p_id)
     }
 }
 
-static bool key_is_present(nrf_802154_key_id_t * p_id)
+/**
+ * @brief Looks up a key in the Key Storage using the hash index.
+ *
+ * @param[in]  p_id  Pointer to the ID of the key to look up.
+ *
+ * @return  Pointer to the matching entry or NULL if no such key is stored.
+ */
+static table_entry_t * key_find(nrf_802154_key_id_t * p_id)
 {
-    for (uint32_t i = 0; i < NRF_802154_SECURITY_KEY_STORAGE_SIZE; i++)
+    uint8_t idx = m_key_index[bucket_get(p_id->mode, p_id->p_key_id)];
+
+    while (idx != INDEX_NONE)
     {
-        if (key_matches(&m_key_storage[i], p_id))
+        table_entry_t * p_entry = &m_key_storage[idx];
+
+        if (key_matches(p_entry, p_id))
         {
-            return true;
+            return p_entry;
         }
+
+        idx = p_entry->next;
     }
 
-    return false;
+    return NULL;
+}
+
+static bool key_is_present(nrf_802154_key_id_t * p_id)
+{
+    return key_find(p_id) != NULL;
 }
 
 nrf_802154_security_error_t nrf_802154_security_pib_init(void)
@@ -133,6 +196,12 @@ nrf_802154_security_error_t nrf_802154_security_pib_init(void)
     for (uint32_t i = 0; i < NRF_802154_SECURITY_KEY_STORAGE_SIZE; i++)
     {
         m_key_storage[i].taken = false;
+        m_key_storage[i].next  = INDEX_NONE;
+    }
+
+    for (uint32_t i = 0; i < NRF_802154_SECURITY_KEY_INDEX_SIZE; i++)
+    {
+        m_key_index[i] = INDEX_NONE;
     }
 
     return NRF_802154_SECURITY_ERROR_NONE;
@@ -173,10 +242,16 @@ nrf_802154_security_error_t nrf_802154_security_pib_key_store(nrf_802154_key_t *
             memcpy(m_key_storage[i].id, p_key->id.p_key_id, id_length_get(p_key->id.mode));
             m_key_storage[i].frame_counter            = p_key->frame_counter;
             m_key_storage[i].use_global_frame_counter = p_key->use_global_frame_counter;
+            m_key_storage[i].taken                    = true;
+
+            uint32_t bucket = bucket_get(p_key->id.mode, p_key->id.p_key_id);
 
+            m_key_storage[i].next = m_key_index[bucket];
+
+            /* Publish the entry only once it is complete, as it may be looked up from an ISR. */
             __DMB();
 
-            m_key_storage[i].taken = true;
+            m_key_index[bucket] = (uint8_t)i;
             return NRF_802154_SECURITY_ERROR_NONE;
         }
     }
@@ -188,13 +263,22 @@ nrf_802154_security_error_t nrf_802154_security_pib_key_remove(nrf_802154_key_id
 {
     assert(p_id != NULL);
 
-    for (uint32_t i = 0; i < NRF_802154_SECURITY_KEY_STORAGE_SIZE; i++)
+    volatile uint8_t * p_link = &m_key_index[bucket_get(p_id->mode, p_id->p_key_id)];
+
+    while (*p_link != INDEX_NONE)
     {
-        if (key_matches(&m_key_storage[i], p_id))
+        table_entry_t * p_entry = &m_key_storage[*p_link];
+
+        if (key_matches(p_entry, p_id))
         {
-            m_key_storage[i].taken = false;
+            /* Unlink the entry. Its next link is kept intact so that a lookup preempting
+             * the removal can still walk the rest of the chain. */
+            *p_link        = p_entry->next;
+            p_entry->taken = false;
             return NRF_802154_SECURITY_ERROR_NONE;
         }
+
+        p_link = &p_entry->next;
     }
 
     return NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND;
@@ -206,21 +290,83 @@ nrf_802154_security_error_t nrf_802154_security_pib_key_use(nrf_802154_key_id_t
     assert(destination != NULL);
     assert(p_id != NULL);
 
-    for (uint32_t i = 0; i < NRF_802154_SECURITY_KEY_STORAGE_SIZE; i++)
+    table_entry_t * p_entry = key_find(p_id);
+
+    if (p_entry != NULL)
+    {
+        memcpy((uint8_t *)destination, p_entry->key, sizeof(p_entry->key));
+        return NRF_802154_SECURITY_ERROR_NONE;
+    }
+
+    return NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND;
+}
+
+#if NRF_802154_SECURITY_FRAME_COUNTER_RESERVATION_ENABLED
+
+/**
+ * @brief Requests a new high-water mark if less than half of the reserved block remains.
+ *
+ * @param[in]  fc  Next global frame counter value to be used.
+ */
+static void fc_reservation_update(uint32_t fc)
+{
+    uint32_t requested;
+    uint32_t base;
+    uint32_t hwm;
+
+    do
     {
-        if (key_matches(&m_key_storage[i], p_id))
+        requested = m_fc_requested;
+
+        if ((requested > fc) && ((requested - fc) > (FC_RESERVATION_BLOCK_SIZE / 2)))
         {
-            memcpy((uint8_t *)destination, m_key_storage[i].key, sizeof(m_key_storage[i].key));
-            return NRF_802154_SECURITY_ERROR_NONE;
+            return;
+        }
+
+        base = (requested > fc) ? requested : fc;
+        hwm  = (base > (UINT32_MAX - FC_RESERVATION_BLOCK_SIZE)) ?
+               UINT32_MAX : (base + FC_RESERVATION_BLOCK_SIZE);
+
+        if (hwm == requested)
+        {
+            /* The frame counter space is exhausted. */
+            return;
         }
     }
+    while (!nrf_802154_sl_atomic_cas_u32((uint32_t *)&m_fc_requested, &requested, hwm));
 
-    return NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND;
+    nrf_802154_security_frame_counter_reservation_requested(hwm);
 }
 
+void nrf_802154_security_pib_global_frame_counter_reservation_confirm(uint32_t high_water_mark)
+{
+    uint32_t limit;
+
+    do
+    {
+        limit = m_fc_limit;
+
+        if (limit >= high_water_mark)
+        {
+            break;
+        }
+    }
+    while (!nrf_802154_sl_atomic_cas_u32((uint32_t *)&m_fc_limit, &limit, high_water_mark));
+}
+
+#endif // NRF_802154_SECURITY_FRAME_COUNTER_RESERVATION_ENABLED
+
 void nrf_802154_security_pib_global_frame_counter_set(uint32_t frame_counter)
 {
     m_global_frame_counter = frame_counter;
+
+#if NRF_802154_SECURITY_FRAME_COUNTER_RESERVATION_ENABLED
+    /* Values at and above the new frame counter are not persisted yet. */
+    m_fc_limit     = frame_counter;
+    m_fc_requested = frame_counter;
+
+    fc_reservation_update(frame_counter);
+#endif
 }
 
 void nrf_802154_security_pib_global_frame_counter_set_if_larger(uint32_t frame_counter)
@@ -238,6 +384,10 @@ void nrf_802154_security_pib_global_frame_counter_set_if_larger(uint32_t frame_c
 
     }
     while (!nrf_802154_sl_atomic_cas_u32(&m_global_frame_counter, &fc, frame_counter));
+
+#if NRF_802154_SECURITY_FRAME_COUNTER_RESERVATION_ENABLED
+    fc_reservation_update(m_global_frame_counter);
+#endif
 }
 
 nrf_802154_security_error_t nrf_802154_security_pib_frame_counter_get_next(
@@ -247,22 +397,19 @@ nrf_802154_security_error_t nrf_802154_security_pib_frame_counter_get_next(
     assert(p_frame_counter != NULL);
     assert(p_id != NULL);
 
-    uint32_t * p_frame_counter_to_use = NULL;
-    uint32_t   fc;
+    uint32_t      * p_frame_counter_to_use = NULL;
+    uint32_t        fc;
+    table_entry_t * p_entry                = key_find(p_id);
 
-    for (uint32_t i = 0; i < NRF_802154_SECURITY_KEY_STORAGE_SIZE; i++)
+    if (p_entry != NULL)
     {
-        if (key_matches(&m_key_storage[i], p_id))
+        if (p_entry->use_global_frame_counter)
         {
-            if (m_key_storage[i].use_global_frame_counter)
-            {
-                p_frame_counter_to_use = &m_global_frame_counter;
-            }
-            else
-            {
-                p_frame_counter_to_use = &m_key_storage[i].frame_counter;
-            }
-            break;
+            p_frame_counter_to_use = &m_global_frame_counter;
+        }
+        else
+        {
+            p_frame_counter_to_use = &p_entry->frame_counter;
         }
     }
 
@@ -281,10 +428,27 @@ nrf_802154_security_error_t nrf_802154_security_pib_frame_counter_get_next(
             __CLREX();
             return NRF_802154_SECURITY_ERROR_FRAME_COUNTER_OVERFLOW;
         }
+
+#if NRF_802154_SECURITY_FRAME_COUNTER_RESERVATION_ENABLED
+        if ((p_frame_counter_to_use == &m_global_frame_counter) && (fc >= m_fc_limit))
+        {
+            /* Using this value could repeat a frame counter after reset. */
+            __CLREX();
+            fc_reservation_update(fc);
+            return NRF_802154_SECURITY_ERROR_FRAME_COUNTER_OVERFLOW;
+        }
+#endif
     }
     while (__STREXW(fc + 1, p_frame_counter_to_use));
 
     *p_frame_counter = *p_frame_counter_to_use - 1;
 
+#if NRF_802154_SECURITY_FRAME_COUNTER_RESERVATION_ENABLED
+    if (p_frame_counter_to_use == &m_global_frame_counter)
+    {
+        fc_reservation_update(fc + 1);
+    }
+#endif
+
     return NRF_802154_SECURITY_ERROR_NONE;
 }
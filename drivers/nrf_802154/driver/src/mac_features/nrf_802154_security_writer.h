@@ -39,6 +39,7 @@
 #include <stdbool.h>
 
 #include "nrf_802154_types_internal.h"
+#include "mac_features/nrf_802154_frame_parser.h"
 
 /**
  * @brief Transmission setup hook for the security writer module.
@@ -52,6 +53,7 @@
  *
  * @param[in]  p_frame          Pointer to the buffer that contains the PHR and PSDU
  *                              of the transmitted frame.
+ * @param[in]  p_frame_data     Pointer to the parser data of @p p_frame.
  * @param[in]  p_params         Pointer to the transmission parameters.
  * @param[in]  notify_function  Function to be called to notify transmission failure.
  *
@@ -60,6 +62,7 @@
  */
 bool nrf_802154_security_writer_tx_setup(
     uint8_t                                 * p_frame,
+    const nrf_802154_frame_parser_data_t    * p_frame_data,
     nrf_802154_transmit_params_t            * p_params,
     nrf_802154_transmit_failed_notification_t notify_function);
 
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the sniffer frame ring of the 802.15.4 driver.
+ *
+ */
+
+#include "nrf_802154_sniffer_ring.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_nrfx_addons.h"
+#include "nrf_802154_types.h"
+#include "nrf_802154_utils.h"
+
+#if NRF_802154_SNIFFER_ENABLED
+
+#define RING_MASK (NRF_802154_SNIFFER_RING_SIZE - 1U) ///< Mask of indices of the ring.
+
+#if (NRF_802154_SNIFFER_RING_SIZE & RING_MASK) != 0U
+#error NRF_802154_SNIFFER_RING_SIZE must be a power of two
+#endif
+
+static uint8_t           m_ring[NRF_802154_SNIFFER_RING_SIZE]; ///< Storage of the frame records.
+static volatile uint32_t m_head;                               ///< Free-running write index.
+static volatile uint32_t m_tail;                               ///< Free-running read index.
+static volatile uint32_t m_lost;                               ///< Number of lost frames.
+static volatile bool     m_enabled;                            ///< If the sniffer mode is enabled.
+
+/**
+ * @brief Copies data to the ring, wrapping around its end.
+ *
+ * @param[in]  index   Free-running index of the ring to copy the data to.
+ * @param[in]  p_src   Pointer to the data to copy.
+ * @param[in]  length  Number of bytes to copy.
+ */
+static void ring_write(uint32_t index, const void * p_src, uint32_t length)
+{
+    uint32_t offset = index & RING_MASK;
+    uint32_t first  = NRF_802154_SNIFFER_RING_SIZE - offset;
+
+    if (first > length)
+    {
+        first = length;
+    }
+
+    memcpy(&m_ring[offset], p_src, first);
+    memcpy(m_ring, (const uint8_t *)p_src + first, length - first);
+}
+
+/**
+ * @brief Copies data from the ring, wrapping around its end.
+ *
+ * @param[in]   index   Free-running index of the ring to copy the data from.
+ * @param[out]  p_dst   Pointer to the buffer to copy the data to.
+ * @param[in]   length  Number of bytes to copy.
+ */
+static void ring_read(uint32_t index, void * p_dst, uint32_t length)
+{
+    uint32_t offset = index & RING_MASK;
+    uint32_t first  = NRF_802154_SNIFFER_RING_SIZE - offset;
+
+    if (first > length)
+    {
+        first = length;
+    }
+
+    memcpy(p_dst, &m_ring[offset], first);
+    memcpy((uint8_t *)p_dst + first, m_ring, length - first);
+}
+
+void nrf_802154_sniffer_ring_init(void)
+{
+    m_head    = 0U;
+    m_tail    = 0U;
+    m_lost    = 0U;
+    m_enabled = false;
+}
+
+void nrf_802154_sniffer_ring_set(bool enabled)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    if (enabled && !m_enabled)
+    {
+        m_head = 0U;
+        m_tail = 0U;
+        m_lost = 0U;
+    }
+
+    m_enabled = enabled;
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+bool nrf_802154_sniffer_ring_is_enabled(void)
+{
+    return m_enabled;
+}
+
+void nrf_802154_sniffer_ring_frame_store(const uint8_t * p_data,
+                                         int8_t          rssi,
+                                         uint8_t         lqi,
+                                         uint8_t         channel,
+                                         uint64_t        timestamp)
+{
+    nrf_802154_sniffer_record_t record;
+    uint32_t                    head = m_head;
+
+    record.timestamp = timestamp;
+    record.rssi      = rssi;
+    record.lqi       = lqi;
+    record.channel   = channel;
+    record.length    = (p_data[PHR_OFFSET] > FCS_SIZE) ? (p_data[PHR_OFFSET] - FCS_SIZE) : 0U;
+
+    uint32_t record_size = sizeof(record) + record.length;
+
+    if ((NRF_802154_SNIFFER_RING_SIZE - (head - m_tail)) < record_size)
+    {
+        m_lost++;
+        return;
+    }
+
+    ring_write(head, &record, sizeof(record));
+    ring_write(head + sizeof(record), &p_data[PSDU_OFFSET], record.length);
+
+    // Make sure the record is complete before the reader may see it.
+    __DMB();
+
+    m_head = head + record_size;
+}
+
+uint32_t nrf_802154_sniffer_ring_read(uint8_t * p_buffer, uint32_t size)
+{
+    uint32_t tail    = m_tail;
+    uint32_t head    = m_head;
+    uint32_t written = 0U;
+
+    // Make sure records are not read before the write index that publishes them.
+    __DMB();
+
+    while (tail != head)
+    {
+        nrf_802154_sniffer_record_t record;
+
+        ring_read(tail, &record, sizeof(record));
+
+        uint32_t record_size = sizeof(record) + record.length;
+
+        if ((size - written) < record_size)
+        {
+            break;
+        }
+
+        ring_read(tail, &p_buffer[written], record_size);
+
+        written += record_size;
+        tail    += record_size;
+    }
+
+    // Make sure the records are copied before the writer may overwrite them.
+    __DMB();
+
+    m_tail = tail;
+
+    return written;
+}
+
+uint32_t nrf_802154_sniffer_ring_lost_count_get(void)
+{
+    return m_lost;
+}
+
+#endif // NRF_802154_SNIFFER_ENABLED
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @defgroup nrf_802154_sniffer_ring Sniffer frame ring
+ * @{
+ * @ingroup nrf_802154
+ * @brief Ring of received frames captured in the sniffer mode of the 802.15.4 driver.
+ */
+
+#ifndef NRF_802154_SNIFFER_RING_H_
+#define NRF_802154_SNIFFER_RING_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Initializes the sniffer frame ring.
+ */
+void nrf_802154_sniffer_ring_init(void);
+
+/**
+ * @brief Enables or disables the sniffer mode.
+ *
+ * Enabling the sniffer mode discards the frames remaining in the ring and clears the counter
+ * of lost frames.
+ *
+ * @param[in]  enabled  If the sniffer mode is to be enabled.
+ */
+void nrf_802154_sniffer_ring_set(bool enabled);
+
+/**
+ * @brief Checks if the sniffer mode is enabled.
+ *
+ * @retval true   The sniffer mode is enabled.
+ * @retval false  The sniffer mode is disabled.
+ */
+bool nrf_802154_sniffer_ring_is_enabled(void);
+
+/**
+ * @brief Appends a received frame to the ring.
+ *
+ * This function is intended to be called by the core module only, and it is the only writer
+ * of the ring. If there is no room for the frame, the frame is counted as lost.
+ *
+ * @param[in]  p_data     Pointer to a buffer containing PHR and PSDU of the received frame.
+ * @param[in]  rssi       RSSI of the received frame in dBm.
+ * @param[in]  lqi        LQI of the received frame.
+ * @param[in]  channel    Channel on which the frame was received.
+ * @param[in]  timestamp  Timestamp of the end of the frame or @ref NRF_802154_NO_TIMESTAMP.
+ */
+void nrf_802154_sniffer_ring_frame_store(const uint8_t * p_data,
+                                         int8_t          rssi,
+                                         uint8_t         lqi,
+                                         uint8_t         channel,
+                                         uint64_t        timestamp);
+
+/**
+ * @brief Moves complete records from the ring to the given buffer.
+ *
+ * @param[out]  p_buffer  Pointer to the buffer to be filled with the records.
+ * @param[in]   size      Size of the buffer.
+ *
+ * @returns  Number of bytes written to @p p_buffer.
+ */
+uint32_t nrf_802154_sniffer_ring_read(uint8_t * p_buffer, uint32_t size);
+
+/**
+ * @brief Gets the number of frames that were lost because the ring was full.
+ *
+ * @returns  Number of lost frames.
+ */
+uint32_t nrf_802154_sniffer_ring_lost_count_get(void);
+
+/**
+ *@}
+ **/
+
+#endif // NRF_802154_SNIFFER_RING_H_
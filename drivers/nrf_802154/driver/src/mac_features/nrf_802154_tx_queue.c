@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the transmit queue feature of the 802.15.4 driver.
+ *
+ * The queue holds frames submitted by the higher layer and requests their transmissions one
+ * by one. The transmission of the next frame is requested as soon as the result of the previous
+ * one is delivered, so the frames are sent back-to-back. The interframe spacing between them is
+ * inserted by the Interframe Spacing feature, if enabled.
+ *
+ */
+
+#include "nrf_802154_tx_queue.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_notification.h"
+#include "nrf_802154_pib.h"
+#include "nrf_802154_request.h"
+#include "nrf_802154_tx_power.h"
+#include "nrf_802154_utils.h"
+
+#if NRF_802154_TX_QUEUE_ENABLED
+
+#if NRF_802154_TX_QUEUE_DEPTH < 1
+#error NRF_802154_TX_QUEUE_DEPTH must be at least 1
+#endif
+
+/**
+ * @brief Frame held by the transmit queue.
+ */
+typedef struct
+{
+    uint8_t                    * p_data; ///< Pointer to a buffer that contains PHR and PSDU of the frame.
+    nrf_802154_transmit_params_t params; ///< Transmission parameters of the frame.
+} tx_queue_entry_t;
+
+static tx_queue_entry_t m_entries[NRF_802154_TX_QUEUE_DEPTH]; ///< Frames held by the queue.
+static uint32_t         m_head;                               ///< Index of the oldest frame.
+static uint32_t         m_count;                              ///< Number of frames in the queue.
+static uint32_t         m_done_count;                         ///< Number of frames whose result was notified.
+static bool             m_in_flight;                          ///< Whether the oldest frame is handed over for transmission.
+static bool             m_rejected;                           ///< Whether the last transmit request was rejected.
+
+static inline uint32_t entry_index(uint32_t position)
+{
+    return (m_head + position) % NRF_802154_TX_QUEUE_DEPTH;
+}
+
+static void entry_transmit_failed_notify(tx_queue_entry_t * p_entry, nrf_802154_tx_error_t error)
+{
+    nrf_802154_transmit_done_metadata_t metadata = {};
+
+    metadata.frame_props = p_entry->params.frame_props;
+    nrf_802154_notify_transmit_failed(p_entry->p_data, error, &metadata);
+}
+
+static void tx_result_notify(bool result)
+{
+    if (!result)
+    {
+        m_rejected = true;
+    }
+}
+
+/**
+ * @brief Requests the transmission of the oldest frame in the queue.
+ *
+ * If the request is rejected before the frame is handed over to the core, the failure is
+ * notified here. Otherwise, the result is notified by the module that performs the transmission.
+ */
+static void head_transmit(void)
+{
+    tx_queue_entry_t entry      = m_entries[m_head];
+    uint32_t         done_count = m_done_count;
+
+    m_rejected = false;
+
+    (void)nrf_802154_request_transmit(NRF_802154_TERM_NONE,
+                                      REQ_ORIG_TX_QUEUE,
+                                      m_entries[m_head].p_data,
+                                      &m_entries[m_head].params,
+                                      tx_result_notify);
+
+    // A failed frame setup is notified by the core before the request returns, which
+    // removes the frame from the queue. Notify only the frames that were not reported yet.
+    if (m_rejected && (done_count == m_done_count))
+    {
+        entry_transmit_failed_notify(&entry, NRF_802154_TX_ERROR_TIMESLOT_DENIED);
+    }
+}
+
+/**
+ * @brief Notifies the frames waiting in the queue that they were aborted.
+ *
+ * The frame handed over for transmission is left in the queue. Its result is notified by
+ * the module that performs the transmission.
+ */
+static void queue_flush(void)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    uint32_t                        to_abort;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+    to_abort = m_count;
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    // Frames pushed while the aborted ones are notified are not affected.
+    for (uint32_t i = 0; i < to_abort; i++)
+    {
+        tx_queue_entry_t entry;
+        uint32_t         first;
+        bool             found = false;
+
+        nrf_802154_mcu_critical_enter(mcu_cs);
+
+        first = m_in_flight ? 1U : 0U;
+
+        if (m_count > first)
+        {
+            entry = m_entries[entry_index(first)];
+
+            for (uint32_t pos = first; (pos + 1U) < m_count; pos++)
+            {
+                m_entries[entry_index(pos)] = m_entries[entry_index(pos + 1U)];
+            }
+
+            m_count--;
+            found = true;
+        }
+
+        nrf_802154_mcu_critical_exit(mcu_cs);
+
+        if (!found)
+        {
+            break;
+        }
+
+        entry_transmit_failed_notify(&entry, NRF_802154_TX_ERROR_ABORTED);
+    }
+}
+
+void nrf_802154_tx_queue_init(void)
+{
+    m_head       = 0U;
+    m_count      = 0U;
+    m_done_count = 0U;
+    m_in_flight  = false;
+    m_rejected   = false;
+}
+
+void nrf_802154_tx_queue_deinit(void)
+{
+    m_count     = 0U;
+    m_in_flight = false;
+}
+
+bool nrf_802154_tx_queue_push(uint8_t                              * p_data,
+                              const nrf_802154_transmit_metadata_t * p_metadata)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    bool                            result = false;
+
+    tx_queue_entry_t entry =
+    {
+        .p_data = p_data,
+        .params =
+        {
+            .frame_props        = p_metadata->frame_props,
+            .tx_power           = {0},
+            .cca                = p_metadata->cca,
+            .immediate          = false,
+            .extra_cca_attempts = 0U,
+        },
+    };
+
+    (void)nrf_802154_tx_power_convert_metadata_to_tx_power_split(nrf_802154_pib_channel_get(),
+                                                                 p_metadata->tx_power,
+                                                                 &entry.params.tx_power);
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    if (m_count < NRF_802154_TX_QUEUE_DEPTH)
+    {
+        m_entries[entry_index(m_count)] = entry;
+        m_count++;
+        result = true;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    if (result)
+    {
+        nrf_802154_tx_queue_next_transmit();
+    }
+
+    return result;
+}
+
+void nrf_802154_tx_queue_transmit_done_hook(const uint8_t * p_frame)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    if (m_in_flight && (p_frame == m_entries[m_head].p_data))
+    {
+        m_head      = entry_index(1U);
+        m_in_flight = false;
+        m_count--;
+        m_done_count++;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_tx_queue_next_transmit(void)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    bool                            start = false;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    if (!m_in_flight && (m_count > 0U))
+    {
+        m_in_flight = true;
+        start       = true;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    if (start)
+    {
+        head_transmit();
+    }
+}
+
+bool nrf_802154_tx_queue_abort(nrf_802154_term_t term_lvl, req_originator_t req_orig)
+{
+    bool result = true;
+
+    if ((req_orig != REQ_ORIG_CORE) && (req_orig != REQ_ORIG_HIGHER_LAYER))
+    {
+        // The request does not originate from core or the higher layer. Ignore it.
+    }
+    else if (term_lvl >= NRF_802154_TERM_802154)
+    {
+        queue_flush();
+    }
+    else
+    {
+        // Frames waiting in the queue would be rejected by other operations.
+        result = (m_count == 0U);
+    }
+
+    return result;
+}
+
+#endif // NRF_802154_TX_QUEUE_ENABLED
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file contains declarations of the transmit queue feature of the 802.15.4 driver.
+ *
+ */
+
+#ifndef NRF_802154_TX_QUEUE_H
+#define NRF_802154_TX_QUEUE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_const.h"
+#include "nrf_802154_types_internal.h"
+
+/**
+ * @brief Initializes the transmit queue feature.
+ */
+void nrf_802154_tx_queue_init(void);
+
+/**
+ * @brief Deinitializes the transmit queue feature.
+ */
+void nrf_802154_tx_queue_deinit(void);
+
+/**
+ * @brief Adds a frame to the transmit queue.
+ *
+ * If the queue was empty, the transmission of the frame is requested immediately.
+ *
+ * @param[in]  p_data      Pointer to a buffer that contains PHR and PSDU of the frame.
+ * @param[in]  p_metadata  Pointer to metadata structure. Contains detailed properties of data
+ *                         to transmit.
+ *
+ * @retval  true   The frame was added to the queue.
+ * @retval  false  The queue is full.
+ */
+bool nrf_802154_tx_queue_push(uint8_t                              * p_data,
+                              const nrf_802154_transmit_metadata_t * p_metadata);
+
+/**
+ * @brief Removes the frame from the transmit queue once its transmission result is notified.
+ *
+ * This function is to be called in the context in which the transmission result is reported
+ * to the notification module.
+ *
+ * @param[in]  p_frame  Pointer to the buffer that contains the PHR and PSDU of the frame whose
+ *                      transmission has ended.
+ */
+void nrf_802154_tx_queue_transmit_done_hook(const uint8_t * p_frame);
+
+/**
+ * @brief Requests the transmission of the next frame from the queue, if there is any.
+ *
+ * This function is to be called after the transmission result is delivered to the higher layer.
+ */
+void nrf_802154_tx_queue_next_transmit(void);
+
+/**
+ * @brief Aborts the frames waiting in the transmit queue.
+ *
+ * The frame being transmitted is not affected. Its result is notified by the module that
+ * performs the transmission.
+ *
+ * @param[in]  term_lvl  Termination level set by the request to abort the ongoing operation.
+ * @param[in]  req_orig  Module that originates this request.
+ *
+ * @retval  true   The queued frames have been aborted or the queue was not active.
+ * @retval  false  The queue is active and the termination level is too low to abort it.
+ */
+bool nrf_802154_tx_queue_abort(nrf_802154_term_t term_lvl, req_originator_t req_orig);
+
+#endif // NRF_802154_TX_QUEUE_H
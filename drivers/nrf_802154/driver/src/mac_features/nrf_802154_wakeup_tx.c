@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the wake-up frame transmission feature of the 802.15.4 driver.
+ *
+ * A device that samples the channel periodically is woken up by a train of wake-up frames that
+ * lasts at least one of its sampling periods. The transmission of the next frame of the train is
+ * requested as soon as the previous one is transmitted, so the frames are sent back-to-back with
+ * only the radio ramp-up between them. The interframe spacing between them is inserted by the
+ * Interframe Spacing feature, if enabled. The Rendezvous Time IE of each frame is updated by
+ * the IE writer to point at the end of the train, where the announced frame is expected.
+ *
+ */
+
+#include "nrf_802154_wakeup_tx.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "mac_features/nrf_802154_ie_writer.h"
+#include "nrf_802154_config.h"
+#include "nrf_802154_pib.h"
+#include "nrf_802154_procedures_duration.h"
+#include "nrf_802154_request.h"
+#include "nrf_802154_sl_timer.h"
+#include "nrf_802154_tx_power.h"
+
+#if NRF_802154_WAKEUP_TX_ENABLED
+
+#if !NRF_802154_IE_WRITER_ENABLED
+#error NRF_802154_WAKEUP_TX_ENABLED requires NRF_802154_IE_WRITER_ENABLED
+#endif
+
+#define RENDEZVOUS_US_PER_UNIT (IE_RENDEZVOUS_SYMBOLS_PER_UNIT * PHY_US_PER_SYMBOL)
+
+static uint8_t                    * mp_data;    ///< Pointer to a buffer that contains PHR and PSDU of the wake-up frame.
+static nrf_802154_transmit_params_t m_params;   ///< Transmission parameters of the wake-up frames.
+static uint64_t                     m_end_time; ///< Time at which the train ends, in microseconds.
+static volatile bool                m_active;   ///< Whether the train is running.
+
+static bool frame_transmit(void)
+{
+    return nrf_802154_request_transmit(NRF_802154_TERM_NONE,
+                                       REQ_ORIG_WAKEUP_TX,
+                                       mp_data,
+                                       &m_params,
+                                       NULL);
+}
+
+static void train_stop(void)
+{
+    m_active = false;
+    nrf_802154_ie_writer_rendezvous_time_clear();
+}
+
+/**
+ * @brief Checks if the next frame of the train ends before the train does.
+ */
+static bool next_frame_fits(void)
+{
+    uint64_t next_end = nrf_802154_sl_timer_current_time_get() + TX_RAMP_UP_TIME +
+                        nrf_802154_frame_duration_get(mp_data[PHR_OFFSET], true, true);
+
+    return next_end <= m_end_time;
+}
+
+void nrf_802154_wakeup_tx_init(void)
+{
+    mp_data  = NULL;
+    m_active = false;
+}
+
+void nrf_802154_wakeup_tx_deinit(void)
+{
+    train_stop();
+}
+
+bool nrf_802154_wakeup_tx_start(uint8_t                              * p_data,
+                                const nrf_802154_transmit_metadata_t * p_metadata,
+                                uint32_t                               duration_us)
+{
+    bool result;
+
+    if (m_active)
+    {
+        // Only one train can run at a time.
+        return false;
+    }
+
+    if ((p_data[ACK_REQUEST_OFFSET] & ACK_REQUEST_BIT) != 0U)
+    {
+        // Wake-up frames are not acknowledged.
+        return false;
+    }
+
+    if (duration_us > (IE_RENDEZVOUS_TIME_MAX * RENDEZVOUS_US_PER_UNIT))
+    {
+        // The end of the train could not be announced in the Rendezvous Time IE.
+        return false;
+    }
+
+    mp_data  = p_data;
+    m_params = (nrf_802154_transmit_params_t)
+    {
+        .frame_props        = p_metadata->frame_props,
+        .tx_power           = {0},
+        .cca                = p_metadata->cca,
+        .immediate          = false,
+        .extra_cca_attempts = 0U,
+    };
+
+    (void)nrf_802154_tx_power_convert_metadata_to_tx_power_split(nrf_802154_pib_channel_get(),
+                                                                 p_metadata->tx_power,
+                                                                 &m_params.tx_power);
+
+    m_end_time = nrf_802154_sl_timer_current_time_get() + duration_us;
+    m_active   = true;
+
+    nrf_802154_ie_writer_rendezvous_time_set(m_end_time);
+
+    result = frame_transmit();
+
+    if (!result && m_active)
+    {
+        train_stop();
+    }
+
+    return result;
+}
+
+bool nrf_802154_wakeup_tx_abort(nrf_802154_term_t term_lvl, req_originator_t req_orig)
+{
+    bool result = true;
+
+    if ((req_orig != REQ_ORIG_CORE) && (req_orig != REQ_ORIG_HIGHER_LAYER))
+    {
+        // The request does not originate from core or the higher layer. Ignore it.
+    }
+    else if (term_lvl >= NRF_802154_TERM_802154)
+    {
+        // The frame in flight is notified as aborted by the core.
+        train_stop();
+    }
+    else
+    {
+        result = !m_active;
+    }
+
+    return result;
+}
+
+bool nrf_802154_wakeup_tx_transmitted_hook(const uint8_t * p_frame)
+{
+    if (!m_active || (p_frame != mp_data))
+    {
+        return true;
+    }
+
+    if (!next_frame_fits())
+    {
+        // The last frame of the train is notified to the higher layer.
+        train_stop();
+        return true;
+    }
+
+    // The channel is already held by the train.
+    m_params.cca = false;
+
+    if (frame_transmit())
+    {
+        return false;
+    }
+
+    // A failed frame setup is notified by the core before the request returns, which stops
+    // the train. Otherwise, the frame just transmitted is notified as the last one.
+    if (m_active)
+    {
+        train_stop();
+        return true;
+    }
+
+    return false;
+}
+
+bool nrf_802154_wakeup_tx_tx_failed_hook(uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    (void)error;
+
+    if (m_active && (p_frame == mp_data))
+    {
+        train_stop();
+    }
+
+    return true;
+}
+
+#endif // NRF_802154_WAKEUP_TX_ENABLED
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file contains declarations of the wake-up frame transmission feature of the 802.15.4
+ *   driver.
+ *
+ */
+
+#ifndef NRF_802154_WAKEUP_TX_H
+#define NRF_802154_WAKEUP_TX_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_const.h"
+#include "nrf_802154_types_internal.h"
+
+/**
+ * @brief Initializes the wake-up frame transmission feature.
+ */
+void nrf_802154_wakeup_tx_init(void);
+
+/**
+ * @brief Deinitializes the wake-up frame transmission feature.
+ */
+void nrf_802154_wakeup_tx_deinit(void);
+
+/**
+ * @brief Starts the transmission of a train of wake-up frames.
+ *
+ * @param[in]  p_data       Pointer to a buffer that contains PHR and PSDU of the wake-up frame.
+ * @param[in]  p_metadata   Pointer to metadata structure. Contains detailed properties of data
+ *                          to transmit.
+ * @param[in]  duration_us  Duration of the train in microseconds.
+ *
+ * @retval  true   The transmission of the first frame of the train was requested.
+ * @retval  false  The train could not be started.
+ */
+bool nrf_802154_wakeup_tx_start(uint8_t                              * p_data,
+                                const nrf_802154_transmit_metadata_t * p_metadata,
+                                uint32_t                               duration_us);
+
+/**
+ * @brief Aborts the wake-up frame train.
+ *
+ * @param[in]  term_lvl  Termination level set by the request to abort the ongoing operation.
+ * @param[in]  req_orig  Module that originates this request.
+ *
+ * @retval  true   The train is stopped or it is not running.
+ * @retval  false  The train cannot be stopped due to a too low termination level.
+ */
+bool nrf_802154_wakeup_tx_abort(nrf_802154_term_t term_lvl, req_originator_t req_orig);
+
+/**
+ * @brief Handles a transmitted event.
+ *
+ * If the transmitted frame belongs to the train and there is enough time left, the transmission
+ * of the next frame of the train is requested.
+ *
+ * @param[in]  p_frame  Pointer to the buffer that contains the PHR and PSDU of the transmitted
+ *                      frame.
+ *
+ * @retval  true   The transmitted event is to be propagated to the MAC layer.
+ * @retval  false  The train continues. The transmitted event is not to be propagated.
+ */
+bool nrf_802154_wakeup_tx_transmitted_hook(const uint8_t * p_frame);
+
+/**
+ * @brief Handles a TX failed event.
+ *
+ * @param[in]  p_frame  Pointer to the buffer that contains the PHR and PSDU of the frame that
+ *                      was not transmitted.
+ * @param[in]  error    Cause of the failed transmission.
+ *
+ * @retval  true  Always succeeds.
+ */
+bool nrf_802154_wakeup_tx_tx_failed_hook(uint8_t * p_frame, nrf_802154_tx_error_t error);
+
+#endif // NRF_802154_WAKEUP_TX_H
@@ -57,9 +57,12 @@
 #include "nrf_802154_notification.h"
 #include "nrf_802154_pib.h"
 #include "nrf_802154_request.h"
+#include "nrf_802154_rssi.h"
 #include "nrf_802154_rx_buffer.h"
 #include "nrf_802154_tx_power.h"
 #include "nrf_802154_stats.h"
+#include "nrf_802154_trace.h"
+#include "nrf_802154_trx_capture.h"
 #include "hal/nrf_radio.h"
 #include "platform/nrf_802154_clock.h"
 #include "platform/nrf_802154_random.h"
@@ -69,10 +72,22 @@
 #include "timer/nrf_802154_timer_coord.h"
 
 #include "mac_features/nrf_802154_ack_timeout.h"
+#include "mac_features/nrf_802154_ant_div_peer.h"
+#include "mac_features/nrf_802154_beacon_tx.h"
+#include "mac_features/nrf_802154_cca_adaptive.h"
+#include "mac_features/nrf_802154_csl_receiver.h"
+#include "mac_features/nrf_802154_csma_ca.h"
 #include "mac_features/nrf_802154_delayed_trx.h"
 #include "mac_features/nrf_802154_ie_writer.h"
 #include "mac_features/nrf_802154_ifs.h"
+#include "mac_features/nrf_802154_lm_series.h"
+#include "mac_features/nrf_802154_noise_floor.h"
 #include "mac_features/nrf_802154_security_pib.h"
+#include "mac_features/nrf_802154_sniffer_ring.h"
+#include "mac_features/nrf_802154_ed_ring.h"
+#include "mac_features/nrf_802154_tx_queue.h"
+#include "mac_features/nrf_802154_indirect_tx.h"
+#include "mac_features/nrf_802154_wakeup_tx.h"
 #include "mac_features/ack_generator/nrf_802154_ack_data.h"
 
 #include "nrf_802154_sl_ant_div.h"
@@ -154,9 +169,38 @@ uint8_t nrf_802154_channel_get(void)
     return nrf_802154_pib_channel_get();
 }
 
+#if NRF_802154_DUAL_CHANNEL_RX_ENABLED
+
+bool nrf_802154_dual_channel_rx_set(uint8_t channel)
+{
+    if ((channel != 0U) && ((channel < 11U) || (channel > 26U)))
+    {
+        return false;
+    }
+
+    bool changed = nrf_802154_pib_dual_rx_channel_get() != channel;
+
+    nrf_802154_pib_dual_rx_channel_set(channel);
+
+    if (changed)
+    {
+        (void)nrf_802154_request_channel_update(REQ_ORIG_HIGHER_LAYER);
+    }
+
+    return true;
+}
+
+uint8_t nrf_802154_dual_channel_rx_get(void)
+{
+    return nrf_802154_pib_dual_rx_channel_get();
+}
+
+#endif
+
 void nrf_802154_tx_power_set(int8_t power)
 {
     nrf_802154_pib_tx_power_set(power);
+    nrf_802154_tx_power_split_cache_clear();
 }
 
 int8_t nrf_802154_tx_power_get(void)
@@ -166,6 +210,15 @@ int8_t nrf_802154_tx_power_get(void)
     return nrf_802154_tx_power_split_pib_power_get(&split_power);
 }
 
+#if NRF_802154_TX_POWER_SPLIT_CACHE_ENABLED
+
+void nrf_802154_tx_power_split_cache_invalidate(void)
+{
+    nrf_802154_tx_power_split_cache_clear();
+}
+
+#endif
+
 bool nrf_802154_coex_rx_request_mode_set(nrf_802154_coex_rx_request_mode_t mode)
 {
     return nrf_802154_pib_coex_rx_request_mode_set(mode);
@@ -188,6 +241,7 @@ nrf_802154_coex_tx_request_mode_t nrf_802154_coex_tx_request_mode_get(void)
 
 void nrf_802154_temperature_changed(void)
 {
+    nrf_802154_rssi_temperature_changed();
     nrf_802154_request_cca_cfg_update();
 }
 
@@ -206,6 +260,25 @@ void nrf_802154_short_address_set(const uint8_t * p_short_address)
     nrf_802154_pib_short_address_set(p_short_address);
 }
 
+#if NRF_802154_SECONDARY_IDENTITIES > 0
+bool nrf_802154_secondary_identity_set(uint8_t         index,
+                                       const uint8_t * p_pan_id,
+                                       const uint8_t * p_short_address,
+                                       const uint8_t * p_extended_addr)
+{
+    return nrf_802154_pib_secondary_identity_set(index,
+                                                 p_pan_id,
+                                                 p_short_address,
+                                                 p_extended_addr);
+}
+
+bool nrf_802154_secondary_identity_clear(uint8_t index)
+{
+    return nrf_802154_pib_secondary_identity_clear(index);
+}
+
+#endif // NRF_802154_SECONDARY_IDENTITIES > 0
+
 void nrf_802154_init(void)
 {
     static const nrf_802154_sl_crit_sect_interface_t crit_sect_int =
@@ -229,17 +302,62 @@ void nrf_802154_init(void)
     nrf_802154_rsch_crit_sect_init();
     nrf_802154_rsch_init();
     nrf_802154_rx_buffer_init();
+    nrf_802154_stats_init();
+    nrf_802154_tx_power_split_cache_init();
     nrf_802154_temperature_init();
+    nrf_802154_rssi_temperature_changed();
     nrf_802154_timer_coord_init();
+#if NRF_802154_TRACE_ENABLED
+    nrf_802154_trace_init();
+#endif
+#if NRF_802154_TRX_CAPTURE_ENABLED
+    nrf_802154_trx_capture_init();
+#endif
 #if NRF_802154_ACK_TIMEOUT_ENABLED
     nrf_802154_ack_timeout_init();
 #endif
+#if NRF_802154_CSMA_CA_ENABLED
+    nrf_802154_csma_ca_init();
+#endif
 #if NRF_802154_DELAYED_TRX_ENABLED
     nrf_802154_delayed_trx_init();
 #endif
 #if NRF_802154_IFS_ENABLED
     nrf_802154_ifs_init();
 #endif
+#if NRF_802154_ANT_DIV_PEER_TABLE_ENABLED
+    nrf_802154_ant_div_peer_init();
+#endif
+#if NRF_802154_LINK_METRICS_SERIES_ENABLED
+    nrf_802154_lm_series_init();
+#endif
+#if NRF_802154_NOISE_FLOOR_ENABLED
+    nrf_802154_noise_floor_init();
+#endif
+#if NRF_802154_CCA_ADAPTIVE_ENABLED
+    nrf_802154_cca_adaptive_init();
+#endif
+#if NRF_802154_SNIFFER_ENABLED
+    nrf_802154_sniffer_ring_init();
+#endif
+#if NRF_802154_ED_RING_ENABLED
+    nrf_802154_ed_ring_init();
+#endif
+#if NRF_802154_TX_QUEUE_ENABLED
+    nrf_802154_tx_queue_init();
+#endif
+#if NRF_802154_INDIRECT_TX_ENABLED
+    nrf_802154_indirect_tx_init();
+#endif
+#if NRF_802154_WAKEUP_TX_ENABLED
+    nrf_802154_wakeup_tx_init();
+#endif
+#if NRF_802154_CSL_RECEIVER_ENABLED
+    nrf_802154_csl_receiver_init();
+#endif
+#if NRF_802154_BEACON_TX_ENABLED
+    nrf_802154_beacon_tx_init();
+#endif
 }
 
 void nrf_802154_deinit(void)
@@ -255,12 +373,30 @@ void nrf_802154_deinit(void)
 #if NRF_802154_ACK_TIMEOUT_ENABLED
     nrf_802154_ack_timeout_deinit();
 #endif
+#if NRF_802154_CSMA_CA_ENABLED
+    nrf_802154_csma_ca_deinit();
+#endif
 #if NRF_802154_DELAYED_TRX_ENABLED
     nrf_802154_delayed_trx_deinit();
 #endif
 #if NRF_802154_IFS_ENABLED
     nrf_802154_ifs_deinit();
 #endif
+#if NRF_802154_TX_QUEUE_ENABLED
+    nrf_802154_tx_queue_deinit();
+#endif
+#if NRF_802154_INDIRECT_TX_ENABLED
+    nrf_802154_indirect_tx_deinit();
+#endif
+#if NRF_802154_WAKEUP_TX_ENABLED
+    nrf_802154_wakeup_tx_deinit();
+#endif
+#if NRF_802154_CSL_RECEIVER_ENABLED
+    nrf_802154_csl_receiver_deinit();
+#endif
+#if NRF_802154_BEACON_TX_ENABLED
+    nrf_802154_beacon_tx_deinit();
+#endif
 }
 
 bool nrf_802154_antenna_diversity_rx_mode_set(nrf_802154_sl_ant_div_mode_t mode)
@@ -626,6 +762,54 @@ bool nrf_802154_receive_at_cancel(uint32_t id)
     return result;
 }
 
+#if NRF_802154_DELAYED_TRX_TIMELINE_ENABLED
+
+bool nrf_802154_timeline_schedule(const nrf_802154_timeline_op_t * p_ops, uint32_t ops_count)
+{
+    bool result = true;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    for (uint32_t i = 0; result && (i < ops_count); i++)
+    {
+        switch (p_ops[i].type)
+        {
+            case NRF_802154_TIMELINE_OP_TX:
+                result = are_frame_properties_valid(&p_ops[i].data.tx.metadata.frame_props) &&
+                         are_extra_cca_attempts_valid(&p_ops[i].data.tx.metadata);
+                break;
+
+            case NRF_802154_TIMELINE_OP_RX:
+                break;
+
+            default:
+                result = false;
+        }
+    }
+
+    if (result)
+    {
+        result = nrf_802154_request_timeline_schedule(p_ops, ops_count);
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+bool nrf_802154_timeline_clear(void)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_request_timeline_clear();
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+#endif // NRF_802154_DELAYED_TRX_TIMELINE_ENABLED
+
 #endif // NRF_802154_DELAYED_TRX_ENABLED
 
 bool nrf_802154_energy_detection(uint32_t time_us)
@@ -640,6 +824,37 @@ bool nrf_802154_energy_detection(uint32_t time_us)
     return result;
 }
 
+bool nrf_802154_energy_scan(uint32_t channel_mask, uint32_t dwell_time_us)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_request_energy_scan(NRF_802154_TERM_NONE, channel_mask, dwell_time_us);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+#if NRF_802154_ED_RING_ENABLED
+
+void nrf_802154_energy_detection_ring_set(bool enabled)
+{
+    nrf_802154_ed_ring_set(enabled);
+}
+
+uint32_t nrf_802154_energy_detection_ring_read(nrf_802154_ed_sample_t * p_samples, uint32_t count)
+{
+    return nrf_802154_ed_ring_read(p_samples, count);
+}
+
+uint32_t nrf_802154_energy_detection_ring_lost_count_get(void)
+{
+    return nrf_802154_ed_ring_lost_count_get();
+}
+
+#endif
+
 bool nrf_802154_cca(void)
 {
     bool result;
@@ -691,7 +906,7 @@ void nrf_802154_buffer_free_raw(uint8_t * p_data)
     bool          result;
     rx_buffer_t * p_buffer = (rx_buffer_t *)p_data;
 
-    assert(p_buffer->free == false);
+    assert(!nrf_802154_rx_buffer_is_free(p_buffer));
     (void)p_buffer;
 
     result = nrf_802154_request_buffer_free(p_data);
@@ -708,7 +923,7 @@ bool nrf_802154_buffer_free_immediately_raw(uint8_t * p_data)
     bool          result;
     rx_buffer_t * p_buffer = (rx_buffer_t *)p_data;
 
-    assert(p_buffer->free == false);
+    assert(!nrf_802154_rx_buffer_is_free(p_buffer));
     (void)p_buffer;
 
     result = nrf_802154_request_buffer_free(p_data);
@@ -726,7 +941,7 @@ void nrf_802154_buffer_free(uint8_t * p_data)
     bool          result;
     rx_buffer_t * p_buffer = (rx_buffer_t *)(p_data - RAW_PAYLOAD_OFFSET);
 
-    assert(p_buffer->free == false);
+    assert(!nrf_802154_rx_buffer_is_free(p_buffer));
     (void)p_buffer;
 
     result = nrf_802154_request_buffer_free(p_data - RAW_PAYLOAD_OFFSET);
@@ -743,7 +958,7 @@ bool nrf_802154_buffer_free_immediately(uint8_t * p_data)
     bool          result;
     rx_buffer_t * p_buffer = (rx_buffer_t *)(p_data - RAW_PAYLOAD_OFFSET);
 
-    assert(p_buffer->free == false);
+    assert(!nrf_802154_rx_buffer_is_free(p_buffer));
     (void)p_buffer;
 
     result = nrf_802154_request_buffer_free(p_data - RAW_PAYLOAD_OFFSET);
@@ -781,6 +996,25 @@ void nrf_802154_promiscuous_set(bool enabled)
     nrf_802154_pib_promiscuous_set(enabled);
 }
 
+#if NRF_802154_SNIFFER_ENABLED
+
+void nrf_802154_sniffer_set(bool enabled)
+{
+    nrf_802154_sniffer_ring_set(enabled);
+}
+
+uint32_t nrf_802154_sniffer_read(uint8_t * p_buffer, uint32_t size)
+{
+    return nrf_802154_sniffer_ring_read(p_buffer, size);
+}
+
+uint32_t nrf_802154_sniffer_lost_count_get(void)
+{
+    return nrf_802154_sniffer_ring_lost_count_get();
+}
+
+#endif
+
 void nrf_802154_auto_ack_set(bool enabled)
 {
     nrf_802154_pib_auto_ack_set(enabled);
@@ -841,6 +1075,60 @@ bool nrf_802154_pending_bit_for_addr_clear(const uint8_t * p_addr, bool extended
     return nrf_802154_ack_data_for_addr_clear(p_addr, extended, NRF_802154_ACK_DATA_PENDING_BIT);
 }
 
+uint32_t nrf_802154_pending_bit_for_addr_set_batch(const uint8_t * p_addrs,
+                                                   uint32_t        count,
+                                                   bool            extended)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    uint8_t                         addr_size = extended ? EXTENDED_ADDRESS_SIZE :
+                                                SHORT_ADDRESS_SIZE;
+    uint32_t                        result = 0;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (nrf_802154_ack_data_for_addr_set(&p_addrs[i * addr_size],
+                                             extended,
+                                             NRF_802154_ACK_DATA_PENDING_BIT,
+                                             NULL,
+                                             0))
+        {
+            result++;
+        }
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+uint32_t nrf_802154_pending_bit_for_addr_clear_batch(const uint8_t * p_addrs,
+                                                     uint32_t        count,
+                                                     bool            extended)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    uint8_t                         addr_size = extended ? EXTENDED_ADDRESS_SIZE :
+                                                SHORT_ADDRESS_SIZE;
+    uint32_t                        result = 0;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (nrf_802154_ack_data_for_addr_clear(&p_addrs[i * addr_size],
+                                               extended,
+                                               NRF_802154_ACK_DATA_PENDING_BIT))
+        {
+            result++;
+        }
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
 void nrf_802154_pending_bit_for_addr_reset(bool extended)
 {
     nrf_802154_ack_data_reset(extended, NRF_802154_ACK_DATA_PENDING_BIT);
@@ -953,6 +1241,16 @@ uint8_t nrf_802154_csma_ca_max_backoffs_get(void)
     return nrf_802154_pib_csmaca_max_backoffs_get();
 }
 
+bool nrf_802154_csma_ca_max_frame_retries_set(uint8_t max_frame_retries)
+{
+    return nrf_802154_pib_csmaca_max_frame_retries_set(max_frame_retries);
+}
+
+uint8_t nrf_802154_csma_ca_max_frame_retries_get(void)
+{
+    return nrf_802154_pib_csmaca_max_frame_retries_get();
+}
+
 #endif // NRF_802154_CSMA_CA_ENABLED
 
 #if NRF_802154_ACK_TIMEOUT_ENABLED
@@ -998,6 +1296,118 @@ void nrf_802154_ifs_min_lifs_period_set(uint16_t period)
 
 #endif // NRF_802154_IFS_ENABLED
 
+#if NRF_802154_TX_QUEUE_ENABLED && NRF_802154_USE_RAW_API
+
+bool nrf_802154_transmit_raw_queued(uint8_t                              * p_data,
+                                    const nrf_802154_transmit_metadata_t * p_metadata)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    if (p_metadata == NULL)
+    {
+        static const nrf_802154_transmit_metadata_t metadata_default =
+        {
+            .frame_props = NRF_802154_TRANSMITTED_FRAME_PROPS_DEFAULT_INIT,
+            .cca         = true,
+            .tx_power    = {.use_metadata_value = false}
+        };
+
+        p_metadata = &metadata_default;
+    }
+
+    result = are_frame_properties_valid(&p_metadata->frame_props);
+    if (result)
+    {
+        result = nrf_802154_request_tx_queue_push(p_data, p_metadata);
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+#endif // NRF_802154_TX_QUEUE_ENABLED && NRF_802154_USE_RAW_API
+
+#if NRF_802154_INDIRECT_TX_ENABLED && NRF_802154_USE_RAW_API
+
+bool nrf_802154_transmit_raw_indirect(uint8_t                              * p_data,
+                                      const nrf_802154_transmit_metadata_t * p_metadata)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    if (p_metadata == NULL)
+    {
+        static const nrf_802154_transmit_metadata_t metadata_default =
+        {
+            .frame_props = NRF_802154_TRANSMITTED_FRAME_PROPS_DEFAULT_INIT,
+            .cca         = true,
+            .tx_power    = {.use_metadata_value = false}
+        };
+
+        p_metadata = &metadata_default;
+    }
+
+    result = are_frame_properties_valid(&p_metadata->frame_props);
+    if (result)
+    {
+        result = nrf_802154_request_indirect_tx_push(p_data, p_metadata);
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+bool nrf_802154_transmit_raw_indirect_cancel(const uint8_t * p_data)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_request_indirect_tx_cancel(p_data);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+#endif // NRF_802154_INDIRECT_TX_ENABLED && NRF_802154_USE_RAW_API
+
+#if NRF_802154_WAKEUP_TX_ENABLED && NRF_802154_USE_RAW_API
+
+bool nrf_802154_transmit_raw_wakeup_train(uint8_t                              * p_data,
+                                          const nrf_802154_transmit_metadata_t * p_metadata,
+                                          uint32_t                               duration_us)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    if (p_metadata == NULL)
+    {
+        static const nrf_802154_transmit_metadata_t metadata_default =
+        {
+            .frame_props = NRF_802154_TRANSMITTED_FRAME_PROPS_DEFAULT_INIT,
+            .cca         = true,
+            .tx_power    = {.use_metadata_value = false}
+        };
+
+        p_metadata = &metadata_default;
+    }
+
+    result = are_frame_properties_valid(&p_metadata->frame_props);
+    if (result)
+    {
+        result = nrf_802154_request_wakeup_tx_start(p_data, p_metadata, duration_us);
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+#endif // NRF_802154_WAKEUP_TX_ENABLED && NRF_802154_USE_RAW_API
+
 nrf_802154_capabilities_t nrf_802154_capabilities_get(void)
 {
     nrf_802154_capabilities_t    caps_drv = 0UL;
@@ -1056,6 +1466,14 @@ void nrf_802154_security_global_frame_counter_set_if_larger(uint32_t frame_count
     nrf_802154_security_pib_global_frame_counter_set_if_larger(frame_counter);
 }
 
+#if NRF_802154_SECURITY_FRAME_COUNTER_RESERVATION_ENABLED
+void nrf_802154_security_global_frame_counter_reservation_confirm(uint32_t high_water_mark)
+{
+    nrf_802154_security_pib_global_frame_counter_reservation_confirm(high_water_mark);
+}
+
+#endif
+
 nrf_802154_security_error_t nrf_802154_security_key_store(nrf_802154_key_t * p_key)
 {
     return nrf_802154_security_pib_key_store(p_key);
@@ -1080,6 +1498,100 @@ void nrf_802154_csl_writer_anchor_time_set(uint64_t anchor_time)
 
 #endif
 
+#if NRF_802154_LINK_METRICS_SERIES_ENABLED
+
+bool nrf_802154_link_metrics_series_configure(uint8_t                     series_id,
+                                              const uint8_t             * p_addr,
+                                              bool                        extended,
+                                              nrf_802154_lm_frame_types_t frame_types)
+{
+    return nrf_802154_lm_series_configure(series_id, p_addr, extended, frame_types);
+}
+
+bool nrf_802154_link_metrics_series_get(uint8_t series_id, nrf_802154_lm_series_t * p_series)
+{
+    return nrf_802154_lm_series_get(series_id, p_series);
+}
+
+#endif
+
+#if NRF_802154_NOISE_FLOOR_ENABLED
+
+bool nrf_802154_channel_noise_floor_get(uint8_t channel, int8_t * p_noise_floor)
+{
+    return nrf_802154_noise_floor_get(channel, p_noise_floor);
+}
+
+void nrf_802154_channel_noise_floor_reset(void)
+{
+    nrf_802154_noise_floor_reset();
+}
+
+#endif
+
+#if NRF_802154_CCA_ADAPTIVE_ENABLED
+
+bool nrf_802154_cca_adaptive_threshold_dbm_get(uint8_t channel, int8_t * p_threshold_dbm)
+{
+    return nrf_802154_cca_adaptive_threshold_get(channel, p_threshold_dbm);
+}
+
+#endif
+
+#if NRF_802154_CSL_RECEIVER_ENABLED
+
+bool nrf_802154_csl_receiver_start(uint16_t period,
+                                   uint64_t anchor_time,
+                                   uint32_t window_duration,
+                                   uint8_t  channel)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_csl_receiver_module_start(period, anchor_time, window_duration, channel);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+void nrf_802154_csl_receiver_stop(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    nrf_802154_csl_receiver_module_stop();
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
+#endif // NRF_802154_CSL_RECEIVER_ENABLED
+
+#if NRF_802154_BEACON_TX_ENABLED
+
+bool nrf_802154_beacon_tx_start(const uint8_t                       * p_template,
+                                const nrf_802154_beacon_tx_config_t * p_config)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_beacon_tx_module_start(p_template, p_config);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+void nrf_802154_beacon_tx_stop(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    nrf_802154_beacon_tx_module_stop();
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
+#endif // NRF_802154_BEACON_TX_ENABLED
+
 __WEAK void nrf_802154_custom_part_of_radio_init(void)
 {
     // Intentionally empty
@@ -1091,6 +1603,16 @@ __WEAK void nrf_802154_tx_ack_started(const uint8_t * p_data)
 }
 
 #if NRF_802154_USE_RAW_API
+#if NRF_802154_RX_METADATA_ENABLED
+
+__WEAK void nrf_802154_received_ext(uint8_t                              * p_data,
+                                    const nrf_802154_received_metadata_t * p_metadata)
+{
+    nrf_802154_received_raw(p_data, p_metadata->rssi, p_metadata->lqi);
+}
+
+#endif // NRF_802154_RX_METADATA_ENABLED
+
 __WEAK void nrf_802154_received_raw(uint8_t * p_data, int8_t power, uint8_t lqi)
 {
     uint64_t timestamp;
@@ -1149,6 +1671,16 @@ __WEAK void nrf_802154_tx_started(const uint8_t * p_frame)
     (void)p_frame;
 }
 
+#if NRF_802154_RX_HEADER_NOTIFY_ENABLED
+__WEAK void nrf_802154_rx_header_received(const uint8_t                * p_data,
+                                          const nrf_802154_rx_header_t * p_header)
+{
+    (void)p_data;
+    (void)p_header;
+}
+
+#endif
+
 #if NRF_802154_USE_RAW_API
 __WEAK void nrf_802154_transmitted_raw(uint8_t                                   * p_frame,
                                        const nrf_802154_transmit_done_metadata_t * p_metadata)
@@ -1209,6 +1741,11 @@ __WEAK void nrf_802154_energy_detection_failed(nrf_802154_ed_error_t error)
     (void)error;
 }
 
+__WEAK void nrf_802154_energy_scan_done(const nrf_802154_energy_scan_result_t * p_result)
+{
+    (void)p_result;
+}
+
 __WEAK void nrf_802154_cca_done(bool channel_free)
 {
     (void)channel_free;
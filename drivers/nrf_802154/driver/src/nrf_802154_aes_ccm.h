@@ -38,6 +38,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 
 #ifdef __cplusplus
@@ -96,4 +97,36 @@ void nrf_802154_aes_ccm_transform_start(uint8_t * p_frame);
  */
 void nrf_802154_aes_ccm_transform_abort(uint8_t * p_frame);
 
+#if NRF_802154_RX_DECRYPTION_ENABLED
+
+/**
+ * @brief Results of AES-CCM* inverse transformation.
+ */
+typedef enum
+{
+    NRF_802154_AES_CCM_INVERSE_VERIFIED,    ///< The MIC matches and the plaintext was written.
+    NRF_802154_AES_CCM_INVERSE_AUTH_FAILED, ///< The MIC does not match.
+    NRF_802154_AES_CCM_INVERSE_BUSY,        ///< The accelerator is needed for a transmission.
+} nrf_802154_aes_ccm_inverse_result_t;
+
+/**
+ * @brief Performs AES-CCM* inverse transformation of a received frame.
+ *
+ * The transformation is performed synchronously, block by block. Each block is calculated
+ * in a critical section, so the transformation can be preempted between blocks. It is
+ * abandoned if a transformation of a transmitted frame is prepared in the meantime.
+ *
+ * @param[in]  p_aes_ccm_data  Data to be used for the transformation. The @c plain_text_data
+ *                             field points to the ciphertext, which is replaced with
+ *                             the plaintext only if the frame is authentic.
+ * @param[in]  p_mic           Pointer to the encrypted MIC of the frame.
+ *
+ * @returns  Result of the transformation.
+ */
+nrf_802154_aes_ccm_inverse_result_t nrf_802154_aes_ccm_inverse_transform(
+    const nrf_802154_aes_ccm_data_t * p_aes_ccm_data,
+    const uint8_t                   * p_mic);
+
+#endif // NRF_802154_RX_DECRYPTION_ENABLED
+
 #endif // NRF_802154_AES_CCM_H_
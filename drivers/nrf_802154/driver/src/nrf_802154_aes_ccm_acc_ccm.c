@@ -0,0 +1,348 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "nrf_802154_config.h"
+
+#if NRF_802154_ENCRYPTION_ACCELERATOR_CCM
+
+#include "nrf_802154_aes_ccm.h"
+
+#include <assert.h>
+#include <string.h>
+
+#include "hal/nrf_ccm.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_tx_work_buffer.h"
+#include "platform/nrf_802154_irq.h"
+
+#if !NRF_CCM_HAS_MODE_PROTOCOL_IEEE802154
+#error "The CCM peripheral of this SoC does not support the IEEE 802.15.4 packet format"
+#endif
+
+#if NRF_802154_ENCRYPTION_ACCELERATOR_ECB
+#error "NRF_802154_ENCRYPTION_ACCELERATOR_CCM and NRF_802154_ENCRYPTION_ACCELERATOR_ECB are exclusive"
+#endif
+
+#ifndef NRF_802154_CCM_INSTANCE
+#define NRF_802154_CCM_INSTANCE       NRF_CCM ///< CCM peripheral used for the transformation.
+#endif
+
+#define NRF_802154_AES_CCM_BLOCK_SIZE 16      // Annex B4 Specification of generic CCM* a)
+
+#define CCM_JOB_ATTRIBUTE_ALEN        11      ///< Job list entry that holds length of a data.
+#define CCM_JOB_ATTRIBUTE_MLEN        12      ///< Job list entry that holds length of m data.
+#define CCM_JOB_ATTRIBUTE_ADATA       13      ///< Job list entry that holds a data.
+#define CCM_JOB_ATTRIBUTE_MDATA       14      ///< Job list entry that holds m data.
+#define CCM_JOB_LIST_SIZE             5       ///< ALEN, MLEN, ADATA, MDATA and the terminator.
+
+static nrf_802154_aes_ccm_data_t m_aes_ccm_data;                                   ///< AES CCM Frame
+static bool                      m_initialized;                                    ///< Flag that indicates whether the module has been initialized.
+static uint8_t                 * mp_ciphertext;                                    ///< Pointer to ciphertext destination buffer.
+static uint8_t                 * mp_work_buffer;                                   ///< Pointer to work buffer that stores the frame being transformed.
+static uint16_t                  m_in_lengths[2];                                  ///< Lengths of a data and m data read by the peripheral.
+static uint16_t                  m_out_lengths[2];                                 ///< Lengths of a data and m data written by the peripheral.
+static nrf_vdma_job_t            m_in_jobs[CCM_JOB_LIST_SIZE];                     ///< Input job list of the peripheral.
+static nrf_vdma_job_t            m_out_jobs[CCM_JOB_LIST_SIZE];                    ///< Output job list of the peripheral.
+static uint32_t                  m_key[NRF_802154_AES_CCM_BLOCK_SIZE / sizeof(uint32_t)];   ///< Key in the register representation.
+static uint32_t                  m_nonce[NRF_802154_AES_CCM_BLOCK_SIZE / sizeof(uint32_t)]; ///< Nonce in the register representation.
+static nrf_ccm_config_t          m_config;                                         ///< Configuration of the peripheral.
+
+static const uint8_t m_mic_size[] = { 0, MIC_32_SIZE, MIC_64_SIZE, MIC_128_SIZE }; ///< Security level - 802.15.4-2015 Standard Table 9.6
+
+static const nrf_ccm_maclen_t m_mac_length[] =
+{
+    NRF_CCM_MODE_MACLEN_M0, NRF_CCM_MODE_MACLEN_M4, NRF_CCM_MODE_MACLEN_M8, NRF_CCM_MODE_MACLEN_M16
+};                                                                                 ///< MAC length setting for each MIC level
+
+static void ccm_irq_handler(void);
+
+/**
+ * @brief Initializes the CCM peripheral.
+ */
+static void ccm_init(void)
+{
+    if (!m_initialized)
+    {
+        nrf_802154_irq_init(nrfx_get_irq_number(NRF_802154_CCM_INSTANCE),
+                            NRF_802154_CCM_PRIORITY,
+                            ccm_irq_handler);
+        m_initialized = true;
+    }
+
+    nrf_ccm_enable(NRF_802154_CCM_INSTANCE);
+
+    nrf_802154_irq_clear_pending(nrfx_get_irq_number(NRF_802154_CCM_INSTANCE));
+    nrf_802154_irq_enable(nrfx_get_irq_number(NRF_802154_CCM_INSTANCE));
+    nrf_ccm_int_enable(NRF_802154_CCM_INSTANCE, NRF_CCM_INT_END_MASK | NRF_CCM_INT_ERROR_MASK);
+}
+
+/**
+ * @brief Converts an octet string to the register representation used by the CCM peripheral.
+ *
+ * The peripheral holds keys and nonces as little-endian 128-bit numbers, so the first octet of
+ * the string is the most significant octet of the number.
+ *
+ * @param[in]  p_octets  Octet string to be converted.
+ * @param[in]  len       Length of the octet string, at most 16 octets.
+ * @param[out] p_words   Four words to be written to the peripheral registers.
+ */
+static void octets_to_words(const uint8_t * p_octets, uint8_t len, uint32_t * p_words)
+{
+    memset(p_words, 0, NRF_802154_AES_CCM_BLOCK_SIZE);
+
+    for (uint8_t i = 0; i < len; i++)
+    {
+        uint8_t bit_pos = 8 * (len - 1 - i);
+
+        p_words[bit_pos / 32] |= (uint32_t)p_octets[i] << (bit_pos % 32);
+    }
+}
+
+/**
+ * @brief Fills a job list of the CCM peripheral.
+ *
+ * @param[out] p_jobs    Job list to be filled.
+ * @param[out] p_lengths Storage for the length fields referenced by the job list.
+ * @param[in]  p_a_data  Pointer to a data.
+ * @param[in]  a_len     Length of a data.
+ * @param[in]  p_m_data  Pointer to m data.
+ * @param[in]  m_len     Length of m data.
+ */
+static void job_list_fill(nrf_vdma_job_t * p_jobs,
+                          uint16_t       * p_lengths,
+                          uint8_t        * p_a_data,
+                          uint16_t         a_len,
+                          uint8_t        * p_m_data,
+                          uint16_t         m_len)
+{
+    uint8_t i = 0;
+
+    p_lengths[0] = a_len;
+    p_lengths[1] = m_len;
+
+    p_jobs[i++] = (nrf_vdma_job_t){ (uint8_t *)&p_lengths[0], sizeof(uint16_t),
+                                    CCM_JOB_ATTRIBUTE_ALEN };
+    p_jobs[i++] = (nrf_vdma_job_t){ (uint8_t *)&p_lengths[1], sizeof(uint16_t),
+                                    CCM_JOB_ATTRIBUTE_MLEN };
+
+    if (a_len != 0)
+    {
+        p_jobs[i++] = (nrf_vdma_job_t){ p_a_data, a_len, CCM_JOB_ATTRIBUTE_ADATA };
+    }
+
+    if (m_len != 0)
+    {
+        p_jobs[i++] = (nrf_vdma_job_t){ p_m_data, m_len, CCM_JOB_ATTRIBUTE_MDATA };
+    }
+
+    p_jobs[i] = (nrf_vdma_job_t){ NULL, 0, 0 };
+}
+
+static void transformation_finished(void)
+{
+    nrf_802154_tx_work_buffer_is_secured_set();
+    m_aes_ccm_data.raw_frame = NULL;
+}
+
+/**
+ * @brief Handler to CCM Interrupt Routine
+ *  Called once the peripheral has transformed the whole frame
+ */
+static void ccm_irq_handler(void)
+{
+    if (nrf_ccm_int_enable_check(NRF_802154_CCM_INSTANCE, NRF_CCM_INT_END_MASK) &&
+        nrf_ccm_event_check(NRF_802154_CCM_INSTANCE, NRF_CCM_EVENT_END))
+    {
+        nrf_ccm_event_clear(NRF_802154_CCM_INSTANCE, NRF_CCM_EVENT_END);
+
+        if (m_aes_ccm_data.raw_frame != NULL)
+        {
+            transformation_finished();
+        }
+    }
+
+    if (nrf_ccm_int_enable_check(NRF_802154_CCM_INSTANCE, NRF_CCM_INT_ERROR_MASK) &&
+        nrf_ccm_event_check(NRF_802154_CCM_INSTANCE, NRF_CCM_EVENT_ERROR))
+    {
+        /*
+         * The ERROR event is generated when the transformation is aborted, which happens
+         * only when the transmission of the frame is terminated. The frame is not marked
+         * as secured in that case, so no further action is taken in this handler.
+         */
+        nrf_ccm_event_clear(NRF_802154_CCM_INSTANCE, NRF_CCM_EVENT_ERROR);
+    }
+}
+
+void nrf_802154_aes_ccm_transform_reset(void)
+{
+    m_aes_ccm_data.raw_frame = NULL;
+}
+
+bool nrf_802154_aes_ccm_transform_prepare(const nrf_802154_aes_ccm_data_t * p_aes_ccm_data)
+{
+    // Verify that all necessary data is available
+    if (p_aes_ccm_data->raw_frame == NULL)
+    {
+        return false;
+    }
+
+    // Verify that the optional data, if exists, is complete
+    if (((p_aes_ccm_data->auth_data_len != 0) && (p_aes_ccm_data->auth_data == NULL)) ||
+        ((p_aes_ccm_data->plain_text_data_len != 0) && (p_aes_ccm_data->plain_text_data == NULL)))
+    {
+        return false;
+    }
+
+    // Verify that the MIC level is valid
+    if (p_aes_ccm_data->mic_level > SECURITY_LEVEL_MIC_LEVEL_MASK)
+    {
+        return false;
+    }
+
+    // Store the encryption data for future use
+    memcpy(&m_aes_ccm_data, p_aes_ccm_data, sizeof(nrf_802154_aes_ccm_data_t));
+
+    ptrdiff_t offset = p_aes_ccm_data->raw_frame[PHR_OFFSET] + PHR_SIZE;
+
+    if (p_aes_ccm_data->plain_text_data)
+    {
+        offset = p_aes_ccm_data->plain_text_data - p_aes_ccm_data->raw_frame;
+    }
+
+    assert((offset >= 0) && (offset <= MAX_PACKET_SIZE + PHR_SIZE));
+
+    nrf_802154_tx_work_buffer_plain_text_offset_set(offset);
+    mp_work_buffer = nrf_802154_tx_work_buffer_enable_for(p_aes_ccm_data->raw_frame);
+    mp_ciphertext  = mp_work_buffer + offset;
+
+    memcpy(mp_work_buffer, p_aes_ccm_data->raw_frame, offset);
+    memset(mp_ciphertext, 0, p_aes_ccm_data->raw_frame[PHR_OFFSET] + PHR_SIZE - offset);
+
+    /*
+     * Everything the peripheral needs apart from the final content of the header is known at this
+     * point, so it is set up here, while the transmission is still waiting for the backoff, CCA or
+     * ramp-up. That leaves only the copy of the updated header and the register writes to
+     * @ref nrf_802154_aes_ccm_transform_start, which is called when the transmission has started.
+     */
+    uint8_t   mic_size = m_mic_size[m_aes_ccm_data.mic_level];
+    uint16_t  a_len    = (uint16_t)m_aes_ccm_data.auth_data_len;
+    uint16_t  m_len    = m_aes_ccm_data.plain_text_data_len;
+    uint8_t * p_a_data = NULL;
+    uint8_t * p_mic    = mp_work_buffer +
+                         (mp_work_buffer[PHR_OFFSET] - FCS_SIZE - mic_size + PHR_SIZE);
+
+    if (a_len != 0)
+    {
+        p_a_data = mp_work_buffer + (m_aes_ccm_data.auth_data - m_aes_ccm_data.raw_frame);
+    }
+
+    /*
+     * The a data is read from the work buffer, because the part of the frame it covers
+     * is updated there when the transformation starts. The m data is encrypted into the work
+     * buffer, immediately followed by the MIC.
+     */
+    job_list_fill(m_in_jobs,
+                  m_in_lengths,
+                  p_a_data,
+                  a_len,
+                  m_aes_ccm_data.plain_text_data,
+                  m_len);
+    job_list_fill(m_out_jobs,
+                  m_out_lengths,
+                  p_a_data,
+                  a_len,
+                  p_mic - m_len,
+                  m_len + mic_size);
+
+    octets_to_words(m_aes_ccm_data.key, AES_CCM_KEY_SIZE, m_key);
+    octets_to_words(m_aes_ccm_data.nonce, NRF_802154_AES_CCM_NONCE_SIZE, m_nonce);
+
+    m_config = (nrf_ccm_config_t)
+    {
+        .mode       = NRF_CCM_MODE_ENCRYPTION,
+        .protocol   = NRF_CCM_MODE_PROTOCOL_IEEE802154,
+        .datarate   = NRF_CCM_DATARATE_250K,
+        .mac_length = m_mac_length[m_aes_ccm_data.mic_level],
+    };
+
+    return true;
+}
+
+void nrf_802154_aes_ccm_transform_start(uint8_t * p_frame)
+{
+    // Verify that the algorithm's inputs were prepared properly
+    if ((p_frame != m_aes_ccm_data.raw_frame) || (m_aes_ccm_data.raw_frame == NULL))
+    {
+        return;
+    }
+
+    ptrdiff_t offset = mp_ciphertext - mp_work_buffer;
+
+    // Copy updated part of the frame
+    memcpy(mp_work_buffer, p_frame, offset);
+
+    ccm_init();
+    nrf_ccm_configure(NRF_802154_CCM_INSTANCE, &m_config);
+    nrf_ccm_key_set(NRF_802154_CCM_INSTANCE, m_key);
+    nrf_ccm_nonce_set(NRF_802154_CCM_INSTANCE, m_nonce);
+    nrf_ccm_in_ptr_set(NRF_802154_CCM_INSTANCE, m_in_jobs);
+    nrf_ccm_out_ptr_set(NRF_802154_CCM_INSTANCE, m_out_jobs);
+
+    nrf_ccm_event_clear(NRF_802154_CCM_INSTANCE, NRF_CCM_EVENT_END);
+    nrf_ccm_event_clear(NRF_802154_CCM_INSTANCE, NRF_CCM_EVENT_ERROR);
+    nrf_ccm_task_trigger(NRF_802154_CCM_INSTANCE, NRF_CCM_TASK_START);
+}
+
+void nrf_802154_aes_ccm_transform_abort(uint8_t * p_frame)
+{
+    // Verify that the encryption of the correct frame is being aborted.
+    if (p_frame != m_aes_ccm_data.raw_frame)
+    {
+        return;
+    }
+
+    /*
+     * Temporarily disable END interrupt, trigger STOP task
+     * to stop encryption in case it is still running and clear
+     * the END event in case the encryption has completed.
+     */
+    nrf_ccm_int_disable(NRF_802154_CCM_INSTANCE, NRF_CCM_INT_END_MASK);
+    nrf_ccm_task_trigger(NRF_802154_CCM_INSTANCE, NRF_CCM_TASK_STOP);
+    nrf_ccm_event_clear(NRF_802154_CCM_INSTANCE, NRF_CCM_EVENT_END);
+    nrf_ccm_int_enable(NRF_802154_CCM_INSTANCE, NRF_CCM_INT_END_MASK);
+
+    m_aes_ccm_data.raw_frame = NULL;
+}
+
+#endif /* NRF_802154_ENCRYPTION_ACCELERATOR_CCM */
@@ -45,6 +45,7 @@
 #include "nrf_802154_const.h"
 #include "nrf_802154_config.h"
 #include "nrf_802154_tx_work_buffer.h"
+#include "nrf_802154_utils.h"
 #include "platform/nrf_802154_irq.h"
 
 #ifndef MIN
@@ -530,6 +531,15 @@ bool nrf_802154_aes_ccm_transform_prepare(const nrf_802154_aes_ccm_data_t * p_ae
     memcpy(mp_work_buffer, p_aes_ccm_data->raw_frame, offset);
     memset(mp_ciphertext, 0, p_aes_ccm_data->raw_frame[PHR_OFFSET] + PHR_SIZE - offset);
 
+    /*
+     * B0 depends only on the nonce and the lengths, so the initial CBC-MAC value is computed
+     * here, while the transmission is still waiting for the backoff, CCA or ramp-up, instead of
+     * when the transmission has started.
+     */
+    memset(m_x, 0, NRF_802154_AES_CCM_BLOCK_SIZE);
+    b0_format(&m_aes_ccm_data, auth_flags_format(&m_aes_ccm_data), m_b);
+    two_blocks_xor(m_x, m_b, NRF_802154_AES_CCM_BLOCK_SIZE);
+
     return true;
 }
 
@@ -541,19 +551,11 @@ void nrf_802154_aes_ccm_transform_start(uint8_t * p_frame)
         return;
     }
 
-    uint8_t   auth_flags = auth_flags_format(&m_aes_ccm_data);
-    uint8_t * p_x        = m_x;
-    uint8_t * p_b        = m_b;
-    ptrdiff_t offset     = mp_ciphertext - mp_work_buffer;
+    ptrdiff_t offset = mp_ciphertext - mp_work_buffer;
 
     // Copy updated part of the frame
     memcpy(mp_work_buffer, p_frame, offset);
 
-    // initial settings
-    memset(p_x, 0, NRF_802154_AES_CCM_BLOCK_SIZE);
-    b0_format(&m_aes_ccm_data, auth_flags, p_b);
-
-    two_blocks_xor(p_x, p_b, NRF_802154_AES_CCM_BLOCK_SIZE);
     ecb_init();
     memset(mp_ecb_key, 0, 48);
     nrf_ecb_set_key(m_aes_ccm_data.key);
@@ -581,4 +583,151 @@ void nrf_802154_aes_ccm_transform_abort(uint8_t * p_frame)
     m_aes_ccm_data.raw_frame = NULL;
 }
 
+#if NRF_802154_RX_DECRYPTION_ENABLED
+
+/**
+ * @brief Encrypts a single block with the ECB peripheral and waits for the result.
+ *
+ * The block is not encrypted if a transformation of a transmitted frame is prepared, because
+ * the state of that transformation is kept in the ECB data structure between ECB interrupts.
+ *
+ * @param[in]  p_key  Pointer to the AES-CCM* key.
+ * @param[in]  p_in   Pointer to the block to be encrypted.
+ * @param[out] p_out  Pointer to memory for the encrypted block.
+ *
+ * @retval true   The block was encrypted.
+ * @retval false  The ECB peripheral could not be used.
+ */
+static bool ecb_block_encrypt(const uint8_t * p_key, const uint8_t * p_in, uint8_t * p_out)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    bool                            result = false;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    if (m_aes_ccm_data.raw_frame == NULL)
+    {
+        uint32_t int_mask = nrf_ecb_int_enable_check(NRF_ECB,
+                                                     NRF_ECB_INT_ENDECB_MASK |
+                                                     NRF_ECB_INT_ERRORECB_MASK);
+
+        nrf_ecb_int_disable(NRF_ECB, int_mask);
+
+        nrf_ecb_init();
+        nrf_ecb_set_key(p_key);
+        memcpy(mp_ecb_cleartext, p_in, NRF_802154_AES_CCM_BLOCK_SIZE);
+
+        nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ENDECB);
+        nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ERRORECB);
+        nrf_ecb_task_trigger(NRF_ECB, NRF_ECB_TASK_STARTECB);
+
+        while (!nrf_ecb_event_check(NRF_ECB, NRF_ECB_EVENT_ENDECB) &&
+               !nrf_ecb_event_check(NRF_ECB, NRF_ECB_EVENT_ERRORECB))
+        {
+            // Intentionally empty
+        }
+
+        // ERRORECB indicates that the block was aborted by the CCM or AAR peripheral
+        result = nrf_ecb_event_check(NRF_ECB, NRF_ECB_EVENT_ENDECB);
+        memcpy(p_out, mp_ecb_ciphertext, NRF_802154_AES_CCM_BLOCK_SIZE);
+
+        nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ENDECB);
+        nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ERRORECB);
+        nrf_802154_irq_clear_pending(nrfx_get_irq_number(NRF_ECB));
+        nrf_ecb_int_enable(NRF_ECB, int_mask);
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+nrf_802154_aes_ccm_inverse_result_t nrf_802154_aes_ccm_inverse_transform(
+    const nrf_802154_aes_ccm_data_t * p_aes_ccm_data,
+    const uint8_t                   * p_mic)
+{
+    nrf_802154_aes_ccm_data_t plain_data = *p_aes_ccm_data;
+    uint8_t                   plain_text[MAX_PACKET_SIZE];
+    uint8_t                   a[NRF_802154_AES_CCM_BLOCK_SIZE];
+    uint8_t                   b[NRF_802154_AES_CCM_BLOCK_SIZE];
+    uint8_t                   x[NRF_802154_AES_CCM_BLOCK_SIZE];
+    uint8_t                   tag[MIC_128_SIZE];
+    uint8_t                   mic_size = m_mic_size[p_aes_ccm_data->mic_level];
+    uint8_t                   diff     = 0;
+    uint8_t                   offset;
+    uint8_t                   len;
+
+    // Decryption transformation - IEEE std 802.15.4-2015, B.4.2 b)
+    for (uint8_t iter = 0; plain_text_data_get(p_aes_ccm_data, iter, b); iter++)
+    {
+        ai_format(p_aes_ccm_data, iter + 1, a);
+        if (!ecb_block_encrypt(p_aes_ccm_data->key, a, x))
+        {
+            return NRF_802154_AES_CCM_INVERSE_BUSY;
+        }
+
+        two_blocks_xor(b, x, NRF_802154_AES_CCM_BLOCK_SIZE);
+
+        offset = iter * NRF_802154_AES_CCM_BLOCK_SIZE;
+        len    = MIN(p_aes_ccm_data->plain_text_data_len - offset, NRF_802154_AES_CCM_BLOCK_SIZE);
+        memcpy(&plain_text[offset], b, len);
+    }
+
+    ai_format(p_aes_ccm_data, 0, a);
+    if (!ecb_block_encrypt(p_aes_ccm_data->key, a, x))
+    {
+        return NRF_802154_AES_CCM_INVERSE_BUSY;
+    }
+
+    memcpy(tag, p_mic, mic_size);
+    two_blocks_xor(tag, x, mic_size);
+
+    // Authentication transformation of the plaintext - IEEE std 802.15.4-2015, B.4.2 c)
+    plain_data.plain_text_data = plain_text;
+
+    b0_format(&plain_data, auth_flags_format(&plain_data), b);
+    if (!ecb_block_encrypt(plain_data.key, b, x))
+    {
+        return NRF_802154_AES_CCM_INVERSE_BUSY;
+    }
+
+    for (uint8_t iter = 0; add_auth_data_get(&plain_data, iter, b); iter++)
+    {
+        two_blocks_xor(b, x, NRF_802154_AES_CCM_BLOCK_SIZE);
+        if (!ecb_block_encrypt(plain_data.key, b, x))
+        {
+            return NRF_802154_AES_CCM_INVERSE_BUSY;
+        }
+    }
+
+    for (uint8_t iter = 0; plain_text_data_get(&plain_data, iter, b); iter++)
+    {
+        two_blocks_xor(b, x, NRF_802154_AES_CCM_BLOCK_SIZE);
+        if (!ecb_block_encrypt(plain_data.key, b, x))
+        {
+            return NRF_802154_AES_CCM_INVERSE_BUSY;
+        }
+    }
+
+    // Compare the whole tag regardless of the position of the first mismatch
+    for (uint8_t i = 0; i < mic_size; i++)
+    {
+        diff |= x[i] ^ tag[i];
+    }
+
+    if (diff != 0)
+    {
+        return NRF_802154_AES_CCM_INVERSE_AUTH_FAILED;
+    }
+
+    if (p_aes_ccm_data->plain_text_data_len != 0)
+    {
+        memcpy(p_aes_ccm_data->plain_text_data, plain_text, p_aes_ccm_data->plain_text_data_len);
+    }
+
+    return NRF_802154_AES_CCM_INVERSE_VERIFIED;
+}
+
+#endif // NRF_802154_RX_DECRYPTION_ENABLED
+
 #endif /* NRF_802154_ENCRYPTION_ACCELERATOR_ECB */
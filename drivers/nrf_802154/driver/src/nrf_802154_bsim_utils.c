@@ -34,6 +34,8 @@
 
 #include "nrf_802154_bsim_utils.h"
 
+#include "nrf_802154_trx.h"
+
 #if defined(CONFIG_SOC_SERIES_BSIM_NRFXX)
 
 /**
@@ -53,4 +55,44 @@ void nrf_802154_bsim_utils_core_hooks_adjustments_set(
     m_nrf_802154_bsim_utils = *p_obj;
 }
 
+#if NRF_802154_TRX_CAPTURE_ENABLED
+
+uint32_t nrf_802154_bsim_utils_trx_capture_replay(const uint8_t                     * p_capture,
+                                                  uint32_t                            size,
+                                                  nrf_802154_bsim_utils_replay_wait_t wait)
+{
+    uint32_t offset  = 0U;
+    uint32_t count   = 0U;
+    uint32_t prev_ts  = 0U;
+
+    while (size - offset >= sizeof(nrf_802154_trx_capture_record_t))
+    {
+        const nrf_802154_trx_capture_record_t * p_record =
+            (const nrf_802154_trx_capture_record_t *)&p_capture[offset];
+        uint32_t record_size = NRF_802154_TRX_CAPTURE_RECORD_SIZE(p_record->data_len);
+
+        if (record_size > size - offset)
+        {
+            // Truncated record
+            break;
+        }
+
+        if (count != 0U)
+        {
+            // Unsigned subtraction handles the wrap-around of the timestamps
+            wait(p_record->timestamp - prev_ts);
+        }
+
+        prev_ts = p_record->timestamp;
+        nrf_802154_trx_capture_replay(p_record);
+
+        offset += record_size;
+        count++;
+    }
+
+    return count;
+}
+
+#endif // NRF_802154_TRX_CAPTURE_ENABLED
+
 #endif /* defined(CONFIG_SOC_SERIES_BSIM_NRFXX) */
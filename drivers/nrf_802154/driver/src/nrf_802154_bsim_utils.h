@@ -37,6 +37,7 @@
 
 #if defined(CONFIG_SOC_SERIES_BSIM_NRFXX)
 
+#include "nrf_802154_config.h"
 #include "nrf_802154_types.h"
 #include "nrf_802154_utils.h"
 
@@ -66,6 +67,38 @@ void nrf_802154_bsim_utils_core_hooks_adjustments_get(
 void nrf_802154_bsim_utils_core_hooks_adjustments_set(
     const nrf_802154_bsim_utils_core_hooks_adjustments_t * p_obj);
 
+#if NRF_802154_TRX_CAPTURE_ENABLED
+
+/**
+ * @brief Function that lets the simulated time pass.
+ *
+ * @param[in]  delay_us  Time to pass in microseconds.
+ */
+typedef void (* nrf_802154_bsim_utils_replay_wait_t)(uint32_t delay_us);
+
+/**
+ * @brief Replays a capture of the trx callbacks against the driver.
+ *
+ * The records are replayed in the captured order with @ref nrf_802154_trx_capture_replay.
+ * Before each record @p wait is called with the time that passed between the record and the
+ * preceding one, so the captured timing is reproduced in the simulated time.
+ *
+ * @note This function must be called from the context of the RADIO IRQ handler, or with the
+ *       RADIO IRQ disabled, after the driver has been put in the state in which the capture
+ *       started.
+ *
+ * @param[in]  p_capture  Pointer to the captured records, aligned to 4 octets.
+ * @param[in]  size       Number of captured bytes.
+ * @param[in]  wait       Function that lets the simulated time pass.
+ *
+ * @return  Number of replayed records.
+ */
+uint32_t nrf_802154_bsim_utils_trx_capture_replay(const uint8_t                     * p_capture,
+                                                  uint32_t                            size,
+                                                  nrf_802154_bsim_utils_replay_wait_t wait);
+
+#endif // NRF_802154_TRX_CAPTURE_ENABLED
+
 #endif /* defined(CONFIG_SOC_SERIES_BSIM_NRFXX) */
 
 #endif /* NRF_802154_BSIM_UTILS_H__ */
@@ -55,11 +55,13 @@
 #include "nrf_802154_notification.h"
 #include "nrf_802154_pib.h"
 #include "nrf_802154_procedures_duration.h"
+#include "nrf_802154_timing_model.h"
 #include "nrf_802154_rssi.h"
 #include "nrf_802154_rx_buffer.h"
 #include "nrf_802154_sl_timer.h"
 #include "nrf_802154_sl_utils.h"
 #include "nrf_802154_stats.h"
+#include "nrf_802154_trace.h"
 #include "nrf_802154_utils.h"
 #include "nrf_802154_trx.h"
 #include "nrf_802154_tx_work_buffer.h"
@@ -68,8 +70,18 @@
 #include "nrf_802154_utils.h"
 #include "drivers/nrfx_errors.h"
 #include "hal/nrf_radio.h"
+#include "mac_features/nrf_802154_ack_timeout.h"
+#include "mac_features/nrf_802154_ant_div_peer.h"
+#include "mac_features/nrf_802154_cca_adaptive.h"
+#include "mac_features/nrf_802154_csma_ca.h"
 #include "mac_features/nrf_802154_filter.h"
 #include "mac_features/nrf_802154_frame_parser.h"
+#include "mac_features/nrf_802154_ifs.h"
+#include "mac_features/nrf_802154_indirect_tx.h"
+#include "mac_features/nrf_802154_lm_series.h"
+#include "mac_features/nrf_802154_noise_floor.h"
+#include "mac_features/nrf_802154_sniffer_ring.h"
+#include "mac_features/nrf_802154_ed_ring.h"
 #include "mac_features/ack_generator/nrf_802154_ack_generator.h"
 #include "rsch/nrf_802154_rsch.h"
 #include "rsch/nrf_802154_rsch_crit_sect.h"
@@ -92,6 +104,11 @@
 #define ED_ITER_DURATION            128U
 /// Overhead of hardware preparation for ED procedure (aTurnaroundTime) [number of iterations]
 #define ED_ITERS_OVERHEAD           2U
+/// Lowest channel covered by the multi-channel energy scan
+#define ED_SCAN_CHANNEL_FIRST       11U
+/// Mask of channels that can be covered by the multi-channel energy scan
+#define ED_SCAN_CHANNELS_MASK       (((1UL << NRF_802154_ENERGY_SCAN_CHANNELS) - 1UL) << \
+                                     ED_SCAN_CHANNEL_FIRST)
 
 #define MAX_CRIT_SECT_TIME          60   ///< Maximal time that the driver spends in single critical section.
 
@@ -122,6 +139,10 @@ static uint8_t                       * mp_ack;                 ///< Pointer to A
 static uint8_t                       * mp_tx_data;             ///< Pointer to the data to transmit.
 static uint32_t                        m_ed_time_left;         ///< Remaining time of the current energy detection procedure [us].
 static uint8_t                         m_ed_result;            ///< Result of the current energy detection procedure.
+static uint32_t                        m_ed_scan_channels;     ///< Channels remaining in the current energy scan procedure.
+static uint32_t                        m_ed_scan_dwell_time;   ///< Energy detection time per channel of the current energy scan [us].
+static uint8_t                         m_ed_scan_channel;      ///< Channel being scanned, 0 if no energy scan is in progress.
+static nrf_802154_energy_scan_result_t m_ed_scan_result;       ///< Results of the current energy scan procedure.
 static uint8_t                         m_last_lqi;             ///< LQI of the last received non-ACK frame, corrected for the temperature.
 static nrf_802154_fal_tx_power_split_t m_tx_power;             ///< Power to be used to transmit the current frame split into components.
 static int8_t                          m_last_rssi;            ///< RSSI of the last received non-ACK frame, corrected for the temperature.
@@ -137,6 +158,9 @@ typedef struct
     bool rx_timeslot_requested : 1; ///< If timeslot for the frame being received is already requested.
     bool tx_with_cca           : 1; ///< If currently transmitted frame is transmitted with cca.
     bool tx_diminished_prio    : 1; ///< If priority of the current transmission should be diminished.
+#if NRF_802154_FILTER_STAGED_ENABLED
+    bool dst_panid_filtered    : 1; ///< If destination PAN ID of frame being received passed filtering operation.
+#endif
 
 #if defined(CONFIG_SOC_SERIES_BSIM_NRFXX)
     bool tx_started_notify     : 1; ///< If higher layer should be notified that transmission started.
@@ -157,6 +181,11 @@ static nrf_802154_trx_transmit_notifications_t m_trx_transmit_frame_notification
 static volatile uint8_t      m_rx_prestarted_trig_count;
 static nrf_802154_sl_timer_t m_rx_prestarted_timer;
 
+#if NRF_802154_DUAL_CHANNEL_RX_ENABLED
+static nrf_802154_sl_timer_t m_dual_rx_timer;          ///< Timer alternating the channels of the dual-channel RX.
+static uint8_t               m_dual_rx_listen_channel; ///< Secondary channel listened on, 0 if the PIB channel.
+#endif
+
 /** @brief Value of Coex TX Request mode */
 static nrf_802154_coex_tx_request_mode_t m_coex_tx_request_mode;
 
@@ -170,24 +199,92 @@ static const nrf_802154_transmitted_frame_props_t m_default_frame_props =
  * @section Common core operations
  **************************************************************************************************/
 
+static bool        timeslot_is_granted(void);
 static rsch_prio_t min_required_rsch_prio(radio_state_t state);
 
+#if NRF_802154_SNIFFER_ENABLED
+static void sniffer_frame_store(uint8_t * p_data);
+#endif
+
+#if NRF_802154_RX_BUFFERS_SHORT > 0
+static uint8_t * rx_frame_compact(uint8_t * p_data);
+#endif
+
+#if NRF_802154_DUAL_CHANNEL_RX_ENABLED
+static void dual_rx_state_update(radio_state_t state);
+#endif
+
+/** Get the channel on which the receiver listens.
+ *
+ * @return  Channel number.
+ */
+static uint8_t rx_channel_get(void)
+{
+#if NRF_802154_DUAL_CHANNEL_RX_ENABLED
+    if (m_dual_rx_listen_channel != 0U)
+    {
+        return m_dual_rx_listen_channel;
+    }
+#endif
+
+    return nrf_802154_pib_channel_get();
+}
+
 static void request_preconditions_for_state(radio_state_t state)
 {
-    nrf_802154_rsch_crit_sect_prio_request(min_required_rsch_prio(state));
+    rsch_prio_t prio = min_required_rsch_prio(state);
+
+#if NRF_802154_STATS_TIMESLOT_ENABLED
+    nrf_802154_stat_timeslot_needed_set(prio != RSCH_PRIO_IDLE);
+#endif
+
+    nrf_802154_rsch_crit_sect_prio_request(prio);
+}
+
+#if NRF_802154_NOISE_FLOOR_ENABLED
+/** Sample the noise floor of the current channel if the driver is listening and idle.
+ *
+ * The sample is taken without extending the radio activity, so this function is to be called
+ * right before the driver leaves the @ref RADIO_STATE_RX state.
+ */
+static void noise_floor_sample(void)
+{
+    uint8_t rssi_sample;
+
+    if ((m_state == RADIO_STATE_RX) && timeslot_is_granted() &&
+        nrf_802154_trx_rssi_noise_sample(&rssi_sample))
+    {
+        rssi_sample = nrf_802154_rssi_sample_corrected_get(rssi_sample);
+
+        nrf_802154_noise_floor_sample_add(rx_channel_get(), -((int8_t)rssi_sample));
+    }
 }
 
+#endif
+
 /** Set driver state.
  *
  * @param[in]  state  Driver state to set.
  */
 static void state_set(radio_state_t state)
 {
+#if NRF_802154_NOISE_FLOOR_ENABLED
+    if (state != RADIO_STATE_RX)
+    {
+        noise_floor_sample();
+    }
+#endif
+
     m_state = state;
 
+#if NRF_802154_DUAL_CHANNEL_RX_ENABLED
+    dual_rx_state_update(state);
+#endif
+
     nrf_802154_log_local_event(NRF_802154_LOG_VERBOSITY_LOW,
                                NRF_802154_LOG_LOCAL_EVENT_ID_CORE__SET_STATE,
                                (uint32_t)state);
+    nrf_802154_trace(NRF_802154_TRACE_EVENT_CORE_STATE, state);
 
     request_preconditions_for_state(state);
 }
@@ -220,8 +317,33 @@ static void rx_flags_clear(void)
     m_flags.frame_filtered        = false;
     m_flags.rx_timeslot_requested = false;
     m_flags.frame_parsed          = false;
+#if NRF_802154_FILTER_STAGED_ENABLED
+    m_flags.dst_panid_filtered = false;
+#endif
+}
+
+#if NRF_802154_FILTER_STAGED_ENABLED
+/** Check if the destination PAN ID of the frame being received is to be filtered in a separate
+ *  bit counter match stage.
+ *
+ * The stage is used only if the destination address follows the destination PAN ID, so that
+ * reception of a frame with a foreign PAN ID can be terminated before the address is received.
+ *
+ * @retval  true   The destination PAN ID stage is to be performed.
+ * @retval  false  The destination PAN ID is to be filtered together with the destination address.
+ */
+static bool rx_dst_panid_stage_is_pending(void)
+{
+    return !m_flags.dst_panid_filtered &&
+           !nrf_802154_pib_promiscuous_get() &&
+           (nrf_802154_frame_parser_dst_panid_offset_get(&m_current_rx_frame_data) !=
+            NRF_802154_FRAME_PARSER_INVALID_OFFSET) &&
+           (nrf_802154_frame_parser_dst_addr_offset_get(&m_current_rx_frame_data) !=
+            NRF_802154_FRAME_PARSER_INVALID_OFFSET);
 }
 
+#endif
+
 /** Wait for the RSSI measurement. */
 static void rssi_measurement_wait(void)
 {
@@ -297,10 +419,43 @@ static uint64_t timer_coord_timestamp_get(void)
     return timestamp;
 }
 
+/**
+ * @brief Get timestamp of the end of SFD of a frame from the timestamp of the end of the frame.
+ *
+ * The duration of the PHR and the PSDU on air is determined by the frame length, so the time
+ * of the ADDRESS event is calculated precisely from the captured time of the end of the frame.
+ *
+ * @param[in]  end_timestamp  Timestamp of the end of the frame or @ref NRF_802154_NO_TIMESTAMP.
+ * @param[in]  p_frame        Pointer to a buffer that contains PHR and PSDU of the frame.
+ *
+ * @returns Timestamp [us] of the end of SFD of the frame or @ref NRF_802154_NO_TIMESTAMP.
+ */
+static uint64_t sfd_timestamp_get(uint64_t end_timestamp, const uint8_t * p_frame)
+{
+    if (end_timestamp == NRF_802154_NO_TIMESTAMP)
+    {
+        return NRF_802154_NO_TIMESTAMP;
+    }
+
+    return end_timestamp - nrf_802154_frame_duration_get(p_frame[PHR_OFFSET], false, true);
+}
+
 #endif
 
 static void received_frame_notify(uint8_t * p_data)
 {
+#if NRF_802154_SNIFFER_ENABLED
+    if (nrf_802154_sniffer_ring_is_enabled())
+    {
+        sniffer_frame_store(p_data);
+        return;
+    }
+#endif
+
+#if NRF_802154_RX_BUFFERS_SHORT > 0
+    p_data = rx_frame_compact(p_data);
+#endif
+
     nrf_802154_notify_received(p_data, m_last_rssi, m_last_lqi);
 }
 
@@ -385,11 +540,16 @@ static void transmitted_frame_notify(uint8_t * p_ack, int8_t power, uint8_t lqi)
         nrf_802154_stat_timestamp_read(&metadata.data.transmitted.time, last_ack_end_timestamp);
     }
 
-    nrf_802154_critical_section_nesting_allow();
+#if NRF_802154_CSMA_CA_ENABLED
+    metadata.retries = nrf_802154_csma_ca_frame_retries_get(p_frame);
+#endif
 
-    nrf_802154_core_hooks_transmitted(p_frame);
+    nrf_802154_critical_section_nesting_allow();
 
-    nrf_802154_notify_transmitted(p_frame, &metadata);
+    if (nrf_802154_core_hooks_transmitted(p_frame))
+    {
+        nrf_802154_notify_transmitted(p_frame, &metadata);
+    }
 
     nrf_802154_critical_section_nesting_deny();
 }
@@ -401,6 +561,13 @@ static void transmit_failed_notify(uint8_t                                   * p
 {
     if (nrf_802154_core_hooks_tx_failed(p_frame, error))
     {
+#if NRF_802154_CSMA_CA_ENABLED
+        nrf_802154_transmit_done_metadata_t metadata = *p_meta;
+
+        metadata.retries = nrf_802154_csma_ca_frame_retries_get(p_frame);
+        p_meta           = &metadata;
+#endif
+
         nrf_802154_notify_transmit_failed(p_frame, error, p_meta);
     }
 }
@@ -435,6 +602,16 @@ static void energy_detected_notify(uint8_t result)
     nrf_802154_critical_section_nesting_deny();
 }
 
+/** Notify MAC layer that energy scan procedure ended. */
+static void energy_scan_done_notify(const nrf_802154_energy_scan_result_t * p_result)
+{
+    nrf_802154_critical_section_nesting_allow();
+
+    nrf_802154_notify_energy_scan_done(p_result);
+
+    nrf_802154_critical_section_nesting_deny();
+}
+
 /** Notify MAC layer that CCA procedure ended. */
 static void cca_notify(bool result)
 {
@@ -485,7 +662,7 @@ static void rx_buffer_in_use_set(rx_buffer_t * p_rx_buffer)
  */
 static bool rx_buffer_is_available(void)
 {
-    return (mp_current_rx_buffer != NULL) && (mp_current_rx_buffer->free);
+    return (mp_current_rx_buffer != NULL) && nrf_802154_rx_buffer_is_free(mp_current_rx_buffer);
 }
 
 /** Get pointer to available rx buffer.
@@ -497,6 +674,177 @@ static uint8_t * rx_buffer_get(void)
     return rx_buffer_is_available() ? mp_current_rx_buffer->data : NULL;
 }
 
+#if NRF_802154_RX_METADATA_ENABLED || NRF_802154_RX_HEADER_NOTIFY_ENABLED
+#if NRF_802154_RX_METADATA_NO_OFFSET != NRF_802154_FRAME_PARSER_INVALID_OFFSET
+#error "Offsets of the frame parser must be passed to the higher layer without conversion"
+#endif
+#endif
+
+#if NRF_802154_RX_HEADER_NOTIFY_ENABLED
+
+/** Notify the higher layer about the header of the frame being received. */
+static void rx_header_notify(void)
+{
+    const nrf_802154_frame_parser_data_t * p_fd  = &m_current_rx_frame_data;
+    const uint8_t                        * p_dsn = nrf_802154_frame_parser_dsn_get(p_fd);
+    nrf_802154_rx_header_t                 header;
+
+    header.psdu_length      = nrf_802154_frame_parser_frame_length_get(p_fd);
+    header.frame_type       = nrf_802154_frame_parser_frame_type_get(p_fd);
+    header.dsn_present      = (p_dsn != NULL);
+    header.dsn              = (p_dsn != NULL) ? *p_dsn : 0U;
+    header.dst_panid_offset = nrf_802154_frame_parser_dst_panid_offset_get(p_fd);
+    header.dst_addr_offset  = nrf_802154_frame_parser_dst_addr_offset_get(p_fd);
+    header.dst_addr_size    = nrf_802154_frame_parser_dst_addr_size_get(p_fd);
+    header.ack_requested    = nrf_802154_frame_parser_ar_bit_is_set(p_fd);
+
+    nrf_802154_rx_header_received(mp_current_rx_buffer->data, &header);
+}
+
+#endif
+
+#if NRF_802154_RX_METADATA_ENABLED
+
+/** Store the metadata of the frame being received with its buffer.
+ *
+ * The metadata is completed by @ref rx_metadata_ack_update if an ACK is transmitted for the frame.
+ *
+ * @param[in]  parsed  If the frame was parsed successfully.
+ */
+static void rx_metadata_fill(bool parsed)
+{
+    nrf_802154_received_metadata_t       * p_meta = &mp_current_rx_buffer->metadata;
+    const nrf_802154_frame_parser_data_t * p_fd   = &m_current_rx_frame_data;
+
+    p_meta->timestamp = NRF_802154_NO_TIMESTAMP;
+#if (NRF_802154_FRAME_TIMESTAMP_ENABLED)
+    nrf_802154_stat_timestamp_read(&p_meta->timestamp, last_rx_end_timestamp);
+#endif
+
+    p_meta->rssi              = m_last_rssi;
+    p_meta->lqi               = m_last_lqi;
+    p_meta->channel           = rx_channel_get();
+    p_meta->parsed            = parsed;
+    p_meta->ack_sent          = false;
+    p_meta->ack_frame_pending = false;
+
+    if (parsed)
+    {
+        p_meta->dst_panid_offset     = nrf_802154_frame_parser_dst_panid_offset_get(p_fd);
+        p_meta->dst_addr_offset      = nrf_802154_frame_parser_dst_addr_offset_get(p_fd);
+        p_meta->dst_addr_size        = nrf_802154_frame_parser_dst_addr_size_get(p_fd);
+        p_meta->src_panid_offset     = nrf_802154_frame_parser_src_panid_offset_get(p_fd);
+        p_meta->src_addr_offset      = nrf_802154_frame_parser_src_addr_offset_get(p_fd);
+        p_meta->src_addr_size        = nrf_802154_frame_parser_src_addr_size_get(p_fd);
+        p_meta->sec_ctrl_offset      = nrf_802154_frame_parser_sec_ctrl_offset_get(p_fd);
+        p_meta->frame_counter_offset = nrf_802154_frame_parser_frame_counter_offset_get(p_fd);
+        p_meta->key_id_offset        = nrf_802154_frame_parser_key_id_offset_get(p_fd);
+        p_meta->header_ie_offset     = nrf_802154_frame_parser_ie_header_offset_get(p_fd);
+        p_meta->mac_payload_offset   = nrf_802154_frame_parser_mac_payload_offset_get(p_fd);
+        p_meta->security_enabled     = nrf_802154_frame_parser_security_enabled_bit_is_set(p_fd);
+        p_meta->security_level       = nrf_802154_frame_parser_sec_ctrl_sec_lvl_get(p_fd);
+        p_meta->key_id_mode          = nrf_802154_frame_parser_sec_ctrl_key_id_mode_get(p_fd);
+        p_meta->mic_size             = nrf_802154_frame_parser_mic_size_get(p_fd);
+        p_meta->security_status      =
+            (p_meta->security_enabled && (p_meta->security_level != SECURITY_LEVEL_NONE)) ?
+            NRF_802154_RX_SECURITY_STATUS_NOT_PROCESSED : NRF_802154_RX_SECURITY_STATUS_UNSECURED;
+    }
+    else
+    {
+        p_meta->dst_panid_offset     = NRF_802154_RX_METADATA_NO_OFFSET;
+        p_meta->dst_addr_offset      = NRF_802154_RX_METADATA_NO_OFFSET;
+        p_meta->dst_addr_size        = 0U;
+        p_meta->src_panid_offset     = NRF_802154_RX_METADATA_NO_OFFSET;
+        p_meta->src_addr_offset      = NRF_802154_RX_METADATA_NO_OFFSET;
+        p_meta->src_addr_size        = 0U;
+        p_meta->sec_ctrl_offset      = NRF_802154_RX_METADATA_NO_OFFSET;
+        p_meta->frame_counter_offset = NRF_802154_RX_METADATA_NO_OFFSET;
+        p_meta->key_id_offset        = NRF_802154_RX_METADATA_NO_OFFSET;
+        p_meta->header_ie_offset     = NRF_802154_RX_METADATA_NO_OFFSET;
+        p_meta->mac_payload_offset   = NRF_802154_RX_METADATA_NO_OFFSET;
+        p_meta->security_enabled     = false;
+        p_meta->security_level       = 0U;
+        p_meta->key_id_mode          = 0U;
+        p_meta->mic_size             = 0U;
+        p_meta->security_status      = NRF_802154_RX_SECURITY_STATUS_UNSECURED;
+    }
+}
+
+/** Store information about the ACK transmitted for the received frame in its metadata.
+ *
+ * @param[in]  p_ack  Pointer to a buffer that contains PHR and PSDU of the transmitted ACK.
+ */
+static void rx_metadata_ack_update(const uint8_t * p_ack)
+{
+    nrf_802154_received_metadata_t * p_meta = &mp_current_rx_buffer->metadata;
+
+    p_meta->ack_sent          = true;
+    p_meta->ack_frame_pending = (p_ack[FRAME_PENDING_OFFSET] & FRAME_PENDING_BIT) != 0U;
+}
+
+#endif // NRF_802154_RX_METADATA_ENABLED
+
+#if NRF_802154_RX_BUFFERS_SHORT > 0
+/** Move a received frame to a short buffer if it fits in one and release its full-size buffer.
+ *
+ * The released buffer is passed to the receiver at once if it is waiting for a buffer.
+ *
+ * @param[in]  p_data  Pointer to a full-size buffer containing PHR and PSDU of the received frame.
+ *
+ * @returns  Pointer to the buffer that contains the received frame after the move.
+ */
+static uint8_t * rx_frame_compact(uint8_t * p_data)
+{
+    rx_buffer_t * p_buffer = (rx_buffer_t *)p_data;
+    uint8_t     * p_short  = nrf_802154_rx_buffer_compact(p_buffer);
+
+    if (p_short == NULL)
+    {
+        return p_data;
+    }
+
+    if (timeslot_is_granted() && nrf_802154_trx_receive_is_buffer_missing())
+    {
+        rx_buffer_in_use_set(p_buffer);
+        nrf_802154_trx_receive_buffer_set(rx_buffer_get());
+    }
+
+    return p_short;
+}
+
+#endif // NRF_802154_RX_BUFFERS_SHORT > 0
+
+#if NRF_802154_SNIFFER_ENABLED
+/** Append a received frame to the sniffer ring and release its buffer.
+ *
+ * @param[in]  p_data  Pointer to a buffer containing PHR and PSDU of the received frame.
+ */
+static void sniffer_frame_store(uint8_t * p_data)
+{
+    rx_buffer_t * p_buffer  = (rx_buffer_t *)p_data;
+    uint64_t      timestamp = NRF_802154_NO_TIMESTAMP;
+
+#if (NRF_802154_FRAME_TIMESTAMP_ENABLED)
+    nrf_802154_stat_timestamp_read(&timestamp, last_rx_end_timestamp);
+#endif
+
+    nrf_802154_sniffer_ring_frame_store(p_data,
+                                        m_last_rssi,
+                                        m_last_lqi,
+                                        rx_channel_get(),
+                                        timestamp);
+
+    nrf_802154_rx_buffer_release(p_buffer);
+
+    if (timeslot_is_granted() && nrf_802154_trx_receive_is_buffer_missing())
+    {
+        rx_buffer_in_use_set(p_buffer);
+        nrf_802154_trx_receive_buffer_set(rx_buffer_get());
+    }
+}
+
+#endif
+
 /***************************************************************************************************
  * @section ACK transmission management
  **************************************************************************************************/
@@ -745,7 +1093,7 @@ static void operation_terminated_notify(radio_state_t state, bool receiving_psdu
             break;
 
         case RADIO_STATE_TX_ACK:
-            mp_current_rx_buffer->free = false;
+            nrf_802154_rx_buffer_acquire(mp_current_rx_buffer);
             nrf_802154_core_hooks_tx_ack_failed(mp_ack, NRF_802154_TX_ERROR_ABORTED);
             received_frame_notify(mp_current_rx_buffer->data);
             break;
@@ -837,6 +1185,18 @@ static bool current_operation_terminate(nrf_802154_term_t term_lvl,
             if (m_state == RADIO_STATE_ED)
             {
                 nrf_802154_sl_ant_div_energy_detection_aborted_notify();
+
+                if (m_ed_scan_channel != 0U)
+                {
+                    // Energy scan could have left the radio on other channel than set in PIB.
+                    m_ed_scan_channels = 0U;
+                    m_ed_scan_channel  = 0U;
+
+                    if (timeslot_is_granted())
+                    {
+                        nrf_802154_trx_channel_set(nrf_802154_pib_channel_get());
+                    }
+                }
             }
 
             if (notify)
@@ -936,6 +1296,7 @@ static nrf_802154_trx_transmit_notifications_t make_trx_frame_transmit_notificat
             case NRF_802154_COEX_TX_REQUEST_MODE_FRAME_READY:
             case NRF_802154_COEX_TX_REQUEST_MODE_CCA_START:
             case NRF_802154_COEX_TX_REQUEST_MODE_ON_CCA_TOGGLE:
+            case NRF_802154_COEX_TX_REQUEST_MODE_PREDICTIVE:
                 /* No additional notifications required. */
                 break;
 
@@ -1027,6 +1388,45 @@ static void rx_init(nrf_802154_trx_ramp_up_trigger_mode_t ru_tr_mode, bool * p_a
     mp_ack = NULL;
 }
 
+/**
+ * @brief Generates an ACK for the frame being received.
+ *
+ * @returns  Pointer to the generated ACK or NULL if the ACK could not be generated.
+ */
+static uint8_t * ack_create(void)
+{
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+    uint32_t start_cycles = nrf_802154_stat_histogram_cycles_get();
+#endif
+
+    uint8_t * p_ack = nrf_802154_ack_generator_create(&m_current_rx_frame_data);
+
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+    nrf_802154_stat_histogram_sample(ack_generation_cycles,
+                                     nrf_802154_stat_histogram_cycles_get() - start_cycles);
+#endif
+
+    return p_ack;
+}
+
+#if NRF_802154_CCA_ADAPTIVE_ENABLED
+/** Configure the energy detection threshold of the upcoming CCA for the current channel. */
+static void cca_threshold_adapt(void)
+{
+    uint8_t ed_threshold;
+
+    if (nrf_802154_cca_adaptive_ed_threshold_get(nrf_802154_pib_channel_get(), &ed_threshold))
+    {
+        nrf_802154_trx_cca_ed_threshold_set(ed_threshold);
+    }
+    else
+    {
+        nrf_802154_trx_cca_configuration_update();
+    }
+}
+
+#endif
+
 /** Initialize TX operation. */
 static bool tx_init(const uint8_t                       * p_data,
                     nrf_802154_trx_ramp_up_trigger_mode_t rampup_trigg_mode,
@@ -1035,7 +1435,7 @@ static bool tx_init(const uint8_t                       * p_data,
     bool cca = cca_attempts > 0;
 
     if (!timeslot_is_granted() || !nrf_802154_rsch_timeslot_request(
-            nrf_802154_tx_duration_get(p_data[0], cca, ack_is_requested(p_data))))
+            nrf_802154_timing_model_tx_duration_get(p_data[0], cca, ack_is_requested(p_data))))
     {
         return false;
     }
@@ -1061,6 +1461,23 @@ static bool tx_init(const uint8_t                       * p_data,
 #endif
 
     m_flags.tx_with_cca = cca;
+#if NRF_802154_CCA_ADAPTIVE_ENABLED
+    if (cca)
+    {
+        cca_threshold_adapt();
+    }
+#endif
+#if NRF_802154_ANT_DIV_PEER_TABLE_ENABLED
+    nrf_802154_trx_tx_peer_antenna_set(nrf_802154_ant_div_peer_tx_antenna_get(p_data));
+#endif
+    if ((rampup_trigg_mode == TRX_RAMP_UP_SW_TRIGGER) && (cca_attempts <= 1))
+    {
+        nrf_802154_timing_model_tx_start(p_data[0], cca);
+    }
+    else
+    {
+        nrf_802154_timing_model_cancel();
+    }
     nrf_802154_trx_transmit_frame(nrf_802154_tx_work_buffer_get(p_data),
                                   rampup_trigg_mode,
                                   cca_attempts,
@@ -1110,6 +1527,28 @@ static bool tx_init(const uint8_t                       * p_data,
     {
         uint32_t ppi_ch = nrf_802154_trx_ramp_up_ppi_channel_get();
 
+#if NRF_802154_IFS_HW_TRIGGER_ENABLED
+        if (nrf_802154_ifs_hw_trigger_is_pending())
+        {
+            if (!nrf_802154_ifs_hw_trigger_arm(ppi_ch))
+            {
+                /**
+                 * The end of the IFS is too close to be timed by the hardware. Ramping up now
+                 * still keeps the gap, so the transmission is prepared again with the
+                 * software trigger.
+                 */
+                nrf_802154_trx_abort();
+                nrf_802154_trx_transmit_frame(nrf_802154_tx_work_buffer_get(p_data),
+                                              TRX_RAMP_UP_SW_TRIGGER,
+                                              cca_attempts,
+                                              &m_tx_power,
+                                              m_trx_transmit_frame_notifications_mask);
+            }
+
+            return true;
+        }
+#endif
+
         if (!nrf_802154_rsch_delayed_timeslot_ppi_update(ppi_ch))
         {
             /**
@@ -1124,6 +1563,23 @@ static bool tx_init(const uint8_t                       * p_data,
     return true;
 }
 
+/** Start the trx energy detection, sampled if the ED samples are stored in the ED ring.
+ *
+ * @param[in]  trx_ed_count  Number of trx energy detection iterations to perform.
+ */
+static void trx_energy_detection_start(uint32_t trx_ed_count)
+{
+#if NRF_802154_ED_RING_ENABLED
+    if (nrf_802154_ed_ring_is_enabled())
+    {
+        nrf_802154_trx_energy_detection_sampled(trx_ed_count);
+        return;
+    }
+#endif
+
+    nrf_802154_trx_energy_detection(trx_ed_count);
+}
+
 /** Initialize ED operation */
 static void ed_init(void)
 {
@@ -1149,13 +1605,39 @@ static void ed_init(void)
         return;
     }
 
-    nrf_802154_trx_energy_detection(trx_ed_count);
+    if (m_ed_scan_channel != 0U)
+    {
+        nrf_802154_trx_channel_set(m_ed_scan_channel);
+    }
+
+    trx_energy_detection_start(trx_ed_count);
+}
+
+/** Select the next channel of the energy scan procedure and reset the ED result.
+ *
+ * @retval true   The next channel was selected.
+ * @retval false  There are no more channels to scan.
+ */
+static bool ed_scan_next_channel_select(void)
+{
+    if (m_ed_scan_channels == 0U)
+    {
+        return false;
+    }
+
+    m_ed_scan_channel   = (uint8_t)NRF_CTZ(m_ed_scan_channels);
+    m_ed_scan_channels &= ~(1UL << m_ed_scan_channel);
+    m_ed_time_left      = m_ed_scan_dwell_time;
+    m_ed_result         = 0;
+
+    return true;
 }
 
 /** Initialize CCA operation. */
 static void cca_init(void)
 {
-    if (!timeslot_is_granted() || !nrf_802154_rsch_timeslot_request(nrf_802154_cca_duration_get()))
+    if (!timeslot_is_granted() ||
+        !nrf_802154_rsch_timeslot_request(nrf_802154_timing_model_cca_duration_get()))
     {
         return;
     }
@@ -1165,6 +1647,11 @@ static void cca_init(void)
         return;
     }
 
+#if NRF_802154_CCA_ADAPTIVE_ENABLED
+    cca_threshold_adapt();
+#endif
+
+    nrf_802154_timing_model_cca_start();
     nrf_802154_trx_standalone_cca();
 }
 
@@ -1231,6 +1718,18 @@ static void on_timeslot_ended(void)
             receiving_psdu_now = nrf_802154_trx_psdu_is_being_received();
         }
 
+#if NRF_802154_NOISE_FLOOR_ENABLED
+        noise_floor_sample();
+#endif
+
+#if NRF_802154_STATS_TIMESLOT_ENABLED
+        bool frame_lost = receiving_psdu_now ||
+                          (m_state == RADIO_STATE_TX_ACK) ||
+                          (m_state == RADIO_STATE_CCA_TX) ||
+                          (m_state == RADIO_STATE_TX) ||
+                          (m_state == RADIO_STATE_RX_ACK);
+#endif
+
         nrf_802154_trx_disable();
 
         nrf_802154_timer_coord_stop();
@@ -1268,7 +1767,7 @@ static void on_timeslot_ended(void)
 
             case RADIO_STATE_TX_ACK:
                 state_set(RADIO_STATE_RX);
-                mp_current_rx_buffer->free = false;
+                nrf_802154_rx_buffer_acquire(mp_current_rx_buffer);
                 nrf_802154_core_hooks_tx_ack_failed(mp_ack, NRF_802154_TX_ERROR_TIMESLOT_ENDED);
                 received_frame_notify_and_nesting_allow(mp_current_rx_buffer->data);
                 break;
@@ -1299,6 +1798,11 @@ static void on_timeslot_ended(void)
             default:
                 assert(false);
         }
+
+#if NRF_802154_STATS_TIMESLOT_ENABLED
+        // Notified after the state is updated, so that falling asleep is not counted as preemption.
+        nrf_802154_stat_timeslot_ended(frame_lost);
+#endif
     }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
@@ -1426,6 +1930,15 @@ static void on_timeslot_started(void)
 
     m_rsch_timeslot_is_granted = true;
 
+#if NRF_802154_DUAL_CHANNEL_RX_ENABLED
+    // The trx module starts on the PIB channel.
+    m_dual_rx_listen_channel = 0U;
+#endif
+
+#if NRF_802154_STATS_TIMESLOT_ENABLED
+    nrf_802154_stat_timeslot_started();
+#endif
+
     nrf_802154_timer_coord_start();
 
 #if defined(CONFIG_SOC_SERIES_BSIM_NRFXX)
@@ -1705,6 +2218,23 @@ void nrf_802154_trx_receive_frame_started(void)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
+/**
+ * @brief Checks if the transmit request to Coex should be raised ahead for the ACK to the frame
+ *        being received.
+ *
+ * @retval true   The frame being received requests an ACK that will be transmitted and
+ *                the predictive Coex transmit request mode is selected.
+ * @retval false  Otherwise.
+ */
+static bool ack_is_predicted(void)
+{
+    return nrf_802154_wifi_coex_is_enabled() &&
+           (nrf_802154_pib_coex_tx_request_mode_get() ==
+            NRF_802154_COEX_TX_REQUEST_MODE_PREDICTIVE) &&
+           nrf_802154_pib_auto_ack_get() &&
+           nrf_802154_frame_parser_ar_bit_is_set(&m_current_rx_frame_data);
+}
+
 uint8_t nrf_802154_trx_receive_frame_bcmatched(uint8_t bcc)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
@@ -1729,6 +2259,16 @@ uint8_t nrf_802154_trx_receive_frame_bcmatched(uint8_t bcc)
             break;
 
         case PARSE_LEVEL_FCF_OFFSETS:
+#if NRF_802154_FILTER_STAGED_ENABLED
+            if (rx_dst_panid_stage_is_pending())
+            {
+                // Only the destination PAN ID has been received so far.
+                parse_level   = PARSE_LEVEL_FCF_OFFSETS;
+                filter_mode   = NRF_802154_FILTER_MODE_DST_PANID;
+                should_filter = true;
+                break;
+            }
+#endif
             parse_level   = PARSE_LEVEL_DST_ADDRESSING_END;
             filter_mode   = NRF_802154_FILTER_MODE_DST_ADDR;
             should_filter = true;
@@ -1767,9 +2307,19 @@ uint8_t nrf_802154_trx_receive_frame_bcmatched(uint8_t bcc)
         {
             m_flags.frame_filtered = true;
 
-            nrf_802154_rsch_crit_sect_prio_request(RSCH_PRIO_RX);
+            // Request Coex for the ACK transmission already, if it is predicted.
+            nrf_802154_rsch_crit_sect_prio_request(ack_is_predicted() ?
+                                                   RSCH_PRIO_TX : RSCH_PRIO_RX);
             nrf_802154_ack_generator_reset();
         }
+
+#if NRF_802154_FILTER_STAGED_ENABLED
+        if ((filter_result == NRF_802154_RX_ERROR_NONE) &&
+            (filter_mode == NRF_802154_FILTER_MODE_DST_PANID))
+        {
+            m_flags.dst_panid_filtered = true;
+        }
+#endif
     }
 
     if (nrf_802154_pib_promiscuous_get())
@@ -1803,9 +2353,25 @@ uint8_t nrf_802154_trx_receive_frame_bcmatched(uint8_t bcc)
         return 0;
     }
 
+#if NRF_802154_RX_HEADER_NOTIFY_ENABLED
+    if ((parse_level == PARSE_LEVEL_DST_ADDRESSING_END) &&
+        (nrf_802154_frame_parser_frame_type_get(&m_current_rx_frame_data) != FRAME_TYPE_ACK))
+    {
+        rx_header_notify();
+    }
+#endif
+
     switch (parse_level)
     {
         case PARSE_LEVEL_FCF_OFFSETS:
+#if NRF_802154_FILTER_STAGED_ENABLED
+            if (rx_dst_panid_stage_is_pending())
+            {
+                next_bcc = PHR_SIZE + PAN_ID_SIZE + nrf_802154_frame_parser_dst_panid_offset_get(
+                    &m_current_rx_frame_data);
+                break;
+            }
+#endif
             next_bcc = PHR_SIZE + nrf_802154_frame_parser_dst_addressing_end_offset_get(
                 &m_current_rx_frame_data);
             break;
@@ -1859,7 +2425,7 @@ uint8_t nrf_802154_trx_receive_frame_bcmatched(uint8_t bcc)
         nrf_802154_frame_parser_ar_bit_is_set(&m_current_rx_frame_data) &&
         nrf_802154_pib_auto_ack_get())
     {
-        mp_ack = nrf_802154_ack_generator_create(&m_current_rx_frame_data);
+        mp_ack = ack_create();
     }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
@@ -1965,10 +2531,32 @@ void nrf_802154_trx_receive_frame_received(void)
         uint64_t ts = timer_coord_timestamp_get();
 
         nrf_802154_stat_timestamp_write(last_rx_end_timestamp, ts);
+        nrf_802154_stat_timestamp_write(last_rx_start_timestamp,
+                                        sfd_timestamp_get(ts, mp_current_rx_buffer->data));
 #endif
 
         nrf_802154_sl_ant_div_rx_frame_received_notify();
 
+#if NRF_802154_ANT_DIV_PEER_TABLE_ENABLED
+        if (parse_result)
+        {
+            nrf_802154_ant_div_peer_rx_frame_update(
+                &m_current_rx_frame_data,
+                nrf_802154_sl_ant_div_last_rx_best_antenna_get());
+        }
+#endif
+
+#if NRF_802154_LINK_METRICS_SERIES_ENABLED
+        if (m_flags.frame_filtered && parse_result)
+        {
+            nrf_802154_lm_series_rx_frame_update(&m_current_rx_frame_data, m_last_rssi, m_last_lqi);
+        }
+#endif
+
+#if NRF_802154_RX_METADATA_ENABLED
+        rx_metadata_fill(parse_result);
+#endif
+
         bool send_ack = false;
 
         if (m_flags.frame_filtered &&
@@ -1976,8 +2564,8 @@ void nrf_802154_trx_receive_frame_received(void)
             nrf_802154_frame_parser_ar_bit_is_set(&m_current_rx_frame_data) &&
             nrf_802154_pib_auto_ack_get())
         {
-            nrf_802154_tx_work_buffer_reset(&m_default_frame_props);
-            mp_ack   = nrf_802154_ack_generator_create(&m_current_rx_frame_data);
+            nrf_802154_tx_work_buffer_reset(NULL, &m_default_frame_props);
+            mp_ack   = ack_create();
             send_ack = (mp_ack != NULL);
         }
 
@@ -2020,7 +2608,7 @@ void nrf_802154_trx_receive_frame_received(void)
                 }
                 else
                 {
-                    mp_current_rx_buffer->free = false;
+                    nrf_802154_rx_buffer_acquire(mp_current_rx_buffer);
 
                     state_set(RADIO_STATE_RX);
                     rx_init(TRX_RAMP_UP_SW_TRIGGER, NULL);
@@ -2036,7 +2624,7 @@ void nrf_802154_trx_receive_frame_received(void)
                     nrf_802154_stat_counter_increment(coex_denied_requests);
                 }
 
-                mp_current_rx_buffer->free = false;
+                nrf_802154_rx_buffer_acquire(mp_current_rx_buffer);
 
                 state_set(RADIO_STATE_RX);
                 rx_init(TRX_RAMP_UP_SW_TRIGGER, NULL);
@@ -2052,7 +2640,7 @@ void nrf_802154_trx_receive_frame_received(void)
                 nrf_802154_pib_promiscuous_get())
             {
                 // Current buffer will be passed to the application
-                mp_current_rx_buffer->free = false;
+                nrf_802154_rx_buffer_acquire(mp_current_rx_buffer);
 
                 // Find new buffer
                 rx_buffer_in_use_set(nrf_802154_rx_buffer_free_find());
@@ -2110,8 +2698,17 @@ void nrf_802154_trx_transmit_ack_transmitted(void)
 
     uint8_t * p_received_data = mp_current_rx_buffer->data;
 
+#if NRF_802154_INDIRECT_TX_ENABLED
+    // The received frame must be inspected before it is passed to the application.
+    bool poll_respond = nrf_802154_indirect_tx_poll_detect(&m_current_rx_frame_data, mp_ack);
+#endif
+
+#if NRF_802154_RX_METADATA_ENABLED
+    rx_metadata_ack_update(mp_ack);
+#endif
+
     // Current buffer used for receive operation will be passed to the application
-    mp_current_rx_buffer->free = false;
+    nrf_802154_rx_buffer_acquire(mp_current_rx_buffer);
 
     state_set(RADIO_STATE_RX);
 
@@ -2119,6 +2716,16 @@ void nrf_802154_trx_transmit_ack_transmitted(void)
 
     received_frame_notify_and_nesting_allow(p_received_data);
 
+#if NRF_802154_INDIRECT_TX_ENABLED
+    if (poll_respond)
+    {
+        // Answer the poll before the polling device turns its receiver off.
+        nrf_802154_critical_section_nesting_allow();
+        nrf_802154_indirect_tx_poll_respond();
+        nrf_802154_critical_section_nesting_deny();
+    }
+#endif
+
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
@@ -2126,22 +2733,27 @@ void nrf_802154_trx_transmit_frame_transmitted(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
+    nrf_802154_timing_model_end();
+
 #if (NRF_802154_FRAME_TIMESTAMP_ENABLED)
     uint64_t ts = timer_coord_timestamp_get();
 
     // ts holds now timestamp of the PHYEND event
     nrf_802154_stat_timestamp_write(last_tx_end_timestamp, ts);
+    nrf_802154_stat_timestamp_write(last_tx_start_timestamp, sfd_timestamp_get(ts, mp_tx_data));
 
     if (m_flags.tx_with_cca)
     {
         m_flags.tx_diminished_prio = false;
+    }
 
-        // We calculate the timestamp when ccaidle must happened.
-        ts -= nrf_802154_frame_duration_get(mp_tx_data[0], true, true) + RX_TX_TURNAROUND_TIME;
+#endif
 
-        nrf_802154_stat_timestamp_write(last_cca_idle_timestamp, ts);
+#if NRF_802154_CCA_ADAPTIVE_ENABLED
+    if (m_flags.tx_with_cca)
+    {
+        nrf_802154_cca_adaptive_cca_result_update(false);
     }
-
 #endif
 
     if (ack_is_requested(mp_tx_data))
@@ -2157,6 +2769,10 @@ void nrf_802154_trx_transmit_frame_transmitted(void)
         nrf_802154_timer_coord_timestamp_prepare(nrf_802154_trx_radio_crcok_event_handle_get());
 #endif
 
+#if NRF_802154_ACK_TIMEOUT_HW_WINDOW_ENABLED
+        nrf_802154_trx_receive_ack_window_set(nrf_802154_ack_timeout_window_get());
+#endif
+
         nrf_802154_trx_receive_ack();
 
         if (!rx_buffer_free)
@@ -2290,6 +2906,10 @@ static void on_bad_ack(void)
 
     nrf_802154_transmit_done_metadata_t metadata = {};
 
+#if NRF_802154_CCA_ADAPTIVE_ENABLED
+    nrf_802154_cca_adaptive_ack_result_update(false);
+#endif
+
     nrf_802154_tx_work_buffer_original_frame_update(mp_tx_data, &metadata.frame_props);
     transmit_failed_notify_and_nesting_allow(NRF_802154_TX_ERROR_INVALID_ACK, &metadata);
 
@@ -2309,18 +2929,32 @@ void nrf_802154_trx_receive_ack_received(void)
         uint64_t ts = timer_coord_timestamp_get();
 
         nrf_802154_stat_timestamp_write(last_ack_end_timestamp, ts);
+        nrf_802154_stat_timestamp_write(last_ack_start_timestamp,
+                                        sfd_timestamp_get(ts, p_ack_data));
 #endif
 
-        rx_buffer_t * p_ack_buffer = mp_current_rx_buffer;
-
-        mp_current_rx_buffer->free = false;
+        nrf_802154_rx_buffer_acquire(mp_current_rx_buffer);
 
         state_set(RADIO_STATE_RX);
         rx_init(TRX_RAMP_UP_SW_TRIGGER, NULL);
 
-        transmitted_frame_notify(p_ack_buffer->data,           // phr + psdu
+#if NRF_802154_RX_BUFFERS_SHORT > 0
+        p_ack_data = rx_frame_compact(p_ack_data);
+#endif
+
+#if NRF_802154_CCA_ADAPTIVE_ENABLED
+        nrf_802154_cca_adaptive_ack_result_update(true);
+#endif
+
+#if NRF_802154_LINK_METRICS_SERIES_ENABLED
+        nrf_802154_lm_series_ack_update(mp_tx_data,
+                                        rssi_last_measurement_get(),
+                                        lqi_get(p_ack_data));
+#endif
+
+        transmitted_frame_notify(p_ack_data,                   // phr + psdu
                                  rssi_last_measurement_get(),  // rssi
-                                 lqi_get(p_ack_buffer->data)); // lqi;
+                                 lqi_get(p_ack_data));         // lqi;
     }
     else
     {
@@ -2334,6 +2968,8 @@ void nrf_802154_trx_standalone_cca_finished(bool channel_was_idle)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
+    nrf_802154_timing_model_end();
+
     state_set(RADIO_STATE_RX);
     rx_init(TRX_RAMP_UP_SW_TRIGGER, NULL);
 
@@ -2364,6 +3000,15 @@ void nrf_802154_trx_transmit_frame_ccaidle(void)
 
     // Update stat timestamp of CCASTART event
     nrf_802154_stat_timestamp_write(last_cca_start_timestamp, ts);
+
+    // The CCA procedure lasts aCcaTime, so the CCAIDLE event follows the captured CCASTART event
+    // by a fixed time
+    if (ts != NRF_802154_NO_TIMESTAMP)
+    {
+        ts += CCA_TIME;
+    }
+
+    nrf_802154_stat_timestamp_write(last_cca_idle_timestamp, ts);
 #endif
 
     if (m_coex_tx_request_mode == NRF_802154_COEX_TX_REQUEST_MODE_CCA_DONE)
@@ -2381,6 +3026,10 @@ void nrf_802154_trx_transmit_frame_ccabusy(void)
 
     nrf_802154_stat_counter_increment(cca_failed_attempts);
 
+#if NRF_802154_CCA_ADAPTIVE_ENABLED
+    nrf_802154_cca_adaptive_cca_result_update(true);
+#endif
+
     state_set(RADIO_STATE_RX);
     rx_init(TRX_RAMP_UP_SW_TRIGGER, NULL);
 
@@ -2392,6 +3041,19 @@ void nrf_802154_trx_transmit_frame_ccabusy(void)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
+#if NRF_802154_ED_RING_ENABLED
+
+void nrf_802154_trx_energy_detection_sample(uint8_t ed_sample)
+{
+    uint8_t channel = (m_ed_scan_channel != 0U) ? m_ed_scan_channel : nrf_802154_pib_channel_get();
+
+    nrf_802154_ed_ring_sample_store(nrf_802154_rssi_ed_sample_to_dbm_convert(ed_sample),
+                                    channel,
+                                    nrf_802154_sl_timer_current_time_get());
+}
+
+#endif // NRF_802154_ED_RING_ENABLED
+
 void nrf_802154_trx_energy_detection_finished(uint8_t ed_sample)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
@@ -2408,7 +3070,7 @@ void nrf_802154_trx_energy_detection_finished(uint8_t ed_sample)
 
         if (ed_iter_setup(&m_ed_time_left, &trx_ed_count))
         {
-            nrf_802154_trx_energy_detection(trx_ed_count);
+            trx_energy_detection_start(trx_ed_count);
         }
         else
         {
@@ -2420,6 +3082,27 @@ void nrf_802154_trx_energy_detection_finished(uint8_t ed_sample)
     {
         ed_init();
     }
+    else if (m_ed_scan_channel != 0U)
+    {
+        m_ed_scan_result.ed_dbm[m_ed_scan_channel - ED_SCAN_CHANNEL_FIRST] =
+            nrf_802154_rssi_ed_sample_to_dbm_convert(m_ed_result);
+
+        if (ed_scan_next_channel_select())
+        {
+            ed_init();
+        }
+        else
+        {
+            m_ed_scan_channel = 0U;
+
+            nrf_802154_trx_channel_set(nrf_802154_pib_channel_get());
+
+            state_set(RADIO_STATE_RX);
+            rx_init(TRX_RAMP_UP_SW_TRIGGER, NULL);
+
+            energy_scan_done_notify(&m_ed_scan_result);
+        }
+    }
     else
     {
         nrf_802154_trx_channel_set(nrf_802154_pib_channel_get());
@@ -2453,9 +3136,14 @@ void nrf_802154_core_init(void)
     m_rx_prestarted_trig_count = 0;
 
     nrf_802154_sl_timer_init(&m_rx_prestarted_timer);
+#if NRF_802154_DUAL_CHANNEL_RX_ENABLED
+    nrf_802154_sl_timer_init(&m_dual_rx_timer);
+    m_dual_rx_listen_channel = 0U;
+#endif
 
     nrf_802154_trx_init();
     nrf_802154_ack_generator_init();
+    nrf_802154_timing_model_init();
 }
 
 void nrf_802154_core_deinit(void)
@@ -2473,6 +3161,9 @@ void nrf_802154_core_deinit(void)
     nrf_802154_irq_clear_pending(nrfx_get_irq_number(NRF_RADIO));
 
     nrf_802154_sl_timer_deinit(&m_rx_prestarted_timer);
+#if NRF_802154_DUAL_CHANNEL_RX_ENABLED
+    nrf_802154_sl_timer_deinit(&m_dual_rx_timer);
+#endif
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
@@ -2612,7 +3303,7 @@ bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
 
             if (result)
             {
-                nrf_802154_tx_work_buffer_reset(&p_params->frame_props);
+                nrf_802154_tx_work_buffer_reset(p_data, &p_params->frame_props);
                 result = nrf_802154_core_hooks_tx_setup(p_data, p_params, &transmit_failed_notify);
 
                 if (!result)
@@ -2636,8 +3327,18 @@ bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
 
                 uint8_t cca_attempts = p_params->cca ? (1 + p_params->extra_cca_attempts) : 0;
 
+                nrf_802154_trx_ramp_up_trigger_mode_t ru_tr_mode = ramp_up_mode_choose(req_orig);
+
+#if NRF_802154_IFS_HW_TRIGGER_ENABLED
+                if (nrf_802154_ifs_hw_trigger_is_pending())
+                {
+                    // The ramp up is triggered by the IFS timer.
+                    ru_tr_mode = TRX_RAMP_UP_HW_TRIGGER;
+                }
+#endif
+
                 // coverity[check_return]
-                result = tx_init(p_data, ramp_up_mode_choose(req_orig), cca_attempts);
+                result = tx_init(p_data, ru_tr_mode, cca_attempts);
 
                 if (p_params->immediate)
                 {
@@ -2695,6 +3396,10 @@ bool nrf_802154_core_ack_timeout_handle(const nrf_802154_ack_timeout_handle_para
 
             nrf_802154_transmit_done_metadata_t metadata = {0};
 
+#if NRF_802154_CCA_ADAPTIVE_ENABLED
+            nrf_802154_cca_adaptive_ack_result_update(false);
+#endif
+
             nrf_802154_tx_work_buffer_original_frame_update(p_param->p_frame,
                                                             &metadata.frame_props);
             nrf_802154_notify_transmit_failed(p_param->p_frame,
@@ -2727,8 +3432,50 @@ bool nrf_802154_core_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_
                 time_us = ED_ITER_DURATION;
             }
 
-            m_ed_time_left = time_us;
-            m_ed_result    = 0;
+            m_ed_time_left     = time_us;
+            m_ed_result        = 0;
+            m_ed_scan_channels = 0U;
+            m_ed_scan_channel  = 0U;
+
+            state_set(RADIO_STATE_ED);
+            ed_init();
+        }
+
+        nrf_802154_critical_section_exit();
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+
+    return result;
+}
+
+bool nrf_802154_core_energy_scan(nrf_802154_term_t term_lvl,
+                                 uint32_t          channel_mask,
+                                 uint32_t          dwell_us)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    channel_mask &= ED_SCAN_CHANNELS_MASK;
+
+    bool result = (channel_mask != 0U) && critical_section_enter_and_verify_timeslot_length();
+
+    if (result)
+    {
+        result = current_operation_terminate(term_lvl, REQ_ORIG_CORE, true);
+
+        if (result)
+        {
+            if (dwell_us < ED_ITER_DURATION)
+            {
+                dwell_us = ED_ITER_DURATION;
+            }
+
+            memset(&m_ed_scan_result, 0, sizeof(m_ed_scan_result));
+            m_ed_scan_result.channel_mask = channel_mask;
+
+            m_ed_scan_channels   = channel_mask;
+            m_ed_scan_dwell_time = dwell_us;
+            (void)ed_scan_next_channel_select();
 
             state_set(RADIO_STATE_ED);
             ed_init();
@@ -2827,13 +3574,15 @@ bool nrf_802154_core_notify_buffer_free(uint8_t * p_data)
     rx_buffer_t * p_buffer     = (rx_buffer_t *)p_data;
     bool          in_crit_sect = critical_section_enter_and_verify_timeslot_length();
 
-    p_buffer->free = true;
+    nrf_802154_rx_buffer_release(p_buffer);
 
     if (in_crit_sect)
     {
         if (timeslot_is_granted())
         {
-            if (nrf_802154_trx_receive_is_buffer_missing())
+            // Frames are received only to full-size buffers.
+            if (nrf_802154_trx_receive_is_buffer_missing() &&
+                !nrf_802154_rx_buffer_is_short(p_data))
             {
                 rx_buffer_in_use_set(p_buffer);
                 nrf_802154_trx_receive_buffer_set(rx_buffer_get());
@@ -2848,6 +3597,157 @@ bool nrf_802154_core_notify_buffer_free(uint8_t * p_data)
     return true;
 }
 
+#if NRF_802154_FAST_CHANNEL_HOP_ENABLED
+/**
+ * @brief Moves the idle reception to the given channel without reinitializing the receiver.
+ *
+ * @param[in]  channel  Channel on which the reception is to continue.
+ *
+ * @retval true   The receiver is ramping up on @p channel.
+ * @retval false  The reception cannot be moved in the current state.
+ */
+static bool rx_channel_move(uint8_t channel)
+{
+    bool result = nrf_802154_trx_receive_frame_channel_hop(channel);
+
+    if (result)
+    {
+        // Same bookkeeping as when the reception is terminated, see current_operation_terminate
+        m_rx_prestarted_trig_count = 0;
+        (void)nrf_802154_sl_timer_remove(&m_rx_prestarted_timer);
+
+        nrf_802154_sl_ant_div_rx_aborted_notify();
+        request_preconditions_for_state(m_state);
+
+        rx_flags_clear();
+        rx_data_clear();
+    }
+
+    return result;
+}
+
+/**
+ * @brief Moves the ongoing reception to the channel from PIB without reinitializing the receiver.
+ *
+ * @param[in]  req_orig  Module that originates the channel update.
+ *
+ * @retval true   The receiver is ramping up on the new channel.
+ * @retval false  The fast channel hop was not possible. The reception must be restarted.
+ */
+static bool rx_channel_hop(req_originator_t req_orig)
+{
+    return timeslot_is_granted() &&
+           !nrf_802154_trx_psdu_is_being_received() &&
+           nrf_802154_core_hooks_terminate(NRF_802154_TERM_802154, req_orig) &&
+           rx_channel_move(nrf_802154_pib_channel_get());
+}
+
+#endif // NRF_802154_FAST_CHANNEL_HOP_ENABLED
+
+#if NRF_802154_DUAL_CHANNEL_RX_ENABLED
+
+static void on_dual_rx_timeout(nrf_802154_sl_timer_t * p_timer);
+
+/** Schedule the next channel alternation of the dual-channel reception, if it is enabled. */
+static void dual_rx_timer_start(void)
+{
+    (void)nrf_802154_sl_timer_remove(&m_dual_rx_timer);
+
+    if (nrf_802154_pib_dual_rx_channel_get() == 0U)
+    {
+        return;
+    }
+
+    m_dual_rx_timer.trigger_time = nrf_802154_sl_timer_current_time_get() +
+                                   NRF_802154_DUAL_CHANNEL_RX_DWELL_US;
+    m_dual_rx_timer.action_type              = NRF_802154_SL_TIMER_ACTION_TYPE_CALLBACK;
+    m_dual_rx_timer.action.callback.callback = on_dual_rx_timeout;
+
+    nrf_802154_sl_timer_ret_t ret;
+
+    ret = nrf_802154_sl_timer_add(&m_dual_rx_timer);
+    assert(ret == NRF_802154_SL_TIMER_RET_SUCCESS);
+    (void)ret;
+}
+
+/** Move the idle reception to the other channel of the dual-channel reception. */
+static void dual_rx_channel_alternate(void)
+{
+    uint8_t secondary = 0U;
+
+    if (m_dual_rx_listen_channel == 0U)
+    {
+        secondary = nrf_802154_pib_dual_rx_channel_get();
+
+        if (secondary == 0U)
+        {
+            // The dual-channel reception was disabled, the receiver stays on the PIB channel.
+            return;
+        }
+    }
+
+    uint8_t channel = (secondary != 0U) ? secondary : nrf_802154_pib_channel_get();
+
+    // A frame being received locks the receiver on its channel.
+    if (!nrf_802154_trx_psdu_is_being_received() && rx_channel_move(channel))
+    {
+        m_dual_rx_listen_channel = secondary;
+    }
+}
+
+static void on_dual_rx_timeout(nrf_802154_sl_timer_t * p_timer)
+{
+    (void)p_timer;
+
+    if (nrf_802154_critical_section_enter())
+    {
+        if ((m_state == RADIO_STATE_RX) && timeslot_is_granted())
+        {
+            dual_rx_channel_alternate();
+        }
+
+        nrf_802154_critical_section_exit();
+    }
+
+    // If the critical section was busy, the alternation is retried after the next dwell time.
+    if (m_state == RADIO_STATE_RX)
+    {
+        dual_rx_timer_start();
+    }
+}
+
+/** Update the dual-channel reception when the driver state is set.
+ *
+ * The channels are alternated only in the @ref RADIO_STATE_RX state. When the driver leaves it
+ * for any state other than @ref RADIO_STATE_TX_ACK, the PIB channel is restored, so that the ACK
+ * is transmitted on the channel of the received frame and all other operations use
+ * the PIB channel.
+ *
+ * @param[in]  state  Driver state that was set.
+ */
+static void dual_rx_state_update(radio_state_t state)
+{
+    if (state == RADIO_STATE_RX)
+    {
+        dual_rx_timer_start();
+        return;
+    }
+
+    (void)nrf_802154_sl_timer_remove(&m_dual_rx_timer);
+
+    if ((state != RADIO_STATE_TX_ACK) && (m_dual_rx_listen_channel != 0U))
+    {
+        m_dual_rx_listen_channel = 0U;
+
+        if (timeslot_is_granted())
+        {
+            nrf_802154_trx_channel_set(nrf_802154_pib_channel_get());
+        }
+    }
+}
+
+#endif // NRF_802154_DUAL_CHANNEL_RX_ENABLED
+
 bool nrf_802154_core_channel_update(req_originator_t req_orig)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
@@ -2861,9 +3761,26 @@ bool nrf_802154_core_channel_update(req_originator_t req_orig)
             nrf_802154_trx_channel_set(nrf_802154_pib_channel_get());
         }
 
+#if NRF_802154_DUAL_CHANNEL_RX_ENABLED
+        m_dual_rx_listen_channel = 0U;
+#endif
+
         switch (m_state)
         {
             case RADIO_STATE_RX:
+#if NRF_802154_DUAL_CHANNEL_RX_ENABLED
+                // The secondary channel might have changed, restart the alternation.
+                dual_rx_timer_start();
+#endif
+
+#if NRF_802154_FAST_CHANNEL_HOP_ENABLED
+                if (rx_channel_hop(req_orig))
+                {
+                    // The reception continues on the new channel.
+                    break;
+                }
+#endif
+
                 if (current_operation_terminate(NRF_802154_TERM_802154, req_orig, true))
                 {
                     rx_init(TRX_RAMP_UP_SW_TRIGGER, NULL);
@@ -178,6 +178,25 @@ bool nrf_802154_core_ack_timeout_handle(const nrf_802154_ack_timeout_handle_para
  */
 bool nrf_802154_core_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_us);
 
+/**
+ * @brief Requests the transition to the @ref RADIO_STATE_ED state to scan multiple channels.
+ *
+ * The energy detection procedure is performed on each channel from @p channel_mask in ascending
+ * order. When the last channel is scanned, the driver returns to the channel set in PIB and
+ * transitions to the @ref RADIO_STATE_RX state.
+ *
+ * @param[in]  term_lvl      Termination level of this request. Selects procedures to abort.
+ * @param[in]  channel_mask  Mask of channels to scan. Only channels 11-26 are taken into account.
+ * @param[in]  dwell_us      Minimal time of energy detection procedure on each channel.
+ *
+ * @retval  true   Entering the energy detection state succeeded.
+ * @retval  false  Entering the energy detection state failed
+ *                 (the driver is performing other procedure or @p channel_mask is empty).
+ */
+bool nrf_802154_core_energy_scan(nrf_802154_term_t term_lvl,
+                                 uint32_t          channel_mask,
+                                 uint32_t          dwell_us);
+
 /**
  * @brief Requests the transition to the @ref RADIO_STATE_CCA state.
  *
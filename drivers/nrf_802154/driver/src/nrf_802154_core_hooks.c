@@ -48,9 +48,12 @@
 #include "mac_features/nrf_802154_ack_timeout.h"
 #include "mac_features/nrf_802154_csma_ca.h"
 #include "mac_features/nrf_802154_delayed_trx.h"
+#include "mac_features/nrf_802154_frame_parser.h"
 #include "mac_features/nrf_802154_ie_writer.h"
 #include "mac_features/nrf_802154_security_writer.h"
 #include "mac_features/nrf_802154_ifs.h"
+#include "mac_features/nrf_802154_tx_queue.h"
+#include "mac_features/nrf_802154_wakeup_tx.h"
 #include "nrf_802154_encrypt.h"
 #include "nrf_802154_config.h"
 
@@ -59,9 +62,10 @@ typedef bool (* pre_transmission_hook)(uint8_t                                 *
                                        nrf_802154_transmit_params_t            * p_params,
                                        nrf_802154_transmit_failed_notification_t notify_function);
 typedef bool (* tx_setup_hook)(uint8_t                                 * p_frame,
+                               const nrf_802154_frame_parser_data_t    * p_frame_data,
                                nrf_802154_transmit_params_t            * p_params,
                                nrf_802154_transmit_failed_notification_t notify_function);
-typedef void (* transmitted_hook)(const uint8_t * p_frame);
+typedef bool (* transmitted_hook)(const uint8_t * p_frame);
 typedef bool (* tx_failed_hook)(uint8_t * p_frame, nrf_802154_tx_error_t error);
 typedef void (* tx_ack_failed_hook)(uint8_t * p_ack, nrf_802154_tx_error_t error);
 typedef bool (* tx_started_hook)(uint8_t * p_frame);
@@ -92,6 +96,14 @@ static const abort_hook m_abort_hooks[] =
     nrf_802154_ifs_abort,
 #endif
 
+#if NRF_802154_TX_QUEUE_ENABLED
+    nrf_802154_tx_queue_abort,
+#endif
+
+#if NRF_802154_WAKEUP_TX_ENABLED
+    nrf_802154_wakeup_tx_abort,
+#endif
+
     NULL,
 };
 
@@ -124,6 +136,10 @@ static const transmitted_hook m_transmitted_hooks[] =
 #endif
 #if NRF_802154_IFS_ENABLED
     nrf_802154_ifs_transmitted_hook,
+#endif
+#if NRF_802154_WAKEUP_TX_ENABLED
+    // Must be the last hook, as it may start the transmission of the next frame
+    nrf_802154_wakeup_tx_transmitted_hook,
 #endif
     NULL,
 };
@@ -142,6 +158,15 @@ static const tx_failed_hook m_tx_failed_hooks[] =
     nrf_802154_encrypt_tx_failed_hook,
 #endif
 
+#if NRF_802154_WAKEUP_TX_ENABLED
+    nrf_802154_wakeup_tx_tx_failed_hook,
+#endif
+
+#if NRF_802154_CSMA_CA_ENABLED
+    // Must be the last hook, as it may restart the transmission of the frame
+    nrf_802154_csma_ca_frame_retry_tx_failed_hook,
+#endif
+
     NULL,
 };
 
@@ -263,7 +288,20 @@ bool nrf_802154_core_hooks_tx_setup(
     nrf_802154_transmit_params_t            * p_params,
     nrf_802154_transmit_failed_notification_t notify_function)
 {
-    bool result = true;
+    bool                           result = true;
+    nrf_802154_frame_parser_data_t frame_data;
+
+    if (m_tx_setup_hooks[0] == NULL)
+    {
+        return result;
+    }
+
+    // The frame is parsed once and the parser data is shared by all the hooks. Parsing may stop
+    // below the full level for a malformed frame, so each hook verifies the level it requires.
+    (void)nrf_802154_frame_parser_data_init(p_frame,
+                                            p_frame[PHR_OFFSET] + PHR_SIZE,
+                                            PARSE_LEVEL_FULL,
+                                            &frame_data);
 
     for (uint32_t i = 0; i < sizeof(m_tx_setup_hooks) / sizeof(m_tx_setup_hooks[0]);
          i++)
@@ -273,7 +311,7 @@ bool nrf_802154_core_hooks_tx_setup(
             break;
         }
 
-        result = m_tx_setup_hooks[i](p_frame, p_params, notify_function);
+        result = m_tx_setup_hooks[i](p_frame, &frame_data, p_params, notify_function);
 
         if (!result)
         {
@@ -284,8 +322,10 @@ bool nrf_802154_core_hooks_tx_setup(
     return result;
 }
 
-void nrf_802154_core_hooks_transmitted(const uint8_t * p_frame)
+bool nrf_802154_core_hooks_transmitted(const uint8_t * p_frame)
 {
+    bool result = true;
+
     for (uint32_t i = 0; i < sizeof(m_transmitted_hooks) / sizeof(m_transmitted_hooks[0]); i++)
     {
         if (m_transmitted_hooks[i] == NULL)
@@ -293,8 +333,15 @@ void nrf_802154_core_hooks_transmitted(const uint8_t * p_frame)
             break;
         }
 
-        m_transmitted_hooks[i](p_frame);
+        result = m_transmitted_hooks[i](p_frame);
+
+        if (!result)
+        {
+            break;
+        }
     }
+
+    return result;
 }
 
 bool nrf_802154_core_hooks_tx_failed(uint8_t * p_frame, nrf_802154_tx_error_t error)
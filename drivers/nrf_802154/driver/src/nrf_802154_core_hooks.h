@@ -101,8 +101,12 @@ bool nrf_802154_core_hooks_tx_setup(
  *
  * @param[in]  p_frame  Pointer to a buffer that contains PHR and PSDU of the frame
  *                      that was transmitted.
+ *
+ * @retval  true   Transmitted event is to be propagated to the MAC layer.
+ * @retval  false  Transmitted event is not to be propagated to the MAC layer. It is handled
+ *                 internally.
  */
-void nrf_802154_core_hooks_transmitted(const uint8_t * p_frame);
+bool nrf_802154_core_hooks_transmitted(const uint8_t * p_frame);
 
 /**
  * @brief Processes hooks for the TX failed event.
@@ -47,6 +47,7 @@
 
 #include "nrf_802154_config.h"
 #include "nrf_802154_debug.h"
+#include "nrf_802154_stats.h"
 #include "nrf_802154_utils.h"
 #include "rsch/nrf_802154_rsch.h"
 #include "platform/nrf_802154_platform_sl_lptimer.h"
@@ -61,6 +62,16 @@
 static volatile uint8_t m_nested_critical_section_counter;          ///< Counter of nested critical sections
 static volatile int8_t  m_nested_critical_section_allowed_priority; ///< Indicator if nested critical sections are currently allowed
 
+#if NRF_802154_STATS_CRITICAL_SECTION_ENABLED
+#define CRITICAL_SECTION_CALLER_GET() NRF_802154_STATS_CRITICAL_SECTION_CALLER_GET()
+
+static uint32_t m_critical_section_start_cycles; ///< Cycle counter value when the outermost critical section was entered
+static uint32_t m_critical_section_caller;       ///< Identifier of the caller that entered the outermost critical section
+static int8_t   m_critical_section_priority;     ///< Priority of the context that entered the outermost critical section
+#else
+#define CRITICAL_SECTION_CALLER_GET() 0U
+#endif
+
 /***************************************************************************************************
  * @section Critical sections management
  **************************************************************************************************/
@@ -108,7 +119,15 @@ static int8_t active_vector_priority_get(void)
     return active_priority_convert(nrf_802154_critical_section_active_vector_priority_get());
 }
 
-static bool critical_section_enter(bool forced)
+/** @brief Enter critical section of the driver
+ *
+ * @param[in]  forced  If the critical section is entered regardless of its current state.
+ * @param[in]  caller  Identifier of the caller, used by the critical section statistics.
+ *
+ * @retval true   The critical section is entered.
+ * @retval false  The critical section could not be entered.
+ */
+static bool critical_section_enter(bool forced, uint32_t caller)
 {
     bool                            result = false;
     int8_t                          active_vector_priority;
@@ -134,6 +153,12 @@ static bool critical_section_enter(bool forced)
         {
             nrf_802154_platform_sl_lptimer_critical_section_enter();
             radio_critical_section_enter();
+
+#if NRF_802154_STATS_CRITICAL_SECTION_ENABLED
+            m_critical_section_caller       = caller;
+            m_critical_section_priority     = active_vector_priority;
+            m_critical_section_start_cycles = NRF_802154_STATS_CRITICAL_SECTION_CYCLES_GET();
+#endif
         }
 
         result = true;
@@ -141,6 +166,10 @@ static bool critical_section_enter(bool forced)
 
     nrf_802154_mcu_critical_exit(mcu_cs);
 
+#if !NRF_802154_STATS_CRITICAL_SECTION_ENABLED
+    (void)caller;
+#endif
+
     return result;
 }
 
@@ -173,6 +202,13 @@ static void critical_section_exit(void)
 
             radio_critical_section_exit();
             nrf_802154_platform_sl_lptimer_critical_section_exit();
+
+#if NRF_802154_STATS_CRITICAL_SECTION_ENABLED
+            nrf_802154_stat_critical_section_account(
+                NRF_802154_STATS_CRITICAL_SECTION_CYCLES_GET() - m_critical_section_start_cycles,
+                m_critical_section_caller,
+                m_critical_section_priority);
+#endif
         }
 
         m_nested_critical_section_counter = cnt;
@@ -201,7 +237,7 @@ bool nrf_802154_critical_section_enter(void)
 
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-    result = critical_section_enter(false);
+    result = critical_section_enter(false, CRITICAL_SECTION_CALLER_GET());
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 
@@ -214,7 +250,7 @@ void nrf_802154_critical_section_forcefully_enter(void)
 
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-    critical_section_entered = critical_section_enter(true);
+    critical_section_entered = critical_section_enter(true, CRITICAL_SECTION_CALLER_GET());
     assert(critical_section_entered);
     (void)critical_section_entered;
 
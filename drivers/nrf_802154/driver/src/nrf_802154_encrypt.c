@@ -40,7 +40,9 @@
 #include "nrf_802154_aes_ccm.h"
 #include "nrf_802154_const.h"
 #include "nrf_802154_pib.h"
+#include "nrf_802154_stats.h"
 #include "nrf_802154_types_internal.h"
+#include "mac_features/nrf_802154_filter.h"
 #include "mac_features/nrf_802154_frame_parser.h"
 #include "mac_features/nrf_802154_security_pib.h"
 
@@ -171,21 +173,22 @@ bool aes_ccm_data_key_prepare(const nrf_802154_frame_parser_data_t * p_frame_dat
  * @brief Generates a CCM nonce.
  *
  * @param[in]  p_frame_data   Pointer to the frame parser data.
+ * @param[in]  p_src_addr     Pointer to the extended address of the frame originator.
  * @param[out] p_nonce        Pointer to the buffer to be filled with generated nonce.
  *
  * @retval  true   Nonce was generated successfully.
  * @retval  false  Nonce could not be generated.
  */
 bool aes_ccm_nonce_generate(const nrf_802154_frame_parser_data_t * p_frame_data,
+                            const uint8_t                        * p_src_addr,
                             uint8_t                              * p_nonce)
 {
-    if ((p_frame_data == NULL) || (p_nonce == NULL))
+    if ((p_frame_data == NULL) || (p_src_addr == NULL) || (p_nonce == NULL))
     {
         return false;
     }
 
-    const uint8_t * p_src_addr = nrf_802154_pib_extended_address_get();
-    uint8_t         offset     = 0;
+    uint8_t offset = 0;
 
     memcpy_rev(p_nonce, p_src_addr, EXTENDED_ADDRESS_SIZE);
     offset += EXTENDED_ADDRESS_SIZE;
@@ -249,16 +252,64 @@ bool aes_ccm_data_a_data_and_m_data_prepare(
     return result;
 }
 
+/**
+ * @brief Gets the extended address of the identity of this node that originates a frame.
+ *
+ * The identity is selected by the source address of the frame. The primary identity is used
+ * if no identity matches the source address.
+ *
+ * @param[in]  p_frame_data  Pointer to the frame parser data.
+ *
+ * @return Pointer to the extended address of the originating identity.
+ */
+static const uint8_t * tx_src_extended_addr_get(
+    const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+#if NRF_802154_SECONDARY_IDENTITIES > 0
+    const uint8_t * p_src_addr = nrf_802154_frame_parser_src_addr_get(p_frame_data);
+
+    if (p_src_addr != NULL)
+    {
+        bool    extended  = nrf_802154_frame_parser_src_addr_is_extended(p_frame_data);
+        uint8_t addr_size = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+
+        for (uint8_t identity = 0U; identity < NRF_802154_PIB_IDENTITIES_NUM; identity++)
+        {
+            const uint8_t * p_own_addr;
+
+            if (!nrf_802154_pib_identity_is_used(identity))
+            {
+                continue;
+            }
+
+            p_own_addr = extended ? nrf_802154_pib_identity_extended_address_get(identity) :
+                         nrf_802154_pib_identity_short_address_get(identity);
+
+            if (0 == memcmp(p_src_addr, p_own_addr, addr_size))
+            {
+                return nrf_802154_pib_identity_extended_address_get(identity);
+            }
+        }
+    }
+#else
+    (void)p_frame_data;
+#endif
+
+    return nrf_802154_pib_extended_address_get();
+}
+
 /**
  * @brief Prepares data for AES CCM transformation.
  *
  * @param[in]   p_frame_data     Pointer to the frame parser data.
+ * @param[in]   p_src_addr       Pointer to the extended address of the frame originator.
  * @param[out]  p_aes_ccm_data   Pointer to AES CCM transformation data to be filled.
  *
  * @retval  true    AES CCM transformation data was prepared successfully.
  * @retval  false   AES CCM transformation could not be prepared.
  */
 static bool aes_ccm_data_content_prepare(const nrf_802154_frame_parser_data_t * p_frame_data,
+                                         const uint8_t                        * p_src_addr,
                                          nrf_802154_aes_ccm_data_t            * p_aes_ccm_data)
 {
     bool retval = false;
@@ -271,7 +322,7 @@ static bool aes_ccm_data_content_prepare(const nrf_802154_frame_parser_data_t *
             break;
         }
 
-        if (!aes_ccm_nonce_generate(p_frame_data, p_aes_ccm_data->nonce))
+        if (!aes_ccm_nonce_generate(p_frame_data, p_src_addr, p_aes_ccm_data->nonce))
         {
             // Return immediately if nonce could not be generated
             break;
@@ -306,14 +357,25 @@ bool nrf_802154_encrypt_ack_prepare(const nrf_802154_frame_parser_data_t * p_ack
     {
         success = true;
     }
-    else if (aes_ccm_data_content_prepare(p_ack_data, &aes_ccm_data))
-    {
-        // Algorithm's inputs prepared. Schedule transformation
-        success = nrf_802154_aes_ccm_transform_prepare(&aes_ccm_data);
-    }
     else
     {
-        // Intentionally empty
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+        uint32_t start_cycles = nrf_802154_stat_histogram_cycles_get();
+#endif
+
+        if (aes_ccm_data_content_prepare(p_ack_data,
+                                         nrf_802154_pib_identity_extended_address_get(
+                                             nrf_802154_filter_matched_identity_get()),
+                                         &aes_ccm_data))
+        {
+            // Algorithm's inputs prepared. Schedule transformation
+            success = nrf_802154_aes_ccm_transform_prepare(&aes_ccm_data);
+        }
+
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+        nrf_802154_stat_histogram_sample(ack_security_prepare_cycles,
+                                         nrf_802154_stat_histogram_cycles_get() - start_cycles);
+#endif
     }
 
     return success;
@@ -326,6 +388,7 @@ void nrf_802154_encrypt_ack_reset(void)
 
 bool nrf_802154_encrypt_tx_setup(
     uint8_t                                 * p_frame,
+    const nrf_802154_frame_parser_data_t    * p_frame_data,
     nrf_802154_transmit_params_t            * p_params,
     nrf_802154_transmit_failed_notification_t notify_function)
 {
@@ -337,23 +400,19 @@ bool nrf_802154_encrypt_tx_setup(
         return true;
     }
 
-    nrf_802154_frame_parser_data_t frame_data;
-    nrf_802154_aes_ccm_data_t      aes_ccm_data;
-    bool                           success = false;
+    nrf_802154_aes_ccm_data_t aes_ccm_data;
+    bool                      success = false;
 
-    success = nrf_802154_frame_parser_data_init(p_frame,
-                                                p_frame[PHR_OFFSET] + PHR_SIZE,
-                                                PARSE_LEVEL_FULL,
-                                                &frame_data);
-    assert(success);
-    (void)success;
+    assert(nrf_802154_frame_parser_parse_level_get(p_frame_data) == PARSE_LEVEL_FULL);
 
-    if (!nrf_802154_frame_parser_security_enabled_bit_is_set(&frame_data) ||
-        (nrf_802154_frame_parser_sec_ctrl_sec_lvl_get(&frame_data) == SECURITY_LEVEL_NONE))
+    if (!nrf_802154_frame_parser_security_enabled_bit_is_set(p_frame_data) ||
+        (nrf_802154_frame_parser_sec_ctrl_sec_lvl_get(p_frame_data) == SECURITY_LEVEL_NONE))
     {
         success = true;
     }
-    else if (aes_ccm_data_content_prepare(&frame_data, &aes_ccm_data))
+    else if (aes_ccm_data_content_prepare(p_frame_data,
+                                          tx_src_extended_addr_get(p_frame_data),
+                                          &aes_ccm_data))
     {
         // Algorithm's inputs prepared. Schedule transformation
         success = nrf_802154_aes_ccm_transform_prepare(&aes_ccm_data);
@@ -403,3 +462,101 @@ void nrf_802154_encrypt_tx_ack_failed_hook(uint8_t * p_ack, nrf_802154_tx_error_
 
     nrf_802154_aes_ccm_transform_abort(p_ack);
 }
+
+#if NRF_802154_RX_DECRYPTION_ENABLED
+
+/**
+ * @brief Checks if the MAC payload of a received frame is long enough to hold its MIC.
+ *
+ * @param[in]  p_frame_data  Pointer to the frame parser data.
+ *
+ * @retval  true   The MAC payload holds the MIC and the open payload, if any.
+ * @retval  false  The frame is malformed.
+ */
+static bool rx_mac_payload_length_is_valid(const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+    uint8_t min_len = nrf_802154_frame_parser_mic_size_get(p_frame_data);
+
+    if (nrf_802154_frame_parser_mac_payload_offset_get(p_frame_data) ==
+        NRF_802154_FRAME_PARSER_INVALID_OFFSET)
+    {
+        return false;
+    }
+
+    if ((nrf_802154_frame_parser_frame_type_get(p_frame_data) == FRAME_TYPE_COMMAND) &&
+        (!frame_version_is_2015_or_above(p_frame_data)))
+    {
+        min_len += MAC_CMD_COMMAND_ID_SIZE;
+    }
+
+    return nrf_802154_frame_parser_mac_payload_length_get(p_frame_data) >= min_len;
+}
+
+void nrf_802154_encrypt_rx_frame_decrypt(uint8_t                        * p_data,
+                                         nrf_802154_received_metadata_t * p_metadata)
+{
+    nrf_802154_frame_parser_data_t      frame_data;
+    nrf_802154_aes_ccm_data_t           aes_ccm_data;
+    nrf_802154_aes_ccm_inverse_result_t result;
+    const uint8_t                     * p_mic;
+
+    if (p_metadata->security_status != NRF_802154_RX_SECURITY_STATUS_NOT_PROCESSED)
+    {
+        return;
+    }
+
+    if (!nrf_802154_frame_parser_data_init(p_data,
+                                           p_data[PHR_OFFSET] + PHR_SIZE,
+                                           PARSE_LEVEL_FULL,
+                                           &frame_data))
+    {
+        return;
+    }
+
+    // The nonce contains the extended address of the originator, which is not known otherwise
+    if (!nrf_802154_frame_parser_src_addr_is_extended(&frame_data) ||
+        !rx_mac_payload_length_is_valid(&frame_data))
+    {
+        return;
+    }
+
+    if (!aes_ccm_data_key_prepare(&frame_data, &aes_ccm_data))
+    {
+        p_metadata->security_status = NRF_802154_RX_SECURITY_STATUS_KEY_NOT_FOUND;
+        return;
+    }
+
+    if (!aes_ccm_nonce_generate(&frame_data,
+                                nrf_802154_frame_parser_src_addr_get(&frame_data),
+                                aes_ccm_data.nonce) ||
+        !aes_ccm_data_a_data_and_m_data_prepare(&frame_data, &aes_ccm_data))
+    {
+        return;
+    }
+
+    aes_ccm_data.mic_level = mic_level_from_security_level_get(
+        nrf_802154_frame_parser_sec_ctrl_sec_lvl_get(&frame_data));
+    aes_ccm_data.raw_frame = p_data;
+
+    p_mic = p_data + PHR_SIZE + p_data[PHR_OFFSET] - FCS_SIZE -
+            nrf_802154_frame_parser_mic_size_get(&frame_data);
+
+    result = nrf_802154_aes_ccm_inverse_transform(&aes_ccm_data, p_mic);
+
+    switch (result)
+    {
+        case NRF_802154_AES_CCM_INVERSE_VERIFIED:
+            p_metadata->security_status = NRF_802154_RX_SECURITY_STATUS_VERIFIED;
+            break;
+
+        case NRF_802154_AES_CCM_INVERSE_AUTH_FAILED:
+            p_metadata->security_status = NRF_802154_RX_SECURITY_STATUS_AUTH_FAILED;
+            break;
+
+        default:
+            // The frame is passed to the higher layer as it was received
+            break;
+    }
+}
+
+#endif // NRF_802154_RX_DECRYPTION_ENABLED
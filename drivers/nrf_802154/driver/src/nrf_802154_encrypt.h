@@ -38,6 +38,8 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "nrf_802154_config.h"
+#include "nrf_802154_types.h"
 #include "nrf_802154_types_internal.h"
 #include "mac_features/nrf_802154_frame_parser.h"
 
@@ -64,6 +66,7 @@ void nrf_802154_encrypt_ack_reset(void);
  *
  * @param[in]  p_frame          Pointer to the buffer that contains the PHR and PSDU
  *                              of the transmitted frame.
+ * @param[in]  p_frame_data     Pointer to the parser data of @p p_frame.
  * @param[in]  p_params         Pointer to the transmission parameters.
  * @param[in]  notify_function  Function to be called to notify transmission failure.
  *
@@ -72,6 +75,7 @@ void nrf_802154_encrypt_ack_reset(void);
  */
 bool nrf_802154_encrypt_tx_setup(
     uint8_t                                 * p_frame,
+    const nrf_802154_frame_parser_data_t    * p_frame_data,
     nrf_802154_transmit_params_t            * p_params,
     nrf_802154_transmit_failed_notification_t notify_function);
 
@@ -117,4 +121,21 @@ bool nrf_802154_encrypt_tx_failed_hook(uint8_t * p_frame, nrf_802154_tx_error_t
  */
 void nrf_802154_encrypt_tx_ack_failed_hook(uint8_t * p_ack, nrf_802154_tx_error_t error);
 
+#if NRF_802154_RX_DECRYPTION_ENABLED
+
+/**
+ * @brief Decrypts and authenticates a received frame.
+ *
+ * The frame is processed only if @p p_metadata indicates a secured frame that has not been
+ * processed yet. The result is stored in the @c security_status field of @p p_metadata.
+ * The MAC payload of the frame is replaced with the plaintext only if the frame is authentic.
+ *
+ * @param[inout]  p_data      Pointer to a buffer that contains PHR and PSDU of the received frame.
+ * @param[inout]  p_metadata  Pointer to the metadata of the received frame.
+ */
+void nrf_802154_encrypt_rx_frame_decrypt(uint8_t                        * p_data,
+                                         nrf_802154_received_metadata_t * p_metadata);
+
+#endif // NRF_802154_RX_DECRYPTION_ENABLED
+
 #endif /* NRF_802154_ENCRYPT_H_ */
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Module implementing a lock-free multiple-producer single-consumer FIFO queue.
+ */
+
+#include <assert.h>
+
+#include "nrf_802154_mpsc_queue.h"
+#include "nrf_802154_utils.h"
+
+static inline uint8_t increment_modulo(uint8_t v, uint8_t wrap_at_value)
+{
+    v++;
+
+    if (v >= wrap_at_value)
+    {
+        v = 0U;
+    }
+
+    return v;
+}
+
+static inline void * idx2ptr(const nrf_802154_mpsc_queue_t * p_queue, size_t idx)
+{
+    return ((uint8_t *)(p_queue->p_memory)) + idx * p_queue->item_size;
+}
+
+static inline size_t ptr2idx(const nrf_802154_mpsc_queue_t * p_queue, const void * p_item)
+{
+    return ((const uint8_t *)p_item - (const uint8_t *)(p_queue->p_memory)) / p_queue->item_size;
+}
+
+void nrf_802154_mpsc_queue_init(nrf_802154_mpsc_queue_t * p_queue,
+                                void                    * p_memory,
+                                size_t                    memory_size,
+                                size_t                    item_size,
+                                volatile uint8_t        * p_ready)
+{
+    assert(p_queue != NULL);
+    assert(p_memory != NULL);
+    assert(p_ready != NULL);
+    assert(item_size != 0U);
+
+    /* Due uint8_t type of nrf_802154_mpsc_queue_t::item_size */
+    assert(item_size <= UINT8_MAX);
+
+    size_t capacity = memory_size / item_size;
+
+    /* Due simplified design, one entry in p_memory array is lost,
+     * see nrf_802154_mpsc_queue_push_begin */
+    assert(capacity >= 2U);
+
+    /* Due uint8_t type of nrf_802154_mpsc_queue_t::capacity */
+    assert(capacity <= UINT8_MAX);
+
+    for (size_t i = 0U; i < capacity; i++)
+    {
+        p_ready[i] = false;
+    }
+
+    p_queue->p_memory  = p_memory;
+    p_queue->p_ready   = p_ready;
+    p_queue->capacity  = capacity;
+    p_queue->item_size = item_size;
+    p_queue->wridx     = 0U;
+    p_queue->rdidx     = 0U;
+}
+
+void * nrf_802154_mpsc_queue_push_begin(nrf_802154_mpsc_queue_t * p_queue)
+{
+    uint8_t wridx;
+
+    do
+    {
+        wridx = __LDREXB(&p_queue->wridx);
+
+        if (increment_modulo(wridx, p_queue->capacity) == p_queue->rdidx)
+        {
+            // The queue is full.
+            __CLREX();
+            return NULL;
+        }
+    }
+    while (__STREXB(increment_modulo(wridx, p_queue->capacity), &p_queue->wridx));
+
+    __DMB();
+
+    return idx2ptr(p_queue, wridx);
+}
+
+void nrf_802154_mpsc_queue_push_commit(nrf_802154_mpsc_queue_t * p_queue, const void * p_item)
+{
+    // Make the item content visible before the item is marked as ready.
+    __DMB();
+    p_queue->p_ready[ptr2idx(p_queue, p_item)] = true;
+}
+
+void * nrf_802154_mpsc_queue_pop_begin(const nrf_802154_mpsc_queue_t * p_queue)
+{
+    uint8_t rdidx = p_queue->rdidx;
+
+    if (!p_queue->p_ready[rdidx])
+    {
+        return NULL;
+    }
+
+    // Do not read the item content before its ready flag.
+    __DMB();
+
+    return idx2ptr(p_queue, rdidx);
+}
+
+void nrf_802154_mpsc_queue_pop_commit(nrf_802154_mpsc_queue_t * p_queue)
+{
+    uint8_t rdidx = p_queue->rdidx;
+
+    p_queue->p_ready[rdidx] = false;
+
+    // The item can be reserved again only after its ready flag is cleared.
+    __DMB();
+    p_queue->rdidx = increment_modulo(rdidx, p_queue->capacity);
+}
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Module implementing a lock-free multiple-producer single-consumer FIFO queue.
+ */
+
+#ifndef NRF_802154_MPSC_QUEUE_H__
+#define NRF_802154_MPSC_QUEUE_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+/**@brief Type representing a lock-free multiple-producer single-consumer FIFO queue.
+ *
+ * Items can be pushed from any context, including interrupts preempting each other, without
+ * disabling interrupts. Items must be popped from a single context only.
+ */
+typedef struct
+{
+    /**@brief Pointer to items memory of the queue.
+     * @details Memory pointed by this pointer has size @c item_size * @c capacity. */
+    void             * p_memory;
+
+    /**@brief Pointer to flags indicating items that are written and ready to be popped.
+     * @details Memory pointed by this pointer has size @c capacity. */
+    volatile uint8_t * p_ready;
+
+    /**@brief Size of an item in the queue. */
+    uint8_t            item_size;
+
+    /**@brief Maximum number of items that can be stored in the memory of the queue */
+    uint8_t            capacity;
+
+    /**@brief Index in the items memory of the queue where next item is reserved for writing. */
+    volatile uint8_t   wridx;
+
+    /**@brief Index in the items memory of the queue where next item is read. */
+    volatile uint8_t   rdidx;
+} nrf_802154_mpsc_queue_t;
+
+/**@brief Initializes a queue.
+ *
+ * @param[in] p_queue       Pointer to the queue instance to be initialized. Must not be NULL.
+ * @param[in] p_memory      Pointer to a memory that will be used to store items of the queue.
+ *                          Must not be NULL.
+ * @param[in] memory_size   Size of the memory pointed by @p p_memory.
+ *                          This parameter must be no less than 2 * @p item_size
+ * @param[in] item_size     Size of an item of the queue. Must not be 0.
+ * @param[in] p_ready       Pointer to a memory that will be used to store ready flags of the items.
+ *                          Must not be NULL and must have one byte for each item that fits
+ *                          in @p p_memory.
+ */
+void nrf_802154_mpsc_queue_init(nrf_802154_mpsc_queue_t * p_queue,
+                                void                    * p_memory,
+                                size_t                    memory_size,
+                                size_t                    item_size,
+                                volatile uint8_t        * p_ready);
+
+/**@brief Reserves the next item to be written to the queue.
+ *
+ * This function is to be used when writing data to the queue directly (no copy). The item is
+ * reserved atomically, so this function can be called concurrently from multiple contexts.
+ * To write an item to the queue perform following.
+ * @code
+ * my_item_t * p_item = (my_item_t *)nrf_802154_mpsc_queue_push_begin(&queue);
+ *
+ * if (p_item != NULL)
+ * {
+ *     ... p_item is now direct pointer into memory of the queue, fill all data at p_item pointer
+ *     p_item->some_field = some_value;
+ *     nrf_802154_mpsc_queue_push_commit(&queue, p_item);
+ * }
+ * @endcode
+ *
+ * @note Items are popped in the order they were reserved. An item reserved, but not yet
+ *       committed, holds back popping of the items reserved after it.
+ *
+ * @param[in] p_queue        Pointer to the queue instance.
+ *
+ * @return Pointer to the reserved item or NULL if the queue is full.
+ */
+void * nrf_802154_mpsc_queue_push_begin(nrf_802154_mpsc_queue_t * p_queue);
+
+/**@brief Marks an item reserved with @ref nrf_802154_mpsc_queue_push_begin as ready to be popped.
+ *
+ * @param[in] p_queue       Pointer to the queue instance.
+ * @param[in] p_item        Pointer to the item returned by @ref nrf_802154_mpsc_queue_push_begin.
+ */
+void nrf_802154_mpsc_queue_push_commit(nrf_802154_mpsc_queue_t * p_queue, const void * p_item);
+
+/**@brief Returns pointer to the next item to be read from the queue.
+ *
+ * This function is to be used when reading data from the queue directly (no copy).
+ * It must be called from a single context only.
+ *
+ * To read all items from the queue perform following.
+ * @code
+ * my_item_t * p_item;
+ *
+ * while ((p_item = (my_item_t *)nrf_802154_mpsc_queue_pop_begin(&queue)) != NULL)
+ * {
+ *     ... read & process data pointed by p_item
+ *     nrf_802154_mpsc_queue_pop_commit(&queue);
+ * }
+ * @endcode
+ *
+ * @param[in] p_queue        Pointer to the queue instance.
+ *
+ * @return Pointer to the next item to be read or NULL if there is no item ready to be read.
+ */
+void * nrf_802154_mpsc_queue_pop_begin(const nrf_802154_mpsc_queue_t * p_queue);
+
+/**@brief Releases the item returned by @ref nrf_802154_mpsc_queue_pop_begin.
+ *
+ * @param[in] p_queue       Pointer to the queue instance.
+ */
+void nrf_802154_mpsc_queue_pop_commit(nrf_802154_mpsc_queue_t * p_queue);
+
+/**@brief Checks if the queue is empty.
+ *
+ * The queue is not empty if it contains any item reserved for writing, even if the item is not
+ * committed yet.
+ *
+ * @param[in] p_queue       Pointer to the queue instance.
+ *
+ * @retval true   The queue is empty.
+ * @retval false  The queue is not empty.
+ */
+static inline bool nrf_802154_mpsc_queue_is_empty(const nrf_802154_mpsc_queue_t * p_queue)
+{
+    return (p_queue->wridx == p_queue->rdidx);
+}
+
+#endif /* NRF_802154_MPSC_QUEUE_H__ */
@@ -142,6 +142,13 @@ void nrf_802154_notify_energy_detected(uint8_t result);
  */
 void nrf_802154_notify_energy_detection_failed(nrf_802154_ed_error_t error);
 
+/**
+ * @brief Notifies the next higher layer that the multi-channel energy scan procedure ended.
+ *
+ * @param[in]  p_result  Pointer to structure containing the results of the scan.
+ */
+void nrf_802154_notify_energy_scan_done(const nrf_802154_energy_scan_result_t * p_result);
+
 /**
  * @brief Notifies the next higher layer that the CCA procedure ended.
  *
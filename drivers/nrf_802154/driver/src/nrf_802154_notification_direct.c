@@ -49,7 +49,12 @@
 #include "nrf_802154.h"
 #include "nrf_802154_critical_section.h"
 #include "nrf_802154_debug.h"
+#include "nrf_802154_encrypt.h"
+#include "nrf_802154_rx_buffer.h"
 #include "nrf_802154_tx_work_buffer.h"
+#include "mac_features/nrf_802154_beacon_tx.h"
+#include "mac_features/nrf_802154_tx_queue.h"
+#include "mac_features/nrf_802154_indirect_tx.h"
 
 #define RAW_LENGTH_OFFSET  0
 #define RAW_PAYLOAD_OFFSET 1
@@ -63,7 +68,16 @@ void nrf_802154_notify_received(uint8_t * p_data, int8_t power, uint8_t lqi)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-#if NRF_802154_USE_RAW_API
+#if NRF_802154_USE_RAW_API && NRF_802154_RX_METADATA_ENABLED
+    (void)power;
+    (void)lqi;
+
+#if NRF_802154_RX_DECRYPTION_ENABLED
+    nrf_802154_encrypt_rx_frame_decrypt(p_data, nrf_802154_rx_buffer_metadata_get(p_data));
+#endif
+
+    nrf_802154_received_ext(p_data, nrf_802154_rx_buffer_metadata_get(p_data));
+#elif NRF_802154_USE_RAW_API
     nrf_802154_received_raw(p_data, power, lqi);
 #else // NRF_802154_USE_RAW_API
     nrf_802154_received(p_data + RAW_PAYLOAD_OFFSET, p_data[RAW_LENGTH_OFFSET], power, lqi);
@@ -90,9 +104,24 @@ void nrf_802154_notify_transmitted(uint8_t                             * p_frame
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
+#if NRF_802154_BEACON_TX_ENABLED
+    if (nrf_802154_beacon_tx_transmit_done_hook(p_frame))
+    {
+        // Beacons sent by the beacon transmitter are not notified to the higher layer.
+        nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+        return;
+    }
+#endif
+
     // Update the transmitted frame contents and update frame status flags
     nrf_802154_tx_work_buffer_original_frame_update(p_frame,
                                                     &p_metadata->frame_props);
+#if NRF_802154_TX_QUEUE_ENABLED
+    nrf_802154_tx_queue_transmit_done_hook(p_frame);
+#endif
+#if NRF_802154_INDIRECT_TX_ENABLED
+    nrf_802154_indirect_tx_transmit_done_hook(p_frame);
+#endif
     // Notify
 #if NRF_802154_USE_RAW_API
     nrf_802154_transmitted_raw(p_frame, p_metadata);
@@ -106,6 +135,10 @@ void nrf_802154_notify_transmitted(uint8_t                             * p_frame
     nrf_802154_transmitted(p_frame + RAW_PAYLOAD_OFFSET, p_metadata);
 #endif // NRF_802154_USE_RAW_API
 
+#if NRF_802154_TX_QUEUE_ENABLED
+    nrf_802154_tx_queue_next_transmit();
+#endif
+
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
@@ -115,6 +148,21 @@ void nrf_802154_notify_transmit_failed(uint8_t
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
+#if NRF_802154_BEACON_TX_ENABLED
+    if (nrf_802154_beacon_tx_transmit_done_hook(p_frame))
+    {
+        // Beacons sent by the beacon transmitter are not notified to the higher layer.
+        nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+        return;
+    }
+#endif
+
+#if NRF_802154_TX_QUEUE_ENABLED
+    nrf_802154_tx_queue_transmit_done_hook(p_frame);
+#endif
+#if NRF_802154_INDIRECT_TX_ENABLED
+    nrf_802154_indirect_tx_transmit_done_hook(p_frame);
+#endif
     // Notify
 #if NRF_802154_USE_RAW_API
     nrf_802154_transmit_failed(p_frame, error, p_metadata);
@@ -122,6 +170,10 @@ void nrf_802154_notify_transmit_failed(uint8_t
     nrf_802154_transmit_failed(p_frame + RAW_PAYLOAD_OFFSET, error, p_metadata);
 #endif  // NRF_802154_USE_RAW_API
 
+#if NRF_802154_TX_QUEUE_ENABLED
+    nrf_802154_tx_queue_next_transmit();
+#endif
+
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
@@ -151,6 +203,15 @@ void nrf_802154_notify_energy_detection_failed(nrf_802154_ed_error_t error)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
+void nrf_802154_notify_energy_scan_done(const nrf_802154_energy_scan_result_t * p_result)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    nrf_802154_energy_scan_done(p_result);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
 void nrf_802154_notify_cca(bool is_free)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
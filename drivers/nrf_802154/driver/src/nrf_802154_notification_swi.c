@@ -49,13 +49,21 @@
 
 #include "nrf_802154.h"
 #include "nrf_802154_config.h"
+#include "nrf_802154_critical_section.h"
 #include "nrf_802154_debug.h"
-#include "nrf_802154_queue.h"
+#include "nrf_802154_encrypt.h"
+#include "nrf_802154_mpsc_queue.h"
+#include "nrf_802154_rx_buffer.h"
+#include "nrf_802154_stats.h"
 #include "nrf_802154_swi.h"
 #include "nrf_802154_tx_work_buffer.h"
 #include "nrf_802154_utils.h"
 #include "hal/nrf_egu.h"
+#include "platform/nrf_802154_irq.h"
 #include "rsch/nrf_802154_rsch.h"
+#include "mac_features/nrf_802154_beacon_tx.h"
+#include "mac_features/nrf_802154_tx_queue.h"
+#include "mac_features/nrf_802154_indirect_tx.h"
 
 #define RAW_PAYLOAD_OFFSET 1
 #define RAW_LENGTH_OFFSET  0
@@ -72,8 +80,9 @@
  *  - DRX timeout notifications
  *  - frame received notifications for each receive buffer.
  */
-#define NTF_PRIMARY_POOL_SIZE \
-    (NRF_802154_RX_BUFFERS + NRF_802154_RSCH_DLY_TS_OP_DRX_SLOTS + 3)
+#define NTF_PRIMARY_POOL_SIZE                              \
+    (NRF_802154_RX_BUFFERS + NRF_802154_RX_BUFFERS_SHORT + \
+     NRF_802154_RSCH_DLY_TS_OP_DRX_SLOTS + 3)
 
 /**
  * The implementation uses 8-bit integers to address slots with the oldest bit
@@ -125,6 +134,7 @@ typedef enum
     NTF_TYPE_TRANSMIT_FAILED,         ///< Frame transmission failure
     NTF_TYPE_ENERGY_DETECTED,         ///< Energy detection procedure ended
     NTF_TYPE_ENERGY_DETECTION_FAILED, ///< Energy detection procedure failed
+    NTF_TYPE_ENERGY_SCAN_DONE,        ///< Energy scan procedure ended
     NTF_TYPE_CCA,                     ///< CCA procedure ended
     NTF_TYPE_CCA_FAILED,              ///< CCA procedure failed
 } nrf_802154_ntf_type_t;
@@ -134,6 +144,9 @@ typedef struct
 {
     volatile uint8_t      taken; ///< Indicates if the slot is available.
     nrf_802154_ntf_type_t type;  ///< Notification type.
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+    uint32_t              time;  ///< Time when the notification was enqueued.
+#endif
 
     union
     {
@@ -179,6 +192,11 @@ typedef struct
             nrf_802154_ed_error_t error; ///< An error code that indicates reason of the failure.
         } energy_detection_failed;       ///< Energy detection failure details.
 
+        struct
+        {
+            nrf_802154_energy_scan_result_t result; ///< Energy scan result.
+        } energy_scan_done;                         ///< Energy scan details.
+
         struct
         {
             bool result; ///< CCA result.
@@ -200,10 +218,13 @@ typedef struct
 static nrf_802154_ntf_data_t m_primary_ntf_pool[NTF_PRIMARY_POOL_SIZE];
 static nrf_802154_ntf_data_t m_secondary_ntf_pool[NTF_SECONDARY_POOL_SIZE];
 
-static nrf_802154_queue_t       m_notifications_queue;
+static nrf_802154_mpsc_queue_t  m_notifications_queue;
 static nrf_802154_queue_entry_t m_notifications_queue_memory[NTF_QUEUE_SIZE];
+static volatile uint8_t         m_notifications_queue_ready[NTF_QUEUE_SIZE];
 
-static volatile nrf_802154_mcu_critical_state_t m_mcu_cs;
+#if NRF_802154_NOTIFICATION_HYBRID_ENABLED
+static volatile bool m_ntf_processing; ///< If a notification is being passed to the higher layer.
+#endif
 
 /** @brief Allocate notification slot from the specified pool.
  *
@@ -255,48 +276,179 @@ static void ntf_slot_free(nrf_802154_ntf_data_t * p_slot)
     p_slot->taken = false;
 }
 
-/**
- * Enter notify block.
+/** @brief Get a slot from its identifier.
  *
- * This is a helper function used in all notification functions to atomically
- * find an empty slot in the notification queue and allow atomic slot update.
+ * @param[in]  slot_id  Identifier of the pool and a slot within.
  *
- * @return Pointer to an empty slot in the notification queue.
+ * @return  Pointer to the slot.
  */
-static nrf_802154_queue_entry_t * ntf_enter(void)
+static nrf_802154_ntf_data_t * ntf_slot_get(uint8_t slot_id)
 {
-    nrf_802154_mcu_critical_enter(m_mcu_cs);
-
-    assert(!nrf_802154_queue_is_full(&m_notifications_queue));
+    uint8_t idx = slot_id & (~NTF_POOL_ID_MASK);
 
-    return nrf_802154_queue_push_begin(&m_notifications_queue);
+    return (slot_id & NTF_POOL_ID_MASK) ? &m_primary_ntf_pool[idx] : &m_secondary_ntf_pool[idx];
 }
 
-/**
- * Exit notify block.
+/** @brief Pass a notification from a slot to the next higher layer.
  *
- * This is a helper function used in all notification functions to end atomic slot update
- * and trigger SWI to process the notification from the slot.
+ * @param[in]  p_slot  Pointer to the slot containing the notification.
  */
-static void ntf_exit(void)
+static void ntf_slot_process(nrf_802154_ntf_data_t * p_slot)
 {
-    nrf_802154_queue_push_commit(&m_notifications_queue);
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+    if ((p_slot->type == NTF_TYPE_RECEIVED) || (p_slot->type == NTF_TYPE_TRANSMITTED))
+    {
+        nrf_802154_stat_histogram_sample(notification_latency,
+                                         nrf_802154_stat_histogram_time_get() - p_slot->time);
+    }
+#endif
 
-    nrf_egu_task_trigger(NRF_802154_EGU_INSTANCE, NTF_TASK);
+    switch (p_slot->type)
+    {
+        case NTF_TYPE_RECEIVED:
+#if NRF_802154_USE_RAW_API && NRF_802154_RX_METADATA_ENABLED
+#if NRF_802154_RX_DECRYPTION_ENABLED
+            nrf_802154_encrypt_rx_frame_decrypt(
+                p_slot->data.received.p_data,
+                nrf_802154_rx_buffer_metadata_get(p_slot->data.received.p_data));
+#endif
+            nrf_802154_received_ext(
+                p_slot->data.received.p_data,
+                nrf_802154_rx_buffer_metadata_get(p_slot->data.received.p_data));
+#elif NRF_802154_USE_RAW_API
+            nrf_802154_received_raw(p_slot->data.received.p_data,
+                                    p_slot->data.received.power,
+                                    p_slot->data.received.lqi);
+#else // NRF_802154_USE_RAW_API
+            nrf_802154_received(p_slot->data.received.p_data + RAW_PAYLOAD_OFFSET,
+                                p_slot->data.received.p_data[RAW_LENGTH_OFFSET],
+                                p_slot->data.received.power,
+                                p_slot->data.received.lqi);
+#endif
+            break;
+
+        case NTF_TYPE_RECEIVE_FAILED:
+            nrf_802154_receive_failed(p_slot->data.receive_failed.error,
+                                      p_slot->data.receive_failed.id);
+            break;
+
+        case NTF_TYPE_TRANSMITTED:
+        {
+#if NRF_802154_USE_RAW_API
+            nrf_802154_transmitted_raw(p_slot->data.transmitted.p_frame,
+                                       &p_slot->data.transmitted.metadata);
+#else // NRF_802154_USE_RAW_API
+            if (p_slot->data.transmitted.metadata.data.transmitted.p_ack != NULL)
+            {
+                p_slot->data.transmitted.metadata.data.transmitted.length =
+                    p_slot->data.transmitted.metadata.data.transmitted.p_ack[RAW_LENGTH_OFFSET];
+                p_slot->data.transmitted.metadata.data.transmitted.p_ack += RAW_PAYLOAD_OFFSET;
+            }
+            nrf_802154_transmitted(p_slot->data.transmitted.p_frame + RAW_PAYLOAD_OFFSET,
+                                   &p_slot->data.transmitted.metadata);
+#endif
+#if NRF_802154_TX_QUEUE_ENABLED
+            nrf_802154_tx_queue_next_transmit();
+#endif
+        }
+        break;
+
+        case NTF_TYPE_TRANSMIT_FAILED:
+#if NRF_802154_USE_RAW_API
+            nrf_802154_transmit_failed(p_slot->data.transmit_failed.p_frame,
+                                       p_slot->data.transmit_failed.error,
+                                       &p_slot->data.transmit_failed.metadata);
+#else // NRF_802154_USE_RAW_API
+            nrf_802154_transmit_failed(
+                p_slot->data.transmit_failed.p_frame + RAW_PAYLOAD_OFFSET,
+                p_slot->data.transmit_failed.error,
+                &p_slot->data.transmit_failed.metadata);
+#endif
+#if NRF_802154_TX_QUEUE_ENABLED
+            nrf_802154_tx_queue_next_transmit();
+#endif
+            break;
 
-    nrf_802154_mcu_critical_exit(m_mcu_cs);
+        case NTF_TYPE_ENERGY_DETECTED:
+#if (NRF_802154_ENERGY_DETECTED_VERSION != 0)
+            nrf_802154_energy_detected(&p_slot->data.energy_detected.result);
+#else
+            nrf_802154_energy_detected(p_slot->data.energy_detected.result);
+#endif
+            break;
+
+        case NTF_TYPE_ENERGY_DETECTION_FAILED:
+            nrf_802154_energy_detection_failed(
+                p_slot->data.energy_detection_failed.error);
+            break;
+
+        case NTF_TYPE_ENERGY_SCAN_DONE:
+            nrf_802154_energy_scan_done(&p_slot->data.energy_scan_done.result);
+            break;
+
+        case NTF_TYPE_CCA:
+            nrf_802154_cca_done(p_slot->data.cca.result);
+            break;
+
+        case NTF_TYPE_CCA_FAILED:
+            nrf_802154_cca_failed(p_slot->data.cca_failed.error);
+            break;
+
+        default:
+            assert(false);
+    }
+}
+
+#if NRF_802154_NOTIFICATION_HYBRID_ENABLED
+/** @brief Check if a notification can be passed to the next higher layer directly.
+ *
+ * @retval  true   The caller runs at the priority of the notification SWI, no notification is
+ *                 pending and no notification is being passed to the higher layer.
+ * @retval  false  The notification must be deferred to the SWI.
+ */
+static bool ntf_direct_call_is_allowed(void)
+{
+    uint32_t swi_priority =
+        nrf_802154_irq_priority_get(nrfx_get_irq_number(NRF_802154_EGU_INSTANCE));
+
+    return (nrf_802154_critical_section_active_vector_priority_get() == swi_priority) &&
+           !m_ntf_processing &&
+           nrf_802154_mpsc_queue_is_empty(&m_notifications_queue);
 }
 
+#endif // NRF_802154_NOTIFICATION_HYBRID_ENABLED
+
 /** @brief Push notification to the queue.
  *
  * @param[in]  slot_id  Identifier of the pool and a slot within.
  */
 static void ntf_push(uint8_t slot_id)
 {
-    nrf_802154_queue_entry_t * p_entry = ntf_enter();
+#if NRF_802154_NOTIFICATION_HYBRID_ENABLED
+    if (ntf_direct_call_is_allowed())
+    {
+        nrf_802154_ntf_data_t * p_slot = ntf_slot_get(slot_id);
+
+        m_ntf_processing = true;
+        ntf_slot_process(p_slot);
+        m_ntf_processing = false;
+
+        ntf_slot_free(p_slot);
+        return;
+    }
+#endif
+
+    // The queue is lock-free, so notifications can be pushed from any context without
+    // entering a critical section.
+    nrf_802154_queue_entry_t * p_entry =
+        (nrf_802154_queue_entry_t *)nrf_802154_mpsc_queue_push_begin(&m_notifications_queue);
+
+    assert(p_entry != NULL);
 
     p_entry->id = slot_id;
-    ntf_exit();
+    nrf_802154_mpsc_queue_push_commit(&m_notifications_queue, p_entry);
+
+    nrf_egu_task_trigger(NRF_802154_EGU_INSTANCE, NTF_TASK);
 }
 
 /**
@@ -327,6 +479,9 @@ bool swi_notify_received(uint8_t * p_data, int8_t power, uint8_t lqi)
     p_slot->data.received.p_data = p_data;
     p_slot->data.received.power  = power;
     p_slot->data.received.lqi    = lqi;
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+    p_slot->time = nrf_802154_stat_histogram_time_get();
+#endif
 
     ntf_push(slot_id | NTF_PRIMARY_POOL_ID_MASK);
 
@@ -408,6 +563,9 @@ bool swi_notify_transmitted(uint8_t                             * p_frame,
     p_slot->type                      = NTF_TYPE_TRANSMITTED;
     p_slot->data.transmitted.p_frame  = p_frame;
     p_slot->data.transmitted.metadata = *p_metadata;
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+    p_slot->time = nrf_802154_stat_histogram_time_get();
+#endif
 
     ntf_push(slot_id | NTF_PRIMARY_POOL_ID_MASK);
 
@@ -525,6 +683,35 @@ bool swi_notify_energy_detection_failed(nrf_802154_ed_error_t error)
     return true;
 }
 
+/**
+ * @brief Notifies the next higher layer that the energy scan procedure ended from
+ * the SWI priority level.
+ *
+ * @param[in]  p_result  Pointer to structure containing the results of the scan.
+ *
+ * @retval  true   Notification enqueued successfully.
+ * @retval  false  Notification could not be performed.
+ */
+bool swi_notify_energy_scan_done(const nrf_802154_energy_scan_result_t * p_result)
+{
+    uint8_t slot_id = ntf_slot_alloc(m_primary_ntf_pool, NTF_PRIMARY_POOL_SIZE);
+
+    if (slot_id == NTF_INVALID_SLOT_ID)
+    {
+        // No slots are available.
+        return false;
+    }
+
+    nrf_802154_ntf_data_t * p_slot = &m_primary_ntf_pool[slot_id];
+
+    p_slot->type                         = NTF_TYPE_ENERGY_SCAN_DONE;
+    p_slot->data.energy_scan_done.result = *p_result;
+
+    ntf_push(slot_id | NTF_PRIMARY_POOL_ID_MASK);
+
+    return true;
+}
+
 /**
  * @brief Notifies the next higher layer that the Clear Channel Assessment (CCA) procedure ended.
  *
@@ -587,10 +774,11 @@ bool swi_notify_cca_failed(nrf_802154_cca_error_t error)
 
 void nrf_802154_notification_init(void)
 {
-    nrf_802154_queue_init(&m_notifications_queue,
-                          m_notifications_queue_memory,
-                          sizeof(m_notifications_queue_memory),
-                          sizeof(m_notifications_queue_memory[0]));
+    nrf_802154_mpsc_queue_init(&m_notifications_queue,
+                               m_notifications_queue_memory,
+                               sizeof(m_notifications_queue_memory),
+                               sizeof(m_notifications_queue_memory[0]),
+                               m_notifications_queue_ready);
 
     nrf_egu_int_enable(NRF_802154_EGU_INSTANCE, NTF_INT);
 
@@ -626,10 +814,28 @@ void nrf_802154_notify_transmitted(uint8_t                             * p_frame
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
+#if NRF_802154_BEACON_TX_ENABLED
+    if (nrf_802154_beacon_tx_transmit_done_hook(p_frame))
+    {
+        // Beacons sent by the beacon transmitter are not notified to the higher layer.
+        nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+        return;
+    }
+#endif
+
     // Update the transmitted frame contents and update frame status flags
     nrf_802154_tx_work_buffer_original_frame_update(p_frame,
                                                     &p_metadata->frame_props);
 
+#if NRF_802154_TX_QUEUE_ENABLED
+    // The notification may be passed to the higher layer right away, so the queue must be
+    // updated before.
+    nrf_802154_tx_queue_transmit_done_hook(p_frame);
+#endif
+#if NRF_802154_INDIRECT_TX_ENABLED
+    nrf_802154_indirect_tx_transmit_done_hook(p_frame);
+#endif
+
     bool notified = swi_notify_transmitted(p_frame, p_metadata);
 
     // It should always be possible to notify transmission result
@@ -645,6 +851,24 @@ void nrf_802154_notify_transmit_failed(uint8_t
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
+#if NRF_802154_BEACON_TX_ENABLED
+    if (nrf_802154_beacon_tx_transmit_done_hook(p_frame))
+    {
+        // Beacons sent by the beacon transmitter are not notified to the higher layer.
+        nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+        return;
+    }
+#endif
+
+#if NRF_802154_TX_QUEUE_ENABLED
+    // The notification may be passed to the higher layer right away, so the queue must be
+    // updated before.
+    nrf_802154_tx_queue_transmit_done_hook(p_frame);
+#endif
+#if NRF_802154_INDIRECT_TX_ENABLED
+    nrf_802154_indirect_tx_transmit_done_hook(p_frame);
+#endif
+
     bool notified = swi_notify_transmit_failed(p_frame, error, p_metadata);
 
     // It should always be possible to notify transmission result
@@ -690,6 +914,19 @@ void nrf_802154_notify_energy_detection_failed(nrf_802154_ed_error_t error)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
+void nrf_802154_notify_energy_scan_done(const nrf_802154_energy_scan_result_t * p_result)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    bool notified = swi_notify_energy_scan_done(p_result);
+
+    // It should always be possible to notify energy scan result
+    assert(notified);
+    (void)notified;
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
 void nrf_802154_notify_cca(bool is_free)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
@@ -721,94 +958,29 @@ static void irq_handler_ntf_event(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-    while (!nrf_802154_queue_is_empty(&m_notifications_queue))
+    while (true)
     {
         nrf_802154_queue_entry_t * p_entry =
-            (nrf_802154_queue_entry_t *)nrf_802154_queue_pop_begin(&m_notifications_queue);
+            (nrf_802154_queue_entry_t *)nrf_802154_mpsc_queue_pop_begin(&m_notifications_queue);
 
-        uint8_t slot_id = p_entry->id & (~NTF_POOL_ID_MASK);
-
-        nrf_802154_ntf_data_t * p_slot =
-            (p_entry->id & NTF_POOL_ID_MASK) ? &m_primary_ntf_pool[slot_id] :
-            &m_secondary_ntf_pool[slot_id];
-
-        switch (p_slot->type)
+        if (p_entry == NULL)
         {
-            case NTF_TYPE_RECEIVED:
-#if NRF_802154_USE_RAW_API
-                nrf_802154_received_raw(p_slot->data.received.p_data,
-                                        p_slot->data.received.power,
-                                        p_slot->data.received.lqi);
-#else // NRF_802154_USE_RAW_API
-                nrf_802154_received(p_slot->data.received.p_data + RAW_PAYLOAD_OFFSET,
-                                    p_slot->data.received.p_data[RAW_LENGTH_OFFSET],
-                                    p_slot->data.received.power,
-                                    p_slot->data.received.lqi);
-#endif
-                break;
-
-            case NTF_TYPE_RECEIVE_FAILED:
-                nrf_802154_receive_failed(p_slot->data.receive_failed.error,
-                                          p_slot->data.receive_failed.id);
-                break;
-
-            case NTF_TYPE_TRANSMITTED:
-            {
-#if NRF_802154_USE_RAW_API
-                nrf_802154_transmitted_raw(p_slot->data.transmitted.p_frame,
-                                           &p_slot->data.transmitted.metadata);
-#else // NRF_802154_USE_RAW_API
-                if (p_slot->data.transmitted.metadata.data.transmitted.p_ack != NULL)
-                {
-                    p_slot->data.transmitted.metadata.data.transmitted.length =
-                        p_slot->data.transmitted.metadata.data.transmitted.p_ack[RAW_LENGTH_OFFSET];
-                    p_slot->data.transmitted.metadata.data.transmitted.p_ack += RAW_PAYLOAD_OFFSET;
-                }
-                nrf_802154_transmitted(p_slot->data.transmitted.p_frame + RAW_PAYLOAD_OFFSET,
-                                       &p_slot->data.transmitted.metadata);
-#endif
-            }
+            // No more notifications, or the next one is still being pushed. A notification
+            // being pushed triggers NTF_TASK again once it is ready.
             break;
+        }
 
-            case NTF_TYPE_TRANSMIT_FAILED:
-#if NRF_802154_USE_RAW_API
-                nrf_802154_transmit_failed(p_slot->data.transmit_failed.p_frame,
-                                           p_slot->data.transmit_failed.error,
-                                           &p_slot->data.transmit_failed.metadata);
-#else // NRF_802154_USE_RAW_API
-                nrf_802154_transmit_failed(
-                    p_slot->data.transmit_failed.p_frame + RAW_PAYLOAD_OFFSET,
-                    p_slot->data.transmit_failed.error,
-                    &p_slot->data.transmit_failed.metadata);
-#endif
-                break;
+        nrf_802154_ntf_data_t * p_slot = ntf_slot_get(p_entry->id);
 
-            case NTF_TYPE_ENERGY_DETECTED:
-#if (NRF_802154_ENERGY_DETECTED_VERSION != 0)
-                nrf_802154_energy_detected(&p_slot->data.energy_detected.result);
+#if NRF_802154_NOTIFICATION_HYBRID_ENABLED
+        m_ntf_processing = true;
+        ntf_slot_process(p_slot);
+        m_ntf_processing = false;
 #else
-                nrf_802154_energy_detected(p_slot->data.energy_detected.result);
+        ntf_slot_process(p_slot);
 #endif
-                break;
-
-            case NTF_TYPE_ENERGY_DETECTION_FAILED:
-                nrf_802154_energy_detection_failed(
-                    p_slot->data.energy_detection_failed.error);
-                break;
-
-            case NTF_TYPE_CCA:
-                nrf_802154_cca_done(p_slot->data.cca.result);
-                break;
-
-            case NTF_TYPE_CCA_FAILED:
-                nrf_802154_cca_failed(p_slot->data.cca_failed.error);
-                break;
-
-            default:
-                assert(false);
-        }
 
-        nrf_802154_queue_pop_commit(&m_notifications_queue);
+        nrf_802154_mpsc_queue_pop_commit(&m_notifications_queue);
         ntf_slot_free(p_slot);
     }
 
@@ -828,8 +1000,8 @@ void nrf_802154_notification_swi_irq_handler(void)
 #if defined(TEST)
 void nrf_802154_notification_swi_module_reset(void)
 {
-    m_mcu_cs = 0UL;
     memset(&m_notifications_queue_memory, 0U, sizeof(m_notifications_queue_memory));
+    memset((void *)m_notifications_queue_ready, 0U, sizeof(m_notifications_queue_ready));
     memset(&m_notifications_queue, 0U, sizeof(m_notifications_queue));
 }
 
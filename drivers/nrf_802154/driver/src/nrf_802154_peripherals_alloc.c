@@ -40,6 +40,9 @@
  * Bitmasks currently provided applies to:
  *   - PPI or DPPI channels (g_nrf_802154_used_nrf_ppi_channels)
  *   - PPI or DPPI channel groups (g_nrf_802154_used_nrf_ppi_groups)
+ *
+ * The bitmasks are also verified at build time against MPSL reserved resources and against
+ * nrfx driver instances enabled in nrfx_config.h, when requested.
  */
 
 #include "nrf_802154_peripherals.h"
@@ -75,3 +78,19 @@ const uint32_t g_nrf_802154_used_nrf_ppi_groups   = NRF_802154_PPI_GR_USED_MSK;
 #endif
 
 #endif // NRF_802154_VERIFY_PERIPHS_ALLOC_AGAINST_MPSL
+
+#if NRF_802154_VERIFY_PERIPHS_ALLOC_AGAINST_NRFX
+
+#if ((NRFX_ENABLED_INSTANCES_MASK(TIMER) & NRF_802154_TIMERS_USED_MASK) != 0UL)
+#error nrfx TIMER driver instances enabled in nrfx_config.h overlap with 802.15.4 driver timers
+#endif
+
+#if ((NRFX_ENABLED_INSTANCES_MASK(RTC) & NRF_802154_RTC_USED_MASK) != 0UL)
+#error nrfx RTC driver instances enabled in nrfx_config.h overlap with 802.15.4 driver RTCs
+#endif
+
+#if ((NRFX_ENABLED_INSTANCES_MASK(EGU) & NRF_802154_EGU_USED_MASK) != 0UL)
+#error nrfx EGU driver instances enabled in nrfx_config.h overlap with 802.15.4 driver EGUs
+#endif
+
+#endif // NRF_802154_VERIFY_PERIPHS_ALLOC_AGAINST_NRFX
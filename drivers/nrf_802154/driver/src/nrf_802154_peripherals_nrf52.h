@@ -207,6 +207,34 @@ extern "C" {
 #define NRF_802154_PPI_RADIO_CCABUSY_TO_RADIO_CCASTART NRF_PPI_CHANNEL10
 #endif
 
+/**
+ * @def NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_DISABLE
+ *
+ * The PPI channel that connects TIMER_COMPARE event to RADIO_DISABLE task. This PPI is used to
+ * end the ACK wait window.
+ *
+ * @note This option is used when @ref NRF_802154_ACK_TIMEOUT_HW_WINDOW_ENABLED is enabled.
+ *       The peripheral is shared with @ref NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_TXEN.
+ *
+ */
+#ifndef NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_DISABLE
+#define NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_DISABLE NRF_PPI_CHANNEL9
+#endif
+
+/**
+ * @def NRF_802154_PPI_RADIO_ADDRESS_TO_TIMER_STOP
+ *
+ * The PPI channel that connects RADIO_ADDRESS event to TIMER_STOP task. This PPI is used to keep
+ * the ACK wait window open when an ACK has started being received.
+ *
+ * @note This option is used when @ref NRF_802154_ACK_TIMEOUT_HW_WINDOW_ENABLED is enabled.
+ *       The peripheral is shared with @ref NRF_802154_PPI_RADIO_CCABUSY_TO_RADIO_CCASTART.
+ *
+ */
+#ifndef NRF_802154_PPI_RADIO_ADDRESS_TO_TIMER_STOP
+#define NRF_802154_PPI_RADIO_ADDRESS_TO_TIMER_STOP NRF_PPI_CHANNEL10
+#endif
+
 /**
  * @def NRF_802154_PPI_RADIO_SYNC_TO_EGU_SYNC
  *
@@ -309,6 +337,8 @@ extern "C" {
                                            (1 << NRF_802154_PPI_RADIO_CCAIDLE_TO_FEM_GPIOTE) |      \
                                            (1 << NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_TXEN) |      \
                                            (1 << NRF_802154_PPI_RADIO_CCABUSY_TO_RADIO_CCASTART) |  \
+                                           (1 << NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_DISABLE) |   \
+                                           (1 << NRF_802154_PPI_RADIO_ADDRESS_TO_TIMER_STOP) |      \
                                            NRF_802154_DISABLE_BCC_MATCHING_PPI_CHANNELS_USED_MASK | \
                                            NRF_802154_TIMESTAMP_PPI_CHANNELS_USED_MASK |            \
                                            NRF_802154_DEBUG_PPI_CHANNELS_USED_MASK)
@@ -238,6 +238,31 @@ extern "C" {
 #define NRF_802154_DPPI_RADIO_CCABUSY 14U
 #endif
 
+/**
+ * @def NRF_802154_DPPI_TIMER_COMPARE_TO_RADIO_DISABLE
+ *
+ * The DPPI channel that connects TIMER_COMPARE event to RADIO_DISABLE task. This DPPI is used to
+ * end the ACK wait window.
+ *
+ * @note This option is used when @ref NRF_802154_ACK_TIMEOUT_HW_WINDOW_ENABLED is enabled.
+ *
+ */
+#ifndef NRF_802154_DPPI_TIMER_COMPARE_TO_RADIO_DISABLE
+#define NRF_802154_DPPI_TIMER_COMPARE_TO_RADIO_DISABLE 16U
+#endif
+
+/**
+ * @def NRF_802154_DPPI_ACK_WAIT_WINDOW_USED_MASK
+ *
+ * Helper bit mask of DPPI channels used by the 802.15.4 driver for the ACK wait window.
+ */
+#if NRF_802154_ACK_TIMEOUT_HW_WINDOW_ENABLED
+#define NRF_802154_DPPI_ACK_WAIT_WINDOW_USED_MASK \
+    (1UL << NRF_802154_DPPI_TIMER_COMPARE_TO_RADIO_DISABLE)
+#else
+#define NRF_802154_DPPI_ACK_WAIT_WINDOW_USED_MASK 0U
+#endif
+
 /**
  * @def NRF_802154_DPPI_RADIO_TEST_MODE_USED_MASK
  *
@@ -286,6 +311,7 @@ extern "C" {
         (1UL << NRF_802154_DPPI_RADIO_CCABUSY) |               \
         (1UL << NRF_802154_DPPI_RADIO_HW_TRIGGER) |            \
         NRF_802154_DPPI_RADIO_TEST_MODE_USED_MASK |            \
+        NRF_802154_DPPI_ACK_WAIT_WINDOW_USED_MASK |            \
         NRF_802154_DPPI_TIMESTAMPS_USED_MASK)
 #endif // NRF_802154_DPPI_CHANNELS_USED_MASK
 
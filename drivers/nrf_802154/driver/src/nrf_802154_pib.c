@@ -48,7 +48,8 @@
 #include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 
-#define CSMACA_BE_MAXIMUM 8 ///< The maximum allowed CSMA-CA backoff exponent (BE) that results from the implementation
+#define CSMACA_BE_MAXIMUM                8 ///< The maximum allowed CSMA-CA backoff exponent (BE) that results from the implementation
+#define CSMACA_MAX_FRAME_RETRIES_MAXIMUM 7 ///< The maximum allowed value of macMaxFrameRetries (see IEEE 802.15.4-2015: 8.4.2.1)
 
 typedef struct
 {
@@ -59,9 +60,10 @@ typedef struct
 #if NRF_802154_CSMA_CA_ENABLED
 typedef struct
 {
-    uint8_t min_be;       // The minimum value of the backoff exponent (BE) in the CSMA-CA algorithm
-    uint8_t max_be;       // The maximum value of the backoff exponent (BE) in the CSMA-CA algorithm
-    uint8_t max_backoffs; // The maximum number of backoffs that the CSMA-CA algorithm will attempt before declaring a channel access failure.
+    uint8_t min_be;            // The minimum value of the backoff exponent (BE) in the CSMA-CA algorithm
+    uint8_t max_be;            // The maximum value of the backoff exponent (BE) in the CSMA-CA algorithm
+    uint8_t max_backoffs;      // The maximum number of backoffs that the CSMA-CA algorithm will attempt before declaring a channel access failure.
+    uint8_t max_frame_retries; // The maximum number of retransmissions of a frame for which no valid ACK was received.
 } nrf_802154_pib_csmaca_t;
 
 #endif  // NRF_802154_CSMA_CA_ENABLED
@@ -84,6 +86,17 @@ typedef struct
 
 #endif  // NRF_802154_TEST_MODES_ENABLED
 
+#if NRF_802154_SECONDARY_IDENTITIES > 0
+typedef struct
+{
+    bool    in_use;                               ///< If the identity is set.
+    uint8_t pan_id[PAN_ID_SIZE];                  ///< Pan Id of the identity.
+    uint8_t short_addr[SHORT_ADDRESS_SIZE];       ///< Short Address of the identity.
+    uint8_t extended_addr[EXTENDED_ADDRESS_SIZE]; ///< Extended Address of the identity.
+} nrf_802154_pib_identity_t;
+
+#endif  // NRF_802154_SECONDARY_IDENTITIES > 0
+
 typedef struct
 {
     int8_t                  tx_power;                             ///< Transmit power.
@@ -112,6 +125,16 @@ typedef struct
 
 #endif
 
+#if NRF_802154_SECONDARY_IDENTITIES > 0
+    nrf_802154_pib_identity_t identities[NRF_802154_SECONDARY_IDENTITIES]; ///< Secondary identities.
+
+#endif
+
+#if NRF_802154_DUAL_CHANNEL_RX_ENABLED
+    uint8_t dual_rx_channel; ///< Secondary channel of the dual-channel reception, 0 if disabled.
+
+#endif
+
 } nrf_802154_pib_data_t;
 
 // Static variables.
@@ -135,6 +158,7 @@ static bool coex_tx_request_mode_is_supported(nrf_802154_coex_tx_request_mode_t
         case NRF_802154_COEX_TX_REQUEST_MODE_CCA_START:
         case NRF_802154_COEX_TX_REQUEST_MODE_CCA_DONE:
         case NRF_802154_COEX_TX_REQUEST_MODE_ON_CCA_TOGGLE:
+        case NRF_802154_COEX_TX_REQUEST_MODE_PREDICTIVE:
             result = true;
             break;
 
@@ -195,9 +219,10 @@ void nrf_802154_pib_init(void)
     m_data.coex.tx_request_mode = NRF_802154_COEX_TX_REQUEST_MODE_ON_CCA_TOGGLE;
 
 #if NRF_802154_CSMA_CA_ENABLED
-    m_data.csmaca.min_be       = NRF_802154_CSMA_CA_MIN_BE_DEFAULT;
-    m_data.csmaca.max_be       = NRF_802154_CSMA_CA_MAX_BE_DEFAULT;
-    m_data.csmaca.max_backoffs = NRF_802154_CSMA_CA_MAX_CSMA_BACKOFFS_DEFAULT;
+    m_data.csmaca.min_be            = NRF_802154_CSMA_CA_MIN_BE_DEFAULT;
+    m_data.csmaca.max_be            = NRF_802154_CSMA_CA_MAX_BE_DEFAULT;
+    m_data.csmaca.max_backoffs      = NRF_802154_CSMA_CA_MAX_CSMA_BACKOFFS_DEFAULT;
+    m_data.csmaca.max_frame_retries = NRF_802154_CSMA_CA_MAX_FRAME_RETRIES_DEFAULT;
 #endif // NRF_802154_CSMA_CA_ENABLED
 
 #if NRF_802154_IFS_ENABLED
@@ -210,6 +235,14 @@ void nrf_802154_pib_init(void)
     m_data.test_modes.csmaca_backoff = NRF_802154_TEST_MODE_CSMACA_BACKOFF_RANDOM;
 #endif
 
+#if NRF_802154_SECONDARY_IDENTITIES > 0
+    memset(m_data.identities, 0, sizeof(m_data.identities));
+#endif
+
+#if NRF_802154_DUAL_CHANNEL_RX_ENABLED
+    m_data.dual_rx_channel = 0U;
+#endif
+
 }
 
 bool nrf_802154_pib_promiscuous_get(void)
@@ -292,6 +325,104 @@ void nrf_802154_pib_short_address_set(const uint8_t * p_short_address)
     memcpy(m_data.short_addr, p_short_address, SHORT_ADDRESS_SIZE);
 }
 
+bool nrf_802154_pib_identity_is_used(uint8_t identity)
+{
+    assert(identity < NRF_802154_PIB_IDENTITIES_NUM);
+
+#if NRF_802154_SECONDARY_IDENTITIES > 0
+    if (identity != NRF_802154_PIB_IDENTITY_PRIMARY)
+    {
+        return m_data.identities[identity - 1U].in_use;
+    }
+#endif
+
+    return true;
+}
+
+const uint8_t * nrf_802154_pib_identity_pan_id_get(uint8_t identity)
+{
+    assert(identity < NRF_802154_PIB_IDENTITIES_NUM);
+
+#if NRF_802154_SECONDARY_IDENTITIES > 0
+    if (identity != NRF_802154_PIB_IDENTITY_PRIMARY)
+    {
+        return m_data.identities[identity - 1U].pan_id;
+    }
+#endif
+
+    return m_data.pan_id;
+}
+
+const uint8_t * nrf_802154_pib_identity_short_address_get(uint8_t identity)
+{
+    assert(identity < NRF_802154_PIB_IDENTITIES_NUM);
+
+#if NRF_802154_SECONDARY_IDENTITIES > 0
+    if (identity != NRF_802154_PIB_IDENTITY_PRIMARY)
+    {
+        return m_data.identities[identity - 1U].short_addr;
+    }
+#endif
+
+    return m_data.short_addr;
+}
+
+const uint8_t * nrf_802154_pib_identity_extended_address_get(uint8_t identity)
+{
+    assert(identity < NRF_802154_PIB_IDENTITIES_NUM);
+
+#if NRF_802154_SECONDARY_IDENTITIES > 0
+    if (identity != NRF_802154_PIB_IDENTITY_PRIMARY)
+    {
+        return m_data.identities[identity - 1U].extended_addr;
+    }
+#endif
+
+    return m_data.extended_addr;
+}
+
+#if NRF_802154_SECONDARY_IDENTITIES > 0
+bool nrf_802154_pib_secondary_identity_set(uint8_t         index,
+                                           const uint8_t * p_pan_id,
+                                           const uint8_t * p_short_address,
+                                           const uint8_t * p_extended_addr)
+{
+    if (index >= NRF_802154_SECONDARY_IDENTITIES)
+    {
+        return false;
+    }
+
+    nrf_802154_pib_identity_t * p_identity = &m_data.identities[index];
+
+    // The identity is marked as not used while being modified, so that the frame filter
+    // never matches a partially updated identity.
+    p_identity->in_use = false;
+    __DMB();
+
+    memcpy(p_identity->pan_id, p_pan_id, PAN_ID_SIZE);
+    memcpy(p_identity->short_addr, p_short_address, SHORT_ADDRESS_SIZE);
+    memcpy(p_identity->extended_addr, p_extended_addr, EXTENDED_ADDRESS_SIZE);
+
+    __DMB();
+    p_identity->in_use = true;
+
+    return true;
+}
+
+bool nrf_802154_pib_secondary_identity_clear(uint8_t index)
+{
+    if (index >= NRF_802154_SECONDARY_IDENTITIES)
+    {
+        return false;
+    }
+
+    m_data.identities[index].in_use = false;
+
+    return true;
+}
+
+#endif // NRF_802154_SECONDARY_IDENTITIES > 0
+
 void nrf_802154_pib_cca_cfg_set(const nrf_802154_cca_cfg_t * p_cca_cfg)
 {
     switch (p_cca_cfg->mode)
@@ -401,6 +532,23 @@ uint8_t nrf_802154_pib_csmaca_max_backoffs_get(void)
     return m_data.csmaca.max_backoffs;
 }
 
+bool nrf_802154_pib_csmaca_max_frame_retries_set(uint8_t max_frame_retries)
+{
+    bool result = (max_frame_retries <= CSMACA_MAX_FRAME_RETRIES_MAXIMUM);
+
+    if (result)
+    {
+        m_data.csmaca.max_frame_retries = max_frame_retries;
+    }
+
+    return result;
+}
+
+uint8_t nrf_802154_pib_csmaca_max_frame_retries_get(void)
+{
+    return m_data.csmaca.max_frame_retries;
+}
+
 #endif // NRF_802154_CSMA_CA_ENABLED
 
 #if NRF_802154_IFS_ENABLED
@@ -460,3 +608,16 @@ void nrf_802154_pib_test_mode_csmaca_backoff_set(nrf_802154_test_mode_csmaca_bac
 }
 
 #endif // NRF_802154_TEST_MODES_ENABLED
+
+#if NRF_802154_DUAL_CHANNEL_RX_ENABLED
+uint8_t nrf_802154_pib_dual_rx_channel_get(void)
+{
+    return m_data.dual_rx_channel;
+}
+
+void nrf_802154_pib_dual_rx_channel_set(uint8_t channel)
+{
+    m_data.dual_rx_channel = channel;
+}
+
+#endif // NRF_802154_DUAL_CHANNEL_RX_ENABLED
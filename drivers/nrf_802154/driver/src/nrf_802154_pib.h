@@ -175,6 +175,89 @@ const uint8_t * nrf_802154_pib_short_address_get(void);
  */
 void nrf_802154_pib_short_address_set(const uint8_t * p_short_address);
 
+/**
+ * @brief Number of identities of this device, including the primary identity.
+ */
+#define NRF_802154_PIB_IDENTITIES_NUM   (1 + NRF_802154_SECONDARY_IDENTITIES)
+
+/**
+ * @brief Index of the primary identity, which is made of the PAN ID, the short address and
+ *        the extended address of this device.
+ *
+ * Secondary identities follow the primary identity, so the secondary identity @c n
+ * has the index @c n+1.
+ */
+#define NRF_802154_PIB_IDENTITY_PRIMARY 0U
+
+/**
+ * @brief Checks if an identity of this device is in use.
+ *
+ * @param[in]  identity  Index of the identity, lower than @ref NRF_802154_PIB_IDENTITIES_NUM.
+ *
+ * @retval  true   The identity is in use. The primary identity is always in use.
+ * @retval  false  The identity is not in use.
+ */
+bool nrf_802154_pib_identity_is_used(uint8_t identity);
+
+/**
+ * @brief Gets the PAN ID of an identity of this device.
+ *
+ * @param[in]  identity  Index of the identity, lower than @ref NRF_802154_PIB_IDENTITIES_NUM.
+ *
+ * @returns Pointer to the buffer containing the PAN ID (2 bytes, little-endian).
+ */
+const uint8_t * nrf_802154_pib_identity_pan_id_get(uint8_t identity);
+
+/**
+ * @brief Gets the short address of an identity of this device.
+ *
+ * @param[in]  identity  Index of the identity, lower than @ref NRF_802154_PIB_IDENTITIES_NUM.
+ *
+ * @returns Pointer to the buffer containing the short address (2 bytes, little-endian).
+ */
+const uint8_t * nrf_802154_pib_identity_short_address_get(uint8_t identity);
+
+/**
+ * @brief Gets the extended address of an identity of this device.
+ *
+ * @param[in]  identity  Index of the identity, lower than @ref NRF_802154_PIB_IDENTITIES_NUM.
+ *
+ * @returns Pointer to the buffer containing the extended address (8 bytes, little-endian).
+ */
+const uint8_t * nrf_802154_pib_identity_extended_address_get(uint8_t identity);
+
+#if NRF_802154_SECONDARY_IDENTITIES > 0
+
+/**
+ * @brief Sets a secondary identity of this device.
+ *
+ * @param[in]  index            Index of the secondary identity, lower than
+ *                              @ref NRF_802154_SECONDARY_IDENTITIES.
+ * @param[in]  p_pan_id         Pointer to the PAN ID (2 bytes, little-endian).
+ * @param[in]  p_short_address  Pointer to the short address (2 bytes, little-endian).
+ * @param[in]  p_extended_addr  Pointer to the extended address (8 bytes, little-endian).
+ *
+ * @retval  true   The secondary identity was set.
+ * @retval  false  The @p index is out of range.
+ */
+bool nrf_802154_pib_secondary_identity_set(uint8_t         index,
+                                           const uint8_t * p_pan_id,
+                                           const uint8_t * p_short_address,
+                                           const uint8_t * p_extended_addr);
+
+/**
+ * @brief Clears a secondary identity of this device.
+ *
+ * @param[in]  index  Index of the secondary identity, lower than
+ *                    @ref NRF_802154_SECONDARY_IDENTITIES.
+ *
+ * @retval  true   The secondary identity was cleared.
+ * @retval  false  The @p index is out of range.
+ */
+bool nrf_802154_pib_secondary_identity_clear(uint8_t index);
+
+#endif // NRF_802154_SECONDARY_IDENTITIES > 0
+
 /**
  * @brief Sets the radio CCA mode and threshold.
  *
@@ -274,6 +357,23 @@ void nrf_802154_pib_csmaca_max_backoffs_set(uint8_t max_backoffs);
  * @return Current maximum number of backoffs.
  */
 uint8_t nrf_802154_pib_csmaca_max_backoffs_get(void);
+
+/**
+ * @brief Sets the maximum number of retransmissions of a frame for which no valid ACK was received.
+ *
+ * @param[in] max_frame_retries  Maximum number of frame retries.
+ *
+ * @retval true   When value provided by @p max_frame_retries does not exceed the limit ( <= 7).
+ * @retval false  Otherwise.
+ */
+bool nrf_802154_pib_csmaca_max_frame_retries_set(uint8_t max_frame_retries);
+
+/**
+ * @brief Gets the maximum number of retransmissions of a frame for which no valid ACK was received.
+ *
+ * @return Current maximum number of frame retries.
+ */
+uint8_t nrf_802154_pib_csmaca_max_frame_retries_get(void);
 #endif // NRF_802154_CSMA_CA_ENABLED
 
 #if NRF_802154_IFS_ENABLED
@@ -342,6 +442,23 @@ void nrf_802154_pib_test_mode_csmaca_backoff_set(nrf_802154_test_mode_csmaca_bac
 
 #endif // NRF_802154_TEST_MODES_ENABLED
 
+#if NRF_802154_DUAL_CHANNEL_RX_ENABLED
+/**
+ * @brief Gets the secondary channel of the dual-channel reception.
+ *
+ * @returns  Secondary channel number, or 0 if the dual-channel reception is disabled.
+ */
+uint8_t nrf_802154_pib_dual_rx_channel_get(void);
+
+/**
+ * @brief Sets the secondary channel of the dual-channel reception.
+ *
+ * @param[in]  channel  Secondary channel number, or 0 to disable the dual-channel reception.
+ */
+void nrf_802154_pib_dual_rx_channel_set(uint8_t channel);
+
+#endif // NRF_802154_DUAL_CHANNEL_RX_ENABLED
+
 #ifdef __cplusplus
 }
 #endif
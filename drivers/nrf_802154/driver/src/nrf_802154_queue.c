@@ -105,6 +105,18 @@ void nrf_802154_queue_pop_commit(nrf_802154_queue_t * p_queue)
     p_queue->rdidx = increment_modulo(p_queue->rdidx, p_queue->capacity);
 }
 
+void * nrf_802154_queue_peek(const nrf_802154_queue_t * p_queue, uint8_t position)
+{
+    size_t count = (p_queue->wridx + p_queue->capacity - p_queue->rdidx) % p_queue->capacity;
+
+    if (position >= count)
+    {
+        return NULL;
+    }
+
+    return idx2ptr(p_queue, (p_queue->rdidx + position) % p_queue->capacity);
+}
+
 bool nrf_802154_queue_is_full(const nrf_802154_queue_t * p_queue)
 {
     size_t wridx;
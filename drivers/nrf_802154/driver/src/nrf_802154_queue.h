@@ -136,6 +136,19 @@ void * nrf_802154_queue_pop_begin(const nrf_802154_queue_t * p_queue);
  */
 void nrf_802154_queue_pop_commit(nrf_802154_queue_t * p_queue);
 
+/**@brief Returns pointer to an item waiting in the queue behind the next item to be read.
+ *
+ * This function is to be used when inspecting items of the queue that wait for being read.
+ * The item at @p position 0 is the one returned by @ref nrf_802154_queue_pop_begin.
+ * To ensure thread-safety external locking is required.
+ *
+ * @param[in] p_queue        Pointer to the queue instance.
+ * @param[in] position       Number of items between the next item to be read and the requested one.
+ *
+ * @return Pointer to the requested item or NULL if the queue holds no more than @p position items.
+ */
+void * nrf_802154_queue_peek(const nrf_802154_queue_t * p_queue, uint8_t position);
+
 /**@brief Checks if the queue is empty.
  *
  * @param[in] p_queue       Pointer to the queue instance.
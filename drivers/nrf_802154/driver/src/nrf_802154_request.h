@@ -123,6 +123,20 @@ bool nrf_802154_request_ack_timeout_handle(const nrf_802154_ack_timeout_handle_p
  */
 bool nrf_802154_request_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_us);
 
+/**
+ * @brief Requests entering the @ref RADIO_STATE_ED state to scan multiple channels.
+ *
+ * @param[in]  term_lvl      Termination level of this request. Selects procedures to abort.
+ * @param[in]  channel_mask  Mask of channels to scan.
+ * @param[in]  dwell_us      Requested duration of the energy detection on each channel.
+ *
+ * @retval  true   The driver will enter energy detection state.
+ * @retval  false  The driver cannot enter the energy detection state due to an ongoing operation.
+ */
+bool nrf_802154_request_energy_scan(nrf_802154_term_t term_lvl,
+                                    uint32_t          channel_mask,
+                                    uint32_t          dwell_us);
+
 /**
  * @brief Requests entering the @ref RADIO_STATE_CCA state.
  *
@@ -255,6 +269,30 @@ bool nrf_802154_request_receive_at(uint64_t rx_time,
  */
 bool nrf_802154_request_receive_at_cancel(uint32_t id);
 
+#if NRF_802154_DELAYED_TRX_TIMELINE_ENABLED
+
+/**
+ * @brief Requests a call to @ref nrf_802154_delayed_trx_timeline_schedule.
+ *
+ * @param[in]  p_ops      Pointer to an array of operations to schedule.
+ * @param[in]  ops_count  Number of operations in @p p_ops.
+ *
+ * @retval  true   All operations were added to the timeline.
+ * @retval  false  There is not enough space in the timeline.
+ */
+bool nrf_802154_request_timeline_schedule(const nrf_802154_timeline_op_t * p_ops,
+                                          uint32_t                         ops_count);
+
+/**
+ * @brief Requests a call to @ref nrf_802154_delayed_trx_timeline_clear.
+ *
+ * @retval  true   At least one operation was removed from the timeline.
+ * @retval  false  The timeline was empty.
+ */
+bool nrf_802154_request_timeline_clear(void);
+
+#endif // NRF_802154_DELAYED_TRX_TIMELINE_ENABLED
+
 #endif // NRF_802154_DELAYED_TRX_ENABLED
 
 /**
@@ -268,6 +306,71 @@ bool nrf_802154_request_receive_at_cancel(uint32_t id);
 bool nrf_802154_request_csma_ca_start(uint8_t                                      * p_data,
                                       const nrf_802154_transmit_csma_ca_metadata_t * p_metadata);
 
+#if NRF_802154_TX_QUEUE_ENABLED
+
+/**
+ * @brief Requests adding a frame to the transmit queue.
+ *
+ * @param[in]  p_data      Pointer to a buffer the contains PHR and PSDU of the frame that is
+ *                         to be transmitted.
+ * @param[in]  p_metadata  Pointer to metadata structure. Contains detailed properties of data
+ *                         to transmit.
+ *
+ * @retval  true   The frame was added to the queue.
+ * @retval  false  The queue is full.
+ */
+bool nrf_802154_request_tx_queue_push(uint8_t                              * p_data,
+                                      const nrf_802154_transmit_metadata_t * p_metadata);
+
+#endif // NRF_802154_TX_QUEUE_ENABLED
+
+#if NRF_802154_INDIRECT_TX_ENABLED
+
+/**
+ * @brief Requests adding a frame to the indirect transmission queue.
+ *
+ * @param[in]  p_data      Pointer to a buffer the contains PHR and PSDU of the frame that is
+ *                         to be transmitted.
+ * @param[in]  p_metadata  Pointer to metadata structure. Contains detailed properties of data
+ *                         to transmit.
+ *
+ * @retval  true   The frame was added to the queue.
+ * @retval  false  The queue is full or the frame has no destination address.
+ */
+bool nrf_802154_request_indirect_tx_push(uint8_t                              * p_data,
+                                         const nrf_802154_transmit_metadata_t * p_metadata);
+
+/**
+ * @brief Requests removing a frame from the indirect transmission queue.
+ *
+ * @param[in]  p_data  Pointer to a buffer the contains PHR and PSDU of the frame.
+ *
+ * @retval  true   The frame was removed from the queue.
+ * @retval  false  The frame is not in the queue or its transmission has already been requested.
+ */
+bool nrf_802154_request_indirect_tx_cancel(const uint8_t * p_data);
+
+#endif // NRF_802154_INDIRECT_TX_ENABLED
+
+#if NRF_802154_WAKEUP_TX_ENABLED
+
+/**
+ * @brief Requests starting a train of wake-up frames.
+ *
+ * @param[in]  p_data       Pointer to a buffer the contains PHR and PSDU of the wake-up frame.
+ * @param[in]  p_metadata   Pointer to metadata structure. Contains detailed properties of data
+ *                          to transmit.
+ * @param[in]  duration_us  Duration of the train in microseconds.
+ *
+ * @retval  true   The transmission of the first frame of the train was requested.
+ * @retval  false  The train could not be started.
+ */
+bool nrf_802154_request_wakeup_tx_start(uint8_t                              * p_data,
+                                        const nrf_802154_transmit_metadata_t * p_metadata,
+                                        uint32_t                               duration_us);
+
+#endif // NRF_802154_WAKEUP_TX_ENABLED
+
 /**
  *@}
  **/
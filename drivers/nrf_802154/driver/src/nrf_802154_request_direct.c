@@ -46,6 +46,9 @@
 #include "nrf_802154_core.h"
 #include "mac_features/nrf_802154_delayed_trx.h"
 #include "mac_features/nrf_802154_csma_ca.h"
+#include "mac_features/nrf_802154_tx_queue.h"
+#include "mac_features/nrf_802154_indirect_tx.h"
+#include "mac_features/nrf_802154_wakeup_tx.h"
 #include "hal/nrf_radio.h"
 
 #define REQUEST_FUNCTION_PARMS(func_core, ...) \
@@ -110,6 +113,13 @@ bool nrf_802154_request_energy_detection(nrf_802154_term_t term_lvl, uint32_t ti
     REQUEST_FUNCTION_PARMS(nrf_802154_core_energy_detection, term_lvl, time_us)
 }
 
+bool nrf_802154_request_energy_scan(nrf_802154_term_t term_lvl,
+                                    uint32_t          channel_mask,
+                                    uint32_t          dwell_us)
+{
+    REQUEST_FUNCTION_PARMS(nrf_802154_core_energy_scan, term_lvl, channel_mask, dwell_us)
+}
+
 bool nrf_802154_request_cca(nrf_802154_term_t term_lvl)
 {
     REQUEST_FUNCTION_PARMS(nrf_802154_core_cca, term_lvl)
@@ -191,6 +201,21 @@ bool nrf_802154_request_receive_at_cancel(uint32_t id)
     REQUEST_FUNCTION_PARMS(nrf_802154_delayed_trx_receive_cancel, id);
 }
 
+#if NRF_802154_DELAYED_TRX_TIMELINE_ENABLED
+
+bool nrf_802154_request_timeline_schedule(const nrf_802154_timeline_op_t * p_ops,
+                                          uint32_t                         ops_count)
+{
+    REQUEST_FUNCTION_PARMS(nrf_802154_delayed_trx_timeline_schedule, p_ops, ops_count);
+}
+
+bool nrf_802154_request_timeline_clear(void)
+{
+    REQUEST_FUNCTION(nrf_802154_delayed_trx_timeline_clear);
+}
+
+#endif // NRF_802154_DELAYED_TRX_TIMELINE_ENABLED
+
 #endif
 
 bool nrf_802154_request_csma_ca_start(uint8_t                                      * p_data,
@@ -198,3 +223,39 @@ bool nrf_802154_request_csma_ca_start(uint8_t
 {
     REQUEST_FUNCTION_PARMS(nrf_802154_csma_ca_start, p_data, p_metadata);
 }
+
+#if NRF_802154_TX_QUEUE_ENABLED
+
+bool nrf_802154_request_tx_queue_push(uint8_t                              * p_data,
+                                      const nrf_802154_transmit_metadata_t * p_metadata)
+{
+    REQUEST_FUNCTION_PARMS(nrf_802154_tx_queue_push, p_data, p_metadata);
+}
+
+#endif // NRF_802154_TX_QUEUE_ENABLED
+
+#if NRF_802154_INDIRECT_TX_ENABLED
+
+bool nrf_802154_request_indirect_tx_push(uint8_t                              * p_data,
+                                         const nrf_802154_transmit_metadata_t * p_metadata)
+{
+    REQUEST_FUNCTION_PARMS(nrf_802154_indirect_tx_push, p_data, p_metadata);
+}
+
+bool nrf_802154_request_indirect_tx_cancel(const uint8_t * p_data)
+{
+    REQUEST_FUNCTION_PARMS(nrf_802154_indirect_tx_cancel, p_data);
+}
+
+#endif // NRF_802154_INDIRECT_TX_ENABLED
+
+#if NRF_802154_WAKEUP_TX_ENABLED
+
+bool nrf_802154_request_wakeup_tx_start(uint8_t                              * p_data,
+                                        const nrf_802154_transmit_metadata_t * p_metadata,
+                                        uint32_t                               duration_us)
+{
+    REQUEST_FUNCTION_PARMS(nrf_802154_wakeup_tx_start, p_data, p_metadata, duration_us);
+}
+
+#endif // NRF_802154_WAKEUP_TX_ENABLED
@@ -56,11 +56,14 @@
 #include "hal/nrf_radio.h"
 #include "hal/nrf_egu.h"
 #include "mac_features/nrf_802154_delayed_trx.h"
+#include "mac_features/nrf_802154_tx_queue.h"
+#include "mac_features/nrf_802154_indirect_tx.h"
+#include "mac_features/nrf_802154_wakeup_tx.h"
 #include "platform/nrf_802154_irq.h"
 
 #include <nrfx.h>
 
-/** Size of requests queue.
+/** Size of each of the requests queues.
  *
  * Two is minimal queue size. It is not expected in current implementation to queue a few requests.
  */
@@ -78,6 +81,7 @@ typedef enum
     REQ_TYPE_TRANSMIT,
     REQ_TYPE_ACK_TIMEOUT_HANDLE,
     REQ_TYPE_ENERGY_DETECTION,
+    REQ_TYPE_ENERGY_SCAN,
     REQ_TYPE_CCA,
     REQ_TYPE_CONTINUOUS_CARRIER,
     REQ_TYPE_MODULATED_CARRIER,
@@ -92,8 +96,23 @@ typedef enum
     REQ_TYPE_RECEIVE_AT,
     REQ_TYPE_RECEIVE_AT_CANCEL,
     REQ_TYPE_CSMA_CA_START,
+    REQ_TYPE_TX_QUEUE_PUSH,
+    REQ_TYPE_INDIRECT_TX_PUSH,
+    REQ_TYPE_INDIRECT_TX_CANCEL,
+    REQ_TYPE_WAKEUP_TX_START,
+    REQ_TYPE_TIMELINE_SCHEDULE,
+    REQ_TYPE_TIMELINE_CLEAR,
+    REQ_TYPE_COALESCED,
 } nrf_802154_req_type_t;
 
+/// Priorities of requests, in the order the request queues are processed.
+typedef enum
+{
+    REQ_PRIORITY_HIGH,   ///< Time-sensitive requests, processed before any other pending request.
+    REQ_PRIORITY_NORMAL, ///< Remaining requests, processed in the order they were made.
+    REQ_PRIORITY_COUNT,  ///< Number of request priorities.
+} nrf_802154_req_priority_t;
+
 /// Request data in request queue.
 typedef struct
 {
@@ -140,6 +159,14 @@ typedef struct
             uint32_t          time_us;  ///< Requested time of energy detection procedure.
         } energy_detection;             ///< Energy detection request details.
 
+        struct
+        {
+            nrf_802154_term_t term_lvl;     ///< Request priority.
+            bool            * p_result;     ///< Energy scan request result.
+            uint32_t          channel_mask; ///< Mask of channels to scan.
+            uint32_t          dwell_us;     ///< Requested time of energy detection on each channel.
+        } energy_scan;                      ///< Energy scan request details.
+
         struct
         {
             nrf_802154_term_t term_lvl; ///< Request priority.
@@ -223,6 +250,20 @@ typedef struct
             bool   * p_result;
         } receive_at_cancel;
 
+#if NRF_802154_DELAYED_TRX_TIMELINE_ENABLED
+        struct
+        {
+            const nrf_802154_timeline_op_t * p_ops;
+            uint32_t                         ops_count;
+            bool                           * p_result;
+        } timeline_schedule;
+
+        struct
+        {
+            bool * p_result;
+        } timeline_clear;
+#endif // NRF_802154_DELAYED_TRX_TIMELINE_ENABLED
+
 #endif // NRF_802154_DELAYED_TRX_ENABLED
 
         struct
@@ -232,33 +273,110 @@ typedef struct
             bool                                         * p_result;
         } csma_ca_start; ///< Antenna update request details.
 
+#if NRF_802154_TX_QUEUE_ENABLED
+        struct
+        {
+            uint8_t                              * p_data;
+            const nrf_802154_transmit_metadata_t * p_metadata;
+            bool                                 * p_result;
+        } tx_queue_push; ///< Transmit queue push request details.
+#endif // NRF_802154_TX_QUEUE_ENABLED
+
+#if NRF_802154_INDIRECT_TX_ENABLED
+        struct
+        {
+            uint8_t                              * p_data;
+            const nrf_802154_transmit_metadata_t * p_metadata;
+            bool                                 * p_result;
+        } indirect_tx_push; ///< Indirect transmission queue push request details.
+
+        struct
+        {
+            const uint8_t * p_data;
+            bool          * p_result;
+        } indirect_tx_cancel; ///< Indirect transmission queue cancel request details.
+#endif // NRF_802154_INDIRECT_TX_ENABLED
+
+#if NRF_802154_WAKEUP_TX_ENABLED
+        struct
+        {
+            uint8_t                              * p_data;
+            const nrf_802154_transmit_metadata_t * p_metadata;
+            uint32_t                               duration_us;
+            bool                                 * p_result;
+        } wakeup_tx_start; ///< Wake-up frame train start request details.
+#endif // NRF_802154_WAKEUP_TX_ENABLED
+
     } data;              ///< Request data depending on its type.
 } nrf_802154_req_data_t;
 
-/**@brief Instance of a requests queue */
-static nrf_802154_queue_t m_requests_queue;
+/**@brief Instances of requests queues, one for each request priority */
+static nrf_802154_queue_t m_requests_queues[REQ_PRIORITY_COUNT];
+
+/**@brief Memory holding requests queues items */
+static nrf_802154_req_data_t m_requests_queues_memory[REQ_PRIORITY_COUNT][REQ_QUEUE_SIZE];
 
-/**@brief Memory holding requests queue items */
-static nrf_802154_req_data_t m_requests_queue_memory[REQ_QUEUE_SIZE];
+/**@brief Requests queue the request being currently made is pushed to */
+static nrf_802154_queue_t * volatile mp_requests_queue_entered;
 
 /**@brief State of the MCU critical section */
 static volatile nrf_802154_mcu_critical_state_t m_mcu_cs;
 
+/**
+ * Get priority of a request.
+ *
+ * Requests that start or abort a scheduled radio operation, and freeing a receive buffer while
+ * the driver has no free receive buffer left, must not wait behind configuration updates or
+ * queries.
+ *
+ * @param[in]  type  Type of the request.
+ *
+ * @return Priority of the request.
+ */
+static nrf_802154_req_priority_t req_priority_get(nrf_802154_req_type_t type)
+{
+    switch (type)
+    {
+        case REQ_TYPE_ACK_TIMEOUT_HANDLE:
+        case REQ_TYPE_TRANSMIT_AT:
+        case REQ_TYPE_TRANSMIT_AT_CANCEL:
+        case REQ_TYPE_RECEIVE_AT_CANCEL:
+            return REQ_PRIORITY_HIGH;
+
+        case REQ_TYPE_BUFFER_FREE:
+            return (nrf_802154_rx_buffer_free_count_get() == 0U) ?
+                   REQ_PRIORITY_HIGH : REQ_PRIORITY_NORMAL;
+
+        default:
+            return REQ_PRIORITY_NORMAL;
+    }
+}
+
 /**
  * Enter request block.
  *
  * This is a helper function used in all request functions to atomically
- * find an empty slot in request queue and allow atomic slot update.
+ * find an empty slot in the request queue matching priority of the request
+ * and allow atomic slot update.
  *
- * @return Pointer to an empty slot in the request queue.
+ * @param[in]  type  Type of the request to be made.
+ *
+ * @return Pointer to an empty slot in the request queue with @p type set.
  */
-static nrf_802154_req_data_t * req_enter(void)
+static nrf_802154_req_data_t * req_enter(nrf_802154_req_type_t type)
 {
+    nrf_802154_req_data_t * p_slot;
+
     nrf_802154_mcu_critical_enter(m_mcu_cs);
 
-    assert(!nrf_802154_queue_is_full(&m_requests_queue));
+    mp_requests_queue_entered = &m_requests_queues[req_priority_get(type)];
+
+    assert(!nrf_802154_queue_is_full(mp_requests_queue_entered));
 
-    return (nrf_802154_req_data_t *)nrf_802154_queue_push_begin(&m_requests_queue);
+    p_slot       = (nrf_802154_req_data_t *)nrf_802154_queue_push_begin(mp_requests_queue_entered);
+    p_slot->type = type;
+
+    return p_slot;
 }
 
 /**
@@ -269,7 +387,7 @@ static nrf_802154_req_data_t * req_enter(void)
  */
 static void req_exit(void)
 {
-    nrf_802154_queue_push_commit(&m_requests_queue);
+    nrf_802154_queue_push_commit(mp_requests_queue_entered);
 
     nrf_egu_task_trigger(NRF_802154_EGU_INSTANCE, REQ_TASK);
 
@@ -332,9 +450,8 @@ static bool active_vector_priority_is_high(void)
  */
 static void swi_sleep(nrf_802154_term_t term_lvl, bool * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    nrf_802154_req_data_t * p_slot = req_enter(REQ_TYPE_SLEEP);
 
-    p_slot->type                = REQ_TYPE_SLEEP;
     p_slot->data.sleep.term_lvl = term_lvl;
     p_slot->data.sleep.p_result = p_result;
 
@@ -358,9 +475,8 @@ static void swi_receive(nrf_802154_term_t              term_lvl,
                         uint32_t                       id,
                         bool                         * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    nrf_802154_req_data_t * p_slot = req_enter(REQ_TYPE_RECEIVE);
 
-    p_slot->type                     = REQ_TYPE_RECEIVE;
     p_slot->data.receive.term_lvl    = term_lvl;
     p_slot->data.receive.req_orig    = req_orig;
     p_slot->data.receive.notif_func  = notify_function;
@@ -391,9 +507,8 @@ static void swi_transmit(nrf_802154_term_t              term_lvl,
                          nrf_802154_notification_func_t notify_function,
                          bool                         * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    nrf_802154_req_data_t * p_slot = req_enter(REQ_TYPE_TRANSMIT);
 
-    p_slot->type                     = REQ_TYPE_TRANSMIT;
     p_slot->data.transmit.term_lvl   = term_lvl;
     p_slot->data.transmit.req_orig   = req_orig;
     p_slot->data.transmit.p_data     = p_data;
@@ -407,9 +522,8 @@ static void swi_transmit(nrf_802154_term_t              term_lvl,
 static void swi_ack_timeout_handle(const nrf_802154_ack_timeout_handle_params_t * p_param,
                                    bool                                         * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    nrf_802154_req_data_t * p_slot = req_enter(REQ_TYPE_ACK_TIMEOUT_HANDLE);
 
-    p_slot->type                             = REQ_TYPE_ACK_TIMEOUT_HANDLE;
     p_slot->data.ack_timeout_handle.p_param  = p_param;
     p_slot->data.ack_timeout_handle.p_result = p_result;
 
@@ -427,9 +541,8 @@ static void swi_energy_detection(nrf_802154_term_t term_lvl,
                                  uint32_t          time_us,
                                  bool            * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    nrf_802154_req_data_t * p_slot = req_enter(REQ_TYPE_ENERGY_DETECTION);
 
-    p_slot->type                           = REQ_TYPE_ENERGY_DETECTION;
     p_slot->data.energy_detection.term_lvl = term_lvl;
     p_slot->data.energy_detection.time_us  = time_us;
     p_slot->data.energy_detection.p_result = p_result;
@@ -437,6 +550,30 @@ static void swi_energy_detection(nrf_802154_term_t term_lvl,
     req_exit();
 }
 
+/**
+ * @brief Requests entering the @ref RADIO_STATE_ED state to scan multiple channels from the SWI
+ *        priority.
+ *
+ * @param[in]   term_lvl      Termination level of this request. Selects procedures to abort.
+ * @param[in]   channel_mask  Mask of channels to scan.
+ * @param[in]   dwell_us      Requested duration of the energy detection on each channel.
+ * @param[out]  p_result      Result of entering the energy detection state.
+ */
+static void swi_energy_scan(nrf_802154_term_t term_lvl,
+                            uint32_t          channel_mask,
+                            uint32_t          dwell_us,
+                            bool            * p_result)
+{
+    nrf_802154_req_data_t * p_slot = req_enter(REQ_TYPE_ENERGY_SCAN);
+
+    p_slot->data.energy_scan.term_lvl     = term_lvl;
+    p_slot->data.energy_scan.channel_mask = channel_mask;
+    p_slot->data.energy_scan.dwell_us     = dwell_us;
+    p_slot->data.energy_scan.p_result     = p_result;
+
+    req_exit();
+}
+
 /**
  * @brief Requests entering the @ref RADIO_STATE_CCA state from the SWI priority.
  *
@@ -445,9 +582,8 @@ static void swi_energy_detection(nrf_802154_term_t term_lvl,
  */
 static void swi_cca(nrf_802154_term_t term_lvl, bool * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    nrf_802154_req_data_t * p_slot = req_enter(REQ_TYPE_CCA);
 
-    p_slot->type              = REQ_TYPE_CCA;
     p_slot->data.cca.term_lvl = term_lvl;
     p_slot->data.cca.p_result = p_result;
 
@@ -464,9 +600,8 @@ static void swi_cca(nrf_802154_term_t term_lvl, bool * p_result)
  */
 static void swi_continuous_carrier(nrf_802154_term_t term_lvl, bool * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    nrf_802154_req_data_t * p_slot = req_enter(REQ_TYPE_CONTINUOUS_CARRIER);
 
-    p_slot->type                             = REQ_TYPE_CONTINUOUS_CARRIER;
     p_slot->data.continuous_carrier.term_lvl = term_lvl;
     p_slot->data.continuous_carrier.p_result = p_result;
 
@@ -484,9 +619,8 @@ static void swi_modulated_carrier(nrf_802154_term_t term_lvl,
                                   const uint8_t   * p_data,
                                   bool            * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    nrf_802154_req_data_t * p_slot = req_enter(REQ_TYPE_MODULATED_CARRIER);
 
-    p_slot->type                            = REQ_TYPE_MODULATED_CARRIER;
     p_slot->data.modulated_carrier.term_lvl = term_lvl;
     p_slot->data.modulated_carrier.p_data   = p_data;
     p_slot->data.modulated_carrier.p_result = p_result;
@@ -505,9 +639,8 @@ static void swi_modulated_carrier(nrf_802154_term_t term_lvl,
  */
 static void swi_buffer_free(uint8_t * p_data, bool * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    nrf_802154_req_data_t * p_slot = req_enter(REQ_TYPE_BUFFER_FREE);
 
-    p_slot->type                      = REQ_TYPE_BUFFER_FREE;
     p_slot->data.buffer_free.p_data   = p_data;
     p_slot->data.buffer_free.p_result = p_result;
 
@@ -522,9 +655,8 @@ static void swi_buffer_free(uint8_t * p_data, bool * p_result)
  */
 static void swi_antenna_update(bool * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    nrf_802154_req_data_t * p_slot = req_enter(REQ_TYPE_ANTENNA_UPDATE);
 
-    p_slot->type                         = REQ_TYPE_ANTENNA_UPDATE;
     p_slot->data.antenna_update.p_result = p_result;
 
     req_exit();
@@ -538,9 +670,8 @@ static void swi_antenna_update(bool * p_result)
  */
 static void swi_channel_update(req_originator_t req_orig, bool * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    nrf_802154_req_data_t * p_slot = req_enter(REQ_TYPE_CHANNEL_UPDATE);
 
-    p_slot->type                         = REQ_TYPE_CHANNEL_UPDATE;
     p_slot->data.channel_update.p_result = p_result;
     p_slot->data.channel_update.req_orig = req_orig;
 
@@ -555,9 +686,8 @@ static void swi_channel_update(req_originator_t req_orig, bool * p_result)
  */
 static void swi_cca_cfg_update(bool * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    nrf_802154_req_data_t * p_slot = req_enter(REQ_TYPE_CCA_CFG_UPDATE);
 
-    p_slot->type                         = REQ_TYPE_CCA_CFG_UPDATE;
     p_slot->data.cca_cfg_update.p_result = p_result;
 
     req_exit();
@@ -571,9 +701,8 @@ static void swi_cca_cfg_update(bool * p_result)
  */
 static void swi_rssi_measure(bool * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    nrf_802154_req_data_t * p_slot = req_enter(REQ_TYPE_RSSI_MEASURE);
 
-    p_slot->type                       = REQ_TYPE_RSSI_MEASURE;
     p_slot->data.rssi_measure.p_result = p_result;
 
     req_exit();
@@ -588,9 +717,8 @@ static void swi_rssi_measure(bool * p_result)
  */
 static void swi_rssi_measurement_get(int8_t * p_rssi, bool * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    nrf_802154_req_data_t * p_slot = req_enter(REQ_TYPE_RSSI_GET);
 
-    p_slot->type                   = REQ_TYPE_RSSI_GET;
     p_slot->data.rssi_get.p_rssi   = p_rssi;
     p_slot->data.rssi_get.p_result = p_result;
 
@@ -603,9 +731,8 @@ static void swi_transmit_at(uint8_t                                 * p_data,
                             const nrf_802154_transmit_at_metadata_t * p_metadata,
                             bool                                    * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    nrf_802154_req_data_t * p_slot = req_enter(REQ_TYPE_TRANSMIT_AT);
 
-    p_slot->type                        = REQ_TYPE_TRANSMIT_AT;
     p_slot->data.transmit_at.p_data     = p_data;
     p_slot->data.transmit_at.tx_time    = tx_time;
     p_slot->data.transmit_at.p_metadata = p_metadata;
@@ -616,9 +743,8 @@ static void swi_transmit_at(uint8_t                                 * p_data,
 
 static void swi_transmit_at_cancel(bool * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    nrf_802154_req_data_t * p_slot = req_enter(REQ_TYPE_TRANSMIT_AT_CANCEL);
 
-    p_slot->type                             = REQ_TYPE_TRANSMIT_AT_CANCEL;
     p_slot->data.transmit_at_cancel.p_result = p_result;
 
     req_exit();
@@ -630,9 +756,8 @@ static void swi_receive_at(uint64_t rx_time,
                            uint32_t id,
                            bool   * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    nrf_802154_req_data_t * p_slot = req_enter(REQ_TYPE_RECEIVE_AT);
 
-    p_slot->type                     = REQ_TYPE_RECEIVE_AT;
     p_slot->data.receive_at.rx_time  = rx_time;
     p_slot->data.receive_at.timeout  = timeout;
     p_slot->data.receive_at.channel  = channel;
@@ -644,36 +769,150 @@ static void swi_receive_at(uint64_t rx_time,
 
 static void swi_receive_at_cancel(uint32_t id, bool * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    nrf_802154_req_data_t * p_slot = req_enter(REQ_TYPE_RECEIVE_AT_CANCEL);
 
-    p_slot->type                            = REQ_TYPE_RECEIVE_AT_CANCEL;
     p_slot->data.receive_at_cancel.id       = id;
     p_slot->data.receive_at_cancel.p_result = p_result;
 
     req_exit();
 }
 
+#if NRF_802154_DELAYED_TRX_TIMELINE_ENABLED
+
+static void swi_timeline_schedule(const nrf_802154_timeline_op_t * p_ops,
+                                  uint32_t                         ops_count,
+                                  bool                           * p_result)
+{
+    nrf_802154_req_data_t * p_slot = req_enter(REQ_TYPE_TIMELINE_SCHEDULE);
+
+    p_slot->data.timeline_schedule.p_ops     = p_ops;
+    p_slot->data.timeline_schedule.ops_count = ops_count;
+    p_slot->data.timeline_schedule.p_result  = p_result;
+
+    req_exit();
+}
+
+static void swi_timeline_clear(bool * p_result)
+{
+    nrf_802154_req_data_t * p_slot = req_enter(REQ_TYPE_TIMELINE_CLEAR);
+
+    p_slot->data.timeline_clear.p_result = p_result;
+
+    req_exit();
+}
+
+#endif // NRF_802154_DELAYED_TRX_TIMELINE_ENABLED
+
 #endif // NRF_802154_DELAYED_TRX_ENABLED
 
 static void swi_csma_ca_start(uint8_t                                      * p_data,
                               const nrf_802154_transmit_csma_ca_metadata_t * p_metadata,
                               bool                                         * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    nrf_802154_req_data_t * p_slot = req_enter(REQ_TYPE_CSMA_CA_START);
 
-    p_slot->type                          = REQ_TYPE_CSMA_CA_START;
     p_slot->data.csma_ca_start.p_data     = p_data;
     p_slot->data.csma_ca_start.p_metadata = p_metadata;
     p_slot->data.csma_ca_start.p_result   = p_result;
     req_exit();
 }
 
+#if NRF_802154_TX_QUEUE_ENABLED
+
+/**
+ * @brief Requests adding a frame to the transmit queue from the SWI priority.
+ *
+ * @param[in]   p_data      Pointer to a buffer that contains PHR and PSDU of the frame.
+ * @param[in]   p_metadata  Pointer to metadata structure of the frame.
+ * @param[out]  p_result    Result of the request.
+ */
+static void swi_tx_queue_push(uint8_t                              * p_data,
+                              const nrf_802154_transmit_metadata_t * p_metadata,
+                              bool                                 * p_result)
+{
+    nrf_802154_req_data_t * p_slot = req_enter(REQ_TYPE_TX_QUEUE_PUSH);
+
+    p_slot->data.tx_queue_push.p_data     = p_data;
+    p_slot->data.tx_queue_push.p_metadata = p_metadata;
+    p_slot->data.tx_queue_push.p_result   = p_result;
+    req_exit();
+}
+
+#endif // NRF_802154_TX_QUEUE_ENABLED
+
+#if NRF_802154_INDIRECT_TX_ENABLED
+
+/**
+ * @brief Requests adding a frame to the indirect transmission queue from the SWI priority.
+ *
+ * @param[in]   p_data      Pointer to a buffer that contains PHR and PSDU of the frame.
+ * @param[in]   p_metadata  Pointer to metadata structure of the frame.
+ * @param[out]  p_result    Result of the request.
+ */
+static void swi_indirect_tx_push(uint8_t                              * p_data,
+                                 const nrf_802154_transmit_metadata_t * p_metadata,
+                                 bool                                 * p_result)
+{
+    nrf_802154_req_data_t * p_slot = req_enter(REQ_TYPE_INDIRECT_TX_PUSH);
+
+    p_slot->data.indirect_tx_push.p_data     = p_data;
+    p_slot->data.indirect_tx_push.p_metadata = p_metadata;
+    p_slot->data.indirect_tx_push.p_result   = p_result;
+    req_exit();
+}
+
+/**
+ * @brief Requests removing a frame from the indirect transmission queue from the SWI priority.
+ *
+ * @param[in]   p_data    Pointer to a buffer that contains PHR and PSDU of the frame.
+ * @param[out]  p_result  Result of the request.
+ */
+static void swi_indirect_tx_cancel(const uint8_t * p_data, bool * p_result)
+{
+    nrf_802154_req_data_t * p_slot = req_enter(REQ_TYPE_INDIRECT_TX_CANCEL);
+
+    p_slot->data.indirect_tx_cancel.p_data   = p_data;
+    p_slot->data.indirect_tx_cancel.p_result = p_result;
+    req_exit();
+}
+
+#endif // NRF_802154_INDIRECT_TX_ENABLED
+
+#if NRF_802154_WAKEUP_TX_ENABLED
+
+/**
+ * @brief Requests starting a train of wake-up frames from the SWI priority.
+ *
+ * @param[in]   p_data       Pointer to a buffer that contains PHR and PSDU of the wake-up frame.
+ * @param[in]   p_metadata   Pointer to metadata structure of the frame.
+ * @param[in]   duration_us  Duration of the train in microseconds.
+ * @param[out]  p_result     Result of the request.
+ */
+static void swi_wakeup_tx_start(uint8_t                              * p_data,
+                                const nrf_802154_transmit_metadata_t * p_metadata,
+                                uint32_t                               duration_us,
+                                bool                                 * p_result)
+{
+    nrf_802154_req_data_t * p_slot = req_enter(REQ_TYPE_WAKEUP_TX_START);
+
+    p_slot->data.wakeup_tx_start.p_data      = p_data;
+    p_slot->data.wakeup_tx_start.p_metadata  = p_metadata;
+    p_slot->data.wakeup_tx_start.duration_us = duration_us;
+    p_slot->data.wakeup_tx_start.p_result    = p_result;
+    req_exit();
+}
+
+#endif // NRF_802154_WAKEUP_TX_ENABLED
+
 void nrf_802154_request_init(void)
 {
-    nrf_802154_queue_init(&m_requests_queue,
-                          m_requests_queue_memory,
-                          sizeof(m_requests_queue_memory),
-                          sizeof(m_requests_queue_memory[0]));
+    for (uint32_t i = 0U; i < REQ_PRIORITY_COUNT; i++)
+    {
+        nrf_802154_queue_init(&m_requests_queues[i],
+                              m_requests_queues_memory[i],
+                              sizeof(m_requests_queues_memory[i]),
+                              sizeof(m_requests_queues_memory[i][0]));
+    }
 
     nrf_egu_int_enable(NRF_802154_EGU_INSTANCE, REQ_INT);
 
@@ -729,6 +968,17 @@ bool nrf_802154_request_energy_detection(nrf_802154_term_t term_lvl,
                      time_us)
 }
 
+bool nrf_802154_request_energy_scan(nrf_802154_term_t term_lvl,
+                                    uint32_t          channel_mask,
+                                    uint32_t          dwell_us)
+{
+    REQUEST_FUNCTION(nrf_802154_core_energy_scan,
+                     swi_energy_scan,
+                     term_lvl,
+                     channel_mask,
+                     dwell_us)
+}
+
 bool nrf_802154_request_cca(nrf_802154_term_t term_lvl)
 {
     REQUEST_FUNCTION(nrf_802154_core_cca, swi_cca, term_lvl)
@@ -811,6 +1061,24 @@ bool nrf_802154_request_receive_at_cancel(uint32_t id)
     REQUEST_FUNCTION(nrf_802154_delayed_trx_receive_cancel, swi_receive_at_cancel, id);
 }
 
+#if NRF_802154_DELAYED_TRX_TIMELINE_ENABLED
+
+bool nrf_802154_request_timeline_schedule(const nrf_802154_timeline_op_t * p_ops,
+                                          uint32_t                         ops_count)
+{
+    REQUEST_FUNCTION(nrf_802154_delayed_trx_timeline_schedule,
+                     swi_timeline_schedule,
+                     p_ops,
+                     ops_count);
+}
+
+bool nrf_802154_request_timeline_clear(void)
+{
+    REQUEST_FUNCTION_NO_ARGS(nrf_802154_delayed_trx_timeline_clear, swi_timeline_clear);
+}
+
+#endif // NRF_802154_DELAYED_TRX_TIMELINE_ENABLED
+
 bool nrf_802154_request_csma_ca_start(uint8_t                                      * p_data,
                                       const nrf_802154_transmit_csma_ca_metadata_t * p_metadata)
 {
@@ -822,13 +1090,159 @@ bool nrf_802154_request_csma_ca_start(uint8_t
 
 #endif // NRF_802154_DELAYED_TRX_ENABLED
 
+#if NRF_802154_TX_QUEUE_ENABLED
+
+bool nrf_802154_request_tx_queue_push(uint8_t                              * p_data,
+                                      const nrf_802154_transmit_metadata_t * p_metadata)
+{
+    REQUEST_FUNCTION(nrf_802154_tx_queue_push,
+                     swi_tx_queue_push,
+                     p_data,
+                     p_metadata);
+}
+
+#endif // NRF_802154_TX_QUEUE_ENABLED
+
+#if NRF_802154_INDIRECT_TX_ENABLED
+
+bool nrf_802154_request_indirect_tx_push(uint8_t                              * p_data,
+                                         const nrf_802154_transmit_metadata_t * p_metadata)
+{
+    REQUEST_FUNCTION(nrf_802154_indirect_tx_push,
+                     swi_indirect_tx_push,
+                     p_data,
+                     p_metadata);
+}
+
+bool nrf_802154_request_indirect_tx_cancel(const uint8_t * p_data)
+{
+    REQUEST_FUNCTION(nrf_802154_indirect_tx_cancel, swi_indirect_tx_cancel, p_data);
+}
+
+#endif // NRF_802154_INDIRECT_TX_ENABLED
+
+#if NRF_802154_WAKEUP_TX_ENABLED
+
+bool nrf_802154_request_wakeup_tx_start(uint8_t                              * p_data,
+                                        const nrf_802154_transmit_metadata_t * p_metadata,
+                                        uint32_t                               duration_us)
+{
+    REQUEST_FUNCTION(nrf_802154_wakeup_tx_start,
+                     swi_wakeup_tx_start,
+                     p_data,
+                     p_metadata,
+                     duration_us);
+}
+
+#endif // NRF_802154_WAKEUP_TX_ENABLED
+
+/**
+ * @brief Checks if two requests reconfigure the radio the same way.
+ *
+ * The configuration update requests carry no configuration themselves. The core reads it from
+ * the PIB when the request is processed, so the first of such requests already applies the
+ * values set before any later one was queued.
+ *
+ * @param[in]  p_slot   Request being processed.
+ * @param[in]  p_other  Request waiting in the queue behind @p p_slot.
+ *
+ * @retval  true   @p p_other is redundant once @p p_slot is processed.
+ * @retval  false  @p p_other must be processed on its own.
+ */
+static bool req_supersedes(const nrf_802154_req_data_t * p_slot,
+                           const nrf_802154_req_data_t * p_other)
+{
+    if (p_slot->type != p_other->type)
+    {
+        return false;
+    }
+
+    switch (p_slot->type)
+    {
+        case REQ_TYPE_CHANNEL_UPDATE:
+            return p_slot->data.channel_update.req_orig == p_other->data.channel_update.req_orig;
+
+        case REQ_TYPE_CCA_CFG_UPDATE:
+        case REQ_TYPE_ANTENNA_UPDATE:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Completes the pending requests made redundant by the request just processed.
+ *
+ * @param[in]  p_slot   Configuration update request that has just been processed.
+ * @param[in]  result   Result of the processed request, passed to the coalesced requests.
+ */
+static void req_coalesce(const nrf_802154_req_data_t * p_slot, bool result)
+{
+    nrf_802154_req_data_t * p_other;
+
+    // Configuration updates are never of high priority, so they all wait in the same queue.
+    nrf_802154_queue_t * p_queue = &m_requests_queues[REQ_PRIORITY_NORMAL];
+
+    for (uint8_t i = 1U;
+         (p_other = (nrf_802154_req_data_t *)nrf_802154_queue_peek(p_queue, i)) != NULL;
+         i++)
+    {
+        if (!req_supersedes(p_slot, p_other))
+        {
+            continue;
+        }
+
+        switch (p_other->type)
+        {
+            case REQ_TYPE_CHANNEL_UPDATE:
+                *(p_other->data.channel_update.p_result) = result;
+                break;
+
+            case REQ_TYPE_CCA_CFG_UPDATE:
+                *(p_other->data.cca_cfg_update.p_result) = result;
+                break;
+
+            case REQ_TYPE_ANTENNA_UPDATE:
+                *(p_other->data.antenna_update.p_result) = result;
+                break;
+
+            default:
+                assert(false);
+        }
+
+        p_other->type = REQ_TYPE_COALESCED;
+    }
+}
+
+/**
+ * @brief Gets the queue holding the next request to be processed.
+ *
+ * @return Pointer to the non-empty requests queue of the highest priority or NULL if no request
+ *         is pending.
+ */
+static nrf_802154_queue_t * req_queue_next_get(void)
+{
+    for (uint32_t i = 0U; i < REQ_PRIORITY_COUNT; i++)
+    {
+        if (!nrf_802154_queue_is_empty(&m_requests_queues[i]))
+        {
+            return &m_requests_queues[i];
+        }
+    }
+
+    return NULL;
+}
+
 /**@brief Handles REQ_EVENT on NRF_802154_EGU_INSTANCE */
 static void irq_handler_req_event(void)
 {
-    while (!nrf_802154_queue_is_empty(&m_requests_queue))
+    nrf_802154_queue_t * p_queue;
+
+    while ((p_queue = req_queue_next_get()) != NULL)
     {
         nrf_802154_req_data_t * p_slot =
-            (nrf_802154_req_data_t *)nrf_802154_queue_pop_begin(&m_requests_queue);
+            (nrf_802154_req_data_t *)nrf_802154_queue_pop_begin(p_queue);
 
         switch (p_slot->type)
         {
@@ -867,6 +1281,14 @@ static void irq_handler_req_event(void)
                         p_slot->data.energy_detection.time_us);
                 break;
 
+            case REQ_TYPE_ENERGY_SCAN:
+                *(p_slot->data.energy_scan.p_result) =
+                    nrf_802154_core_energy_scan(
+                        p_slot->data.energy_scan.term_lvl,
+                        p_slot->data.energy_scan.channel_mask,
+                        p_slot->data.energy_scan.dwell_us);
+                break;
+
             case REQ_TYPE_CCA:
                 *(p_slot->data.cca.p_result) = nrf_802154_core_cca(p_slot->data.cca.term_lvl);
                 break;
@@ -895,10 +1317,12 @@ static void irq_handler_req_event(void)
             case REQ_TYPE_CHANNEL_UPDATE:
                 *(p_slot->data.channel_update.p_result) =
                     nrf_802154_core_channel_update(p_slot->data.channel_update.req_orig);
+                req_coalesce(p_slot, *(p_slot->data.channel_update.p_result));
                 break;
 
             case REQ_TYPE_CCA_CFG_UPDATE:
                 *(p_slot->data.cca_cfg_update.p_result) = nrf_802154_core_cca_cfg_update();
+                req_coalesce(p_slot, *(p_slot->data.cca_cfg_update.p_result));
                 break;
 
             case REQ_TYPE_RSSI_MEASURE:
@@ -912,6 +1336,7 @@ static void irq_handler_req_event(void)
 
             case REQ_TYPE_ANTENNA_UPDATE:
                 *(p_slot->data.antenna_update.p_result) = nrf_802154_core_antenna_update();
+                req_coalesce(p_slot, *(p_slot->data.antenna_update.p_result));
                 break;
 
 #if NRF_802154_DELAYED_TRX_ENABLED
@@ -940,6 +1365,19 @@ static void irq_handler_req_event(void)
                     nrf_802154_delayed_trx_receive_cancel(p_slot->data.receive_at_cancel.id);
                 break;
 
+#if NRF_802154_DELAYED_TRX_TIMELINE_ENABLED
+            case REQ_TYPE_TIMELINE_SCHEDULE:
+                *(p_slot->data.timeline_schedule.p_result) =
+                    nrf_802154_delayed_trx_timeline_schedule(
+                        p_slot->data.timeline_schedule.p_ops,
+                        p_slot->data.timeline_schedule.ops_count);
+                break;
+
+            case REQ_TYPE_TIMELINE_CLEAR:
+                *(p_slot->data.timeline_clear.p_result) = nrf_802154_delayed_trx_timeline_clear();
+                break;
+#endif // NRF_802154_DELAYED_TRX_TIMELINE_ENABLED
+
             case REQ_TYPE_CSMA_CA_START:
                 *(p_slot->data.receive_at_cancel.p_result) =
                     nrf_802154_csma_ca_start(p_slot->data.csma_ca_start.p_data,
@@ -947,11 +1385,45 @@ static void irq_handler_req_event(void)
                 break;
 #endif // NRF_802154_DELAYED_TRX_ENABLED
 
+#if NRF_802154_TX_QUEUE_ENABLED
+            case REQ_TYPE_TX_QUEUE_PUSH:
+                *(p_slot->data.tx_queue_push.p_result) =
+                    nrf_802154_tx_queue_push(p_slot->data.tx_queue_push.p_data,
+                                             p_slot->data.tx_queue_push.p_metadata);
+                break;
+#endif // NRF_802154_TX_QUEUE_ENABLED
+
+#if NRF_802154_INDIRECT_TX_ENABLED
+            case REQ_TYPE_INDIRECT_TX_PUSH:
+                *(p_slot->data.indirect_tx_push.p_result) =
+                    nrf_802154_indirect_tx_push(p_slot->data.indirect_tx_push.p_data,
+                                                p_slot->data.indirect_tx_push.p_metadata);
+                break;
+
+            case REQ_TYPE_INDIRECT_TX_CANCEL:
+                *(p_slot->data.indirect_tx_cancel.p_result) =
+                    nrf_802154_indirect_tx_cancel(p_slot->data.indirect_tx_cancel.p_data);
+                break;
+#endif // NRF_802154_INDIRECT_TX_ENABLED
+
+#if NRF_802154_WAKEUP_TX_ENABLED
+            case REQ_TYPE_WAKEUP_TX_START:
+                *(p_slot->data.wakeup_tx_start.p_result) =
+                    nrf_802154_wakeup_tx_start(p_slot->data.wakeup_tx_start.p_data,
+                                               p_slot->data.wakeup_tx_start.p_metadata,
+                                               p_slot->data.wakeup_tx_start.duration_us);
+                break;
+#endif // NRF_802154_WAKEUP_TX_ENABLED
+
+            case REQ_TYPE_COALESCED:
+                // Completed together with an earlier request of the same type.
+                break;
+
             default:
                 assert(false);
         }
 
-        nrf_802154_queue_pop_commit(&m_requests_queue);
+        nrf_802154_queue_pop_commit(p_queue);
     }
 }
 
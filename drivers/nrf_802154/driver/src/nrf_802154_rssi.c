@@ -48,12 +48,18 @@
 
 #if defined(NRF52_SERIES)
 
-/* Implementation for nRF52 family. */
-int8_t nrf_802154_rssi_sample_temp_corr_value_get(uint8_t rssi_sample)
-{
-    (void)rssi_sample;
+/** @brief Cached correction value computed for the last reported temperature. */
+static volatile int8_t m_temp_corr;
 
-    int8_t temp = nrf_802154_temperature_get();
+/**
+ * @brief Calculates the RSSISAMPLE temperature correction value for the given temperature.
+ *
+ * @param[in]  temp  Temperature in degrees Celsius.
+ *
+ * @returns RSSISAMPLE temperature correction value.
+ */
+static int8_t temp_corr_value_calculate(int8_t temp)
+{
     int8_t result;
 
 #if defined(NRF52840_XXAA) || defined(NRF52833_XXAA)
@@ -94,11 +100,25 @@ int8_t nrf_802154_rssi_sample_temp_corr_value_get(uint8_t rssi_sample)
     }
 #else
     /* Implementation for other SoCs from nRF52 family */
+    (void)temp;
     result = 0;
 #endif
     return result;
 }
 
+void nrf_802154_rssi_temperature_changed(void)
+{
+    m_temp_corr = temp_corr_value_calculate(nrf_802154_temperature_get());
+}
+
+/* Implementation for nRF52 family. */
+int8_t nrf_802154_rssi_sample_temp_corr_value_get(uint8_t rssi_sample)
+{
+    (void)rssi_sample;
+
+    return m_temp_corr;
+}
+
 #else
 
 /** Macro for calculating x raised to the power of 2. */
@@ -136,24 +156,75 @@ static int8_t normalize_rssi(int32_t rssi_value)
     return (rssi_value < 0) ? (-(int8_t)abs_rssi_value) : ((int8_t)abs_rssi_value);
 }
 
-/* Implementation based on Errata 87 for nRF53 family. */
-int8_t nrf_802154_rssi_sample_temp_corr_value_get(uint8_t rssi_sample)
+/** @brief Number of sample values covered by the cached correction table. */
+#define RSSI_CORR_TABLE_SIZE 128U
+
+/**
+ * @brief Cached correction tables indexed by the sample value.
+ *
+ * Two tables are kept so that a refresh triggered by a temperature change never exposes
+ * a partially updated table to a reader running in a higher priority context.
+ */
+static int8_t m_temp_corr_tables[2][RSSI_CORR_TABLE_SIZE];
+
+/** @brief Index of the table in @ref m_temp_corr_tables that is currently in use. */
+static volatile uint8_t m_temp_corr_table_idx;
+
+/** @brief Temperature the table in use was calculated for. */
+static volatile int8_t m_temp_corr_temp;
+
+/**
+ * @brief Calculates the RSSISAMPLE temperature correction value.
+ *
+ * @param[in]  rssi_sample  Value read from the RSSISAMPLE register.
+ * @param[in]  temp         Temperature in degrees Celsius.
+ *
+ * @returns RSSISAMPLE temperature correction value.
+ */
+static int8_t temp_corr_value_calculate(uint8_t rssi_sample, int8_t temp)
 {
-    int32_t temp;
+    int32_t temp_i32;
     int32_t rssi_sample_i32;
     int8_t  compensated_rssi;
 
-    temp            = (int32_t)nrf_802154_temperature_get();
+    temp_i32        = (int32_t)temp;
     rssi_sample_i32 = (int32_t)rssi_sample;
 
     compensated_rssi = normalize_rssi((RSSI_COEFF_A1 * rssi_sample_i32)
                                       + (RSSI_COEFF_A3 * POW_3(rssi_sample_i32))
                                       - (RSSI_COEFF_A2 * POW_2(rssi_sample_i32))
-                                      - (RSSI_COEFF_TEMP * temp) - RSSI_COEFF_A0);
+                                      - (RSSI_COEFF_TEMP * temp_i32) - RSSI_COEFF_A0);
 
     return compensated_rssi - (int8_t)rssi_sample;
 }
 
+void nrf_802154_rssi_temperature_changed(void)
+{
+    int8_t  temp = nrf_802154_temperature_get();
+    uint8_t idx  = m_temp_corr_table_idx ^ 1U;
+
+    for (uint32_t i = 0U; i < RSSI_CORR_TABLE_SIZE; i++)
+    {
+        m_temp_corr_tables[idx][i] = temp_corr_value_calculate((uint8_t)i, temp);
+    }
+
+    m_temp_corr_temp = temp;
+    __DMB();
+    m_temp_corr_table_idx = idx;
+}
+
+/* Implementation based on Errata 87 for nRF53 family. */
+int8_t nrf_802154_rssi_sample_temp_corr_value_get(uint8_t rssi_sample)
+{
+    if (rssi_sample < RSSI_CORR_TABLE_SIZE)
+    {
+        return m_temp_corr_tables[m_temp_corr_table_idx][rssi_sample];
+    }
+
+    /* Values outside of the RSSISAMPLE range are not cached. */
+    return temp_corr_value_calculate(rssi_sample, m_temp_corr_temp);
+}
+
 #endif
 
 uint8_t nrf_802154_rssi_sample_corrected_get(uint8_t rssi_sample)
@@ -44,10 +44,20 @@
  * @brief RSSI calculations used internally in the 802.15.4 driver.
  */
 
+/**
+ * @brief Refreshes the cached RSSISAMPLE temperature correction.
+ *
+ * This function must be called during driver initialization and each time the platform
+ * reports a temperature change.
+ */
+void nrf_802154_rssi_temperature_changed(void);
+
 /**
  * @brief Gets the RSSISAMPLE temperature correction value.
  *
- * The correction value is based on the last temperature value reported by the platform.
+ * The correction value is taken from the cache refreshed by
+ * @ref nrf_802154_rssi_temperature_changed, so it is based on the last temperature value
+ * reported by the platform.
  *
  * @param[in]  rssi_sample  Value read from the RSSISAMPLE register.
  *
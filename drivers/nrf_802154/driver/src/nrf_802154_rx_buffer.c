@@ -40,33 +40,197 @@
 
 #include "nrf_802154_rx_buffer.h"
 
+#include <assert.h>
 #include <stddef.h>
+#include <string.h>
 
 #include "nrf_802154_config.h"
+#include "nrf_802154_sl_atomics.h"
 
 #if NRF_802154_RX_BUFFERS < 1
 #error Not enough rx buffers in the 802.15.4 radio driver.
 #endif
 
+/// Number of bits in a single word of the free buffers bitmap.
+#define FREE_MASK_WORD_BITS 32U
+/// Number of words in a free buffers bitmap of the given number of buffers.
+#define FREE_MASK_WORDS(buffers) \
+    (((buffers) + FREE_MASK_WORD_BITS - 1U) / FREE_MASK_WORD_BITS)
+
 rx_buffer_t nrf_802154_rx_buffers[NRF_802154_RX_BUFFERS]; ///< Receive buffers.
 
+/// Bitmap of free buffers. Bit n is set if nrf_802154_rx_buffers[n] is free.
+static uint32_t m_free_mask[FREE_MASK_WORDS(NRF_802154_RX_BUFFERS)];
+
+#if NRF_802154_RX_BUFFERS_SHORT > 0
+rx_buffer_short_t nrf_802154_rx_buffers_short[NRF_802154_RX_BUFFERS_SHORT]; ///< Short receive buffers.
+
+/// Bitmap of free short buffers. Bit n is set if nrf_802154_rx_buffers_short[n] is free.
+static uint32_t m_short_free_mask[FREE_MASK_WORDS(NRF_802154_RX_BUFFERS_SHORT)];
+#endif
+
+/** Get the bitmap tracking a buffer and the index of the buffer within it.
+ *
+ * @param[in]   p_buffer  Pointer to a full-size or a short buffer.
+ * @param[out]  p_index   Index of the buffer within the returned bitmap.
+ *
+ * @returns  Pointer to the bitmap tracking @p p_buffer.
+ */
+static uint32_t * buffer_locate(const rx_buffer_t * p_buffer, uint32_t * p_index)
+{
+#if NRF_802154_RX_BUFFERS_SHORT > 0
+    if (nrf_802154_rx_buffer_is_short(p_buffer->data))
+    {
+        *p_index = (uint32_t)((const rx_buffer_short_t *)p_buffer - nrf_802154_rx_buffers_short);
+
+        return m_short_free_mask;
+    }
+#endif
+
+    *p_index = (uint32_t)(p_buffer - nrf_802154_rx_buffers);
+
+    assert(*p_index < NRF_802154_RX_BUFFERS);
+
+    return m_free_mask;
+}
+
+static void free_mask_update(uint32_t * p_mask, uint32_t index, bool free)
+{
+    uint32_t * p_word   = &p_mask[index / FREE_MASK_WORD_BITS];
+    uint32_t   bit      = 1UL << (index % FREE_MASK_WORD_BITS);
+    uint32_t   expected = nrf_802154_sl_atomic_load_u32(p_word);
+    uint32_t   desired;
+
+    do
+    {
+        desired = free ? (expected | bit) : (expected & ~bit);
+    }
+    while (!nrf_802154_sl_atomic_cas_u32(p_word, &expected, desired));
+}
+
+/** Find the lowest index of a free buffer in a bitmap.
+ *
+ * @param[in]   p_mask   Pointer to the bitmap.
+ * @param[in]   words    Number of words of the bitmap.
+ * @param[out]  p_index  Index of the free buffer.
+ *
+ * @retval true   A free buffer was found.
+ * @retval false  All buffers tracked by the bitmap are taken.
+ */
+static bool free_mask_find(uint32_t * p_mask, uint32_t words, uint32_t * p_index)
+{
+    for (uint32_t i = 0; i < words; i++)
+    {
+        uint32_t mask = nrf_802154_sl_atomic_load_u32(&p_mask[i]);
+
+        if (mask != 0U)
+        {
+            *p_index = (i * FREE_MASK_WORD_BITS) + NRF_CTZ(mask);
+            return true;
+        }
+    }
+
+    return false;
+}
+
 void nrf_802154_rx_buffer_init(void)
 {
     for (uint32_t i = 0; i < NRF_802154_RX_BUFFERS; i++)
     {
-        nrf_802154_rx_buffers[i].free = true;
+        free_mask_update(m_free_mask, i, true);
+    }
+
+#if NRF_802154_RX_BUFFERS_SHORT > 0
+    for (uint32_t i = 0; i < NRF_802154_RX_BUFFERS_SHORT; i++)
+    {
+        free_mask_update(m_short_free_mask, i, true);
     }
+#endif
 }
 
 rx_buffer_t * nrf_802154_rx_buffer_free_find(void)
 {
-    for (uint32_t i = 0; i < NRF_802154_RX_BUFFERS; i++)
+    uint32_t index;
+
+    if (free_mask_find(m_free_mask, FREE_MASK_WORDS(NRF_802154_RX_BUFFERS), &index))
+    {
+        return &nrf_802154_rx_buffers[index];
+    }
+
+    return NULL;
+}
+
+uint8_t * nrf_802154_rx_buffer_compact(rx_buffer_t * p_buffer)
+{
+#if NRF_802154_RX_BUFFERS_SHORT > 0
+    rx_buffer_short_t * p_short;
+    uint32_t            index;
+
+    if ((p_buffer->data[PHR_OFFSET] > NRF_802154_RX_BUFFER_SHORT_PSDU_SIZE) ||
+        !free_mask_find(m_short_free_mask,
+                        FREE_MASK_WORDS(NRF_802154_RX_BUFFERS_SHORT),
+                        &index))
     {
-        if (nrf_802154_rx_buffers[i].free)
+        return NULL;
+    }
+
+    p_short = &nrf_802154_rx_buffers_short[index];
+
+    memcpy(p_short->data, p_buffer->data, PHR_SIZE + p_buffer->data[PHR_OFFSET]);
+#if NRF_802154_RX_METADATA_ENABLED
+    p_short->metadata = p_buffer->metadata;
+#endif
+
+    free_mask_update(m_short_free_mask, index, false);
+    nrf_802154_rx_buffer_release(p_buffer);
+
+    return p_short->data;
+#else
+    (void)p_buffer;
+
+    return NULL;
+#endif
+}
+
+void nrf_802154_rx_buffer_acquire(rx_buffer_t * p_buffer)
+{
+    uint32_t   index;
+    uint32_t * p_mask = buffer_locate(p_buffer, &index);
+
+    free_mask_update(p_mask, index, false);
+}
+
+void nrf_802154_rx_buffer_release(rx_buffer_t * p_buffer)
+{
+    uint32_t   index;
+    uint32_t * p_mask = buffer_locate(p_buffer, &index);
+
+    free_mask_update(p_mask, index, true);
+}
+
+bool nrf_802154_rx_buffer_is_free(const rx_buffer_t * p_buffer)
+{
+    uint32_t   index;
+    uint32_t * p_mask = buffer_locate(p_buffer, &index);
+    uint32_t   mask   = nrf_802154_sl_atomic_load_u32(&p_mask[index / FREE_MASK_WORD_BITS]);
+
+    return (mask & (1UL << (index % FREE_MASK_WORD_BITS))) != 0U;
+}
+
+uint32_t nrf_802154_rx_buffer_free_count_get(void)
+{
+    uint32_t count = 0U;
+
+    for (uint32_t i = 0; i < FREE_MASK_WORDS(NRF_802154_RX_BUFFERS); i++)
+    {
+        uint32_t mask = nrf_802154_sl_atomic_load_u32(&m_free_mask[i]);
+
+        while (mask != 0U)
         {
-            return &nrf_802154_rx_buffers[i];
+            mask &= mask - 1U;
+            count++;
         }
     }
 
-    return NULL;
+    return count;
 }
@@ -43,7 +43,9 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
+#include "nrf_802154_types.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -55,7 +57,9 @@ extern "C" {
 typedef struct
 {
     uint8_t data[MAX_PACKET_SIZE + 1];
-    bool    free; // If this buffer is free or contains a frame.
+#if NRF_802154_RX_METADATA_ENABLED
+    nrf_802154_received_metadata_t metadata; ///< Metadata of the received frame.
+#endif
 } rx_buffer_t;
 
 /**
@@ -67,18 +71,135 @@ typedef struct
  */
 extern rx_buffer_t nrf_802154_rx_buffers[];
 
+#if NRF_802154_RX_BUFFERS_SHORT > 0
+
+/**
+ * @brief Structure that contains a short received frame.
+ *
+ * The layout matches @ref rx_buffer_t up to the length of the data, so the data of both can be
+ * passed to the higher layer the same way.
+ */
+typedef struct
+{
+    uint8_t data[NRF_802154_RX_BUFFER_SHORT_PSDU_SIZE + 1];
+#if NRF_802154_RX_METADATA_ENABLED
+    nrf_802154_received_metadata_t metadata; ///< Metadata of the received frame.
+#endif
+} rx_buffer_short_t;
+
+/**
+ * @brief Array that contains all buffers used to hold short received frames.
+ */
+extern rx_buffer_short_t nrf_802154_rx_buffers_short[];
+
+#endif // NRF_802154_RX_BUFFERS_SHORT > 0
+
 /**
  * @brief Initializes the buffer for received frames.
  */
 void nrf_802154_rx_buffer_init(void);
 
 /**
- * @brief Gets a free buffer to receive a frame.
+ * @brief Gets a free full-size buffer to receive a frame.
+ *
+ * The returned buffer remains free until @ref nrf_802154_rx_buffer_acquire is called for it.
+ * This function takes constant time regardless of the number of buffers.
  *
  * @returns  Pointer to a free buffer, or NULL if no free buffer is available.
  */
 rx_buffer_t * nrf_802154_rx_buffer_free_find(void);
 
+/**
+ * @brief Moves a received frame to a free short buffer if it fits in one.
+ *
+ * On success the short buffer is marked as containing the received frame, together with its
+ * metadata, and @p p_buffer is marked as free.
+ *
+ * @param[in]  p_buffer  Pointer to a full-size buffer containing a received frame.
+ *
+ * @returns  Pointer to the data of the short buffer the frame was moved to, or NULL if the frame
+ *           is too long or no short buffer is free.
+ */
+uint8_t * nrf_802154_rx_buffer_compact(rx_buffer_t * p_buffer);
+
+/**
+ * @brief Checks if data belongs to a short buffer.
+ *
+ * @param[in]  p_data  Pointer to the data of a buffer, as passed to the higher layer.
+ *
+ * @retval true   @p p_data belongs to one of the short buffers.
+ * @retval false  @p p_data belongs to one of the full-size buffers.
+ */
+static inline bool nrf_802154_rx_buffer_is_short(const uint8_t * p_data)
+{
+#if NRF_802154_RX_BUFFERS_SHORT > 0
+    uintptr_t address = (uintptr_t)p_data;
+
+    return (address >= (uintptr_t)&nrf_802154_rx_buffers_short[0]) &&
+           (address < (uintptr_t)&nrf_802154_rx_buffers_short[NRF_802154_RX_BUFFERS_SHORT]);
+#else
+    (void)p_data;
+
+    return false;
+#endif
+}
+
+/**
+ * @brief Marks a buffer as containing a received frame.
+ *
+ * @param[in]  p_buffer  Pointer to the buffer to be marked.
+ */
+void nrf_802154_rx_buffer_acquire(rx_buffer_t * p_buffer);
+
+/**
+ * @brief Marks a buffer as free.
+ *
+ * This function can be called from any context.
+ *
+ * @param[in]  p_buffer  Pointer to the buffer to be marked. It may point to a short buffer.
+ */
+void nrf_802154_rx_buffer_release(rx_buffer_t * p_buffer);
+
+/**
+ * @brief Checks if a buffer is free.
+ *
+ * @param[in]  p_buffer  Pointer to the buffer to be checked. It may point to a short buffer.
+ *
+ * @retval true   The buffer is free.
+ * @retval false  The buffer contains a received frame.
+ */
+bool nrf_802154_rx_buffer_is_free(const rx_buffer_t * p_buffer);
+
+/**
+ * @brief Gets the number of full-size buffers that are currently free.
+ *
+ * @returns  Number of free buffers frames can be received to.
+ */
+uint32_t nrf_802154_rx_buffer_free_count_get(void);
+
+#if NRF_802154_RX_METADATA_ENABLED
+
+/**
+ * @brief Gets the metadata stored with a buffer.
+ *
+ * @param[in]  p_data  Pointer to the data of the buffer, as passed to the higher layer.
+ *
+ * @returns  Pointer to the metadata of the frame held by the buffer.
+ */
+static inline nrf_802154_received_metadata_t * nrf_802154_rx_buffer_metadata_get(uint8_t * p_data)
+{
+#if NRF_802154_RX_BUFFERS_SHORT > 0
+    if (nrf_802154_rx_buffer_is_short(p_data))
+    {
+        return &((rx_buffer_short_t *)p_data)->metadata;
+    }
+#endif
+
+    return &((rx_buffer_t *)p_data)->metadata;
+}
+
+#endif // NRF_802154_RX_METADATA_ENABLED
+
 #ifdef __cplusplus
 }
 #endif
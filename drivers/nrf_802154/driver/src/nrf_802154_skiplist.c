@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements an ordered skip list used by the 802.15.4 driver.
+ *
+ */
+
+#include "nrf_802154_skiplist.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "nrf_802154_utils.h"
+
+#define LEVEL_SEED_INIT 0x2545F491UL ///< Non-zero initial state of the level generator.
+
+/**@brief Gets the membership capability of an item. */
+static nrf_802154_skiplist_membership_capability_t * membership_get(void * p_item, size_t offset)
+{
+    return (nrf_802154_skiplist_membership_capability_t *)((uint8_t *)p_item + offset);
+}
+
+/**@brief Gets the pointer to the next item field on a level of the list.
+ *
+ * @param p_list  Pointer to the list.
+ * @param p_item  Pointer to the item, or NULL for the head of the list.
+ * @param offset  Offset of the membership capability within the item.
+ * @param level   Level of the list.
+ */
+static void * volatile * next_ptr_get(nrf_802154_skiplist_t * p_list,
+                                      void                  * p_item,
+                                      size_t                  offset,
+                                      uint8_t                 level)
+{
+    if (p_item == NULL)
+    {
+        return &p_list->p_head[level];
+    }
+
+    return &membership_get(p_item, offset)->p_next[level];
+}
+
+/**@brief Draws the number of levels of an inserted item.
+ *
+ * Each next level is drawn with the probability of 1/4, so the expected search cost is
+ * logarithmic for up to 4^@ref NRF_802154_SKIPLIST_LEVELS items.
+ */
+static uint8_t levels_draw(nrf_802154_skiplist_t * p_list)
+{
+    uint32_t x = p_list->level_seed;
+
+    // xorshift32
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+
+    p_list->level_seed = x;
+
+    uint8_t levels = 1U;
+
+    while ((levels < NRF_802154_SKIPLIST_LEVELS) && ((x & 0x3U) == 0U))
+    {
+        levels++;
+        x >>= 2;
+    }
+
+    return levels;
+}
+
+/**@brief Finds the last item on each level after which an item can be linked or unlinked.
+ *
+ * @param p_list        Pointer to the list.
+ * @param p_item        Pointer to the item being inserted or removed.
+ * @param offset        Offset of the membership capability within the items.
+ * @param compare_func  Function that determines an order in the list.
+ * @param insert        If true, items equal to @p p_item are skipped (insertion).
+ *                      Otherwise, the search stops at the first equal item (removal).
+ * @param p_prev        Array filled with the found items, NULL meaning the head of the list.
+ */
+static void prev_find(nrf_802154_skiplist_t      * p_list,
+                      void                       * p_item,
+                      size_t                       offset,
+                      nrf_802154_sl_compare_func_t compare_func,
+                      bool                         insert,
+                      void                      ** p_prev)
+{
+    void * p_cur = NULL;
+
+    for (int32_t level = NRF_802154_SKIPLIST_LEVELS - 1; level >= 0; level--)
+    {
+        void * p_next = *next_ptr_get(p_list, p_cur, offset, (uint8_t)level);
+
+        while (p_next != NULL)
+        {
+            int_fast8_t cmp = compare_func(p_item, p_next);
+
+            if ((cmp < 0) || ((cmp == 0) && !insert))
+            {
+                break;
+            }
+
+            p_cur  = p_next;
+            p_next = *next_ptr_get(p_list, p_cur, offset, (uint8_t)level);
+        }
+
+        p_prev[level] = p_cur;
+    }
+}
+
+/**@brief Unlinks an item from all the levels of the list.
+ *
+ * @param p_list  Pointer to the list.
+ * @param p_item  Pointer to the item to unlink.
+ * @param offset  Offset of the membership capability within the items.
+ * @param p_prev  Array of items preceding @p p_item on each level, NULL meaning the head.
+ */
+static void item_unlink(nrf_802154_skiplist_t * p_list,
+                        void                  * p_item,
+                        size_t                  offset,
+                        void                 ** p_prev)
+{
+    nrf_802154_skiplist_membership_capability_t * p_membership = membership_get(p_item, offset);
+
+    // The bottom level goes first, so that lock-free readers stop seeing the item right away.
+    for (uint8_t level = 0U; level < p_membership->levels; level++)
+    {
+        *next_ptr_get(p_list, p_prev[level], offset, level) = p_membership->p_next[level];
+    }
+}
+
+void nrf_802154_skiplist_init(nrf_802154_skiplist_t * p_list)
+{
+    for (uint8_t level = 0U; level < NRF_802154_SKIPLIST_LEVELS; level++)
+    {
+        p_list->p_head[level] = NULL;
+    }
+
+    p_list->level_seed = LEVEL_SEED_INIT;
+}
+
+void nrf_802154_skiplist_insert_ordered(nrf_802154_skiplist_t      * p_list,
+                                        void                       * p_item,
+                                        size_t                       offsetof_membership_capability,
+                                        nrf_802154_sl_compare_func_t compare_func)
+{
+    nrf_802154_mcu_critical_state_t               mcu_cs;
+    nrf_802154_skiplist_membership_capability_t * p_membership;
+    void                                        * p_prev[NRF_802154_SKIPLIST_LEVELS];
+
+    p_membership = membership_get(p_item, offsetof_membership_capability);
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    prev_find(p_list, p_item, offsetof_membership_capability, compare_func, true, p_prev);
+
+    p_membership->levels = levels_draw(p_list);
+
+    for (uint8_t level = 0U; level < p_membership->levels; level++)
+    {
+        p_membership->p_next[level] =
+            *next_ptr_get(p_list, p_prev[level], offsetof_membership_capability, level);
+    }
+
+    // Make sure the item is complete before it becomes visible to lock-free readers.
+    __DMB();
+
+    // The bottom level goes last, so that lock-free readers see the item once it is fully linked.
+    for (int32_t level = p_membership->levels - 1; level >= 0; level--)
+    {
+        *next_ptr_get(p_list, p_prev[level], offsetof_membership_capability, (uint8_t)level) =
+            p_item;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+bool nrf_802154_skiplist_remove(nrf_802154_skiplist_t      * p_list,
+                                void                       * p_item,
+                                size_t                       offsetof_membership_capability,
+                                nrf_802154_sl_compare_func_t compare_func)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    void                          * p_prev[NRF_802154_SKIPLIST_LEVELS];
+    bool                            result = false;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    prev_find(p_list, p_item, offsetof_membership_capability, compare_func, false, p_prev);
+
+    // Items equal to p_item are not ordered. Walk over them on each level to reach p_item.
+    for (uint8_t level = 0U; level < NRF_802154_SKIPLIST_LEVELS; level++)
+    {
+        void * p_next = *next_ptr_get(p_list,
+                                      p_prev[level],
+                                      offsetof_membership_capability,
+                                      level);
+
+        while ((p_next != NULL) && (p_next != p_item) && (compare_func(p_item, p_next) == 0))
+        {
+            p_prev[level] = p_next;
+            p_next        = *next_ptr_get(p_list, p_next, offsetof_membership_capability, level);
+        }
+
+        if (p_next != p_item)
+        {
+            // The item is linked on the bottom level and on a contiguous range of levels above.
+            break;
+        }
+
+        if (level == 0U)
+        {
+            result = true;
+        }
+    }
+
+    if (result)
+    {
+        item_unlink(p_list, p_item, offsetof_membership_capability, p_prev);
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+void * nrf_802154_skiplist_head_peek(const nrf_802154_skiplist_t * p_list)
+{
+    return p_list->p_head[0];
+}
+
+void * nrf_802154_skiplist_remove_head_if_criteria_met(
+    nrf_802154_skiplist_t      * p_list,
+    size_t                       offsetof_membership_capability,
+    nrf_802154_sl_checker_func_t checker_func,
+    const void                 * p_checker_func_param)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    void                          * p_prev[NRF_802154_SKIPLIST_LEVELS];
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    void * p_head = p_list->p_head[0];
+
+    if ((p_head != NULL) && checker_func(p_head, p_checker_func_param))
+    {
+        // The head of the list is the first item on each level it is linked on.
+        for (uint8_t level = 0U; level < NRF_802154_SKIPLIST_LEVELS; level++)
+        {
+            p_prev[level] = NULL;
+        }
+
+        item_unlink(p_list, p_head, offsetof_membership_capability, p_prev);
+    }
+    else
+    {
+        p_head = NULL;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return p_head;
+}
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Module implementing an ordered skip list.
+ *
+ * The skip list keeps the same ordering semantics as @ref nrf_802154_sl_atomic_list_insert_ordered,
+ * and uses the same @ref nrf_802154_sl_compare_func_t and @ref nrf_802154_sl_checker_func_t
+ * callbacks, but finds the insertion and removal points in O(log n) expected time instead of
+ * walking the whole list.
+ *
+ * Modifications of the list are performed inside a short MCU critical section, so they can be
+ * called from any context. The bottom level of the list, which holds all the items in order, is
+ * linked last on insertion and unlinked first on removal with single pointer stores. Because
+ * of that, @ref nrf_802154_skiplist_head_peek does not need the critical section.
+ */
+
+#ifndef NRF_802154_SKIPLIST_H__
+#define NRF_802154_SKIPLIST_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_sl_atomic_list.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Type representing an ordered skip list. */
+typedef struct
+{
+    /**@brief Pointers to the first item of each level of the list. */
+    void * volatile p_head[NRF_802154_SKIPLIST_LEVELS];
+
+    /**@brief State of the generator of item levels. */
+    uint32_t        level_seed;
+} nrf_802154_skiplist_t;
+
+/**@brief Structure that needs to be contained in every struct capable of being stored in
+ *        a skip list.
+ *
+ * Operations on a skip list are generic. To manipulate the list user must provide an offset
+ * to the field of type @ref nrf_802154_skiplist_membership_capability_t within an item structure
+ * as a @c offsetof_membership_capability parameter, as for @ref nrf_802154_sl_atomic_list_t.
+ */
+typedef struct
+{
+    /**@brief Pointers to the next item on each level the item is linked on. */
+    void * volatile p_next[NRF_802154_SKIPLIST_LEVELS];
+
+    /**@brief Number of levels the item is linked on. */
+    uint8_t         levels;
+} nrf_802154_skiplist_membership_capability_t;
+
+/**@brief Initializes an empty skip list.
+ *
+ * Any API function for list manipulation is forbidden before call to this function.
+ *
+ * @param p_list    Pointer to the list to initialize.
+ */
+void nrf_802154_skiplist_init(nrf_802154_skiplist_t * p_list);
+
+/**@brief Inserts an item to an ordered skip list.
+ *
+ * The item is inserted before the first @c entry for which compare_func(p_item, entry) returns -1,
+ * so items that compare equal keep the order of their insertion.
+ *
+ * @param p_list                         Pointer to the list the item is to be inserted.
+ * @param p_item                         Pointer to the item to add. The item must not be
+ *                                       a member of the list.
+ * @param offsetof_membership_capability Offset of
+ *                                       @ref nrf_802154_skiplist_membership_capability_t structure
+ *                                       to be used to build the list.
+ * @param compare_func                   Pointer to a function that determines an order in the list.
+ */
+void nrf_802154_skiplist_insert_ordered(nrf_802154_skiplist_t      * p_list,
+                                        void                       * p_item,
+                                        size_t                       offsetof_membership_capability,
+                                        nrf_802154_sl_compare_func_t compare_func);
+
+/**@brief Removes an item from an ordered skip list.
+ *
+ * @param p_list                         Pointer to the list from which the item is to be removed.
+ * @param p_item                         Pointer to the item to be removed from the list.
+ * @param offsetof_membership_capability Offset of
+ *                                       @ref nrf_802154_skiplist_membership_capability_t structure
+ *                                       to be used to build the list.
+ * @param compare_func                   Pointer to the function the list was ordered with.
+ *
+ * @retval true     The item was found in the list and has been removed.
+ * @retval false    The item was not a member of the list, has been not removed.
+ */
+bool nrf_802154_skiplist_remove(nrf_802154_skiplist_t      * p_list,
+                                void                       * p_item,
+                                size_t                       offsetof_membership_capability,
+                                nrf_802154_sl_compare_func_t compare_func);
+
+/**@brief Peeks at the value of list head.
+ *
+ * @param p_list  Pointer to the list to peek at.
+ *
+ * @returns Pointer of list head.
+ */
+void * nrf_802154_skiplist_head_peek(const nrf_802154_skiplist_t * p_list);
+
+/**@brief Removes the head item from a skip list if the head item meets user-defined criteria.
+ *
+ * @param p_list                         Pointer to a list from which the item is to be removed.
+ * @param offsetof_membership_capability Offset of
+ *                                       @ref nrf_802154_skiplist_membership_capability_t structure
+ *                                       to be used to build the list.
+ * @param checker_func                   Pointer to a function to be called to determine if
+ *                                       the head item should be removed.
+ * @param p_checker_func_param           Parameter passed to @p checker_func
+ *
+ * @retval NULL when there was no head item or the head item didn't pass criteria imposed by
+ *              @p checker_func .
+ * @retval other Pointer to the removed item.
+ */
+void * nrf_802154_skiplist_remove_head_if_criteria_met(
+    nrf_802154_skiplist_t      * p_list,
+    size_t                       offsetof_membership_capability,
+    nrf_802154_sl_checker_func_t checker_func,
+    const void                 * p_checker_func_param);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_802154_SKIPLIST_H__
@@ -32,16 +32,147 @@
  *
  */
 
+#include <assert.h>
+#include <stdbool.h>
 #include <stddef.h>
+#include <string.h>
 
 #include "nrf_802154.h"
+#include "nrf_802154_procedures_duration.h"
+#include "nrf_802154_rx_buffer.h"
 #include "nrf_802154_stats.h"
+#include "nrf_802154_sl_timer.h"
+#include "mac_features/nrf_802154_csma_ca.h"
+#include "helpers/nrfx_perf_counters.h"
 
 #define NUMBER_OF_STAT_COUNTERS (sizeof(nrf_802154_stat_counters_t) / sizeof(uint32_t))
 
 /**@brief Structure holding statistics about the Radio Driver behavior. */
 volatile nrf_802154_stats_t g_nrf_802154_stats;
 
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+/**@brief Structure holding latency histograms of the Radio Driver. */
+volatile nrf_802154_stat_histograms_t g_nrf_802154_stat_histograms;
+#endif
+
+/**@brief Registers the statistic counter @p field in the performance counter registry. */
+#define STAT_COUNTER_REGISTER(field) \
+    NRFX_PERF_COUNTER_REGISTER(field, "802154." #field, g_nrf_802154_stats.counters.field)
+
+STAT_COUNTER_REGISTER(cca_failed_attempts);
+STAT_COUNTER_REGISTER(received_frames);
+STAT_COUNTER_REGISTER(received_energy_events);
+STAT_COUNTER_REGISTER(received_preambles);
+STAT_COUNTER_REGISTER(coex_requests);
+STAT_COUNTER_REGISTER(coex_granted_requests);
+STAT_COUNTER_REGISTER(coex_denied_requests);
+STAT_COUNTER_REGISTER(coex_unsolicited_grants);
+
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+/**@brief Registers the latency histogram @p field in the performance counter registry. */
+#define STAT_HISTOGRAM_REGISTER(field, name) \
+    NRFX_PERF_HISTOGRAM_REGISTER(field, name, g_nrf_802154_stat_histograms.field.bins)
+
+STAT_HISTOGRAM_REGISTER(radio_irq_duration, "802154.radio_irq_duration");
+STAT_HISTOGRAM_REGISTER(notification_latency, "802154.notification_latency");
+STAT_HISTOGRAM_REGISTER(ack_turnaround_margin, "802154.ack_turnaround_margin");
+STAT_HISTOGRAM_REGISTER(csma_ca_backoffs, "802154.csma_ca_backoffs");
+STAT_HISTOGRAM_REGISTER(bcmatch_handler_cycles, "802154.bcmatch_handler_cycles");
+STAT_HISTOGRAM_REGISTER(rx_frame_handler_cycles, "802154.rx_frame_handler_cycles");
+STAT_HISTOGRAM_REGISTER(ack_generation_cycles, "802154.ack_generation_cycles");
+STAT_HISTOGRAM_REGISTER(ack_security_prepare_cycles, "802154.ack_sec_prepare_cycles");
+#endif
+
+#if NRF_802154_STATS_RADIO_TIME_ENABLED
+static nrf_802154_stat_radio_times_t m_radio_times;      ///< Accumulated radio times.
+static nrf_802154_stat_radio_state_t m_radio_state;      ///< Current state of the radio.
+static uint8_t                       m_radio_channel;    ///< Index of the current channel.
+static bool                          m_radio_ramp_up;    ///< If the current state ramps up.
+static uint64_t                      m_radio_state_time; ///< Time the current state was entered.
+
+/**@brief Accounts the time spent in the current state on the current channel up to @p now. */
+static void radio_time_account(uint64_t now)
+{
+    nrf_802154_stat_radio_time_t * p_time   = &m_radio_times.channels[m_radio_channel];
+    uint64_t                       duration = now - m_radio_state_time;
+
+    m_radio_state_time = now;
+
+    if (m_radio_ramp_up)
+    {
+        uint64_t ramp_up = (m_radio_state == NRF_802154_STAT_RADIO_STATE_TX) ?
+                           TX_RAMP_UP_TIME : RX_RAMP_UP_TIME;
+
+        ramp_up = (duration < ramp_up) ? duration : ramp_up;
+
+        p_time->ramp_up_time += ramp_up;
+        duration             -= ramp_up;
+        m_radio_ramp_up       = false;
+    }
+
+    switch (m_radio_state)
+    {
+        case NRF_802154_STAT_RADIO_STATE_IDLE:
+            p_time->idle_time += duration;
+            break;
+
+        case NRF_802154_STAT_RADIO_STATE_RX:
+            p_time->rx_time += duration;
+            break;
+
+        case NRF_802154_STAT_RADIO_STATE_TX:
+            p_time->tx_time += duration;
+            break;
+
+        default:
+            // The time the radio is off is not accounted.
+            break;
+    }
+}
+
+#endif // NRF_802154_STATS_RADIO_TIME_ENABLED
+
+#if NRF_802154_STATS_TIMESLOT_ENABLED
+static nrf_802154_stat_timeslots_t m_timeslots;           ///< Collected timeslot statistics.
+static bool                        m_timeslot_needed;     ///< If the driver needs the radio.
+static bool                        m_timeslot_granted;    ///< If a timeslot is granted.
+static uint64_t                    m_timeslot_wait_time;  ///< Time the driver started waiting for a timeslot.
+static uint64_t                    m_timeslot_start_time; ///< Time the granted timeslot started.
+
+/**@brief Starts measuring the time the driver waits for a timeslot. */
+static void timeslot_wait_start(uint64_t now)
+{
+    m_timeslot_wait_time = now;
+    m_timeslots.requests++;
+}
+
+/**@brief Accounts the time the driver waited for a timeslot up to @p now. */
+static void timeslot_wait_end(uint64_t now)
+{
+    uint64_t duration = now - m_timeslot_wait_time;
+
+    m_timeslots.total_denied_time += duration;
+
+    if (duration > m_timeslots.max_denied_time)
+    {
+        m_timeslots.max_denied_time = duration;
+    }
+}
+
+#endif // NRF_802154_STATS_TIMESLOT_ENABLED
+
+#if NRF_802154_STATS_CRITICAL_SECTION_ENABLED
+static nrf_802154_stat_critical_sections_t m_critical_sections; ///< Collected critical section statistics.
+#endif
+
+void nrf_802154_stats_init(void)
+{
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED || NRF_802154_STATS_CRITICAL_SECTION_ENABLED
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
 void nrf_802154_stats_get(nrf_802154_stats_t * p_stats)
 {
     *p_stats = g_nrf_802154_stats;
@@ -70,6 +201,20 @@ void nrf_802154_stat_counters_subtract(const nrf_802154_stat_counters_t * p_stat
     }
 }
 
+uint32_t nrf_802154_stat_rx_buffers_free_get(void)
+{
+    return nrf_802154_rx_buffer_free_count_get();
+}
+
+#if NRF_802154_CSMA_CA_ENABLED
+
+uint8_t nrf_802154_stat_channel_occupancy_get(void)
+{
+    return nrf_802154_csma_ca_channel_occupancy_get();
+}
+
+#endif // NRF_802154_CSMA_CA_ENABLED
+
 void nrf_802154_stat_timestamps_get(nrf_802154_stat_timestamps_t * p_stat_timestamps)
 {
     *p_stat_timestamps = g_nrf_802154_stats.timestamps;
@@ -84,3 +229,253 @@ void nrf_802154_stat_counters_reset(void)
         *(p_dst++) = 0U;
     }
 }
+
+void nrf_802154_stat_histograms_get(nrf_802154_stat_histograms_t * p_stat_histograms)
+{
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+    *p_stat_histograms = g_nrf_802154_stat_histograms;
+#else
+    memset(p_stat_histograms, 0, sizeof(*p_stat_histograms));
+#endif
+}
+
+bool nrf_802154_perf_counter_get(uint32_t index, nrf_802154_perf_counter_t * p_counter)
+{
+#if NRFX_CHECK(NRFX_PERF_COUNTERS_ENABLED)
+    const nrfx_perf_counter_t * p_desc = nrfx_perf_counter_get(index);
+
+    if (p_desc == NULL)
+    {
+        return false;
+    }
+
+    strncpy(p_counter->name, p_desc->p_name, NRF_802154_PERF_COUNTER_NAME_MAX_LEN);
+    p_counter->name[NRF_802154_PERF_COUNTER_NAME_MAX_LEN] = '\0';
+
+    p_counter->type   = p_desc->type;
+    p_counter->length = (uint8_t)nrfx_perf_counter_read(p_desc,
+                                                        p_counter->values,
+                                                        NRF_802154_PERF_COUNTER_VALUES_MAX);
+
+    return true;
+#else
+    (void)index;
+    (void)p_counter;
+
+    return false;
+#endif
+}
+
+void nrf_802154_stat_histograms_reset(void)
+{
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+    memset((void *)&g_nrf_802154_stat_histograms, 0, sizeof(g_nrf_802154_stat_histograms));
+#endif
+}
+
+#if NRF_802154_STATS_RADIO_TIME_ENABLED
+
+void nrf_802154_stat_radio_state_set(nrf_802154_stat_radio_state_t state)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    radio_time_account(nrf_802154_sl_timer_current_time_get());
+
+    m_radio_ramp_up = (state != m_radio_state) &&
+                      ((state == NRF_802154_STAT_RADIO_STATE_RX) ||
+                       (state == NRF_802154_STAT_RADIO_STATE_TX));
+    m_radio_state = state;
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_stat_radio_channel_set(uint8_t channel)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    assert((channel >= 11U) && (channel < 11U + NRF_802154_STAT_RADIO_TIME_CHANNELS));
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    radio_time_account(nrf_802154_sl_timer_current_time_get());
+
+    m_radio_channel = channel - 11U;
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_stat_radio_times_get(nrf_802154_stat_radio_times_t * p_stat_radio_times)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    // Account the ongoing state so that the returned times are up to date.
+    radio_time_account(nrf_802154_sl_timer_current_time_get());
+
+    *p_stat_radio_times = m_radio_times;
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_stat_radio_times_reset(void)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    radio_time_account(nrf_802154_sl_timer_current_time_get());
+
+    memset(&m_radio_times, 0, sizeof(m_radio_times));
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+#endif // NRF_802154_STATS_RADIO_TIME_ENABLED
+
+#if NRF_802154_STATS_TIMESLOT_ENABLED
+
+void nrf_802154_stat_timeslot_needed_set(bool needed)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    if ((needed != m_timeslot_needed) && !m_timeslot_granted)
+    {
+        uint64_t now = nrf_802154_sl_timer_current_time_get();
+
+        if (needed)
+        {
+            timeslot_wait_start(now);
+        }
+        else
+        {
+            timeslot_wait_end(now);
+        }
+    }
+
+    m_timeslot_needed = needed;
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_stat_timeslot_started(void)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    uint64_t                        now = nrf_802154_sl_timer_current_time_get();
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    if (m_timeslot_needed)
+    {
+        timeslot_wait_end(now);
+    }
+
+    m_timeslot_granted    = true;
+    m_timeslot_start_time = now;
+    m_timeslots.granted++;
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_stat_timeslot_ended(bool frame_lost)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    uint64_t                        now = nrf_802154_sl_timer_current_time_get();
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    m_timeslot_granted        = false;
+    m_timeslots.granted_time += now - m_timeslot_start_time;
+
+    if (frame_lost)
+    {
+        m_timeslots.lost_frames++;
+    }
+
+    if (m_timeslot_needed)
+    {
+        m_timeslots.preemptions++;
+        timeslot_wait_start(now);
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_stat_timeslots_get(nrf_802154_stat_timeslots_t * p_stat_timeslots)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    *p_stat_timeslots = m_timeslots;
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_stat_timeslots_reset(void)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    uint64_t                        now = nrf_802154_sl_timer_current_time_get();
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    memset(&m_timeslots, 0, sizeof(m_timeslots));
+
+    // Ongoing periods are accounted from the moment of the reset.
+    m_timeslot_wait_time  = now;
+    m_timeslot_start_time = now;
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+#endif // NRF_802154_STATS_TIMESLOT_ENABLED
+
+#if NRF_802154_STATS_CRITICAL_SECTION_ENABLED
+
+void nrf_802154_stat_critical_section_account(uint32_t cycles, uint32_t caller, int8_t priority)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    m_critical_sections.count++;
+    m_critical_sections.total_cycles += cycles;
+
+    if (cycles > m_critical_sections.max_cycles)
+    {
+        m_critical_sections.max_cycles   = cycles;
+        m_critical_sections.max_caller   = caller;
+        m_critical_sections.max_priority = priority;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_stat_critical_sections_get(
+    nrf_802154_stat_critical_sections_t * p_stat_critical_sections)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    *p_stat_critical_sections = m_critical_sections;
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_stat_critical_sections_reset(void)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    memset(&m_critical_sections, 0, sizeof(m_critical_sections));
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+#endif // NRF_802154_STATS_CRITICAL_SECTION_ENABLED
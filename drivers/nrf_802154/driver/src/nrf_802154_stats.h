@@ -35,9 +35,98 @@
 #ifndef NRF_802154_STATS_H_
 #define NRF_802154_STATS_H_
 
+#include "nrf_802154_config.h"
 #include "nrf_802154_types.h"
 #include "nrf_802154_utils.h"
 
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+#include "platform/nrf_802154_hp_timer.h"
+#endif
+
+/**@brief Get the current time used to measure durations collected in the histograms. */
+#define nrf_802154_stat_histogram_time_get() NRF_802154_STATS_HISTOGRAMS_TIME_GET()
+
+/**@brief Get the current value of the cycle counter used to measure durations of handlers. */
+#define nrf_802154_stat_histogram_cycles_get() NRF_802154_STATS_HISTOGRAMS_CYCLES_GET()
+
+/**@brief Get the bin of a histogram that counts the given sample.
+ *
+ * @param[in] value  Sample value.
+ *
+ * @return Index of the bin as described in @ref nrf_802154_stat_histogram_t, before it is limited
+ *         to the last bin.
+ */
+static inline uint32_t nrf_802154_stat_histogram_bin_get(uint32_t value)
+{
+    return (value == 0U) ? 0U : (32U - __CLZ(value));
+}
+
+/**@brief Initialize the statistics module.
+ *
+ * Enables the cycle counter of the DWT unit if the histograms are collected or the durations of
+ * critical sections are measured.
+ */
+void nrf_802154_stats_init(void);
+
+#if NRF_802154_STATS_RADIO_TIME_ENABLED
+
+/**@brief States of the radio distinguished by the radio time accounting. */
+typedef enum
+{
+    NRF_802154_STAT_RADIO_STATE_OFF,  ///< The radio is disabled. This time is not accounted.
+    NRF_802154_STAT_RADIO_STATE_IDLE, ///< The radio is enabled, but not receiving or transmitting.
+    NRF_802154_STAT_RADIO_STATE_RX,   ///< The radio is receiving.
+    NRF_802154_STAT_RADIO_STATE_TX,   ///< The radio is transmitting.
+} nrf_802154_stat_radio_state_t;
+
+/**@brief Notify the radio time accounting that the radio changed its state.
+ *
+ * Entering @ref NRF_802154_STAT_RADIO_STATE_RX or @ref NRF_802154_STAT_RADIO_STATE_TX from
+ * another state is assumed to start with a ramp-up.
+ *
+ * @param[in] state  New state of the radio.
+ */
+void nrf_802154_stat_radio_state_set(nrf_802154_stat_radio_state_t state);
+
+/**@brief Notify the radio time accounting that the radio changed its channel.
+ *
+ * @param[in] channel  New channel of the radio, in range from 11 to 26.
+ */
+void nrf_802154_stat_radio_channel_set(uint8_t channel);
+
+#endif // NRF_802154_STATS_RADIO_TIME_ENABLED
+
+#if NRF_802154_STATS_TIMESLOT_ENABLED
+
+/**@brief Notify the timeslot statistics whether the driver needs the radio.
+ *
+ * @param[in] needed  If the driver is in a state that requires a timeslot.
+ */
+void nrf_802154_stat_timeslot_needed_set(bool needed);
+
+/**@brief Notify the timeslot statistics that a timeslot was granted. */
+void nrf_802154_stat_timeslot_started(void);
+
+/**@brief Notify the timeslot statistics that the granted timeslot ended.
+ *
+ * @param[in] frame_lost  If a frame was being received or transmitted when the timeslot ended.
+ */
+void nrf_802154_stat_timeslot_ended(bool frame_lost);
+
+#endif // NRF_802154_STATS_TIMESLOT_ENABLED
+
+#if NRF_802154_STATS_CRITICAL_SECTION_ENABLED
+
+/**@brief Account a completed outermost critical section.
+ *
+ * @param[in] cycles    Duration of the critical section in CPU cycles.
+ * @param[in] caller    Identifier of the caller that entered the critical section.
+ * @param[in] priority  Priority of the context that entered the critical section.
+ */
+void nrf_802154_stat_critical_section_account(uint32_t cycles, uint32_t caller, int8_t priority);
+
+#endif // NRF_802154_STATS_CRITICAL_SECTION_ENABLED
+
 #if !defined(TEST)
 // Don't use directly. Use provided nrf_802154_stat_xxxx API macros.
 extern volatile nrf_802154_stats_t g_nrf_802154_stats;
@@ -85,6 +174,42 @@ extern volatile nrf_802154_stats_t g_nrf_802154_stats;
     }                                                           \
     while (0)
 
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+// Don't use directly. Use provided nrf_802154_stat_histogram_xxxx API macros.
+extern volatile nrf_802154_stat_histograms_t g_nrf_802154_stat_histograms;
+
+/**@brief Increment a bin of one of the @ref nrf_802154_stat_histograms_t fields.
+ *
+ * @param field_name    Identifier of struct member to update
+ * @param bin           Index of the bin to increment
+ */
+#define nrf_802154_stat_histogram_bin_increment(field_name, bin)               \
+    do                                                                         \
+    {                                                                          \
+        uint32_t nrf_802154_stat_bin = (bin);                                  \
+        nrf_802154_mcu_critical_state_t mcu_cs;                                \
+                                                                               \
+        if (nrf_802154_stat_bin >= NRF_802154_STAT_HISTOGRAM_BINS)             \
+        {                                                                      \
+            nrf_802154_stat_bin = NRF_802154_STAT_HISTOGRAM_BINS - 1U;         \
+        }                                                                      \
+                                                                               \
+        nrf_802154_mcu_critical_enter(mcu_cs);                                 \
+        (g_nrf_802154_stat_histograms.field_name.bins[nrf_802154_stat_bin])++; \
+        nrf_802154_mcu_critical_exit(mcu_cs);                                  \
+    }                                                                          \
+    while (0)
+
+#else // NRF_802154_STATS_HISTOGRAMS_ENABLED
+
+#define nrf_802154_stat_histogram_bin_increment(field_name, bin) \
+    do                                                           \
+    {                                                            \
+    }                                                            \
+    while (0)
+
+#endif // NRF_802154_STATS_HISTOGRAMS_ENABLED
+
 #else // !defined(TEST)
 
 #define nrf_802154_stat_counter_increment(field_name) \
@@ -98,11 +223,26 @@ extern volatile nrf_802154_stats_t g_nrf_802154_stats;
     *(variable) = nrf_802154_stat_timestamp_read_func(offsetof(nrf_802154_stat_timestamps_t, \
                                                                field_name))
 
+#define nrf_802154_stat_histogram_bin_increment(field_name, bin)                        \
+    nrf_802154_stat_histogram_bin_increment_func(offsetof(nrf_802154_stat_histograms_t, \
+                                                          field_name),                  \
+                                                 (bin))
+
 // Functions for which mocks are generated.
 void nrf_802154_stat_counter_increment_func(size_t field_offset);
 void nrf_802154_stat_timestamp_write_func(size_t field_offset, uint64_t value);
 uint64_t nrf_802154_stat_timestamp_read_func(size_t field_offset);
+void nrf_802154_stat_histogram_bin_increment_func(size_t field_offset, uint32_t bin);
 
 #endif // !defined(TEST)
 
+/**@brief Add a sample to one of the @ref nrf_802154_stat_histograms_t fields.
+ *
+ * @param field_name    Identifier of struct member to update
+ * @param value         Sample value
+ */
+#define nrf_802154_stat_histogram_sample(field_name, value) \
+    nrf_802154_stat_histogram_bin_increment(field_name,     \
+                                            nrf_802154_stat_histogram_bin_get(value))
+
 #endif /* NRF_802154_STATS_H_ */
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**
+ * @file
+ *   This file implements the procedure timing model of the 802.15.4 driver.
+ *
+ */
+
+#include "nrf_802154_timing_model.h"
+
+#include "nrf_802154_const.h"
+#include "nrf_802154_sl_timer.h"
+
+#if NRF_802154_TIMING_MODEL_ENABLED
+
+/**@brief Measurements of a single procedure. */
+typedef struct
+{
+    uint16_t max_overhead_us; ///< Largest overhead measured.
+    uint16_t samples;         ///< Number of measurements, saturated.
+} timing_model_entry_t;
+
+/**@brief Overheads of the procedures assumed by @c nrf_802154_procedures_duration.h. */
+static const uint16_t m_static_overheads[NRF_802154_TIMING_MODEL_PROCEDURE_COUNT] =
+{
+    [NRF_802154_TIMING_MODEL_PROCEDURE_TX]     = MAX_RAMP_DOWN_TIME + TX_RAMP_UP_TIME,
+    [NRF_802154_TIMING_MODEL_PROCEDURE_TX_CCA] = MAX_RAMP_DOWN_TIME + TX_RAMP_UP_TIME +
+                                                 RX_RAMP_UP_TIME + RX_RAMP_DOWN_TIME,
+    [NRF_802154_TIMING_MODEL_PROCEDURE_CCA]    = MAX_RAMP_DOWN_TIME + RX_RAMP_UP_TIME,
+};
+
+static timing_model_entry_t m_entries[NRF_802154_TIMING_MODEL_PROCEDURE_COUNT];
+
+static uint8_t  m_procedure;  ///< Procedure being measured, COUNT if none.
+static uint32_t m_start_time; ///< Timestamp of the start of the measured procedure.
+static uint16_t m_airtime_us; ///< Time on air of the measured procedure.
+
+static void measurement_start(nrf_802154_timing_model_procedure_t procedure, uint16_t airtime_us)
+{
+    m_start_time = NRF_802154_TIMING_MODEL_TIMESTAMP_GET();
+    m_airtime_us = airtime_us;
+    m_procedure  = (uint8_t)procedure;
+}
+
+void nrf_802154_timing_model_init(void)
+{
+    for (uint32_t i = 0; i < NRF_802154_TIMING_MODEL_PROCEDURE_COUNT; i++)
+    {
+        m_entries[i].max_overhead_us = 0;
+        m_entries[i].samples         = 0;
+    }
+
+    m_procedure = NRF_802154_TIMING_MODEL_PROCEDURE_COUNT;
+}
+
+void nrf_802154_timing_model_tx_start(uint8_t psdu_length, bool cca)
+{
+    uint16_t airtime_us = nrf_802154_frame_duration_get(psdu_length, true, true);
+
+    if (cca)
+    {
+        airtime_us += PHY_US_TIME_FROM_SYMBOLS(A_CCA_DURATION_SYMBOLS);
+    }
+
+    measurement_start(cca ? NRF_802154_TIMING_MODEL_PROCEDURE_TX_CCA :
+                      NRF_802154_TIMING_MODEL_PROCEDURE_TX,
+                      airtime_us);
+}
+
+void nrf_802154_timing_model_cca_start(void)
+{
+    measurement_start(NRF_802154_TIMING_MODEL_PROCEDURE_CCA,
+                      PHY_US_TIME_FROM_SYMBOLS(A_CCA_DURATION_SYMBOLS));
+}
+
+void nrf_802154_timing_model_cancel(void)
+{
+    m_procedure = NRF_802154_TIMING_MODEL_PROCEDURE_COUNT;
+}
+
+void nrf_802154_timing_model_end(void)
+{
+    if (m_procedure >= NRF_802154_TIMING_MODEL_PROCEDURE_COUNT)
+    {
+        return;
+    }
+
+    uint32_t               elapsed = NRF_802154_TIMING_MODEL_TIMESTAMP_GET() - m_start_time;
+    timing_model_entry_t * p_entry = &m_entries[m_procedure];
+
+    m_procedure = NRF_802154_TIMING_MODEL_PROCEDURE_COUNT;
+
+    // Only the overhead is calibrated, the time on air is given by the PHY.
+    uint32_t overhead = (elapsed > m_airtime_us) ? (elapsed - m_airtime_us) : 0U;
+
+    if (overhead > p_entry->max_overhead_us)
+    {
+        p_entry->max_overhead_us = (overhead < UINT16_MAX) ? (uint16_t)overhead : UINT16_MAX;
+    }
+
+    if (p_entry->samples < UINT16_MAX)
+    {
+        p_entry->samples++;
+    }
+}
+
+uint16_t nrf_802154_timing_model_overhead_get(nrf_802154_timing_model_procedure_t procedure)
+{
+    const timing_model_entry_t * p_entry         = &m_entries[procedure];
+    uint16_t                     static_overhead = m_static_overheads[procedure];
+
+    if (p_entry->samples < NRF_802154_TIMING_MODEL_MIN_SAMPLES)
+    {
+        return static_overhead;
+    }
+
+    uint32_t overhead = (uint32_t)p_entry->max_overhead_us + NRF_802154_TIMING_MODEL_MARGIN_US;
+
+    return (overhead < static_overhead) ? (uint16_t)overhead : static_overhead;
+}
+
+uint16_t nrf_802154_timing_model_tx_duration_get(uint8_t psdu_length,
+                                                 bool    cca,
+                                                 bool    ack_requested)
+{
+    nrf_802154_timing_model_procedure_t procedure = cca ?
+                                                    NRF_802154_TIMING_MODEL_PROCEDURE_TX_CCA :
+                                                    NRF_802154_TIMING_MODEL_PROCEDURE_TX;
+
+    return nrf_802154_tx_duration_get(psdu_length, cca, ack_requested) -
+           m_static_overheads[procedure] + nrf_802154_timing_model_overhead_get(procedure);
+}
+
+uint16_t nrf_802154_timing_model_cca_duration_get(void)
+{
+    return nrf_802154_cca_duration_get() -
+           m_static_overheads[NRF_802154_TIMING_MODEL_PROCEDURE_CCA] +
+           nrf_802154_timing_model_overhead_get(NRF_802154_TIMING_MODEL_PROCEDURE_CCA);
+}
+
+#endif // NRF_802154_TIMING_MODEL_ENABLED
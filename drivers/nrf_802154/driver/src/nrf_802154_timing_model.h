@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#ifndef NRF_802154_TIMING_MODEL_H__
+#define NRF_802154_TIMING_MODEL_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_procedures_duration.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrf_802154_timing_model 802.15.4 driver procedure timing model
+ * @{
+ * @ingroup nrf_802154
+ * @brief Procedure durations calibrated on the device for timeslot requests.
+ *
+ * The static durations of @c nrf_802154_procedures_duration.h assume the worst case of the
+ * RADIO ramp down and ramp up, which is reserved in each timeslot request. The timing model
+ * measures the time from starting a transmission or a CCA until its end, subtracts the time on
+ * air, and keeps the largest overhead observed for each procedure. Once enough procedures are
+ * measured, the timeslot requests use that overhead increased by
+ * @ref NRF_802154_TIMING_MODEL_MARGIN_US instead of the static one. The static overhead is
+ * never exceeded, so the model can only shorten the requests.
+ *
+ * Only procedures started right away are measured. The ones triggered by hardware at a later
+ * time, and the transmissions preceded by more than one CCA attempt, are not.
+ */
+
+/**
+ * @brief Procedures covered by the timing model.
+ */
+typedef enum
+{
+    NRF_802154_TIMING_MODEL_PROCEDURE_TX,     ///< Transmission without CCA.
+    NRF_802154_TIMING_MODEL_PROCEDURE_TX_CCA, ///< Transmission preceded by CCA.
+    NRF_802154_TIMING_MODEL_PROCEDURE_CCA,    ///< Standalone CCA.
+    NRF_802154_TIMING_MODEL_PROCEDURE_COUNT,  ///< Number of procedures.
+} nrf_802154_timing_model_procedure_t;
+
+#if NRF_802154_TIMING_MODEL_ENABLED
+
+/**
+ * @brief Initializes the timing model and discards all measurements.
+ */
+void nrf_802154_timing_model_init(void);
+
+/**
+ * @brief Starts the measurement of a transmission.
+ *
+ * @param[in]  psdu_length  Length of the PSDU of the transmitted frame.
+ * @param[in]  cca          If the transmission is preceded by CCA.
+ */
+void nrf_802154_timing_model_tx_start(uint8_t psdu_length, bool cca);
+
+/**
+ * @brief Starts the measurement of a standalone CCA.
+ */
+void nrf_802154_timing_model_cca_start(void);
+
+/**
+ * @brief Discards the measurement in progress, if any.
+ */
+void nrf_802154_timing_model_cancel(void);
+
+/**
+ * @brief Ends the measurement in progress, if any, and updates the model.
+ */
+void nrf_802154_timing_model_end(void);
+
+/**
+ * @brief Gets the duration of a transmission for the timeslot request.
+ *
+ * The parameters and the composition of the duration are the same as for
+ * @c nrf_802154_tx_duration_get, with the overhead taken from the model.
+ *
+ * @param[in]  psdu_length    Length of the PSDU of the transmitted frame.
+ * @param[in]  cca            If the transmission is preceded by CCA.
+ * @param[in]  ack_requested  If the transmitted frame requests an ACK.
+ *
+ * @return  Duration of the transmission in microseconds.
+ */
+uint16_t nrf_802154_timing_model_tx_duration_get(uint8_t psdu_length,
+                                                 bool    cca,
+                                                 bool    ack_requested);
+
+/**
+ * @brief Gets the duration of a standalone CCA for the timeslot request.
+ *
+ * @return  Duration of the CCA in microseconds.
+ */
+uint16_t nrf_802154_timing_model_cca_duration_get(void);
+
+/**
+ * @brief Gets the overhead of a procedure currently used by the model.
+ *
+ * @param[in]  procedure  Procedure to get the overhead of.
+ *
+ * @return  Overhead of the procedure in microseconds.
+ */
+uint16_t nrf_802154_timing_model_overhead_get(nrf_802154_timing_model_procedure_t procedure);
+
+#else // NRF_802154_TIMING_MODEL_ENABLED
+
+#define nrf_802154_timing_model_init() \
+    do                                 \
+    {                                  \
+    }                                  \
+    while (0)
+
+#define nrf_802154_timing_model_tx_start(psdu_length, cca) \
+    do                                                     \
+    {                                                      \
+    }                                                      \
+    while (0)
+
+#define nrf_802154_timing_model_cca_start() \
+    do                                      \
+    {                                       \
+    }                                       \
+    while (0)
+
+#define nrf_802154_timing_model_cancel() \
+    do                                   \
+    {                                    \
+    }                                    \
+    while (0)
+
+#define nrf_802154_timing_model_end() \
+    do                                \
+    {                                 \
+    }                                 \
+    while (0)
+
+#define nrf_802154_timing_model_tx_duration_get(psdu_length, cca, ack_requested) \
+    nrf_802154_tx_duration_get((psdu_length), (cca), (ack_requested))
+
+#define nrf_802154_timing_model_cca_duration_get() \
+    nrf_802154_cca_duration_get()
+
+#endif // NRF_802154_TIMING_MODEL_ENABLED
+
+/**
+ *@}
+ **/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_802154_TIMING_MODEL_H__
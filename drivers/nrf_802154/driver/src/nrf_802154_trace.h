@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#ifndef NRF_802154_TRACE_H__
+#define NRF_802154_TRACE_H__
+
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+
+#if NRF_802154_TRACE_ENABLED
+#include <nrfx.h>
+#include "platform/nrf_802154_hp_timer.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrf_802154_trace 802.15.4 driver event tracer
+ * @{
+ * @ingroup nrf_802154
+ * @brief Low-overhead timestamped event tracer of the 802.15.4 driver.
+ *
+ * Each event is stored in a ring buffer as a pair of words: the event word holding the event
+ * identifier in bits [23:16] and the event parameter in bits [15:0], followed by the timestamp
+ * returned by @ref NRF_802154_TRACE_TIMESTAMP_GET. The slot of an event is claimed with an
+ * exclusive access increment of the write index, so events can be recorded from any priority
+ * without disabling interrupts.
+ *
+ * The trace is read out by dumping @c g_nrf_802154_trace with a debugger and decoding it with
+ * the @c nrf_802154_trace_decode.py host tool.
+ */
+
+/**
+ * @brief Identifiers of the events recorded by the tracer.
+ *
+ * Value 0 is reserved for an empty trace slot.
+ */
+typedef enum
+{
+    NRF_802154_TRACE_EVENT_RADIO_IRQ_ENTER = 1U,  ///< RADIO IRQ handler entered. Param: 0.
+    NRF_802154_TRACE_EVENT_RADIO_IRQ_EXIT  = 2U,  ///< RADIO IRQ handler exited. Param: 0.
+    NRF_802154_TRACE_EVENT_READY           = 3U,  ///< READY event handled. Param: 0.
+    NRF_802154_TRACE_EVENT_ADDRESS         = 4U,  ///< ADDRESS event handled. Param: 0.
+    NRF_802154_TRACE_EVENT_BCMATCH         = 5U,  ///< BCMATCH event handled. Param: 0.
+    NRF_802154_TRACE_EVENT_CRCERROR        = 6U,  ///< CRCERROR event handled. Param: 0.
+    NRF_802154_TRACE_EVENT_CRCOK           = 7U,  ///< CRCOK event handled. Param: 0.
+    NRF_802154_TRACE_EVENT_PHYEND          = 8U,  ///< PHYEND event handled. Param: 0.
+    NRF_802154_TRACE_EVENT_DISABLED        = 9U,  ///< DISABLED event handled. Param: 0.
+    NRF_802154_TRACE_EVENT_CCAIDLE         = 10U, ///< CCAIDLE event handled. Param: 0.
+    NRF_802154_TRACE_EVENT_CCABUSY         = 11U, ///< CCABUSY event handled. Param: 0.
+    NRF_802154_TRACE_EVENT_EDEND           = 12U, ///< EDEND event handled. Param: 0.
+    NRF_802154_TRACE_EVENT_CORE_STATE      = 13U, ///< Core state changed. Param: new state.
+} nrf_802154_trace_event_t;
+
+#if NRF_802154_TRACE_ENABLED
+
+/**
+ * @brief Entry of the trace ring buffer.
+ */
+typedef struct
+{
+    uint32_t event;     ///< Event identifier in bits [23:16] and event parameter in bits [15:0].
+    uint32_t timestamp; ///< Timestamp of the event.
+} nrf_802154_trace_entry_t;
+
+/**
+ * @brief Trace ring buffer.
+ */
+typedef struct
+{
+    volatile uint32_t        idx;                                   ///< Number of events recorded.
+    nrf_802154_trace_entry_t entries[NRF_802154_TRACE_BUFFER_LEN]; ///< Recorded events.
+} nrf_802154_trace_t;
+
+extern volatile nrf_802154_trace_t g_nrf_802154_trace;
+
+/**
+ * @brief Records an event in the trace ring buffer.
+ *
+ * @param[in]  event_id  Identifier of the event.
+ * @param[in]  param     Parameter of the event.
+ */
+static inline void nrf_802154_trace_record(nrf_802154_trace_event_t event_id, uint16_t param)
+{
+    uint32_t timestamp = NRF_802154_TRACE_TIMESTAMP_GET();
+    uint32_t idx;
+
+    do
+    {
+        idx = __LDREXW(&g_nrf_802154_trace.idx);
+    }
+    while (__STREXW(idx + 1U, &g_nrf_802154_trace.idx));
+
+    volatile nrf_802154_trace_entry_t * p_entry =
+        &g_nrf_802154_trace.entries[idx & (NRF_802154_TRACE_BUFFER_LEN - 1U)];
+
+    p_entry->event     = ((uint32_t)event_id << 16) | param;
+    p_entry->timestamp = timestamp;
+}
+
+/**
+ * @brief Records an event in the trace ring buffer.
+ *
+ * @param[in]  event_id  Identifier of the event.
+ * @param[in]  param     Parameter of the event.
+ */
+#define nrf_802154_trace(event_id, param) \
+    nrf_802154_trace_record((event_id), (uint16_t)(param))
+
+/**
+ * @brief Initializes the tracer and discards all recorded events.
+ */
+void nrf_802154_trace_init(void);
+
+#else // NRF_802154_TRACE_ENABLED
+
+#define nrf_802154_trace(event_id, param) \
+    do                                    \
+    {                                     \
+    }                                     \
+    while (0)
+
+#endif // NRF_802154_TRACE_ENABLED
+
+/**
+ *@}
+ **/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_802154_TRACE_H__
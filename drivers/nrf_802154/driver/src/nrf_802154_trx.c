@@ -44,7 +44,11 @@
 #include "nrf_802154_peripherals.h"
 #include "nrf_802154_pib.h"
 #include "nrf_802154_rssi.h"
+#include "nrf_802154_sl_timer.h"
+#include "nrf_802154_stats.h"
 #include "nrf_802154_swi.h"
+#include "nrf_802154_trace.h"
+#include "nrf_802154_trx_capture.h"
 #include "nrf_802154_trx_ppi_api.h"
 #include "nrf_802154_utils.h"
 
@@ -57,6 +61,7 @@
 
 #include "nrf_802154_procedures_duration.h"
 #include "nrf_802154_critical_section.h"
+#include "nrf_802154_fal.h"
 #include "mpsl_fem_config_common.h"
 #include "mpsl_tx_power.h"
 #include "platform/nrf_802154_irq.h"
@@ -143,6 +148,7 @@
 #endif
 
 #define RSSI_SETTLE_TIME_US   15         ///< Time required for RSSI measurements to become valid after signal level change.
+#define RSSI_NOISE_DELAY_US   (RSSI_SETTLE_TIME_US + 31) ///< RSSI settle time with one tick of the low-frequency timer used to measure it.
 
 #if NRF_802154_INTERNAL_RADIO_IRQ_HANDLING
 void nrf_802154_radio_irq_handler(void); ///< Prototype required by internal RADIO IRQ handler
@@ -168,33 +174,23 @@ void nrf_802154_radio_irq_handler(void); ///< Prototype required by internal RAD
 #define NRF_802154_TRX_TEST_MODE_ALLOW_LATE_TX_ACK 0
 #endif
 
-/// Common parameters for the FEM handling.
-static const mpsl_fem_event_t m_activate_rx_cc0 =
-{
-    .type        = MPSL_FEM_EVENT_TYPE_TIMER,
-    .event.timer =
-    {
-        .p_timer_instance     = NRF_802154_TIMER_INSTANCE,
-        .compare_channel_mask = ((1 << NRF_TIMER_CC_CHANNEL0) | (1 << NRF_TIMER_CC_CHANNEL2)),
-        .counter_period       = {
-            .end = RX_RAMP_UP_TIME
-        },
-    },
-};
+/// TIMER compare channels available to the FEM.
+#define FEM_COMPARE_CHANNEL_MASK ((1 << NRF_TIMER_CC_CHANNEL0) | (1 << NRF_TIMER_CC_CHANNEL2))
 
-static const mpsl_fem_event_t m_activate_tx_cc0 =
+/// FEM timing profiles of the radio operations.
+static const nrf_802154_fal_timing_profile_t m_fem_profiles[NRF_802154_FAL_OPERATION_COUNT] =
 {
-    .type        = MPSL_FEM_EVENT_TYPE_TIMER,
-    .event.timer =
-    {
-        .p_timer_instance     = NRF_802154_TIMER_INSTANCE,
-        .compare_channel_mask = ((1 << NRF_TIMER_CC_CHANNEL0) | (1 << NRF_TIMER_CC_CHANNEL2)),
-        .counter_period       = {
-            .end = TX_RAMP_UP_TIME
-        },
-    },
+    [NRF_802154_FAL_OPERATION_RX]     = { NRF_802154_FEM_RX_READY_OFFSET_US },
+    [NRF_802154_FAL_OPERATION_TX]     = { NRF_802154_FEM_TX_READY_OFFSET_US },
+    [NRF_802154_FAL_OPERATION_ACK_TX] = { NRF_802154_FEM_ACK_TX_READY_OFFSET_US },
+    [NRF_802154_FAL_OPERATION_CCA]    = { NRF_802154_FEM_CCA_READY_OFFSET_US },
 };
 
+/// FEM activation events prepared from the profiles by @ref fem_events_prepare.
+static mpsl_fem_event_t m_activate_rx_cc0;
+static mpsl_fem_event_t m_activate_tx_cc0;
+static mpsl_fem_event_t m_activate_cca_cc0;
+
 static const mpsl_fem_event_t m_ccaidle =
 {
     .type = MPSL_FEM_EVENT_TYPE_GENERIC,
@@ -212,6 +208,29 @@ static mpsl_fem_event_t m_activate_tx_cc0_timeshifted;
 
 static volatile trx_state_t m_trx_state;
 
+/**@brief Snapshot of the RADIO configuration that does not depend on the PIB.
+ *
+ * The RADIO is reset on every timeslot start, as other protocols may have reconfigured it. The
+ * snapshot is taken once the configuration is complete for the first time. It is then restored
+ * in one pass of register writes on every following timeslot start.
+ */
+static struct
+{
+    uint32_t pcnf0;    ///< Value of the PCNF0 register.
+    uint32_t pcnf1;    ///< Value of the PCNF1 register.
+    uint32_t crccnf;   ///< Value of the CRCCNF register.
+    uint32_t crcpoly;  ///< Value of the CRCPOLY register.
+#if defined(RADIO_MODECNF0_RU_Msk)
+    uint32_t modecnf0; ///< Value of the MODECNF0 register.
+#endif
+    bool     valid;    ///< Whether the snapshot has been taken.
+} m_radio_cfg_snapshot;
+
+#if NRF_802154_ANT_DIV_PEER_TABLE_ENABLED
+/// Antenna preferred for the destination of the transmitted frame.
+static nrf_802154_sl_ant_div_antenna_t m_tx_peer_antenna = NRF_802154_SL_ANT_DIV_ANTENNA_NONE;
+#endif
+
 typedef struct
 {
     bool          psdu_being_received;    ///< If PSDU is currently being received.
@@ -230,6 +249,20 @@ static volatile uint32_t m_timer_value_on_radio_end_event;
 static volatile bool     m_transmit_with_cca;
 static volatile uint8_t  m_remaining_cca_attempts;
 
+#if NRF_802154_ACK_TIMEOUT_HW_WINDOW_ENABLED
+static uint32_t m_ack_wait_window; ///< Length of the ACK wait window in microseconds (us) or 0 if disabled.
+#endif
+
+#if NRF_802154_NOISE_FLOOR_ENABLED
+static uint64_t m_rx_listen_time; ///< Time the RADIO started or is to start listening in RXFRAME state.
+#endif
+
+#if NRF_802154_ED_RING_ENABLED
+static bool     m_ed_sampled;      ///< If each energy detection iteration is reported separately.
+static uint32_t m_ed_samples_left; ///< Iterations left in the sampled energy detection.
+static uint8_t  m_ed_max_sample;   ///< Maximum sample of the sampled energy detection.
+#endif
+
 static void timer_frequency_set_1mhz(void);
 
 static void rxframe_finish_disable_ppis(void);
@@ -257,8 +290,96 @@ static void rx_flags_clear(void)
     m_flags.psdu_being_received    = false;
 }
 
+#if NRF_802154_STATS_RADIO_TIME_ENABLED
+/** Get the radio time accounting state corresponding to the given TRX state. */
+static nrf_802154_stat_radio_state_t stat_radio_state_get(trx_state_t state)
+{
+    switch (state)
+    {
+        case TRX_STATE_DISABLED:
+            return NRF_802154_STAT_RADIO_STATE_OFF;
+
+        case TRX_STATE_RXFRAME:
+        // Fallthrough
+        case TRX_STATE_RXACK:
+        // Fallthrough
+        case TRX_STATE_STANDALONE_CCA:
+        // Fallthrough
+        case TRX_STATE_ENERGY_DETECTION:
+            return NRF_802154_STAT_RADIO_STATE_RX;
+
+        case TRX_STATE_TXFRAME:
+        // Fallthrough
+        case TRX_STATE_TXACK:
+        // Fallthrough
+        case TRX_STATE_CONTINUOUS_CARRIER:
+        // Fallthrough
+        case TRX_STATE_MODULATED_CARRIER:
+            return NRF_802154_STAT_RADIO_STATE_TX;
+
+        default:
+            return NRF_802154_STAT_RADIO_STATE_IDLE;
+    }
+}
+
+#endif // NRF_802154_STATS_RADIO_TIME_ENABLED
+
+/** Set the state of the TRX module. */
+static inline void trx_state_set(trx_state_t state)
+{
+    m_trx_state = state;
+
+#if NRF_802154_STATS_RADIO_TIME_ENABLED
+    nrf_802154_stat_radio_state_set(stat_radio_state_get(state));
+#endif
+}
+
 static void * volatile mp_receive_buffer;
 
+#if NRF_802154_TRX_CAPTURE_ENABLED
+
+/** Capture a trx callback that carries no frame data. */
+static inline void trx_capture(nrf_802154_trx_capture_event_t event, uint8_t param)
+{
+    nrf_802154_trx_capture(event, m_trx_state, param, NULL, 0U);
+}
+
+/** Capture a trx callback together with the first @p len octets of the receive buffer. */
+static void trx_capture_rx(nrf_802154_trx_capture_event_t event, uint8_t param, uint8_t len)
+{
+    const uint8_t * p_data = (const uint8_t *)mp_receive_buffer;
+
+    if (p_data == NULL)
+    {
+        len = 0U;
+    }
+
+    nrf_802154_trx_capture(event, m_trx_state, param, p_data, len);
+}
+
+/** Capture a trx callback that ends a reception together with the whole received frame. */
+static void trx_capture_rx_end(nrf_802154_trx_capture_event_t event)
+{
+    const uint8_t * p_data = (const uint8_t *)mp_receive_buffer;
+    uint8_t         len    = 0U;
+
+    if (p_data != NULL)
+    {
+        len = p_data[PHR_OFFSET] & PHR_LENGTH_MASK;
+        len = (len > MAX_PACKET_SIZE ? MAX_PACKET_SIZE : len) + PHR_SIZE;
+    }
+
+    nrf_802154_trx_capture(event, m_trx_state, 0U, p_data, len);
+}
+
+#else // NRF_802154_TRX_CAPTURE_ENABLED
+
+#define trx_capture(event, param)             ((void)0)
+#define trx_capture_rx(event, param, len)     ((void)0)
+#define trx_capture_rx_end(event)             ((void)0)
+
+#endif // NRF_802154_TRX_CAPTURE_ENABLED
+
 static void txpower_set(int8_t txpower)
 {
 #ifdef NRF53_SERIES
@@ -353,6 +474,19 @@ static void channel_set(uint8_t channel)
     assert(channel >= 11U && channel <= 26U);
 
     nrf_radio_frequency_set(NRF_RADIO, 2405U + 5U * (channel - 11U));
+
+#if NRF_802154_STATS_RADIO_TIME_ENABLED
+    nrf_802154_stat_radio_channel_set(channel);
+#endif
+}
+
+static void cca_configure(const nrf_802154_cca_cfg_t * p_cca_cfg)
+{
+    nrf_radio_cca_configure(NRF_RADIO,
+                            p_cca_cfg->mode,
+                            nrf_802154_rssi_cca_ed_threshold_corrected_get(p_cca_cfg->ed_threshold),
+                            p_cca_cfg->corr_threshold,
+                            p_cca_cfg->corr_limit);
 }
 
 static void cca_configuration_update(void)
@@ -360,11 +494,52 @@ static void cca_configuration_update(void)
     nrf_802154_cca_cfg_t cca_cfg;
 
     nrf_802154_pib_cca_cfg_get(&cca_cfg);
-    nrf_radio_cca_configure(NRF_RADIO,
-                            cca_cfg.mode,
-                            nrf_802154_rssi_cca_ed_threshold_corrected_get(cca_cfg.ed_threshold),
-                            cca_cfg.corr_threshold,
-                            cca_cfg.corr_limit);
+    cca_configure(&cca_cfg);
+}
+
+/** Configure the packet format, ramp up mode and CRC of the RADIO from scratch. */
+static void radio_cfg_apply(void)
+{
+    nrf_radio_packet_conf_t packet_conf;
+
+    memset(&packet_conf, 0, sizeof(packet_conf));
+    packet_conf.lflen  = 8;
+    packet_conf.plen   = NRF_RADIO_PREAMBLE_LENGTH_32BIT_ZERO;
+    packet_conf.crcinc = true;
+    packet_conf.maxlen = MAX_PACKET_SIZE;
+    nrf_radio_packet_configure(NRF_RADIO, &packet_conf);
+
+#if defined(RADIO_MODECNF0_RU_Msk)
+    nrf_radio_modecnf0_set(NRF_RADIO, true, 0);
+#endif
+
+    // Configure CRC
+    nrf_radio_crc_configure(NRF_RADIO, CRC_LENGTH, NRF_RADIO_CRC_ADDR_IEEE802154, CRC_POLYNOMIAL);
+}
+
+/** Take a snapshot of the configuration made by @ref radio_cfg_apply. */
+static void radio_cfg_snapshot_take(void)
+{
+    m_radio_cfg_snapshot.pcnf0   = NRF_RADIO->PCNF0;
+    m_radio_cfg_snapshot.pcnf1   = NRF_RADIO->PCNF1;
+    m_radio_cfg_snapshot.crccnf  = NRF_RADIO->CRCCNF;
+    m_radio_cfg_snapshot.crcpoly = NRF_RADIO->CRCPOLY;
+#if defined(RADIO_MODECNF0_RU_Msk)
+    m_radio_cfg_snapshot.modecnf0 = NRF_RADIO->MODECNF0;
+#endif
+    m_radio_cfg_snapshot.valid = true;
+}
+
+/** Restore the configuration made by @ref radio_cfg_apply from the snapshot. */
+static void radio_cfg_snapshot_restore(void)
+{
+    NRF_RADIO->PCNF0   = m_radio_cfg_snapshot.pcnf0;
+    NRF_RADIO->PCNF1   = m_radio_cfg_snapshot.pcnf1;
+    NRF_RADIO->CRCCNF  = m_radio_cfg_snapshot.crccnf;
+    NRF_RADIO->CRCPOLY = m_radio_cfg_snapshot.crcpoly;
+#if defined(RADIO_MODECNF0_RU_Msk)
+    NRF_RADIO->MODECNF0 = m_radio_cfg_snapshot.modecnf0;
+#endif
 }
 
 /** Initialize interrupts for radio peripheral. */
@@ -387,12 +562,32 @@ static void trigger_disable_to_start_rampup(void)
     }
 }
 
+/** Prepare the FEM activation events of the operations started by a fixed ramp up. */
+static void fem_events_prepare(void)
+{
+    nrf_802154_fal_timer_event_prepare(&m_activate_rx_cc0,
+                                       NRF_802154_TIMER_INSTANCE,
+                                       FEM_COMPARE_CHANNEL_MASK,
+                                       RX_RAMP_UP_TIME,
+                                       &m_fem_profiles[NRF_802154_FAL_OPERATION_RX]);
+    nrf_802154_fal_timer_event_prepare(&m_activate_tx_cc0,
+                                       NRF_802154_TIMER_INSTANCE,
+                                       FEM_COMPARE_CHANNEL_MASK,
+                                       TX_RAMP_UP_TIME,
+                                       &m_fem_profiles[NRF_802154_FAL_OPERATION_TX]);
+    nrf_802154_fal_timer_event_prepare(&m_activate_cca_cc0,
+                                       NRF_802154_TIMER_INSTANCE,
+                                       FEM_COMPARE_CHANNEL_MASK,
+                                       RX_RAMP_UP_TIME,
+                                       &m_fem_profiles[NRF_802154_FAL_OPERATION_CCA]);
+}
+
 /** Configure FEM to set LNA at appropriate time. */
-static void fem_for_lna_set(void)
+static void fem_for_lna_set(const mpsl_fem_event_t * p_activate_event)
 {
-    if (mpsl_fem_lna_configuration_set(&m_activate_rx_cc0, NULL) == 0)
+    if (mpsl_fem_lna_configuration_set(p_activate_event, NULL) == 0)
     {
-        nrf_timer_shorts_enable(m_activate_rx_cc0.event.timer.p_timer_instance,
+        nrf_timer_shorts_enable(p_activate_event->event.timer.p_timer_instance,
                                 NRF_TIMER_SHORT_COMPARE0_STOP_MASK);
 
         nrf_802154_trx_ppi_for_fem_set();
@@ -457,7 +652,7 @@ static void fem_for_tx_set(bool cca, const mpsl_fem_gain_t * p_fem_gain_data)
         bool pa_set  = false;
         bool lna_set = false;
 
-        if (mpsl_fem_lna_configuration_set(&m_activate_rx_cc0, &m_ccaidle) == 0)
+        if (mpsl_fem_lna_configuration_set(&m_activate_cca_cc0, &m_ccaidle) == 0)
         {
             lna_set = true;
         }
@@ -637,6 +832,7 @@ void nrf_802154_trx_init(void)
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
     nrf_802154_trx_module_reset();
+    fem_events_prepare();
 
 #if defined(RADIO_INTENSET_SYNC_Msk)
     nrf_802154_swi_init();
@@ -663,8 +859,6 @@ void nrf_802154_trx_enable(void)
     }
 #endif
 
-    nrf_radio_packet_conf_t packet_conf;
-
     nrf_radio_mode_set(NRF_RADIO, NRF_RADIO_MODE_IEEE802154_250KBIT);
 
 #if defined(NRF5340_XXAA) && !defined(CONFIG_SOC_SERIES_BSIM_NRFXX)
@@ -673,21 +867,17 @@ void nrf_802154_trx_enable(void)
     pa_modulation_fix_apply(true);
 #endif
 
-    memset(&packet_conf, 0, sizeof(packet_conf));
-    packet_conf.lflen  = 8;
-    packet_conf.plen   = NRF_RADIO_PREAMBLE_LENGTH_32BIT_ZERO;
-    packet_conf.crcinc = true;
-    packet_conf.maxlen = MAX_PACKET_SIZE;
-    nrf_radio_packet_configure(NRF_RADIO, &packet_conf);
-
     NRF_802154_TRX_ENABLE_INTERNAL();
 
-#if defined(RADIO_MODECNF0_RU_Msk)
-    nrf_radio_modecnf0_set(NRF_RADIO, true, 0);
-#endif
-
-    // Configure CRC
-    nrf_radio_crc_configure(NRF_RADIO, CRC_LENGTH, NRF_RADIO_CRC_ADDR_IEEE802154, CRC_POLYNOMIAL);
+    if (m_radio_cfg_snapshot.valid)
+    {
+        radio_cfg_snapshot_restore();
+    }
+    else
+    {
+        radio_cfg_apply();
+        radio_cfg_snapshot_take();
+    }
 
     nrf_802154_trx_ppi_for_enable();
 
@@ -714,7 +904,7 @@ void nrf_802154_trx_enable(void)
 
     mpsl_fem_deactivate_now(MPSL_FEM_ALL);
 
-    m_trx_state = TRX_STATE_IDLE;
+    trx_state_set(TRX_STATE_IDLE);
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
@@ -838,7 +1028,7 @@ void nrf_802154_trx_disable(void)
         m_flags.rssi_started           = false;
         m_flags.tx_started             = false;
 
-        m_trx_state = TRX_STATE_DISABLED;
+        trx_state_set(TRX_STATE_DISABLED);
 
         nrf_802154_log_global_event(NRF_802154_LOG_VERBOSITY_LOW,
                                     NRF_802154_LOG_GLOBAL_EVENT_ID_RADIO_RESET,
@@ -910,11 +1100,31 @@ static void rx_antenna_update(void)
     (void)result;
 }
 
+/**
+ * Gets the antenna to be used for transmission in @ref NRF_802154_SL_ANT_DIV_MODE_MANUAL mode.
+ *
+ * If per-peer antenna selection is enabled and the antenna best for the destination of
+ * the transmitted frame is known, that antenna is used for the frame and its ACK.
+ */
+static nrf_802154_sl_ant_div_antenna_t tx_manual_antenna_get(void)
+{
+#if NRF_802154_ANT_DIV_PEER_TABLE_ENABLED
+    if (((m_trx_state == TRX_STATE_TXFRAME) || (m_trx_state == TRX_STATE_RXACK)) &&
+        (m_tx_peer_antenna != NRF_802154_SL_ANT_DIV_ANTENNA_NONE))
+    {
+        return m_tx_peer_antenna;
+    }
+#endif
+
+    return nrf_802154_sl_ant_div_cfg_antenna_get(NRF_802154_SL_ANT_DIV_OP_TX);
+}
+
 /**
  * Updates the antenna for transmission, according to antenna diversity configuration.
  *
  * Antenna diversity for tx is not currently supported. If antenna diversity is not
- * in disabled state, default antenna will always be used for transmission.
+ * in disabled state, default antenna will always be used for transmission, unless
+ * the antenna best for the destination is known.
  */
 static void tx_antenna_update(void)
 {
@@ -929,8 +1139,7 @@ static void tx_antenna_update(void)
             break;
 
         case NRF_802154_SL_ANT_DIV_MODE_MANUAL:
-            result = nrf_802154_sl_ant_div_antenna_set(
-                nrf_802154_sl_ant_div_cfg_antenna_get(NRF_802154_SL_ANT_DIV_OP_TX));
+            result = nrf_802154_sl_ant_div_antenna_set(tx_manual_antenna_get());
             break;
 
         case NRF_802154_SL_ANT_DIV_MODE_AUTO:
@@ -974,6 +1183,14 @@ void nrf_802154_trx_antenna_update(void)
     }
 }
 
+#if NRF_802154_ANT_DIV_PEER_TABLE_ENABLED
+void nrf_802154_trx_tx_peer_antenna_set(nrf_802154_sl_ant_div_antenna_t antenna)
+{
+    m_tx_peer_antenna = antenna;
+}
+
+#endif // NRF_802154_ANT_DIV_PEER_TABLE_ENABLED
+
 void nrf_802154_trx_channel_set(uint8_t channel)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
@@ -992,6 +1209,19 @@ void nrf_802154_trx_cca_configuration_update(void)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
+#if NRF_802154_CCA_ADAPTIVE_ENABLED
+
+void nrf_802154_trx_cca_ed_threshold_set(uint8_t ed_threshold)
+{
+    nrf_802154_cca_cfg_t cca_cfg;
+
+    nrf_802154_pib_cca_cfg_get(&cca_cfg);
+    cca_cfg.ed_threshold = ed_threshold;
+    cca_configure(&cca_cfg);
+}
+
+#endif // NRF_802154_CCA_ADAPTIVE_ENABLED
+
 /** Check if PSDU is currently being received.
  *
  * @returns True if radio is receiving PSDU, false otherwise.
@@ -1082,7 +1312,7 @@ void nrf_802154_trx_receive_frame(uint8_t                                 bcc,
     // Force the TIMER to be stopped and count from 0.
     nrf_timer_task_trigger(NRF_802154_TIMER_INSTANCE, NRF_TIMER_TASK_SHUTDOWN);
 
-    m_trx_state = TRX_STATE_RXFRAME;
+    trx_state_set(TRX_STATE_RXFRAME);
 
     // Clear filtering flag
     rx_flags_clear();
@@ -1094,6 +1324,12 @@ void nrf_802154_trx_receive_frame(uint8_t                                 bcc,
 
     m_flags.rssi_settled = false;
 
+#if NRF_802154_NOISE_FLOOR_ENABLED
+    // With a hardware trigger the time is updated when the RADIO becomes ready.
+    m_rx_listen_time = (rampup_trigg_mode == TRX_RAMP_UP_SW_TRIGGER) ?
+                       nrf_802154_sl_timer_current_time_get() + RX_RAMP_UP_TIME : UINT64_MAX;
+#endif
+
     txpower_set(p_ack_tx_power->radio_tx_power);
 
     if (mp_receive_buffer != NULL)
@@ -1200,6 +1436,54 @@ void nrf_802154_trx_receive_frame(uint8_t                                 bcc,
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
+#if NRF_802154_FAST_CHANNEL_HOP_ENABLED
+
+bool nrf_802154_trx_receive_frame_channel_hop(uint8_t channel)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    bool result = false;
+
+    // ADDRESS event not yet handled means a frame has just started being received
+    if ((m_trx_state == TRX_STATE_RXFRAME) && !m_flags.psdu_being_received &&
+        !nrf_radio_event_check(NRF_RADIO, NRF_RADIO_EVENT_ADDRESS))
+    {
+        // Rewind the TIMER. It is started again by the ramp up on the new channel and activates
+        // LNA relative to it.
+        nrf_timer_task_trigger(NRF_802154_TIMER_INSTANCE, NRF_TIMER_TASK_SHUTDOWN);
+
+        if (mpsl_fem_lna_configuration_set(&m_activate_rx_cc0, NULL) != 0)
+        {
+            nrf_timer_cc_set(NRF_802154_TIMER_INSTANCE, NRF_TIMER_CC_CHANNEL0, 1);
+        }
+
+        channel_set(channel);
+
+#if NRF_802154_NOISE_FLOOR_ENABLED
+        m_rx_listen_time = nrf_802154_sl_timer_current_time_get() + RX_RAMP_UP_TIME;
+#endif
+
+        nrf_802154_trx_ppi_for_ramp_up_set(NRF_RADIO_TASK_RXEN, TRX_RAMP_UP_SW_TRIGGER, true);
+
+        nrf_radio_task_trigger(NRF_RADIO, NRF_RADIO_TASK_DISABLE);
+        nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_DISABLED);
+
+        // Drop events of a frame whose reception has been cut off by the channel change
+        nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_ADDRESS);
+        nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_BCMATCH);
+        nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_CRCERROR);
+        nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_CRCOK);
+
+        result = true;
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+
+    return result;
+}
+
+#endif // NRF_802154_FAST_CHANNEL_HOP_ENABLED
+
 void nrf_802154_trx_receive_ack(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
@@ -1207,7 +1491,7 @@ void nrf_802154_trx_receive_ack(void)
     uint32_t shorts         = SHORTS_RX_ACK;
     uint32_t ints_to_enable = 0U;
 
-    m_trx_state = TRX_STATE_RXACK;
+    trx_state_set(TRX_STATE_RXACK);
 
     if (mp_receive_buffer != NULL)
     {
@@ -1231,15 +1515,42 @@ void nrf_802154_trx_receive_ack(void)
 
     nrf_radio_int_enable(NRF_RADIO, ints_to_enable);
 
-    fem_for_lna_set();
+    fem_for_lna_set(&m_activate_rx_cc0);
     nrf_802154_trx_antenna_update();
-    nrf_802154_trx_ppi_for_ramp_up_set(NRF_RADIO_TASK_RXEN, TRX_RAMP_UP_SW_TRIGGER, false);
+
+#if NRF_802154_ACK_TIMEOUT_HW_WINDOW_ENABLED
+    if (m_ack_wait_window != 0U)
+    {
+        // The TIMER counts from the ramp up and must not be stopped by the LNA activation
+        nrf_timer_shorts_disable(NRF_802154_TIMER_INSTANCE, NRF_TIMER_SHORT_COMPARE0_STOP_MASK);
+        nrf_timer_cc_set(NRF_802154_TIMER_INSTANCE, NRF_TIMER_CC_CHANNEL1, m_ack_wait_window);
+        nrf_timer_event_clear(NRF_802154_TIMER_INSTANCE, NRF_TIMER_EVENT_COMPARE1);
+
+        nrf_802154_trx_ppi_for_ramp_up_set(NRF_RADIO_TASK_RXEN, TRX_RAMP_UP_SW_TRIGGER, true);
+        nrf_802154_trx_ppi_for_ack_wait_window_set();
+    }
+    else
+#endif
+    {
+        nrf_802154_trx_ppi_for_ramp_up_set(NRF_RADIO_TASK_RXEN, TRX_RAMP_UP_SW_TRIGGER, false);
+    }
 
     trigger_disable_to_start_rampup();
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
+#if NRF_802154_ACK_TIMEOUT_HW_WINDOW_ENABLED
+
+void nrf_802154_trx_receive_ack_window_set(uint32_t window_us)
+{
+    assert(m_trx_state != TRX_STATE_RXACK);
+
+    m_ack_wait_window = window_us;
+}
+
+#endif // NRF_802154_ACK_TIMEOUT_HW_WINDOW_ENABLED
+
 bool nrf_802154_trx_rssi_measure(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
@@ -1286,6 +1597,45 @@ bool nrf_802154_trx_rssi_measure(void)
     return result;
 }
 
+#if NRF_802154_NOISE_FLOOR_ENABLED
+
+bool nrf_802154_trx_rssi_noise_sample(uint8_t * p_rssi_sample)
+{
+    if ((m_trx_state != TRX_STATE_RXFRAME) || m_flags.psdu_being_received ||
+        m_flags.rssi_started || (nrf_radio_state_get(NRF_RADIO) != RADIO_STATE_STATE_Rx))
+    {
+        return false;
+    }
+
+    if (!m_flags.rssi_settled)
+    {
+        uint64_t now = nrf_802154_sl_timer_current_time_get();
+
+        if ((m_rx_listen_time > now) || (now - m_rx_listen_time < RSSI_NOISE_DELAY_US))
+        {
+            return false;
+        }
+
+        m_flags.rssi_settled = true;
+    }
+
+#if defined(RADIO_EVENTS_RSSIEND_EVENTS_RSSIEND_Msk)
+    nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_RSSIEND);
+#endif
+    nrf_radio_task_trigger(NRF_RADIO, NRF_RADIO_TASK_RSSISTART);
+
+    while (!nrf_802154_trx_rssi_sample_is_available())
+    {
+        // Intentionally empty: a single RSSI sample takes a fraction of a microsecond.
+    }
+
+    *p_rssi_sample = nrf_radio_rssi_sample_get(NRF_RADIO);
+
+    return true;
+}
+
+#endif // NRF_802154_NOISE_FLOOR_ENABLED
+
 bool nrf_802154_trx_rssi_measure_is_started(void)
 {
     return m_flags.rssi_started;
@@ -1319,7 +1669,8 @@ void nrf_802154_trx_transmit_frame(const void                            * p_tra
     // Force the TIMER to be stopped and count from 0.
     nrf_timer_task_trigger(NRF_802154_TIMER_INSTANCE, NRF_TIMER_TASK_SHUTDOWN);
 
-    m_trx_state              = TRX_STATE_TXFRAME;
+    trx_state_set(TRX_STATE_TXFRAME);
+
     m_transmit_with_cca      = cca;
     m_remaining_cca_attempts = cca_attempts;
 
@@ -1414,7 +1765,7 @@ bool nrf_802154_trx_transmit_ack(const void * p_transmit_buffer, uint32_t delay_
     assert(m_trx_state == TRX_STATE_RXFRAME_FINISHED);
     assert(p_transmit_buffer != NULL);
 
-    m_trx_state = TRX_STATE_TXACK;
+    trx_state_set(TRX_STATE_TXACK);
 
     // Set TIMER's CC to the moment when ramp-up should occur.
     if (delay_us <= TXRU_TIME + EVENT_LAT)
@@ -1442,11 +1793,12 @@ bool nrf_802154_trx_transmit_ack(const void * p_transmit_buffer, uint32_t delay_
     // Set FEM
     // Note: the TIMER is running, ramp up will start in timer_cc_ramp_up_start tick
     // Assumption here is that FEM activation takes no more than TXRU_TIME.
-    m_activate_tx_cc0_timeshifted = m_activate_tx_cc0;
-
     // Set the moment for FEM at which real transmission starts.
-    m_activate_tx_cc0_timeshifted.event.timer.counter_period.end = timer_cc_ramp_up_start +
-                                                                   TXRU_TIME;
+    nrf_802154_fal_timer_event_prepare(&m_activate_tx_cc0_timeshifted,
+                                       NRF_802154_TIMER_INSTANCE,
+                                       FEM_COMPARE_CHANNEL_MASK,
+                                       timer_cc_ramp_up_start + TXRU_TIME,
+                                       &m_fem_profiles[NRF_802154_FAL_OPERATION_ACK_TX]);
 
     if (mpsl_fem_pa_configuration_set(&m_activate_tx_cc0_timeshifted, NULL) == 0)
     {
@@ -1487,10 +1839,13 @@ bool nrf_802154_trx_transmit_ack(const void * p_transmit_buffer, uint32_t delay_
     if ((timer_cc_now < timer_cc_ramp_up_start) &&
         ((timer_cc_fem_start >= timer_cc_ramp_up_start) || (timer_cc_now > timer_cc_fem_start)))
     {
+        nrf_802154_stat_histogram_sample(ack_turnaround_margin,
+                                         timer_cc_ramp_up_start - timer_cc_now);
         result = true;
     }
     else
     {
+        nrf_802154_stat_histogram_sample(ack_turnaround_margin, 0U);
         nrf_802154_trx_ppi_for_ramp_up_propagation_delay_wait();
 
         if (nrf_radio_state_get(NRF_RADIO) == NRF_RADIO_STATE_TXRU)
@@ -1674,7 +2029,7 @@ void nrf_802154_trx_abort(void)
 
         case TRX_STATE_RXFRAME_FINISHED:
             nrf_timer_task_trigger(NRF_802154_TIMER_INSTANCE, NRF_TIMER_TASK_SHUTDOWN);
-            m_trx_state = TRX_STATE_FINISHED;
+            trx_state_set(TRX_STATE_FINISHED);
             break;
 
         case TRX_STATE_RXACK:
@@ -1728,7 +2083,7 @@ static void go_idle_from_state_finished(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
 
-    m_trx_state = TRX_STATE_GOING_IDLE;
+    trx_state_set(TRX_STATE_GOING_IDLE);
 
     nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_DISABLED);
     nrf_radio_task_trigger(NRF_RADIO, NRF_RADIO_TASK_DISABLE);
@@ -1782,7 +2137,7 @@ static void go_idle_abort(void)
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
 
     nrf_radio_int_disable(NRF_RADIO, NRF_RADIO_INT_DISABLED_MASK);
-    m_trx_state = TRX_STATE_FINISHED;
+    trx_state_set(TRX_STATE_FINISHED);
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
@@ -1802,7 +2157,7 @@ static void receive_frame_abort(void)
 
     nrf_timer_task_trigger(NRF_802154_TIMER_INSTANCE, NRF_TIMER_TASK_SHUTDOWN);
 
-    m_trx_state = TRX_STATE_FINISHED;
+    trx_state_set(TRX_STATE_FINISHED);
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
@@ -1811,7 +2166,17 @@ static void rxack_finish_disable_ppis(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
 
-    nrf_802154_trx_ppi_for_ramp_up_clear(NRF_RADIO_TASK_RXEN, false);
+#if NRF_802154_ACK_TIMEOUT_HW_WINDOW_ENABLED
+    if (m_ack_wait_window != 0U)
+    {
+        nrf_802154_trx_ppi_for_ack_wait_window_clear();
+        nrf_802154_trx_ppi_for_ramp_up_clear(NRF_RADIO_TASK_RXEN, true);
+    }
+    else
+#endif
+    {
+        nrf_802154_trx_ppi_for_ramp_up_clear(NRF_RADIO_TASK_RXEN, false);
+    }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
@@ -1880,7 +2245,7 @@ static void receive_ack_abort(void)
 
     nrf_timer_task_trigger(NRF_802154_TIMER_INSTANCE, NRF_TIMER_TASK_SHUTDOWN);
 
-    m_trx_state = TRX_STATE_FINISHED;
+    trx_state_set(TRX_STATE_FINISHED);
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
@@ -1891,7 +2256,7 @@ void nrf_802154_trx_standalone_cca(void)
 
     assert((m_trx_state == TRX_STATE_IDLE) || (m_trx_state == TRX_STATE_FINISHED));
 
-    m_trx_state = TRX_STATE_STANDALONE_CCA;
+    trx_state_set(TRX_STATE_STANDALONE_CCA);
 
     // Set shorts
     nrf_radio_shorts_set(NRF_RADIO, SHORTS_CCA);
@@ -1902,7 +2267,7 @@ void nrf_802154_trx_standalone_cca(void)
     nrf_radio_int_enable(NRF_RADIO, NRF_RADIO_INT_CCABUSY_MASK | NRF_RADIO_INT_CCAIDLE_MASK);
 
     // Set FEM
-    fem_for_lna_set();
+    fem_for_lna_set(&m_activate_cca_cc0);
 
     // Select antenna
     nrf_802154_trx_antenna_update();
@@ -1939,7 +2304,7 @@ static void standalone_cca_abort(void)
 
     standalone_cca_finish();
 
-    m_trx_state = TRX_STATE_FINISHED;
+    trx_state_set(TRX_STATE_FINISHED);
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
@@ -1952,7 +2317,7 @@ void nrf_802154_trx_continuous_carrier(const nrf_802154_fal_tx_power_split_t * p
 
     assert((m_trx_state == TRX_STATE_IDLE) || (m_trx_state == TRX_STATE_FINISHED));
 
-    m_trx_state = TRX_STATE_CONTINUOUS_CARRIER;
+    trx_state_set(TRX_STATE_CONTINUOUS_CARRIER);
 
     // Set Tx Power
     txpower_set(p_tx_power->radio_tx_power);
@@ -1996,7 +2361,7 @@ static void continuous_carrier_abort(void)
 
     nrf_radio_task_trigger(NRF_RADIO, NRF_RADIO_TASK_DISABLE);
 
-    m_trx_state = TRX_STATE_FINISHED;
+    trx_state_set(TRX_STATE_FINISHED);
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
@@ -2009,7 +2374,7 @@ void nrf_802154_trx_modulated_carrier(const void                            * p_
     assert((m_trx_state == TRX_STATE_IDLE) || (m_trx_state == TRX_STATE_FINISHED));
     assert(p_transmit_buffer != NULL);
 
-    m_trx_state = TRX_STATE_MODULATED_CARRIER;
+    trx_state_set(TRX_STATE_MODULATED_CARRIER);
 
     // Set Tx Power
     txpower_set(p_tx_power->radio_tx_power);
@@ -2061,20 +2426,18 @@ static void modulated_carrier_abort()
 
     nrf_radio_task_trigger(NRF_RADIO, NRF_RADIO_TASK_DISABLE);
 
-    m_trx_state = TRX_STATE_FINISHED;
+    trx_state_set(TRX_STATE_FINISHED);
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
 
 #endif // NRF_802154_CARRIER_FUNCTIONS_ENABLED
 
-void nrf_802154_trx_energy_detection(uint32_t ed_count)
+static void energy_detection_start(uint32_t ed_count)
 {
-    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
-
     assert((m_trx_state == TRX_STATE_FINISHED) || (m_trx_state == TRX_STATE_IDLE));
 
-    m_trx_state = TRX_STATE_ENERGY_DETECTION;
+    trx_state_set(TRX_STATE_ENERGY_DETECTION);
 
     ed_count--;
     /* Check that vd_count will fit into defined bits of register */
@@ -2092,7 +2455,7 @@ void nrf_802154_trx_energy_detection(uint32_t ed_count)
     nrf_radio_int_enable(NRF_RADIO, NRF_RADIO_INT_EDEND_MASK);
 
     // Set FEM
-    fem_for_lna_set();
+    fem_for_lna_set(&m_activate_rx_cc0);
 
     // Select antenna
     nrf_802154_trx_antenna_update();
@@ -2101,10 +2464,42 @@ void nrf_802154_trx_energy_detection(uint32_t ed_count)
     nrf_802154_trx_ppi_for_ramp_up_set(NRF_RADIO_TASK_RXEN, TRX_RAMP_UP_SW_TRIGGER, false);
 
     trigger_disable_to_start_rampup();
+}
+
+void nrf_802154_trx_energy_detection(uint32_t ed_count)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+#if NRF_802154_ED_RING_ENABLED
+    m_ed_sampled = false;
+#endif
+
+    energy_detection_start(ed_count);
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
+#if NRF_802154_ED_RING_ENABLED
+
+void nrf_802154_trx_energy_detection_sampled(uint32_t ed_count)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    assert(ed_count != 0U);
+
+    // The RADIO has no shortcut from EDEND to EDSTART. Each iteration is performed as a separate
+    // ED procedure of one iteration, restarted from the EDEND handler.
+    m_ed_sampled      = true;
+    m_ed_samples_left = ed_count - 1U;
+    m_ed_max_sample   = 0U;
+
+    energy_detection_start(1U);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
+#endif // NRF_802154_ED_RING_ENABLED
+
 static void energy_detection_finish(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
@@ -2126,7 +2521,7 @@ static void energy_detection_abort(void)
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
 
     energy_detection_finish();
-    m_trx_state = TRX_STATE_FINISHED;
+    trx_state_set(TRX_STATE_FINISHED);
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
@@ -2144,11 +2539,15 @@ static void irq_handler_ready(void)
         case TRX_STATE_TXFRAME:
             if (m_flags.ccastarted_notif_en)
             {
+                trx_capture(NRF_802154_TRX_CAPTURE_EVENT_TRANSMIT_FRAME_CCASTARTED, 0U);
                 nrf_802154_trx_transmit_frame_ccastarted();
             }
             break;
 
         case TRX_STATE_RXFRAME:
+#if NRF_802154_NOISE_FLOOR_ENABLED
+            m_rx_listen_time = nrf_802154_sl_timer_current_time_get();
+#endif
             break;
 
         default:
@@ -2172,23 +2571,27 @@ static void irq_handler_address(void)
         case TRX_STATE_RXFRAME:
             if (m_flags.rxstarted_notif_en)
             {
+                trx_capture(NRF_802154_TRX_CAPTURE_EVENT_RECEIVE_FRAME_STARTED, 0U);
                 nrf_802154_trx_receive_frame_started();
             }
             break;
 
         case TRX_STATE_RXACK:
             m_flags.rssi_started = true;
+            trx_capture(NRF_802154_TRX_CAPTURE_EVENT_RECEIVE_ACK_STARTED, 0U);
             nrf_802154_trx_receive_ack_started();
             break;
 
         case TRX_STATE_TXFRAME:
             nrf_radio_int_disable(NRF_RADIO, NRF_RADIO_INT_ADDRESS_MASK);
             m_flags.tx_started = true;
+            trx_capture(NRF_802154_TRX_CAPTURE_EVENT_TRANSMIT_FRAME_STARTED, 0U);
             nrf_802154_trx_transmit_frame_started();
             break;
 
         case TRX_STATE_TXACK:
             nrf_radio_int_disable(NRF_RADIO, NRF_RADIO_INT_ADDRESS_MASK);
+            trx_capture(NRF_802154_TRX_CAPTURE_EVENT_TRANSMIT_ACK_STARTED, 0U);
             nrf_802154_trx_transmit_ack_started();
             break;
 
@@ -2220,8 +2623,19 @@ static void irq_handler_bcmatch(void)
 
     current_bcc = nrf_radio_bcc_get(NRF_RADIO) / 8U;
 
+    trx_capture_rx(NRF_802154_TRX_CAPTURE_EVENT_RECEIVE_FRAME_BCMATCHED, current_bcc, current_bcc);
+
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+    uint32_t start_cycles = nrf_802154_stat_histogram_cycles_get();
+#endif
+
     next_bcc = nrf_802154_trx_receive_frame_bcmatched(current_bcc);
 
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+    nrf_802154_stat_histogram_sample(bcmatch_handler_cycles,
+                                     nrf_802154_stat_histogram_cycles_get() - start_cycles);
+#endif
+
     if (next_bcc > current_bcc)
     {
         /* Note: If we don't make it before given octet is received by RADIO bcmatch will not be triggered.
@@ -2244,13 +2658,15 @@ static void irq_handler_crcerror(void)
             rxframe_finish();
             /* On crc error TIMER is not needed, no ACK may be sent */
             nrf_timer_task_trigger(NRF_802154_TIMER_INSTANCE, NRF_TIMER_TASK_SHUTDOWN);
-            m_trx_state = TRX_STATE_FINISHED;
+            trx_state_set(TRX_STATE_FINISHED);
+            trx_capture_rx_end(NRF_802154_TRX_CAPTURE_EVENT_RECEIVE_FRAME_CRCERROR);
             nrf_802154_trx_receive_frame_crcerror();
             break;
 
         case TRX_STATE_RXACK:
             rxack_finish();
-            m_trx_state = TRX_STATE_FINISHED;
+            trx_state_set(TRX_STATE_FINISHED);
+            trx_capture_rx_end(NRF_802154_TRX_CAPTURE_EVENT_RECEIVE_ACK_CRCERROR);
             nrf_802154_trx_receive_ack_crcerror();
             break;
 
@@ -2268,15 +2684,30 @@ static void irq_handler_crcok(void)
     switch (m_trx_state)
     {
         case TRX_STATE_RXFRAME:
+        {
             m_flags.rssi_started = true;
             rxframe_finish();
-            m_trx_state = TRX_STATE_RXFRAME_FINISHED;
+            trx_state_set(TRX_STATE_RXFRAME_FINISHED);
+
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+            uint32_t start_cycles = nrf_802154_stat_histogram_cycles_get();
+#endif
+
+            trx_capture_rx_end(NRF_802154_TRX_CAPTURE_EVENT_RECEIVE_FRAME_RECEIVED);
             nrf_802154_trx_receive_frame_received();
-            break;
+
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+            nrf_802154_stat_histogram_sample(rx_frame_handler_cycles,
+                                             nrf_802154_stat_histogram_cycles_get() -
+                                             start_cycles);
+#endif
+        }
+        break;
 
         case TRX_STATE_RXACK:
             rxack_finish();
-            m_trx_state = TRX_STATE_FINISHED;
+            trx_state_set(TRX_STATE_FINISHED);
+            trx_capture_rx_end(NRF_802154_TRX_CAPTURE_EVENT_RECEIVE_ACK_RECEIVED);
             nrf_802154_trx_receive_ack_received();
             break;
 
@@ -2368,7 +2799,7 @@ static void transmit_frame_abort(void)
     nrf_radio_task_trigger(NRF_RADIO, NRF_RADIO_TASK_CCASTOP);
     nrf_radio_task_trigger(NRF_RADIO, NRF_RADIO_TASK_DISABLE);
 
-    m_trx_state = TRX_STATE_FINISHED;
+    trx_state_set(TRX_STATE_FINISHED);
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
@@ -2440,7 +2871,7 @@ static void transmit_ack_abort(void)
 
     nrf_radio_task_trigger(NRF_RADIO, NRF_RADIO_TASK_DISABLE);
 
-    m_trx_state = TRX_STATE_FINISHED;
+    trx_state_set(TRX_STATE_FINISHED);
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
@@ -2453,13 +2884,15 @@ static void irq_handler_phyend(void)
     {
         case TRX_STATE_TXFRAME:
             txframe_finish();
-            m_trx_state = TRX_STATE_FINISHED;
+            trx_state_set(TRX_STATE_FINISHED);
+            trx_capture(NRF_802154_TRX_CAPTURE_EVENT_TRANSMIT_FRAME_TRANSMITTED, 0U);
             nrf_802154_trx_transmit_frame_transmitted();
             break;
 
         case TRX_STATE_TXACK:
             txack_finish();
-            m_trx_state = TRX_STATE_FINISHED;
+            trx_state_set(TRX_STATE_FINISHED);
+            trx_capture(NRF_802154_TRX_CAPTURE_EVENT_TRANSMIT_ACK_TRANSMITTED, 0U);
             nrf_802154_trx_transmit_ack_transmitted();
             break;
 
@@ -2478,8 +2911,9 @@ static void go_idle_finish(void)
 
     fem_power_down_now();
 
-    m_trx_state = TRX_STATE_IDLE;
+    trx_state_set(TRX_STATE_IDLE);
 
+    trx_capture(NRF_802154_TRX_CAPTURE_EVENT_GO_IDLE_FINISHED, 0U);
     nrf_802154_trx_go_idle_finished();
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
@@ -2525,11 +2959,13 @@ static void irq_handler_ccaidle(void)
     {
         case TRX_STATE_STANDALONE_CCA:
             standalone_cca_finish();
-            m_trx_state = TRX_STATE_FINISHED;
+            trx_state_set(TRX_STATE_FINISHED);
+            trx_capture(NRF_802154_TRX_CAPTURE_EVENT_STANDALONE_CCA_FINISHED, 1U);
             nrf_802154_trx_standalone_cca_finished(true);
             break;
 
         case TRX_STATE_TXFRAME:
+            trx_capture(NRF_802154_TRX_CAPTURE_EVENT_TRANSMIT_FRAME_CCAIDLE, 0U);
             nrf_802154_trx_transmit_frame_ccaidle();
             break;
 
@@ -2603,7 +3039,8 @@ static void irq_handler_ccabusy(void)
                         nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_CCABUSY);
 
                         txframe_finish();
-                        m_trx_state = TRX_STATE_FINISHED;
+                        trx_state_set(TRX_STATE_FINISHED);
+                        trx_capture(NRF_802154_TRX_CAPTURE_EVENT_TRANSMIT_FRAME_CCABUSY, 0U);
                         nrf_802154_trx_transmit_frame_ccabusy();
                     }
                 }
@@ -2611,14 +3048,16 @@ static void irq_handler_ccabusy(void)
             else
             {
                 txframe_finish();
-                m_trx_state = TRX_STATE_FINISHED;
+                trx_state_set(TRX_STATE_FINISHED);
+                trx_capture(NRF_802154_TRX_CAPTURE_EVENT_TRANSMIT_FRAME_CCABUSY, 0U);
                 nrf_802154_trx_transmit_frame_ccabusy();
             }
             break;
 
         case TRX_STATE_STANDALONE_CCA:
             standalone_cca_finish();
-            m_trx_state = TRX_STATE_FINISHED;
+            trx_state_set(TRX_STATE_FINISHED);
+            trx_capture(NRF_802154_TRX_CAPTURE_EVENT_STANDALONE_CCA_FINISHED, 0U);
             nrf_802154_trx_standalone_cca_finished(false);
             break;
 
@@ -2637,9 +3076,35 @@ static void irq_handler_edend(void)
 
     uint8_t ed_sample = nrf_radio_ed_sample_get(NRF_RADIO);
 
+#if NRF_802154_ED_RING_ENABLED
+    if (m_ed_sampled)
+    {
+        if (m_ed_max_sample < ed_sample)
+        {
+            m_ed_max_sample = ed_sample;
+        }
+
+        if (m_ed_samples_left > 0U)
+        {
+            m_ed_samples_left--;
+
+            // The RADIO stays in RXIDLE after EDEND, so the next iteration starts right away.
+            nrf_radio_task_trigger(NRF_RADIO, NRF_RADIO_TASK_EDSTART);
+            nrf_802154_trx_energy_detection_sample(ed_sample);
+
+            nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+            return;
+        }
+
+        nrf_802154_trx_energy_detection_sample(ed_sample);
+        ed_sample = m_ed_max_sample;
+    }
+#endif
+
     energy_detection_finish();
-    m_trx_state = TRX_STATE_FINISHED;
+    trx_state_set(TRX_STATE_FINISHED);
 
+    trx_capture(NRF_802154_TRX_CAPTURE_EVENT_ENERGY_DETECTION_FINISHED, ed_sample);
     nrf_802154_trx_energy_detection_finished(ed_sample);
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
@@ -2652,6 +3117,7 @@ static void irq_handler_sync(void)
 
     assert(m_trx_state == TRX_STATE_RXFRAME);
 
+    trx_capture(NRF_802154_TRX_CAPTURE_EVENT_RECEIVE_FRAME_PRESTARTED, 0U);
     nrf_802154_trx_receive_frame_prestarted();
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
@@ -2662,6 +3128,11 @@ static void irq_handler_sync(void)
 void nrf_802154_radio_irq_handler(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+    nrf_802154_trace(NRF_802154_TRACE_EVENT_RADIO_IRQ_ENTER, 0U);
+
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+    uint32_t irq_start_time = nrf_802154_stat_histogram_time_get();
+#endif
 
     // Prevent interrupting of this handler by requests from higher priority code.
     nrf_802154_critical_section_forcefully_enter();
@@ -2685,6 +3156,7 @@ void nrf_802154_radio_irq_handler(void)
     {
         nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_READY);
 
+        nrf_802154_trace(NRF_802154_TRACE_EVENT_READY, 0U);
         irq_handler_ready();
     }
 
@@ -2693,6 +3165,7 @@ void nrf_802154_radio_irq_handler(void)
     {
         nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_ADDRESS);
 
+        nrf_802154_trace(NRF_802154_TRACE_EVENT_ADDRESS, 0U);
         irq_handler_address();
     }
 
@@ -2702,6 +3175,7 @@ void nrf_802154_radio_irq_handler(void)
     {
         nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_BCMATCH);
 
+        nrf_802154_trace(NRF_802154_TRACE_EVENT_BCMATCH, 0U);
         irq_handler_bcmatch();
     }
 
@@ -2710,6 +3184,7 @@ void nrf_802154_radio_irq_handler(void)
     {
         nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_CRCERROR);
 
+        nrf_802154_trace(NRF_802154_TRACE_EVENT_CRCERROR, 0U);
         irq_handler_crcerror();
     }
 
@@ -2718,6 +3193,7 @@ void nrf_802154_radio_irq_handler(void)
     {
         nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_CRCOK);
 
+        nrf_802154_trace(NRF_802154_TRACE_EVENT_CRCOK, 0U);
         irq_handler_crcok();
     }
 
@@ -2726,6 +3202,7 @@ void nrf_802154_radio_irq_handler(void)
     {
         nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_PHYEND);
 
+        nrf_802154_trace(NRF_802154_TRACE_EVENT_PHYEND, 0U);
         irq_handler_phyend();
     }
 
@@ -2734,6 +3211,7 @@ void nrf_802154_radio_irq_handler(void)
     {
         nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_DISABLED);
 
+        nrf_802154_trace(NRF_802154_TRACE_EVENT_DISABLED, 0U);
         irq_handler_disabled();
     }
 
@@ -2742,6 +3220,7 @@ void nrf_802154_radio_irq_handler(void)
     {
         nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_CCAIDLE);
 
+        nrf_802154_trace(NRF_802154_TRACE_EVENT_CCAIDLE, 0U);
         irq_handler_ccaidle();
     }
 
@@ -2750,6 +3229,7 @@ void nrf_802154_radio_irq_handler(void)
     {
         nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_CCABUSY);
 
+        nrf_802154_trace(NRF_802154_TRACE_EVENT_CCABUSY, 0U);
         irq_handler_ccabusy();
     }
 
@@ -2758,11 +3238,18 @@ void nrf_802154_radio_irq_handler(void)
     {
         nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_EDEND);
 
+        nrf_802154_trace(NRF_802154_TRACE_EVENT_EDEND, 0U);
         irq_handler_edend();
     }
 
     nrf_802154_critical_section_exit();
 
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+    nrf_802154_stat_histogram_sample(radio_irq_duration,
+                                     nrf_802154_stat_histogram_time_get() - irq_start_time);
+#endif
+
+    nrf_802154_trace(NRF_802154_TRACE_EVENT_RADIO_IRQ_EXIT, 0U);
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
@@ -2860,3 +3347,98 @@ const nrf_802154_sl_event_handle_t * nrf_802154_trx_radio_phyend_event_handle_ge
 
     return &r;
 }
+
+#if NRF_802154_TRX_CAPTURE_ENABLED && defined(CONFIG_SOC_SERIES_BSIM_NRFXX)
+
+void nrf_802154_trx_capture_replay(const nrf_802154_trx_capture_record_t * p_record)
+{
+    const uint8_t * p_data = (const uint8_t *)(p_record + 1);
+
+    if ((p_record->data_len != 0U) && (mp_receive_buffer != NULL))
+    {
+        memcpy(mp_receive_buffer, p_data, p_record->data_len);
+    }
+
+    trx_state_set((trx_state_t)p_record->trx_state);
+
+    switch (p_record->event)
+    {
+        case NRF_802154_TRX_CAPTURE_EVENT_RECEIVE_FRAME_PRESTARTED:
+            nrf_802154_trx_receive_frame_prestarted();
+            break;
+
+        case NRF_802154_TRX_CAPTURE_EVENT_RECEIVE_FRAME_STARTED:
+            nrf_802154_trx_receive_frame_started();
+            break;
+
+        case NRF_802154_TRX_CAPTURE_EVENT_RECEIVE_FRAME_BCMATCHED:
+            // Further BCMATCH events that were requested are replayed from their own records.
+            (void)nrf_802154_trx_receive_frame_bcmatched(p_record->param);
+            break;
+
+        case NRF_802154_TRX_CAPTURE_EVENT_RECEIVE_FRAME_RECEIVED:
+            nrf_802154_trx_receive_frame_received();
+            break;
+
+        case NRF_802154_TRX_CAPTURE_EVENT_RECEIVE_FRAME_CRCERROR:
+            nrf_802154_trx_receive_frame_crcerror();
+            break;
+
+        case NRF_802154_TRX_CAPTURE_EVENT_RECEIVE_ACK_STARTED:
+            nrf_802154_trx_receive_ack_started();
+            break;
+
+        case NRF_802154_TRX_CAPTURE_EVENT_RECEIVE_ACK_RECEIVED:
+            nrf_802154_trx_receive_ack_received();
+            break;
+
+        case NRF_802154_TRX_CAPTURE_EVENT_RECEIVE_ACK_CRCERROR:
+            nrf_802154_trx_receive_ack_crcerror();
+            break;
+
+        case NRF_802154_TRX_CAPTURE_EVENT_TRANSMIT_FRAME_CCASTARTED:
+            nrf_802154_trx_transmit_frame_ccastarted();
+            break;
+
+        case NRF_802154_TRX_CAPTURE_EVENT_TRANSMIT_FRAME_CCAIDLE:
+            nrf_802154_trx_transmit_frame_ccaidle();
+            break;
+
+        case NRF_802154_TRX_CAPTURE_EVENT_TRANSMIT_FRAME_CCABUSY:
+            nrf_802154_trx_transmit_frame_ccabusy();
+            break;
+
+        case NRF_802154_TRX_CAPTURE_EVENT_TRANSMIT_FRAME_STARTED:
+            nrf_802154_trx_transmit_frame_started();
+            break;
+
+        case NRF_802154_TRX_CAPTURE_EVENT_TRANSMIT_FRAME_TRANSMITTED:
+            nrf_802154_trx_transmit_frame_transmitted();
+            break;
+
+        case NRF_802154_TRX_CAPTURE_EVENT_TRANSMIT_ACK_STARTED:
+            nrf_802154_trx_transmit_ack_started();
+            break;
+
+        case NRF_802154_TRX_CAPTURE_EVENT_TRANSMIT_ACK_TRANSMITTED:
+            nrf_802154_trx_transmit_ack_transmitted();
+            break;
+
+        case NRF_802154_TRX_CAPTURE_EVENT_GO_IDLE_FINISHED:
+            nrf_802154_trx_go_idle_finished();
+            break;
+
+        case NRF_802154_TRX_CAPTURE_EVENT_STANDALONE_CCA_FINISHED:
+            nrf_802154_trx_standalone_cca_finished(p_record->param != 0U);
+            break;
+
+        case NRF_802154_TRX_CAPTURE_EVENT_ENERGY_DETECTION_FINISHED:
+            nrf_802154_trx_energy_detection_finished(p_record->param);
+            break;
+
+        default:
+            assert(false);
+    }
+}
+
+#endif // NRF_802154_TRX_CAPTURE_ENABLED && defined(CONFIG_SOC_SERIES_BSIM_NRFXX)
@@ -46,7 +46,9 @@
 #include <stdint.h>
 
 #include "nrf_802154_config.h"
+#include "nrf_802154_sl_ant_div.h"
 #include "nrf_802154_sl_types.h"
+#include "nrf_802154_trx_capture.h"
 #include "nrf_802154_types_internal.h"
 
 #ifdef __cplusplus
@@ -170,6 +172,22 @@ void nrf_802154_trx_disable(void);
  */
 void nrf_802154_trx_antenna_update(void);
 
+#if NRF_802154_ANT_DIV_PEER_TABLE_ENABLED
+
+/**
+ * @brief Sets the antenna preferred for the destination of the next transmitted frame.
+ *
+ * The antenna is used instead of the manually selected TX antenna during transmission of
+ * a frame and reception of its ACK, provided that antenna diversity TX mode is set to
+ * @ref NRF_802154_SL_ANT_DIV_MODE_MANUAL.
+ *
+ * @param[in] antenna  Antenna to be used or @ref NRF_802154_SL_ANT_DIV_ANTENNA_NONE to use
+ *                     the manually selected TX antenna.
+ */
+void nrf_802154_trx_tx_peer_antenna_set(nrf_802154_sl_ant_div_antenna_t antenna);
+
+#endif // NRF_802154_ANT_DIV_PEER_TABLE_ENABLED
+
 /**@brief Sets radio channel to use.
  *
  * @param[in] channel   Channel number to set (11-26).
@@ -179,6 +197,20 @@ void nrf_802154_trx_channel_set(uint8_t channel);
 /**@brief Updates CCA configuration in the RADIO peripheral according to PIB. */
 void nrf_802154_trx_cca_configuration_update(void);
 
+#if NRF_802154_CCA_ADAPTIVE_ENABLED
+
+/**@brief Updates CCA configuration in the RADIO peripheral according to PIB, except for the
+ *        energy detection threshold.
+ *
+ * The configuration stays in effect until @ref nrf_802154_trx_cca_configuration_update is called
+ * or the trx module is enabled again.
+ *
+ * @param[in] ed_threshold  Energy detection threshold to be written to the CCACTRL register.
+ */
+void nrf_802154_trx_cca_ed_threshold_set(uint8_t ed_threshold);
+
+#endif // NRF_802154_CCA_ADAPTIVE_ENABLED
+
 /**@brief Puts the trx module into receive frame mode.
  *
  * The frame will be received into buffer set by @ref nrf_802154_trx_receive_buffer_set.
@@ -224,6 +256,41 @@ void nrf_802154_trx_receive_frame(uint8_t                                 bcc,
  */
 void nrf_802154_trx_receive_ack(void);
 
+#if NRF_802154_ACK_TIMEOUT_HW_WINDOW_ENABLED
+
+/**@brief Sets the length of the ACK wait window used by @ref nrf_802154_trx_receive_ack.
+ *
+ * The window starts when the receiver starts ramping up. When it ends and no ACK has started
+ * being received, the receiver is disabled by the hardware and no further ACK notifications are
+ * generated. The trx module remains in receive ACK mode until it is aborted.
+ *
+ * @param[in] window_us  Length of the window in microseconds or 0 to wait for an ACK indefinitely.
+ */
+void nrf_802154_trx_receive_ack_window_set(uint32_t window_us);
+
+#endif // NRF_802154_ACK_TIMEOUT_HW_WINDOW_ENABLED
+
+#if NRF_802154_FAST_CHANNEL_HOP_ENABLED
+
+/**@brief Moves the ongoing frame reception to another channel.
+ *
+ * The configuration of the frame reception started with @ref nrf_802154_trx_receive_frame
+ * (shorts, interrupts, buffer and FEM setup) is kept. Only the frequency is updated and the RADIO
+ * is disabled with the RXEN ramp-up task chained to the RADIO DISABLED event through (D)PPI,
+ * the same way @ref TRX_RAMP_UP_SW_TRIGGER ramp up is performed.
+ *
+ * @note This function succeeds only when the trx module is in receive frame state and no frame
+ *       is being received at the moment.
+ *
+ * @param[in] channel  Channel number on which the reception is to continue.
+ *
+ * @retval true   The radio is ramping up on @p channel.
+ * @retval false  The reception cannot be moved in the current state. Nothing was changed.
+ */
+bool nrf_802154_trx_receive_frame_channel_hop(uint8_t channel);
+
+#endif // NRF_802154_FAST_CHANNEL_HOP_ENABLED
+
 /**@brief Starts RSSI measurement.
  *
  * @note This function succeeds when TRX module is in receive frame state only (started with @ref nrf_802154_trx_receive_frame)
@@ -233,6 +300,23 @@ void nrf_802154_trx_receive_ack(void);
  */
 bool nrf_802154_trx_rssi_measure(void);
 
+#if NRF_802154_NOISE_FLOOR_ENABLED
+
+/**@brief Takes an RSSI sample of the channel if the RADIO is listening and idle.
+ *
+ * The sample is taken only if the TRX module is in receive frame state, no frame is being received,
+ * no RSSI measurement requested by @ref nrf_802154_trx_rssi_measure is pending and the RSSI has
+ * already settled. The function never waits for the RSSI to settle.
+ *
+ * @param[out] p_rssi_sample  RSSI sample, to be scaled using API provided by nrf_802154_rssi.h.
+ *
+ * @retval true     When the sample has been taken.
+ * @retval false    When the TRX state didn't allow to take the sample without a delay.
+ */
+bool nrf_802154_trx_rssi_noise_sample(uint8_t * p_rssi_sample);
+
+#endif // NRF_802154_NOISE_FLOOR_ENABLED
+
 /**@brief Checks if RSSI measurement is currently started.
  *
  * @retval true     When RSSI measurement is currently started. In this case user can
@@ -440,6 +524,21 @@ void nrf_802154_trx_modulated_carrier_restart(void);
  */
 void nrf_802154_trx_energy_detection(uint32_t ed_count);
 
+#if NRF_802154_ED_RING_ENABLED
+
+/**@brief Puts trx module into energy detection mode reporting each iteration.
+ *
+ * Operation works as @ref nrf_802154_trx_energy_detection, but the sample of each iteration is
+ * reported by a call to @ref nrf_802154_trx_energy_detection_sample handler. Operation ends up
+ * with a call to @ref nrf_802154_trx_energy_detection_finished handler with the maximum sample.
+ *
+ * @param ed_count  Number of iterations to perform. Must be greater than 0.
+ *                  One iteration takes 128 microseconds.
+ */
+void nrf_802154_trx_energy_detection_sampled(uint32_t ed_count);
+
+#endif // NRF_802154_ED_RING_ENABLED
+
 /**@brief Aborts currently performed operation.
  *
  * When trx module is in @c DISABLED, @c IDLE or @c FINISHED state, this function has no effect.
@@ -780,6 +879,20 @@ extern void nrf_802154_trx_standalone_cca_finished(bool channel_was_idle);
  */
 extern void nrf_802154_trx_energy_detection_finished(uint8_t ed_sample);
 
+#if NRF_802154_ED_RING_ENABLED
+
+/**@brief Handler called when an iteration of the sampled energy detection has been just finished.
+ *
+ *  This handler is called from an ISR when energy detection operation was requested by a call to
+ *  @ref nrf_802154_trx_energy_detection_sampled, before the next iteration is performed or
+ *  before @ref nrf_802154_trx_energy_detection_finished handler is called.
+ *
+ * @param ed_sample     Sample of detected energy of the iteration.
+ */
+extern void nrf_802154_trx_energy_detection_sample(uint8_t ed_sample);
+
+#endif // NRF_802154_ED_RING_ENABLED
+
 /**@brief Returns RADIO->EVENTS_END handle that hardware can subscribe to.
  *
  * @return RADIO->EVENTS_END handle that hardware can subscribe to.
@@ -804,6 +917,23 @@ const nrf_802154_sl_event_handle_t * nrf_802154_trx_radio_crcok_event_handle_get
  */
 const nrf_802154_sl_event_handle_t * nrf_802154_trx_radio_phyend_event_handle_get(void);
 
+#if NRF_802154_TRX_CAPTURE_ENABLED && defined(CONFIG_SOC_SERIES_BSIM_NRFXX)
+
+/**@brief Replays a captured trx callback.
+ *
+ * The frame octets of the record are copied to the buffer set by
+ * @ref nrf_802154_trx_receive_buffer_set, the trx module is moved to the captured state and
+ * the captured callback is called, as if the RADIO IRQ handler had called it.
+ *
+ * @note This function is intended for simulation only and must be called from the context of
+ *       the RADIO IRQ handler, or with the RADIO IRQ disabled.
+ *
+ * @param[in] p_record  Pointer to the captured record, followed by its frame octets.
+ */
+void nrf_802154_trx_capture_replay(const nrf_802154_trx_capture_record_t * p_record);
+
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**
+ * @file
+ *   This file implements the capture of the trx callbacks of the 802.15.4 driver.
+ *
+ */
+
+#include "nrf_802154_trx_capture.h"
+
+#include <string.h>
+
+#include "nrf_802154_sl_timer.h"
+
+#if NRF_802154_TRX_CAPTURE_ENABLED
+
+#if (NRF_802154_TRX_CAPTURE_BUFFER_SIZE % 4) != 0
+#error NRF_802154_TRX_CAPTURE_BUFFER_SIZE must be a multiple of 4
+#endif
+
+volatile nrf_802154_trx_capture_t g_nrf_802154_trx_capture;
+
+void nrf_802154_trx_capture_init(void)
+{
+    memset((void *)&g_nrf_802154_trx_capture, 0, sizeof(g_nrf_802154_trx_capture));
+}
+
+void nrf_802154_trx_capture_record(nrf_802154_trx_capture_event_t event,
+                                   uint8_t                        trx_state,
+                                   uint8_t                        param,
+                                   const uint8_t                * p_data,
+                                   uint8_t                        data_len)
+{
+    uint32_t size        = g_nrf_802154_trx_capture.size;
+    uint32_t record_size = NRF_802154_TRX_CAPTURE_RECORD_SIZE(data_len);
+
+    if (record_size > NRF_802154_TRX_CAPTURE_BUFFER_SIZE - size)
+    {
+        g_nrf_802154_trx_capture.dropped++;
+        return;
+    }
+
+    uint8_t                         * p_dst    = (uint8_t *)g_nrf_802154_trx_capture.data + size;
+    nrf_802154_trx_capture_record_t * p_record = (nrf_802154_trx_capture_record_t *)p_dst;
+
+    p_record->timestamp = NRF_802154_TRX_CAPTURE_TIMESTAMP_GET();
+    p_record->event     = (uint8_t)event;
+    p_record->trx_state = trx_state;
+    p_record->param     = param;
+    p_record->data_len  = data_len;
+
+    if (data_len != 0U)
+    {
+        memcpy(p_dst + sizeof(nrf_802154_trx_capture_record_t), p_data, data_len);
+    }
+
+    g_nrf_802154_trx_capture.size = size + record_size;
+}
+
+const uint8_t * nrf_802154_trx_capture_get(uint32_t * p_size)
+{
+    *p_size = g_nrf_802154_trx_capture.size;
+
+    return (const uint8_t *)g_nrf_802154_trx_capture.data;
+}
+
+#endif // NRF_802154_TRX_CAPTURE_ENABLED
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#ifndef NRF_802154_TRX_CAPTURE_H__
+#define NRF_802154_TRX_CAPTURE_H__
+
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrf_802154_trx_capture 802.15.4 driver trx callback capture
+ * @{
+ * @ingroup nrf_802154
+ * @brief Capture of the sequence of the trx module callbacks for offline replay.
+ *
+ * Every callback the trx module calls into the core is stored in the capture buffer as
+ * a record of @ref nrf_802154_trx_capture_record_t, immediately followed by @c data_len octets
+ * of the frame as present in the receive buffer at the time of the callback. Each record is
+ * padded to a multiple of 4 octets. The data holds the PHR and the octets received so far for
+ * @ref NRF_802154_TRX_CAPTURE_EVENT_RECEIVE_FRAME_BCMATCHED and the whole frame for the events
+ * that end a reception. The other records carry no data.
+ *
+ * The trx callbacks are called only from the RADIO IRQ handler, so the capture buffer has
+ * a single writer and records are stored without disabling interrupts. The buffer is read out
+ * by dumping @c g_nrf_802154_trx_capture with a debugger, or with
+ * @ref nrf_802154_trx_capture_get, and can be replayed in simulation with
+ * @c nrf_802154_bsim_utils_trx_capture_replay.
+ */
+
+/**
+ * @brief Identifiers of the captured trx callbacks.
+ *
+ * Value 0 is reserved.
+ */
+typedef enum
+{
+    NRF_802154_TRX_CAPTURE_EVENT_RECEIVE_FRAME_PRESTARTED   = 1U,  ///< @c nrf_802154_trx_receive_frame_prestarted. Param: 0.
+    NRF_802154_TRX_CAPTURE_EVENT_RECEIVE_FRAME_STARTED      = 2U,  ///< @c nrf_802154_trx_receive_frame_started. Param: 0.
+    NRF_802154_TRX_CAPTURE_EVENT_RECEIVE_FRAME_BCMATCHED    = 3U,  ///< @c nrf_802154_trx_receive_frame_bcmatched. Param: bcc.
+    NRF_802154_TRX_CAPTURE_EVENT_RECEIVE_FRAME_RECEIVED     = 4U,  ///< @c nrf_802154_trx_receive_frame_received. Param: 0.
+    NRF_802154_TRX_CAPTURE_EVENT_RECEIVE_FRAME_CRCERROR     = 5U,  ///< @c nrf_802154_trx_receive_frame_crcerror. Param: 0.
+    NRF_802154_TRX_CAPTURE_EVENT_RECEIVE_ACK_STARTED        = 6U,  ///< @c nrf_802154_trx_receive_ack_started. Param: 0.
+    NRF_802154_TRX_CAPTURE_EVENT_RECEIVE_ACK_RECEIVED       = 7U,  ///< @c nrf_802154_trx_receive_ack_received. Param: 0.
+    NRF_802154_TRX_CAPTURE_EVENT_RECEIVE_ACK_CRCERROR       = 8U,  ///< @c nrf_802154_trx_receive_ack_crcerror. Param: 0.
+    NRF_802154_TRX_CAPTURE_EVENT_TRANSMIT_FRAME_CCASTARTED  = 9U,  ///< @c nrf_802154_trx_transmit_frame_ccastarted. Param: 0.
+    NRF_802154_TRX_CAPTURE_EVENT_TRANSMIT_FRAME_CCAIDLE     = 10U, ///< @c nrf_802154_trx_transmit_frame_ccaidle. Param: 0.
+    NRF_802154_TRX_CAPTURE_EVENT_TRANSMIT_FRAME_CCABUSY     = 11U, ///< @c nrf_802154_trx_transmit_frame_ccabusy. Param: 0.
+    NRF_802154_TRX_CAPTURE_EVENT_TRANSMIT_FRAME_STARTED     = 12U, ///< @c nrf_802154_trx_transmit_frame_started. Param: 0.
+    NRF_802154_TRX_CAPTURE_EVENT_TRANSMIT_FRAME_TRANSMITTED = 13U, ///< @c nrf_802154_trx_transmit_frame_transmitted. Param: 0.
+    NRF_802154_TRX_CAPTURE_EVENT_TRANSMIT_ACK_STARTED       = 14U, ///< @c nrf_802154_trx_transmit_ack_started. Param: 0.
+    NRF_802154_TRX_CAPTURE_EVENT_TRANSMIT_ACK_TRANSMITTED   = 15U, ///< @c nrf_802154_trx_transmit_ack_transmitted. Param: 0.
+    NRF_802154_TRX_CAPTURE_EVENT_GO_IDLE_FINISHED           = 16U, ///< @c nrf_802154_trx_go_idle_finished. Param: 0.
+    NRF_802154_TRX_CAPTURE_EVENT_STANDALONE_CCA_FINISHED    = 17U, ///< @c nrf_802154_trx_standalone_cca_finished. Param: channel_was_idle.
+    NRF_802154_TRX_CAPTURE_EVENT_ENERGY_DETECTION_FINISHED  = 18U, ///< @c nrf_802154_trx_energy_detection_finished. Param: ed_sample.
+} nrf_802154_trx_capture_event_t;
+
+/**
+ * @brief Header of a captured record.
+ */
+typedef struct
+{
+    uint32_t timestamp; ///< Timestamp of the callback returned by @ref NRF_802154_TRX_CAPTURE_TIMESTAMP_GET.
+    uint8_t  event;     ///< Captured callback, one of @ref nrf_802154_trx_capture_event_t.
+    uint8_t  trx_state; ///< State of the trx module when the callback was called.
+    uint8_t  param;     ///< Parameter of the callback.
+    uint8_t  data_len;  ///< Number of frame octets following the header.
+} nrf_802154_trx_capture_record_t;
+
+/**
+ * @brief Returns the size of a record including its padded data.
+ *
+ * @param[in]  data_len  Number of frame octets following the header of the record.
+ */
+#define NRF_802154_TRX_CAPTURE_RECORD_SIZE(data_len) \
+    (sizeof(nrf_802154_trx_capture_record_t) + (((data_len) + 3U) & ~3U))
+
+#if NRF_802154_TRX_CAPTURE_ENABLED
+
+/**
+ * @brief Capture buffer.
+ */
+typedef struct
+{
+    uint32_t size;                                                        ///< Number of captured bytes.
+    uint32_t dropped;                                                     ///< Number of records that did not fit in the buffer.
+    uint32_t data[NRF_802154_TRX_CAPTURE_BUFFER_SIZE / sizeof(uint32_t)]; ///< Captured records.
+} nrf_802154_trx_capture_t;
+
+extern volatile nrf_802154_trx_capture_t g_nrf_802154_trx_capture;
+
+/**
+ * @brief Initializes the capture and discards all captured records.
+ */
+void nrf_802154_trx_capture_init(void);
+
+/**
+ * @brief Stores a record of a trx callback in the capture buffer.
+ *
+ * @param[in]  event      Captured callback.
+ * @param[in]  trx_state  State of the trx module when the callback is called.
+ * @param[in]  param      Parameter of the callback.
+ * @param[in]  p_data     Pointer to the frame octets to be stored with the record.
+ * @param[in]  data_len   Number of frame octets to be stored with the record.
+ */
+void nrf_802154_trx_capture_record(nrf_802154_trx_capture_event_t event,
+                                   uint8_t                        trx_state,
+                                   uint8_t                        param,
+                                   const uint8_t                * p_data,
+                                   uint8_t                        data_len);
+
+/**
+ * @brief Gets the captured records.
+ *
+ * @param[out] p_size  Number of captured bytes.
+ *
+ * @return  Pointer to the first captured record.
+ */
+const uint8_t * nrf_802154_trx_capture_get(uint32_t * p_size);
+
+#define nrf_802154_trx_capture(event, trx_state, param, p_data, data_len)                    \
+    nrf_802154_trx_capture_record((event), (uint8_t)(trx_state), (uint8_t)(param), (p_data), \
+                                  (uint8_t)(data_len))
+
+#else // NRF_802154_TRX_CAPTURE_ENABLED
+
+#define nrf_802154_trx_capture(event, trx_state, param, p_data, data_len) \
+    do                                                                    \
+    {                                                                     \
+    }                                                                     \
+    while (0)
+
+#endif // NRF_802154_TRX_CAPTURE_ENABLED
+
+/**
+ *@}
+ **/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_802154_TRX_CAPTURE_H__
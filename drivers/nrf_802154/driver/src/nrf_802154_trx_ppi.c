@@ -60,12 +60,14 @@
 
 #define PPI_CHGRP_ABORT            NRF_802154_PPI_ABORT_GROUP                 ///< PPI group used to disable PPIs when async event aborting radio operation is propagated through the system
 
-#define PPI_DISABLED_EGU           NRF_802154_PPI_RADIO_DISABLED_TO_EGU       ///< PPI that connects RADIO DISABLED event with EGU task
-#define PPI_RAMP_UP_TRG_EGU        NRF_802154_PPI_RADIO_RAMP_UP_TRIGG         ///< PPI that connects ramp up trigger event with EGU task
-#define PPI_EGU_RAMP_UP            NRF_802154_PPI_EGU_TO_RADIO_RAMP_UP        ///< PPI that connects EGU event with RADIO TXEN or RXEN task
-#define PPI_EGU_TIMER_START        NRF_802154_PPI_EGU_TO_TIMER_START          ///< PPI that connects EGU event with TIMER START task
-#define PPI_TIMER_TX_ACK           NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_TXEN ///< PPI that connects TIMER COMPARE event with RADIO TXEN task
-#define PPI_RADIO_SYNC_EGU_SYNC    NRF_802154_PPI_RADIO_SYNC_TO_EGU_SYNC      ///< PPI that connects RADIO SYNC event with EGU task for SYNC channel
+#define PPI_DISABLED_EGU           NRF_802154_PPI_RADIO_DISABLED_TO_EGU          ///< PPI that connects RADIO DISABLED event with EGU task
+#define PPI_RAMP_UP_TRG_EGU        NRF_802154_PPI_RADIO_RAMP_UP_TRIGG            ///< PPI that connects ramp up trigger event with EGU task
+#define PPI_EGU_RAMP_UP            NRF_802154_PPI_EGU_TO_RADIO_RAMP_UP           ///< PPI that connects EGU event with RADIO TXEN or RXEN task
+#define PPI_EGU_TIMER_START        NRF_802154_PPI_EGU_TO_TIMER_START             ///< PPI that connects EGU event with TIMER START task
+#define PPI_TIMER_TX_ACK           NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_TXEN    ///< PPI that connects TIMER COMPARE event with RADIO TXEN task
+#define PPI_RADIO_SYNC_EGU_SYNC    NRF_802154_PPI_RADIO_SYNC_TO_EGU_SYNC         ///< PPI that connects RADIO SYNC event with EGU task for SYNC channel
+#define PPI_TIMER_ACK_WAIT_END     NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_DISABLE ///< PPI that connects TIMER COMPARE event with RADIO DISABLE task
+#define PPI_ADDRESS_TIMER_STOP     NRF_802154_PPI_RADIO_ADDRESS_TO_TIMER_STOP    ///< PPI that connects RADIO ADDRESS event with TIMER STOP task
 
 void nrf_802154_trx_ppi_for_enable(void)
 {
@@ -259,6 +261,44 @@ void nrf_802154_trx_ppi_for_ack_tx_clear(void)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
 
+#if NRF_802154_ACK_TIMEOUT_HW_WINDOW_ENABLED
+
+void nrf_802154_trx_ppi_for_ack_wait_window_set(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
+
+    nrf_ppi_channel_endpoint_setup(NRF_PPI,
+                                   PPI_TIMER_ACK_WAIT_END,
+                                   nrf_timer_event_address_get(NRF_802154_TIMER_INSTANCE,
+                                                               NRF_TIMER_EVENT_COMPARE1),
+                                   nrf_radio_task_address_get(NRF_RADIO,
+                                                              NRF_RADIO_TASK_DISABLE));
+    nrf_ppi_channel_endpoint_setup(NRF_PPI,
+                                   PPI_ADDRESS_TIMER_STOP,
+                                   nrf_radio_event_address_get(NRF_RADIO,
+                                                               NRF_RADIO_EVENT_ADDRESS),
+                                   nrf_timer_task_address_get(NRF_802154_TIMER_INSTANCE,
+                                                              NRF_TIMER_TASK_STOP));
+    nrf_ppi_channels_enable(NRF_PPI,
+                            (1UL << PPI_TIMER_ACK_WAIT_END) | (1UL << PPI_ADDRESS_TIMER_STOP));
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
+}
+
+void nrf_802154_trx_ppi_for_ack_wait_window_clear(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
+
+    nrf_ppi_channels_disable(NRF_PPI,
+                             (1UL << PPI_TIMER_ACK_WAIT_END) | (1UL << PPI_ADDRESS_TIMER_STOP));
+    nrf_ppi_channel_endpoint_setup(NRF_PPI, PPI_TIMER_ACK_WAIT_END, 0, 0);
+    nrf_ppi_channel_endpoint_setup(NRF_PPI, PPI_ADDRESS_TIMER_STOP, 0, 0);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
+}
+
+#endif // NRF_802154_ACK_TIMEOUT_HW_WINDOW_ENABLED
+
 void nrf_802154_trx_ppi_for_fem_set(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
@@ -45,6 +45,7 @@
 
 #include "hal/nrf_egu.h"
 #include "hal/nrf_radio.h"
+#include "nrf_802154_config.h"
 #include "nrf_802154_trx.h"
 
 /**
@@ -183,6 +184,27 @@ void nrf_802154_trx_ppi_for_ack_tx_set(void);
  */
 void nrf_802154_trx_ppi_for_ack_tx_clear(void);
 
+#if NRF_802154_ACK_TIMEOUT_HW_WINDOW_ENABLED
+
+/**
+ * @brief Set (D)PPIs to end the ACK wait window at TIMER event COMPARE1.
+ *
+ * Connections created by this function:
+ *
+ *       TIMER_COMPARE1 ----> RADIO_DISABLE
+ *       RADIO_ADDRESS  ----> TIMER_STOP
+ */
+void nrf_802154_trx_ppi_for_ack_wait_window_set(void);
+
+/**
+ * @brief Clear (D)PPIs that end the ACK wait window.
+ *
+ * See @ref nrf_802154_trx_ppi_for_ack_wait_window_set.
+ */
+void nrf_802154_trx_ppi_for_ack_wait_window_clear(void);
+
+#endif // NRF_802154_ACK_TIMEOUT_HW_WINDOW_ENABLED
+
 /**
  * @brief Configure PPIs needed for external LNA or PA. Radio DISABLED event will be connected to timer START task.
  * As a result, FEM ramp-up will be scheduled during the radio ramp-up period, with timing based on FEM implementation used.
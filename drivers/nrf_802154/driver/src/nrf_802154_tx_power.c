@@ -33,9 +33,118 @@
  */
 
 #include "nrf_802154_tx_power.h"
+#include "nrf_802154_config.h"
 #include "nrf_802154_pib.h"
+#include "nrf_802154_utils.h"
 #include "nrf_802154_fal.h"
 
+#include <stdbool.h>
+
+#if NRF_802154_TX_POWER_SPLIT_CACHE_ENABLED
+
+#define CACHE_CHANNEL_FIRST 11U ///< Lowest channel covered by the cache.
+#define CACHE_CHANNEL_LAST  26U ///< Highest channel covered by the cache.
+
+/**@brief Cached transmit power split for a single channel. */
+typedef struct
+{
+    nrf_802154_fal_tx_power_split_t split;  ///< Transmit power split into components.
+    int8_t                          power;  ///< Requested transmit power the split was made for.
+    int8_t                          result; ///< Real achieved total transmit power.
+    bool                            valid;  ///< If the entry holds a valid split.
+} tx_power_split_cache_entry_t;
+
+static tx_power_split_cache_entry_t m_cache[CACHE_CHANNEL_LAST - CACHE_CHANNEL_FIRST + 1U];
+
+/**@brief Split the transmit power, using the cached result when available.
+ *
+ * The cache entries are accessed with interrupts disabled, because the split can be requested
+ * from any context of the driver. The FEM is consulted outside of the critical section.
+ */
+static int8_t tx_power_split(uint8_t                                 channel,
+                             int8_t                                  power,
+                             nrf_802154_fal_tx_power_split_t * const p_split_power)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    tx_power_split_cache_entry_t  * p_entry;
+    int8_t                          result;
+    bool                            hit = false;
+
+    if ((channel < CACHE_CHANNEL_FIRST) || (channel > CACHE_CHANNEL_LAST))
+    {
+        return nrf_802154_fal_tx_power_split(channel, power, p_split_power);
+    }
+
+    p_entry = &m_cache[channel - CACHE_CHANNEL_FIRST];
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    if (p_entry->valid && (p_entry->power == power))
+    {
+        *p_split_power = p_entry->split;
+        result         = p_entry->result;
+        hit            = true;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    if (!hit)
+    {
+        result = nrf_802154_fal_tx_power_split(channel, power, p_split_power);
+
+        nrf_802154_mcu_critical_enter(mcu_cs);
+
+        p_entry->split  = *p_split_power;
+        p_entry->power  = power;
+        p_entry->result = result;
+        p_entry->valid  = true;
+
+        nrf_802154_mcu_critical_exit(mcu_cs);
+    }
+
+    return result;
+}
+
+void nrf_802154_tx_power_split_cache_init(void)
+{
+    nrf_802154_tx_power_split_cache_clear();
+}
+
+void nrf_802154_tx_power_split_cache_clear(void)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    for (uint32_t i = 0U; i < NUMELTS(m_cache); i++)
+    {
+        m_cache[i].valid = false;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+#else
+
+static inline int8_t tx_power_split(uint8_t                                 channel,
+                                    int8_t                                  power,
+                                    nrf_802154_fal_tx_power_split_t * const p_split_power)
+{
+    return nrf_802154_fal_tx_power_split(channel, power, p_split_power);
+}
+
+void nrf_802154_tx_power_split_cache_init(void)
+{
+    // Intentionally empty
+}
+
+void nrf_802154_tx_power_split_cache_clear(void)
+{
+    // Intentionally empty
+}
+
+#endif // NRF_802154_TX_POWER_SPLIT_CACHE_ENABLED
+
 int8_t nrf_802154_tx_power_convert_metadata_to_tx_power_split(
     uint8_t                                 channel,
     nrf_802154_tx_power_metadata_t          tx_power,
@@ -44,22 +153,22 @@ int8_t nrf_802154_tx_power_convert_metadata_to_tx_power_split(
     int8_t power_unconstrained =
         tx_power.use_metadata_value ? tx_power.power : nrf_802154_pib_tx_power_get();
 
-    return nrf_802154_fal_tx_power_split(channel, power_unconstrained, p_tx_power_split);
+    return tx_power_split(channel, power_unconstrained, p_tx_power_split);
 }
 
 int8_t nrf_802154_tx_power_split_pib_power_get(
     nrf_802154_fal_tx_power_split_t * const p_split_power)
 {
-    return nrf_802154_fal_tx_power_split(nrf_802154_pib_channel_get(),
-                                         nrf_802154_pib_tx_power_get(),
-                                         p_split_power);
+    return tx_power_split(nrf_802154_pib_channel_get(),
+                          nrf_802154_pib_tx_power_get(),
+                          p_split_power);
 }
 
 int8_t nrf_802154_tx_power_split_pib_power_for_channel_get(
     uint8_t                                 channel,
     nrf_802154_fal_tx_power_split_t * const p_split_power)
 {
-    return nrf_802154_fal_tx_power_split(channel,
-                                         nrf_802154_pib_tx_power_get(),
-                                         p_split_power);
+    return tx_power_split(channel,
+                          nrf_802154_pib_tx_power_get(),
+                          p_split_power);
 }
@@ -83,4 +83,18 @@ int8_t nrf_802154_tx_power_split_pib_power_for_channel_get(
     uint8_t                                 channel,
     nrf_802154_fal_tx_power_split_t * const p_split_power);
 
+/**@brief Initialize the transmit power split cache.
+ *
+ * @note The cache is present only if @ref NRF_802154_TX_POWER_SPLIT_CACHE_ENABLED is set.
+ *       Otherwise, this function has no effect.
+ */
+void nrf_802154_tx_power_split_cache_init(void);
+
+/**@brief Invalidate the cached transmit power split for all channels.
+ *
+ * @note The cache is present only if @ref NRF_802154_TX_POWER_SPLIT_CACHE_ENABLED is set.
+ *       Otherwise, this function has no effect.
+ */
+void nrf_802154_tx_power_split_cache_clear(void);
+
 #endif // NRF_802154_TX_POWER_H__
@@ -36,41 +36,95 @@
 #include <stddef.h>
 #include <string.h>
 
+#include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 #include "nrf_802154_tx_work_buffer.h"
 
-static uint8_t   m_work_buffer[MAX_PACKET_SIZE + PHR_SIZE]; ///< Work buffer.
-static uint8_t * mp_original_frame;                         ///< Pointer to the original frame the work buffer is currently bound to.
-static uint8_t   m_plain_text_offset;                       ///< Offset of encryption plain text.
-static bool      m_is_secured;                              ///< Flag that indicates if work buffer has been successfully secured.
-static bool      m_is_dynamic_data_updated;                 ///< Flag that indicates if work buffer has had dynamic data successfully updated.
+/**
+ * @brief Work buffer together with the state of the frame it was reset for.
+ */
+typedef struct
+{
+    uint8_t         data[MAX_PACKET_SIZE + PHR_SIZE]; ///< Work buffer.
+    const uint8_t * p_frame;                          ///< Pointer to the original frame the work buffer was reset for.
+    bool            enabled;                          ///< Flag that indicates if the work buffer is bound to the original frame.
+    uint8_t         plain_text_offset;                ///< Offset of encryption plain text.
+    bool            is_secured;                       ///< Flag that indicates if work buffer has been successfully secured.
+    bool            is_dynamic_data_updated;          ///< Flag that indicates if work buffer has had dynamic data successfully updated.
+} work_buffer_t;
+
+static work_buffer_t   m_work_buffers[NRF_802154_TX_WORK_BUFFERS]; ///< Pool of work buffers.
+static work_buffer_t * mp_current = &m_work_buffers[0];            ///< Work buffer of the frame being prepared.
+static uint8_t         m_next;                                     ///< Index of the work buffer to be reused next.
 
-void nrf_802154_tx_work_buffer_reset(const nrf_802154_transmitted_frame_props_t * p_frame_props)
+/**
+ * @brief Finds the work buffer that was last reset for the given frame.
+ *
+ * @param[in]  p_frame  Pointer to the original frame.
+ *
+ * @returns  Pointer to the work buffer or NULL if there is none for @p p_frame.
+ */
+static work_buffer_t * work_buffer_find(const uint8_t * p_frame)
 {
-    mp_original_frame   = NULL;
-    m_plain_text_offset = 0;
+    if ((p_frame == NULL) || (mp_current->p_frame == p_frame))
+    {
+        return (p_frame == NULL) ? NULL : mp_current;
+    }
+
+    for (uint32_t i = 0; i < NRF_802154_TX_WORK_BUFFERS; i++)
+    {
+        if (m_work_buffers[i].p_frame == p_frame)
+        {
+            return &m_work_buffers[i];
+        }
+    }
+
+    return NULL;
+}
+
+void nrf_802154_tx_work_buffer_reset(const uint8_t                              * p_frame,
+                                     const nrf_802154_transmitted_frame_props_t * p_frame_props)
+{
+    work_buffer_t * p_buffer = work_buffer_find(p_frame);
+
+    if (p_buffer == NULL)
+    {
+        // Reuse the buffers in turns, so that the buffers of the recently prepared frames are kept.
+        p_buffer = &m_work_buffers[m_next];
+        m_next   = (m_next + 1U) % NRF_802154_TX_WORK_BUFFERS;
+    }
+
+    mp_current = p_buffer;
+
+    p_buffer->p_frame           = p_frame;
+    p_buffer->enabled           = false;
+    p_buffer->plain_text_offset = 0;
 
     if (p_frame_props == NULL)
     {
-        m_is_secured              = false;
-        m_is_dynamic_data_updated = false;
+        p_buffer->is_secured              = false;
+        p_buffer->is_dynamic_data_updated = false;
     }
     else
     {
-        m_is_secured              = p_frame_props->is_secured;
-        m_is_dynamic_data_updated = p_frame_props->dynamic_data_is_set;
+        p_buffer->is_secured              = p_frame_props->is_secured;
+        p_buffer->is_dynamic_data_updated = p_frame_props->dynamic_data_is_set;
     }
 }
 
 uint8_t * nrf_802154_tx_work_buffer_enable_for(uint8_t * p_original_frame)
 {
-    mp_original_frame = p_original_frame;
-    return m_work_buffer;
+    mp_current->p_frame = p_original_frame;
+    mp_current->enabled = true;
+
+    return mp_current->data;
 }
 
 const uint8_t * nrf_802154_tx_work_buffer_get(const uint8_t * p_original_frame)
 {
-    return mp_original_frame ? m_work_buffer : p_original_frame;
+    work_buffer_t * p_buffer = work_buffer_find(p_original_frame);
+
+    return ((p_buffer != NULL) && p_buffer->enabled) ? p_buffer->data : p_original_frame;
 }
 
 void nrf_802154_tx_work_buffer_original_frame_update(
@@ -79,27 +133,35 @@ void nrf_802154_tx_work_buffer_original_frame_update(
 {
     assert(p_frame_props != NULL);
 
-    p_frame_props->is_secured          = m_is_secured;
-    p_frame_props->dynamic_data_is_set = m_is_dynamic_data_updated;
+    work_buffer_t * p_buffer = work_buffer_find(p_original_frame);
 
-    if (mp_original_frame == NULL)
+    if (p_buffer == NULL)
     {
         return;
     }
 
-    uint8_t work_buffer_len = m_work_buffer[PHR_OFFSET] + PHR_SIZE;
+    p_frame_props->is_secured          = p_buffer->is_secured;
+    p_frame_props->dynamic_data_is_set = p_buffer->is_dynamic_data_updated;
 
-    if (m_is_dynamic_data_updated && m_is_secured)
+    if (!p_buffer->enabled)
     {
-        memcpy(p_original_frame, m_work_buffer, work_buffer_len);
+        return;
     }
-    else if (m_is_dynamic_data_updated)
+
+    uint8_t work_buffer_len   = p_buffer->data[PHR_OFFSET] + PHR_SIZE;
+    uint8_t plain_text_offset = p_buffer->plain_text_offset;
+
+    if (p_buffer->is_dynamic_data_updated && p_buffer->is_secured)
+    {
+        memcpy(p_original_frame, p_buffer->data, work_buffer_len);
+    }
+    else if (p_buffer->is_dynamic_data_updated)
     {
-        memcpy(p_original_frame, m_work_buffer, m_plain_text_offset);
+        memcpy(p_original_frame, p_buffer->data, plain_text_offset);
     }
-    else if (m_is_secured)
+    else if (p_buffer->is_secured)
     {
-        memcpy(p_original_frame, m_work_buffer, work_buffer_len - m_plain_text_offset);
+        memcpy(p_original_frame, p_buffer->data, work_buffer_len - plain_text_offset);
     }
     else
     {
@@ -107,17 +169,34 @@ void nrf_802154_tx_work_buffer_original_frame_update(
     }
 }
 
+void nrf_802154_tx_work_buffer_frame_props_get(
+    const uint8_t                        * p_original_frame,
+    nrf_802154_transmitted_frame_props_t * p_frame_props)
+{
+    assert(p_frame_props != NULL);
+
+    work_buffer_t * p_buffer = work_buffer_find(p_original_frame);
+
+    if (p_buffer == NULL)
+    {
+        p_buffer = mp_current;
+    }
+
+    p_frame_props->is_secured          = p_buffer->is_secured;
+    p_frame_props->dynamic_data_is_set = p_buffer->is_dynamic_data_updated;
+}
+
 void nrf_802154_tx_work_buffer_is_secured_set(void)
 {
-    m_is_secured = true;
+    mp_current->is_secured = true;
 }
 
 void nrf_802154_tx_work_buffer_is_dynamic_data_updated_set(void)
 {
-    m_is_dynamic_data_updated = true;
+    mp_current->is_dynamic_data_updated = true;
 }
 
 void nrf_802154_tx_work_buffer_plain_text_offset_set(uint8_t offset)
 {
-    m_plain_text_offset = offset;
+    mp_current->plain_text_offset = offset;
 }
@@ -43,6 +43,10 @@
  * By default, the using of work buffer is turned off. If desired, it can be turned on with
  * @ref nrf_802154_tx_work_buffer_enable_for.
  *
+ * The module holds a pool of @ref NRF_802154_TX_WORK_BUFFERS work buffers. Every reset takes
+ * a work buffer for the frame being prepared, and the buffer keeps the contents and properties
+ * of that frame until it is taken for another frame. Buffers are taken in turns.
+ *
  */
 
 #ifndef NRF_802154_TX_WORK_BUFFER_H_
@@ -56,17 +60,22 @@
 /**
  * @brief Resets work buffer.
  *
- * Internal state of the work buffer is completely reset after this call.
+ * A work buffer is taken for @p p_frame and its internal state is completely reset after this
+ * call. If a work buffer was already taken for @p p_frame, the same work buffer is reset.
+ * The work buffer becomes the current one, to which the setters of this module apply.
  * If @p p_frame_props is not NULL, the work buffer properties are set according to the contents
  * of the given structure.
  *
+ * @param[in]  p_frame        Pointer to the original frame to be transmitted, or NULL if it is
+ *                            not known yet.
  * @param[in]  p_frame_props  Pointer to a structure containing the initial properties that will
  *                            be set for the work buffer.
  */
-void nrf_802154_tx_work_buffer_reset(const nrf_802154_transmitted_frame_props_t * p_frame_props);
+void nrf_802154_tx_work_buffer_reset(const uint8_t                              * p_frame,
+                                     const nrf_802154_transmitted_frame_props_t * p_frame_props);
 
 /**
- * @brief Enables work buffer for provided frame.
+ * @brief Enables the current work buffer for provided frame.
  *
  * In order to avoid performing potentially hazardous operations on the original buffer containing
  * data to be transmitted, a work buffer can be allocated to the original frame. After all necessary
@@ -98,6 +107,7 @@ const uint8_t * nrf_802154_tx_work_buffer_get(const uint8_t * p_original_frame);
  *
  * Processing performed on the work buffer might require copying its contents back to the original
  * buffer. This function performs all necessary updates of the original buffer in place.
+ * If no work buffer holds @p p_original_frame anymore, @p p_frame_props is left unchanged.
  *
  * @param[inout]    p_original_frame    Pointer to the original frame to be transmitted.
  * @param[out]      p_frame_props       Pointer to a structure to which properties of the frame
@@ -108,17 +118,32 @@ void nrf_802154_tx_work_buffer_original_frame_update(
     nrf_802154_transmitted_frame_props_t * p_frame_props);
 
 /**
- * @brief Marks a work buffer as secured.
+ * @brief Gets properties of a frame prepared in a work buffer.
+ *
+ * The properties reflect the processing already applied to the frame: after
+ * @ref nrf_802154_tx_work_buffer_original_frame_update is called, they describe the contents
+ * of the original buffer. If no work buffer holds @p p_original_frame anymore, the properties of
+ * the current work buffer are returned.
+ *
+ * @param[in]   p_original_frame  Pointer to the original frame.
+ * @param[out]  p_frame_props     Pointer to a structure to which the frame properties are stored.
+ */
+void nrf_802154_tx_work_buffer_frame_props_get(
+    const uint8_t                        * p_original_frame,
+    nrf_802154_transmitted_frame_props_t * p_frame_props);
+
+/**
+ * @brief Marks the current work buffer as secured.
  */
 void nrf_802154_tx_work_buffer_is_secured_set(void);
 
 /**
- * @brief Marks a work buffer as containing updated dynamic data.
+ * @brief Marks the current work buffer as containing updated dynamic data.
  */
 void nrf_802154_tx_work_buffer_is_dynamic_data_updated_set(void);
 
 /**
- * @brief Sets offset of encryption plain text for the work buffer.
+ * @brief Sets offset of encryption plain text for the current work buffer.
  *
  * @param[in]  offset  Offset of encryption plain text to be set.
  */
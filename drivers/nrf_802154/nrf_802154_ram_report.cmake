@@ -0,0 +1,132 @@
+#
+# Copyright (c) 2023, Nordic Semiconductor ASA
+# All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+#
+# 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+#    contributors may be used to endorse or promote products derived from this
+#    software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+#
+
+# Prints static RAM used by symbols of archives, objects or ELF files.
+#
+# Symbols placed in data and zero-initialized data sections are listed per object file, sorted
+# by size, together with the total of each object file and the grand total. As control blocks
+# and buffers of drivers are sized by the configuration, the report shows the RAM cost
+# of the configured instance counts, pool sizes and buffer sizes.
+#
+# Usage:
+#   cmake -DNM=<nm executable> -DFILES=<file>[;<file>...] -P nrf_802154_ram_report.cmake
+
+if (NOT NM OR NOT FILES)
+  message(FATAL_ERROR
+    "Usage: cmake -DNM=<nm> -DFILES=<file>[;<file>...] -P ${CMAKE_CURRENT_LIST_FILE}")
+endif ()
+
+set(grand_total 0)
+
+foreach (file IN LISTS FILES)
+  if (NOT EXISTS "${file}")
+    message(WARNING "${file} does not exist, skipped")
+    continue()
+  endif ()
+
+  execute_process(
+    COMMAND ${NM} --print-size --radix=d --size-sort "${file}"
+    OUTPUT_VARIABLE nm_output
+    RESULT_VARIABLE nm_result
+    ERROR_QUIET
+  )
+
+  if (NOT nm_result EQUAL 0)
+    message(WARNING "${NM} failed for ${file}, skipped")
+    continue()
+  endif ()
+
+  get_filename_component(file_name "${file}" NAME)
+
+  # Object files of an archive are introduced by lines "<object>:", an ELF file has no such lines.
+  set(object "${file_name}")
+  set(objects "")
+  string(REPLACE "\n" ";" nm_lines "${nm_output}")
+
+  foreach (line IN LISTS nm_lines)
+    if (line MATCHES "^(.+):$")
+      set(object "${CMAKE_MATCH_1}")
+    elseif (line MATCHES "^[0-9]+ ([0-9]+) [bBdDC] (.+)$")
+      math(EXPR size "${CMAKE_MATCH_1}")
+      set(symbol "${CMAKE_MATCH_2}")
+
+      if (NOT DEFINED total_${object})
+        set(total_${object} 0)
+        set(symbols_${object} "")
+        list(APPEND objects "${object}")
+      endif ()
+
+      math(EXPR total_${object} "${total_${object}} + ${size}")
+      string(LENGTH "${size}" size_len)
+      math(EXPR pad_len "10 - ${size_len}")
+      string(REPEAT "0" ${pad_len} pad)
+      list(APPEND symbols_${object} "${pad}${size} ${symbol}")
+    endif ()
+  endforeach ()
+
+  message("${file_name}")
+
+  # Sort objects by their total, the largest first.
+  set(sorted_objects "")
+  foreach (object IN LISTS objects)
+    string(LENGTH "${total_${object}}" total_len)
+    math(EXPR pad_len "10 - ${total_len}")
+    string(REPEAT "0" ${pad_len} pad)
+    list(APPEND sorted_objects "${pad}${total_${object}} ${object}")
+  endforeach ()
+  list(SORT sorted_objects ORDER DESCENDING)
+
+  set(file_total 0)
+  foreach (entry IN LISTS sorted_objects)
+    string(REGEX REPLACE "^[0-9]+ " "" object "${entry}")
+    math(EXPR file_total "${file_total} + ${total_${object}}")
+    message("  ${object}: ${total_${object}} bytes")
+
+    set(symbols "${symbols_${object}}")
+    list(SORT symbols ORDER DESCENDING)
+    foreach (symbol_entry IN LISTS symbols)
+      string(REGEX MATCH "^([0-9]+) (.+)$" _ "${symbol_entry}")
+      math(EXPR size "${CMAKE_MATCH_1}")
+      message("    ${CMAKE_MATCH_2}: ${size}")
+    endforeach ()
+
+    unset(total_${object})
+    unset(symbols_${object})
+  endforeach ()
+
+  message("  Total: ${file_total} bytes")
+  math(EXPR grand_total "${grand_total} + ${file_total}")
+endforeach ()
+
+message("Total static RAM: ${grand_total} bytes")
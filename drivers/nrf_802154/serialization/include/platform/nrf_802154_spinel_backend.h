@@ -44,6 +44,7 @@
 
 #include <stddef.h>
 
+#include "nrf_802154_serialization_config.h"
 #include "nrf_802154_serialization_error.h"
 #include "nrf_802154_spinel_backend_callouts.h"
 
@@ -63,6 +64,99 @@ extern "C" {
 nrf_802154_ser_err_t nrf_802154_spinel_encoded_packet_send(const void * p_data,
                                                            size_t       data_len);
 
+#if NRF_802154_SER_BACKEND_NOCOPY_TX_ENABLED || defined(DOXYGEN)
+
+/**
+ * @brief Reserves a transmit buffer of the spinel backend.
+ *
+ * The reserved buffer must be passed either to @ref nrf_802154_spinel_encoded_packet_buffer_commit
+ * or to @ref nrf_802154_spinel_encoded_packet_buffer_discard.
+ *
+ * @note This function must not block. It may be called from a critical section.
+ *
+ * @param[out] p_buffer_size  Size of the reserved buffer.
+ *
+ * @returns  Pointer to the reserved buffer or NULL if no buffer is available.
+ *
+ */
+void * nrf_802154_spinel_encoded_packet_buffer_reserve(size_t * p_buffer_size);
+
+/**
+ * @brief Sends a spinel frame placed in a buffer reserved from spinel backend.
+ *
+ * The ownership of the buffer is passed back to the backend, regardless of the result.
+ *
+ * @param[in]  p_buffer  Pointer to a buffer returned by
+ *                       @ref nrf_802154_spinel_encoded_packet_buffer_reserve that contains
+ *                       spinel encoded frame.
+ * @param[in]  data_len  Size of the frame in the @ref p_buffer buffer.
+ *
+ * @returns  number of bytes sent or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_encoded_packet_buffer_commit(void * p_buffer,
+                                                                    size_t data_len);
+
+/**
+ * @brief Returns a buffer reserved from spinel backend without sending it.
+ *
+ * @param[in]  p_buffer  Pointer to a buffer returned by
+ *                       @ref nrf_802154_spinel_encoded_packet_buffer_reserve.
+ *
+ */
+void nrf_802154_spinel_encoded_packet_buffer_discard(void * p_buffer);
+
+#endif // NRF_802154_SER_BACKEND_NOCOPY_TX_ENABLED
+
+#if NRF_802154_SER_IRQ_MODERATION_ENABLED || defined(DOXYGEN)
+
+/**
+ * @brief Places a spinel frame in spinel backend without signaling the peer.
+ *
+ * The frame is to be delivered to the peer after @ref nrf_802154_spinel_peer_signal is called.
+ *
+ * @param[in]  p_data    Pointer to a buffer that contains spinel encoded frame.
+ * @param[in]  data_len  Size of the @ref p_data buffer.
+ *
+ * @returns  number of bytes queued or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_encoded_packet_enqueue(const void * p_data,
+                                                              size_t       data_len);
+
+#if NRF_802154_SER_BACKEND_NOCOPY_TX_ENABLED || defined(DOXYGEN)
+
+/**
+ * @brief Places a spinel frame in a buffer reserved from spinel backend without signaling the
+ *        peer.
+ *
+ * The ownership of the buffer is passed back to the backend, regardless of the result.
+ *
+ * @param[in]  p_buffer  Pointer to a buffer returned by
+ *                       @ref nrf_802154_spinel_encoded_packet_buffer_reserve that contains
+ *                       spinel encoded frame.
+ * @param[in]  data_len  Size of the frame in the @ref p_buffer buffer.
+ *
+ * @returns  number of bytes queued or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_encoded_packet_buffer_enqueue(void * p_buffer,
+                                                                     size_t data_len);
+
+#endif // NRF_802154_SER_BACKEND_NOCOPY_TX_ENABLED || defined(DOXYGEN)
+
+/**
+ * @brief Signals the peer that spinel frames placed in spinel backend are available.
+ *
+ * A single signal covers all frames queued before it.
+ *
+ * @note This function must not block.
+ *
+ */
+void nrf_802154_spinel_peer_signal(void);
+
+#endif // NRF_802154_SER_IRQ_MODERATION_ENABLED || defined(DOXYGEN)
+
 /**
  * @brief Initializes spinel backend.
  *
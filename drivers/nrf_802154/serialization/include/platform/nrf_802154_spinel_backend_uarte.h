@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @defgroup nrf_802154_spinel_serialization_backend_uarte
+ * 802.15.4 radio driver spinel serialization UARTE backend platform
+ * @{
+ *
+ */
+
+#ifndef NRF_802154_SPINEL_BACKEND_UARTE_H_
+#define NRF_802154_SPINEL_BACKEND_UARTE_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Starts the periodic timer that polls for data received by the UARTE spinel backend.
+ *
+ * Every time the timer expires, the platform must call
+ * @ref nrf_802154_spinel_backend_uarte_poll. The timer must not expire in a priority higher
+ * than @ref NRF_802154_SER_BACKEND_UARTE_IRQ_PRIORITY.
+ *
+ * @note This function must be implemented by the platform when
+ *       @ref NRF_802154_SER_BACKEND_UARTE_ENABLED is set.
+ *
+ * @param[in]  period_us  Period of the timer in microseconds.
+ */
+void nrf_802154_spinel_backend_uarte_poll_timer_start(uint32_t period_us);
+
+/**
+ * @brief Notifies that the timer started with
+ *        @ref nrf_802154_spinel_backend_uarte_poll_timer_start expired.
+ *
+ * Decodes the data received since the last poll.
+ */
+extern void nrf_802154_spinel_backend_uarte_poll(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_802154_SPINEL_BACKEND_UARTE_H_ */
+
+/** @} */
@@ -45,11 +45,27 @@
 #include <stdint.h>
 #include <stddef.h>
 
+#include "nrf_802154_serialization_config.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-#ifdef CONFIG_NRF_802154_SER_LOG
+/** @brief Maximum number of arguments following the format string of a deferred log call. */
+#define NRF_802154_SPINEL_LOG_DEFERRED_MAX_ARGS 4
+
+/** @brief Counts the arguments that follow the format string, up to 4. */
+#define NRF_802154_SPINEL_LOG_ARGC(...) NRF_802154_SPINEL_LOG_ARGC_(__VA_ARGS__, 4, 3, 2, 1, 0, 0)
+#define NRF_802154_SPINEL_LOG_ARGC_(p_fmt, a1, a2, a3, a4, argc, ...) argc
+
+#if defined(CONFIG_NRF_802154_SER_LOG) && NRF_802154_SER_LOG_DEFERRED_ENABLED
+
+#define NRF_802154_SPINEL_LOG_RAW(...) \
+    nrf_802154_spinel_log_deferred(NRF_802154_SPINEL_LOG_ARGC(__VA_ARGS__), __VA_ARGS__)
+#define NRF_802154_SPINEL_BUFF_LOG_RAW(p_buff, buff_len) \
+    nrf_802154_spinel_buff_log_deferred(p_buff, buff_len)
+
+#elif defined(CONFIG_NRF_802154_SER_LOG)
 
 #define NRF_802154_SPINEL_LOG_RAW(...)                   nrf_802154_spinel_log(__VA_ARGS__)
 #define NRF_802154_SPINEL_BUFF_LOG_RAW(p_buff, buff_len) nrf_802154_spinel_buff_log(p_buff, \
@@ -116,6 +132,42 @@ void nrf_802154_spinel_log(const char * p_fmt, ...);
  */
 void nrf_802154_spinel_buff_log(const uint8_t * p_buff, size_t buff_len);
 
+#if NRF_802154_SER_LOG_DEFERRED_ENABLED || defined(DOXYGEN)
+
+/**
+ * @brief Stores a log message in the ring buffer of deferred logging without formatting it.
+ *
+ * @param[in]  argc   Number of arguments following @p p_fmt, up to
+ *                    @ref NRF_802154_SPINEL_LOG_DEFERRED_MAX_ARGS.
+ * @param[in]  p_fmt  Pointer to a format string. The string must outlive the log entry.
+ * @param[in]  ...    Arguments of at most 32 bits each, to be formatted according to @p p_fmt.
+ *
+ */
+void nrf_802154_spinel_log_deferred(uint32_t argc, const char * p_fmt, ...);
+
+/**
+ * @brief Stores a copy of the buffer in the ring buffer of deferred logging.
+ *
+ * The buffer is truncated to @ref NRF_802154_SER_LOG_DEFERRED_BUFF_MAX_SIZE bytes.
+ *
+ * @param[in]  p_buff    Pointer to a buffer to be logged.
+ * @param[in]  buff_len  Size of the @p p_buff buffer.
+ *
+ */
+void nrf_802154_spinel_buff_log_deferred(const uint8_t * p_buff, size_t buff_len);
+
+/**
+ * @brief Formats the log entries stored by deferred logging.
+ *
+ * The entries are formatted with @ref nrf_802154_spinel_log and @ref nrf_802154_spinel_buff_log
+ * in the order in which they were stored. The platform is expected to call this function from
+ * a low priority context, for example from an idle thread.
+ *
+ */
+void nrf_802154_spinel_log_deferred_process(void);
+
+#endif // NRF_802154_SER_LOG_DEFERRED_ENABLED || defined(DOXYGEN)
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @defgroup nrf_802154_spinel_serialization_moderation_timer
+ * 802.15.4 radio driver spinel serialization interrupt moderation timer
+ * @{
+ *
+ */
+
+#ifndef NRF_802154_SPINEL_MODERATION_TIMER_H_
+#define NRF_802154_SPINEL_MODERATION_TIMER_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Starts the one-shot timer that bounds the delay of signaling queued spinel frames.
+ *
+ * When the timer expires, the platform must call @ref nrf_802154_spinel_moderation_timer_expired.
+ * If the timer is already running, it is restarted.
+ *
+ * @note This function must be implemented by the platform when
+ *       @ref NRF_802154_SER_IRQ_MODERATION_ENABLED is set.
+ *
+ * @param[in]  timeout_us  Time in microseconds after which the timer expires.
+ */
+void nrf_802154_spinel_moderation_timer_start(uint32_t timeout_us);
+
+/**
+ * @brief Stops the timer started with @ref nrf_802154_spinel_moderation_timer_start.
+ *
+ * Calling this function when the timer is not running has no effect.
+ *
+ * @note This function must be implemented by the platform when
+ *       @ref NRF_802154_SER_IRQ_MODERATION_ENABLED is set.
+ */
+void nrf_802154_spinel_moderation_timer_stop(void);
+
+/**
+ * @brief Notifies that the timer started with @ref nrf_802154_spinel_moderation_timer_start
+ *        expired.
+ *
+ * Signals the peer about all queued spinel frames.
+ */
+extern void nrf_802154_spinel_moderation_timer_expired(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_802154_SPINEL_MODERATION_TIMER_H_ */
+
+/** @} */
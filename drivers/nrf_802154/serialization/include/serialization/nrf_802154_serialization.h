@@ -42,6 +42,13 @@
 #ifndef NRF_802154_SERIALIZATION_H_
 #define NRF_802154_SERIALIZATION_H_
 
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_const.h"
+#include "nrf_802154_serialization_config.h"
+#include "nrf_802154_serialization_error.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -52,6 +59,349 @@ extern "C" {
  */
 void nrf_802154_serialization_init(void);
 
+#if NRF_802154_SER_SHM_TX_POOL_ENABLED || defined(DOXYGEN)
+
+/**
+ * @brief Allocates a frame buffer from the shared-memory TX pool.
+ *
+ * A frame placed in the buffer is passed to the network core without copying when it is
+ * transmitted with any of the nrf_802154_transmit_*_raw functions. The buffer remains owned by
+ * the caller after the transmission completes.
+ *
+ * @note This function is available on the application core only.
+ *
+ * @return Pointer to the allocated buffer or NULL if the pool is exhausted.
+ */
+uint8_t * nrf_802154_serialization_tx_buffer_alloc(void);
+
+/**
+ * @brief Returns a frame buffer to the shared-memory TX pool.
+ *
+ * The buffer must not be freed while a transmission of the frame it contains is in progress.
+ *
+ * @note This function is available on the application core only.
+ *
+ * @param[in]  p_buffer  Buffer allocated with @ref nrf_802154_serialization_tx_buffer_alloc.
+ */
+void nrf_802154_serialization_tx_buffer_free(uint8_t * p_buffer);
+
+#endif // NRF_802154_SER_SHM_TX_POOL_ENABLED || defined(DOXYGEN)
+
+#if NRF_802154_SER_ASYNC_ENABLED || defined(DOXYGEN)
+
+/**
+ * @brief Token identifying an asynchronous request.
+ */
+typedef uint32_t nrf_802154_ser_async_token_t;
+
+/**
+ * @brief Value returned instead of a token when an asynchronous request could not be issued.
+ */
+#define NRF_802154_SER_ASYNC_TOKEN_INVALID 0U
+
+/**
+ * @brief Callback reporting completion of an asynchronous request.
+ *
+ * The callback is called from the context that processes data received from the network core.
+ * It is allowed to issue new asynchronous requests.
+ *
+ * @param[in]  token      Token returned when the request was issued.
+ * @param[in]  result     @ref NRF_802154_SERIALIZATION_ERROR_OK if the request succeeded or
+ *                        @ref NRF_802154_SERIALIZATION_ERROR_RESPONSE_INVALID if the network
+ *                        core rejected it.
+ * @param[in]  p_context  Context passed when the request was issued.
+ */
+typedef void (* nrf_802154_ser_async_callback_t)(nrf_802154_ser_async_token_t token,
+                                                 nrf_802154_ser_err_t         result,
+                                                 void                       * p_context);
+
+/**
+ * @brief Requests a channel change without waiting for the network core to respond.
+ *
+ * @note This function is available on the application core only.
+ *
+ * @param[in]  channel    Channel to be set. See @ref nrf_802154_channel_set.
+ * @param[in]  callback   Callback called when the request completes. Can be NULL.
+ * @param[in]  p_context  Context passed to @p callback.
+ *
+ * @return Token identifying the request or @ref NRF_802154_SER_ASYNC_TOKEN_INVALID if
+ *         @ref NRF_802154_SER_ASYNC_MAX_PENDING requests are already pending or the request
+ *         could not be sent.
+ */
+nrf_802154_ser_async_token_t nrf_802154_serialization_channel_set_async(
+    uint8_t                         channel,
+    nrf_802154_ser_async_callback_t callback,
+    void                          * p_context);
+
+/**
+ * @brief Requests a transmit power change without waiting for the network core to respond.
+ *
+ * @note This function is available on the application core only.
+ *
+ * @param[in]  power      Transmit power to be set. See @ref nrf_802154_tx_power_set.
+ * @param[in]  callback   Callback called when the request completes. Can be NULL.
+ * @param[in]  p_context  Context passed to @p callback.
+ *
+ * @return Token identifying the request or @ref NRF_802154_SER_ASYNC_TOKEN_INVALID on failure.
+ */
+nrf_802154_ser_async_token_t nrf_802154_serialization_tx_power_set_async(
+    int8_t                          power,
+    nrf_802154_ser_async_callback_t callback,
+    void                          * p_context);
+
+/**
+ * @brief Requests a PAN ID change without waiting for the network core to respond.
+ *
+ * @note This function is available on the application core only.
+ *
+ * @param[in]  p_pan_id   Pointer to the PAN ID to be set. See @ref nrf_802154_pan_id_set.
+ *                        The data is copied before the function returns.
+ * @param[in]  callback   Callback called when the request completes. Can be NULL.
+ * @param[in]  p_context  Context passed to @p callback.
+ *
+ * @return Token identifying the request or @ref NRF_802154_SER_ASYNC_TOKEN_INVALID on failure.
+ */
+nrf_802154_ser_async_token_t nrf_802154_serialization_pan_id_set_async(
+    const uint8_t                 * p_pan_id,
+    nrf_802154_ser_async_callback_t callback,
+    void                          * p_context);
+
+/**
+ * @brief Requests a short address change without waiting for the network core to respond.
+ *
+ * @note This function is available on the application core only.
+ *
+ * @param[in]  p_short_address  Pointer to the short address to be set.
+ *                              See @ref nrf_802154_short_address_set. The data is copied before
+ *                              the function returns.
+ * @param[in]  callback         Callback called when the request completes. Can be NULL.
+ * @param[in]  p_context        Context passed to @p callback.
+ *
+ * @return Token identifying the request or @ref NRF_802154_SER_ASYNC_TOKEN_INVALID on failure.
+ */
+nrf_802154_ser_async_token_t nrf_802154_serialization_short_address_set_async(
+    const uint8_t                 * p_short_address,
+    nrf_802154_ser_async_callback_t callback,
+    void                          * p_context);
+
+/**
+ * @brief Requests an extended address change without waiting for the network core to respond.
+ *
+ * @note This function is available on the application core only.
+ *
+ * @param[in]  p_extended_address  Pointer to the extended address to be set.
+ *                                 See @ref nrf_802154_extended_address_set. The data is copied
+ *                                 before the function returns.
+ * @param[in]  callback            Callback called when the request completes. Can be NULL.
+ * @param[in]  p_context           Context passed to @p callback.
+ *
+ * @return Token identifying the request or @ref NRF_802154_SER_ASYNC_TOKEN_INVALID on failure.
+ */
+nrf_802154_ser_async_token_t nrf_802154_serialization_extended_address_set_async(
+    const uint8_t                 * p_extended_address,
+    nrf_802154_ser_async_callback_t callback,
+    void                          * p_context);
+
+#endif // NRF_802154_SER_ASYNC_ENABLED || defined(DOXYGEN)
+
+#if NRF_802154_SER_LATENCY_STATS_ENABLED || defined(DOXYGEN)
+
+/**
+ * @brief Serialized calls whose latencies are measured.
+ */
+typedef enum
+{
+    /** Application core: @ref nrf_802154_transmit_raw, from the call until the response. */
+    NRF_802154_SER_LATENCY_TRANSMIT_RAW,
+    /** Application core: @ref nrf_802154_receive, from the call until the response. */
+    NRF_802154_SER_LATENCY_RECEIVE,
+    /** Application core: @ref nrf_802154_channel_set, from the call until the response. */
+    NRF_802154_SER_LATENCY_CHANNEL_SET,
+    /** Application core: decoding of a received frame notification until its callout. */
+    NRF_802154_SER_LATENCY_RECEIVED_RAW_DECODE,
+    /** Network core: serialization and sending of a received frame notification. */
+    NRF_802154_SER_LATENCY_RECEIVED_RAW_ENCODE,
+    /** Network core: handling of a request, from its reception until its decoder returns. */
+    NRF_802154_SER_LATENCY_REQUEST_HANDLE,
+    /** Number of measured calls. */
+    NRF_802154_SER_LATENCY_COUNT,
+} nrf_802154_ser_latency_id_t;
+
+/**
+ * @brief Number of bins of the histogram in @ref nrf_802154_ser_latency_stats_t.
+ */
+#define NRF_802154_SER_LATENCY_BINS 32U
+
+/**
+ * @brief Latencies of a serialized call.
+ *
+ * All values are expressed in units of @ref NRF_802154_SER_LATENCY_STATS_TIME_GET, which are
+ * CPU cycles by default. Bin 0 of the histogram counts samples equal to 0 and bin n counts
+ * samples in range [ 2^(n-1) .. 2^n - 1 ].
+ */
+typedef struct
+{
+    uint32_t count;                             ///< Number of measured calls.
+    uint32_t min;                               ///< Shortest measured latency.
+    uint32_t max;                               ///< Longest measured latency.
+    uint64_t total;                             ///< Sum of all measured latencies.
+    uint32_t bins[NRF_802154_SER_LATENCY_BINS]; ///< Histogram of the measured latencies.
+} nrf_802154_ser_latency_stats_t;
+
+/**
+ * @brief Gets the latencies measured for a serialized call.
+ *
+ * Only the calls measured on the core that calls this function are reported.
+ *
+ * @param[in]   id       Identifier of the call.
+ * @param[out]  p_stats  Structure that will be filled with the measured latencies.
+ */
+void nrf_802154_serialization_latency_stats_get(nrf_802154_ser_latency_id_t      id,
+                                                nrf_802154_ser_latency_stats_t * p_stats);
+
+/**
+ * @brief Resets the latencies measured for all serialized calls.
+ */
+void nrf_802154_serialization_latency_stats_reset(void);
+
+/**
+ * @brief Estimates a percentile of the measured latencies.
+ *
+ * The estimate is the upper bound of the histogram bin containing the percentile,
+ * limited to the longest measured latency.
+ *
+ * @param[in]  p_stats     Latencies retrieved with @ref nrf_802154_serialization_latency_stats_get.
+ * @param[in]  percentile  Requested percentile, from 0 to 100.
+ *
+ * @return Estimated percentile or 0 if no latency was measured.
+ */
+uint32_t nrf_802154_serialization_latency_percentile_get(
+    const nrf_802154_ser_latency_stats_t * p_stats,
+    uint8_t                                percentile);
+
+#endif // NRF_802154_SER_LATENCY_STATS_ENABLED || defined(DOXYGEN)
+
+#if NRF_802154_SER_RX_FILTER_ENABLED || defined(DOXYGEN)
+
+#define NRF_802154_SER_RX_FILTER_FIELD_FRAME_TYPE 0x01U ///< Match the Frame Type field.
+#define NRF_802154_SER_RX_FILTER_FIELD_DST_PAN_ID 0x02U ///< Match the Destination PAN ID field.
+#define NRF_802154_SER_RX_FILTER_FIELD_DST_ADDR   0x04U ///< Match the Destination Address field.
+#define NRF_802154_SER_RX_FILTER_FIELD_CMD_ID     0x08U ///< Match the Command ID of a MAC command frame.
+
+/**
+ * @brief Action taken on a received frame that matches a filter rule.
+ */
+typedef enum
+{
+    NRF_802154_SER_RX_FILTER_ACTION_PASS, ///< Notify the frame to the application core.
+    NRF_802154_SER_RX_FILTER_ACTION_DROP, ///< Free the frame on the network core.
+} nrf_802154_ser_rx_filter_action_t;
+
+/**
+ * @brief Rule of the received frames filter.
+ *
+ * A frame matches the rule if all fields selected by @c fields match. A rule with no fields
+ * selected matches every frame. A field that is not present in the frame or that cannot be
+ * located, like the Command ID of a secured frame or of a frame with Information Elements,
+ * does not match.
+ */
+typedef struct
+{
+    uint8_t                           fields;                               ///< Bitmask of NRF_802154_SER_RX_FILTER_FIELD_* values.
+    nrf_802154_ser_rx_filter_action_t action;                               ///< Action taken on a matching frame.
+    uint8_t                           frame_type;                           ///< Frame type as encoded in the Frame Control field, for example @ref FRAME_TYPE_DATA.
+    uint8_t                           cmd_id;                               ///< Command ID, for example @ref MAC_CMD_DATA_REQ.
+    uint8_t                           dst_pan_id[PAN_ID_SIZE];              ///< Destination PAN ID, in little-endian byte order.
+    uint8_t                           dst_addr[EXTENDED_ADDRESS_SIZE];      ///< Destination address, in little-endian byte order.
+    bool                              dst_addr_extended;                    ///< If @c dst_addr holds an extended address.
+} nrf_802154_ser_rx_filter_rule_t;
+
+/**
+ * @brief Adds a rule to the received frames filter of the network core.
+ *
+ * Each received frame is checked against the rules in the order in which they were added.
+ * The action of the first matching rule is taken. Frames that match no rule are notified
+ * to the application core. Dropped frames are freed by the network core, so they cost neither
+ * IPC bandwidth nor an application core wake-up.
+ *
+ * @note This function is available on the application core only.
+ *
+ * @param[in]  p_rule  Rule to be added. The data is copied before the function returns.
+ *
+ * @retval true   The rule was added.
+ * @retval false  @ref NRF_802154_SER_RX_FILTER_RULES rules are already added.
+ */
+bool nrf_802154_serialization_rx_filter_rule_add(const nrf_802154_ser_rx_filter_rule_t * p_rule);
+
+/**
+ * @brief Removes all rules of the received frames filter of the network core.
+ *
+ * @note This function is available on the application core only.
+ */
+void nrf_802154_serialization_rx_filter_clear(void);
+
+#endif // NRF_802154_SER_RX_FILTER_ENABLED || defined(DOXYGEN)
+
+#if NRF_802154_SER_LAZY_FREE_ENABLED || defined(DOXYGEN)
+
+/**
+ * @brief Returns all buffers freed lazily with @ref nrf_802154_buffer_free_raw to the network core.
+ *
+ * The function does not wait for the network core to process the request. It does nothing when
+ * no freed buffers are withheld.
+ *
+ * @note This function is available on the application core only.
+ */
+void nrf_802154_serialization_buffer_free_flush(void);
+
+#endif // NRF_802154_SER_LAZY_FREE_ENABLED || defined(DOXYGEN)
+
+#if NRF_802154_SER_TIME_SYNC_ENABLED || defined(DOXYGEN)
+
+/**
+ * @brief Synchronizes the radio time to the local time immediately.
+ *
+ * The function performs a spinel round trip regardless of the age of the current estimate.
+ *
+ * @note This function is available on the application core only.
+ *
+ * @retval true   The estimate was updated.
+ * @retval false  The round trip took longer than @ref NRF_802154_SER_TIME_SYNC_MAX_RTT_US.
+ */
+bool nrf_802154_serialization_time_sync(void);
+
+/**
+ * @brief Converts a radio time to the local time of the application core.
+ *
+ * @note This function is available on the application core only.
+ *
+ * @param[in]  radio_time    Time of the radio driver, for example a timestamp of a received frame.
+ * @param[out] p_local_time  Corresponding local time.
+ *
+ * @retval true   The time was converted.
+ * @retval false  The time is not synchronized or the estimate is older than
+ *                @ref NRF_802154_SER_TIME_SYNC_PERIOD_US.
+ */
+bool nrf_802154_serialization_time_to_local(uint64_t radio_time, uint64_t * p_local_time);
+
+/**
+ * @brief Converts a local time of the application core to the radio time.
+ *
+ * The result can be used to schedule operations like @ref nrf_802154_transmit_raw_at.
+ *
+ * @note This function is available on the application core only.
+ *
+ * @param[in]  local_time    Local time.
+ * @param[out] p_radio_time  Corresponding time of the radio driver.
+ *
+ * @retval true   The time was converted.
+ * @retval false  The time is not synchronized or the estimate is older than
+ *                @ref NRF_802154_SER_TIME_SYNC_PERIOD_US.
+ */
+bool nrf_802154_serialization_time_from_local(uint64_t local_time, uint64_t * p_radio_time);
+
+#endif // NRF_802154_SER_TIME_SYNC_ENABLED || defined(DOXYGEN)
+
 #ifdef __cplusplus
 }
 #endif
@@ -42,6 +42,16 @@
 #define NRF_802154_RX_BUFFERS 16
 #endif
 
+/**
+ * @brief Number of short buffers of the radio driver used to store 802.15.4 received frames.
+ *
+ * Each of them holds a received frame that can be passed to the application core, so the value
+ * must be the same on both cores.
+ */
+#ifndef NRF_802154_RX_BUFFERS_SHORT
+#define NRF_802154_RX_BUFFERS_SHORT 0
+#endif
+
 /**
  * @brief Number of serialization buffers used to store 802.15.4 transmission frames.
  */
@@ -49,4 +59,493 @@
 #define NRF_802154_TX_BUFFERS 4
 #endif
 
+/**
+ * @brief Enables coalescing of notifications sent by the network core.
+ *
+ * When enabled, notifications about received frames, finished transmissions and finished
+ * energy detections are not sent immediately. They are accumulated and sent together in a single
+ * spinel frame when the accumulated data reaches @ref NRF_802154_SER_COALESCING_BUFFER_SIZE,
+ * when the oldest of them has waited for @ref NRF_802154_SER_COALESCING_MAX_DELAY_US or before
+ * any other spinel frame is sent. This reduces the number of frames the application core needs
+ * to process at the cost of added notification latency.
+ *
+ * The option affects the network core only. The application core always accepts coalesced
+ * notifications. The network core platform must implement the functions declared in
+ * nrf_802154_spinel_coalescing_timer.h.
+ */
+#ifndef NRF_802154_SER_COALESCING_ENABLED
+#define NRF_802154_SER_COALESCING_ENABLED 0
+#endif
+
+/**
+ * @brief Maximum size in bytes of the coalesced notifications sent in a single spinel frame.
+ *
+ * The value must not exceed the size of frames that the spinel backend is able to transfer.
+ */
+#ifndef NRF_802154_SER_COALESCING_BUFFER_SIZE
+#define NRF_802154_SER_COALESCING_BUFFER_SIZE 1024
+#endif
+
+/**
+ * @brief Maximum time in microseconds a coalesced notification can be delayed.
+ */
+#ifndef NRF_802154_SER_COALESCING_MAX_DELAY_US
+#define NRF_802154_SER_COALESCING_MAX_DELAY_US 1000
+#endif
+
+/**
+ * @brief Enables the hashed variant of the key-value map.
+ *
+ * When enabled, items of an @ref nrf_802154_kvmap_t are stored in an open-addressing hash table
+ * instead of a linear array, which makes the cost of a lookup independent of the map capacity.
+ * The table occupies about twice as much memory.
+ */
+#ifndef NRF_802154_SER_KVMAP_HASH_ENABLED
+#define NRF_802154_SER_KVMAP_HASH_ENABLED 0
+#endif
+
+/**
+ * @brief Enables the shared-memory RX ring.
+ *
+ * When enabled, the network core copies each received frame directly into a slot of a memory
+ * region shared with the application core and only a short descriptor of the frame is sent
+ * through spinel. The application core returns the slot by calling
+ * @ref nrf_802154_buffer_free_raw, which does not require a spinel round trip.
+ *
+ * When no slot is available, the frame is serialized in the regular way.
+ *
+ * Both cores must be built with the same configuration of the ring.
+ */
+#ifndef NRF_802154_SER_SHM_RX_RING_ENABLED
+#define NRF_802154_SER_SHM_RX_RING_ENABLED 0
+#endif
+
+/**
+ * @brief Number of slots in the shared-memory RX ring.
+ *
+ * The value must not exceed 255.
+ */
+#ifndef NRF_802154_SER_SHM_RX_RING_SLOTS
+#define NRF_802154_SER_SHM_RX_RING_SLOTS NRF_802154_RX_BUFFERS
+#endif
+
+/**
+ * @brief Address of the memory region used by the shared-memory RX ring.
+ *
+ * The region must be accessible by both cores, must not be cached and must be at least
+ * @ref NRF_802154_SHM_RX_RING_MEMORY_SIZE bytes long. This option has no default value and must
+ * be provided by the platform when @ref NRF_802154_SER_SHM_RX_RING_ENABLED is set.
+ */
+#if defined(DOXYGEN)
+#define NRF_802154_SER_SHM_RX_RING_ADDRESS
+#endif
+
+/**
+ * @brief Enables the shared-memory TX pool.
+ *
+ * When enabled, the application core can allocate frame buffers from a memory region shared
+ * with the network core using @ref nrf_802154_serialization_tx_buffer_alloc. Frames placed in
+ * such buffers are passed to the network core by reference only, both when a transmission is
+ * requested and when its result is notified. Frames placed in other buffers are serialized
+ * in the regular way.
+ *
+ * Both cores must be built with the same configuration of the pool.
+ */
+#ifndef NRF_802154_SER_SHM_TX_POOL_ENABLED
+#define NRF_802154_SER_SHM_TX_POOL_ENABLED 0
+#endif
+
+/**
+ * @brief Number of buffers in the shared-memory TX pool.
+ */
+#ifndef NRF_802154_SER_SHM_TX_POOL_BUFFERS
+#define NRF_802154_SER_SHM_TX_POOL_BUFFERS NRF_802154_TX_BUFFERS
+#endif
+
+/**
+ * @brief Address of the memory region used by the shared-memory TX pool.
+ *
+ * The region must be visible at the same address to both cores, must not be cached and must be
+ * at least @ref NRF_802154_SHM_TX_POOL_MEMORY_SIZE bytes long. This option has no default value
+ * and must be provided by the platform when @ref NRF_802154_SER_SHM_TX_POOL_ENABLED is set.
+ */
+#if defined(DOXYGEN)
+#define NRF_802154_SER_SHM_TX_POOL_ADDRESS
+#endif
+
+/**
+ * @brief Enables asynchronous requests.
+ *
+ * When enabled, the application core provides nrf_802154_serialization_*_async functions that
+ * send a request to the network core and return immediately. The result of the request is
+ * reported through a callback when the network core responds, so several requests can be in
+ * flight at the same time.
+ */
+#ifndef NRF_802154_SER_ASYNC_ENABLED
+#define NRF_802154_SER_ASYNC_ENABLED 0
+#endif
+
+/**
+ * @brief Maximum number of asynchronous requests awaiting a response at the same time.
+ *
+ * Every pending request is identified by a spinel transaction identifier, so the value must be
+ * within 1 and 15.
+ */
+#ifndef NRF_802154_SER_ASYNC_MAX_PENDING
+#define NRF_802154_SER_ASYNC_MAX_PENDING 8
+#endif
+
+/**
+ * @brief Enables serializing spinel frames directly into transmit buffers of the backend.
+ *
+ * When enabled, the backend must provide @ref nrf_802154_spinel_encoded_packet_buffer_reserve,
+ * @ref nrf_802154_spinel_encoded_packet_buffer_commit and
+ * @ref nrf_802154_spinel_encoded_packet_buffer_discard. Spinel frames are then serialized
+ * directly into a buffer reserved from the backend, for example an RPMsg no-copy transmit
+ * buffer, which saves copying the frame. When the backend has no buffer available, the frame
+ * is serialized locally and sent with @ref nrf_802154_spinel_encoded_packet_send.
+ */
+#ifndef NRF_802154_SER_BACKEND_NOCOPY_TX_ENABLED
+#define NRF_802154_SER_BACKEND_NOCOPY_TX_ENABLED 0
+#endif
+
+/**
+ * @brief Enables measurement of latencies of serialized calls.
+ *
+ * When enabled, each core measures the duration of representative serialized calls and
+ * notifications and collects them in histograms that can be read with
+ * @ref nrf_802154_serialization_latency_stats_get. The measurements are meant for evaluation of
+ * the serialization performance and add a small overhead to every measured call.
+ */
+#ifndef NRF_802154_SER_LATENCY_STATS_ENABLED
+#define NRF_802154_SER_LATENCY_STATS_ENABLED 0
+#endif
+
+/**
+ * @brief Expression providing the current time used to measure latencies of serialized calls.
+ *
+ * By default the cycle counter of the DWT unit is used, which is enabled when the serialization
+ * is initialized.
+ */
+#ifndef NRF_802154_SER_LATENCY_STATS_TIME_GET
+#define NRF_802154_SER_LATENCY_STATS_TIME_GET() (DWT->CYCCNT)
+#endif
+
+/**
+ * @brief Enables the compact encoding of received frame notifications.
+ *
+ * When enabled, the application core requests the compact encoding during initialization.
+ * If the network core supports it, received frames are notified with the handle and
+ * the timestamp encoded as differences from the previously notified frame, and without
+ * the framing of the regular notification.
+ *
+ * The option may differ between the cores. The regular encoding is used if either core
+ * does not support the compact one.
+ */
+#ifndef NRF_802154_SER_COMPACT_RX_ENABLED
+#define NRF_802154_SER_COMPACT_RX_ENABLED 0
+#endif
+
+/**
+ * @brief Enables the received frames filter of the network core.
+ *
+ * When enabled, the application core can program rules with
+ * @ref nrf_802154_serialization_rx_filter_rule_add. Received frames are checked against
+ * the rules on the network core before they are serialized.
+ *
+ * Both cores must be built with the same configuration of the filter.
+ */
+#ifndef NRF_802154_SER_RX_FILTER_ENABLED
+#define NRF_802154_SER_RX_FILTER_ENABLED 0
+#endif
+
+/**
+ * @brief Maximum number of rules of the received frames filter.
+ */
+#ifndef NRF_802154_SER_RX_FILTER_RULES
+#define NRF_802154_SER_RX_FILTER_RULES 8
+#endif
+
+/**
+ * @brief Enables lazy returning of freed receive buffers to the network core.
+ *
+ * When enabled, @ref nrf_802154_buffer_free_raw called on the application core does not send
+ * a request to the network core for every buffer. Handles of freed buffers are accumulated and
+ * returned together in a single request, without waiting for a response, when
+ * @ref NRF_802154_SER_LAZY_FREE_BATCH_SIZE handles are accumulated, before any other request is
+ * sent to the network core or when @ref nrf_802154_serialization_buffer_free_flush is called.
+ * The application core platform can call the latter from a timer to bound the time the buffers
+ * are withheld.
+ *
+ * Both cores must be built with the same configuration of lazy freeing.
+ */
+#ifndef NRF_802154_SER_LAZY_FREE_ENABLED
+#define NRF_802154_SER_LAZY_FREE_ENABLED 0
+#endif
+
+/**
+ * @brief Number of freed buffer handles returned to the network core in a single request.
+ */
+#ifndef NRF_802154_SER_LAZY_FREE_BATCH_SIZE
+#define NRF_802154_SER_LAZY_FREE_BATCH_SIZE 4
+#endif
+
+/**
+ * @brief Number of receive buffers of the network core that lazy freeing never withholds.
+ *
+ * At most @ref NRF_802154_SER_LAZY_FREE_BATCH_SIZE - 1 freed buffers are withheld at a time,
+ * so the sum of both values must not exceed @ref NRF_802154_RX_BUFFERS. The remaining buffers
+ * stay available for reception regardless of how the freed handles are batched.
+ */
+#ifndef NRF_802154_SER_LAZY_FREE_RESERVE
+#define NRF_802154_SER_LAZY_FREE_RESERVE 4
+#endif
+
+/**
+ * @brief Enables moderation of interrupts signaled to the peer core.
+ *
+ * When enabled, spinel frames are placed in the backend with
+ * @ref nrf_802154_spinel_encoded_packet_enqueue and the peer is signaled with
+ * @ref nrf_802154_spinel_peer_signal once for multiple frames. Requests and responses signal
+ * the peer immediately, together with all frames queued before them. Notifications signal the
+ * peer when @ref NRF_802154_SER_IRQ_MODERATION_MAX_PACKETS frames are queued or when the oldest
+ * of them has waited for @ref NRF_802154_SER_IRQ_MODERATION_MAX_DELAY_US.
+ *
+ * The platform of each core must implement the functions declared in
+ * nrf_802154_spinel_moderation_timer.h.
+ */
+#ifndef NRF_802154_SER_IRQ_MODERATION_ENABLED
+#define NRF_802154_SER_IRQ_MODERATION_ENABLED 0
+#endif
+
+/**
+ * @brief Number of queued spinel frames that triggers signaling of the peer core.
+ */
+#ifndef NRF_802154_SER_IRQ_MODERATION_MAX_PACKETS
+#define NRF_802154_SER_IRQ_MODERATION_MAX_PACKETS 8
+#endif
+
+/**
+ * @brief Maximum time in microseconds signaling of a queued spinel frame can be delayed.
+ */
+#ifndef NRF_802154_SER_IRQ_MODERATION_MAX_DELAY_US
+#define NRF_802154_SER_IRQ_MODERATION_MAX_DELAY_US 250
+#endif
+
+/**
+ * @brief Enables synchronization of the radio time to the local time of the application core.
+ *
+ * When enabled, the application core estimates the offset and the drift between its local time,
+ * provided by the platform with @ref nrf_802154_spinel_local_time_get, and the time of the radio
+ * driver. Each call to @ref nrf_802154_time_get that is served by the network core provides
+ * a synchronization sample. While the estimate is younger than
+ * @ref NRF_802154_SER_TIME_SYNC_PERIOD_US, @ref nrf_802154_time_get is served locally without
+ * a spinel round trip, and timestamps can be converted between both time bases with
+ * @ref nrf_802154_serialization_time_to_local and @ref nrf_802154_serialization_time_from_local.
+ *
+ * The option affects the application core only.
+ */
+#ifndef NRF_802154_SER_TIME_SYNC_ENABLED
+#define NRF_802154_SER_TIME_SYNC_ENABLED 0
+#endif
+
+/**
+ * @brief Time in microseconds after which the time synchronization estimate is refreshed.
+ */
+#ifndef NRF_802154_SER_TIME_SYNC_PERIOD_US
+#define NRF_802154_SER_TIME_SYNC_PERIOD_US 1000000
+#endif
+
+/**
+ * @brief Maximum round trip time in microseconds of a time synchronization sample.
+ *
+ * The synchronization error of a sample is bounded by half of its round trip time, so samples
+ * delayed longer are not used for the estimate.
+ */
+#ifndef NRF_802154_SER_TIME_SYNC_MAX_RTT_US
+#define NRF_802154_SER_TIME_SYNC_MAX_RTT_US 200
+#endif
+
+
+/**
+ * @brief Enables size-class pools for buffers of the destination buffer manager.
+ *
+ * When enabled, copies of frames received from the peer core are allocated from pools of
+ * ACK-sized, short and full-size buffers instead of a pool of full-size buffers only. A frame is
+ * placed in the smallest buffer it fits in, so short frames such as ACKs and MAC commands do not
+ * occupy a full-size buffer. On the application core, on top of @ref NRF_802154_RX_BUFFERS
+ * full-size buffers, @ref NRF_802154_SER_BUFFER_SLAB_ACK_BUFFERS ACK-sized buffers and
+ * @ref NRF_802154_SER_BUFFER_SLAB_SHORT_BUFFERS short buffers are available.
+ */
+#ifndef NRF_802154_SER_BUFFER_SLAB_ENABLED
+#define NRF_802154_SER_BUFFER_SLAB_ENABLED 0
+#endif
+
+/**
+ * @brief Number of ACK-sized buffers of the destination buffer manager.
+ */
+#ifndef NRF_802154_SER_BUFFER_SLAB_ACK_BUFFERS
+#define NRF_802154_SER_BUFFER_SLAB_ACK_BUFFERS 4
+#endif
+
+/**
+ * @brief Number of short buffers of the destination buffer manager.
+ */
+#ifndef NRF_802154_SER_BUFFER_SLAB_SHORT_BUFFERS
+#define NRF_802154_SER_BUFFER_SLAB_SHORT_BUFFERS 2
+#endif
+
+/**
+ * @brief Enables deferred binary logging of the spinel serialization.
+ *
+ * When enabled together with @c CONFIG_NRF_802154_SER_LOG, log calls of the serialization do not
+ * format messages in place. They store the address of the format string and the raw arguments
+ * in a ring buffer of @ref NRF_802154_SER_LOG_DEFERRED_BUFFER_LEN words, which takes a few
+ * instructions only. The messages are formatted later, when the platform calls
+ * @ref nrf_802154_spinel_log_deferred_process from a low priority context, or they can be
+ * extracted from the ring buffer and formatted by an external tool using the firmware image.
+ *
+ * Format strings and string arguments must be stored in memory that outlives the log entry and
+ * at most @ref NRF_802154_SPINEL_LOG_DEFERRED_MAX_ARGS arguments of at most 32 bits each can be
+ * passed to a single log call. Log entries that do not fit in the ring buffer are dropped and
+ * counted.
+ */
+#ifndef NRF_802154_SER_LOG_DEFERRED_ENABLED
+#define NRF_802154_SER_LOG_DEFERRED_ENABLED 0
+#endif
+
+/**
+ * @brief Number of 32-bit words of the ring buffer of deferred logging.
+ *
+ * The value must be a power of two.
+ */
+#ifndef NRF_802154_SER_LOG_DEFERRED_BUFFER_LEN
+#define NRF_802154_SER_LOG_DEFERRED_BUFFER_LEN 256
+#endif
+
+/**
+ * @brief Maximum number of bytes of a buffer stored by a single deferred buffer log call.
+ *
+ * Longer buffers are truncated. The value must be a multiple of 4.
+ */
+#ifndef NRF_802154_SER_LOG_DEFERRED_BUFF_MAX_SIZE
+#define NRF_802154_SER_LOG_DEFERRED_BUFF_MAX_SIZE 16
+#endif
+
+/**
+ * @brief Enables the spinel backend transporting spinel frames over UARTE.
+ *
+ * The backend connects the serialization to a spinel host on another chip, for example when
+ * the radio SoC works as an external radio coprocessor. Spinel frames are delimited and
+ * escaped with HDLC-lite framing. Reception runs continuously into a ring of DMA buffers and
+ * transmission sends batches of frames with a single DMA transfer, so there is no interrupt
+ * per byte in either direction.
+ *
+ * The platform must implement the functions of nrf_802154_spinel_backend_uarte.h. When enabled,
+ * @ref NRF_802154_SER_BACKEND_NOCOPY_TX_ENABLED must be disabled and nrfx must be configured
+ * with the selected UARTE instance and with @c NRFX_UARTE_CONFIG_RX_RING_ENABLED.
+ */
+#ifndef NRF_802154_SER_BACKEND_UARTE_ENABLED
+#define NRF_802154_SER_BACKEND_UARTE_ENABLED 0
+#endif
+
+/**
+ * @brief Index of the UARTE instance used by the UARTE spinel backend.
+ */
+#ifndef NRF_802154_SER_BACKEND_UARTE_INSTANCE
+#define NRF_802154_SER_BACKEND_UARTE_INSTANCE 0
+#endif
+
+/**
+ * @brief TXD pin of the UARTE spinel backend.
+ */
+#ifndef NRF_802154_SER_BACKEND_UARTE_TX_PIN
+#define NRF_802154_SER_BACKEND_UARTE_TX_PIN NRF_UARTE_PSEL_DISCONNECTED
+#endif
+
+/**
+ * @brief RXD pin of the UARTE spinel backend.
+ */
+#ifndef NRF_802154_SER_BACKEND_UARTE_RX_PIN
+#define NRF_802154_SER_BACKEND_UARTE_RX_PIN NRF_UARTE_PSEL_DISCONNECTED
+#endif
+
+/**
+ * @brief RTS pin of the UARTE spinel backend.
+ *
+ * Hardware flow control is enabled when both RTS and CTS pins are connected. It is recommended
+ * at high baud rates, as reception is lost when the ring of receive buffers overflows.
+ */
+#ifndef NRF_802154_SER_BACKEND_UARTE_RTS_PIN
+#define NRF_802154_SER_BACKEND_UARTE_RTS_PIN NRF_UARTE_PSEL_DISCONNECTED
+#endif
+
+/**
+ * @brief CTS pin of the UARTE spinel backend.
+ */
+#ifndef NRF_802154_SER_BACKEND_UARTE_CTS_PIN
+#define NRF_802154_SER_BACKEND_UARTE_CTS_PIN NRF_UARTE_PSEL_DISCONNECTED
+#endif
+
+/**
+ * @brief Baud rate of the UARTE spinel backend, as one of the @c nrf_uarte_baudrate_t values.
+ */
+#ifndef NRF_802154_SER_BACKEND_UARTE_BAUDRATE
+#define NRF_802154_SER_BACKEND_UARTE_BAUDRATE NRF_UARTE_BAUDRATE_1000000
+#endif
+
+/**
+ * @brief Interrupt priority of the UARTE spinel backend.
+ *
+ * Received spinel frames are decoded and passed to the serialization in this priority.
+ */
+#ifndef NRF_802154_SER_BACKEND_UARTE_IRQ_PRIORITY
+#define NRF_802154_SER_BACKEND_UARTE_IRQ_PRIORITY NRFX_UARTE_DEFAULT_CONFIG_IRQ_PRIORITY
+#endif
+
+/**
+ * @brief TIMER instance counting bytes received by the UARTE spinel backend.
+ */
+#ifndef NRF_802154_SER_BACKEND_UARTE_RX_TIMER
+#define NRF_802154_SER_BACKEND_UARTE_RX_TIMER NRF_TIMER3
+#endif
+
+/**
+ * @brief Size in bytes of a single receive buffer of the UARTE spinel backend.
+ */
+#ifndef NRF_802154_SER_BACKEND_UARTE_RX_BUFFER_SIZE
+#define NRF_802154_SER_BACKEND_UARTE_RX_BUFFER_SIZE 256
+#endif
+
+/**
+ * @brief Number of receive buffers in the ring of the UARTE spinel backend.
+ *
+ * Received data must be decoded before the reception wraps around the ring, that is within
+ * the time of receiving all buffers but one.
+ */
+#ifndef NRF_802154_SER_BACKEND_UARTE_RX_BUFFER_COUNT
+#define NRF_802154_SER_BACKEND_UARTE_RX_BUFFER_COUNT 4
+#endif
+
+/**
+ * @brief Size in bytes of each of the two transmit buffers of the UARTE spinel backend.
+ *
+ * Frames are encoded into one buffer while the other one is being transmitted. A frame that
+ * does not fit in the free space of the buffer is rejected, so the size must be at least
+ * the maximum encoded size of a single spinel frame.
+ */
+#ifndef NRF_802154_SER_BACKEND_UARTE_TX_BUFFER_SIZE
+#define NRF_802154_SER_BACKEND_UARTE_TX_BUFFER_SIZE 1024
+#endif
+
+/**
+ * @brief Period in microseconds of polling for data received by the UARTE spinel backend.
+ *
+ * Data that does not fill a receive buffer is decoded when polled, so the period bounds
+ * the latency of receiving a short spinel frame.
+ */
+#ifndef NRF_802154_SER_BACKEND_UARTE_POLL_PERIOD_US
+#define NRF_802154_SER_BACKEND_UARTE_POLL_PERIOD_US 500
+#endif
+
 #endif // NRF_802154_SER_CONFIG_H__
@@ -119,6 +119,20 @@ void * nrf_802154_buffer_allocator_alloc(const nrf_802154_buffer_allocator_t * p
  */
 void nrf_802154_buffer_allocator_free(const nrf_802154_buffer_allocator_t * p_obj, void * p_buffer);
 
+/**
+ * @brief Gets the index of a buffer within the pool of a buffer allocator.
+ *
+ * @param[in]  p_obj     Pointer to a buffer allocator to check.
+ * @param[in]  p_buffer  Pointer to a buffer returned by @ref nrf_802154_buffer_allocator_alloc.
+ * @param[out] p_idx     Index of the buffer within the pool.
+ *
+ * @retval true   @p p_buffer points to a buffer of the pool.
+ * @retval false  @p p_buffer does not belong to the pool.
+ */
+bool nrf_802154_buffer_allocator_index_get(const nrf_802154_buffer_allocator_t * p_obj,
+                                           const void                          * p_buffer,
+                                           size_t                              * p_idx);
+
 /**
  * @brief Gets total number of buffers a buffer allocator can store.
  *
@@ -58,28 +58,77 @@
 #include <stdbool.h>
 #include <stdint.h>
 
-#include "nrf_802154_kvmap.h"
 #include "nrf_802154_buffer_allocator.h"
+#include "nrf_802154_buffer_slab.h"
+#include "nrf_802154_serialization_config.h"
 
-/**@brief Type of a buffer manager for destination peer of serialization. */
+#if NRF_802154_SER_BUFFER_SLAB_ENABLED
+
+/**@brief Type of an allocator providing storage for local buffers. */
+typedef nrf_802154_buffer_slab_t nrf_802154_buffer_mgr_dst_allocator_t;
+
+/**@brief Calculates the number of local buffers of a buffer manager.
+ *
+ * @param buffers_count  Number of full-size buffers of the buffer manager.
+ */
+#define NRF_802154_BUFFER_MGR_DST_SLOTS_COUNT(buffers_count) \
+    (NRF_802154_SER_BUFFER_SLAB_ACK_BUFFERS +                \
+     NRF_802154_SER_BUFFER_SLAB_SHORT_BUFFERS +              \
+     (buffers_count))
+
+/**@brief Calculates byte size of memory required to store local buffers of a buffer manager.
+ *
+ * @param buffers_count  Number of full-size buffers of the buffer manager.
+ */
+#define NRF_802154_BUFFER_MGR_DST_MEMORY_SIZE(buffers_count) \
+    NRF_802154_BUFFER_SLAB_MEMORY_SIZE(                      \
+        NRF_802154_SER_BUFFER_SLAB_ACK_BUFFERS,              \
+        NRF_802154_SER_BUFFER_SLAB_SHORT_BUFFERS,            \
+        (buffers_count))
+
+#else // NRF_802154_SER_BUFFER_SLAB_ENABLED
+
+/**@brief Type of an allocator providing storage for local buffers. */
+typedef nrf_802154_buffer_allocator_t nrf_802154_buffer_mgr_dst_allocator_t;
+
+/**@brief Calculates the number of local buffers of a buffer manager.
+ *
+ * @param buffers_count  Number of buffers of the buffer manager.
+ */
+#define NRF_802154_BUFFER_MGR_DST_SLOTS_COUNT(buffers_count) (buffers_count)
+
+/**@brief Calculates byte size of memory required to store local buffers of a buffer manager.
+ *
+ * @param buffers_count  Number of buffers of the buffer manager.
+ */
+#define NRF_802154_BUFFER_MGR_DST_MEMORY_SIZE(buffers_count) \
+    NRF_802154_BUFFER_ALLOCATOR_MEMORY_SIZE(buffers_count)
+
+#endif // NRF_802154_SER_BUFFER_SLAB_ENABLED
+
+/**@brief Slot of a destination peer buffer manager, associated with a local buffer. */
 typedef struct
 {
-    /**@brief Map for matching local pointers to remote buffer handle.
-     *
-     * Key is a local pointer (@c void*)
-     * Value is a remote buffer handle (@c uint32_t)
-     */
-    nrf_802154_kvmap_t            map;
+    /**@brief Remote buffer handle the local buffer has been received with. */
+    uint32_t      buffer_handle;
 
-    /**@brief Allocator providing storage for local buffers. */
-    nrf_802154_buffer_allocator_t allocator;
-} nrf_802154_buffer_mgr_dst_t;
+    /**@brief Flag indicating if the local buffer is associated with @c buffer_handle. */
+    volatile bool valid;
+} nrf_802154_buffer_mgr_dst_slot_t;
 
-/**@brief Calculates number of bytes needed to store map.
- * @param buffers_count     Number of buffers to be tracked.
+/**@brief Type of a buffer manager for destination peer of serialization.
+ *
+ * Every buffer of the allocator has its own slot, so a local pointer is mapped to the slot
+ * by its index within the allocator pool.
  */
-#define NRF_802154_BUFFER_MGR_DST_MAP_MEMSIZE(buffers_count) \
-    NRF_802154_KVMAP_MEMORY_SIZE((buffers_count), sizeof(void *), sizeof(uint32_t))
+typedef struct
+{
+    /**@brief Slots holding remote buffer handles, indexed like buffers of @c allocator. */
+    nrf_802154_buffer_mgr_dst_slot_t    * p_slots;
+
+    /**@brief Allocator providing storage for local buffers. */
+    nrf_802154_buffer_mgr_dst_allocator_t allocator;
+} nrf_802154_buffer_mgr_dst_t;
 
 /**@brief Defines instance of @ref rf_802154_buffer_mgr_dst_t with all necessary accompanying
  *        variables.
@@ -99,11 +148,10 @@ typedef struct
  */
 #define NRF_802154_BUFFER_MGR_DST_INST_DECL(name, buffers_count) \
     nrf_802154_buffer_mgr_dst_t name;                            \
-    uint8_t name ## _map_mem[                                    \
-        NRF_802154_BUFFER_MGR_DST_MAP_MEMSIZE(buffers_count)]    \
-    __attribute__((aligned(4)));                                 \
+    nrf_802154_buffer_mgr_dst_slot_t name ## _slots[             \
+        NRF_802154_BUFFER_MGR_DST_SLOTS_COUNT(buffers_count)];   \
     uint8_t name ## _allocator_mem[                              \
-        NRF_802154_BUFFER_ALLOCATOR_MEMORY_SIZE(buffers_count)]  \
+        NRF_802154_BUFFER_MGR_DST_MEMORY_SIZE(buffers_count)]    \
     __attribute__((aligned(4)));                                 \
     const size_t name ## _buffers_count = (buffers_count);
 
@@ -117,11 +165,10 @@ typedef struct
 /**@brief As @ref NRF_802154_BUFFER_MGR_DST_INST_DECL but with static storage. */
 #define NRF_802154_BUFFER_MGR_DST_INST_DECL_STATIC(name, buffers_count) \
     static nrf_802154_buffer_mgr_dst_t name;                            \
-    static uint8_t name ## _map_mem[                                    \
-        NRF_802154_BUFFER_MGR_DST_MAP_MEMSIZE(buffers_count)]           \
-    __attribute__((aligned(4)));                                        \
+    static nrf_802154_buffer_mgr_dst_slot_t name ## _slots[             \
+        NRF_802154_BUFFER_MGR_DST_SLOTS_COUNT(buffers_count)];          \
     static uint8_t name ## _allocator_mem[                              \
-        NRF_802154_BUFFER_ALLOCATOR_MEMORY_SIZE(buffers_count)]         \
+        NRF_802154_BUFFER_MGR_DST_MEMORY_SIZE(buffers_count)]           \
     __attribute__((aligned(4)));                                        \
     static const size_t name ## _buffers_count = (buffers_count);
 
@@ -133,26 +180,26 @@ typedef struct
 #define NRF_802154_BUFFER_MGR_DST_INIT(name) \
     nrf_802154_buffer_mgr_dst_init(          \
         &name,                               \
-        name ## _map_mem,                    \
+        name ## _slots,                      \
         name ## _allocator_mem,              \
         name ## _buffers_count)
 
 /**@brief Initializes a buffer manager.
  *
  * @param[out] p_obj         Pointer to an object instance to initialize
- * @param[in]  p_map_memory  Pointer to a memory buffer of size equal to
- *                           @ref NRF_802154_BUFFER_MGR_DST_MAP_MEMSIZE(@c buffers_count)
+ * @param[in]  p_slots       Pointer to an array of
+ *                           @ref NRF_802154_BUFFER_MGR_DST_SLOTS_COUNT(@c buffers_count) slots
  * @param[in]  p_allocator_memory Pointer to a memory buffer of size equal to
- *                           @ref NRF_802154_BUFFER_ALLOCATOR_MEMORY_SIZE(@c buffers_count)
+ *                           @ref NRF_802154_BUFFER_MGR_DST_MEMORY_SIZE(@c buffers_count)
  * @param[in]  buffers_count Number of buffers the object @p p_obj will be able to track
  *
  * @sa @ref NRF_802154_BUFFER_MGR_DST_INSTANCE_DECL, @ref NRF_802154_BUFFER_DST_MGR_INIT
  */
 void nrf_802154_buffer_mgr_dst_init(
-    nrf_802154_buffer_mgr_dst_t * p_obj,
-    void                        * p_map_memory,
-    void                        * p_allocator_memory,
-    size_t                        buffers_count);
+    nrf_802154_buffer_mgr_dst_t      * p_obj,
+    nrf_802154_buffer_mgr_dst_slot_t * p_slots,
+    void                             * p_allocator_memory,
+    size_t                             buffers_count);
 
 /**@brief Adds a remote buffer handle to a buffer manager obtaining a local pointer.
  *
@@ -57,22 +57,45 @@
 #define NRF_802154_BUFFER_MGR_SRC_H__
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
-#include "nrf_802154_kvmap.h"
+/**@brief Maximum number of buffers a source peer buffer manager can track. */
+#define NRF_802154_BUFFER_MGR_SRC_BUFFERS_MAX 256U
 
-/**@brief Type of a buffer manager object for a source peer. */
+/**@brief Slot of a source peer buffer manager. */
 typedef struct
 {
-    /**@brief Map for holding source peer local buffer pointers. */
-    nrf_802154_kvmap_t map;
-} nrf_802154_buffer_mgr_src_t;
+    /**@brief Tracked buffer or NULL if the slot is free. */
+    const void * p_buffer;
+
+    /**@brief Handle of the tracked buffer. */
+    uint32_t     buffer_handle;
+
+    /**@brief Index of the next free slot, valid only if the slot is free. */
+    uint16_t     next_free;
+} nrf_802154_buffer_mgr_src_slot_t;
 
-/**@brief Calculates number of bytes needed to store map.
- * @param buffers_count     Number of buffers to be tracked.
+/**@brief Type of a buffer manager object for a source peer.
+ *
+ * A buffer handle encodes the index of the slot the buffer is tracked in and a sequence number
+ * assigned when the buffer was added. A handle can therefore be mapped to its slot directly and
+ * a stale handle of a buffer that was removed does not match the current handle of the slot.
  */
-#define NRF_802154_BUFFER_MGR_SRC_MAP_MEMSIZE(buffers_count) \
-    NRF_802154_KVMAP_MEMORY_SIZE((buffers_count), sizeof(uint32_t), 0U)
+typedef struct
+{
+    /**@brief Slots holding source peer local buffer pointers. */
+    nrf_802154_buffer_mgr_src_slot_t * p_slots;
+
+    /**@brief Number of slots. */
+    uint16_t                           slots_count;
+
+    /**@brief Index of the first free slot. */
+    uint16_t                           free_head;
+
+    /**@brief Sequence number of the most recently added buffer. */
+    uint32_t                           sequence;
+} nrf_802154_buffer_mgr_src_t;
 
 /**@brief Defines instance of @ref nrf_802154_buffer_mgr_src_t with all necessary accompanying
  *        variables.
@@ -91,11 +114,9 @@ typedef struct
  * @param name          Identifier of an object of type @ref nrf_802154_buffer_mgr_src_t
  * @param buffers_count Number of buffers the @c name object will be able to track.
  */
-#define NRF_802154_BUFFER_MGR_SRC_INST_DECL(name, buffers_count) \
-    nrf_802154_buffer_mgr_src_t name;                            \
-    uint8_t name ## _map_mem[                                    \
-        NRF_802154_BUFFER_MGR_SRC_MAP_MEMSIZE(buffers_count)]    \
-    __attribute__((aligned(4)));                                 \
+#define NRF_802154_BUFFER_MGR_SRC_INST_DECL(name, buffers_count)    \
+    nrf_802154_buffer_mgr_src_t name;                               \
+    nrf_802154_buffer_mgr_src_slot_t name ## _slots[buffers_count]; \
     const size_t name ## _buffers_count = (buffers_count);
 
 /**@brief Provides extern complementary to @ref NRF_802154_BUFFER_MGR_SRC_INST_DECL.
@@ -106,11 +127,9 @@ typedef struct
     extern nrf_802154_buffer_mgr_src_t name
 
 /**@brief @ref NRF_802154_BUFFER_MGR_SRC_INST_DECL but with static storage */
-#define NRF_802154_BUFFER_MGR_SRC_INST_DECL_STATIC(name, buffers_count) \
-    static nrf_802154_buffer_mgr_src_t name;                            \
-    static uint8_t name ## _map_mem[                                    \
-        NRF_802154_BUFFER_MGR_SRC_MAP_MEMSIZE(buffers_count)]           \
-    __attribute__((aligned(4)));                                        \
+#define NRF_802154_BUFFER_MGR_SRC_INST_DECL_STATIC(name, buffers_count)    \
+    static nrf_802154_buffer_mgr_src_t name;                               \
+    static nrf_802154_buffer_mgr_src_slot_t name ## _slots[buffers_count]; \
     static const size_t name ## _buffers_count = (buffers_count);
 
 /**@brief Calls @ref nrf_802154_buffer_mgr_src_init for an object instantiated by
@@ -121,22 +140,22 @@ typedef struct
 #define NRF_802154_BUFFER_MGR_SRC_INIT(name) \
     nrf_802154_buffer_mgr_src_init(          \
         &name,                               \
-        name ## _map_mem,                    \
+        name ## _slots,                      \
         name ## _buffers_count)
 
 /**@brief Initializes a source peer buffer manager.
  *
  * @param[out] p_obj         Pointer to an object instance to initialize
- * @param[in]  p_map_memory  Pointer to a memory buffer of size equal to
- *                           @ref NRF_802154_BUFFER_MGR_SRC_MAP_MEMSIZE(@c buffers_count)
- * @param[in]  buffers_count Number of buffers the object @p p_obj will be able to track
+ * @param[in]  p_slots       Pointer to an array of @c buffers_count slots
+ * @param[in]  buffers_count Number of buffers the object @p p_obj will be able to track.
+ *                           Must not exceed @ref NRF_802154_BUFFER_MGR_SRC_BUFFERS_MAX.
  *
  * @sa @ref NRF_802154_BUFFER_MGR_SRC_INSTANCE_DECL, @ref NRF_802154_BUFFER_MGR_SRC_INIT
  */
 void nrf_802154_buffer_mgr_src_init(
-    nrf_802154_buffer_mgr_src_t * p_obj,
-    void                        * p_map_memory,
-    size_t                        buffers_count);
+    nrf_802154_buffer_mgr_src_t      * p_obj,
+    nrf_802154_buffer_mgr_src_slot_t * p_slots,
+    size_t                             buffers_count);
 
 /**@brief Adds a local memory buffer pointer to a buffer manager.
  *
@@ -161,7 +180,7 @@ bool nrf_802154_buffer_mgr_src_add(
  *
  * @retval true     Given @p buffer_handle has been found. The pointer to an associated buffer
  *                  is available behind @p pp_buffer
- * @retval false    Given @p buffer_handle has not been found.
+ * @retval false    Given @p buffer_handle has not been found or is stale.
  */
 bool nrf_802154_buffer_mgr_src_search_by_buffer_handle(
     nrf_802154_buffer_mgr_src_t * p_obj,
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file nrf_802154_buffer_slab.h
+ * @brief Size-class buffer allocation for 802.15.4 receptions and transmissions.
+ *
+ * Buffers are grouped in pools of ACK-sized, short and full-size buffers. Each pool keeps
+ * its free buffers on a lock-free list, so that allocation and freeing do not need a critical
+ * section.
+ */
+
+#ifndef NRF_802154_BUFFER_SLAB_H__
+#define NRF_802154_BUFFER_SLAB_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "nrf_802154_buffer_allocator.h"
+
+/** @brief Length of a buffer of the pool for ACK frames. */
+#define NRF_802154_BUFFER_SLAB_ACK_BUFFER_LEN   32
+
+/** @brief Length of a buffer of the pool for short frames, for example MAC commands. */
+#define NRF_802154_BUFFER_SLAB_SHORT_BUFFER_LEN 64
+
+/** @brief Length of a buffer of the pool for frames of any length. */
+#define NRF_802154_BUFFER_SLAB_FULL_BUFFER_LEN  NRF_802154_BUFFER_ALLOCATOR_DEFAULT_BUFFER_LEN
+
+/** @brief Number of pools of a slab allocator. */
+#define NRF_802154_BUFFER_SLAB_POOLS            3
+
+/** @brief Maximum number of buffers in a single pool of a slab allocator. */
+#define NRF_802154_BUFFER_SLAB_POOL_CAPACITY    (UINT8_MAX - 1)
+
+/**@brief Calculates byte size of memory required to store buffers of a slab allocator.
+ *
+ * Example:
+ * @code
+ * static uint8_t m_memory[NRF_802154_BUFFER_SLAB_MEMORY_SIZE(4, 2, 10)]
+ * __attribute__((aligned(4)));
+ * static nrf_802154_buffer_slab_t m_slab;
+ *
+ * nrf_802154_buffer_slab_init(&m_slab, m_memory, 4, 2, 10);
+ * @endcode
+ */
+#define NRF_802154_BUFFER_SLAB_MEMORY_SIZE(ack_count, short_count, full_count) \
+    (((ack_count) * (NRF_802154_BUFFER_SLAB_ACK_BUFFER_LEN + 1)) +            \
+     ((short_count) * (NRF_802154_BUFFER_SLAB_SHORT_BUFFER_LEN + 1)) +        \
+     ((full_count) * (NRF_802154_BUFFER_SLAB_FULL_BUFFER_LEN + 1)))
+
+/** @brief Structure representing a pool of buffers of the same length. */
+typedef struct
+{
+    /** @brief Pointer to a memory used to store buffers of the pool. */
+    uint8_t        * p_buffers;
+    /** @brief Pointer to list links, holding for each free buffer the index of the next one. */
+    uint8_t        * p_links;
+    /** @brief Length of each buffer of the pool. */
+    uint16_t         buffer_len;
+    /** @brief Index of the pool first buffer among all buffers of the slab allocator. */
+    uint16_t         first_idx;
+    /** @brief Number of buffers of the pool. */
+    uint8_t          capacity;
+    /** @brief Index of the first free buffer of the pool. */
+    volatile uint8_t head;
+} nrf_802154_buffer_slab_pool_t;
+
+/** @brief Structure representing a slab allocator. */
+typedef struct
+{
+    /** @brief Pools of buffers, ordered by increasing buffer length. */
+    nrf_802154_buffer_slab_pool_t pools[NRF_802154_BUFFER_SLAB_POOLS];
+    /** @brief Total number of buffers of all pools. */
+    size_t                        capacity;
+} nrf_802154_buffer_slab_t;
+
+/**
+ * @brief Initializes a slab allocator instance.
+ *
+ * @param[out] p_obj        Pointer to an object to initialize. The pointed object should persist
+ *                          as long as the slab allocator is in use. Cannot be NULL.
+ * @param[in]  p_memory     Pointer to a 4-byte aligned memory of size equal to
+ *                          @ref NRF_802154_BUFFER_SLAB_MEMORY_SIZE(@p ack_count, @p short_count,
+ *                          @p full_count). Memory pointed by this pointer should persist as long
+ *                          as the slab allocator pointed by @p p_obj is in use.
+ * @param[in]  ack_count    Number of ACK-sized buffers.
+ * @param[in]  short_count  Number of short buffers.
+ * @param[in]  full_count   Number of full-size buffers.
+ */
+void nrf_802154_buffer_slab_init(nrf_802154_buffer_slab_t * p_obj,
+                                 void                     * p_memory,
+                                 size_t                     ack_count,
+                                 size_t                     short_count,
+                                 size_t                     full_count);
+
+/**
+ * @brief Allocates a buffer that can store the given number of bytes.
+ *
+ * The buffer is taken from the pool of the shortest buffers that are long enough. If that pool
+ * is exhausted, the buffer is taken from a pool of longer buffers.
+ *
+ * This function can be called from any context.
+ *
+ * @param[in] p_obj  Pointer to a slab allocator to allocate from.
+ * @param[in] size   Number of bytes the buffer must be able to store.
+ *
+ * @return Pointer to allocated buffer or NULL if no buffer could be allocated.
+ */
+void * nrf_802154_buffer_slab_alloc(nrf_802154_buffer_slab_t * p_obj, size_t size);
+
+/**
+ * @brief Frees a buffer allocated with @ref nrf_802154_buffer_slab_alloc.
+ *
+ * This function can be called from any context.
+ *
+ * @param[in] p_obj     Pointer to a slab allocator the buffer was allocated from.
+ * @param[in] p_buffer  Pointer to a buffer to free.
+ */
+void nrf_802154_buffer_slab_free(nrf_802154_buffer_slab_t * p_obj, void * p_buffer);
+
+/**
+ * @brief Gets the index of a buffer among all buffers of a slab allocator.
+ *
+ * @param[in]  p_obj     Pointer to a slab allocator to check.
+ * @param[in]  p_buffer  Pointer to a buffer returned by @ref nrf_802154_buffer_slab_alloc.
+ * @param[out] p_idx     Index of the buffer, lower than @ref nrf_802154_buffer_slab_capacity.
+ *
+ * @retval true   @p p_buffer points to a buffer of the slab allocator.
+ * @retval false  @p p_buffer does not belong to the slab allocator.
+ */
+bool nrf_802154_buffer_slab_index_get(const nrf_802154_buffer_slab_t * p_obj,
+                                      const void                     * p_buffer,
+                                      size_t                         * p_idx);
+
+/**
+ * @brief Gets total number of buffers of a slab allocator.
+ *
+ * @param[in] p_obj  Pointer to a slab allocator to check.
+ *
+ * @return  Number of buffers of all pools of the slab allocator.
+ */
+static inline size_t nrf_802154_buffer_slab_capacity(const nrf_802154_buffer_slab_t * p_obj)
+{
+    return p_obj->capacity;
+}
+
+#endif // NRF_802154_BUFFER_SLAB_H__
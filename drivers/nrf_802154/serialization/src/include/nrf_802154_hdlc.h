@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file nrf_802154_hdlc.h
+ * @brief HDLC-lite framing of spinel frames sent over byte streams.
+ *
+ * Frames are delimited with flag bytes, escaped as described in RFC 1662 and protected
+ * with the 16-bit frame check sequence of RFC 1662, which is the framing expected by spinel
+ * hosts connected over UART.
+ */
+
+#ifndef NRF_802154_HDLC_H__
+#define NRF_802154_HDLC_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/** @brief Byte delimiting HDLC-lite frames. */
+#define NRF_802154_HDLC_FLAG_BYTE     0x7E
+
+/** @brief Byte preceding escaped bytes of HDLC-lite frames. */
+#define NRF_802154_HDLC_ESCAPE_BYTE   0x7D
+
+/** @brief Value of the frame check sequence before any byte is processed. */
+#define NRF_802154_HDLC_FCS_INIT      0xFFFF
+
+/** @brief Number of bytes of the frame check sequence. */
+#define NRF_802154_HDLC_FCS_SIZE      2
+
+/**
+ * @brief Calculates the maximum number of bytes of an encoded frame.
+ *
+ * Every byte of the frame and of its frame check sequence can be escaped, and the frame
+ * is surrounded by two flag bytes.
+ *
+ * @param[in]  data_len  Number of bytes of the frame to encode.
+ */
+#define NRF_802154_HDLC_ENCODED_MAX_SIZE(data_len) \
+    (2 * ((data_len) + NRF_802154_HDLC_FCS_SIZE) + 2)
+
+/**
+ * @brief Function called when a frame is received.
+ *
+ * @param[in]  p_frame    Pointer to the received frame, without the frame check sequence.
+ *                        The data is valid only during the call.
+ * @param[in]  frame_len  Number of bytes of the frame.
+ */
+typedef void (* nrf_802154_hdlc_frame_handler_t)(const uint8_t * p_frame, size_t frame_len);
+
+/** @brief Structure representing an HDLC-lite decoder. */
+typedef struct
+{
+    /** @brief Pointer to a memory where the frame being received is stored. */
+    uint8_t                       * p_buffer;
+    /** @brief Size of the memory pointed by @ref p_buffer. */
+    size_t                          buffer_size;
+    /** @brief Number of bytes of the frame being received, including its check sequence. */
+    size_t                          length;
+    /** @brief Function called for every frame received with a valid check sequence. */
+    nrf_802154_hdlc_frame_handler_t handler;
+    /** @brief Frame check sequence of the bytes received so far. */
+    uint16_t                        fcs;
+    /** @brief Indicates that the last received byte was the escape byte. */
+    bool                            escaped;
+    /** @brief Indicates that the frame being received does not fit in @ref p_buffer. */
+    bool                            overflow;
+} nrf_802154_hdlc_decoder_t;
+
+/**
+ * @brief Updates a frame check sequence with a block of bytes.
+ *
+ * @param[in]  fcs       Frame check sequence of the preceding bytes or
+ *                       @ref NRF_802154_HDLC_FCS_INIT.
+ * @param[in]  p_data    Pointer to the bytes.
+ * @param[in]  data_len  Number of bytes.
+ *
+ * @returns  Updated frame check sequence.
+ */
+uint16_t nrf_802154_hdlc_fcs_update(uint16_t fcs, const uint8_t * p_data, size_t data_len);
+
+/**
+ * @brief Calculates the number of bytes of an encoded frame.
+ *
+ * @param[in]  p_data    Pointer to the frame to encode.
+ * @param[in]  data_len  Number of bytes of the frame.
+ *
+ * @returns  Number of bytes written by @ref nrf_802154_hdlc_encode for the frame.
+ */
+size_t nrf_802154_hdlc_encoded_size(const uint8_t * p_data, size_t data_len);
+
+/**
+ * @brief Encodes a frame.
+ *
+ * @param[in]  p_data    Pointer to the frame to encode.
+ * @param[in]  data_len  Number of bytes of the frame.
+ * @param[out] p_out     Pointer to a memory where the encoded frame is written.
+ * @param[in]  out_size  Size of the memory pointed by @p p_out. When it is at least
+ *                       @ref NRF_802154_HDLC_ENCODED_MAX_SIZE(@p data_len), encoding never fails.
+ *
+ * @returns  Number of bytes of the encoded frame or zero if it does not fit in @p p_out.
+ */
+size_t nrf_802154_hdlc_encode(const uint8_t * p_data,
+                              size_t          data_len,
+                              uint8_t       * p_out,
+                              size_t          out_size);
+
+/**
+ * @brief Initializes an HDLC-lite decoder.
+ *
+ * Bytes received before the first flag byte are discarded as a partial frame.
+ *
+ * @param[out] p_decoder    Pointer to the decoder to initialize.
+ * @param[in]  p_buffer     Pointer to a memory for the frame being received. It must hold
+ *                          the longest frame plus @ref NRF_802154_HDLC_FCS_SIZE bytes and persist
+ *                          as long as the decoder is in use.
+ * @param[in]  buffer_size  Size of the memory pointed by @p p_buffer.
+ * @param[in]  handler      Function called for every received frame.
+ */
+void nrf_802154_hdlc_decoder_init(nrf_802154_hdlc_decoder_t     * p_decoder,
+                                  uint8_t                       * p_buffer,
+                                  size_t                          buffer_size,
+                                  nrf_802154_hdlc_frame_handler_t handler);
+
+/**
+ * @brief Decodes a block of received bytes.
+ *
+ * The handler of the decoder is called from the context of this function for every complete
+ * frame in the block. Frames with an invalid check sequence and frames too long for the buffer
+ * of the decoder are dropped.
+ *
+ * @param[inout] p_decoder  Pointer to the decoder.
+ * @param[in]    p_data     Pointer to the received bytes.
+ * @param[in]    data_len   Number of received bytes.
+ */
+void nrf_802154_hdlc_decode(nrf_802154_hdlc_decoder_t * p_decoder,
+                            const uint8_t             * p_data,
+                            size_t                      data_len);
+
+#endif // NRF_802154_HDLC_H__
@@ -42,6 +42,8 @@
 #include <stdbool.h>
 #include <stddef.h>
 
+#include "nrf_802154_serialization_config.h"
+
 /**@brief Structure representing a key-value map */
 typedef struct
 {
@@ -55,8 +57,22 @@ typedef struct
     size_t key_size;
     /**@brief Size of a value in bytes */
     size_t val_size;
+#if NRF_802154_SER_KVMAP_HASH_ENABLED
+    /**@brief Number of slots of the hash table */
+    size_t slots;
+#endif
 } nrf_802154_kvmap_t;
 
+#if NRF_802154_SER_KVMAP_HASH_ENABLED
+
+/**@brief Number of hash table slots per item the map is able to store. */
+#define NRF_802154_KVMAP_SLOTS_PER_ITEM 2U
+
+/**@brief Calculates byte size of a single hash table slot. A slot starts with a state byte. */
+#define NRF_802154_KVMAP_SLOT_SIZE(key_size, val_size) (1U + (key_size) + (val_size))
+
+#endif
+
 /**@brief Calculates capacity of memory required to store a key-value map.
  *
  * Example:
@@ -68,8 +84,14 @@ typedef struct
  *                       7, 6);
  * @endcode
  */
+#if NRF_802154_SER_KVMAP_HASH_ENABLED
+#define NRF_802154_KVMAP_MEMORY_SIZE(capacity, key_size, val_size) \
+    ((capacity) * NRF_802154_KVMAP_SLOTS_PER_ITEM *                \
+     NRF_802154_KVMAP_SLOT_SIZE(key_size, val_size))
+#else
 #define NRF_802154_KVMAP_MEMORY_SIZE(capacity, key_size, val_size) \
     ((capacity) * ((key_size) + (val_size)))
+#endif
 
 /**@brief Initializes a key-value map instance.
  *
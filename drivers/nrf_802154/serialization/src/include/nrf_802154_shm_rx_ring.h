@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file nrf_802154_shm_rx_ring.h
+ * @brief Shared-memory ring used to pass received frames between the cores.
+ *
+ * Every slot of the ring has an owner. The network core takes free slots, fills them with
+ * received frames and passes them to the application core. The application core returns
+ * the slots once the frames are freed. Each ownership transition is performed by one core only,
+ * so no inter-core locking is required.
+ */
+
+#ifndef NRF_802154_SHM_RX_RING_H__
+#define NRF_802154_SHM_RX_RING_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_const.h"
+#include "nrf_802154_serialization_config.h"
+
+#if NRF_802154_SER_SHM_RX_RING_ENABLED
+
+/** @brief Size of a single slot of the ring. Fits the PHR and the longest PSDU. */
+#define NRF_802154_SHM_RX_RING_SLOT_SIZE   (MAX_PACKET_SIZE + 1)
+
+/** @brief Byte size of memory required at @ref NRF_802154_SER_SHM_RX_RING_ADDRESS. */
+#define NRF_802154_SHM_RX_RING_MEMORY_SIZE                                        \
+    (NRF_802154_SER_SHM_RX_RING_SLOTS * (NRF_802154_SHM_RX_RING_SLOT_SIZE + 1U))
+
+/**
+ * @brief Initializes the ring.
+ *
+ * All slots are marked as free. The function is to be called by the network core only.
+ */
+void nrf_802154_shm_rx_ring_init(void);
+
+/**
+ * @brief Takes a free slot of the ring.
+ *
+ * The function is to be called by the network core only.
+ *
+ * @param[out] p_slot  Index of the taken slot.
+ *
+ * @retval true   A slot was taken.
+ * @retval false  All slots are in use.
+ */
+bool nrf_802154_shm_rx_ring_slot_take(uint8_t * p_slot);
+
+/**
+ * @brief Passes a slot filled with a frame to the application core.
+ *
+ * The function is to be called by the network core only.
+ *
+ * @param[in]  slot  Index of the slot taken with @ref nrf_802154_shm_rx_ring_slot_take.
+ */
+void nrf_802154_shm_rx_ring_slot_pass(uint8_t slot);
+
+/**
+ * @brief Returns a slot taken by the network core without passing it.
+ *
+ * The function is to be called by the network core only.
+ *
+ * @param[in]  slot  Index of the slot taken with @ref nrf_802154_shm_rx_ring_slot_take.
+ */
+void nrf_802154_shm_rx_ring_slot_abort(uint8_t slot);
+
+/**
+ * @brief Checks if a slot is currently owned by the application core.
+ *
+ * @param[in]  slot  Index of the slot to check.
+ *
+ * @retval true   The slot is valid and was passed to the application core.
+ * @retval false  Otherwise.
+ */
+bool nrf_802154_shm_rx_ring_slot_is_passed(uint8_t slot);
+
+/**
+ * @brief Returns a slot passed to the application core back to the network core.
+ *
+ * The function is to be called by the application core. The network core may call it only for
+ * a slot whose descriptor could not be sent to the application core.
+ *
+ * @param[in]  slot  Index of the slot to return.
+ */
+void nrf_802154_shm_rx_ring_slot_release(uint8_t slot);
+
+/**
+ * @brief Gets a pointer to the frame buffer of a slot.
+ *
+ * @param[in]  slot  Index of the slot.
+ *
+ * @return  Pointer to the frame buffer of the slot.
+ */
+uint8_t * nrf_802154_shm_rx_ring_slot_data_get(uint8_t slot);
+
+/**
+ * @brief Gets an index of a slot based on a pointer to its frame buffer.
+ *
+ * @param[in]  p_data  Pointer to check.
+ * @param[out] p_slot  Index of the slot that contains @p p_data.
+ *
+ * @retval true   @p p_data points to the frame buffer of a slot.
+ * @retval false  @p p_data does not belong to the ring.
+ */
+bool nrf_802154_shm_rx_ring_slot_find(const uint8_t * p_data, uint8_t * p_slot);
+
+#endif // NRF_802154_SER_SHM_RX_RING_ENABLED
+
+#endif // NRF_802154_SHM_RX_RING_H__
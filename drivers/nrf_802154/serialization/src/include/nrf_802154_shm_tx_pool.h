@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file nrf_802154_shm_tx_pool.h
+ * @brief Shared-memory pool of frame buffers used for transmissions.
+ *
+ * The application core allocates the buffers and is the only core that modifies their allocation
+ * state. The network core accesses the frames placed in the buffers for the duration of
+ * a transmission, identified by the address of the buffer.
+ */
+
+#ifndef NRF_802154_SHM_TX_POOL_H__
+#define NRF_802154_SHM_TX_POOL_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_buffer_allocator.h"
+#include "nrf_802154_serialization_config.h"
+
+#if NRF_802154_SER_SHM_TX_POOL_ENABLED
+
+/** @brief Byte size of memory required at @ref NRF_802154_SER_SHM_TX_POOL_ADDRESS. */
+#define NRF_802154_SHM_TX_POOL_MEMORY_SIZE \
+    NRF_802154_BUFFER_ALLOCATOR_MEMORY_SIZE(NRF_802154_SER_SHM_TX_POOL_BUFFERS)
+
+/**
+ * @brief Initializes the pool.
+ *
+ * All buffers are marked as free. The function is to be called by the application core only.
+ */
+void nrf_802154_shm_tx_pool_init(void);
+
+/**
+ * @brief Allocates a buffer from the pool.
+ *
+ * The function is to be called by the application core only.
+ *
+ * @return Pointer to the allocated buffer or NULL if the pool is exhausted.
+ */
+uint8_t * nrf_802154_shm_tx_pool_alloc(void);
+
+/**
+ * @brief Frees a buffer allocated from the pool.
+ *
+ * The function is to be called by the application core only.
+ *
+ * @param[in]  p_buffer  Pointer to the buffer to free.
+ */
+void nrf_802154_shm_tx_pool_free(uint8_t * p_buffer);
+
+/**
+ * @brief Checks if a pointer points to the beginning of a buffer of the pool.
+ *
+ * @param[in]  p_data  Pointer to check.
+ *
+ * @retval true   @p p_data points to a buffer of the pool.
+ * @retval false  Otherwise.
+ */
+bool nrf_802154_shm_tx_pool_contains(const void * p_data);
+
+#endif // NRF_802154_SER_SHM_TX_POOL_ENABLED
+
+#endif // NRF_802154_SHM_TX_POOL_H__
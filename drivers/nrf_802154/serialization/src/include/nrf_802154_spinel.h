@@ -42,9 +42,12 @@
 #ifndef NRF_802154_SPINEL_H_
 #define NRF_802154_SPINEL_H_
 
+#include "../spinel_base/spinel.h"
 #include "nrf_802154_serialization_error.h"
+#include "nrf_802154_spinel_pack.h"
 #include "nrf_802154_buffer_mgr_dst.h"
 #include "nrf_802154_buffer_mgr_src.h"
+#include "nrf_802154_serialization_config.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -83,6 +86,104 @@ extern "C" {
  */
 nrf_802154_ser_err_t nrf_802154_spinel_send(const char * p_fmt, ...);
 
+/**
+ * @brief Function packing a property key followed by its value of a fixed layout.
+ *
+ * @param[inout]  p_writer  Writer to which the property is to be packed.
+ * @param[in]     p_ctx     Pointer to the property value to be packed.
+ */
+typedef void (* nrf_802154_spinel_prop_packer_t)(nrf_802154_spinel_writer_t * p_writer,
+                                                 const void                 * p_ctx);
+
+/**
+ * @brief Packs a property with a packer function and sends it over spinel backend.
+ *
+ * This function is equivalent to @ref nrf_802154_spinel_send with a format string made of the
+ * command and the property, but it does not interpret a format string at runtime.
+ *
+ * @param[in]  cmd     Spinel command carrying the property.
+ * @param[in]  packer  Function packing the property.
+ * @param[in]  p_ctx   Pointer passed to @p packer.
+ *
+ * @returns  number of bytes sent or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_prop_send(spinel_command_t                cmd,
+                                                 nrf_802154_spinel_prop_packer_t packer,
+                                                 const void                    * p_ctx);
+
+/**
+ * @brief Serializes data according to format string and sends it over spinel backend without
+ *        signaling the peer immediately.
+ *
+ * When @ref NRF_802154_SER_IRQ_MODERATION_ENABLED is set, signaling of the peer about the frame
+ * is moderated. Otherwise this function is equivalent to @ref nrf_802154_spinel_send. It is
+ * meant for frames the peer does not wait for, like notifications.
+ *
+ * @param[in]  p_fmt  Pointer to a format string describing data types to be serialized.
+ *                    Format string should conform to spinel specification.
+ * @param[in]  ...    Data to be serialized and sent according to @ref p_fmt format string.
+ *
+ * @returns  number of bytes sent or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_send_moderated(const char * p_fmt, ...);
+
+/**
+ * @brief Packs a property with a packer function and sends it over spinel backend without
+ *        signaling the peer immediately.
+ *
+ * This function is equivalent to @ref nrf_802154_spinel_send_moderated, but it does not
+ * interpret a format string at runtime.
+ *
+ * @param[in]  cmd     Spinel command carrying the property.
+ * @param[in]  packer  Function packing the property.
+ * @param[in]  p_ctx   Pointer passed to @p packer.
+ *
+ * @returns  number of bytes sent or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_prop_send_moderated(
+    spinel_command_t                cmd,
+    nrf_802154_spinel_prop_packer_t packer,
+    const void                    * p_ctx);
+
+#if NRF_802154_SER_COALESCING_ENABLED
+/**
+ * @brief Serializes a property value according to format string and queues it for coalesced
+ *        sending over spinel backend.
+ *
+ * The queued property values are sent before any frame sent with @ref nrf_802154_spinel_send,
+ * when the queue becomes full or when the maximum coalescing delay elapses.
+ *
+ * @param[in]  p_fmt  Pointer to a format string describing the property key followed by its
+ *                    value. Format string should conform to spinel specification.
+ * @param[in]  ...    Data to be serialized according to @ref p_fmt format string.
+ *
+ * @returns  zero on success or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_notification_send(const char * p_fmt, ...);
+
+/**
+ * @brief Packs a property with a packer function and queues it for coalesced sending over
+ *        spinel backend.
+ *
+ * This function is equivalent to @ref nrf_802154_spinel_notification_send, but it does not
+ * interpret a format string at runtime.
+ *
+ * @param[in]  packer  Function packing the property.
+ * @param[in]  p_ctx   Pointer passed to @p packer.
+ *
+ * @returns  zero on success or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_prop_notification_send(
+    nrf_802154_spinel_prop_packer_t packer,
+    const void                    * p_ctx);
+
+#endif // NRF_802154_SER_COALESCING_ENABLED
+
 /**
  * @brief Gets buffer manager for transactions originated by the remote serialization peer.
  *
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file nrf_802154_spinel_async_app.h
+ * @brief Bookkeeping of asynchronous requests issued by the application core.
+ *
+ * Every pending asynchronous request occupies one spinel transaction identifier. The network core
+ * echoes the identifier in its response, which allows matching the response with the request
+ * regardless of how many requests are in flight.
+ */
+
+#ifndef NRF_802154_SPINEL_ASYNC_APP_H__
+#define NRF_802154_SPINEL_ASYNC_APP_H__
+
+#include <stddef.h>
+
+#include "../spinel_base/spinel.h"
+#include "nrf_802154_serialization.h"
+#include "nrf_802154_serialization_error.h"
+
+#if NRF_802154_SER_ASYNC_ENABLED
+
+/**
+ * @brief Handles a response to an asynchronous request.
+ *
+ * @param[in]  tid                Transaction identifier carried by the response.
+ * @param[in]  property           Spinel property of the response.
+ * @param[in]  p_property_data    Pointer to a buffer that contains data of the property.
+ * @param[in]  property_data_len  Size of the @p p_property_data buffer.
+ *
+ * @returns zero on success or negative error value on failure.
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_async_response_handle(spinel_tid_t      tid,
+                                                             spinel_prop_key_t property,
+                                                             const void      * p_property_data,
+                                                             size_t            property_data_len);
+
+#endif // NRF_802154_SER_ASYNC_ENABLED
+
+#endif // NRF_802154_SPINEL_ASYNC_APP_H__
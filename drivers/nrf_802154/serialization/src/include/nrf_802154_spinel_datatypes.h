@@ -459,6 +459,110 @@ typedef enum
     SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_COORD_GET =
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 65,
 
+    /**
+     * Vendor property for nrf_802154_pending_bit_for_addr_set_batch serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_SET_BATCH =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 66,
+
+    /**
+     * Vendor property for nrf_802154_pending_bit_for_addr_clear_batch serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR_BATCH =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 67,
+
+    /**
+     * Vendor property for nrf_802154_received_timestamp_raw serialization
+     * through the shared-memory RX ring.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_SHM =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 68,
+
+    /**
+     * Vendor property for nrf_802154_stat_histograms_get serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_STAT_HISTOGRAMS_GET =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 69,
+
+    /**
+     * Vendor property for nrf_802154_csma_ca_max_frame_retries_set serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_FRAME_RETRIES_SET =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 70,
+
+    /**
+     * Vendor property for nrf_802154_csma_ca_max_frame_retries_get serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_FRAME_RETRIES_GET =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 71,
+
+    /**
+     * Vendor property for nrf_802154_energy_scan serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_SCAN =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 72,
+
+    /**
+     * Vendor property for nrf_802154_energy_scan_done serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_SCAN_DONE =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 73,
+
+    /**
+     * Vendor property for nrf_802154_link_metrics_series_configure serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_LINK_METRICS_SERIES_CONFIGURE =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 74,
+
+    /**
+     * Vendor property for nrf_802154_link_metrics_series_get serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_LINK_METRICS_SERIES_GET =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 75,
+
+    /**
+     * Vendor property for enabling the compact encoding of received frame notifications.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RX_COMPACT_ENABLE =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 76,
+
+    /**
+     * Vendor property for nrf_802154_received_timestamp_raw serialization
+     * with the compact encoding.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_COMPACT =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 77,
+
+    /**
+     * Vendor property for nrf_802154_serialization_rx_filter_rule_add serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RX_FILTER_RULE_ADD =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 78,
+
+    /**
+     * Vendor property for nrf_802154_serialization_rx_filter_clear serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RX_FILTER_CLEAR =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 79,
+
+    /**
+     * Vendor property for returning multiple freed buffers with a single request.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_BUFFER_FREE_RAW_BATCH =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 80,
+
+    /**
+     * Vendor property for nrf_802154_perf_counter_get serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PERF_COUNTER_GET =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 81,
+
+    /**
+     * Vendor property group for Nordic nrf_802154 end. New properties are to be added above.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154__END =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 82,
+
 } spinel_prop_vendor_key_t;
 
 /**
@@ -649,6 +753,26 @@ typedef enum
  */
 #define SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BACKOFFS_GET_RET     SPINEL_DATATYPE_UINT8_S
 
+/**
+ * @brief Spinel data type description for nrf_802154_csma_ca_max_frame_retries_set.
+ */
+#define SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_FRAME_RETRIES_SET     SPINEL_DATATYPE_UINT8_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_csma_ca_max_frame_retries_set result.
+ */
+#define SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_FRAME_RETRIES_SET_RET SPINEL_DATATYPE_BOOL_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_csma_ca_max_frame_retries_get.
+ */
+#define SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_FRAME_RETRIES_GET     SPINEL_DATATYPE_NULL_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_csma_ca_max_frame_retries_get result.
+ */
+#define SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_FRAME_RETRIES_GET_RET SPINEL_DATATYPE_UINT8_S
+
 /**
  * @brief Spinel data type description for nrf_802154_test_mode_csmaca_backoff_set.
  */
@@ -727,6 +851,9 @@ typedef enum
     SPINEL_DATATYPE_UINT64_S                         \
     SPINEL_DATATYPE_UINT64_S                         \
     SPINEL_DATATYPE_UINT64_S                         \
+    SPINEL_DATATYPE_UINT64_S                         \
+    SPINEL_DATATYPE_UINT64_S                         \
+    SPINEL_DATATYPE_UINT64_S                         \
     SPINEL_DATATYPE_UINT64_S
 
 /**
@@ -738,7 +865,10 @@ typedef enum
     ((stat_timestamps).last_cca_idle_timestamp),           \
     ((stat_timestamps).last_tx_end_timestamp),             \
     ((stat_timestamps).last_ack_end_timestamp),            \
-    ((stat_timestamps).last_rx_end_timestamp)
+    ((stat_timestamps).last_rx_end_timestamp),             \
+    ((stat_timestamps).last_tx_start_timestamp),           \
+    ((stat_timestamps).last_ack_start_timestamp),          \
+    ((stat_timestamps).last_rx_start_timestamp)
 
 /**
  * @brief Decodes an instance of @ref SPINEL_DATATYPE_NRF_802154_STAT_TIMESTAMPS_S data type.
@@ -749,7 +879,10 @@ typedef enum
     (&(stat_timestamps).last_cca_idle_timestamp),          \
     (&(stat_timestamps).last_tx_end_timestamp),            \
     (&(stat_timestamps).last_ack_end_timestamp),           \
-    (&(stat_timestamps).last_rx_end_timestamp)
+    (&(stat_timestamps).last_rx_end_timestamp),            \
+    (&(stat_timestamps).last_tx_start_timestamp),          \
+    (&(stat_timestamps).last_ack_start_timestamp),         \
+    (&(stat_timestamps).last_rx_start_timestamp)
 
 /**
  * @brief Spinel data type description for SPINEL_PROP_LAST_STATUS.
@@ -892,6 +1025,25 @@ typedef enum
  */
 #define SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_FAILED SPINEL_DATATYPE_UINT8_S
 
+/**
+ * @brief Spinel data type description for nrf_802154_energy_scan.
+ */
+#define SPINEL_DATATYPE_NRF_802154_ENERGY_SCAN  \
+    SPINEL_DATATYPE_UINT32_S /* Channel mask */ \
+    SPINEL_DATATYPE_UINT32_S /* Dwell time */
+
+/**
+ * @brief Spinel data type description for nrf_802154_energy_scan result.
+ */
+#define SPINEL_DATATYPE_NRF_802154_ENERGY_SCAN_RET SPINEL_DATATYPE_BOOL_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_energy_scan_done.
+ */
+#define SPINEL_DATATYPE_NRF_802154_ENERGY_SCAN_DONE \
+    SPINEL_DATATYPE_UINT32_S /* Channel mask */     \
+    SPINEL_DATATYPE_DATA_S   /* ED results */
+
 /**
  * @brief Spinel data type description for nrf_802154_continuous_carrier.
  */
@@ -936,6 +1088,66 @@ typedef enum
     SPINEL_DATATYPE_UINT8_S            /* lqi */            \
     SPINEL_DATATYPE_UINT64_S           /* timestamp */
 
+/**
+ * @brief Spinel data type description for nrf_802154_received_timestamp_raw
+ *        passed through the shared-memory RX ring
+ */
+#define SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_SHM \
+    SPINEL_DATATYPE_UINT8_S  /* Slot index */             \
+    SPINEL_DATATYPE_UINT8_S  /* Frame length */           \
+    SPINEL_DATATYPE_INT8_S   /* Power */                  \
+    SPINEL_DATATYPE_UINT8_S  /* lqi */                    \
+    SPINEL_DATATYPE_UINT64_S /* timestamp */
+
+/**
+ * @brief Spinel data type description for nrf_802154_received_timestamp_raw
+ *        with the compact encoding
+ *
+ * The handle and the timestamp are encoded as differences from the ones of the previous
+ * received frame notification. The handle difference is zigzag-encoded. The received frame
+ * occupies the rest of the property.
+ */
+#define SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_COMPACT \
+    SPINEL_DATATYPE_UINT_PACKED_S /* Handle difference */     \
+    SPINEL_DATATYPE_UINT_PACKED_S /* Timestamp difference */  \
+    SPINEL_DATATYPE_INT8_S        /* Power */                 \
+    SPINEL_DATATYPE_UINT8_S       /* lqi */                   \
+    SPINEL_DATATYPE_DATA_S        /* Received frame */
+
+/**
+ * @brief Spinel data type description for the compact encoding of received frame
+ *        notifications enable request
+ */
+#define SPINEL_DATATYPE_NRF_802154_RX_COMPACT_ENABLE     SPINEL_DATATYPE_NULL_S
+
+/**
+ * @brief Spinel data type description for the result of the compact encoding of received frame
+ *        notifications enable request
+ */
+#define SPINEL_DATATYPE_NRF_802154_RX_COMPACT_ENABLE_RET SPINEL_DATATYPE_BOOL_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_serialization_rx_filter_rule_add
+ */
+#define SPINEL_DATATYPE_NRF_802154_RX_FILTER_RULE_ADD      \
+    SPINEL_DATATYPE_UINT8_S     /* Fields to be matched */ \
+    SPINEL_DATATYPE_UINT8_S     /* Action */               \
+    SPINEL_DATATYPE_UINT8_S     /* Frame type */           \
+    SPINEL_DATATYPE_UINT8_S     /* Command ID */           \
+    SPINEL_DATATYPE_DATA_WLEN_S /* Destination PAN ID */   \
+    SPINEL_DATATYPE_DATA_S      /* Destination address */
+
+/**
+ * @brief Spinel data type description for return value of
+ *        nrf_802154_serialization_rx_filter_rule_add
+ */
+#define SPINEL_DATATYPE_NRF_802154_RX_FILTER_RULE_ADD_RET SPINEL_DATATYPE_BOOL_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_serialization_rx_filter_clear
+ */
+#define SPINEL_DATATYPE_NRF_802154_RX_FILTER_CLEAR        SPINEL_DATATYPE_NULL_S
+
 /**
  * @brief Spinel data type description for nrf_802154_receive_failed
  */
@@ -955,6 +1167,14 @@ typedef enum
 #define SPINEL_DATATYPE_NRF_802154_BUFFER_FREE_RAW \
     SPINEL_DATATYPE_UINT32_S /* Handle to buffer to free */
 
+/**
+ * @brief Spinel data type description for returning multiple freed buffers.
+ *
+ * SPINEL_DATATYPE_ARRAY_S encoding is not implemented, SPINEL_DATATYPE_DATA_S has to be used instead.
+ */
+#define SPINEL_DATATYPE_NRF_802154_BUFFER_FREE_RAW_BATCH \
+    SPINEL_DATATYPE_DATA_S /* UINT32 handles of buffers to free placed one after another */
+
 /**
  * @brief Spinel data type description for nrf_802154_transmit_raw
  */
@@ -1011,6 +1231,41 @@ typedef enum
  */
 #define SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR_RET SPINEL_DATATYPE_BOOL_S
 
+/**
+ * @brief Spinel data type desription for nrf_802154_pending_bit_for_addr_set_batch.
+ *
+ * SPINEL_DATATYPE_ARRAY_S encoding is not implemented, SPINEL_DATATYPE_DATA_S has to be used instead.
+ */
+#define SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_SET_BATCH         \
+    SPINEL_DATATYPE_BOOL_S /* extended */                                 \
+    SPINEL_DATATYPE_DATA_S /* Addresses placed one after another */
+
+/**
+ * @brief Spinel data type desription for nrf_802154_pending_bit_for_addr_set_batch return value.
+ */
+#define SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_SET_BATCH_RET     SPINEL_DATATYPE_UINT8_S
+
+/**
+ * @brief Spinel data type desription for nrf_802154_pending_bit_for_addr_clear_batch.
+ *
+ * SPINEL_DATATYPE_ARRAY_S encoding is not implemented, SPINEL_DATATYPE_DATA_S has to be used instead.
+ */
+#define SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR_BATCH       \
+    SPINEL_DATATYPE_BOOL_S /* extended */                                 \
+    SPINEL_DATATYPE_DATA_S /* Addresses placed one after another */
+
+/**
+ * @brief Spinel data type desription for nrf_802154_pending_bit_for_addr_clear_batch return value.
+ */
+#define SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR_BATCH_RET   SPINEL_DATATYPE_UINT8_S
+
+/**
+ * @brief Maximum size of the addresses data carried by a single pending bit batch property.
+ *
+ * Batches exceeding this size are split into multiple properties.
+ */
+#define NRF_802154_SPINEL_PENDING_BIT_BATCH_MAX_DATA_SIZE 256
+
 /**
  * @brief Spinel data type desription for nrf_802154_pending_bit_for_addr_reset.
  */
@@ -1075,6 +1330,7 @@ typedef enum
  */
 #define SPINEL_DATATYPE_NRF_802154_TRANSMIT_DONE_METADATA_S                \
     SPINEL_DATATYPE_NRF_802154_TRANSMITTED_FRAME_PROPS_S /* Frame props */ \
+    SPINEL_DATATYPE_UINT8_S                              /* Retries */     \
     SPINEL_DATATYPE_UINT8_S                              /* Length */      \
     SPINEL_DATATYPE_INT8_S                               /* Power */       \
     SPINEL_DATATYPE_UINT8_S                              /* LQI */         \
@@ -1089,6 +1345,7 @@ typedef enum
  */
 #define NRF_802154_TRANSMIT_DONE_METADATA_ENCODE(metadata, ack_handle) \
     NRF_802154_TRANSMITTED_FRAME_PROPS_ENCODE((metadata).frame_props), \
+    (metadata).retries,                                                \
     (metadata).data.transmitted.length,                                \
     (metadata).data.transmitted.power,                                 \
     (metadata).data.transmitted.lqi,                                   \
@@ -1107,6 +1364,7 @@ typedef enum
  */
 #define NRF_802154_TRANSMIT_DONE_METADATA_DECODE(metadata, ack_handle, ack_length) \
     NRF_802154_TRANSMITTED_FRAME_PROPS_DECODE((metadata).frame_props),             \
+    &(metadata).retries,                                                           \
     &(metadata).data.transmitted.length,                                           \
     &(metadata).data.transmitted.power,                                            \
     &(metadata).data.transmitted.lqi,                                              \
@@ -1116,24 +1374,27 @@ typedef enum
 /**
  * @brief Spinel data type description for nrf_802154_transmit_failed_metadata.
  */
-#define SPINEL_DATATYPE_NRF_802154_TRANSMIT_FAILED_METADATA_S \
-    SPINEL_DATATYPE_NRF_802154_TRANSMITTED_FRAME_PROPS_S /* Frame props */
+#define SPINEL_DATATYPE_NRF_802154_TRANSMIT_FAILED_METADATA_S             \
+    SPINEL_DATATYPE_NRF_802154_TRANSMITTED_FRAME_PROPS_S /* Frame props */ \
+    SPINEL_DATATYPE_UINT8_S                              /* Retries */
 
 /**
  * @brief Encodes an instance of @ref SPINEL_DATATYPE_NRF_802154_TRANSMIT_FAILED_METADATA_S data type.
  *
  * @param[in]  metadata    Transmit failed metadata structure to be encoded.
  */
-#define NRF_802154_TRANSMIT_FAILED_METADATA_ENCODE(metadata) \
-    NRF_802154_TRANSMITTED_FRAME_PROPS_ENCODE((metadata).frame_props)
+#define NRF_802154_TRANSMIT_FAILED_METADATA_ENCODE(metadata)           \
+    NRF_802154_TRANSMITTED_FRAME_PROPS_ENCODE((metadata).frame_props), \
+    (metadata).retries
 
 /**
  * @brief Decodes an instance of @ref SPINEL_DATATYPE_NRF_802154_TRANSMIT_FAILED_METADATA_S data type.
  *
  * @param[out]  metadata    Transmit failed metadata structure to which store decoded data.
  */
-#define NRF_802154_TRANSMIT_FAILED_METADATA_DECODE(metadata) \
-    NRF_802154_TRANSMITTED_FRAME_PROPS_DECODE((metadata).frame_props)
+#define NRF_802154_TRANSMIT_FAILED_METADATA_DECODE(metadata)           \
+    NRF_802154_TRANSMITTED_FRAME_PROPS_DECODE((metadata).frame_props), \
+    &(metadata).retries
 
 /**
  * @brief Spinel data type description for nrf_802154_transmitted_raw.
@@ -1147,11 +1408,16 @@ typedef enum
  *
  * @param[in]  frame_handle Variable containing remote frame handle.
  * @param[in]  frame_data   Pointer to contents of frame.
+ * @param[in]  frame_length Number of bytes of @p frame_data to be encoded.
  * @param[in]  metadata     Transmit done metadata structure to be encoded.
  * @param[in]  ack_handle   Variable containing handle to received Ack.
  */
-#define NRF_802154_TRANSMITTED_RAW_ENCODE(frame_handle, frame_data, metadata, ack_handle) \
-    NRF_802154_HDATA_ENCODE(frame_handle, frame_data, frame_data[0] + 1),                 \
+#define NRF_802154_TRANSMITTED_RAW_ENCODE(frame_handle,              \
+                                          frame_data,                \
+                                          frame_length,              \
+                                          metadata,                  \
+                                          ack_handle)                \
+    NRF_802154_HDATA_ENCODE(frame_handle, frame_data, frame_length), \
     NRF_802154_TRANSMIT_DONE_METADATA_ENCODE(metadata, ack_handle)
 
 /**
@@ -1186,12 +1452,17 @@ typedef enum
  *
  * @param[in]  frame_handle Variable containing remote frame handle.
  * @param[in]  frame_data   Pointer to contents of frame.
+ * @param[in]  frame_length Number of bytes of @p frame_data to be encoded.
  * @param[in]  error_code   Error code to be encoded.
  * @param[in]  metadata     Transmit failed metadata structure to be encoded.
  */
-#define NRF_802154_TRANSMIT_FAILED_ENCODE(frame_handle, frame_data, error_code, metadata) \
-    NRF_802154_HDATA_ENCODE(frame_handle, frame_data, frame_data[0] + 1),                 \
-    error_code,                                                                           \
+#define NRF_802154_TRANSMIT_FAILED_ENCODE(frame_handle,              \
+                                          frame_data,                \
+                                          frame_length,              \
+                                          error_code,                \
+                                          metadata)                  \
+    NRF_802154_HDATA_ENCODE(frame_handle, frame_data, frame_length), \
+    error_code,                                                      \
     NRF_802154_TRANSMIT_FAILED_METADATA_ENCODE(metadata)
 
 /**
@@ -1360,6 +1631,62 @@ typedef enum
 #define SPINEL_DATATYPE_NRF_802154_STAT_TIMESTAMPS_GET_RET \
     SPINEL_DATATYPE_NRF_802154_STAT_TIMESTAMPS_S
 
+/**
+ * @brief Spinel data type description for nrf_802154_stat_histograms_get
+ */
+#define SPINEL_DATATYPE_NRF_802154_STAT_HISTOGRAMS_GET     SPINEL_DATATYPE_NULL_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_stat_histograms_get_ret.
+ *
+ * The histograms are passed as the raw @ref nrf_802154_stat_histograms_t structure, as both
+ * cores share its layout.
+ */
+#define SPINEL_DATATYPE_NRF_802154_STAT_HISTOGRAMS_GET_RET SPINEL_DATATYPE_DATA_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_perf_counter_get.
+ */
+#define SPINEL_DATATYPE_NRF_802154_PERF_COUNTER_GET SPINEL_DATATYPE_UINT32_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_perf_counter_get return value.
+ *
+ * The counter is passed as the raw @ref nrf_802154_perf_counter_t structure, as both
+ * cores share its layout.
+ */
+#define SPINEL_DATATYPE_NRF_802154_PERF_COUNTER_GET_RET \
+    SPINEL_DATATYPE_BOOL_S /* Result */                 \
+    SPINEL_DATATYPE_DATA_S /* Counter snapshot */
+
+/**
+ * @brief Spinel data type description for nrf_802154_link_metrics_series_configure.
+ */
+#define SPINEL_DATATYPE_NRF_802154_LINK_METRICS_SERIES_CONFIGURE \
+    SPINEL_DATATYPE_UINT8_S /* Series ID */                      \
+    SPINEL_DATATYPE_DATA_S  /* Initiator address */              \
+    SPINEL_DATATYPE_UINT8_S /* Frame types */
+
+/**
+ * @brief Spinel data type description for nrf_802154_link_metrics_series_configure return value.
+ */
+#define SPINEL_DATATYPE_NRF_802154_LINK_METRICS_SERIES_CONFIGURE_RET SPINEL_DATATYPE_BOOL_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_link_metrics_series_get.
+ */
+#define SPINEL_DATATYPE_NRF_802154_LINK_METRICS_SERIES_GET SPINEL_DATATYPE_UINT8_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_link_metrics_series_get return value.
+ *
+ * The accumulated values are passed as the raw @ref nrf_802154_lm_series_t structure, as both
+ * cores share its layout.
+ */
+#define SPINEL_DATATYPE_NRF_802154_LINK_METRICS_SERIES_GET_RET \
+    SPINEL_DATATYPE_BOOL_S /* Result */                        \
+    SPINEL_DATATYPE_DATA_S /* Series values */
+
 /**
  * @brief Spinel data type description for nrf_802154_ifs_mode_get
  */
@@ -44,12 +44,58 @@
 
 #include <stddef.h>
 
+#include "../spinel_base/spinel.h"
 #include "nrf_802154_serialization_error.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief Gets the index of an nrf_802154 vendor property in a table of property decoders.
+ *
+ * @param[in]  property  Vendor property of the nrf_802154 group.
+ */
+#define NRF_802154_SPINEL_PROP_IDX(property) \
+    ((property) - SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN)
+
+/**
+ * @brief Size of a property decoder table indexed by @ref NRF_802154_SPINEL_PROP_IDX.
+ */
+#define NRF_802154_SPINEL_PROP_NUM \
+    NRF_802154_SPINEL_PROP_IDX(SPINEL_PROP_VENDOR_NORDIC_NRF_802154__END)
+
+/**
+ * @brief Function decoding and dispatching the value of a single property.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @p p_property_data buffer.
+ *
+ * @returns zero on success or negative error value on failure.
+ */
+typedef nrf_802154_ser_err_t (* nrf_802154_spinel_prop_decoder_t)(const void * p_property_data,
+                                                                   size_t       property_data_len);
+
+/**
+ * @brief Decode the property key that starts the data of a property command.
+ *
+ * The key is decoded directly instead of through a spinel format string, as it is present in
+ * every property command.
+ *
+ * @param[in]   p_cmd_data           Pointer to a buffer that contains data to be decoded.
+ * @param[in]   cmd_data_len         Size of the @p p_cmd_data buffer.
+ * @param[out]  p_property           Decoded property key.
+ * @param[out]  pp_property_data     Pointer to the property value following the key.
+ * @param[out]  p_property_data_len  Size of the property value.
+ *
+ * @returns zero on success or negative error value on failure.
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_key(const void        * p_cmd_data,
+                                                       size_t              cmd_data_len,
+                                                       spinel_prop_key_t * p_property,
+                                                       const void       ** pp_property_data,
+                                                       size_t            * p_property_data_len);
+
 /**
  * @brief Decode and dispatch spinel command.
  *
@@ -62,6 +108,16 @@ extern "C" {
 nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd(const void * p_packet_data,
                                                   size_t       packet_data_len);
 
+/**
+ * @brief Get transaction identifier of the spinel command being decoded.
+ *
+ * The value is valid from the moment @ref nrf_802154_spinel_decode_cmd dispatches a command
+ * until the next command is decoded. Commands not bound to a transaction carry identifier 0.
+ *
+ * @returns Transaction identifier taken from the header of the most recently decoded command.
+ */
+spinel_tid_t nrf_802154_spinel_decoded_cmd_tid_get(void);
+
 /**
  * @brief Dispatches spinel command.
  *
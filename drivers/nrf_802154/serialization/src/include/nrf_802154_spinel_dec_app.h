@@ -207,6 +207,55 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_nrf_802154_stat_timestamps_ge
     size_t                         property_data_len,
     nrf_802154_stat_timestamps_t * p_stat_timestamps);
 
+/**
+ * @brief Decode SPINEL_PROP_VENDOR_NORDIC_NRF_802154_STAT_HISTOGRAMS_GET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ * @param[out] p_stat_histograms  Decoded stat histograms
+ *
+ * @returns zero on success or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_nrf_802154_stat_histograms_get_ret(
+    const void                   * p_property_data,
+    size_t                         property_data_len,
+    nrf_802154_stat_histograms_t * p_stat_histograms);
+
+/**
+ * @brief Decode SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PERF_COUNTER_GET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ * @param[out] p_result           Decoded result of the call.
+ * @param[out] p_counter          Decoded counter. Filled only if @p p_result is true.
+ *
+ * @returns zero on success or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_nrf_802154_perf_counter_get_ret(
+    const void                * p_property_data,
+    size_t                      property_data_len,
+    bool                      * p_result,
+    nrf_802154_perf_counter_t * p_counter);
+
+/**
+ * @brief Decode SPINEL_PROP_VENDOR_NORDIC_NRF_802154_LINK_METRICS_SERIES_GET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ * @param[out] p_result           Decoded result of the call.
+ * @param[out] p_series           Decoded series values. Filled only if @p p_result is true.
+ *
+ * @returns zero on success or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_nrf_802154_link_metrics_series_get_ret(
+    const void             * p_property_data,
+    size_t                   property_data_len,
+    bool                   * p_result,
+    nrf_802154_lm_series_t * p_series);
+
 /**
  * @brief Decode and dispatch SPINEL_CMD_PROP_VALUE_IS.
  *
@@ -44,6 +44,7 @@
 
 #include "../spinel_base/spinel.h"
 #include "nrf_802154_spinel_enc.h"
+#include "nrf_802154_spinel_dec.h"
 #include "nrf_802154_spinel_datatypes.h"
 
 #ifdef __cplusplus
@@ -80,6 +81,91 @@ extern "C" {
                                prop,                                \
                                __VA_ARGS__)
 
+/**
+ * @brief Serialize and send spinel command SPINEL_CMD_PROP_VALUE_IS carrying a notification.
+ *
+ * When @ref NRF_802154_SER_COALESCING_ENABLED is set, the notification is coalesced with other
+ * notifications. Otherwise it is sent immediately, while signaling of the peer about it is
+ * moderated like by @ref nrf_802154_spinel_send_moderated.
+ *
+ * @param[in]  prop   Spinel property to be serialized and sent.
+ * @param[in]  p_fmt  Pointer to a format string describing data types to be serialized.
+ *                    Format string should conform to spinel specification.
+ * @param[in]  ...    Data to be serialized and sent according to @ref p_fmt format string.
+ *
+ * @returns  non-negative value on success or negative error value on failure.
+ *
+ */
+#if NRF_802154_SER_COALESCING_ENABLED
+#define nrf_802154_spinel_send_notification_prop_value_is(prop, p_fmt, ...) \
+    nrf_802154_spinel_notification_send(SPINEL_DATATYPE_UINT_PACKED_S p_fmt, \
+                                        prop,                                \
+                                        __VA_ARGS__)
+#else
+#define nrf_802154_spinel_send_notification_prop_value_is(prop, p_fmt, ...) \
+    nrf_802154_spinel_send_moderated(SPINEL_DATATYPE_COMMAND_S              \
+                                     SPINEL_DATATYPE_UINT_PACKED_S p_fmt,   \
+                                     SPINEL_HEADER_FLAG,                    \
+                                     SPINEL_CMD_PROP_VALUE_IS,              \
+                                     prop,                                  \
+                                     __VA_ARGS__)
+#endif
+
+/**
+ * @brief Pack and send spinel command SPINEL_CMD_PROP_VALUE_IS carrying a fixed-layout
+ *        notification.
+ *
+ * The notification is coalesced like by @ref nrf_802154_spinel_send_notification_prop_value_is.
+ *
+ * @param[in]  packer  Function packing the property key and its value.
+ * @param[in]  p_ctx   Pointer to the property value passed to @p packer.
+ *
+ * @returns  non-negative value on success or negative error value on failure.
+ *
+ */
+#if NRF_802154_SER_COALESCING_ENABLED
+#define nrf_802154_spinel_send_notification_prop_value_is_packed(packer, p_ctx) \
+    nrf_802154_spinel_prop_notification_send(packer, p_ctx)
+#else
+#define nrf_802154_spinel_send_notification_prop_value_is_packed(packer, p_ctx) \
+    nrf_802154_spinel_prop_send_moderated(SPINEL_CMD_PROP_VALUE_IS, packer, p_ctx)
+#endif
+
+/**
+ * @brief Serialize and send spinel command SPINEL_CMD_PROP_VALUE_IS as a response.
+ *
+ * The response carries the transaction identifier of the request being processed, as returned
+ * by @ref nrf_802154_spinel_decoded_cmd_tid_get. It must only be used from the context that
+ * decodes the request.
+ *
+ * @param[in]  prop   Spinel property to be serialized and sent.
+ * @param[in]  p_fmt  Pointer to a format string describing data types to be serialized.
+ *                    Format string should conform to spinel specification.
+ * @param[in]  ...    Data to be serialized and sent according to @ref p_fmt format string.
+ *
+ * @returns  number of bytes sent or negative error value on failure.
+ *
+ */
+#define nrf_802154_spinel_send_rsp_prop_value_is(prop, p_fmt, ...)          \
+    nrf_802154_spinel_send_cmd_tid(nrf_802154_spinel_decoded_cmd_tid_get(), \
+                                   SPINEL_CMD_PROP_VALUE_IS,                \
+                                   SPINEL_DATATYPE_UINT_PACKED_S p_fmt,     \
+                                   prop,                                    \
+                                   __VA_ARGS__)
+
+/**
+ * @brief Serialize and send spinel property SPINEL_PROP_LAST_STATUS as a response.
+ *
+ * @param[in]  status  Spinel status to be serialized and sent.
+ *
+ * @returns  number of bytes sent or negative error value on failure.
+ *
+ */
+#define nrf_802154_spinel_send_rsp_prop_last_status_is(status)                        \
+    nrf_802154_spinel_send_rsp_prop_value_is(SPINEL_PROP_LAST_STATUS,                 \
+                                             SPINEL_DATATYPE_SPINEL_PROP_LAST_STATUS, \
+                                             status)
+
 #ifdef __cplusplus
 }
 #endif
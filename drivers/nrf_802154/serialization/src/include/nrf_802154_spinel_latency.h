@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file nrf_802154_spinel_latency.h
+ * @brief Measurement of latencies of serialized calls.
+ */
+
+#ifndef NRF_802154_SPINEL_LATENCY_H__
+#define NRF_802154_SPINEL_LATENCY_H__
+
+#include <stdint.h>
+
+#include "nrf_802154_serialization.h"
+#include "nrf_802154_serialization_config.h"
+
+#if NRF_802154_SER_LATENCY_STATS_ENABLED
+
+#include "nrfx.h"
+
+/**
+ * @brief Initializes the latency measurement.
+ *
+ * Enables the time source and resets all measured latencies.
+ */
+void nrf_802154_spinel_latency_init(void);
+
+/**
+ * @brief Records a latency of a serialized call.
+ *
+ * @param[in]  id     Identifier of the call.
+ * @param[in]  start  Time at which the call started, taken with
+ *                    @ref NRF_802154_SER_LATENCY_STATS_TIME_GET.
+ */
+void nrf_802154_spinel_latency_record(nrf_802154_ser_latency_id_t id, uint32_t start);
+
+/** @brief Declares variable @p start holding the time at which a measured call started. */
+#define NRF_802154_SPINEL_LATENCY_START(start) \
+    uint32_t start = NRF_802154_SER_LATENCY_STATS_TIME_GET()
+
+/** @brief Records the latency of the call @p id which started at @p start. */
+#define NRF_802154_SPINEL_LATENCY_RECORD(id, start) \
+    nrf_802154_spinel_latency_record((id), (start))
+
+#else // NRF_802154_SER_LATENCY_STATS_ENABLED
+
+#define NRF_802154_SPINEL_LATENCY_START(start)
+#define NRF_802154_SPINEL_LATENCY_RECORD(id, start)
+
+#endif // NRF_802154_SER_LATENCY_STATS_ENABLED
+
+#endif // NRF_802154_SPINEL_LATENCY_H__
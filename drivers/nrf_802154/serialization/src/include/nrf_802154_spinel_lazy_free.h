@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file nrf_802154_spinel_lazy_free.h
+ * @brief Lazy returning of freed receive buffers to the network core.
+ *
+ * Handles of buffers freed on the application core are accumulated and sent to the network
+ * core together in a single request that is not responded to.
+ */
+
+#ifndef NRF_802154_SPINEL_LAZY_FREE_H__
+#define NRF_802154_SPINEL_LAZY_FREE_H__
+
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_serialization_config.h"
+#include "nrf_802154_serialization_error.h"
+
+#if NRF_802154_SER_LAZY_FREE_ENABLED
+
+#if (NRF_802154_SER_LAZY_FREE_BATCH_SIZE == 0) ||                               \
+    ((NRF_802154_SER_LAZY_FREE_BATCH_SIZE + NRF_802154_SER_LAZY_FREE_RESERVE) > \
+     NRF_802154_RX_BUFFERS)
+#error "Lazy freeing must not withhold the reserved receive buffers"
+#endif
+
+/**
+ * @brief Initializes lazy freeing.
+ *
+ * All accumulated handles are dropped.
+ */
+void nrf_802154_spinel_lazy_free_init(void);
+
+/**
+ * @brief Accumulates the handle of a freed buffer.
+ *
+ * The accumulated handles are sent to the network core when
+ * @ref NRF_802154_SER_LAZY_FREE_BATCH_SIZE of them are accumulated.
+ *
+ * @param[in]  buffer_handle  Handle of the freed buffer.
+ *
+ * @returns  zero on success or negative error value on failure.
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_lazy_free_add(uint32_t buffer_handle);
+
+/**
+ * @brief Sends all accumulated handles to the network core.
+ *
+ * @returns  zero on success, when there was nothing to send, or negative error value on failure.
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_lazy_free_flush(void);
+
+#endif // NRF_802154_SER_LAZY_FREE_ENABLED
+
+#endif // NRF_802154_SPINEL_LAZY_FREE_H__
@@ -0,0 +1,494 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @defgroup nrf_802154_spinel_serialization_pack
+ * 802.15.4 radio driver spinel serialization of fixed-layout data
+ * @{
+ *
+ */
+
+#ifndef NRF_802154_SPINEL_PACK_H_
+#define NRF_802154_SPINEL_PACK_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../spinel_base/spinel.h"
+#include "nrf_802154_spinel_datatypes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Writer producing spinel data of a fixed layout with straight-line code.
+ *
+ * The writer produces the same encoding as @ref spinel_datatype_pack for the corresponding
+ * format string. Like @ref spinel_datatype_pack, it keeps counting the size of the data once
+ * the buffer is full, so the size required for the data can be compared against the buffer size.
+ */
+typedef struct
+{
+    uint8_t * p_data; ///< Buffer to which the data is written.
+    size_t    size;   ///< Size of @ref p_data buffer.
+    size_t    len;    ///< Size of the data written so far, possibly exceeding @ref size.
+    bool      error;  ///< Data that cannot be encoded was written.
+} nrf_802154_spinel_writer_t;
+
+/**
+ * @brief Reader decoding spinel data of a fixed layout with straight-line code.
+ *
+ * The reader accepts the same encoding as @ref spinel_datatype_unpack for the corresponding
+ * format string. Reading past the end of the data sets the error flag and yields zeros.
+ */
+typedef struct
+{
+    const uint8_t * p_data; ///< Data left to be read.
+    size_t          len;    ///< Size of @ref p_data.
+    bool            error;  ///< Data was malformed or too short.
+} nrf_802154_spinel_reader_t;
+
+/**
+ * @brief Initializes a writer.
+ *
+ * @param[out]  p_writer  Writer to be initialized.
+ * @param[in]   p_data    Buffer to which the data is to be written.
+ * @param[in]   size      Size of the @p p_data buffer.
+ */
+static inline void nrf_802154_spinel_writer_init(nrf_802154_spinel_writer_t * p_writer,
+                                                 uint8_t                    * p_data,
+                                                 size_t                       size)
+{
+    p_writer->p_data = p_data;
+    p_writer->size   = size;
+    p_writer->len    = 0U;
+    p_writer->error  = false;
+}
+
+/**
+ * @brief Reserves space for data of a given size in the writer buffer.
+ *
+ * @param[inout]  p_writer  Writer.
+ * @param[in]     size      Size of the data.
+ *
+ * @returns  Pointer to the reserved space or NULL if the data does not fit into the buffer.
+ */
+static inline uint8_t * nrf_802154_spinel_writer_reserve(nrf_802154_spinel_writer_t * p_writer,
+                                                         size_t                       size)
+{
+    uint8_t * p_space = NULL;
+
+    if ((p_writer->len <= p_writer->size) && (size <= (p_writer->size - p_writer->len)))
+    {
+        p_space = &p_writer->p_data[p_writer->len];
+    }
+
+    p_writer->len += size;
+
+    return p_space;
+}
+
+/**
+ * @brief Writes a value encoded as @ref SPINEL_DATATYPE_UINT8_S or @ref SPINEL_DATATYPE_INT8_S.
+ *
+ * @param[inout]  p_writer  Writer.
+ * @param[in]     value     Value to be written.
+ */
+static inline void nrf_802154_spinel_writer_uint8(nrf_802154_spinel_writer_t * p_writer,
+                                                  uint8_t                      value)
+{
+    uint8_t * p_space = nrf_802154_spinel_writer_reserve(p_writer, sizeof(uint8_t));
+
+    if (p_space != NULL)
+    {
+        p_space[0] = value;
+    }
+}
+
+/**
+ * @brief Writes a value encoded as @ref SPINEL_DATATYPE_BOOL_S.
+ *
+ * @param[inout]  p_writer  Writer.
+ * @param[in]     value     Value to be written.
+ */
+static inline void nrf_802154_spinel_writer_bool(nrf_802154_spinel_writer_t * p_writer,
+                                                 bool                         value)
+{
+    nrf_802154_spinel_writer_uint8(p_writer, value ? 1U : 0U);
+}
+
+/**
+ * @brief Writes a value encoded as @ref SPINEL_DATATYPE_UINT16_S.
+ *
+ * @param[inout]  p_writer  Writer.
+ * @param[in]     value     Value to be written.
+ */
+static inline void nrf_802154_spinel_writer_uint16(nrf_802154_spinel_writer_t * p_writer,
+                                                   uint16_t                     value)
+{
+    uint8_t * p_space = nrf_802154_spinel_writer_reserve(p_writer, sizeof(uint16_t));
+
+    if (p_space != NULL)
+    {
+        p_space[0] = (uint8_t)value;
+        p_space[1] = (uint8_t)(value >> 8);
+    }
+}
+
+/**
+ * @brief Writes a value encoded as @ref SPINEL_DATATYPE_UINT32_S.
+ *
+ * @param[inout]  p_writer  Writer.
+ * @param[in]     value     Value to be written.
+ */
+static inline void nrf_802154_spinel_writer_uint32(nrf_802154_spinel_writer_t * p_writer,
+                                                   uint32_t                     value)
+{
+    uint8_t * p_space = nrf_802154_spinel_writer_reserve(p_writer, sizeof(uint32_t));
+
+    if (p_space != NULL)
+    {
+        p_space[0] = (uint8_t)value;
+        p_space[1] = (uint8_t)(value >> 8);
+        p_space[2] = (uint8_t)(value >> 16);
+        p_space[3] = (uint8_t)(value >> 24);
+    }
+}
+
+/**
+ * @brief Writes a value encoded as @ref SPINEL_DATATYPE_UINT64_S.
+ *
+ * @param[inout]  p_writer  Writer.
+ * @param[in]     value     Value to be written.
+ */
+static inline void nrf_802154_spinel_writer_uint64(nrf_802154_spinel_writer_t * p_writer,
+                                                   uint64_t                     value)
+{
+    nrf_802154_spinel_writer_uint32(p_writer, (uint32_t)value);
+    nrf_802154_spinel_writer_uint32(p_writer, (uint32_t)(value >> 32));
+}
+
+/**
+ * @brief Writes a value encoded as @ref SPINEL_DATATYPE_UINT_PACKED_S.
+ *
+ * @param[inout]  p_writer  Writer.
+ * @param[in]     value     Value to be written.
+ */
+static inline void nrf_802154_spinel_writer_packed_uint(nrf_802154_spinel_writer_t * p_writer,
+                                                        uint32_t                     value)
+{
+    if (value >= SPINEL_MAX_UINT_PACKED)
+    {
+        p_writer->error = true;
+        return;
+    }
+
+    do
+    {
+        uint8_t byte = (uint8_t)(value & 0x7FU);
+
+        value >>= 7;
+        nrf_802154_spinel_writer_uint8(p_writer, (value != 0U) ? (byte | 0x80U) : byte);
+    }
+    while (value != 0U);
+}
+
+/**
+ * @brief Writes raw bytes, like the last @ref SPINEL_DATATYPE_DATA_S of a format string.
+ *
+ * @param[inout]  p_writer  Writer.
+ * @param[in]     p_data    Bytes to be written or NULL to write zeros.
+ * @param[in]     data_len  Number of bytes to be written.
+ */
+static inline void nrf_802154_spinel_writer_raw(nrf_802154_spinel_writer_t * p_writer,
+                                                const void                 * p_data,
+                                                size_t                       data_len)
+{
+    uint8_t * p_space = nrf_802154_spinel_writer_reserve(p_writer, data_len);
+
+    if ((p_space != NULL) && (data_len != 0U))
+    {
+        if (p_data != NULL)
+        {
+            memcpy(p_space, p_data, data_len);
+        }
+        else
+        {
+            memset(p_space, 0, data_len);
+        }
+    }
+}
+
+/**
+ * @brief Writes the spinel property key that starts a property value.
+ *
+ * @param[inout]  p_writer  Writer.
+ * @param[in]     property  Property key to be written.
+ */
+static inline void nrf_802154_spinel_writer_prop_key(nrf_802154_spinel_writer_t * p_writer,
+                                                     spinel_prop_key_t            property)
+{
+    nrf_802154_spinel_writer_packed_uint(p_writer, (uint32_t)property);
+}
+
+/**
+ * @brief Writes data with a handle encoded as @ref SPINEL_DATATYPE_NRF_802154_HDATA_S.
+ *
+ * The amount of data written matches @ref NRF_802154_HDATA_ENCODE, which accounts for the size
+ * of the handle in the size of the data.
+ *
+ * @param[inout]  p_writer  Writer.
+ * @param[in]     handle    Handle of the data.
+ * @param[in]     p_data    Data to be written or NULL to write zeros.
+ * @param[in]     data_len  Length of the data, as passed to @ref NRF_802154_HDATA_ENCODE.
+ */
+static inline void nrf_802154_spinel_writer_hdata(nrf_802154_spinel_writer_t * p_writer,
+                                                  uint32_t                     handle,
+                                                  const void                 * p_data,
+                                                  size_t                       data_len)
+{
+    size_t hdata_len = NRF_802154_HDATA_LENGTH(data_len);
+
+    nrf_802154_spinel_writer_uint16(p_writer, (uint16_t)(sizeof(uint32_t) + hdata_len));
+    nrf_802154_spinel_writer_uint32(p_writer, handle);
+    nrf_802154_spinel_writer_raw(p_writer, p_data, hdata_len);
+}
+
+/**
+ * @brief Initializes a reader.
+ *
+ * @param[out]  p_reader  Reader to be initialized.
+ * @param[in]   p_data    Data to be read.
+ * @param[in]   data_len  Size of the @p p_data.
+ */
+static inline void nrf_802154_spinel_reader_init(nrf_802154_spinel_reader_t * p_reader,
+                                                 const void                 * p_data,
+                                                 size_t                       data_len)
+{
+    p_reader->p_data = (const uint8_t *)p_data;
+    p_reader->len    = data_len;
+    p_reader->error  = false;
+}
+
+/**
+ * @brief Consumes data of a given size from the reader.
+ *
+ * @param[inout]  p_reader  Reader.
+ * @param[in]     size      Size of the data.
+ *
+ * @returns  Pointer to the consumed data or NULL if the reader holds less data.
+ */
+static inline const uint8_t * nrf_802154_spinel_reader_consume(
+    nrf_802154_spinel_reader_t * p_reader,
+    size_t                       size)
+{
+    const uint8_t * p_data = NULL;
+
+    if (!p_reader->error && (size <= p_reader->len))
+    {
+        p_data            = p_reader->p_data;
+        p_reader->p_data += size;
+        p_reader->len    -= size;
+    }
+    else
+    {
+        p_reader->error = true;
+    }
+
+    return p_data;
+}
+
+/**
+ * @brief Reads a value encoded as @ref SPINEL_DATATYPE_UINT8_S or @ref SPINEL_DATATYPE_INT8_S.
+ *
+ * @param[inout]  p_reader  Reader.
+ *
+ * @returns  Value read or zero on error.
+ */
+static inline uint8_t nrf_802154_spinel_reader_uint8(nrf_802154_spinel_reader_t * p_reader)
+{
+    const uint8_t * p_data = nrf_802154_spinel_reader_consume(p_reader, sizeof(uint8_t));
+
+    return (p_data != NULL) ? p_data[0] : 0U;
+}
+
+/**
+ * @brief Reads a value encoded as @ref SPINEL_DATATYPE_BOOL_S.
+ *
+ * @param[inout]  p_reader  Reader.
+ *
+ * @returns  Value read or false on error.
+ */
+static inline bool nrf_802154_spinel_reader_bool(nrf_802154_spinel_reader_t * p_reader)
+{
+    return nrf_802154_spinel_reader_uint8(p_reader) != 0U;
+}
+
+/**
+ * @brief Reads a value encoded as @ref SPINEL_DATATYPE_UINT16_S.
+ *
+ * @param[inout]  p_reader  Reader.
+ *
+ * @returns  Value read or zero on error.
+ */
+static inline uint16_t nrf_802154_spinel_reader_uint16(nrf_802154_spinel_reader_t * p_reader)
+{
+    const uint8_t * p_data = nrf_802154_spinel_reader_consume(p_reader, sizeof(uint16_t));
+
+    return (p_data != NULL) ? (uint16_t)(p_data[0] | ((uint16_t)p_data[1] << 8)) : 0U;
+}
+
+/**
+ * @brief Reads a value encoded as @ref SPINEL_DATATYPE_UINT32_S.
+ *
+ * @param[inout]  p_reader  Reader.
+ *
+ * @returns  Value read or zero on error.
+ */
+static inline uint32_t nrf_802154_spinel_reader_uint32(nrf_802154_spinel_reader_t * p_reader)
+{
+    const uint8_t * p_data = nrf_802154_spinel_reader_consume(p_reader, sizeof(uint32_t));
+
+    if (p_data == NULL)
+    {
+        return 0UL;
+    }
+
+    return ((uint32_t)p_data[0]) |
+           ((uint32_t)p_data[1] << 8) |
+           ((uint32_t)p_data[2] << 16) |
+           ((uint32_t)p_data[3] << 24);
+}
+
+/**
+ * @brief Reads a value encoded as @ref SPINEL_DATATYPE_UINT64_S.
+ *
+ * @param[inout]  p_reader  Reader.
+ *
+ * @returns  Value read or zero on error.
+ */
+static inline uint64_t nrf_802154_spinel_reader_uint64(nrf_802154_spinel_reader_t * p_reader)
+{
+    uint64_t low = nrf_802154_spinel_reader_uint32(p_reader);
+
+    return low | ((uint64_t)nrf_802154_spinel_reader_uint32(p_reader) << 32);
+}
+
+/**
+ * @brief Reads a value encoded as @ref SPINEL_DATATYPE_UINT_PACKED_S.
+ *
+ * @param[inout]  p_reader  Reader.
+ *
+ * @returns  Value read or zero on error.
+ */
+static inline uint32_t nrf_802154_spinel_reader_packed_uint(nrf_802154_spinel_reader_t * p_reader)
+{
+    uint32_t value = 0U;
+    uint8_t  byte;
+    uint8_t  shift = 0U;
+
+    do
+    {
+        if (shift >= 32U)
+        {
+            p_reader->error = true;
+            return 0U;
+        }
+
+        byte   = nrf_802154_spinel_reader_uint8(p_reader);
+        value |= (uint32_t)(byte & 0x7FU) << shift;
+        shift += 7U;
+    }
+    while ((byte & 0x80U) && !p_reader->error);
+
+    return p_reader->error ? 0U : value;
+}
+
+/**
+ * @brief Reads the size prefix of a structure or of a @ref SPINEL_DATATYPE_DATA_S that is not
+ *        the last item of a format string.
+ *
+ * @param[inout]  p_reader  Reader.
+ *
+ * @returns  Size of the block that follows the prefix or zero on error.
+ */
+static inline size_t nrf_802154_spinel_reader_block_len(nrf_802154_spinel_reader_t * p_reader)
+{
+    size_t block_len = nrf_802154_spinel_reader_uint16(p_reader);
+
+    if ((block_len >= SPINEL_FRAME_MAX_SIZE) || (block_len > p_reader->len))
+    {
+        p_reader->error = true;
+        block_len       = 0U;
+    }
+
+    return block_len;
+}
+
+/**
+ * @brief Reads data with a handle encoded as @ref SPINEL_DATATYPE_NRF_802154_HDATA_S.
+ *
+ * @param[inout]  p_reader     Reader.
+ * @param[out]    p_handle     Handle of the data.
+ * @param[out]    pp_data      Pointer to the data.
+ * @param[out]    p_hdata_len  Length of the data, as produced by @ref NRF_802154_HDATA_DECODE.
+ */
+static inline void nrf_802154_spinel_reader_hdata(nrf_802154_spinel_reader_t * p_reader,
+                                                  uint32_t                   * p_handle,
+                                                  const void                ** pp_data,
+                                                  size_t                     * p_hdata_len)
+{
+    size_t block_len = nrf_802154_spinel_reader_block_len(p_reader);
+
+    if (block_len < sizeof(uint32_t))
+    {
+        p_reader->error = true;
+        block_len       = sizeof(uint32_t);
+    }
+
+    *p_handle    = nrf_802154_spinel_reader_uint32(p_reader);
+    *pp_data     = nrf_802154_spinel_reader_consume(p_reader, block_len - sizeof(uint32_t));
+    *p_hdata_len = block_len - sizeof(uint32_t);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_802154_SPINEL_PACK_H_ */
+
+/** @} */
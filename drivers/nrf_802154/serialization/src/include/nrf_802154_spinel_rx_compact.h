@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file nrf_802154_spinel_rx_compact.h
+ * @brief Compact encoding of received frame notifications.
+ *
+ * When the compact encoding is enabled, the handle and the timestamp of a received frame are
+ * notified as differences from the ones of the previously notified frame. Both cores keep
+ * a copy of that reference. The network core falls back to the regular notification whenever
+ * the differences cannot be represented, which also resynchronizes the reference.
+ */
+
+#ifndef NRF_802154_SPINEL_RX_COMPACT_H__
+#define NRF_802154_SPINEL_RX_COMPACT_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_serialization_config.h"
+
+#if NRF_802154_SER_COMPACT_RX_ENABLED
+
+/**
+ * @brief Initializes the compact encoding.
+ *
+ * The compact encoding is disabled and the reference is invalidated.
+ */
+void nrf_802154_spinel_rx_compact_init(void);
+
+/**
+ * @brief Enables the compact encoding.
+ *
+ * The reference is invalidated, so the next received frame is notified in the regular way.
+ * The function is to be called by the network core only.
+ */
+void nrf_802154_spinel_rx_compact_enable(void);
+
+/**
+ * @brief Checks if the compact encoding is enabled.
+ *
+ * @retval true   The compact encoding is enabled.
+ * @retval false  The compact encoding is disabled.
+ */
+bool nrf_802154_spinel_rx_compact_is_enabled(void);
+
+/**
+ * @brief Calculates the differences from the reference.
+ *
+ * The function is to be called by the network core only.
+ *
+ * @param[in]  handle          Handle of the received frame.
+ * @param[in]  time            Timestamp of the received frame.
+ * @param[out] p_handle_delta  Zigzag-encoded difference of the handles.
+ * @param[out] p_time_delta    Difference of the timestamps.
+ *
+ * @retval true   The differences can be encoded in a compact notification.
+ * @retval false  The frame must be notified in the regular way.
+ */
+bool nrf_802154_spinel_rx_compact_delta_get(uint32_t   handle,
+                                            uint64_t   time,
+                                            uint32_t * p_handle_delta,
+                                            uint32_t * p_time_delta);
+
+/**
+ * @brief Restores a handle and a timestamp from the differences from the reference.
+ *
+ * The function is to be called by the application core only.
+ *
+ * @param[in]  handle_delta  Zigzag-encoded difference of the handles.
+ * @param[in]  time_delta    Difference of the timestamps.
+ * @param[out] p_handle      Handle of the received frame.
+ * @param[out] p_time        Timestamp of the received frame.
+ *
+ * @retval true   The handle and the timestamp were restored.
+ * @retval false  There is no valid reference.
+ */
+bool nrf_802154_spinel_rx_compact_delta_apply(uint32_t   handle_delta,
+                                              uint32_t   time_delta,
+                                              uint32_t * p_handle,
+                                              uint64_t * p_time);
+
+/**
+ * @brief Sets the reference to the handle and the timestamp of a notified frame.
+ *
+ * @param[in]  handle  Handle of the notified frame.
+ * @param[in]  time    Timestamp of the notified frame.
+ */
+void nrf_802154_spinel_rx_compact_ref_update(uint32_t handle, uint64_t time);
+
+#endif // NRF_802154_SER_COMPACT_RX_ENABLED
+
+#endif // NRF_802154_SPINEL_RX_COMPACT_H__
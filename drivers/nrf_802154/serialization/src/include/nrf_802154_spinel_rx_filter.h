@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file nrf_802154_spinel_rx_filter.h
+ * @brief Received frames filter of the network core.
+ *
+ * The filter holds the rules programmed by the application core with
+ * @ref nrf_802154_serialization_rx_filter_rule_add. Rules are modified from the context that
+ * decodes requests and are evaluated from the context that notifies received frames.
+ */
+
+#ifndef NRF_802154_SPINEL_RX_FILTER_H__
+#define NRF_802154_SPINEL_RX_FILTER_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_serialization.h"
+#include "nrf_802154_serialization_config.h"
+
+#if NRF_802154_SER_RX_FILTER_ENABLED
+
+/**
+ * @brief Adds a rule at the end of the filter.
+ *
+ * @param[in]  p_rule  Rule to be added.
+ *
+ * @retval true   The rule was added.
+ * @retval false  The filter is full.
+ */
+bool nrf_802154_spinel_rx_filter_rule_add(const nrf_802154_ser_rx_filter_rule_t * p_rule);
+
+/**
+ * @brief Removes all rules of the filter.
+ */
+void nrf_802154_spinel_rx_filter_clear(void);
+
+/**
+ * @brief Checks if a received frame is to be notified to the application core.
+ *
+ * @param[in]  p_data  Received frame, starting with the PHR.
+ *
+ * @retval true   The frame is to be notified.
+ * @retval false  The frame is to be dropped.
+ */
+bool nrf_802154_spinel_rx_filter_frame_passes(const uint8_t * p_data);
+
+#endif // NRF_802154_SER_RX_FILTER_ENABLED
+
+#endif // NRF_802154_SPINEL_RX_FILTER_H__
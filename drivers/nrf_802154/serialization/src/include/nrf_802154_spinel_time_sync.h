@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file nrf_802154_spinel_time_sync.h
+ * @brief Synchronization of the radio time to the local time of the application core.
+ *
+ * The radio time is estimated from the local time with an offset and a drift measured from
+ * samples of the radio time. A sample is the radio time read from the network core together
+ * with the local times at which the request was sent and the response was received.
+ * The radio time is assumed to have been read in the middle of that interval.
+ */
+
+#ifndef NRF_802154_SPINEL_TIME_SYNC_H__
+#define NRF_802154_SPINEL_TIME_SYNC_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_serialization_config.h"
+
+#if NRF_802154_SER_TIME_SYNC_ENABLED
+
+/**
+ * @brief Initializes the time synchronization.
+ *
+ * The estimate is invalidated.
+ */
+void nrf_802154_spinel_time_sync_init(void);
+
+/**
+ * @brief Updates the estimate with a sample of the radio time.
+ *
+ * @param[in]  local_sent      Local time at which the radio time was requested.
+ * @param[in]  radio_time      Radio time read by the network core.
+ * @param[in]  local_received  Local time at which the radio time was received.
+ *
+ * @retval true   The estimate was updated.
+ * @retval false  The sample was discarded because of its round trip time.
+ */
+bool nrf_802154_spinel_time_sync_sample_add(uint64_t local_sent,
+                                            uint64_t radio_time,
+                                            uint64_t local_received);
+
+/**
+ * @brief Converts a local time to the radio time.
+ *
+ * @param[in]  local_time    Local time.
+ * @param[out] p_radio_time  Corresponding radio time.
+ *
+ * @retval true   The time was converted.
+ * @retval false  There is no valid estimate or it is older than
+ *                @ref NRF_802154_SER_TIME_SYNC_PERIOD_US.
+ */
+bool nrf_802154_spinel_time_sync_to_radio(uint64_t local_time, uint64_t * p_radio_time);
+
+/**
+ * @brief Converts a radio time to the local time.
+ *
+ * @param[in]  radio_time    Radio time.
+ * @param[out] p_local_time  Corresponding local time.
+ *
+ * @retval true   The time was converted.
+ * @retval false  There is no valid estimate or it is older than
+ *                @ref NRF_802154_SER_TIME_SYNC_PERIOD_US.
+ */
+bool nrf_802154_spinel_time_sync_to_local(uint64_t radio_time, uint64_t * p_local_time);
+
+#endif // NRF_802154_SER_TIME_SYNC_ENABLED
+
+#endif // NRF_802154_SPINEL_TIME_SYNC_H__
@@ -136,3 +136,22 @@ void nrf_802154_buffer_allocator_free(const nrf_802154_buffer_allocator_t * p_ob
 {
     buffer_free(p_buffer, (nrf_802154_buffer_t *)p_obj->p_memory, p_obj->capacity);
 }
+
+bool nrf_802154_buffer_allocator_index_get(const nrf_802154_buffer_allocator_t * p_obj,
+                                           const void                          * p_buffer,
+                                           size_t                              * p_idx)
+{
+    uintptr_t offset = (uintptr_t)p_buffer - (uintptr_t)p_obj->p_memory;
+    size_t    idx    = offset / sizeof(nrf_802154_buffer_t);
+
+    if (((uintptr_t)p_buffer < (uintptr_t)p_obj->p_memory) ||
+        ((offset % sizeof(nrf_802154_buffer_t)) != 0U) ||
+        (idx >= p_obj->capacity))
+    {
+        return false;
+    }
+
+    *p_idx = idx;
+
+    return true;
+}
@@ -38,26 +38,90 @@
 
 #include "nrf_802154_buffer_mgr_dst.h"
 
+#include "nrf_802154_serialization_crit_sect.h"
+
 #include <assert.h>
 #include <string.h>
 
-void nrf_802154_buffer_mgr_dst_init(
-    nrf_802154_buffer_mgr_dst_t * p_obj,
-    void                        * p_map_memory,
-    void                        * p_allocator_memory,
-    size_t                        buffers_count)
+#if NRF_802154_SER_BUFFER_SLAB_ENABLED
+
+static void allocator_init(nrf_802154_buffer_mgr_dst_allocator_t * p_allocator,
+                           void                                  * p_memory,
+                           size_t                                  buffers_count)
+{
+    nrf_802154_buffer_slab_init(p_allocator,
+                                p_memory,
+                                NRF_802154_SER_BUFFER_SLAB_ACK_BUFFERS,
+                                NRF_802154_SER_BUFFER_SLAB_SHORT_BUFFERS,
+                                buffers_count);
+}
+
+static void * allocator_alloc(nrf_802154_buffer_mgr_dst_allocator_t * p_allocator, size_t size)
+{
+    return nrf_802154_buffer_slab_alloc(p_allocator, size);
+}
+
+static void allocator_free(nrf_802154_buffer_mgr_dst_allocator_t * p_allocator, void * p_buffer)
+{
+    nrf_802154_buffer_slab_free(p_allocator, p_buffer);
+}
+
+static bool allocator_index_get(const nrf_802154_buffer_mgr_dst_allocator_t * p_allocator,
+                                const void                                  * p_buffer,
+                                size_t                                      * p_idx)
+{
+    return nrf_802154_buffer_slab_index_get(p_allocator, p_buffer, p_idx);
+}
+
+#else // NRF_802154_SER_BUFFER_SLAB_ENABLED
+
+static void allocator_init(nrf_802154_buffer_mgr_dst_allocator_t * p_allocator,
+                           void                                  * p_memory,
+                           size_t                                  buffers_count)
 {
-    nrf_802154_kvmap_init(&p_obj->map,
-                          p_map_memory,
-                          NRF_802154_BUFFER_MGR_DST_MAP_MEMSIZE(buffers_count),
-                          sizeof(void *),
-                          sizeof(uint32_t));
-
-    nrf_802154_buffer_allocator_init(&p_obj->allocator,
-                                     p_allocator_memory,
+    nrf_802154_buffer_allocator_init(p_allocator,
+                                     p_memory,
                                      NRF_802154_BUFFER_ALLOCATOR_MEMORY_SIZE(buffers_count));
 }
 
+static void * allocator_alloc(nrf_802154_buffer_mgr_dst_allocator_t * p_allocator, size_t size)
+{
+    assert(size <= NRF_802154_BUFFER_ALLOCATOR_DEFAULT_BUFFER_LEN);
+    (void)size;
+
+    return nrf_802154_buffer_allocator_alloc(p_allocator);
+}
+
+static void allocator_free(nrf_802154_buffer_mgr_dst_allocator_t * p_allocator, void * p_buffer)
+{
+    nrf_802154_buffer_allocator_free(p_allocator, p_buffer);
+}
+
+static bool allocator_index_get(const nrf_802154_buffer_mgr_dst_allocator_t * p_allocator,
+                                const void                                  * p_buffer,
+                                size_t                                      * p_idx)
+{
+    return nrf_802154_buffer_allocator_index_get(p_allocator, p_buffer, p_idx);
+}
+
+#endif // NRF_802154_SER_BUFFER_SLAB_ENABLED
+
+void nrf_802154_buffer_mgr_dst_init(
+    nrf_802154_buffer_mgr_dst_t      * p_obj,
+    nrf_802154_buffer_mgr_dst_slot_t * p_slots,
+    void                             * p_allocator_memory,
+    size_t                             buffers_count)
+{
+    p_obj->p_slots = p_slots;
+
+    for (size_t i = 0; i < NRF_802154_BUFFER_MGR_DST_SLOTS_COUNT(buffers_count); i++)
+    {
+        p_slots[i].valid = false;
+    }
+
+    allocator_init(&p_obj->allocator, p_allocator_memory, buffers_count);
+}
+
 bool nrf_802154_buffer_mgr_dst_add(
     nrf_802154_buffer_mgr_dst_t * p_obj,
     uint32_t                      buffer_handle,
@@ -65,19 +129,24 @@ bool nrf_802154_buffer_mgr_dst_add(
     size_t                        data_size,
     void                       ** pp_local_pointer)
 {
-    bool result = false;
+    bool   result = false;
+    size_t idx;
 
-    *pp_local_pointer = nrf_802154_buffer_allocator_alloc(&p_obj->allocator);
+    *pp_local_pointer = allocator_alloc(&p_obj->allocator, data_size);
 
     if (*pp_local_pointer != NULL)
     {
         memcpy(*pp_local_pointer, p_data, data_size);
-        result = nrf_802154_kvmap_add(&p_obj->map, pp_local_pointer, &buffer_handle);
 
-        /* Allocator is a pool allocator of fixed size.
-         * If allocator managed to allocate, there must be place in the map.
+        result = allocator_index_get(&p_obj->allocator, *pp_local_pointer, &idx);
+
+        /* Every buffer of the allocator has its own slot. The slot of a buffer that has just been
+         * allocated is not used by anyone else.
          */
         assert(result);
+
+        p_obj->p_slots[idx].buffer_handle = buffer_handle;
+        p_obj->p_slots[idx].valid         = true;
     }
 
     return result;
@@ -88,19 +157,54 @@ bool nrf_802154_buffer_mgr_dst_search_by_local_pointer(
     void                        * p_local_pointer,
     uint32_t                    * p_buffer_handle)
 {
-    return nrf_802154_kvmap_search(&p_obj->map, &p_local_pointer, p_buffer_handle);
+    bool     result    = false;
+    size_t   idx;
+    uint32_t crit_sect = 0UL;
+
+    if (!allocator_index_get(&p_obj->allocator, p_local_pointer, &idx))
+    {
+        return false;
+    }
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    if (p_obj->p_slots[idx].valid)
+    {
+        *p_buffer_handle = p_obj->p_slots[idx].buffer_handle;
+        result           = true;
+    }
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    return result;
 }
 
 bool nrf_802154_buffer_mgr_dst_remove_by_local_pointer(
     nrf_802154_buffer_mgr_dst_t * p_obj,
     void                        * p_local_pointer)
 {
-    bool result;
+    bool     result    = false;
+    size_t   idx;
+    uint32_t crit_sect = 0UL;
+
+    if (!allocator_index_get(&p_obj->allocator, p_local_pointer, &idx))
+    {
+        return false;
+    }
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    if (p_obj->p_slots[idx].valid)
+    {
+        p_obj->p_slots[idx].valid = false;
+        result                    = true;
+    }
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
 
-    result = nrf_802154_kvmap_remove(&p_obj->map, &p_local_pointer);
     if (result)
     {
-        nrf_802154_buffer_allocator_free(&p_obj->allocator, p_local_pointer);
+        allocator_free(&p_obj->allocator, p_local_pointer);
     }
 
     return result;
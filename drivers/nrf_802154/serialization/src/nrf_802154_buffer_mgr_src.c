@@ -34,29 +34,36 @@
 
 /**@file nrf_802154_buffer_mgr_src.c
  * @brief Buffer management on source side of a buffer of a nRF 802.15.4 serialization.
- *
- * @note Implementation valid for 32-bit architectures only
  */
 
 #include "nrf_802154_buffer_mgr_src.h"
 
+#include "nrf_802154_serialization_crit_sect.h"
+
 #include <assert.h>
 
+#define SLOT_IDX_BITS 8U                           ///< Number of handle bits holding the slot index.
+#define SLOT_IDX_MASK ((1U << SLOT_IDX_BITS) - 1U) ///< Mask of handle bits holding the slot index.
+#define SLOT_NONE     UINT16_MAX                   ///< Index marking the end of the free slots list.
+
 void nrf_802154_buffer_mgr_src_init(
-    nrf_802154_buffer_mgr_src_t * p_obj,
-    void                        * p_map_memory,
-    size_t                        buffers_count)
+    nrf_802154_buffer_mgr_src_t      * p_obj,
+    nrf_802154_buffer_mgr_src_slot_t * p_slots,
+    size_t                             buffers_count)
 {
-    /* Implementation is for 32-bit architectures only
-     * When this is not true we need mapping uint32->void*
-     * When this is true only presence of buffer handle can be checked */
-    assert(sizeof(void *) == sizeof(uint32_t) );
-
-    nrf_802154_kvmap_init(&p_obj->map,
-                          p_map_memory,
-                          NRF_802154_BUFFER_MGR_SRC_MAP_MEMSIZE(buffers_count),
-                          sizeof(uint32_t),
-                          0U);
+    assert(buffers_count <= NRF_802154_BUFFER_MGR_SRC_BUFFERS_MAX);
+
+    p_obj->p_slots     = p_slots;
+    p_obj->slots_count = (uint16_t)buffers_count;
+    p_obj->free_head   = (buffers_count != 0U) ? 0U : SLOT_NONE;
+    p_obj->sequence    = 0U;
+
+    for (size_t i = 0; i < buffers_count; i++)
+    {
+        p_slots[i].p_buffer      = NULL;
+        p_slots[i].buffer_handle = 0U;
+        p_slots[i].next_free     = ((i + 1U) < buffers_count) ? (uint16_t)(i + 1U) : SLOT_NONE;
+    }
 }
 
 bool nrf_802154_buffer_mgr_src_add(
@@ -64,15 +71,30 @@ bool nrf_802154_buffer_mgr_src_add(
     const void                  * p_buffer,
     uint32_t                    * p_buffer_handle)
 {
-    bool     result;
-    uint32_t buffer_handle = (uintptr_t)p_buffer;
+    bool     result    = false;
+    uint32_t crit_sect = 0UL;
 
-    result = nrf_802154_kvmap_add(&p_obj->map, &buffer_handle, NULL);
-    if (result)
+    assert(p_buffer != NULL);
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    uint16_t idx = p_obj->free_head;
+
+    if (idx != SLOT_NONE)
     {
-        *p_buffer_handle = buffer_handle;
+        nrf_802154_buffer_mgr_src_slot_t * p_slot = &p_obj->p_slots[idx];
+
+        p_obj->free_head = p_slot->next_free;
+        p_obj->sequence++;
+
+        p_slot->p_buffer      = p_buffer;
+        p_slot->buffer_handle = (p_obj->sequence << SLOT_IDX_BITS) | idx;
+        *p_buffer_handle      = p_slot->buffer_handle;
+        result                = true;
     }
 
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
     return result;
 }
 
@@ -81,13 +103,27 @@ bool nrf_802154_buffer_mgr_src_search_by_buffer_handle(
     uint32_t                      buffer_handle,
     void                       ** pp_buffer)
 {
-    bool result = false;
+    bool     result    = false;
+    uint32_t idx       = buffer_handle & SLOT_IDX_MASK;
+    uint32_t crit_sect = 0UL;
+
+    if (idx >= p_obj->slots_count)
+    {
+        return false;
+    }
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
 
-    if (nrf_802154_kvmap_search(&p_obj->map, &buffer_handle, NULL))
+    const nrf_802154_buffer_mgr_src_slot_t * p_slot = &p_obj->p_slots[idx];
+
+    if ((p_slot->p_buffer != NULL) && (p_slot->buffer_handle == buffer_handle))
     {
-        *pp_buffer = (void *)buffer_handle;
+        *pp_buffer = (void *)p_slot->p_buffer;
         result     = true;
     }
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
     return result;
 }
 
@@ -95,5 +131,28 @@ bool nrf_802154_buffer_mgr_src_remove_by_buffer_handle(
     nrf_802154_buffer_mgr_src_t * p_obj,
     uint32_t                      buffer_handle)
 {
-    return nrf_802154_kvmap_remove(&p_obj->map, &buffer_handle);
+    bool     result    = false;
+    uint32_t idx       = buffer_handle & SLOT_IDX_MASK;
+    uint32_t crit_sect = 0UL;
+
+    if (idx >= p_obj->slots_count)
+    {
+        return false;
+    }
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    nrf_802154_buffer_mgr_src_slot_t * p_slot = &p_obj->p_slots[idx];
+
+    if ((p_slot->p_buffer != NULL) && (p_slot->buffer_handle == buffer_handle))
+    {
+        p_slot->p_buffer  = NULL;
+        p_slot->next_free = p_obj->free_head;
+        p_obj->free_head  = (uint16_t)idx;
+        result            = true;
+    }
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    return result;
 }
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file nrf_802154_buffer_slab.c
+ * @brief Size-class buffer allocation for 802.15.4 receptions and transmissions.
+ */
+
+#include "nrf_802154_buffer_slab.h"
+
+#include "nrfx.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#define LINK_NONE UINT8_MAX ///< Link value terminating the list of free buffers of a pool.
+
+static const uint16_t m_buffer_lens[NRF_802154_BUFFER_SLAB_POOLS] =
+{
+    NRF_802154_BUFFER_SLAB_ACK_BUFFER_LEN,
+    NRF_802154_BUFFER_SLAB_SHORT_BUFFER_LEN,
+    NRF_802154_BUFFER_SLAB_FULL_BUFFER_LEN,
+};
+
+static void * pool_pop(nrf_802154_buffer_slab_pool_t * p_pool)
+{
+    uint8_t head;
+
+    do
+    {
+        head = __LDREXB(&p_pool->head);
+
+        if (head == LINK_NONE)
+        {
+            // The pool is exhausted.
+            __CLREX();
+            return NULL;
+        }
+    }
+    while (__STREXB(p_pool->p_links[head], &p_pool->head));
+
+    __DMB();
+
+    return &p_pool->p_buffers[head * p_pool->buffer_len];
+}
+
+static void pool_push(nrf_802154_buffer_slab_pool_t * p_pool, uint8_t idx)
+{
+    uint8_t head;
+
+    __DMB();
+
+    do
+    {
+        head                 = __LDREXB(&p_pool->head);
+        p_pool->p_links[idx] = head;
+    }
+    while (__STREXB(idx, &p_pool->head));
+}
+
+static bool pool_index_get(const nrf_802154_buffer_slab_pool_t * p_pool,
+                           const void                          * p_buffer,
+                           uint8_t                             * p_idx)
+{
+    uintptr_t offset = (uintptr_t)p_buffer - (uintptr_t)p_pool->p_buffers;
+    size_t    idx    = offset / p_pool->buffer_len;
+
+    if (((uintptr_t)p_buffer < (uintptr_t)p_pool->p_buffers) ||
+        ((offset % p_pool->buffer_len) != 0U) ||
+        (idx >= p_pool->capacity))
+    {
+        return false;
+    }
+
+    *p_idx = (uint8_t)idx;
+
+    return true;
+}
+
+void nrf_802154_buffer_slab_init(nrf_802154_buffer_slab_t * p_obj,
+                                 void                     * p_memory,
+                                 size_t                     ack_count,
+                                 size_t                     short_count,
+                                 size_t                     full_count)
+{
+    const size_t counts[NRF_802154_BUFFER_SLAB_POOLS] = {ack_count, short_count, full_count};
+    uint8_t    * p_buffers                            = (uint8_t *)p_memory;
+    uint8_t    * p_links;
+    size_t       first_idx                            = 0U;
+
+    p_obj->capacity = ack_count + short_count + full_count;
+
+    assert((p_obj->capacity == 0U) || (p_memory != NULL));
+    assert(p_obj->capacity <= UINT16_MAX);
+
+    // Links of all pools follow the buffers of all pools.
+    p_links = p_buffers;
+
+    for (uint32_t i = 0; i < NRF_802154_BUFFER_SLAB_POOLS; i++)
+    {
+        p_links += counts[i] * m_buffer_lens[i];
+    }
+
+    for (uint32_t i = 0; i < NRF_802154_BUFFER_SLAB_POOLS; i++)
+    {
+        nrf_802154_buffer_slab_pool_t * p_pool = &p_obj->pools[i];
+
+        assert(counts[i] <= NRF_802154_BUFFER_SLAB_POOL_CAPACITY);
+
+        p_pool->p_buffers  = p_buffers;
+        p_pool->p_links    = p_links;
+        p_pool->buffer_len = m_buffer_lens[i];
+        p_pool->capacity   = (uint8_t)counts[i];
+        p_pool->first_idx  = (uint16_t)first_idx;
+        p_pool->head       = (counts[i] != 0U) ? 0U : LINK_NONE;
+
+        for (uint8_t j = 0U; j < p_pool->capacity; j++)
+        {
+            p_links[j] = ((j + 1U) < p_pool->capacity) ? (j + 1U) : LINK_NONE;
+        }
+
+        p_buffers += counts[i] * m_buffer_lens[i];
+        p_links   += counts[i];
+        first_idx += counts[i];
+    }
+}
+
+void * nrf_802154_buffer_slab_alloc(nrf_802154_buffer_slab_t * p_obj, size_t size)
+{
+    void * p_buffer = NULL;
+
+    for (uint32_t i = 0; (i < NRF_802154_BUFFER_SLAB_POOLS) && (p_buffer == NULL); i++)
+    {
+        if (size <= p_obj->pools[i].buffer_len)
+        {
+            p_buffer = pool_pop(&p_obj->pools[i]);
+        }
+    }
+
+    return p_buffer;
+}
+
+void nrf_802154_buffer_slab_free(nrf_802154_buffer_slab_t * p_obj, void * p_buffer)
+{
+    uint8_t idx;
+
+    for (uint32_t i = 0; i < NRF_802154_BUFFER_SLAB_POOLS; i++)
+    {
+        if (pool_index_get(&p_obj->pools[i], p_buffer, &idx))
+        {
+            pool_push(&p_obj->pools[i], idx);
+            return;
+        }
+    }
+
+    // The buffer does not belong to the slab allocator.
+    assert(false);
+}
+
+bool nrf_802154_buffer_slab_index_get(const nrf_802154_buffer_slab_t * p_obj,
+                                      const void                     * p_buffer,
+                                      size_t                         * p_idx)
+{
+    uint8_t idx;
+
+    for (uint32_t i = 0; i < NRF_802154_BUFFER_SLAB_POOLS; i++)
+    {
+        if (pool_index_get(&p_obj->pools[i], p_buffer, &idx))
+        {
+            *p_idx = p_obj->pools[i].first_idx + idx;
+            return true;
+        }
+    }
+
+    return false;
+}
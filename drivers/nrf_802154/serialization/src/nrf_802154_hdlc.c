@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file nrf_802154_hdlc.c
+ * @brief HDLC-lite framing of spinel frames sent over byte streams.
+ */
+
+#include "nrf_802154_hdlc.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#define ESCAPE_XOR       0x20   ///< Value applied with XOR to escaped bytes.
+#define FCS_GOOD         0xF0B8 ///< Frame check sequence of a frame followed by its valid FCS.
+
+#define XON_BYTE         0x11   ///< Software flow control resume byte, escaped by spinel hosts.
+#define XOFF_BYTE        0x13   ///< Software flow control pause byte, escaped by spinel hosts.
+#define SPECIAL_BYTE     0xF8   ///< Byte reserved by spinel hosts, escaped for compatibility.
+
+/** @brief Frame check sequence of every single byte, for the reflected polynomial 0x8408. */
+static const uint16_t m_fcs_table[256] =
+{
+    0x0000, 0x1189, 0x2312, 0x329B, 0x4624, 0x57AD, 0x6536, 0x74BF,
+    0x8C48, 0x9DC1, 0xAF5A, 0xBED3, 0xCA6C, 0xDBE5, 0xE97E, 0xF8F7,
+    0x1081, 0x0108, 0x3393, 0x221A, 0x56A5, 0x472C, 0x75B7, 0x643E,
+    0x9CC9, 0x8D40, 0xBFDB, 0xAE52, 0xDAED, 0xCB64, 0xF9FF, 0xE876,
+    0x2102, 0x308B, 0x0210, 0x1399, 0x6726, 0x76AF, 0x4434, 0x55BD,
+    0xAD4A, 0xBCC3, 0x8E58, 0x9FD1, 0xEB6E, 0xFAE7, 0xC87C, 0xD9F5,
+    0x3183, 0x200A, 0x1291, 0x0318, 0x77A7, 0x662E, 0x54B5, 0x453C,
+    0xBDCB, 0xAC42, 0x9ED9, 0x8F50, 0xFBEF, 0xEA66, 0xD8FD, 0xC974,
+    0x4204, 0x538D, 0x6116, 0x709F, 0x0420, 0x15A9, 0x2732, 0x36BB,
+    0xCE4C, 0xDFC5, 0xED5E, 0xFCD7, 0x8868, 0x99E1, 0xAB7A, 0xBAF3,
+    0x5285, 0x430C, 0x7197, 0x601E, 0x14A1, 0x0528, 0x37B3, 0x263A,
+    0xDECD, 0xCF44, 0xFDDF, 0xEC56, 0x98E9, 0x8960, 0xBBFB, 0xAA72,
+    0x6306, 0x728F, 0x4014, 0x519D, 0x2522, 0x34AB, 0x0630, 0x17B9,
+    0xEF4E, 0xFEC7, 0xCC5C, 0xDDD5, 0xA96A, 0xB8E3, 0x8A78, 0x9BF1,
+    0x7387, 0x620E, 0x5095, 0x411C, 0x35A3, 0x242A, 0x16B1, 0x0738,
+    0xFFCF, 0xEE46, 0xDCDD, 0xCD54, 0xB9EB, 0xA862, 0x9AF9, 0x8B70,
+    0x8408, 0x9581, 0xA71A, 0xB693, 0xC22C, 0xD3A5, 0xE13E, 0xF0B7,
+    0x0840, 0x19C9, 0x2B52, 0x3ADB, 0x4E64, 0x5FED, 0x6D76, 0x7CFF,
+    0x9489, 0x8500, 0xB79B, 0xA612, 0xD2AD, 0xC324, 0xF1BF, 0xE036,
+    0x18C1, 0x0948, 0x3BD3, 0x2A5A, 0x5EE5, 0x4F6C, 0x7DF7, 0x6C7E,
+    0xA50A, 0xB483, 0x8618, 0x9791, 0xE32E, 0xF2A7, 0xC03C, 0xD1B5,
+    0x2942, 0x38CB, 0x0A50, 0x1BD9, 0x6F66, 0x7EEF, 0x4C74, 0x5DFD,
+    0xB58B, 0xA402, 0x9699, 0x8710, 0xF3AF, 0xE226, 0xD0BD, 0xC134,
+    0x39C3, 0x284A, 0x1AD1, 0x0B58, 0x7FE7, 0x6E6E, 0x5CF5, 0x4D7C,
+    0xC60C, 0xD785, 0xE51E, 0xF497, 0x8028, 0x91A1, 0xA33A, 0xB2B3,
+    0x4A44, 0x5BCD, 0x6956, 0x78DF, 0x0C60, 0x1DE9, 0x2F72, 0x3EFB,
+    0xD68D, 0xC704, 0xF59F, 0xE416, 0x90A9, 0x8120, 0xB3BB, 0xA232,
+    0x5AC5, 0x4B4C, 0x79D7, 0x685E, 0x1CE1, 0x0D68, 0x3FF3, 0x2E7A,
+    0xE70E, 0xF687, 0xC41C, 0xD595, 0xA12A, 0xB0A3, 0x8238, 0x93B1,
+    0x6B46, 0x7ACF, 0x4854, 0x59DD, 0x2D62, 0x3CEB, 0x0E70, 0x1FF9,
+    0xF78F, 0xE606, 0xD49D, 0xC514, 0xB1AB, 0xA022, 0x92B9, 0x8330,
+    0x7BC7, 0x6A4E, 0x58D5, 0x495C, 0x3DE3, 0x2C6A, 0x1EF1, 0x0F78,
+};
+
+static inline uint16_t fcs_byte_update(uint16_t fcs, uint8_t byte)
+{
+    return (fcs >> 8) ^ m_fcs_table[(fcs ^ byte) & 0xFF];
+}
+
+static inline bool byte_needs_escape(uint8_t byte)
+{
+    switch (byte)
+    {
+        case NRF_802154_HDLC_FLAG_BYTE:
+        case NRF_802154_HDLC_ESCAPE_BYTE:
+        case XON_BYTE:
+        case XOFF_BYTE:
+        case SPECIAL_BYTE:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Writes a byte of a frame to the output, escaping it if needed.
+ *
+ * @returns  Number of bytes written or zero if the byte does not fit in the output.
+ */
+static inline size_t byte_encode(uint8_t byte, uint8_t * p_out, size_t out_size)
+{
+    if (byte_needs_escape(byte))
+    {
+        if (out_size < 2)
+        {
+            return 0;
+        }
+
+        p_out[0] = NRF_802154_HDLC_ESCAPE_BYTE;
+        p_out[1] = byte ^ ESCAPE_XOR;
+        return 2;
+    }
+
+    if (out_size < 1)
+    {
+        return 0;
+    }
+
+    p_out[0] = byte;
+    return 1;
+}
+
+uint16_t nrf_802154_hdlc_fcs_update(uint16_t fcs, const uint8_t * p_data, size_t data_len)
+{
+    for (size_t i = 0; i < data_len; i++)
+    {
+        fcs = fcs_byte_update(fcs, p_data[i]);
+    }
+
+    return fcs;
+}
+
+size_t nrf_802154_hdlc_encoded_size(const uint8_t * p_data, size_t data_len)
+{
+    uint16_t fcs  = NRF_802154_HDLC_FCS_INIT;
+    size_t   size = data_len + NRF_802154_HDLC_FCS_SIZE + 2;
+
+    for (size_t i = 0; i < data_len; i++)
+    {
+        fcs   = fcs_byte_update(fcs, p_data[i]);
+        size += byte_needs_escape(p_data[i]) ? 1 : 0;
+    }
+
+    fcs   = ~fcs;
+    size += byte_needs_escape((uint8_t)fcs) ? 1 : 0;
+    size += byte_needs_escape((uint8_t)(fcs >> 8)) ? 1 : 0;
+
+    return size;
+}
+
+size_t nrf_802154_hdlc_encode(const uint8_t * p_data,
+                              size_t          data_len,
+                              uint8_t       * p_out,
+                              size_t          out_size)
+{
+    uint16_t fcs = NRF_802154_HDLC_FCS_INIT;
+    size_t   pos = 0;
+    size_t   written;
+
+    if (out_size < 2)
+    {
+        return 0;
+    }
+
+    p_out[pos++] = NRF_802154_HDLC_FLAG_BYTE;
+
+    for (size_t i = 0; i < data_len; i++)
+    {
+        fcs     = fcs_byte_update(fcs, p_data[i]);
+        written = byte_encode(p_data[i], &p_out[pos], out_size - pos);
+
+        if (written == 0)
+        {
+            return 0;
+        }
+
+        pos += written;
+    }
+
+    // The check sequence is sent complemented, least significant byte first.
+    fcs = ~fcs;
+
+    for (size_t i = 0; i < NRF_802154_HDLC_FCS_SIZE; i++)
+    {
+        written = byte_encode((uint8_t)(fcs >> (8 * i)), &p_out[pos], out_size - pos);
+
+        if (written == 0)
+        {
+            return 0;
+        }
+
+        pos += written;
+    }
+
+    if (pos >= out_size)
+    {
+        return 0;
+    }
+
+    p_out[pos++] = NRF_802154_HDLC_FLAG_BYTE;
+
+    return pos;
+}
+
+static void decoder_frame_reset(nrf_802154_hdlc_decoder_t * p_decoder)
+{
+    p_decoder->length   = 0;
+    p_decoder->fcs      = NRF_802154_HDLC_FCS_INIT;
+    p_decoder->escaped  = false;
+    p_decoder->overflow = false;
+}
+
+static void decoder_frame_end(nrf_802154_hdlc_decoder_t * p_decoder)
+{
+    // Flags repeated between frames delimit empty frames, which are silently skipped.
+    if (!p_decoder->overflow &&
+        !p_decoder->escaped &&
+        (p_decoder->length > NRF_802154_HDLC_FCS_SIZE) &&
+        (p_decoder->fcs == FCS_GOOD))
+    {
+        p_decoder->handler(p_decoder->p_buffer, p_decoder->length - NRF_802154_HDLC_FCS_SIZE);
+    }
+
+    decoder_frame_reset(p_decoder);
+}
+
+void nrf_802154_hdlc_decoder_init(nrf_802154_hdlc_decoder_t     * p_decoder,
+                                  uint8_t                       * p_buffer,
+                                  size_t                          buffer_size,
+                                  nrf_802154_hdlc_frame_handler_t handler)
+{
+    assert(p_decoder != NULL);
+    assert(p_buffer != NULL);
+    assert(handler != NULL);
+
+    p_decoder->p_buffer    = p_buffer;
+    p_decoder->buffer_size = buffer_size;
+    p_decoder->handler     = handler;
+
+    decoder_frame_reset(p_decoder);
+
+    // Drop everything until the first flag, which may be received in the middle of a frame.
+    p_decoder->overflow = true;
+}
+
+void nrf_802154_hdlc_decode(nrf_802154_hdlc_decoder_t * p_decoder,
+                            const uint8_t             * p_data,
+                            size_t                      data_len)
+{
+    for (size_t i = 0; i < data_len; i++)
+    {
+        uint8_t byte = p_data[i];
+
+        if (byte == NRF_802154_HDLC_FLAG_BYTE)
+        {
+            decoder_frame_end(p_decoder);
+            continue;
+        }
+
+        if (p_decoder->overflow)
+        {
+            continue;
+        }
+
+        if (byte == NRF_802154_HDLC_ESCAPE_BYTE)
+        {
+            p_decoder->escaped = true;
+            continue;
+        }
+
+        if (p_decoder->escaped)
+        {
+            byte              ^= ESCAPE_XOR;
+            p_decoder->escaped = false;
+        }
+
+        if (p_decoder->length >= p_decoder->buffer_size)
+        {
+            p_decoder->overflow = true;
+            continue;
+        }
+
+        p_decoder->p_buffer[p_decoder->length++] = byte;
+        p_decoder->fcs                           = fcs_byte_update(p_decoder->fcs, byte);
+    }
+}
@@ -45,12 +45,6 @@
 
 #define NRF_802154_KVMAP_ITEMSIZE(key_size, val_size) ((key_size) + (val_size))
 
-static inline uint8_t * item_ptr_by_idx_get(const nrf_802154_kvmap_t * p_kvmap, size_t idx)
-{
-    return ((uint8_t *)(p_kvmap->p_memory)) +
-           (idx * NRF_802154_KVMAP_ITEMSIZE(p_kvmap->key_size, p_kvmap->val_size));
-}
-
 static void item_value_write(const nrf_802154_kvmap_t * p_kvmap,
                              uint8_t                  * p_item,
                              const void               * p_value)
@@ -61,6 +55,158 @@ static void item_value_write(const nrf_802154_kvmap_t * p_kvmap,
     }
 }
 
+#if NRF_802154_SER_KVMAP_HASH_ENABLED
+
+#define SLOT_STATE_EMPTY 0U ///< The slot holds no item.
+#define SLOT_STATE_USED  1U ///< The slot holds an item.
+
+/* Each slot consists of a state byte followed by an item. Collisions are resolved with linear
+ * probing. Removal shifts the following items of the probe sequence back, so no tombstones are
+ * needed and lookups of missing keys stop at the first empty slot.
+ */
+
+static inline uint8_t * slot_ptr_by_idx_get(const nrf_802154_kvmap_t * p_kvmap, size_t idx)
+{
+    return ((uint8_t *)(p_kvmap->p_memory)) +
+           (idx * NRF_802154_KVMAP_SLOT_SIZE(p_kvmap->key_size, p_kvmap->val_size));
+}
+
+static inline size_t slot_idx_next(const nrf_802154_kvmap_t * p_kvmap, size_t idx)
+{
+    return ((idx + 1U) < p_kvmap->slots) ? (idx + 1U) : 0U;
+}
+
+static size_t slot_idx_home_get(const nrf_802154_kvmap_t * p_kvmap, const void * p_key)
+{
+    /* FNV-1a */
+    const uint8_t * p_byte = (const uint8_t *)p_key;
+    uint32_t        hash   = 2166136261UL;
+
+    for (size_t i = 0U; i < p_kvmap->key_size; i++)
+    {
+        hash ^= p_byte[i];
+        hash *= 16777619UL;
+    }
+
+    return hash % p_kvmap->slots;
+}
+
+static bool slot_idx_by_key_search(const nrf_802154_kvmap_t * p_kvmap,
+                                   const void               * p_key,
+                                   size_t                   * p_idx)
+{
+    size_t idx;
+
+    if (p_kvmap->slots == 0U)
+    {
+        return false;
+    }
+
+    idx = slot_idx_home_get(p_kvmap, p_key);
+
+    for (size_t i = 0U; i < p_kvmap->slots; i++)
+    {
+        uint8_t * p_slot = slot_ptr_by_idx_get(p_kvmap, idx);
+
+        if (p_slot[0] == SLOT_STATE_EMPTY)
+        {
+            break;
+        }
+
+        if (memcmp(&p_slot[1], p_key, p_kvmap->key_size) == 0)
+        {
+            /* Hit! */
+            *p_idx = idx;
+            return true;
+        }
+
+        idx = slot_idx_next(p_kvmap, idx);
+    }
+
+    return false;
+}
+
+static void table_init(nrf_802154_kvmap_t * p_kvmap, size_t memsize)
+{
+    size_t slot_size = NRF_802154_KVMAP_SLOT_SIZE(p_kvmap->key_size, p_kvmap->val_size);
+
+    p_kvmap->capacity = memsize / (slot_size * NRF_802154_KVMAP_SLOTS_PER_ITEM);
+    p_kvmap->slots    = p_kvmap->capacity * NRF_802154_KVMAP_SLOTS_PER_ITEM;
+
+    for (size_t idx = 0U; idx < p_kvmap->slots; idx++)
+    {
+        slot_ptr_by_idx_get(p_kvmap, idx)[0] = SLOT_STATE_EMPTY;
+    }
+}
+
+static uint8_t * item_find(const nrf_802154_kvmap_t * p_kvmap, const void * p_key)
+{
+    size_t idx;
+
+    return slot_idx_by_key_search(p_kvmap, p_key, &idx) ?
+           &slot_ptr_by_idx_get(p_kvmap, idx)[1] : NULL;
+}
+
+static uint8_t * item_insert(nrf_802154_kvmap_t * p_kvmap, const void * p_key)
+{
+    size_t    idx    = slot_idx_home_get(p_kvmap, p_key);
+    uint8_t * p_slot = slot_ptr_by_idx_get(p_kvmap, idx);
+
+    /* The table is never full, because there are more slots than items */
+    while (p_slot[0] != SLOT_STATE_EMPTY)
+    {
+        idx    = slot_idx_next(p_kvmap, idx);
+        p_slot = slot_ptr_by_idx_get(p_kvmap, idx);
+    }
+
+    p_slot[0] = SLOT_STATE_USED;
+    memcpy(&p_slot[1], p_key, p_kvmap->key_size);
+
+    return &p_slot[1];
+}
+
+static void item_delete(nrf_802154_kvmap_t * p_kvmap, uint8_t * p_item)
+{
+    size_t slot_size = NRF_802154_KVMAP_SLOT_SIZE(p_kvmap->key_size, p_kvmap->val_size);
+    size_t hole      = (size_t)((p_item - 1) - (uint8_t *)p_kvmap->p_memory) / slot_size;
+    size_t idx       = slot_idx_next(p_kvmap, hole);
+
+    for (;;)
+    {
+        uint8_t * p_slot = slot_ptr_by_idx_get(p_kvmap, idx);
+
+        if (p_slot[0] == SLOT_STATE_EMPTY)
+        {
+            break;
+        }
+
+        size_t home = slot_idx_home_get(p_kvmap, &p_slot[1]);
+
+        /* The item can fill the hole only if its home slot does not lie cyclically
+         * within (hole, idx]. */
+        bool home_in_range = (hole <= idx) ? ((hole < home) && (home <= idx)) :
+                             ((hole < home) || (home <= idx));
+
+        if (!home_in_range)
+        {
+            memcpy(slot_ptr_by_idx_get(p_kvmap, hole), p_slot, slot_size);
+            hole = idx;
+        }
+
+        idx = slot_idx_next(p_kvmap, idx);
+    }
+
+    slot_ptr_by_idx_get(p_kvmap, hole)[0] = SLOT_STATE_EMPTY;
+}
+
+#else // NRF_802154_SER_KVMAP_HASH_ENABLED
+
+static inline uint8_t * item_ptr_by_idx_get(const nrf_802154_kvmap_t * p_kvmap, size_t idx)
+{
+    return ((uint8_t *)(p_kvmap->p_memory)) +
+           (idx * NRF_802154_KVMAP_ITEMSIZE(p_kvmap->key_size, p_kvmap->val_size));
+}
+
 static size_t item_idx_by_key_search(const nrf_802154_kvmap_t * p_kvmap, const void * p_key)
 {
     size_t    item_size = NRF_802154_KVMAP_ITEMSIZE(p_kvmap->key_size, p_kvmap->val_size);
@@ -80,6 +226,46 @@ static size_t item_idx_by_key_search(const nrf_802154_kvmap_t * p_kvmap, const v
     return idx;
 }
 
+static void table_init(nrf_802154_kvmap_t * p_kvmap, size_t memsize)
+{
+    p_kvmap->capacity = memsize / NRF_802154_KVMAP_ITEMSIZE(p_kvmap->key_size, p_kvmap->val_size);
+}
+
+static uint8_t * item_find(const nrf_802154_kvmap_t * p_kvmap, const void * p_key)
+{
+    size_t idx = item_idx_by_key_search(p_kvmap, p_key);
+
+    return (idx < p_kvmap->count) ? item_ptr_by_idx_get(p_kvmap, idx) : NULL;
+}
+
+static uint8_t * item_insert(nrf_802154_kvmap_t * p_kvmap, const void * p_key)
+{
+    /* Add next at p_kvmap->count */
+    uint8_t * p_item = item_ptr_by_idx_get(p_kvmap, p_kvmap->count);
+
+    memcpy(p_item, p_key, p_kvmap->key_size);
+
+    return p_item;
+}
+
+static void item_delete(nrf_802154_kvmap_t * p_kvmap, uint8_t * p_item)
+{
+    const uint8_t * p_last_item = item_ptr_by_idx_get(p_kvmap, p_kvmap->count - 1U);
+
+    if (p_item != p_last_item)
+    {
+        memcpy(p_item,
+               p_last_item,
+               NRF_802154_KVMAP_ITEMSIZE(p_kvmap->key_size, p_kvmap->val_size));
+    }
+    else
+    {
+        /* We hit last item, no item move necessary */
+    }
+}
+
+#endif // NRF_802154_SER_KVMAP_HASH_ENABLED
+
 void nrf_802154_kvmap_init(nrf_802154_kvmap_t * p_kvmap,
                            void               * p_memory,
                            size_t               memsize,
@@ -87,26 +273,25 @@ void nrf_802154_kvmap_init(nrf_802154_kvmap_t * p_kvmap,
                            size_t               val_size)
 {
     p_kvmap->p_memory = p_memory;
-    p_kvmap->capacity = memsize / NRF_802154_KVMAP_ITEMSIZE(key_size, val_size);
     p_kvmap->key_size = key_size;
     p_kvmap->val_size = val_size;
     p_kvmap->count    = 0U;
+
+    table_init(p_kvmap, memsize);
 }
 
 bool nrf_802154_kvmap_add(nrf_802154_kvmap_t * p_kvmap, const void * p_key, const void * p_value)
 {
-    uint32_t crit_sect = 0UL;
-    size_t   idx;
-    bool     success = true;
+    uint32_t  crit_sect = 0UL;
+    uint8_t * p_item;
+    bool      success = true;
 
     nrf_802154_serialization_crit_sect_enter(&crit_sect);
 
-    idx = item_idx_by_key_search(p_kvmap, p_key);
-    if (idx < p_kvmap->count)
+    p_item = item_find(p_kvmap, p_key);
+    if (p_item != NULL)
     {
         /* Item already present */
-        uint8_t * p_item = item_ptr_by_idx_get(p_kvmap, idx);
-
         item_value_write(p_kvmap, p_item, p_value);
     }
     else if (p_kvmap->count >= p_kvmap->capacity)
@@ -116,10 +301,8 @@ bool nrf_802154_kvmap_add(nrf_802154_kvmap_t * p_kvmap, const void * p_key, cons
     }
     else
     {
-        /* Not found, try to add next at p_kvmap->count */
-        uint8_t * p_item = item_ptr_by_idx_get(p_kvmap, p_kvmap->count);
-
-        memcpy(p_item, p_key, p_kvmap->key_size);
+        /* Not found, add it */
+        p_item = item_insert(p_kvmap, p_key);
         item_value_write(p_kvmap, p_item, p_value);
 
         p_kvmap->count++;
@@ -132,34 +315,22 @@ bool nrf_802154_kvmap_add(nrf_802154_kvmap_t * p_kvmap, const void * p_key, cons
 
 bool nrf_802154_kvmap_remove(nrf_802154_kvmap_t * p_kvmap, const void * p_key)
 {
-    uint32_t crit_sect = 0UL;
-    size_t   idx;
-    bool     success = true;
+    uint32_t  crit_sect = 0UL;
+    uint8_t * p_item;
+    bool      success = true;
 
     nrf_802154_serialization_crit_sect_enter(&crit_sect);
 
-    idx = item_idx_by_key_search(p_kvmap, p_key);
-    if (idx >= p_kvmap->count)
+    p_item = item_find(p_kvmap, p_key);
+    if (p_item == NULL)
     {
         /* Key not found */
         success = false;
     }
     else
     {
+        item_delete(p_kvmap, p_item);
         p_kvmap->count--;
-        if (idx < p_kvmap->count)
-        {
-            const uint8_t * p_last_item = item_ptr_by_idx_get(p_kvmap, p_kvmap->count);
-            uint8_t       * p_item      = item_ptr_by_idx_get(p_kvmap, idx);
-
-            memcpy(p_item,
-                   p_last_item,
-                   NRF_802154_KVMAP_ITEMSIZE(p_kvmap->key_size, p_kvmap->val_size));
-        }
-        else
-        {
-            /* We hit last item, no item move necessary */
-        }
     }
 
     nrf_802154_serialization_crit_sect_exit(crit_sect);
@@ -171,22 +342,20 @@ bool nrf_802154_kvmap_search(const nrf_802154_kvmap_t * p_kvmap,
                              const void               * p_key,
                              void                     * p_value)
 {
-    uint32_t crit_sect = 0UL;
-    size_t   idx;
-    bool     success = true;
+    uint32_t        crit_sect = 0UL;
+    const uint8_t * p_item;
+    bool            success = true;
 
     nrf_802154_serialization_crit_sect_enter(&crit_sect);
 
-    idx = item_idx_by_key_search(p_kvmap, p_key);
-    if (idx >= p_kvmap->count)
+    p_item = item_find(p_kvmap, p_key);
+    if (p_item == NULL)
     {
         /* Key not found */
         success = false;
     }
     else
     {
-        const uint8_t * p_item = item_ptr_by_idx_get(p_kvmap, idx);
-
         /* Copy value associated with the key if requested and values are present */
         if ((p_value != NULL) && (p_kvmap->val_size != 0U))
         {
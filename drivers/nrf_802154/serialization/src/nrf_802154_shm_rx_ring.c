@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file nrf_802154_shm_rx_ring.c
+ * @brief Shared-memory ring used to pass received frames between the cores.
+ */
+
+#include "nrf_802154_shm_rx_ring.h"
+
+#if NRF_802154_SER_SHM_RX_RING_ENABLED
+
+#include "nrf_802154_serialization_crit_sect.h"
+
+#include "nrfx.h"
+
+#include <assert.h>
+#include <stddef.h>
+
+#ifndef NRF_802154_SER_SHM_RX_RING_ADDRESS
+#error "NRF_802154_SER_SHM_RX_RING_ADDRESS must be defined when the shared-memory RX ring is enabled"
+#endif
+
+#if NRF_802154_SER_SHM_RX_RING_SLOTS > UINT8_MAX
+#error "NRF_802154_SER_SHM_RX_RING_SLOTS must not exceed 255"
+#endif
+
+#define SLOT_OWNER_NONE 0U ///< The slot is free.
+#define SLOT_OWNER_NET  1U ///< The slot is being filled by the network core.
+#define SLOT_OWNER_APP  2U ///< The slot holds a frame passed to the application core.
+
+/** @brief Layout of the shared memory region. */
+typedef struct
+{
+    volatile uint8_t owner[NRF_802154_SER_SHM_RX_RING_SLOTS];
+    uint8_t          data[NRF_802154_SER_SHM_RX_RING_SLOTS][NRF_802154_SHM_RX_RING_SLOT_SIZE];
+} shm_rx_ring_t;
+
+#define MP_RING ((shm_rx_ring_t *)(NRF_802154_SER_SHM_RX_RING_ADDRESS))
+
+void nrf_802154_shm_rx_ring_init(void)
+{
+    for (uint32_t i = 0; i < NRF_802154_SER_SHM_RX_RING_SLOTS; i++)
+    {
+        MP_RING->owner[i] = SLOT_OWNER_NONE;
+    }
+
+    __DMB();
+}
+
+bool nrf_802154_shm_rx_ring_slot_take(uint8_t * p_slot)
+{
+    bool     success   = false;
+    uint32_t crit_sect = 0UL;
+
+    // Only the network core moves slots out of the free state, so a local critical section
+    // is enough to protect this transition against preemption.
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    for (uint32_t i = 0; i < NRF_802154_SER_SHM_RX_RING_SLOTS; i++)
+    {
+        if (MP_RING->owner[i] == SLOT_OWNER_NONE)
+        {
+            MP_RING->owner[i] = SLOT_OWNER_NET;
+            *p_slot           = (uint8_t)i;
+            success           = true;
+            break;
+        }
+    }
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    return success;
+}
+
+void nrf_802154_shm_rx_ring_slot_pass(uint8_t slot)
+{
+    assert(slot < NRF_802154_SER_SHM_RX_RING_SLOTS);
+    assert(MP_RING->owner[slot] == SLOT_OWNER_NET);
+
+    // Make the frame visible to the other core before the ownership is passed
+    __DMB();
+    MP_RING->owner[slot] = SLOT_OWNER_APP;
+    __DMB();
+}
+
+void nrf_802154_shm_rx_ring_slot_abort(uint8_t slot)
+{
+    assert(slot < NRF_802154_SER_SHM_RX_RING_SLOTS);
+    assert(MP_RING->owner[slot] == SLOT_OWNER_NET);
+
+    MP_RING->owner[slot] = SLOT_OWNER_NONE;
+}
+
+bool nrf_802154_shm_rx_ring_slot_is_passed(uint8_t slot)
+{
+    bool result = (slot < NRF_802154_SER_SHM_RX_RING_SLOTS) &&
+                  (MP_RING->owner[slot] == SLOT_OWNER_APP);
+
+    // Do not let the frame be read before its ownership is confirmed
+    __DMB();
+
+    return result;
+}
+
+void nrf_802154_shm_rx_ring_slot_release(uint8_t slot)
+{
+    assert(slot < NRF_802154_SER_SHM_RX_RING_SLOTS);
+    assert(MP_RING->owner[slot] == SLOT_OWNER_APP);
+
+    // Complete all accesses to the frame before the slot can be reused by the other core
+    __DMB();
+    MP_RING->owner[slot] = SLOT_OWNER_NONE;
+    __DMB();
+}
+
+uint8_t * nrf_802154_shm_rx_ring_slot_data_get(uint8_t slot)
+{
+    assert(slot < NRF_802154_SER_SHM_RX_RING_SLOTS);
+
+    return MP_RING->data[slot];
+}
+
+bool nrf_802154_shm_rx_ring_slot_find(const uint8_t * p_data, uint8_t * p_slot)
+{
+    const uint8_t * p_begin = &MP_RING->data[0][0];
+    const uint8_t * p_end   = p_begin + sizeof(MP_RING->data);
+
+    if ((p_data < p_begin) || (p_data >= p_end))
+    {
+        return false;
+    }
+
+    size_t offset = (size_t)(p_data - p_begin);
+
+    if ((offset % NRF_802154_SHM_RX_RING_SLOT_SIZE) != 0U)
+    {
+        return false;
+    }
+
+    *p_slot = (uint8_t)(offset / NRF_802154_SHM_RX_RING_SLOT_SIZE);
+
+    return true;
+}
+
+#endif // NRF_802154_SER_SHM_RX_RING_ENABLED
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file nrf_802154_shm_tx_pool.c
+ * @brief Shared-memory pool of frame buffers used for transmissions.
+ */
+
+#include "nrf_802154_shm_tx_pool.h"
+
+#if NRF_802154_SER_SHM_TX_POOL_ENABLED
+
+#include <stddef.h>
+
+#ifndef NRF_802154_SER_SHM_TX_POOL_ADDRESS
+#error "NRF_802154_SER_SHM_TX_POOL_ADDRESS must be defined when the shared-memory TX pool is enabled"
+#endif
+
+#define MP_POOL ((nrf_802154_buffer_t *)(NRF_802154_SER_SHM_TX_POOL_ADDRESS))
+
+static nrf_802154_buffer_allocator_t m_allocator;
+
+void nrf_802154_shm_tx_pool_init(void)
+{
+    nrf_802154_buffer_allocator_init(&m_allocator, MP_POOL, NRF_802154_SHM_TX_POOL_MEMORY_SIZE);
+}
+
+uint8_t * nrf_802154_shm_tx_pool_alloc(void)
+{
+    return nrf_802154_buffer_allocator_alloc(&m_allocator);
+}
+
+void nrf_802154_shm_tx_pool_free(uint8_t * p_buffer)
+{
+    nrf_802154_buffer_allocator_free(&m_allocator, p_buffer);
+}
+
+bool nrf_802154_shm_tx_pool_contains(const void * p_data)
+{
+    const uint8_t * p_begin = (const uint8_t *)MP_POOL;
+    const uint8_t * p_end   = p_begin + NRF_802154_SHM_TX_POOL_MEMORY_SIZE;
+    const uint8_t * p_byte  = (const uint8_t *)p_data;
+
+    if ((p_byte < p_begin) || (p_byte >= p_end))
+    {
+        return false;
+    }
+
+    return ((size_t)(p_byte - p_begin) % sizeof(nrf_802154_buffer_t)) == 0U;
+}
+
+#endif // NRF_802154_SER_SHM_TX_POOL_ENABLED
@@ -34,28 +34,302 @@
 
 #include "nrf_802154_spinel.h"
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <stddef.h>
 
 #include "../spinel_base/spinel.h"
 #include "nrf_802154_spinel_dec.h"
+#include "nrf_802154_spinel_latency.h"
 #include "nrf_802154_spinel_backend.h"
 #include "nrf_802154_spinel_log.h"
 #include "nrf_802154_spinel_response_notifier.h"
+#include "nrf_802154_spinel_rx_compact.h"
 #include "nrf_802154_serialization_error.h"
 #include "nrf_802154_serialization_error_helper.h"
 #include "nrf_802154_buffer_mgr_dst.h"
 #include "nrf_802154_buffer_mgr_src.h"
 #include "nrf_802154_serialization_config.h"
+#include "nrf_802154_shm_rx_ring.h"
+#include "nrf_802154_shm_tx_pool.h"
+#include "nrf_802154_spinel_time_sync.h"
+
+/* Only buffers freed by the application core are returned lazily */
+#define LAZY_FREE_ENABLED (NRF_802154_SER_LAZY_FREE_ENABLED && CONFIG_NRF_802154_SER_HOST)
+
+/* Only notifications sent by the network core are coalesced */
+#define COALESCING_ENABLED (NRF_802154_SER_COALESCING_ENABLED && !CONFIG_NRF_802154_SER_HOST)
+
+#if LAZY_FREE_ENABLED
+#include "nrf_802154_spinel_lazy_free.h"
+#endif
+
+#if COALESCING_ENABLED
+#include "nrf_802154_serialization_crit_sect.h"
+#include "nrf_802154_spinel_coalescing_timer.h"
+
+#include <string.h>
+#endif
+
+#if NRF_802154_SER_IRQ_MODERATION_ENABLED
+#include "nrf_802154_serialization_crit_sect.h"
+#include "nrf_802154_spinel_moderation_timer.h"
+#endif
+
+/** Number of received frames that can be passed to the application core at a time. */
+#define RX_FRAMES_MAX (NRF_802154_RX_BUFFERS + NRF_802154_RX_BUFFERS_SHORT)
 
 #if CONFIG_NRF_802154_SER_HOST
 NRF_802154_BUFFER_MGR_SRC_INST_DECL_STATIC(m_src_mgr, NRF_802154_TX_BUFFERS);
-NRF_802154_BUFFER_MGR_DST_INST_DECL_STATIC(m_dst_mgr, NRF_802154_RX_BUFFERS);
+NRF_802154_BUFFER_MGR_DST_INST_DECL_STATIC(m_dst_mgr, RX_FRAMES_MAX);
 #else // CONFIG_NRF_802154_SER_HOST
 NRF_802154_BUFFER_MGR_DST_INST_DECL_STATIC(m_dst_mgr, NRF_802154_TX_BUFFERS);
-NRF_802154_BUFFER_MGR_SRC_INST_DECL_STATIC(m_src_mgr, NRF_802154_RX_BUFFERS);
+NRF_802154_BUFFER_MGR_SRC_INST_DECL_STATIC(m_src_mgr, RX_FRAMES_MAX);
 #endif  // CONFIG_NRF_802154_SER_HOST
 
+#if NRF_802154_SER_BACKEND_NOCOPY_TX_ENABLED
+
+/**
+ * @brief Reserves a transmit buffer of the backend that is large enough for a frame.
+ *
+ * @param[in]   min_size       Minimum size of the buffer.
+ * @param[out]  p_buffer_size  Size of the reserved buffer.
+ *
+ * @returns  Pointer to the reserved buffer or NULL if no large enough buffer is available.
+ */
+static uint8_t * backend_buffer_reserve(size_t min_size, size_t * p_buffer_size)
+{
+    size_t    size     = 0U;
+    uint8_t * p_buffer = nrf_802154_spinel_encoded_packet_buffer_reserve(&size);
+
+    if ((p_buffer != NULL) && (size < min_size))
+    {
+        nrf_802154_spinel_encoded_packet_buffer_discard(p_buffer);
+        p_buffer = NULL;
+    }
+
+    *p_buffer_size = size;
+
+    return p_buffer;
+}
+
+#endif // NRF_802154_SER_BACKEND_NOCOPY_TX_ENABLED
+
+#if NRF_802154_SER_IRQ_MODERATION_ENABLED
+/** @brief Number of frames queued in the backend since the peer was last signaled. */
+static uint32_t m_moderated_count;
+
+/**
+ * @brief Signals the peer if queued frames require it.
+ *
+ * @param[in]  urgent  If the peer is to be signaled regardless of the number of queued frames.
+ */
+static void peer_signal_moderate(bool urgent)
+{
+    uint32_t crit_sect = 0UL;
+    bool     signal;
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    m_moderated_count++;
+
+    signal = urgent || (m_moderated_count >= NRF_802154_SER_IRQ_MODERATION_MAX_PACKETS);
+
+    if (signal)
+    {
+        m_moderated_count = 0U;
+        nrf_802154_spinel_moderation_timer_stop();
+    }
+    else if (m_moderated_count == 1U)
+    {
+        nrf_802154_spinel_moderation_timer_start(NRF_802154_SER_IRQ_MODERATION_MAX_DELAY_US);
+    }
+    else
+    {
+        // The timer started for the oldest queued frame bounds the delay
+    }
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    if (signal)
+    {
+        nrf_802154_spinel_peer_signal();
+    }
+}
+
+void nrf_802154_spinel_moderation_timer_expired(void)
+{
+    uint32_t crit_sect = 0UL;
+    bool     signal;
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    signal            = (m_moderated_count != 0U);
+    m_moderated_count = 0U;
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    if (signal)
+    {
+        nrf_802154_spinel_peer_signal();
+    }
+}
+
+#endif // NRF_802154_SER_IRQ_MODERATION_ENABLED
+
+/**
+ * @brief Sends a serialized spinel frame over the backend.
+ *
+ * @param[in]  p_frame     Pointer to the serialized frame.
+ * @param[in]  frame_len   Length of the serialized frame.
+ * @param[in]  is_backend  If @p p_frame is a buffer reserved from the backend.
+ * @param[in]  urgent      If the peer is to be signaled immediately. Ignored unless
+ *                         @ref NRF_802154_SER_IRQ_MODERATION_ENABLED is set.
+ *
+ * @returns  number of bytes sent or negative error value on failure.
+ */
+static nrf_802154_ser_err_t frame_send(uint8_t * p_frame,
+                                       size_t    frame_len,
+                                       bool      is_backend,
+                                       bool      urgent)
+{
+    NRF_802154_SPINEL_LOG_BUFF_NAMED(p_frame, frame_len, "data");
+
+#if NRF_802154_SER_IRQ_MODERATION_ENABLED
+    nrf_802154_ser_err_t res;
+
+#if NRF_802154_SER_BACKEND_NOCOPY_TX_ENABLED
+    if (is_backend)
+    {
+        res = nrf_802154_spinel_encoded_packet_buffer_enqueue(p_frame, frame_len);
+    }
+    else
+#else
+    (void)is_backend;
+#endif
+    {
+        res = nrf_802154_spinel_encoded_packet_enqueue(p_frame, frame_len);
+    }
+
+    if (res >= 0)
+    {
+        peer_signal_moderate(urgent);
+    }
+
+    return res;
+#else // NRF_802154_SER_IRQ_MODERATION_ENABLED
+    (void)urgent;
+
+#if NRF_802154_SER_BACKEND_NOCOPY_TX_ENABLED
+    if (is_backend)
+    {
+        return nrf_802154_spinel_encoded_packet_buffer_commit(p_frame, frame_len);
+    }
+#else
+    (void)is_backend;
+#endif
+
+    return nrf_802154_spinel_encoded_packet_send(p_frame, frame_len);
+#endif // NRF_802154_SER_IRQ_MODERATION_ENABLED
+}
+
+#if COALESCING_ENABLED
+/** @brief Size of the length prefix of each coalesced notification. */
+#define COALESCED_ITEM_LEN_SIZE sizeof(uint16_t)
+
+/** @brief Notifications waiting to be sent, each preceded by its length. */
+static uint8_t  m_coalesced_buff[NRF_802154_SER_COALESCING_BUFFER_SIZE];
+static size_t   m_coalesced_len;   ///< Number of bytes used in @ref m_coalesced_buff.
+static uint32_t m_coalesced_count; ///< Number of notifications in @ref m_coalesced_buff.
+
+/**
+ * @brief Sends all coalesced notifications.
+ *
+ * A single notification is sent as SPINEL_CMD_PROP_VALUE_IS. Multiple notifications are sent
+ * as SPINEL_CMD_PROP_VALUES_ARE.
+ *
+ * @returns  zero on success, when there was nothing to send, or negative error value on failure.
+ */
+static nrf_802154_ser_err_t coalesced_flush(void)
+{
+    uint8_t        frame_buff[NRF_802154_SER_COALESCING_BUFFER_SIZE + 2U];
+    uint8_t      * p_frame    = frame_buff;
+    size_t         frame_size = sizeof(frame_buff);
+    bool           is_backend = false;
+    size_t         frame_len;
+    uint32_t       crit_sect = 0UL;
+    spinel_ssize_t siz       = 0;
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+#if NRF_802154_SER_BACKEND_NOCOPY_TX_ENABLED
+    if (m_coalesced_count != 0U)
+    {
+        // The command header takes at most 2 bytes, like reserved in frame_buff
+        uint8_t * p_reserved = backend_buffer_reserve(m_coalesced_len + 2U, &frame_size);
+
+        if (p_reserved != NULL)
+        {
+            p_frame    = p_reserved;
+            is_backend = true;
+        }
+        else
+        {
+            frame_size = sizeof(frame_buff);
+        }
+    }
+#endif
+
+    if (m_coalesced_count == 1U)
+    {
+        // Strip the length prefix of the only notification
+        siz = spinel_datatype_pack(p_frame,
+                                   frame_size,
+                                   SPINEL_DATATYPE_COMMAND_S,
+                                   SPINEL_HEADER_FLAG,
+                                   SPINEL_CMD_PROP_VALUE_IS);
+        frame_len = m_coalesced_len - COALESCED_ITEM_LEN_SIZE;
+        memcpy(&p_frame[siz], &m_coalesced_buff[COALESCED_ITEM_LEN_SIZE], frame_len);
+    }
+    else if (m_coalesced_count > 1U)
+    {
+        siz = spinel_datatype_pack(p_frame,
+                                   frame_size,
+                                   SPINEL_DATATYPE_COMMAND_S,
+                                   SPINEL_HEADER_FLAG,
+                                   SPINEL_CMD_PROP_VALUES_ARE);
+        frame_len = m_coalesced_len;
+        memcpy(&p_frame[siz], m_coalesced_buff, frame_len);
+    }
+    else
+    {
+        // Nothing to send
+        frame_len = 0U;
+    }
+
+    if (frame_len != 0U)
+    {
+        nrf_802154_spinel_coalescing_timer_stop();
+    }
+
+    m_coalesced_len   = 0U;
+    m_coalesced_count = 0U;
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    if (frame_len == 0U)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_OK;
+    }
+
+    NRF_802154_SPINEL_LOG_RAW("Sending coalesced spinel frame\n");
+
+    // The notifications do not require the peer to be signaled immediately
+    return frame_send(p_frame, (size_t)siz + frame_len, is_backend, false);
+}
+
+#endif // COALESCING_ENABLED
+
 static void buffer_mgr_init(void)
 {
     NRF_802154_BUFFER_MGR_SRC_INIT(m_src_mgr);
@@ -79,6 +353,30 @@ void nrf_802154_serialization_init(void)
     buffer_mgr_init();
     nrf_802154_spinel_response_notifier_init();
 
+#if NRF_802154_SER_LATENCY_STATS_ENABLED
+    nrf_802154_spinel_latency_init();
+#endif
+
+#if !CONFIG_NRF_802154_SER_HOST && NRF_802154_SER_SHM_RX_RING_ENABLED
+    nrf_802154_shm_rx_ring_init();
+#endif
+
+#if CONFIG_NRF_802154_SER_HOST && NRF_802154_SER_SHM_TX_POOL_ENABLED
+    nrf_802154_shm_tx_pool_init();
+#endif
+
+#if NRF_802154_SER_COMPACT_RX_ENABLED
+    nrf_802154_spinel_rx_compact_init();
+#endif
+
+#if LAZY_FREE_ENABLED
+    nrf_802154_spinel_lazy_free_init();
+#endif
+
+#if CONFIG_NRF_802154_SER_HOST && NRF_802154_SER_TIME_SYNC_ENABLED
+    nrf_802154_spinel_time_sync_init();
+#endif
+
     nrf_802154_ser_err_t ret = nrf_802154_backend_init();
 
     SERIALIZATION_ERROR_CHECK(ret, error, bail);
@@ -89,41 +387,342 @@ bail:
     return;
 }
 
-nrf_802154_ser_err_t nrf_802154_spinel_send(const char * p_fmt, ...)
+/**
+ * @brief Data of a frame to be serialized.
+ *
+ * The data is described either by a format string with its arguments, or by a packer function
+ * of a property carried by a command.
+ */
+typedef struct
+{
+    const char                    * p_fmt;  ///< Format string describing the data or NULL.
+    va_list                       * p_args; ///< Arguments of @ref p_fmt.
+    spinel_command_t                cmd;    ///< Command carrying the property packed by @ref packer.
+    nrf_802154_spinel_prop_packer_t packer; ///< Packer of the property, used if @ref p_fmt is NULL.
+    const void                    * p_ctx;  ///< Pointer passed to @ref packer.
+    bool                            urgent; ///< If the peer is to be signaled immediately.
+} payload_t;
+
+/**
+ * @brief Serializes the data of a frame.
+ *
+ * @param[out]  p_buffer     Buffer to which the data is to be serialized.
+ * @param[in]   buffer_size  Size of the @p p_buffer buffer.
+ * @param[in]   p_payload    Data to be serialized.
+ * @param[in]   with_cmd     If the command header is serialized before a packed property.
+ *
+ * @returns  size required for the serialized data, which is greater than @p buffer_size if the
+ *           data did not fit, or negative value on failure.
+ */
+static spinel_ssize_t payload_pack(uint8_t         * p_buffer,
+                                   size_t            buffer_size,
+                                   const payload_t * p_payload,
+                                   bool              with_cmd)
+{
+    nrf_802154_spinel_writer_t writer;
+
+    if (p_payload->p_fmt != NULL)
+    {
+        // The arguments are copied by spinel, so they can be serialized repeatedly
+        return spinel_datatype_vpack(p_buffer, buffer_size, p_payload->p_fmt, *p_payload->p_args);
+    }
+
+    nrf_802154_spinel_writer_init(&writer, p_buffer, buffer_size);
+
+    if (with_cmd)
+    {
+        nrf_802154_spinel_writer_uint8(&writer, SPINEL_HEADER_FLAG);
+        nrf_802154_spinel_writer_packed_uint(&writer, p_payload->cmd);
+    }
+
+    p_payload->packer(&writer, p_payload->p_ctx);
+
+    return writer.error ? -1 : (spinel_ssize_t)writer.len;
+}
+
+/**
+ * @brief Serializes a frame and sends it over spinel backend.
+ *
+ * @param[in]  p_payload  Data of the frame to be serialized.
+ *
+ * @returns  number of bytes sent or negative error value on failure.
+ */
+static nrf_802154_ser_err_t payload_send(const payload_t * p_payload)
 {
     uint8_t        command_buff[NRF_802154_SPINEL_FRAME_BUFFER_SIZE];
-    spinel_ssize_t siz;
+    uint8_t      * p_frame    = command_buff;
+    bool           is_backend = false;
+    spinel_ssize_t siz        = -1;
 
-    va_list args;
+#if LAZY_FREE_ENABLED
+    // Return the freed buffers before the network core processes the request
+    nrf_802154_ser_err_t free_res = nrf_802154_spinel_lazy_free_flush();
 
-    va_start(args, p_fmt);
+    if (free_res < 0)
+    {
+        return free_res;
+    }
+#endif
 
-    siz = spinel_datatype_vpack(command_buff, sizeof(command_buff), p_fmt, args);
+#if NRF_802154_SER_BACKEND_NOCOPY_TX_ENABLED
+    size_t    reserved_size;
+    uint8_t * p_reserved = backend_buffer_reserve(0U, &reserved_size);
 
-    va_end(args);
+    if (p_reserved != NULL)
+    {
+        siz = payload_pack(p_reserved, reserved_size, p_payload, true);
 
-    if (siz < 0)
+        if ((siz >= 0) && ((size_t)siz <= reserved_size))
+        {
+            p_frame    = p_reserved;
+            is_backend = true;
+        }
+        else
+        {
+            nrf_802154_spinel_encoded_packet_buffer_discard(p_reserved);
+        }
+    }
+
+    if (!is_backend)
+#endif
+    {
+        siz = payload_pack(command_buff, sizeof(command_buff), p_payload, true);
+    }
+
+    if ((siz < 0) || (!is_backend && ((size_t)siz > sizeof(command_buff))))
     {
         return NRF_802154_SERIALIZATION_ERROR_ENCODING_FAILURE;
     }
 
+#if COALESCING_ENABLED
+    // Preserve the order of frames
+    nrf_802154_ser_err_t res = coalesced_flush();
+
+    if (res < 0)
+    {
+#if NRF_802154_SER_BACKEND_NOCOPY_TX_ENABLED
+        if (is_backend)
+        {
+            nrf_802154_spinel_encoded_packet_buffer_discard(p_frame);
+        }
+#endif
+        return res;
+    }
+#endif
+
     NRF_802154_SPINEL_LOG_RAW("Sending spinel frame\n");
-    NRF_802154_SPINEL_LOG_BUFF_NAMED(command_buff, siz, "data");
 
-    return nrf_802154_spinel_encoded_packet_send(command_buff, (size_t)siz);
+    return frame_send(p_frame, (size_t)siz, is_backend, p_payload->urgent);
+}
+
+/**
+ * @brief Packs a property with a packer function and sends it over spinel backend.
+ *
+ * @param[in]  cmd     Spinel command carrying the property.
+ * @param[in]  packer  Function packing the property.
+ * @param[in]  p_ctx   Pointer passed to @p packer.
+ * @param[in]  urgent  If the peer is to be signaled immediately.
+ *
+ * @returns  number of bytes sent or negative error value on failure.
+ */
+static nrf_802154_ser_err_t payload_prop_send(spinel_command_t                cmd,
+                                              nrf_802154_spinel_prop_packer_t packer,
+                                              const void                    * p_ctx,
+                                              bool                            urgent)
+{
+    payload_t payload =
+    {
+        .p_fmt  = NULL,
+        .cmd    = cmd,
+        .packer = packer,
+        .p_ctx  = p_ctx,
+        .urgent = urgent,
+    };
+
+    return payload_send(&payload);
+}
+
+nrf_802154_ser_err_t nrf_802154_spinel_send(const char * p_fmt, ...)
+{
+    nrf_802154_ser_err_t res;
+    va_list              args;
+
+    va_start(args, p_fmt);
+
+    payload_t payload = {.p_fmt = p_fmt, .p_args = &args, .urgent = true};
+
+    res = payload_send(&payload);
+
+    va_end(args);
+
+    return res;
 }
 
+nrf_802154_ser_err_t nrf_802154_spinel_prop_send(spinel_command_t                cmd,
+                                                 nrf_802154_spinel_prop_packer_t packer,
+                                                 const void                    * p_ctx)
+{
+    return payload_prop_send(cmd, packer, p_ctx, true);
+}
+
+nrf_802154_ser_err_t nrf_802154_spinel_send_moderated(const char * p_fmt, ...)
+{
+    nrf_802154_ser_err_t res;
+    va_list              args;
+
+    va_start(args, p_fmt);
+
+    payload_t payload = {.p_fmt = p_fmt, .p_args = &args, .urgent = false};
+
+    res = payload_send(&payload);
+
+    va_end(args);
+
+    return res;
+}
+
+nrf_802154_ser_err_t nrf_802154_spinel_prop_send_moderated(
+    spinel_command_t                cmd,
+    nrf_802154_spinel_prop_packer_t packer,
+    const void                    * p_ctx)
+{
+    return payload_prop_send(cmd, packer, p_ctx, false);
+}
+
+#if COALESCING_ENABLED
+/**
+ * @brief Serializes a property value and queues it for coalesced sending.
+ *
+ * @param[in]  p_payload  Property to be serialized, without the command header.
+ *
+ * @returns  zero on success or negative error value on failure.
+ */
+static nrf_802154_ser_err_t payload_coalesce(const payload_t * p_payload)
+{
+    spinel_ssize_t       siz;
+    bool                 first;
+    bool                 fits;
+    uint32_t             crit_sect = 0UL;
+    nrf_802154_ser_err_t res       = NRF_802154_SERIALIZATION_ERROR_OK;
+
+    do
+    {
+        nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+        uint8_t * p_item = &m_coalesced_buff[m_coalesced_len];
+        size_t    room   = sizeof(m_coalesced_buff) - m_coalesced_len;
+
+        first = (m_coalesced_count == 0U);
+        fits  = false;
+
+        if (room > COALESCED_ITEM_LEN_SIZE)
+        {
+            // Serialize the notification in place, leaving room for its length
+            siz = payload_pack(p_item + COALESCED_ITEM_LEN_SIZE,
+                               room - COALESCED_ITEM_LEN_SIZE,
+                               p_payload,
+                               false);
+
+            fits = (siz >= 0) && ((size_t)siz <= (room - COALESCED_ITEM_LEN_SIZE));
+        }
+
+        if (fits)
+        {
+            (void)spinel_datatype_pack(p_item,
+                                       COALESCED_ITEM_LEN_SIZE,
+                                       SPINEL_DATATYPE_UINT16_S,
+                                       (uint16_t)siz);
+
+            m_coalesced_len += COALESCED_ITEM_LEN_SIZE + (size_t)siz;
+            m_coalesced_count++;
+
+            if (first)
+            {
+                nrf_802154_spinel_coalescing_timer_start(NRF_802154_SER_COALESCING_MAX_DELAY_US);
+            }
+        }
+
+        nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+        if (!fits)
+        {
+            if (first)
+            {
+                // The notification does not fit even into the empty buffer
+                res = NRF_802154_SERIALIZATION_ERROR_ENCODING_FAILURE;
+            }
+            else
+            {
+                // Make room for the notification
+                res = coalesced_flush();
+            }
+        }
+    }
+    while (!fits && (res >= 0));
+
+    return res;
+}
+
+nrf_802154_ser_err_t nrf_802154_spinel_notification_send(const char * p_fmt, ...)
+{
+    nrf_802154_ser_err_t res;
+    va_list              args;
+
+    va_start(args, p_fmt);
+
+    payload_t payload = {.p_fmt = p_fmt, .p_args = &args};
+
+    res = payload_coalesce(&payload);
+
+    va_end(args);
+
+    return res;
+}
+
+nrf_802154_ser_err_t nrf_802154_spinel_prop_notification_send(
+    nrf_802154_spinel_prop_packer_t packer,
+    const void                    * p_ctx)
+{
+    payload_t payload = {.p_fmt = NULL, .packer = packer, .p_ctx = p_ctx};
+
+    return payload_coalesce(&payload);
+}
+
+void nrf_802154_spinel_coalescing_timer_expired(void)
+{
+    SERIALIZATION_ERROR_INIT(error);
+
+    nrf_802154_ser_err_t res = coalesced_flush();
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return;
+}
+
+#endif // COALESCING_ENABLED
+
 void nrf_802154_spinel_encoded_packet_received(const void * p_data, size_t data_len)
 {
     NRF_802154_SPINEL_LOG_RAW("Received spinel frame\n");
     NRF_802154_SPINEL_LOG_BUFF_NAMED(p_data, data_len, "data");
 
+#if !CONFIG_NRF_802154_SER_HOST
+    NRF_802154_SPINEL_LATENCY_START(latency_start);
+#endif
+
     SERIALIZATION_ERROR_INIT(error);
 
     nrf_802154_ser_err_t err = nrf_802154_spinel_decode_cmd(p_data, data_len);
 
     SERIALIZATION_ERROR_CHECK(err, error, bail);
 
+#if !CONFIG_NRF_802154_SER_HOST
+    NRF_802154_SPINEL_LATENCY_RECORD(NRF_802154_SER_LATENCY_REQUEST_HANDLE, latency_start);
+#endif
+
 bail:
     SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
 
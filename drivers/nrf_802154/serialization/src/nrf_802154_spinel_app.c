@@ -53,17 +53,94 @@
 #include "nrf_802154_spinel_datatypes.h"
 #include "nrf_802154_spinel_enc_app.h"
 #include "nrf_802154_spinel_dec_app.h"
+#include "nrf_802154_spinel_latency.h"
+#include "nrf_802154_spinel_lazy_free.h"
 #include "nrf_802154_spinel_log.h"
 #include "nrf_802154_spinel_response_notifier.h"
+#include "nrf_802154_spinel_rx_compact.h"
+#include "nrf_802154_spinel_time_sync.h"
 #include "nrf_802154_serialization_error.h"
 #include "nrf_802154_serialization_error_helper.h"
 #include "nrf_802154_buffer_mgr_dst.h"
 #include "nrf_802154_buffer_mgr_src.h"
+#include "nrf_802154_shm_rx_ring.h"
+#include "nrf_802154_shm_tx_pool.h"
+#include "nrf_802154_spinel_local_time.h"
 
 #include "nrf_802154.h"
 #include "nrf_802154_config.h"
 #include "nrf_802154_types.h"
 
+/**
+ * @brief Gets the number of bytes of a frame to transmit that must be serialized.
+ *
+ * Frames placed in the shared-memory TX pool are passed by reference. Only their handle
+ * is serialized.
+ *
+ * @param[in]  p_data  Pointer to the frame to transmit.
+ *
+ * @returns  Number of bytes of the frame to serialize.
+ */
+static inline uint8_t tx_frame_serialized_len_get(const uint8_t * p_data)
+{
+#if NRF_802154_SER_SHM_TX_POOL_ENABLED
+    if (nrf_802154_shm_tx_pool_contains(p_data))
+    {
+        return 0U;
+    }
+#endif
+
+    return p_data[0];
+}
+
+/**
+ * @brief Creates a handle of a frame to transmit.
+ *
+ * A frame placed in the shared-memory TX pool is identified by its address, which the network
+ * core uses to access the frame in place. Any other frame is tracked by the buffer manager.
+ *
+ * @param[in]  p_data         Pointer to the frame to transmit.
+ * @param[out] p_data_handle  Handle of the frame.
+ *
+ * @retval true   The handle was created.
+ * @retval false  No more frames can be tracked.
+ */
+static bool tx_frame_handle_add(const uint8_t * p_data, uint32_t * p_data_handle)
+{
+#if NRF_802154_SER_SHM_TX_POOL_ENABLED
+    if (nrf_802154_shm_tx_pool_contains(p_data))
+    {
+        *p_data_handle = (uintptr_t)p_data;
+        return true;
+    }
+#endif
+
+    return nrf_802154_buffer_mgr_src_add(nrf_802154_spinel_src_buffer_mgr_get(),
+                                         p_data,
+                                         p_data_handle);
+}
+
+/**
+ * @brief Removes a handle created with @ref tx_frame_handle_add.
+ *
+ * @param[in]  p_data       Pointer to the frame the handle was created for.
+ * @param[in]  data_handle  Handle of the frame.
+ */
+static void tx_frame_handle_remove(const uint8_t * p_data, uint32_t data_handle)
+{
+#if NRF_802154_SER_SHM_TX_POOL_ENABLED
+    if (nrf_802154_shm_tx_pool_contains(p_data))
+    {
+        return;
+    }
+#else
+    (void)p_data;
+#endif
+
+    nrf_802154_buffer_mgr_src_remove_by_buffer_handle(nrf_802154_spinel_src_buffer_mgr_get(),
+                                                      data_handle);
+}
+
 /**
  * @brief Wait with timeout for SPINEL_STATUS_OK to be received.
  *
@@ -412,9 +489,53 @@ bail:
     return error;
 }
 
+#if NRF_802154_SER_COMPACT_RX_ENABLED
+
+/**
+ * @brief Requests the compact encoding of received frame notifications.
+ *
+ * The network core enables the compact encoding only if it supports it. Otherwise received frames
+ * keep being notified in the regular way, which the application core handles as well.
+ */
+static void rx_compact_request(void)
+{
+    nrf_802154_ser_err_t res;
+    bool                 accepted = false;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RX_COMPACT_ENABLE);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RX_COMPACT_ENABLE,
+        SPINEL_DATATYPE_NRF_802154_RX_COMPACT_ENABLE,
+        NULL);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = net_generic_bool_response_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
+                                          &accepted);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return;
+}
+
+#endif // NRF_802154_SER_COMPACT_RX_ENABLED
+
 void nrf_802154_init(void)
 {
     nrf_802154_serialization_init();
+
+#if NRF_802154_SER_COMPACT_RX_ENABLED
+    rx_compact_request();
+#endif
 }
 
 bool nrf_802154_sleep(void)
@@ -481,6 +602,7 @@ bool nrf_802154_receive(void)
     nrf_802154_ser_err_t res;
     bool                 receive_remote_resp = false;
 
+    NRF_802154_SPINEL_LATENCY_START(latency_start);
     SERIALIZATION_ERROR_INIT(error);
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
@@ -499,6 +621,8 @@ bool nrf_802154_receive(void)
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
+    NRF_802154_SPINEL_LATENCY_RECORD(NRF_802154_SER_LATENCY_RECEIVE, latency_start);
+
 bail:
     SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
 
@@ -933,6 +1057,88 @@ bail:
     return addr_clr_res;
 }
 
+/**
+ * @brief Serialize a pending bit batch property, splitting it into chunks if needed.
+ *
+ * @param[in]  property   Either SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_SET_BATCH
+ *                        or SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR_BATCH.
+ * @param[in]  p_addrs    Array of addresses placed one after another.
+ * @param[in]  count      Number of addresses in @p p_addrs.
+ * @param[in]  extended   If the given addresses are extended or short.
+ *
+ * @returns  Sum of the results returned by the network core for all chunks.
+ */
+static uint32_t pending_bit_for_addr_batch_send(spinel_prop_key_t property,
+                                                const uint8_t   * p_addrs,
+                                                uint32_t          count,
+                                                bool              extended)
+{
+    nrf_802154_ser_err_t res;
+    uint32_t             addr_size = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+    uint32_t             chunk_max = NRF_802154_SPINEL_PENDING_BIT_BATCH_MAX_DATA_SIZE / addr_size;
+    uint32_t             batch_res = 0;
+    uint8_t              chunk_res = 0;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%u", count, "count");
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%s", (extended ? "true" : "false"), "extended");
+
+    while (count > 0U)
+    {
+        uint32_t chunk = (count > chunk_max) ? chunk_max : count;
+
+        nrf_802154_spinel_response_notifier_lock_before_request(property);
+
+        // Both batch properties share the same layout.
+        res = nrf_802154_spinel_send_cmd_prop_value_set(
+            property,
+            SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_SET_BATCH,
+            extended,
+            p_addrs,
+            chunk * addr_size);
+
+        SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+        res = net_generic_uint8_response_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
+                                               &chunk_res);
+
+        SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+        batch_res += chunk_res;
+        p_addrs   += chunk * addr_size;
+        count     -= chunk;
+    }
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return batch_res;
+}
+
+uint32_t nrf_802154_pending_bit_for_addr_set_batch(const uint8_t * p_addrs,
+                                                   uint32_t        count,
+                                                   bool            extended)
+{
+    return pending_bit_for_addr_batch_send(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_SET_BATCH,
+        p_addrs,
+        count,
+        extended);
+}
+
+uint32_t nrf_802154_pending_bit_for_addr_clear_batch(const uint8_t * p_addrs,
+                                                     uint32_t        count,
+                                                     bool            extended)
+{
+    return pending_bit_for_addr_batch_send(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR_BATCH,
+        p_addrs,
+        count,
+        extended);
+}
+
 void nrf_802154_pending_bit_for_addr_reset(bool extended)
 {
     nrf_802154_ser_err_t res;
@@ -963,6 +1169,7 @@ void nrf_802154_channel_set(uint8_t channel)
 {
     nrf_802154_ser_err_t res;
 
+    NRF_802154_SPINEL_LATENCY_START(latency_start);
     SERIALIZATION_ERROR_INIT(error);
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
@@ -980,6 +1187,8 @@ void nrf_802154_channel_set(uint8_t channel)
     res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
+    NRF_802154_SPINEL_LATENCY_RECORD(NRF_802154_SER_LATENCY_CHANNEL_SET, latency_start);
+
 bail:
     SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
 
@@ -1140,6 +1349,37 @@ bail:
     return ed_result;
 }
 
+bool nrf_802154_energy_scan(uint32_t channel_mask, uint32_t dwell_time_us)
+{
+    nrf_802154_ser_err_t res;
+    bool                 scan_result = false;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_SCAN);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_SCAN,
+        SPINEL_DATATYPE_NRF_802154_ENERGY_SCAN,
+        channel_mask,
+        dwell_time_us);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = net_generic_bool_response_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
+                                          &scan_result);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return scan_result;
+}
+
 #if NRF_802154_CSMA_CA_ENABLED
 
 bool nrf_802154_transmit_csma_ca_raw(uint8_t                                      * p_data,
@@ -1154,9 +1394,7 @@ bool nrf_802154_transmit_csma_ca_raw(uint8_t
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_BUFF(p_data, p_data[0]);
 
-    bool handle_added = nrf_802154_buffer_mgr_src_add(nrf_802154_spinel_src_buffer_mgr_get(),
-                                                      p_data,
-                                                      &data_handle);
+    bool handle_added = tx_frame_handle_add(p_data, &data_handle);
 
     if (p_metadata == NULL)
     {
@@ -1178,7 +1416,7 @@ bool nrf_802154_transmit_csma_ca_raw(uint8_t
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_CSMA_CA_RAW,
         SPINEL_DATATYPE_NRF_802154_TRANSMIT_CSMA_CA_RAW,
         NRF_802154_TRANSMIT_CSMA_CA_METADATA_ENCODE(*p_metadata),
-        NRF_802154_HDATA_ENCODE(data_handle, p_data, p_data[0]));
+        NRF_802154_HDATA_ENCODE(data_handle, p_data, tx_frame_serialized_len_get(p_data)));
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
@@ -1193,9 +1431,7 @@ bail:
     if (handle_added)
     {
         /* Rollback what we did until an error to avoid memory leak. */
-        nrf_802154_buffer_mgr_src_remove_by_buffer_handle(
-            nrf_802154_spinel_src_buffer_mgr_get(),
-            data_handle);
+        tx_frame_handle_remove(p_data, data_handle);
     }
 
     SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
@@ -1377,6 +1613,65 @@ bail:
     return max_backoffs;
 }
 
+bool nrf_802154_csma_ca_max_frame_retries_set(uint8_t max_frame_retries)
+{
+    nrf_802154_ser_err_t res;
+    bool                 result = false;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR("%u", max_frame_retries);
+
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_FRAME_RETRIES_SET);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_FRAME_RETRIES_SET,
+        SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_FRAME_RETRIES_SET,
+        max_frame_retries);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = net_generic_bool_response_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
+                                          &result);
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return result;
+}
+
+uint8_t nrf_802154_csma_ca_max_frame_retries_get(void)
+{
+    nrf_802154_ser_err_t res;
+    uint8_t              max_frame_retries = 0;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_FRAME_RETRIES_GET);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_FRAME_RETRIES_GET,
+        SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_FRAME_RETRIES_GET,
+        &max_frame_retries);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = net_generic_uint8_response_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
+                                           &max_frame_retries);
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return max_frame_retries;
+}
+
 #endif // NRF_802154_CSMA_CA_ENABLED
 
 #if NRF_802154_TEST_MODES_ENABLED
@@ -1438,6 +1733,41 @@ bail:
 
 #endif // NRF_802154_TEST_MODES_ENABLED
 
+/**
+ * @brief Value of SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW to be packed.
+ */
+typedef struct
+{
+    const nrf_802154_transmit_metadata_t * p_metadata;  ///< Transmit metadata.
+    uint32_t                               data_handle; ///< Handle of the frame to transmit.
+    const uint8_t                        * p_data;      ///< Frame to transmit.
+} transmit_raw_t;
+
+/**
+ * @brief Packs SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW.
+ *
+ * The layout matches @ref SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW.
+ *
+ * @param[inout]  p_writer  Writer to which the property is to be packed.
+ * @param[in]     p_ctx     Pointer to the @ref transmit_raw_t to be packed.
+ */
+static void transmit_raw_pack(nrf_802154_spinel_writer_t * p_writer, const void * p_ctx)
+{
+    const transmit_raw_t                 * p_tx       = (const transmit_raw_t *)p_ctx;
+    const nrf_802154_transmit_metadata_t * p_metadata = p_tx->p_metadata;
+
+    nrf_802154_spinel_writer_prop_key(p_writer, SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW);
+    nrf_802154_spinel_writer_bool(p_writer, p_metadata->frame_props.is_secured);
+    nrf_802154_spinel_writer_bool(p_writer, p_metadata->frame_props.dynamic_data_is_set);
+    nrf_802154_spinel_writer_bool(p_writer, p_metadata->cca);
+    nrf_802154_spinel_writer_bool(p_writer, p_metadata->tx_power.use_metadata_value);
+    nrf_802154_spinel_writer_uint8(p_writer, (uint8_t)p_metadata->tx_power.power);
+    nrf_802154_spinel_writer_hdata(p_writer,
+                                   p_tx->data_handle,
+                                   p_tx->p_data,
+                                   tx_frame_serialized_len_get(p_tx->p_data));
+}
+
 bool nrf_802154_transmit_raw(uint8_t                              * p_data,
                              const nrf_802154_transmit_metadata_t * p_metadata)
 {
@@ -1445,14 +1775,13 @@ bool nrf_802154_transmit_raw(uint8_t                              * p_data,
     uint32_t             data_handle;
     bool                 transmit_result = false;
 
+    NRF_802154_SPINEL_LATENCY_START(latency_start);
     SERIALIZATION_ERROR_INIT(error);
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_BUFF(p_data, p_data[0]);
 
-    bool handle_added = nrf_802154_buffer_mgr_src_add(nrf_802154_spinel_src_buffer_mgr_get(),
-                                                      p_data,
-                                                      &data_handle);
+    bool handle_added = tx_frame_handle_add(p_data, &data_handle);
 
     if (p_metadata == NULL)
     {
@@ -1471,11 +1800,14 @@ bool nrf_802154_transmit_raw(uint8_t                              * p_data,
     nrf_802154_spinel_response_notifier_lock_before_request(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW);
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW,
-        SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW,
-        NRF_802154_TRANSMIT_METADATA_ENCODE(*p_metadata),
-        NRF_802154_HDATA_ENCODE(data_handle, p_data, p_data[0]));
+    transmit_raw_t tx =
+    {
+        .p_metadata  = p_metadata,
+        .data_handle = data_handle,
+        .p_data      = p_data,
+    };
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set_packed(transmit_raw_pack, &tx);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
@@ -1484,15 +1816,15 @@ bool nrf_802154_transmit_raw(uint8_t                              * p_data,
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
+    NRF_802154_SPINEL_LATENCY_RECORD(NRF_802154_SER_LATENCY_TRANSMIT_RAW, latency_start);
+
     return transmit_result;
 
 bail:
     if (handle_added)
     {
         /* Rollback what we did until an error to avoid memory leak. */
-        nrf_802154_buffer_mgr_src_remove_by_buffer_handle(
-            nrf_802154_spinel_src_buffer_mgr_get(),
-            data_handle);
+        tx_frame_handle_remove(p_data, data_handle);
     }
 
     SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
@@ -1513,9 +1845,7 @@ bool nrf_802154_transmit_raw_at(uint8_t                                 * p_data
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_BUFF(p_data, p_data[0]);
 
-    bool handle_added = nrf_802154_buffer_mgr_src_add(nrf_802154_spinel_src_buffer_mgr_get(),
-                                                      p_data,
-                                                      &data_handle);
+    bool handle_added = tx_frame_handle_add(p_data, &data_handle);
 
     if (p_metadata == NULL)
     {
@@ -1542,7 +1872,7 @@ bool nrf_802154_transmit_raw_at(uint8_t                                 * p_data
         SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW_AT,
         NRF_802154_TRANSMIT_AT_METADATA_ENCODE(*p_metadata),
         tx_time,
-        NRF_802154_HDATA_ENCODE(data_handle, p_data, p_data[0]));
+        NRF_802154_HDATA_ENCODE(data_handle, p_data, tx_frame_serialized_len_get(p_data)));
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
@@ -1557,9 +1887,7 @@ bail:
     if (handle_added)
     {
         /* Rollback what we did until an error to avoid memory leak. */
-        nrf_802154_buffer_mgr_src_remove_by_buffer_handle(
-            nrf_802154_spinel_src_buffer_mgr_get(),
-            data_handle);
+        tx_frame_handle_remove(p_data, data_handle);
     }
 
     SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
@@ -1597,6 +1925,24 @@ bail:
     return cancel_result;
 }
 
+#if !NRF_802154_SER_LAZY_FREE_ENABLED
+/**
+ * @brief Packs SPINEL_PROP_VENDOR_NORDIC_NRF_802154_BUFFER_FREE_RAW.
+ *
+ * The layout matches @ref SPINEL_DATATYPE_NRF_802154_BUFFER_FREE_RAW.
+ *
+ * @param[inout]  p_writer  Writer to which the property is to be packed.
+ * @param[in]     p_ctx     Pointer to the handle of the buffer to be freed.
+ */
+static void buffer_free_raw_pack(nrf_802154_spinel_writer_t * p_writer, const void * p_ctx)
+{
+    nrf_802154_spinel_writer_prop_key(p_writer,
+                                      SPINEL_PROP_VENDOR_NORDIC_NRF_802154_BUFFER_FREE_RAW);
+    nrf_802154_spinel_writer_uint32(p_writer, *(const uint32_t *)p_ctx);
+}
+
+#endif // !NRF_802154_SER_LAZY_FREE_ENABLED
+
 void nrf_802154_buffer_free_raw(uint8_t * p_data)
 {
     nrf_802154_ser_err_t res;
@@ -1607,6 +1953,22 @@ void nrf_802154_buffer_free_raw(uint8_t * p_data)
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_BUFF(p_data, p_data[0]);
 
+#if NRF_802154_SER_SHM_RX_RING_ENABLED
+    uint8_t slot;
+
+    if (nrf_802154_shm_rx_ring_slot_find(p_data, &slot))
+    {
+        // Frames received through the shared-memory ring are returned without a round trip
+        SERIALIZATION_ERROR_IF(!nrf_802154_shm_rx_ring_slot_is_passed(slot),
+                               NRF_802154_SERIALIZATION_ERROR_INVALID_BUFFER,
+                               error,
+                               bail);
+
+        nrf_802154_shm_rx_ring_slot_release(slot);
+        goto bail;
+    }
+#endif
+
     bool handle_found = nrf_802154_buffer_mgr_dst_search_by_local_pointer(
         nrf_802154_spinel_dst_buffer_mgr_get(),
         p_data,
@@ -1617,12 +1979,23 @@ void nrf_802154_buffer_free_raw(uint8_t * p_data)
                            error,
                            bail);
 
+#if NRF_802154_SER_LAZY_FREE_ENABLED
+    bool removed = nrf_802154_buffer_mgr_dst_remove_by_local_pointer(
+        nrf_802154_spinel_dst_buffer_mgr_get(),
+        p_data);
+
+    SERIALIZATION_ERROR_IF(!removed,
+                           NRF_802154_SERIALIZATION_ERROR_INVALID_BUFFER,
+                           error,
+                           bail);
+
+    // The handle is returned to the network core later, together with other freed handles
+    res = nrf_802154_spinel_lazy_free_add(data_handle);
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+#else
     nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_BUFFER_FREE_RAW,
-        SPINEL_DATATYPE_NRF_802154_BUFFER_FREE_RAW,
-        data_handle);
+    res = nrf_802154_spinel_send_cmd_prop_value_set_packed(buffer_free_raw_pack, &data_handle);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
@@ -1637,6 +2010,7 @@ void nrf_802154_buffer_free_raw(uint8_t * p_data)
 
     res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
+#endif // NRF_802154_SER_LAZY_FREE_ENABLED
 
 bail:
     SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
@@ -1644,24 +2018,15 @@ bail:
     return;
 }
 
-void nrf_802154_tx_power_set(int8_t power)
+#if NRF_802154_SER_LAZY_FREE_ENABLED
+void nrf_802154_serialization_buffer_free_flush(void)
 {
-    nrf_802154_ser_err_t res;
-
     SERIALIZATION_ERROR_INIT(error);
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
-
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_POWER_SET,
-        SPINEL_DATATYPE_NRF_802154_TX_POWER_SET,
-        power);
-
-    SERIALIZATION_ERROR_CHECK(res, error, bail);
+    nrf_802154_ser_err_t res = nrf_802154_spinel_lazy_free_flush();
 
-    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
@@ -1670,71 +2035,182 @@ bail:
     return;
 }
 
-int8_t nrf_802154_tx_power_get(void)
+#endif // NRF_802154_SER_LAZY_FREE_ENABLED
+
+#if NRF_802154_SER_SHM_TX_POOL_ENABLED
+uint8_t * nrf_802154_serialization_tx_buffer_alloc(void)
 {
-    int32_t res;
-    int8_t  power = 0;
+    return nrf_802154_shm_tx_pool_alloc();
+}
+
+void nrf_802154_serialization_tx_buffer_free(uint8_t * p_buffer)
+{
+    nrf_802154_shm_tx_pool_free(p_buffer);
+}
+
+#endif // NRF_802154_SER_SHM_TX_POOL_ENABLED
+
+#if NRF_802154_SER_RX_FILTER_ENABLED
+bool nrf_802154_serialization_rx_filter_rule_add(const nrf_802154_ser_rx_filter_rule_t * p_rule)
+{
+    nrf_802154_ser_err_t res;
+    bool                 rule_add_res = false;
 
     SERIALIZATION_ERROR_INIT(error);
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%u", p_rule->fields, "fields");
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%u", p_rule->action, "action");
 
     nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_POWER_GET);
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RX_FILTER_RULE_ADD);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_POWER_GET,
-        SPINEL_DATATYPE_NRF_802154_TX_POWER_GET,
-        NULL);
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RX_FILTER_RULE_ADD,
+        SPINEL_DATATYPE_NRF_802154_RX_FILTER_RULE_ADD,
+        p_rule->fields,
+        (uint8_t)p_rule->action,
+        p_rule->frame_type,
+        p_rule->cmd_id,
+        p_rule->dst_pan_id,
+        sizeof(p_rule->dst_pan_id),
+        p_rule->dst_addr,
+        p_rule->dst_addr_extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = tx_power_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT, &power);
+    res = net_generic_bool_response_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
+                                          &rule_add_res);
+
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
     SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
 
-    return power;
+    return rule_add_res;
 }
 
-nrf_802154_capabilities_t nrf_802154_capabilities_get(void)
+void nrf_802154_serialization_rx_filter_clear(void)
 {
-    int32_t                   res;
-    nrf_802154_capabilities_t caps = 0UL;
+    nrf_802154_ser_err_t res;
 
     SERIALIZATION_ERROR_INIT(error);
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CAPABILITIES_GET);
+    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CAPABILITIES_GET,
-        SPINEL_DATATYPE_NRF_802154_CAPABILITIES_GET,
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RX_FILTER_CLEAR,
+        SPINEL_DATATYPE_NRF_802154_RX_FILTER_CLEAR,
         NULL);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = capabilities_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT, &caps);
+    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
     SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
 
-    return caps;
+    return;
 }
 
-uint64_t nrf_802154_time_get(void)
+#endif // NRF_802154_SER_RX_FILTER_ENABLED
+
+void nrf_802154_tx_power_set(int8_t power)
 {
-    int32_t  res;
-    uint64_t time = 0UL;
+    nrf_802154_ser_err_t res;
 
     SERIALIZATION_ERROR_INIT(error);
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
+    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_POWER_SET,
+        SPINEL_DATATYPE_NRF_802154_TX_POWER_SET,
+        power);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return;
+}
+
+int8_t nrf_802154_tx_power_get(void)
+{
+    int32_t res;
+    int8_t  power = 0;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_POWER_GET);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_POWER_GET,
+        SPINEL_DATATYPE_NRF_802154_TX_POWER_GET,
+        NULL);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = tx_power_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT, &power);
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return power;
+}
+
+nrf_802154_capabilities_t nrf_802154_capabilities_get(void)
+{
+    int32_t                   res;
+    nrf_802154_capabilities_t caps = 0UL;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CAPABILITIES_GET);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CAPABILITIES_GET,
+        SPINEL_DATATYPE_NRF_802154_CAPABILITIES_GET,
+        NULL);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = capabilities_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT, &caps);
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return caps;
+}
+
+/**
+ * @brief Reads the radio time from the network core.
+ *
+ * @param[out] p_time  Radio time.
+ *
+ * @returns  zero on success or negative error value on failure.
+ */
+static nrf_802154_ser_err_t remote_time_get(uint64_t * p_time)
+{
+    nrf_802154_ser_err_t res;
+
     nrf_802154_spinel_response_notifier_lock_before_request(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TIME_GET);
 
@@ -1743,9 +2219,66 @@ uint64_t nrf_802154_time_get(void)
         SPINEL_DATATYPE_NRF_802154_TIME_GET,
         NULL);
 
-    SERIALIZATION_ERROR_CHECK(res, error, bail);
+    if (res < 0)
+    {
+        return res;
+    }
+
+    return time_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT, p_time);
+}
+
+#if NRF_802154_SER_TIME_SYNC_ENABLED
+/**
+ * @brief Reads the radio time from the network core and uses it as a synchronization sample.
+ *
+ * @param[out] p_time     Radio time.
+ * @param[out] p_updated  Indicates if the synchronization estimate was updated.
+ *
+ * @returns  zero on success or negative error value on failure.
+ */
+static nrf_802154_ser_err_t remote_time_sync(uint64_t * p_time, bool * p_updated)
+{
+    uint64_t             local_sent = nrf_802154_spinel_local_time_get();
+    nrf_802154_ser_err_t res        = remote_time_get(p_time);
+
+    *p_updated = false;
+
+    if (res >= 0)
+    {
+        *p_updated = nrf_802154_spinel_time_sync_sample_add(local_sent,
+                                                            *p_time,
+                                                            nrf_802154_spinel_local_time_get());
+    }
+
+    return res;
+}
+
+#endif // NRF_802154_SER_TIME_SYNC_ENABLED
+
+uint64_t nrf_802154_time_get(void)
+{
+    int32_t  res;
+    uint64_t time = 0UL;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+
+#if NRF_802154_SER_TIME_SYNC_ENABLED
+    bool updated;
+
+    // A fresh estimate serves the request without a round trip
+    if (nrf_802154_spinel_time_sync_to_radio(nrf_802154_spinel_local_time_get(), &time))
+    {
+        goto bail;
+    }
+
+    res = remote_time_sync(&time, &updated);
+    (void)updated;
+#else
+    res = remote_time_get(&time);
+#endif
 
-    res = time_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT, &time);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
@@ -1754,6 +2287,38 @@ bail:
     return time;
 }
 
+#if NRF_802154_SER_TIME_SYNC_ENABLED
+bool nrf_802154_serialization_time_sync(void)
+{
+    nrf_802154_ser_err_t res;
+    uint64_t             time;
+    bool                 updated = false;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+
+    res = remote_time_sync(&time, &updated);
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return updated;
+}
+
+bool nrf_802154_serialization_time_to_local(uint64_t radio_time, uint64_t * p_local_time)
+{
+    return nrf_802154_spinel_time_sync_to_local(radio_time, p_local_time);
+}
+
+bool nrf_802154_serialization_time_from_local(uint64_t local_time, uint64_t * p_radio_time)
+{
+    return nrf_802154_spinel_time_sync_to_radio(local_time, p_radio_time);
+}
+
+#endif // NRF_802154_SER_TIME_SYNC_ENABLED
+
 void nrf_802154_cca_cfg_set(const nrf_802154_cca_cfg_t * p_cfg)
 {
     nrf_802154_ser_err_t res;
@@ -2029,6 +2594,271 @@ bail:
     SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
 }
 
+static nrf_802154_ser_err_t stat_histograms_get_ret_await(uint32_t                       timeout,
+                                                          nrf_802154_stat_histograms_t * p_stat_histograms)
+{
+    nrf_802154_ser_err_t              res;
+    nrf_802154_spinel_notify_buff_t * p_notify_data = NULL;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    p_notify_data = nrf_802154_spinel_response_notifier_property_await(
+        timeout);
+
+    SERIALIZATION_ERROR_IF(p_notify_data == NULL,
+                           NRF_802154_SERIALIZATION_ERROR_RESPONSE_TIMEOUT,
+                           error,
+                           bail);
+
+    res = nrf_802154_spinel_decode_prop_nrf_802154_stat_histograms_get_ret(
+        p_notify_data->data,
+        p_notify_data->data_len,
+        p_stat_histograms);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    NRF_802154_SPINEL_LOG_BANNER_RESPONSE();
+
+bail:
+    if (p_notify_data != NULL)
+    {
+        nrf_802154_spinel_response_notifier_free(p_notify_data);
+    }
+
+    return error;
+}
+
+void nrf_802154_stat_histograms_get(nrf_802154_stat_histograms_t * p_stat_histograms)
+{
+    nrf_802154_ser_err_t res;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_STAT_HISTOGRAMS_GET);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_STAT_HISTOGRAMS_GET,
+        SPINEL_DATATYPE_NRF_802154_STAT_HISTOGRAMS_GET,
+        NULL);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = stat_histograms_get_ret_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
+                                        p_stat_histograms);
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+}
+
+/**
+ * @brief Wait with timeout for a performance counter to be received.
+ *
+ * @param[in]  timeout    Timeout in us.
+ * @param[out] p_result   Pointer to the result of the call.
+ * @param[out] p_counter  Pointer to the counter which needs to be populated.
+ *
+ * @returns  zero on success or negative error value on failure.
+ *
+ */
+static nrf_802154_ser_err_t perf_counter_get_ret_await(uint32_t                    timeout,
+                                                       bool                      * p_result,
+                                                       nrf_802154_perf_counter_t * p_counter)
+{
+    nrf_802154_ser_err_t              res;
+    nrf_802154_spinel_notify_buff_t * p_notify_data = NULL;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    p_notify_data = nrf_802154_spinel_response_notifier_property_await(
+        timeout);
+
+    SERIALIZATION_ERROR_IF(p_notify_data == NULL,
+                           NRF_802154_SERIALIZATION_ERROR_RESPONSE_TIMEOUT,
+                           error,
+                           bail);
+
+    res = nrf_802154_spinel_decode_prop_nrf_802154_perf_counter_get_ret(
+        p_notify_data->data,
+        p_notify_data->data_len,
+        p_result,
+        p_counter);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    NRF_802154_SPINEL_LOG_BANNER_RESPONSE();
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%s", (*p_result) ? "true" : "false", "net response");
+
+bail:
+    if (p_notify_data != NULL)
+    {
+        nrf_802154_spinel_response_notifier_free(p_notify_data);
+    }
+
+    return error;
+}
+
+bool nrf_802154_perf_counter_get(uint32_t index, nrf_802154_perf_counter_t * p_counter)
+{
+    nrf_802154_ser_err_t res;
+    bool                 result = false;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%u", (unsigned int)index, "index");
+
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PERF_COUNTER_GET);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PERF_COUNTER_GET,
+        SPINEL_DATATYPE_NRF_802154_PERF_COUNTER_GET,
+        index);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = perf_counter_get_ret_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
+                                     &result,
+                                     p_counter);
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return result;
+}
+
+#if NRF_802154_LINK_METRICS_SERIES_ENABLED
+
+bool nrf_802154_link_metrics_series_configure(uint8_t                     series_id,
+                                              const uint8_t             * p_addr,
+                                              bool                        extended,
+                                              nrf_802154_lm_frame_types_t frame_types)
+{
+    nrf_802154_ser_err_t res;
+    bool                 result   = false;
+    uint8_t              addr_len = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+    static const uint8_t no_addr[EXTENDED_ADDRESS_SIZE];
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%u", series_id, "series_id");
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%u", frame_types, "frame_types");
+
+    if (p_addr == NULL)
+    {
+        p_addr = no_addr;
+    }
+
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_LINK_METRICS_SERIES_CONFIGURE);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_LINK_METRICS_SERIES_CONFIGURE,
+        SPINEL_DATATYPE_NRF_802154_LINK_METRICS_SERIES_CONFIGURE,
+        series_id,
+        p_addr,
+        addr_len,
+        frame_types);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = net_generic_bool_response_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
+                                          &result);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return result;
+}
+
+/**
+ * @brief Wait with timeout for Link Metrics series values to be received.
+ *
+ * @param[in]  timeout   Timeout in us.
+ * @param[out] p_result  Pointer to the result of the call.
+ * @param[out] p_series  Pointer to the series values which need to be populated.
+ *
+ * @returns  zero on success or negative error value on failure.
+ *
+ */
+static nrf_802154_ser_err_t link_metrics_series_get_ret_await(uint32_t                 timeout,
+                                                              bool                   * p_result,
+                                                              nrf_802154_lm_series_t * p_series)
+{
+    nrf_802154_ser_err_t              res;
+    nrf_802154_spinel_notify_buff_t * p_notify_data = NULL;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    p_notify_data = nrf_802154_spinel_response_notifier_property_await(
+        timeout);
+
+    SERIALIZATION_ERROR_IF(p_notify_data == NULL,
+                           NRF_802154_SERIALIZATION_ERROR_RESPONSE_TIMEOUT,
+                           error,
+                           bail);
+
+    res = nrf_802154_spinel_decode_prop_nrf_802154_link_metrics_series_get_ret(
+        p_notify_data->data,
+        p_notify_data->data_len,
+        p_result,
+        p_series);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    NRF_802154_SPINEL_LOG_BANNER_RESPONSE();
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%s", (*p_result) ? "true" : "false", "net response");
+
+bail:
+    if (p_notify_data != NULL)
+    {
+        nrf_802154_spinel_response_notifier_free(p_notify_data);
+    }
+
+    return error;
+}
+
+bool nrf_802154_link_metrics_series_get(uint8_t series_id, nrf_802154_lm_series_t * p_series)
+{
+    nrf_802154_ser_err_t res;
+    bool                 result = false;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%u", series_id, "series_id");
+
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_LINK_METRICS_SERIES_GET);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_LINK_METRICS_SERIES_GET,
+        SPINEL_DATATYPE_NRF_802154_LINK_METRICS_SERIES_GET,
+        series_id);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = link_metrics_series_get_ret_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
+                                            &result,
+                                            p_series);
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return result;
+}
+
+#endif // NRF_802154_LINK_METRICS_SERIES_ENABLED
+
 #if NRF_802154_IFS_ENABLED
 
 nrf_802154_ifs_mode_t nrf_802154_ifs_mode_get(void)
@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file nrf_802154_spinel_async_app.c
+ * @brief Asynchronous requests issued by the application core.
+ */
+
+#include "nrf_802154_spinel_async_app.h"
+
+#if NRF_802154_SER_ASYNC_ENABLED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_const.h"
+
+#include "nrf_802154_serialization_crit_sect.h"
+#include "nrf_802154_spinel.h"
+#include "nrf_802154_spinel_datatypes.h"
+#include "nrf_802154_spinel_dec_app.h"
+#include "nrf_802154_spinel_enc_app.h"
+#include "nrf_802154_spinel_log.h"
+
+#if (NRF_802154_SER_ASYNC_MAX_PENDING < 1) || \
+    (NRF_802154_SER_ASYNC_MAX_PENDING > SPINEL_HEADER_TID_MASK)
+#error "NRF_802154_SER_ASYNC_MAX_PENDING must be within 1 and 15"
+#endif
+
+/** @brief Pending asynchronous request. Request at index i uses transaction identifier i + 1. */
+typedef struct
+{
+    bool                            used;      ///< The request awaits a response.
+    nrf_802154_ser_async_token_t    token;     ///< Token returned to the issuer.
+    nrf_802154_ser_async_callback_t callback;  ///< Callback called on completion.
+    void                          * p_context; ///< Context passed to the callback.
+} async_request_t;
+
+static async_request_t              m_requests[NRF_802154_SER_ASYNC_MAX_PENDING];
+static nrf_802154_ser_async_token_t m_last_token;
+
+/**
+ * @brief Reserves a transaction identifier for a new asynchronous request.
+ *
+ * @param[in]   callback   Callback to be called on completion.
+ * @param[in]   p_context  Context to be passed to the callback.
+ * @param[out]  p_tid      Reserved transaction identifier.
+ *
+ * @return Token of the request or @ref NRF_802154_SER_ASYNC_TOKEN_INVALID if all transaction
+ *         identifiers are in use.
+ */
+static nrf_802154_ser_async_token_t request_alloc(nrf_802154_ser_async_callback_t callback,
+                                                  void                          * p_context,
+                                                  spinel_tid_t                  * p_tid)
+{
+    nrf_802154_ser_async_token_t token = NRF_802154_SER_ASYNC_TOKEN_INVALID;
+    uint32_t                     crit_sect;
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    for (size_t i = 0; i < NRF_802154_SER_ASYNC_MAX_PENDING; i++)
+    {
+        if (!m_requests[i].used)
+        {
+            if (++m_last_token == NRF_802154_SER_ASYNC_TOKEN_INVALID)
+            {
+                ++m_last_token;
+            }
+
+            token                   = m_last_token;
+            m_requests[i].used      = true;
+            m_requests[i].token     = token;
+            m_requests[i].callback  = callback;
+            m_requests[i].p_context = p_context;
+            *p_tid                  = (spinel_tid_t)(i + 1U);
+            break;
+        }
+    }
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    return token;
+}
+
+/**
+ * @brief Releases the transaction identifier of an asynchronous request.
+ *
+ * @param[in]  tid  Transaction identifier returned by @ref request_alloc.
+ */
+static void request_free(spinel_tid_t tid)
+{
+    m_requests[tid - 1U].used = false;
+}
+
+/**
+ * @brief Finishes issuing an asynchronous request.
+ *
+ * @param[in]  token  Token of the request.
+ * @param[in]  tid    Transaction identifier of the request.
+ * @param[in]  res    Result of sending the request.
+ *
+ * @return @p token if the request was sent or @ref NRF_802154_SER_ASYNC_TOKEN_INVALID otherwise.
+ */
+static nrf_802154_ser_async_token_t request_sent(nrf_802154_ser_async_token_t token,
+                                                 spinel_tid_t                 tid,
+                                                 nrf_802154_ser_err_t         res)
+{
+    if (res < 0)
+    {
+        request_free(tid);
+        return NRF_802154_SER_ASYNC_TOKEN_INVALID;
+    }
+
+    return token;
+}
+
+nrf_802154_ser_err_t nrf_802154_spinel_async_response_handle(spinel_tid_t      tid,
+                                                             spinel_prop_key_t property,
+                                                             const void      * p_property_data,
+                                                             size_t            property_data_len)
+{
+    async_request_t      request;
+    spinel_status_t      status;
+    nrf_802154_ser_err_t res;
+
+    if ((tid == 0U) || (tid > NRF_802154_SER_ASYNC_MAX_PENDING) || !m_requests[tid - 1U].used)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_RESPONSE_INVALID;
+    }
+
+    if (property != SPINEL_PROP_LAST_STATUS)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_RESPONSE_INVALID;
+    }
+
+    res = nrf_802154_spinel_decode_prop_last_status(p_property_data, property_data_len, &status);
+
+    if (res < 0)
+    {
+        return res;
+    }
+
+    // Release the identifier before calling back so the callback can issue another request.
+    request = m_requests[tid - 1U];
+    request_free(tid);
+
+    if (request.callback != NULL)
+    {
+        request.callback(request.token,
+                         (status == SPINEL_STATUS_OK) ? NRF_802154_SERIALIZATION_ERROR_OK :
+                         NRF_802154_SERIALIZATION_ERROR_RESPONSE_INVALID,
+                         request.p_context);
+    }
+
+    return NRF_802154_SERIALIZATION_ERROR_OK;
+}
+
+nrf_802154_ser_async_token_t nrf_802154_serialization_channel_set_async(
+    uint8_t                         channel,
+    nrf_802154_ser_async_callback_t callback,
+    void                          * p_context)
+{
+    nrf_802154_ser_async_token_t token;
+    spinel_tid_t                 tid;
+    nrf_802154_ser_err_t         res;
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR("%u", channel);
+
+    token = request_alloc(callback, p_context, &tid);
+
+    if (token == NRF_802154_SER_ASYNC_TOKEN_INVALID)
+    {
+        return token;
+    }
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set_tid(
+        tid,
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CHANNEL_SET,
+        SPINEL_DATATYPE_NRF_802154_CHANNEL_SET,
+        channel);
+
+    return request_sent(token, tid, res);
+}
+
+nrf_802154_ser_async_token_t nrf_802154_serialization_tx_power_set_async(
+    int8_t                          power,
+    nrf_802154_ser_async_callback_t callback,
+    void                          * p_context)
+{
+    nrf_802154_ser_async_token_t token;
+    spinel_tid_t                 tid;
+    nrf_802154_ser_err_t         res;
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR("%d", power);
+
+    token = request_alloc(callback, p_context, &tid);
+
+    if (token == NRF_802154_SER_ASYNC_TOKEN_INVALID)
+    {
+        return token;
+    }
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set_tid(
+        tid,
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_POWER_SET,
+        SPINEL_DATATYPE_NRF_802154_TX_POWER_SET,
+        power);
+
+    return request_sent(token, tid, res);
+}
+
+nrf_802154_ser_async_token_t nrf_802154_serialization_pan_id_set_async(
+    const uint8_t                 * p_pan_id,
+    nrf_802154_ser_async_callback_t callback,
+    void                          * p_context)
+{
+    nrf_802154_ser_async_token_t token;
+    spinel_tid_t                 tid;
+    nrf_802154_ser_err_t         res;
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_BUFF(p_pan_id, PAN_ID_SIZE);
+
+    token = request_alloc(callback, p_context, &tid);
+
+    if (token == NRF_802154_SER_ASYNC_TOKEN_INVALID)
+    {
+        return token;
+    }
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set_tid(
+        tid,
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_ID_SET,
+        SPINEL_DATATYPE_NRF_802154_PAN_ID_SET,
+        p_pan_id,
+        PAN_ID_SIZE);
+
+    return request_sent(token, tid, res);
+}
+
+nrf_802154_ser_async_token_t nrf_802154_serialization_short_address_set_async(
+    const uint8_t                 * p_short_address,
+    nrf_802154_ser_async_callback_t callback,
+    void                          * p_context)
+{
+    nrf_802154_ser_async_token_t token;
+    spinel_tid_t                 tid;
+    nrf_802154_ser_err_t         res;
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_BUFF(p_short_address, SHORT_ADDRESS_SIZE);
+
+    token = request_alloc(callback, p_context, &tid);
+
+    if (token == NRF_802154_SER_ASYNC_TOKEN_INVALID)
+    {
+        return token;
+    }
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set_tid(
+        tid,
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SHORT_ADDRESS_SET,
+        SPINEL_DATATYPE_NRF_802154_SHORT_ADDRESS_SET,
+        p_short_address,
+        SHORT_ADDRESS_SIZE);
+
+    return request_sent(token, tid, res);
+}
+
+nrf_802154_ser_async_token_t nrf_802154_serialization_extended_address_set_async(
+    const uint8_t                 * p_extended_address,
+    nrf_802154_ser_async_callback_t callback,
+    void                          * p_context)
+{
+    nrf_802154_ser_async_token_t token;
+    spinel_tid_t                 tid;
+    nrf_802154_ser_err_t         res;
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_BUFF(p_extended_address, EXTENDED_ADDRESS_SIZE);
+
+    token = request_alloc(callback, p_context, &tid);
+
+    if (token == NRF_802154_SER_ASYNC_TOKEN_INVALID)
+    {
+        return token;
+    }
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set_tid(
+        tid,
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_EXTENDED_ADDRESS_SET,
+        SPINEL_DATATYPE_NRF_802154_EXTENDED_ADDRESS_SET,
+        p_extended_address,
+        EXTENDED_ADDRESS_SIZE);
+
+    return request_sent(token, tid, res);
+}
+
+#endif // NRF_802154_SER_ASYNC_ENABLED
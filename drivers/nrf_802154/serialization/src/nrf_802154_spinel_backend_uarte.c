@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file nrf_802154_spinel_backend_uarte.c
+ * @brief Spinel serialization backend transporting HDLC-lite framed spinel frames over UARTE.
+ *
+ * Received bytes are written by EasyDMA into a ring of buffers and decoded in blocks, when
+ * a buffer of the ring is filled or when polled. Transmitted frames are encoded into one of two
+ * buffers while the other one is sent, so that frames queued during a transfer are sent
+ * together with a single transfer.
+ */
+
+#include "nrf_802154_serialization_config.h"
+
+#if NRF_802154_SER_BACKEND_UARTE_ENABLED
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "nrfx.h"
+#include "nrfx_uarte.h"
+
+#include "nrf_802154_hdlc.h"
+#include "nrf_802154_serialization_crit_sect.h"
+#include "nrf_802154_serialization_error.h"
+#include "nrf_802154_spinel.h"
+#include "nrf_802154_spinel_backend.h"
+#include "nrf_802154_spinel_backend_callouts.h"
+#include "nrf_802154_spinel_backend_uarte.h"
+
+#if NRF_802154_SER_BACKEND_NOCOPY_TX_ENABLED
+#error "The UARTE spinel backend does not provide transmit buffers for no-copy serialization."
+#endif
+
+#if !NRFX_CHECK(NRFX_UARTE_CONFIG_RX_RING_ENABLED)
+#error "The UARTE spinel backend requires NRFX_UARTE_CONFIG_RX_RING_ENABLED."
+#endif
+
+NRFX_STATIC_ASSERT(NRF_802154_SER_BACKEND_UARTE_TX_BUFFER_SIZE >=
+                   NRF_802154_HDLC_ENCODED_MAX_SIZE(NRF_802154_SPINEL_FRAME_BUFFER_SIZE));
+NRFX_STATIC_ASSERT(NRF_802154_SER_BACKEND_UARTE_RX_BUFFER_COUNT >= 2);
+
+/** @brief Structure representing a transmit buffer. */
+typedef struct
+{
+    /** @brief Encoded frames. */
+    uint8_t          data[NRF_802154_SER_BACKEND_UARTE_TX_BUFFER_SIZE];
+    /** @brief Number of bytes of the buffer reserved for encoded frames. */
+    size_t           length;
+    /** @brief Number of frames being encoded in the buffer. */
+    volatile uint8_t writers;
+} tx_buffer_t;
+
+static const nrfx_uarte_t m_uarte =
+    NRFX_UARTE_INSTANCE(NRF_802154_SER_BACKEND_UARTE_INSTANCE);
+
+/** @brief Ring of buffers written by UARTE reception. */
+static uint8_t m_rx_ring[NRF_802154_SER_BACKEND_UARTE_RX_BUFFER_SIZE *
+                         NRF_802154_SER_BACKEND_UARTE_RX_BUFFER_COUNT];
+
+/** @brief Buffer of the spinel frame being decoded. */
+static uint8_t m_rx_frame[NRF_802154_SPINEL_FRAME_BUFFER_SIZE + NRF_802154_HDLC_FCS_SIZE];
+
+static nrf_802154_hdlc_decoder_t m_decoder; ///< Decoder of received spinel frames.
+
+static tx_buffer_t m_tx_buffers[2]; ///< Transmit buffers, one filled while the other is sent.
+static uint8_t     m_tx_fill;       ///< Index of the transmit buffer being filled.
+static bool        m_tx_busy;       ///< Indicates that a transmit buffer is being sent.
+static bool        m_tx_requested;  ///< Indicates that queued frames are to be sent.
+
+static void frame_received(const uint8_t * p_frame, size_t frame_len)
+{
+    nrf_802154_spinel_encoded_packet_received(p_frame, frame_len);
+}
+
+/**
+ * @brief Starts sending the buffer being filled if it is requested and nothing prevents it.
+ *
+ * @note This function must be called from the serialization critical section.
+ *
+ * @retval true   The buffer was sent or there was nothing to do.
+ * @retval false  The transfer could not be started, queued frames were dropped.
+ */
+static bool tx_kick(void)
+{
+    tx_buffer_t * p_buffer = &m_tx_buffers[m_tx_fill];
+    nrfx_err_t    err;
+
+    if (m_tx_busy || !m_tx_requested || (p_buffer->writers != 0) || (p_buffer->length == 0))
+    {
+        return true;
+    }
+
+    m_tx_busy      = true;
+    m_tx_requested = false;
+    m_tx_fill     ^= 1;
+
+    // The other buffer was sent completely, so it can be filled from the beginning.
+    m_tx_buffers[m_tx_fill].length = 0;
+
+    err = nrfx_uarte_tx(&m_uarte, p_buffer->data, p_buffer->length, 0);
+
+    if (err != NRFX_SUCCESS)
+    {
+        m_tx_busy = false;
+        return false;
+    }
+
+    return true;
+}
+
+static nrf_802154_ser_err_t frame_queue(const void * p_data, size_t data_len, bool send)
+{
+    size_t        size = nrf_802154_hdlc_encoded_size(p_data, data_len);
+    tx_buffer_t * p_buffer;
+    size_t        offset;
+    uint32_t      crit_sect;
+    bool          result;
+
+    // Reserve space for the frame, then encode it outside of the critical section.
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    p_buffer = &m_tx_buffers[m_tx_fill];
+    offset   = p_buffer->length;
+
+    if (size > (sizeof(p_buffer->data) - offset))
+    {
+        nrf_802154_serialization_crit_sect_exit(crit_sect);
+        return NRF_802154_SERIALIZATION_ERROR_NO_MEMORY;
+    }
+
+    p_buffer->length += size;
+    p_buffer->writers++;
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    (void)nrf_802154_hdlc_encode(p_data, data_len, &p_buffer->data[offset], size);
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    p_buffer->writers--;
+    m_tx_requested = m_tx_requested || send;
+    result         = tx_kick();
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    return result ? (nrf_802154_ser_err_t)data_len : NRF_802154_SERIALIZATION_ERROR_BACKEND_FAILURE;
+}
+
+static void uarte_event_handler(nrfx_uarte_event_t const * p_event, void * p_context)
+{
+    uint32_t crit_sect;
+
+    (void)p_context;
+
+    switch (p_event->type)
+    {
+        case NRFX_UARTE_EVT_RX_DONE:
+            nrf_802154_hdlc_decode(&m_decoder, p_event->data.rx.p_data, p_event->data.rx.bytes);
+            break;
+
+        case NRFX_UARTE_EVT_TX_DONE:
+            nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+            // Frames queued during the transfer are sent right away.
+            m_tx_busy      = false;
+            m_tx_requested = m_tx_requested || (m_tx_buffers[m_tx_fill].length != 0);
+            (void)tx_kick();
+
+            nrf_802154_serialization_crit_sect_exit(crit_sect);
+            break;
+
+        default:
+            // Corrupted bytes are detected by the frame check sequence of the frame.
+            break;
+    }
+}
+
+nrf_802154_ser_err_t nrf_802154_spinel_encoded_packet_send(const void * p_data,
+                                                           size_t       data_len)
+{
+    return frame_queue(p_data, data_len, true);
+}
+
+#if NRF_802154_SER_IRQ_MODERATION_ENABLED
+
+nrf_802154_ser_err_t nrf_802154_spinel_encoded_packet_enqueue(const void * p_data,
+                                                              size_t       data_len)
+{
+    return frame_queue(p_data, data_len, false);
+}
+
+void nrf_802154_spinel_peer_signal(void)
+{
+    uint32_t crit_sect;
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    m_tx_requested = true;
+    (void)tx_kick();
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+}
+
+#endif // NRF_802154_SER_IRQ_MODERATION_ENABLED
+
+void nrf_802154_spinel_backend_uarte_poll(void)
+{
+    (void)nrfx_uarte_rx_ring_flush(&m_uarte);
+}
+
+nrf_802154_ser_err_t nrf_802154_backend_init(void)
+{
+    nrfx_uarte_config_t config = NRFX_UARTE_DEFAULT_CONFIG(NRF_802154_SER_BACKEND_UARTE_TX_PIN,
+                                                           NRF_802154_SER_BACKEND_UARTE_RX_PIN);
+
+    nrfx_uarte_rx_ring_config_t ring_config =
+    {
+        .p_buffer     = m_rx_ring,
+        .buffer_size  = NRF_802154_SER_BACKEND_UARTE_RX_BUFFER_SIZE,
+        .buffer_count = NRF_802154_SER_BACKEND_UARTE_RX_BUFFER_COUNT,
+        .p_timer      = NRF_802154_SER_BACKEND_UARTE_RX_TIMER,
+    };
+
+    config.rts_pin            = NRF_802154_SER_BACKEND_UARTE_RTS_PIN;
+    config.cts_pin            = NRF_802154_SER_BACKEND_UARTE_CTS_PIN;
+    config.baudrate           = NRF_802154_SER_BACKEND_UARTE_BAUDRATE;
+    config.interrupt_priority = NRF_802154_SER_BACKEND_UARTE_IRQ_PRIORITY;
+
+    if ((config.rts_pin != NRF_UARTE_PSEL_DISCONNECTED) &&
+        (config.cts_pin != NRF_UARTE_PSEL_DISCONNECTED))
+    {
+        config.config.hwfc = NRF_UARTE_HWFC_ENABLED;
+    }
+
+    m_tx_fill      = 0;
+    m_tx_busy      = false;
+    m_tx_requested = false;
+
+    for (size_t i = 0; i < NRFX_ARRAY_SIZE(m_tx_buffers); i++)
+    {
+        m_tx_buffers[i].length  = 0;
+        m_tx_buffers[i].writers = 0;
+    }
+
+    nrf_802154_hdlc_decoder_init(&m_decoder, m_rx_frame, sizeof(m_rx_frame), frame_received);
+
+    if (nrfx_uarte_init(&m_uarte, &config, uarte_event_handler) != NRFX_SUCCESS)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_INIT_FAILED;
+    }
+
+    if (nrfx_uarte_rx_ring_start(&m_uarte, &ring_config) != NRFX_SUCCESS)
+    {
+        nrfx_uarte_uninit(&m_uarte);
+        return NRF_802154_SERIALIZATION_ERROR_INIT_FAILED;
+    }
+
+    nrf_802154_spinel_backend_uarte_poll_timer_start(NRF_802154_SER_BACKEND_UARTE_POLL_PERIOD_US);
+
+    return NRF_802154_SERIALIZATION_ERROR_OK;
+}
+
+#endif // NRF_802154_SER_BACKEND_UARTE_ENABLED
@@ -40,26 +40,58 @@
 #include "nrf_802154_spinel_dec.h"
 #include "nrf_802154_serialization_error.h"
 
+/** @brief Transaction identifier of the most recently decoded spinel command. */
+static spinel_tid_t m_decoded_cmd_tid;
+
 nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd(const void * p_packet_data,
                                                   size_t       packet_data_len)
 {
-    uint8_t          header;
-    spinel_command_t cmd;
-    const void     * p_cmd_data;
-    size_t           cmd_data_len;
+    const uint8_t * p_data = (const uint8_t *)p_packet_data;
+    unsigned int    cmd;
+    spinel_ssize_t  siz;
+
+    // The header and the packed command are decoded directly as every packet starts with them.
+    if (packet_data_len < sizeof(uint8_t))
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
 
-    spinel_ssize_t siz = spinel_datatype_unpack(p_packet_data,
-                                                packet_data_len,
-                                                SPINEL_DATATYPE_COMMAND_S SPINEL_DATATYPE_DATA_S,
-                                                &header,
-                                                &cmd,
-                                                &p_cmd_data,
-                                                &cmd_data_len);
+    siz = spinel_packed_uint_decode(&p_data[1], packet_data_len - 1U, &cmd);
 
     if (siz < 0)
     {
         return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
     }
 
-    return nrf_802154_spinel_dispatch_cmd(cmd, p_cmd_data, cmd_data_len);
+    m_decoded_cmd_tid = SPINEL_HEADER_GET_TID(p_data[0]);
+
+    return nrf_802154_spinel_dispatch_cmd((spinel_command_t)cmd,
+                                          &p_data[1 + siz],
+                                          packet_data_len - 1U - (size_t)siz);
+}
+
+nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_key(const void        * p_cmd_data,
+                                                       size_t              cmd_data_len,
+                                                       spinel_prop_key_t * p_property,
+                                                       const void       ** pp_property_data,
+                                                       size_t            * p_property_data_len)
+{
+    unsigned int   property;
+    spinel_ssize_t siz = spinel_packed_uint_decode(p_cmd_data, cmd_data_len, &property);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    *p_property          = (spinel_prop_key_t)property;
+    *pp_property_data    = (const uint8_t *)p_cmd_data + siz;
+    *p_property_data_len = cmd_data_len - (size_t)siz;
+
+    return NRF_802154_SERIALIZATION_ERROR_OK;
+}
+
+spinel_tid_t nrf_802154_spinel_decoded_cmd_tid_get(void)
+{
+    return m_decoded_cmd_tid;
 }
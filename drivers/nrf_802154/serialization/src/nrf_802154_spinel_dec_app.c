@@ -44,11 +44,17 @@
 #include "nrf_802154_spinel.h"
 #include "nrf_802154_spinel_datatypes.h"
 #include "nrf_802154_spinel_dec.h"
+#include "nrf_802154_spinel_latency.h"
 #include "nrf_802154_spinel_response_notifier.h"
+#include "nrf_802154_spinel_rx_compact.h"
 #include "nrf_802154_spinel_log.h"
+#include "nrf_802154_spinel_pack.h"
 #include "nrf_802154_serialization_error.h"
 #include "nrf_802154_buffer_mgr_dst.h"
 #include "nrf_802154_buffer_mgr_src.h"
+#include "nrf_802154_shm_rx_ring.h"
+#include "nrf_802154_shm_tx_pool.h"
+#include "nrf_802154_spinel_async_app.h"
 
 #include "nrf_802154.h"
 #include "nrf_802154_config.h"
@@ -177,34 +183,71 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_energy_detection_faile
 }
 
 /**
- * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW.
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_SCAN_DONE.
  *
  * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
  * @param[in]  property_data_len  Size of the @ref p_data buffer.
  */
-static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_received_timestamp_raw(
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_energy_scan_done(
     const void * p_property_data,
     size_t       property_data_len)
 {
-    uint32_t remote_frame_handle;
-    void   * p_frame;
-    size_t   frame_hdata_len;
-    int8_t   power;
-    uint8_t  lqi;
-    uint64_t timestamp;
-    void   * p_local_ptr;
+    nrf_802154_energy_scan_result_t result = {};
+    const uint8_t                 * p_data;
+    size_t                          data_len;
 
     spinel_ssize_t siz = spinel_datatype_unpack(p_property_data,
                                                 property_data_len,
-                                                SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW,
-                                                NRF_802154_HDATA_DECODE(remote_frame_handle,
-                                                                        p_frame,
-                                                                        frame_hdata_len),
-                                                &power,
-                                                &lqi,
-                                                &timestamp);
+                                                SPINEL_DATATYPE_NRF_802154_ENERGY_SCAN_DONE,
+                                                &result.channel_mask,
+                                                &p_data,
+                                                &data_len);
 
-    if (siz < 0)
+    if ((siz < 0) || (data_len != sizeof(result.ed_dbm)))
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    memcpy(result.ed_dbm, p_data, data_len);
+
+    nrf_802154_energy_scan_done(&result);
+
+    return NRF_802154_SERIALIZATION_ERROR_OK;
+}
+
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_received_timestamp_raw(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    uint32_t                   remote_frame_handle;
+    const void               * p_frame;
+    size_t                     frame_hdata_len;
+    int8_t                     power;
+    uint8_t                    lqi;
+    uint64_t                   timestamp;
+    void                     * p_local_ptr;
+    nrf_802154_spinel_reader_t reader;
+
+    NRF_802154_SPINEL_LATENCY_START(latency_start);
+
+    // The layout is fixed by SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW
+    nrf_802154_spinel_reader_init(&reader, p_property_data, property_data_len);
+
+    nrf_802154_spinel_reader_hdata(&reader,
+                                   &remote_frame_handle,
+                                   &p_frame,
+                                   &frame_hdata_len);
+    power     = (int8_t)nrf_802154_spinel_reader_uint8(&reader);
+    lqi       = nrf_802154_spinel_reader_uint8(&reader);
+    timestamp = nrf_802154_spinel_reader_uint64(&reader);
+
+    if (reader.error)
     {
         return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
     }
@@ -223,11 +266,145 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_received_timestamp_raw
         return NRF_802154_SERIALIZATION_ERROR_NO_MEMORY;
     }
 
+#if NRF_802154_SER_COMPACT_RX_ENABLED
+    nrf_802154_spinel_rx_compact_ref_update(remote_frame_handle, timestamp);
+#endif
+
+    NRF_802154_SPINEL_LATENCY_RECORD(NRF_802154_SER_LATENCY_RECEIVED_RAW_DECODE, latency_start);
+
+    nrf_802154_received_timestamp_raw(p_local_ptr, power, lqi, timestamp);
+
+    return NRF_802154_SERIALIZATION_ERROR_OK;
+}
+
+#if NRF_802154_SER_COMPACT_RX_ENABLED
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_COMPACT.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_received_timestamp_compact(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    uint32_t                   handle_delta;
+    uint32_t                   time_delta;
+    uint32_t                   remote_frame_handle;
+    const void               * p_frame;
+    size_t                     frame_len;
+    int8_t                     power;
+    uint8_t                    lqi;
+    uint64_t                   timestamp;
+    void                     * p_local_ptr;
+    nrf_802154_spinel_reader_t reader;
+
+    NRF_802154_SPINEL_LATENCY_START(latency_start);
+
+    // The layout is fixed by SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_COMPACT
+    nrf_802154_spinel_reader_init(&reader, p_property_data, property_data_len);
+
+    handle_delta = nrf_802154_spinel_reader_packed_uint(&reader);
+    time_delta   = nrf_802154_spinel_reader_packed_uint(&reader);
+    power        = (int8_t)nrf_802154_spinel_reader_uint8(&reader);
+    lqi          = nrf_802154_spinel_reader_uint8(&reader);
+    frame_len    = reader.len;
+    p_frame      = nrf_802154_spinel_reader_consume(&reader, frame_len);
+
+    if (reader.error)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    if (!nrf_802154_spinel_rx_compact_delta_apply(handle_delta,
+                                                  time_delta,
+                                                  &remote_frame_handle,
+                                                  &timestamp))
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    // Associate the remote frame handle with a local pointer
+    // and copy the buffer content there
+    bool frame_added = nrf_802154_buffer_mgr_dst_add(nrf_802154_spinel_dst_buffer_mgr_get(),
+                                                     remote_frame_handle,
+                                                     p_frame,
+                                                     frame_len,
+                                                     &p_local_ptr);
+
+    if (!frame_added)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_NO_MEMORY;
+    }
+
+    nrf_802154_spinel_rx_compact_ref_update(remote_frame_handle, timestamp);
+
+    NRF_802154_SPINEL_LATENCY_RECORD(NRF_802154_SER_LATENCY_RECEIVED_RAW_DECODE, latency_start);
+
     nrf_802154_received_timestamp_raw(p_local_ptr, power, lqi, timestamp);
 
     return NRF_802154_SERIALIZATION_ERROR_OK;
 }
 
+#endif // NRF_802154_SER_COMPACT_RX_ENABLED
+
+#if NRF_802154_SER_SHM_RX_RING_ENABLED
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_SHM.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_received_timestamp_shm(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    uint8_t   slot;
+    uint8_t   frame_len;
+    int8_t    power;
+    uint8_t   lqi;
+    uint64_t  timestamp;
+    uint8_t * p_frame;
+
+    NRF_802154_SPINEL_LATENCY_START(latency_start);
+
+    spinel_ssize_t siz = spinel_datatype_unpack(p_property_data,
+                                                property_data_len,
+                                                SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_SHM,
+                                                &slot,
+                                                &frame_len,
+                                                &power,
+                                                &lqi,
+                                                &timestamp);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    if (!nrf_802154_shm_rx_ring_slot_is_passed(slot))
+    {
+        return NRF_802154_SERIALIZATION_ERROR_INVALID_BUFFER;
+    }
+
+    // The frame is already in place. No copy is needed
+    p_frame = nrf_802154_shm_rx_ring_slot_data_get(slot);
+
+    if (p_frame[0] != frame_len)
+    {
+        nrf_802154_shm_rx_ring_slot_release(slot);
+        return NRF_802154_SERIALIZATION_ERROR_INVALID_BUFFER;
+    }
+
+    NRF_802154_SPINEL_LATENCY_RECORD(NRF_802154_SER_LATENCY_RECEIVED_RAW_DECODE, latency_start);
+
+    nrf_802154_received_timestamp_raw(p_frame, power, lqi, timestamp);
+
+    return NRF_802154_SERIALIZATION_ERROR_OK;
+}
+
+#endif // NRF_802154_SER_SHM_RX_RING_ENABLED
+
 /**
  * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_FAILED
  *
@@ -286,6 +463,68 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_tx_ack_started(
     return NRF_802154_SERIALIZATION_ERROR_OK;
 }
 
+/**
+ * @brief Finds the local buffer of a transmitted frame.
+ *
+ * A frame placed in the shared-memory TX pool is identified by its address and is not serialized
+ * back, because both cores access it in place.
+ *
+ * @param[in]  frame_handle     Handle of the frame.
+ * @param[in]  frame_hdata_len  Length of the serialized frame HDATA.
+ * @param[out] pp_local_frame   Pointer to the local buffer of the frame.
+ *
+ * @retval true   The frame was found.
+ * @retval false  The frame was not found.
+ */
+static bool tx_frame_local_ptr_get(uint32_t frame_handle,
+                                   size_t   frame_hdata_len,
+                                   void  ** pp_local_frame)
+{
+#if NRF_802154_SER_SHM_TX_POOL_ENABLED
+    void * p_shm_frame = (void *)(uintptr_t)frame_handle;
+
+    if ((NRF_802154_DATA_LEN_FROM_HDATA_LEN(frame_hdata_len) == 0U) &&
+        nrf_802154_shm_tx_pool_contains(p_shm_frame))
+    {
+        *pp_local_frame = p_shm_frame;
+        return true;
+    }
+#else
+    (void)frame_hdata_len;
+#endif
+
+    return nrf_802154_buffer_mgr_src_search_by_buffer_handle(
+        nrf_802154_spinel_src_buffer_mgr_get(),
+        frame_handle,
+        pp_local_frame);
+}
+
+/**
+ * @brief Releases the handle of a transmitted frame found with @ref tx_frame_local_ptr_get.
+ *
+ * @param[in]  frame_handle     Handle of the frame.
+ * @param[in]  frame_hdata_len  Length of the serialized frame HDATA.
+ *
+ * @retval true   The handle was released.
+ * @retval false  The handle was not found.
+ */
+static bool tx_frame_local_ptr_release(uint32_t frame_handle, size_t frame_hdata_len)
+{
+#if NRF_802154_SER_SHM_TX_POOL_ENABLED
+    if ((NRF_802154_DATA_LEN_FROM_HDATA_LEN(frame_hdata_len) == 0U) &&
+        nrf_802154_shm_tx_pool_contains((void *)(uintptr_t)frame_handle))
+    {
+        return true;
+    }
+#else
+    (void)frame_hdata_len;
+#endif
+
+    return nrf_802154_buffer_mgr_src_remove_by_buffer_handle(
+        nrf_802154_spinel_src_buffer_mgr_get(),
+        frame_handle);
+}
+
 /**
  * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMITTED_RAW.
  *
@@ -298,36 +537,38 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_transmitted_raw(
 {
     uint32_t                            frame_handle;
     uint32_t                            remote_ack_handle;
-    void                              * p_ack;
+    const void                        * p_ack;
     size_t                              ack_hdata_len;
     size_t                              frame_hdata_len;
     void                              * p_local_frame;
-    void                              * p_serialized_frame;
+    const void                        * p_serialized_frame;
     void                              * p_ack_local_ptr = NULL;
     nrf_802154_transmit_done_metadata_t metadata        = {0};
-
-    spinel_ssize_t siz = spinel_datatype_unpack(p_property_data,
-                                                property_data_len,
-                                                SPINEL_DATATYPE_NRF_802154_TRANSMITTED_RAW,
-                                                NRF_802154_TRANSMITTED_RAW_DECODE(frame_handle,
-                                                                                  p_serialized_frame,
-                                                                                  frame_hdata_len,
-                                                                                  metadata,
-                                                                                  remote_ack_handle,
-                                                                                  ack_hdata_len));
-
-    p_ack = metadata.data.transmitted.p_ack;
-
-    if (siz < 0)
+    nrf_802154_spinel_reader_t          reader;
+
+    // The layout is fixed by SPINEL_DATATYPE_NRF_802154_TRANSMITTED_RAW
+    nrf_802154_spinel_reader_init(&reader, p_property_data, property_data_len);
+
+    nrf_802154_spinel_reader_hdata(&reader,
+                                   &frame_handle,
+                                   &p_serialized_frame,
+                                   &frame_hdata_len);
+    metadata.frame_props.is_secured          = nrf_802154_spinel_reader_bool(&reader);
+    metadata.frame_props.dynamic_data_is_set = nrf_802154_spinel_reader_bool(&reader);
+    metadata.retries                         = nrf_802154_spinel_reader_uint8(&reader);
+    metadata.data.transmitted.length         = nrf_802154_spinel_reader_uint8(&reader);
+    metadata.data.transmitted.power          = (int8_t)nrf_802154_spinel_reader_uint8(&reader);
+    metadata.data.transmitted.lqi            = nrf_802154_spinel_reader_uint8(&reader);
+    metadata.data.transmitted.time           = nrf_802154_spinel_reader_uint64(&reader);
+    nrf_802154_spinel_reader_hdata(&reader, &remote_ack_handle, &p_ack, &ack_hdata_len);
+
+    if (reader.error)
     {
         return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
     }
 
     // Search for the original frame buffer based on the provided handle
-    bool frame_found = nrf_802154_buffer_mgr_src_search_by_buffer_handle(
-        nrf_802154_spinel_src_buffer_mgr_get(),
-        frame_handle,
-        &p_local_frame);
+    bool frame_found = tx_frame_local_ptr_get(frame_handle, frame_hdata_len, &p_local_frame);
 
     if (!frame_found)
     {
@@ -358,9 +599,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_transmitted_raw(
         }
     }
 
-    frame_found = nrf_802154_buffer_mgr_src_remove_by_buffer_handle(
-        nrf_802154_spinel_src_buffer_mgr_get(),
-        frame_handle);
+    frame_found = tx_frame_local_ptr_release(frame_handle, frame_hdata_len);
 
     if (!frame_found)
     {
@@ -410,10 +649,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_transmit_failed(
     }
 
     // Search for the original frame buffer based on the provided handle
-    bool frame_found = nrf_802154_buffer_mgr_src_search_by_buffer_handle(
-        nrf_802154_spinel_src_buffer_mgr_get(),
-        frame_handle,
-        &p_local_frame);
+    bool frame_found = tx_frame_local_ptr_get(frame_handle, frame_hdata_len, &p_local_frame);
 
     if (!frame_found)
     {
@@ -422,9 +658,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_transmit_failed(
         return NRF_802154_SERIALIZATION_ERROR_INVALID_BUFFER;
     }
 
-    frame_found = nrf_802154_buffer_mgr_src_remove_by_buffer_handle(
-        nrf_802154_spinel_src_buffer_mgr_get(),
-        frame_handle);
+    frame_found = tx_frame_local_ptr_release(frame_handle, frame_hdata_len);
 
     if (!frame_found)
     {
@@ -567,159 +801,330 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_nrf_802154_stat_timestamps_ge
             NRF_802154_SERIALIZATION_ERROR_OK);
 }
 
-nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_is(
-    const void * p_cmd_data,
-    size_t       cmd_data_len)
+nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_nrf_802154_stat_histograms_get_ret(
+    const void                   * p_property_data,
+    size_t                         property_data_len,
+    nrf_802154_stat_histograms_t * p_stat_histograms)
 {
-    spinel_prop_key_t property;
-    const void      * p_property_data;
-    size_t            property_data_len;
-    spinel_ssize_t    siz;
+    const uint8_t * p_data;
+    size_t          data_len;
 
-    siz = spinel_datatype_unpack(p_cmd_data,
-                                 cmd_data_len,
-                                 SPINEL_DATATYPE_UINT_PACKED_S SPINEL_DATATYPE_DATA_S,
-                                 &property,
-                                 &p_property_data,
-                                 &property_data_len);
+    spinel_ssize_t siz = spinel_datatype_unpack(p_property_data,
+                                                property_data_len,
+                                                SPINEL_DATATYPE_NRF_802154_STAT_HISTOGRAMS_GET_RET,
+                                                &p_data,
+                                                &data_len);
 
-    if (siz < 0)
+    if ((siz < 0) || (data_len != sizeof(*p_stat_histograms)))
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    memcpy(p_stat_histograms, p_data, data_len);
+
+    return NRF_802154_SERIALIZATION_ERROR_OK;
+}
+
+nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_nrf_802154_perf_counter_get_ret(
+    const void                * p_property_data,
+    size_t                      property_data_len,
+    bool                      * p_result,
+    nrf_802154_perf_counter_t * p_counter)
+{
+    const uint8_t * p_data;
+    size_t          data_len;
+
+    spinel_ssize_t siz = spinel_datatype_unpack(
+        p_property_data,
+        property_data_len,
+        SPINEL_DATATYPE_NRF_802154_PERF_COUNTER_GET_RET,
+        p_result,
+        &p_data,
+        &data_len);
+
+    if ((siz < 0) || (data_len != sizeof(*p_counter)))
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    if (*p_result)
+    {
+        memcpy(p_counter, p_data, data_len);
+    }
+
+    return NRF_802154_SERIALIZATION_ERROR_OK;
+}
+
+nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_nrf_802154_link_metrics_series_get_ret(
+    const void             * p_property_data,
+    size_t                   property_data_len,
+    bool                   * p_result,
+    nrf_802154_lm_series_t * p_series)
+{
+    const uint8_t * p_data;
+    size_t          data_len;
+
+    spinel_ssize_t siz = spinel_datatype_unpack(
+        p_property_data,
+        property_data_len,
+        SPINEL_DATATYPE_NRF_802154_LINK_METRICS_SERIES_GET_RET,
+        p_result,
+        &p_data,
+        &data_len);
+
+    if ((siz < 0) || (data_len != sizeof(*p_series)))
     {
         return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
     }
 
-    switch (property)
-    {
-        case SPINEL_PROP_LAST_STATUS:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SLEEP:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SLEEP_IF_IDLE:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT_CANCEL:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA:
-            // fall through
+    if (*p_result)
+    {
+        memcpy(p_series, p_data, data_len);
+    }
+
+    return NRF_802154_SERIALIZATION_ERROR_OK;
+}
+
+/**
+ * @brief Decoding of a single property carried by SPINEL_CMD_PROP_VALUE_IS.
+ */
+typedef struct
+{
+    nrf_802154_spinel_prop_decoder_t decoder;  ///< Decoder of a notification property.
+    bool                             response; ///< Property is a response to an awaited request.
+} prop_value_is_entry_t;
+
+/**
+ * @brief Defines an entry of a property decoding a notification.
+ */
+#define PROP_DECODER(property, _decoder) \
+    [NRF_802154_SPINEL_PROP_IDX(property)] = {.decoder = (_decoder), .response = false}
+
+/**
+ * @brief Defines an entry of a property passed to the response notifier.
+ */
+#define PROP_RESPONSE(property) \
+    [NRF_802154_SPINEL_PROP_IDX(property)] = {.decoder = NULL, .response = true}
+
+/**
+ * @brief Decoding of properties carried by SPINEL_CMD_PROP_VALUE_IS, indexed by property.
+ *
+ * Properties not supported in the current configuration have neither decoder nor response flag.
+ */
+static const prop_value_is_entry_t m_prop_value_is_entries[NRF_802154_SPINEL_PROP_NUM] =
+{
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SLEEP),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SLEEP_IF_IDLE),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT_CANCEL),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA),
+
 #if NRF_802154_CARRIER_FUNCTIONS_ENABLED
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CONTINUOUS_CARRIER:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_MODULATED_CARRIER:
-            // fall through
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CONTINUOUS_CARRIER),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_MODULATED_CARRIER),
 #endif
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTION:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_POWER_GET:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CHANNEL_GET:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CAPABILITIES_GET:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TIME_GET:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA_CFG_GET:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_STORE:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_REMOVE:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_SET:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_SET:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_CLEAR:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW_AT:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_AT_CANCEL:
-            // fall through
+
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTION),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_SCAN),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_POWER_GET),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CHANNEL_GET),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CAPABILITIES_GET),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TIME_GET),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA_CFG_GET),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_STORE),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_REMOVE),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_SET),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_SET_BATCH),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR_BATCH),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_SET),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_CLEAR),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW_AT),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_AT_CANCEL),
+
 #if NRF_802154_CSMA_CA_ENABLED
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_CSMA_CA_RAW:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MIN_BE_SET:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MIN_BE_GET:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BE_SET:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BE_GET:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BACKOFFS_SET:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BACKOFFS_GET:
-            // fall through
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_CSMA_CA_RAW),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MIN_BE_SET),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MIN_BE_GET),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BE_SET),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BE_GET),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BACKOFFS_SET),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BACKOFFS_GET),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_FRAME_RETRIES_SET),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_FRAME_RETRIES_GET),
 #endif // NRF_802154_CSMA_CA_ENABLED
+
 #if NRF_802154_TEST_MODES_ENABLED
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TEST_MODE_CSMACA_BACKOFF_SET:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TEST_MODE_CSMACA_BACKOFF_GET:
-            // fall through
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TEST_MODE_CSMACA_BACKOFF_SET),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TEST_MODE_CSMACA_BACKOFF_GET),
 #endif // NRF_802154_TEST_MODES_ENABLED
+
 #if NRF_802154_IFS_ENABLED
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MODE_SET:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MODE_GET:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_SIFS_PERIOD_GET:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_LIFS_PERIOD_GET:
-            // fall through
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MODE_SET),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MODE_GET),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_SIFS_PERIOD_GET),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_LIFS_PERIOD_GET),
 #endif // NRF_802154_IFS_ENABLED
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_STAT_TIMESTAMPS_GET:
-            nrf_802154_spinel_response_notifier_property_notify(property,
-                                                                p_property_data,
-                                                                property_data_len);
-            return NRF_802154_SERIALIZATION_ERROR_OK;
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA_DONE:
-            return spinel_decode_prop_nrf_802154_cca_done(p_property_data,
-                                                          property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA_FAILED:
-            return spinel_decode_prop_nrf_802154_cca_failed(p_property_data,
-                                                            property_data_len);
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTED:
-            return spinel_decode_prop_nrf_802154_energy_detected(p_property_data,
-                                                                 property_data_len);
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_STAT_TIMESTAMPS_GET),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_STAT_HISTOGRAMS_GET),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PERF_COUNTER_GET),
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTION_FAILED:
-            return spinel_decode_prop_nrf_802154_energy_detection_failed(p_property_data,
-                                                                         property_data_len);
+#if NRF_802154_LINK_METRICS_SERIES_ENABLED
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_LINK_METRICS_SERIES_CONFIGURE),
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_LINK_METRICS_SERIES_GET),
+#endif // NRF_802154_LINK_METRICS_SERIES_ENABLED
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW:
-            return spinel_decode_prop_nrf_802154_received_timestamp_raw(p_property_data,
-                                                                        property_data_len);
+#if NRF_802154_SER_COMPACT_RX_ENABLED
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RX_COMPACT_ENABLE),
+#endif
+
+#if NRF_802154_SER_RX_FILTER_ENABLED
+    PROP_RESPONSE(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RX_FILTER_RULE_ADD),
+#endif
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMITTED_RAW:
-            return spinel_decode_prop_nrf_802154_transmitted_raw(p_property_data,
-                                                                 property_data_len);
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA_DONE,
+                 spinel_decode_prop_nrf_802154_cca_done),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA_FAILED,
+                 spinel_decode_prop_nrf_802154_cca_failed),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTED,
+                 spinel_decode_prop_nrf_802154_energy_detected),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTION_FAILED,
+                 spinel_decode_prop_nrf_802154_energy_detection_failed),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_SCAN_DONE,
+                 spinel_decode_prop_nrf_802154_energy_scan_done),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW,
+                 spinel_decode_prop_nrf_802154_received_timestamp_raw),
+
+#if NRF_802154_SER_SHM_RX_RING_ENABLED
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_SHM,
+                 spinel_decode_prop_nrf_802154_received_timestamp_shm),
+#endif
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_FAILED:
-            return spinel_decode_prop_nrf_802154_transmit_failed(p_property_data,
-                                                                 property_data_len);
+#if NRF_802154_SER_COMPACT_RX_ENABLED
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_COMPACT,
+                 spinel_decode_prop_nrf_802154_received_timestamp_compact),
+#endif
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_FAILED:
-            return spinel_decode_prop_nrf_802154_receive_failed(p_property_data,
-                                                                property_data_len);
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMITTED_RAW,
+                 spinel_decode_prop_nrf_802154_transmitted_raw),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_FAILED,
+                 spinel_decode_prop_nrf_802154_transmit_failed),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_FAILED,
+                 spinel_decode_prop_nrf_802154_receive_failed),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_ACK_STARTED,
+                 spinel_decode_prop_nrf_802154_tx_ack_started),
+};
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_ACK_STARTED:
-            return spinel_decode_prop_nrf_802154_tx_ack_started(p_property_data,
-                                                                property_data_len);
+#undef PROP_RESPONSE
+#undef PROP_DECODER
 
-        default:
-            NRF_802154_SPINEL_LOG_RAW("Unsupported property: %s(%u)\n",
-                                      spinel_prop_key_to_cstr(property),
-                                      property);
+nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_is(
+    const void * p_cmd_data,
+    size_t       cmd_data_len)
+{
+    spinel_prop_key_t             property;
+    const void                  * p_property_data;
+    size_t                        property_data_len;
+    const prop_value_is_entry_t * p_entry = NULL;
+    nrf_802154_ser_err_t          res;
+
+    res = nrf_802154_spinel_decode_prop_key(p_cmd_data,
+                                            cmd_data_len,
+                                            &property,
+                                            &p_property_data,
+                                            &property_data_len);
+
+    if (res < 0)
+    {
+        return res;
+    }
+
+#if NRF_802154_SER_ASYNC_ENABLED
+    // Only responses to asynchronous requests carry a non-zero transaction identifier.
+    if (nrf_802154_spinel_decoded_cmd_tid_get() != 0U)
+    {
+        return nrf_802154_spinel_async_response_handle(nrf_802154_spinel_decoded_cmd_tid_get(),
+                                                       property,
+                                                       p_property_data,
+                                                       property_data_len);
+    }
+#endif
+
+    if ((property >= SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN) &&
+        (property < SPINEL_PROP_VENDOR_NORDIC_NRF_802154__END))
+    {
+        p_entry = &m_prop_value_is_entries[NRF_802154_SPINEL_PROP_IDX(property)];
+    }
+
+    // The last status is the only awaited property from outside of the vendor range.
+    if ((property == SPINEL_PROP_LAST_STATUS) || ((p_entry != NULL) && p_entry->response))
+    {
+        nrf_802154_spinel_response_notifier_property_notify(property,
+                                                            p_property_data,
+                                                            property_data_len);
+        return NRF_802154_SERIALIZATION_ERROR_OK;
+    }
+
+    if ((p_entry == NULL) || (p_entry->decoder == NULL))
+    {
+        NRF_802154_SPINEL_LOG_RAW("Unsupported property: %s(%u)\n",
+                                  spinel_prop_key_to_cstr(property),
+                                  property);
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    return p_entry->decoder(p_property_data, property_data_len);
+}
+
+/**
+ * @brief Decode and dispatch SPINEL_CMD_PROP_VALUES_ARE.
+ *
+ * Each of the property values is dispatched as if it was received in a separate
+ * SPINEL_CMD_PROP_VALUE_IS command.
+ *
+ * @param[in]  p_cmd_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  cmd_data_len  Size of the @ref p_cmd_data buffer.
+ *
+ * @returns zero on success or negative error value on failure.
+ */
+static nrf_802154_ser_err_t spinel_decode_cmd_prop_values_are(const void * p_cmd_data,
+                                                              size_t       cmd_data_len)
+{
+    const uint8_t * p_data = (const uint8_t *)p_cmd_data;
+
+    while (cmd_data_len > 0U)
+    {
+        const void   * p_value_data;
+        size_t         value_data_len;
+        spinel_ssize_t siz;
+
+        siz = spinel_datatype_unpack(p_data,
+                                     cmd_data_len,
+                                     SPINEL_DATATYPE_DATA_WLEN_S,
+                                     &p_value_data,
+                                     &value_data_len);
+
+        if (siz <= 0)
+        {
             return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+        }
+
+        nrf_802154_ser_err_t res = nrf_802154_spinel_decode_cmd_prop_value_is(p_value_data,
+                                                                              value_data_len);
+
+        if (res < 0)
+        {
+            return res;
+        }
+
+        p_data       += siz;
+        cmd_data_len -= (size_t)siz;
     }
+
+    return NRF_802154_SERIALIZATION_ERROR_OK;
 }
 
 nrf_802154_ser_err_t nrf_802154_spinel_dispatch_cmd(spinel_command_t cmd,
@@ -731,6 +1136,9 @@ nrf_802154_ser_err_t nrf_802154_spinel_dispatch_cmd(spinel_command_t cmd,
         case SPINEL_CMD_PROP_VALUE_IS:
             return nrf_802154_spinel_decode_cmd_prop_value_is(p_cmd_data, cmd_data_len);
 
+        case SPINEL_CMD_PROP_VALUES_ARE:
+            return spinel_decode_cmd_prop_values_are(p_cmd_data, cmd_data_len);
+
         default:
             NRF_802154_SPINEL_LOG_RAW("Unsupported command: %s(%u)\n",
                                       spinel_command_to_cstr(cmd),
@@ -817,4 +1225,10 @@ __WEAK void nrf_802154_energy_detection_failed(nrf_802154_ed_error_t error)
     // Intentionally empty
 }
 
+__WEAK void nrf_802154_energy_scan_done(const nrf_802154_energy_scan_result_t * p_result)
+{
+    (void)p_result;
+    // Intentionally empty
+}
+
 #endif // TEST
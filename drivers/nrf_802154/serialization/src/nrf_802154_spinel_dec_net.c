@@ -34,6 +34,7 @@
 
 #include <assert.h>
 #include <stddef.h>
+#include <string.h>
 
 #include "nrf_802154_const.h"
 
@@ -42,10 +43,14 @@
 #include "nrf_802154_spinel_dec.h"
 #include "nrf_802154_spinel_enc_net.h"
 #include "nrf_802154_spinel_log.h"
+#include "nrf_802154_spinel_pack.h"
+#include "nrf_802154_spinel_rx_compact.h"
+#include "nrf_802154_spinel_rx_filter.h"
 #include "nrf_802154_serialization_error.h"
 #include "nrf_802154_serialization_error_helper.h"
 #include "nrf_802154_buffer_mgr_dst.h"
 #include "nrf_802154_buffer_mgr_src.h"
+#include "nrf_802154_shm_tx_pool.h"
 
 #include "nrf_802154.h"
 #include "nrf_802154_config.h"
@@ -55,6 +60,67 @@ static uint8_t * mp_transmit_at_frame; ///< Pointer to the frame that was reques
 
 #endif
 
+/**
+ * @brief Gets a locally accessible pointer to a frame requested to be transmitted.
+ *
+ * A frame placed in the shared-memory TX pool is serialized without its content and is
+ * accessed in place. Any other frame is copied to a local buffer mapped to the remote handle.
+ *
+ * @param[in]  remote_frame_handle  Remote handle of the frame.
+ * @param[in]  p_frame              Pointer to the serialized content of the frame.
+ * @param[in]  frame_hdata_len      Length of the serialized frame with its handle.
+ * @param[out] pp_local_frame_ptr   Locally accessible pointer to the frame.
+ *
+ * @retval true   The pointer was obtained.
+ * @retval false  No local buffer is available.
+ */
+static bool tx_frame_local_ptr_get(uint32_t     remote_frame_handle,
+                                   const void * p_frame,
+                                   size_t       frame_hdata_len,
+                                   void      ** pp_local_frame_ptr)
+{
+#if NRF_802154_SER_SHM_TX_POOL_ENABLED
+    void * p_shm_frame = (void *)remote_frame_handle;
+
+    if ((NRF_802154_DATA_LEN_FROM_HDATA_LEN(frame_hdata_len) == 0U) &&
+        nrf_802154_shm_tx_pool_contains(p_shm_frame))
+    {
+        *pp_local_frame_ptr = p_shm_frame;
+        return true;
+    }
+#endif
+
+    // Map the remote handle to locally accessible pointer and copy the buffer content there
+    return nrf_802154_buffer_mgr_dst_add(nrf_802154_spinel_dst_buffer_mgr_get(),
+                                         remote_frame_handle,
+                                         p_frame,
+                                         NRF_802154_DATA_LEN_FROM_HDATA_LEN(frame_hdata_len),
+                                         pp_local_frame_ptr);
+}
+
+/**
+ * @brief Releases a pointer obtained with @ref tx_frame_local_ptr_get.
+ *
+ * @param[in]  p_local_frame_ptr  Locally accessible pointer to the frame.
+ *
+ * @retval true   The pointer was released.
+ * @retval false  The pointer is not known.
+ */
+static bool tx_frame_local_ptr_free(void * p_local_frame_ptr)
+{
+#if NRF_802154_SER_SHM_TX_POOL_ENABLED
+    if (nrf_802154_shm_tx_pool_contains(p_local_frame_ptr))
+    {
+        // The frame is owned by the remote core. Nothing to release locally
+        return true;
+    }
+#endif
+
+    return nrf_802154_buffer_mgr_dst_remove_by_local_pointer(
+        nrf_802154_spinel_dst_buffer_mgr_get(),
+        p_local_frame_ptr);
+}
+
 /**
  * @brief Deal with SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SLEEP request and send response.
  *
@@ -72,7 +138,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_sleep(const void * p_p
 
     sleep_response = nrf_802154_sleep();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SLEEP,
+    return nrf_802154_spinel_send_rsp_prop_value_is(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SLEEP,
                                                     SPINEL_DATATYPE_NRF_802154_SLEEP_RET,
                                                     sleep_response);
 }
@@ -93,7 +159,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_sleep_if_idle(
 
     nrf_802154_sleep_error_t sleep_response = nrf_802154_sleep_if_idle();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_rsp_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SLEEP_IF_IDLE,
         SPINEL_DATATYPE_NRF_802154_SLEEP_IF_IDLE_RET,
         sleep_response);
@@ -116,7 +182,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_receive(const void * p
 
     receive_response = nrf_802154_receive();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE,
+    return nrf_802154_spinel_send_rsp_prop_value_is(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE,
                                                     SPINEL_DATATYPE_NRF_802154_RECEIVE_RET,
                                                     receive_response);
 }
@@ -154,7 +220,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_receive_at(
 
     bool result = nrf_802154_receive_at(rx_time, timeout, channel, id);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_rsp_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT,
         SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_RET,
         result);
@@ -186,7 +252,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_receive_at_cancel(
 
     bool result = nrf_802154_receive_at_cancel(id);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_rsp_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT_CANCEL,
         SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_CANCEL_RET,
         result);
@@ -202,7 +268,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_channel_get(const void
 
     uint8_t channel = nrf_802154_channel_get();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_rsp_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CHANNEL_GET,
         SPINEL_DATATYPE_NRF_802154_CHANNEL_GET_RET,
         channel);
@@ -226,7 +292,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_channel_set(const void
 
     nrf_802154_channel_set(channel);
 
-    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+    return nrf_802154_spinel_send_rsp_prop_last_status_is(SPINEL_STATUS_OK);
 }
 
 /**
@@ -262,7 +328,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_pan_id_set(
 
     nrf_802154_pan_id_set((uint8_t *)p_pan_id);
 
-    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+    return nrf_802154_spinel_send_rsp_prop_last_status_is(SPINEL_STATUS_OK);
 }
 
 /**
@@ -298,7 +364,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_short_address_set(
 
     nrf_802154_short_address_set((uint8_t *)p_short_address);
 
-    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+    return nrf_802154_spinel_send_rsp_prop_last_status_is(SPINEL_STATUS_OK);
 }
 
 /**
@@ -334,7 +400,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_extended_address_set(
 
     nrf_802154_extended_address_set((uint8_t *)p_extended_address);
 
-    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+    return nrf_802154_spinel_send_rsp_prop_last_status_is(SPINEL_STATUS_OK);
 }
 
 /**
@@ -363,7 +429,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_pan_coord_set(
 
     nrf_802154_pan_coord_set(enabled);
 
-    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+    return nrf_802154_spinel_send_rsp_prop_last_status_is(SPINEL_STATUS_OK);
 }
 
 #if NRF_802154_PAN_COORD_GET_ENABLED
@@ -377,7 +443,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_pan_coord_get(
 
     bool result = nrf_802154_pan_coord_get();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_rsp_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_COORD_GET,
         SPINEL_DATATYPE_NRF_802154_PAN_COORD_GET_RET,
         result);
@@ -411,7 +477,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_promiscuous_set(
 
     nrf_802154_promiscuous_set(enabled);
 
-    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+    return nrf_802154_spinel_send_rsp_prop_last_status_is(SPINEL_STATUS_OK);
 }
 
 /**
@@ -429,7 +495,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_cca(const void * p_pro
 
     bool result = nrf_802154_cca();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA,
+    return nrf_802154_spinel_send_rsp_prop_value_is(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA,
                                                     SPINEL_DATATYPE_NRF_802154_CCA_RET,
                                                     result);
 }
@@ -452,7 +518,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_continuous_carrier(
 
     bool result = nrf_802154_continuous_carrier();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_rsp_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CONTINUOUS_CARRIER,
         SPINEL_DATATYPE_NRF_802154_CONTINUOUS_CARRIER_RET,
         result);
@@ -491,7 +557,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_modulated_carrier(
 
     bool result = nrf_802154_modulated_carrier(p_buffer);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_rsp_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_MODULATED_CARRIER,
         SPINEL_DATATYPE_NRF_802154_MODULATED_CARRIER_RET,
         result);
@@ -525,12 +591,46 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_energy_detection(
 
     bool result = nrf_802154_energy_detection(time_us);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_rsp_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTION,
         SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_RET,
         result);
 }
 
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_SCAN.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_energy_scan(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    uint32_t       channel_mask;
+    uint32_t       dwell_time_us;
+    spinel_ssize_t siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_ENERGY_SCAN,
+                                 &channel_mask,
+                                 &dwell_time_us);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    bool result = nrf_802154_energy_scan(channel_mask, dwell_time_us);
+
+    return nrf_802154_spinel_send_rsp_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_SCAN,
+        SPINEL_DATATYPE_NRF_802154_ENERGY_SCAN_RET,
+        result);
+}
+
 /**
  * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_AUTO_PENDING_BIT_SET.
  *
@@ -556,7 +656,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_auto_pending_bit_set(
 
     nrf_802154_auto_pending_bit_set(enabled);
 
-    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+    return nrf_802154_spinel_send_rsp_prop_last_status_is(SPINEL_STATUS_OK);
 }
 
 /**
@@ -601,7 +701,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_pending_bit_for_addr_s
 
     result = nrf_802154_pending_bit_for_addr_set(p_addr, extended);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_rsp_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_SET,
         SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_SET_RET,
         result);
@@ -650,12 +750,108 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_pending_bit_for_addr_c
 
     result = nrf_802154_pending_bit_for_addr_clear(p_addr, extended);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_rsp_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR,
         SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR_RET,
         result);
 }
 
+/**
+ * @brief Decode and dispatch pending bit batch properties.
+ *
+ * Handles both SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_SET_BATCH and
+ * SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR_BATCH as they share the layout.
+ *
+ * @param[in]  property           Property to be decoded.
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_pending_bit_for_addr_batch(
+    spinel_prop_key_t property,
+    const void      * p_property_data,
+    size_t            property_data_len)
+{
+    const uint8_t * p_addrs;
+    size_t          addrs_len;
+    size_t          addr_size;
+    uint32_t        count;
+    bool            extended;
+    uint32_t        result;
+    spinel_ssize_t  siz;
+
+    // Both batch properties share the same layout.
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_SET_BATCH,
+                                 &extended,
+                                 &p_addrs,
+                                 &addrs_len);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    addr_size = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+
+    if (((addrs_len % addr_size) != 0U) ||
+        (addrs_len > NRF_802154_SPINEL_PENDING_BIT_BATCH_MAX_DATA_SIZE))
+    {
+        return NRF_802154_SERIALIZATION_ERROR_REQUEST_INVALID;
+    }
+
+    count = addrs_len / addr_size;
+
+    if (property == SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_SET_BATCH)
+    {
+        result = nrf_802154_pending_bit_for_addr_set_batch(p_addrs, count, extended);
+    }
+    else
+    {
+        result = nrf_802154_pending_bit_for_addr_clear_batch(p_addrs, count, extended);
+    }
+
+    return nrf_802154_spinel_send_rsp_prop_value_is(
+        property,
+        SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_SET_BATCH_RET,
+        (uint8_t)result);
+}
+
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_SET_BATCH.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_pending_bit_for_addr_set_batch(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    return spinel_decode_prop_nrf_802154_pending_bit_for_addr_batch(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_SET_BATCH,
+        p_property_data,
+        property_data_len);
+}
+
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR_BATCH.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_pending_bit_for_addr_clear_batch(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    return spinel_decode_prop_nrf_802154_pending_bit_for_addr_batch(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR_BATCH,
+        p_property_data,
+        property_data_len);
+}
+
 /**
  * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_RESET.
  *
@@ -682,7 +878,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_pending_bit_for_addr_r
 
     nrf_802154_pending_bit_for_addr_reset(extended);
 
-    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+    return nrf_802154_spinel_send_rsp_prop_last_status_is(SPINEL_STATUS_OK);
 }
 
 /**
@@ -718,12 +914,12 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_src_addr_matching_meth
             break;
 
         default:
-            return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_INVALID_ARGUMENT);
+            return nrf_802154_spinel_send_rsp_prop_last_status_is(SPINEL_STATUS_INVALID_ARGUMENT);
     }
 
     nrf_802154_src_addr_matching_method_set(match_method);
 
-    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+    return nrf_802154_spinel_send_rsp_prop_last_status_is(SPINEL_STATUS_OK);
 }
 
 /**
@@ -779,7 +975,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_ack_data_set(
         (uint16_t)length,
         data_type);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_rsp_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_SET,
         SPINEL_DATATYPE_NRF_802154_ACK_DATA_SET_RET,
         ack_data_set_res);
@@ -829,7 +1025,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_ack_data_clear(
 
     bool ack_data_clear_res = nrf_802154_ack_data_clear(p_addr, extended, data_type);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_rsp_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_CLEAR,
         SPINEL_DATATYPE_NRF_802154_ACK_DATA_CLEAR_RET,
         ack_data_clear_res);
@@ -866,13 +1062,10 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_transmit_csma_ca_raw(
         return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
     }
 
-    // Map the remote handle to locally accessible pointer and copy the buffer content there
-    bool frame_added = nrf_802154_buffer_mgr_dst_add(
-        nrf_802154_spinel_dst_buffer_mgr_get(),
-        remote_frame_handle,
-        p_frame,
-        NRF_802154_DATA_LEN_FROM_HDATA_LEN(frame_hdata_len),
-        &p_local_frame_ptr);
+    bool frame_added = tx_frame_local_ptr_get(remote_frame_handle,
+                                              p_frame,
+                                              frame_hdata_len,
+                                              &p_local_frame_ptr);
 
     if (!frame_added)
     {
@@ -884,11 +1077,10 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_transmit_csma_ca_raw(
 
     if (!result)
     {
-        nrf_802154_buffer_mgr_dst_remove_by_local_pointer(nrf_802154_spinel_dst_buffer_mgr_get(),
-                                                          p_local_frame_ptr);
+        tx_frame_local_ptr_free(p_local_frame_ptr);
     }
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_rsp_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_CSMA_CA_RAW,
         SPINEL_DATATYPE_NRF_802154_TRANSMIT_CSMA_CA_RAW_RET,
         result);
@@ -921,7 +1113,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_csma_ca_min_be_set(
 
     result = nrf_802154_csma_ca_min_be_set(min_be);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_rsp_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MIN_BE_SET,
         SPINEL_DATATYPE_NRF_802154_CSMA_CA_MIN_BE_SET_RET,
         result);
@@ -943,7 +1135,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_csma_ca_min_be_get(
 
     uint8_t min_be = nrf_802154_csma_ca_min_be_get();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_rsp_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MIN_BE_GET,
         SPINEL_DATATYPE_NRF_802154_CSMA_CA_MIN_BE_GET_RET,
         min_be);
@@ -976,7 +1168,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_csma_ca_max_be_set(
 
     result = nrf_802154_csma_ca_max_be_set(max_be);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_rsp_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BE_SET,
         SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BE_SET_RET,
         result);
@@ -998,7 +1190,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_csma_ca_max_be_get(
 
     uint8_t max_be = nrf_802154_csma_ca_max_be_get();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_rsp_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BE_GET,
         SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BE_GET_RET,
         max_be);
@@ -1030,7 +1222,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_csma_ca_max_backoffs_s
 
     nrf_802154_csma_ca_max_backoffs_set(max_backoffs);
 
-    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+    return nrf_802154_spinel_send_rsp_prop_last_status_is(SPINEL_STATUS_OK);
 }
 
 /**
@@ -1049,12 +1241,67 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_csma_ca_max_backoffs_g
 
     uint8_t max_backoffs = nrf_802154_csma_ca_max_backoffs_get();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_rsp_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BACKOFFS_GET,
         SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BACKOFFS_GET_RET,
         max_backoffs);
 }
 
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_FRAME_RETRIES_SET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_csma_ca_max_frame_retries_set(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    uint8_t        max_frame_retries;
+    spinel_ssize_t siz;
+    bool           result;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_FRAME_RETRIES_SET,
+                                 &max_frame_retries);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    result = nrf_802154_csma_ca_max_frame_retries_set(max_frame_retries);
+
+    return nrf_802154_spinel_send_rsp_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_FRAME_RETRIES_SET,
+        SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_FRAME_RETRIES_SET_RET,
+        result);
+}
+
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_FRAME_RETRIES_GET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_csma_ca_max_frame_retries_get(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    (void)p_property_data;
+    (void)property_data_len;
+
+    uint8_t max_frame_retries = nrf_802154_csma_ca_max_frame_retries_get();
+
+    return nrf_802154_spinel_send_rsp_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_FRAME_RETRIES_GET,
+        SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_FRAME_RETRIES_GET_RET,
+        max_frame_retries);
+}
+
 #endif // NRF_802154_CSMA_CA_ENABLED
 
 #if NRF_802154_TEST_MODES_ENABLED
@@ -1084,7 +1331,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_test_mode_csmaca_backo
 
     nrf_802154_test_mode_csmaca_backoff_set(value);
 
-    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+    return nrf_802154_spinel_send_rsp_prop_last_status_is(SPINEL_STATUS_OK);
 }
 
 /**
@@ -1103,7 +1350,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_test_mode_csmaca_backo
 
     nrf_802154_test_mode_csmaca_backoff_t value = nrf_802154_test_mode_csmaca_backoff_get();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_rsp_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TEST_MODE_CSMACA_BACKOFF_GET,
         SPINEL_DATATYPE_NRF_802154_TEST_MODE_CSMACA_BACKOFF_GET_RET,
         value);
@@ -1140,7 +1387,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_ifs_mode_set(
 
     result = nrf_802154_ifs_mode_set(value);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_rsp_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MODE_SET,
         SPINEL_DATATYPE_NRF_802154_IFS_MODE_SET_RET,
         result);
@@ -1162,7 +1409,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_ifs_mode_get(
 
     nrf_802154_ifs_mode_t value = nrf_802154_ifs_mode_get();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_rsp_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MODE_GET,
         SPINEL_DATATYPE_NRF_802154_IFS_MODE_GET_RET,
         value);
@@ -1194,7 +1441,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_ifs_min_sifs_period_se
 
     nrf_802154_ifs_min_sifs_period_set(value);
 
-    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+    return nrf_802154_spinel_send_rsp_prop_last_status_is(SPINEL_STATUS_OK);
 }
 
 /**
@@ -1213,7 +1460,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_ifs_min_sifs_period_ge
 
     uint16_t value = nrf_802154_ifs_min_sifs_period_get();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_rsp_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_SIFS_PERIOD_GET,
         SPINEL_DATATYPE_NRF_802154_IFS_MIN_SIFS_PERIOD_GET_RET,
         value);
@@ -1245,7 +1492,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_ifs_min_lifs_period_se
 
     nrf_802154_ifs_min_lifs_period_set(value);
 
-    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+    return nrf_802154_spinel_send_rsp_prop_last_status_is(SPINEL_STATUS_OK);
 }
 
 /**
@@ -1264,7 +1511,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_ifs_min_lifs_period_ge
 
     uint16_t value = nrf_802154_ifs_min_lifs_period_get();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_rsp_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_LIFS_PERIOD_GET,
         SPINEL_DATATYPE_NRF_802154_IFS_MIN_LIFS_PERIOD_GET_RET,
         value);
@@ -1288,26 +1535,30 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_transmit_raw(
     size_t                         frame_hdata_len;
     void                         * p_local_frame_ptr;
     nrf_802154_transmit_metadata_t tx_metadata;
+    nrf_802154_spinel_reader_t     reader;
 
-    spinel_ssize_t siz = spinel_datatype_unpack(
-        p_property_data,
-        property_data_len,
-        SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW,
-        NRF_802154_TRANSMIT_METADATA_DECODE(tx_metadata),
-        NRF_802154_HDATA_DECODE(remote_frame_handle, p_frame, frame_hdata_len));
+    // The layout is fixed by SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW
+    nrf_802154_spinel_reader_init(&reader, p_property_data, property_data_len);
 
-    if (siz < 0)
+    tx_metadata.frame_props.is_secured          = nrf_802154_spinel_reader_bool(&reader);
+    tx_metadata.frame_props.dynamic_data_is_set = nrf_802154_spinel_reader_bool(&reader);
+    tx_metadata.cca                             = nrf_802154_spinel_reader_bool(&reader);
+    tx_metadata.tx_power.use_metadata_value     = nrf_802154_spinel_reader_bool(&reader);
+    tx_metadata.tx_power.power                  = (int8_t)nrf_802154_spinel_reader_uint8(&reader);
+    nrf_802154_spinel_reader_hdata(&reader,
+                                   &remote_frame_handle,
+                                   &p_frame,
+                                   &frame_hdata_len);
+
+    if (reader.error)
     {
         return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
     }
 
-    // Map the remote handle to locally accessible pointer and copy the buffer content there
-    bool frame_added = nrf_802154_buffer_mgr_dst_add(
-        nrf_802154_spinel_dst_buffer_mgr_get(),
-        remote_frame_handle,
-        p_frame,
-        NRF_802154_DATA_LEN_FROM_HDATA_LEN(frame_hdata_len),
-        &p_local_frame_ptr);
+    bool frame_added = tx_frame_local_ptr_get(remote_frame_handle,
+                                              p_frame,
+                                              frame_hdata_len,
+                                              &p_local_frame_ptr);
 
     if (!frame_added)
     {
@@ -1318,11 +1569,10 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_transmit_raw(
 
     if (!result)
     {
-        nrf_802154_buffer_mgr_dst_remove_by_local_pointer(nrf_802154_spinel_dst_buffer_mgr_get(),
-                                                          p_local_frame_ptr);
+        tx_frame_local_ptr_free(p_local_frame_ptr);
     }
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_rsp_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW,
         SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW_RET,
         result);
@@ -1360,13 +1610,10 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_transmit_raw_at(
         return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
     }
 
-    // Map the remote handle to locally accessible pointer and copy the buffer content there
-    bool frame_added = nrf_802154_buffer_mgr_dst_add(
-        nrf_802154_spinel_dst_buffer_mgr_get(),
-        remote_frame_handle,
-        p_frame,
-        NRF_802154_DATA_LEN_FROM_HDATA_LEN(frame_hdata_len),
-        &p_local_frame_ptr);
+    bool frame_added = tx_frame_local_ptr_get(remote_frame_handle,
+                                              p_frame,
+                                              frame_hdata_len,
+                                              &p_local_frame_ptr);
 
     if (!frame_added)
     {
@@ -1384,8 +1631,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_transmit_raw_at(
 
     if (!result)
     {
-        nrf_802154_buffer_mgr_dst_remove_by_local_pointer(nrf_802154_spinel_dst_buffer_mgr_get(),
-                                                          p_local_frame_ptr);
+        tx_frame_local_ptr_free(p_local_frame_ptr);
     }
     else
     {
@@ -1393,7 +1639,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_transmit_raw_at(
         mp_transmit_at_frame = p_local_frame_ptr;
     }
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_rsp_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW_AT,
         SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW_AT_RET,
         result);
@@ -1425,9 +1671,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_transmit_at_cancel(
         }
 
         // Free the local frame pointer
-        bool removed = nrf_802154_buffer_mgr_dst_remove_by_local_pointer(
-            nrf_802154_spinel_dst_buffer_mgr_get(),
-            mp_transmit_at_frame);
+        bool removed = tx_frame_local_ptr_free(mp_transmit_at_frame);
 
         if (!removed)
         {
@@ -1435,7 +1679,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_transmit_at_cancel(
         }
     }
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_rsp_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_AT_CANCEL,
         SPINEL_DATATYPE_NRF_802154_TRANSMIT_AT_CANCEL_RET,
         result);
@@ -1444,28 +1688,15 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_transmit_at_cancel(
 #endif // NRF_802154_DELAYED_TRX_ENABLED
 
 /**
- * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_BUFFER_FREE_RAW.
+ * @brief Frees a received buffer passed to the application core.
  *
- * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
- * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ * @param[in]  local_frame_handle  Handle of the buffer to free.
  *
+ * @returns  zero on success or negative error value on failure.
  */
-static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_buffer_free_raw(
-    const void * p_property_data,
-    size_t       property_data_len)
+static nrf_802154_ser_err_t buffer_free_by_handle(uint32_t local_frame_handle)
 {
-    uint32_t local_frame_handle;
-    void   * p_local_ptr;
-
-    spinel_ssize_t siz = spinel_datatype_unpack(p_property_data,
-                                                property_data_len,
-                                                SPINEL_DATATYPE_NRF_802154_BUFFER_FREE_RAW,
-                                                &local_frame_handle);
-
-    if (siz < 0)
-    {
-        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
-    }
+    void * p_local_ptr;
 
     // Search for a locally accessible pointer to be freed based on the local handle
     bool ptr_found = nrf_802154_buffer_mgr_src_search_by_buffer_handle(
@@ -1489,9 +1720,78 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_buffer_free_raw(
         }
     }
 
-    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+    return NRF_802154_SERIALIZATION_ERROR_OK;
 }
 
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_BUFFER_FREE_RAW.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_buffer_free_raw(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    uint32_t                   local_frame_handle;
+    nrf_802154_spinel_reader_t reader;
+
+    // The layout is fixed by SPINEL_DATATYPE_NRF_802154_BUFFER_FREE_RAW
+    nrf_802154_spinel_reader_init(&reader, p_property_data, property_data_len);
+
+    local_frame_handle = nrf_802154_spinel_reader_uint32(&reader);
+
+    if (reader.error)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    nrf_802154_ser_err_t res = buffer_free_by_handle(local_frame_handle);
+
+    if (res < 0)
+    {
+        return res;
+    }
+
+    return nrf_802154_spinel_send_rsp_prop_last_status_is(SPINEL_STATUS_OK);
+}
+
+#if NRF_802154_SER_LAZY_FREE_ENABLED
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_BUFFER_FREE_RAW_BATCH.
+ *
+ * The application core does not wait for a response, so none is sent.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_buffer_free_raw_batch(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    nrf_802154_spinel_reader_t reader;
+    nrf_802154_ser_err_t       res = NRF_802154_SERIALIZATION_ERROR_OK;
+
+    if ((property_data_len % sizeof(uint32_t)) != 0U)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    // The layout is fixed by SPINEL_DATATYPE_NRF_802154_BUFFER_FREE_RAW_BATCH
+    nrf_802154_spinel_reader_init(&reader, p_property_data, property_data_len);
+
+    while ((reader.len != 0U) && (res >= 0))
+    {
+        res = buffer_free_by_handle(nrf_802154_spinel_reader_uint32(&reader));
+    }
+
+    return res;
+}
+
+#endif // NRF_802154_SER_LAZY_FREE_ENABLED
+
 /**
  * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_POWER_SET.
  *
@@ -1516,7 +1816,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_tx_power_set(const voi
 
     nrf_802154_tx_power_set(power);
 
-    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+    return nrf_802154_spinel_send_rsp_prop_last_status_is(SPINEL_STATUS_OK);
 }
 
 /**
@@ -1536,7 +1836,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_tx_power_get(const voi
 
     power = nrf_802154_tx_power_get();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_rsp_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_POWER_GET,
         SPINEL_DATATYPE_NRF_802154_TX_POWER_GET_RET,
         power);
@@ -1560,7 +1860,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_capabilities_get(
 
     caps = nrf_802154_capabilities_get();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_rsp_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CAPABILITIES_GET,
         SPINEL_DATATYPE_NRF_802154_CAPABILITIES_GET_RET,
         caps);
@@ -1584,7 +1884,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_time_get(
 
     time = nrf_802154_time_get();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_rsp_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TIME_GET,
         SPINEL_DATATYPE_NRF_802154_TIME_GET_RET,
         time);
@@ -1600,7 +1900,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_cca_cfg_get(const void
 
     nrf_802154_cca_cfg_get(&cfg);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_rsp_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA_CFG_GET,
         SPINEL_DATATYPE_NRF_802154_CCA_CFG_GET_RET,
         NRF_802154_CCA_CFG_ENCODE(cfg));
@@ -1617,12 +1917,156 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_stat_timestamps_get(
 
     nrf_802154_stat_timestamps_get(&t);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_rsp_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_STAT_TIMESTAMPS_GET,
         SPINEL_DATATYPE_NRF_802154_STAT_TIMESTAMPS_GET_RET,
         NRF_802154_STAT_TIMESTAMPS_ENCODE(t));
 }
 
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_stat_histograms_get(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    (void)p_property_data;
+    (void)property_data_len;
+
+    nrf_802154_stat_histograms_t h;
+
+    nrf_802154_stat_histograms_get(&h);
+
+    return nrf_802154_spinel_send_rsp_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_STAT_HISTOGRAMS_GET,
+        SPINEL_DATATYPE_NRF_802154_STAT_HISTOGRAMS_GET_RET,
+        &h,
+        sizeof(h));
+}
+
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PERF_COUNTER_GET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_perf_counter_get(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    uint32_t                  index;
+    nrf_802154_perf_counter_t counter = {0};
+    bool                      result;
+    spinel_ssize_t            siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_PERF_COUNTER_GET,
+                                 &index);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    result = nrf_802154_perf_counter_get(index, &counter);
+
+    return nrf_802154_spinel_send_rsp_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PERF_COUNTER_GET,
+        SPINEL_DATATYPE_NRF_802154_PERF_COUNTER_GET_RET,
+        result,
+        &counter,
+        sizeof(counter));
+}
+
+#if NRF_802154_LINK_METRICS_SERIES_ENABLED
+
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_LINK_METRICS_SERIES_CONFIGURE.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_link_metrics_series_configure(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    uint8_t                     series_id;
+    const uint8_t             * p_addr;
+    size_t                      addr_len;
+    nrf_802154_lm_frame_types_t frame_types;
+    bool                        extended;
+    bool                        result;
+    spinel_ssize_t              siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_LINK_METRICS_SERIES_CONFIGURE,
+                                 &series_id,
+                                 &p_addr,
+                                 &addr_len,
+                                 &frame_types);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    if (addr_len == EXTENDED_ADDRESS_SIZE)
+    {
+        extended = true;
+    }
+    else if (addr_len == SHORT_ADDRESS_SIZE)
+    {
+        extended = false;
+    }
+    else
+    {
+        return NRF_802154_SERIALIZATION_ERROR_REQUEST_INVALID;
+    }
+
+    result = nrf_802154_link_metrics_series_configure(series_id, p_addr, extended, frame_types);
+
+    return nrf_802154_spinel_send_rsp_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_LINK_METRICS_SERIES_CONFIGURE,
+        SPINEL_DATATYPE_NRF_802154_LINK_METRICS_SERIES_CONFIGURE_RET,
+        result);
+}
+
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_LINK_METRICS_SERIES_GET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_link_metrics_series_get(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    uint8_t                series_id;
+    nrf_802154_lm_series_t series = {0};
+    bool                   result;
+    spinel_ssize_t         siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_LINK_METRICS_SERIES_GET,
+                                 &series_id);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    result = nrf_802154_link_metrics_series_get(series_id, &series);
+
+    return nrf_802154_spinel_send_rsp_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_LINK_METRICS_SERIES_GET,
+        SPINEL_DATATYPE_NRF_802154_LINK_METRICS_SERIES_GET_RET,
+        result,
+        &series,
+        sizeof(series));
+}
+
+#endif // NRF_802154_LINK_METRICS_SERIES_ENABLED
+
 static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_cca_cfg_set(const void * p_property_data,
                                                                       size_t       property_data_len)
 {
@@ -1641,7 +2085,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_cca_cfg_set(const void
 
     nrf_802154_cca_cfg_set(&cfg);
 
-    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+    return nrf_802154_spinel_send_rsp_prop_last_status_is(SPINEL_STATUS_OK);
 }
 
 /**
@@ -1669,7 +2113,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_security_global_frame_
 
     nrf_802154_security_global_frame_counter_set(frame_counter);
 
-    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+    return nrf_802154_spinel_send_rsp_prop_last_status_is(SPINEL_STATUS_OK);
 }
 
 /**
@@ -1698,7 +2142,7 @@ spinel_decode_prop_nrf_802154_security_global_frame_counter_set_if_larger(
 
     nrf_802154_security_global_frame_counter_set_if_larger(frame_counter);
 
-    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+    return nrf_802154_spinel_send_rsp_prop_last_status_is(SPINEL_STATUS_OK);
 }
 
 /**
@@ -1729,7 +2173,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_security_key_store(
 
     err = nrf_802154_security_key_store(&key);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_rsp_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_STORE,
         SPINEL_DATATYPE_NRF_802154_SECURITY_ERROR_RET,
         err);
@@ -1763,7 +2207,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_security_key_remove(
 
     err = nrf_802154_security_key_remove(&key_id);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_rsp_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_REMOVE,
         SPINEL_DATATYPE_NRF_802154_SECURITY_ERROR_RET,
         err);
@@ -1796,7 +2240,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_csl_writer_period_set(
 
     nrf_802154_csl_writer_period_set(csl_period);
 
-    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+    return nrf_802154_spinel_send_rsp_prop_last_status_is(SPINEL_STATUS_OK);
 }
 
 /**
@@ -1824,270 +2268,351 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_csl_writer_anchor_time
 
     nrf_802154_csl_writer_anchor_time_set(csl_anchor_time);
 
-    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+    return nrf_802154_spinel_send_rsp_prop_last_status_is(SPINEL_STATUS_OK);
 }
 
 #endif // NRF_802154_DELAYED_TRX_ENABLED && NRF_802154_IE_WRITER_ENABLED
 
-nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_set(const void * p_cmd_data,
-                                                                 size_t       cmd_data_len)
+/**
+ * @brief Deal with SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RX_COMPACT_ENABLE request
+ *        and send response.
+ *
+ * The request is answered even if the compact encoding is not supported, so that
+ * the application core keeps using the regular encoding.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer - unused here (no additional data to decode).
+ * @param[in]  property_data_len  Size of the @ref p_data buffer - unused here.
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_rx_compact_enable(
+    const void * p_property_data,
+    size_t       property_data_len)
 {
-    spinel_prop_key_t property;
-    const void      * p_property_data;
-    size_t            property_data_len;
-    spinel_ssize_t    siz;
+    (void)p_property_data;
+    (void)property_data_len;
+
+    bool enabled = false;
+
+#if NRF_802154_SER_COMPACT_RX_ENABLED
+    nrf_802154_spinel_rx_compact_enable();
+    enabled = true;
+#endif
 
-    siz = spinel_datatype_unpack(p_cmd_data,
-                                 cmd_data_len,
-                                 SPINEL_DATATYPE_UINT_PACKED_S SPINEL_DATATYPE_DATA_S,
-                                 &property,
-                                 &p_property_data,
-                                 &property_data_len);
+    return nrf_802154_spinel_send_rsp_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RX_COMPACT_ENABLE,
+        SPINEL_DATATYPE_NRF_802154_RX_COMPACT_ENABLE_RET,
+        enabled);
+}
+
+#if NRF_802154_SER_RX_FILTER_ENABLED
+
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RX_FILTER_RULE_ADD.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_rx_filter_rule_add(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    nrf_802154_ser_rx_filter_rule_t rule;
+    uint8_t                         action;
+    const void                    * p_dst_pan_id;
+    size_t                          dst_pan_id_len;
+    const void                    * p_dst_addr;
+    size_t                          dst_addr_len;
+    spinel_ssize_t                  siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_RX_FILTER_RULE_ADD,
+                                 &rule.fields,
+                                 &action,
+                                 &rule.frame_type,
+                                 &rule.cmd_id,
+                                 &p_dst_pan_id,
+                                 &dst_pan_id_len,
+                                 &p_dst_addr,
+                                 &dst_addr_len);
 
     if (siz < 0)
     {
         return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
     }
 
-    switch (property)
+    if ((action > NRF_802154_SER_RX_FILTER_ACTION_DROP) ||
+        (dst_pan_id_len != PAN_ID_SIZE) ||
+        ((dst_addr_len != SHORT_ADDRESS_SIZE) && (dst_addr_len != EXTENDED_ADDRESS_SIZE)))
     {
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SLEEP:
-            return spinel_decode_prop_nrf_802154_sleep(p_property_data, property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SLEEP_IF_IDLE:
-            return spinel_decode_prop_nrf_802154_sleep_if_idle(p_property_data, property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE:
-            return spinel_decode_prop_nrf_802154_receive(p_property_data, property_data_len);
+        return NRF_802154_SERIALIZATION_ERROR_REQUEST_INVALID;
+    }
 
-#if NRF_802154_DELAYED_TRX_ENABLED
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT:
-            return spinel_decode_prop_nrf_802154_receive_at(p_property_data, property_data_len);
+    rule.action            = (nrf_802154_ser_rx_filter_action_t)action;
+    rule.dst_addr_extended = (dst_addr_len == EXTENDED_ADDRESS_SIZE);
+    memcpy(rule.dst_pan_id, p_dst_pan_id, PAN_ID_SIZE);
+    memset(rule.dst_addr, 0, sizeof(rule.dst_addr));
+    memcpy(rule.dst_addr, p_dst_addr, dst_addr_len);
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT_CANCEL:
-            return spinel_decode_prop_nrf_802154_receive_at_cancel(p_property_data,
-                                                                   property_data_len);
+    bool result = nrf_802154_spinel_rx_filter_rule_add(&rule);
 
-#endif // NRF_802154_DELAYED_TRX_ENABLED
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CHANNEL_GET:
-            return spinel_decode_prop_nrf_802154_channel_get(p_property_data, property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CHANNEL_SET:
-            return spinel_decode_prop_nrf_802154_channel_set(p_property_data, property_data_len);
+    return nrf_802154_spinel_send_rsp_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RX_FILTER_RULE_ADD,
+        SPINEL_DATATYPE_NRF_802154_RX_FILTER_RULE_ADD_RET,
+        result);
+}
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_AUTO_PENDING_BIT_SET:
-            return spinel_decode_prop_nrf_802154_auto_pending_bit_set(p_property_data,
-                                                                      property_data_len);
+/**
+ * @brief Deal with SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RX_FILTER_CLEAR request
+ *        and send response.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer - unused here (no additional data to decode).
+ * @param[in]  property_data_len  Size of the @ref p_data buffer - unused here.
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_rx_filter_clear(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    (void)p_property_data;
+    (void)property_data_len;
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_SET:
-            return spinel_decode_prop_nrf_802154_pending_bit_for_addr_set(p_property_data,
-                                                                          property_data_len);
+    nrf_802154_spinel_rx_filter_clear();
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR:
-            return spinel_decode_prop_nrf_802154_pending_bit_for_addr_clear(p_property_data,
-                                                                            property_data_len);
+    return nrf_802154_spinel_send_rsp_prop_last_status_is(SPINEL_STATUS_OK);
+}
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_RESET:
-            return spinel_decode_prop_nrf_802154_pending_bit_for_addr_reset(p_property_data,
-                                                                            property_data_len);
+#endif // NRF_802154_SER_RX_FILTER_ENABLED
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SRC_ADDR_MATCHING_METHOD_SET:
-            return spinel_decode_prop_nrf_802154_src_addr_matching_method_set(p_property_data,
-                                                                              property_data_len);
+/**
+ * @brief Defines an entry of a table of property decoders.
+ */
+#define PROP_DECODER(property, decoder) [NRF_802154_SPINEL_PROP_IDX(property)] = (decoder)
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_ID_SET:
-            return spinel_decode_prop_nrf_802154_pan_id_set(p_property_data, property_data_len);
+/**
+ * @brief Decoders of properties set by SPINEL_CMD_PROP_VALUE_SET, indexed by property.
+ *
+ * Properties not supported in the current configuration have no decoder.
+ */
+static const nrf_802154_spinel_prop_decoder_t
+    m_prop_value_set_decoders[NRF_802154_SPINEL_PROP_NUM] =
+{
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SLEEP,
+                 spinel_decode_prop_nrf_802154_sleep),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SLEEP_IF_IDLE,
+                 spinel_decode_prop_nrf_802154_sleep_if_idle),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE,
+                 spinel_decode_prop_nrf_802154_receive),
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SHORT_ADDRESS_SET:
-            return spinel_decode_prop_nrf_802154_short_address_set(p_property_data,
-                                                                   property_data_len);
+#if NRF_802154_DELAYED_TRX_ENABLED
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT,
+                 spinel_decode_prop_nrf_802154_receive_at),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT_CANCEL,
+                 spinel_decode_prop_nrf_802154_receive_at_cancel),
+#endif // NRF_802154_DELAYED_TRX_ENABLED
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_EXTENDED_ADDRESS_SET:
-            return spinel_decode_prop_nrf_802154_extended_address_set(p_property_data,
-                                                                      property_data_len);
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CHANNEL_GET,
+                 spinel_decode_prop_nrf_802154_channel_get),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CHANNEL_SET,
+                 spinel_decode_prop_nrf_802154_channel_set),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_AUTO_PENDING_BIT_SET,
+                 spinel_decode_prop_nrf_802154_auto_pending_bit_set),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_SET,
+                 spinel_decode_prop_nrf_802154_pending_bit_for_addr_set),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR,
+                 spinel_decode_prop_nrf_802154_pending_bit_for_addr_clear),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_SET_BATCH,
+                 spinel_decode_prop_nrf_802154_pending_bit_for_addr_set_batch),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR_BATCH,
+                 spinel_decode_prop_nrf_802154_pending_bit_for_addr_clear_batch),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_RESET,
+                 spinel_decode_prop_nrf_802154_pending_bit_for_addr_reset),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SRC_ADDR_MATCHING_METHOD_SET,
+                 spinel_decode_prop_nrf_802154_src_addr_matching_method_set),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_ID_SET,
+                 spinel_decode_prop_nrf_802154_pan_id_set),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SHORT_ADDRESS_SET,
+                 spinel_decode_prop_nrf_802154_short_address_set),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_EXTENDED_ADDRESS_SET,
+                 spinel_decode_prop_nrf_802154_extended_address_set),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_COORD_SET,
+                 spinel_decode_prop_nrf_802154_pan_coord_set),
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_COORD_SET:
-            return spinel_decode_prop_nrf_802154_pan_coord_set(p_property_data, property_data_len);
 #if NRF_802154_PAN_COORD_GET_ENABLED
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_COORD_GET:
-            return spinel_decode_prop_nrf_802154_pan_coord_get(p_property_data, property_data_len);
-
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_COORD_GET,
+                 spinel_decode_prop_nrf_802154_pan_coord_get),
 #endif // NRF_802154_PAN_COORD_GET_ENABLED
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PROMISCUOUS_SET:
-            return spinel_decode_prop_nrf_802154_promiscuous_set(p_property_data,
-                                                                 property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA:
-            return spinel_decode_prop_nrf_802154_cca(p_property_data, property_data_len);
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PROMISCUOUS_SET,
+                 spinel_decode_prop_nrf_802154_promiscuous_set),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA,
+                 spinel_decode_prop_nrf_802154_cca),
 
 #if NRF_802154_CARRIER_FUNCTIONS_ENABLED
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CONTINUOUS_CARRIER:
-            return spinel_decode_prop_nrf_802154_continuous_carrier(p_property_data,
-                                                                    property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_MODULATED_CARRIER:
-            return spinel_decode_prop_nrf_802154_modulated_carrier(p_property_data,
-                                                                   property_data_len);
-
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CONTINUOUS_CARRIER,
+                 spinel_decode_prop_nrf_802154_continuous_carrier),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_MODULATED_CARRIER,
+                 spinel_decode_prop_nrf_802154_modulated_carrier),
 #endif // NRF_802154_CARRIER_FUNCTIONS_ENABLED
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTION:
-            return spinel_decode_prop_nrf_802154_energy_detection(p_property_data,
-                                                                  property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_POWER_SET:
-            return spinel_decode_prop_nrf_802154_tx_power_set(p_property_data, property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_POWER_GET:
-            return spinel_decode_prop_nrf_802154_tx_power_get(p_property_data, property_data_len);
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTION,
+                 spinel_decode_prop_nrf_802154_energy_detection),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_SCAN,
+                 spinel_decode_prop_nrf_802154_energy_scan),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_POWER_SET,
+                 spinel_decode_prop_nrf_802154_tx_power_set),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_POWER_GET,
+                 spinel_decode_prop_nrf_802154_tx_power_get),
 
 #if NRF_802154_CSMA_CA_ENABLED
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_CSMA_CA_RAW:
-            return spinel_decode_prop_nrf_802154_transmit_csma_ca_raw(p_property_data,
-                                                                      property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MIN_BE_SET:
-            return spinel_decode_prop_nrf_802154_csma_ca_min_be_set(p_property_data,
-                                                                    property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MIN_BE_GET:
-            return spinel_decode_prop_nrf_802154_csma_ca_min_be_get(p_property_data,
-                                                                    property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BE_SET:
-            return spinel_decode_prop_nrf_802154_csma_ca_max_be_set(p_property_data,
-                                                                    property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BE_GET:
-            return spinel_decode_prop_nrf_802154_csma_ca_max_be_get(p_property_data,
-                                                                    property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BACKOFFS_SET:
-            return spinel_decode_prop_nrf_802154_csma_ca_max_backoffs_set(p_property_data,
-                                                                          property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BACKOFFS_GET:
-            return spinel_decode_prop_nrf_802154_csma_ca_max_backoffs_get(p_property_data,
-                                                                          property_data_len);
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_CSMA_CA_RAW,
+                 spinel_decode_prop_nrf_802154_transmit_csma_ca_raw),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MIN_BE_SET,
+                 spinel_decode_prop_nrf_802154_csma_ca_min_be_set),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MIN_BE_GET,
+                 spinel_decode_prop_nrf_802154_csma_ca_min_be_get),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BE_SET,
+                 spinel_decode_prop_nrf_802154_csma_ca_max_be_set),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BE_GET,
+                 spinel_decode_prop_nrf_802154_csma_ca_max_be_get),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BACKOFFS_SET,
+                 spinel_decode_prop_nrf_802154_csma_ca_max_backoffs_set),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BACKOFFS_GET,
+                 spinel_decode_prop_nrf_802154_csma_ca_max_backoffs_get),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_FRAME_RETRIES_SET,
+                 spinel_decode_prop_nrf_802154_csma_ca_max_frame_retries_set),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_FRAME_RETRIES_GET,
+                 spinel_decode_prop_nrf_802154_csma_ca_max_frame_retries_get),
 #endif // NRF_802154_CSMA_CA_ENABLED
 
 #if NRF_802154_TEST_MODES_ENABLED
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TEST_MODE_CSMACA_BACKOFF_SET:
-            return spinel_decode_prop_nrf_802154_test_mode_csmaca_backoff_set(p_property_data,
-                                                                              property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TEST_MODE_CSMACA_BACKOFF_GET:
-            return spinel_decode_prop_nrf_802154_test_mode_csmaca_backoff_get(p_property_data,
-                                                                              property_data_len);
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TEST_MODE_CSMACA_BACKOFF_SET,
+                 spinel_decode_prop_nrf_802154_test_mode_csmaca_backoff_set),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TEST_MODE_CSMACA_BACKOFF_GET,
+                 spinel_decode_prop_nrf_802154_test_mode_csmaca_backoff_get),
 #endif // NRF_802154_TEST_MODES_ENABLED
 
 #if NRF_802154_IFS_ENABLED
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MODE_SET:
-            return spinel_decode_prop_nrf_802154_ifs_mode_set(p_property_data,
-                                                              property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MODE_GET:
-            return spinel_decode_prop_nrf_802154_ifs_mode_get(p_property_data,
-                                                              property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_SIFS_PERIOD_SET:
-            return spinel_decode_prop_nrf_802154_ifs_min_sifs_period_set(p_property_data,
-                                                                         property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_SIFS_PERIOD_GET:
-            return spinel_decode_prop_nrf_802154_ifs_min_sifs_period_get(p_property_data,
-                                                                         property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_LIFS_PERIOD_SET:
-            return spinel_decode_prop_nrf_802154_ifs_min_lifs_period_set(p_property_data,
-                                                                         property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_LIFS_PERIOD_GET:
-            return spinel_decode_prop_nrf_802154_ifs_min_lifs_period_get(p_property_data,
-                                                                         property_data_len);
-
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MODE_SET,
+                 spinel_decode_prop_nrf_802154_ifs_mode_set),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MODE_GET,
+                 spinel_decode_prop_nrf_802154_ifs_mode_get),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_SIFS_PERIOD_SET,
+                 spinel_decode_prop_nrf_802154_ifs_min_sifs_period_set),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_SIFS_PERIOD_GET,
+                 spinel_decode_prop_nrf_802154_ifs_min_sifs_period_get),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_LIFS_PERIOD_SET,
+                 spinel_decode_prop_nrf_802154_ifs_min_lifs_period_set),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_LIFS_PERIOD_GET,
+                 spinel_decode_prop_nrf_802154_ifs_min_lifs_period_get),
 #endif // NRF_802154_IFS_ENABLED
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW:
-            return spinel_decode_prop_nrf_802154_transmit_raw(p_property_data, property_data_len);
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW,
+                 spinel_decode_prop_nrf_802154_transmit_raw),
 
 #if NRF_802154_DELAYED_TRX_ENABLED
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW_AT:
-            return spinel_decode_prop_nrf_802154_transmit_raw_at(p_property_data,
-                                                                 property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_AT_CANCEL:
-            return spinel_decode_prop_nrf_802154_transmit_at_cancel(p_property_data,
-                                                                    property_data_len);
-
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW_AT,
+                 spinel_decode_prop_nrf_802154_transmit_raw_at),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_AT_CANCEL,
+                 spinel_decode_prop_nrf_802154_transmit_at_cancel),
 #endif // NRF_802154_DELAYED_TRX_ENABLED
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_BUFFER_FREE_RAW:
-            return spinel_decode_prop_nrf_802154_buffer_free_raw(p_property_data,
-                                                                 property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CAPABILITIES_GET:
-            return spinel_decode_prop_nrf_802154_capabilities_get(p_property_data,
-                                                                  property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TIME_GET:
-            return spinel_decode_prop_nrf_802154_time_get(p_property_data,
-                                                          property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA_CFG_GET:
-            return spinel_decode_prop_nrf_802154_cca_cfg_get(p_property_data, property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA_CFG_SET:
-            return spinel_decode_prop_nrf_802154_cca_cfg_set(p_property_data, property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_SET:
-            return spinel_decode_prop_nrf_802154_ack_data_set(p_property_data,
-                                                              property_data_len);
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_CLEAR:
-            return spinel_decode_prop_nrf_802154_ack_data_clear(p_property_data,
-                                                                property_data_len);
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_BUFFER_FREE_RAW,
+                 spinel_decode_prop_nrf_802154_buffer_free_raw),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CAPABILITIES_GET,
+                 spinel_decode_prop_nrf_802154_capabilities_get),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TIME_GET,
+                 spinel_decode_prop_nrf_802154_time_get),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA_CFG_GET,
+                 spinel_decode_prop_nrf_802154_cca_cfg_get),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA_CFG_SET,
+                 spinel_decode_prop_nrf_802154_cca_cfg_set),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_SET,
+                 spinel_decode_prop_nrf_802154_ack_data_set),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_CLEAR,
+                 spinel_decode_prop_nrf_802154_ack_data_clear),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_SET,
+                 spinel_decode_prop_nrf_802154_security_global_frame_counter_set),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_STORE,
+                 spinel_decode_prop_nrf_802154_security_key_store),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_REMOVE,
+                 spinel_decode_prop_nrf_802154_security_key_remove),
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_SET:
-            return spinel_decode_prop_nrf_802154_security_global_frame_counter_set(p_property_data,
-                                                                                   property_data_len);
+#if NRF_802154_DELAYED_TRX_ENABLED && NRF_802154_IE_WRITER_ENABLED
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSL_WRITER_PERIOD_SET,
+                 spinel_decode_prop_nrf_802154_csl_writer_period_set),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSL_WRITER_ANCHOR_TIME_SET,
+                 spinel_decode_prop_nrf_802154_csl_writer_anchor_time_set),
+#endif // NRF_802154_DELAYED_TRX_ENABLED && NRF_802154_IE_WRITER_ENABLED
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_STORE:
-            return spinel_decode_prop_nrf_802154_security_key_store(p_property_data,
-                                                                    property_data_len);
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_STAT_TIMESTAMPS_GET,
+                 spinel_decode_prop_nrf_802154_stat_timestamps_get),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_STAT_HISTOGRAMS_GET,
+                 spinel_decode_prop_nrf_802154_stat_histograms_get),
+
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PERF_COUNTER_GET,
+                 spinel_decode_prop_nrf_802154_perf_counter_get),
+
+#if NRF_802154_LINK_METRICS_SERIES_ENABLED
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_LINK_METRICS_SERIES_CONFIGURE,
+                 spinel_decode_prop_nrf_802154_link_metrics_series_configure),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_LINK_METRICS_SERIES_GET,
+                 spinel_decode_prop_nrf_802154_link_metrics_series_get),
+#endif // NRF_802154_LINK_METRICS_SERIES_ENABLED
+
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_SET_IF_LARGER,
+                 spinel_decode_prop_nrf_802154_security_global_frame_counter_set_if_larger),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RX_COMPACT_ENABLE,
+                 spinel_decode_prop_nrf_802154_rx_compact_enable),
+
+#if NRF_802154_SER_RX_FILTER_ENABLED
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RX_FILTER_RULE_ADD,
+                 spinel_decode_prop_nrf_802154_rx_filter_rule_add),
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RX_FILTER_CLEAR,
+                 spinel_decode_prop_nrf_802154_rx_filter_clear),
+#endif
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_REMOVE:
-            return spinel_decode_prop_nrf_802154_security_key_remove(p_property_data,
-                                                                     property_data_len);
+#if NRF_802154_SER_LAZY_FREE_ENABLED
+    PROP_DECODER(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_BUFFER_FREE_RAW_BATCH,
+                 spinel_decode_prop_nrf_802154_buffer_free_raw_batch),
+#endif
+};
 
-#if NRF_802154_DELAYED_TRX_ENABLED && NRF_802154_IE_WRITER_ENABLED
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSL_WRITER_PERIOD_SET:
-            return spinel_decode_prop_nrf_802154_csl_writer_period_set(p_property_data,
-                                                                       property_data_len);
+#undef PROP_DECODER
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSL_WRITER_ANCHOR_TIME_SET:
-            return spinel_decode_prop_nrf_802154_csl_writer_anchor_time_set(p_property_data,
-                                                                            property_data_len);
-#endif // NRF_802154_DELAYED_TRX_ENABLED && NRF_802154_IE_WRITER_ENABLED
+nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_set(const void * p_cmd_data,
+                                                                 size_t       cmd_data_len)
+{
+    spinel_prop_key_t                property;
+    const void                     * p_property_data;
+    size_t                           property_data_len;
+    nrf_802154_spinel_prop_decoder_t decoder = NULL;
+    nrf_802154_ser_err_t             res;
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_STAT_TIMESTAMPS_GET:
-            return spinel_decode_prop_nrf_802154_stat_timestamps_get(p_property_data,
-                                                                     property_data_len);
+    res = nrf_802154_spinel_decode_prop_key(p_cmd_data,
+                                            cmd_data_len,
+                                            &property,
+                                            &p_property_data,
+                                            &property_data_len);
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_SET_IF_LARGER:
-            return spinel_decode_prop_nrf_802154_security_global_frame_counter_set_if_larger(
-                p_property_data,
-                property_data_len);
+    if (res < 0)
+    {
+        return res;
+    }
 
-        default:
-            NRF_802154_SPINEL_LOG_RAW("Unsupported property: %s(%u)\n",
-                                      spinel_prop_key_to_cstr(property),
-                                      property);
-            return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    if ((property >= SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN) &&
+        (property < SPINEL_PROP_VENDOR_NORDIC_NRF_802154__END))
+    {
+        decoder = m_prop_value_set_decoders[NRF_802154_SPINEL_PROP_IDX(property)];
+    }
 
+    if (decoder == NULL)
+    {
+        NRF_802154_SPINEL_LOG_RAW("Unsupported property: %s(%u)\n",
+                                  spinel_prop_key_to_cstr(property),
+                                  property);
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
     }
+
+    return decoder(p_property_data, property_data_len);
 }
 
 nrf_802154_ser_err_t nrf_802154_spinel_dispatch_cmd(spinel_command_t cmd,
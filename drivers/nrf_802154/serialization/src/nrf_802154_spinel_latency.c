@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file nrf_802154_spinel_latency.c
+ * @brief Measurement of latencies of serialized calls.
+ */
+
+#include "nrf_802154_spinel_latency.h"
+
+#if NRF_802154_SER_LATENCY_STATS_ENABLED
+
+#include <string.h>
+
+#include "nrf_802154_serialization_crit_sect.h"
+#include "helpers/nrfx_perf_counters.h"
+
+/** @brief Latencies of the measured calls. */
+static nrf_802154_ser_latency_stats_t m_stats[NRF_802154_SER_LATENCY_COUNT];
+
+/** @brief Registers the call count and the histogram of call @p id as "ser.<name>". */
+#define LATENCY_REGISTER(id, name)                                            \
+    NRFX_PERF_COUNTER_REGISTER(id ## _calls,                                  \
+                               "ser." name ".calls",                          \
+                               m_stats[NRF_802154_SER_LATENCY_ ## id].count); \
+    NRFX_PERF_HISTOGRAM_REGISTER(id ## _latency,                              \
+                                 "ser." name ".latency",                      \
+                                 m_stats[NRF_802154_SER_LATENCY_ ## id].bins)
+
+LATENCY_REGISTER(TRANSMIT_RAW, "transmit_raw");
+LATENCY_REGISTER(RECEIVE, "receive");
+LATENCY_REGISTER(CHANNEL_SET, "channel_set");
+LATENCY_REGISTER(RECEIVED_RAW_DECODE, "received_raw_decode");
+LATENCY_REGISTER(RECEIVED_RAW_ENCODE, "received_raw_encode");
+LATENCY_REGISTER(REQUEST_HANDLE, "request_handle");
+
+/**
+ * @brief Gets the histogram bin that counts the given sample.
+ *
+ * @param[in]  value  Sample value.
+ *
+ * @return Index of the bin as described in @ref nrf_802154_ser_latency_stats_t.
+ */
+static uint32_t bin_get(uint32_t value)
+{
+    uint32_t bin = (value == 0U) ? 0U : (32U - __CLZ(value));
+
+    return (bin < NRF_802154_SER_LATENCY_BINS) ? bin : (NRF_802154_SER_LATENCY_BINS - 1U);
+}
+
+/**
+ * @brief Gets the greatest sample counted by the given histogram bin.
+ *
+ * @param[in]  bin  Index of the bin.
+ *
+ * @return Upper bound of the bin.
+ */
+static uint32_t bin_upper_bound_get(uint32_t bin)
+{
+    return (bin == NRF_802154_SER_LATENCY_BINS - 1U) ? UINT32_MAX : ((1UL << bin) - 1UL);
+}
+
+static void stats_reset(void)
+{
+    memset(m_stats, 0, sizeof(m_stats));
+
+    for (uint32_t i = 0U; i < NRF_802154_SER_LATENCY_COUNT; i++)
+    {
+        m_stats[i].min = UINT32_MAX;
+    }
+}
+
+void nrf_802154_spinel_latency_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+
+    stats_reset();
+}
+
+void nrf_802154_spinel_latency_record(nrf_802154_ser_latency_id_t id, uint32_t start)
+{
+    uint32_t latency   = NRF_802154_SER_LATENCY_STATS_TIME_GET() - start;
+    uint32_t crit_sect = 0UL;
+
+    nrf_802154_ser_latency_stats_t * p_stats = &m_stats[id];
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    p_stats->count++;
+    p_stats->total += latency;
+
+    if (latency < p_stats->min)
+    {
+        p_stats->min = latency;
+    }
+
+    if (latency > p_stats->max)
+    {
+        p_stats->max = latency;
+    }
+
+    p_stats->bins[bin_get(latency)]++;
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+}
+
+void nrf_802154_serialization_latency_stats_get(nrf_802154_ser_latency_id_t      id,
+                                                nrf_802154_ser_latency_stats_t * p_stats)
+{
+    uint32_t crit_sect = 0UL;
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    *p_stats = m_stats[id];
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    if (p_stats->count == 0U)
+    {
+        p_stats->min = 0U;
+    }
+}
+
+void nrf_802154_serialization_latency_stats_reset(void)
+{
+    uint32_t crit_sect = 0UL;
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    stats_reset();
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+}
+
+uint32_t nrf_802154_serialization_latency_percentile_get(
+    const nrf_802154_ser_latency_stats_t * p_stats,
+    uint8_t                                percentile)
+{
+    uint64_t rank;
+    uint64_t counted = 0U;
+
+    if (p_stats->count == 0U)
+    {
+        return 0U;
+    }
+
+    if (percentile > 100U)
+    {
+        percentile = 100U;
+    }
+
+    // Number of samples not greater than the percentile, rounded up
+    rank = (((uint64_t)p_stats->count * percentile) + 99U) / 100U;
+
+    if (rank == 0U)
+    {
+        return p_stats->min;
+    }
+
+    for (uint32_t bin = 0U; bin < NRF_802154_SER_LATENCY_BINS; bin++)
+    {
+        counted += p_stats->bins[bin];
+
+        if (counted >= rank)
+        {
+            uint32_t bound = bin_upper_bound_get(bin);
+
+            return (bound < p_stats->max) ? bound : p_stats->max;
+        }
+    }
+
+    return p_stats->max;
+}
+
+#endif // NRF_802154_SER_LATENCY_STATS_ENABLED
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file nrf_802154_spinel_lazy_free.c
+ * @brief Lazy returning of freed receive buffers to the network core.
+ */
+
+#include "nrf_802154_spinel_lazy_free.h"
+
+#if NRF_802154_SER_LAZY_FREE_ENABLED
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "nrf_802154_serialization_crit_sect.h"
+#include "nrf_802154_spinel_datatypes.h"
+#include "nrf_802154_spinel.h"
+#include "nrf_802154_spinel_pack.h"
+
+/** @brief Handles of freed buffers not yet returned to the network core. */
+static uint32_t m_handles[NRF_802154_SER_LAZY_FREE_BATCH_SIZE];
+static size_t   m_handles_num; ///< Number of handles in @ref m_handles.
+
+/** @brief Handles taken for sending. */
+typedef struct
+{
+    uint32_t handles[NRF_802154_SER_LAZY_FREE_BATCH_SIZE]; ///< Handles to be sent.
+    size_t   handles_num;                                  ///< Number of handles to be sent.
+} lazy_free_batch_t;
+
+/**
+ * @brief Packs SPINEL_PROP_VENDOR_NORDIC_NRF_802154_BUFFER_FREE_RAW_BATCH.
+ *
+ * The layout matches @ref SPINEL_DATATYPE_NRF_802154_BUFFER_FREE_RAW_BATCH.
+ *
+ * @param[inout]  p_writer  Writer to which the property is to be packed.
+ * @param[in]     p_ctx     Pointer to the @ref lazy_free_batch_t to be sent.
+ */
+static void buffer_free_raw_batch_pack(nrf_802154_spinel_writer_t * p_writer, const void * p_ctx)
+{
+    const lazy_free_batch_t * p_batch = (const lazy_free_batch_t *)p_ctx;
+
+    nrf_802154_spinel_writer_prop_key(p_writer,
+                                      SPINEL_PROP_VENDOR_NORDIC_NRF_802154_BUFFER_FREE_RAW_BATCH);
+
+    for (size_t i = 0U; i < p_batch->handles_num; i++)
+    {
+        nrf_802154_spinel_writer_uint32(p_writer, p_batch->handles[i]);
+    }
+}
+
+void nrf_802154_spinel_lazy_free_init(void)
+{
+    m_handles_num = 0U;
+}
+
+nrf_802154_ser_err_t nrf_802154_spinel_lazy_free_add(uint32_t buffer_handle)
+{
+    nrf_802154_ser_err_t res       = NRF_802154_SERIALIZATION_ERROR_OK;
+    uint32_t             crit_sect = 0UL;
+    bool                 added;
+    bool                 full;
+
+    do
+    {
+        nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+        added = (m_handles_num < NRF_802154_SER_LAZY_FREE_BATCH_SIZE);
+
+        if (added)
+        {
+            m_handles[m_handles_num++] = buffer_handle;
+        }
+
+        full = (m_handles_num == NRF_802154_SER_LAZY_FREE_BATCH_SIZE);
+
+        nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+        if (full)
+        {
+            // The handle did not fit or completed the batch
+            res = nrf_802154_spinel_lazy_free_flush();
+        }
+    }
+    while (!added && (res >= 0));
+
+    return res;
+}
+
+nrf_802154_ser_err_t nrf_802154_spinel_lazy_free_flush(void)
+{
+    lazy_free_batch_t batch;
+    uint32_t          crit_sect = 0UL;
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    batch.handles_num = m_handles_num;
+
+    for (size_t i = 0U; i < m_handles_num; i++)
+    {
+        batch.handles[i] = m_handles[i];
+    }
+
+    m_handles_num = 0U;
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    if (batch.handles_num == 0U)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_OK;
+    }
+
+    // Handles accumulated in the meantime are flushed in front of the request
+    // The network core does not respond, so signaling of the peer can be moderated
+    return nrf_802154_spinel_prop_send_moderated(SPINEL_CMD_PROP_VALUE_SET,
+                                                 buffer_free_raw_batch_pack,
+                                                 &batch);
+}
+
+#endif // NRF_802154_SER_LAZY_FREE_ENABLED
@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file nrf_802154_spinel_log_deferred.c
+ * @brief Deferred binary logging of the spinel serialization.
+ *
+ * Every log entry occupies consecutive words of @ref g_nrf_802154_spinel_log_buffer. The first
+ * word of an entry is a header that holds the entry type and the number of words that follow it:
+ * - a message entry is followed by the address of the format string and the arguments,
+ * - a buffer entry is followed by the length of the buffer and its truncated contents.
+ *
+ * The buffer and its indices are global to let external tools extract and format the entries.
+ */
+
+#include "nrf_802154_spinel_log.h"
+
+#if NRF_802154_SER_LOG_DEFERRED_ENABLED
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "nrf_802154_serialization_crit_sect.h"
+
+#if (NRF_802154_SER_LOG_DEFERRED_BUFFER_LEN & (NRF_802154_SER_LOG_DEFERRED_BUFFER_LEN - 1)) != 0
+#error NRF_802154_SER_LOG_DEFERRED_BUFFER_LEN must be a power of two
+#endif
+
+#if (NRF_802154_SER_LOG_DEFERRED_BUFF_MAX_SIZE % 4) != 0
+#error NRF_802154_SER_LOG_DEFERRED_BUFF_MAX_SIZE must be a multiple of 4
+#endif
+
+#define ENTRY_TYPE_MSG       0x1U                                    ///< Type of a message entry.
+#define ENTRY_TYPE_BUFF      0x2U                                    ///< Type of a buffer entry.
+#define ENTRY_TYPE_POS       16U                                     ///< Bit position of the entry type in the header.
+#define ENTRY_LEN_MASK       0xFFFFU                                 ///< Mask of the number of words in the header.
+#define ENTRY_BUFF_MAX_WORDS (NRF_802154_SER_LOG_DEFERRED_BUFF_MAX_SIZE / sizeof(uint32_t))
+#define ENTRY_MAX_WORDS      (2U + NRF_802154_SPINEL_LOG_DEFERRED_MAX_ARGS + ENTRY_BUFF_MAX_WORDS)
+
+/** @brief Ring buffer of the log entries. */
+volatile uint32_t g_nrf_802154_spinel_log_buffer[NRF_802154_SER_LOG_DEFERRED_BUFFER_LEN];
+
+/** @brief Number of words written to the ring buffer, modulo 2^32. */
+volatile uint32_t g_nrf_802154_spinel_log_wr_idx;
+
+/** @brief Number of words read from the ring buffer, modulo 2^32. */
+volatile uint32_t g_nrf_802154_spinel_log_rd_idx;
+
+/** @brief Number of log entries dropped because the ring buffer was full. */
+volatile uint32_t g_nrf_802154_spinel_log_dropped;
+
+/**
+ * @brief Stores a log entry in the ring buffer.
+ *
+ * @param[in]  type     Type of the entry.
+ * @param[in]  p_words  Words that follow the header of the entry.
+ * @param[in]  len      Number of words pointed to by @p p_words.
+ */
+static void entry_write(uint32_t type, const uint32_t * p_words, uint32_t len)
+{
+    uint32_t crit_sect = 0UL;
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    uint32_t wr_idx = g_nrf_802154_spinel_log_wr_idx;
+
+    if ((NRF_802154_SER_LOG_DEFERRED_BUFFER_LEN - (wr_idx - g_nrf_802154_spinel_log_rd_idx)) <
+        (len + 1U))
+    {
+        g_nrf_802154_spinel_log_dropped++;
+    }
+    else
+    {
+        g_nrf_802154_spinel_log_buffer[wr_idx % NRF_802154_SER_LOG_DEFERRED_BUFFER_LEN] =
+            (type << ENTRY_TYPE_POS) | len;
+
+        for (uint32_t i = 0U; i < len; i++)
+        {
+            g_nrf_802154_spinel_log_buffer[(wr_idx + 1U + i) %
+                                           NRF_802154_SER_LOG_DEFERRED_BUFFER_LEN] = p_words[i];
+        }
+
+        g_nrf_802154_spinel_log_wr_idx = wr_idx + 1U + len;
+    }
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+}
+
+/**
+ * @brief Takes the oldest log entry out of the ring buffer.
+ *
+ * @param[out]  p_type   Type of the entry.
+ * @param[out]  p_words  Buffer for at least @ref ENTRY_MAX_WORDS words that follow the header.
+ * @param[out]  p_len    Number of words stored in @p p_words.
+ *
+ * @retval true   An entry has been taken out.
+ * @retval false  The ring buffer is empty.
+ */
+static bool entry_read(uint32_t * p_type, uint32_t * p_words, uint32_t * p_len)
+{
+    uint32_t crit_sect = 0UL;
+    bool     result    = false;
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    uint32_t rd_idx = g_nrf_802154_spinel_log_rd_idx;
+
+    if (rd_idx != g_nrf_802154_spinel_log_wr_idx)
+    {
+        uint32_t header =
+            g_nrf_802154_spinel_log_buffer[rd_idx % NRF_802154_SER_LOG_DEFERRED_BUFFER_LEN];
+
+        *p_type = header >> ENTRY_TYPE_POS;
+        *p_len  = header & ENTRY_LEN_MASK;
+
+        for (uint32_t i = 0U; i < *p_len; i++)
+        {
+            p_words[i] = g_nrf_802154_spinel_log_buffer[(rd_idx + 1U + i) %
+                                                        NRF_802154_SER_LOG_DEFERRED_BUFFER_LEN];
+        }
+
+        g_nrf_802154_spinel_log_rd_idx = rd_idx + 1U + *p_len;
+        result                         = true;
+    }
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    return result;
+}
+
+/**
+ * @brief Formats a message entry.
+ *
+ * @param[in]  p_words  Words of the entry that follow its header.
+ * @param[in]  len      Number of words pointed to by @p p_words.
+ */
+static void msg_entry_format(const uint32_t * p_words, uint32_t len)
+{
+    const char * p_fmt = (const char *)(uintptr_t)p_words[0];
+
+    switch (len - 1U)
+    {
+        case 0U:
+            nrf_802154_spinel_log(p_fmt);
+            break;
+
+        case 1U:
+            nrf_802154_spinel_log(p_fmt, p_words[1]);
+            break;
+
+        case 2U:
+            nrf_802154_spinel_log(p_fmt, p_words[1], p_words[2]);
+            break;
+
+        case 3U:
+            nrf_802154_spinel_log(p_fmt, p_words[1], p_words[2], p_words[3]);
+            break;
+
+        default:
+            nrf_802154_spinel_log(p_fmt, p_words[1], p_words[2], p_words[3], p_words[4]);
+            break;
+    }
+}
+
+void nrf_802154_spinel_log_deferred(uint32_t argc, const char * p_fmt, ...)
+{
+    uint32_t words[1U + NRF_802154_SPINEL_LOG_DEFERRED_MAX_ARGS];
+    va_list  args;
+
+    if (argc > NRF_802154_SPINEL_LOG_DEFERRED_MAX_ARGS)
+    {
+        argc = NRF_802154_SPINEL_LOG_DEFERRED_MAX_ARGS;
+    }
+
+    words[0] = (uint32_t)(uintptr_t)p_fmt;
+
+    va_start(args, p_fmt);
+
+    for (uint32_t i = 0U; i < argc; i++)
+    {
+        words[1U + i] = va_arg(args, uint32_t);
+    }
+
+    va_end(args);
+
+    entry_write(ENTRY_TYPE_MSG, words, 1U + argc);
+}
+
+void nrf_802154_spinel_buff_log_deferred(const uint8_t * p_buff, size_t buff_len)
+{
+    uint32_t words[1U + ENTRY_BUFF_MAX_WORDS];
+    uint32_t len = (buff_len < NRF_802154_SER_LOG_DEFERRED_BUFF_MAX_SIZE) ?
+                   (uint32_t)buff_len : NRF_802154_SER_LOG_DEFERRED_BUFF_MAX_SIZE;
+
+    words[0] = len;
+    memcpy(&words[1], p_buff, len);
+
+    entry_write(ENTRY_TYPE_BUFF, words, 1U + (len + sizeof(uint32_t) - 1U) / sizeof(uint32_t));
+}
+
+void nrf_802154_spinel_log_deferred_process(void)
+{
+    uint32_t words[ENTRY_MAX_WORDS];
+    uint32_t type;
+    uint32_t len;
+    uint32_t dropped;
+    uint32_t crit_sect = 0UL;
+
+    while (entry_read(&type, words, &len))
+    {
+        if (type == ENTRY_TYPE_MSG)
+        {
+            msg_entry_format(words, len);
+        }
+        else
+        {
+            nrf_802154_spinel_buff_log((const uint8_t *)&words[1], words[0]);
+        }
+    }
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+    dropped                         = g_nrf_802154_spinel_log_dropped;
+    g_nrf_802154_spinel_log_dropped = 0U;
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    if (dropped != 0U)
+    {
+        nrf_802154_spinel_log("%u log entries dropped\n", (unsigned int)dropped);
+    }
+}
+
+#endif // NRF_802154_SER_LOG_DEFERRED_ENABLED
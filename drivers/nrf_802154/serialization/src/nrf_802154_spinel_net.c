@@ -50,15 +50,22 @@
 #include "nrf_802154_spinel.h"
 #include "nrf_802154_spinel_datatypes.h"
 #include "nrf_802154_spinel_enc_net.h"
+#include "nrf_802154_spinel_latency.h"
 #include "nrf_802154_spinel_log.h"
 #include "nrf_802154_spinel_response_notifier.h"
+#include "nrf_802154_spinel_rx_compact.h"
+#include "nrf_802154_spinel_rx_filter.h"
 #include "nrf_802154_serialization_error.h"
 #include "nrf_802154_serialization_error_helper.h"
 #include "nrf_802154_buffer_mgr_dst.h"
 #include "nrf_802154_buffer_mgr_src.h"
+#include "nrf_802154_shm_rx_ring.h"
+#include "nrf_802154_shm_tx_pool.h"
 
 #include "nrf_802154.h"
 
+#include <string.h>
+
 /**@brief A pointer to the last transmitted ACK frame. */
 static const uint8_t * volatile mp_last_tx_ack;
 
@@ -66,6 +73,14 @@ static void local_transmitted_frame_ptr_free(void * p_frame)
 {
     SERIALIZATION_ERROR_INIT(error);
 
+#if NRF_802154_SER_SHM_TX_POOL_ENABLED
+    if (nrf_802154_shm_tx_pool_contains(p_frame))
+    {
+        // The frame is owned by the application core. Nothing to release locally
+        return;
+    }
+#endif
+
     bool frame_found = nrf_802154_buffer_mgr_dst_remove_by_local_pointer(
         nrf_802154_spinel_dst_buffer_mgr_get(),
         p_frame);
@@ -81,6 +96,40 @@ bail:
     return;
 }
 
+/**
+ * @brief Gets a remote handle of a transmitted frame and the number of its bytes to serialize.
+ *
+ * A frame placed in the shared-memory TX pool is identified by its address and its content
+ * is not serialized, because the application core accesses it in place.
+ *
+ * @param[in]  p_frame            Pointer to the transmitted frame.
+ * @param[out] p_frame_handle     Remote handle of the frame.
+ * @param[out] p_serialized_len   Number of bytes of the frame to serialize.
+ *
+ * @retval true   The handle was found.
+ * @retval false  The frame is not known.
+ */
+static bool remote_transmitted_frame_handle_get(const uint8_t * p_frame,
+                                                uint32_t      * p_frame_handle,
+                                                uint8_t       * p_serialized_len)
+{
+#if NRF_802154_SER_SHM_TX_POOL_ENABLED
+    if (nrf_802154_shm_tx_pool_contains(p_frame))
+    {
+        *p_frame_handle   = (uintptr_t)p_frame;
+        *p_serialized_len = 0U;
+        return true;
+    }
+#endif
+
+    *p_serialized_len = p_frame[0] + 1U;
+
+    return nrf_802154_buffer_mgr_dst_search_by_local_pointer(
+        nrf_802154_spinel_dst_buffer_mgr_get(),
+        (void *)p_frame,
+        p_frame_handle);
+}
+
 void nrf_802154_cca_done(bool channel_free)
 {
     nrf_802154_ser_err_t res;
@@ -139,12 +188,12 @@ void nrf_802154_energy_detected(uint8_t result)
     NRF_802154_SPINEL_LOG_VAR("%u", result);
 
 #if (NRF_802154_ENERGY_DETECTED_VERSION != 0)
-    res = nrf_802154_spinel_send_cmd_prop_value_is(
+    res = nrf_802154_spinel_send_notification_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTED,
         SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTED,
         p_result->ed_dbm);
 #else
-    res = nrf_802154_spinel_send_cmd_prop_value_is(
+    res = nrf_802154_spinel_send_notification_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTED,
         SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTED,
         result);
@@ -167,7 +216,7 @@ void nrf_802154_energy_detection_failed(nrf_802154_ed_error_t err)
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_VAR("%u", err);
 
-    res = nrf_802154_spinel_send_cmd_prop_value_is(
+    res = nrf_802154_spinel_send_notification_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTION_FAILED,
         SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_FAILED,
         err);
@@ -180,6 +229,30 @@ bail:
     return;
 }
 
+void nrf_802154_energy_scan_done(const nrf_802154_energy_scan_result_t * p_result)
+{
+    nrf_802154_ser_err_t res;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR("%u", p_result->channel_mask);
+
+    res = nrf_802154_spinel_send_notification_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_SCAN_DONE,
+        SPINEL_DATATYPE_NRF_802154_ENERGY_SCAN_DONE,
+        p_result->channel_mask,
+        p_result->ed_dbm,
+        sizeof(p_result->ed_dbm));
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return;
+}
+
 void nrf_802154_tx_ack_started(const uint8_t * p_data)
 {
     /* Due to timing restrictions this function cannot be serialized directly.
@@ -210,6 +283,131 @@ static nrf_802154_ser_err_t last_tx_ack_started_send(void)
     return res;
 }
 
+#if NRF_802154_SER_SHM_RX_RING_ENABLED
+/**
+ * @brief Passes a received frame to the application core through the shared-memory RX ring.
+ *
+ * On success the frame buffer is returned to the driver immediately.
+ *
+ * @param[in]  p_data  Pointer to the received frame.
+ * @param[in]  power   RSSI of the frame.
+ * @param[in]  lqi     LQI of the frame.
+ * @param[in]  time    Timestamp of the frame.
+ * @param[out] p_res   Result of the serialization. Valid only if the frame was handled.
+ *
+ * @retval true   The frame was handled.
+ * @retval false  No slot is available. The frame must be serialized in the regular way.
+ */
+static bool received_timestamp_shm_send(uint8_t              * p_data,
+                                        int8_t                 power,
+                                        uint8_t                lqi,
+                                        uint64_t               time,
+                                        nrf_802154_ser_err_t * p_res)
+{
+    uint8_t slot;
+
+    if (!nrf_802154_shm_rx_ring_slot_take(&slot))
+    {
+        return false;
+    }
+
+    memcpy(nrf_802154_shm_rx_ring_slot_data_get(slot), p_data, p_data[0] + 1U);
+    nrf_802154_shm_rx_ring_slot_pass(slot);
+
+    *p_res = nrf_802154_spinel_send_notification_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_SHM,
+        SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_SHM,
+        slot,
+        p_data[0],
+        power,
+        lqi,
+        time);
+
+    if (*p_res < 0)
+    {
+        // The descriptor did not reach the other core, so the slot will never be released there
+        nrf_802154_shm_rx_ring_slot_release(slot);
+    }
+
+    nrf_802154_buffer_free_raw(p_data);
+
+    return true;
+}
+
+#endif // NRF_802154_SER_SHM_RX_RING_ENABLED
+
+/**
+ * @brief Value of SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW to be packed.
+ */
+typedef struct
+{
+    uint32_t        data_handle; ///< Handle of the received frame.
+    const uint8_t * p_data;      ///< Received frame.
+    int8_t          power;       ///< RSSI of the received frame.
+    uint8_t         lqi;         ///< LQI of the received frame.
+    uint64_t        time;        ///< Timestamp of the received frame.
+} received_timestamp_raw_t;
+
+/**
+ * @brief Packs SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW.
+ *
+ * The layout matches @ref SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW.
+ *
+ * @param[inout]  p_writer  Writer to which the property is to be packed.
+ * @param[in]     p_ctx     Pointer to the @ref received_timestamp_raw_t to be packed.
+ */
+static void received_timestamp_raw_pack(nrf_802154_spinel_writer_t * p_writer,
+                                        const void                 * p_ctx)
+{
+    const received_timestamp_raw_t * p_rx = (const received_timestamp_raw_t *)p_ctx;
+
+    nrf_802154_spinel_writer_prop_key(p_writer,
+                                      SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW);
+    nrf_802154_spinel_writer_hdata(p_writer, p_rx->data_handle, p_rx->p_data, p_rx->p_data[0]);
+    nrf_802154_spinel_writer_uint8(p_writer, (uint8_t)p_rx->power);
+    nrf_802154_spinel_writer_uint8(p_writer, p_rx->lqi);
+    nrf_802154_spinel_writer_uint64(p_writer, p_rx->time);
+}
+
+#if NRF_802154_SER_COMPACT_RX_ENABLED
+
+/**
+ * @brief Value of SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_COMPACT to be packed.
+ */
+typedef struct
+{
+    uint32_t        handle_delta; ///< Zigzag-encoded difference of the handles.
+    uint32_t        time_delta;   ///< Difference of the timestamps.
+    const uint8_t * p_data;       ///< Received frame.
+    int8_t          power;        ///< RSSI of the received frame.
+    uint8_t         lqi;          ///< LQI of the received frame.
+} received_timestamp_compact_t;
+
+/**
+ * @brief Packs SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_COMPACT.
+ *
+ * The layout matches @ref SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_COMPACT.
+ *
+ * @param[inout]  p_writer  Writer to which the property is to be packed.
+ * @param[in]     p_ctx     Pointer to the @ref received_timestamp_compact_t to be packed.
+ */
+static void received_timestamp_compact_pack(nrf_802154_spinel_writer_t * p_writer,
+                                            const void                 * p_ctx)
+{
+    const received_timestamp_compact_t * p_rx = (const received_timestamp_compact_t *)p_ctx;
+
+    nrf_802154_spinel_writer_prop_key(
+        p_writer,
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_COMPACT);
+    nrf_802154_spinel_writer_packed_uint(p_writer, p_rx->handle_delta);
+    nrf_802154_spinel_writer_packed_uint(p_writer, p_rx->time_delta);
+    nrf_802154_spinel_writer_uint8(p_writer, (uint8_t)p_rx->power);
+    nrf_802154_spinel_writer_uint8(p_writer, p_rx->lqi);
+    nrf_802154_spinel_writer_raw(p_writer, p_rx->p_data, p_rx->p_data[0]);
+}
+
+#endif // NRF_802154_SER_COMPACT_RX_ENABLED
+
 void nrf_802154_received_timestamp_raw(uint8_t * p_data,
                                        int8_t    power,
                                        uint8_t   lqi,
@@ -218,6 +416,7 @@ void nrf_802154_received_timestamp_raw(uint8_t * p_data,
     nrf_802154_ser_err_t res;
     uint32_t             local_data_handle;
 
+    NRF_802154_SPINEL_LATENCY_START(latency_start);
     SERIALIZATION_ERROR_INIT(error);
 
     res = last_tx_ack_started_send();
@@ -226,6 +425,25 @@ void nrf_802154_received_timestamp_raw(uint8_t * p_data,
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_BUFF(p_data, p_data[0]);
 
+#if NRF_802154_SER_RX_FILTER_ENABLED
+    if (!nrf_802154_spinel_rx_filter_frame_passes(p_data))
+    {
+        // The application core is not interested in the frame
+        nrf_802154_buffer_free_raw(p_data);
+        goto bail;
+    }
+#endif
+
+#if NRF_802154_SER_SHM_RX_RING_ENABLED
+    if (received_timestamp_shm_send(p_data, power, lqi, time, &res))
+    {
+        SERIALIZATION_ERROR_CHECK(res, error, bail);
+        NRF_802154_SPINEL_LATENCY_RECORD(NRF_802154_SER_LATENCY_RECEIVED_RAW_ENCODE,
+                                         latency_start);
+        goto bail;
+    }
+#endif
+
     // Create a handle to the original frame buffer
     bool handle_added = nrf_802154_buffer_mgr_src_add(nrf_802154_spinel_src_buffer_mgr_get(),
                                                       (void *)p_data,
@@ -239,13 +457,39 @@ void nrf_802154_received_timestamp_raw(uint8_t * p_data,
     }
 
     // Serialize the call
-    res = nrf_802154_spinel_send_cmd_prop_value_is(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW,
-        SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW,
-        NRF_802154_HDATA_ENCODE(local_data_handle, p_data, p_data[0]),
-        power,
-        lqi,
-        time);
+#if NRF_802154_SER_COMPACT_RX_ENABLED
+    received_timestamp_compact_t rx_compact =
+    {
+        .p_data = p_data,
+        .power  = power,
+        .lqi    = lqi,
+    };
+
+    if (nrf_802154_spinel_rx_compact_delta_get(local_data_handle,
+                                               time,
+                                               &rx_compact.handle_delta,
+                                               &rx_compact.time_delta))
+    {
+        res = nrf_802154_spinel_send_notification_prop_value_is_packed(
+            received_timestamp_compact_pack,
+            &rx_compact);
+    }
+    else
+#endif
+    {
+        received_timestamp_raw_t rx =
+        {
+            .data_handle = local_data_handle,
+            .p_data      = p_data,
+            .power       = power,
+            .lqi         = lqi,
+            .time        = time,
+        };
+
+        res = nrf_802154_spinel_send_notification_prop_value_is_packed(
+            received_timestamp_raw_pack,
+            &rx);
+    }
 
     if (res < 0)
     {
@@ -258,6 +502,15 @@ void nrf_802154_received_timestamp_raw(uint8_t * p_data,
         SERIALIZATION_ERROR(res, error, bail);
     }
 
+#if NRF_802154_SER_COMPACT_RX_ENABLED
+    if (nrf_802154_spinel_rx_compact_is_enabled())
+    {
+        nrf_802154_spinel_rx_compact_ref_update(local_data_handle, time);
+    }
+#endif
+
+    NRF_802154_SPINEL_LATENCY_RECORD(NRF_802154_SER_LATENCY_RECEIVED_RAW_ENCODE, latency_start);
+
 bail:
     SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
 
@@ -277,7 +530,7 @@ void nrf_802154_receive_failed(nrf_802154_rx_error_t error, uint32_t id)
     NRF_802154_SPINEL_LOG_VAR("%u", error);
 
     // Serialize the call
-    res = nrf_802154_spinel_send_cmd_prop_value_is(
+    res = nrf_802154_spinel_send_notification_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_FAILED,
         SPINEL_DATATYPE_NRF_802154_RECEIVE_FAILED,
         error,
@@ -289,10 +542,53 @@ bail:
     SERIALIZATION_ERROR_RAISE_IF_FAILED(ser_error);
 }
 
+/**
+ * @brief Value of SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMITTED_RAW to be packed.
+ */
+typedef struct
+{
+    uint32_t                                    frame_handle; ///< Remote handle of the frame.
+    const uint8_t                             * p_frame;      ///< Transmitted frame.
+    uint8_t                                     frame_len;    ///< Serialized length of the frame.
+    const nrf_802154_transmit_done_metadata_t * p_metadata;   ///< Transmit done metadata.
+    uint32_t                                    ack_handle;   ///< Handle of the received ACK.
+} transmitted_raw_t;
+
+/**
+ * @brief Packs SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMITTED_RAW.
+ *
+ * The layout matches @ref SPINEL_DATATYPE_NRF_802154_TRANSMITTED_RAW.
+ *
+ * @param[inout]  p_writer  Writer to which the property is to be packed.
+ * @param[in]     p_ctx     Pointer to the @ref transmitted_raw_t to be packed.
+ */
+static void transmitted_raw_pack(nrf_802154_spinel_writer_t * p_writer, const void * p_ctx)
+{
+    const transmitted_raw_t                   * p_tx       = (const transmitted_raw_t *)p_ctx;
+    const nrf_802154_transmit_done_metadata_t * p_metadata = p_tx->p_metadata;
+    const uint8_t                             * p_ack      = p_metadata->data.transmitted.p_ack;
+
+    nrf_802154_spinel_writer_prop_key(p_writer,
+                                      SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMITTED_RAW);
+    nrf_802154_spinel_writer_hdata(p_writer, p_tx->frame_handle, p_tx->p_frame, p_tx->frame_len);
+    nrf_802154_spinel_writer_bool(p_writer, p_metadata->frame_props.is_secured);
+    nrf_802154_spinel_writer_bool(p_writer, p_metadata->frame_props.dynamic_data_is_set);
+    nrf_802154_spinel_writer_uint8(p_writer, p_metadata->retries);
+    nrf_802154_spinel_writer_uint8(p_writer, p_metadata->data.transmitted.length);
+    nrf_802154_spinel_writer_uint8(p_writer, (uint8_t)p_metadata->data.transmitted.power);
+    nrf_802154_spinel_writer_uint8(p_writer, p_metadata->data.transmitted.lqi);
+    nrf_802154_spinel_writer_uint64(p_writer, p_metadata->data.transmitted.time);
+    nrf_802154_spinel_writer_hdata(p_writer,
+                                   p_tx->ack_handle,
+                                   p_ack,
+                                   (p_ack != NULL) ? (p_ack[0] + 1U) : 0U);
+}
+
 void nrf_802154_transmitted_raw(uint8_t                                   * p_frame,
                                 const nrf_802154_transmit_done_metadata_t * p_metadata)
 {
     uint32_t  remote_frame_handle;
+    uint8_t   frame_serialized_len;
     uint32_t  ack_handle = 0;
     uint8_t * p_ack      = p_metadata->data.transmitted.p_ack;
 
@@ -302,10 +598,9 @@ void nrf_802154_transmitted_raw(uint8_t                                   * p_fr
     NRF_802154_SPINEL_LOG_BUFF(p_frame, p_frame[0]);
 
     // Search for the handle to the original frame buffer based on the local pointer
-    bool frame_found = nrf_802154_buffer_mgr_dst_search_by_local_pointer(
-        nrf_802154_spinel_dst_buffer_mgr_get(),
-        (void *)p_frame,
-        &remote_frame_handle);
+    bool frame_found = remote_transmitted_frame_handle_get(p_frame,
+                                                           &remote_frame_handle,
+                                                           &frame_serialized_len);
 
     // The handle is expected to be found, throw an error if it was not found
     SERIALIZATION_ERROR_IF(!frame_found,
@@ -330,10 +625,18 @@ void nrf_802154_transmitted_raw(uint8_t                                   * p_fr
     }
 
     // Serialize the call
-    nrf_802154_ser_err_t res = nrf_802154_spinel_send_cmd_prop_value_is(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMITTED_RAW,
-        SPINEL_DATATYPE_NRF_802154_TRANSMITTED_RAW,
-        NRF_802154_TRANSMITTED_RAW_ENCODE(remote_frame_handle, p_frame, *p_metadata, ack_handle));
+    transmitted_raw_t tx =
+    {
+        .frame_handle = remote_frame_handle,
+        .p_frame      = p_frame,
+        .frame_len    = frame_serialized_len,
+        .p_metadata   = p_metadata,
+        .ack_handle   = ack_handle,
+    };
+
+    nrf_802154_ser_err_t res = nrf_802154_spinel_send_notification_prop_value_is_packed(
+        transmitted_raw_pack,
+        &tx);
 
     // Free the local frame pointer no matter the result of serialization
     local_transmitted_frame_ptr_free((void *)p_frame);
@@ -352,6 +655,7 @@ void nrf_802154_transmit_failed(uint8_t                                   * p_fr
                                 const nrf_802154_transmit_done_metadata_t * p_metadata)
 {
     uint32_t remote_frame_handle;
+    uint8_t  frame_serialized_len;
 
     SERIALIZATION_ERROR_INIT(error);
 
@@ -359,10 +663,9 @@ void nrf_802154_transmit_failed(uint8_t                                   * p_fr
     NRF_802154_SPINEL_LOG_BUFF(p_frame, p_frame[0]);
 
     // Search for the handle to the original frame buffer based on the local pointer
-    bool frame_found = nrf_802154_buffer_mgr_dst_search_by_local_pointer(
-        nrf_802154_spinel_dst_buffer_mgr_get(),
-        (void *)p_frame,
-        &remote_frame_handle);
+    bool frame_found = remote_transmitted_frame_handle_get(p_frame,
+                                                           &remote_frame_handle,
+                                                           &frame_serialized_len);
 
     // The handle is expected to be found, throw an error if it was not found
     SERIALIZATION_ERROR_IF(!frame_found,
@@ -371,10 +674,14 @@ void nrf_802154_transmit_failed(uint8_t                                   * p_fr
                            bail);
 
     // Serialize the call
-    nrf_802154_ser_err_t res = nrf_802154_spinel_send_cmd_prop_value_is(
+    nrf_802154_ser_err_t res = nrf_802154_spinel_send_notification_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_FAILED,
         SPINEL_DATATYPE_NRF_802154_TRANSMIT_FAILED,
-        NRF_802154_TRANSMIT_FAILED_ENCODE(remote_frame_handle, p_frame, tx_error, *p_metadata));
+        NRF_802154_TRANSMIT_FAILED_ENCODE(remote_frame_handle,
+                                          p_frame,
+                                          frame_serialized_len,
+                                          tx_error,
+                                          *p_metadata));
 
     // Free the local frame pointer no matter the result of serialization
     local_transmitted_frame_ptr_free((void *)p_frame);
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file nrf_802154_spinel_rx_compact.c
+ * @brief Compact encoding of received frame notifications.
+ */
+
+#include "nrf_802154_spinel_rx_compact.h"
+
+#if NRF_802154_SER_COMPACT_RX_ENABLED
+
+#include "spinel.h"
+
+#include <stddef.h>
+
+/** @brief Reference for the differences carried by compact notifications. */
+typedef struct
+{
+    uint32_t handle; ///< Handle of the previously notified frame.
+    uint64_t time;   ///< Timestamp of the previously notified frame.
+    bool     valid;  ///< Indicates if the reference is valid.
+} rx_compact_ref_t;
+
+static volatile bool    m_enabled; ///< Indicates if the compact encoding is enabled.
+static rx_compact_ref_t m_ref;     ///< Reference shared with the other core.
+
+void nrf_802154_spinel_rx_compact_init(void)
+{
+    m_enabled   = false;
+    m_ref.valid = false;
+}
+
+void nrf_802154_spinel_rx_compact_enable(void)
+{
+    m_ref.valid = false;
+    m_enabled   = true;
+}
+
+bool nrf_802154_spinel_rx_compact_is_enabled(void)
+{
+    return m_enabled;
+}
+
+bool nrf_802154_spinel_rx_compact_delta_get(uint32_t   handle,
+                                            uint64_t   time,
+                                            uint32_t * p_handle_delta,
+                                            uint32_t * p_time_delta)
+{
+    if (!m_enabled || !m_ref.valid || (time < m_ref.time) ||
+        ((time - m_ref.time) >= SPINEL_MAX_UINT_PACKED))
+    {
+        return false;
+    }
+
+    int32_t  delta    = (int32_t)(handle - m_ref.handle);
+    uint32_t zigzagged = ((uint32_t)delta << 1) ^ (uint32_t)(delta >> 31);
+
+    if (zigzagged >= SPINEL_MAX_UINT_PACKED)
+    {
+        return false;
+    }
+
+    *p_handle_delta = zigzagged;
+    *p_time_delta   = (uint32_t)(time - m_ref.time);
+
+    return true;
+}
+
+bool nrf_802154_spinel_rx_compact_delta_apply(uint32_t   handle_delta,
+                                              uint32_t   time_delta,
+                                              uint32_t * p_handle,
+                                              uint64_t * p_time)
+{
+    if (!m_ref.valid)
+    {
+        return false;
+    }
+
+    uint32_t delta = (handle_delta >> 1) ^ (0U - (handle_delta & 1U));
+
+    *p_handle = m_ref.handle + delta;
+    *p_time   = m_ref.time + time_delta;
+
+    return true;
+}
+
+void nrf_802154_spinel_rx_compact_ref_update(uint32_t handle, uint64_t time)
+{
+    m_ref.handle = handle;
+    m_ref.time   = time;
+    m_ref.valid  = true;
+}
+
+#endif // NRF_802154_SER_COMPACT_RX_ENABLED
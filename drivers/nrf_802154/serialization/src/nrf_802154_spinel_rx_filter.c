@@ -0,0 +1,304 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file nrf_802154_spinel_rx_filter.c
+ * @brief Received frames filter of the network core.
+ */
+
+#include "nrf_802154_spinel_rx_filter.h"
+
+#if NRF_802154_SER_RX_FILTER_ENABLED
+
+#include "nrf_802154_const.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#define FRAME_TYPE_INVALID 0xFFU ///< Frame type of a frame too short to carry the Frame Control field.
+
+/** @brief Fields of a received frame that can be matched by the filter. */
+typedef struct
+{
+    uint8_t         frame_type;    ///< Frame type.
+    const uint8_t * p_dst_pan_id;  ///< Destination PAN ID or NULL if not present.
+    const uint8_t * p_dst_addr;    ///< Destination address or NULL if not present.
+    uint8_t         dst_addr_size; ///< Size of the destination address.
+    const uint8_t * p_cmd_id;      ///< Command ID or NULL if it cannot be located.
+} rx_frame_fields_t;
+
+/** @brief Rules of the filter, in the order of evaluation. */
+static nrf_802154_ser_rx_filter_rule_t m_rules[NRF_802154_SER_RX_FILTER_RULES];
+
+// Rules are only appended or removed all at once. A rule becomes visible to the notifying context
+// only once it is fully written, so no critical section is needed.
+static volatile uint8_t m_rules_num; ///< Number of valid rules.
+
+static uint8_t addr_size_get(uint8_t addr_type, uint8_t short_type, uint8_t extended_type)
+{
+    if (addr_type == short_type)
+    {
+        return SHORT_ADDRESS_SIZE;
+    }
+
+    if (addr_type == extended_type)
+    {
+        return EXTENDED_ADDRESS_SIZE;
+    }
+
+    return 0U;
+}
+
+/**
+ * @brief Locates the fields of a received frame that can be matched by the filter.
+ *
+ * The addressing fields are located only in frames of the Beacon, Data, Acknowledgment
+ * and MAC command types. The Command ID is located only in frames without security and
+ * Information Elements.
+ *
+ * @param[in]  p_data    Received frame, starting with the PHR.
+ * @param[out] p_fields  Located fields.
+ */
+static void rx_frame_fields_get(const uint8_t * p_data, rx_frame_fields_t * p_fields)
+{
+    const uint8_t * p_psdu   = &p_data[PSDU_OFFSET];
+    uint8_t         psdu_len = p_data[PHR_OFFSET] & PHR_LENGTH_MASK;
+
+    memset(p_fields, 0, sizeof(*p_fields));
+
+    if (psdu_len < (FCF_SIZE + FCS_SIZE))
+    {
+        p_fields->frame_type = FRAME_TYPE_INVALID;
+        return;
+    }
+
+    psdu_len -= FCS_SIZE;
+
+    p_fields->frame_type = p_data[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK;
+
+    switch (p_fields->frame_type)
+    {
+        case FRAME_TYPE_BEACON:
+        case FRAME_TYPE_DATA:
+        case FRAME_TYPE_ACK:
+        case FRAME_TYPE_COMMAND:
+            break;
+
+        default:
+            return;
+    }
+
+    uint8_t frame_version     = p_data[FRAME_VERSION_OFFSET] & FRAME_VERSION_MASK;
+    uint8_t dst_addr_type     = p_data[DEST_ADDR_TYPE_OFFSET] & DEST_ADDR_TYPE_MASK;
+    uint8_t src_addr_type     = p_data[SRC_ADDR_TYPE_OFFSET] & SRC_ADDR_TYPE_MASK;
+    bool    panid_compression = (p_data[PAN_ID_COMPR_OFFSET] & PAN_ID_COMPR_MASK) != 0U;
+    uint8_t dst_addr_size     = addr_size_get(dst_addr_type,
+                                              DEST_ADDR_TYPE_SHORT,
+                                              DEST_ADDR_TYPE_EXTENDED);
+    uint8_t src_addr_size = addr_size_get(src_addr_type,
+                                          SRC_ADDR_TYPE_SHORT,
+                                          SRC_ADDR_TYPE_EXTENDED);
+    uint8_t offset = FCF_SIZE;
+    bool    dst_panid_present;
+    bool    src_panid_present;
+
+    if (((dst_addr_type != DEST_ADDR_TYPE_NONE) && (dst_addr_size == 0U)) ||
+        ((src_addr_type != SRC_ADDR_TYPE_NONE) && (src_addr_size == 0U)))
+    {
+        // Reserved addressing mode
+        return;
+    }
+
+    switch (frame_version)
+    {
+        case FRAME_VERSION_0:
+        case FRAME_VERSION_1:
+            offset           += DSN_SIZE;
+            dst_panid_present = (dst_addr_size != 0U);
+            src_panid_present = (src_addr_size != 0U) && !panid_compression;
+            break;
+
+        case FRAME_VERSION_2:
+            if (!(p_data[DSN_SUPPRESS_OFFSET] & DSN_SUPPRESS_BIT))
+            {
+                offset += DSN_SIZE;
+            }
+
+            if ((dst_addr_size == EXTENDED_ADDRESS_SIZE) &&
+                (src_addr_size == EXTENDED_ADDRESS_SIZE))
+            {
+                dst_panid_present = !panid_compression;
+                src_panid_present = false;
+            }
+            else if ((dst_addr_size != 0U) && (src_addr_size != 0U))
+            {
+                dst_panid_present = true;
+                src_panid_present = !panid_compression;
+            }
+            else if (src_addr_size != 0U)
+            {
+                dst_panid_present = false;
+                src_panid_present = !panid_compression;
+            }
+            else if (dst_addr_size != 0U)
+            {
+                dst_panid_present = !panid_compression;
+                src_panid_present = false;
+            }
+            else
+            {
+                dst_panid_present = panid_compression;
+                src_panid_present = false;
+            }
+            break;
+
+        default:
+            return;
+    }
+
+    if (dst_panid_present)
+    {
+        if ((offset + PAN_ID_SIZE) > psdu_len)
+        {
+            return;
+        }
+
+        p_fields->p_dst_pan_id = &p_psdu[offset];
+        offset                += PAN_ID_SIZE;
+    }
+
+    if (dst_addr_size != 0U)
+    {
+        if ((offset + dst_addr_size) > psdu_len)
+        {
+            return;
+        }
+
+        p_fields->p_dst_addr    = &p_psdu[offset];
+        p_fields->dst_addr_size = dst_addr_size;
+        offset                 += dst_addr_size;
+    }
+
+    offset += (src_panid_present ? PAN_ID_SIZE : 0U) + src_addr_size;
+
+    if ((p_fields->frame_type == FRAME_TYPE_COMMAND) &&
+        !(p_data[SECURITY_ENABLED_OFFSET] & SECURITY_ENABLED_BIT) &&
+        !((frame_version == FRAME_VERSION_2) &&
+          (p_data[IE_PRESENT_OFFSET] & IE_PRESENT_BIT)) &&
+        ((offset + MAC_CMD_COMMAND_ID_SIZE) <= psdu_len))
+    {
+        p_fields->p_cmd_id = &p_psdu[offset];
+    }
+}
+
+static bool rule_matches(const nrf_802154_ser_rx_filter_rule_t * p_rule,
+                         const rx_frame_fields_t               * p_fields)
+{
+    if ((p_rule->fields & NRF_802154_SER_RX_FILTER_FIELD_FRAME_TYPE) &&
+        (p_rule->frame_type != p_fields->frame_type))
+    {
+        return false;
+    }
+
+    if ((p_rule->fields & NRF_802154_SER_RX_FILTER_FIELD_DST_PAN_ID) &&
+        ((p_fields->p_dst_pan_id == NULL) ||
+         (memcmp(p_rule->dst_pan_id, p_fields->p_dst_pan_id, PAN_ID_SIZE) != 0)))
+    {
+        return false;
+    }
+
+    if (p_rule->fields & NRF_802154_SER_RX_FILTER_FIELD_DST_ADDR)
+    {
+        uint8_t addr_size = p_rule->dst_addr_extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+
+        if ((p_fields->dst_addr_size != addr_size) ||
+            (memcmp(p_rule->dst_addr, p_fields->p_dst_addr, addr_size) != 0))
+        {
+            return false;
+        }
+    }
+
+    if ((p_rule->fields & NRF_802154_SER_RX_FILTER_FIELD_CMD_ID) &&
+        ((p_fields->p_cmd_id == NULL) || (*p_fields->p_cmd_id != p_rule->cmd_id)))
+    {
+        return false;
+    }
+
+    return true;
+}
+
+bool nrf_802154_spinel_rx_filter_rule_add(const nrf_802154_ser_rx_filter_rule_t * p_rule)
+{
+    uint8_t rules_num = m_rules_num;
+
+    if (rules_num >= NRF_802154_SER_RX_FILTER_RULES)
+    {
+        return false;
+    }
+
+    m_rules[rules_num] = *p_rule;
+    m_rules_num        = rules_num + 1U;
+
+    return true;
+}
+
+void nrf_802154_spinel_rx_filter_clear(void)
+{
+    m_rules_num = 0U;
+}
+
+bool nrf_802154_spinel_rx_filter_frame_passes(const uint8_t * p_data)
+{
+    uint8_t           rules_num = m_rules_num;
+    rx_frame_fields_t fields;
+
+    if (rules_num == 0U)
+    {
+        return true;
+    }
+
+    rx_frame_fields_get(p_data, &fields);
+
+    for (uint8_t i = 0; i < rules_num; i++)
+    {
+        if (rule_matches(&m_rules[i], &fields))
+        {
+            return m_rules[i].action != NRF_802154_SER_RX_FILTER_ACTION_DROP;
+        }
+    }
+
+    return true;
+}
+
+#endif // NRF_802154_SER_RX_FILTER_ENABLED
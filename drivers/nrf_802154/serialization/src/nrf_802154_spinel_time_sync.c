@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file nrf_802154_spinel_time_sync.c
+ * @brief Synchronization of the radio time to the local time of the application core.
+ */
+
+#include "nrf_802154_spinel_time_sync.h"
+
+#if NRF_802154_SER_TIME_SYNC_ENABLED
+
+#include "nrf_802154_serialization_crit_sect.h"
+#include "nrf_802154_spinel_local_time.h"
+
+/** @brief Number of parts per billion in a unit. */
+#define PPB_PER_UNIT  1000000000LL
+
+/** @brief Maximum absolute drift in parts per billion accepted between the time bases. */
+#define DRIFT_MAX_PPB 200000LL
+
+/** @brief Estimate of the radio time. */
+typedef struct
+{
+    uint64_t local;     ///< Local time of the reference sample.
+    uint64_t radio;     ///< Radio time of the reference sample.
+    int64_t  drift_ppb; ///< Rate of the radio time relative to the local time, minus one.
+    bool     valid;     ///< Indicates if the estimate is valid.
+} time_sync_estimate_t;
+
+static time_sync_estimate_t m_estimate; ///< Current estimate.
+
+/**
+ * @brief Gets a copy of the current estimate if it is fresh.
+ *
+ * @param[out] p_estimate  Copy of the current estimate.
+ *
+ * @retval true   The estimate is valid and younger than @ref NRF_802154_SER_TIME_SYNC_PERIOD_US.
+ * @retval false  There is no such estimate.
+ */
+static bool estimate_get(time_sync_estimate_t * p_estimate)
+{
+    uint32_t crit_sect = 0UL;
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    *p_estimate = m_estimate;
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    return p_estimate->valid &&
+           ((nrf_802154_spinel_local_time_get() - p_estimate->local) <
+            NRF_802154_SER_TIME_SYNC_PERIOD_US);
+}
+
+/**
+ * @brief Calculates the correction of an interval caused by the drift.
+ *
+ * @param[in]  interval   Interval measured in either time base.
+ * @param[in]  drift_ppb  Drift of the radio time relative to the local time.
+ *
+ * @returns  Number of microseconds by which the radio time advances more than the local time.
+ */
+static int64_t drift_correction(int64_t interval, int64_t drift_ppb)
+{
+    return (interval * drift_ppb) / PPB_PER_UNIT;
+}
+
+void nrf_802154_spinel_time_sync_init(void)
+{
+    m_estimate.valid = false;
+}
+
+bool nrf_802154_spinel_time_sync_sample_add(uint64_t local_sent,
+                                            uint64_t radio_time,
+                                            uint64_t local_received)
+{
+    uint32_t crit_sect = 0UL;
+    uint64_t rtt       = local_received - local_sent;
+    uint64_t local     = local_sent + (rtt / 2U);
+
+    if ((local_received < local_sent) || (rtt > NRF_802154_SER_TIME_SYNC_MAX_RTT_US))
+    {
+        return false;
+    }
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    if (m_estimate.valid && (local > m_estimate.local))
+    {
+        uint64_t local_elapsed = local - m_estimate.local;
+
+        // A short baseline would amplify the error of the samples
+        if (local_elapsed >= (NRF_802154_SER_TIME_SYNC_PERIOD_US / 2U))
+        {
+            int64_t error     = (int64_t)(radio_time - m_estimate.radio) - (int64_t)local_elapsed;
+            int64_t drift_ppb = (error * PPB_PER_UNIT) / (int64_t)local_elapsed;
+
+            if (drift_ppb > DRIFT_MAX_PPB)
+            {
+                drift_ppb = DRIFT_MAX_PPB;
+            }
+            else if (drift_ppb < -DRIFT_MAX_PPB)
+            {
+                drift_ppb = -DRIFT_MAX_PPB;
+            }
+
+            m_estimate.drift_ppb = drift_ppb;
+        }
+    }
+    else
+    {
+        m_estimate.drift_ppb = 0;
+    }
+
+    m_estimate.local = local;
+    m_estimate.radio = radio_time;
+    m_estimate.valid = true;
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    return true;
+}
+
+bool nrf_802154_spinel_time_sync_to_radio(uint64_t local_time, uint64_t * p_radio_time)
+{
+    time_sync_estimate_t estimate;
+
+    if (!estimate_get(&estimate))
+    {
+        return false;
+    }
+
+    int64_t elapsed = (int64_t)(local_time - estimate.local);
+
+    *p_radio_time = estimate.radio + (uint64_t)(elapsed +
+                                                drift_correction(elapsed, estimate.drift_ppb));
+
+    return true;
+}
+
+bool nrf_802154_spinel_time_sync_to_local(uint64_t radio_time, uint64_t * p_local_time)
+{
+    time_sync_estimate_t estimate;
+
+    if (!estimate_get(&estimate))
+    {
+        return false;
+    }
+
+    int64_t elapsed = (int64_t)(radio_time - estimate.radio);
+
+    *p_local_time = estimate.local + (uint64_t)(elapsed -
+                                                drift_correction(elapsed, estimate.drift_ppb));
+
+    return true;
+}
+
+#endif // NRF_802154_SER_TIME_SYNC_ENABLED
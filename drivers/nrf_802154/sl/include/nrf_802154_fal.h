@@ -56,6 +56,57 @@ typedef struct
     mpsl_fem_gain_t fem;            // !< Data needed to set the FEM gain
 } nrf_802154_fal_tx_power_split_t;
 
+/**
+ * @brief Radio operations with separate FEM timing profiles.
+ */
+typedef enum
+{
+    NRF_802154_FAL_OPERATION_RX,     // !< Frame reception and energy detection.
+    NRF_802154_FAL_OPERATION_TX,     // !< Frame transmission without CCA.
+    NRF_802154_FAL_OPERATION_ACK_TX, // !< ACK transmission.
+    NRF_802154_FAL_OPERATION_CCA,    // !< CCA, standalone or preceding a transmission.
+    NRF_802154_FAL_OPERATION_COUNT   // !< Number of operations.
+} nrf_802154_fal_operation_t;
+
+/**
+ * @brief FEM timing profile of a radio operation.
+ */
+typedef struct
+{
+    int32_t ready_offset_us; // !< Offset of the moment the PA or LNA must be ready, relative to the end of the RADIO ramp up.
+} nrf_802154_fal_timing_profile_t;
+
+/** @brief Prepares the event activating the FEM on the TIMER that counts the RADIO ramp up.
+ *
+ * The event is prepared once per profile, so that only the TIMER compare values computed here
+ * need to be programmed when the operation starts.
+ *
+ * @param[out] p_event              Event to be passed to the FEM PA or LNA configuration.
+ * @param[in]  p_timer              TIMER instance counting the RADIO ramp up.
+ * @param[in]  compare_channel_mask Mask of the TIMER compare channels available to the FEM.
+ * @param[in]  ramp_up_end          TIMER value at which the RADIO ramp up ends.
+ * @param[in]  p_profile            FEM timing profile of the operation.
+ */
+static inline void nrf_802154_fal_timer_event_prepare(
+    mpsl_fem_event_t                      * p_event,
+    NRF_TIMER_Type                        * p_timer,
+    uint8_t                                 compare_channel_mask,
+    uint32_t                                ramp_up_end,
+    const nrf_802154_fal_timing_profile_t * p_profile)
+{
+    *p_event = (mpsl_fem_event_t){
+        .type        = MPSL_FEM_EVENT_TYPE_TIMER,
+        .event.timer =
+        {
+            .p_timer_instance     = p_timer,
+            .compare_channel_mask = compare_channel_mask,
+            .counter_period       = {
+                .end = (uint32_t)((int32_t)ramp_up_end + p_profile->ready_offset_us)
+            },
+        },
+    };
+}
+
 /** @brief Splits transmit power value into components to be applied on each stage on the transmit path.
  *
  * @note This is a stub implementation used when MPSL is not linked.
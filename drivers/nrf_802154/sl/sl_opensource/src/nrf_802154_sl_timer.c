@@ -42,10 +42,77 @@
 
 #include "nrf_802154_sl_timer.h"
 
+/**@brief Private fields of a timer placed in @ref nrf_802154_sl_timer_t::priv. */
+typedef struct
+{
+    nrf_802154_sl_timer_t * p_next; ///< Next timer in the active timers list.
+    bool                    active; ///< If the timer is in the active timers list.
+} timer_priv_t;
+
+_Static_assert(sizeof(timer_priv_t) <= sizeof(nrf_802154_sl_timer_priv_placeholder_t),
+               "Private fields of the timer do not fit in the placeholder");
+
 static void timeout_handler(struct k_timer * timer_id);
 
+/* All the timers share a single kernel timer that is always armed for the earliest of them,
+ * so that the kernel keeps track of one timeout regardless of the number of active timers.
+ */
 K_TIMER_DEFINE(timer, timeout_handler, NULL);
 
+static nrf_802154_sl_timer_t * mp_head; ///< Active timers sorted by trigger time.
+
+static timer_priv_t * priv_get(nrf_802154_sl_timer_t * p_timer)
+{
+    return (timer_priv_t *)&p_timer->priv;
+}
+
+/**@brief Arms the kernel timer for the earliest active timer or stops it if there is none.
+ *
+ * Must be called with interrupts locked.
+ */
+static void kernel_timer_rearm(void)
+{
+    if (mp_head == NULL)
+    {
+        k_timer_stop(&timer);
+        return;
+    }
+
+    uint64_t now   = nrf_802154_sl_timer_current_time_get();
+    uint64_t delta = (mp_head->trigger_time > now) ? (mp_head->trigger_time - now) : 1U;
+
+    k_timer_start(&timer, K_USEC(delta), K_NO_WAIT);
+}
+
+/**@brief Unlinks a timer from the active timers list.
+ *
+ * Must be called with interrupts locked.
+ *
+ * @retval true   The timer was active and has been removed.
+ * @retval false  The timer was not active.
+ */
+static bool timer_unlink(nrf_802154_sl_timer_t * p_timer)
+{
+    if (!priv_get(p_timer)->active)
+    {
+        return false;
+    }
+
+    nrf_802154_sl_timer_t ** pp_link = &mp_head;
+
+    while (*pp_link != p_timer)
+    {
+        assert(*pp_link != NULL);
+        pp_link = &priv_get(*pp_link)->p_next;
+    }
+
+    *pp_link                  = priv_get(p_timer)->p_next;
+    priv_get(p_timer)->p_next = NULL;
+    priv_get(p_timer)->active = false;
+
+    return true;
+}
+
 void nrf_802154_timer_coord_init(void)
 {
     // Intentionally empty
@@ -68,12 +135,17 @@ void nrf_802154_timer_coord_stop(void)
 
 void nrf_802154_sl_timer_module_init(void)
 {
-    // Intentionally empty
+    mp_head = NULL;
 }
 
 void nrf_802154_sl_timer_module_uninit(void)
 {
-    // Intentionally empty
+    unsigned int key = irq_lock();
+
+    k_timer_stop(&timer);
+    mp_head = NULL;
+
+    irq_unlock(key);
 }
 
 uint64_t nrf_802154_sl_timer_current_time_get(void)
@@ -85,58 +157,91 @@ uint64_t nrf_802154_sl_timer_current_time_get(void)
 
 void nrf_802154_sl_timer_init(nrf_802154_sl_timer_t * p_timer)
 {
-    // Intentionally empty
+    priv_get(p_timer)->p_next = NULL;
+    priv_get(p_timer)->active = false;
 }
 
 void nrf_802154_sl_timer_deinit(nrf_802154_sl_timer_t * p_timer)
 {
-    // Intentionally empty
+    (void)nrf_802154_sl_timer_remove(p_timer);
 }
 
 nrf_802154_sl_timer_ret_t nrf_802154_sl_timer_add(nrf_802154_sl_timer_t * p_timer)
 {
-    uint64_t now    = nrf_802154_sl_timer_current_time_get();
-    int32_t  target = p_timer->trigger_time - now;
+    unsigned int key = irq_lock();
+
+    (void)timer_unlink(p_timer);
+
+    // Timers with equal trigger times fire in the order in which they were added.
+    nrf_802154_sl_timer_t ** pp_link = &mp_head;
+
+    while ((*pp_link != NULL) && ((*pp_link)->trigger_time <= p_timer->trigger_time))
+    {
+        pp_link = &priv_get(*pp_link)->p_next;
+    }
 
-    target = MAX(target, 1);
+    priv_get(p_timer)->p_next = *pp_link;
+    priv_get(p_timer)->active = true;
+    *pp_link                  = p_timer;
 
-    k_timer_user_data_set(&timer, p_timer); // Passing arguments is not supported.
-    k_timer_start(&timer, K_USEC(target), K_NO_WAIT);
+    if (mp_head == p_timer)
+    {
+        kernel_timer_rearm();
+    }
+
+    irq_unlock(key);
 
     return NRF_802154_SL_TIMER_RET_SUCCESS;
 }
 
 nrf_802154_sl_timer_ret_t nrf_802154_sl_timer_remove(nrf_802154_sl_timer_t * p_timer)
 {
-    nrf_802154_sl_timer_ret_t ret;
+    nrf_802154_sl_timer_ret_t ret      = NRF_802154_SL_TIMER_RET_INACTIVE;
+    unsigned int              key      = irq_lock();
+    bool                      was_head = (mp_head == p_timer);
 
-    if (k_timer_status_get(&timer) > 0)
-    {
-        /* Timer has expired. */
-        ret = NRF_802154_SL_TIMER_RET_INACTIVE;
-    }
-    else if (k_timer_remaining_get(&timer) == 0)
-    {
-        /* Timer was stopped (by someone else) before expiring. */
-        ret = NRF_802154_SL_TIMER_RET_INACTIVE;
-    }
-    else
+    if (timer_unlink(p_timer))
     {
-        /* Timer is still running. */
-        k_timer_stop(&timer);
+        if (was_head)
+        {
+            kernel_timer_rearm();
+        }
 
         ret = NRF_802154_SL_TIMER_RET_SUCCESS;
     }
 
+    irq_unlock(key);
+
     return ret;
 }
 
 static void timeout_handler(struct k_timer * timer_id)
 {
-    nrf_802154_sl_timer_t * p_timer =
-        (nrf_802154_sl_timer_t *)k_timer_user_data_get(timer_id);
+    (void)timer_id;
+
+    while (true)
+    {
+        unsigned int            key     = irq_lock();
+        nrf_802154_sl_timer_t * p_timer = mp_head;
 
-    p_timer->action.callback.callback(p_timer);
+        if ((p_timer == NULL) ||
+            (p_timer->trigger_time > nrf_802154_sl_timer_current_time_get()))
+        {
+            // No more expired timers. Wait for the next one.
+            kernel_timer_rearm();
+            irq_unlock(key);
+            break;
+        }
+
+        (void)timer_unlink(p_timer);
+        irq_unlock(key);
+
+        // The timer is no longer owned by the module, so the callback may add it again.
+        if (p_timer->action_type & NRF_802154_SL_TIMER_ACTION_TYPE_CALLBACK)
+        {
+            p_timer->action.callback.callback(p_timer);
+        }
+    }
 }
 
 void nrf_802154_platform_sl_lp_timer_init(void)
@@ -0,0 +1,16 @@
+/**
+ *
+ * @defgroup nrfx_cache_config CACHE peripheral driver configuration
+ * @{
+ * @ingroup nrfx_cache
+ */
+/** @brief Enable CACHE driver.
+ *
+ *  Set to 1 to activate.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_CACHE_ENABLED
+
+
+/** @} */
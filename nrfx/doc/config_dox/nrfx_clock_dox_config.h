@@ -31,6 +31,34 @@
  */
 #define NRFX_CLOCK_CONFIG_LF_CAL_ENABLED
 
+/** @brief Temperature change that triggers adaptive calibration, in 0.01 degrees Celsius.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_CLOCK_CONFIG_LF_CAL_TEMP_THRESHOLD
+
+/** @brief Maximum number of consecutive calibrations skipped by adaptive calibration.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_CLOCK_CONFIG_LF_CAL_MAX_SKIP
+
+/** @brief Enables reference-counted HFCLK requests.
+ *
+ *  Set to 1 to activate.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_CLOCK_CONFIG_HFCLK_REQUEST_ENABLED
+
+/** @brief Initial HFCLK startup time estimate in microseconds.
+ *
+ *  Used until the startup time has been measured.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_CLOCK_CONFIG_HFCLK_STARTUP_TIME_US
+
 /** @brief Interrupt priority
  *
  *  Following options are available:
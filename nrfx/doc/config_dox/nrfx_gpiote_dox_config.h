@@ -19,6 +19,31 @@
  */
 #define NRFX_GPIOTE_CONFIG_NUM_OF_LOW_POWER_EVENTS
 
+/** @brief Number of pin group handlers
+ *
+ *  Groups dispatch pins of one port that trigger together with a single
+ *  handler call. Set to 0 to disable.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_GPIOTE_CONFIG_NUM_OF_GROUP_HANDLERS
+
+/** @brief Enable the callback reporting all pins of a port triggered by a PORT event at once.
+ *
+ *  Set to 1 to activate.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_GPIOTE_CONFIG_PORT_CALLBACK_ENABLED
+
+/** @brief Enable debouncing of input pins with a TIMER instance and a (D)PPI channel.
+ *
+ *  Set to 1 to activate.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_GPIOTE_CONFIG_DEBOUNCE_ENABLED
+
 /** @brief Interrupt priority
  *
  *  Following options are available:
@@ -28,6 +28,14 @@
  */
 #define NRFX_I2S_CONFIG_IRQ_PRIORITY
 
+/** @brief Enable the ring-buffer streaming mode.
+ *
+ *  Set to 1 to activate.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_I2S_CONFIG_RING_ENABLED
+
 /** @brief Enables logging in the module.
  *
  *  Set to 1 to activate.
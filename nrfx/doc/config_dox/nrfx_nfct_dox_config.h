@@ -28,6 +28,14 @@
  */
 #define NRFX_NFCT_CONFIG_IRQ_PRIORITY
 
+/** @brief Enables the automatic responses and the RX buffer ring.
+ *
+ *  Set to 1 to activate.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_NFCT_CONFIG_AUTORESPONSE_ENABLED
+
 /** @brief Enables logging in the module.
  *
  *  Set to 1 to activate.
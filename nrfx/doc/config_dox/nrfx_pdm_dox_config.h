@@ -28,6 +28,22 @@
  */
 #define NRFX_PDM_CONFIG_IRQ_PRIORITY
 
+/** @brief Size of the driver queue of sample buffers.
+ *
+ *  Set to 0 to disable the queue.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_PDM_CONFIG_BUFFER_QUEUE_SIZE
+
+/** @brief Enable the software decimation and gain stage.
+ *
+ *  Set to 1 to activate.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_PDM_CONFIG_POSTPROC_ENABLED
+
 /** @brief Enables logging in the module.
  *
  *  Set to 1 to activate.
@@ -48,5 +48,21 @@
  */
 #define NRFX_POWER_CONFIG_DEFAULT_DCDCENHV
 
+/** @brief Enable sleep-state residency accounting
+ *
+ *  Set to 1 to activate.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_POWER_CONFIG_RESIDENCY_ENABLED
+
+/** @brief Number of wake-up sources counted by the residency accounting
+ *
+ *  Integer value. Minimum: 1. Maximum: 32.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_POWER_CONFIG_RESIDENCY_WAKEUP_SOURCES
+
 
 /** @} */
@@ -60,6 +60,14 @@
  */
 #define NRFX_PWM_DEFAULT_CONFIG_IRQ_PRIORITY
 
+/** @brief Enable streaming of duty cycle values from a circular buffer.
+ *
+ *  Set to 1 to activate.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_PWM_CONFIG_STREAM_ENABLED
+
 /** @brief Enables logging in the module.
  *
  *  Set to 1 to activate.
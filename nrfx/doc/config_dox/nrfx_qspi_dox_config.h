@@ -28,5 +28,54 @@
  */
 #define NRFX_QSPI_CONFIG_IRQ_PRIORITY
 
+/** @brief Number of requests that can be queued with nrfx_qspi_request_queue().
+ *
+ *  Set to 0 to disable the request queue.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_QSPI_CONFIG_QUEUE_SIZE
+
+/** @brief Size in bytes of the driver-owned cache used for sequential read-ahead.
+ *
+ *  Must be a multiple of 4. Used only with the request queue.
+ *  Set to 0 to disable read-ahead.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_QSPI_CONFIG_READ_AHEAD_SIZE
+
+/** @brief Enable reading with suspension of the ongoing erase or program operation.
+ *
+ *  Set to 1 to activate.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_QSPI_CONFIG_SUSPEND_ENABLED
+
+/** @brief Operation code of the erase/program suspend instruction.
+ *
+ *  Integer value. Minimum: 0. Maximum: 255.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_QSPI_CONFIG_SUSPEND_OPCODE
+
+/** @brief Operation code of the erase/program resume instruction.
+ *
+ *  Integer value. Minimum: 0. Maximum: 255.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_QSPI_CONFIG_RESUME_OPCODE
+
+/** @brief Enable XIP cache profiling and prefetch helpers (requires the CACHE driver).
+ *
+ *  Set to 1 to activate.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_QSPI_CONFIG_XIP_CACHE_ENABLED
+
 
 /** @} */
@@ -28,6 +28,14 @@
  */
 #define NRFX_RNG_CONFIG_IRQ_PRIORITY
 
+/** @brief Enables the entropy pool mode.
+ *
+ *  Set to 1 to activate.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_RNG_CONFIG_POOL_ENABLED
+
 /** @brief Enables logging in the module.
  *
  *  Set to 1 to activate.
@@ -49,6 +49,30 @@
  */
 #define NRFX_SAADC_CONFIG_LOG_LEVEL
 
+/** @brief Enables continuous conversion into a ring of buffers supplied up front.
+ *
+ *  Set to 1 to activate.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_SAADC_CONFIG_BUFFER_RING_ENABLED
+
+/** @brief Enables in-place processing of filled buffers before they are reported.
+ *
+ *  Set to 1 to activate.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_SAADC_CONFIG_PROCESS_HANDLER_ENABLED
+
+/** @brief Enables TIMER timestamps of the buffer start in the done event.
+ *
+ *  Set to 1 to activate.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_SAADC_CONFIG_TIMESTAMP_ENABLED
+
 /** @brief ANSI escape code prefix.
  *
  *  Following options are available:
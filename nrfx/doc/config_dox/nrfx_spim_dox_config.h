@@ -89,6 +89,22 @@
  */
 #define NRFX_SPIM_CONFIG_LOG_LEVEL
 
+/** @brief Enables transfer lists with per-transfer Slave Select, frequency, and mode.
+ *
+ *  Set to 1 to activate.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_SPIM_CONFIG_XFER_LIST_ENABLED
+
+/** @brief Enables streaming of periodic transfers into a ring of blocks using EasyDMA ArrayList.
+ *
+ *  Set to 1 to activate. Available only on SoCs supporting EasyDMA ArrayList.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_SPIM_CONFIG_STREAM_ENABLED
+
 /** @brief ANSI escape code prefix.
  *
  *  Following options are available:
@@ -65,6 +65,22 @@
  */
 #define NRFX_TWIM_CONFIG_LOG_LEVEL
 
+/** @brief Enables transactions built of an arbitrary list of write and read messages.
+ *
+ *  Set to 1 to activate.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_TWIM_CONFIG_MSG_LIST_ENABLED
+
+/** @brief Enables periodic transfers triggered by a TIMER, received into a ring of buffers.
+ *
+ *  Set to 1 to activate.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_TWIM_CONFIG_STREAM_ENABLED
+
 /** @brief ANSI escape code prefix.
  *
  *  Following options are available:
@@ -63,6 +63,31 @@
  */
 #define NRFX_UARTE_CONFIG_LOG_LEVEL
 
+/** @brief Enables continuous reception into a ring of buffers with hardware byte counting.
+ *
+ *  Set to 1 to activate.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_UARTE_CONFIG_RX_RING_ENABLED
+
+/** @brief Enables transmission of a scatter-gather list of buffers back-to-back.
+ *
+ *  Set to 1 to activate.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_UARTE_CONFIG_TX_LIST_ENABLED
+
+/** @brief Size of the driver-managed buffer used to send data that EasyDMA cannot access.
+ *
+ *  Data outside RAM, for example constant strings in flash, is copied in chunks
+ *  of half of this size. Set to 0 to reject such data with NRFX_ERROR_INVALID_ADDR.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_UARTE_CONFIG_TX_BOUNCE_SIZE
+
 /** @brief ANSI escape code prefix.
  *
  *  Following options are available:
@@ -41,6 +41,25 @@
  */
 #define NRFX_USBD_CONFIG_DMASCHEDULER_ISO_BOOST
 
+/** @brief EasyDMA scheduling mode.
+ *
+ *  Following options are available:
+ * - 0 - Prioritized (the endpoint with the lowest number is served first)
+ * - 1 - Round robin (the control endpoint is served first, other endpoints in turns)
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_USBD_CONFIG_DMASCHEDULER_MODE
+
+/** @brief Maximum number of EasyDMA transfers started in a single interrupt.
+ *
+ *  Values greater than 1 let the driver serve several endpoints without
+ *  additional interrupts.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_USBD_CONFIG_DMASCHEDULER_BATCH_SIZE
+
 /** @brief Respond to an IN token on ISO IN endpoint with ZLP when no data is ready
  *
  * If set, ISO IN endpoint will respond to an IN token with ZLP when no data is ready to be sent.
@@ -52,5 +71,13 @@
  */
 #define NRFX_USBD_CONFIG_ISO_IN_ZLP
 
+/** @brief Maximum number of buffers in the ring of an isochronous stream.
+ *
+ *  Set to 0 to disable the isochronous streaming API.
+ *
+ * @note This is an NRF_CONFIG macro.
+ */
+#define NRFX_USBD_CONFIG_ISO_STREAM_MAX_BUFFERS
+
 
 /** @} */
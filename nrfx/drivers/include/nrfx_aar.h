@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_AAR_H__
+#define NRFX_AAR_H__
+
+#include <nrfx.h>
+#include <hal/nrf_aar.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_aar AAR driver
+ * @{
+ * @ingroup nrf_aar
+ * @brief   Accelerated Address Resolver (AAR) peripheral driver.
+ *
+ * The driver resolves a resolvable private address against a table of Identity
+ * Resolving Keys (IRK). The peripheral checks up to @ref NRFX_AAR_IRKS_PER_RUN keys
+ * in one run, and larger tables are split by the driver into consecutive runs.
+ *
+ * @note AAR and CCM share the ENABLE register, so the AAR driver enables the peripheral
+ *       only for the time of the resolution. It must not be used while the CCM driver
+ *       has a transfer set up.
+ */
+
+/** @brief Size of one IRK in bytes. */
+#define NRFX_AAR_IRK_SIZE 16
+
+/** @brief Maximum number of IRKs checked by the peripheral in one run. */
+#define NRFX_AAR_IRKS_PER_RUN 16
+
+/** @brief IRK index reported when the address is not resolved. */
+#define NRFX_AAR_IRK_INDEX_NONE UINT16_MAX
+
+/** @brief Structure for AAR configuration. */
+typedef struct
+{
+    uint8_t interrupt_priority; ///< Interrupt priority.
+} nrfx_aar_config_t;
+
+/** @brief AAR default configuration. */
+#define NRFX_AAR_DEFAULT_CONFIG                                         \
+{                                                                       \
+    .interrupt_priority = NRFX_AAR_DEFAULT_CONFIG_IRQ_PRIORITY,         \
+}
+
+/** @brief Structure describing an address resolution. */
+typedef struct
+{
+    uint8_t const * p_irks;    ///< IRK table, @ref NRFX_AAR_IRK_SIZE bytes per key. Must be in RAM.
+    uint16_t        irk_count; ///< Number of IRKs in the table. Must not be 0.
+    uint8_t const * p_addr;    ///< 6-byte address to resolve. Must be in RAM.
+    uint32_t        start_eep; ///< Address of the event starting the resolution, for example
+                               ///< RADIO END. 0 to start by software.
+} nrfx_aar_job_t;
+
+/**
+ * @brief AAR driver event handler type.
+ *
+ * @param[in] irk_index Index of the matching IRK in the table,
+ *                      or @ref NRFX_AAR_IRK_INDEX_NONE if the address is not resolved.
+ * @param[in] p_context User context.
+ */
+typedef void (* nrfx_aar_handler_t)(uint16_t irk_index, void * p_context);
+
+/**
+ * @brief Function for initializing the AAR driver.
+ *
+ * @param[in] p_config  Pointer to the structure with the initial configuration.
+ * @param[in] handler   Event handler provided by the user. If NULL, the driver works
+ *                      in blocking mode, and resolutions started by events cannot be used.
+ * @param[in] p_context User context passed to the event handler.
+ *
+ * @retval NRFX_SUCCESS                   Driver was successfully initialized.
+ * @retval NRFX_ERROR_ALREADY_INITIALIZED Driver was already initialized.
+ */
+nrfx_err_t nrfx_aar_init(nrfx_aar_config_t const * p_config,
+                         nrfx_aar_handler_t        handler,
+                         void *                    p_context);
+
+/** @brief Function for uninitializing the AAR driver. */
+void nrfx_aar_uninit(void);
+
+/**
+ * @brief Function for resolving an address.
+ *
+ * If @ref nrfx_aar_job_t::start_eep is set, the first run starts on that event, through
+ * a (D)PPI channel allocated by the driver at the first use and kept until the driver
+ * is uninitialized. Following runs, when the table has more than @ref NRFX_AAR_IRKS_PER_RUN
+ * keys, are started by the driver from the interrupt handler.
+ *
+ * @note The job, the IRK table and the address must stay valid until the resolution ends.
+ *
+ * @param[in]  p_job       Pointer to the resolution descriptor.
+ * @param[out] p_irk_index In blocking mode, index of the matching IRK,
+ *                         or @ref NRFX_AAR_IRK_INDEX_NONE. Not used in non-blocking mode.
+ *
+ * @retval NRFX_SUCCESS             In non-blocking mode, the resolution is started.
+ *                                  In blocking mode, the resolution is completed.
+ * @retval NRFX_ERROR_BUSY          A resolution is in progress.
+ * @retval NRFX_ERROR_INVALID_ADDR  The IRK table or the address is not in RAM.
+ * @retval NRFX_ERROR_NO_MEM        No (D)PPI channel is available.
+ * @retval NRFX_ERROR_NOT_SUPPORTED The (D)PPI driver is not enabled.
+ */
+nrfx_err_t nrfx_aar_resolve(nrfx_aar_job_t const * p_job, uint16_t * p_irk_index);
+
+/** @brief Function for aborting the ongoing resolution. No event is generated. */
+void nrfx_aar_stop(void);
+
+/** @} */
+
+void nrfx_aar_irq_handler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_AAR_H__
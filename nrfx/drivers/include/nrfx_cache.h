@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_CACHE_H__
+#define NRFX_CACHE_H__
+
+#include <nrfx.h>
+#include <hal/nrf_cache.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_cache CACHE driver
+ * @{
+ * @ingroup nrf_cache
+ * @brief   Instruction and data cache (CACHE) peripheral driver.
+ */
+
+/** @brief Structure for holding the profiling counters of one cache region. */
+typedef struct
+{
+    uint32_t instruction_hits;   ///< Number of instruction fetch cache hits.
+    uint32_t instruction_misses; ///< Number of instruction fetch cache misses.
+    uint32_t data_hits;          ///< Number of data fetch cache hits.
+    uint32_t data_misses;        ///< Number of data fetch cache misses.
+} nrfx_cache_profile_t;
+
+/** @brief Function for enabling the cache. */
+void nrfx_cache_enable(void);
+
+/**
+ * @brief Function for disabling the cache.
+ *
+ * The update lock is released, so that the cache is refilled normally
+ * after it is enabled again.
+ */
+void nrfx_cache_disable(void);
+
+/**
+ * @brief Function for invalidating the whole cache.
+ *
+ * The update lock is released, because locking an invalidated cache would
+ * make all further accesses miss.
+ */
+void nrfx_cache_invalidate(void);
+
+/**
+ * @brief Function for clearing the profiling counters and starting the profiling.
+ *
+ * Profiling counts instruction and data fetches separately for the flash
+ * and the XIP regions. Profiling increases the power consumption of the cache,
+ * so it must be stopped with @ref nrfx_cache_profiling_stop when the measurement
+ * is finished.
+ */
+void nrfx_cache_profiling_start(void);
+
+/**
+ * @brief Function for stopping the profiling.
+ *
+ * The counters keep their values and can still be read with @ref nrfx_cache_profile_get.
+ */
+void nrfx_cache_profiling_stop(void);
+
+/**
+ * @brief Function for reading the profiling counters of the specified cache region.
+ *
+ * @param[in]  region    Cache region.
+ * @param[out] p_profile Pointer to the structure to be filled with the counter values.
+ */
+void nrfx_cache_profile_get(nrf_cache_region_t region, nrfx_cache_profile_t * p_profile);
+
+/**
+ * @brief Function for getting the cache hit rate of the specified cache region.
+ *
+ * Instruction and data fetches are summed up.
+ *
+ * @param[in] region Cache region.
+ *
+ * @return Hit rate in parts per thousand, or 0 if no fetch was counted.
+ */
+uint32_t nrfx_cache_hit_rate_get(nrf_cache_region_t region);
+
+/**
+ * @brief Function for loading a memory range into the cache and locking the cache contents.
+ *
+ * The cache does not support locking of individual lines. Instead, the range is read
+ * word by word so that it is brought into the cache and then the cache update lock is set.
+ * From that moment, cache misses are served directly from memory and do not evict
+ * anything, so the locked range, typically a set of hot functions, stays cached.
+ *
+ * @note Only the last locked range is guaranteed to be in the cache, as loading a range
+ *       can evict lines loaded by a previous call. Place all hot functions in one
+ *       contiguous section and lock it with a single call.
+ * @note The range should not be larger than the cache, otherwise only a part of it
+ *       stays cached.
+ *
+ * @param[in] p_start Start of the memory range in the flash or the XIP region.
+ * @param[in] size    Size of the memory range in bytes.
+ */
+void nrfx_cache_range_lock(void const * p_start, size_t size);
+
+/** @brief Function for releasing the cache update lock set by @ref nrfx_cache_range_lock. */
+void nrfx_cache_unlock(void);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_CACHE_H__
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_CCM_H__
+#define NRFX_CCM_H__
+
+#include <nrfx.h>
+#include <hal/nrf_ccm.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_ccm CCM driver
+ * @{
+ * @ingroup nrf_ccm
+ * @brief   AES CCM mode encryption (CCM) peripheral driver.
+ *
+ * The driver encrypts and decrypts packets in the format used by the RADIO peripheral,
+ * that is a header, a length, an RFU byte, and a payload, using EasyDMA.
+ * The key-stream generation can be started by software or by an event, for example
+ * RADIO ADDRESS, connected by the driver through GPPI. In the latter case, the packet
+ * is decrypted on the fly, while it is received by the RADIO.
+ */
+
+/** @brief Structure for CCM configuration. */
+typedef struct
+{
+    nrf_ccm_config_t hal;                ///< Mode of operation, data rate and packet length.
+    uint8_t          interrupt_priority; ///< Interrupt priority.
+} nrfx_ccm_config_t;
+
+/**
+ * @brief CCM default configuration.
+ *
+ * This configuration sets up CCM with the following options:
+ * - encryption mode
+ * - 1 Mbps data rate
+ * - default packet length
+ */
+#define NRFX_CCM_DEFAULT_CONFIG                                         \
+{                                                                       \
+    .hal                = { .mode = NRF_CCM_MODE_ENCRYPTION },          \
+    .interrupt_priority = NRFX_CCM_DEFAULT_CONFIG_IRQ_PRIORITY,         \
+}
+
+/** @brief Structure describing a CCM transfer. */
+typedef struct
+{
+    nrf_ccm_cnf_t const * p_cnf;     ///< Key, packet counter and IV. Must be in RAM.
+    uint8_t const *       p_in;      ///< Input packet. Must be word-aligned and in RAM.
+    uint8_t *             p_out;     ///< Output packet. Must be word-aligned and in RAM.
+    uint32_t              ksgen_eep; ///< Address of the event starting the key-stream generation,
+                                     ///< for example RADIO ADDRESS. 0 to start by software.
+} nrfx_ccm_xfer_t;
+
+/** @brief CCM driver event types. */
+typedef enum
+{
+    NRFX_CCM_EVT_KSGEN_END, ///< Key-stream is generated by @ref nrfx_ccm_ksgen.
+    NRFX_CCM_EVT_CRYPT_END, ///< Packet is encrypted or decrypted.
+    NRFX_CCM_EVT_ERROR,     ///< Operation was aborted, for example because of RADIO timing.
+} nrfx_ccm_evt_type_t;
+
+/** @brief CCM driver event structure. */
+typedef struct
+{
+    nrfx_ccm_evt_type_t type;   ///< Event type.
+    bool                mic_ok; ///< True if the MIC check passed. Valid for decryption only.
+} nrfx_ccm_evt_t;
+
+/**
+ * @brief CCM driver event handler type.
+ *
+ * @param[in] p_event   Pointer to the event structure.
+ * @param[in] p_context User context.
+ */
+typedef void (* nrfx_ccm_event_handler_t)(nrfx_ccm_evt_t const * p_event, void * p_context);
+
+/**
+ * @brief Function for initializing the CCM driver.
+ *
+ * @param[in] p_config  Pointer to the structure with the initial configuration.
+ * @param[in] handler   Event handler provided by the user. If NULL, the driver works
+ *                      in blocking mode, and transfers started by events cannot be used.
+ * @param[in] p_context User context passed to the event handler.
+ *
+ * @retval NRFX_SUCCESS                   Driver was successfully initialized.
+ * @retval NRFX_ERROR_ALREADY_INITIALIZED Driver was already initialized.
+ */
+nrfx_err_t nrfx_ccm_init(nrfx_ccm_config_t const * p_config,
+                         nrfx_ccm_event_handler_t  handler,
+                         void *                    p_context);
+
+/**
+ * @brief Function for changing the CCM configuration.
+ *
+ * @param[in] p_config Pointer to the structure with the configuration.
+ *
+ * @retval NRFX_SUCCESS    Configuration was changed.
+ * @retval NRFX_ERROR_BUSY A transfer is in progress.
+ */
+nrfx_err_t nrfx_ccm_reconfigure(nrfx_ccm_config_t const * p_config);
+
+/** @brief Function for uninitializing the CCM driver. */
+void nrfx_ccm_uninit(void);
+
+/**
+ * @brief Function for encrypting or decrypting a packet.
+ *
+ * The key-stream generation is followed by the encryption or decryption through
+ * the ENDKSGEN-CRYPT shortcut. If @ref nrfx_ccm_xfer_t::ksgen_eep is set, the key-stream
+ * generation starts on that event, through a (D)PPI channel allocated by the driver
+ * at the first use and kept until the driver is uninitialized.
+ *
+ * @note On DPPI, the event is published on the driver channel for the time of the transfer.
+ *
+ * @param[in] p_xfer Pointer to the transfer descriptor.
+ *
+ * @retval NRFX_SUCCESS             In non-blocking mode, the transfer is started.
+ *                                  In blocking mode, the transfer is completed and,
+ *                                  when decrypting, the MIC check passed.
+ * @retval NRFX_ERROR_BUSY          A transfer is in progress.
+ * @retval NRFX_ERROR_INVALID_ADDR  Data or configuration is not in RAM or not aligned.
+ * @retval NRFX_ERROR_NO_MEM        No (D)PPI channel is available.
+ * @retval NRFX_ERROR_NOT_SUPPORTED The (D)PPI driver is not enabled.
+ * @retval NRFX_ERROR_INTERNAL      In blocking mode, the operation was aborted or,
+ *                                  when decrypting, the MIC check failed.
+ */
+nrfx_err_t nrfx_ccm_crypt(nrfx_ccm_xfer_t const * p_xfer);
+
+/**
+ * @brief Function for generating the key-stream in advance.
+ *
+ * The key-stream can be generated before the packet is available, and the encryption
+ * or decryption is started later by @ref nrfx_ccm_crypt_resume, with no key-stream
+ * generation latency. @ref nrfx_ccm_xfer_t::ksgen_eep is ignored.
+ *
+ * @param[in] p_xfer Pointer to the transfer descriptor.
+ *
+ * @retval NRFX_SUCCESS            In non-blocking mode, the generation is started.
+ *                                 In blocking mode, the key-stream is generated.
+ * @retval NRFX_ERROR_BUSY         A transfer is in progress.
+ * @retval NRFX_ERROR_INVALID_ADDR Data or configuration is not in RAM or not aligned.
+ */
+nrfx_err_t nrfx_ccm_ksgen(nrfx_ccm_xfer_t const * p_xfer);
+
+/**
+ * @brief Function for encrypting or decrypting with the key-stream generated
+ *        by @ref nrfx_ccm_ksgen.
+ *
+ * @retval NRFX_SUCCESS         In non-blocking mode, the transfer is started.
+ *                              In blocking mode, the transfer is completed and,
+ *                              when decrypting, the MIC check passed.
+ * @retval NRFX_ERROR_BUSY      A transfer is in progress.
+ * @retval NRFX_ERROR_FORBIDDEN No key-stream was generated.
+ * @retval NRFX_ERROR_INTERNAL  In blocking mode, the operation was aborted or,
+ *                              when decrypting, the MIC check failed.
+ */
+nrfx_err_t nrfx_ccm_crypt_resume(void);
+
+/** @brief Function for aborting the ongoing transfer. No event is generated. */
+void nrfx_ccm_stop(void);
+
+/**
+ * @brief Function for getting the address of a CCM task.
+ *
+ * It can be used to trigger the CRYPT task from an event of choice, instead of calling
+ * @ref nrfx_ccm_crypt_resume.
+ *
+ * @param[in] task CCM task.
+ *
+ * @return Task address.
+ */
+uint32_t nrfx_ccm_task_address_get(nrf_ccm_task_t task);
+
+/** @} */
+
+void nrfx_ccm_irq_handler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_CCM_H__
@@ -104,6 +104,100 @@ void nrfx_clock_start(nrf_clock_domain_t domain);
  */
 void nrfx_clock_stop(nrf_clock_domain_t domain);
 
+#if NRFX_CHECK(NRFX_CLOCK_CONFIG_HFCLK_REQUEST_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief HFCLK request callback.
+ *
+ * Called from the CLOCK interrupt once the HFCLK requested with
+ * @ref nrfx_clock_hfclk_request is running.
+ *
+ * @param[in] p_context Context passed in @ref nrfx_clock_hfclk_user_t.
+ */
+typedef void (*nrfx_clock_hfclk_cb_t)(void * p_context);
+
+/**
+ * @brief Function returning current time in microseconds.
+ *
+ * Used for measuring the HFCLK startup time. The returned value is allowed to wrap around.
+ */
+typedef uint32_t (*nrfx_clock_time_get_t)(void);
+
+/**
+ * @brief HFCLK user.
+ *
+ * Each module that needs the HFCLK owns one instance of this structure.
+ * The structure must remain valid until the request is released.
+ */
+typedef struct nrfx_clock_hfclk_user_s
+{
+    nrfx_clock_hfclk_cb_t            callback;  ///< Called when the HFCLK has started. Can be NULL.
+    void *                           p_context; ///< Context passed to @p callback.
+    struct nrfx_clock_hfclk_user_s * p_next;    ///< Internal list link. Do not modify.
+    bool                             requested; ///< Internal state. Do not modify.
+} nrfx_clock_hfclk_user_t;
+
+/**
+ * @brief Function for requesting the high-accuracy HFCLK.
+ *
+ * Requests are reference counted. The HFCLK is started by the first request and stopped
+ * when the last request is released. If the HFCLK is already running, the function returns
+ * true and the user callback is not called. Otherwise the callback is called from the CLOCK
+ * interrupt when the clock starts.
+ *
+ * @note Requests must not be mixed with @ref nrfx_clock_start and @ref nrfx_clock_stop
+ *       for the HFCLK domain.
+ *
+ * @param[in] p_user Pointer to the user. Must not be already requested.
+ *
+ * @retval true  The HFCLK is already running.
+ * @retval false The HFCLK is starting. The user callback will be called.
+ */
+bool nrfx_clock_hfclk_request(nrfx_clock_hfclk_user_t * p_user);
+
+/**
+ * @brief Function for releasing the HFCLK request.
+ *
+ * Releasing a request that is still waiting for the HFCLK cancels its callback.
+ * Releasing a user that has not been requested has no effect.
+ *
+ * @param[in] p_user Pointer to the user.
+ */
+void nrfx_clock_hfclk_release(nrfx_clock_hfclk_user_t * p_user);
+
+/**
+ * @brief Function for setting the time source used for measuring the HFCLK startup time.
+ *
+ * Without a time source the startup time is taken from
+ * @ref NRFX_CLOCK_CONFIG_HFCLK_STARTUP_TIME_US.
+ *
+ * @param[in] time_get Function returning time in microseconds. NULL to stop measuring.
+ */
+void nrfx_clock_hfclk_time_source_set(nrfx_clock_time_get_t time_get);
+
+/**
+ * @brief Function for getting the predicted HFCLK startup time.
+ *
+ * The prediction follows the longest measured startup and slowly decays towards
+ * shorter measurements, so a single fast startup does not make the next one late.
+ *
+ * @return Predicted startup time in microseconds.
+ */
+uint32_t nrfx_clock_hfclk_startup_time_get(void);
+
+/**
+ * @brief Function for getting the time at which the HFCLK must be requested.
+ *
+ * Used to get the HFCLK running at a specific time without turning it on too early.
+ * The caller schedules @ref nrfx_clock_hfclk_request at the returned time with its own timer.
+ *
+ * @param[in] need_time Time in microseconds, in the time source domain, at which
+ *                      the HFCLK must be running.
+ *
+ * @return Time in microseconds at which the request must be made.
+ */
+NRFX_STATIC_INLINE uint32_t nrfx_clock_hfclk_request_time_get(uint32_t need_time);
+#endif
+
 /**
  * @brief Function for checking the specified clock domain state.
  *
@@ -245,6 +339,32 @@ nrfx_err_t nrfx_clock_calibration_start(void);
  */
 nrfx_err_t nrfx_clock_is_calibrating(void);
 
+#if NRFX_CHECK(NRFX_CLOCK_CONFIG_LF_CAL_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Function for starting the calibration of internal LFCLK only if it is needed.
+ *
+ * Intended to be called on every calibration interval instead of
+ * @ref nrfx_clock_calibration_start, with the temperature measured
+ * by @ref nrfx_temp_measure and converted by @ref nrfx_temp_calculate.
+ * Calibration is skipped when the temperature differs less than
+ * @ref NRFX_CLOCK_CONFIG_LF_CAL_TEMP_THRESHOLD from the temperature during the last
+ * calibration, but not more than @ref NRFX_CLOCK_CONFIG_LF_CAL_MAX_SKIP times in a row.
+ *
+ * When @ref NRFX_CLOCK_CONFIG_HFCLK_REQUEST_ENABLED is set, the HFCLK is requested only for
+ * the duration of the calibration and does not need to be running when the function is called.
+ * Otherwise the same requirements as for @ref nrfx_clock_calibration_start apply.
+ *
+ * @param[in]  temperature Current temperature in 0.01 degrees Celsius.
+ * @param[out] p_started   Set to true if calibration was started and
+ *                         @ref NRFX_CLOCK_EVT_CAL_DONE will be generated.
+ *
+ * @retval NRFX_SUCCESS             Calibration was started or skipped.
+ * @retval NRFX_ERROR_INVALID_STATE The low-frequency or high-frequency clock is off.
+ * @retval NRFX_ERROR_BUSY          Clock is in the calibration phase.
+ */
+nrfx_err_t nrfx_clock_calibration_adaptive_start(int32_t temperature, bool * p_started);
+#endif
+
 /**
  * @brief Function for starting calibration timer.
  *
@@ -342,6 +462,13 @@ NRFX_STATIC_INLINE bool nrfx_clock_lfclk_is_running(void)
     return nrfx_clock_is_running(NRF_CLOCK_DOMAIN_LFCLK, NULL);
 }
 
+#if NRFX_CHECK(NRFX_CLOCK_CONFIG_HFCLK_REQUEST_ENABLED)
+NRFX_STATIC_INLINE uint32_t nrfx_clock_hfclk_request_time_get(uint32_t need_time)
+{
+    return need_time - nrfx_clock_hfclk_startup_time_get();
+}
+#endif
+
 #if NRF_CLOCK_HAS_HFCLKAUDIO
 
 NRFX_STATIC_INLINE void nrfx_clock_hfclkaudio_config_set(uint16_t freq_value)
@@ -55,7 +55,7 @@ void nrfx_dppi_free(void);
  * @brief Function for allocating a DPPI channel.
  * @details This function allocates the first unused DPPI channel.
  *
- * @note Function is thread safe as it uses @ref nrfx_flag32_alloc.
+ * @note Function is thread safe as it uses @ref nrfx_flag32_array_alloc.
  *
  * @param[out] p_channel Pointer to the DPPI channel number that has been allocated.
  *
@@ -69,7 +69,7 @@ nrfx_err_t nrfx_dppi_channel_alloc(uint8_t * p_channel);
  * @details This function also disables the chosen channel. Configuration in
  *          PUBLISH/SUBSCRIBE registers used for the channel is not cleared.
  *
- * @note Function is thread safe as it uses @ref nrfx_flag32_free.
+ * @note Function is thread safe as it uses @ref nrfx_flag32_array_free.
  *
  * @param[in] channel DPPI channel to be freed.
  *
@@ -78,6 +78,36 @@ nrfx_err_t nrfx_dppi_channel_alloc(uint8_t * p_channel);
  */
 nrfx_err_t nrfx_dppi_channel_free(uint8_t channel);
 
+/**
+ * @brief Function for allocating a range of consecutive DPPI channels.
+ * @details Consecutive channels form a contiguous mask, which can be passed at once
+ *          to functions operating on channel masks, e.g. to include the channels
+ *          in a channel group.
+ *
+ * @note Function is thread safe as it uses @ref nrfx_flag32_array_range_alloc.
+ *
+ * @param[in]  count   Number of channels to allocate.
+ * @param[out] p_first Pointer to the first DPPI channel of the allocated range.
+ *
+ * @retval NRFX_SUCCESS      The channels were successfully allocated.
+ * @retval NRFX_ERROR_NO_MEM There is no range of @p count available channels.
+ */
+nrfx_err_t nrfx_dppi_channel_range_alloc(uint8_t count, uint8_t * p_first);
+
+/**
+ * @brief Function for freeing a range of DPPI channels.
+ * @details This function also disables the channels.
+ *
+ * @note Function is thread safe as it uses @ref nrfx_flag32_array_range_free.
+ *
+ * @param[in] first First DPPI channel of the range.
+ * @param[in] count Number of channels in the range.
+ *
+ * @retval NRFX_SUCCESS             The channels were successfully freed.
+ * @retval NRFX_ERROR_INVALID_PARAM Any of the channels is not allocated.
+ */
+nrfx_err_t nrfx_dppi_channel_range_free(uint8_t first, uint8_t count);
+
 /**
  * @brief Function for enabling a DPPI channel.
  *
@@ -190,6 +220,88 @@ nrfx_err_t nrfx_dppi_group_enable(nrf_dppi_channel_group_t group);
  */
 nrfx_err_t nrfx_dppi_group_disable(nrf_dppi_channel_group_t group);
 
+/**
+ * @brief Function for enabling and disabling a set of DPPI channels at once.
+ *
+ * Channels from @p disable_mask are disabled with a single write to CHENCLR and then
+ * channels from @p enable_mask are enabled with a single write to CHENSET, so that
+ * a set of connections is changed without passing through intermediate configurations.
+ *
+ * @param[in] enable_mask  Mask of channels to be enabled.
+ * @param[in] disable_mask Mask of channels to be disabled.
+ *
+ * @retval NRFX_SUCCESS             The channels were successfully updated.
+ * @retval NRFX_ERROR_INVALID_PARAM At least one of the channels is not allocated
+ *                                  or the masks overlap.
+ */
+nrfx_err_t nrfx_dppi_channels_update(uint32_t enable_mask, uint32_t disable_mask);
+
+/**
+ * @brief Function for setting the whole configuration of a DPPI channel group.
+ *
+ * Unlike @ref nrfx_dppi_channel_include_in_group, the group register is written once,
+ * replacing the previous configuration.
+ *
+ * @param[in] group        Channel group to be configured.
+ * @param[in] channel_mask Mask of channels to be included in the group.
+ *
+ * @warning Channel group configuration can be modified only if subscriptions for tasks
+ *          associated with this group are disabled.
+ *
+ * @retval NRFX_SUCCESS             The group was successfully configured.
+ * @retval NRFX_ERROR_INVALID_PARAM The specified group or at least one of the channels
+ *                                  is not allocated.
+ */
+nrfx_err_t nrfx_dppi_group_config_set(nrf_dppi_channel_group_t group, uint32_t channel_mask);
+
+/**
+ * @brief Function for switching from one DPPI channel group to another.
+ *
+ * The channels of the @p from group are disabled and the channels of the @p to group
+ * are enabled by triggering two group tasks back to back. This allows keeping shadow
+ * configurations in separate groups and switching between them.
+ *
+ * @note Channels belonging to both groups remain enabled after the switch.
+ *
+ * @param[in] from Channel group to be disabled.
+ * @param[in] to   Channel group to be enabled.
+ *
+ * @retval NRFX_SUCCESS             The groups were successfully switched.
+ * @retval NRFX_ERROR_INVALID_PARAM The specified groups are not allocated or are the same.
+ */
+nrfx_err_t nrfx_dppi_group_swap(nrf_dppi_channel_group_t from, nrf_dppi_channel_group_t to);
+
+/**
+ * @brief Function for setting up a DPPI channel that switches between channel groups.
+ *
+ * Both the disable task of the @p from group and the enable task of the @p to group
+ * are subscribed to @p channel, so that a single event published on this channel
+ * performs the switch in hardware, with no CPU involvement.
+ *
+ * @param[in] channel DPPI channel triggering the switch.
+ * @param[in] from    Channel group to be disabled.
+ * @param[in] to      Channel group to be enabled.
+ *
+ * @retval NRFX_SUCCESS             The switch was successfully set up.
+ * @retval NRFX_ERROR_INVALID_PARAM The specified groups or channel are not allocated
+ *                                  or the groups are the same.
+ */
+nrfx_err_t nrfx_dppi_group_swap_channel_set(uint8_t                  channel,
+                                            nrf_dppi_channel_group_t from,
+                                            nrf_dppi_channel_group_t to);
+
+/**
+ * @brief Function for removing the switch set up with @ref nrfx_dppi_group_swap_channel_set.
+ *
+ * @param[in] from Channel group disabled by the switch.
+ * @param[in] to   Channel group enabled by the switch.
+ *
+ * @retval NRFX_SUCCESS             The switch was successfully removed.
+ * @retval NRFX_ERROR_INVALID_PARAM The specified groups are not allocated.
+ */
+nrfx_err_t nrfx_dppi_group_swap_channel_clear(nrf_dppi_channel_group_t from,
+                                              nrf_dppi_channel_group_t to);
+
 /** @} */
 
 #ifdef __cplusplus
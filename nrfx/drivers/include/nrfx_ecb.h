@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_ECB_H__
+#define NRFX_ECB_H__
+
+#include <nrfx.h>
+#include <hal/nrf_ecb.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_ecb ECB driver
+ * @{
+ * @ingroup nrf_ecb
+ * @brief   AES Electronic Codebook mode encryption (ECB) peripheral driver.
+ *
+ * The driver serializes access to the peripheral between many users. Encryption requests
+ * are described by jobs that are queued by @ref nrfx_ecb_job_enqueue. Queued jobs are
+ * served one block at a time in a round-robin manner, so a short job of one user is not
+ * delayed by a long batch of another one, for example the keystream generation for
+ * the AES CTR mode.
+ */
+
+/** @brief Size of the AES key and of the data block, in bytes. */
+#define NRFX_ECB_BLOCK_SIZE 16
+
+/** @brief Structure for ECB configuration. */
+typedef struct
+{
+    uint8_t interrupt_priority; /**< Interrupt priority. */
+} nrfx_ecb_config_t;
+
+/** @brief ECB default configuration. */
+#define NRFX_ECB_DEFAULT_CONFIG                                         \
+    {                                                                   \
+        .interrupt_priority = NRFX_ECB_DEFAULT_CONFIG_IRQ_PRIORITY,     \
+    }
+
+/** @brief Forward declaration of the ECB job type. */
+typedef struct nrfx_ecb_job_s nrfx_ecb_job_t;
+
+/**
+ * @brief ECB job completion handler type.
+ *
+ * The handler is called from the ECB interrupt when all blocks of the job are encrypted.
+ * The job can be enqueued again from the handler.
+ *
+ * @param[in] p_job     Completed job.
+ * @param[in] p_context User context.
+ */
+typedef void (* nrfx_ecb_handler_t)(nrfx_ecb_job_t * p_job, void * p_context);
+
+/** @brief Structure describing an ECB job. */
+struct nrfx_ecb_job_s
+{
+    uint8_t const *    p_key;      ///< 128-bit key.
+    uint8_t const *    p_in;       ///< Cleartext, @p count blocks of 16 bytes.
+    uint8_t *          p_out;      ///< Ciphertext, @p count blocks. Can be equal to @p p_in.
+    uint16_t           count;      ///< Number of blocks. Must not be 0.
+    nrfx_ecb_handler_t handler;    ///< Completion handler. Must not be NULL.
+    void *             p_context;  ///< User context passed to the handler.
+    nrfx_ecb_job_t *   p_next;     ///< Next queued job. For internal use only.
+    uint16_t           done;       ///< Number of encrypted blocks. For internal use only.
+    bool volatile      pending;    ///< True if the job is enqueued. For internal use only.
+};
+
+/**
+ * @brief Function for initializing the ECB driver.
+ *
+ * @param[in] p_config Pointer to the structure with the initial configuration.
+ *
+ * @retval NRFX_SUCCESS                   Driver was successfully initialized.
+ * @retval NRFX_ERROR_ALREADY_INITIALIZED Driver was already initialized.
+ */
+nrfx_err_t nrfx_ecb_init(nrfx_ecb_config_t const * p_config);
+
+/**
+ * @brief Function for uninitializing the ECB driver.
+ *
+ * Queued jobs are dropped without calling their handlers.
+ */
+void nrfx_ecb_uninit(void);
+
+/**
+ * @brief Function for encrypting a single block in the blocking mode.
+ *
+ * The function does not wait for queued jobs to complete.
+ *
+ * @param[in]  p_key NRFX_ECB_BLOCK_SIZE bytes long key.
+ * @param[in]  p_in  NRFX_ECB_BLOCK_SIZE bytes of cleartext.
+ * @param[out] p_out NRFX_ECB_BLOCK_SIZE bytes of ciphertext. Can be equal to @p p_in.
+ *
+ * @retval NRFX_SUCCESS        The block is encrypted.
+ * @retval NRFX_ERROR_BUSY     The peripheral is in use by queued jobs or another caller.
+ * @retval NRFX_ERROR_INTERNAL The encryption was aborted, for example by the CCM
+ *                             or AAR peripheral that has higher priority.
+ */
+nrfx_err_t nrfx_ecb_encrypt(uint8_t const * p_key, uint8_t const * p_in, uint8_t * p_out);
+
+/**
+ * @brief Function for enqueuing an ECB job.
+ *
+ * The job is started immediately if the peripheral is idle. Blocks aborted by a higher
+ * priority peripheral are encrypted again.
+ *
+ * @note The job structure, the key and the data must stay valid until the handler is called.
+ * @note A job that was never enqueued must have @p pending cleared,
+ *       which is the case when the structure is zero-initialized.
+ *
+ * @param[in] p_job Job to be enqueued.
+ *
+ * @retval NRFX_SUCCESS      The job is enqueued.
+ * @retval NRFX_ERROR_BUSY   The job is already enqueued.
+ */
+nrfx_err_t nrfx_ecb_job_enqueue(nrfx_ecb_job_t * p_job);
+
+/**
+ * @brief Function for checking if the ECB job is still enqueued.
+ *
+ * @param[in] p_job Job to be checked.
+ *
+ * @retval true  The job is enqueued or in progress.
+ * @retval false The job is completed or was never enqueued.
+ */
+bool nrfx_ecb_job_is_pending(nrfx_ecb_job_t const * p_job);
+
+/** @} */
+
+void nrfx_ecb_irq_handler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_ECB_H__
@@ -75,6 +75,23 @@ typedef void (*nrfx_gpiote_interrupt_handler_t)(nrfx_gpiote_pin_t     pin,
                                                 nrfx_gpiote_trigger_t trigger,
                                                 void *                p_context);
 
+#if (NRFX_GPIOTE_CONFIG_NUM_OF_GROUP_HANDLERS > 0) || \
+    NRFX_CHECK(NRFX_GPIOTE_CONFIG_PORT_CALLBACK_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Multi-pin interrupt handler prototype.
+ *
+ * Used for pin groups and for the port callback.
+ *
+ * @param[in] port      Port number of the pins.
+ * @param[in] pin_mask  Mask of the pins that triggered this event.
+ *                      Bit n corresponds to pin n of the port.
+ * @param[in] p_context User context.
+ */
+typedef void (*nrfx_gpiote_port_handler_t)(uint32_t port,
+                                           uint32_t pin_mask,
+                                           void *   p_context);
+#endif
+
 /** @brief Structure for configuring a GPIOTE task. */
 typedef struct
 {
@@ -104,14 +121,30 @@ typedef struct
     nrf_gpio_pin_pull_t pull; ///< Pull configuration.
 } nrfx_gpiote_input_config_t;
 
+#if NRFX_CHECK(NRFX_GPIOTE_CONFIG_DEBOUNCE_ENABLED) || defined(__NRFX_DOXYGEN__)
+/** @brief Structure for configuring debouncing of an input pin. */
+typedef struct
+{
+    NRF_TIMER_Type * p_timer;      ///< TIMER instance measuring the debounce window.
+    uint32_t         window_us;    ///< Debounce window in microseconds.
+    uint8_t          irq_priority; ///< Priority of the interrupt of @p p_timer.
+} nrfx_gpiote_debounce_config_t;
+#endif
+
 /** @brief Structure for configuring pin interrupt/event. */
 typedef struct
 {
-    nrfx_gpiote_trigger_t trigger;      ///< Specify trigger.
-    uint8_t const *       p_in_channel; ///< Pointer to GPIOTE channel for IN event.
-                                        /**< If NULL, the sensing mechanism is used
-                                         *   instead. Note that when channel is provided
-                                         *   only edge triggering can be used. */
+    nrfx_gpiote_trigger_t                 trigger;      ///< Specify trigger.
+    uint8_t const *                       p_in_channel; ///< Pointer to GPIOTE channel for IN event.
+                                                        /**< If NULL, the sensing mechanism is used
+                                                         *   instead. Note that when channel is
+                                                         *   provided only edge triggering can be
+                                                         *   used. */
+#if NRFX_CHECK(NRFX_GPIOTE_CONFIG_DEBOUNCE_ENABLED) || defined(__NRFX_DOXYGEN__)
+    nrfx_gpiote_debounce_config_t const * p_debounce;   ///< Debounce configuration.
+                                                        /**< If NULL, every IN event is reported.
+                                                         *   Debouncing requires @p p_in_channel. */
+#endif
 } nrfx_gpiote_trigger_config_t;
 
 /** @brief Structure for configuring a pin interrupt handler. */
@@ -172,7 +205,7 @@ void nrfx_gpiote_uninit(void);
  * @details This function allocates the first unused GPIOTE channel from
  *          pool defined in @ref NRFX_GPIOTE_APP_CHANNELS_MASK.
  *
- * @note Function is thread safe as it uses @ref nrfx_flag32_alloc.
+ * @note Function is thread safe as it uses @ref nrfx_flag32_array_alloc.
  * @note Routines that allocate and free the GPIOTE channels are independent
  *       from the rest of the driver. In particular, the driver does not need
  *       to be initialized when this function is called.
@@ -189,7 +222,7 @@ nrfx_err_t nrfx_gpiote_channel_alloc(uint8_t * p_channel);
  * @details This function frees a GPIOTE channel that was allocated using
  *          @ref nrfx_gpiote_channel_alloc.
  *
- * @note Function is thread safe as it uses @ref nrfx_flag32_free.
+ * @note Function is thread safe as it uses @ref nrfx_flag32_array_free.
  * @note Routines that allocate and free the GPIOTE channels are independent
  *       from the rest of the driver. In particular, the driver does not need
  *       to be initialized when this function is called.
@@ -221,6 +254,12 @@ nrfx_err_t nrfx_gpiote_channel_free(uint8_t channel);
  * input buffer connected. In that case @p p_input_config is NULL to avoid reconfiguration
  * of the pin.
  *
+ * When the debounce configuration is provided, the IN event of the GPIOTE channel restarts
+ * the given TIMER instance through a (D)PPI channel and the GPIOTE interrupt of the channel
+ * is not used. Edges that follow within the debounce window restart the window, and the handler
+ * is called once from the TIMER interrupt, when the input has been stable for the whole window.
+ * The IN event itself still reaches other (D)PPI connections of the channel on each edge.
+ *
  * @param[in] pin              Absolute pin number.
  * @param[in] p_input_config   Pin configuration. If NULL, the current configuration is untouched.
  * @param[in] p_trigger_config Interrupt/event configuration. If NULL, the current configuration
@@ -229,6 +268,7 @@ nrfx_err_t nrfx_gpiote_channel_free(uint8_t channel);
  *
  * @retval NRFX_SUCCESS             Configuration was successful.
  * @retval NRFX_ERROR_INVALID_PARAM Invalid configuration.
+ * @retval NRFX_ERROR_NO_MEM        No (D)PPI channel is available for debouncing.
  */
 nrfx_err_t nrfx_gpiote_input_configure(nrfx_gpiote_pin_t                    pin,
                                        nrfx_gpiote_input_config_t const *   p_input_config,
@@ -279,7 +319,8 @@ nrfx_err_t nrfx_gpiote_pin_uninit(nrfx_gpiote_pin_t pin);
  * @brief Function for enabling trigger for the given pin.
  *
  * When GPIOTE event is used trigger can be enabled without enabling interrupt,
- * e.g. for PPI.
+ * e.g. for PPI. For a debounced pin, @p int_enable applies to the interrupt
+ * of the debounce TIMER instead.
  *
  * @param[in] pin        Absolute pin number.
  * @param[in] int_enable True to enable the interrupt. Must be true when sensing is used.
@@ -293,6 +334,18 @@ void nrfx_gpiote_trigger_enable(nrfx_gpiote_pin_t pin, bool int_enable);
  */
 void nrfx_gpiote_trigger_disable(nrfx_gpiote_pin_t pin);
 
+#if NRFX_CHECK(NRFX_GPIOTE_CONFIG_DEBOUNCE_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Function for handling the interrupt of a debounce TIMER instance.
+ *
+ * @note The driver does not define the interrupt handler of the TIMER instances
+ *       used for debouncing. Call this function from those handlers.
+ *
+ * @param[in] p_timer TIMER instance that generated the interrupt.
+ */
+void nrfx_gpiote_debounce_irq_handler(NRF_TIMER_Type * p_timer);
+#endif
+
 /**
  * @brief Set global callback called for each event.
  *
@@ -302,6 +355,62 @@ void nrfx_gpiote_trigger_disable(nrfx_gpiote_pin_t pin);
 void nrfx_gpiote_global_callback_set(nrfx_gpiote_interrupt_handler_t handler,
                                      void *                          p_context);
 
+#if NRFX_CHECK(NRFX_GPIOTE_CONFIG_PORT_CALLBACK_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Set callback called once per port for all pins reported by a PORT event.
+ *
+ * When the PORT event occurs, the pins of each port are processed in one pass
+ * and all pins that triggered during that pass are passed to the handler in
+ * a single call. While the callback is set, it replaces the global handler
+ * (see @ref nrfx_gpiote_global_callback_set) for pins sensed through the PORT
+ * event. Pin specific and group handlers are still called, before the callback.
+ * Pins that use GPIOTE IN events are not reported to this callback.
+ *
+ * @param[in] handler   Port handler. NULL to disable the callback.
+ * @param[in] p_context Context passed to the handler.
+ */
+void nrfx_gpiote_port_callback_set(nrfx_gpiote_port_handler_t handler, void * p_context);
+#endif
+
+#if (NRFX_GPIOTE_CONFIG_NUM_OF_GROUP_HANDLERS > 0) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Function for adding a group of pins dispatched to a single handler.
+ *
+ * Pins of the group that trigger during the same PORT event are reported with
+ * one call to the group handler, which receives a mask of these pins. Pin
+ * specific handlers and the global handler are not called for such pins,
+ * but they are included in the mask passed to the port callback, if set.
+ * The pins must be configured separately with @ref nrfx_gpiote_input_configure,
+ * using a trigger that does not use a GPIOTE IN event. Pins that use IN events
+ * are always reported individually.
+ *
+ * @param[in]  port      Port number.
+ * @param[in]  pin_mask  Mask of the pins of the port to be added to the group.
+ * @param[in]  handler   Group handler. Must not be NULL.
+ * @param[in]  p_context Context passed to the handler.
+ * @param[out] p_group   Location to write the group identifier.
+ *
+ * @retval NRFX_SUCCESS             The group was added.
+ * @retval NRFX_ERROR_INVALID_PARAM Port is not present or some of the pins
+ *                                  already belong to another group.
+ * @retval NRFX_ERROR_NO_MEM        No free group entries.
+ */
+nrfx_err_t nrfx_gpiote_group_add(uint32_t                    port,
+                                 uint32_t                    pin_mask,
+                                 nrfx_gpiote_port_handler_t handler,
+                                 void *                      p_context,
+                                 uint8_t *                   p_group);
+
+/**
+ * @brief Function for removing a group of pins.
+ *
+ * The pins of the group are reported to their pin specific handlers again.
+ *
+ * @param[in] group Group identifier obtained with @ref nrfx_gpiote_group_add.
+ */
+void nrfx_gpiote_group_remove(uint8_t group);
+#endif
+
 /**
  * @brief Function for retrieving Task/Event channel index associated with the given pin.
  *
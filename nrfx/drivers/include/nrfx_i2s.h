@@ -170,6 +170,48 @@ enum {
     /**< The I2S peripheral has been stopped and all buffers that were passed
      *   to the driver have been released. */
 
+#if NRFX_CHECK(NRFX_I2S_CONFIG_RING_ENABLED) || defined(__NRFX_DOXYGEN__)
+#define NRFX_I2S_STATUS_RING_UPDATED        (1UL << 2)
+    /**< Ring mode only. The peripheral has finished processing a block of
+     *   the ring registered with @ref nrfx_i2s_ring_start and has moved on to
+     *   the next one. No action is required from the application. */
+
+/** @brief Structure describing the ring of blocks used in the ring mode. */
+typedef struct
+{
+    uint32_t * p_tx_blocks; ///< Memory for the TX blocks, NULL if TX is not used.
+                            /**< Must hold @p block_count blocks of @p block_size words. */
+    uint32_t * p_rx_blocks; ///< Memory for the RX blocks, NULL if RX is not used.
+                            /**< Must hold @p block_count blocks of @p block_size words. */
+    uint16_t   block_size;  ///< Size of a single block (in 32-bit words).
+    uint16_t   block_count; ///< Number of blocks in the ring. Must be at least 2.
+    uint16_t   tx_prefill;  ///< Number of TX blocks filled before the transfer is started.
+                            /**< Must be at least 1 if TX is used. Ignored otherwise. */
+} nrfx_i2s_ring_t;
+
+/** @brief Ring mode statistics. */
+typedef struct
+{
+    uint32_t underruns; ///< Number of times a TX block was repeated as no new one was committed.
+    uint32_t overruns;  ///< Number of times an RX block was overwritten as the ring was full.
+} nrfx_i2s_ring_stats_t;
+#endif
+
+#if NRFX_CHECK(NRFX_I2S_CONFIG_DRIFT_COMP_ENABLED) || defined(__NRFX_DOXYGEN__)
+/** @brief Structure for the clock drift compensation configuration. */
+typedef struct
+{
+    NRF_TIMER_Type * p_timer;           ///< TIMER instance dedicated to timestamping the events.
+    uint32_t         ref_event_address; ///< Address of the reference event, for example USBD SOF.
+    uint32_t         ref_period_us;     ///< Nominal period of the reference event in microseconds.
+    uint32_t         word_rate;         ///< Nominal number of 32-bit words transferred per second.
+    uint16_t         window;            ///< Number of reference periods between corrections.
+    uint16_t         max_ppm;           ///< Largest drift estimate that is applied, in ppm.
+                                        /**< Larger estimates are treated as measurement errors,
+                                         *   for example after the reference has been paused. */
+} nrfx_i2s_drift_comp_config_t;
+#endif
+
 /**
  * @brief I2S driver data handler type.
  *
@@ -214,6 +256,7 @@ enum {
  *                    It can be 0 or a combination of the following flags:
  *                    - @ref NRFX_I2S_STATUS_NEXT_BUFFERS_NEEDED
  *                    - @ref NRFX_I2S_STATUS_TRANSFER_STOPPED
+ *                    - @ref NRFX_I2S_STATUS_RING_UPDATED
  */
 typedef void (* nrfx_i2s_data_handler_t)(nrfx_i2s_buffers_t const * p_released,
                                          uint32_t                   status);
@@ -312,6 +355,134 @@ nrfx_err_t nrfx_i2s_next_buffers_set(nrfx_i2s_t const *         p_instance,
  */
 void nrfx_i2s_stop(nrfx_i2s_t const * p_instance);
 
+#if NRFX_CHECK(NRFX_I2S_CONFIG_RING_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Function for starting the continuous I2S transfer in the ring mode.
+ *
+ * In the ring mode, the application does not supply buffers from the data
+ * handler. Instead, it registers a circular buffer of blocks and the driver
+ * hands consecutive blocks to the peripheral on its own. The application
+ * fills TX blocks with @ref nrfx_i2s_ring_tx_block_get and
+ * @ref nrfx_i2s_ring_tx_block_commit, and drains RX blocks with
+ * @ref nrfx_i2s_ring_rx_block_get and @ref nrfx_i2s_ring_rx_block_release.
+ * The data handler is called with @ref NRFX_I2S_STATUS_RING_UPDATED each time
+ * a block is completed. If no block is available when the peripheral needs
+ * the next one, the current block is used again, the event is counted in
+ * the ring statistics and the data handler receives NULL instead of
+ * the released buffers.
+ *
+ * The first @c tx_prefill blocks of the TX ring must be filled before this
+ * function is called. At any moment, two blocks per direction are owned by
+ * the peripheral, so a ring of at least 3 blocks is needed to have any slack.
+ * The transfer is terminated with @ref nrfx_i2s_stop.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ * @param[in] p_ring     Pointer to the structure describing the ring.
+ * @param[in] flags      Transfer options (0 for default settings).
+ *                       Currently, no additional flags are available.
+ *
+ * @retval NRFX_SUCCESS             The operation was successful.
+ * @retval NRFX_ERROR_INVALID_STATE Transfer was already started or
+ *                                  the driver has not been initialized.
+ * @retval NRFX_ERROR_INVALID_ADDR  The provided blocks are not placed
+ *                                  in the Data RAM region.
+ */
+nrfx_err_t nrfx_i2s_ring_start(nrfx_i2s_t const *      p_instance,
+                               nrfx_i2s_ring_t const * p_ring,
+                               uint8_t                 flags);
+
+/**
+ * @brief Function for getting the TX block to be filled next.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ *
+ * @return Pointer to the block or NULL if all blocks are in use.
+ */
+uint32_t * nrfx_i2s_ring_tx_block_get(nrfx_i2s_t const * p_instance);
+
+/**
+ * @brief Function for committing the TX block obtained with @ref nrfx_i2s_ring_tx_block_get.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ */
+void nrfx_i2s_ring_tx_block_commit(nrfx_i2s_t const * p_instance);
+
+/**
+ * @brief Function for getting the oldest RX block filled by the peripheral.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ *
+ * @return Pointer to the block or NULL if no filled block is available.
+ */
+uint32_t * nrfx_i2s_ring_rx_block_get(nrfx_i2s_t const * p_instance);
+
+/**
+ * @brief Function for returning the RX block obtained with @ref nrfx_i2s_ring_rx_block_get.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ */
+void nrfx_i2s_ring_rx_block_release(nrfx_i2s_t const * p_instance);
+
+/**
+ * @brief Function for getting the ring mode statistics.
+ *
+ * The statistics are cleared by @ref nrfx_i2s_ring_start.
+ *
+ * @param[in]  p_instance Pointer to the driver instance structure.
+ * @param[out] p_stats    Pointer to the structure to be filled with the statistics.
+ */
+void nrfx_i2s_ring_stats_get(nrfx_i2s_t const *      p_instance,
+                             nrfx_i2s_ring_stats_t * p_stats);
+#endif
+
+#if NRFX_CHECK(NRFX_I2S_CONFIG_DRIFT_COMP_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Function for starting the compensation of the audio clock drift.
+ *
+ * The I2S clock is derived from HFCLKAUDIO, which drifts against the clock of
+ * the data source or sink, for example the USB host. Without compensation, the
+ * buffers slowly underrun or overrun. The driver timestamps the reference event
+ * and the buffer pointer updates with the dedicated TIMER connected through
+ * (D)PPI, so the interrupt latency does not affect the measurement. Once per
+ * @c window reference periods, it compares the number of words transferred
+ * against the time elapsed on the reference and trims HFCLKAUDIO by the estimated
+ * drift with @ref nrfx_clock_hfclkaudio_config_set. One step of the HFCLKAUDIO
+ * setting is 3 to 4 ppm, so windows of at least one second are recommended.
+ *
+ * The reference events are counted by rounding the elapsed time to the nominal
+ * period, so single missed events do not distort the estimate.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ * @param[in] p_config   Pointer to the compensation configuration.
+ *
+ * @retval NRFX_SUCCESS             The compensation has been started.
+ * @retval NRFX_ERROR_INVALID_STATE The transfer has not been started or
+ *                                  the compensation is already running.
+ * @retval NRFX_ERROR_NO_MEM        No (D)PPI channels are available.
+ */
+nrfx_err_t nrfx_i2s_drift_comp_start(nrfx_i2s_t const *                   p_instance,
+                                     nrfx_i2s_drift_comp_config_t const * p_config);
+
+/**
+ * @brief Function for stopping the compensation of the audio clock drift.
+ *
+ * The HFCLKAUDIO setting reached so far is kept.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ */
+void nrfx_i2s_drift_comp_stop(nrfx_i2s_t const * p_instance);
+
+/**
+ * @brief Function for getting the most recent drift estimate.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ *
+ * @return Drift of the audio clock against the reference, in ppm. Positive values
+ *         mean the audio clock runs fast.
+ */
+int32_t nrfx_i2s_drift_comp_ppm_get(nrfx_i2s_t const * p_instance);
+#endif
+
 /** @} */
 
 /*
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_KMU_H__
+#define NRFX_KMU_H__
+
+#include <nrfx.h>
+#include <hal/nrf_kmu.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_kmu KMU driver
+ * @{
+ * @ingroup nrf_kmu
+ * @brief   Key Management Unit (KMU) peripheral driver.
+ *
+ * The driver provisions keys into the key slots located in UICR and pushes them over the secure
+ * APB directly into the key registers of a crypto peripheral. A key pushed this way never transits
+ * the general-purpose RAM, and switching between keys stored in different slots costs a single
+ * push instead of copying the key into the peripheral.
+ *
+ * The destination address of a key is a property of its slot and is stored in UICR together with
+ * the key. Keys used by the same peripheral share the destination address, so selecting the key
+ * for a given operation is done by pushing the corresponding slot.
+ *
+ * @note The driver is not reentrant. Calls must be serialized by the user.
+ */
+
+/** @brief Number of key slots provided by the KMU. */
+#define NRFX_KMU_SLOT_COUNT \
+    (sizeof(((NRF_UICR_Type *)0)->KEYSLOT.CONFIG) / sizeof(UICR_KEYSLOT_CONFIG_Type))
+
+/** @brief Size of the key stored in a single key slot, in bytes. */
+#define NRFX_KMU_KEY_SIZE sizeof(((UICR_KEYSLOT_KEY_Type *)0)->VALUE)
+
+#if defined(NRF_CRYPTOCELL_S) || defined(__NRFX_DOXYGEN__)
+/** @brief Destination address of the AES key register of the CryptoCell. */
+#define NRFX_KMU_DEST_CRYPTOCELL_AES_KEY ((uint32_t)NRF_CRYPTOCELL_S + 0x1400UL)
+#endif
+
+/** @brief Key slot permissions. */
+typedef enum
+{
+    NRFX_KMU_PERM_WRITE = UICR_KEYSLOT_CONFIG_PERM_WRITE_Msk, ///< Key value can be written.
+    NRFX_KMU_PERM_READ  = UICR_KEYSLOT_CONFIG_PERM_READ_Msk,  ///< Key value can be read over AHB.
+    NRFX_KMU_PERM_PUSH  = UICR_KEYSLOT_CONFIG_PERM_PUSH_Msk,  ///< Key value can be pushed over secure APB.
+} nrfx_kmu_perm_t;
+
+/**
+ * @brief Function for checking if the specified key slot is not provisioned.
+ *
+ * @param[in] slot Index of the key slot.
+ *
+ * @retval true  The key slot is erased and can be provisioned.
+ * @retval false The key slot has already been provisioned.
+ */
+bool nrfx_kmu_slot_free_check(uint8_t slot);
+
+/**
+ * @brief Function for provisioning a key into the specified key slot.
+ *
+ * The key, its destination address and its permissions are written to UICR. The function
+ * blocks until NVMC completes the writes.
+ *
+ * @param[in] slot  Index of the key slot.
+ * @param[in] p_key Pointer to the key of @ref NRFX_KMU_KEY_SIZE bytes. Must be word-aligned.
+ * @param[in] dest  Secure APB address the key is to be pushed to.
+ * @param[in] perm  Mask of permissions of the key slot, constructed from @ref nrfx_kmu_perm_t.
+ *
+ * @retval NRFX_SUCCESS             The key has been provisioned.
+ * @retval NRFX_ERROR_INVALID_STATE The key slot has already been provisioned.
+ * @retval NRFX_ERROR_INVALID_PARAM The key slot index is invalid or pushing is permitted
+ *                                  without a valid destination address.
+ */
+nrfx_err_t nrfx_kmu_key_provision(uint8_t          slot,
+                                  uint32_t const * p_key,
+                                  uint32_t         dest,
+                                  uint32_t         perm);
+
+/**
+ * @brief Function for pushing the key from the specified key slot to its destination.
+ *
+ * The function blocks until the KMU completes the push. The key slot is deselected afterwards,
+ * so its key value cannot be accessed until the next selection.
+ *
+ * @param[in] slot Index of the key slot.
+ *
+ * @retval NRFX_SUCCESS             The key has been pushed.
+ * @retval NRFX_ERROR_INVALID_PARAM The key slot index is invalid.
+ * @retval NRFX_ERROR_FORBIDDEN     The key slot has been revoked.
+ * @retval NRFX_ERROR_INTERNAL      The push has failed, for example because the key slot
+ *                                  does not permit pushing.
+ */
+nrfx_err_t nrfx_kmu_key_push(uint8_t slot);
+
+/**
+ * @brief Function for revoking the key in the specified key slot.
+ *
+ * A revoked key can no longer be read or pushed. The revocation is permanent until UICR is erased.
+ *
+ * @param[in] slot Index of the key slot.
+ *
+ * @retval NRFX_SUCCESS             The key has been revoked.
+ * @retval NRFX_ERROR_INVALID_PARAM The key slot index is invalid.
+ */
+nrfx_err_t nrfx_kmu_key_revoke(uint8_t slot);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_KMU_H__
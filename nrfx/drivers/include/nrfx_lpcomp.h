@@ -92,7 +92,8 @@ typedef struct
  *
  * @param[in] p_config      Pointer to the structure with the initial configuration.
  * @param[in] event_handler Event handler provided by the user.
- *                          Must not be NULL.
+ *                          If NULL, interrupts are not enabled and the events can only be
+ *                          used through (D)PPI, for example to trigger SAADC sampling.
  *
  * @retval NRFX_SUCCESS             Initialization was successful.
  * @retval NRFX_ERROR_INVALID_STATE The driver has already been initialized.
@@ -135,6 +136,36 @@ void nrfx_lpcomp_enable(void);
  */
 void nrfx_lpcomp_disable(void);
 
+/**
+ * @brief Function for getting the address of an LPCOMP task.
+ *
+ * @param[in] task LPCOMP task.
+ *
+ * @return Address of the given LPCOMP task.
+ */
+NRFX_STATIC_INLINE uint32_t nrfx_lpcomp_task_address_get(nrf_lpcomp_task_t task);
+
+/**
+ * @brief Function for getting the address of an LPCOMP event.
+ *
+ * @param[in] event LPCOMP event.
+ *
+ * @return Address of the given LPCOMP event.
+ */
+NRFX_STATIC_INLINE uint32_t nrfx_lpcomp_event_address_get(nrf_lpcomp_event_t event);
+
+#ifndef NRFX_DECLARE_ONLY
+NRFX_STATIC_INLINE uint32_t nrfx_lpcomp_task_address_get(nrf_lpcomp_task_t task)
+{
+    return nrfy_lpcomp_task_address_get(NRF_LPCOMP, task);
+}
+
+NRFX_STATIC_INLINE uint32_t nrfx_lpcomp_event_address_get(nrf_lpcomp_event_t event)
+{
+    return nrfy_lpcomp_event_address_get(NRF_LPCOMP, event);
+}
+#endif // NRFX_DECLARE_ONLY
+
 /** @} */
 
 
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_MUTEX_H__
+#define NRFX_MUTEX_H__
+
+#include <nrfx.h>
+#include <hal/nrf_mutex.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_mutex MUTEX driver
+ * @{
+ * @ingroup nrf_mutex
+ * @brief   MUTEX peripheral driver.
+ *
+ * The driver uses the hardware mutexes to protect short critical sections of data structures
+ * shared between the cores, which is cheaper than exchanging IPC messages to get the exclusion.
+ * Reading a mutex register locks the mutex and returns its previous state, so a lock attempt is
+ * a single bus access and needs no interrupt.
+ *
+ * Mutex IDs are allocated per core, so the cores sharing a mutex must agree on its ID, for
+ * example by reserving it with @p NRFX_MUTEXES_USED on one core and passing the ID allocated on
+ * the other core through the shared memory.
+ *
+ * @note The MUTEX peripheral does not track the owner of a mutex. Unlocking a mutex that is
+ *       locked by the other core releases it.
+ */
+
+/** @brief Number of mutexes provided by the MUTEX peripheral. */
+#define NRFX_MUTEX_COUNT (sizeof(((NRF_MUTEX_Type *)0)->MUTEX) / sizeof(uint32_t))
+
+/**
+ * @brief Function for allocating a mutex.
+ *
+ * @note Function is thread safe as it uses @ref nrfx_flag32_alloc.
+ *
+ * @param[out] p_mutex Pointer to the ID of the allocated mutex.
+ *
+ * @retval NRFX_SUCCESS      The mutex was successfully allocated.
+ * @retval NRFX_ERROR_NO_MEM There is no available mutex to be used.
+ */
+nrfx_err_t nrfx_mutex_alloc(uint8_t * p_mutex);
+
+/**
+ * @brief Function for freeing a mutex.
+ *
+ * The state of the mutex is not changed.
+ *
+ * @note Function is thread safe as it uses @ref nrfx_flag32_free.
+ *
+ * @param[in] mutex ID of the mutex to be freed.
+ *
+ * @retval NRFX_SUCCESS             The mutex was successfully freed.
+ * @retval NRFX_ERROR_INVALID_PARAM The specified mutex is not allocated.
+ */
+nrfx_err_t nrfx_mutex_free(uint8_t mutex);
+
+/**
+ * @brief Function for trying to lock a mutex without waiting.
+ *
+ * A data memory barrier follows a successful lock, so that the accesses to the protected data
+ * are not performed before the mutex is locked.
+ *
+ * @param[in] mutex ID of the mutex.
+ *
+ * @retval true  The mutex has been locked.
+ * @retval false The mutex is locked by another context.
+ */
+NRFX_STATIC_INLINE bool nrfx_mutex_try_lock(uint8_t mutex);
+
+/**
+ * @brief Function for locking a mutex with a bounded wait.
+ *
+ * The mutex is polled with an exponential backoff of 1 us doubled up to
+ * @p NRFX_MUTEX_CONFIG_BACKOFF_MAX_US between attempts, so that the core holding the mutex
+ * is not slowed down by a stream of bus accesses to the MUTEX peripheral.
+ *
+ * @param[in] mutex      ID of the mutex.
+ * @param[in] timeout_us Maximum time of waiting for the mutex in microseconds.
+ *                       Value 0 makes a single attempt.
+ *
+ * @retval NRFX_SUCCESS       The mutex has been locked.
+ * @retval NRFX_ERROR_TIMEOUT The mutex has not been released within @p timeout_us.
+ */
+nrfx_err_t nrfx_mutex_lock(uint8_t mutex, uint32_t timeout_us);
+
+/**
+ * @brief Function for unlocking a mutex.
+ *
+ * A data memory barrier precedes the unlock, so that the accesses to the protected data are
+ * completed before the mutex can be taken by the other core.
+ *
+ * @param[in] mutex ID of the mutex.
+ */
+NRFX_STATIC_INLINE void nrfx_mutex_unlock(uint8_t mutex);
+
+#ifndef NRFX_DECLARE_ONLY
+NRFX_STATIC_INLINE bool nrfx_mutex_try_lock(uint8_t mutex)
+{
+    NRFX_ASSERT(mutex < NRFX_MUTEX_COUNT);
+
+    if (!nrf_mutex_lock(NRF_MUTEX, mutex))
+    {
+        return false;
+    }
+
+    __DMB();
+    return true;
+}
+
+NRFX_STATIC_INLINE void nrfx_mutex_unlock(uint8_t mutex)
+{
+    NRFX_ASSERT(mutex < NRFX_MUTEX_COUNT);
+
+    __DMB();
+    nrf_mutex_unlock(NRF_MUTEX, mutex);
+}
+#endif // NRFX_DECLARE_ONLY
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_MUTEX_H__
@@ -329,6 +329,72 @@ void nrfx_nfct_autocolres_enable(void);
  */
 void nrfx_nfct_autocolres_disable(void);
 
+#if NRFX_CHECK(NRFX_NFCT_CONFIG_AUTORESPONSE_ENABLED) || defined(__NRFX_DOXYGEN__)
+/** @brief Automatic response descriptor. */
+typedef struct
+{
+    uint8_t const * p_pattern;     ///< Bytes that the received frame must start with.
+    uint8_t const * p_mask;        ///< Mask applied to the frame bytes before the comparison.
+                                   ///< NULL if all bits are compared.
+    uint8_t         pattern_size;  ///< Number of bytes in @p p_pattern and @p p_mask.
+    uint8_t         echo_size;     ///< Number of leading frame bytes copied to the beginning
+                                   ///< of the response, for example the ISO-DEP PCB byte.
+    uint8_t *       p_response;    ///< Response frame. Must be in RAM.
+    uint32_t        response_size; ///< Size of the response frame in bytes.
+} nrfx_nfct_autoresp_t;
+
+/**
+ * @brief Function for setting the table of automatic responses.
+ *
+ * A frame received without errors is compared with the patterns in the table order.
+ * On the first match, the response is transmitted directly from the interrupt handler
+ * with the window grid frame delay, and the reception is restarted when it is sent.
+ * The upper layer is not notified about the frame and the response.
+ * Frames that match no pattern are reported as usual.
+ *
+ * @note @ref NRFX_NFCT_EVT_RX_FRAMEEND and @ref NRFX_NFCT_EVT_TX_FRAMEEND must be enabled
+ *       in @ref nrfx_nfct_config_t::rxtx_int_mask.
+ * @note The table and the buffers must stay valid until the table is changed.
+ *
+ * @param[in] p_table Table of automatic responses. NULL to disable the automatic responses.
+ * @param[in] count   Number of entries in @p p_table.
+ *
+ * @retval NRFX_SUCCESS            The table is set.
+ * @retval NRFX_ERROR_INVALID_ADDR A response buffer does not point to memory region
+ *                                 reachable by EasyDMA.
+ */
+nrfx_err_t nrfx_nfct_autoresponse_set(nrfx_nfct_autoresp_t const * p_table, size_t count);
+
+/**
+ * @brief Function for receiving frames into a ring of buffers.
+ *
+ * The reception into the first buffer is started immediately, like with @ref nrfx_nfct_rx.
+ * Each frame reported with @ref NRFX_NFCT_EVT_RX_FRAMEEND stays in its buffer, owned by
+ * the upper layer until it is released with @ref nrfx_nfct_rx_ring_release. When a frame
+ * is transmitted, the reception is restarted by the driver into the next free buffer,
+ * so the upper layer does not call @ref nrfx_nfct_rx.
+ *
+ * @note @ref NRFX_NFCT_EVT_RX_FRAMEEND and @ref NRFX_NFCT_EVT_TX_FRAMEEND must be enabled
+ *       in @ref nrfx_nfct_config_t::rxtx_int_mask.
+ *
+ * @param[in] p_buffers   Memory for @p count buffers of @p buffer_size bytes each.
+ *                        NULL to stop using the ring.
+ * @param[in] buffer_size Size of one buffer.
+ * @param[in] count       Number of buffers. Maximum is 32.
+ *
+ * @retval NRFX_SUCCESS            The ring is set up.
+ * @retval NRFX_ERROR_INVALID_ADDR Buffers do not point to memory region reachable by EasyDMA.
+ */
+nrfx_err_t nrfx_nfct_rx_ring_set(uint8_t * p_buffers, uint16_t buffer_size, uint8_t count);
+
+/**
+ * @brief Function for returning a ring buffer to the driver.
+ *
+ * @param[in] p_data Pointer to the buffer, as reported in @ref NRFX_NFCT_EVT_RX_FRAMEEND.
+ */
+void nrfx_nfct_rx_ring_release(uint8_t const * p_data);
+#endif // NRFX_CHECK(NRFX_NFCT_CONFIG_AUTORESPONSE_ENABLED) || defined(__NRFX_DOXYGEN__)
+
 /** @} */
 
 
@@ -50,6 +50,33 @@ extern "C" {
  * @brief   Non-Volatile Memory Controller (NVMC) peripheral driver.
  */
 
+#if NRFX_CHECK(NRFX_NVMC_CONFIG_WRITER_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Buffered writer completion handler type.
+ *
+ * @param[in] p_context User context passed to @ref nrfx_nvmc_writer_write_async.
+ */
+typedef void (*nrfx_nvmc_writer_handler_t)(void * p_context);
+
+/**
+ * @brief Buffered writer instance.
+ *
+ * The writer packs consecutive bytes into words and writes each word to flash
+ * only once it is complete, so the number of write operations is reduced to
+ * the minimum. Fields of the structure must not be modified directly.
+ */
+typedef struct
+{
+    uint32_t                   addr;      ///< Flash address of the next byte to be written.
+    uint32_t                   word;      ///< Word being packed.
+    uint8_t const *            p_src;     ///< Data not yet consumed by the writer.
+    uint32_t                   remaining; ///< Number of bytes not yet consumed by the writer.
+    nrfx_nvmc_writer_handler_t handler;   ///< Completion handler of the non-blocking write.
+    void *                     p_context; ///< Context passed to the completion handler.
+} nrfx_nvmc_writer_t;
+#endif
+
+
 /**
  * @brief Function for erasing a page in flash.
  *
@@ -124,6 +151,58 @@ nrfx_err_t nrfx_nvmc_page_partial_erase_init(uint32_t address, uint32_t duration
  */
 bool nrfx_nvmc_page_partial_erase_continue(void);
 
+#if NRFX_CHECK(NRFX_NVMC_CONFIG_ERASE_SCHEDULER_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Erase scheduler completion handler type.
+ *
+ * @param[in] address   Address of the first page of the erased range.
+ * @param[in] p_context User context passed to @ref nrfx_nvmc_erase_schedule.
+ */
+typedef void (*nrfx_nvmc_erase_handler_t)(uint32_t address, void * p_context);
+
+/**
+ * @brief Function for scheduling an erase of a range of pages split into short steps.
+ *
+ * The pages are erased with partial erase operations, each blocking the CPU
+ * for at most @p step_ms milliseconds. The steps are executed by calls to
+ * @ref nrfx_nvmc_erase_step, which can be performed from the idle loop
+ * or from a periodic interrupt, for example an RTC compare handler, so that
+ * the time-critical interrupts are not starved while flash is reclaimed.
+ * Pages that are already erased are skipped.
+ *
+ * @param address    Address of the first word in the first page to erase.
+ * @param page_count Number of consecutive pages to erase.
+ * @param step_ms    Maximum duration in milliseconds of a single erase step.
+ * @param handler    Handler called when all pages are erased. Can be NULL.
+ * @param p_context  Context passed to the handler.
+ *
+ * @retval NRFX_SUCCESS             The erase was scheduled.
+ * @retval NRFX_ERROR_INVALID_ADDR  Address is not aligned to the size of the page.
+ * @retval NRFX_ERROR_INVALID_PARAM Step duration is not supported by the NVMC.
+ * @retval NRFX_ERROR_BUSY          Another erase is already scheduled.
+ */
+nrfx_err_t nrfx_nvmc_erase_schedule(uint32_t                  address,
+                                    uint32_t                  page_count,
+                                    uint32_t                  step_ms,
+                                    nrfx_nvmc_erase_handler_t handler,
+                                    void *                    p_context);
+
+/**
+ * @brief Function for executing one step of the scheduled erase.
+ *
+ * The function blocks for at most the step duration specified in
+ * @ref nrfx_nvmc_erase_schedule. When the last page is erased, the completion
+ * handler is called from this function.
+ *
+ * @note The partial erase of a single page cannot be used at the same time
+ *       as the scheduler, as the NVMC holds only one partial erase configuration.
+ *
+ * @retval true  No erase is scheduled.
+ * @retval false Some pages are still to be erased.
+ */
+bool nrfx_nvmc_erase_step(void);
+#endif
+
 #endif // defined(NRF_NVMC_PARTIAL_ERASE_PRESENT) || defined(__NRFX_DOXYGEN__)
 
 /**
@@ -249,6 +328,80 @@ void nrfx_nvmc_bytes_write(uint32_t address, void const * src, uint32_t num_byte
  */
 void nrfx_nvmc_words_write(uint32_t address, void const * src, uint32_t num_words);
 
+#if NRFX_CHECK(NRFX_NVMC_CONFIG_WRITER_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Function for initializing the buffered writer.
+ *
+ * @param[out] p_writer Pointer to the writer instance.
+ * @param[in]  address  Flash address of the first byte to be written.
+ */
+void nrfx_nvmc_writer_init(nrfx_nvmc_writer_t * p_writer, uint32_t address);
+
+/**
+ * @brief Function for writing consecutive bytes to flash through the buffered writer.
+ *
+ * Bytes are packed into the word being prepared and every completed word is
+ * written to flash. Where the NVMC supports it, a word is written as soon as
+ * the controller can buffer it, so that consecutive writes are pipelined.
+ * The bytes of the last incomplete word are kept in the writer until the next
+ * call or until @ref nrfx_nvmc_writer_flush is called.
+ *
+ * This function blocks until all completed words are accepted by the NVMC.
+ *
+ * @param[in] p_writer  Pointer to the writer instance.
+ * @param[in] src       Pointer to the data to copy from.
+ * @param[in] num_bytes Number of bytes to write.
+ */
+void nrfx_nvmc_writer_write(nrfx_nvmc_writer_t * p_writer, void const * src, uint32_t num_bytes);
+
+/**
+ * @brief Function for starting a non-blocking write through the buffered writer.
+ *
+ * The NVMC does not generate interrupts, so the data is written by subsequent calls to
+ * @ref nrfx_nvmc_writer_process. The source data must stay valid until the handler is called.
+ *
+ * @param[in] p_writer  Pointer to the writer instance.
+ * @param[in] src       Pointer to the data to copy from.
+ * @param[in] num_bytes Number of bytes to write.
+ * @param[in] handler   Handler called when all data is consumed by the writer.
+ * @param[in] p_context Context passed to the handler.
+ *
+ * @retval NRFX_SUCCESS    The write was started.
+ * @retval NRFX_ERROR_BUSY Another non-blocking write of the writer is in progress.
+ */
+nrfx_err_t nrfx_nvmc_writer_write_async(nrfx_nvmc_writer_t *       p_writer,
+                                        void const *               src,
+                                        uint32_t                   num_bytes,
+                                        nrfx_nvmc_writer_handler_t handler,
+                                        void *                     p_context);
+
+/**
+ * @brief Function for advancing the non-blocking write of the buffered writer.
+ *
+ * The function writes the words that the NVMC can accept immediately and returns
+ * without waiting for the controller, so it can be called periodically, for example
+ * from the idle loop. When all data is consumed, the completion handler is called
+ * from this function.
+ *
+ * @param[in] p_writer Pointer to the writer instance.
+ *
+ * @retval true  No non-blocking write is in progress.
+ * @retval false Part of the data is still to be written.
+ */
+bool nrfx_nvmc_writer_process(nrfx_nvmc_writer_t * p_writer);
+
+/**
+ * @brief Function for writing the incomplete word kept in the buffered writer.
+ *
+ * Unwritten bytes of the word are left erased, so they can be written later
+ * by the same writer. Note that the number of writes to one word before its erase
+ * is limited. Refer to the Product Specification for more information.
+ *
+ * @param[in] p_writer Pointer to the writer instance. No non-blocking write can be in progress.
+ */
+void nrfx_nvmc_writer_flush(nrfx_nvmc_writer_t * p_writer);
+#endif
+
 /**
  * @brief Function for reading a 16-bit aligned halfword from the OTP (UICR)
  *
@@ -64,8 +64,29 @@ typedef struct
     bool             buffer_requested; ///< Buffer request flag.
     int16_t *        buffer_released;  ///< Pointer to the released buffer. Can be NULL.
     nrfx_pdm_error_t error;            ///< Error type.
+#if NRFX_CHECK(NRFX_PDM_CONFIG_POSTPROC_ENABLED) || defined(__NRFX_DOXYGEN__)
+    uint16_t         released_length;  ///< Number of valid samples in the released buffer.
+                                       /**< Accounts for the decimation done by the driver.
+                                        *   0 for buffers released after the sampling
+                                        *   was stopped, as these are not processed. */
+#endif
 } nrfx_pdm_evt_t;
 
+#if NRFX_CHECK(NRFX_PDM_CONFIG_POSTPROC_ENABLED) || defined(__NRFX_DOXYGEN__)
+/** @brief Unity gain value for the software post-processing stage. */
+#define NRFX_PDM_POSTPROC_GAIN_UNITY 256
+
+/** @brief PDM software post-processing configuration structure. */
+typedef struct
+{
+    uint8_t decimation; ///< Decimation factor. 1 disables decimation.
+                        /**< Each group of @p decimation consecutive samples of a channel
+                         *   is averaged into one output sample. */
+    int16_t gain;       ///< Gain in Q8.8 format, see @ref NRFX_PDM_POSTPROC_GAIN_UNITY.
+                        /**< The result is saturated to the 16-bit sample range. */
+} nrfx_pdm_postproc_t;
+#endif
+
 /** @brief PDM interface driver configuration structure. */
 typedef struct
 {
@@ -222,6 +243,53 @@ nrfx_err_t nrfx_pdm_stop(void);
  */
 nrfx_err_t nrfx_pdm_buffer_set(int16_t * buffer, uint16_t buffer_length);
 
+#if (NRFX_PDM_CONFIG_BUFFER_QUEUE_SIZE > 0) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Function for adding the sample buffer to the driver queue.
+ *
+ * Queued buffers are supplied to the peripheral by the driver itself whenever
+ * a buffer is requested, without involving the event handler. Only when
+ * the queue is empty is the buffer request passed to the application, which
+ * can then either call @ref nrfx_pdm_buffer_set or queue another buffer.
+ * Released buffers are still reported through the event handler, so they
+ * can be queued again from there. Buffers still in the queue when the sampling
+ * is stopped stay queued and are used after the next start.
+ *
+ * @param[in] buffer        Pointer to the receive buffer. Cannot be NULL.
+ * @param[in] buffer_length Length of the receive buffer in 16-bit words.
+ *
+ * @retval NRFX_SUCCESS             The buffer was queued successfully.
+ * @retval NRFX_ERROR_NO_MEM        The queue is full.
+ * @retval NRFX_ERROR_INVALID_STATE The driver was not initialized.
+ * @retval NRFX_ERROR_INVALID_PARAM Invalid parameters were provided.
+ */
+nrfx_err_t nrfx_pdm_buffer_queue(int16_t * buffer, uint16_t buffer_length);
+#endif
+
+#if NRFX_CHECK(NRFX_PDM_CONFIG_POSTPROC_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Function for configuring the software post-processing stage.
+ *
+ * The stage runs in the interrupt handler on every completely filled buffer,
+ * before it is released to the application. The decimated samples are packed
+ * in place at the beginning of the buffer and their number is reported in
+ * @ref nrfx_pdm_evt_t::released_length. For example, 32 kHz sampling used
+ * with a decimation factor of 2 yields 16 kHz frames.
+ *
+ * @note Averaging is a simple low-pass filter. If the input contains
+ *       significant energy above the output Nyquist frequency, some of it
+ *       folds back into the decimated signal.
+ *
+ * @param[in] p_postproc Pointer to the post-processing configuration.
+ *
+ * @retval NRFX_SUCCESS             The configuration was applied successfully.
+ * @retval NRFX_ERROR_BUSY          Sampling is in progress.
+ * @retval NRFX_ERROR_INVALID_STATE The driver was not initialized.
+ * @retval NRFX_ERROR_INVALID_PARAM Invalid parameters were provided.
+ */
+nrfx_err_t nrfx_pdm_postproc_set(nrfx_pdm_postproc_t const * p_postproc);
+#endif
+
 #ifndef NRFX_DECLARE_ONLY
 NRFX_STATIC_INLINE uint32_t nrfx_pdm_task_address_get(nrf_pdm_task_t task)
 {
@@ -330,6 +330,73 @@ void nrfx_power_sleepevt_disable(void);
 void nrfx_power_sleepevt_uninit(void);
 #endif /* NRF_POWER_HAS_SLEEPEVT */
 
+#if (NRF_POWER_HAS_CONST_LATENCY && NRF_POWER_HAS_LOW_POWER) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Function for setting the sub power mode used in System ON idle.
+ *
+ * @param[in] mode Power mode to be used.
+ */
+void nrfx_power_mode_set(nrfx_power_mode_t mode);
+#endif
+
+#if NRFX_CHECK(NRFX_POWER_CONFIG_RESIDENCY_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Function returning the current time used by the residency accounting.
+ *
+ * Typically the COUNTER register of a running RTC. Only the bits given by the mask
+ * passed to @ref nrfx_power_residency_init are used and the value is allowed to wrap around.
+ */
+typedef uint32_t (*nrfx_power_time_get_t)(void);
+
+/** @brief Sleep-state residency statistics. All times are in ticks of the time source. */
+typedef struct
+{
+    uint64_t active;                                              //!< Time spent running.
+    uint64_t idle[2];                                             //!< Time spent in System ON
+                                                                  //!< idle, indexed by
+                                                                  //!< @ref nrfx_power_mode_t.
+    uint32_t wakeups[NRFX_POWER_CONFIG_RESIDENCY_WAKEUP_SOURCES]; //!< Number of wake-ups,
+                                                                  //!< indexed by the source.
+} nrfx_power_residency_t;
+
+/**
+ * @brief Function for starting the sleep-state residency accounting.
+ *
+ * The statistics are cleared. Time between two consecutive calls to the time source
+ * must not exceed the range given by @p time_mask.
+ *
+ * @param[in] time_get  Function returning the current time.
+ * @param[in] time_mask Mask of the valid bits of the time, for example 0xFFFFFF for RTC.
+ */
+void nrfx_power_residency_init(nrfx_power_time_get_t time_get, uint32_t time_mask);
+
+/**
+ * @brief Function for recording the entry to System ON idle.
+ *
+ * To be called by the idle loop right before WFI or WFE, with interrupts masked.
+ */
+void nrfx_power_residency_sleep_enter(void);
+
+/**
+ * @brief Function for recording the exit from System ON idle.
+ *
+ * To be called by the idle loop right after WFI or WFE, before interrupts are unmasked.
+ *
+ * @param[in] source Application-defined identifier of the wake-up source, for example
+ *                   derived from the pending interrupts. Must be lower than
+ *                   @ref NRFX_POWER_CONFIG_RESIDENCY_WAKEUP_SOURCES.
+ */
+void nrfx_power_residency_sleep_exit(uint8_t source);
+
+/**
+ * @brief Function for getting the sleep-state residency statistics.
+ *
+ * @param[out] p_residency Pointer to the structure to be filled with the statistics,
+ *                         including the time elapsed in the current state.
+ */
+void nrfx_power_residency_get(nrfx_power_residency_t * p_residency);
+#endif // NRFX_CHECK(NRFX_POWER_CONFIG_RESIDENCY_ENABLED) || defined(__NRFX_DOXYGEN__)
+
 #if NRF_POWER_HAS_USBREG || defined(__NRFX_DOXYGEN__)
 /**
  * @brief Function for initializing the processing of USB power event.
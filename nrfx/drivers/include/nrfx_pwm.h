@@ -191,8 +191,33 @@ typedef enum
     NRFX_PWM_EVT_END_SEQ1, /**< End of sequence 1 reached. Its data can be
                                 safely modified now. */
     NRFX_PWM_EVT_STOPPED,  ///< The PWM peripheral has been stopped.
+#if NRFX_CHECK(NRFX_PWM_CONFIG_STREAM_ENABLED) || defined(__NRFX_DOXYGEN__)
+    NRFX_PWM_EVT_STREAM_CHUNK_DONE, /**< A chunk of the stream has been played
+                                         and can be filled again. */
+    NRFX_PWM_EVT_STREAM_UNDERRUN,   /**< No chunk was committed in time and
+                                         the idle sequence is played instead. */
+#endif
 } nrfx_pwm_evt_type_t;
 
+#if NRFX_CHECK(NRFX_PWM_CONFIG_STREAM_ENABLED) || defined(__NRFX_DOXYGEN__)
+/** @brief PWM streaming configuration structure. */
+typedef struct
+{
+    uint16_t *                 p_ring;       ///< Memory for the ring of chunks.
+                                             /**< Values are stored in the format
+                                              *   selected by the decoder load mode. */
+    uint16_t                   chunk_length; ///< Number of 16-bit entries in a single chunk.
+    uint16_t                   chunk_count;  ///< Number of chunks in the ring. Must be at least 2.
+                                             /**< Two chunks are always owned by the peripheral,
+                                              *   so at least 3 are needed to fill ahead. */
+    uint16_t                   prefill;      ///< Number of chunks filled before the start.
+                                             /**< Must be at least 2. */
+    uint32_t                   repeats;      ///< Number of times each value is repeated.
+                                             /**< See @ref nrf_pwm_sequence_t::repeats. */
+    nrf_pwm_sequence_t const * p_idle;       ///< Sequence played when no chunk is available.
+} nrfx_pwm_stream_config_t;
+#endif
+
 /** @brief PWM driver event handler type. */
 typedef void (* nrfx_pwm_handler_t)(nrfx_pwm_evt_type_t event_type, void * p_context);
 
@@ -303,6 +328,58 @@ uint32_t nrfx_pwm_complex_playback(nrfx_pwm_t const *         p_instance,
                                    uint16_t                   playback_count,
                                    uint32_t                   flags);
 
+#if NRFX_CHECK(NRFX_PWM_CONFIG_STREAM_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Function for starting the playback of a stream of duty cycle values.
+ *
+ * The stream is kept in a circular buffer of chunks. Both sequences of
+ * the peripheral are used alternately, and whenever one of them ends,
+ * the driver points it at the next committed chunk from its interrupt
+ * handler. The stream therefore has no length limit. The application fills
+ * chunks with @ref nrfx_pwm_stream_chunk_get and
+ * @ref nrfx_pwm_stream_chunk_commit. When a chunk has been played, the event
+ * handler, if defined, receives @ref NRFX_PWM_EVT_STREAM_CHUNK_DONE. If no
+ * chunk is committed in time, the idle sequence is played in its place and
+ * @ref NRFX_PWM_EVT_STREAM_UNDERRUN is reported. The first @c prefill chunks
+ * of the ring must be filled before this function is called.
+ *
+ * The playback continues until @ref nrfx_pwm_stop is called.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ * @param[in] p_config   Pointer to the stream configuration.
+ *
+ * @retval NRFX_SUCCESS             The stream was started.
+ * @retval NRFX_ERROR_INVALID_STATE A playback is in progress.
+ */
+nrfx_err_t nrfx_pwm_stream_start(nrfx_pwm_t const *               p_instance,
+                                 nrfx_pwm_stream_config_t const * p_config);
+
+/**
+ * @brief Function for getting the chunk of the stream to be filled next.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ *
+ * @return Pointer to the chunk or NULL if all chunks are in use.
+ */
+uint16_t * nrfx_pwm_stream_chunk_get(nrfx_pwm_t const * p_instance);
+
+/**
+ * @brief Function for committing the chunk obtained with @ref nrfx_pwm_stream_chunk_get.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ */
+void nrfx_pwm_stream_chunk_commit(nrfx_pwm_t const * p_instance);
+
+/**
+ * @brief Function for getting the number of underruns since the stream was started.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ *
+ * @return Number of times the idle sequence was played instead of a chunk.
+ */
+uint32_t nrfx_pwm_stream_underruns_get(nrfx_pwm_t const * p_instance);
+#endif
+
 /**
  * @brief Function for advancing the active sequence.
  *
@@ -167,6 +167,23 @@ typedef struct
  */
 typedef void (*nrfx_qdec_event_handler_t)(nrfx_qdec_event_t event, void * p_context);
 
+/** @brief QDEC report stored in the stream ring buffer. */
+typedef struct
+{
+    int32_t  acc;       /**< Accumulated transitions. */
+    uint32_t accdbl;    /**< Accumulated double transitions. */
+    uint32_t timestamp; /**< TIMER value captured at the REPORTRDY event. */
+} nrfx_qdec_stream_report_t;
+
+/** @brief QDEC report stream configuration. */
+typedef struct
+{
+    nrfx_qdec_stream_report_t * p_buffer;   /**< Ring buffer for reports. */
+    size_t                      size;       /**< Number of reports in @p p_buffer. At least 2. */
+    NRF_TIMER_Type *            p_timer;    /**< Running TIMER that provides timestamps. */
+    uint8_t                     cc_channel; /**< TIMER channel used for timestamps. */
+} nrfx_qdec_stream_config_t;
+
 /**
  * @brief Function for initializing QDEC.
  *
@@ -237,6 +254,61 @@ void nrfx_qdec_accumulators_read(nrfx_qdec_t const * p_instance,
                                  int32_t *           p_acc,
                                  uint32_t *          p_accdbl);
 
+/**
+ * @brief Function for starting the report stream.
+ *
+ * Each REPORTRDY event captures the TIMER value through (D)PPI at the moment of the event.
+ * The driver stores the accumulators together with that timestamp in the ring buffer.
+ * The application reads the reports in batches with @ref nrfx_qdec_stream_read.
+ * The event handler is not called for reports while the stream is active.
+ *
+ * @note The TIMER must be configured and started by the application.
+ * @note Each report is moved to the ring buffer in the QDEC interrupt, which must be
+ *       serviced within one report period.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ * @param[in] p_config   Pointer to the stream configuration.
+ *
+ * @retval NRFX_SUCCESS             The stream was started.
+ * @retval NRFX_ERROR_INVALID_STATE The driver is not enabled or the stream is already active.
+ * @retval NRFX_ERROR_NO_MEM        No (D)PPI channel available.
+ * @retval NRFX_ERROR_NOT_SUPPORTED The (D)PPI driver is not enabled.
+ */
+nrfx_err_t nrfx_qdec_stream_start(nrfx_qdec_t const *               p_instance,
+                                  nrfx_qdec_stream_config_t const * p_config);
+
+/**
+ * @brief Function for stopping the report stream.
+ *
+ * Reports that are still in the ring buffer are discarded.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ */
+void nrfx_qdec_stream_stop(nrfx_qdec_t const * p_instance);
+
+/**
+ * @brief Function for reading reports from the stream.
+ *
+ * @param[in]  p_instance Pointer to the driver instance structure.
+ * @param[out] p_reports  Array to be filled with the oldest reports.
+ * @param[in]  count      Size of @p p_reports.
+ *
+ * @return Number of reports read.
+ */
+size_t nrfx_qdec_stream_read(nrfx_qdec_t const *         p_instance,
+                             nrfx_qdec_stream_report_t * p_reports,
+                             size_t                      count);
+
+/**
+ * @brief Function for getting and clearing the number of reports lost because
+ *        the ring buffer was full.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ *
+ * @return Number of lost reports.
+ */
+uint32_t nrfx_qdec_stream_overrun_get(nrfx_qdec_t const * p_instance);
+
 /**
  * @brief Function for returning the address of the specified QDEC task.
  *
@@ -36,6 +36,9 @@
 
 #include <nrfx.h>
 #include <hal/nrf_qspi.h>
+#if NRFX_CHECK(NRFX_QSPI_CONFIG_XIP_CACHE_ENABLED)
+#include <nrfx_cache.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -178,6 +181,42 @@ typedef struct
     } data;                              ///< Union to store event data.
 } nrfx_qspi_evt_ext_t;
 
+#if (NRFX_QSPI_CONFIG_QUEUE_SIZE > 0) || defined(__NRFX_DOXYGEN__)
+/** @brief QSPI queued request types. */
+typedef enum
+{
+    NRFX_QSPI_REQ_WRITE, /**< Write of a buffer. */
+    NRFX_QSPI_REQ_READ,  /**< Read into a buffer. */
+    NRFX_QSPI_REQ_ERASE, /**< Erase of a memory area. */
+} nrfx_qspi_req_type_t;
+
+/** @brief QSPI queued request. */
+typedef struct
+{
+    nrfx_qspi_req_type_t type;      /**< Request type. */
+    void *               p_buffer;  /**< Pointer to the data buffer. Not used by erase requests. */
+    size_t               size;      /**< Data buffer size. Not used by erase requests. */
+    uint32_t             addr;      /**< Start address in memory. */
+    nrf_qspi_erase_len_t erase_len; /**< Erase length. Used only by erase requests. */
+} nrfx_qspi_req_t;
+#endif
+
+#if NRFX_CHECK(NRFX_QSPI_CONFIG_STREAM_ENABLED) || defined(__NRFX_DOXYGEN__)
+/** @brief Configuration of the QSPI stream. */
+typedef struct
+{
+    bool                          write;        /**< True to write the region, false to read it. */
+    uint32_t                      addr;         /**< Start address of the region in memory. */
+    size_t                        size;         /**< Size of the region. */
+    void *                        p_buffers[2]; /**< Chunk buffers, used alternately. */
+    size_t                        chunk_size;   /**< Size of each chunk buffer. Multiple of 4. */
+#if NRF_QSPI_HAS_DMA_ENC || defined(__NRFX_DOXYGEN__)
+    nrf_qspi_encryption_t const * p_encryption; /**< DMA encryption of the region.
+                                                     NULL to keep the current setting. */
+#endif
+} nrfx_qspi_stream_config_t;
+#endif
+
 /** @brief QSPI driver event handler type. */
 typedef void (*nrfx_qspi_handler_t)(nrfx_qspi_evt_t event, void * p_context);
 
@@ -243,6 +282,13 @@ void nrfx_qspi_uninit(void);
  * To utilize double-buffering feature, @ref NRF_QSPI_TASK_READSTART needs to be triggered
  * on @ref NRF_QSPI_EVENT_READY externally (for example by using the PPI/DPPI).
  *
+ * If @ref NRFX_QSPI_CONFIG_READ_CACHE_LINES is not 0, reads in blocking mode are served from
+ * a read cache of that many lines of @ref NRFX_QSPI_CONFIG_READ_CACHE_LINE_SIZE bytes.
+ * A missing line is read from the memory device, replacing the least recently used line.
+ * Reads through the cache can use any buffer and any length and address alignment.
+ * Reads longer than a line with an aligned buffer, length, and address bypass the cache.
+ * Writes and erases invalidate the cache.
+ *
  * @param[out] p_rx_buffer      Pointer to the receive buffer.
  * @param[in]  rx_buffer_length Size of the data to read.
  * @param[in]  src_address      Address in memory to read from.
@@ -323,6 +369,93 @@ nrfx_err_t nrfx_qspi_erase(nrf_qspi_erase_len_t length,
  */
 nrfx_err_t nrfx_qspi_chip_erase(void);
 
+#if (NRFX_QSPI_CONFIG_QUEUE_SIZE > 0) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Function for queuing a write, read, or erase request.
+ *
+ * Requests are executed in order from the interrupt handler, one after another, without
+ * waiting for the caller. The QSPI peripheral polls the write-in-progress bit of the memory
+ * device itself, so the next request is started as soon as the previous one is finished.
+ * For each finished request, the event handler is called with @ref NRFX_QSPI_EVENT_DONE and
+ * the request is described by the extended event, see @ref nrfx_qspi_event_extended_get().
+ *
+ * A write request that continues the last queued write request, both in memory and in the
+ * data buffer, is merged with it into a single operation, for which one event is generated.
+ *
+ * If @ref NRFX_QSPI_CONFIG_READ_AHEAD_SIZE is not 0, the driver reads the data following the last
+ * read request into its cache when the queue is empty. A read request served from the cache
+ * is completed without accessing the memory device. Write and erase requests invalidate
+ * the cache.
+ *
+ * @note Other operations of the driver return @ref NRFX_ERROR_BUSY while queued requests
+ *       or read-ahead are being executed.
+ * @note The request structure is copied by the driver, but the data buffer must remain valid
+ *       until the request is finished.
+ *
+ * @param[in] p_req Pointer to the request.
+ *
+ * @retval NRFX_SUCCESS            The request was queued.
+ * @retval NRFX_ERROR_FORBIDDEN    The driver works in blocking mode.
+ * @retval NRFX_ERROR_NO_MEM       The queue is full.
+ * @retval NRFX_ERROR_INVALID_ADDR The provided buffer is not placed in the Data RAM region
+ *                                 or its address is not aligned to a 32-bit word,
+ *                                 or the erase address is not aligned to a 32-bit word.
+ */
+nrfx_err_t nrfx_qspi_request_queue(nrfx_qspi_req_t const * p_req);
+#endif
+
+#if (NRFX_QSPI_CONFIG_READ_CACHE_LINES > 0) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Function for invalidating the read cache.
+ *
+ * Writes and erases done by the driver invalidate the cache. This function must be called
+ * after the memory content is changed by other means, for example by custom instructions.
+ */
+void nrfx_qspi_read_cache_invalidate(void);
+#endif
+
+#if NRFX_CHECK(NRFX_QSPI_CONFIG_STREAM_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Function for starting a stream that reads or writes a large region in chunks.
+ *
+ * The region is transferred in chunks of the configured size, alternating between the two
+ * chunk buffers. When a chunk is finished, the driver starts the next one from the interrupt
+ * handler before it calls the event handler with @ref NRFX_QSPI_EVENT_DONE. The finished chunk
+ * is described by the extended event, see @ref nrfx_qspi_event_extended_get(). In this way
+ * the processing of a chunk by the application overlaps with the transfer of the following one.
+ *
+ * When reading, the data of a chunk must be consumed before the following chunk is finished,
+ * because its buffer is then reused. When writing, both buffers must contain the first two
+ * chunks before the stream is started. A buffer reported as written must be filled
+ * with the chunk after the next one before the next one is finished.
+ *
+ * With DMA encryption, the peripheral encrypts written data and decrypts read data
+ * on the fly during the EasyDMA transfers. The encryption of the region is applied when
+ * the stream starts, and it is disabled after the stream if it was configured by the stream.
+ *
+ * @note Other operations of the driver return @ref NRFX_ERROR_BUSY while the stream
+ *       is being executed.
+ *
+ * @param[in] p_config Pointer to the stream configuration.
+ *
+ * @retval NRFX_SUCCESS            The stream is started.
+ * @retval NRFX_ERROR_FORBIDDEN    The driver works in blocking mode.
+ * @retval NRFX_ERROR_BUSY         The driver currently handles another operation.
+ * @retval NRFX_ERROR_INVALID_ADDR The chunk buffers are not placed in the Data RAM region
+ *                                 or they are not aligned to a 32-bit word,
+ *                                 or the region address is not aligned to a 32-bit word.
+ */
+nrfx_err_t nrfx_qspi_stream_start(nrfx_qspi_stream_config_t const * p_config);
+
+/**
+ * @brief Function for stopping the stream.
+ *
+ * The ongoing chunk is finished without an event and no further chunks are started.
+ * The driver becomes idle when the ongoing chunk is finished.
+ */
+void nrfx_qspi_stream_stop(void);
+#endif
+
 /**
  * @brief Function for getting the extended event associated with finished operation.
  *
@@ -349,6 +482,38 @@ bool nrfx_qspi_xfer_buffered_check(void);
  */
 nrfx_err_t nrfx_qspi_mem_busy_check(void);
 
+#if NRFX_CHECK(NRFX_QSPI_CONFIG_SUSPEND_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Function for reading data from the memory device with bounded latency.
+ *
+ * If the memory device is busy with an erase or a program operation, the operation
+ * is suspended with the @ref NRFX_QSPI_CONFIG_SUSPEND_OPCODE instruction, the data
+ * is read, and the suspended operation is resumed with the @ref NRFX_QSPI_CONFIG_RESUME_OPCODE
+ * instruction. Thanks to that, the read does not have to wait until a long erase is finished.
+ *
+ * The function always works in the blocking mode. It can be called when the driver is
+ * idle, also after the erase operation started in the handler mode is reported as done
+ * while the memory device is still executing it.
+ *
+ * @note The memory device must support suspending of the operation it executes.
+ *       Reading from the block being erased or programmed returns undefined data.
+ *
+ * @param[out] p_rx_buffer      Pointer to the receive buffer.
+ * @param[in]  rx_buffer_length Size of the data to read.
+ * @param[in]  src_address      Address in memory to read from.
+ *
+ * @retval NRFX_SUCCESS            The operation was successful.
+ * @retval NRFX_ERROR_BUSY         The driver currently handles other operation.
+ * @retval NRFX_ERROR_INVALID_ADDR The provided buffer is not placed in the Data RAM region
+ *                                 or its address is not aligned to a 32-bit word.
+ * @retval NRFX_ERROR_TIMEOUT      The memory device did not suspend the ongoing operation
+ *                                 or the read did not finish on time.
+ */
+nrfx_err_t nrfx_qspi_read_urgent(void *   p_rx_buffer,
+                                 size_t   rx_buffer_length,
+                                 uint32_t src_address);
+#endif
+
 /**
  * @brief Function for sending operation code, sending data, and receiving data from the memory device.
  *
@@ -463,6 +628,47 @@ nrfx_err_t nrfx_qspi_xip_encrypt(nrf_qspi_encryption_t const * p_config);
 nrfx_err_t nrfx_qspi_dma_encrypt(nrf_qspi_encryption_t const * p_config);
 #endif
 
+#if NRFX_CHECK(NRFX_QSPI_CONFIG_XIP_CACHE_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Function for starting the measurement of the XIP cache hit rate.
+ *
+ * The profiling counters of the CACHE peripheral are cleared and the profiling is started.
+ * The counters are shared with the flash region, so this function also restarts
+ * any measurement of the flash region performed with the CACHE driver.
+ */
+void nrfx_qspi_xip_profiling_start(void);
+
+/**
+ * @brief Function for stopping the measurement of the XIP cache hit rate.
+ *
+ * @param[out] p_profile Pointer to the structure to be filled with the XIP region counters.
+ *                       Can be NULL if only the hit rate is needed.
+ *
+ * @return XIP hit rate in parts per thousand, or 0 if no XIP fetch was counted.
+ */
+uint32_t nrfx_qspi_xip_profiling_stop(nrfx_cache_profile_t * p_profile);
+
+/**
+ * @brief Function for prefetching a part of the XIP region into the cache and locking it there.
+ *
+ * The range is read through the XIP interface, so that it is brought into the cache,
+ * and then the cache update lock is set. See @ref nrfx_cache_range_lock for the limitations.
+ * Use it for code executed from the external memory that is sensitive to the XIP latency.
+ *
+ * @note The cache is not updated when the external memory is modified. After a write or
+ *       an erase operation that affects the XIP-mapped area, call @ref nrfx_cache_invalidate
+ *       and lock the range again.
+ *
+ * @param[in] p_xip_addr Start address of the range in the XIP address space.
+ * @param[in] size       Size of the range in bytes.
+ *
+ * @retval NRFX_SUCCESS             The range was prefetched and locked.
+ * @retval NRFX_ERROR_INVALID_STATE The driver is not initialized.
+ * @retval NRFX_ERROR_BUSY          The driver currently handles another operation.
+ */
+nrfx_err_t nrfx_qspi_xip_prefetch(void const * p_xip_addr, size_t size);
+#endif
+
 /** @} */
 
 
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_RAM_H__
+#define NRFX_RAM_H__
+
+#include <nrfx.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_ram RAM power driver
+ * @{
+ * @ingroup nrf_power
+ * @brief   Driver for powering down and disabling retention of unused RAM sections.
+ *
+ * The driver keeps a reference count of the users of each RAM section. The sections used by
+ * the application image, which are given to @ref nrfx_ram_init from the linker-provided
+ * symbols, are always in use. Other sections can be marked as used at runtime with
+ * @ref nrfx_ram_region_keep, for example when a large buffer is allocated from a memory pool,
+ * and released with @ref nrfx_ram_region_release.
+ *
+ * @ref nrfx_ram_sleep_enter powers off the sections that are not in use and enables retention
+ * only of the sections that are, using the POWER peripheral on nRF52 Series SoCs and the VMC
+ * peripheral on nRF53 and nRF91 Series SoCs. The previous configuration is restored with
+ * @ref nrfx_ram_sleep_exit. The content of a section that is not in use is lost.
+ */
+
+/** @brief RAM region. */
+typedef struct
+{
+    void const * p_start; ///< Start of the region.
+    size_t       size;    ///< Size of the region in bytes.
+} nrfx_ram_region_t;
+
+/**
+ * @brief Function for initializing the RAM power driver.
+ *
+ * The regions used by the application image must cover all the statically allocated data,
+ * the heap and the stack, for example the range from the start of the data section to the top
+ * of the stack, as registered by the linker script.
+ *
+ * @param[in] p_used Array of the regions used by the application image.
+ * @param[in] count  Number of the regions.
+ *
+ * @retval NRFX_SUCCESS                   The driver was successfully initialized.
+ * @retval NRFX_ERROR_ALREADY_INITIALIZED The driver is already initialized.
+ * @retval NRFX_ERROR_INVALID_PARAM       A region lies outside the RAM.
+ */
+nrfx_err_t nrfx_ram_init(nrfx_ram_region_t const * p_used, size_t count);
+
+/** @brief Function for uninitializing the RAM power driver. */
+void nrfx_ram_uninit(void);
+
+/**
+ * @brief Function for marking a RAM region as used.
+ *
+ * The sections that overlap the region are kept powered and retained in sleep until the region
+ * is released with @ref nrfx_ram_region_release.
+ *
+ * @param[in] p_start Start of the region.
+ * @param[in] size    Size of the region in bytes.
+ *
+ * @retval NRFX_SUCCESS             The region was marked as used.
+ * @retval NRFX_ERROR_INVALID_PARAM The region lies outside the RAM.
+ */
+nrfx_err_t nrfx_ram_region_keep(void const * p_start, size_t size);
+
+/**
+ * @brief Function for releasing a RAM region marked as used with @ref nrfx_ram_region_keep.
+ *
+ * @param[in] p_start Start of the region.
+ * @param[in] size    Size of the region in bytes.
+ *
+ * @retval NRFX_SUCCESS             The region was released.
+ * @retval NRFX_ERROR_INVALID_PARAM The region lies outside the RAM.
+ * @retval NRFX_ERROR_INVALID_STATE The region is not marked as used.
+ */
+nrfx_err_t nrfx_ram_region_release(void const * p_start, size_t size);
+
+/**
+ * @brief Function for getting the size of the RAM that is not in use.
+ *
+ * @return Total size of the sections powered off by @ref nrfx_ram_sleep_enter, in bytes.
+ */
+size_t nrfx_ram_unused_size_get(void);
+
+/**
+ * @brief Function for preparing the RAM for sleep.
+ *
+ * The sections that are not in use are powered off and have retention disabled, and retention
+ * of the sections in use is enabled, so that they are retained in System OFF mode as well.
+ *
+ * @note The function must be called with interrupts disabled, right before entering sleep.
+ */
+void nrfx_ram_sleep_enter(void);
+
+/**
+ * @brief Function for restoring the RAM configuration after sleep.
+ *
+ * The configuration from before the call to @ref nrfx_ram_sleep_enter is restored.
+ * The content of the sections that were powered off is undefined.
+ */
+void nrfx_ram_sleep_exit(void);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_RAM_H__
@@ -52,6 +52,11 @@ typedef struct
 {
     bool     error_correction : 1;  /**< Error correction flag. */
     uint8_t  interrupt_priority;    /**< Interrupt priority. */
+#if NRFX_CHECK(NRFX_RNG_CONFIG_POOL_ENABLED) || defined(__NRFX_DOXYGEN__)
+    uint8_t * p_pool;               /**< Entropy pool memory. NULL if the pool is not used. */
+    uint16_t  pool_size;            /**< Size of the entropy pool in bytes. */
+    uint16_t  pool_threshold;       /**< Fill level in bytes below which the pool is refilled. */
+#endif
 } nrfx_rng_config_t;
 
 /**
@@ -78,8 +83,16 @@ typedef void (* nrfx_rng_evt_handler_t)(uint8_t rng_data);
 /**
  * @brief Function for initializing the nrfx_rng module.
  *
+ * When @ref nrfx_rng_config_t::p_pool is set, the driver operates in the entropy pool mode.
+ * The pool is filled in the background with error correction enabled, and random values
+ * are taken from it with @ref nrfx_rng_bytes_get. The peripheral runs only while the fill
+ * level is below @ref nrfx_rng_config_t::pool_threshold or until the pool is full.
+ * In that mode, @p handler is not used and can be NULL, and the functions
+ * @ref nrfx_rng_start and @ref nrfx_rng_stop must not be used.
+ *
  * @param[in] p_config Pointer to the structure with the initial configuration.
- * @param[in] handler  Event handler provided by the user. Must not be NULL.
+ * @param[in] handler  Event handler provided by the user. Must not be NULL,
+ *                     unless the entropy pool mode is used.
  *
  * @retval NRFX_SUCCESS                   Driver was successfully initialized.
  * @retval NRFX_ERROR_ALREADY_INITIALIZED Driver was already initialized.
@@ -100,6 +113,24 @@ void nrfx_rng_start(void);
  */
 void nrfx_rng_stop(void);
 
+#if NRFX_CHECK(NRFX_RNG_CONFIG_POOL_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Function for getting random bytes from the entropy pool.
+ *
+ * The function does not wait for new values. If the fill level drops below the threshold,
+ * the background refill is started.
+ *
+ * @note The function is available only when the driver is in the entropy pool mode.
+ *
+ * @param[out] p_data Pointer to the buffer for random bytes.
+ * @param[in]  length Number of bytes requested.
+ *
+ * @return Number of bytes written to @p p_data, which is less than @p length
+ *         if the pool does not hold enough bytes.
+ */
+size_t nrfx_rng_bytes_get(uint8_t * p_data, size_t length);
+#endif
+
 /** @brief Function for uninitializing the nrfx_rng module. */
 void nrfx_rng_uninit(void);
 
@@ -37,6 +37,10 @@
 #include <nrfx.h>
 #include <haly/nrfy_saadc.h>
 
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_TIMESTAMP_ENABLED)
+#include <haly/nrfy_timer.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -192,6 +196,10 @@ typedef struct
 {
     nrf_saadc_value_t * p_buffer; ///< Pointer to the buffer with converted samples.
     uint16_t            size;     ///< Number of samples in the buffer.
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_TIMESTAMP_ENABLED) || defined(__NRFX_DOXYGEN__)
+    uint32_t            timestamp; ///< TIMER value captured when the buffer was started.
+                                   ///< Valid only if timestamping is enabled.
+#endif
 } nrfx_saadc_done_evt_t;
 
 /** @brief SAADC driver limit event data. */
@@ -225,6 +233,28 @@ typedef struct
  */
 typedef void (* nrfx_saadc_event_handler_t)(nrfx_saadc_evt_t const * p_event);
 
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_PROCESS_HANDLER_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief SAADC buffer processing handler.
+ *
+ * The handler is called from the interrupt handler for each buffer filled in the advanced
+ * non-blocking mode, before @ref NRFX_SAADC_EVT_DONE is generated for that buffer.
+ * It can process the samples in place, for example filter and decimate them with
+ * a FIR decimation kernel such as arm_fir_decimate_q15() from CMSIS-DSP, so that
+ * no additional buffer is needed.
+ *
+ * @param[in,out] p_buffer  Pointer to the buffer with converted samples.
+ * @param[in]     size      Number of samples in the buffer.
+ * @param[in]     p_context Context passed to @ref nrfx_saadc_process_handler_set().
+ *
+ * @return Number of samples left in the buffer after processing, which is reported
+ *         in @ref nrfx_saadc_done_evt_t.size.
+ */
+typedef uint16_t (* nrfx_saadc_process_handler_t)(nrf_saadc_value_t * p_buffer,
+                                                  uint16_t            size,
+                                                  void *              p_context);
+#endif
+
 /**
  * @brief Function for initializing the SAADC driver.
  *
@@ -375,6 +405,140 @@ nrfx_err_t nrfx_saadc_advanced_mode_set(uint32_t                        channel_
  */
 nrfx_err_t nrfx_saadc_buffer_set(nrf_saadc_value_t * p_buffer, uint16_t size);
 
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_BUFFER_RING_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Function for supplying a ring of buffers for the continuous conversion
+ *        in the advanced non-blocking mode.
+ *
+ * The ring consists of @p count buffers of @p size samples each, placed one after another
+ * in the memory pointed to by @p p_buffer. The buffers are filled in order and the ring is
+ * used cyclically until the conversion is aborted with @ref nrfx_saadc_abort().
+ * @ref NRFX_SAADC_EVT_DONE is generated for every filled buffer and
+ * @ref NRFX_SAADC_EVT_BUF_REQ is not generated. A buffer must be processed before
+ * the conversion wraps around the ring, that is, within (@p count - 1) buffer periods.
+ *
+ * The next buffer is latched by the driver as soon as the previous one is started,
+ * without involving the event handler. If @ref nrfx_saadc_adv_config_t.start_on_end is set,
+ * the @ref NRF_SAADC_TASK_START is triggered on @ref NRF_SAADC_EVENT_END through
+ * a (D)PPI channel instead of from the interrupt handler, so the conversion continues
+ * even if servicing of the interrupt is delayed by up to one buffer period.
+ *
+ * @param[in] p_buffer Pointer to the memory of the ring.
+ * @param[in] size     Number of @ref nrf_saadc_value_t samples in each buffer of the ring.
+ * @param[in] count    Number of buffers in the ring. At least 2.
+ *
+ * @retval NRFX_SUCCESS                   The ring was supplied successfully.
+ * @retval NRFX_ERROR_INVALID_ADDR        The provided memory is not in the Data RAM region.
+ * @retval NRFX_ERROR_INVALID_LENGTH      The buffer size is not aligned to the number of activated
+ *                                        channels or is too long for the EasyDMA to handle, or
+ *                                        the ring has fewer than two buffers.
+ * @retval NRFX_ERROR_INVALID_STATE       The driver is not in the advanced non-blocking mode
+ *                                        or there is an ongoing conversion.
+ * @retval NRFX_ERROR_ALREADY_INITIALIZED A buffer is already set.
+ * @retval NRFX_ERROR_NO_MEM              There is no (D)PPI channel available.
+ */
+nrfx_err_t nrfx_saadc_buffer_ring_set(nrf_saadc_value_t * p_buffer, uint16_t size, uint8_t count);
+#endif
+
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_PROCESS_HANDLER_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Function for setting the handler processing filled buffers in the advanced
+ *        non-blocking mode.
+ *
+ * The START task for the next buffer is triggered before the handler is called, so the time
+ * spent in the handler does not delay the conversion. The handler must finish within one
+ * buffer period, like the event handler.
+ *
+ * @param[in] handler   Processing handler. NULL to disable processing.
+ * @param[in] p_context Context passed to the handler.
+ */
+void nrfx_saadc_process_handler_set(nrfx_saadc_process_handler_t handler, void * p_context);
+#endif
+
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_TIMESTAMP_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Function for enabling timestamps of buffers in the advanced non-blocking mode.
+ *
+ * The value of the TIMER instance is captured on @ref NRF_SAADC_EVENT_STARTED through
+ * a (D)PPI channel, so it does not depend on the interrupt latency. The captured value
+ * is read from the interrupt handler and reported in @ref nrfx_saadc_done_evt_t.timestamp.
+ * The TIMER instance must be configured and started by the user.
+ *
+ * @note The STARTED interrupt must be serviced before the next buffer is started,
+ *       otherwise the captured value is overwritten.
+ *
+ * @param[in] p_timer    TIMER instance capturing timestamps.
+ * @param[in] cc_channel Capture/compare channel of the TIMER instance.
+ *
+ * @retval NRFX_SUCCESS     Timestamps were enabled successfully.
+ * @retval NRFX_ERROR_BUSY  There is a conversion or calibration ongoing.
+ * @retval NRFX_ERROR_NO_MEM There is no (D)PPI channel available.
+ */
+nrfx_err_t nrfx_saadc_timestamp_enable(NRF_TIMER_Type *       p_timer,
+                                       nrf_timer_cc_channel_t cc_channel);
+
+/** @brief Function for disabling timestamps of buffers. */
+void nrfx_saadc_timestamp_disable(void);
+#endif
+
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_TRIGGER_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Function for enabling the external trigger of sampling in the advanced non-blocking mode.
+ *
+ * The given event is connected to @ref NRF_SAADC_TASK_SAMPLE through a (D)PPI channel and
+ * the driver no longer triggers sampling itself. With the internal timer enabled in
+ * @ref nrfx_saadc_adv_config_t.internal_timer_cc, a single event starts a burst of conversions
+ * that runs until the buffer is filled, so the CPU is woken up only by the END event.
+ * A typical source is the UP event of LPCOMP or COMP, allowing the CPU to sleep until the
+ * monitored signal crosses the threshold.
+ *
+ * @note The event source must be configured and started by the user. To avoid waking up
+ *       the CPU, its interrupt should not be enabled.
+ *
+ * @param[in] event_address Address of the event triggering sampling.
+ *
+ * @retval NRFX_SUCCESS      The trigger was enabled successfully.
+ * @retval NRFX_ERROR_BUSY   There is a conversion or calibration ongoing.
+ * @retval NRFX_ERROR_NO_MEM There is no (D)PPI channel available.
+ */
+nrfx_err_t nrfx_saadc_trigger_enable(uint32_t event_address);
+
+/** @brief Function for disabling the external trigger of sampling. */
+void nrfx_saadc_trigger_disable(void);
+#endif
+
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_SCAN_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Function for preparing repeated scans of all activated channels in the simple
+ *        blocking mode.
+ *
+ * The SAADC is enabled and the buffer is latched in EasyDMA once, so that each following
+ * @ref nrfx_saadc_scan_read only triggers sampling and waits for the END event. The buffer is
+ * latched again right after every scan, so the latching overlaps with the processing of the
+ * samples by the user. The SAADC stays enabled until @ref nrfx_saadc_abort is called, which
+ * also has to be done before the driver is reconfigured.
+ *
+ * @param[in] p_buffer Pointer to the result buffer. Its size must be equal to the number of
+ *                     channels activated in @ref nrfx_saadc_simple_mode_set.
+ *
+ * @retval NRFX_SUCCESS             The scan was prepared successfully.
+ * @retval NRFX_ERROR_INVALID_ADDR  The buffer is not placed in the Data RAM region.
+ * @retval NRFX_ERROR_INVALID_STATE The driver is not in the simple blocking mode.
+ */
+nrfx_err_t nrfx_saadc_scan_prepare(nrf_saadc_value_t * p_buffer);
+
+/**
+ * @brief Function for scanning all activated channels prepared by @ref nrfx_saadc_scan_prepare.
+ *
+ * The function blocks until a single sample of every activated channel is stored in
+ * the buffer. The buffer is overwritten by the next scan.
+ *
+ * @retval NRFX_SUCCESS             The scan finished successfully.
+ * @retval NRFX_ERROR_INVALID_STATE The scan is not prepared.
+ */
+nrfx_err_t nrfx_saadc_scan_read(void);
+#endif
+
 /**
  * @brief Function for triggering the conversion in the configured mode.
  *
@@ -436,6 +600,37 @@ nrfx_err_t nrfx_saadc_limits_set(uint8_t channel, int16_t limit_low, int16_t lim
  */
 nrfx_err_t nrfx_saadc_offset_calibrate(nrfx_saadc_event_handler_t calib_event_handler);
 
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_AUTO_CALIBRATION_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Function for recalibrating the SAADC offset when the temperature has changed.
+ *
+ * The offset error of the SAADC depends mostly on the temperature, so the calibration
+ * needs to be repeated only when the temperature has drifted away from the one at which
+ * the last calibration was made. The driver stores that temperature and runs the offset
+ * calibration only if the difference reaches @p threshold, or if no calibration has been
+ * made by this function yet.
+ *
+ * If the calibration is needed and the driver is idle, it is started right away, in the
+ * non-blocking manner if an event handler was provided during the mode configuration.
+ * If a conversion is ongoing, the calibration is postponed until the last buffer
+ * of the conversion is filled. It is then run before @ref NRFX_SAADC_EVT_FINISHED is
+ * generated, so the acquisition is paused only for the duration of the calibration and
+ * a new one started from the event handler already uses the new calibration.
+ * In both non-blocking cases, @ref NRFX_SAADC_EVT_CALIBRATEDONE is generated.
+ *
+ * @param[in] temperature Current temperature, for example the result of
+ *                        @ref nrfx_temp_calculate.
+ * @param[in] threshold   Temperature change triggering the recalibration,
+ *                        in the same units as @p temperature.
+ *
+ * @retval NRFX_SUCCESS    No calibration was needed, calibration finished successfully
+ *                         in the blocking manner or started in the non-blocking manner.
+ * @retval NRFX_ERROR_BUSY Calibration is needed but has been postponed until
+ *                         the ongoing conversion is finished.
+ */
+nrfx_err_t nrfx_saadc_auto_calibrate(int32_t temperature, uint32_t threshold);
+#endif
+
 /** @} */
 
 void nrfx_saadc_irq_handler(void);
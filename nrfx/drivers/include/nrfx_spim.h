@@ -191,6 +191,9 @@ typedef struct
 /** @brief Flag indicating that the transfer will be executed multiple times. */
 #define NRFX_SPIM_FLAG_REPEATED_XFER       (1UL << 4)
 
+/** @brief Flag indicating that the event handler will be called after each transfer of a list. */
+#define NRFX_SPIM_FLAG_LIST_EVT_PER_XFER   (1UL << 5)
+
 /** @brief Single transfer descriptor structure. */
 typedef nrfy_spim_xfer_desc_t nrfx_spim_xfer_desc_t;
 
@@ -225,7 +228,8 @@ typedef nrfy_spim_xfer_desc_t nrfx_spim_xfer_desc_t;
  */
 typedef enum
 {
-    NRFX_SPIM_EVENT_DONE, ///< Transfer done.
+    NRFX_SPIM_EVENT_DONE,       ///< Transfer done.
+    NRFX_SPIM_EVENT_BLOCK_DONE, ///< Block of a stream filled, described by the RX buffer.
 } nrfx_spim_evt_type_t;
 
 /** @brief SPIM event description with transmission details. */
@@ -239,6 +243,49 @@ typedef struct
 typedef void (* nrfx_spim_evt_handler_t)(nrfx_spim_evt_t const * p_event,
                                          void *                  p_context);
 
+#if NRFX_CHECK(NRFX_SPIM_CONFIG_XFER_LIST_ENABLED) || defined(__NRFX_DOXYGEN__)
+/** @brief Structure describing one transfer of a transfer list. */
+typedef struct
+{
+    nrfx_spim_xfer_desc_t xfer_desc;      ///< Transfer descriptor.
+    uint32_t              ss_pin;         ///< Slave Select pin number of the addressed device.
+                                          /**< Set to @ref NRF_SPIM_PIN_NOT_CONNECTED
+                                           *   if the device does not use Slave Select. */
+    bool                  ss_active_high; ///< Polarity of the Slave Select pin during transmission.
+    uint32_t              frequency;      ///< SPIM frequency in Hz for the transfer.
+    nrf_spim_mode_t       mode;           ///< SPIM mode for the transfer.
+    nrf_spim_bit_order_t  bit_order;      ///< SPIM bit order for the transfer.
+} nrfx_spim_list_xfer_t;
+#endif
+
+#if NRFX_CHECK(NRFX_SPIM_CONFIG_DISPLAY_ENABLED) || defined(__NRFX_DOXYGEN__)
+/** @brief Structure describing one segment of a display update. */
+typedef struct
+{
+    uint8_t const * p_cmd;       ///< Command byte followed by its parameters.
+    size_t          cmd_length;  ///< Length of the command including the parameters. At least 1.
+    uint8_t const * p_data;      ///< Pixel data sent after the command. NULL if not used.
+    size_t          data_length; ///< Length of the pixel data. Can exceed the EasyDMA limit.
+} nrfx_spim_display_xfer_t;
+#endif
+
+#if NRFX_CHECK(NRFX_SPIM_CONFIG_STREAM_ENABLED) || defined(__NRFX_DOXYGEN__)
+/** @brief Configuration of the SPIM stream. */
+typedef struct
+{
+    uint8_t const *  p_cmd;          ///< Command sent in each sample transfer.
+    size_t           cmd_length;     ///< Length of the command.
+    uint8_t *        p_buffer;       ///< Memory of the ring, holding @p block_count blocks.
+    size_t           sample_length;  ///< Number of bytes received in each sample transfer.
+    size_t           block_samples;  ///< Number of samples in a block.
+    uint8_t          block_count;    ///< Number of blocks in the ring. At least 2.
+    uint32_t         sample_rate;    ///< Sample rate in Hz.
+    NRF_TIMER_Type * p_sample_timer; ///< TIMER instance generating the sample clock.
+    NRF_TIMER_Type * p_count_timer;  ///< TIMER instance counting samples of a block.
+    uint8_t          irq_priority;   ///< Priority of the interrupt of @p p_count_timer.
+} nrfx_spim_stream_config_t;
+#endif
+
 /**
  * @brief Function for initializing the SPIM driver instance.
  *
@@ -300,6 +347,63 @@ nrfx_err_t nrfx_spim_reconfigure(nrfx_spim_t const *        p_instance,
  */
 void nrfx_spim_uninit(nrfx_spim_t const * p_instance);
 
+/** @brief Maximum number of registers stored in @ref nrfx_spim_retained_t. */
+#define NRFX_SPIM_RETAINED_REGS_MAX 12
+
+/**
+ * @brief Context of the SPIM driver instance to be kept in retained RAM.
+ *
+ * Its content is handled by the driver.
+ */
+typedef struct
+{
+    nrfy_reg_desc_t         regs[NRFX_SPIM_RETAINED_REGS_MAX]; ///< Stored registers.
+    uint8_t                 reg_count;                         ///< Number of stored registers.
+    uint8_t                 irq_priority;                      ///< Interrupt priority.
+    bool                    skip_gpio_cfg;                     ///< Skip GPIO handling.
+    bool                    ss_active_high;                    ///< Software Slave Select polarity.
+    uint32_t                ss_pin;                            ///< Software Slave Select pin.
+    nrfx_spim_evt_handler_t handler;                           ///< Event handler.
+    void *                  p_context;                         ///< Event handler context.
+} nrfx_spim_retained_t;
+
+/**
+ * @brief Function for suspending the SPIM driver instance.
+ *
+ * The configuration of the instance is stored in the context, the peripheral is disabled
+ * and the driver becomes uninitialized. Pins are left as they are, since GPIO configuration
+ * is kept in low-power modes, including System OFF.
+ *
+ * @param[in]  p_instance Pointer to the driver instance structure.
+ * @param[out] p_retained Pointer to the context, typically placed in retained RAM.
+ *
+ * @retval NRFX_SUCCESS             The instance was suspended.
+ * @retval NRFX_ERROR_BUSY          The driver is during transfer.
+ * @retval NRFX_ERROR_INVALID_STATE The driver is uninitialized.
+ */
+nrfx_err_t nrfx_spim_suspend(nrfx_spim_t const *    p_instance,
+                             nrfx_spim_retained_t * p_retained);
+
+/**
+ * @brief Function for resuming the SPIM driver instance.
+ *
+ * The driver is initialized from the context stored by @ref nrfx_spim_suspend, also after
+ * a wake-up from System OFF. Registers are written in a single pass and no pin configuration
+ * or configuration validation is done, which makes it faster than @ref nrfx_spim_init.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ * @param[in] p_retained Pointer to the context.
+ *
+ * @retval NRFX_SUCCESS             The instance was resumed.
+ * @retval NRFX_ERROR_INVALID_STATE The driver is already initialized.
+ * @retval NRFX_ERROR_BUSY          Some other peripheral with the same
+ *                                  instance ID is already in use. This is
+ *                                  possible only if @ref nrfx_prs module
+ *                                  is enabled.
+ */
+nrfx_err_t nrfx_spim_resume(nrfx_spim_t const *          p_instance,
+                            nrfx_spim_retained_t const * p_retained);
+
 /**
  * @brief Function for starting the SPIM data transfer.
  *
@@ -352,6 +456,136 @@ nrfx_err_t nrfx_spim_xfer(nrfx_spim_t const *           p_instance,
                           nrfx_spim_xfer_desc_t const * p_xfer_desc,
                           uint32_t                      flags);
 
+#if NRFX_CHECK(NRFX_SPIM_CONFIG_XFER_LIST_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Function for starting a list of SPIM transfers, possibly to different devices.
+ *
+ * The transfers are executed one after another from the SPIM interrupt, without
+ * the involvement of the caller. Before each transfer the driver applies its frequency,
+ * mode and bit order, and activates its Slave Select pin, which is deactivated when
+ * the transfer ends. The Slave Select pins of the list are configured as outputs by
+ * this function, unless GPIO configuration is skipped for the instance.
+ *
+ * By default a single @ref NRFX_SPIM_EVENT_DONE event is generated after the last
+ * transfer, with the descriptor of that transfer. When @ref NRFX_SPIM_FLAG_LIST_EVT_PER_XFER
+ * is set, the event is generated after each transfer of the list.
+ *
+ * The list must be kept intact until the last transfer is done. After the list, the driver
+ * restores the Slave Select configured for the instance, but the peripheral keeps frequency
+ * and mode of the last transfer. Use @ref nrfx_spim_reconfigure to change them.
+ *
+ * @note Peripherals using EasyDMA (including SPIM) require the transfer buffers
+ *       to be placed in the Data RAM region. If this condition is not met,
+ *       this function will fail with the error code NRFX_ERROR_INVALID_ADDR.
+ *
+ * @param p_instance Pointer to the driver instance structure.
+ * @param p_list     Pointer to the list of transfers.
+ * @param count      Number of transfers in the list.
+ * @param flags      Transfer options (0 or @ref NRFX_SPIM_FLAG_LIST_EVT_PER_XFER).
+ *
+ * @retval NRFX_SUCCESS             The procedure is successful.
+ * @retval NRFX_ERROR_BUSY          The driver is not ready for a new transfer.
+ * @retval NRFX_ERROR_FORBIDDEN     The driver works in blocking mode.
+ * @retval NRFX_ERROR_INVALID_PARAM One of the transfers uses an unsupported frequency.
+ * @retval NRFX_ERROR_INVALID_ADDR  The provided buffers are not placed in the Data
+ *                                  RAM region.
+ */
+nrfx_err_t nrfx_spim_xfer_list(nrfx_spim_t const *           p_instance,
+                               nrfx_spim_list_xfer_t const * p_list,
+                               size_t                        count,
+                               uint32_t                      flags);
+#endif
+
+#if NRFX_CHECK(NRFX_SPIM_CONFIG_DISPLAY_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Function for sending a batch of display command and pixel data segments.
+ *
+ * Each segment consists of a command byte, its parameters and optional pixel data,
+ * for example a window setting command followed by a memory write command with the pixels
+ * of that window. The DCX line is low during the command byte and high during the parameters
+ * and the pixel data. The segments are sent one after another from the SPIM interrupt,
+ * without the involvement of the caller. Pixel data longer than the EasyDMA limit of
+ * the instance is split into several transfers by the driver, so a whole framebuffer can be
+ * sent as a single segment.
+ *
+ * The Slave Select configured for the instance is kept active for the whole batch. A single
+ * @ref NRFX_SPIM_EVENT_DONE event is generated after the last segment. The segments and
+ * the buffers they point to must be kept intact until then.
+ *
+ * @note The instance must be initialized with the DCX pin configured.
+ *
+ * @note Peripherals using EasyDMA (including SPIM) require the transfer buffers
+ *       to be placed in the Data RAM region. If this condition is not met,
+ *       this function will fail with the error code NRFX_ERROR_INVALID_ADDR.
+ *
+ * @param p_instance Pointer to the driver instance structure.
+ * @param p_segments Pointer to the list of segments.
+ * @param count      Number of segments in the list.
+ *
+ * @retval NRFX_SUCCESS             The procedure is successful.
+ * @retval NRFX_ERROR_BUSY          The driver is not ready for a new transfer.
+ * @retval NRFX_ERROR_FORBIDDEN     The driver works in blocking mode.
+ * @retval NRFX_ERROR_NOT_SUPPORTED The instance does not support DCX.
+ * @retval NRFX_ERROR_INVALID_ADDR  The provided buffers are not placed in the Data
+ *                                  RAM region.
+ */
+nrfx_err_t nrfx_spim_display_xfer(nrfx_spim_t const *              p_instance,
+                                  nrfx_spim_display_xfer_t const * p_segments,
+                                  size_t                           count);
+#endif
+
+#if NRFX_CHECK(NRFX_SPIM_CONFIG_STREAM_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Function for starting a stream of periodic transfers.
+ *
+ * A TIMER instance triggers a transfer at the requested sample rate through a (D)PPI
+ * channel, so the sample clock does not depend on the interrupt latency. Each transfer
+ * sends the command and receives one sample, which EasyDMA ArrayList places right after
+ * the previous one. Another TIMER instance counts the transfers and generates an interrupt
+ * when a block of the ring is filled, which is reported with @ref NRFX_SPIM_EVENT_BLOCK_DONE.
+ * The CPU is not involved in single samples.
+ *
+ * The block must be processed before the stream wraps around the ring and overwrites it.
+ * The interrupt must be serviced within one sample period, because the driver moves
+ * the reception back to the beginning of the ring from the interrupt of the last block.
+ *
+ * @note The driver does not define the interrupt handler of @p p_count_timer.
+ *       Call @ref nrfx_spim_stream_irq_handler from that handler.
+ *
+ * @note The Slave Select configured for the instance is not used. Sample transfers
+ *       need a device that does not require Slave Select toggling or hardware Slave Select.
+ *
+ * @param p_instance Pointer to the driver instance structure.
+ * @param p_config   Pointer to the stream configuration.
+ *
+ * @retval NRFX_SUCCESS             The stream is started.
+ * @retval NRFX_ERROR_BUSY          The driver is not ready for a new transfer.
+ * @retval NRFX_ERROR_FORBIDDEN     The driver works in blocking mode.
+ * @retval NRFX_ERROR_INVALID_PARAM The sample rate cannot be generated by the TIMER.
+ * @retval NRFX_ERROR_NO_MEM        There are not enough (D)PPI channels available.
+ * @retval NRFX_ERROR_INVALID_ADDR  The provided buffers are not placed in the Data
+ *                                  RAM region.
+ */
+nrfx_err_t nrfx_spim_stream_start(nrfx_spim_t const *               p_instance,
+                                  nrfx_spim_stream_config_t const * p_config);
+
+/**
+ * @brief Function for stopping the stream.
+ *
+ * The samples of the block that is not filled yet are discarded.
+ *
+ * @param p_instance Pointer to the driver instance structure.
+ */
+void nrfx_spim_stream_stop(nrfx_spim_t const * p_instance);
+
+/**
+ * @brief Function for handling the interrupt of the TIMER instance counting samples.
+ *
+ * @param p_instance Pointer to the driver instance structure.
+ */
+void nrfx_spim_stream_irq_handler(nrfx_spim_t const * p_instance);
+#endif
+
 #if NRFX_CHECK(NRFX_SPIM_EXTENDED_ENABLED) || defined(__NRFX_DOXYGEN__)
 /**
  * @brief Function for starting the SPIM data transfer with DCX control.
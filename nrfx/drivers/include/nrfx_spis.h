@@ -254,6 +254,42 @@ nrfx_err_t nrfx_spis_buffers_set(nrfx_spis_t const * p_instance,
                                  uint8_t *           p_rx_buffer,
                                  size_t              rx_buffer_length);
 
+/**
+ * @brief Function for queuing buffers for the SPI transaction that follows the armed one.
+ *
+ * Buffers set with @ref nrfx_spis_buffers_set are used for one transaction only. Until the
+ * driver is prepared again, the slave responds with the DEF and ORC characters. This function
+ * lets the application queue the next buffer pair in advance. The driver then switches to it
+ * from the interrupt that ends the current transaction, before @ref NRFX_SPIS_XFER_DONE is
+ * reported. Back-to-back transactions are therefore limited only by the interrupt latency
+ * and not by the processing done in the event handler.
+ *
+ * When no transaction is armed, this function behaves like @ref nrfx_spis_buffers_set.
+ *
+ * @note @ref NRFX_SPIS_BUFFERS_SET_DONE for the queued buffers can be reported before
+ *       @ref NRFX_SPIS_XFER_DONE for the previous transaction.
+ *
+ * @note This function can be called from the callback function context.
+ *
+ * @param[in] p_instance       Pointer to the driver instance structure.
+ * @param[in] p_tx_buffer      Pointer to the TX buffer. Can be NULL when the buffer length is zero.
+ * @param[in] tx_buffer_length Length of the TX buffer in bytes.
+ * @param[in] p_rx_buffer      Pointer to the RX buffer. Can be NULL when the buffer length is zero.
+ * @param[in] rx_buffer_length Length of the RX buffer in bytes.
+ *
+ * @retval NRFX_SUCCESS              The buffers were queued or set.
+ * @retval NRFX_ERROR_BUSY           Another buffer pair is already queued.
+ * @retval NRFX_ERROR_INVALID_STATE  The SPI slave device is in an incorrect state.
+ * @retval NRFX_ERROR_INVALID_ADDR   The provided buffers are not placed in the Data
+ *                                   RAM region.
+ * @retval NRFX_ERROR_INVALID_LENGTH Provided lengths exceed the EasyDMA limits for the peripheral.
+ */
+nrfx_err_t nrfx_spis_next_buffers_set(nrfx_spis_t const * p_instance,
+                                      uint8_t const *     p_tx_buffer,
+                                      size_t              tx_buffer_length,
+                                      uint8_t *           p_rx_buffer,
+                                      size_t              rx_buffer_length);
+
 /**
  * @brief Macro returning SPIS interrupt handler.
  *
@@ -119,6 +119,55 @@ void nrfx_systick_delay_us(uint32_t us);
  */
 void nrfx_systick_delay_ms(uint32_t ms);
 
+/** @brief Structure for the sampling profiler configuration. */
+typedef struct
+{
+    uint32_t * p_bins;       ///< Histogram buffer. Each bin counts the samples of its address range.
+    uint32_t   bin_count;    ///< Number of bins in @p p_bins.
+    uint32_t   start_addr;   ///< Lowest code address covered by the histogram.
+    uint8_t    bin_shift;    ///< Binary logarithm of the size of the address range of a bin.
+    uint32_t   rate_hz;      ///< Sampling rate.
+    uint8_t    irq_priority; ///< SysTick interrupt priority.
+                             /**< Interrupt handlers of lower or equal priority cannot be
+                              *   sampled. */
+} nrfx_systick_profiler_config_t;
+
+/**
+ * @brief Function for starting the sampling profiler.
+ *
+ * The SysTick is reconfigured to generate an interrupt at @p rate_hz. On each interrupt,
+ * the address of the interrupted instruction is taken from the exception stack frame and the
+ * histogram bin covering that address is incremented. Samples outside of the histogram are
+ * counted separately, see @ref nrfx_systick_profiler_stop. The histogram is not cleared.
+ *
+ * The hot spots are found by matching the bins with the highest counts against the map file:
+ * bin @p n covers the addresses from @p start_addr + (@p n << @p bin_shift).
+ *
+ * @note The delay and timeout functions of the driver must not be used while the profiler
+ *       is running, as they require the SysTick to be free-running.
+ * @note @ref nrfx_systick_irq_handler must be installed as the SysTick exception handler.
+ *
+ * @param[in] p_config Pointer to the structure with the profiler configuration.
+ */
+void nrfx_systick_profiler_start(nrfx_systick_profiler_config_t const * p_config);
+
+/**
+ * @brief Function for stopping the sampling profiler.
+ *
+ * The SysTick is configured back as a free-running timer.
+ *
+ * @return Number of samples that were outside of the histogram.
+ */
+uint32_t nrfx_systick_profiler_stop(void);
+
+/**
+ * @brief SysTick exception handler sampling the interrupted code address.
+ *
+ * @note The handler is available only for compilers supporting GCC extensions,
+ *       as it must read the exception stack frame before any register is stacked.
+ */
+void nrfx_systick_irq_handler(void);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -69,6 +69,30 @@ typedef struct
  */
 typedef void (* nrfx_temp_data_handler_t)(int32_t temperature);
 
+/**
+ * @brief TEMP driver change notification handler type.
+ *
+ * @param temperature Temperature in Celsius scale, multiplied by 100.
+ * @param p_context   Context passed in the subscriber structure.
+ */
+typedef void (* nrfx_temp_notify_handler_t)(int32_t temperature, void * p_context);
+
+/**
+ * @brief Structure of a temperature change subscriber.
+ *
+ * The structure is linked into a list by the driver, so it must stay valid as long as
+ * the subscriber is registered. Fields marked as internal must not be modified by the user.
+ */
+typedef struct nrfx_temp_subscriber_s
+{
+    nrfx_temp_notify_handler_t      handler;   ///< Change notification handler.
+    void *                          p_context; ///< Context passed to the handler.
+    int32_t                         threshold; ///< Minimum change to be notified, in 0.01[C].
+    int32_t                         reported;  ///< Internal. Last notified temperature.
+    bool                            notified;  ///< Internal. True if notified at least once.
+    struct nrfx_temp_subscriber_s * p_next;    ///< Internal. Next subscriber on the list.
+} nrfx_temp_subscriber_t;
+
 /**
  * @brief Function for initializing the TEMP driver.
  *
@@ -135,6 +159,65 @@ int32_t nrfx_temp_calculate(int32_t raw_measurement);
  */
 nrfx_err_t nrfx_temp_measure(void);
 
+/**
+ * @brief Function for registering a temperature change subscriber.
+ *
+ * The subscriber handler is called from the TEMP interrupt after the first measurement
+ * that follows the registration and then only when the temperature differs from the
+ * last notified value by at least the threshold specified in the subscriber structure.
+ * Measurements can be started by any user with @ref nrfx_temp_measure() or periodically
+ * with @ref nrfx_temp_periodic_start().
+ *
+ * @note Subscribers are supported only in the non-blocking mode.
+ *
+ * @param[in] p_subscriber Pointer to the subscriber structure.
+ *
+ * @retval NRFX_SUCCESS             The subscriber was registered.
+ * @retval NRFX_ERROR_INVALID_STATE The driver is initialized in blocking mode.
+ */
+nrfx_err_t nrfx_temp_subscribe(nrfx_temp_subscriber_t * p_subscriber);
+
+/**
+ * @brief Function for removing a temperature change subscriber.
+ *
+ * @param[in] p_subscriber Pointer to the subscriber structure.
+ */
+void nrfx_temp_unsubscribe(nrfx_temp_subscriber_t * p_subscriber);
+
+/**
+ * @brief Function for starting periodic temperature measurements.
+ *
+ * The START task of TEMP is connected with (G)PPI to the specified event, for example
+ * an RTC compare or TICK event, so that measurements are started without CPU
+ * involvement. Every measurement result is passed to the data handler and
+ * to the subscribers whose threshold is exceeded.
+ *
+ * @note Periodic measurements are supported only in the non-blocking mode.
+ *
+ * @param[in] event_address Address of the event that starts each measurement.
+ *
+ * @retval NRFX_SUCCESS             Periodic measurements were started.
+ * @retval NRFX_ERROR_INVALID_STATE The driver is initialized in blocking mode or
+ *                                  periodic measurements are already started.
+ * @retval NRFX_ERROR_NO_MEM        No free (G)PPI channel.
+ */
+nrfx_err_t nrfx_temp_periodic_start(uint32_t event_address);
+
+/** @brief Function for stopping periodic temperature measurements. */
+void nrfx_temp_periodic_stop(void);
+
+/**
+ * @brief Function for getting the most recent temperature measured in the non-blocking mode.
+ *
+ * This allows users to get a fresh value without triggering an additional measurement.
+ *
+ * @param[out] p_temperature Temperature in Celsius scale, multiplied by 100.
+ *
+ * @retval true  The temperature was stored in @p p_temperature.
+ * @retval false No measurement was completed yet.
+ */
+bool nrfx_temp_last_get(int32_t * p_temperature);
+
 #ifndef NRFX_DECLARE_ONLY
 NRFX_STATIC_INLINE int32_t nrfx_temp_result_get(void)
 {
@@ -42,6 +42,59 @@ extern "C" {
 
 nrfx_err_t nrfx_twi_twim_bus_recover(uint32_t scl_pin, uint32_t sda_pin);
 
+#if NRFX_CHECK(NRFX_GPIOTE_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Bus recovery completion handler prototype.
+ *
+ * @param[in] result    @ref NRFX_SUCCESS if the bus has been released,
+ *                      @ref NRFX_ERROR_INTERNAL if SDA is still held low.
+ * @param[in] p_context User context.
+ */
+typedef void (*nrfx_twi_twim_bus_recover_handler_t)(nrfx_err_t result, void * p_context);
+
+/** @brief Structure for the non-blocking bus recovery configuration. */
+typedef struct
+{
+    uint32_t                            scl_pin;      ///< SCL pin number.
+    uint32_t                            sda_pin;      ///< SDA pin number.
+    NRF_TIMER_Type *                    p_timer;      ///< TIMER instance timing the recovery.
+    uint8_t                             irq_priority; ///< Priority of the interrupt of @p p_timer.
+    nrfx_twi_twim_bus_recover_handler_t handler;      ///< Handler called when the recovery is done.
+    void *                              p_context;    ///< Context passed to @p handler.
+} nrfx_twi_twim_bus_recover_config_t;
+
+/**
+ * @brief Function for starting the non-blocking recovery of a stuck bus.
+ *
+ * The sequence is the same as in @ref nrfx_twi_twim_bus_recover, but the clock pulses are
+ * generated on SCL by @p p_timer connected over (D)PPI to a GPIOTE channel, and the CPU is
+ * involved only in the interrupt of @p p_timer, once per edge, to check SDA. The handler
+ * is called from that interrupt when the recovery is done.
+ *
+ * @note The GPIOTE driver must be initialized. One GPIOTE channel and one (D)PPI channel are
+ *       allocated for the time of the recovery.
+ * @note The driver does not define the interrupt handler of @p p_timer.
+ *       Call @ref nrfx_twi_twim_bus_recover_irq_handler from that handler.
+ * @note The interrupt of @p p_timer must be served within 4 us, which is the half period
+ *       of the generated clock.
+ *
+ * @param[in] p_config Pointer to the structure with the recovery configuration.
+ *
+ * @retval NRFX_SUCCESS             The recovery has been started.
+ * @retval NRFX_ERROR_BUSY          A recovery is already in progress.
+ * @retval NRFX_ERROR_NO_MEM        No GPIOTE or (D)PPI channel is available.
+ * @retval NRFX_ERROR_INVALID_PARAM The GPIOTE driver rejected the SCL pin configuration.
+ */
+nrfx_err_t nrfx_twi_twim_bus_recover_start(nrfx_twi_twim_bus_recover_config_t const * p_config);
+
+/**
+ * @brief Function for handling the interrupt of the TIMER instance used for the bus recovery.
+ *
+ * @param[in] p_timer TIMER instance that generated the interrupt.
+ */
+void nrfx_twi_twim_bus_recover_irq_handler(NRF_TIMER_Type * p_timer);
+#endif // NRFX_CHECK(NRFX_GPIOTE_ENABLED) || defined(__NRFX_DOXYGEN__)
+
 #ifdef __cplusplus
 }
 #endif
@@ -136,7 +136,8 @@ typedef enum
     NRFX_TWIM_EVT_ADDRESS_NACK, ///< Error event: NACK received after sending the address.
     NRFX_TWIM_EVT_DATA_NACK,    ///< Error event: NACK received after sending a data byte.
     NRFX_TWIM_EVT_OVERRUN,      ///< Error event: The unread data is replaced by new data.
-    NRFX_TWIM_EVT_BUS_ERROR     ///< Error event: An unexpected transition occurred on the bus.
+    NRFX_TWIM_EVT_BUS_ERROR,    ///< Error event: An unexpected transition occurred on the bus.
+    NRFX_TWIM_EVT_BLOCK_DONE,   ///< Block of a stream filled, described by the secondary buffer.
 } nrfx_twim_evt_type_t;
 
 /** @brief TWI master driver transfer types. */
@@ -186,6 +187,38 @@ typedef struct
 #define NRFX_TWIM_XFER_DESC_TXTX(addr, p_tx, tx_len, p_tx2, tx_len2) \
         NRFX_TWIM_XFER_DESC(NRFX_TWIM_XFER_TXTX, addr, p_tx, tx_len, p_tx2, tx_len2)
 
+#if NRFX_CHECK(NRFX_TWIM_CONFIG_MSG_LIST_ENABLED) || defined(__NRFX_DOXYGEN__)
+/** @brief Structure for a single message of a TWI transaction. */
+typedef struct
+{
+    uint8_t * p_data;  ///< Pointer to the data to be written or to the buffer for the data read.
+    size_t    length;  ///< Number of bytes to be written or read.
+    uint8_t   address; ///< Slave address.
+    bool      read;    ///< True for a read message, false for a write message.
+    bool      stop;    ///< True if the message is to be followed by a STOP condition.
+} nrfx_twim_msg_t;
+
+/** @brief Macro for setting a write message. */
+#define NRFX_TWIM_MSG_WRITE(addr, p_buf, len, stop_cond) \
+{                                                        \
+    .p_data  = (p_buf),                                  \
+    .length  = (len),                                    \
+    .address = (addr),                                   \
+    .read    = false,                                    \
+    .stop    = (stop_cond)                               \
+}
+
+/** @brief Macro for setting a read message. */
+#define NRFX_TWIM_MSG_READ(addr, p_buf, len, stop_cond) \
+{                                                       \
+    .p_data  = (p_buf),                                 \
+    .length  = (len),                                   \
+    .address = (addr),                                  \
+    .read    = true,                                    \
+    .stop    = (stop_cond)                              \
+}
+#endif
+
 /** @brief Structure for a TWI event. */
 typedef struct
 {
@@ -193,6 +226,24 @@ typedef struct
     nrfx_twim_xfer_desc_t xfer_desc; ///< Transfer details.
 } nrfx_twim_evt_t;
 
+#if NRFX_CHECK(NRFX_TWIM_CONFIG_STREAM_ENABLED) || defined(__NRFX_DOXYGEN__)
+/** @brief Configuration of the TWIM stream. */
+typedef struct
+{
+    uint8_t          address;        ///< Slave address.
+    uint8_t const *  p_cmd;          ///< Data written before each read, such as a register address.
+    size_t           cmd_length;     ///< Length of the command. 0 if only reads are performed.
+    uint8_t *        p_buffer;       ///< Memory of the ring, holding @p block_count blocks.
+    size_t           sample_length;  ///< Number of bytes read in each sample transfer.
+    size_t           block_samples;  ///< Number of samples in a block.
+    uint8_t          block_count;    ///< Number of blocks in the ring. At least 2.
+    uint32_t         sample_rate;    ///< Sample rate in Hz.
+    NRF_TIMER_Type * p_sample_timer; ///< TIMER instance generating the sample clock.
+    NRF_TIMER_Type * p_count_timer;  ///< TIMER instance counting samples of a block.
+    uint8_t          irq_priority;   ///< Priority of the interrupt of @p p_count_timer.
+} nrfx_twim_stream_config_t;
+#endif
+
 /** @brief TWI event handler prototype. */
 typedef void (* nrfx_twim_evt_handler_t)(nrfx_twim_evt_t const * p_event,
                                          void *                  p_context);
@@ -314,6 +365,103 @@ nrfx_err_t nrfx_twim_xfer(nrfx_twim_t           const * p_instance,
                           nrfx_twim_xfer_desc_t const * p_xfer_desc,
                           uint32_t                      flags);
 
+#if NRFX_CHECK(NRFX_TWIM_CONFIG_MSG_LIST_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Function for performing a TWI transaction built of a list of messages.
+ *
+ * The messages are executed in order, one after another, from the interrupt handler.
+ * Each message is a write or a read addressed to any slave. A message with
+ * @ref nrfx_twim_msg_t.stop set ends with a STOP condition and the next message starts
+ * with a new START condition, which allows, for example, reading several slaves in one call.
+ * Otherwise the next message starts with a repeated START condition. The last message
+ * always ends with a STOP condition.
+ *
+ * Hardware shortcuts are used whenever possible so that consecutive messages follow
+ * with no CPU involvement:
+ * - a write followed by a read from the same slave uses the LASTTX_STARTRX shortcut,
+ * - a read followed by a write to the same slave uses the LASTRX_STARTTX shortcut.
+ * In other cases the next message is started from the SUSPENDED or STOPPED event.
+ *
+ * Because the TWIM cannot suspend after a read, a read that is not followed by
+ * a STOP condition must be followed by a write to the same slave. That write cannot
+ * be preceded by another write within the same chain of shortcuts, that is, the sequence
+ * write, read, write without STOP conditions is not supported.
+ *
+ * A single @ref nrfx_twim_evt_t event is generated when the transaction ends. Its
+ * @ref nrfx_twim_evt_t.xfer_desc describes the last message executed as a TX or RX transfer.
+ * If the transaction fails, this is the message in which the error was detected.
+ *
+ * @note Transactions are supported only in non-blocking mode.
+ * @note Messages of zero length are not supported.
+ * @note The list of messages and the buffers must remain valid until the transaction ends.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ * @param[in] p_msgs     Pointer to the list of messages.
+ * @param[in] count      Number of messages in the list.
+ *
+ * @retval NRFX_SUCCESS             The procedure is successful.
+ * @retval NRFX_ERROR_BUSY          The driver is not ready for a new transfer.
+ * @retval NRFX_ERROR_FORBIDDEN     The driver is in blocking mode.
+ * @retval NRFX_ERROR_INVALID_PARAM The list of messages is empty, contains an empty message,
+ *                                  or contains an unsupported sequence of messages.
+ * @retval NRFX_ERROR_INVALID_ADDR  The provided buffers are not placed in the Data RAM region.
+ */
+nrfx_err_t nrfx_twim_xfer_msgs(nrfx_twim_t     const * p_instance,
+                               nrfx_twim_msg_t const * p_msgs,
+                               size_t                  count);
+#endif
+
+#if NRFX_CHECK(NRFX_TWIM_CONFIG_STREAM_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Function for starting a stream of periodic transfers.
+ *
+ * A TIMER instance starts a transfer at the requested sample rate through a (D)PPI
+ * channel. Each transfer writes the command and reads one sample, with a repeated START
+ * condition in between, and EasyDMA ArrayList places the sample right after the previous
+ * one. Another TIMER instance counts the transfers and generates an interrupt when
+ * a block of the ring is filled, which is reported with @ref NRFX_TWIM_EVT_BLOCK_DONE.
+ * The CPU is not involved in single samples.
+ *
+ * The block must be processed before the stream wraps around the ring and overwrites it.
+ * The interrupt must be serviced within one sample period, because the driver moves
+ * the reception back to the beginning of the ring from the interrupt of the last block.
+ *
+ * If an error is detected on the bus, the stream is stopped and the error is reported
+ * with the corresponding event.
+ *
+ * @note The driver does not define the interrupt handler of @p p_count_timer.
+ *       Call @ref nrfx_twim_stream_irq_handler from that handler.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ * @param[in] p_config   Pointer to the stream configuration.
+ *
+ * @retval NRFX_SUCCESS             The stream is started.
+ * @retval NRFX_ERROR_BUSY          The driver is not ready for a new transfer.
+ * @retval NRFX_ERROR_FORBIDDEN     The driver works in blocking mode.
+ * @retval NRFX_ERROR_INVALID_PARAM The sample rate cannot be generated by the TIMER.
+ * @retval NRFX_ERROR_NO_MEM        There are not enough (D)PPI channels available.
+ * @retval NRFX_ERROR_INVALID_ADDR  The provided buffers are not placed in the Data RAM region.
+ */
+nrfx_err_t nrfx_twim_stream_start(nrfx_twim_t const *               p_instance,
+                                  nrfx_twim_stream_config_t const * p_config);
+
+/**
+ * @brief Function for stopping the stream.
+ *
+ * The samples of the block that is not filled yet are discarded.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ */
+void nrfx_twim_stream_stop(nrfx_twim_t const * p_instance);
+
+/**
+ * @brief Function for handling the interrupt of the TIMER instance counting samples.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ */
+void nrfx_twim_stream_irq_handler(nrfx_twim_t const * p_instance);
+#endif
+
 /**
  * @brief Function for checking the TWI driver state.
  *
@@ -86,7 +86,10 @@ typedef enum
                                      */
     NRFX_TWIS_EVT_WRITE_DONE,   ///< Write request finished - process data.
     NRFX_TWIS_EVT_WRITE_ERROR,  ///< Write request finished with error.
-    NRFX_TWIS_EVT_GENERAL_ERROR ///< Error that happens not inside WRITE or READ transaction.
+    NRFX_TWIS_EVT_GENERAL_ERROR, ///< Error that happens not inside WRITE or READ transaction.
+    NRFX_TWIS_EVT_REG_WRITE     ///< Register map was written by the master.
+                                /**< Generated only in the register map mode.
+                                     See @ref nrfx_twis_regmap_set. */
 } nrfx_twis_evt_type_t;
 
 /**
@@ -116,6 +119,11 @@ typedef struct
         uint32_t tx_amount; ///< Data for @ref NRFX_TWIS_EVT_READ_DONE.
         uint32_t rx_amount; ///< Data for @ref NRFX_TWIS_EVT_WRITE_DONE.
         uint32_t error;     ///< Data for @ref NRFX_TWIS_EVT_GENERAL_ERROR.
+        struct
+        {
+            uint16_t offset; ///< Offset of the first written register.
+            uint16_t length; ///< Number of written registers.
+        } reg;              ///< Data for @ref NRFX_TWIS_EVT_REG_WRITE.
     } data;                 ///< Union to store event data.
 } nrfx_twis_evt_t;
 
@@ -151,6 +159,15 @@ typedef struct
                                              *   as they are ignored anyway. */
 } nrfx_twis_config_t;
 
+/** @brief Structure for the register map mode. */
+typedef struct
+{
+    uint8_t * p_map;       ///< Register map. Register N is stored at p_map[N].
+    size_t    size;        ///< Number of registers in the map. Maximum 256.
+    uint8_t * p_rx_buf;    ///< Buffer for incoming writes: register address followed by data.
+    size_t    rx_buf_size; ///< Size of @p p_rx_buf. Longer writes are truncated.
+} nrfx_twis_regmap_t;
+
 /**
  * @brief TWIS driver default configuration.
  *
@@ -320,6 +337,39 @@ nrfx_err_t nrfx_twis_rx_prepare(nrfx_twis_t const * p_instance,
                                 void *              p_buf,
                                 size_t              size);
 
+/**
+ * @brief Function for setting the register map mode.
+ *
+ * In the register map mode the driver emulates a typical I2C register-based device.
+ * The first byte of every write from the master sets the register pointer.
+ * The following bytes are stored in the map starting at that register.
+ * Reads return the map contents starting at the register pointer.
+ * The pointer is incremented after each byte written or read.
+ * The driver prepares all buffers itself.
+ * The event handler is notified only with @ref NRFX_TWIS_EVT_REG_WRITE after the map
+ * is modified and with error events. Reads past the map end return the over-read character.
+ *
+ * The receive buffer is kept prepared between transactions. A write is therefore accepted
+ * without clock stretching. A read is prepared in the TWIS interrupt, as the register
+ * pointer is known only once the preceding write has finished.
+ *
+ * @note The register map mode requires the driver to be initialized with an event handler.
+ * @note Both buffers must be placed in the Data RAM region and must remain valid
+ *       until the mode is disabled.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ * @param[in] p_regmap   Pointer to the register map description.
+ *                       NULL to return to the normal mode.
+ *
+ * @retval NRFX_SUCCESS             The mode was set.
+ * @retval NRFX_ERROR_INVALID_PARAM Invalid register map description.
+ * @retval NRFX_ERROR_INVALID_ADDR  The given buffers are not placed inside the RAM.
+ * @retval NRFX_ERROR_BUSY          A transaction is in progress.
+ * @retval NRFX_ERROR_INVALID_STATE The module is not initialized or has no event handler.
+ */
+nrfx_err_t nrfx_twis_regmap_set(nrfx_twis_t const *        p_instance,
+                                nrfx_twis_regmap_t const * p_regmap);
+
 /**
  * @brief Function for getting the number of received bytes.
  *
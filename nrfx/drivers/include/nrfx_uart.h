@@ -76,6 +76,7 @@ typedef enum
     NRFX_UART_EVT_TX_DONE, ///< Requested TX transfer completed.
     NRFX_UART_EVT_RX_DONE, ///< Requested RX transfer completed.
     NRFX_UART_EVT_ERROR,   ///< Error reported by UART peripheral.
+    NRFX_UART_EVT_RX_RING, ///< Number of bytes in the RX ring buffer reached the threshold.
 } nrfx_uart_evt_type_t;
 
 /** @brief Structure for the UART configuration. */
@@ -370,6 +371,61 @@ void nrfx_uart_rx_disable(nrfx_uart_t const * p_instance);
  */
 void nrfx_uart_rx_abort(nrfx_uart_t const * p_instance);
 
+/**
+ * @brief Function for starting continuous reception into a ring buffer.
+ *
+ * In this mode, the receiver stays enabled and every received byte is stored in the ring buffer
+ * without involving the user. All bytes available in the RX FIFO are moved to the ring buffer in
+ * a single interrupt, and @ref NRFX_UART_EVT_RX_RING is generated only once the number of unread
+ * bytes reaches @p threshold, which lets the user drain the data in chunks with
+ * @ref nrfx_uart_rx_ring_read instead of handling every byte separately.
+ * The event is generated again after the next read, as soon as the threshold is reached.
+ *
+ * Bytes received when the ring buffer is full are dropped and reported with
+ * @ref NRFX_UART_EVT_ERROR containing @ref NRF_UART_ERROR_OVERRUN_MASK and the number of
+ * dropped bytes. Errors reported by the peripheral do not stop the reception.
+ *
+ * @note This mode is available only in non-blocking mode. @ref nrfx_uart_rx cannot be used
+ *       until the reception is stopped with @ref nrfx_uart_rx_ring_stop.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ * @param[in] p_buffer   Pointer to the ring buffer.
+ * @param[in] size       Size of the ring buffer. Must be a power of 2.
+ * @param[in] threshold  Number of unread bytes that triggers @ref NRFX_UART_EVT_RX_RING.
+ *                       Must be in the range from 1 to @p size.
+ *
+ * @retval NRFX_SUCCESS    The reception has been started.
+ * @retval NRFX_ERROR_BUSY The driver is already receiving.
+ */
+nrfx_err_t nrfx_uart_rx_ring_start(nrfx_uart_t const * p_instance,
+                                   uint8_t *           p_buffer,
+                                   size_t              size,
+                                   size_t              threshold);
+
+/**
+ * @brief Function for reading the data received into the ring buffer.
+ *
+ * This function can be called from any context, also from the event handler.
+ *
+ * @param[in]  p_instance Pointer to the driver instance structure.
+ * @param[out] p_data     Pointer to the buffer for the data.
+ * @param[in]  length     Maximum number of bytes to read.
+ *
+ * @return Number of bytes read.
+ */
+size_t nrfx_uart_rx_ring_read(nrfx_uart_t const * p_instance,
+                              uint8_t *           p_data,
+                              size_t              length);
+
+/**
+ * @brief Function for stopping the reception into the ring buffer.
+ *
+ * The receiver is disabled and the data that has not been read is discarded.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ */
+void nrfx_uart_rx_ring_stop(nrfx_uart_t const * p_instance);
+
 /**
  * @brief Function for reading error source mask. Mask contains values from @ref nrf_uart_error_mask_t.
  * @note Function must be used in blocking mode only. In case of non-blocking mode, an error event is
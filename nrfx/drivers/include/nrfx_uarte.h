@@ -214,6 +214,63 @@ nrfx_err_t nrfx_uarte_reconfigure(nrfx_uarte_t const *        p_instance,
  */
 void nrfx_uarte_uninit(nrfx_uarte_t const * p_instance);
 
+/** @brief Maximum number of registers stored in @ref nrfx_uarte_retained_t. */
+#define NRFX_UARTE_RETAINED_REGS_MAX 7
+
+/**
+ * @brief Context of the UARTE driver instance to be kept in retained RAM.
+ *
+ * Its content is handled by the driver.
+ */
+typedef struct
+{
+    nrfy_reg_desc_t            regs[NRFX_UARTE_RETAINED_REGS_MAX]; ///< Stored registers.
+    uint8_t                    reg_count;                          ///< Number of stored registers.
+    uint8_t                    irq_priority;                       ///< Interrupt priority.
+    bool                       skip_gpio_cfg;                      ///< Skip GPIO handling.
+    bool                       skip_psel_cfg;                      ///< Skip PSEL handling.
+    uint32_t                   int_mask;                           ///< Enabled interrupts.
+    nrfx_uarte_event_handler_t handler;                            ///< Event handler.
+    void *                     p_context;                          ///< Event handler context.
+} nrfx_uarte_retained_t;
+
+/**
+ * @brief Function for suspending the UARTE driver instance.
+ *
+ * The configuration of the instance is stored in the context, the peripheral is disabled
+ * and the driver becomes uninitialized. Pins are left as they are, since GPIO configuration
+ * is kept in low-power modes, including System OFF.
+ *
+ * @param[in]  p_instance Pointer to the driver instance structure.
+ * @param[out] p_retained Pointer to the context, typically placed in retained RAM.
+ *
+ * @retval NRFX_SUCCESS             The instance was suspended.
+ * @retval NRFX_ERROR_BUSY          The driver is during transmission or reception.
+ * @retval NRFX_ERROR_INVALID_STATE The driver is uninitialized.
+ */
+nrfx_err_t nrfx_uarte_suspend(nrfx_uarte_t const *    p_instance,
+                              nrfx_uarte_retained_t * p_retained);
+
+/**
+ * @brief Function for resuming the UARTE driver instance.
+ *
+ * The driver is initialized from the context stored by @ref nrfx_uarte_suspend, also after
+ * a wake-up from System OFF. Registers are written in a single pass and no pin configuration
+ * is done, which makes it faster than @ref nrfx_uarte_init.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ * @param[in] p_retained Pointer to the context.
+ *
+ * @retval NRFX_SUCCESS             The instance was resumed.
+ * @retval NRFX_ERROR_INVALID_STATE The driver is already initialized.
+ * @retval NRFX_ERROR_BUSY          Some other peripheral with the same
+ *                                  instance ID is already in use. This is
+ *                                  possible only if @ref nrfx_prs module
+ *                                  is enabled.
+ */
+nrfx_err_t nrfx_uarte_resume(nrfx_uarte_t const *          p_instance,
+                             nrfx_uarte_retained_t const * p_retained);
+
 /**
  * @brief Function for getting the address of the specified UARTE task.
  *
@@ -248,6 +305,8 @@ NRFX_STATIC_INLINE uint32_t nrfx_uarte_event_address_get(nrfx_uarte_t const * p_
  * @note Peripherals using EasyDMA (including UARTE) require the transfer buffers
  *       to be placed in the Data RAM region. If this condition is not met,
  *       this function will fail with the error code NRFX_ERROR_INVALID_ADDR.
+ *       When @ref NRFX_UARTE_CONFIG_TX_BOUNCE_SIZE is not 0, data outside RAM is
+ *       instead copied by the driver in chunks to its own buffer and sent from there.
  *
  * @param[in] p_instance Pointer to the driver instance structure.
  * @param[in] p_data     Pointer to data.
@@ -268,6 +327,45 @@ nrfx_err_t nrfx_uarte_tx(nrfx_uarte_t const * p_instance,
                          size_t               length,
                          uint32_t             flags);
 
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_TX_LIST_ENABLED) || defined(__NRFX_DOXYGEN__)
+/** @brief Structure describing one buffer of a transmission list. */
+typedef struct
+{
+    uint8_t const * p_data; ///< Pointer to data.
+    size_t          length; ///< Number of bytes to send.
+} nrfx_uarte_tx_segment_t;
+
+/**
+ * @brief Function for sending a list of buffers over UARTE back-to-back.
+ *
+ * Each buffer is started by a (D)PPI connection between the ENDTX event and
+ * the STARTTX task, with the pointer of the next buffer already loaded in the
+ * double-buffered TXD.PTR register, so there is no gap on the line between the buffers.
+ * A single @ref NRFX_UARTE_EVT_TX_DONE event is generated when the whole list is sent.
+ * The event contains the total number of bytes sent and the pointer to the first buffer.
+ *
+ * The list and the buffers must be kept intact until the transfer is done. The UARTE
+ * interrupt must be serviced within the transmission time of a single buffer.
+ *
+ * @note Peripherals using EasyDMA (including UARTE) require the transfer buffers
+ *       to be placed in the Data RAM region. If this condition is not met,
+ *       this function will fail with the error code NRFX_ERROR_INVALID_ADDR.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ * @param[in] p_list     Pointer to the list of buffers.
+ * @param[in] count      Number of buffers in the list.
+ *
+ * @retval NRFX_SUCCESS            Transfer is started.
+ * @retval NRFX_ERROR_BUSY         Driver is already transferring.
+ * @retval NRFX_ERROR_FORBIDDEN    The driver works in blocking mode.
+ * @retval NRFX_ERROR_NO_MEM       There is no (D)PPI channel available.
+ * @retval NRFX_ERROR_INVALID_ADDR One of the buffers does not point to RAM.
+ */
+nrfx_err_t nrfx_uarte_tx_list(nrfx_uarte_t const *            p_instance,
+                              nrfx_uarte_tx_segment_t const * p_list,
+                              size_t                          count);
+#endif // NRFX_CHECK(NRFX_UARTE_CONFIG_TX_LIST_ENABLED) || defined(__NRFX_DOXYGEN__)
+
 /**
  * @brief Function for checking if UARTE is currently transmitting.
  *
@@ -385,6 +483,113 @@ nrfx_err_t nrfx_uarte_rx_abort(nrfx_uarte_t const * p_instance, bool disable_all
  */
 uint32_t nrfx_uarte_errorsrc_get(nrfx_uarte_t const * p_instance);
 
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_RX_RING_ENABLED) || defined(__NRFX_DOXYGEN__)
+/** @brief Structure for the continuous reception configuration. */
+typedef struct
+{
+    uint8_t *        p_buffer;     ///< Memory of the ring, holding @p buffer_count consecutive buffers.
+    size_t           buffer_size;  ///< Size of a single buffer of the ring.
+    uint8_t          buffer_count; ///< Number of buffers in the ring. At least 2.
+    NRF_TIMER_Type * p_timer;      ///< TIMER instance used in counter mode to count received bytes.
+                                   /**< The TIMER instance must not be used for any other purpose
+                                    *   while the reception is ongoing. */
+} nrfx_uarte_rx_ring_config_t;
+
+/**
+ * @brief Function for starting continuous reception into a ring of buffers.
+ *
+ * The UARTE receives into the buffers of the ring one after another and wraps around
+ * at the end of the ring, without waiting for the user to provide new buffers. Every received
+ * byte increments the counter of the TIMER instance through a (D)PPI channel, so the driver
+ * knows how many bytes arrived without an interrupt per byte.
+ *
+ * Received data is reported with @ref NRFX_UARTE_EVT_RX_DONE events pointing into the ring,
+ * whenever a buffer of the ring is filled and whenever @ref nrfx_uarte_rx_ring_flush
+ * is called. The data must be processed before the reception wraps around the ring and
+ * overwrites it, that is within the time of receiving @p buffer_count - 1 buffers.
+ *
+ * @note Peripherals using EasyDMA (including UARTE) require the transfer buffers
+ *       to be placed in the Data RAM region. If this condition is not met,
+ *       this function fails with the error code NRFX_ERROR_INVALID_ADDR.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ * @param[in] p_config   Pointer to the structure with the ring configuration.
+ *
+ * @retval NRFX_SUCCESS            Reception is started.
+ * @retval NRFX_ERROR_BUSY         The driver is already receiving.
+ * @retval NRFX_ERROR_FORBIDDEN    The driver works in blocking mode.
+ * @retval NRFX_ERROR_NO_MEM       There is no (D)PPI channel available.
+ * @retval NRFX_ERROR_INVALID_ADDR The ring does not point to RAM buffer.
+ */
+nrfx_err_t nrfx_uarte_rx_ring_start(nrfx_uarte_t const *                p_instance,
+                                    nrfx_uarte_rx_ring_config_t const * p_config);
+
+/**
+ * @brief Function for reporting the data received since the last report.
+ *
+ * The hardware does not signal when the line becomes idle. To get the data of a transfer
+ * that does not fill a buffer of the ring, call this function after the idle timeout,
+ * for example periodically from a timer. If any data has been received since the last report,
+ * @ref NRFX_UARTE_EVT_RX_DONE is generated from the context of this function.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ *
+ * @return Number of bytes reported.
+ */
+size_t nrfx_uarte_rx_ring_flush(nrfx_uarte_t const * p_instance);
+
+/**
+ * @brief Function for stopping continuous reception.
+ *
+ * The data received until the receiver stops is reported with @ref NRFX_UARTE_EVT_RX_DONE
+ * from the UARTE interrupt context, after which the TIMER instance and the (D)PPI channel
+ * are released.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ */
+void nrfx_uarte_rx_ring_stop(nrfx_uarte_t const * p_instance);
+#endif // NRFX_CHECK(NRFX_UARTE_CONFIG_RX_RING_ENABLED) || defined(__NRFX_DOXYGEN__)
+
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_RX_WAKEUP_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Function for enabling low-power reception started by the first start bit.
+ *
+ * When enabled, @ref nrfx_uarte_rx only prepares the buffer and the receiver stays stopped,
+ * so it does not request the high-frequency clock while the line is idle. The falling edge
+ * of the start bit on the RXD pin triggers STARTRX through a GPIOTE IN event and a (D)PPI
+ * channel, which disarms itself through a channel group so that following edges are ignored.
+ * The receiver is stopped again as soon as the buffer is filled. Only one buffer can be
+ * provided at a time.
+ *
+ * The receiver needs time to start, so at higher baud rates the first byte may be lost or
+ * corrupted. The peer should then precede each message with the 0xFF wakeup byte, which
+ * contains only the start bit, and @p drop_wakeup_byte should be set, so that the byte
+ * is removed from the reported data when it is received. Messages must not start with 0xFF.
+ *
+ * @note The GPIOTE driver must be initialized. Messages shorter than the buffer must be
+ *       completed with @ref nrfx_uarte_rx_abort, for example after an idle timeout.
+ *
+ * @param[in] p_instance       Pointer to the driver instance structure.
+ * @param[in] drop_wakeup_byte True if the leading 0xFF byte is to be removed from received data.
+ *
+ * @retval NRFX_SUCCESS         Low-power reception is enabled.
+ * @retval NRFX_ERROR_BUSY      Reception is ongoing.
+ * @retval NRFX_ERROR_FORBIDDEN The driver works in blocking mode.
+ * @retval NRFX_ERROR_NO_MEM    There is no GPIOTE channel, (D)PPI channel or channel group
+ *                              available.
+ */
+nrfx_err_t nrfx_uarte_rx_wakeup_enable(nrfx_uarte_t const * p_instance, bool drop_wakeup_byte);
+
+/**
+ * @brief Function for disabling low-power reception.
+ *
+ * Reception must not be ongoing. The GPIOTE channel and the (D)PPI resources are released.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ */
+void nrfx_uarte_rx_wakeup_disable(nrfx_uarte_t const * p_instance);
+#endif // NRFX_CHECK(NRFX_UARTE_CONFIG_RX_WAKEUP_ENABLED) || defined(__NRFX_DOXYGEN__)
+
 
 #ifndef NRFX_DECLARE_ONLY
 NRFX_STATIC_INLINE uint32_t nrfx_uarte_task_address_get(nrfx_uarte_t const * p_instance,
@@ -699,6 +699,154 @@ nrfx_err_t nrfx_usbd_ep_handled_transfer(nrfx_usbd_ep_t ep,
  */
 void * nrfx_usbd_feeder_buffer_get(void);
 
+#if (NRFX_USBD_CONFIG_ISO_STREAM_MAX_BUFFERS > 0) || defined(__NRFX_DOXYGEN__)
+/** @brief Isochronous stream configuration. */
+typedef struct
+{
+    void *   p_buffers;    ///< Memory for the ring of buffers, placed in RAM.
+                           ///< Its size must be @p buffer_size * @p buffer_count bytes.
+    uint16_t buffer_size;  ///< Size of a single buffer, holding data of one frame.
+    uint8_t  buffer_count; ///< Number of buffers in the ring.
+                           ///< Maximum: @ref NRFX_USBD_CONFIG_ISO_STREAM_MAX_BUFFERS.
+} nrfx_usbd_iso_stream_config_t;
+
+/** @brief Isochronous stream statistics. */
+typedef struct
+{
+    uint32_t underruns; ///< Number of frames in which the IN stream had no data to send.
+    uint32_t overruns;  ///< Number of OUT packets dropped because there was no free buffer.
+} nrfx_usbd_iso_stream_stats_t;
+
+/**
+ * @brief Function for starting an isochronous stream on the ISO endpoint.
+ *
+ * The driver serves the endpoint from a ring of buffers in every frame without
+ * any action from the application and without generating transfer events.
+ * For @ref NRFX_USBD_EPIN8, in each frame the oldest buffer released with
+ * @ref nrfx_usbd_iso_stream_buffer_release is sent. When no buffer is ready,
+ * an empty packet is sent and an underrun is counted.
+ * For @ref NRFX_USBD_EPOUT8, every received packet is stored in the next free
+ * buffer. When no buffer is free, the packet is dropped and an overrun is counted.
+ *
+ * @note The SOF interrupt must be enabled, see @ref nrfx_usbd_start.
+ *
+ * @param[in] ep       ISO endpoint number.
+ * @param[in] p_config Pointer to the stream configuration.
+ *
+ * @retval NRFX_SUCCESS             The stream was started.
+ * @retval NRFX_ERROR_INVALID_PARAM Invalid configuration.
+ * @retval NRFX_ERROR_BUSY          The endpoint is pending.
+ */
+nrfx_err_t nrfx_usbd_iso_stream_start(nrfx_usbd_ep_t                        ep,
+                                      nrfx_usbd_iso_stream_config_t const * p_config);
+
+/**
+ * @brief Function for stopping the isochronous stream.
+ *
+ * @param[in] ep ISO endpoint number.
+ */
+void nrfx_usbd_iso_stream_stop(nrfx_usbd_ep_t ep);
+
+/**
+ * @brief Function for getting the buffer to be processed by the application.
+ *
+ * For the IN stream, the next free buffer to be filled with data is returned.
+ * For the OUT stream, the oldest buffer with received data is returned.
+ * Subsequent calls return the same buffer until it is released.
+ *
+ * @param[in]  ep     ISO endpoint number.
+ * @param[out] p_size Size of the buffer for the IN stream or the amount
+ *                    of received data for the OUT stream.
+ *
+ * @return Pointer to the buffer or NULL if there is no buffer available.
+ */
+void * nrfx_usbd_iso_stream_buffer_get(nrfx_usbd_ep_t ep, size_t * p_size);
+
+/**
+ * @brief Function for releasing the buffer obtained with @ref nrfx_usbd_iso_stream_buffer_get.
+ *
+ * For the IN stream, the buffer is queued for sending. For the OUT stream,
+ * the buffer is returned to the driver to receive the next packets.
+ *
+ * @param[in] ep   ISO endpoint number.
+ * @param[in] size Amount of data in the buffer to be sent. Ignored for the OUT stream.
+ */
+void nrfx_usbd_iso_stream_buffer_release(nrfx_usbd_ep_t ep, size_t size);
+
+/**
+ * @brief Function for getting the statistics of the isochronous stream.
+ *
+ * The statistics are cleared when the stream is started.
+ *
+ * @param[in]  ep      ISO endpoint number.
+ * @param[out] p_stats Pointer to the structure to be filled with the statistics.
+ */
+void nrfx_usbd_iso_stream_stats_get(nrfx_usbd_ep_t ep, nrfx_usbd_iso_stream_stats_t * p_stats);
+#endif
+
+#if (NRFX_USBD_CONFIG_OUT_RING_MAX_SLOTS > 0) || defined(__NRFX_DOXYGEN__)
+/** @brief Configuration of the ring of an OUT endpoint. */
+typedef struct
+{
+    void *   p_slots;    ///< Memory for the ring of slots, placed in RAM and aligned to a word.
+                         ///< Its size must be @p slot_size * @p slot_count bytes.
+    uint16_t slot_size;  ///< Size of a single slot. Multiple of the maximum packet size.
+    uint8_t  slot_count; ///< Number of slots in the ring.
+                         ///< Maximum: @ref NRFX_USBD_CONFIG_OUT_RING_MAX_SLOTS.
+} nrfx_usbd_out_ring_config_t;
+
+/**
+ * @brief Function for starting the reception on a bulk or interrupt OUT endpoint into a ring.
+ *
+ * EasyDMA stores the received packets directly in the slots of the ring, without copying.
+ * A slot is filled with packets until it is full or a short packet ends the transfer
+ * of the host. The filled slot is then reported with the @ref NRFX_USBD_EVT_EPTRANSFER event
+ * with the @ref NRFX_USBD_EP_OK status, and the reception continues into the next slot.
+ * When no slot is free, the packets are not read from the endpoint, so the peripheral
+ * responds with NAK and the host retries until a slot is released.
+ *
+ * The ring keeps the endpoint busy until it is stopped with @ref nrfx_usbd_out_ring_stop.
+ *
+ * @param[in] ep       OUT endpoint number, other than @ref NRFX_USBD_EPOUT0 and ISO.
+ * @param[in] p_config Pointer to the ring configuration.
+ *
+ * @retval NRFX_SUCCESS             The reception was started.
+ * @retval NRFX_ERROR_INVALID_PARAM Invalid configuration.
+ * @retval NRFX_ERROR_BUSY          The endpoint is pending.
+ */
+nrfx_err_t nrfx_usbd_out_ring_start(nrfx_usbd_ep_t                      ep,
+                                    nrfx_usbd_out_ring_config_t const * p_config);
+
+/**
+ * @brief Function for stopping the reception into the ring.
+ *
+ * @param[in] ep OUT endpoint number.
+ */
+void nrfx_usbd_out_ring_stop(nrfx_usbd_ep_t ep);
+
+/**
+ * @brief Function for getting the oldest filled slot of the ring.
+ *
+ * Subsequent calls return the same slot until it is released.
+ *
+ * @param[in]  ep     OUT endpoint number.
+ * @param[out] p_size Amount of data in the slot. 0 if the slot holds only a zero-length packet.
+ *
+ * @return Pointer to the slot or NULL if there is no filled slot.
+ */
+void * nrfx_usbd_out_ring_slot_get(nrfx_usbd_ep_t ep, size_t * p_size);
+
+/**
+ * @brief Function for returning the slot obtained with @ref nrfx_usbd_out_ring_slot_get
+ *        to the driver.
+ *
+ * If the reception was held because the ring was full, it is resumed.
+ *
+ * @param[in] ep OUT endpoint number.
+ */
+void nrfx_usbd_out_ring_slot_release(nrfx_usbd_ep_t ep);
+#endif
+
 /**
  * @brief Get the information about last finished or current transfer.
  *
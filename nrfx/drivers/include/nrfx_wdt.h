@@ -71,6 +71,19 @@ typedef void (*nrfx_wdt_event_handler_t)(uint32_t requests);
 /** @brief WDT channel ID type. */
 typedef nrf_wdt_rr_register_t nrfx_wdt_channel_id;
 
+/**
+ * @brief Structure of a virtual watchdog client.
+ *
+ * The structure is linked into a list by the driver, so it must stay valid as long as
+ * the client is registered. Its content is handled by the driver.
+ */
+typedef struct nrfx_wdt_client_s
+{
+    uint32_t                   timeout;  ///< Client timeout in milliseconds.
+    volatile uint32_t          fed_at;   ///< Virtual time of the last feed.
+    struct nrfx_wdt_client_s * p_next;   ///< Next client on the list.
+} nrfx_wdt_client_t;
+
 /** @brief Data structure of the Watchdog (WDT) driver instance. */
 typedef struct
 {
@@ -189,6 +202,58 @@ void nrfx_wdt_feed(nrfx_wdt_t const * p_instance);
  */
 void nrfx_wdt_channel_feed(nrfx_wdt_t const * p_instance, nrfx_wdt_channel_id channel_id);
 
+/**
+ * @brief Function for registering a virtual watchdog client.
+ *
+ * Virtual clients share one watchdog channel, which is fed by @ref nrfx_wdt_clients_tick
+ * only while all clients are alive. This allows any number of tasks to be supervised,
+ * each with its own timeout. The client is considered fed when registered.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ * @param[in] p_client   Pointer to the client structure.
+ * @param[in] timeout    Client timeout in milliseconds.
+ */
+void nrfx_wdt_client_register(nrfx_wdt_t const *  p_instance,
+                              nrfx_wdt_client_t * p_client,
+                              uint32_t            timeout);
+
+/**
+ * @brief Function for unregistering a virtual watchdog client.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ * @param[in] p_client   Pointer to the client structure.
+ */
+void nrfx_wdt_client_unregister(nrfx_wdt_t const * p_instance, nrfx_wdt_client_t * p_client);
+
+/**
+ * @brief Function for feeding a virtual watchdog client.
+ *
+ * The function only stores the current virtual time in the client structure,
+ * so it is cheap and can be called from any context.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ * @param[in] p_client   Pointer to the client structure.
+ */
+void nrfx_wdt_client_feed(nrfx_wdt_t const * p_instance, nrfx_wdt_client_t * p_client);
+
+/**
+ * @brief Function for checking virtual watchdog clients.
+ *
+ * This function is to be called periodically, with a period shorter than the reload value
+ * of the watchdog. It advances the virtual time and feeds the specified watchdog channel
+ * only if every registered client was fed within its timeout.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ * @param[in] channel_id ID of the watchdog channel shared by the clients.
+ * @param[in] elapsed    Time elapsed since the previous call, in milliseconds.
+ *
+ * @retval true  All clients are alive and the channel was fed.
+ * @retval false At least one client timed out and the channel was not fed.
+ */
+bool nrfx_wdt_clients_tick(nrfx_wdt_t const *  p_instance,
+                           nrfx_wdt_channel_id channel_id,
+                           uint32_t            elapsed);
+
 /**
  * @brief Function for returning a requested task address for the WDT driver module.
  *
@@ -305,6 +305,20 @@ extern "C" {
 #define NRFX_INSTANCE_ENUM_LIST(periph_name) \
         NRFX_FOREACH_ENABLED(periph_name, _NRFX_INST_ENUM, (), ())
 
+/**
+ * @brief Macro for creating a bit mask of enabled driver instances.
+ *
+ * Bit \<i\> of the mask is set when NRFX_\<periph_name\>\<i\>_ENABLED is set to 1.
+ * The mask can be evaluated by the preprocessor, e.g. to check that driver instances
+ * enabled in nrfx_config.h do not use peripherals reserved by other components.
+ *
+ * Macro supports instances with names \<periph_name\>0 - \<periph_name\>31, e.g. TIMER0.
+ *
+ * @param[in] periph_name Peripheral name (e.g. TIMER).
+ */
+#define NRFX_ENABLED_INSTANCES_MASK(periph_name) \
+        (0UL NRFX_LISTIFY(32, _NRFX_INST_MASK_BIT, (), periph_name))
+
 /**
  * @brief Macro for creating an interrupt handler for all enabled driver instances.
  *
@@ -369,6 +383,35 @@ extern "C" {
 #define NRFX_INSTANCE_IRQ_HANDLERS_LIST(periph_name, periph_name_small) \
     NRFX_FOREACH_ENABLED(periph_name, _NRFX_IRQ_HANDLER_LIST, (), (), periph_name_small)
 
+/**
+ * @brief Macro for getting the index of a driver instance.
+ *
+ * When only one instance of the peripheral is enabled, the index is resolved at compile time,
+ * so the control block of the driver is accessed without reading the instance structure.
+ *
+ * @note Macro uses enum generated using @ref NRFX_INSTANCE_ENUM_LIST.
+ *
+ * @param[in] periph_name Peripheral name, e.g. SPIM.
+ * @param[in] idx         Index of the driver instance read from the instance structure.
+ */
+#define NRFX_INSTANCE_IDX_GET(periph_name, idx) \
+    ((NRFX_CONCAT(NRFX_, periph_name, _ENABLED_COUNT) == 1) ? 0 : (idx))
+
+/**
+ * @brief Macro for getting the register pointer of a driver instance.
+ *
+ * When only one instance of the peripheral is enabled, the pointer is resolved at compile time,
+ * so registers are accessed without reading the instance structure.
+ *
+ * @note Macro uses enum generated using @ref NRFX_INSTANCE_ENUM_LIST.
+ *
+ * @param[in] periph_name Peripheral name, e.g. SPIM.
+ * @param[in] p_reg       Register pointer read from the instance structure.
+ */
+#define NRFX_INSTANCE_REG_GET(periph_name, p_reg)                                              \
+    ((NRFX_CONCAT(NRFX_, periph_name, _ENABLED_COUNT) == 1) ?                                  \
+     _NRFX_GET_ARG1(NRFX_FOREACH_ENABLED(periph_name, _NRFX_INST_REG, (), ()) (p_reg)) : (p_reg))
+
 /**
  * @brief Macro for checking if given peripheral instance is present on the target.
  *
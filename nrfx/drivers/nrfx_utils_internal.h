@@ -151,6 +151,10 @@
 #define _NRFX_INST_ENUM(periph_name, prefix, i, _) \
     NRFX_CONCAT(NRFX_, periph_name, prefix, i, _INST_IDX),
 
+/* Macro used for enabled driver instances mask generation. */
+#define _NRFX_INST_MASK_BIT(i, periph_name) \
+        NRFX_COND_CODE_1(NRFX_CONCAT(NRFX_, periph_name, i, _ENABLED), (| (1UL << i)), ())
+
 /* Macro used for generation of irq handlers.
  *
  * Macro is using enum created by _NRFX_INSG_ENUM macro.
@@ -163,8 +167,10 @@
 #define _NRFX_IRQ_HANDLER(periph_name, prefix, i, periph_name_small) \
 void NRFX_CONCAT(nrfx_, periph_name_small, _, prefix, i, _irq_handler)(void) \
 { \
+    NRFX_IRQ_ENTER(NRFX_CONCAT(NRF_, periph_name, prefix, i)); \
     irq_handler(NRFX_CONCAT(NRF_, periph_name, prefix, i), \
                 &m_cb[NRFX_CONCAT(NRFX_, periph_name, prefix, i, _INST_IDX)]); \
+    NRFX_IRQ_EXIT(NRFX_CONCAT(NRF_, periph_name, prefix, i)); \
 }
 
 /* Macro used for generation of irq handlers with addtional parameter.
@@ -184,9 +190,11 @@ void NRFX_CONCAT(nrfx_, periph_name_small, _, prefix, i, _irq_handler)(void) \
 #define _NRFX_IRQ_HANDLER_EXT(periph_name, prefix, i, periph_name_small, ext_macro) \
 void NRFX_CONCAT(nrfx_, periph_name_small, _, prefix, i, _irq_handler)(void) \
 { \
+    NRFX_IRQ_ENTER(NRFX_CONCAT(NRF_, periph_name, prefix, i)); \
     irq_handler(NRFX_CONCAT(NRF_, periph_name, prefix, i), \
                 &m_cb[NRFX_CONCAT(NRFX_, periph_name, prefix, i, _INST_IDX)], \
                 ext_macro(NRFX_CONCAT(prefix, i))); \
+    NRFX_IRQ_EXIT(NRFX_CONCAT(NRF_, periph_name, prefix, i)); \
 }
 
 #define _NRFX_IRQ_HANDLER_LIST(periph_name, prefix, i, periph_name_small) \
@@ -195,6 +203,13 @@ void NRFX_CONCAT(nrfx_, periph_name_small, _, prefix, i, _irq_handler)(void) \
 #define _NRFX_IRQ_HANDLER_DECLARE(periph_name, prefix, i, periph_name_small) \
     void NRFX_CONCAT(nrfx_, periph_name_small, _, prefix, i, _irq_handler)(void);
 
+#define _NRFX_INST_REG(periph_name, prefix, i, _) \
+    NRFX_CONCAT(NRF_, periph_name, prefix, i),
+
+/* Macro for getting first argument from the set of input arguments. */
+#define __NRFX_GET_ARG1(arg1, ...) arg1
+#define _NRFX_GET_ARG1(...) __NRFX_GET_ARG1(__VA_ARGS__)
+
 /* Macro for getting third argument from the set of input arguments. */
 #define __NRFX_GET_ARG3(arg1, arg2, arg3, ...) arg3
 #define _NRFX_GET_ARG3(...) __NRFX_GET_ARG3(__VA_ARGS__)
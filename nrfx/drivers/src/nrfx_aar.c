@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_AAR_ENABLED)
+
+#include <nrfx_aar.h>
+#include <helpers/nrfx_gppi.h>
+
+#define NRFX_LOG_MODULE AAR
+#include <nrfx_log.h>
+
+/* Minimum size of the scratch area required by the peripheral. */
+#define AAR_SCRATCH_SIZE 3
+
+/* Control block of the AAR driver. */
+typedef struct
+{
+    nrfx_aar_handler_t              handler;
+    void *                          p_context;
+    nrfx_aar_job_t const * volatile p_job;       ///< Resolution in progress. NULL if none.
+    uint16_t                        base;        ///< Index of the first IRK of the current run.
+    uint32_t                        ppi_eep;     ///< Event connected to START. 0 if none.
+    uint8_t                         ppi_channel;
+    bool                            ppi_allocated;
+    nrfx_drv_state_t                state;
+    uint8_t                         scratch[AAR_SCRATCH_SIZE];
+} aar_control_block_t;
+
+static aar_control_block_t m_cb;
+
+static void run_setup(uint16_t base)
+{
+    nrfx_aar_job_t const * p_job = m_cb.p_job;
+    uint16_t               count = (uint16_t)(p_job->irk_count - base);
+
+    if (count > NRFX_AAR_IRKS_PER_RUN)
+    {
+        count = NRFX_AAR_IRKS_PER_RUN;
+    }
+
+    m_cb.base = base;
+    nrf_aar_irk_pointer_set(NRF_AAR, &p_job->p_irks[base * NRFX_AAR_IRK_SIZE]);
+    nrf_aar_irk_number_set(NRF_AAR, (uint8_t)count);
+    nrf_aar_event_clear(NRF_AAR, NRF_AAR_EVENT_END);
+    nrf_aar_event_clear(NRF_AAR, NRF_AAR_EVENT_RESOLVED);
+    nrf_aar_event_clear(NRF_AAR, NRF_AAR_EVENT_NOTRESOLVED);
+}
+
+/* Function handles the end of a run. It returns false if the next run was started. */
+static bool run_end(uint16_t * p_irk_index)
+{
+    uint16_t next = (uint16_t)(m_cb.base + NRFX_AAR_IRKS_PER_RUN);
+
+    if (nrf_aar_event_check(NRF_AAR, NRF_AAR_EVENT_RESOLVED))
+    {
+        *p_irk_index = (uint16_t)(m_cb.base + nrf_aar_resolution_status_get(NRF_AAR));
+        return true;
+    }
+    if (next < m_cb.p_job->irk_count)
+    {
+        run_setup(next);
+        nrf_aar_task_trigger(NRF_AAR, NRF_AAR_TASK_START);
+        return false;
+    }
+    *p_irk_index = NRFX_AAR_IRK_INDEX_NONE;
+    return true;
+}
+
+static nrfx_err_t ppi_connect(uint32_t eep)
+{
+    if (!m_cb.ppi_allocated)
+    {
+        nrfx_err_t err_code = nrfx_gppi_channel_alloc(&m_cb.ppi_channel);
+
+        if (err_code != NRFX_SUCCESS)
+        {
+            return err_code;
+        }
+        m_cb.ppi_allocated = true;
+    }
+
+    nrfx_gppi_channel_endpoints_setup(m_cb.ppi_channel,
+                                      eep,
+                                      nrf_aar_task_address_get(NRF_AAR, NRF_AAR_TASK_START));
+    nrfx_gppi_channels_enable(NRFX_BIT(m_cb.ppi_channel));
+    m_cb.ppi_eep = eep;
+    return NRFX_SUCCESS;
+}
+
+static void ppi_disconnect(void)
+{
+    if (m_cb.ppi_eep)
+    {
+        nrfx_gppi_channels_disable(NRFX_BIT(m_cb.ppi_channel));
+        nrfx_gppi_channel_endpoints_clear(m_cb.ppi_channel,
+                                          m_cb.ppi_eep,
+                                          nrf_aar_task_address_get(NRF_AAR,
+                                                                   NRF_AAR_TASK_START));
+        m_cb.ppi_eep = 0;
+    }
+}
+
+static void resolution_finish(void)
+{
+    ppi_disconnect();
+    nrf_aar_disable(NRF_AAR);
+    m_cb.p_job = NULL;
+}
+
+nrfx_err_t nrfx_aar_init(nrfx_aar_config_t const * p_config,
+                         nrfx_aar_handler_t        handler,
+                         void *                    p_context)
+{
+    NRFX_ASSERT(p_config);
+
+    if (m_cb.state != NRFX_DRV_STATE_UNINITIALIZED)
+    {
+        return NRFX_ERROR_ALREADY_INITIALIZED;
+    }
+
+    m_cb.handler       = handler;
+    m_cb.p_context     = p_context;
+    m_cb.p_job         = NULL;
+    m_cb.ppi_eep       = 0;
+    m_cb.ppi_allocated = false;
+
+    if (handler)
+    {
+        nrf_aar_int_enable(NRF_AAR, NRF_AAR_INT_END_MASK);
+        NRFX_IRQ_PRIORITY_SET(nrfx_get_irq_number(NRF_AAR), p_config->interrupt_priority);
+        NRFX_IRQ_ENABLE(nrfx_get_irq_number(NRF_AAR));
+    }
+
+    m_cb.state = NRFX_DRV_STATE_INITIALIZED;
+    NRFX_LOG_INFO("Initialized.");
+    return NRFX_SUCCESS;
+}
+
+void nrfx_aar_uninit(void)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_INITIALIZED);
+
+    nrfx_aar_stop();
+    if (m_cb.handler)
+    {
+        nrf_aar_int_disable(NRF_AAR, NRF_AAR_INT_END_MASK);
+        NRFX_IRQ_DISABLE(nrfx_get_irq_number(NRF_AAR));
+    }
+    if (m_cb.ppi_allocated)
+    {
+        (void)nrfx_gppi_channel_free(m_cb.ppi_channel);
+        m_cb.ppi_allocated = false;
+    }
+
+    m_cb.state = NRFX_DRV_STATE_UNINITIALIZED;
+    NRFX_LOG_INFO("Uninitialized.");
+}
+
+nrfx_err_t nrfx_aar_resolve(nrfx_aar_job_t const * p_job, uint16_t * p_irk_index)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_INITIALIZED);
+    NRFX_ASSERT(p_job);
+    NRFX_ASSERT(p_job->irk_count > 0);
+    NRFX_ASSERT(m_cb.handler || (p_irk_index && !p_job->start_eep));
+
+    nrfx_err_t err_code = NRFX_SUCCESS;
+
+    if (m_cb.p_job)
+    {
+        return NRFX_ERROR_BUSY;
+    }
+    if (!nrfx_is_in_ram(p_job->p_irks) || !nrfx_is_in_ram(p_job->p_addr))
+    {
+        err_code = NRFX_ERROR_INVALID_ADDR;
+    }
+    else if (p_job->start_eep)
+    {
+        err_code = ppi_connect(p_job->start_eep);
+    }
+    if (err_code != NRFX_SUCCESS)
+    {
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    m_cb.p_job = p_job;
+    nrf_aar_enable(NRF_AAR);
+    nrf_aar_addr_pointer_set(NRF_AAR, p_job->p_addr);
+    nrf_aar_scratch_pointer_set(NRF_AAR, m_cb.scratch);
+    run_setup(0);
+    if (!p_job->start_eep)
+    {
+        nrf_aar_task_trigger(NRF_AAR, NRF_AAR_TASK_START);
+    }
+
+    if (!m_cb.handler)
+    {
+        do
+        {
+            while (!nrf_aar_event_check(NRF_AAR, NRF_AAR_EVENT_END))
+            {}
+        } while (!run_end(p_irk_index));
+        resolution_finish();
+    }
+    return NRFX_SUCCESS;
+}
+
+void nrfx_aar_stop(void)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_INITIALIZED);
+
+    ppi_disconnect();
+    nrf_aar_task_trigger(NRF_AAR, NRF_AAR_TASK_STOP);
+    nrf_aar_event_clear(NRF_AAR, NRF_AAR_EVENT_END);
+    resolution_finish();
+}
+
+static void aar_irq_handle(void)
+{
+    uint16_t irk_index;
+
+    if (!nrf_aar_event_check(NRF_AAR, NRF_AAR_EVENT_END) || !m_cb.p_job)
+    {
+        return;
+    }
+    nrf_aar_event_clear(NRF_AAR, NRF_AAR_EVENT_END);
+    NRFX_LOG_DEBUG("Event: NRF_AAR_EVENT_END.");
+
+    if (run_end(&irk_index))
+    {
+        resolution_finish();
+        m_cb.handler(irk_index, m_cb.p_context);
+    }
+}
+
+void nrfx_aar_irq_handler(void)
+{
+    NRFX_IRQ_ENTER(NRF_AAR);
+    aar_irq_handle();
+    NRFX_IRQ_EXIT(NRF_AAR);
+}
+
+#endif // NRFX_CHECK(NRFX_AAR_ENABLED)
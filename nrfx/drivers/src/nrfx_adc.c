@@ -301,6 +301,8 @@ bool nrfx_adc_is_busy(void)
 
 void nrfx_adc_irq_handler(void)
 {
+    NRFX_IRQ_ENTER(NRF_ADC);
+
     if (m_cb.p_buffer == NULL)
     {
         nrf_adc_event_clear(NRF_ADC, NRF_ADC_EVENT_END);
@@ -328,6 +330,8 @@ void nrfx_adc_irq_handler(void)
         NRFX_LOG_HEXDUMP_DEBUG((uint8_t *)m_cb.p_buffer, m_cb.size * sizeof(nrf_adc_value_t));
         m_cb.event_handler(&evt);
     }
+
+    NRFX_IRQ_EXIT(NRF_ADC);
 }
 
 #endif // NRFX_CHECK(NRFX_ADC_ENABLED)
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_CACHE_ENABLED)
+
+#include <nrfx_cache.h>
+
+void nrfx_cache_enable(void)
+{
+    nrf_cache_enable(NRF_CACHE);
+}
+
+void nrfx_cache_disable(void)
+{
+    nrf_cache_update_lock_set(NRF_CACHE, false);
+    nrf_cache_disable(NRF_CACHE);
+}
+
+void nrfx_cache_invalidate(void)
+{
+    nrf_cache_update_lock_set(NRF_CACHE, false);
+    nrf_cache_invalidate(NRF_CACHE);
+}
+
+void nrfx_cache_profiling_start(void)
+{
+    nrf_cache_profiling_counters_clear(NRF_CACHE);
+    nrf_cache_profiling_set(NRF_CACHE, true);
+}
+
+void nrfx_cache_profiling_stop(void)
+{
+    nrf_cache_profiling_set(NRF_CACHE, false);
+}
+
+void nrfx_cache_profile_get(nrf_cache_region_t region, nrfx_cache_profile_t * p_profile)
+{
+    NRFX_ASSERT(p_profile);
+
+    p_profile->instruction_hits   = nrf_cache_instruction_hit_counter_get(NRF_CACHE, region);
+    p_profile->instruction_misses = nrf_cache_instruction_miss_counter_get(NRF_CACHE, region);
+    p_profile->data_hits          = nrf_cache_data_hit_counter_get(NRF_CACHE, region);
+    p_profile->data_misses        = nrf_cache_data_miss_counter_get(NRF_CACHE, region);
+}
+
+uint32_t nrfx_cache_hit_rate_get(nrf_cache_region_t region)
+{
+    nrfx_cache_profile_t profile;
+    nrfx_cache_profile_get(region, &profile);
+
+    uint64_t hits  = (uint64_t)profile.instruction_hits + profile.data_hits;
+    uint64_t total = hits + profile.instruction_misses + profile.data_misses;
+    if (total == 0)
+    {
+        return 0;
+    }
+    return (uint32_t)((hits * 1000) / total);
+}
+
+void nrfx_cache_range_lock(void const * p_start, size_t size)
+{
+    volatile uint32_t const * p_word =
+        (volatile uint32_t const *)((uintptr_t)p_start & ~(uintptr_t)(sizeof(uint32_t) - 1));
+    uintptr_t end = (uintptr_t)p_start + size;
+
+    // Lines can be allocated only while the cache is unlocked.
+    nrf_cache_update_lock_set(NRF_CACHE, false);
+    while ((uintptr_t)p_word < end)
+    {
+        (void)*p_word;
+        p_word++;
+    }
+    nrf_cache_update_lock_set(NRF_CACHE, true);
+}
+
+void nrfx_cache_unlock(void)
+{
+    nrf_cache_update_lock_set(NRF_CACHE, false);
+}
+
+#endif // NRFX_CHECK(NRFX_CACHE_ENABLED)
@@ -0,0 +1,393 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_CCM_ENABLED)
+
+#include <nrfx_ccm.h>
+#include <helpers/nrfx_gppi.h>
+
+#define NRFX_LOG_MODULE CCM
+#include <nrfx_log.h>
+
+#if !NRF_CCM_HAS_TASK_KSGEN
+#error "The CCM driver supports only the peripheral with the KSGEN task."
+#endif
+
+/* Scratch area must hold 16 bytes and the key-stream for the longest payload. */
+#define CCM_SCRATCH_SIZE (16 + 251)
+
+#define CCM_INT_MASK (NRF_CCM_INT_ENDKSGEN_MASK | \
+                      NRF_CCM_INT_ENDCRYPT_MASK | \
+                      NRF_CCM_INT_ERROR_MASK)
+
+/* Operations of the peripheral. */
+typedef enum
+{
+    CCM_OP_IDLE,        ///< No operation.
+    CCM_OP_KSGEN,       ///< Key-stream generation only.
+    CCM_OP_KSGEN_READY, ///< Key-stream generated, waiting for CRYPT.
+    CCM_OP_CRYPT,       ///< Encryption or decryption, possibly preceded by key-stream generation.
+} ccm_op_t;
+
+/* Control block of the CCM driver. */
+typedef struct
+{
+    nrfx_ccm_event_handler_t handler;
+    void *                   p_context;
+    nrf_ccm_mode_t           mode;
+    ccm_op_t volatile        op;
+    uint32_t                 ppi_eep;      ///< Event connected to KSGEN. 0 if none.
+    uint8_t                  ppi_channel;
+    bool                     ppi_allocated;
+    nrfx_drv_state_t         state;
+} ccm_control_block_t;
+
+static ccm_control_block_t m_cb;
+static uint32_t            m_scratch[NRFX_CEIL_DIV(CCM_SCRATCH_SIZE, sizeof(uint32_t))];
+
+static nrfx_err_t xfer_setup(nrfx_ccm_xfer_t const * p_xfer)
+{
+    NRFX_ASSERT(p_xfer);
+
+    if (!nrfx_is_in_ram(p_xfer->p_cnf) ||
+        !nrfx_is_in_ram(p_xfer->p_in) || !nrfx_is_word_aligned(p_xfer->p_in) ||
+        !nrfx_is_in_ram(p_xfer->p_out) || !nrfx_is_word_aligned(p_xfer->p_out))
+    {
+        return NRFX_ERROR_INVALID_ADDR;
+    }
+
+    nrf_ccm_cnfptr_set(NRF_CCM, p_xfer->p_cnf);
+    nrf_ccm_inptr_set(NRF_CCM, (uint32_t const *)p_xfer->p_in);
+    nrf_ccm_outptr_set(NRF_CCM, (uint32_t const *)p_xfer->p_out);
+    nrf_ccm_event_clear(NRF_CCM, NRF_CCM_EVENT_ENDKSGEN);
+    nrf_ccm_event_clear(NRF_CCM, NRF_CCM_EVENT_ENDCRYPT);
+    nrf_ccm_event_clear(NRF_CCM, NRF_CCM_EVENT_ERROR);
+    return NRFX_SUCCESS;
+}
+
+static nrfx_err_t ppi_connect(uint32_t eep)
+{
+    if (!m_cb.ppi_allocated)
+    {
+        nrfx_err_t err_code = nrfx_gppi_channel_alloc(&m_cb.ppi_channel);
+
+        if (err_code != NRFX_SUCCESS)
+        {
+            return err_code;
+        }
+        m_cb.ppi_allocated = true;
+    }
+
+    nrfx_gppi_channel_endpoints_setup(m_cb.ppi_channel,
+                                      eep,
+                                      nrf_ccm_task_address_get(NRF_CCM, NRF_CCM_TASK_KSGEN));
+    nrfx_gppi_channels_enable(NRFX_BIT(m_cb.ppi_channel));
+    m_cb.ppi_eep = eep;
+    return NRFX_SUCCESS;
+}
+
+static void ppi_disconnect(void)
+{
+    if (m_cb.ppi_eep)
+    {
+        nrfx_gppi_channels_disable(NRFX_BIT(m_cb.ppi_channel));
+        nrfx_gppi_channel_endpoints_clear(m_cb.ppi_channel,
+                                          m_cb.ppi_eep,
+                                          nrf_ccm_task_address_get(NRF_CCM,
+                                                                   NRF_CCM_TASK_KSGEN));
+        m_cb.ppi_eep = 0;
+    }
+}
+
+/* Function checks the result of a finished operation. */
+static nrfx_err_t result_get(void)
+{
+    if (nrf_ccm_event_check(NRF_CCM, NRF_CCM_EVENT_ERROR))
+    {
+        return NRFX_ERROR_INTERNAL;
+    }
+    if ((m_cb.op == CCM_OP_CRYPT) && (m_cb.mode != NRF_CCM_MODE_ENCRYPTION) &&
+        !nrf_ccm_micstatus_get(NRF_CCM))
+    {
+        return NRFX_ERROR_INTERNAL;
+    }
+    return NRFX_SUCCESS;
+}
+
+/* Function waits for the operation to finish in blocking mode. */
+static nrfx_err_t blocking_wait(nrf_ccm_event_t end_event)
+{
+    nrfx_err_t err_code;
+
+    while (!nrf_ccm_event_check(NRF_CCM, end_event) &&
+           !nrf_ccm_event_check(NRF_CCM, NRF_CCM_EVENT_ERROR))
+    {}
+
+    err_code = result_get();
+    m_cb.op = ((end_event == NRF_CCM_EVENT_ENDKSGEN) && (err_code == NRFX_SUCCESS)) ?
+              CCM_OP_KSGEN_READY : CCM_OP_IDLE;
+    return err_code;
+}
+
+nrfx_err_t nrfx_ccm_init(nrfx_ccm_config_t const * p_config,
+                         nrfx_ccm_event_handler_t  handler,
+                         void *                    p_context)
+{
+    NRFX_ASSERT(p_config);
+
+    if (m_cb.state != NRFX_DRV_STATE_UNINITIALIZED)
+    {
+        return NRFX_ERROR_ALREADY_INITIALIZED;
+    }
+
+    m_cb.handler       = handler;
+    m_cb.p_context     = p_context;
+    m_cb.op            = CCM_OP_IDLE;
+    m_cb.ppi_eep       = 0;
+    m_cb.ppi_allocated = false;
+
+    nrf_ccm_enable(NRF_CCM);
+    nrf_ccm_scratchptr_set(NRF_CCM, m_scratch);
+#if NRF_CCM_HAS_MAXPACKETSIZE
+    nrf_ccm_maxpacketsize_set(NRF_CCM, CCM_SCRATCH_SIZE - 16);
+#endif
+    m_cb.state = NRFX_DRV_STATE_INITIALIZED;
+    (void)nrfx_ccm_reconfigure(p_config);
+
+    if (handler)
+    {
+        NRFX_IRQ_PRIORITY_SET(nrfx_get_irq_number(NRF_CCM), p_config->interrupt_priority);
+        NRFX_IRQ_ENABLE(nrfx_get_irq_number(NRF_CCM));
+        nrf_ccm_int_enable(NRF_CCM, CCM_INT_MASK);
+    }
+
+    NRFX_LOG_INFO("Initialized.");
+    return NRFX_SUCCESS;
+}
+
+nrfx_err_t nrfx_ccm_reconfigure(nrfx_ccm_config_t const * p_config)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_INITIALIZED);
+    NRFX_ASSERT(p_config);
+
+    if ((m_cb.op == CCM_OP_KSGEN) || (m_cb.op == CCM_OP_CRYPT))
+    {
+        return NRFX_ERROR_BUSY;
+    }
+
+    nrf_ccm_configure(NRF_CCM, &p_config->hal);
+    m_cb.mode = p_config->hal.mode;
+    m_cb.op   = CCM_OP_IDLE;
+    return NRFX_SUCCESS;
+}
+
+void nrfx_ccm_uninit(void)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_INITIALIZED);
+
+    nrfx_ccm_stop();
+    if (m_cb.handler)
+    {
+        nrf_ccm_int_disable(NRF_CCM, CCM_INT_MASK);
+        NRFX_IRQ_DISABLE(nrfx_get_irq_number(NRF_CCM));
+    }
+    if (m_cb.ppi_allocated)
+    {
+        (void)nrfx_gppi_channel_free(m_cb.ppi_channel);
+        m_cb.ppi_allocated = false;
+    }
+    nrf_ccm_disable(NRF_CCM);
+
+    m_cb.state = NRFX_DRV_STATE_UNINITIALIZED;
+    NRFX_LOG_INFO("Uninitialized.");
+}
+
+nrfx_err_t nrfx_ccm_crypt(nrfx_ccm_xfer_t const * p_xfer)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_INITIALIZED);
+    NRFX_ASSERT(m_cb.handler || !p_xfer->ksgen_eep);
+
+    nrfx_err_t err_code;
+
+    if ((m_cb.op == CCM_OP_KSGEN) || (m_cb.op == CCM_OP_CRYPT))
+    {
+        return NRFX_ERROR_BUSY;
+    }
+
+    err_code = xfer_setup(p_xfer);
+    if ((err_code == NRFX_SUCCESS) && p_xfer->ksgen_eep)
+    {
+        err_code = ppi_connect(p_xfer->ksgen_eep);
+    }
+    if (err_code != NRFX_SUCCESS)
+    {
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    m_cb.op = CCM_OP_CRYPT;
+    nrf_ccm_shorts_enable(NRF_CCM, NRF_CCM_SHORT_ENDKSGEN_CRYPT_MASK);
+    if (!p_xfer->ksgen_eep)
+    {
+        nrf_ccm_task_trigger(NRF_CCM, NRF_CCM_TASK_KSGEN);
+    }
+
+    if (!m_cb.handler)
+    {
+        err_code = blocking_wait(NRF_CCM_EVENT_ENDCRYPT);
+    }
+    return err_code;
+}
+
+nrfx_err_t nrfx_ccm_ksgen(nrfx_ccm_xfer_t const * p_xfer)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_INITIALIZED);
+
+    nrfx_err_t err_code;
+
+    if ((m_cb.op == CCM_OP_KSGEN) || (m_cb.op == CCM_OP_CRYPT))
+    {
+        return NRFX_ERROR_BUSY;
+    }
+
+    err_code = xfer_setup(p_xfer);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    m_cb.op = CCM_OP_KSGEN;
+    nrf_ccm_shorts_disable(NRF_CCM, NRF_CCM_SHORT_ENDKSGEN_CRYPT_MASK);
+    nrf_ccm_task_trigger(NRF_CCM, NRF_CCM_TASK_KSGEN);
+
+    if (!m_cb.handler)
+    {
+        err_code = blocking_wait(NRF_CCM_EVENT_ENDKSGEN);
+    }
+    return err_code;
+}
+
+nrfx_err_t nrfx_ccm_crypt_resume(void)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_INITIALIZED);
+
+    if ((m_cb.op == CCM_OP_KSGEN) || (m_cb.op == CCM_OP_CRYPT))
+    {
+        return NRFX_ERROR_BUSY;
+    }
+    if (m_cb.op != CCM_OP_KSGEN_READY)
+    {
+        return NRFX_ERROR_FORBIDDEN;
+    }
+
+    m_cb.op = CCM_OP_CRYPT;
+    nrf_ccm_event_clear(NRF_CCM, NRF_CCM_EVENT_ENDCRYPT);
+    nrf_ccm_task_trigger(NRF_CCM, NRF_CCM_TASK_CRYPT);
+
+    if (!m_cb.handler)
+    {
+        return blocking_wait(NRF_CCM_EVENT_ENDCRYPT);
+    }
+    return NRFX_SUCCESS;
+}
+
+void nrfx_ccm_stop(void)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_INITIALIZED);
+
+    ppi_disconnect();
+    nrf_ccm_task_trigger(NRF_CCM, NRF_CCM_TASK_STOP);
+    nrf_ccm_event_clear(NRF_CCM, NRF_CCM_EVENT_ENDKSGEN);
+    nrf_ccm_event_clear(NRF_CCM, NRF_CCM_EVENT_ENDCRYPT);
+    nrf_ccm_event_clear(NRF_CCM, NRF_CCM_EVENT_ERROR);
+    m_cb.op = CCM_OP_IDLE;
+}
+
+uint32_t nrfx_ccm_task_address_get(nrf_ccm_task_t task)
+{
+    return nrf_ccm_task_address_get(NRF_CCM, task);
+}
+
+static void ccm_irq_handle(void)
+{
+    nrfx_ccm_evt_t event = { .mic_ok = false };
+
+    if (nrf_ccm_event_check(NRF_CCM, NRF_CCM_EVENT_ERROR))
+    {
+        nrf_ccm_event_clear(NRF_CCM, NRF_CCM_EVENT_ERROR);
+        NRFX_LOG_DEBUG("Event: NRF_CCM_EVENT_ERROR.");
+        event.type = NRFX_CCM_EVT_ERROR;
+        m_cb.op    = CCM_OP_IDLE;
+    }
+    else if (nrf_ccm_event_check(NRF_CCM, NRF_CCM_EVENT_ENDCRYPT))
+    {
+        nrf_ccm_event_clear(NRF_CCM, NRF_CCM_EVENT_ENDCRYPT);
+        NRFX_LOG_DEBUG("Event: NRF_CCM_EVENT_ENDCRYPT.");
+        event.type   = NRFX_CCM_EVT_CRYPT_END;
+        event.mic_ok = (m_cb.mode != NRF_CCM_MODE_ENCRYPTION) && nrf_ccm_micstatus_get(NRF_CCM);
+        m_cb.op      = CCM_OP_IDLE;
+    }
+    else if (nrf_ccm_event_check(NRF_CCM, NRF_CCM_EVENT_ENDKSGEN))
+    {
+        nrf_ccm_event_clear(NRF_CCM, NRF_CCM_EVENT_ENDKSGEN);
+        if (m_cb.op != CCM_OP_KSGEN)
+        {
+            /* CRYPT is started by the shortcut, and ENDCRYPT follows. */
+            return;
+        }
+        NRFX_LOG_DEBUG("Event: NRF_CCM_EVENT_ENDKSGEN.");
+        event.type = NRFX_CCM_EVT_KSGEN_END;
+        m_cb.op    = CCM_OP_KSGEN_READY;
+    }
+    else
+    {
+        return;
+    }
+
+    /* The event is connected for a single packet, the next one is set up by the user. */
+    ppi_disconnect();
+    m_cb.handler(&event, m_cb.p_context);
+}
+
+void nrfx_ccm_irq_handler(void)
+{
+    NRFX_IRQ_ENTER(NRF_CCM);
+    ccm_irq_handle();
+    NRFX_IRQ_EXIT(NRF_CCM);
+}
+
+#endif // NRFX_CHECK(NRFX_CCM_ENABLED)
@@ -123,6 +123,9 @@ extern bool nrfx_power_irq_enabled;
 typedef enum
 {
     CAL_STATE_IDLE,
+#if NRFX_CHECK(NRFX_CLOCK_CONFIG_HFCLK_REQUEST_ENABLED)
+    CAL_STATE_HFCLK, // Waiting for the HFCLK requested for the calibration.
+#endif
     CAL_STATE_CAL
 } nrfx_clock_cal_state_t;
 #endif
@@ -138,6 +141,17 @@ typedef struct
 
 #if NRFX_CHECK(NRFX_CLOCK_CONFIG_LF_CAL_ENABLED)
     volatile nrfx_clock_cal_state_t cal_state;
+    int32_t                         cal_temp;           /*< Temperature at last calibration. */
+    bool                            cal_temp_valid;     /*< Set if @p cal_temp is valid. */
+    uint8_t                         cal_skipped;        /*< Calibrations skipped in a row. */
+#endif
+#if NRFX_CHECK(NRFX_CLOCK_CONFIG_HFCLK_REQUEST_ENABLED)
+    nrfx_clock_hfclk_user_t *       p_hf_waiting;       /*< Users waiting for HFCLK start. */
+    uint16_t                        hf_requests;        /*< Number of active HFCLK requests. */
+    volatile bool                   hf_running;         /*< HFCLK started for the requests. */
+    nrfx_clock_time_get_t           hf_time_get;        /*< Time source for measurement. */
+    uint32_t                        hf_start_time;      /*< Time of the last HFCLK start. */
+    uint32_t                        hf_startup_us;      /*< Predicted HFCLK startup time. */
 #endif
 } nrfx_clock_cb_t;
 
@@ -285,11 +299,19 @@ nrfx_err_t nrfx_clock_init(nrfx_clock_event_handler_t event_handler)
     {
 #if NRFX_CHECK(NRFX_CLOCK_CONFIG_LF_CAL_ENABLED)
         m_clock_cb.cal_state = CAL_STATE_IDLE;
+        m_clock_cb.cal_temp_valid = false;
+        m_clock_cb.cal_skipped = 0;
 #endif
         m_clock_cb.event_handler = event_handler;
         m_clock_cb.module_initialized = true;
 #if NRFX_CHECK(USE_WORKAROUND_FOR_ANOMALY_201)
         m_clock_cb.hfclk_started = false;
+#endif
+#if NRFX_CHECK(NRFX_CLOCK_CONFIG_HFCLK_REQUEST_ENABLED)
+        m_clock_cb.p_hf_waiting = NULL;
+        m_clock_cb.hf_requests = 0;
+        m_clock_cb.hf_running = false;
+        m_clock_cb.hf_startup_us = NRFX_CLOCK_CONFIG_HFCLK_STARTUP_TIME_US;
 #endif
     }
 
@@ -350,6 +372,11 @@ void nrfx_clock_uninit(void)
 #endif
 #if NRF_CLOCK_HAS_HFCLKAUDIO
     clock_stop(NRF_CLOCK_DOMAIN_HFCLKAUDIO);
+#endif
+#if NRFX_CHECK(NRFX_CLOCK_CONFIG_HFCLK_REQUEST_ENABLED)
+    m_clock_cb.p_hf_waiting = NULL;
+    m_clock_cb.hf_requests = 0;
+    m_clock_cb.hf_running = false;
 #endif
     m_clock_cb.module_initialized = false;
     NRFX_LOG_INFO("Uninitialized.");
@@ -430,6 +457,32 @@ void nrfx_clock_stop(nrf_clock_domain_t domain)
     clock_stop(domain);
 }
 
+#if NRFX_CHECK(NRFX_CLOCK_CONFIG_LF_CAL_ENABLED)
+static void calibration_trigger(void)
+{
+    nrf_clock_event_clear(NRF_CLOCK, NRF_CLOCK_EVENT_DONE);
+    nrf_clock_int_enable(NRF_CLOCK, NRF_CLOCK_INT_DONE_MASK);
+    m_clock_cb.cal_state = CAL_STATE_CAL;
+#if NRFX_CHECK(USE_WORKAROUND_FOR_ANOMALY_192)
+    *(volatile uint32_t *)0x40000C34 = 0x00000002;
+#endif
+    nrf_clock_task_trigger(NRF_CLOCK, NRF_CLOCK_TASK_CAL);
+}
+
+#if NRFX_CHECK(NRFX_CLOCK_CONFIG_HFCLK_REQUEST_ENABLED)
+static nrfx_clock_hfclk_user_t m_cal_hfclk_user;
+
+static void calibration_hfclk_started(void * p_context)
+{
+    (void)p_context;
+    if (m_clock_cb.cal_state == CAL_STATE_HFCLK)
+    {
+        calibration_trigger();
+    }
+}
+#endif
+#endif // NRFX_CHECK(NRFX_CLOCK_CONFIG_LF_CAL_ENABLED)
+
 nrfx_err_t nrfx_clock_calibration_start(void)
 {
     nrfx_err_t err_code = NRFX_SUCCESS;
@@ -453,13 +506,7 @@ nrfx_err_t nrfx_clock_calibration_start(void)
 
     if (m_clock_cb.cal_state == CAL_STATE_IDLE)
     {
-        nrf_clock_event_clear(NRF_CLOCK, NRF_CLOCK_EVENT_DONE);
-        nrf_clock_int_enable(NRF_CLOCK, NRF_CLOCK_INT_DONE_MASK);
-        m_clock_cb.cal_state = CAL_STATE_CAL;
-#if NRFX_CHECK(USE_WORKAROUND_FOR_ANOMALY_192)
-        *(volatile uint32_t *)0x40000C34 = 0x00000002;
-#endif
-        nrf_clock_task_trigger(NRF_CLOCK, NRF_CLOCK_TASK_CAL);
+        calibration_trigger();
     }
     else
     {
@@ -484,6 +531,71 @@ nrfx_err_t nrfx_clock_is_calibrating(void)
     return NRFX_SUCCESS;
 }
 
+#if NRFX_CHECK(NRFX_CLOCK_CONFIG_LF_CAL_ENABLED)
+nrfx_err_t nrfx_clock_calibration_adaptive_start(int32_t temperature, bool * p_started)
+{
+    NRFX_ASSERT(m_clock_cb.module_initialized);
+    NRFX_ASSERT(p_started);
+
+    nrfx_err_t err_code = NRFX_SUCCESS;
+    *p_started = false;
+
+    if (m_clock_cb.cal_state != CAL_STATE_IDLE)
+    {
+        err_code = NRFX_ERROR_BUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    int32_t drift = temperature - m_clock_cb.cal_temp;
+    if (drift < 0)
+    {
+        drift = -drift;
+    }
+    if (m_clock_cb.cal_temp_valid &&
+        (drift < NRFX_CLOCK_CONFIG_LF_CAL_TEMP_THRESHOLD) &&
+        (m_clock_cb.cal_skipped < NRFX_CLOCK_CONFIG_LF_CAL_MAX_SKIP))
+    {
+        m_clock_cb.cal_skipped++;
+        NRFX_LOG_DEBUG("Calibration skipped, drift: %d.", (int)drift);
+        return NRFX_SUCCESS;
+    }
+
+#if NRFX_CHECK(NRFX_CLOCK_CONFIG_HFCLK_REQUEST_ENABLED)
+    if (!nrfx_clock_is_running(NRF_CLOCK_DOMAIN_LFCLK, NULL))
+    {
+        err_code = NRFX_ERROR_INVALID_STATE;
+    }
+    else
+    {
+        m_cal_hfclk_user.callback = calibration_hfclk_started;
+        m_clock_cb.cal_state = CAL_STATE_HFCLK;
+        if (nrfx_clock_hfclk_request(&m_cal_hfclk_user))
+        {
+            calibration_trigger();
+        }
+    }
+#else
+    err_code = nrfx_clock_calibration_start();
+#endif
+
+    if (err_code == NRFX_SUCCESS)
+    {
+        m_clock_cb.cal_temp = temperature;
+        m_clock_cb.cal_temp_valid = true;
+        m_clock_cb.cal_skipped = 0;
+        *p_started = true;
+    }
+
+    NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                     __func__,
+                     NRFX_LOG_ERROR_STRING_GET(err_code));
+    return err_code;
+}
+#endif // NRFX_CHECK(NRFX_CLOCK_CONFIG_LF_CAL_ENABLED)
+
 void nrfx_clock_calibration_timer_start(uint8_t interval)
 {
 #if NRFX_CHECK(NRFX_CLOCK_CONFIG_LF_CAL_ENABLED) && \
@@ -583,8 +695,135 @@ nrfx_err_t nrfx_clock_divider_set(nrf_clock_domain_t domain,
 }
 #endif
 
+#if NRFX_CHECK(NRFX_CLOCK_CONFIG_HFCLK_REQUEST_ENABLED)
+static void hfclk_startup_time_update(uint32_t sample)
+{
+    // Follow longer startups immediately and decay by 1/8 of the difference towards shorter ones.
+    if (sample >= m_clock_cb.hf_startup_us)
+    {
+        m_clock_cb.hf_startup_us = sample;
+    }
+    else
+    {
+        m_clock_cb.hf_startup_us -= (m_clock_cb.hf_startup_us - sample) / 8;
+    }
+}
+
+bool nrfx_clock_hfclk_request(nrfx_clock_hfclk_user_t * p_user)
+{
+    NRFX_ASSERT(m_clock_cb.module_initialized);
+    NRFX_ASSERT(p_user);
+    NRFX_ASSERT(!p_user->requested);
+
+    bool running;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    p_user->requested = true;
+    running = m_clock_cb.hf_running;
+    if (!running)
+    {
+        p_user->p_next = m_clock_cb.p_hf_waiting;
+        m_clock_cb.p_hf_waiting = p_user;
+    }
+    if (m_clock_cb.hf_requests++ == 0)
+    {
+        if (m_clock_cb.hf_time_get)
+        {
+            m_clock_cb.hf_start_time = m_clock_cb.hf_time_get();
+        }
+        nrfx_clock_start(NRF_CLOCK_DOMAIN_HFCLK);
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    return running;
+}
+
+void nrfx_clock_hfclk_release(nrfx_clock_hfclk_user_t * p_user)
+{
+    NRFX_ASSERT(m_clock_cb.module_initialized);
+    NRFX_ASSERT(p_user);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    if (p_user->requested)
+    {
+        p_user->requested = false;
+
+        nrfx_clock_hfclk_user_t ** pp_user = &m_clock_cb.p_hf_waiting;
+        while (*pp_user && (*pp_user != p_user))
+        {
+            pp_user = &(*pp_user)->p_next;
+        }
+        if (*pp_user)
+        {
+            *pp_user = p_user->p_next;
+        }
+
+        NRFX_ASSERT(m_clock_cb.hf_requests > 0);
+        if (--m_clock_cb.hf_requests == 0)
+        {
+            m_clock_cb.hf_running = false;
+            nrfx_clock_stop(NRF_CLOCK_DOMAIN_HFCLK);
+        }
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+void nrfx_clock_hfclk_time_source_set(nrfx_clock_time_get_t time_get)
+{
+    NRFX_ASSERT(m_clock_cb.module_initialized);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    m_clock_cb.hf_time_get = time_get;
+    if (time_get)
+    {
+        // A startup already in progress has no valid start time, so measure from now.
+        m_clock_cb.hf_start_time = time_get();
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+uint32_t nrfx_clock_hfclk_startup_time_get(void)
+{
+    return m_clock_cb.hf_startup_us;
+}
+#endif // NRFX_CHECK(NRFX_CLOCK_CONFIG_HFCLK_REQUEST_ENABLED)
+
+static void hfclk_started_process(void)
+{
+#if NRFX_CHECK(NRFX_CLOCK_CONFIG_HFCLK_REQUEST_ENABLED)
+    nrfx_clock_hfclk_user_t * p_user = NULL;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    if (m_clock_cb.hf_requests > 0)
+    {
+        m_clock_cb.hf_running = true;
+        p_user = m_clock_cb.p_hf_waiting;
+        m_clock_cb.p_hf_waiting = NULL;
+        if (m_clock_cb.hf_time_get)
+        {
+            hfclk_startup_time_update(m_clock_cb.hf_time_get() - m_clock_cb.hf_start_time);
+        }
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    while (p_user)
+    {
+        // Take the link first, the callback is allowed to release and request the user again.
+        nrfx_clock_hfclk_user_t * p_next = p_user->p_next;
+        if (p_user->requested && p_user->callback)
+        {
+            p_user->callback(p_user->p_context);
+        }
+        p_user = p_next;
+    }
+#endif
+    m_clock_cb.event_handler(NRFX_CLOCK_EVT_HFCLK_STARTED);
+}
+
 void nrfx_clock_irq_handler(void)
 {
+    NRFX_IRQ_ENTER(NRF_CLOCK);
+
     if (nrf_clock_event_check(NRF_CLOCK, NRF_CLOCK_EVENT_HFCLKSTARTED))
     {
         nrf_clock_event_clear(NRF_CLOCK, NRF_CLOCK_EVENT_HFCLKSTARTED);
@@ -595,10 +834,10 @@ void nrfx_clock_irq_handler(void)
         if (!m_clock_cb.hfclk_started)
         {
             m_clock_cb.hfclk_started = true;
-            m_clock_cb.event_handler(NRFX_CLOCK_EVT_HFCLK_STARTED);
+            hfclk_started_process();
         }
 #else
-        m_clock_cb.event_handler(NRFX_CLOCK_EVT_HFCLK_STARTED);
+        hfclk_started_process();
 #endif
     }
     if (nrf_clock_event_check(NRF_CLOCK, NRF_CLOCK_EVENT_LFCLKSTARTED))
@@ -657,6 +896,9 @@ void nrfx_clock_irq_handler(void)
         NRFX_LOG_DEBUG("Event: NRF_CLOCK_EVENT_DONE");
         nrf_clock_int_disable(NRF_CLOCK, NRF_CLOCK_INT_DONE_MASK);
         m_clock_cb.cal_state = CAL_STATE_IDLE;
+#if NRFX_CHECK(NRFX_CLOCK_CONFIG_HFCLK_REQUEST_ENABLED)
+        nrfx_clock_hfclk_release(&m_cal_hfclk_user);
+#endif
         m_clock_cb.event_handler(NRFX_CLOCK_EVT_CAL_DONE);
     }
 #endif // NRFX_CHECK(NRFX_CLOCK_CONFIG_LF_CAL_ENABLED)
@@ -682,6 +924,8 @@ void nrfx_clock_irq_handler(void)
         m_clock_cb.event_handler(NRFX_CLOCK_EVT_HFCLK192M_STARTED);
     }
 #endif
+
+    NRFX_IRQ_EXIT(NRF_CLOCK);
 }
 
 #endif // NRFX_CHECK(NRFX_CLOCK_ENABLED)
@@ -87,6 +87,8 @@ static void comp_execute_handler(nrf_comp_event_t event, uint32_t event_mask)
 
 void nrfx_comp_irq_handler(void)
 {
+    NRFX_IRQ_ENTER(NRF_COMP);
+
     uint32_t evt_mask = nrfy_comp_events_process(NRF_COMP,
                                                  NRF_COMP_INT_READY_MASK |
                                                  NRF_COMP_INT_DOWN_MASK |
@@ -96,6 +98,8 @@ void nrfx_comp_irq_handler(void)
     comp_execute_handler(NRF_COMP_EVENT_DOWN,  evt_mask);
     comp_execute_handler(NRF_COMP_EVENT_UP,    evt_mask);
     comp_execute_handler(NRF_COMP_EVENT_CROSS, evt_mask);
+
+    NRFX_IRQ_EXIT(NRF_COMP);
 }
 
 
@@ -53,31 +53,46 @@
 #endif
 
 #if defined(DPPI_CH_NUM)
-#define DPPI_AVAILABLE_CHANNELS_MASK \
-    ((uint32_t)(NRFX_BIT_MASK(DPPI_CH_NUM) & (~NRFX_DPPI_CHANNELS_USED)))
+#define DPPI_CHANNEL_COUNT DPPI_CH_NUM
 #else
-#define DPPI_AVAILABLE_CHANNELS_MASK \
-    ((uint32_t)(NRFX_BIT_MASK(NRF_DPPI_CH_NUM_MAX) & (~NRFX_DPPI_CHANNELS_USED)))
+#define DPPI_CHANNEL_COUNT NRF_DPPI_CH_NUM_MAX
 #endif
 
+#define DPPI_AVAILABLE_CHANNELS_MASK \
+    ((uint32_t)(NRFX_BIT_MASK(DPPI_CHANNEL_COUNT) & (~NRFX_DPPI_CHANNELS_USED)))
+
+/* Number of words of the channel allocation bitset. */
+#define DPPI_CHANNEL_WORDS NRFX_FLAG32_ARRAY_WORDS(DPPI_CHANNEL_COUNT)
+
+/* Channel masks in DPPIC registers hold all channels of the instance in one word. */
+NRFX_STATIC_ASSERT(DPPI_CHANNEL_WORDS == 1);
+
 #define DPPI_AVAILABLE_GROUPS_MASK \
     (NRFX_BIT_MASK(DPPI_GROUP_NUM) & (~NRFX_DPPI_GROUPS_USED))
 
 /** @brief Set bit at given position. */
 #define DPPI_BIT_SET(pos) (1uL << (pos))
 
-/**< Bitmap representing channels availability. */
-static nrfx_atomic_t   m_allocated_channels = DPPI_AVAILABLE_CHANNELS_MASK;
+/**< Initial state of the channel bitset. */
+static const uint32_t  m_available_channels[DPPI_CHANNEL_WORDS] = { DPPI_AVAILABLE_CHANNELS_MASK };
+/**< Bitset representing channels availability. */
+static nrfx_atomic_t   m_allocated_channels[DPPI_CHANNEL_WORDS] = { DPPI_AVAILABLE_CHANNELS_MASK };
 /**< Bitmap representing groups availability. */
 static nrfx_atomic_t   m_allocated_groups = DPPI_AVAILABLE_GROUPS_MASK;
 
+static bool channel_mask_is_allocated(uint32_t mask)
+{
+    return ((mask & ~DPPI_AVAILABLE_CHANNELS_MASK) == 0) &&
+           ((mask & (uint32_t)m_allocated_channels[0]) == 0);
+}
+
 void nrfx_dppi_free(void)
 {
     uint32_t mask = DPPI_AVAILABLE_GROUPS_MASK & ~m_allocated_groups;
     uint8_t group_idx = NRF_DPPI_CHANNEL_GROUP0;
 
     // Disable all channels
-    nrfy_dppi_channels_disable(NRF_DPPIC, DPPI_AVAILABLE_CHANNELS_MASK & ~m_allocated_channels);
+    nrfy_dppi_channels_disable(NRF_DPPIC, DPPI_AVAILABLE_CHANNELS_MASK & ~m_allocated_channels[0]);
 
     // Clear all groups configurations
     while (mask)
@@ -92,7 +107,7 @@ void nrfx_dppi_free(void)
     }
 
     // Clear all allocated channels.
-    m_allocated_channels = DPPI_AVAILABLE_CHANNELS_MASK;
+    nrfx_flag32_array_init(m_allocated_channels, DPPI_CHANNEL_WORDS, m_available_channels);
 
     // Clear all allocated groups.
     m_allocated_groups = DPPI_AVAILABLE_GROUPS_MASK;
@@ -100,20 +115,45 @@ void nrfx_dppi_free(void)
 
 nrfx_err_t nrfx_dppi_channel_alloc(uint8_t * p_channel)
 {
-    return nrfx_flag32_alloc(&m_allocated_channels, p_channel);
+    return nrfx_dppi_channel_range_alloc(1, p_channel);
 }
 
 nrfx_err_t nrfx_dppi_channel_free(uint8_t channel)
 {
-    nrfy_dppi_channels_disable(NRF_DPPIC, NRFX_BIT(channel));
-    return nrfx_flag32_free(&m_allocated_channels, channel);
+    return nrfx_dppi_channel_range_free(channel, 1);
+}
+
+nrfx_err_t nrfx_dppi_channel_range_alloc(uint8_t count, uint8_t * p_first)
+{
+    uint16_t   first;
+    nrfx_err_t err_code = nrfx_flag32_array_range_alloc(m_allocated_channels,
+                                                        DPPI_CHANNEL_WORDS,
+                                                        count,
+                                                        &first);
+
+    if (err_code == NRFX_SUCCESS)
+    {
+        *p_first = (uint8_t)first;
+    }
+    return err_code;
+}
+
+nrfx_err_t nrfx_dppi_channel_range_free(uint8_t first, uint8_t count)
+{
+    if ((count == 0) || (first + count > DPPI_CHANNEL_COUNT))
+    {
+        return NRFX_ERROR_INVALID_PARAM;
+    }
+
+    nrfy_dppi_channels_disable(NRF_DPPIC, NRFX_BIT_MASK(count) << first);
+    return nrfx_flag32_array_range_free(m_allocated_channels, first, count);
 }
 
 nrfx_err_t nrfx_dppi_channel_enable(uint8_t channel)
 {
     nrfx_err_t err_code = NRFX_SUCCESS;
 
-    if (!nrfx_flag32_is_allocated(m_allocated_channels, channel))
+    if (!nrfx_flag32_array_is_allocated(m_allocated_channels, channel))
     {
         err_code = NRFX_ERROR_INVALID_PARAM;
     }
@@ -129,7 +169,7 @@ nrfx_err_t nrfx_dppi_channel_disable(uint8_t channel)
 {
     nrfx_err_t err_code = NRFX_SUCCESS;
 
-    if (!nrfx_flag32_is_allocated(m_allocated_channels, channel))
+    if (!nrfx_flag32_array_is_allocated(m_allocated_channels, channel))
     {
         err_code = NRFX_ERROR_INVALID_PARAM;
     }
@@ -159,7 +199,7 @@ nrfx_err_t nrfx_dppi_channel_include_in_group(uint8_t                  channel,
     nrfx_err_t err_code = NRFX_SUCCESS;
 
     if (!nrfx_flag32_is_allocated(m_allocated_groups, group) ||
-        !nrfx_flag32_is_allocated(m_allocated_channels, channel))
+        !nrfx_flag32_array_is_allocated(m_allocated_channels, channel))
     {
         err_code = NRFX_ERROR_INVALID_PARAM;
     }
@@ -179,7 +219,7 @@ nrfx_err_t nrfx_dppi_channel_remove_from_group(uint8_t                  channel,
     nrfx_err_t err_code = NRFX_SUCCESS;
 
     if (!nrfx_flag32_is_allocated(m_allocated_groups, group) ||
-        !nrfx_flag32_is_allocated(m_allocated_channels, channel))
+        !nrfx_flag32_array_is_allocated(m_allocated_channels, channel))
     {
         err_code = NRFX_ERROR_INVALID_PARAM;
     }
@@ -241,4 +281,109 @@ nrfx_err_t nrfx_dppi_group_disable(nrf_dppi_channel_group_t group)
     return err_code;
 }
 
+nrfx_err_t nrfx_dppi_channels_update(uint32_t enable_mask, uint32_t disable_mask)
+{
+    nrfx_err_t err_code = NRFX_SUCCESS;
+
+    if (((enable_mask & disable_mask) != 0) ||
+        !channel_mask_is_allocated(enable_mask | disable_mask))
+    {
+        err_code = NRFX_ERROR_INVALID_PARAM;
+    }
+    else
+    {
+        // Back-to-back writes so that no other context observes a partial change.
+        NRFY_CRITICAL_SECTION_ENTER();
+        nrfy_dppi_channels_disable(NRF_DPPIC, disable_mask);
+        nrfy_dppi_channels_enable(NRF_DPPIC, enable_mask);
+        NRFY_CRITICAL_SECTION_EXIT();
+    }
+    NRFX_LOG_INFO("Function: %s, error code: %s.", __func__, NRFX_LOG_ERROR_STRING_GET(err_code));
+    return err_code;
+}
+
+nrfx_err_t nrfx_dppi_group_config_set(nrf_dppi_channel_group_t group, uint32_t channel_mask)
+{
+    nrfx_err_t err_code = NRFX_SUCCESS;
+
+    if (!nrfx_flag32_is_allocated(m_allocated_groups, group) ||
+        !channel_mask_is_allocated(channel_mask))
+    {
+        err_code = NRFX_ERROR_INVALID_PARAM;
+    }
+    else
+    {
+        nrfy_dppi_group_channels_set(NRF_DPPIC, channel_mask, group);
+    }
+    NRFX_LOG_INFO("Function: %s, error code: %s.", __func__, NRFX_LOG_ERROR_STRING_GET(err_code));
+    return err_code;
+}
+
+nrfx_err_t nrfx_dppi_group_swap(nrf_dppi_channel_group_t from, nrf_dppi_channel_group_t to)
+{
+    nrfx_err_t err_code = NRFX_SUCCESS;
+
+    if (!nrfx_flag32_is_allocated(m_allocated_groups, from) ||
+        !nrfx_flag32_is_allocated(m_allocated_groups, to) ||
+        (from == to))
+    {
+        err_code = NRFX_ERROR_INVALID_PARAM;
+    }
+    else
+    {
+        NRFY_CRITICAL_SECTION_ENTER();
+        nrfy_dppi_group_disable(NRF_DPPIC, from);
+        nrfy_dppi_group_enable(NRF_DPPIC, to);
+        NRFY_CRITICAL_SECTION_EXIT();
+    }
+    NRFX_LOG_INFO("Function: %s, error code: %s.", __func__, NRFX_LOG_ERROR_STRING_GET(err_code));
+    return err_code;
+}
+
+nrfx_err_t nrfx_dppi_group_swap_channel_set(uint8_t                  channel,
+                                            nrf_dppi_channel_group_t from,
+                                            nrf_dppi_channel_group_t to)
+{
+    nrfx_err_t err_code = NRFX_SUCCESS;
+
+    if (!nrfx_flag32_is_allocated(m_allocated_groups, from) ||
+        !nrfx_flag32_is_allocated(m_allocated_groups, to) ||
+        (from == to) ||
+        !nrfx_flag32_array_is_allocated(m_allocated_channels, channel))
+    {
+        err_code = NRFX_ERROR_INVALID_PARAM;
+    }
+    else
+    {
+        // Both group tasks are triggered by the same event, so the swap happens in hardware.
+        nrfy_dppi_subscribe_set(NRF_DPPIC,
+                                nrfy_dppi_group_disable_task_get((uint8_t)from),
+                                channel);
+        nrfy_dppi_subscribe_set(NRF_DPPIC,
+                                nrfy_dppi_group_enable_task_get((uint8_t)to),
+                                channel);
+    }
+    NRFX_LOG_INFO("Function: %s, error code: %s.", __func__, NRFX_LOG_ERROR_STRING_GET(err_code));
+    return err_code;
+}
+
+nrfx_err_t nrfx_dppi_group_swap_channel_clear(nrf_dppi_channel_group_t from,
+                                              nrf_dppi_channel_group_t to)
+{
+    nrfx_err_t err_code = NRFX_SUCCESS;
+
+    if (!nrfx_flag32_is_allocated(m_allocated_groups, from) ||
+        !nrfx_flag32_is_allocated(m_allocated_groups, to))
+    {
+        err_code = NRFX_ERROR_INVALID_PARAM;
+    }
+    else
+    {
+        nrfy_dppi_subscribe_clear(NRF_DPPIC, nrfy_dppi_group_disable_task_get((uint8_t)from));
+        nrfy_dppi_subscribe_clear(NRF_DPPIC, nrfy_dppi_group_enable_task_get((uint8_t)to));
+    }
+    NRFX_LOG_INFO("Function: %s, error code: %s.", __func__, NRFX_LOG_ERROR_STRING_GET(err_code));
+    return err_code;
+}
+
 #endif // defined(DPPI_PRESENT) && defined(DPPIC_COUNT == 1)
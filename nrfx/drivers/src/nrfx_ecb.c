@@ -0,0 +1,301 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_ECB_ENABLED)
+
+#include <nrfx_ecb.h>
+#include <string.h>
+
+#define NRFX_LOG_MODULE ECB
+#include <nrfx_log.h>
+
+#if !NRF_ECB_HAS_ECBDATAPTR
+#error "The ECB driver supports only the peripheral with the ECBDATAPTR register."
+#endif
+
+/* Offsets of the fields in the ECB data structure. */
+#define ECB_KEY_OFFSET        0
+#define ECB_CLEARTEXT_OFFSET  NRFX_ECB_BLOCK_SIZE
+#define ECB_CIPHERTEXT_OFFSET (2 * NRFX_ECB_BLOCK_SIZE)
+
+#define ECB_INT_MASK (NRF_ECB_INT_ENDECB_MASK | NRF_ECB_INT_ERRORECB_MASK)
+
+/* Control block of the ECB driver. */
+typedef struct
+{
+    nrfx_ecb_job_t * p_head;   ///< Job with the block in progress.
+    nrfx_ecb_job_t * p_tail;   ///< Last queued job.
+    bool             sync;     ///< True if a blocking encryption is in progress.
+    nrfx_drv_state_t state;    ///< Driver state.
+    uint8_t          data[3 * NRFX_ECB_BLOCK_SIZE]; ///< Data structure used by the peripheral.
+} ecb_control_block_t;
+
+static ecb_control_block_t m_cb;
+
+static void ecb_start(uint8_t const * p_key, uint8_t const * p_in)
+{
+    memcpy(&m_cb.data[ECB_KEY_OFFSET], p_key, NRFX_ECB_BLOCK_SIZE);
+    memcpy(&m_cb.data[ECB_CLEARTEXT_OFFSET], p_in, NRFX_ECB_BLOCK_SIZE);
+    nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ENDECB);
+    nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ERRORECB);
+    nrf_ecb_task_trigger(NRF_ECB, NRF_ECB_TASK_STARTECB);
+}
+
+static void job_block_start(nrfx_ecb_job_t const * p_job)
+{
+    ecb_start(p_job->p_key, &p_job->p_in[p_job->done * NRFX_ECB_BLOCK_SIZE]);
+}
+
+/* Must be called in a critical section. */
+static void job_append(nrfx_ecb_job_t * p_job)
+{
+    p_job->p_next = NULL;
+    if (m_cb.p_tail)
+    {
+        m_cb.p_tail->p_next = p_job;
+    }
+    else
+    {
+        m_cb.p_head = p_job;
+    }
+    m_cb.p_tail = p_job;
+}
+
+nrfx_err_t nrfx_ecb_init(nrfx_ecb_config_t const * p_config)
+{
+    NRFX_ASSERT(p_config);
+
+    if (m_cb.state != NRFX_DRV_STATE_UNINITIALIZED)
+    {
+        return NRFX_ERROR_ALREADY_INITIALIZED;
+    }
+
+    m_cb.p_head = NULL;
+    m_cb.p_tail = NULL;
+    m_cb.sync   = false;
+
+    nrf_ecb_data_pointer_set(NRF_ECB, m_cb.data);
+    nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ENDECB);
+    nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ERRORECB);
+    nrf_ecb_int_enable(NRF_ECB, ECB_INT_MASK);
+    NRFX_IRQ_PRIORITY_SET(nrfx_get_irq_number(NRF_ECB), p_config->interrupt_priority);
+    NRFX_IRQ_ENABLE(nrfx_get_irq_number(NRF_ECB));
+
+    m_cb.state = NRFX_DRV_STATE_INITIALIZED;
+    NRFX_LOG_INFO("Initialized.");
+    return NRFX_SUCCESS;
+}
+
+void nrfx_ecb_uninit(void)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_INITIALIZED);
+
+    NRFX_IRQ_DISABLE(nrfx_get_irq_number(NRF_ECB));
+    nrf_ecb_int_disable(NRF_ECB, ECB_INT_MASK);
+    nrf_ecb_task_trigger(NRF_ECB, NRF_ECB_TASK_STOPECB);
+
+    for (nrfx_ecb_job_t * p_job = m_cb.p_head; p_job; p_job = p_job->p_next)
+    {
+        p_job->pending = false;
+    }
+    m_cb.p_head = NULL;
+    m_cb.p_tail = NULL;
+
+    m_cb.state = NRFX_DRV_STATE_UNINITIALIZED;
+    NRFX_LOG_INFO("Uninitialized.");
+}
+
+nrfx_err_t nrfx_ecb_encrypt(uint8_t const * p_key, uint8_t const * p_in, uint8_t * p_out)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_INITIALIZED);
+    NRFX_ASSERT(p_key && p_in && p_out);
+
+    nrfx_err_t       err_code = NRFX_SUCCESS;
+    nrfx_ecb_job_t * p_job;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    if (m_cb.sync || m_cb.p_head)
+    {
+        err_code = NRFX_ERROR_BUSY;
+    }
+    else
+    {
+        m_cb.sync = true;
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    /* The events are polled, so they must not be cleared by the interrupt handler. */
+    nrf_ecb_int_disable(NRF_ECB, ECB_INT_MASK);
+    ecb_start(p_key, p_in);
+    while (!nrf_ecb_event_check(NRF_ECB, NRF_ECB_EVENT_ENDECB) &&
+           !nrf_ecb_event_check(NRF_ECB, NRF_ECB_EVENT_ERRORECB))
+    {}
+
+    if (nrf_ecb_event_check(NRF_ECB, NRF_ECB_EVENT_ENDECB))
+    {
+        memcpy(p_out, &m_cb.data[ECB_CIPHERTEXT_OFFSET], NRFX_ECB_BLOCK_SIZE);
+    }
+    else
+    {
+        err_code = NRFX_ERROR_INTERNAL;
+    }
+    nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ENDECB);
+    nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ERRORECB);
+    nrf_ecb_int_enable(NRF_ECB, ECB_INT_MASK);
+
+    /* Jobs enqueued in the meantime are waiting for the peripheral. */
+    NRFX_CRITICAL_SECTION_ENTER();
+    m_cb.sync = false;
+    p_job = m_cb.p_head;
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    if (p_job)
+    {
+        job_block_start(p_job);
+    }
+
+    NRFX_LOG_INFO("Function: %s, error code: %s.",
+                  __func__,
+                  NRFX_LOG_ERROR_STRING_GET(err_code));
+    return err_code;
+}
+
+nrfx_err_t nrfx_ecb_job_enqueue(nrfx_ecb_job_t * p_job)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_INITIALIZED);
+    NRFX_ASSERT(p_job->p_key && p_job->p_in && p_job->p_out);
+    NRFX_ASSERT(p_job->count > 0);
+    NRFX_ASSERT(p_job->handler);
+
+    nrfx_err_t err_code = NRFX_SUCCESS;
+    bool       start    = false;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    if (p_job->pending)
+    {
+        err_code = NRFX_ERROR_BUSY;
+    }
+    else
+    {
+        p_job->pending = true;
+        p_job->done    = 0;
+        job_append(p_job);
+        start = (m_cb.p_head == p_job) && !m_cb.sync;
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    if (start)
+    {
+        job_block_start(p_job);
+    }
+    return err_code;
+}
+
+bool nrfx_ecb_job_is_pending(nrfx_ecb_job_t const * p_job)
+{
+    return p_job->pending;
+}
+
+static void ecb_irq_handle(void)
+{
+    nrfx_ecb_job_t * p_job = m_cb.p_head;
+
+    if (nrf_ecb_event_check(NRF_ECB, NRF_ECB_EVENT_ERRORECB))
+    {
+        nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ERRORECB);
+        NRFX_LOG_DEBUG("Event: NRF_ECB_EVENT_ERRORECB.");
+        /* The block was aborted by a peripheral with higher priority. */
+        if (p_job)
+        {
+            job_block_start(p_job);
+        }
+        return;
+    }
+    if (!nrf_ecb_event_check(NRF_ECB, NRF_ECB_EVENT_ENDECB) || !p_job)
+    {
+        return;
+    }
+    nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ENDECB);
+
+    memcpy(&p_job->p_out[p_job->done * NRFX_ECB_BLOCK_SIZE],
+           &m_cb.data[ECB_CIPHERTEXT_OFFSET],
+           NRFX_ECB_BLOCK_SIZE);
+    p_job->done++;
+
+    bool             complete = (p_job->done == p_job->count);
+    nrfx_ecb_job_t * p_next;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    m_cb.p_head = p_job->p_next;
+    if (!m_cb.p_head)
+    {
+        m_cb.p_tail = NULL;
+    }
+    if (complete)
+    {
+        p_job->pending = false;
+    }
+    else
+    {
+        /* Round-robin, the next block of this job is encrypted after the other jobs. */
+        job_append(p_job);
+    }
+    p_next = m_cb.p_head;
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    /* The next block is started before the handler to keep the peripheral busy. */
+    if (p_next)
+    {
+        job_block_start(p_next);
+    }
+    if (complete)
+    {
+        p_job->handler(p_job, p_job->p_context);
+    }
+}
+
+void nrfx_ecb_irq_handler(void)
+{
+    NRFX_IRQ_ENTER(NRF_ECB);
+    ecb_irq_handle();
+    NRFX_IRQ_EXIT(NRF_ECB);
+}
+
+#endif // NRFX_CHECK(NRFX_ECB_ENABLED)
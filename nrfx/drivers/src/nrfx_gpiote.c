@@ -38,6 +38,10 @@
 #include <helpers/nrfx_flag32_allocator.h>
 #include "nrf_bitmask.h"
 #include <string.h>
+#if NRFX_CHECK(NRFX_GPIOTE_CONFIG_DEBOUNCE_ENABLED)
+#include <haly/nrfy_timer.h>
+#include <helpers/nrfx_gppi.h>
+#endif
 
 #define NRFX_LOG_MODULE GPIOTE
 #include <nrfx_log.h>
@@ -151,6 +155,30 @@ NRFX_STATIC_ASSERT((NRFX_BIT(PIN_TE_ID_BITS)) >= GPIOTE_CH_NUM);
 /* Macro for getting Task/Event index from flags. */
 #define PIN_GET_TE_ID(flags) ((flags & PIN_TE_ID_MASK) >> PIN_TE_ID_SHIFT)
 
+/* Number of words of the allocation bitsets. */
+#define GPIOTE_CHANNEL_WORDS NRFX_FLAG32_ARRAY_WORDS(GPIOTE_CH_NUM)
+#define GPIOTE_HANDLER_WORDS NRFX_FLAG32_ARRAY_WORDS(NRFX_GPIOTE_CONFIG_NUM_OF_EVT_HANDLERS)
+
+#if NRFX_GPIOTE_CONFIG_NUM_OF_GROUP_HANDLERS > 0
+/* Structure holding a group of pins dispatched to one handler. */
+typedef struct
+{
+    nrfx_gpiote_port_handler_t handler;
+    void *                      p_context;
+    uint32_t                    pin_mask;
+    uint8_t                     port_idx;
+} gpiote_group_t;
+#endif
+
+#if NRFX_CHECK(NRFX_GPIOTE_CONFIG_DEBOUNCE_ENABLED)
+/* Structure holding debounce resources of a GPIOTE channel. */
+typedef struct
+{
+    NRF_TIMER_Type * p_timer;
+    uint8_t          ppi_channel;
+} gpiote_debounce_t;
+#endif
+
 /* Structure holding state of the pins */
 typedef struct
 {
@@ -160,23 +188,48 @@ typedef struct
     /* Global handler called on each event */
     nrfx_gpiote_handler_config_t global_handler;
 
+#if NRFX_CHECK(NRFX_GPIOTE_CONFIG_PORT_CALLBACK_ENABLED)
+    /* Handler called once per port with all pins reported by the PORT event. */
+    nrfx_gpiote_port_handler_t   port_handler;
+    void *                       port_handler_context;
+#endif
+
     /* Each pin state */
     uint16_t                     pin_flags[MAX_PIN_NUMBER];
 
-    /* Mask for tracking gpiote channel allocation. */
-    nrfx_atomic_t                available_channels_mask;
+    /* Bitset for tracking gpiote channel allocation. */
+    nrfx_atomic_t                available_channels_mask[GPIOTE_CHANNEL_WORDS];
+
+    /* Bitset for tracking event handler entries allocation. */
+    nrfx_atomic_t                available_evt_handlers[GPIOTE_HANDLER_WORDS];
 
-    /* Mask for tracking event handler entries allocation. */
-    nrfx_atomic_t                available_evt_handlers;
+    /* Number of pins using each of the pin specific handlers. */
+    uint8_t                      handler_pin_count[NRFX_GPIOTE_CONFIG_NUM_OF_EVT_HANDLERS];
 
 #if !defined(NRF_GPIO_LATCH_PRESENT)
     uint32_t                     port_pins[GPIO_COUNT];
+#endif
+#if NRFX_GPIOTE_CONFIG_NUM_OF_GROUP_HANDLERS > 0
+    /* Pin group handlers. */
+    gpiote_group_t               groups[NRFX_GPIOTE_CONFIG_NUM_OF_GROUP_HANDLERS];
+
+    /* Union of masks of all groups, per port index used in the PORT event handler. */
+    uint32_t                     group_pins[GPIO_COUNT];
+#endif
+#if NRFX_CHECK(NRFX_GPIOTE_CONFIG_DEBOUNCE_ENABLED)
+    /* Debounce resources, indexed by GPIOTE channel. */
+    gpiote_debounce_t            debounce[GPIOTE_CH_NUM];
 #endif
     nrfx_drv_state_t             state;
 } gpiote_control_block_t;
 
 static gpiote_control_block_t m_cb = {
-    .available_channels_mask = NRFX_GPIOTE_APP_CHANNELS_MASK
+    .available_channels_mask = { NRFX_GPIOTE_APP_CHANNELS_MASK }
+};
+
+/* Initial state of the event handler bitset. */
+static const uint32_t m_available_evt_handlers[GPIOTE_HANDLER_WORDS] = {
+    NRFX_BIT_MASK(NRFX_GPIOTE_CONFIG_NUM_OF_EVT_HANDLERS)
 };
 
 #if defined(NRF_GPIO_LATCH_PRESENT) || (!FULL_PORTS_PRESENT)
@@ -309,18 +362,6 @@ static bool is_level(nrfx_gpiote_trigger_t trigger)
     return trigger >= NRFX_GPIOTE_TRIGGER_LOW;
 }
 
-static bool handler_in_use(int32_t handler_id)
-{
-    for (uint32_t i = 0; i < MAX_PIN_NUMBER; i++)
-    {
-        if (PIN_GET_HANDLER_ID(m_cb.pin_flags[i]) == handler_id)
-        {
-            return true;
-        }
-    }
-    return false;
-}
-
 /* Function clears pin handler flag and releases handler slot if handler+context
  * pair is not used by other pin. */
 static void release_handler(nrfx_gpiote_pin_t pin)
@@ -335,18 +376,97 @@ static void release_handler(nrfx_gpiote_pin_t pin)
 
     m_cb.pin_flags[idx] &= ~PIN_HANDLER_MASK;
 
-    /* Check if other pin is using same handler and release handler only if handler
-     * is not used by others.
-     */
-    if (!handler_in_use(handler_id))
+    /* Release handler only if handler is not used by other pins. */
+    NRFX_ASSERT(m_cb.handler_pin_count[handler_id] > 0);
+    if (--m_cb.handler_pin_count[handler_id] == 0)
     {
         m_cb.handlers[handler_id].handler = NULL;
-        nrfx_err_t err = nrfx_flag32_free(&m_cb.available_evt_handlers, handler_id);
+        nrfx_err_t err = nrfx_flag32_array_free(m_cb.available_evt_handlers,
+                                                (uint16_t)handler_id);
         (void)err;
         NRFX_ASSERT(err == NRFX_SUCCESS);
     }
 }
 
+#if NRFX_CHECK(NRFX_GPIOTE_CONFIG_DEBOUNCE_ENABLED)
+static bool debounce_used(uint8_t ch)
+{
+    return m_cb.debounce[ch].p_timer != NULL;
+}
+
+/* Function connects the IN event of the channel to the TIMER, which then
+ * measures the time since the last edge. */
+static nrfx_err_t debounce_setup(uint8_t ch, nrfx_gpiote_debounce_config_t const * p_config)
+{
+    gpiote_debounce_t * p_deb = &m_cb.debounce[ch];
+    NRF_TIMER_Type *    p_timer = p_config->p_timer;
+    uint32_t            base;
+
+    if (!p_timer || (p_config->window_us == 0))
+    {
+        return NRFX_ERROR_INVALID_PARAM;
+    }
+
+    base = NRF_TIMER_BASE_FREQUENCY_GET(p_timer);
+    if (nrfx_gppi_channel_alloc(&p_deb->ppi_channel) != NRFX_SUCCESS)
+    {
+        return NRFX_ERROR_NO_MEM;
+    }
+
+    /* Window is counted in microseconds. STOP and CLEAR on COMPARE0 make the TIMER
+     * ready for the next press without CPU involvement. */
+    nrfy_timer_config_t timer_config = {
+        .prescaler = NRF_TIMER_PRESCALER_CALCULATE(base, NRFX_MHZ_TO_HZ(1)),
+        .mode      = NRF_TIMER_MODE_TIMER,
+        .bit_width = NRF_TIMER_BIT_WIDTH_32
+    };
+    nrfy_timer_task_trigger(p_timer, NRF_TIMER_TASK_STOP);
+    nrfy_timer_periph_configure(p_timer, &timer_config);
+    nrfy_timer_task_trigger(p_timer, NRF_TIMER_TASK_CLEAR);
+    nrfy_timer_cc_set(p_timer, NRF_TIMER_CC_CHANNEL0, p_config->window_us);
+    nrfy_timer_shorts_enable(p_timer, NRF_TIMER_SHORT_COMPARE0_STOP_MASK |
+                                      NRF_TIMER_SHORT_COMPARE0_CLEAR_MASK);
+    nrfy_timer_int_init(p_timer, NRF_TIMER_INT_COMPARE0_MASK, p_config->irq_priority, false);
+
+    /* Each edge restarts the window, so bounces extend it instead of being reported. */
+    nrfx_gppi_channel_endpoints_setup(p_deb->ppi_channel,
+        nrfy_gpiote_event_address_get(NRF_GPIOTE, nrf_gpiote_in_event_get(ch)),
+        nrfy_timer_task_address_get(p_timer, NRF_TIMER_TASK_CLEAR));
+    nrfx_gppi_fork_endpoint_setup(p_deb->ppi_channel,
+        nrfy_timer_task_address_get(p_timer, NRF_TIMER_TASK_START));
+    nrfx_gppi_channels_enable(NRFX_BIT(p_deb->ppi_channel));
+
+    p_deb->p_timer = p_timer;
+    return NRFX_SUCCESS;
+}
+
+static void debounce_release(uint8_t ch)
+{
+    gpiote_debounce_t * p_deb = &m_cb.debounce[ch];
+
+    if (!debounce_used(ch))
+    {
+        return;
+    }
+
+    nrfx_gppi_channels_disable(NRFX_BIT(p_deb->ppi_channel));
+    nrfx_gppi_channel_endpoints_clear(p_deb->ppi_channel,
+        nrfy_gpiote_event_address_get(NRF_GPIOTE, nrf_gpiote_in_event_get(ch)),
+        nrfy_timer_task_address_get(p_deb->p_timer, NRF_TIMER_TASK_CLEAR));
+    nrfx_gppi_fork_endpoint_clear(p_deb->ppi_channel,
+        nrfy_timer_task_address_get(p_deb->p_timer, NRF_TIMER_TASK_START));
+    (void)nrfx_gppi_channel_free(p_deb->ppi_channel);
+
+    nrfy_timer_task_trigger(p_deb->p_timer, NRF_TIMER_TASK_STOP);
+    nrfy_timer_task_trigger(p_deb->p_timer, NRF_TIMER_TASK_CLEAR);
+    nrfy_timer_shorts_disable(p_deb->p_timer, NRF_TIMER_SHORT_COMPARE0_STOP_MASK |
+                                              NRF_TIMER_SHORT_COMPARE0_CLEAR_MASK);
+    nrfy_timer_int_disable(p_deb->p_timer, NRF_TIMER_INT_COMPARE0_MASK);
+    nrfy_timer_int_uninit(p_deb->p_timer);
+    p_deb->p_timer = NULL;
+}
+#endif // NRFX_CHECK(NRFX_GPIOTE_CONFIG_DEBOUNCE_ENABLED)
+
 /* Function releases the handler associated with the pin and sets GPIOTE channel
  * configuration to default if it was used with the pin.
  */
@@ -354,6 +474,9 @@ static void pin_handler_trigger_uninit(nrfx_gpiote_pin_t pin)
 {
     if (pin_in_use_by_te(pin))
     {
+#if NRFX_CHECK(NRFX_GPIOTE_CONFIG_DEBOUNCE_ENABLED)
+        debounce_release(pin_te_get(pin));
+#endif
         /* te to default */
         nrfy_gpiote_te_default(NRF_GPIOTE, pin_te_get(pin));
     }
@@ -413,9 +536,9 @@ static nrfx_err_t pin_handler_set(nrfx_gpiote_pin_t               pin,
     /* Handler not found, new must be allocated. */
     if (handler_id < 0)
     {
-        uint8_t id;
+        uint16_t id;
 
-        err = nrfx_flag32_alloc(&m_cb.available_evt_handlers, &id);
+        err = nrfx_flag32_array_alloc(m_cb.available_evt_handlers, GPIOTE_HANDLER_WORDS, &id);
         if (err != NRFX_SUCCESS)
         {
             return err;
@@ -425,6 +548,7 @@ static nrfx_err_t pin_handler_set(nrfx_gpiote_pin_t               pin,
 
     m_cb.handlers[handler_id].handler = handler;
     m_cb.handlers[handler_id].p_context = p_context;
+    m_cb.handler_pin_count[handler_id]++;
     m_cb.pin_flags[get_pin_idx(pin)] |= PIN_FLAG_HANDLER(handler_id);
 
     return NRFX_SUCCESS;
@@ -490,6 +614,17 @@ nrfx_err_t nrfx_gpiote_input_configure(nrfx_gpiote_pin_t                    pin,
         }
         else
         {
+#if NRFX_CHECK(NRFX_GPIOTE_CONFIG_DEBOUNCE_ENABLED)
+            if (pin_in_use_by_te(pin))
+            {
+                debounce_release(pin_te_get(pin));
+            }
+            if (p_trigger_config->p_debounce && !use_evt)
+            {
+                /* Debouncing is done on the IN event. */
+                return NRFX_ERROR_INVALID_PARAM;
+            }
+#endif
             m_cb.pin_flags[idx] &= ~(PIN_TE_ID_MASK | PIN_FLAG_TE_USED);
             if (use_evt)
             {
@@ -514,6 +649,17 @@ nrfx_err_t nrfx_gpiote_input_configure(nrfx_gpiote_pin_t                    pin,
 
                     nrfy_gpiote_event_disable(NRF_GPIOTE, ch);
                     nrfy_gpiote_event_configure(NRF_GPIOTE, ch, pin, polarity);
+#if NRFX_CHECK(NRFX_GPIOTE_CONFIG_DEBOUNCE_ENABLED)
+                    if (p_trigger_config->p_debounce)
+                    {
+                        err = debounce_setup(ch, p_trigger_config->p_debounce);
+                        if (err != NRFX_SUCCESS)
+                        {
+                            nrfy_gpiote_te_default(NRF_GPIOTE, ch);
+                            return err;
+                        }
+                    }
+#endif
 
                     m_cb.pin_flags[idx] |= PIN_FLAG_TE_ID(ch);
                 }
@@ -603,6 +749,81 @@ void nrfx_gpiote_global_callback_set(nrfx_gpiote_interrupt_handler_t handler, vo
     m_cb.global_handler.p_context = p_context;
 }
 
+#if NRFX_CHECK(NRFX_GPIOTE_CONFIG_PORT_CALLBACK_ENABLED)
+void nrfx_gpiote_port_callback_set(nrfx_gpiote_port_handler_t handler, void * p_context)
+{
+    m_cb.port_handler = NULL;
+    m_cb.port_handler_context = p_context;
+    m_cb.port_handler = handler;
+}
+#endif
+
+#if NRFX_GPIOTE_CONFIG_NUM_OF_GROUP_HANDLERS > 0
+/* Returns index of the port as used by the PORT event handler or -1 if port is not present. */
+static int32_t group_port_idx_get(uint32_t port)
+{
+#if defined(NRF_GPIO_LATCH_PRESENT)
+    for (uint32_t i = 0; i < GPIO_COUNT; i++)
+    {
+        if (ports[i] == port)
+        {
+            return (int32_t)i;
+        }
+    }
+    return -1;
+#else
+    return (port < GPIO_COUNT) ? (int32_t)port : -1;
+#endif
+}
+
+nrfx_err_t nrfx_gpiote_group_add(uint32_t                    port,
+                                 uint32_t                    pin_mask,
+                                 nrfx_gpiote_port_handler_t handler,
+                                 void *                      p_context,
+                                 uint8_t *                   p_group)
+{
+    NRFX_ASSERT(handler);
+    NRFX_ASSERT(p_group);
+
+    int32_t port_idx = group_port_idx_get(port);
+
+    if ((port_idx < 0) || (pin_mask == 0) || (m_cb.group_pins[port_idx] & pin_mask))
+    {
+        return NRFX_ERROR_INVALID_PARAM;
+    }
+
+    for (uint8_t i = 0; i < NRFX_GPIOTE_CONFIG_NUM_OF_GROUP_HANDLERS; i++)
+    {
+        gpiote_group_t * p_grp = &m_cb.groups[i];
+
+        if (p_grp->handler == NULL)
+        {
+            p_grp->p_context = p_context;
+            p_grp->pin_mask  = pin_mask;
+            p_grp->port_idx  = (uint8_t)port_idx;
+            p_grp->handler   = handler;
+
+            m_cb.group_pins[port_idx] |= pin_mask;
+            *p_group = i;
+            return NRFX_SUCCESS;
+        }
+    }
+
+    return NRFX_ERROR_NO_MEM;
+}
+
+void nrfx_gpiote_group_remove(uint8_t group)
+{
+    NRFX_ASSERT(group < NRFX_GPIOTE_CONFIG_NUM_OF_GROUP_HANDLERS);
+
+    gpiote_group_t * p_grp = &m_cb.groups[group];
+
+    NRFX_ASSERT(p_grp->handler);
+    m_cb.group_pins[p_grp->port_idx] &= ~p_grp->pin_mask;
+    p_grp->handler = NULL;
+}
+#endif
+
 nrfx_err_t nrfx_gpiote_channel_get(nrfx_gpiote_pin_t pin, uint8_t *p_channel)
 {
     NRFX_ASSERT(p_channel);
@@ -645,11 +866,21 @@ nrfx_err_t nrfx_gpiote_init(uint8_t interrupt_priority)
     }
 
     memset(m_cb.pin_flags, 0, sizeof(m_cb.pin_flags));
+    memset(m_cb.handler_pin_count, 0, sizeof(m_cb.handler_pin_count));
+#if NRFX_GPIOTE_CONFIG_NUM_OF_GROUP_HANDLERS > 0
+    memset(m_cb.groups, 0, sizeof(m_cb.groups));
+    memset(m_cb.group_pins, 0, sizeof(m_cb.group_pins));
+#endif
+#if NRFX_CHECK(NRFX_GPIOTE_CONFIG_DEBOUNCE_ENABLED)
+    memset(m_cb.debounce, 0, sizeof(m_cb.debounce));
+#endif
 
     nrfy_gpiote_int_init(NRF_GPIOTE, (uint32_t)NRF_GPIOTE_INT_PORT_MASK, interrupt_priority, true);
 
     m_cb.state = NRFX_DRV_STATE_INITIALIZED;
-    m_cb.available_evt_handlers = NRFX_BIT_MASK(NRFX_GPIOTE_CONFIG_NUM_OF_EVT_HANDLERS);
+    nrfx_flag32_array_init(m_cb.available_evt_handlers,
+                           GPIOTE_HANDLER_WORDS,
+                           m_available_evt_handlers);
 
     err_code = NRFX_SUCCESS;
     NRFX_LOG_INFO("Function: %s, error code: %s.", __func__, NRFX_LOG_ERROR_STRING_GET(err_code));
@@ -704,12 +935,21 @@ void nrfx_gpiote_uninit(void)
 
 nrfx_err_t nrfx_gpiote_channel_free(uint8_t channel)
 {
-    return nrfx_flag32_free(&m_cb.available_channels_mask, channel);
+    return nrfx_flag32_array_free(m_cb.available_channels_mask, channel);
 }
 
 nrfx_err_t nrfx_gpiote_channel_alloc(uint8_t * p_channel)
 {
-    return nrfx_flag32_alloc(&m_cb.available_channels_mask, p_channel);
+    uint16_t   channel;
+    nrfx_err_t err = nrfx_flag32_array_alloc(m_cb.available_channels_mask,
+                                             GPIOTE_CHANNEL_WORDS,
+                                             &channel);
+
+    if (err == NRFX_SUCCESS)
+    {
+        *p_channel = (uint8_t)channel;
+    }
+    return err;
 }
 
 void nrfx_gpiote_out_set(nrfx_gpiote_pin_t pin)
@@ -867,6 +1107,21 @@ void nrfx_gpiote_trigger_enable(nrfx_gpiote_pin_t pin, bool int_enable)
         uint8_t ch = pin_te_get(pin);
 
         nrfy_gpiote_event_clear(NRF_GPIOTE, nrf_gpiote_in_event_get(ch));
+#if NRFX_CHECK(NRFX_GPIOTE_CONFIG_DEBOUNCE_ENABLED)
+        if (debounce_used(ch))
+        {
+            /* The pin is reported from the TIMER interrupt instead. */
+            NRF_TIMER_Type * p_timer = m_cb.debounce[ch].p_timer;
+
+            nrfy_timer_event_clear(p_timer, NRF_TIMER_EVENT_COMPARE0);
+            if (int_enable)
+            {
+                nrfy_timer_int_enable(p_timer, NRF_TIMER_INT_COMPARE0_MASK);
+            }
+            nrfy_gpiote_event_enable(NRF_GPIOTE, ch);
+            return;
+        }
+#endif
         nrfy_gpiote_event_enable(NRF_GPIOTE, ch);
         if (int_enable)
         {
@@ -888,6 +1143,17 @@ void nrfx_gpiote_trigger_disable(nrfx_gpiote_pin_t pin)
 
         nrfy_gpiote_int_disable(NRF_GPIOTE, NRFX_BIT(ch));
         nrfy_gpiote_event_disable(NRF_GPIOTE, ch);
+#if NRFX_CHECK(NRFX_GPIOTE_CONFIG_DEBOUNCE_ENABLED)
+        if (debounce_used(ch))
+        {
+            /* Drop the window in progress. */
+            NRF_TIMER_Type * p_timer = m_cb.debounce[ch].p_timer;
+
+            nrfy_timer_int_disable(p_timer, NRF_TIMER_INT_COMPARE0_MASK);
+            nrfy_timer_task_trigger(p_timer, NRF_TIMER_TASK_STOP);
+            nrfy_timer_task_trigger(p_timer, NRF_TIMER_TASK_CLEAR);
+        }
+#endif
     }
     else
     {
@@ -937,42 +1203,147 @@ static void call_handler(nrfx_gpiote_pin_t pin, nrfx_gpiote_trigger_t trigger)
     }
 }
 
-static void next_sense_cond_call_handler(nrfx_gpiote_pin_t     pin,
+/* Function calls handlers for the pin reported by the PORT event. */
+static void port_pin_call_handler(nrfx_gpiote_pin_t pin, nrfx_gpiote_trigger_t trigger)
+{
+#if NRFX_CHECK(NRFX_GPIOTE_CONFIG_PORT_CALLBACK_ENABLED)
+    /* The port callback takes over the role of the global handler. */
+    if (m_cb.port_handler)
+    {
+        nrfx_gpiote_handler_config_t const * handler = channel_handler_get(pin);
+
+        if (handler)
+        {
+            handler->handler(pin, trigger, handler->p_context);
+        }
+        return;
+    }
+#endif
+    call_handler(pin, trigger);
+}
+
+/* Function prepares sensing for the next event on the pin and returns true
+ * if the current event is to be reported to the user. */
+static bool next_sense_set(nrfx_gpiote_pin_t     pin,
+                           nrfx_gpiote_trigger_t trigger,
+                           nrf_gpio_pin_sense_t  sense)
+{
+    if (is_level(trigger))
+    {
+        /* Sensing is reenabled after the user is notified, see level_sense_rearm(). */
+        return true;
+    }
+
+    /* Reconfigure sense to the opposite level, so the internal PINx.DETECT signal
+     * can be deasserted. Therefore PORT event can be generated again,
+     * unless some other PINx.DETECT signal is still active. */
+    nrf_gpio_pin_sense_t next_sense = (sense == NRF_GPIO_PIN_SENSE_HIGH) ?
+            NRF_GPIO_PIN_SENSE_LOW : NRF_GPIO_PIN_SENSE_HIGH;
+
+    nrfy_gpio_cfg_sense_set(pin, next_sense);
+
+    /* Invoke user handler only if the sensed pin level matches its polarity
+     * configuration. Call handler unconditionally in case of toggle trigger or
+     * level trigger. */
+    return (trigger == NRFX_GPIOTE_TRIGGER_TOGGLE) ||
+           (sense == NRF_GPIO_PIN_SENSE_HIGH && trigger == NRFX_GPIOTE_TRIGGER_LOTOHI) ||
+           (sense == NRF_GPIO_PIN_SENSE_LOW && trigger == NRFX_GPIOTE_TRIGGER_HITOLO);
+}
+
+static void level_sense_rearm(nrfx_gpiote_pin_t pin, nrf_gpio_pin_sense_t sense)
+{
+    if (nrfy_gpio_pin_sense_get(pin) == sense)
+    {
+        /* The sensing mechanism needs to be reenabled here so that the PORT event
+         * is generated again for the pin if it stays at the sensed level. */
+        nrfy_gpio_cfg_sense_set(pin, NRF_GPIO_PIN_NOSENSE);
+        nrfy_gpio_cfg_sense_set(pin, sense);
+    }
+}
+
+/* Function returns true if the user was notified about the event. */
+static bool next_sense_cond_call_handler(nrfx_gpiote_pin_t     pin,
                                          nrfx_gpiote_trigger_t trigger,
                                          nrf_gpio_pin_sense_t  sense)
 {
+    bool notify = next_sense_set(pin, trigger, sense);
+
+    if (notify)
+    {
+        port_pin_call_handler(pin, trigger);
+    }
     if (is_level(trigger))
     {
-        call_handler(pin, trigger);
-        if (nrfy_gpio_pin_sense_get(pin) == sense)
+        level_sense_rearm(pin, sense);
+    }
+    return notify;
+}
+
+#if NRFX_GPIOTE_CONFIG_NUM_OF_GROUP_HANDLERS > 0
+/* Function handles PORT event of the pin which belongs to a group. The pin is
+ * marked in @p p_fired if the group handler is to be notified. */
+static void group_pin_handle(nrfx_gpiote_pin_t     pin,
+                             nrfx_gpiote_trigger_t trigger,
+                             nrf_gpio_pin_sense_t  sense,
+                             uint32_t *            p_fired)
+{
+    if (next_sense_set(pin, trigger, sense))
+    {
+        *p_fired |= NRFX_BIT(pin & 0x1F);
+    }
+}
+
+/* Function calls handlers of all groups of the port with at least one pin fired
+ * and then reenables sensing of level triggered pins. */
+static void group_dispatch(uint32_t port_idx, uint32_t port, uint32_t fired)
+{
+    if (fired == 0)
+    {
+        return;
+    }
+
+    for (uint8_t i = 0; i < NRFX_GPIOTE_CONFIG_NUM_OF_GROUP_HANDLERS; i++)
+    {
+        gpiote_group_t const * p_grp = &m_cb.groups[i];
+        uint32_t               mask  = p_grp->pin_mask & fired;
+
+        if (p_grp->handler && (p_grp->port_idx == port_idx) && mask)
         {
-            /* The sensing mechanism needs to be reenabled here so that the PORT event
-             * is generated again for the pin if it stays at the sensed level. */
-            nrfy_gpio_cfg_sense_set(pin, NRF_GPIO_PIN_NOSENSE);
-            nrfy_gpio_cfg_sense_set(pin, sense);
+            p_grp->handler(port, mask, p_grp->p_context);
         }
     }
-    else
+
+    while (fired)
     {
-        /* Reconfigure sense to the opposite level, so the internal PINx.DETECT signal
-         * can be deasserted. Therefore PORT event can be generated again,
-         * unless some other PINx.DETECT signal is still active. */
-        nrf_gpio_pin_sense_t next_sense = (sense == NRF_GPIO_PIN_SENSE_HIGH) ?
-                NRF_GPIO_PIN_SENSE_LOW : NRF_GPIO_PIN_SENSE_HIGH;
-
-        nrfy_gpio_cfg_sense_set(pin, next_sense);
-
-        /* Invoke user handler only if the sensed pin level matches its polarity
-         * configuration. Call handler unconditionally in case of toggle trigger or
-         * level trigger. */
-        if ((trigger == NRFX_GPIOTE_TRIGGER_TOGGLE) ||
-            (sense == NRF_GPIO_PIN_SENSE_HIGH && trigger == NRFX_GPIOTE_TRIGGER_LOTOHI) ||
-            (sense == NRF_GPIO_PIN_SENSE_LOW && trigger == NRFX_GPIOTE_TRIGGER_HITOLO))
+        uint32_t pin = NRF_PIN_PORT_TO_PIN_NUMBER(NRF_CTZ(fired), port);
+        nrfx_gpiote_trigger_t trigger = PIN_FLAG_TRIG_MODE_GET(m_cb.pin_flags[get_pin_idx(pin)]);
+
+        fired &= fired - 1;
+        if (is_level(trigger))
         {
-            call_handler(pin, trigger);
+            level_sense_rearm(pin, (trigger == NRFX_GPIOTE_TRIGGER_HIGH) ?
+                                   NRF_GPIO_PIN_SENSE_HIGH : NRF_GPIO_PIN_SENSE_LOW);
         }
     }
 }
+#endif
+
+/* Function notifies the users about all pins of the port reported in one pass. */
+static void port_pass_dispatch(uint32_t port_idx, uint32_t port, uint32_t fired)
+{
+    (void)port_idx;
+    (void)port;
+    (void)fired;
+#if NRFX_GPIOTE_CONFIG_NUM_OF_GROUP_HANDLERS > 0
+    group_dispatch(port_idx, port, fired & m_cb.group_pins[port_idx]);
+#endif
+#if NRFX_CHECK(NRFX_GPIOTE_CONFIG_PORT_CALLBACK_ENABLED)
+    if (m_cb.port_handler && fired)
+    {
+        m_cb.port_handler(port, fired, m_cb.port_handler_context);
+    }
+#endif
+}
 
 #if defined(NRF_GPIO_LATCH_PRESENT)
 static bool latch_pending_read_and_check(uint32_t * latch)
@@ -1001,6 +1372,9 @@ static void port_event_handle(void)
     do {
         for (uint32_t i = 0; i < GPIO_COUNT; i++)
         {
+            /* Pins reported during this pass over the port. */
+            uint32_t fired = 0;
+
             while (latch[i])
             {
                 uint32_t pin = NRF_CTZ(latch[i]);
@@ -1014,13 +1388,25 @@ static void port_event_handle(void)
                 nrf_bitmask_bit_clear(pin, &latch[i]);
                 sense = nrfy_gpio_pin_sense_get(abs_pin);
 
-                next_sense_cond_call_handler(abs_pin, trigger, sense);
+#if NRFX_GPIOTE_CONFIG_NUM_OF_GROUP_HANDLERS > 0
+                if (m_cb.group_pins[i] & NRFX_BIT(pin))
+                {
+                    group_pin_handle(abs_pin, trigger, sense, &fired);
+                }
+                else
+#endif
+                if (next_sense_cond_call_handler(abs_pin, trigger, sense))
+                {
+                    fired |= NRFX_BIT(pin);
+                }
                 /* Try to clear LATCH bit corresponding to currently processed pin.
                  * This may not succeed if the pin's state changed during the interrupt processing
                  * and now it matches the new sense configuration. In such case,
                  * the pin will be processed again in another iteration of the outer loop. */
                 nrfy_gpio_pin_latch_clear(abs_pin);
            }
+
+            port_pass_dispatch(i, ports[i], fired);
         }
 
         /* All pins have been handled, clear PORT, check latch again in case
@@ -1077,6 +1463,9 @@ static void port_event_handle(void)
     do {
         for (uint32_t i = 0; i < GPIO_COUNT; i++)
         {
+            /* Pins reported during this pass over the port. */
+            uint32_t fired = 0;
+
             while (pins_to_check[i])
             {
                 nrf_gpio_pin_sense_t sense;
@@ -1095,9 +1484,20 @@ static void port_event_handle(void)
                 if ((pin_state && (sense == NRF_GPIO_PIN_SENSE_HIGH)) ||
                     (!pin_state && (sense == NRF_GPIO_PIN_SENSE_LOW)) )
                 {
-                    next_sense_cond_call_handler(pin, trigger, sense);
+#if NRFX_GPIOTE_CONFIG_NUM_OF_GROUP_HANDLERS > 0
+                    if (m_cb.group_pins[i] & NRFX_BIT(rel_pin))
+                    {
+                        group_pin_handle(pin, trigger, sense, &fired);
+                    }
+                    else
+#endif
+                    if (next_sense_cond_call_handler(pin, trigger, sense))
+                    {
+                        fired |= NRFX_BIT(rel_pin);
+                    }
                 }
             }
+            port_pass_dispatch(i, i, fired);
         }
 
         /* All pins used with PORT must be rechecked because it's content and
@@ -1152,8 +1552,36 @@ static void gpiote_evt_handle(uint32_t mask)
     }
 }
 
+#if NRFX_CHECK(NRFX_GPIOTE_CONFIG_DEBOUNCE_ENABLED)
+void nrfx_gpiote_debounce_irq_handler(NRF_TIMER_Type * p_timer)
+{
+    for (uint8_t ch = 0; ch < GPIOTE_CH_NUM; ch++)
+    {
+        if (m_cb.debounce[ch].p_timer != p_timer)
+        {
+            continue;
+        }
+
+        if (nrfy_timer_events_process(p_timer,
+                                      NRFY_EVENT_TO_INT_BITMASK(NRF_TIMER_EVENT_COMPARE0)))
+        {
+            /* IN events of the window are not reported separately. */
+            nrfy_gpiote_event_clear(NRF_GPIOTE, nrf_gpiote_in_event_get(ch));
+
+            nrfx_gpiote_pin_t pin = nrfy_gpiote_event_pin_get(NRF_GPIOTE, ch);
+            nrf_gpiote_polarity_t polarity = nrfy_gpiote_event_polarity_get(NRF_GPIOTE, ch);
+
+            call_handler(pin, gpiote_polarity_to_trigger(polarity));
+        }
+        return;
+    }
+}
+#endif // NRFX_CHECK(NRFX_GPIOTE_CONFIG_DEBOUNCE_ENABLED)
+
 void nrfx_gpiote_irq_handler(void)
 {
+    NRFX_IRQ_ENTER(NRF_GPIOTE);
+
     /* Collect status of all GPIOTE pin events. Processing is done once all are collected and cleared.*/
     uint32_t enabled_in_events = nrf_gpiote_int_enable_check(NRF_GPIOTE, NRF_GPIOTE_INT_IN_MASK);
     uint32_t evt_mask = nrfy_gpiote_events_process(NRF_GPIOTE,
@@ -1169,6 +1597,8 @@ void nrfx_gpiote_irq_handler(void)
 
     /* Process pin events. */
     gpiote_evt_handle(evt_mask);
+
+    NRFX_IRQ_EXIT(NRF_GPIOTE);
 }
 
 #endif // NRFX_CHECK(NRFX_GPIOTE_ENABLED)
@@ -38,6 +38,15 @@
 #include <nrfx_i2s.h>
 #include <haly/nrfy_gpio.h>
 
+#if NRFX_CHECK(NRFX_I2S_CONFIG_DRIFT_COMP_ENABLED)
+#include <hal/nrf_clock.h>
+#if !NRF_CLOCK_HAS_HFCLKAUDIO
+#error "Drift compensation requires HFCLKAUDIO."
+#endif
+#include <haly/nrfy_timer.h>
+#include <helpers/nrfx_gppi.h>
+#endif
+
 #define NRFX_LOG_MODULE I2S
 #include <nrfx_log.h>
 
@@ -67,6 +76,42 @@
 #define USE_WORKAROUND_FOR_ANOMALY_196 1
 #endif
 
+#if NRFX_CHECK(NRFX_I2S_CONFIG_RING_ENABLED)
+// Ring mode data. All counters are free-running block counts.
+typedef struct
+{
+    uint32_t *            p_tx_blocks; // Memory for the TX blocks.
+    uint32_t *            p_rx_blocks; // Memory for the RX blocks.
+    uint16_t              block_count; // Number of blocks in the ring.
+    bool                  next_fresh;  // A new block has been set as next.
+    volatile uint32_t     tx_wr;       // TX blocks committed by the application.
+    volatile uint32_t     rx_rd;       // RX blocks released by the application.
+    volatile uint32_t     hw;          // Blocks handed to the peripheral.
+    volatile uint32_t     done;        // Blocks completed by the peripheral.
+    nrfx_i2s_ring_stats_t stats;       // Ring statistics.
+} nrfx_i2s_ring_cb_t;
+#endif
+
+#if NRFX_CHECK(NRFX_I2S_CONFIG_DRIFT_COMP_ENABLED)
+// Clock drift compensation data. Timestamps are TIMER capture values.
+typedef struct
+{
+    NRF_TIMER_Type *  p_timer;       // TIMER timestamping the events.
+    uint32_t          ref_period_us; // Nominal reference period in microseconds.
+    uint32_t          ref_ticks;     // Nominal reference period in TIMER ticks.
+    uint32_t          window_ticks;  // Measurement window in TIMER ticks.
+    uint32_t          word_rate;     // Nominal words per second.
+    uint16_t          max_ppm;       // Largest estimate that is applied.
+    uint8_t           ref_channel;   // (D)PPI channel capturing the reference event.
+    uint8_t           buf_channel;   // (D)PPI channel capturing the pointer update.
+    bool              window_open;   // Timestamps of the window start are valid.
+    uint32_t          ref_start;     // Reference timestamp at the window start.
+    uint32_t          buf_start;     // Pointer update timestamp at the window start.
+    uint32_t          buffers;       // Buffers completed since the window start.
+    volatile int32_t  ppm;           // Most recent drift estimate.
+} nrfx_i2s_drift_cb_t;
+#endif
+
 // Control block - driver instance local data.
 typedef struct
 {
@@ -81,10 +126,22 @@ typedef struct
     bool buffers_reused : 1;
     bool skip_gpio_cfg  : 1;
     bool skip_psel_cfg  : 1;
+#if NRFX_CHECK(NRFX_I2S_CONFIG_RING_ENABLED)
+    bool ring_mode      : 1;
+#endif
+#if NRFX_CHECK(NRFX_I2S_CONFIG_DRIFT_COMP_ENABLED)
+    bool drift_comp     : 1;
+#endif
 
     uint16_t            buffer_size;
     nrfx_i2s_buffers_t  next_buffers;
     nrfx_i2s_buffers_t  current_buffers;
+#if NRFX_CHECK(NRFX_I2S_CONFIG_RING_ENABLED)
+    nrfx_i2s_ring_cb_t  ring;
+#endif
+#if NRFX_CHECK(NRFX_I2S_CONFIG_DRIFT_COMP_ENABLED)
+    nrfx_i2s_drift_cb_t drift;
+#endif
 } nrfx_i2s_cb_t;
 
 static nrfx_i2s_cb_t m_cb[NRFX_I2S_ENABLED_COUNT];
@@ -477,6 +534,322 @@ void nrfx_i2s_stop(nrfx_i2s_t const * p_instance)
 #endif
 }
 
+#if NRFX_CHECK(NRFX_I2S_CONFIG_RING_ENABLED)
+nrfx_err_t nrfx_i2s_ring_start(nrfx_i2s_t const *      p_instance,
+                               nrfx_i2s_ring_t const * p_ring,
+                               uint8_t                 flags)
+{
+    NRFX_ASSERT(p_ring != NULL);
+    NRFX_ASSERT(p_ring->block_count >= 2);
+    NRFX_ASSERT((p_ring->p_tx_blocks == NULL) || (p_ring->tx_prefill >= 1));
+    NRFX_ASSERT((p_ring->p_tx_blocks == NULL) || (p_ring->tx_prefill <= p_ring->block_count));
+
+    nrfx_err_t err_code;
+    nrfx_i2s_cb_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+
+    if (p_cb->state != NRFX_DRV_STATE_INITIALIZED)
+    {
+        err_code = NRFX_ERROR_INVALID_STATE;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    // The first block of the ring is handed to the peripheral by the regular
+    // start procedure, so account for it before the interrupt can fire.
+    p_cb->ring.p_tx_blocks = p_ring->p_tx_blocks;
+    p_cb->ring.p_rx_blocks = p_ring->p_rx_blocks;
+    p_cb->ring.block_count = p_ring->block_count;
+    p_cb->ring.next_fresh  = true;
+    p_cb->ring.tx_wr       = (p_ring->p_tx_blocks != NULL) ? p_ring->tx_prefill : 0;
+    p_cb->ring.rx_rd       = 0;
+    p_cb->ring.hw          = 1;
+    p_cb->ring.done        = 0;
+    p_cb->ring.stats       = (nrfx_i2s_ring_stats_t){ 0 };
+    p_cb->ring_mode        = true;
+
+    nrfx_i2s_buffers_t initial_buffers = {
+        .p_rx_buffer = p_ring->p_rx_blocks,
+        .p_tx_buffer = p_ring->p_tx_blocks,
+    };
+
+    err_code = nrfx_i2s_start(p_instance, &initial_buffers, p_ring->block_size, flags);
+    if (err_code != NRFX_SUCCESS)
+    {
+        p_cb->ring_mode = false;
+    }
+    return err_code;
+}
+
+uint32_t * nrfx_i2s_ring_tx_block_get(nrfx_i2s_t const * p_instance)
+{
+    nrfx_i2s_cb_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    nrfx_i2s_ring_cb_t * p_ring = &p_cb->ring;
+
+    NRFX_ASSERT(p_cb->ring_mode && p_cb->use_tx);
+
+    if ((p_ring->tx_wr - p_ring->done) >= p_ring->block_count)
+    {
+        return NULL;
+    }
+    return &p_ring->p_tx_blocks[(p_ring->tx_wr % p_ring->block_count) * p_cb->buffer_size];
+}
+
+void nrfx_i2s_ring_tx_block_commit(nrfx_i2s_t const * p_instance)
+{
+    nrfx_i2s_cb_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+
+    NRFX_ASSERT(p_cb->ring_mode && p_cb->use_tx);
+    NRFX_ASSERT((p_cb->ring.tx_wr - p_cb->ring.done) < p_cb->ring.block_count);
+
+    p_cb->ring.tx_wr++;
+}
+
+uint32_t * nrfx_i2s_ring_rx_block_get(nrfx_i2s_t const * p_instance)
+{
+    nrfx_i2s_cb_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    nrfx_i2s_ring_cb_t * p_ring = &p_cb->ring;
+
+    NRFX_ASSERT(p_cb->ring_mode && p_cb->use_rx);
+
+    if (p_ring->done == p_ring->rx_rd)
+    {
+        return NULL;
+    }
+    return &p_ring->p_rx_blocks[(p_ring->rx_rd % p_ring->block_count) * p_cb->buffer_size];
+}
+
+void nrfx_i2s_ring_rx_block_release(nrfx_i2s_t const * p_instance)
+{
+    nrfx_i2s_cb_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+
+    NRFX_ASSERT(p_cb->ring_mode && p_cb->use_rx);
+    NRFX_ASSERT(p_cb->ring.done != p_cb->ring.rx_rd);
+
+    p_cb->ring.rx_rd++;
+}
+
+void nrfx_i2s_ring_stats_get(nrfx_i2s_t const *      p_instance,
+                             nrfx_i2s_ring_stats_t * p_stats)
+{
+    NRFX_ASSERT(p_stats);
+
+    nrfx_i2s_cb_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    *p_stats = p_cb->ring.stats;
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+static void ring_advance(NRF_I2S_Type * p_reg, nrfx_i2s_cb_t * p_cb)
+{
+    nrfx_i2s_ring_cb_t * p_ring = &p_cb->ring;
+    nrfx_i2s_buffers_t released_buffers = p_cb->current_buffers;
+    bool released = p_ring->next_fresh;
+
+    // If no new block was set as next, the peripheral has just latched
+    // the current block again and nothing can be released.
+    if (released)
+    {
+        if ((p_cb->current_buffers.p_rx_buffer != NULL) ||
+            (p_cb->current_buffers.p_tx_buffer != NULL))
+        {
+            p_ring->done++;
+        }
+        p_cb->current_buffers = p_cb->next_buffers;
+    }
+
+    bool tx_available = !p_cb->use_tx || (p_ring->tx_wr != p_ring->hw);
+    bool rx_available = !p_cb->use_rx ||
+                        ((p_ring->hw - p_ring->rx_rd) < p_ring->block_count);
+
+    if (tx_available && rx_available)
+    {
+        uint32_t offset = (p_ring->hw % p_ring->block_count) * p_cb->buffer_size;
+
+        p_cb->next_buffers.p_tx_buffer = p_cb->use_tx ? &p_ring->p_tx_blocks[offset] : NULL;
+        p_cb->next_buffers.p_rx_buffer = p_cb->use_rx ? &p_ring->p_rx_blocks[offset] : NULL;
+
+        nrfy_i2s_xfer_desc_t xfer = {
+            .p_buffers   = &p_cb->next_buffers,
+            .buffer_size = p_cb->buffer_size,
+        };
+        nrfy_i2s_buffers_set(p_reg, &xfer);
+
+        p_ring->hw++;
+        p_ring->next_fresh = true;
+    }
+    else
+    {
+        p_ring->stats.underruns += tx_available ? 0 : 1;
+        p_ring->stats.overruns  += rx_available ? 0 : 1;
+        p_ring->next_fresh = false;
+    }
+
+    p_cb->handler(released ? &released_buffers : NULL, NRFX_I2S_STATUS_RING_UPDATED);
+}
+#endif
+
+#if NRFX_CHECK(NRFX_I2S_CONFIG_DRIFT_COMP_ENABLED)
+nrfx_err_t nrfx_i2s_drift_comp_start(nrfx_i2s_t const *                   p_instance,
+                                     nrfx_i2s_drift_comp_config_t const * p_config)
+{
+    NRFX_ASSERT(p_config != NULL);
+    NRFX_ASSERT(p_config->p_timer != NULL);
+    NRFX_ASSERT(p_config->ref_period_us != 0);
+    NRFX_ASSERT(p_config->word_rate != 0);
+    NRFX_ASSERT(p_config->window != 0);
+
+    nrfx_err_t err_code;
+    nrfx_i2s_cb_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    nrfx_i2s_drift_cb_t * p_drift = &p_cb->drift;
+
+    if ((p_cb->state != NRFX_DRV_STATE_POWERED_ON) || p_cb->drift_comp)
+    {
+        err_code = NRFX_ERROR_INVALID_STATE;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    if (nrfx_gppi_channel_alloc(&p_drift->ref_channel) != NRFX_SUCCESS)
+    {
+        err_code = NRFX_ERROR_NO_MEM;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+    if (nrfx_gppi_channel_alloc(&p_drift->buf_channel) != NRFX_SUCCESS)
+    {
+        (void)nrfx_gppi_channel_free(p_drift->ref_channel);
+        err_code = NRFX_ERROR_NO_MEM;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    p_drift->p_timer       = p_config->p_timer;
+    p_drift->ref_period_us = p_config->ref_period_us;
+    p_drift->ref_ticks     = p_config->ref_period_us *
+                             (NRF_TIMER_BASE_FREQUENCY_GET(p_config->p_timer) / 1000000);
+    p_drift->window_ticks  = p_drift->ref_ticks * p_config->window;
+    p_drift->word_rate     = p_config->word_rate;
+    p_drift->max_ppm       = p_config->max_ppm;
+    p_drift->window_open   = false;
+    p_drift->ppm           = 0;
+
+    nrfy_timer_config_t timer_config = {
+        .prescaler = 0,
+        .mode      = NRF_TIMER_MODE_TIMER,
+        .bit_width = NRF_TIMER_BIT_WIDTH_32
+    };
+    nrfy_timer_task_trigger(p_config->p_timer, NRF_TIMER_TASK_STOP);
+    nrfy_timer_periph_configure(p_config->p_timer, &timer_config);
+    nrfy_timer_task_trigger(p_config->p_timer, NRF_TIMER_TASK_CLEAR);
+    nrfy_timer_cc_set(p_config->p_timer, NRF_TIMER_CC_CHANNEL0, 0);
+    nrfy_timer_task_trigger(p_config->p_timer, NRF_TIMER_TASK_START);
+
+    // In the full-duplex mode both pointers are updated together, so TX is enough.
+    nrf_i2s_event_t buf_event = p_cb->use_tx ? NRF_I2S_EVENT_TXPTRUPD : NRF_I2S_EVENT_RXPTRUPD;
+
+    nrfx_gppi_channel_endpoints_setup(p_drift->ref_channel,
+        p_config->ref_event_address,
+        nrfy_timer_task_address_get(p_config->p_timer, NRF_TIMER_TASK_CAPTURE0));
+    nrfx_gppi_channel_endpoints_setup(p_drift->buf_channel,
+        nrfy_i2s_event_address_get(p_instance->p_reg, buf_event),
+        nrfy_timer_task_address_get(p_config->p_timer, NRF_TIMER_TASK_CAPTURE1));
+    nrfx_gppi_channels_enable(NRFX_BIT(p_drift->ref_channel) | NRFX_BIT(p_drift->buf_channel));
+
+    p_cb->drift_comp = true;
+    return NRFX_SUCCESS;
+}
+
+void nrfx_i2s_drift_comp_stop(nrfx_i2s_t const * p_instance)
+{
+    nrfx_i2s_cb_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    nrfx_i2s_drift_cb_t * p_drift = &p_cb->drift;
+
+    if (!p_cb->drift_comp)
+    {
+        return;
+    }
+
+    p_cb->drift_comp = false;
+    nrfx_gppi_channels_disable(NRFX_BIT(p_drift->ref_channel) | NRFX_BIT(p_drift->buf_channel));
+    (void)nrfx_gppi_channel_free(p_drift->ref_channel);
+    (void)nrfx_gppi_channel_free(p_drift->buf_channel);
+    nrfy_timer_task_trigger(p_drift->p_timer, NRF_TIMER_TASK_STOP);
+}
+
+int32_t nrfx_i2s_drift_comp_ppm_get(nrfx_i2s_t const * p_instance)
+{
+    return m_cb[p_instance->drv_inst_idx].drift.ppm;
+}
+
+static void drift_comp_update(nrfx_i2s_cb_t * p_cb)
+{
+    nrfx_i2s_drift_cb_t * p_drift = &p_cb->drift;
+
+    // CC1 holds the pointer update that has just been handled and CC0 the most
+    // recent reference event, both captured by hardware.
+    uint32_t ref_time = nrfy_timer_cc_get(p_drift->p_timer, NRF_TIMER_CC_CHANNEL0);
+    uint32_t buf_time = nrfy_timer_cc_get(p_drift->p_timer, NRF_TIMER_CC_CHANNEL1);
+
+    if (!p_drift->window_open)
+    {
+        // CC0 is zeroed on start, so wait for the first reference event.
+        if (ref_time != 0)
+        {
+            p_drift->ref_start   = ref_time;
+            p_drift->buf_start   = buf_time;
+            p_drift->buffers     = 0;
+            p_drift->window_open = true;
+        }
+        return;
+    }
+
+    p_drift->buffers++;
+    uint32_t ref_ticks = ref_time - p_drift->ref_start;
+    if (ref_ticks < p_drift->window_ticks)
+    {
+        return;
+    }
+
+    uint32_t buf_ticks = buf_time - p_drift->buf_start;
+    uint32_t ref_count = (ref_ticks + p_drift->ref_ticks / 2) / p_drift->ref_ticks;
+    uint64_t ref_us    = (uint64_t)ref_count * p_drift->ref_period_us;
+    uint64_t words     = (uint64_t)p_drift->buffers * p_cb->buffer_size;
+
+    p_drift->ref_start = ref_time;
+    p_drift->buf_start = buf_time;
+    p_drift->buffers   = 0;
+
+    // Ticks the counted words would take if the audio clock followed the reference.
+    // The reference time is converted to ticks first, scaled to keep the precision.
+    uint64_t expected = ((words * ref_ticks * 64) / ref_us) * 1000000 / p_drift->word_rate / 64;
+    int32_t  ppm      = (int32_t)(((int64_t)expected - (int64_t)buf_ticks) * 1000000 /
+                                  (int64_t)buf_ticks);
+
+    p_drift->ppm = ppm;
+    if ((ppm > p_drift->max_ppm) || (ppm < -(int32_t)p_drift->max_ppm))
+    {
+        NRFX_LOG_WARNING("Drift estimate of %d ppm ignored.", (int)ppm);
+        return;
+    }
+
+    // The audio clock is proportional to 4 + FREQ_VALUE * 2^(-16).
+    int64_t scale = (4L << 16) + nrf_clock_hfclkaudio_config_get(NRF_CLOCK);
+    scale -= (scale * ppm) / 1000000;
+    scale = NRFX_MAX(scale, (4L << 16));
+    scale = NRFX_MIN(scale, (5L << 16) - 1);
+    nrf_clock_hfclkaudio_config_set(NRF_CLOCK, (uint16_t)(scale - (4L << 16)));
+}
+#endif
+
 static void irq_handler(NRF_I2S_Type * p_reg, nrfx_i2s_cb_t * p_cb)
 {
     uint32_t event_mask;
@@ -519,6 +892,12 @@ static void irq_handler(NRF_I2S_Type * p_reg, nrfx_i2s_cb_t * p_cb)
 
         p_cb->handler(&p_cb->current_buffers, 0);
 
+#if NRFX_CHECK(NRFX_I2S_CONFIG_RING_ENABLED)
+        p_cb->ring_mode = false;
+#endif
+#if NRFX_CHECK(NRFX_I2S_CONFIG_DRIFT_COMP_ENABLED)
+        p_cb->drift.window_open = false;
+#endif
         // Change the state of the driver before calling the handler with
         // the flag signaling that the transfer has finished, so that it is
         // possible to start a new transfer directly from the handler function.
@@ -541,6 +920,20 @@ static void irq_handler(NRF_I2S_Type * p_reg, nrfx_i2s_cb_t * p_cb)
             p_cb->tx_ready = false;
             p_cb->rx_ready = false;
 
+#if NRFX_CHECK(NRFX_I2S_CONFIG_DRIFT_COMP_ENABLED)
+            if (p_cb->drift_comp)
+            {
+                drift_comp_update(p_cb);
+            }
+#endif
+
+#if NRFX_CHECK(NRFX_I2S_CONFIG_RING_ENABLED)
+            if (p_cb->ring_mode)
+            {
+                ring_advance(p_reg, p_cb);
+                return;
+            }
+#endif
             // If the application did not supply the buffers for the next
             // part of the transfer until this moment, the current buffers
             // cannot be released, since the I2S peripheral already started
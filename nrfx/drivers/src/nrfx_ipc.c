@@ -145,6 +145,8 @@ void nrfx_ipc_send_task_channel_assign(uint8_t send_index, uint8_t channel_index
 
 void nrfx_ipc_irq_handler(void)
 {
+    NRFX_IRQ_ENTER(NRF_IPC);
+
     // Get the information about events that fire this interrupt
     uint32_t events_map = nrf_ipc_int_pending_get(NRF_IPC);
     // Clear these events
@@ -160,6 +162,8 @@ void nrfx_ipc_irq_handler(void)
             m_cb.handler(event_idx, m_cb.p_context);
         }
     }
+
+    NRFX_IRQ_EXIT(NRF_IPC);
 }
 
 #endif // NRFX_CHECK(NRFX_IPC_ENABLED)
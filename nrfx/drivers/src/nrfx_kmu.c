@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_KMU_ENABLED)
+
+#include <nrfx_kmu.h>
+#include <hal/nrf_nvmc.h>
+
+#define NRFX_LOG_MODULE KMU
+#include <nrfx_log.h>
+
+// Value of an erased UICR word.
+#define UICR_ERASED_VALUE 0xFFFFFFFFUL
+
+// Bits of the key slot permissions that are set by the user.
+#define KMU_PERM_MASK (NRFX_KMU_PERM_WRITE | NRFX_KMU_PERM_READ | NRFX_KMU_PERM_PUSH)
+
+// Key slot IDs used by the KMU start from 1, ID 0 means that no key slot is selected.
+#define KMU_SLOT_ID(slot) ((uint8_t)((slot) + 1))
+#define KMU_SLOT_ID_NONE  0
+
+static void uicr_word_write(volatile uint32_t * p_word, uint32_t value)
+{
+    *p_word = value;
+    while (!nrf_nvmc_ready_check(NRF_NVMC))
+    {}
+}
+
+bool nrfx_kmu_slot_free_check(uint8_t slot)
+{
+    NRFX_ASSERT(slot < NRFX_KMU_SLOT_COUNT);
+
+    return (NRF_UICR->KEYSLOT.CONFIG[slot].PERM == UICR_ERASED_VALUE) &&
+           (NRF_UICR->KEYSLOT.CONFIG[slot].DEST == UICR_ERASED_VALUE);
+}
+
+nrfx_err_t nrfx_kmu_key_provision(uint8_t          slot,
+                                  uint32_t const * p_key,
+                                  uint32_t         dest,
+                                  uint32_t         perm)
+{
+    NRFX_ASSERT(p_key);
+    NRFX_ASSERT(nrfx_is_word_aligned(p_key));
+    NRFX_ASSERT((perm & ~KMU_PERM_MASK) == 0);
+
+    nrfx_err_t err_code;
+
+    if ((slot >= NRFX_KMU_SLOT_COUNT) ||
+        ((perm & NRFX_KMU_PERM_PUSH) && (dest == UICR_ERASED_VALUE)))
+    {
+        err_code = NRFX_ERROR_INVALID_PARAM;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    if (!nrfx_kmu_slot_free_check(slot))
+    {
+        err_code = NRFX_ERROR_INVALID_STATE;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    nrf_nvmc_mode_set(NRF_NVMC, NRF_NVMC_MODE_WRITE);
+
+    // The key value and the destination must be in place before the permissions
+    // make the key slot usable.
+    for (uint8_t i = 0; i < NRFX_ARRAY_SIZE(NRF_UICR->KEYSLOT.KEY[slot].VALUE); i++)
+    {
+        uicr_word_write(&NRF_UICR->KEYSLOT.KEY[slot].VALUE[i], p_key[i]);
+    }
+    uicr_word_write(&NRF_UICR->KEYSLOT.CONFIG[slot].DEST, dest);
+    uicr_word_write(&NRF_UICR->KEYSLOT.CONFIG[slot].PERM, ~KMU_PERM_MASK | perm);
+
+    nrf_nvmc_mode_set(NRF_NVMC, NRF_NVMC_MODE_READONLY);
+
+    err_code = NRFX_SUCCESS;
+    NRFX_LOG_INFO("Function: %s, error code: %s.",
+                  __func__,
+                  NRFX_LOG_ERROR_STRING_GET(err_code));
+    return err_code;
+}
+
+nrfx_err_t nrfx_kmu_key_push(uint8_t slot)
+{
+    if (slot >= NRFX_KMU_SLOT_COUNT)
+    {
+        return NRFX_ERROR_INVALID_PARAM;
+    }
+
+    nrf_kmu_event_clear(NRF_KMU, NRF_KMU_EVENT_KEYSLOT_PUSHED);
+    nrf_kmu_event_clear(NRF_KMU, NRF_KMU_EVENT_KEYSLOT_REVOKED);
+    nrf_kmu_event_clear(NRF_KMU, NRF_KMU_EVENT_KEYSLOT_ERROR);
+
+    nrf_kmu_keyslot_set(NRF_KMU, KMU_SLOT_ID(slot));
+    nrf_kmu_task_trigger(NRF_KMU, NRF_KMU_TASK_PUSH_KEYSLOT);
+
+    nrfx_err_t err_code;
+
+    while (true)
+    {
+        if (nrf_kmu_event_check(NRF_KMU, NRF_KMU_EVENT_KEYSLOT_PUSHED))
+        {
+            err_code = NRFX_SUCCESS;
+            break;
+        }
+        if (nrf_kmu_event_check(NRF_KMU, NRF_KMU_EVENT_KEYSLOT_REVOKED))
+        {
+            err_code = NRFX_ERROR_FORBIDDEN;
+            break;
+        }
+        if (nrf_kmu_event_check(NRF_KMU, NRF_KMU_EVENT_KEYSLOT_ERROR))
+        {
+            err_code = NRFX_ERROR_INTERNAL;
+            break;
+        }
+    }
+
+    nrf_kmu_keyslot_set(NRF_KMU, KMU_SLOT_ID_NONE);
+
+    if (err_code != NRFX_SUCCESS)
+    {
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+    }
+    return err_code;
+}
+
+nrfx_err_t nrfx_kmu_key_revoke(uint8_t slot)
+{
+    if (slot >= NRFX_KMU_SLOT_COUNT)
+    {
+        return NRFX_ERROR_INVALID_PARAM;
+    }
+
+    nrf_nvmc_mode_set(NRF_NVMC, NRF_NVMC_MODE_WRITE);
+    uicr_word_write(&NRF_UICR->KEYSLOT.CONFIG[slot].PERM,
+                    NRF_UICR->KEYSLOT.CONFIG[slot].PERM & ~UICR_KEYSLOT_CONFIG_PERM_STATE_Msk);
+    nrf_nvmc_mode_set(NRF_NVMC, NRF_NVMC_MODE_READONLY);
+
+    NRFX_LOG_INFO("Key slot %d revoked.", slot);
+    return NRFX_SUCCESS;
+}
+
+#endif // NRFX_CHECK(NRFX_KMU_ENABLED)
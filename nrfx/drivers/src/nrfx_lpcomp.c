@@ -64,6 +64,8 @@ static void lpcomp_execute_handler(nrf_lpcomp_event_t event, uint32_t event_mask
 
 void nrfx_lpcomp_irq_handler(void)
 {
+    NRFX_IRQ_ENTER(NRF_LPCOMP);
+
     uint32_t evt_mask = nrfy_lpcomp_events_process(NRF_LPCOMP,
                                                    NRF_LPCOMP_INT_READY_MASK |
                                                    NRF_LPCOMP_INT_DOWN_MASK |
@@ -74,13 +76,14 @@ void nrfx_lpcomp_irq_handler(void)
     lpcomp_execute_handler(NRF_LPCOMP_EVENT_DOWN,  evt_mask);
     lpcomp_execute_handler(NRF_LPCOMP_EVENT_UP,    evt_mask);
     lpcomp_execute_handler(NRF_LPCOMP_EVENT_CROSS, evt_mask);
+
+    NRFX_IRQ_EXIT(NRF_LPCOMP);
 }
 
 nrfx_err_t nrfx_lpcomp_init(nrfx_lpcomp_config_t const * p_config,
                             nrfx_lpcomp_event_handler_t  event_handler)
 {
     NRFX_ASSERT(p_config);
-    NRFX_ASSERT(event_handler);
     nrfx_err_t err_code;
 
     if (m_state != NRFX_DRV_STATE_UNINITIALIZED)
@@ -149,6 +152,11 @@ nrfx_err_t nrfx_lpcomp_init(nrfx_lpcomp_config_t const * p_config,
         default:
             break;
     }
+    if (!event_handler)
+    {
+        // Events are used only through (D)PPI.
+        int_mask = 0;
+    }
     nrfy_lpcomp_int_init(NRF_LPCOMP, int_mask, p_config->interrupt_priority, true);
     nrfy_lpcomp_shorts_enable(NRF_LPCOMP, NRF_LPCOMP_SHORT_READY_SAMPLE_MASK);
 
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_MUTEX_ENABLED)
+
+#include <nrfx_mutex.h>
+#include <helpers/nrfx_flag32_allocator.h>
+
+#define NRFX_LOG_MODULE MUTEX
+#include <nrfx_log.h>
+
+#if !defined(NRFX_MUTEXES_USED)
+// Default mask of mutexes reserved for other modules or for the other core.
+#define NRFX_MUTEXES_USED 0x00000000uL
+#endif
+
+#if !defined(NRFX_MUTEX_CONFIG_BACKOFF_MAX_US)
+// Default maximum time between attempts to lock a mutex.
+#define NRFX_MUTEX_CONFIG_BACKOFF_MAX_US 8
+#endif
+
+#define MUTEX_AVAILABLE_MASK \
+    ((uint32_t)(NRFX_BIT_MASK(NRFX_MUTEX_COUNT) & (~NRFX_MUTEXES_USED)))
+
+/**< Bitmap representing mutexes availability. */
+static nrfx_atomic_t m_allocated_mutexes = MUTEX_AVAILABLE_MASK;
+
+nrfx_err_t nrfx_mutex_alloc(uint8_t * p_mutex)
+{
+    nrfx_err_t err_code = nrfx_flag32_alloc(&m_allocated_mutexes, p_mutex);
+
+    NRFX_LOG_INFO("Function: %s, error code: %s.",
+                  __func__,
+                  NRFX_LOG_ERROR_STRING_GET(err_code));
+    return err_code;
+}
+
+nrfx_err_t nrfx_mutex_free(uint8_t mutex)
+{
+    if ((mutex >= NRFX_MUTEX_COUNT) || !(MUTEX_AVAILABLE_MASK & NRFX_BIT(mutex)))
+    {
+        return NRFX_ERROR_INVALID_PARAM;
+    }
+
+    return nrfx_flag32_free(&m_allocated_mutexes, mutex);
+}
+
+nrfx_err_t nrfx_mutex_lock(uint8_t mutex, uint32_t timeout_us)
+{
+    uint32_t backoff_us = 1;
+    uint32_t waited_us  = 0;
+
+    while (!nrfx_mutex_try_lock(mutex))
+    {
+        if (waited_us >= timeout_us)
+        {
+            return NRFX_ERROR_TIMEOUT;
+        }
+
+        if (backoff_us > timeout_us - waited_us)
+        {
+            backoff_us = timeout_us - waited_us;
+        }
+
+        NRFX_DELAY_US(backoff_us);
+        waited_us += backoff_us;
+
+        if (backoff_us < NRFX_MUTEX_CONFIG_BACKOFF_MAX_US)
+        {
+            backoff_us *= 2;
+        }
+    }
+
+    return NRFX_SUCCESS;
+}
+
+#endif // NRFX_CHECK(NRFX_MUTEX_ENABLED)
@@ -37,6 +37,9 @@
 
 #include <nrfx_nfct.h>
 #include <hal/nrf_ficr.h>
+#if NRFX_CHECK(NRFX_NFCT_CONFIG_AUTORESPONSE_ENABLED)
+#include <string.h>
+#endif
 
 #define NRFX_LOG_MODULE NFCT
 #include <nrfx_log.h>
@@ -147,6 +150,19 @@ typedef struct
     volatile bool      field_on;
     uint32_t           frame_delay_max;
     uint32_t           frame_delay_min;
+#if NRFX_CHECK(NRFX_NFCT_CONFIG_AUTORESPONSE_ENABLED)
+    nrfx_nfct_autoresp_t const * p_autoresp;       ///< Table of automatic responses.
+    size_t                       autoresp_count;   ///< Number of automatic responses.
+    volatile bool                autoresp_tx;      ///< Automatic response is being transmitted.
+    uint8_t *                    p_rx_buffer;      ///< Buffer of the last started reception.
+    uint32_t                     rx_buffer_size;   ///< Size of the buffer of the last reception.
+    uint8_t *                    p_ring;           ///< Ring of RX buffers. NULL if not used.
+    uint16_t                     ring_buffer_size; ///< Size of one ring buffer.
+    uint8_t                      ring_count;       ///< Number of ring buffers.
+    uint8_t                      ring_next;        ///< Buffer to be checked first for the next RX.
+    uint32_t                     ring_owned;       ///< Mask of buffers owned by the upper layer.
+    bool                         ring_rx_wait;     ///< Reception waits for a free buffer.
+#endif
 } nrfx_nfct_control_block_t;
 
 static nrfx_nfct_control_block_t m_nfct_cb;
@@ -443,6 +459,76 @@ static void nfct_stop_tx(void)
 #endif // NRF_NFCT_HAS_STOPTX_TASK
 }
 
+static void nfct_rx_start(uint8_t * p_data, uint32_t data_size)
+{
+#if NRFX_CHECK(NRFX_NFCT_CONFIG_AUTORESPONSE_ENABLED)
+    m_nfct_cb.p_rx_buffer    = p_data;
+    m_nfct_cb.rx_buffer_size = data_size;
+#endif
+    nrfy_nfct_rxtx_buffer_set(NRF_NFCT, p_data, data_size, true);
+
+    nrfx_nfct_rxtx_int_enable(NRFX_NFCT_RX_INT_MASK);
+    nrfy_nfct_task_trigger(NRF_NFCT, NRF_NFCT_TASK_ENABLERXDATA);
+}
+
+#if NRFX_CHECK(NRFX_NFCT_CONFIG_AUTORESPONSE_ENABLED)
+/* Function restarts the reception into the next free ring buffer. */
+static void nfct_ring_rx_restart(void)
+{
+    for (uint8_t i = 0; i < m_nfct_cb.ring_count; i++)
+    {
+        uint8_t idx = (uint8_t)((m_nfct_cb.ring_next + i) % m_nfct_cb.ring_count);
+
+        if (!(m_nfct_cb.ring_owned & NRFX_BIT(idx)))
+        {
+            m_nfct_cb.ring_next = (uint8_t)((idx + 1) % m_nfct_cb.ring_count);
+            nfct_rx_start(&m_nfct_cb.p_ring[idx * m_nfct_cb.ring_buffer_size],
+                          m_nfct_cb.ring_buffer_size);
+            return;
+        }
+    }
+    m_nfct_cb.ring_rx_wait = true;
+}
+
+/* Function transmits the automatic response to the frame. It returns false if there is none. */
+static bool nfct_autoresponse_tx(nrfx_nfct_data_desc_t const * p_rx_data)
+{
+    for (size_t i = 0; i < m_nfct_cb.autoresp_count; i++)
+    {
+        nrfx_nfct_autoresp_t const * p_resp  = &m_nfct_cb.p_autoresp[i];
+        bool                         matched = (p_rx_data->data_size >= p_resp->pattern_size) &&
+                                               (p_rx_data->data_size >= p_resp->echo_size);
+
+        for (uint8_t j = 0; matched && (j < p_resp->pattern_size); j++)
+        {
+            uint8_t mask = p_resp->p_mask ? p_resp->p_mask[j] : UINT8_MAX;
+
+            matched = ((p_rx_data->p_data[j] & mask) == p_resp->p_pattern[j]);
+        }
+        if (!matched)
+        {
+            continue;
+        }
+
+        nrfx_nfct_data_desc_t tx_data =
+        {
+            .data_size = p_resp->response_size,
+            .p_data    = p_resp->p_response,
+        };
+
+        memcpy(p_resp->p_response, p_rx_data->p_data, p_resp->echo_size);
+        m_nfct_cb.autoresp_tx = true;
+        if (nrfx_nfct_tx(&tx_data, NRF_NFCT_FRAME_DELAY_MODE_WINDOWGRID) != NRFX_SUCCESS)
+        {
+            m_nfct_cb.autoresp_tx = false;
+            return false;
+        }
+        return true;
+    }
+    return false;
+}
+#endif // NRFX_CHECK(NRFX_NFCT_CONFIG_AUTORESPONSE_ENABLED)
+
 nrfx_err_t nrfx_nfct_init(nrfx_nfct_config_t const * p_config)
 {
     NRFX_ASSERT(p_config);
@@ -550,10 +636,7 @@ nrfx_err_t nrfx_nfct_rx(nrfx_nfct_data_desc_t const * p_rx_data)
         return err;
     }
 
-    nrfy_nfct_rxtx_buffer_set(NRF_NFCT, (uint8_t *)p_rx_data->p_data, p_rx_data->data_size, true);
-
-    nrfx_nfct_rxtx_int_enable(NRFX_NFCT_RX_INT_MASK);
-    nrfy_nfct_task_trigger(NRF_NFCT, NRF_NFCT_TASK_ENABLERXDATA);
+    nfct_rx_start((uint8_t *)p_rx_data->p_data, p_rx_data->data_size);
 
     return NRFX_SUCCESS;
 }
@@ -861,8 +944,81 @@ void nrfx_nfct_autocolres_disable(void)
 #endif //defined(NRF52832_XXAA) || defined(NRF52832_XXAB)
 }
 
+#if NRFX_CHECK(NRFX_NFCT_CONFIG_AUTORESPONSE_ENABLED)
+nrfx_err_t nrfx_nfct_autoresponse_set(nrfx_nfct_autoresp_t const * p_table, size_t count)
+{
+    NRFX_ASSERT(p_table || (count == 0));
+    NRFX_ASSERT((m_nfct_cb.config.rxtx_int_mask & NRFX_NFCT_EVT_RX_FRAMEEND) &&
+                (m_nfct_cb.config.rxtx_int_mask & NRFX_NFCT_EVT_TX_FRAMEEND));
+
+    for (size_t i = 0; i < count; i++)
+    {
+        NRFX_ASSERT(p_table[i].echo_size <= p_table[i].response_size);
+        if (!nrf_dma_accessible_check(NRF_NFCT, p_table[i].p_response))
+        {
+            return NRFX_ERROR_INVALID_ADDR;
+        }
+    }
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    m_nfct_cb.p_autoresp     = p_table;
+    m_nfct_cb.autoresp_count = p_table ? count : 0;
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    return NRFX_SUCCESS;
+}
+
+nrfx_err_t nrfx_nfct_rx_ring_set(uint8_t * p_buffers, uint16_t buffer_size, uint8_t count)
+{
+    NRFX_ASSERT(!p_buffers || ((buffer_size > 0) && (count > 0) && (count <= 32)));
+    NRFX_ASSERT((m_nfct_cb.config.rxtx_int_mask & NRFX_NFCT_EVT_RX_FRAMEEND) &&
+                (m_nfct_cb.config.rxtx_int_mask & NRFX_NFCT_EVT_TX_FRAMEEND));
+
+    if (p_buffers && !nrf_dma_accessible_check(NRF_NFCT, p_buffers))
+    {
+        return NRFX_ERROR_INVALID_ADDR;
+    }
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    m_nfct_cb.p_ring           = p_buffers;
+    m_nfct_cb.ring_buffer_size = buffer_size;
+    m_nfct_cb.ring_count       = count;
+    m_nfct_cb.ring_next        = 0;
+    m_nfct_cb.ring_owned       = 0;
+    m_nfct_cb.ring_rx_wait     = false;
+    if (p_buffers)
+    {
+        nfct_ring_rx_restart();
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    return NRFX_SUCCESS;
+}
+
+void nrfx_nfct_rx_ring_release(uint8_t const * p_data)
+{
+    NRFX_ASSERT(m_nfct_cb.p_ring);
+    NRFX_ASSERT(p_data >= m_nfct_cb.p_ring);
+
+    uint32_t idx = (uint32_t)(p_data - m_nfct_cb.p_ring) / m_nfct_cb.ring_buffer_size;
+
+    NRFX_ASSERT(idx < m_nfct_cb.ring_count);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    m_nfct_cb.ring_owned &= ~NRFX_BIT(idx);
+    if (m_nfct_cb.ring_rx_wait)
+    {
+        m_nfct_cb.ring_rx_wait = false;
+        nfct_ring_rx_restart();
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+#endif // NRFX_CHECK(NRFX_NFCT_CONFIG_AUTORESPONSE_ENABLED)
+
 void nrfx_nfct_irq_handler(void)
 {
+    NRFX_IRQ_ENTER(NRF_NFCT);
+
     nrfx_nfct_field_state_t current_field = NRFX_NFC_FIELD_STATE_NONE;
     uint32_t evt_mask = nrfy_nfct_events_process(NRF_NFCT,
                                         NRFY_EVENT_TO_INT_BITMASK(NRF_NFCT_EVENT_FIELDDETECTED)  |
@@ -934,7 +1090,27 @@ void nrfx_nfct_irq_handler(void)
             nrfy_nfct_rx_frame_status_clear(NRF_NFCT, NRFX_NFCT_FRAME_STATUS_RX_ALL_MASK);
         }
 
+#if NRFX_CHECK(NRFX_NFCT_CONFIG_AUTORESPONSE_ENABLED)
+        if ((nfct_evt.params.rx_frameend.rx_status == 0) &&
+            nfct_autoresponse_tx(&nfct_evt.params.rx_frameend.rx_data))
+        {
+            NRFX_LOG_DEBUG("Rx fend, automatic response");
+        }
+        else
+        {
+            if (m_nfct_cb.p_ring)
+            {
+                /* The frame stays in its buffer until it is released. */
+                uint32_t idx = (uint32_t)(m_nfct_cb.p_rx_buffer - m_nfct_cb.p_ring) /
+                               m_nfct_cb.ring_buffer_size;
+
+                m_nfct_cb.ring_owned |= NRFX_BIT(idx);
+            }
+            NRFX_NFCT_CB_HANDLE(m_nfct_cb.config.cb, nfct_evt);
+        }
+#else
         NRFX_NFCT_CB_HANDLE(m_nfct_cb.config.cb, nfct_evt);
+#endif
 
         NRFX_LOG_DEBUG("Rx fend");
     }
@@ -994,7 +1170,11 @@ void nrfx_nfct_irq_handler(void)
 
     if (NRFX_NFCT_EVT_ACTIVE(TXFRAMESTART, evt_mask))
     {
+#if NRFX_CHECK(NRFX_NFCT_CONFIG_AUTORESPONSE_ENABLED)
+        if ((m_nfct_cb.config.cb != NULL) && !m_nfct_cb.autoresp_tx)
+#else
         if (m_nfct_cb.config.cb != NULL)
+#endif
         {
             nrfx_nfct_evt_t nfct_evt;
 
@@ -1017,10 +1197,29 @@ void nrfx_nfct_irq_handler(void)
         /* Ignore any frame transmission until a new TX is scheduled by nrfx_nfct_tx() */
         nrfy_nfct_int_disable(NRF_NFCT, NRFX_NFCT_TX_INT_MASK);
 
+#if NRFX_CHECK(NRFX_NFCT_CONFIG_AUTORESPONSE_ENABLED)
+        if (m_nfct_cb.autoresp_tx)
+        {
+            /* The command buffer was not passed to the upper layer, so it is reused. */
+            m_nfct_cb.autoresp_tx = false;
+            nfct_rx_start(m_nfct_cb.p_rx_buffer, m_nfct_cb.rx_buffer_size);
+        }
+        else
+        {
+            if (m_nfct_cb.p_ring)
+            {
+                nfct_ring_rx_restart();
+            }
+            NRFX_NFCT_CB_HANDLE(m_nfct_cb.config.cb, nfct_evt);
+        }
+#else
         NRFX_NFCT_CB_HANDLE(m_nfct_cb.config.cb, nfct_evt);
+#endif
 
         NRFX_LOG_DEBUG("Tx fend");
     }
+
+    NRFX_IRQ_EXIT(NRF_NFCT);
 }
 
 #endif // NRFX_CHECK(NRFX_NFCT_ENABLED)
@@ -37,6 +37,11 @@
 
 #include <nrfx_nvmc.h>
 
+#if NRFX_CHECK(NRFX_NVMC_CONFIG_ERASE_SCHEDULER_ENABLED) && \
+    !defined(NRF_NVMC_PARTIAL_ERASE_PRESENT)
+#error "NRFX_NVMC_CONFIG_ERASE_SCHEDULER_ENABLED requires an NVMC with partial erase."
+#endif
+
 /**
  * Value representing the number of bytes in a word.
  *
@@ -108,6 +113,21 @@ static uint32_t m_partial_erase_time_elapsed;
 /** Partial erase page address. */
 static uint32_t m_partial_erase_page_addr = NVMC_PARTIAL_ERASE_INVALID_ADDR;
 
+#if NRFX_CHECK(NRFX_NVMC_CONFIG_ERASE_SCHEDULER_ENABLED)
+/** Erase scheduler data. */
+typedef struct
+{
+    nrfx_nvmc_erase_handler_t handler;    ///< Completion handler.
+    void *                    p_context;  ///< Context passed to the completion handler.
+    uint32_t                  start_addr; ///< Address of the first page of the range.
+    uint32_t                  page_addr;  ///< Address of the page being erased.
+    uint32_t                  pages_left; ///< Number of pages still to be erased.
+    uint32_t                  step_ms;    ///< Duration of a single erase step.
+} nvmc_erase_sched_t;
+
+static nvmc_erase_sched_t m_erase_sched;
+#endif
+
 #endif // defined(NRF_NVMC_PARTIAL_ERASE_PRESENT)
 
 static uint32_t flash_page_size_get(void)
@@ -258,6 +278,149 @@ static void nvmc_words_write(uint32_t addr, void const * src, uint32_t num_words
     }
 }
 
+#if NRFX_CHECK(NRFX_NVMC_CONFIG_WRITER_ENABLED)
+static bool nvmc_word_write_ready_check(void)
+{
+#if defined(NVMC_READYNEXT_READYNEXT_Msk)
+    return nrf_nvmc_write_ready_check(NRF_NVMC);
+#else
+    return nrf_nvmc_ready_check(NRF_NVMC);
+#endif
+}
+
+static void nvmc_writer_word_commit(nrfx_nvmc_writer_t * p_writer)
+{
+    // The word containing the last packed byte.
+    uint32_t word_addr = (p_writer->addr - 1) & ~(0x03UL);
+
+    nrf_nvmc_word_write(word_addr, p_writer->word);
+    __DMB();
+    p_writer->word = 0xFFFFFFFF;
+}
+
+static void nvmc_writer_bytes_put(nrfx_nvmc_writer_t * p_writer, bool wait)
+{
+    nvmc_write_mode_set();
+
+    while (p_writer->remaining > 0)
+    {
+        uint32_t byte_shift = p_writer->addr % NVMC_BYTES_IN_WORD;
+        bool     word_done  = (byte_shift == (NVMC_BYTES_IN_WORD - 1));
+
+        if (word_done)
+        {
+            while (!nvmc_word_write_ready_check())
+            {
+                if (!wait)
+                {
+                    nvmc_readonly_mode_set();
+                    return;
+                }
+            }
+        }
+
+        ((uint8_t *)&p_writer->word)[byte_shift] = *p_writer->p_src;
+        p_writer->p_src++;
+        p_writer->remaining--;
+        p_writer->addr++;
+
+        if (word_done)
+        {
+            nvmc_writer_word_commit(p_writer);
+        }
+    }
+
+    nvmc_readonly_mode_set();
+}
+
+void nrfx_nvmc_writer_init(nrfx_nvmc_writer_t * p_writer, uint32_t addr)
+{
+    NRFX_ASSERT(p_writer);
+    NRFX_ASSERT(is_valid_address(addr, true));
+
+    p_writer->addr      = addr;
+    p_writer->word      = 0xFFFFFFFF;
+    p_writer->p_src     = NULL;
+    p_writer->remaining = 0;
+    p_writer->handler   = NULL;
+    p_writer->p_context = NULL;
+}
+
+void nrfx_nvmc_writer_write(nrfx_nvmc_writer_t * p_writer, void const * src, uint32_t num_bytes)
+{
+    NRFX_ASSERT(p_writer);
+    NRFX_ASSERT(!p_writer->handler);
+    NRFX_ASSERT(is_valid_address(p_writer->addr, true));
+
+    p_writer->p_src     = (uint8_t const *)src;
+    p_writer->remaining = num_bytes;
+    nvmc_writer_bytes_put(p_writer, true);
+}
+
+nrfx_err_t nrfx_nvmc_writer_write_async(nrfx_nvmc_writer_t *       p_writer,
+                                        void const *               src,
+                                        uint32_t                   num_bytes,
+                                        nrfx_nvmc_writer_handler_t handler,
+                                        void *                     p_context)
+{
+    NRFX_ASSERT(p_writer);
+    NRFX_ASSERT(handler);
+    NRFX_ASSERT(is_valid_address(p_writer->addr, true));
+
+    if (p_writer->handler)
+    {
+        return NRFX_ERROR_BUSY;
+    }
+
+    p_writer->p_src     = (uint8_t const *)src;
+    p_writer->remaining = num_bytes;
+    p_writer->handler   = handler;
+    p_writer->p_context = p_context;
+
+    return NRFX_SUCCESS;
+}
+
+bool nrfx_nvmc_writer_process(nrfx_nvmc_writer_t * p_writer)
+{
+    NRFX_ASSERT(p_writer);
+
+    if (!p_writer->handler)
+    {
+        return true;
+    }
+
+    nvmc_writer_bytes_put(p_writer, false);
+    if (p_writer->remaining > 0)
+    {
+        return false;
+    }
+
+    // Release the writer before calling the handler, so that the next write can be started there.
+    nrfx_nvmc_writer_handler_t handler = p_writer->handler;
+    p_writer->handler = NULL;
+    handler(p_writer->p_context);
+
+    return true;
+}
+
+void nrfx_nvmc_writer_flush(nrfx_nvmc_writer_t * p_writer)
+{
+    NRFX_ASSERT(p_writer);
+    NRFX_ASSERT(!p_writer->handler);
+
+    if ((p_writer->addr % NVMC_BYTES_IN_WORD) == 0)
+    {
+        return;
+    }
+
+    nvmc_write_mode_set();
+    while (!nvmc_word_write_ready_check())
+    {}
+    nvmc_writer_word_commit(p_writer);
+    nvmc_readonly_mode_set();
+}
+#endif // NRFX_CHECK(NRFX_NVMC_CONFIG_WRITER_ENABLED)
+
 nrfx_err_t nrfx_nvmc_page_erase(uint32_t addr)
 {
     NRFX_ASSERT(is_valid_address(addr, false));
@@ -344,6 +507,100 @@ bool nrfx_nvmc_page_partial_erase_continue(void)
         return true;
     }
 }
+
+#if NRFX_CHECK(NRFX_NVMC_CONFIG_ERASE_SCHEDULER_ENABLED)
+static bool nvmc_page_erased_check(uint32_t addr)
+{
+    uint32_t words = flash_page_size_get() / NVMC_BYTES_IN_WORD;
+    for (uint32_t i = 0; i < words; i++)
+    {
+        if (nrf_nvmc_word_read(addr + (NVMC_BYTES_IN_WORD * i)) != 0xFFFFFFFF)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+nrfx_err_t nrfx_nvmc_erase_schedule(uint32_t                  addr,
+                                    uint32_t                  page_count,
+                                    uint32_t                  step_ms,
+                                    nrfx_nvmc_erase_handler_t handler,
+                                    void *                    p_context)
+{
+    NRFX_ASSERT(is_valid_address(addr, false));
+    NRFX_ASSERT(page_count > 0);
+    NRFX_ASSERT(is_valid_address(addr + (page_count * flash_page_size_get()) - 1, false));
+
+    if (!is_page_aligned_check(addr))
+    {
+        return NRFX_ERROR_INVALID_ADDR;
+    }
+
+    uint32_t step_max_ms = NVMC_ERASEPAGEPARTIALCFG_DURATION_Msk >>
+                           NVMC_ERASEPAGEPARTIALCFG_DURATION_Pos;
+    if ((step_ms == 0) || (step_ms > step_max_ms))
+    {
+        return NRFX_ERROR_INVALID_PARAM;
+    }
+
+    if (m_erase_sched.pages_left > 0)
+    {
+        return NRFX_ERROR_BUSY;
+    }
+
+    m_erase_sched.handler    = handler;
+    m_erase_sched.p_context  = p_context;
+    m_erase_sched.start_addr = addr;
+    m_erase_sched.page_addr  = addr;
+    m_erase_sched.step_ms    = step_ms;
+    m_erase_sched.pages_left = page_count;
+
+    return NRFX_SUCCESS;
+}
+
+bool nrfx_nvmc_erase_step(void)
+{
+    if (m_erase_sched.pages_left == 0)
+    {
+        return true;
+    }
+
+    bool page_done;
+    if (m_partial_erase_page_addr == NVMC_PARTIAL_ERASE_INVALID_ADDR)
+    {
+        // Checking the page content takes much less time than a single erase step.
+        page_done = nvmc_page_erased_check(m_erase_sched.page_addr);
+        if (!page_done)
+        {
+            (void)nrfx_nvmc_page_partial_erase_init(m_erase_sched.page_addr,
+                                                    m_erase_sched.step_ms);
+            page_done = nrfx_nvmc_page_partial_erase_continue();
+        }
+    }
+    else
+    {
+        NRFX_ASSERT(m_partial_erase_page_addr == m_erase_sched.page_addr);
+        page_done = nrfx_nvmc_page_partial_erase_continue();
+    }
+
+    if (page_done)
+    {
+        m_erase_sched.page_addr += flash_page_size_get();
+        m_erase_sched.pages_left--;
+        if (m_erase_sched.pages_left == 0)
+        {
+            if (m_erase_sched.handler)
+            {
+                m_erase_sched.handler(m_erase_sched.start_addr, m_erase_sched.p_context);
+            }
+            return true;
+        }
+    }
+
+    return false;
+}
+#endif // NRFX_CHECK(NRFX_NVMC_CONFIG_ERASE_SCHEDULER_ENABLED)
 #endif // defined(NRF_NVMC_PARTIAL_ERASE_PRESENT)
 
 bool nrfx_nvmc_byte_writable_check(uint32_t addr, uint8_t val_to_check)
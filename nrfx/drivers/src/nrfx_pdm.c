@@ -48,6 +48,10 @@
     (event == NRF_PDM_EVENT_END     ? "NRF_PDM_EVENT_END"     : \
                                       "UNKNOWN EVENT")))
 
+#if NRFX_PDM_CONFIG_BUFFER_QUEUE_SIZE > UINT8_MAX
+#error "NRFX_PDM_CONFIG_BUFFER_QUEUE_SIZE must not exceed 255."
+#endif
+
 
 /** @brief PDM interface status. */
 typedef enum
@@ -70,6 +74,16 @@ typedef struct
     uint8_t                   error;            ///< Driver error flag.
     volatile uint8_t          irq_buff_request; ///< Request the next buffer in the ISR.
     bool                      skip_gpio_cfg;    ///< Do not touch GPIO configuration of used pins.
+#if NRFX_PDM_CONFIG_BUFFER_QUEUE_SIZE > 0
+    /** Buffers waiting to be supplied to the peripheral. */
+    nrfy_pdm_buffer_t         queue[NRFX_PDM_CONFIG_BUFFER_QUEUE_SIZE];
+    uint8_t                   queue_head;       ///< Index of the oldest queued buffer.
+    uint8_t                   queue_count;      ///< Number of queued buffers.
+#endif
+#if NRFX_CHECK(NRFX_PDM_CONFIG_POSTPROC_ENABLED)
+    nrfx_pdm_postproc_t       postproc;         ///< Post-processing configuration.
+    bool                      stereo;           ///< Samples of two channels are interleaved.
+#endif
 } nrfx_pdm_cb_t;
 
 static nrfx_pdm_cb_t m_cb;
@@ -82,6 +96,9 @@ static void pdm_configure(nrfx_pdm_config_t const * p_config)
         nrfy_gpio_cfg_output(p_config->clk_pin);
         nrfy_gpio_cfg_input(p_config->din_pin, NRF_GPIO_PIN_NOPULL);
     }
+#if NRFX_CHECK(NRFX_PDM_CONFIG_POSTPROC_ENABLED)
+    m_cb.stereo = (p_config->mode == NRF_PDM_MODE_STEREO);
+#endif
     if (!p_config->skip_psel_cfg)
     {
         nrf_pdm_psel_connect(NRF_PDM0,
@@ -136,6 +153,14 @@ nrfx_err_t nrfx_pdm_init(nrfx_pdm_config_t const * p_config,
     m_cb.error = 0;
     m_cb.event_handler = event_handler;
     m_cb.op_state = NRFX_PDM_STATE_IDLE;
+#if NRFX_PDM_CONFIG_BUFFER_QUEUE_SIZE > 0
+    m_cb.queue_head = 0;
+    m_cb.queue_count = 0;
+#endif
+#if NRFX_CHECK(NRFX_PDM_CONFIG_POSTPROC_ENABLED)
+    m_cb.postproc.decimation = 1;
+    m_cb.postproc.gain = NRFX_PDM_POSTPROC_GAIN_UNITY;
+#endif
 
     if (p_config)
     {
@@ -301,6 +326,111 @@ nrfx_err_t nrfx_pdm_buffer_set(int16_t * buffer, uint16_t buffer_length)
     return err_code;
 }
 
+#if NRFX_PDM_CONFIG_BUFFER_QUEUE_SIZE > 0
+nrfx_err_t nrfx_pdm_buffer_queue(int16_t * buffer, uint16_t buffer_length)
+{
+    if (m_cb.drv_state == NRFX_DRV_STATE_UNINITIALIZED)
+    {
+        return NRFX_ERROR_INVALID_STATE;
+    }
+    if ((buffer == NULL) || (buffer_length > NRFX_PDM_MAX_BUFFER_SIZE))
+    {
+        return NRFX_ERROR_INVALID_PARAM;
+    }
+
+    nrfx_err_t err_code = NRFX_SUCCESS;
+
+    // Enter the PDM critical section.
+    NRFY_IRQ_DISABLE(nrfx_get_irq_number(NRF_PDM0));
+
+    if (m_cb.queue_count == NRFX_PDM_CONFIG_BUFFER_QUEUE_SIZE)
+    {
+        err_code = NRFX_ERROR_NO_MEM;
+    }
+    else
+    {
+        uint8_t idx = (m_cb.queue_head + m_cb.queue_count) % NRFX_PDM_CONFIG_BUFFER_QUEUE_SIZE;
+        m_cb.queue[idx].p_buff = buffer;
+        m_cb.queue[idx].length = buffer_length;
+        m_cb.queue_count++;
+    }
+
+    NRFY_IRQ_ENABLE(nrfx_get_irq_number(NRF_PDM0));
+    return err_code;
+}
+
+static bool pdm_queue_feed(void)
+{
+    if (m_cb.queue_count == 0)
+    {
+        return false;
+    }
+
+    nrfy_pdm_buffer_t const * p_entry = &m_cb.queue[m_cb.queue_head];
+    if (nrfx_pdm_buffer_set(p_entry->p_buff, p_entry->length) != NRFX_SUCCESS)
+    {
+        return false;
+    }
+
+    m_cb.queue_head = (m_cb.queue_head + 1) % NRFX_PDM_CONFIG_BUFFER_QUEUE_SIZE;
+    m_cb.queue_count--;
+    return true;
+}
+#endif
+
+#if NRFX_CHECK(NRFX_PDM_CONFIG_POSTPROC_ENABLED)
+nrfx_err_t nrfx_pdm_postproc_set(nrfx_pdm_postproc_t const * p_postproc)
+{
+    NRFX_ASSERT(p_postproc);
+    if (m_cb.drv_state == NRFX_DRV_STATE_UNINITIALIZED)
+    {
+        return NRFX_ERROR_INVALID_STATE;
+    }
+    if (p_postproc->decimation == 0)
+    {
+        return NRFX_ERROR_INVALID_PARAM;
+    }
+    if (m_cb.op_state != NRFX_PDM_STATE_IDLE)
+    {
+        return NRFX_ERROR_BUSY;
+    }
+
+    m_cb.postproc = *p_postproc;
+    return NRFX_SUCCESS;
+}
+
+static uint16_t pdm_postproc_run(int16_t * p_buffer, uint16_t length)
+{
+    uint8_t  factor   = m_cb.postproc.decimation;
+    int32_t  gain     = m_cb.postproc.gain;
+    uint8_t  channels = m_cb.stereo ? 2 : 1;
+    uint16_t step     = (uint16_t)(factor * channels);
+    uint16_t out      = 0;
+
+    if ((factor == 1) && (gain == NRFX_PDM_POSTPROC_GAIN_UNITY))
+    {
+        return length;
+    }
+
+    // Output never overtakes input, so the buffer can be processed in place.
+    for (uint32_t in = 0; (in + step) <= length; in += step)
+    {
+        for (uint8_t ch = 0; ch < channels; ch++)
+        {
+            int32_t acc = 0;
+            for (uint8_t i = 0; i < factor; i++)
+            {
+                acc += p_buffer[in + (i * channels) + ch];
+            }
+            acc = ((acc / factor) * gain) / NRFX_PDM_POSTPROC_GAIN_UNITY;
+            acc = NRFX_MIN(NRFX_MAX(acc, INT16_MIN), INT16_MAX);
+            p_buffer[out++] = (int16_t)acc;
+        }
+    }
+    return out;
+}
+#endif
+
 nrfx_err_t nrfx_pdm_stop(void)
 {
     NRFX_ASSERT(m_cb.drv_state != NRFX_DRV_STATE_UNINITIALIZED);
@@ -336,6 +466,8 @@ nrfx_err_t nrfx_pdm_stop(void)
 
 void nrfx_pdm_irq_handler(void)
 {
+    NRFX_IRQ_ENTER(NRF_PDM0);
+
     nrfy_pdm_buffer_t buffer =
     {
         .p_buff = m_cb.buff_address[m_cb.active_buffer],
@@ -366,16 +498,31 @@ void nrfx_pdm_irq_handler(void)
             if (m_cb.op_state == NRFX_PDM_STATE_STARTING)
             {
                 evt.buffer_released = 0;
+#if NRFX_CHECK(NRFX_PDM_CONFIG_POSTPROC_ENABLED)
+                evt.released_length = 0;
+#endif
                 m_cb.op_state = NRFX_PDM_STATE_RUNNING;
             }
             else
             {
                 evt.buffer_released = m_cb.buff_address[finished_buffer];
+#if NRFX_CHECK(NRFX_PDM_CONFIG_POSTPROC_ENABLED)
+                evt.released_length = pdm_postproc_run(m_cb.buff_address[finished_buffer],
+                                                       m_cb.buff_length[finished_buffer]);
+#endif
                 m_cb.buff_address[finished_buffer] = 0;
                 m_cb.active_buffer = next_buffer;
             }
+#if NRFX_PDM_CONFIG_BUFFER_QUEUE_SIZE > 0
+            evt.buffer_requested = !pdm_queue_feed();
+            if (evt.buffer_requested || evt.buffer_released)
+            {
+                m_cb.event_handler(&evt);
+            }
+#else
             evt.buffer_requested = true;
             m_cb.event_handler(&evt);
+#endif
         }
         else
         {
@@ -408,6 +555,9 @@ void nrfx_pdm_irq_handler(void)
         nrfx_pdm_evt_t evt;
         evt.error = NRFX_PDM_NO_ERROR;
         evt.buffer_requested = false;
+#if NRFX_CHECK(NRFX_PDM_CONFIG_POSTPROC_ENABLED)
+        evt.released_length = 0;
+#endif
         if (m_cb.buff_address[m_cb.active_buffer])
         {
             evt.buffer_released = m_cb.buff_address[m_cb.active_buffer];
@@ -425,6 +575,12 @@ void nrfx_pdm_irq_handler(void)
         m_cb.active_buffer = 0;
     }
 
+#if NRFX_PDM_CONFIG_BUFFER_QUEUE_SIZE > 0
+    if (m_cb.irq_buff_request && pdm_queue_feed())
+    {
+        m_cb.irq_buff_request = 0;
+    }
+#endif
     if (m_cb.irq_buff_request)
     {
         nrfx_pdm_evt_t const evt =
@@ -436,6 +592,8 @@ void nrfx_pdm_irq_handler(void)
         m_cb.irq_buff_request = 0;
         m_cb.event_handler(&evt);
     }
+
+    NRFX_IRQ_EXIT(NRF_PDM0);
 }
 
 #endif // NRFX_CHECK(NRFX_PDM_ENABLED)
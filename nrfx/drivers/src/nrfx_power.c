@@ -36,6 +36,7 @@
 #if NRFX_CHECK(NRFX_POWER_ENABLED)
 
 #include <nrfx_power.h>
+#include <helpers/nrfx_perf_counters.h>
 
 #if NRFX_CHECK(NRFX_CLOCK_ENABLED)
 
@@ -93,6 +94,23 @@ static nrfx_power_sleep_event_handler_t m_sleepevt_handler;
 static nrfx_power_usb_event_handler_t m_usbevt_handler;
 #endif
 
+#if NRFX_CHECK(NRFX_POWER_CONFIG_RESIDENCY_ENABLED)
+/**
+ * @brief State of the sleep-state residency accounting
+ */
+static struct
+{
+    nrfx_power_residency_t stats;
+    nrfx_power_time_get_t  time_get;
+    uint32_t               time_mask;
+    uint32_t               last;
+    nrfx_power_mode_t      mode;
+    bool                   sleeping;
+} m_residency = { .mode = NRFX_POWER_MODE_LOWPWR };
+
+NRFX_PERF_HISTOGRAM_REGISTER(wakeups, "nrfx_power.wakeups", m_residency.stats.wakeups);
+#endif
+
 /** @} */
 
 nrfx_power_pofwarn_event_handler_t nrfx_power_pof_handler_get(void)
@@ -251,6 +269,81 @@ void nrfx_power_sleepevt_uninit(void)
 }
 #endif /* NRF_POWER_HAS_SLEEPEVT */
 
+#if NRF_POWER_HAS_CONST_LATENCY && NRF_POWER_HAS_LOW_POWER
+void nrfx_power_mode_set(nrfx_power_mode_t mode)
+{
+    nrf_power_task_trigger(NRF_POWER, (mode == NRFX_POWER_MODE_CONSTLAT) ?
+                                      NRF_POWER_TASK_CONSTLAT : NRF_POWER_TASK_LOWPWR);
+#if NRFX_CHECK(NRFX_POWER_CONFIG_RESIDENCY_ENABLED)
+    m_residency.mode = mode;
+#endif
+}
+#endif
+
+#if NRFX_CHECK(NRFX_POWER_CONFIG_RESIDENCY_ENABLED)
+static uint32_t residency_elapsed(uint32_t now)
+{
+    return (now - m_residency.last) & m_residency.time_mask;
+}
+
+void nrfx_power_residency_init(nrfx_power_time_get_t time_get, uint32_t time_mask)
+{
+    NRFX_ASSERT(time_get);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    memset(&m_residency.stats, 0, sizeof(m_residency.stats));
+    m_residency.time_get  = time_get;
+    m_residency.time_mask = time_mask;
+    m_residency.last      = time_get();
+    m_residency.sleeping  = false;
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+void nrfx_power_residency_sleep_enter(void)
+{
+    NRFX_ASSERT(m_residency.time_get);
+
+    uint32_t now = m_residency.time_get();
+
+    m_residency.stats.active += residency_elapsed(now);
+    m_residency.last          = now;
+    m_residency.sleeping      = true;
+}
+
+void nrfx_power_residency_sleep_exit(uint8_t source)
+{
+    NRFX_ASSERT(m_residency.time_get);
+    NRFX_ASSERT(source < NRFX_POWER_CONFIG_RESIDENCY_WAKEUP_SOURCES);
+
+    uint32_t now = m_residency.time_get();
+
+    m_residency.stats.idle[m_residency.mode] += residency_elapsed(now);
+    m_residency.stats.wakeups[source]++;
+    m_residency.last     = now;
+    m_residency.sleeping = false;
+}
+
+void nrfx_power_residency_get(nrfx_power_residency_t * p_residency)
+{
+    NRFX_ASSERT(p_residency);
+    NRFX_ASSERT(m_residency.time_get);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    *p_residency = m_residency.stats;
+
+    uint32_t elapsed = residency_elapsed(m_residency.time_get());
+    if (m_residency.sleeping)
+    {
+        p_residency->idle[m_residency.mode] += elapsed;
+    }
+    else
+    {
+        p_residency->active += elapsed;
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+#endif // NRFX_CHECK(NRFX_POWER_CONFIG_RESIDENCY_ENABLED)
+
 #if NRF_POWER_HAS_USBREG
 void nrfx_power_usbevt_init(nrfx_power_usbevt_config_t const * p_config)
 {
@@ -289,6 +382,8 @@ void nrfx_power_usbevt_uninit(void)
 
 void nrfx_power_irq_handler(void)
 {
+    NRFX_IRQ_ENTER(NRF_POWER);
+
     uint32_t enabled = nrf_power_int_enable_get(NRF_POWER);
     /* Prevent "unused variable" warning when all below blocks are disabled. */
     (void)enabled;
@@ -341,6 +436,8 @@ void nrfx_power_irq_handler(void)
         m_usbevt_handler(NRFX_POWER_USB_EVT_READY);
     }
 #endif
+
+    NRFX_IRQ_EXIT(NRF_POWER);
 }
 
 #if NRFX_CHECK(NRFX_CLOCK_ENABLED)
@@ -356,8 +453,12 @@ void nrfx_power_irq_handler(void)
  */
 void nrfx_power_clock_irq_handler(void)
 {
+    NRFX_IRQ_ENTER(NRF_POWER);
+
     nrfx_power_irq_handler();
     nrfx_clock_irq_handler();
+
+    NRFX_IRQ_EXIT(NRF_POWER);
 }
 #endif
 
@@ -66,6 +66,19 @@
 #define DMA_ISSUE_EGU_IRQHandler    EGU_IRQHandler(DMA_ISSUE_EGU_IDX)
 #endif
 
+#if NRFX_CHECK(NRFX_PWM_CONFIG_STREAM_ENABLED)
+// Stream data. All counters are free-running chunk counts.
+typedef struct
+{
+    nrfx_pwm_stream_config_t config;     // Stream configuration.
+    bool                     in_ring[2]; // Sequence plays a chunk from the ring.
+    volatile uint32_t        wr;         // Chunks committed by the application.
+    volatile uint32_t        hw;         // Chunks handed to the peripheral.
+    volatile uint32_t        done;       // Chunks played by the peripheral.
+    uint32_t                 underruns;  // Idle sequences played instead of chunks.
+} pwm_stream_t;
+#endif
+
 // Control block - driver instance local data.
 typedef struct
 {
@@ -77,6 +90,10 @@ typedef struct
     nrfx_drv_state_t volatile state;
     uint8_t                   flags;
     bool                      skip_gpio_cfg;
+#if NRFX_CHECK(NRFX_PWM_CONFIG_STREAM_ENABLED)
+    bool                      streaming;
+    pwm_stream_t              stream;
+#endif
 } pwm_control_block_t;
 static pwm_control_block_t m_cb[NRFX_PWM_ENABLED_COUNT];
 
@@ -265,6 +282,9 @@ static uint32_t start_playback(nrfx_pwm_t const *    p_instance,
 {
     p_cb->state = NRFX_DRV_STATE_POWERED_ON;
     p_cb->flags = flags;
+#if NRFX_CHECK(NRFX_PWM_CONFIG_STREAM_ENABLED)
+    p_cb->streaming = false;
+#endif
 
     if (p_cb->handler)
     {
@@ -417,6 +437,147 @@ uint32_t nrfx_pwm_complex_playback(nrfx_pwm_t const *         p_instance,
     return start_playback(p_instance, p_cb, flags, 0);
 }
 
+#if NRFX_CHECK(NRFX_PWM_CONFIG_STREAM_ENABLED)
+static void stream_chunk_set(NRF_PWM_Type * p_pwm, pwm_stream_t * p_stream, uint8_t seq_id)
+{
+    uint32_t offset = (p_stream->hw % p_stream->config.chunk_count) *
+                      p_stream->config.chunk_length;
+    nrf_pwm_sequence_t const seq =
+    {
+        .values.p_raw = &p_stream->config.p_ring[offset],
+        .length       = p_stream->config.chunk_length,
+        .repeats      = p_stream->config.repeats,
+        .end_delay    = 0
+    };
+
+    nrfy_pwm_sequence_set(p_pwm, seq_id, &seq);
+    p_stream->in_ring[seq_id] = true;
+    p_stream->hw++;
+}
+
+nrfx_err_t nrfx_pwm_stream_start(nrfx_pwm_t const *               p_instance,
+                                 nrfx_pwm_stream_config_t const * p_config)
+{
+    pwm_control_block_t * p_cb = &m_cb[p_instance->instance_id];
+    NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
+    NRFX_ASSERT(p_config);
+    NRFX_ASSERT(nrfx_is_in_ram(p_config->p_ring));
+    NRFX_ASSERT(p_config->chunk_length > 0);
+    NRFX_ASSERT(p_config->chunk_count >= 2);
+    NRFX_ASSERT((p_config->prefill >= 2) && (p_config->prefill <= p_config->chunk_count));
+    NRFX_ASSERT(p_config->p_idle && nrfx_is_in_ram(p_config->p_idle->values.p_raw));
+
+    nrfx_err_t err_code;
+
+    if (p_cb->state != NRFX_DRV_STATE_INITIALIZED)
+    {
+        err_code = NRFX_ERROR_INVALID_STATE;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    pwm_stream_t * p_stream = &p_cb->stream;
+    p_stream->config    = *p_config;
+    p_stream->wr        = p_config->prefill;
+    p_stream->hw        = 0;
+    p_stream->done      = 0;
+    p_stream->underruns = 0;
+
+    stream_chunk_set(p_instance->p_reg, p_stream, 0);
+    stream_chunk_set(p_instance->p_reg, p_stream, 1);
+
+    // The sequences alternate until the loop counter expires, after which
+    // the playback is restarted by the shortcut or by the interrupt handler.
+    nrfy_pwm_loop_set(p_instance->p_reg, UINT16_MAX);
+    uint32_t int_mask = NRF_PWM_INT_SEQEND0_MASK |
+                        NRF_PWM_INT_SEQEND1_MASK |
+                        NRF_PWM_INT_STOPPED_MASK;
+#if NRF_PWM_HAS_SHORT_LOOPSDONE_SEQSTART
+    nrfy_pwm_shorts_set(p_instance->p_reg, NRF_PWM_SHORT_LOOPSDONE_SEQSTART0_MASK);
+#else
+    nrfy_pwm_shorts_set(p_instance->p_reg, 0);
+    int_mask |= NRF_PWM_INT_LOOPSDONE_MASK;
+#endif
+
+    p_cb->state     = NRFX_DRV_STATE_POWERED_ON;
+    p_cb->flags     = 0;
+    p_cb->streaming = true;
+
+    nrfy_pwm_int_set(p_instance->p_reg, int_mask);
+    nrfy_pwm_start(p_instance->p_reg, 0, false);
+
+    NRFX_LOG_INFO("Function: %s, chunk length: %d, chunk count: %d.",
+                  __func__,
+                  p_config->chunk_length,
+                  p_config->chunk_count);
+    return NRFX_SUCCESS;
+}
+
+uint16_t * nrfx_pwm_stream_chunk_get(nrfx_pwm_t const * p_instance)
+{
+    pwm_stream_t * p_stream = &m_cb[p_instance->instance_id].stream;
+
+    if ((p_stream->wr - p_stream->done) >= p_stream->config.chunk_count)
+    {
+        return NULL;
+    }
+    return &p_stream->config.p_ring[(p_stream->wr % p_stream->config.chunk_count) *
+                                    p_stream->config.chunk_length];
+}
+
+void nrfx_pwm_stream_chunk_commit(nrfx_pwm_t const * p_instance)
+{
+    pwm_stream_t * p_stream = &m_cb[p_instance->instance_id].stream;
+    NRFX_ASSERT((p_stream->wr - p_stream->done) < p_stream->config.chunk_count);
+
+    p_stream->wr++;
+}
+
+uint32_t nrfx_pwm_stream_underruns_get(nrfx_pwm_t const * p_instance)
+{
+    return m_cb[p_instance->instance_id].stream.underruns;
+}
+
+static void stream_seq_end(NRF_PWM_Type * p_pwm, pwm_control_block_t * p_cb, uint8_t seq_id)
+{
+    pwm_stream_t * p_stream = &p_cb->stream;
+    bool chunk_done = p_stream->in_ring[seq_id];
+
+    // Chunks are handed to both sequences in order and the sequences
+    // alternate, so they are also played in order.
+    if (chunk_done)
+    {
+        p_stream->done++;
+    }
+
+    bool underrun = (p_stream->wr == p_stream->hw);
+    if (!underrun)
+    {
+        stream_chunk_set(p_pwm, p_stream, seq_id);
+    }
+    else
+    {
+        nrfy_pwm_sequence_set(p_pwm, seq_id, p_stream->config.p_idle);
+        p_stream->in_ring[seq_id] = false;
+        p_stream->underruns++;
+    }
+
+    if (p_cb->handler)
+    {
+        if (chunk_done)
+        {
+            p_cb->handler(NRFX_PWM_EVT_STREAM_CHUNK_DONE, p_cb->p_context);
+        }
+        if (underrun)
+        {
+            p_cb->handler(NRFX_PWM_EVT_STREAM_UNDERRUN, p_cb->p_context);
+        }
+    }
+}
+#endif
+
 bool nrfx_pwm_stop(nrfx_pwm_t const * p_instance, bool wait_until_stopped)
 {
     pwm_control_block_t * p_cb = &m_cb[p_instance->instance_id];
@@ -465,6 +626,30 @@ static void irq_handler(NRF_PWM_Type * p_pwm, pwm_control_block_t * p_cb)
                                                 NRFY_EVENT_TO_INT_BITMASK(NRF_PWM_EVENT_LOOPSDONE) |
                                                 NRFY_EVENT_TO_INT_BITMASK(NRF_PWM_EVENT_STOPPED));
 
+#if NRFX_CHECK(NRFX_PWM_CONFIG_STREAM_ENABLED)
+    if (p_cb->streaming)
+    {
+        if (evt_mask & NRFY_EVENT_TO_INT_BITMASK(NRF_PWM_EVENT_SEQEND0))
+        {
+            stream_seq_end(p_pwm, p_cb, 0);
+        }
+        if (evt_mask & NRFY_EVENT_TO_INT_BITMASK(NRF_PWM_EVENT_SEQEND1))
+        {
+            stream_seq_end(p_pwm, p_cb, 1);
+        }
+#if !NRF_PWM_HAS_SHORT_LOOPSDONE_SEQSTART
+        if ((evt_mask & NRFY_EVENT_TO_INT_BITMASK(NRF_PWM_EVENT_LOOPSDONE)) &&
+            (p_cb->state == NRFX_DRV_STATE_POWERED_ON))
+        {
+            nrfy_pwm_start(p_pwm, 0, false);
+        }
+#endif
+        evt_mask &= ~(NRFY_EVENT_TO_INT_BITMASK(NRF_PWM_EVENT_SEQEND0) |
+                      NRFY_EVENT_TO_INT_BITMASK(NRF_PWM_EVENT_SEQEND1) |
+                      NRFY_EVENT_TO_INT_BITMASK(NRF_PWM_EVENT_LOOPSDONE));
+    }
+#endif
+
     // The user handler is called for SEQEND0 and SEQEND1 events only when the
     // user asks for it (by setting proper flags when starting the playback).
     if (evt_mask & NRFY_EVENT_TO_INT_BITMASK(NRF_PWM_EVENT_SEQEND0))
@@ -495,6 +680,9 @@ static void irq_handler(NRF_PWM_Type * p_pwm, pwm_control_block_t * p_cb)
     if (evt_mask & NRFY_EVENT_TO_INT_BITMASK(NRF_PWM_EVENT_STOPPED))
     {
         p_cb->state = NRFX_DRV_STATE_INITIALIZED;
+#if NRFX_CHECK(NRFX_PWM_CONFIG_STREAM_ENABLED)
+        p_cb->streaming = false;
+#endif
         if (p_cb->handler)
         {
             p_cb->handler(NRFX_PWM_EVT_STOPPED, p_cb->p_context);
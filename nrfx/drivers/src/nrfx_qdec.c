@@ -42,6 +42,8 @@
 #endif
 
 #include <haly/nrfy_gpio.h>
+#include <hal/nrf_timer.h>
+#include <helpers/nrfx_gppi.h>
 
 #define NRFX_LOG_MODULE QDEC
 #include <nrfx_log.h>
@@ -59,6 +61,17 @@ typedef struct
     bool                      skip_gpio_cfg;
     nrfx_qdec_event_handler_t handler;
     void *                    p_context;
+    bool                      reportper_inten;
+
+    // Report stream, active when p_stream is not NULL.
+    nrfx_qdec_stream_report_t * p_stream;
+    size_t                      stream_size;
+    volatile size_t             stream_wr;
+    volatile size_t             stream_rd;
+    volatile uint32_t           stream_overrun;
+    NRF_TIMER_Type *            p_timer;
+    uint8_t                     cc_channel;
+    uint8_t                     ppi_channel;
 } qdec_control_block_t;
 
 static qdec_control_block_t m_cb[NRFX_QDEC_ENABLED_COUNT];
@@ -132,9 +145,11 @@ nrfx_err_t nrfx_qdec_init(nrfx_qdec_t const *        p_instance,
     p_cb->handler = handler;
     p_cb->p_context = p_context;
 
+    p_cb->p_stream = NULL;
     if (p_config)
     {
         p_cb->skip_gpio_cfg = p_config->skip_gpio_cfg;
+        p_cb->reportper_inten = p_config->reportper_inten;
         qdec_configure(p_instance, p_config);
     }
 
@@ -159,6 +174,7 @@ nrfx_err_t nrfx_qdec_reconfigure(nrfx_qdec_t const *        p_instance,
     {
         return NRFX_ERROR_BUSY;
     }
+    p_cb->reportper_inten = p_config->reportper_inten;
     qdec_configure(p_instance, p_config);
     nrfy_qdec_enable(p_instance->p_reg);
     return NRFX_SUCCESS;
@@ -172,6 +188,10 @@ void nrfx_qdec_uninit(nrfx_qdec_t const * p_instance)
 
     NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
 
+    if (p_cb->p_stream)
+    {
+        nrfx_qdec_stream_stop(p_instance);
+    }
     nrfy_qdec_disable(p_instance->p_reg);
     nrfy_qdec_int_uninit(p_instance->p_reg);
 
@@ -214,6 +234,10 @@ void nrfx_qdec_disable(nrfx_qdec_t const * p_instance)
     qdec_control_block_t * const p_cb = &m_cb[p_instance->drv_inst_idx];
 
     NRFX_ASSERT(p_cb->state == NRFX_DRV_STATE_POWERED_ON);
+    if (p_cb->p_stream)
+    {
+        nrfx_qdec_stream_stop(p_instance);
+    }
     nrfy_qdec_task_trigger(p_instance->p_reg, NRF_QDEC_TASK_STOP);
     nrfy_qdec_disable(p_instance->p_reg);
     p_cb->state = NRFX_DRV_STATE_INITIALIZED;
@@ -238,6 +262,142 @@ void nrfx_qdec_accumulators_read(nrfx_qdec_t const * p_instance,
     NRFX_LOG_HEXDUMP_DEBUG((uint8_t *)p_accdbl, sizeof(p_accdbl[0]));
 }
 
+static uint32_t stream_capture_task_address_get(qdec_control_block_t const * p_cb)
+{
+    return nrf_timer_task_address_get(p_cb->p_timer,
+                                      nrf_timer_capture_task_get(p_cb->cc_channel));
+}
+
+nrfx_err_t nrfx_qdec_stream_start(nrfx_qdec_t const *               p_instance,
+                                  nrfx_qdec_stream_config_t const * p_config)
+{
+    NRFX_ASSERT(p_instance);
+    NRFX_ASSERT(p_config);
+    NRFX_ASSERT(p_config->p_buffer);
+    NRFX_ASSERT(p_config->size >= 2);
+    NRFX_ASSERT(p_config->p_timer);
+
+    qdec_control_block_t * const p_cb = &m_cb[p_instance->drv_inst_idx];
+    nrfx_err_t err_code;
+
+    if ((p_cb->state != NRFX_DRV_STATE_POWERED_ON) || p_cb->p_stream)
+    {
+        err_code = NRFX_ERROR_INVALID_STATE;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    err_code = nrfx_gppi_channel_alloc(&p_cb->ppi_channel);
+    if (err_code != NRFX_SUCCESS)
+    {
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    p_cb->stream_size    = p_config->size;
+    p_cb->stream_wr      = 0;
+    p_cb->stream_rd      = 0;
+    p_cb->stream_overrun = 0;
+    p_cb->p_timer        = p_config->p_timer;
+    p_cb->cc_channel     = p_config->cc_channel;
+    p_cb->p_stream       = p_config->p_buffer;
+
+    nrfx_gppi_channel_endpoints_setup(p_cb->ppi_channel,
+        nrfy_qdec_event_address_get(p_instance->p_reg, NRF_QDEC_EVENT_REPORTRDY),
+        stream_capture_task_address_get(p_cb));
+    nrfx_gppi_channels_enable(NRFX_BIT(p_cb->ppi_channel));
+
+    nrfy_qdec_shorts_enable(p_instance->p_reg, NRF_QDEC_SHORT_REPORTRDY_READCLRACC_MASK);
+    nrfy_qdec_int_enable(p_instance->p_reg, NRF_QDEC_INT_REPORTRDY_MASK);
+
+    NRFX_LOG_INFO("Function: %s, error code: %s.", __func__, NRFX_LOG_ERROR_STRING_GET(err_code));
+    return err_code;
+}
+
+void nrfx_qdec_stream_stop(nrfx_qdec_t const * p_instance)
+{
+    NRFX_ASSERT(p_instance);
+
+    qdec_control_block_t * const p_cb = &m_cb[p_instance->drv_inst_idx];
+
+    NRFX_ASSERT(p_cb->p_stream);
+
+    if (!p_cb->reportper_inten)
+    {
+        nrfy_qdec_int_disable(p_instance->p_reg, NRF_QDEC_INT_REPORTRDY_MASK);
+        nrfy_qdec_shorts_disable(p_instance->p_reg, NRF_QDEC_SHORT_REPORTRDY_READCLRACC_MASK);
+    }
+
+    nrfx_gppi_channels_disable(NRFX_BIT(p_cb->ppi_channel));
+    nrfx_gppi_channel_endpoints_clear(p_cb->ppi_channel,
+        nrfy_qdec_event_address_get(p_instance->p_reg, NRF_QDEC_EVENT_REPORTRDY),
+        stream_capture_task_address_get(p_cb));
+    (void)nrfx_gppi_channel_free(p_cb->ppi_channel);
+
+    p_cb->p_stream = NULL;
+    NRFX_LOG_INFO("Stream stopped.");
+}
+
+size_t nrfx_qdec_stream_read(nrfx_qdec_t const *         p_instance,
+                             nrfx_qdec_stream_report_t * p_reports,
+                             size_t                      count)
+{
+    NRFX_ASSERT(p_instance);
+    NRFX_ASSERT(p_reports);
+
+    qdec_control_block_t * const p_cb = &m_cb[p_instance->drv_inst_idx];
+    size_t rd = p_cb->stream_rd;
+    size_t wr = p_cb->stream_wr;
+    size_t n  = 0;
+
+    NRFX_ASSERT(p_cb->p_stream);
+
+    // The interrupt only moves the write index, so the read side needs no locking.
+    while ((rd != wr) && (n < count))
+    {
+        p_reports[n++] = p_cb->p_stream[rd];
+        rd = (rd + 1 == p_cb->stream_size) ? 0 : (rd + 1);
+    }
+    p_cb->stream_rd = rd;
+    return n;
+}
+
+uint32_t nrfx_qdec_stream_overrun_get(nrfx_qdec_t const * p_instance)
+{
+    NRFX_ASSERT(p_instance);
+
+    qdec_control_block_t * const p_cb = &m_cb[p_instance->drv_inst_idx];
+    uint32_t overrun;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    overrun = p_cb->stream_overrun;
+    p_cb->stream_overrun = 0;
+    NRFX_CRITICAL_SECTION_EXIT();
+    return overrun;
+}
+
+static void stream_report_store(NRF_QDEC_Type * p_qdec, qdec_control_block_t * p_cb)
+{
+    size_t wr   = p_cb->stream_wr;
+    size_t next = (wr + 1 == p_cb->stream_size) ? 0 : (wr + 1);
+
+    if (next == p_cb->stream_rd)
+    {
+        p_cb->stream_overrun++;
+        return;
+    }
+
+    nrfx_qdec_stream_report_t * p_report = &p_cb->p_stream[wr];
+    nrfy_qdec_accumulators_read(p_qdec, &p_report->acc, &p_report->accdbl);
+    p_report->timestamp = nrf_timer_cc_get(p_cb->p_timer,
+                                           (nrf_timer_cc_channel_t)p_cb->cc_channel);
+    p_cb->stream_wr = next;
+}
+
 static void irq_handler(NRF_QDEC_Type * p_qdec, qdec_control_block_t * p_cb)
 {
     uint32_t evt_to_process;
@@ -263,9 +423,18 @@ static void irq_handler(NRF_QDEC_Type * p_qdec, qdec_control_block_t * p_cb)
     {
         NRFX_LOG_DEBUG("Event: %s.", EVT_TO_STR(NRF_QDEC_EVENT_REPORTRDY));
 
-        event.type = NRF_QDEC_EVENT_REPORTRDY;
-        nrfy_qdec_accumulators_read(p_qdec, &event.data.report.acc, &event.data.report.accdbl);
-        p_cb->handler(event, p_cb->p_context);
+        if (p_cb->p_stream)
+        {
+            stream_report_store(p_qdec, p_cb);
+        }
+        else
+        {
+            event.type = NRF_QDEC_EVENT_REPORTRDY;
+            nrfy_qdec_accumulators_read(p_qdec,
+                                        &event.data.report.acc,
+                                        &event.data.report.accdbl);
+            p_cb->handler(event, p_cb->p_context);
+        }
     }
 
     if (evt_mask & NRFY_EVENT_TO_INT_BITMASK(NRF_QDEC_EVENT_ACCOF))
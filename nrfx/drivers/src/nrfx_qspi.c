@@ -39,6 +39,10 @@
 #include <hal/nrf_gpio.h>
 #include <nrf_erratas.h>
 
+#if NRFX_CHECK(NRFX_QSPI_CONFIG_XIP_CACHE_ENABLED) && !NRFX_CHECK(NRFX_CACHE_ENABLED)
+#error "NRFX_QSPI_CONFIG_XIP_CACHE_ENABLED requires NRFX_CACHE_ENABLED."
+#endif
+
 /** @brief Command byte used to read status register. */
 #define QSPI_STD_CMD_RDSR 0x05
 
@@ -59,6 +63,15 @@
  */
 #define QSPI_DEF_WAIT_ATTEMPTS 50000
 
+#if NRFX_CHECK(NRFX_QSPI_CONFIG_SUSPEND_ENABLED)
+/**
+ * @brief Number of memory status checks performed while waiting for an operation to be suspended.
+ *
+ * Memory devices typically need from 20 to 100 us to suspend an erase operation.
+ */
+#define QSPI_SUSPEND_WAIT_ATTEMPTS 100
+#endif
+
 /**
  * @brief Macro for initializing a QSPI pin.
  *
@@ -71,6 +84,23 @@
                                          NRF_GPIO_PIN_H0H1,             \
                                          NRF_GPIO_PIN_NOSENSE)
 
+#if (NRFX_QSPI_CONFIG_READ_AHEAD_SIZE > 0)
+#if (NRFX_QSPI_CONFIG_QUEUE_SIZE == 0)
+#error "NRFX_QSPI_CONFIG_READ_AHEAD_SIZE requires NRFX_QSPI_CONFIG_QUEUE_SIZE to be non-zero."
+#endif
+#if (NRFX_QSPI_CONFIG_READ_AHEAD_SIZE % 4) != 0
+#error "NRFX_QSPI_CONFIG_READ_AHEAD_SIZE must be a multiple of 4."
+#endif
+#include <string.h>
+#endif
+
+#if (NRFX_QSPI_CONFIG_READ_CACHE_LINES > 0)
+#if (NRFX_QSPI_CONFIG_READ_CACHE_LINE_SIZE == 0) || (NRFX_QSPI_CONFIG_READ_CACHE_LINE_SIZE % 4) != 0
+#error "NRFX_QSPI_CONFIG_READ_CACHE_LINE_SIZE must be a non-zero multiple of 4."
+#endif
+#include <string.h>
+#endif
+
 #if !defined(USE_WORKAROUND_FOR_ANOMALY_121) && defined(NRF53_SERIES)
     // ANOMALY 121 - Configuration of QSPI peripheral requires additional steps.
     #define USE_WORKAROUND_FOR_ANOMALY_121 1
@@ -87,6 +117,19 @@ typedef enum
     NRFX_QSPI_STATE_CINSTR,
 } nrfx_qspi_state_t;
 
+#if (NRFX_QSPI_CONFIG_READ_CACHE_LINES > 0)
+/** @brief Read cache in front of blocking reads. */
+typedef struct
+{
+    /** Content of the lines. */
+    uint32_t lines[NRFX_QSPI_CONFIG_READ_CACHE_LINES]
+                  [NRFX_QSPI_CONFIG_READ_CACHE_LINE_SIZE / sizeof(uint32_t)];
+    uint32_t addr[NRFX_QSPI_CONFIG_READ_CACHE_LINES];     /**< Memory addresses of lines. */
+    uint32_t last_use[NRFX_QSPI_CONFIG_READ_CACHE_LINES]; /**< Last use of lines, 0 if unused. */
+    uint32_t use_count;                                   /**< Number of line uses. */
+} qspi_read_cache_t;
+#endif
+
 /** @brief Control block - driver instance local data. */
 typedef struct
 {
@@ -101,10 +144,43 @@ typedef struct
     nrfx_qspi_evt_ext_t evt_ext;            /**< Extended event. */
     nrfx_qspi_state_t   state;              /**< Driver state. */
     bool                skip_gpio_cfg;      /**< Do not touch GPIO configuration of used pins. */
+#if (NRFX_QSPI_CONFIG_QUEUE_SIZE > 0)
+    nrfx_qspi_req_t     queue[NRFX_QSPI_CONFIG_QUEUE_SIZE]; /**< Queued requests. */
+    uint8_t             queue_head;         /**< Index of the oldest queued request. */
+    uint8_t             queue_count;        /**< Number of queued requests. */
+    bool                queue_active;       /**< Queued request or read-ahead is being executed. */
+#endif
+#if (NRFX_QSPI_CONFIG_READ_AHEAD_SIZE > 0)
+    /** Read-ahead cache. */
+    uint32_t            cache[NRFX_QSPI_CONFIG_READ_AHEAD_SIZE / sizeof(uint32_t)];
+    uint32_t            cache_addr;         /**< Memory address of the cache content. */
+    uint32_t            read_ahead_addr;    /**< Address following the last read request. */
+    bool                cache_valid;        /**< Cache content is valid. */
+    bool                cache_filling;      /**< Read-ahead into the cache is being executed. */
+    bool                read_ahead;         /**< Read-ahead is pending until the queue is empty. */
+#endif
+#if (NRFX_QSPI_CONFIG_READ_CACHE_LINES > 0)
+    qspi_read_cache_t   read_cache;         /**< Read cache. */
+#endif
+#if NRFX_CHECK(NRFX_QSPI_CONFIG_STREAM_ENABLED)
+    nrfx_qspi_stream_config_t stream;       /**< Configuration of the stream. */
+    size_t              stream_offset;      /**< Offset of the ongoing chunk in the region. */
+    uint8_t             stream_buf_idx;     /**< Buffer used by the ongoing chunk. */
+    bool                stream_active;      /**< Stream is being executed. */
+    bool                stream_stop;        /**< No further chunks are started. */
+#endif
 } qspi_control_block_t;
 
 static qspi_control_block_t m_cb;
 
+static void qspi_read_cache_clear(void)
+{
+#if (NRFX_QSPI_CONFIG_READ_CACHE_LINES > 0)
+    memset(m_cb.read_cache.last_use, 0, sizeof(m_cb.read_cache.last_use));
+    m_cb.read_cache.use_count = 0;
+#endif
+}
+
 static nrfx_err_t qspi_xfer(void *            p_buffer,
                             size_t            length,
                             uint32_t          address,
@@ -124,6 +200,20 @@ static nrfx_err_t qspi_xfer(void *            p_buffer,
         return NRFX_ERROR_BUSY;
     }
 
+#if (NRFX_QSPI_CONFIG_QUEUE_SIZE > 0)
+    if (m_cb.queue_active)
+    {
+        return NRFX_ERROR_BUSY;
+    }
+#endif
+    if (desired_state == NRFX_QSPI_STATE_WRITE)
+    {
+#if (NRFX_QSPI_CONFIG_READ_AHEAD_SIZE > 0)
+        m_cb.cache_valid = false;
+#endif
+        qspi_read_cache_clear();
+    }
+
     bool is_first_buffer = false;
     if (m_cb.handler)
     {
@@ -460,6 +550,84 @@ nrfx_err_t nrfx_qspi_cinstr_quick_send(uint8_t               opcode,
     return nrfx_qspi_cinstr_xfer(&config, p_tx_buffer, NULL);
 }
 
+#if NRFX_CHECK(NRFX_QSPI_CONFIG_SUSPEND_ENABLED)
+static bool qspi_mem_idle_check(void)
+{
+    return (nrfx_qspi_mem_busy_check() == NRFX_SUCCESS);
+}
+
+nrfx_err_t nrfx_qspi_read_urgent(void *   p_rx_buffer,
+                                 size_t   rx_buffer_length,
+                                 uint32_t src_address)
+{
+    NRFX_ASSERT(m_cb.state != NRFX_QSPI_STATE_UNINITIALIZED);
+    NRFX_ASSERT(p_rx_buffer != NULL);
+
+    if (!nrfx_is_in_ram(p_rx_buffer) || !nrfx_is_word_aligned(p_rx_buffer))
+    {
+        return NRFX_ERROR_INVALID_ADDR;
+    }
+
+    if (m_cb.state != NRFX_QSPI_STATE_IDLE)
+    {
+        return NRFX_ERROR_BUSY;
+    }
+
+#if (NRFX_QSPI_CONFIG_QUEUE_SIZE > 0)
+    if (m_cb.queue_active)
+    {
+        return NRFX_ERROR_BUSY;
+    }
+#endif
+
+    nrfx_err_t err_code = nrfx_qspi_mem_busy_check();
+    bool       suspended = false;
+    if (err_code == NRFX_ERROR_BUSY)
+    {
+        err_code = nrfx_qspi_cinstr_quick_send(NRFX_QSPI_CONFIG_SUSPEND_OPCODE,
+                                               NRF_QSPI_CINSTR_LEN_1B,
+                                               NULL);
+        if (err_code != NRFX_SUCCESS)
+        {
+            return err_code;
+        }
+        suspended = true;
+
+        // The memory clears the WIP bit when the operation is suspended.
+        bool idle;
+        NRFX_WAIT_FOR(qspi_mem_idle_check(), QSPI_SUSPEND_WAIT_ATTEMPTS, 1, idle);
+        err_code = idle ? NRFX_SUCCESS : NRFX_ERROR_TIMEOUT;
+    }
+
+    if (err_code == NRFX_SUCCESS)
+    {
+        // The READY interrupt has been disabled by the status check performed above,
+        // so the read can be handled in the blocking way also in the handler mode.
+        m_cb.state = NRFX_QSPI_STATE_READ;
+        nrf_qspi_read_buffer_set(NRF_QSPI, p_rx_buffer, rx_buffer_length, src_address);
+        nrf_qspi_event_clear(NRF_QSPI, NRF_QSPI_EVENT_READY);
+        nrf_qspi_task_trigger(NRF_QSPI, NRF_QSPI_TASK_READSTART);
+        err_code = qspi_ready_wait();
+        nrf_qspi_event_clear(NRF_QSPI, NRF_QSPI_EVENT_READY);
+        m_cb.state = NRFX_QSPI_STATE_IDLE;
+    }
+
+    if (suspended)
+    {
+        // Resume also after a timeout, as the memory may have suspended the operation late.
+        nrfx_err_t resume_err = nrfx_qspi_cinstr_quick_send(NRFX_QSPI_CONFIG_RESUME_OPCODE,
+                                                            NRF_QSPI_CINSTR_LEN_1B,
+                                                            NULL);
+        if (err_code == NRFX_SUCCESS)
+        {
+            err_code = resume_err;
+        }
+    }
+
+    return err_code;
+}
+#endif
+
 nrfx_err_t nrfx_qspi_lfm_start(nrf_qspi_cinstr_conf_t const * p_config)
 {
     NRFX_ASSERT(m_cb.state != NRFX_QSPI_STATE_UNINITIALIZED);
@@ -623,6 +791,19 @@ void nrfx_qspi_uninit(void)
         qspi_pins_deconfigure();
     }
 
+#if (NRFX_QSPI_CONFIG_QUEUE_SIZE > 0)
+    m_cb.queue_count  = 0;
+    m_cb.queue_active = false;
+#endif
+#if (NRFX_QSPI_CONFIG_READ_AHEAD_SIZE > 0)
+    m_cb.cache_valid   = false;
+    m_cb.cache_filling = false;
+    m_cb.read_ahead    = false;
+#endif
+    qspi_read_cache_clear();
+#if NRFX_CHECK(NRFX_QSPI_CONFIG_STREAM_ENABLED)
+    m_cb.stream_active = false;
+#endif
     m_cb.state = NRFX_QSPI_STATE_UNINITIALIZED;
 }
 
@@ -633,10 +814,95 @@ nrfx_err_t nrfx_qspi_write(void const * p_tx_buffer,
     return qspi_xfer((void *)p_tx_buffer, tx_buffer_length, dst_address, NRFX_QSPI_STATE_WRITE);
 }
 
+#if (NRFX_QSPI_CONFIG_READ_CACHE_LINES > 0)
+static nrfx_err_t qspi_read_cache_line_get(uint32_t line_addr, uint8_t const ** pp_line)
+{
+    qspi_read_cache_t * p_cache = &m_cb.read_cache;
+    size_t              victim  = 0;
+
+    for (size_t i = 0; i < NRFX_QSPI_CONFIG_READ_CACHE_LINES; i++)
+    {
+        if (p_cache->last_use[i] && (p_cache->addr[i] == line_addr))
+        {
+            p_cache->last_use[i] = ++p_cache->use_count;
+            *pp_line = (uint8_t const *)p_cache->lines[i];
+            return NRFX_SUCCESS;
+        }
+        // Invalid lines have the lowest use value, so they are replaced first.
+        if (p_cache->last_use[i] < p_cache->last_use[victim])
+        {
+            victim = i;
+        }
+    }
+
+    p_cache->last_use[victim] = 0;
+    nrfx_err_t err_code = qspi_xfer(p_cache->lines[victim],
+                                    NRFX_QSPI_CONFIG_READ_CACHE_LINE_SIZE,
+                                    line_addr,
+                                    NRFX_QSPI_STATE_READ);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    p_cache->addr[victim]     = line_addr;
+    p_cache->last_use[victim] = ++p_cache->use_count;
+    *pp_line = (uint8_t const *)p_cache->lines[victim];
+    return NRFX_SUCCESS;
+}
+
+static nrfx_err_t qspi_cached_read(uint8_t * p_buffer, size_t length, uint32_t address)
+{
+    NRFX_ASSERT(m_cb.state != NRFX_QSPI_STATE_UNINITIALIZED);
+    NRFX_ASSERT(p_buffer != NULL);
+
+    // Long reads would only evict the small records the cache is meant for.
+    if ((length > NRFX_QSPI_CONFIG_READ_CACHE_LINE_SIZE) && ((length % 4) == 0) &&
+        nrfx_is_word_aligned((void const *)address) &&
+        nrfx_is_in_ram(p_buffer) && nrfx_is_word_aligned(p_buffer))
+    {
+        return qspi_xfer(p_buffer, length, address, NRFX_QSPI_STATE_READ);
+    }
+
+    while (length > 0)
+    {
+        uint32_t        offset = address % NRFX_QSPI_CONFIG_READ_CACHE_LINE_SIZE;
+        size_t          chunk  = NRFX_MIN(length, NRFX_QSPI_CONFIG_READ_CACHE_LINE_SIZE - offset);
+        uint8_t const * p_line;
+
+        nrfx_err_t err_code = qspi_read_cache_line_get(address - offset, &p_line);
+        if (err_code != NRFX_SUCCESS)
+        {
+            return err_code;
+        }
+
+        memcpy(p_buffer, p_line + offset, chunk);
+        p_buffer += chunk;
+        address  += chunk;
+        length   -= chunk;
+    }
+
+    return NRFX_SUCCESS;
+}
+
+void nrfx_qspi_read_cache_invalidate(void)
+{
+    NRFX_ASSERT(m_cb.state != NRFX_QSPI_STATE_UNINITIALIZED);
+
+    qspi_read_cache_clear();
+}
+#endif
+
 nrfx_err_t nrfx_qspi_read(void *   p_rx_buffer,
                           size_t   rx_buffer_length,
                           uint32_t src_address)
 {
+#if (NRFX_QSPI_CONFIG_READ_CACHE_LINES > 0)
+    if (!m_cb.handler)
+    {
+        return qspi_cached_read((uint8_t *)p_rx_buffer, rx_buffer_length, src_address);
+    }
+#endif
     return qspi_xfer((void *)p_rx_buffer, rx_buffer_length, src_address, NRFX_QSPI_STATE_READ);
 }
 
@@ -655,6 +921,10 @@ nrfx_err_t nrfx_qspi_erase(nrf_qspi_erase_len_t length,
         return NRFX_ERROR_BUSY;
     }
     m_cb.state = NRFX_QSPI_STATE_ERASE;
+#if (NRFX_QSPI_CONFIG_READ_AHEAD_SIZE > 0)
+    m_cb.cache_valid = false;
+#endif
+    qspi_read_cache_clear();
 
     nrf_qspi_erase_ptr_set(NRF_QSPI, start_address, length);
     nrf_qspi_event_clear(NRF_QSPI, NRF_QSPI_EVENT_READY);
@@ -734,11 +1004,46 @@ nrfx_err_t nrfx_qspi_dma_encrypt(nrf_qspi_encryption_t const * p_config)
     {
         nrf_qspi_dma_encryption_set(NRF_QSPI, false);
     }
+    qspi_read_cache_clear();
 
     return NRFX_SUCCESS;
 }
 #endif
 
+#if NRFX_CHECK(NRFX_QSPI_CONFIG_XIP_CACHE_ENABLED)
+void nrfx_qspi_xip_profiling_start(void)
+{
+    nrfx_cache_profiling_start();
+}
+
+uint32_t nrfx_qspi_xip_profiling_stop(nrfx_cache_profile_t * p_profile)
+{
+    nrfx_cache_profiling_stop();
+    if (p_profile)
+    {
+        nrfx_cache_profile_get(NRF_CACHE_REGION_XIP, p_profile);
+    }
+    return nrfx_cache_hit_rate_get(NRF_CACHE_REGION_XIP);
+}
+
+nrfx_err_t nrfx_qspi_xip_prefetch(void const * p_xip_addr, size_t size)
+{
+    if (m_cb.state == NRFX_QSPI_STATE_UNINITIALIZED)
+    {
+        return NRFX_ERROR_INVALID_STATE;
+    }
+
+    // XIP reads are stalled for the whole duration of an EasyDMA transfer.
+    if (m_cb.state != NRFX_QSPI_STATE_IDLE)
+    {
+        return NRFX_ERROR_BUSY;
+    }
+
+    nrfx_cache_range_lock(p_xip_addr, size);
+    return NRFX_SUCCESS;
+}
+#endif
+
 static void qspi_event_xfer_handle(nrfx_qspi_evt_ext_xfer_t * p_xfer)
 {
     p_xfer->p_buffer = (uint8_t *)m_cb.p_buffer_primary;
@@ -788,13 +1093,385 @@ static void qspi_extended_event_process(nrfx_qspi_evt_ext_t * p_event)
     }
 }
 
-void nrfx_qspi_irq_handler(void)
+#if (NRFX_QSPI_CONFIG_QUEUE_SIZE > 0)
+nrfx_err_t nrfx_qspi_request_queue(nrfx_qspi_req_t const * p_req)
+{
+    NRFX_ASSERT(m_cb.state != NRFX_QSPI_STATE_UNINITIALIZED);
+    NRFX_ASSERT(p_req);
+
+    if (!m_cb.handler)
+    {
+        return NRFX_ERROR_FORBIDDEN;
+    }
+
+    if (p_req->type == NRFX_QSPI_REQ_ERASE)
+    {
+        if (!nrfx_is_word_aligned((void const *)p_req->addr))
+        {
+            return NRFX_ERROR_INVALID_ADDR;
+        }
+    }
+    else if (!nrfx_is_in_ram(p_req->p_buffer) || !nrfx_is_word_aligned(p_req->p_buffer))
+    {
+        return NRFX_ERROR_INVALID_ADDR;
+    }
+
+    nrfx_err_t err_code = NRFX_SUCCESS;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+
+    nrfx_qspi_req_t * p_tail = NULL;
+    if (m_cb.queue_count > (m_cb.queue_active ? 1 : 0))
+    {
+        // The last request can be modified only if its execution has not started.
+        p_tail = &m_cb.queue[(m_cb.queue_head + m_cb.queue_count - 1) %
+                             NRFX_QSPI_CONFIG_QUEUE_SIZE];
+    }
+
+    if (p_tail && (p_tail->type == NRFX_QSPI_REQ_WRITE) &&
+        (p_req->type == NRFX_QSPI_REQ_WRITE) &&
+        (p_tail->addr + p_tail->size == p_req->addr) &&
+        ((uint8_t *)p_tail->p_buffer + p_tail->size == (uint8_t *)p_req->p_buffer))
+    {
+        p_tail->size += p_req->size;
+    }
+    else if (m_cb.queue_count == NRFX_QSPI_CONFIG_QUEUE_SIZE)
+    {
+        err_code = NRFX_ERROR_NO_MEM;
+    }
+    else
+    {
+        m_cb.queue[(m_cb.queue_head + m_cb.queue_count) % NRFX_QSPI_CONFIG_QUEUE_SIZE] = *p_req;
+        m_cb.queue_count++;
+
+        if (!m_cb.queue_active && (m_cb.state == NRFX_QSPI_STATE_IDLE))
+        {
+            // Requests are started from the interrupt handler, so that cache hits
+            // are reported in the same context as other completed requests.
+            NRFX_IRQ_PENDING_SET(QSPI_IRQn);
+        }
+    }
+
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    return err_code;
+}
+
+#if (NRFX_QSPI_CONFIG_READ_AHEAD_SIZE > 0)
+static bool qspi_cache_hit_check(uint32_t addr, size_t size)
+{
+    return m_cb.cache_valid &&
+           (addr >= m_cb.cache_addr) &&
+           (addr + size <= m_cb.cache_addr + sizeof(m_cb.cache));
+}
+#endif
+
+static void qspi_queue_request_start(nrfx_qspi_req_t const * p_req)
+{
+    nrf_qspi_task_t task;
+
+    switch (p_req->type)
+    {
+        case NRFX_QSPI_REQ_WRITE:
+            m_cb.state = NRFX_QSPI_STATE_WRITE;
+            nrf_qspi_write_buffer_set(NRF_QSPI, p_req->p_buffer, p_req->size, p_req->addr);
+            task = NRF_QSPI_TASK_WRITESTART;
+            break;
+
+        case NRFX_QSPI_REQ_READ:
+            m_cb.state = NRFX_QSPI_STATE_READ;
+            nrf_qspi_read_buffer_set(NRF_QSPI, p_req->p_buffer, p_req->size, p_req->addr);
+            task = NRF_QSPI_TASK_READSTART;
+            break;
+
+        default:
+            m_cb.state = NRFX_QSPI_STATE_ERASE;
+            nrf_qspi_erase_ptr_set(NRF_QSPI, p_req->addr, p_req->erase_len);
+            task = NRF_QSPI_TASK_ERASESTART;
+            break;
+    }
+
+    m_cb.queue_active = true;
+    nrf_qspi_event_clear(NRF_QSPI, NRF_QSPI_EVENT_READY);
+    nrf_qspi_int_enable(NRF_QSPI, NRF_QSPI_INT_READY_MASK);
+    nrf_qspi_task_trigger(NRF_QSPI, task);
+}
+
+static void qspi_queue_request_finish(void)
+{
+    nrfx_qspi_req_t const * p_req = &m_cb.queue[m_cb.queue_head];
+
+    switch (p_req->type)
+    {
+        case NRFX_QSPI_REQ_WRITE:
+            m_cb.evt_ext.type = NRFX_QSPI_EVENT_WRITE_DONE;
+            break;
+
+        case NRFX_QSPI_REQ_READ:
+            m_cb.evt_ext.type = NRFX_QSPI_EVENT_READ_DONE;
+#if (NRFX_QSPI_CONFIG_READ_AHEAD_SIZE > 0)
+            m_cb.read_ahead_addr = p_req->addr + p_req->size;
+            m_cb.read_ahead      = true;
+#endif
+            break;
+
+        default:
+            m_cb.evt_ext.type = NRFX_QSPI_EVENT_ERASE_DONE;
+            m_cb.evt_ext.data.erase.addr = p_req->addr;
+            m_cb.evt_ext.data.erase.len  = p_req->erase_len;
+            break;
+    }
+
+    if (p_req->type != NRFX_QSPI_REQ_ERASE)
+    {
+        m_cb.evt_ext.data.xfer.p_buffer = p_req->p_buffer;
+        m_cb.evt_ext.data.xfer.size     = p_req->size;
+        m_cb.evt_ext.data.xfer.addr     = p_req->addr;
+    }
+
+    m_cb.queue_head = (uint8_t)((m_cb.queue_head + 1) % NRFX_QSPI_CONFIG_QUEUE_SIZE);
+    m_cb.queue_count--;
+
+    m_cb.handler(NRFX_QSPI_EVENT_DONE, m_cb.p_context);
+    m_cb.evt_ext.type = NRFX_QSPI_EVENT_NONE;
+}
+
+static void qspi_queue_process(void)
+{
+    while ((m_cb.queue_count > 0) && !m_cb.queue_active &&
+           (m_cb.state == NRFX_QSPI_STATE_IDLE))
+    {
+        nrfx_qspi_req_t const * p_req = &m_cb.queue[m_cb.queue_head];
+
+#if (NRFX_QSPI_CONFIG_READ_AHEAD_SIZE > 0)
+        if (p_req->type != NRFX_QSPI_REQ_READ)
+        {
+            m_cb.cache_valid = false;
+            m_cb.read_ahead  = false;
+        }
+        else if (qspi_cache_hit_check(p_req->addr, p_req->size))
+        {
+            memcpy(p_req->p_buffer,
+                   (uint8_t const *)m_cb.cache + (p_req->addr - m_cb.cache_addr),
+                   p_req->size);
+            qspi_queue_request_finish();
+            continue;
+        }
+#endif
+        qspi_queue_request_start(p_req);
+        return;
+    }
+
+#if (NRFX_QSPI_CONFIG_READ_AHEAD_SIZE > 0)
+    if ((m_cb.queue_count == 0) && !m_cb.queue_active &&
+        (m_cb.state == NRFX_QSPI_STATE_IDLE) && m_cb.read_ahead)
+    {
+        m_cb.read_ahead = false;
+        // Data already in the cache is not read again until at least half of it is consumed.
+        if (!qspi_cache_hit_check(m_cb.read_ahead_addr, sizeof(m_cb.cache) / 2))
+        {
+            m_cb.cache_addr    = m_cb.read_ahead_addr & ~(sizeof(uint32_t) - 1);
+            m_cb.cache_valid   = false;
+            m_cb.cache_filling = true;
+            m_cb.state         = NRFX_QSPI_STATE_READ;
+            m_cb.queue_active  = true;
+            nrf_qspi_read_buffer_set(NRF_QSPI, m_cb.cache, sizeof(m_cb.cache), m_cb.cache_addr);
+            nrf_qspi_event_clear(NRF_QSPI, NRF_QSPI_EVENT_READY);
+            nrf_qspi_int_enable(NRF_QSPI, NRF_QSPI_INT_READY_MASK);
+            nrf_qspi_task_trigger(NRF_QSPI, NRF_QSPI_TASK_READSTART);
+        }
+    }
+#endif
+}
+
+static void qspi_queue_ready_handle(void)
+{
+    m_cb.queue_active = false;
+    m_cb.state        = NRFX_QSPI_STATE_IDLE;
+
+#if (NRFX_QSPI_CONFIG_READ_AHEAD_SIZE > 0)
+    if (m_cb.cache_filling)
+    {
+        m_cb.cache_filling = false;
+        m_cb.cache_valid   = true;
+        return;
+    }
+#endif
+    qspi_queue_request_finish();
+}
+#endif // (NRFX_QSPI_CONFIG_QUEUE_SIZE > 0)
+
+#if NRFX_CHECK(NRFX_QSPI_CONFIG_STREAM_ENABLED)
+static void qspi_stream_chunk_start(void)
+{
+    nrfx_qspi_stream_config_t const * p_config = &m_cb.stream;
+    nrf_qspi_task_t                   task;
+
+    m_cb.p_buffer_primary = p_config->p_buffers[m_cb.stream_buf_idx];
+    m_cb.size_primary     = (uint32_t)NRFX_MIN(p_config->size - m_cb.stream_offset,
+                                               p_config->chunk_size);
+    m_cb.addr_primary     = p_config->addr + m_cb.stream_offset;
+
+    if (p_config->write)
+    {
+        nrf_qspi_write_buffer_set(NRF_QSPI, m_cb.p_buffer_primary,
+                                  m_cb.size_primary, m_cb.addr_primary);
+        task = NRF_QSPI_TASK_WRITESTART;
+    }
+    else
+    {
+        nrf_qspi_read_buffer_set(NRF_QSPI, m_cb.p_buffer_primary,
+                                 m_cb.size_primary, m_cb.addr_primary);
+        task = NRF_QSPI_TASK_READSTART;
+    }
+
+    nrf_qspi_event_clear(NRF_QSPI, NRF_QSPI_EVENT_READY);
+    nrf_qspi_int_enable(NRF_QSPI, NRF_QSPI_INT_READY_MASK);
+    nrf_qspi_task_trigger(NRF_QSPI, task);
+}
+
+nrfx_err_t nrfx_qspi_stream_start(nrfx_qspi_stream_config_t const * p_config)
+{
+    NRFX_ASSERT(m_cb.state != NRFX_QSPI_STATE_UNINITIALIZED);
+    NRFX_ASSERT(p_config);
+    NRFX_ASSERT(p_config->size > 0);
+    NRFX_ASSERT((p_config->chunk_size > 0) && ((p_config->chunk_size % 4) == 0));
+
+    if (!m_cb.handler)
+    {
+        return NRFX_ERROR_FORBIDDEN;
+    }
+
+    for (size_t i = 0; i < NRFX_ARRAY_SIZE(p_config->p_buffers); i++)
+    {
+        if (!nrfx_is_in_ram(p_config->p_buffers[i]) ||
+            !nrfx_is_word_aligned(p_config->p_buffers[i]))
+        {
+            return NRFX_ERROR_INVALID_ADDR;
+        }
+    }
+
+    if (!nrfx_is_word_aligned((void const *)p_config->addr))
+    {
+        return NRFX_ERROR_INVALID_ADDR;
+    }
+
+    if (m_cb.state != NRFX_QSPI_STATE_IDLE)
+    {
+        return NRFX_ERROR_BUSY;
+    }
+
+#if (NRFX_QSPI_CONFIG_QUEUE_SIZE > 0)
+    if (m_cb.queue_active)
+    {
+        return NRFX_ERROR_BUSY;
+    }
+#endif
+
+    if (p_config->write)
+    {
+#if (NRFX_QSPI_CONFIG_READ_AHEAD_SIZE > 0)
+        m_cb.cache_valid = false;
+#endif
+        qspi_read_cache_clear();
+    }
+
+#if NRF_QSPI_HAS_DMA_ENC
+    if (p_config->p_encryption)
+    {
+        nrf_qspi_dma_encryption_configure(NRF_QSPI, p_config->p_encryption);
+        nrf_qspi_dma_encryption_set(NRF_QSPI, true);
+        qspi_read_cache_clear();
+    }
+#endif
+
+    m_cb.stream         = *p_config;
+    m_cb.stream_offset  = 0;
+    m_cb.stream_buf_idx = 0;
+    m_cb.stream_active  = true;
+    m_cb.stream_stop    = false;
+    m_cb.state          = p_config->write ? NRFX_QSPI_STATE_WRITE : NRFX_QSPI_STATE_READ;
+
+    qspi_stream_chunk_start();
+
+    return NRFX_SUCCESS;
+}
+
+void nrfx_qspi_stream_stop(void)
+{
+    NRFX_ASSERT(m_cb.state != NRFX_QSPI_STATE_UNINITIALIZED);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    if (m_cb.stream_active)
+    {
+        m_cb.stream_stop = true;
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+static void qspi_stream_ready_handle(void)
+{
+    bool report = !m_cb.stream_stop;
+
+    m_cb.evt_ext.type = m_cb.stream.write ? NRFX_QSPI_EVENT_WRITE_DONE :
+                                            NRFX_QSPI_EVENT_READ_DONE;
+    qspi_event_xfer_handle(&m_cb.evt_ext.data.xfer);
+    m_cb.stream_offset += m_cb.evt_ext.data.xfer.size;
+
+    if (!m_cb.stream_stop && (m_cb.stream_offset < m_cb.stream.size))
+    {
+        // The next chunk is transferred while the finished one is processed.
+        m_cb.stream_buf_idx ^= 1;
+        qspi_stream_chunk_start();
+    }
+    else
+    {
+#if NRF_QSPI_HAS_DMA_ENC
+        if (m_cb.stream.p_encryption)
+        {
+            nrf_qspi_dma_encryption_set(NRF_QSPI, false);
+            qspi_read_cache_clear();
+        }
+#endif
+        m_cb.stream_active = false;
+        m_cb.state         = NRFX_QSPI_STATE_IDLE;
+    }
+
+    if (report)
+    {
+        m_cb.handler(NRFX_QSPI_EVENT_DONE, m_cb.p_context);
+    }
+    m_cb.evt_ext.type = NRFX_QSPI_EVENT_NONE;
+}
+#endif // NRFX_CHECK(NRFX_QSPI_CONFIG_STREAM_ENABLED)
+
+static void qspi_irq_handle(void)
 {
     // Catch Event ready interrupts
     if (nrf_qspi_event_check(NRF_QSPI, NRF_QSPI_EVENT_READY))
     {
         nrf_qspi_event_clear(NRF_QSPI, NRF_QSPI_EVENT_READY);
 
+#if NRFX_CHECK(NRFX_QSPI_CONFIG_STREAM_ENABLED)
+        if (m_cb.stream_active)
+        {
+            qspi_stream_ready_handle();
+#if (NRFX_QSPI_CONFIG_QUEUE_SIZE > 0)
+            qspi_queue_process();
+#endif
+            return;
+        }
+#endif
+
+#if (NRFX_QSPI_CONFIG_QUEUE_SIZE > 0)
+        if (m_cb.queue_active)
+        {
+            qspi_queue_ready_handle();
+            qspi_queue_process();
+            return;
+        }
+#endif
+
         qspi_extended_event_process(&m_cb.evt_ext);
         if (!m_cb.p_buffer_primary)
         {
@@ -804,6 +1481,18 @@ void nrfx_qspi_irq_handler(void)
         m_cb.handler(NRFX_QSPI_EVENT_DONE, m_cb.p_context);
         m_cb.evt_ext.type = NRFX_QSPI_EVENT_NONE;
     }
+
+#if (NRFX_QSPI_CONFIG_QUEUE_SIZE > 0)
+    // Requests queued while the driver was idle or busy with another operation.
+    qspi_queue_process();
+#endif
+}
+
+void nrfx_qspi_irq_handler(void)
+{
+    NRFX_IRQ_ENTER(NRF_QSPI);
+    qspi_irq_handle();
+    NRFX_IRQ_EXIT(NRF_QSPI);
 }
 
 #endif // NRFX_CHECK(NRFX_QSPI_ENABLED)
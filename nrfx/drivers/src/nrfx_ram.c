@@ -0,0 +1,377 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_RAM_ENABLED)
+
+#include <nrfx_ram.h>
+#include <string.h>
+
+#if defined(VMC_RAM_POWER_S0POWER_Msk)
+#include <hal/nrf_vmc.h>
+#define RAM_USE_VMC       1
+#define RAM_RETENTION_POS VMC_RAM_POWER_S0RETENTION_Pos
+#else
+#include <hal/nrf_power.h>
+#define RAM_USE_VMC       0
+#define RAM_RETENTION_POS POWER_RAM_POWER_S0RETENTION_Pos
+#endif
+
+/*
+ * Layout of the RAM: RAM_BLOCK_COUNT blocks of RAM_BLOCK_SECTIONS sections of RAM_SECTION_SIZE
+ * bytes each, optionally followed by one block of RAM_LARGE_BLOCK_SECTIONS sections of
+ * RAM_LARGE_SECTION_SIZE bytes each.
+ */
+#if defined(NRF52820_XXAA) || defined(NRF52832_XXAB)
+#define RAM_BASE                 0x20000000UL
+#define RAM_BLOCK_COUNT          4
+#define RAM_BLOCK_SECTIONS       2
+#define RAM_SECTION_SIZE         0x1000UL
+#define RAM_LARGE_BLOCK_SECTIONS 0
+#define RAM_LARGE_SECTION_SIZE   0UL
+#elif defined(NRF52832_XXAA)
+#define RAM_BASE                 0x20000000UL
+#define RAM_BLOCK_COUNT          8
+#define RAM_BLOCK_SECTIONS       2
+#define RAM_SECTION_SIZE         0x1000UL
+#define RAM_LARGE_BLOCK_SECTIONS 0
+#define RAM_LARGE_SECTION_SIZE   0UL
+#elif defined(NRF52833_XXAA)
+#define RAM_BASE                 0x20000000UL
+#define RAM_BLOCK_COUNT          8
+#define RAM_BLOCK_SECTIONS       2
+#define RAM_SECTION_SIZE         0x1000UL
+#define RAM_LARGE_BLOCK_SECTIONS 2
+#define RAM_LARGE_SECTION_SIZE   0x8000UL
+#elif defined(NRF52840_XXAA)
+#define RAM_BASE                 0x20000000UL
+#define RAM_BLOCK_COUNT          8
+#define RAM_BLOCK_SECTIONS       2
+#define RAM_SECTION_SIZE         0x1000UL
+#define RAM_LARGE_BLOCK_SECTIONS 6
+#define RAM_LARGE_SECTION_SIZE   0x8000UL
+#elif defined(NRF5340_XXAA_APPLICATION)
+#define RAM_BASE                 0x20000000UL
+#define RAM_BLOCK_COUNT          8
+#define RAM_BLOCK_SECTIONS       4
+#define RAM_SECTION_SIZE         0x4000UL
+#define RAM_LARGE_BLOCK_SECTIONS 0
+#define RAM_LARGE_SECTION_SIZE   0UL
+#elif defined(NRF5340_XXAA_NETWORK)
+#define RAM_BASE                 0x21000000UL
+#define RAM_BLOCK_COUNT          4
+#define RAM_BLOCK_SECTIONS       4
+#define RAM_SECTION_SIZE         0x1000UL
+#define RAM_LARGE_BLOCK_SECTIONS 0
+#define RAM_LARGE_SECTION_SIZE   0UL
+#elif defined(NRF9160_XXAA) || defined(NRF9120_XXAA)
+#define RAM_BASE                 0x20000000UL
+#define RAM_BLOCK_COUNT          8
+#define RAM_BLOCK_SECTIONS       4
+#define RAM_SECTION_SIZE         0x2000UL
+#define RAM_LARGE_BLOCK_SECTIONS 0
+#define RAM_LARGE_SECTION_SIZE   0UL
+#else
+#error "The RAM layout of the selected SoC is not supported by the RAM power driver."
+#endif
+
+/* Total number of blocks and sections. */
+#define RAM_BLOCKS_TOTAL   (RAM_BLOCK_COUNT + ((RAM_LARGE_BLOCK_SECTIONS != 0) ? 1 : 0))
+#define RAM_SECTIONS_TOTAL ((RAM_BLOCK_COUNT * RAM_BLOCK_SECTIONS) + RAM_LARGE_BLOCK_SECTIONS)
+
+/* Size of the part of the RAM made of the regular blocks. */
+#define RAM_SMALL_SIZE     (RAM_BLOCK_COUNT * RAM_BLOCK_SECTIONS * RAM_SECTION_SIZE)
+#define RAM_SIZE           (RAM_SMALL_SIZE + (RAM_LARGE_BLOCK_SECTIONS * RAM_LARGE_SECTION_SIZE))
+
+/** @brief RAM section. */
+typedef struct
+{
+    uint32_t start;   ///< Start address of the section.
+    uint32_t size;    ///< Size of the section.
+    uint8_t  index;   ///< Index of the section in the whole RAM.
+    uint8_t  block;   ///< Index of the block containing the section.
+    uint8_t  section; ///< Index of the section in the block.
+} ram_section_t;
+
+/** @brief Control block - driver instance local data. */
+typedef struct
+{
+    uint8_t          refs[RAM_SECTIONS_TOTAL]; ///< Number of users of each section.
+    uint32_t         saved[RAM_BLOCKS_TOTAL];  ///< Block configuration saved for sleep exit.
+    bool             sleeping;                 ///< Flag indicating sleep configuration is set.
+    nrfx_drv_state_t state;                    ///< Driver state.
+} ram_control_block_t;
+
+static ram_control_block_t m_cb;
+
+static void section_get(uint32_t addr, ram_section_t * p_section)
+{
+    uint32_t offset = addr - RAM_BASE;
+
+    if (offset < RAM_SMALL_SIZE)
+    {
+        uint32_t index = offset / RAM_SECTION_SIZE;
+
+        p_section->start   = RAM_BASE + (index * RAM_SECTION_SIZE);
+        p_section->size    = RAM_SECTION_SIZE;
+        p_section->index   = (uint8_t)index;
+        p_section->block   = (uint8_t)(index / RAM_BLOCK_SECTIONS);
+        p_section->section = (uint8_t)(index % RAM_BLOCK_SECTIONS);
+    }
+#if RAM_LARGE_BLOCK_SECTIONS != 0
+    else
+    {
+        uint32_t index = (offset - RAM_SMALL_SIZE) / RAM_LARGE_SECTION_SIZE;
+
+        p_section->start   = RAM_BASE + RAM_SMALL_SIZE + (index * RAM_LARGE_SECTION_SIZE);
+        p_section->size    = RAM_LARGE_SECTION_SIZE;
+        p_section->index   = (uint8_t)((RAM_BLOCK_COUNT * RAM_BLOCK_SECTIONS) + index);
+        p_section->block   = RAM_BLOCK_COUNT;
+        p_section->section = (uint8_t)index;
+    }
+#endif
+}
+
+static bool region_is_valid(void const * p_start, size_t size)
+{
+    uint32_t start = (uint32_t)p_start;
+
+    return (size != 0) &&
+           (start >= RAM_BASE) &&
+           ((start - RAM_BASE) < RAM_SIZE) &&
+           (size <= RAM_SIZE - (start - RAM_BASE));
+}
+
+static bool region_refs_update(void const * p_start, size_t size, bool keep)
+{
+    ram_section_t section;
+    uint32_t      addr = (uint32_t)p_start;
+    uint32_t      end  = addr + size;
+
+    if (!keep)
+    {
+        // Verify the whole region first, so that a failed release leaves no trace.
+        for (; addr < end; addr = section.start + section.size)
+        {
+            section_get(addr, &section);
+            if (m_cb.refs[section.index] == 0)
+            {
+                return false;
+            }
+        }
+        addr = (uint32_t)p_start;
+    }
+
+    for (; addr < end; addr = section.start + section.size)
+    {
+        section_get(addr, &section);
+        if (keep)
+        {
+            NRFX_ASSERT(m_cb.refs[section.index] < UINT8_MAX);
+            m_cb.refs[section.index]++;
+        }
+        else
+        {
+            m_cb.refs[section.index]--;
+        }
+    }
+
+    return true;
+}
+
+static uint32_t block_used_mask_get(uint8_t block)
+{
+    uint8_t  first    = (uint8_t)(block * RAM_BLOCK_SECTIONS);
+    uint8_t  sections = RAM_BLOCK_SECTIONS;
+    uint32_t mask     = 0;
+
+    if (block == RAM_BLOCK_COUNT)
+    {
+        sections = RAM_LARGE_BLOCK_SECTIONS;
+    }
+
+    for (uint8_t i = 0; i < sections; i++)
+    {
+        if (m_cb.refs[first + i] != 0)
+        {
+            mask |= NRFX_BIT(i);
+        }
+    }
+
+    return mask;
+}
+
+static uint32_t block_config_get(uint8_t block)
+{
+#if RAM_USE_VMC
+    return nrf_vmc_ram_block_power_mask_get(NRF_VMC, block) |
+           nrf_vmc_ram_block_retention_mask_get(NRF_VMC, block);
+#else
+    return nrf_power_rampower_mask_get(NRF_POWER, block);
+#endif
+}
+
+static void block_config_set(uint8_t block, uint32_t config)
+{
+#if RAM_USE_VMC
+    nrf_vmc_ram_block_config(NRF_VMC, block, config, config);
+#else
+    uint32_t current = nrf_power_rampower_mask_get(NRF_POWER, block);
+
+    // Sections are powered on before the others are powered off.
+    nrf_power_rampower_mask_on(NRF_POWER, block, config & ~current);
+    nrf_power_rampower_mask_off(NRF_POWER, block, current & ~config);
+#endif
+}
+
+nrfx_err_t nrfx_ram_init(nrfx_ram_region_t const * p_used, size_t count)
+{
+    if (m_cb.state != NRFX_DRV_STATE_UNINITIALIZED)
+    {
+        return NRFX_ERROR_ALREADY_INITIALIZED;
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (!region_is_valid(p_used[i].p_start, p_used[i].size))
+        {
+            return NRFX_ERROR_INVALID_PARAM;
+        }
+    }
+
+    memset(m_cb.refs, 0, sizeof(m_cb.refs));
+    for (size_t i = 0; i < count; i++)
+    {
+        (void)region_refs_update(p_used[i].p_start, p_used[i].size, true);
+    }
+
+    m_cb.sleeping = false;
+    m_cb.state    = NRFX_DRV_STATE_INITIALIZED;
+    return NRFX_SUCCESS;
+}
+
+void nrfx_ram_uninit(void)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_INITIALIZED);
+    NRFX_ASSERT(!m_cb.sleeping);
+
+    m_cb.state = NRFX_DRV_STATE_UNINITIALIZED;
+}
+
+nrfx_err_t nrfx_ram_region_keep(void const * p_start, size_t size)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_INITIALIZED);
+
+    if (!region_is_valid(p_start, size))
+    {
+        return NRFX_ERROR_INVALID_PARAM;
+    }
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    (void)region_refs_update(p_start, size, true);
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    return NRFX_SUCCESS;
+}
+
+nrfx_err_t nrfx_ram_region_release(void const * p_start, size_t size)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_INITIALIZED);
+
+    bool released;
+
+    if (!region_is_valid(p_start, size))
+    {
+        return NRFX_ERROR_INVALID_PARAM;
+    }
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    released = region_refs_update(p_start, size, false);
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    return released ? NRFX_SUCCESS : NRFX_ERROR_INVALID_STATE;
+}
+
+size_t nrfx_ram_unused_size_get(void)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_INITIALIZED);
+
+    size_t size = 0;
+
+    for (uint8_t i = 0; i < RAM_SECTIONS_TOTAL; i++)
+    {
+        if (m_cb.refs[i] == 0)
+        {
+            size += (i < RAM_BLOCK_COUNT * RAM_BLOCK_SECTIONS) ? RAM_SECTION_SIZE :
+                                                                 RAM_LARGE_SECTION_SIZE;
+        }
+    }
+
+    return size;
+}
+
+void nrfx_ram_sleep_enter(void)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_INITIALIZED);
+    NRFX_ASSERT(!m_cb.sleeping);
+
+    for (uint8_t block = 0; block < RAM_BLOCKS_TOTAL; block++)
+    {
+        uint32_t used = block_used_mask_get(block);
+
+        m_cb.saved[block] = block_config_get(block);
+        block_config_set(block, used | (used << RAM_RETENTION_POS));
+    }
+
+    m_cb.sleeping = true;
+}
+
+void nrfx_ram_sleep_exit(void)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_INITIALIZED);
+
+    if (!m_cb.sleeping)
+    {
+        return;
+    }
+
+    for (uint8_t block = 0; block < RAM_BLOCKS_TOTAL; block++)
+    {
+        block_config_set(block, m_cb.saved[block]);
+    }
+
+    m_cb.sleeping = false;
+}
+
+#endif // NRFX_CHECK(NRFX_RAM_ENABLED)
@@ -50,10 +50,87 @@ static nrfx_drv_state_t m_rng_state;
  */
 static nrfx_rng_evt_handler_t m_rng_hndl;
 
+#if NRFX_CHECK(NRFX_RNG_CONFIG_POOL_ENABLED)
+/** @brief Entropy pool, a ring buffer filled from the interrupt routine. */
+typedef struct
+{
+    uint8_t *         p_buffer;   ///< Pool memory. NULL if the pool mode is not used.
+    uint16_t          size;       ///< Pool size.
+    uint16_t          threshold;  ///< Fill level below which the pool is refilled.
+    uint16_t          head;       ///< Index of the next byte to be written.
+    uint16_t volatile count;      ///< Number of bytes in the pool.
+    bool     volatile running;    ///< True if the peripheral is generating values.
+} rng_pool_t;
+
+static rng_pool_t m_pool;
+
+static void pool_refill_start(void)
+{
+    m_pool.running = true;
+    nrfx_rng_start();
+}
+
+static void pool_refill_stop(void)
+{
+    nrfx_rng_stop();
+    m_pool.running = false;
+}
+
+static void pool_put(uint8_t value)
+{
+    m_pool.p_buffer[m_pool.head] = value;
+    m_pool.head = (uint16_t)((m_pool.head + 1) % m_pool.size);
+    m_pool.count++;
+    if (m_pool.count == m_pool.size)
+    {
+        pool_refill_stop();
+    }
+}
+
+size_t nrfx_rng_bytes_get(uint8_t * p_data, size_t length)
+{
+    NRFX_ASSERT(m_rng_state == NRFX_DRV_STATE_INITIALIZED);
+    NRFX_ASSERT(m_pool.p_buffer);
+    NRFX_ASSERT(p_data);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    uint16_t count = m_pool.count;
+
+    if (length > count)
+    {
+        length = count;
+    }
+
+    /* The oldest byte is the first one after the newest ones. */
+    uint16_t tail = (uint16_t)((m_pool.head + m_pool.size - count) % m_pool.size);
+
+    for (size_t i = 0; i < length; i++)
+    {
+        p_data[i] = m_pool.p_buffer[tail];
+        tail = (uint16_t)((tail + 1) % m_pool.size);
+    }
+    m_pool.count = (uint16_t)(count - length);
+
+    if (!m_pool.running && (m_pool.count < m_pool.threshold))
+    {
+        pool_refill_start();
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    return length;
+}
+#endif // NRFX_CHECK(NRFX_RNG_CONFIG_POOL_ENABLED)
+
 nrfx_err_t nrfx_rng_init(nrfx_rng_config_t const * p_config, nrfx_rng_evt_handler_t handler)
 {
     NRFX_ASSERT(p_config);
+#if NRFX_CHECK(NRFX_RNG_CONFIG_POOL_ENABLED)
+    NRFX_ASSERT(handler || p_config->p_pool);
+    NRFX_ASSERT(!p_config->p_pool || (p_config->pool_size > 0));
+    NRFX_ASSERT(p_config->pool_threshold <= p_config->pool_size);
+#else
     NRFX_ASSERT(handler);
+#endif
     if (m_rng_state != NRFX_DRV_STATE_UNINITIALIZED)
     {
         return NRFX_ERROR_ALREADY_INITIALIZED;
@@ -61,7 +138,18 @@ nrfx_err_t nrfx_rng_init(nrfx_rng_config_t const * p_config, nrfx_rng_evt_handle
 
     m_rng_hndl = handler;
 
+#if NRFX_CHECK(NRFX_RNG_CONFIG_POOL_ENABLED)
+    m_pool.p_buffer  = p_config->p_pool;
+    m_pool.size      = p_config->pool_size;
+    m_pool.threshold = p_config->pool_threshold;
+    m_pool.head      = 0;
+    m_pool.count     = 0;
+    m_pool.running   = false;
+    /* Values in the pool may be used as keys, so they are always bias corrected. */
+    if (p_config->error_correction || m_pool.p_buffer)
+#else
     if (p_config->error_correction)
+#endif
     {
         nrf_rng_error_correction_enable(NRF_RNG);
     }
@@ -71,6 +159,13 @@ nrfx_err_t nrfx_rng_init(nrfx_rng_config_t const * p_config, nrfx_rng_evt_handle
 
     m_rng_state = NRFX_DRV_STATE_INITIALIZED;
 
+#if NRFX_CHECK(NRFX_RNG_CONFIG_POOL_ENABLED)
+    if (m_pool.p_buffer)
+    {
+        pool_refill_start();
+    }
+#endif
+
     return NRFX_SUCCESS;
 }
 
@@ -96,20 +191,38 @@ void nrfx_rng_uninit(void)
     nrf_rng_int_disable(NRF_RNG, NRF_RNG_INT_VALRDY_MASK);
     nrf_rng_task_trigger(NRF_RNG, NRF_RNG_TASK_STOP);
     NRFX_IRQ_DISABLE(RNG_IRQn);
+#if NRFX_CHECK(NRFX_RNG_CONFIG_POOL_ENABLED)
+    m_pool.p_buffer = NULL;
+    m_pool.running  = false;
+#endif
 
     m_rng_state = NRFX_DRV_STATE_UNINITIALIZED;
     NRFX_LOG_INFO("Uninitialized.");
 }
 
-void nrfx_rng_irq_handler(void)
+static void rng_irq_handle(void)
 {
     nrf_rng_event_clear(NRF_RNG, NRF_RNG_EVENT_VALRDY);
 
     uint8_t rng_value = nrf_rng_random_value_get(NRF_RNG);
 
+#if NRFX_CHECK(NRFX_RNG_CONFIG_POOL_ENABLED)
+    if (m_pool.p_buffer)
+    {
+        pool_put(rng_value);
+        return;
+    }
+#endif
     m_rng_hndl(rng_value);
 
     NRFX_LOG_DEBUG("Event: NRF_RNG_EVENT_VALRDY.");
 }
 
+void nrfx_rng_irq_handler(void)
+{
+    NRFX_IRQ_ENTER(NRF_RNG);
+    rng_irq_handle();
+    NRFX_IRQ_EXIT(NRF_RNG);
+}
+
 #endif // NRFX_CHECK(NRFX_RNG_ENABLED)
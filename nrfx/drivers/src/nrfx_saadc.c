@@ -35,6 +35,13 @@
 #if NRFX_CHECK(NRFX_SAADC_ENABLED)
 #include <nrfx_saadc.h>
 
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_BUFFER_RING_ENABLED) || \
+    NRFX_CHECK(NRFX_SAADC_CONFIG_TIMESTAMP_ENABLED)   || \
+    NRFX_CHECK(NRFX_SAADC_CONFIG_TRIGGER_ENABLED)
+#include <helpers/nrfx_gppi.h>
+#endif
+
+
 #define NRFX_LOG_MODULE SAADC
 #include <nrfx_log.h>
 
@@ -59,6 +66,7 @@ typedef enum
     NRF_SAADC_STATE_IDLE,
     NRF_SAADC_STATE_SIMPLE_MODE,
     NRF_SAADC_STATE_SIMPLE_MODE_SAMPLE,
+    NRF_SAADC_STATE_SIMPLE_MODE_SCAN,
     NRF_SAADC_STATE_ADV_MODE,
     NRF_SAADC_STATE_ADV_MODE_SAMPLE,
     NRF_SAADC_STATE_ADV_MODE_SAMPLE_STARTED,
@@ -84,6 +92,35 @@ typedef struct
     uint8_t                    limits_high_activated;        ///< Bitmask of the activated high limits.
     bool                       start_on_end;                 ///< Flag indicating if the START task is to be triggered on the END event.
     bool                       oversampling_without_burst;   ///< Flag indicating whether oversampling without burst is configured.
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_BUFFER_RING_ENABLED)
+    nrf_saadc_value_t *        p_ring;                       ///< Memory of the ring of buffers, NULL if the ring is not used.
+    uint16_t                   ring_buffer_size;             ///< Number of samples in each buffer of the ring.
+    uint8_t                    ring_count;                   ///< Number of buffers in the ring.
+    uint8_t                    ring_next;                    ///< Index of the buffer of the ring to be latched next.
+    uint8_t                    ring_channel;                 ///< (D)PPI channel triggering START on END.
+    bool                       ring_channel_used;            ///< Flag indicating if the (D)PPI channel is allocated.
+#endif
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_PROCESS_HANDLER_ENABLED)
+    nrfx_saadc_process_handler_t process_handler;            ///< Handler processing filled buffers.
+    void *                       p_process_context;          ///< Context passed to the processing handler.
+#endif
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_TIMESTAMP_ENABLED)
+    NRF_TIMER_Type *           p_timestamp_timer;            ///< TIMER capturing timestamps, NULL if timestamps are disabled.
+    nrf_timer_cc_channel_t     timestamp_cc_channel;         ///< Capture/compare channel of the TIMER.
+    uint8_t                    timestamp_channel;            ///< (D)PPI channel triggering capture on STARTED.
+    uint32_t                   timestamp;                    ///< Timestamp of the primary buffer.
+#endif
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_TRIGGER_ENABLED)
+    uint32_t                   trigger_event;                ///< Address of the event triggering SAMPLE, 0 if the trigger is disabled.
+    uint8_t                    trigger_channel;              ///< (D)PPI channel triggering SAMPLE on the event.
+#endif
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_AUTO_CALIBRATION_ENABLED)
+    int32_t                    calib_temperature;            ///< Temperature of the last automatic calibration.
+    int32_t                    calib_pending_temperature;    ///< Temperature of the postponed automatic calibration.
+    bool                       calib_valid;                  ///< Flag indicating if @p calib_temperature is valid.
+    bool                       calib_pending;                ///< Flag indicating if the automatic calibration is postponed.
+    bool                       calib_finish_pending;         ///< Flag indicating if the FINISHED event is to follow the calibration.
+#endif
 } nrfx_saadc_cb_t;
 
 static nrfx_saadc_cb_t m_cb;
@@ -267,6 +304,11 @@ nrfx_err_t nrfx_saadc_init(uint8_t interrupt_priority)
 
     nrfy_saadc_int_init(NRF_SAADC, mask, interrupt_priority, false);
     m_cb.event_handler = NULL;
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_AUTO_CALIBRATION_ENABLED)
+    m_cb.calib_valid          = false;
+    m_cb.calib_pending        = false;
+    m_cb.calib_finish_pending = false;
+#endif
 
     err_code = NRFX_SUCCESS;
     NRFX_LOG_INFO("Function: %s, error code: %s.", __func__, NRFX_LOG_ERROR_STRING_GET(err_code));
@@ -277,6 +319,12 @@ nrfx_err_t nrfx_saadc_init(uint8_t interrupt_priority)
 void nrfx_saadc_uninit(void)
 {
     nrfx_saadc_abort();
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_TIMESTAMP_ENABLED)
+    nrfx_saadc_timestamp_disable();
+#endif
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_TRIGGER_ENABLED)
+    nrfx_saadc_trigger_disable();
+#endif
 
     nrfy_saadc_int_uninit(NRF_SAADC);
     nrfy_saadc_disable(NRF_SAADC);
@@ -510,6 +558,256 @@ nrfx_err_t nrfx_saadc_buffer_set(nrf_saadc_value_t * p_buffer, uint16_t size)
     return NRFX_SUCCESS;
 }
 
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_BUFFER_RING_ENABLED)
+static nrfy_saadc_buffer_t saadc_ring_buffer_get(uint8_t idx)
+{
+    nrfy_saadc_buffer_t buffer = {.p_buffer = &m_cb.p_ring[idx * m_cb.ring_buffer_size],
+                                  .length   = m_cb.ring_buffer_size};
+    return buffer;
+}
+
+static void saadc_ring_teardown(void)
+{
+    if (m_cb.ring_channel_used)
+    {
+        nrfx_gppi_channels_disable(NRFX_BIT(m_cb.ring_channel));
+        nrfx_gppi_channel_endpoints_clear(m_cb.ring_channel,
+            nrfy_saadc_event_address_get(NRF_SAADC, NRF_SAADC_EVENT_END),
+            nrfy_saadc_task_address_get(NRF_SAADC, NRF_SAADC_TASK_START));
+        (void)nrfx_gppi_channel_free(m_cb.ring_channel);
+        m_cb.ring_channel_used = false;
+    }
+    m_cb.p_ring = NULL;
+}
+
+nrfx_err_t nrfx_saadc_buffer_ring_set(nrf_saadc_value_t * p_buffer, uint16_t size, uint8_t count)
+{
+    NRFX_ASSERT(m_cb.saadc_state != NRF_SAADC_STATE_UNINITIALIZED);
+
+    if ((m_cb.saadc_state != NRF_SAADC_STATE_ADV_MODE) || !m_cb.event_handler)
+    {
+        return NRFX_ERROR_INVALID_STATE;
+    }
+
+    if (m_cb.buffer_primary.p_buffer)
+    {
+        return NRFX_ERROR_ALREADY_INITIALIZED;
+    }
+
+    if (!nrfx_is_in_ram(p_buffer))
+    {
+        return NRFX_ERROR_INVALID_ADDR;
+    }
+
+    if ((size % m_cb.channels_activated_count != 0) ||
+        (size >= (1 << SAADC_EASYDMA_MAXCNT_SIZE))  ||
+        (!size) || (count < 2))
+    {
+        return NRFX_ERROR_INVALID_LENGTH;
+    }
+
+    if (m_cb.start_on_end)
+    {
+        if (nrfx_gppi_channel_alloc(&m_cb.ring_channel) != NRFX_SUCCESS)
+        {
+            return NRFX_ERROR_NO_MEM;
+        }
+        nrfx_gppi_channel_endpoints_setup(m_cb.ring_channel,
+            nrfy_saadc_event_address_get(NRF_SAADC, NRF_SAADC_EVENT_END),
+            nrfy_saadc_task_address_get(NRF_SAADC, NRF_SAADC_TASK_START));
+        nrfx_gppi_channels_enable(NRFX_BIT(m_cb.ring_channel));
+        m_cb.ring_channel_used = true;
+    }
+
+    m_cb.p_ring           = p_buffer;
+    m_cb.ring_buffer_size = size;
+    m_cb.ring_count       = count;
+    m_cb.ring_next        = 2 % count;
+    m_cb.buffer_primary   = saadc_ring_buffer_get(0);
+    m_cb.buffer_secondary = saadc_ring_buffer_get(1);
+
+    return NRFX_SUCCESS;
+}
+#endif // NRFX_CHECK(NRFX_SAADC_CONFIG_BUFFER_RING_ENABLED)
+
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_PROCESS_HANDLER_ENABLED)
+void nrfx_saadc_process_handler_set(nrfx_saadc_process_handler_t handler, void * p_context)
+{
+    NRFX_ASSERT(m_cb.saadc_state != NRF_SAADC_STATE_UNINITIALIZED);
+    NRFX_ASSERT(!saadc_busy_check());
+
+    m_cb.process_handler   = handler;
+    m_cb.p_process_context = p_context;
+}
+#endif
+
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_TIMESTAMP_ENABLED)
+nrfx_err_t nrfx_saadc_timestamp_enable(NRF_TIMER_Type *       p_timer,
+                                       nrf_timer_cc_channel_t cc_channel)
+{
+    NRFX_ASSERT(m_cb.saadc_state != NRF_SAADC_STATE_UNINITIALIZED);
+    NRFX_ASSERT(p_timer);
+
+    if (saadc_busy_check())
+    {
+        return NRFX_ERROR_BUSY;
+    }
+
+    if (m_cb.p_timestamp_timer)
+    {
+        nrfx_saadc_timestamp_disable();
+    }
+
+    if (nrfx_gppi_channel_alloc(&m_cb.timestamp_channel) != NRFX_SUCCESS)
+    {
+        return NRFX_ERROR_NO_MEM;
+    }
+
+    m_cb.p_timestamp_timer    = p_timer;
+    m_cb.timestamp_cc_channel = cc_channel;
+    nrfx_gppi_channel_endpoints_setup(m_cb.timestamp_channel,
+        nrfy_saadc_event_address_get(NRF_SAADC, NRF_SAADC_EVENT_STARTED),
+        nrfy_timer_task_address_get(p_timer, nrfy_timer_capture_task_get(cc_channel)));
+    nrfx_gppi_channels_enable(NRFX_BIT(m_cb.timestamp_channel));
+
+    return NRFX_SUCCESS;
+}
+
+void nrfx_saadc_timestamp_disable(void)
+{
+    NRFX_ASSERT(m_cb.saadc_state != NRF_SAADC_STATE_UNINITIALIZED);
+    NRFX_ASSERT(!saadc_busy_check());
+
+    if (!m_cb.p_timestamp_timer)
+    {
+        return;
+    }
+
+    nrfx_gppi_channels_disable(NRFX_BIT(m_cb.timestamp_channel));
+    nrfx_gppi_channel_endpoints_clear(m_cb.timestamp_channel,
+        nrfy_saadc_event_address_get(NRF_SAADC, NRF_SAADC_EVENT_STARTED),
+        nrfy_timer_task_address_get(m_cb.p_timestamp_timer,
+                                    nrfy_timer_capture_task_get(m_cb.timestamp_cc_channel)));
+    (void)nrfx_gppi_channel_free(m_cb.timestamp_channel);
+    m_cb.p_timestamp_timer = NULL;
+}
+#endif // NRFX_CHECK(NRFX_SAADC_CONFIG_TIMESTAMP_ENABLED)
+
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_TRIGGER_ENABLED)
+nrfx_err_t nrfx_saadc_trigger_enable(uint32_t event_address)
+{
+    NRFX_ASSERT(m_cb.saadc_state != NRF_SAADC_STATE_UNINITIALIZED);
+    NRFX_ASSERT(event_address);
+
+    if (saadc_busy_check())
+    {
+        return NRFX_ERROR_BUSY;
+    }
+
+    if (m_cb.trigger_event)
+    {
+        nrfx_saadc_trigger_disable();
+    }
+
+    if (nrfx_gppi_channel_alloc(&m_cb.trigger_channel) != NRFX_SUCCESS)
+    {
+        return NRFX_ERROR_NO_MEM;
+    }
+
+    m_cb.trigger_event = event_address;
+    nrfx_gppi_channel_endpoints_setup(m_cb.trigger_channel,
+        event_address,
+        nrfy_saadc_task_address_get(NRF_SAADC, NRF_SAADC_TASK_SAMPLE));
+    nrfx_gppi_channels_enable(NRFX_BIT(m_cb.trigger_channel));
+
+    return NRFX_SUCCESS;
+}
+
+void nrfx_saadc_trigger_disable(void)
+{
+    NRFX_ASSERT(m_cb.saadc_state != NRF_SAADC_STATE_UNINITIALIZED);
+    NRFX_ASSERT(!saadc_busy_check());
+
+    if (!m_cb.trigger_event)
+    {
+        return;
+    }
+
+    nrfx_gppi_channels_disable(NRFX_BIT(m_cb.trigger_channel));
+    nrfx_gppi_channel_endpoints_clear(m_cb.trigger_channel,
+        m_cb.trigger_event,
+        nrfy_saadc_task_address_get(NRF_SAADC, NRF_SAADC_TASK_SAMPLE));
+    (void)nrfx_gppi_channel_free(m_cb.trigger_channel);
+    m_cb.trigger_event = 0;
+}
+#endif // NRFX_CHECK(NRFX_SAADC_CONFIG_TRIGGER_ENABLED)
+
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_SCAN_ENABLED)
+nrfx_err_t nrfx_saadc_scan_prepare(nrf_saadc_value_t * p_buffer)
+{
+    NRFX_ASSERT(m_cb.saadc_state != NRF_SAADC_STATE_UNINITIALIZED);
+    NRFX_ASSERT(p_buffer);
+
+    if ((m_cb.saadc_state != NRF_SAADC_STATE_SIMPLE_MODE) || m_cb.event_handler)
+    {
+        return NRFX_ERROR_INVALID_STATE;
+    }
+
+    if (!nrfx_is_in_ram(p_buffer))
+    {
+        return NRFX_ERROR_INVALID_ADDR;
+    }
+
+    m_cb.buffer_primary.p_buffer = p_buffer;
+    m_cb.buffer_primary.length   = m_cb.channels_activated_count;
+    m_cb.saadc_state             = NRF_SAADC_STATE_SIMPLE_MODE_SCAN;
+
+    nrfy_saadc_enable(NRF_SAADC);
+    nrfy_saadc_buffer_set(NRF_SAADC, &m_cb.buffer_primary, true, false);
+
+    return NRFX_SUCCESS;
+}
+
+nrfx_err_t nrfx_saadc_scan_read(void)
+{
+    if (m_cb.saadc_state != NRF_SAADC_STATE_SIMPLE_MODE_SCAN)
+    {
+        return NRFX_ERROR_INVALID_STATE;
+    }
+
+    // The buffer was latched at the end of the previous scan, so STARTED is normally already set.
+    uint32_t evt_mask = NRFY_EVENT_TO_INT_BITMASK(NRF_SAADC_EVENT_STARTED);
+    while (!nrfy_saadc_events_process(NRF_SAADC, evt_mask, NULL))
+    {}
+
+    // Single SAMPLE task is enough to obtain one sample on each activated channel.
+    nrfy_saadc_sample_start(NRF_SAADC, &m_cb.buffer_primary);
+
+    // Latch the same buffer for the next scan. No sample is stored until SAMPLE is triggered.
+    nrfy_saadc_buffer_latch(NRF_SAADC, false);
+
+    return NRFX_SUCCESS;
+}
+#endif // NRFX_CHECK(NRFX_SAADC_CONFIG_SCAN_ENABLED)
+
+static bool saadc_sample_by_trigger_check(void)
+{
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_TRIGGER_ENABLED)
+    return m_cb.trigger_event != 0;
+#else
+    return false;
+#endif
+}
+
+static bool saadc_start_on_end_by_ppi_check(void)
+{
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_BUFFER_RING_ENABLED)
+    return m_cb.ring_channel_used;
+#else
+    return false;
+#endif
+}
+
 nrfx_err_t nrfx_saadc_mode_trigger(void)
 {
     NRFX_ASSERT(m_cb.saadc_state != NRF_SAADC_STATE_UNINITIALIZED);
@@ -612,10 +910,35 @@ void nrfx_saadc_abort(void)
     if (m_cb.saadc_state == NRF_SAADC_STATE_CALIBRATION ? m_cb.calib_event_handler :
                                                           m_cb.event_handler)
     {
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_BUFFER_RING_ENABLED)
+        // No more buffers of the ring are latched and START is not triggered on END anymore.
+        m_cb.p_ring = NULL;
+        if (m_cb.ring_channel_used)
+        {
+            nrfx_gppi_channels_disable(NRFX_BIT(m_cb.ring_channel));
+        }
+        if (m_cb.saadc_state == NRF_SAADC_STATE_ADV_MODE)
+        {
+            // Ring was set up, but the conversion was not triggered.
+            saadc_ring_teardown();
+            m_cb.buffer_primary.p_buffer   = NULL;
+            m_cb.buffer_secondary.p_buffer = NULL;
+        }
+#endif
         nrfy_saadc_abort(NRF_SAADC, NULL);
     }
     else
     {
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_SCAN_ENABLED)
+        if (m_cb.saadc_state == NRF_SAADC_STATE_SIMPLE_MODE_SCAN)
+        {
+            nrfy_saadc_stop(NRF_SAADC, true);
+            nrfy_saadc_event_clear(NRF_SAADC, NRF_SAADC_EVENT_STARTED);
+            nrfy_saadc_event_clear(NRF_SAADC, NRF_SAADC_EVENT_END);
+            nrfy_saadc_disable(NRF_SAADC);
+            m_cb.saadc_state = NRF_SAADC_STATE_SIMPLE_MODE;
+        }
+#endif
         m_cb.buffer_primary.p_buffer   = NULL;
         m_cb.buffer_secondary.p_buffer = NULL;
         m_cb.samples_converted         = 0;
@@ -718,6 +1041,43 @@ nrfx_err_t nrfx_saadc_offset_calibrate(nrfx_saadc_event_handler_t calib_event_ha
     return NRFX_SUCCESS;
 }
 
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_AUTO_CALIBRATION_ENABLED)
+static nrfx_err_t saadc_auto_calibration_start(void)
+{
+    nrfx_err_t err_code = nrfx_saadc_offset_calibrate(m_cb.event_handler);
+    if (err_code == NRFX_SUCCESS)
+    {
+        // The temperature is taken as valid right away. If the calibration is aborted,
+        // it is invalidated by the abort procedure.
+        m_cb.calib_pending     = false;
+        m_cb.calib_valid       = true;
+        m_cb.calib_temperature = m_cb.calib_pending_temperature;
+    }
+    return err_code;
+}
+
+nrfx_err_t nrfx_saadc_auto_calibrate(int32_t temperature, uint32_t threshold)
+{
+    NRFX_ASSERT(m_cb.saadc_state != NRF_SAADC_STATE_UNINITIALIZED);
+
+    int32_t change = temperature - m_cb.calib_temperature;
+    if (m_cb.calib_valid && ((uint32_t)(change < 0 ? -change : change) < threshold))
+    {
+        return NRFX_SUCCESS;
+    }
+
+    // If the ongoing conversion finishes in the meantime, the interrupt handler picks up
+    // the postponed calibration, so the flag is set before the state is checked.
+    m_cb.calib_pending_temperature = temperature;
+    m_cb.calib_pending             = true;
+    if (saadc_busy_check())
+    {
+        return NRFX_ERROR_BUSY;
+    }
+    return saadc_auto_calibration_start();
+}
+#endif
+
 static void saadc_pre_calibration_state_restore(void)
 {
     nrf_saadc_disable(NRF_SAADC);
@@ -748,13 +1108,22 @@ static void saadc_event_started_handle(void)
 {
     nrfx_saadc_evt_t evt_data;
 
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_TIMESTAMP_ENABLED)
+    // END of the previous buffer is handled first, so the started buffer is the primary one.
+    if (m_cb.p_timestamp_timer)
+    {
+        m_cb.timestamp = nrfy_timer_cc_get(m_cb.p_timestamp_timer, m_cb.timestamp_cc_channel);
+    }
+#endif
+
     switch (m_cb.saadc_state)
     {
         case NRF_SAADC_STATE_ADV_MODE_SAMPLE:
             evt_data.type = NRFX_SAADC_EVT_READY;
             m_cb.event_handler(&evt_data);
 
-            if (nrfy_saadc_continuous_mode_enable_check(NRF_SAADC))
+            if (nrfy_saadc_continuous_mode_enable_check(NRF_SAADC) &&
+                !saadc_sample_by_trigger_check())
             {
                 // Trigger internal timer
                 nrfy_saadc_sample_start(NRF_SAADC, NULL);
@@ -770,6 +1139,17 @@ static void saadc_event_started_handle(void)
         case NRF_SAADC_STATE_ADV_MODE_SAMPLE_STARTED:
             if (!m_cb.buffer_secondary.p_buffer)
             {
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_BUFFER_RING_ENABLED)
+                if (m_cb.p_ring)
+                {
+                    // Latch the next buffer of the ring right away, so that the whole
+                    // duration of the current buffer is left for the next STARTED event.
+                    m_cb.buffer_secondary = saadc_ring_buffer_get(m_cb.ring_next);
+                    m_cb.ring_next = (uint8_t)((m_cb.ring_next + 1) % m_cb.ring_count);
+                    nrfy_saadc_buffer_set(NRF_SAADC, &m_cb.buffer_secondary, false, false);
+                    break;
+                }
+#endif
                 // Send next buffer request only if it was not provided earlier,
                 // before conversion start or outside of user's callback context.
                 evt_data.type = NRFX_SAADC_EVT_BUF_REQ;
@@ -798,6 +1178,9 @@ static void saadc_event_end_handle(void)
     evt_data.type = NRFX_SAADC_EVT_DONE;
     evt_data.data.done.p_buffer = m_cb.buffer_primary.p_buffer;
     evt_data.data.done.size = m_cb.buffer_primary.length;
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_TIMESTAMP_ENABLED)
+    evt_data.data.done.timestamp = m_cb.timestamp;
+#endif
 
     switch (m_cb.saadc_state)
     {
@@ -812,17 +1195,37 @@ static void saadc_event_end_handle(void)
             break;
 
         case NRF_SAADC_STATE_ADV_MODE_SAMPLE_STARTED:
-            if (m_cb.start_on_end && m_cb.buffer_secondary.p_buffer)
+            if (m_cb.start_on_end && m_cb.buffer_secondary.p_buffer &&
+                !saadc_start_on_end_by_ppi_check())
             {
                 nrfy_saadc_buffer_latch(NRF_SAADC, false);
             }
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_PROCESS_HANDLER_ENABLED)
+            if (m_cb.process_handler)
+            {
+                evt_data.data.done.size = m_cb.process_handler(evt_data.data.done.p_buffer,
+                                                               evt_data.data.done.size,
+                                                               m_cb.p_process_context);
+            }
+#endif
             m_cb.event_handler(&evt_data);
             m_cb.buffer_primary = m_cb.buffer_secondary;
             m_cb.buffer_secondary.p_buffer = NULL;
             if (!m_cb.buffer_primary.p_buffer)
             {
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_BUFFER_RING_ENABLED)
+                saadc_ring_teardown();
+#endif
                 nrfy_saadc_disable(NRF_SAADC);
                 m_cb.saadc_state = NRF_SAADC_STATE_ADV_MODE;
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_AUTO_CALIBRATION_ENABLED)
+                if (m_cb.calib_pending && (saadc_auto_calibration_start() == NRFX_SUCCESS))
+                {
+                    // The FINISHED event is generated once the calibration is done.
+                    m_cb.calib_finish_pending = true;
+                    break;
+                }
+#endif
                 evt_data.type = NRFX_SAADC_EVT_FINISHED;
                 m_cb.event_handler(&evt_data);
             }
@@ -833,6 +1236,14 @@ static void saadc_event_end_handle(void)
             saadc_pre_calibration_state_restore();
             evt_data.type = NRFX_SAADC_EVT_CALIBRATEDONE;
             m_cb.calib_event_handler(&evt_data);
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_AUTO_CALIBRATION_ENABLED)
+            if (m_cb.calib_finish_pending)
+            {
+                m_cb.calib_finish_pending = false;
+                evt_data.type = NRFX_SAADC_EVT_FINISHED;
+                m_cb.event_handler(&evt_data);
+            }
+#endif
             break;
 
         default:
@@ -871,6 +1282,8 @@ static void saadc_event_limits_handle(void)
 
 void nrfx_saadc_irq_handler(void)
 {
+    NRFX_IRQ_ENTER(NRF_SAADC);
+
     uint32_t evt_mask = NRFY_EVENT_TO_INT_BITMASK(NRF_SAADC_EVENT_STARTED) |
                         NRFY_EVENT_TO_INT_BITMASK(NRF_SAADC_EVENT_STOPPED) |
                         NRFY_EVENT_TO_INT_BITMASK(NRF_SAADC_EVENT_END) |
@@ -901,6 +1314,15 @@ void nrfx_saadc_irq_handler(void)
             // and END event will not appear.
             // Calibration procedure was not completed and user handler will not be called.
             saadc_pre_calibration_state_restore();
+#if NRFX_CHECK(NRFX_SAADC_CONFIG_AUTO_CALIBRATION_ENABLED)
+            m_cb.calib_valid = false;
+            if (m_cb.calib_finish_pending)
+            {
+                m_cb.calib_finish_pending = false;
+                nrfx_saadc_evt_t evt_data = {.type = NRFX_SAADC_EVT_FINISHED};
+                m_cb.event_handler(&evt_data);
+            }
+#endif
         }
         /* fall-through to the END event handler */
     }
@@ -919,6 +1341,8 @@ void nrfx_saadc_irq_handler(void)
     {
         saadc_event_limits_handle();
     }
+
+    NRFX_IRQ_EXIT(NRF_SAADC);
 }
 
 #endif // NRFX_CHECK(NRFX_SAADC_ENABLED)
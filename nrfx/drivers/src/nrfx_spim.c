@@ -42,6 +42,11 @@
 #include <nrfx_spim.h>
 #include "prs/nrfx_prs.h"
 
+#if NRFX_CHECK(NRFX_SPIM_CONFIG_STREAM_ENABLED)
+#include <haly/nrfy_timer.h>
+#include <helpers/nrfx_gppi.h>
+#endif
+
 #define NRFX_LOG_MODULE SPIM
 #include <nrfx_log.h>
 
@@ -49,6 +54,14 @@
 #error "Extended options are not available in the SoC currently in use."
 #endif
 
+#if NRFX_CHECK(NRFX_SPIM_CONFIG_DISPLAY_ENABLED) && !NRFX_CHECK(NRFX_SPIM_EXTENDED_ENABLED)
+#error "Display transfers require DCX control, enable NRFX_SPIM_EXTENDED_ENABLED."
+#endif
+
+#if NRFX_CHECK(NRFX_SPIM_CONFIG_STREAM_ENABLED) && !NRFY_SPIM_HAS_ARRAY_LIST
+#error "Streaming requires EasyDMA ArrayList, which is not available in the SoC currently in use."
+#endif
+
 #define _NRFX_NUM_FEATURE_TOKEN(periph, inst, feature) \
     NRFX_CONCAT(NRFX_CONCAT(periph, _, feature, _TOKEN), NRFX_CONCAT(inst, _, feature))
 
@@ -141,6 +154,18 @@ static const uint8_t easydma_support_bits[] __UNUSED =
 #define USE_WORKAROUND_FOR_ANOMALY_195 1
 #endif
 
+#if NRFX_CHECK(NRFX_SPIM_CONFIG_STREAM_ENABLED)
+// Stream state - transfers are started by TIMER through (D)PPI, the CPU is involved per block.
+typedef struct
+{
+    nrfx_spim_stream_config_t config;
+    uint8_t                   block_idx;      // Index of the block being filled.
+    uint8_t                   start_channel;  // (D)PPI from sample TIMER COMPARE0 to SPIM START.
+    uint8_t                   count_channel;  // (D)PPI from SPIM END to the counting TIMER COUNT.
+    bool                      active;
+} spim_stream_t;
+#endif
+
 // Control block - driver instance local data.
 typedef struct
 {
@@ -151,10 +176,34 @@ typedef struct
     volatile bool           transfer_in_progress;
     bool                    skip_gpio_cfg  : 1;
     bool                    ss_active_high;
+    uint8_t                 irq_priority;
     uint32_t                ss_pin;
+#if NRFX_CHECK(NRFX_SPIM_CONFIG_XFER_LIST_ENABLED)
+    nrfx_spim_list_xfer_t const * p_list;                  ///< List being executed, NULL if none.
+    size_t                        list_count;              ///< Number of transfers in the list.
+    size_t                        list_idx;                ///< Index of the ongoing transfer.
+    uint32_t                      list_flags;              ///< Options of the list.
+    uint32_t                      saved_ss_pin;            ///< Slave Select of the instance.
+    bool                          saved_ss_active_high;    ///< Slave Select polarity of the instance.
+#endif
+#if NRFX_CHECK(NRFX_SPIM_CONFIG_DISPLAY_ENABLED)
+    nrfx_spim_display_xfer_t const * p_display;            ///< Segments being sent, NULL if none.
+    size_t                           display_count;        ///< Number of segments.
+    size_t                           display_idx;          ///< Index of the ongoing segment.
+    size_t                           display_offset;       ///< Pixel data already sent.
+    size_t                           display_max_length;   ///< EasyDMA limit of the instance.
+    bool                             display_cmd_sent;     ///< Command of the segment is sent.
+#endif
+#if NRFX_CHECK(NRFX_SPIM_CONFIG_STREAM_ENABLED)
+    spim_stream_t           stream;
+#endif
 } spim_control_block_t;
 static spim_control_block_t m_cb[NRFX_SPIM_ENABLED_COUNT];
 
+/* Index and registers of the instance, resolved at compile time if only one is enabled. */
+#define SPIM_IDX(p_instance) NRFX_INSTANCE_IDX_GET(SPIM, (p_instance)->drv_inst_idx)
+#define SPIM_REG(p_instance) NRFX_INSTANCE_REG_GET(SPIM, (p_instance)->p_reg)
+
 #if NRFX_CHECK(NRFX_SPIM3_NRF52840_ANOMALY_198_WORKAROUND_ENABLED)
 
 // Workaround for nRF52840 anomaly 198: SPIM3 transmit data might be corrupted.
@@ -246,7 +295,7 @@ static void pin_init(uint32_t             pin,
 static void configure_pins(nrfx_spim_t const *        p_instance,
                            nrfx_spim_config_t const * p_config)
 {
-    spim_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    spim_control_block_t * p_cb = &m_cb[SPIM_IDX(p_instance)];
 
     p_cb->ss_active_high = p_config->ss_active_high;
 
@@ -352,8 +401,8 @@ static nrf_spim_frequency_t spim_frequency_bit_decode(uint32_t frequency)
 #elif NRF_SPIM_HAS_PRESCALER
 static bool spim_frequency_valid_check(nrfx_spim_t const * p_instance, uint32_t frequency)
 {
-    uint32_t base_frequency = NRF_SPIM_BASE_FREQUENCY_GET(p_instance->p_reg);
-    uint32_t prescaler = NRF_SPIM_PRESCALER_CALCULATE(p_instance->p_reg, frequency);
+    uint32_t base_frequency = NRF_SPIM_BASE_FREQUENCY_GET(SPIM_REG(p_instance));
+    uint32_t prescaler = NRF_SPIM_PRESCALER_CALCULATE(SPIM_REG(p_instance), frequency);
 
     return (base_frequency % frequency == 0) &&
             NRFX_IS_EVEN(prescaler) &&
@@ -363,7 +412,7 @@ static bool spim_frequency_valid_check(nrfx_spim_t const * p_instance, uint32_t
 
 static uint32_t spim_prescaler_calculate(nrfx_spim_t const * p_instance, uint32_t frequency)
 {
-    return NRF_SPIM_PRESCALER_CALCULATE(p_instance->p_reg, frequency);
+    return NRF_SPIM_PRESCALER_CALCULATE(SPIM_REG(p_instance), frequency);
 }
 #else
     #error "Unable to determine frequency division support type."
@@ -402,7 +451,7 @@ static nrfx_err_t spim_configuration_verify(nrfx_spim_t const *        p_instanc
     // and pin selection are to be skipped (pin numbers may be not specified
     // in such case).
     if (!(p_config->skip_gpio_cfg && p_config->skip_psel_cfg) &&
-        (p_instance->p_reg == NRF_SPIM4) && (p_config->frequency == NRFX_MHZ_TO_HZ(32)))
+        (SPIM_REG(p_instance) == NRF_SPIM4) && (p_config->frequency == NRFX_MHZ_TO_HZ(32)))
     {
         enum {
             SPIM_SCK_DEDICATED  = NRF_GPIO_PIN_MAP(0, 8),
@@ -438,7 +487,7 @@ static nrfx_err_t spim_configuration_verify(nrfx_spim_t const *        p_instanc
 static void spim_configure(nrfx_spim_t const *        p_instance,
                            nrfx_spim_config_t const * p_config)
 {
-    spim_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    spim_control_block_t * p_cb = &m_cb[SPIM_IDX(p_instance)];
 
 #if NRF_SPIM_HAS_FREQUENCY
     nrf_spim_frequency_t frequency = spim_frequency_bit_decode(p_config->frequency);
@@ -496,10 +545,11 @@ static void spim_configure(nrfx_spim_t const *        p_instance,
         .skip_psel_cfg = p_config->skip_psel_cfg
     };
 
-    nrfy_spim_periph_configure(p_instance->p_reg, &nrfy_config);
-    if (m_cb[p_instance->drv_inst_idx].handler)
+    nrfy_spim_periph_configure(SPIM_REG(p_instance), &nrfy_config);
+    p_cb->irq_priority = p_config->irq_priority;
+    if (m_cb[SPIM_IDX(p_instance)].handler)
     {
-        nrfy_spim_int_init(p_instance->p_reg, 0, p_config->irq_priority, false);
+        nrfy_spim_int_init(SPIM_REG(p_instance), 0, p_config->irq_priority, false);
     }
 }
 
@@ -509,7 +559,7 @@ nrfx_err_t nrfx_spim_init(nrfx_spim_t const *        p_instance,
                           void *                     p_context)
 {
     NRFX_ASSERT(p_config);
-    spim_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    spim_control_block_t * p_cb = &m_cb[SPIM_IDX(p_instance)];
     nrfx_err_t err_code;
 
     if (p_cb->state != NRFX_DRV_STATE_UNINITIALIZED)
@@ -525,7 +575,7 @@ nrfx_err_t nrfx_spim_init(nrfx_spim_t const *        p_instance,
     static nrfx_irq_handler_t const irq_handlers[NRFX_SPIM_ENABLED_COUNT] = {
         NRFX_INSTANCE_IRQ_HANDLERS_LIST(SPIM, spim)
     };
-    if (nrfx_prs_acquire(p_instance->p_reg, irq_handlers[p_instance->drv_inst_idx]) != NRFX_SUCCESS)
+    if (nrfx_prs_acquire(SPIM_REG(p_instance), irq_handlers[SPIM_IDX(p_instance)]) != NRFX_SUCCESS)
     {
         err_code = NRFX_ERROR_BUSY;
         NRFX_LOG_WARNING("Function: %s, error code: %s.",
@@ -560,7 +610,7 @@ nrfx_err_t nrfx_spim_reconfigure(nrfx_spim_t const *        p_instance,
                                  nrfx_spim_config_t const * p_config)
 {
     NRFX_ASSERT(p_config);
-    spim_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    spim_control_block_t * p_cb = &m_cb[SPIM_IDX(p_instance)];
 
     if (p_cb->state == NRFX_DRV_STATE_UNINITIALIZED)
     {
@@ -593,18 +643,18 @@ static void spim_pin_uninit(uint32_t pin)
 
 void nrfx_spim_uninit(nrfx_spim_t const * p_instance)
 {
-    spim_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    spim_control_block_t * p_cb = &m_cb[SPIM_IDX(p_instance)];
     NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
 
-    nrfy_spim_int_uninit(p_instance->p_reg);
+    nrfy_spim_int_uninit(SPIM_REG(p_instance));
     if (p_cb->handler)
     {
-        nrfy_spim_int_disable(p_instance->p_reg, NRF_SPIM_ALL_INTS_MASK);
-        spim_abort(p_instance->p_reg, p_cb);
+        nrfy_spim_int_disable(SPIM_REG(p_instance), NRF_SPIM_ALL_INTS_MASK);
+        spim_abort(SPIM_REG(p_instance), p_cb);
     }
 
     nrfy_spim_pins_t pins;
-    nrfy_spim_pins_get(p_instance->p_reg, &pins);
+    nrfy_spim_pins_get(SPIM_REG(p_instance), &pins);
 
     if (!p_cb->skip_gpio_cfg)
     {
@@ -617,7 +667,7 @@ void nrfx_spim_uninit(nrfx_spim_t const * p_instance)
             SPIM_HW_CSN_PRESENT_VALIDATE(p_instance->drv_inst_idx))
         {
             nrfy_spim_ext_pins_t ext_pins;
-            nrfy_spim_ext_pins_get(p_instance->p_reg, &ext_pins);
+            nrfy_spim_ext_pins_get(SPIM_REG(p_instance), &ext_pins);
             spim_pin_uninit(ext_pins.dcx_pin);
             spim_pin_uninit(ext_pins.csn_pin);
         }
@@ -625,19 +675,168 @@ void nrfx_spim_uninit(nrfx_spim_t const * p_instance)
     }
 
 #if NRFX_CHECK(USE_WORKAROUND_FOR_ANOMALY_195)
-    if (p_instance->p_reg == NRF_SPIM3)
+    if (SPIM_REG(p_instance) == NRF_SPIM3)
     {
         *(volatile uint32_t *)0x4002F004 = 1;
     }
 #endif
 
 #if NRFX_CHECK(NRFX_PRS_ENABLED)
-    nrfx_prs_release(p_instance->p_reg);
+    nrfx_prs_release(SPIM_REG(p_instance));
 #endif
 
     p_cb->state = NRFX_DRV_STATE_UNINITIALIZED;
 }
 
+static uint8_t spim_retained_regs_set(nrfx_spim_t const * p_instance, nrfy_reg_desc_t * p_regs)
+{
+    uint8_t count = 0;
+
+    p_regs[count++] = (nrfy_reg_desc_t)NRFY_REG_DESC(NRF_SPIM_Type, PSEL.SCK, 0);
+    p_regs[count++] = (nrfy_reg_desc_t)NRFY_REG_DESC(NRF_SPIM_Type, PSEL.MOSI, 0);
+    p_regs[count++] = (nrfy_reg_desc_t)NRFY_REG_DESC(NRF_SPIM_Type, PSEL.MISO, 0);
+    p_regs[count++] = (nrfy_reg_desc_t)NRFY_REG_DESC(NRF_SPIM_Type, CONFIG, 0);
+    p_regs[count++] = (nrfy_reg_desc_t)NRFY_REG_DESC(NRF_SPIM_Type, ORC, 0);
+#if NRF_SPIM_HAS_FREQUENCY
+    p_regs[count++] = (nrfy_reg_desc_t)NRFY_REG_DESC(NRF_SPIM_Type, FREQUENCY, 0);
+#elif NRF_SPIM_HAS_PRESCALER
+    p_regs[count++] = (nrfy_reg_desc_t)NRFY_REG_DESC(NRF_SPIM_Type, PRESCALER, 0);
+#endif
+#if NRFX_CHECK(NRFX_SPIM_EXTENDED_ENABLED)
+#if NRFY_SPIM_HAS_HW_CSN
+    if (SPIM_HW_CSN_PRESENT_VALIDATE(p_instance->drv_inst_idx))
+    {
+#if defined(SPIM_CSNPOL_CSNPOL0_LOW)
+        p_regs[count++] = (nrfy_reg_desc_t)NRFY_REG_DESC(NRF_SPIM_Type, PSEL.CSN[0], 0);
+#else
+        p_regs[count++] = (nrfy_reg_desc_t)NRFY_REG_DESC(NRF_SPIM_Type, PSEL.CSN, 0);
+#endif
+        p_regs[count++] = (nrfy_reg_desc_t)NRFY_REG_DESC(NRF_SPIM_Type, CSNPOL, 0);
+        p_regs[count++] = (nrfy_reg_desc_t)NRFY_REG_DESC(NRF_SPIM_Type, IFTIMING.CSNDUR, 0);
+#if NRFY_SPIM_HAS_RXDELAY
+        p_regs[count++] = (nrfy_reg_desc_t)NRFY_REG_DESC(NRF_SPIM_Type, IFTIMING.RXDELAY, 0);
+#endif
+    }
+#endif
+#if NRFY_SPIM_HAS_DCX
+    if (SPIM_DCX_PRESENT_VALIDATE(p_instance->drv_inst_idx))
+    {
+#if defined(SPIM_PSEL_DCX_PIN_Msk)
+        p_regs[count++] = (nrfy_reg_desc_t)NRFY_REG_DESC(NRF_SPIM_Type, PSEL.DCX, 0);
+#else
+        p_regs[count++] = (nrfy_reg_desc_t)NRFY_REG_DESC(NRF_SPIM_Type, PSELDCX, 0);
+#endif
+    }
+#endif
+#else
+    (void)p_instance;
+#endif // NRFX_CHECK(NRFX_SPIM_EXTENDED_ENABLED)
+    // ENABLE must be written last.
+    p_regs[count++] = (nrfy_reg_desc_t)NRFY_REG_DESC(NRF_SPIM_Type, ENABLE, 0);
+
+    NRFX_ASSERT(count <= NRFX_SPIM_RETAINED_REGS_MAX);
+    return count;
+}
+
+nrfx_err_t nrfx_spim_suspend(nrfx_spim_t const *    p_instance,
+                             nrfx_spim_retained_t * p_retained)
+{
+    NRFX_ASSERT(p_retained);
+    spim_control_block_t * p_cb = &m_cb[SPIM_IDX(p_instance)];
+    nrfx_err_t err_code;
+
+    if (p_cb->state == NRFX_DRV_STATE_UNINITIALIZED)
+    {
+        err_code = NRFX_ERROR_INVALID_STATE;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+    if (p_cb->transfer_in_progress)
+    {
+        err_code = NRFX_ERROR_BUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    p_retained->reg_count = spim_retained_regs_set(p_instance, p_retained->regs);
+    nrfy_regs_snapshot(SPIM_REG(p_instance), p_retained->regs, p_retained->reg_count);
+
+    p_retained->irq_priority   = p_cb->irq_priority;
+    p_retained->skip_gpio_cfg  = p_cb->skip_gpio_cfg;
+    p_retained->ss_active_high = p_cb->ss_active_high;
+    p_retained->ss_pin         = p_cb->ss_pin;
+    p_retained->handler        = p_cb->handler;
+    p_retained->p_context      = p_cb->p_context;
+
+    nrfy_spim_int_uninit(SPIM_REG(p_instance));
+    nrfy_spim_disable(SPIM_REG(p_instance));
+
+#if NRFX_CHECK(NRFX_PRS_ENABLED)
+    nrfx_prs_release(SPIM_REG(p_instance));
+#endif
+
+    p_cb->state = NRFX_DRV_STATE_UNINITIALIZED;
+
+    err_code = NRFX_SUCCESS;
+    NRFX_LOG_INFO("Function: %s, error code: %s.", __func__, NRFX_LOG_ERROR_STRING_GET(err_code));
+    return err_code;
+}
+
+nrfx_err_t nrfx_spim_resume(nrfx_spim_t const *          p_instance,
+                            nrfx_spim_retained_t const * p_retained)
+{
+    NRFX_ASSERT(p_retained);
+    spim_control_block_t * p_cb = &m_cb[SPIM_IDX(p_instance)];
+    nrfx_err_t err_code;
+
+    if (p_cb->state != NRFX_DRV_STATE_UNINITIALIZED)
+    {
+        err_code = NRFX_ERROR_INVALID_STATE;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+#if NRFX_CHECK(NRFX_PRS_ENABLED)
+    static nrfx_irq_handler_t const irq_handlers[NRFX_SPIM_ENABLED_COUNT] = {
+        NRFX_INSTANCE_IRQ_HANDLERS_LIST(SPIM, spim)
+    };
+    if (nrfx_prs_acquire(SPIM_REG(p_instance), irq_handlers[SPIM_IDX(p_instance)]) != NRFX_SUCCESS)
+    {
+        err_code = NRFX_ERROR_BUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+#endif // NRFX_CHECK(NRFX_PRS_ENABLED)
+
+    p_cb->handler        = p_retained->handler;
+    p_cb->p_context      = p_retained->p_context;
+    p_cb->irq_priority   = p_retained->irq_priority;
+    p_cb->skip_gpio_cfg  = p_retained->skip_gpio_cfg;
+    p_cb->ss_active_high = p_retained->ss_active_high;
+    p_cb->ss_pin         = p_retained->ss_pin;
+
+    nrfy_regs_apply(SPIM_REG(p_instance), p_retained->regs, p_retained->reg_count);
+    if (p_cb->handler)
+    {
+        nrfy_spim_int_init(SPIM_REG(p_instance), 0, p_cb->irq_priority, false);
+    }
+
+    p_cb->transfer_in_progress = false;
+    p_cb->state = NRFX_DRV_STATE_INITIALIZED;
+
+    err_code = NRFX_SUCCESS;
+    NRFX_LOG_INFO("Function: %s, error code: %s.", __func__, NRFX_LOG_ERROR_STRING_GET(err_code));
+    return err_code;
+}
+
 #if NRFX_CHECK(NRFX_SPIM_EXTENDED_ENABLED)
 nrfx_err_t nrfx_spim_xfer_dcx(nrfx_spim_t const *           p_instance,
                               nrfx_spim_xfer_desc_t const * p_xfer_desc,
@@ -647,7 +846,7 @@ nrfx_err_t nrfx_spim_xfer_dcx(nrfx_spim_t const *           p_instance,
     (void)flags;
 
     NRFX_ASSERT(cmd_length <= NRF_SPIM_DCX_CNT_ALL_CMD);
-    nrfy_spim_dcx_cnt_set((NRF_SPIM_Type *)p_instance->p_reg, cmd_length);
+    nrfy_spim_dcx_cnt_set((NRF_SPIM_Type *)SPIM_REG(p_instance), cmd_length);
     return nrfx_spim_xfer(p_instance, p_xfer_desc, 0);
 }
 #endif
@@ -784,7 +983,7 @@ nrfx_err_t nrfx_spim_xfer(nrfx_spim_t const *           p_instance,
                           nrfx_spim_xfer_desc_t const * p_xfer_desc,
                           uint32_t                      flags)
 {
-    spim_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    spim_control_block_t * p_cb = &m_cb[SPIM_IDX(p_instance)];
     NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
     NRFX_ASSERT(p_xfer_desc->p_tx_buffer != NULL || p_xfer_desc->tx_length == 0);
     NRFX_ASSERT(p_xfer_desc->p_rx_buffer != NULL || p_xfer_desc->rx_length == 0);
@@ -828,17 +1027,530 @@ nrfx_err_t nrfx_spim_xfer(nrfx_spim_t const *           p_instance,
 
     set_ss_pin_state(p_cb, true);
 
-    return spim_xfer(p_instance->p_reg, p_cb,  p_xfer_desc, flags);
+    return spim_xfer(SPIM_REG(p_instance), p_cb,  p_xfer_desc, flags);
+}
+
+#if NRFX_CHECK(NRFX_SPIM_CONFIG_XFER_LIST_ENABLED)
+static void spim_list_end(spim_control_block_t * p_cb)
+{
+    set_ss_pin_state(p_cb, false);
+
+    p_cb->ss_pin         = p_cb->saved_ss_pin;
+    p_cb->ss_active_high = p_cb->saved_ss_active_high;
+    p_cb->p_list         = NULL;
+}
+
+static void spim_list_xfer_start(NRF_SPIM_Type * p_spim, spim_control_block_t * p_cb)
+{
+    nrfx_spim_list_xfer_t const * p_xfer = &p_cb->p_list[p_cb->list_idx];
+
+    // The configuration of the peripheral can be changed only when it is disabled.
+    nrfy_spim_disable(p_spim);
+#if NRF_SPIM_HAS_FREQUENCY
+    nrfy_spim_frequency_set(p_spim, spim_frequency_bit_decode(p_xfer->frequency));
+#elif NRF_SPIM_HAS_PRESCALER
+    nrfy_spim_prescaler_set(p_spim, NRF_SPIM_PRESCALER_CALCULATE(p_spim, p_xfer->frequency));
+#endif
+    nrfy_spim_configure(p_spim, p_xfer->mode, p_xfer->bit_order);
+
+    if (!p_cb->skip_gpio_cfg)
+    {
+        // SCK idles at the level of the clock polarity of the selected mode.
+        uint32_t sck_pin = nrfy_spim_sck_pin_get(p_spim);
+
+        if (p_xfer->mode <= NRF_SPIM_MODE_1)
+        {
+            nrfy_gpio_pin_clear(sck_pin);
+        }
+        else
+        {
+            nrfy_gpio_pin_set(sck_pin);
+        }
+    }
+
+    p_cb->ss_pin         = p_xfer->ss_pin;
+    p_cb->ss_active_high = p_xfer->ss_active_high;
+    p_cb->evt.xfer_desc  = p_xfer->xfer_desc;
+
+    set_ss_pin_state(p_cb, true);
+
+    (void)spim_xfer(p_spim, p_cb, &p_xfer->xfer_desc, 0);
+}
+
+// Returns true if the list continues with the next transfer.
+static bool spim_list_xfer_done(NRF_SPIM_Type * p_spim, spim_control_block_t * p_cb)
+{
+    // Slave Select of the finished transfer is deactivated before the next one is activated.
+    set_ss_pin_state(p_cb, false);
+
+    if (++p_cb->list_idx == p_cb->list_count)
+    {
+        spim_list_end(p_cb);
+        return false;
+    }
+
+    nrfx_spim_evt_t evt = p_cb->evt;
+
+    spim_list_xfer_start(p_spim, p_cb);
+
+    if (p_cb->list_flags & NRFX_SPIM_FLAG_LIST_EVT_PER_XFER)
+    {
+        p_cb->handler(&evt, p_cb->p_context);
+    }
+    return true;
+}
+
+nrfx_err_t nrfx_spim_xfer_list(nrfx_spim_t const *           p_instance,
+                               nrfx_spim_list_xfer_t const * p_list,
+                               size_t                        count,
+                               uint32_t                      flags)
+{
+    spim_control_block_t * p_cb = &m_cb[SPIM_IDX(p_instance)];
+    NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
+    NRFX_ASSERT(p_list);
+    NRFX_ASSERT(count > 0);
+    NRFX_ASSERT(!(flags & ~NRFX_SPIM_FLAG_LIST_EVT_PER_XFER));
+
+    nrfx_err_t err_code = NRFX_SUCCESS;
+
+    if (!p_cb->handler)
+    {
+        err_code = NRFX_ERROR_FORBIDDEN;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        nrfx_spim_xfer_desc_t const * p_desc = &p_list[i].xfer_desc;
+
+        NRFX_ASSERT(p_desc->p_tx_buffer != NULL || p_desc->tx_length == 0);
+        NRFX_ASSERT(p_desc->p_rx_buffer != NULL || p_desc->rx_length == 0);
+        NRFX_ASSERT(SPIM_LENGTH_VALIDATE(p_instance->drv_inst_idx,
+                                         p_desc->rx_length,
+                                         p_desc->tx_length));
+
+        if (!spim_frequency_valid_check(p_instance, p_list[i].frequency))
+        {
+            err_code = NRFX_ERROR_INVALID_PARAM;
+            NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                             __func__,
+                             NRFX_LOG_ERROR_STRING_GET(err_code));
+            return err_code;
+        }
+
+        // EasyDMA requires that transfer buffers are placed in Data RAM region;
+        // signal error if they are not. Transfers following the first one are
+        // started from the interrupt, where the error could not be reported.
+        if ((p_desc->p_tx_buffer != NULL &&
+             !nrf_dma_accessible_check(SPIM_REG(p_instance), p_desc->p_tx_buffer)) ||
+            (p_desc->p_rx_buffer != NULL &&
+             !nrf_dma_accessible_check(SPIM_REG(p_instance), p_desc->p_rx_buffer)))
+        {
+            err_code = NRFX_ERROR_INVALID_ADDR;
+            NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                             __func__,
+                             NRFX_LOG_ERROR_STRING_GET(err_code));
+            return err_code;
+        }
+    }
+
+    if (p_cb->transfer_in_progress)
+    {
+        err_code = NRFX_ERROR_BUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+    p_cb->transfer_in_progress = true;
+
+    if (!p_cb->skip_gpio_cfg)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            // - Slave Select (optional) - output with initial value corresponding to inactive.
+            pin_init(p_list[i].ss_pin, NRF_GPIO_PIN_DIR_OUTPUT, NRF_GPIO_PIN_NOPULL,
+                     NRF_GPIO_PIN_S0S1, !p_list[i].ss_active_high);
+        }
+    }
+
+    p_cb->saved_ss_pin         = p_cb->ss_pin;
+    p_cb->saved_ss_active_high = p_cb->ss_active_high;
+    p_cb->p_list               = p_list;
+    p_cb->list_count           = count;
+    p_cb->list_idx             = 0;
+    p_cb->list_flags           = flags;
+
+    NRFX_LOG_INFO("Transfer list: %d transfers.", count);
+
+    spim_list_xfer_start(SPIM_REG(p_instance), p_cb);
+
+    return err_code;
+}
+#endif // NRFX_CHECK(NRFX_SPIM_CONFIG_XFER_LIST_ENABLED)
+
+#if NRFX_CHECK(NRFX_SPIM_CONFIG_DISPLAY_ENABLED)
+static void spim_display_chunk_start(NRF_SPIM_Type * p_spim, spim_control_block_t * p_cb)
+{
+    nrfx_spim_display_xfer_t const * p_segment = &p_cb->p_display[p_cb->display_idx];
+
+    if (!p_cb->display_cmd_sent)
+    {
+        // Only the first byte is the command, its parameters are data.
+        nrfy_spim_dcx_cnt_set(p_spim, 1);
+        p_cb->evt.xfer_desc = (nrfx_spim_xfer_desc_t)
+                              NRFX_SPIM_XFER_TX(p_segment->p_cmd, p_segment->cmd_length);
+    }
+    else
+    {
+        size_t length = NRFX_MIN(p_segment->data_length - p_cb->display_offset,
+                                 p_cb->display_max_length);
+
+        nrfy_spim_dcx_cnt_set(p_spim, 0);
+        p_cb->evt.xfer_desc = (nrfx_spim_xfer_desc_t)
+                              NRFX_SPIM_XFER_TX(p_segment->p_data + p_cb->display_offset, length);
+    }
+
+    (void)spim_xfer(p_spim, p_cb, &p_cb->evt.xfer_desc, 0);
+}
+
+// Returns true if the batch continues with the next transfer.
+static bool spim_display_xfer_done(NRF_SPIM_Type * p_spim, spim_control_block_t * p_cb)
+{
+    nrfx_spim_display_xfer_t const * p_segment = &p_cb->p_display[p_cb->display_idx];
+
+    if (p_cb->display_cmd_sent)
+    {
+        p_cb->display_offset += p_cb->evt.xfer_desc.tx_length;
+    }
+    p_cb->display_cmd_sent = true;
+
+    if (p_cb->display_offset == p_segment->data_length)
+    {
+        if (++p_cb->display_idx == p_cb->display_count)
+        {
+            p_cb->p_display = NULL;
+            return false;
+        }
+        p_cb->display_offset   = 0;
+        p_cb->display_cmd_sent = false;
+    }
+
+    // Slave Select stays active, the next transfer is started right away from the interrupt.
+    spim_display_chunk_start(p_spim, p_cb);
+    return true;
+}
+
+nrfx_err_t nrfx_spim_display_xfer(nrfx_spim_t const *              p_instance,
+                                  nrfx_spim_display_xfer_t const * p_segments,
+                                  size_t                           count)
+{
+    spim_control_block_t * p_cb = &m_cb[SPIM_IDX(p_instance)];
+    NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
+    NRFX_ASSERT(p_segments);
+    NRFX_ASSERT(count > 0);
+
+    nrfx_err_t err_code = NRFX_SUCCESS;
+    size_t     max_length = NRFX_BIT(easydma_support_bits[p_instance->drv_inst_idx]) - 1;
+
+    if (!p_cb->handler)
+    {
+        err_code = NRFX_ERROR_FORBIDDEN;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    if (!SPIM_DCX_PRESENT_VALIDATE(p_instance->drv_inst_idx))
+    {
+        err_code = NRFX_ERROR_NOT_SUPPORTED;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        NRFX_ASSERT(p_segments[i].p_cmd != NULL);
+        NRFX_ASSERT(p_segments[i].cmd_length > 0 && p_segments[i].cmd_length <= max_length);
+        NRFX_ASSERT(p_segments[i].p_data != NULL || p_segments[i].data_length == 0);
+
+        // EasyDMA requires that transfer buffers are placed in Data RAM region;
+        // signal error if they are not. Transfers following the first one are
+        // started from the interrupt, where the error could not be reported.
+        if (!nrf_dma_accessible_check(SPIM_REG(p_instance), p_segments[i].p_cmd) ||
+            (p_segments[i].p_data != NULL &&
+             !nrf_dma_accessible_check(SPIM_REG(p_instance), p_segments[i].p_data)))
+        {
+            err_code = NRFX_ERROR_INVALID_ADDR;
+            NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                             __func__,
+                             NRFX_LOG_ERROR_STRING_GET(err_code));
+            return err_code;
+        }
+    }
+
+    if (p_cb->transfer_in_progress)
+    {
+        err_code = NRFX_ERROR_BUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+    p_cb->transfer_in_progress = true;
+
+    p_cb->p_display          = p_segments;
+    p_cb->display_count      = count;
+    p_cb->display_idx        = 0;
+    p_cb->display_offset     = 0;
+    p_cb->display_max_length = max_length;
+    p_cb->display_cmd_sent   = false;
+
+    NRFX_LOG_INFO("Display transfer: %d segments.", count);
+
+    set_ss_pin_state(p_cb, true);
+
+    spim_display_chunk_start(SPIM_REG(p_instance), p_cb);
+
+    return err_code;
 }
+#endif // NRFX_CHECK(NRFX_SPIM_CONFIG_DISPLAY_ENABLED)
 
 void nrfx_spim_abort(nrfx_spim_t const * p_instance)
 {
-    spim_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    spim_control_block_t * p_cb = &m_cb[SPIM_IDX(p_instance)];
+    NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
+
+    spim_abort(SPIM_REG(p_instance), p_cb);
+#if NRFX_CHECK(NRFX_SPIM_CONFIG_XFER_LIST_ENABLED)
+    if (p_cb->p_list)
+    {
+        spim_list_end(p_cb);
+    }
+#endif
+#if NRFX_CHECK(NRFX_SPIM_CONFIG_DISPLAY_ENABLED)
+    if (p_cb->p_display)
+    {
+        set_ss_pin_state(p_cb, false);
+        p_cb->p_display = NULL;
+    }
+#endif
+}
+
+#if NRFX_CHECK(NRFX_SPIM_CONFIG_STREAM_ENABLED)
+static size_t spim_stream_block_size_get(nrfx_spim_stream_config_t const * p_config)
+{
+    return p_config->sample_length * p_config->block_samples;
+}
+
+static void spim_stream_channels_free(spim_stream_t * p_stream)
+{
+    nrfx_gppi_channels_disable(NRFX_BIT(p_stream->start_channel) |
+                               NRFX_BIT(p_stream->count_channel));
+    (void)nrfx_gppi_channel_free(p_stream->start_channel);
+    (void)nrfx_gppi_channel_free(p_stream->count_channel);
+}
+
+nrfx_err_t nrfx_spim_stream_start(nrfx_spim_t const *               p_instance,
+                                  nrfx_spim_stream_config_t const * p_config)
+{
+    spim_control_block_t * p_cb     = &m_cb[SPIM_IDX(p_instance)];
+    spim_stream_t *        p_stream = &p_cb->stream;
+    NRF_SPIM_Type *        p_spim   = SPIM_REG(p_instance);
     NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
+    NRFX_ASSERT(p_config->p_buffer);
+    NRFX_ASSERT(p_config->p_cmd != NULL || p_config->cmd_length == 0);
+    NRFX_ASSERT(p_config->block_samples > 0);
+    NRFX_ASSERT(p_config->block_count >= 2);
+    NRFX_ASSERT(p_config->p_sample_timer && p_config->p_count_timer);
+    NRFX_ASSERT(SPIM_LENGTH_VALIDATE(p_instance->drv_inst_idx,
+                                     p_config->sample_length,
+                                     p_config->cmd_length));
+
+    nrfx_err_t err_code = NRFX_SUCCESS;
+    uint32_t   base     = NRF_TIMER_BASE_FREQUENCY_GET(p_config->p_sample_timer);
+
+    if (!p_cb->handler)
+    {
+        err_code = NRFX_ERROR_FORBIDDEN;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
 
-    spim_abort(p_instance->p_reg, p_cb);
+    if ((p_config->sample_rate == 0) || (p_config->sample_rate > base))
+    {
+        err_code = NRFX_ERROR_INVALID_PARAM;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    // EasyDMA requires that transfer buffers are placed in Data RAM region;
+    // signal error if they are not.
+    if ((p_config->p_cmd != NULL && !nrf_dma_accessible_check(p_spim, p_config->p_cmd)) ||
+        !nrf_dma_accessible_check(p_spim, p_config->p_buffer))
+    {
+        err_code = NRFX_ERROR_INVALID_ADDR;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    if (p_cb->transfer_in_progress)
+    {
+        err_code = NRFX_ERROR_BUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    if (nrfx_gppi_channel_alloc(&p_stream->start_channel) != NRFX_SUCCESS)
+    {
+        err_code = NRFX_ERROR_NO_MEM;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+    if (nrfx_gppi_channel_alloc(&p_stream->count_channel) != NRFX_SUCCESS)
+    {
+        (void)nrfx_gppi_channel_free(p_stream->start_channel);
+        err_code = NRFX_ERROR_NO_MEM;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    p_cb->transfer_in_progress = true;
+    p_stream->config           = *p_config;
+    p_stream->block_idx        = 0;
+    p_stream->active           = true;
+
+    // The command is sent from the same place in each transfer, while ArrayList moves
+    // the reception by one sample after each transfer.
+    nrfy_spim_xfer_desc_t xfer_desc = {
+        .p_tx_buffer = p_config->p_cmd,
+        .tx_length   = p_config->cmd_length,
+        .p_rx_buffer = p_config->p_buffer,
+        .rx_length   = p_config->sample_length
+    };
+    nrfy_spim_tx_list_set(p_spim, false);
+    nrfy_spim_rx_list_set(p_spim, true);
+    nrfy_spim_buffers_set(p_spim, &xfer_desc);
+    nrfy_spim_int_disable(p_spim, NRF_SPIM_INT_END_MASK);
+    nrfy_spim_event_clear(p_spim, NRF_SPIM_EVENT_END);
+    nrfy_spim_enable(p_spim);
+
+    nrfy_timer_config_t count_config = {
+        .prescaler = 0,
+        .mode      = NRF_TIMER_MODE_COUNTER,
+        .bit_width = NRF_TIMER_BIT_WIDTH_32
+    };
+    nrfy_timer_task_trigger(p_config->p_count_timer, NRF_TIMER_TASK_STOP);
+    nrfy_timer_periph_configure(p_config->p_count_timer, &count_config);
+    nrfy_timer_task_trigger(p_config->p_count_timer, NRF_TIMER_TASK_CLEAR);
+    nrfy_timer_cc_set(p_config->p_count_timer, NRF_TIMER_CC_CHANNEL0, p_config->block_samples);
+    nrfy_timer_shorts_enable(p_config->p_count_timer, NRF_TIMER_SHORT_COMPARE0_CLEAR_MASK);
+    nrfy_timer_int_init(p_config->p_count_timer,
+                        NRF_TIMER_INT_COMPARE0_MASK,
+                        p_config->irq_priority,
+                        true);
+    nrfy_timer_task_trigger(p_config->p_count_timer, NRF_TIMER_TASK_START);
+
+    nrfy_timer_config_t sample_config = {
+        .prescaler = 0,
+        .mode      = NRF_TIMER_MODE_TIMER,
+        .bit_width = NRF_TIMER_BIT_WIDTH_32
+    };
+    nrfy_timer_task_trigger(p_config->p_sample_timer, NRF_TIMER_TASK_STOP);
+    nrfy_timer_periph_configure(p_config->p_sample_timer, &sample_config);
+    nrfy_timer_task_trigger(p_config->p_sample_timer, NRF_TIMER_TASK_CLEAR);
+    nrfy_timer_cc_set(p_config->p_sample_timer, NRF_TIMER_CC_CHANNEL0,
+                      base / p_config->sample_rate);
+    nrfy_timer_shorts_enable(p_config->p_sample_timer, NRF_TIMER_SHORT_COMPARE0_CLEAR_MASK);
+
+    nrfx_gppi_channel_endpoints_setup(p_stream->start_channel,
+        nrfy_timer_event_address_get(p_config->p_sample_timer, NRF_TIMER_EVENT_COMPARE0),
+        nrfy_spim_task_address_get(p_spim, NRF_SPIM_TASK_START));
+    nrfx_gppi_channel_endpoints_setup(p_stream->count_channel,
+        nrfy_spim_event_address_get(p_spim, NRF_SPIM_EVENT_END),
+        nrfy_timer_task_address_get(p_config->p_count_timer, NRF_TIMER_TASK_COUNT));
+    nrfx_gppi_channels_enable(NRFX_BIT(p_stream->start_channel) |
+                              NRFX_BIT(p_stream->count_channel));
+
+    NRFX_LOG_INFO("Stream: %d Hz, %d blocks of %d samples.", p_config->sample_rate,
+                  p_config->block_count, p_config->block_samples);
+
+    nrfy_timer_task_trigger(p_config->p_sample_timer, NRF_TIMER_TASK_START);
+
+    return err_code;
 }
 
+void nrfx_spim_stream_stop(nrfx_spim_t const * p_instance)
+{
+    spim_control_block_t * p_cb     = &m_cb[SPIM_IDX(p_instance)];
+    spim_stream_t *        p_stream = &p_cb->stream;
+    NRFX_ASSERT(p_stream->active);
+
+    nrfy_timer_task_trigger(p_stream->config.p_sample_timer, NRF_TIMER_TASK_STOP);
+    nrfy_timer_task_trigger(p_stream->config.p_count_timer, NRF_TIMER_TASK_STOP);
+    nrfy_timer_int_disable(p_stream->config.p_count_timer, NRF_TIMER_INT_COMPARE0_MASK);
+    nrfy_timer_int_uninit(p_stream->config.p_count_timer);
+    spim_stream_channels_free(p_stream);
+
+    p_stream->active = false;
+    nrfy_spim_rx_list_set(SPIM_REG(p_instance), false);
+    spim_abort(SPIM_REG(p_instance), p_cb);
+    NRFX_LOG_INFO("Stream stopped.");
+}
+
+void nrfx_spim_stream_irq_handler(nrfx_spim_t const * p_instance)
+{
+    spim_control_block_t * p_cb     = &m_cb[SPIM_IDX(p_instance)];
+    spim_stream_t *        p_stream = &p_cb->stream;
+
+    if (!p_stream->active ||
+        !nrfy_timer_events_process(p_stream->config.p_count_timer,
+                                   NRFY_EVENT_TO_INT_BITMASK(NRF_TIMER_EVENT_COMPARE0)))
+    {
+        return;
+    }
+
+    size_t    block_size = spim_stream_block_size_get(&p_stream->config);
+    uint8_t * p_block    = p_stream->config.p_buffer + p_stream->block_idx * block_size;
+
+    p_stream->block_idx = (uint8_t)((p_stream->block_idx + 1) % p_stream->config.block_count);
+    if (p_stream->block_idx == 0)
+    {
+        // ArrayList would continue past the ring, so the next sample goes to its beginning.
+        nrfy_spim_rx_buffer_set(SPIM_REG(p_instance),
+                                p_stream->config.p_buffer,
+                                p_stream->config.sample_length);
+    }
+
+    NRFY_CACHE_INV(p_block, block_size);
+
+    p_cb->evt.type                  = NRFX_SPIM_EVENT_BLOCK_DONE;
+    p_cb->evt.xfer_desc.p_tx_buffer = p_stream->config.p_cmd;
+    p_cb->evt.xfer_desc.tx_length   = p_stream->config.cmd_length;
+    p_cb->evt.xfer_desc.p_rx_buffer = p_block;
+    p_cb->evt.xfer_desc.rx_length   = block_size;
+    p_cb->handler(&p_cb->evt, p_cb->p_context);
+}
+#endif // NRFX_CHECK(NRFX_SPIM_CONFIG_STREAM_ENABLED)
+
 static void irq_handler(NRF_SPIM_Type * p_spim, spim_control_block_t * p_cb)
 {
 #if NRFX_CHECK(NRFX_SPIM_NRF52_ANOMALY_109_WORKAROUND_ENABLED)
@@ -874,6 +1586,18 @@ static void irq_handler(NRF_SPIM_Type * p_spim, spim_control_block_t * p_cb)
 #endif
         NRFX_ASSERT(p_cb->handler);
         NRFX_LOG_DEBUG("Event: NRF_SPIM_EVENT_END.");
+#if NRFX_CHECK(NRFX_SPIM_CONFIG_XFER_LIST_ENABLED)
+        if (p_cb->p_list && spim_list_xfer_done(p_spim, p_cb))
+        {
+            return;
+        }
+#endif
+#if NRFX_CHECK(NRFX_SPIM_CONFIG_DISPLAY_ENABLED)
+        if (p_cb->p_display && spim_display_xfer_done(p_spim, p_cb))
+        {
+            return;
+        }
+#endif
         finish_transfer(p_spim, p_cb);
     }
 }
@@ -91,6 +91,11 @@ typedef struct
     nrfx_spis_event_handler_t  handler;         //!< SPI event handler.
     volatile const uint8_t *   tx_buffer;       //!< SPI slave TX buffer.
     volatile uint8_t *         rx_buffer;       //!< SPI slave RX buffer.
+    uint32_t                   next_tx_size;    //!< Queued TX buffer size in bytes.
+    uint32_t                   next_rx_size;    //!< Queued RX buffer size in bytes.
+    const uint8_t *            next_tx_buffer;  //!< Queued TX buffer.
+    uint8_t *                  next_rx_buffer;  //!< Queued RX buffer.
+    volatile bool              next_pending;    //!< Set when the queued buffers are valid.
     nrfx_drv_state_t           state;           //!< driver initialization state.
     volatile nrfx_spis_state_t spi_state;       //!< SPI slave state.
     void *                     p_context;       //!< Context set on initialization.
@@ -309,6 +314,7 @@ nrfx_err_t nrfx_spis_init(nrfx_spis_t const *        p_instance,
     nrf_spis_tx_buffer_set(p_spis, NULL, 0);
 
     p_cb->spi_state = SPIS_STATE_INIT;
+    p_cb->next_pending = false;
     // Enable IRQ.
     nrf_spis_int_enable(p_spis, NRF_SPIS_INT_ACQUIRED_MASK |
                                 NRF_SPIS_INT_END_MASK);
@@ -447,16 +453,12 @@ static void spis_state_change(NRF_SPIS_Type   * p_spis,
     spis_state_entry_action_execute(p_spis, p_cb);
 }
 
-nrfx_err_t nrfx_spis_buffers_set(nrfx_spis_t const * p_instance,
-                                 uint8_t const *     p_tx_buffer,
-                                 size_t              tx_buffer_length,
-                                 uint8_t *           p_rx_buffer,
-                                 size_t              rx_buffer_length)
+static nrfx_err_t buffers_check(nrfx_spis_t const * p_instance,
+                                uint8_t const *     p_tx_buffer,
+                                size_t              tx_buffer_length,
+                                uint8_t *           p_rx_buffer,
+                                size_t              rx_buffer_length)
 {
-    NRFX_ASSERT(p_tx_buffer != NULL || tx_buffer_length == 0);
-    NRFX_ASSERT(p_rx_buffer != NULL || rx_buffer_length == 0);
-
-    spis_cb_t * p_cb = &m_cb[p_instance->drv_inst_idx];
     nrfx_err_t err_code;
 
     if (!SPIS_LENGTH_VALIDATE(p_instance->drv_inst_idx,
@@ -478,6 +480,29 @@ nrfx_err_t nrfx_spis_buffers_set(nrfx_spis_t const * p_instance,
         return err_code;
     }
 
+    return NRFX_SUCCESS;
+}
+
+nrfx_err_t nrfx_spis_buffers_set(nrfx_spis_t const * p_instance,
+                                 uint8_t const *     p_tx_buffer,
+                                 size_t              tx_buffer_length,
+                                 uint8_t *           p_rx_buffer,
+                                 size_t              rx_buffer_length)
+{
+    NRFX_ASSERT(p_tx_buffer != NULL || tx_buffer_length == 0);
+    NRFX_ASSERT(p_rx_buffer != NULL || rx_buffer_length == 0);
+
+    spis_cb_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    nrfx_err_t err_code = buffers_check(p_instance,
+                                        p_tx_buffer,
+                                        tx_buffer_length,
+                                        p_rx_buffer,
+                                        rx_buffer_length);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
     switch (p_cb->spi_state)
     {
         case SPIS_STATE_INIT:
@@ -506,6 +531,110 @@ nrfx_err_t nrfx_spis_buffers_set(nrfx_spis_t const * p_instance,
     return err_code;
 }
 
+nrfx_err_t nrfx_spis_next_buffers_set(nrfx_spis_t const * p_instance,
+                                      uint8_t const *     p_tx_buffer,
+                                      size_t              tx_buffer_length,
+                                      uint8_t *           p_rx_buffer,
+                                      size_t              rx_buffer_length)
+{
+    NRFX_ASSERT(p_tx_buffer != NULL || tx_buffer_length == 0);
+    NRFX_ASSERT(p_rx_buffer != NULL || rx_buffer_length == 0);
+
+    spis_cb_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    nrfx_err_t err_code = buffers_check(p_instance,
+                                        p_tx_buffer,
+                                        tx_buffer_length,
+                                        p_rx_buffer,
+                                        rx_buffer_length);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    bool armed;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    armed = (p_cb->spi_state == SPIS_BUFFER_RESOURCE_REQUESTED) ||
+            (p_cb->spi_state == SPIS_BUFFER_RESOURCE_CONFIGURED);
+    if (armed)
+    {
+        if (p_cb->next_pending)
+        {
+            err_code = NRFX_ERROR_BUSY;
+        }
+        else
+        {
+            p_cb->next_tx_buffer = p_tx_buffer;
+            p_cb->next_rx_buffer = p_rx_buffer;
+            p_cb->next_tx_size   = tx_buffer_length;
+            p_cb->next_rx_size   = rx_buffer_length;
+            p_cb->next_pending   = true;
+        }
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    if (!armed)
+    {
+        // Nothing to queue behind, use the buffers for the next transaction directly.
+        return nrfx_spis_buffers_set(p_instance,
+                                     p_tx_buffer,
+                                     tx_buffer_length,
+                                     p_rx_buffer,
+                                     rx_buffer_length);
+    }
+
+    NRFX_LOG_INFO("Function: %s, error code: %s.", __func__, NRFX_LOG_ERROR_STRING_GET(err_code));
+    return err_code;
+}
+
+static void spis_acquired_handle(NRF_SPIS_Type * p_spis, spis_cb_t * p_cb)
+{
+    switch (p_cb->spi_state)
+    {
+        case SPIS_BUFFER_RESOURCE_REQUESTED:
+            nrf_spis_tx_buffer_set(p_spis, (uint8_t *)p_cb->tx_buffer, p_cb->tx_buffer_size);
+            nrf_spis_rx_buffer_set(p_spis, (uint8_t *)p_cb->rx_buffer, p_cb->rx_buffer_size);
+
+            nrf_spis_task_trigger(p_spis, NRF_SPIS_TASK_RELEASE);
+
+            spis_state_change(p_spis, p_cb, SPIS_BUFFER_RESOURCE_CONFIGURED);
+            break;
+
+        default:
+            // No implementation required.
+            break;
+    }
+}
+
+/** @brief Function for switching to the queued buffers right after a transaction ends. */
+static void spis_next_buffers_switch(NRF_SPIS_Type * p_spis, spis_cb_t * p_cb)
+{
+    nrfx_spis_evt_t event = {
+        .evt_type  = NRFX_SPIS_XFER_DONE,
+        .rx_amount = nrf_spis_rx_amount_get(p_spis),
+        .tx_amount = nrf_spis_tx_amount_get(p_spis),
+    };
+    NRFX_LOG_INFO("Transfer rx_len:%d.", event.rx_amount);
+
+    p_cb->tx_buffer      = p_cb->next_tx_buffer;
+    p_cb->rx_buffer      = p_cb->next_rx_buffer;
+    p_cb->tx_buffer_size = p_cb->next_tx_size;
+    p_cb->rx_buffer_size = p_cb->next_rx_size;
+    p_cb->next_pending   = false;
+
+    spis_state_change(p_spis, p_cb, SPIS_BUFFER_RESOURCE_REQUESTED);
+
+    // The END_ACQUIRE shortcut normally gives the semaphore back to the CPU at once, so hand
+    // the queued buffers to the peripheral before the user handler adds its latency.
+    if (nrf_spis_event_check(p_spis, NRF_SPIS_EVENT_ACQUIRED))
+    {
+        nrf_spis_event_clear(p_spis, NRF_SPIS_EVENT_ACQUIRED);
+        spis_acquired_handle(p_spis, p_cb);
+    }
+
+    p_cb->handler(&event, p_cb->p_context);
+}
+
 static void irq_handler(NRF_SPIS_Type * p_spis, spis_cb_t * p_cb)
 {
     // @note: as multiple events can be pending for processing, the correct event processing order
@@ -519,21 +648,7 @@ static void irq_handler(NRF_SPIS_Type * p_spis, spis_cb_t * p_cb)
         nrf_spis_event_clear(p_spis, NRF_SPIS_EVENT_ACQUIRED);
         NRFX_LOG_DEBUG("SPIS: Event: %s.", EVT_TO_STR(NRF_SPIS_EVENT_ACQUIRED));
 
-        switch (p_cb->spi_state)
-        {
-            case SPIS_BUFFER_RESOURCE_REQUESTED:
-                nrf_spis_tx_buffer_set(p_spis, (uint8_t *)p_cb->tx_buffer, p_cb->tx_buffer_size);
-                nrf_spis_rx_buffer_set(p_spis, (uint8_t *)p_cb->rx_buffer, p_cb->rx_buffer_size);
-
-                nrf_spis_task_trigger(p_spis, NRF_SPIS_TASK_RELEASE);
-
-                spis_state_change(p_spis, p_cb, SPIS_BUFFER_RESOURCE_CONFIGURED);
-                break;
-
-            default:
-                // No implementation required.
-                break;
-        }
+        spis_acquired_handle(p_spis, p_cb);
     }
 
     // Check for SPI transaction complete event.
@@ -545,7 +660,14 @@ static void irq_handler(NRF_SPIS_Type * p_spis, spis_cb_t * p_cb)
         switch (p_cb->spi_state)
         {
             case SPIS_BUFFER_RESOURCE_CONFIGURED:
-                spis_state_change(p_spis, p_cb, SPIS_XFER_COMPLETED);
+                if (p_cb->next_pending)
+                {
+                    spis_next_buffers_switch(p_spis, p_cb);
+                }
+                else
+                {
+                    spis_state_change(p_spis, p_cb, SPIS_XFER_COMPLETED);
+                }
                 break;
 
             default:
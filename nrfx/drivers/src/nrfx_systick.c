@@ -160,4 +160,100 @@ void nrfx_systick_delay_ms(uint32_t ms)
     nrfx_systick_delay_ticks(nrfx_systick_ms_tick(r));
 }
 
+/**
+ * @brief Offset of the stacked PC in the exception stack frame, in words.
+ */
+#define NRFX_SYSTICK_FRAME_PC_IDX 6
+
+typedef struct
+{
+    nrfx_systick_profiler_config_t config;
+    volatile uint32_t              missed;
+} nrfx_systick_profiler_cb_t;
+
+static nrfx_systick_profiler_cb_t m_profiler;
+
+void nrfx_systick_profiler_start(nrfx_systick_profiler_config_t const * p_config)
+{
+    NRFX_ASSERT(p_config);
+    NRFX_ASSERT(p_config->p_bins);
+    NRFX_ASSERT(p_config->rate_hz > 0);
+    NRFX_ASSERT((SystemCoreClock / p_config->rate_hz) <= NRF_SYSTICK_VAL_MASK);
+
+    nrf_systick_csr_set(NRF_SYSTICK_CSR_DISABLE);
+
+    m_profiler.config = *p_config;
+    m_profiler.missed = 0;
+
+    NRFX_IRQ_PRIORITY_SET(SysTick_IRQn, p_config->irq_priority);
+    nrf_systick_load_set((SystemCoreClock / p_config->rate_hz) - 1);
+    nrf_systick_val_clear();
+    nrf_systick_csr_set(
+        NRF_SYSTICK_CSR_CLKSOURCE_CPU |
+        NRF_SYSTICK_CSR_TICKINT_ENABLE |
+        NRF_SYSTICK_CSR_ENABLE);
+}
+
+uint32_t nrfx_systick_profiler_stop(void)
+{
+    nrfx_systick_init();
+    m_profiler.config.p_bins = NULL;
+
+    return m_profiler.missed;
+}
+
+#if defined(__GNUC__)
+/**
+ * @brief Function for counting a sample of the interrupted code.
+ *
+ * @param p_frame Exception stack frame of the interrupted code.
+ */
+static void __attribute__((used)) nrfx_systick_profiler_sample(uint32_t const * p_frame)
+{
+    nrfx_systick_profiler_config_t const * p_config = &m_profiler.config;
+
+    if (p_config->p_bins == NULL)
+    {
+        return;
+    }
+
+    // Addresses below the histogram wrap around to high bin indexes and are counted as missed.
+    uint32_t bin = (p_frame[NRFX_SYSTICK_FRAME_PC_IDX] - p_config->start_addr) >>
+                   p_config->bin_shift;
+
+    if (bin < p_config->bin_count)
+    {
+        p_config->p_bins[bin]++;
+    }
+    else
+    {
+        m_profiler.missed++;
+    }
+}
+
+__attribute__((naked)) void nrfx_systick_irq_handler(void)
+{
+    // Pass the stack frame of the interrupted code, selected by bit 2 of EXC_RETURN.
+    // Only Thumb-1 instructions are used, so that the code is valid for all Cortex-M cores,
+    // and the sampling function is reached through a literal to avoid the branch range limit.
+    // LR still holds EXC_RETURN, so the sampling function returns from the exception.
+    __ASM volatile(
+        "movs r0, #4                        \n"
+        "mov  r1, lr                        \n"
+        "tst  r0, r1                        \n"
+        "beq  1f                            \n"
+        "mrs  r0, psp                       \n"
+        "b    2f                            \n"
+        "1:                                 \n"
+        "mrs  r0, msp                       \n"
+        "2:                                 \n"
+        "ldr  r2, 3f                        \n"
+        "bx   r2                            \n"
+        ".align 2                           \n"
+        "3:                                 \n"
+        ".word nrfx_systick_profiler_sample \n"
+    );
+}
+#endif
+
 #endif // NRFX_CHECK(NRFX_SYSTICK_ENABLED)
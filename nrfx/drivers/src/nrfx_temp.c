@@ -36,6 +36,7 @@
 #if NRFX_CHECK(NRFX_TEMP_ENABLED)
 
 #include <nrfx_temp.h>
+#include <helpers/nrfx_gppi.h>
 
 #if !defined(USE_WORKAROUND_FOR_TEMP_OFFSET_ANOMALY) && defined(NRF51)
 // Enable workaround for nRF51 series anomaly 28
@@ -55,6 +56,24 @@ static nrfx_drv_state_t m_temp_state = NRFX_DRV_STATE_UNINITIALIZED;
 /** @brief Pointer to handler to be called from interrupt routine. */
 static nrfx_temp_data_handler_t m_data_handler;
 
+/** @brief List of temperature change subscribers. */
+static nrfx_temp_subscriber_t * m_p_subscribers;
+
+/** @brief Most recent temperature in Celsius scale, multiplied by 100. */
+static int32_t m_last_temp;
+
+/** @brief True if @ref m_last_temp holds a measured value. */
+static bool m_last_valid;
+
+/** @brief True if periodic measurements are started. */
+static bool m_periodic;
+
+/** @brief (G)PPI channel used to trigger periodic measurements. */
+static uint8_t m_ppi_channel;
+
+/** @brief Event address used to trigger periodic measurements. */
+static uint32_t m_periodic_event;
+
 nrfx_err_t nrfx_temp_init(nrfx_temp_config_t const * p_config, nrfx_temp_data_handler_t handler)
 {
     NRFX_ASSERT(p_config);
@@ -72,7 +91,10 @@ nrfx_err_t nrfx_temp_init(nrfx_temp_config_t const * p_config, nrfx_temp_data_ha
     nrfy_temp_calibration_coeff_set(NRF_TEMP, NRF_FICR->TRIM.GLOBAL.TEMP.CALIB);
 #endif
 
-    m_data_handler = handler;
+    m_data_handler  = handler;
+    m_p_subscribers = NULL;
+    m_last_valid    = false;
+    m_periodic      = false;
 
     if (m_data_handler)
     {
@@ -87,6 +109,11 @@ void nrfx_temp_uninit(void)
 {
     NRFX_ASSERT(m_temp_state == NRFX_DRV_STATE_INITIALIZED);
 
+    if (m_periodic)
+    {
+        nrfx_temp_periodic_stop();
+    }
+
     nrfy_temp_task_trigger(NRF_TEMP, NRF_TEMP_TASK_STOP);
     if (m_data_handler)
     {
@@ -136,15 +163,130 @@ nrfx_err_t nrfx_temp_measure(void)
     return result;
 }
 
+nrfx_err_t nrfx_temp_subscribe(nrfx_temp_subscriber_t * p_subscriber)
+{
+    NRFX_ASSERT(m_temp_state == NRFX_DRV_STATE_INITIALIZED);
+    NRFX_ASSERT(p_subscriber);
+    NRFX_ASSERT(p_subscriber->handler);
+
+    if (!m_data_handler)
+    {
+        return NRFX_ERROR_INVALID_STATE;
+    }
+
+    p_subscriber->notified = false;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    p_subscriber->p_next = m_p_subscribers;
+    m_p_subscribers      = p_subscriber;
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    return NRFX_SUCCESS;
+}
+
+void nrfx_temp_unsubscribe(nrfx_temp_subscriber_t * p_subscriber)
+{
+    NRFX_ASSERT(p_subscriber);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    nrfx_temp_subscriber_t ** pp_item = &m_p_subscribers;
+    while (*pp_item)
+    {
+        if (*pp_item == p_subscriber)
+        {
+            *pp_item = p_subscriber->p_next;
+            break;
+        }
+        pp_item = &(*pp_item)->p_next;
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+nrfx_err_t nrfx_temp_periodic_start(uint32_t event_address)
+{
+    NRFX_ASSERT(m_temp_state == NRFX_DRV_STATE_INITIALIZED);
+
+    if (!m_data_handler || m_periodic)
+    {
+        return NRFX_ERROR_INVALID_STATE;
+    }
+
+    if (nrfx_gppi_channel_alloc(&m_ppi_channel) != NRFX_SUCCESS)
+    {
+        return NRFX_ERROR_NO_MEM;
+    }
+
+    m_periodic_event = event_address;
+    m_periodic       = true;
+
+    nrfy_temp_event_clear(NRF_TEMP, NRF_TEMP_EVENT_DATARDY);
+    nrfx_gppi_channel_endpoints_setup(m_ppi_channel,
+        event_address,
+        nrfy_temp_task_address_get(NRF_TEMP, NRF_TEMP_TASK_START));
+    nrfx_gppi_channels_enable(NRFX_BIT(m_ppi_channel));
+
+    return NRFX_SUCCESS;
+}
+
+void nrfx_temp_periodic_stop(void)
+{
+    NRFX_ASSERT(m_periodic);
+
+    nrfx_gppi_channels_disable(NRFX_BIT(m_ppi_channel));
+    nrfx_gppi_channel_endpoints_clear(m_ppi_channel,
+        m_periodic_event,
+        nrfy_temp_task_address_get(NRF_TEMP, NRF_TEMP_TASK_START));
+    (void)nrfx_gppi_channel_free(m_ppi_channel);
+
+    m_periodic = false;
+}
+
+bool nrfx_temp_last_get(int32_t * p_temperature)
+{
+    NRFX_ASSERT(p_temperature);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    bool valid = m_last_valid;
+    *p_temperature = m_last_temp;
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    return valid;
+}
+
+static void subscribers_notify(int32_t temperature)
+{
+    for (nrfx_temp_subscriber_t * p_item = m_p_subscribers; p_item; p_item = p_item->p_next)
+    {
+        int32_t diff = temperature - p_item->reported;
+
+        if (!p_item->notified || (diff >= p_item->threshold) || (-diff >= p_item->threshold))
+        {
+            p_item->notified = true;
+            p_item->reported = temperature;
+            p_item->handler(temperature, p_item->p_context);
+        }
+    }
+}
+
 void nrfx_temp_irq_handler(void)
 {
+    NRFX_IRQ_ENTER(NRF_TEMP);
+
     NRFX_ASSERT(m_data_handler);
 
     nrf_temp_task_trigger(NRF_TEMP, NRF_TEMP_TASK_STOP);
     nrf_temp_event_clear(NRF_TEMP, NRF_TEMP_EVENT_DATARDY);
 
-    int32_t raw_temp = nrfx_temp_result_get();
+    int32_t raw_temp    = nrfx_temp_result_get();
+    int32_t temperature = nrfx_temp_calculate(raw_temp);
+
+    m_last_temp  = temperature;
+    m_last_valid = true;
+
     m_data_handler(raw_temp);
+    subscribers_notify(temperature);
+
+    NRFX_IRQ_EXIT(NRF_TEMP);
 }
 
 #endif // NRFX_CHECK(NRFX_TEMP_ENABLED)
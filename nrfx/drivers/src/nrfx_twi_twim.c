@@ -37,6 +37,12 @@
 
 #include <hal/nrf_gpio.h>
 
+#if NRFX_CHECK(NRFX_GPIOTE_ENABLED)
+#include <nrfx_gpiote.h>
+#include <haly/nrfy_timer.h>
+#include <helpers/nrfx_gppi.h>
+#endif
+
 #define TWI_TWIM_PIN_CONFIGURE(_pin) nrf_gpio_cfg((_pin),                     \
                                                   NRF_GPIO_PIN_DIR_OUTPUT,    \
                                                   NRF_GPIO_PIN_INPUT_CONNECT, \
@@ -85,4 +91,195 @@ nrfx_err_t nrfx_twi_twim_bus_recover(uint32_t scl_pin, uint32_t sda_pin)
     }
 }
 
+#if NRFX_CHECK(NRFX_GPIOTE_ENABLED)
+
+// Half period of the recovery clock, the same as the delays of the blocking recovery.
+#define BUS_RECOVER_HALF_PERIOD_US 4
+
+// Number of SCL edges of 9 clock pulses.
+#define BUS_RECOVER_EDGES 18
+
+typedef enum
+{
+    BUS_RECOVER_STATE_IDLE,      // No recovery in progress.
+    BUS_RECOVER_STATE_SETTLE,    // Pins configured, waiting before the first SDA check.
+    BUS_RECOVER_STATE_CLOCK,     // Clock pulses generated on SCL through (D)PPI.
+    BUS_RECOVER_STATE_STOP_LOW,  // Waiting before SDA is pulled low for the STOP condition.
+    BUS_RECOVER_STATE_STOP_HIGH, // Waiting before SDA is released for the STOP condition.
+    BUS_RECOVER_STATE_CHECK,     // Waiting before SDA is checked for the result.
+} bus_recover_state_t;
+
+typedef struct
+{
+    nrfx_twi_twim_bus_recover_config_t config;
+    bus_recover_state_t                state;
+    uint8_t                            edges;
+    uint8_t                            gpiote_channel;
+    uint8_t                            ppi_channel;
+} bus_recover_cb_t;
+
+static bus_recover_cb_t m_bus_recover;
+
+nrfx_err_t nrfx_twi_twim_bus_recover_start(nrfx_twi_twim_bus_recover_config_t const * p_config)
+{
+    NRFX_ASSERT(p_config);
+    NRFX_ASSERT(p_config->p_timer);
+    NRFX_ASSERT(p_config->handler);
+
+    bus_recover_cb_t * p_cb = &m_bus_recover;
+    nrfx_err_t         err_code;
+
+    if (p_cb->state != BUS_RECOVER_STATE_IDLE)
+    {
+        return NRFX_ERROR_BUSY;
+    }
+
+    if (nrfx_gpiote_channel_alloc(&p_cb->gpiote_channel) != NRFX_SUCCESS)
+    {
+        return NRFX_ERROR_NO_MEM;
+    }
+    if (nrfx_gppi_channel_alloc(&p_cb->ppi_channel) != NRFX_SUCCESS)
+    {
+        (void)nrfx_gpiote_channel_free(p_cb->gpiote_channel);
+        return NRFX_ERROR_NO_MEM;
+    }
+
+    nrf_gpio_pin_set(p_config->sda_pin);
+    TWI_TWIM_PIN_CONFIGURE(p_config->sda_pin);
+
+    // SCL is driven by the GPIOTE channel in the open-drain configuration of TWI.
+    static const nrfx_gpiote_output_config_t scl_config = {
+        .drive         = NRF_GPIO_PIN_S0D1,
+        .input_connect = NRF_GPIO_PIN_INPUT_CONNECT,
+        .pull          = NRF_GPIO_PIN_PULLUP,
+    };
+    nrfx_gpiote_task_config_t scl_task_config = {
+        .task_ch  = p_cb->gpiote_channel,
+        .polarity = NRF_GPIOTE_POLARITY_TOGGLE,
+        .init_val = NRF_GPIOTE_INITIAL_VALUE_HIGH,
+    };
+    err_code = nrfx_gpiote_output_configure(p_config->scl_pin, &scl_config, &scl_task_config);
+    if (err_code != NRFX_SUCCESS)
+    {
+        (void)nrfx_gppi_channel_free(p_cb->ppi_channel);
+        (void)nrfx_gpiote_channel_free(p_cb->gpiote_channel);
+        return err_code;
+    }
+    nrfx_gpiote_out_task_enable(p_config->scl_pin);
+
+    nrfx_gppi_channel_endpoints_setup(p_cb->ppi_channel,
+        nrfy_timer_event_address_get(p_config->p_timer, NRF_TIMER_EVENT_COMPARE0),
+        nrfx_gpiote_out_task_address_get(p_config->scl_pin));
+
+    p_cb->config = *p_config;
+    p_cb->edges  = 0;
+    p_cb->state  = BUS_RECOVER_STATE_SETTLE;
+
+    // Each COMPARE0 marks the end of a half period. The (D)PPI channel is enabled only
+    // for the clock pulses.
+    nrfy_timer_config_t timer_config = {
+        .prescaler = NRF_TIMER_PRESCALER_CALCULATE(NRF_TIMER_BASE_FREQUENCY_GET(p_config->p_timer),
+                                                   NRFX_MHZ_TO_HZ(1)),
+        .mode      = NRF_TIMER_MODE_TIMER,
+        .bit_width = NRF_TIMER_BIT_WIDTH_32
+    };
+    nrfy_timer_task_trigger(p_config->p_timer, NRF_TIMER_TASK_STOP);
+    nrfy_timer_periph_configure(p_config->p_timer, &timer_config);
+    nrfy_timer_task_trigger(p_config->p_timer, NRF_TIMER_TASK_CLEAR);
+    nrfy_timer_cc_set(p_config->p_timer, NRF_TIMER_CC_CHANNEL0, BUS_RECOVER_HALF_PERIOD_US);
+    nrfy_timer_shorts_enable(p_config->p_timer, NRF_TIMER_SHORT_COMPARE0_CLEAR_MASK);
+    nrfy_timer_int_init(p_config->p_timer,
+                        NRF_TIMER_INT_COMPARE0_MASK,
+                        p_config->irq_priority,
+                        true);
+    nrfy_timer_task_trigger(p_config->p_timer, NRF_TIMER_TASK_START);
+
+    return NRFX_SUCCESS;
+}
+
+static void bus_recover_finish(bus_recover_cb_t * p_cb)
+{
+    nrfx_err_t result = nrf_gpio_pin_read(p_cb->config.sda_pin) ? NRFX_SUCCESS :
+                                                                  NRFX_ERROR_INTERNAL;
+
+    nrfy_timer_task_trigger(p_cb->config.p_timer, NRF_TIMER_TASK_STOP);
+    nrfy_timer_shorts_disable(p_cb->config.p_timer, NRF_TIMER_SHORT_COMPARE0_CLEAR_MASK);
+    nrfy_timer_int_disable(p_cb->config.p_timer, NRF_TIMER_INT_COMPARE0_MASK);
+    nrfy_timer_int_uninit(p_cb->config.p_timer);
+
+    nrfx_gppi_channel_endpoints_clear(p_cb->ppi_channel,
+        nrfy_timer_event_address_get(p_cb->config.p_timer, NRF_TIMER_EVENT_COMPARE0),
+        nrfx_gpiote_out_task_address_get(p_cb->config.scl_pin));
+    (void)nrfx_gppi_channel_free(p_cb->ppi_channel);
+
+    // Leave SCL in the same state as the blocking recovery does.
+    nrf_gpio_pin_set(p_cb->config.scl_pin);
+    (void)nrfx_gpiote_pin_uninit(p_cb->config.scl_pin);
+    (void)nrfx_gpiote_channel_free(p_cb->gpiote_channel);
+    TWI_TWIM_PIN_CONFIGURE(p_cb->config.scl_pin);
+
+    p_cb->state = BUS_RECOVER_STATE_IDLE;
+    p_cb->config.handler(result, p_cb->config.p_context);
+}
+
+void nrfx_twi_twim_bus_recover_irq_handler(NRF_TIMER_Type * p_timer)
+{
+    bus_recover_cb_t * p_cb = &m_bus_recover;
+
+    if ((p_cb->state == BUS_RECOVER_STATE_IDLE) || (p_cb->config.p_timer != p_timer) ||
+        !nrfy_timer_events_process(p_timer,
+                                   NRFY_EVENT_TO_INT_BITMASK(NRF_TIMER_EVENT_COMPARE0)))
+    {
+        return;
+    }
+
+    switch (p_cb->state)
+    {
+        case BUS_RECOVER_STATE_SETTLE:
+            if (nrf_gpio_pin_read(p_cb->config.sda_pin))
+            {
+                p_cb->state = BUS_RECOVER_STATE_STOP_LOW;
+            }
+            else
+            {
+                // The next COMPARE0 starts the first clock pulse.
+                nrfx_gppi_channels_enable(NRFX_BIT(p_cb->ppi_channel));
+                p_cb->state = BUS_RECOVER_STATE_CLOCK;
+            }
+            break;
+
+        case BUS_RECOVER_STATE_CLOCK:
+            p_cb->edges++;
+            // SDA is checked after each rising edge, when SCL is high again.
+            if ((p_cb->edges % 2 == 0) &&
+                (nrf_gpio_pin_read(p_cb->config.sda_pin) ||
+                 (p_cb->edges == BUS_RECOVER_EDGES)))
+            {
+                nrfx_gppi_channels_disable(NRFX_BIT(p_cb->ppi_channel));
+                p_cb->state = BUS_RECOVER_STATE_STOP_LOW;
+            }
+            break;
+
+        case BUS_RECOVER_STATE_STOP_LOW:
+            nrf_gpio_pin_clear(p_cb->config.sda_pin);
+            p_cb->state = BUS_RECOVER_STATE_STOP_HIGH;
+            break;
+
+        case BUS_RECOVER_STATE_STOP_HIGH:
+            nrf_gpio_pin_set(p_cb->config.sda_pin);
+            p_cb->state = BUS_RECOVER_STATE_CHECK;
+            break;
+
+        case BUS_RECOVER_STATE_CHECK:
+            bus_recover_finish(p_cb);
+            break;
+
+        default:
+            NRFX_ASSERT(false);
+            break;
+    }
+}
+
+#endif // NRFX_CHECK(NRFX_GPIOTE_ENABLED)
+
 #endif // NRFX_CHECK(NRFX_TWI_ENABLED) || NRFX_CHECK(NRFX_TWIM_ENABLED)
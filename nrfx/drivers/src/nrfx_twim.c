@@ -43,16 +43,26 @@
 #include <haly/nrfy_gpio.h>
 #include "prs/nrfx_prs.h"
 
+#if NRFX_CHECK(NRFX_TWIM_CONFIG_STREAM_ENABLED)
+#include <haly/nrfy_timer.h>
+#include <helpers/nrfx_gppi.h>
+#endif
+
 #define NRFX_LOG_MODULE TWIM
 #include <nrfx_log.h>
 
+#if NRFX_CHECK(NRFX_TWIM_CONFIG_STREAM_ENABLED) && !NRFY_TWIM_HAS_ARRAY_LIST
+#error "Streaming requires EasyDMA ArrayList, which is not available in the SoC currently in use."
+#endif
+
 #define EVT_TO_STR(event)                                       \
     (event == NRFX_TWIM_EVT_DONE         ? "EVT_DONE"         : \
     (event == NRFX_TWIM_EVT_ADDRESS_NACK ? "EVT_ADDRESS_NACK" : \
     (event == NRFX_TWIM_EVT_DATA_NACK    ? "EVT_DATA_NACK"    : \
     (event == NRFX_TWIM_EVT_OVERRUN      ? "EVT_OVERRUN"      : \
     (event == NRFX_TWIM_EVT_BUS_ERROR    ? "EVT_BUS_ERROR"    : \
-                                           "UNKNOWN ERROR")))))
+    (event == NRFX_TWIM_EVT_BLOCK_DONE   ? "EVT_BLOCK_DONE"   : \
+                                           "UNKNOWN ERROR"))))))
 
 #define EVT_TO_STR_TWIM(event)                                        \
     (event == NRF_TWIM_EVENT_STOPPED   ? "NRF_TWIM_EVENT_STOPPED"   : \
@@ -85,6 +95,18 @@
 #define TWIM_LENGTH_VALIDATE(drv_inst_idx, len1, len2)    \
         (NRFX_FOREACH_ENABLED(TWIM, TWIMX_LENGTH_VALIDATE, (||), (0), drv_inst_idx, len1, len2))
 
+#if NRFX_CHECK(NRFX_TWIM_CONFIG_STREAM_ENABLED)
+// Stream state - transfers are started by TIMER through (D)PPI, the CPU is involved per block.
+typedef struct
+{
+    nrfx_twim_stream_config_t config;
+    uint8_t                   block_idx;      // Index of the block being filled.
+    uint8_t                   start_channel;  // (D)PPI from sample TIMER COMPARE0 to TWIM start.
+    uint8_t                   count_channel;  // (D)PPI from TWIM STOPPED to the counting TIMER.
+    bool                      active;
+} twim_stream_t;
+#endif
+
 // Control block - driver instance local data.
 typedef struct
 {
@@ -105,10 +127,23 @@ typedef struct
 #if NRFX_CHECK(NRFX_TWIM_NRF52_ANOMALY_109_WORKAROUND_ENABLED)
     nrf_twim_frequency_t    bus_frequency;
 #endif
+#if NRFX_CHECK(NRFX_TWIM_CONFIG_MSG_LIST_ENABLED)
+    nrfx_twim_msg_t const * p_msgs;     ///< List of messages of the ongoing transaction.
+    size_t                  msgs_count; ///< Number of messages in the list.
+    size_t                  msgs_first; ///< First message of the ongoing chain of shortcuts.
+    size_t                  msgs_last;  ///< Last message of the ongoing chain of shortcuts.
+#endif
+#if NRFX_CHECK(NRFX_TWIM_CONFIG_STREAM_ENABLED)
+    twim_stream_t           stream;
+#endif
 } twim_control_block_t;
 
 static twim_control_block_t m_cb[NRFX_TWIM_ENABLED_COUNT];
 
+/* Index and registers of the instance, resolved at compile time if only one is enabled. */
+#define TWIM_IDX(p_instance) NRFX_INSTANCE_IDX_GET(TWIM, (p_instance)->drv_inst_idx)
+#define TWIM_REG(p_instance) NRFX_INSTANCE_REG_GET(TWIM, (p_instance)->p_twim)
+
 static nrfx_err_t twi_process_error(uint32_t errorsrc)
 {
     nrfx_err_t ret = NRFX_ERROR_INTERNAL;
@@ -199,10 +234,10 @@ static void twim_configure(nrfx_twim_t const *        p_instance,
         .skip_psel_cfg = p_config->skip_psel_cfg
     };
 
-    nrfy_twim_periph_configure(p_instance->p_twim, &nrfy_config);
-    if (m_cb[p_instance->drv_inst_idx].handler)
+    nrfy_twim_periph_configure(TWIM_REG(p_instance), &nrfy_config);
+    if (m_cb[TWIM_IDX(p_instance)].handler)
     {
-        nrfy_twim_int_init(p_instance->p_twim, 0, p_config->interrupt_priority, false);
+        nrfy_twim_int_init(TWIM_REG(p_instance), 0, p_config->interrupt_priority, false);
     }
 }
 
@@ -256,7 +291,7 @@ nrfx_err_t nrfx_twim_init(nrfx_twim_t const *        p_instance,
                           void *                     p_context)
 {
     NRFX_ASSERT(p_config);
-    twim_control_block_t * p_cb  = &m_cb[p_instance->drv_inst_idx];
+    twim_control_block_t * p_cb  = &m_cb[TWIM_IDX(p_instance)];
     nrfx_err_t err_code;
 
     if (p_cb->state != NRFX_DRV_STATE_UNINITIALIZED)
@@ -272,8 +307,8 @@ nrfx_err_t nrfx_twim_init(nrfx_twim_t const *        p_instance,
     static nrfx_irq_handler_t const irq_handlers[NRFX_TWIM_ENABLED_COUNT] = {
         NRFX_INSTANCE_IRQ_HANDLERS_LIST(TWIM, twim)
     };
-    if (nrfx_prs_acquire(p_instance->p_twim,
-            irq_handlers[p_instance->drv_inst_idx]) != NRFX_SUCCESS)
+    if (nrfx_prs_acquire(TWIM_REG(p_instance),
+            irq_handlers[TWIM_IDX(p_instance)]) != NRFX_SUCCESS)
     {
         err_code = NRFX_ERROR_BUSY;
         NRFX_LOG_WARNING("Function: %s, error code: %s.",
@@ -316,7 +351,7 @@ nrfx_err_t nrfx_twim_reconfigure(nrfx_twim_t const *        p_instance,
                                  nrfx_twim_config_t const * p_config)
 {
     NRFX_ASSERT(p_config);
-    twim_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    twim_control_block_t * p_cb = &m_cb[TWIM_IDX(p_instance)];
 
     if (p_cb->state == NRFX_DRV_STATE_UNINITIALIZED)
     {
@@ -326,29 +361,29 @@ nrfx_err_t nrfx_twim_reconfigure(nrfx_twim_t const *        p_instance,
     {
         return NRFX_ERROR_BUSY;
     }
-    nrfy_twim_disable(p_instance->p_twim);
+    nrfy_twim_disable(TWIM_REG(p_instance));
     twim_configure(p_instance, p_config);
-    nrfy_twim_enable(p_instance->p_twim);
+    nrfy_twim_enable(TWIM_REG(p_instance));
     return NRFX_SUCCESS;
 }
 
 void nrfx_twim_uninit(nrfx_twim_t const * p_instance)
 {
-    twim_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    twim_control_block_t * p_cb = &m_cb[TWIM_IDX(p_instance)];
     NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
 
-    nrfy_twim_int_uninit(p_instance->p_twim);
+    nrfy_twim_int_uninit(TWIM_REG(p_instance));
     nrfx_twim_disable(p_instance);
 
 #if NRFX_CHECK(NRFX_PRS_ENABLED)
-    nrfx_prs_release(p_instance->p_twim);
+    nrfx_prs_release(TWIM_REG(p_instance));
 #endif
 
     if (!p_cb->skip_gpio_cfg && !p_cb->hold_bus_uninit)
     {
         nrfy_twim_pins_t pins;
 
-        nrfy_twim_pins_get(p_instance->p_twim, &pins);
+        nrfy_twim_pins_get(TWIM_REG(p_instance), &pins);
         nrfy_gpio_cfg_default(pins.scl_pin);
         nrfy_gpio_cfg_default(pins.sda_pin);
     }
@@ -359,10 +394,10 @@ void nrfx_twim_uninit(nrfx_twim_t const * p_instance)
 
 void nrfx_twim_enable(nrfx_twim_t const * p_instance)
 {
-    twim_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    twim_control_block_t * p_cb = &m_cb[TWIM_IDX(p_instance)];
     NRFX_ASSERT(p_cb->state == NRFX_DRV_STATE_INITIALIZED);
 
-    nrfy_twim_enable(p_instance->p_twim);
+    nrfy_twim_enable(TWIM_REG(p_instance));
 
     p_cb->state = NRFX_DRV_STATE_POWERED_ON;
     NRFX_LOG_INFO("Instance enabled: %d.", p_instance->drv_inst_idx);
@@ -370,19 +405,22 @@ void nrfx_twim_enable(nrfx_twim_t const * p_instance)
 
 void nrfx_twim_disable(nrfx_twim_t const * p_instance)
 {
-    twim_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    twim_control_block_t * p_cb = &m_cb[TWIM_IDX(p_instance)];
     NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
 
     p_cb->int_mask = 0;
-    nrfy_twim_stop(p_instance->p_twim);
+    nrfy_twim_stop(TWIM_REG(p_instance));
     p_cb->state = NRFX_DRV_STATE_INITIALIZED;
     p_cb->busy = false;
+#if NRFX_CHECK(NRFX_TWIM_CONFIG_MSG_LIST_ENABLED)
+    p_cb->p_msgs = NULL;
+#endif
     NRFX_LOG_INFO("Instance disabled: %d.", p_instance->drv_inst_idx);
 }
 
 bool nrfx_twim_is_busy(nrfx_twim_t const * p_instance)
 {
-    twim_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    twim_control_block_t * p_cb = &m_cb[TWIM_IDX(p_instance)];
     return p_cb->busy;
 }
 
@@ -595,7 +633,7 @@ nrfx_err_t nrfx_twim_xfer(nrfx_twim_t           const * p_instance,
                                      p_xfer_desc->secondary_length));
 
     nrfx_err_t err_code = NRFX_SUCCESS;
-    twim_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    twim_control_block_t * p_cb = &m_cb[TWIM_IDX(p_instance)];
 
     // TXRX and TXTX transfers are supported only in non-blocking mode.
     NRFX_ASSERT( !((p_cb->handler == NULL) && (p_xfer_desc->type == NRFX_TWIM_XFER_TXRX)));
@@ -614,23 +652,658 @@ nrfx_err_t nrfx_twim_xfer(nrfx_twim_t           const * p_instance,
                            p_xfer_desc->secondary_length *
                            sizeof(p_xfer_desc->p_secondary_buf[0]));
 
-    err_code = twim_xfer(p_cb, (NRF_TWIM_Type *)p_instance->p_twim, p_xfer_desc, flags);
+    err_code = twim_xfer(p_cb, (NRF_TWIM_Type *)TWIM_REG(p_instance), p_xfer_desc, flags);
     NRFX_LOG_WARNING("Function: %s, error code: %s.",
                      __func__,
                      NRFX_LOG_ERROR_STRING_GET(err_code));
     return err_code;
 }
 
+#if NRFX_CHECK(NRFX_TWIM_CONFIG_MSG_LIST_ENABLED)
+/*
+ * Finds the chain of messages, starting at @p first, that is executed by the peripheral
+ * using shortcuts only. The chain contains at most one write and one read message,
+ * as only one TXD and one RXD buffer can be set up at a time. It ends with a STOP
+ * condition or, after a write, with suspending the peripheral.
+ * Returns false if the message following a read without STOP cannot be chained.
+ */
+static bool msgs_chain_get(nrfx_twim_msg_t const * p_msgs,
+                           size_t                  count,
+                           size_t                  first,
+                           size_t *                p_last,
+                           uint32_t *              p_shorts)
+{
+    bool     tx_used = false;
+    bool     rx_used = false;
+    uint32_t shorts  = 0;
+    size_t   idx     = first;
+
+    while (true)
+    {
+        nrfx_twim_msg_t const * p_msg = &p_msgs[idx];
+
+        if ((idx == count - 1) || p_msg->stop)
+        {
+            shorts |= p_msg->read ? NRF_TWIM_SHORT_LASTRX_STOP_MASK :
+                                    NRF_TWIM_SHORT_LASTTX_STOP_MASK;
+            break;
+        }
+
+        nrfx_twim_msg_t const * p_next = &p_msgs[idx + 1];
+        bool chainable = (p_next->address == p_msg->address) && (p_next->read != p_msg->read);
+
+        if (p_msg->read)
+        {
+            rx_used = true;
+            if (!chainable || tx_used)
+            {
+                return false;
+            }
+            shorts |= NRF_TWIM_SHORT_LASTRX_STARTTX_MASK;
+        }
+        else
+        {
+            tx_used = true;
+            if (!chainable || rx_used)
+            {
+                shorts |= NRF_TWIM_SHORT_LASTTX_SUSPEND_MASK;
+                break;
+            }
+            shorts |= NRF_TWIM_SHORT_LASTTX_STARTRX_MASK;
+        }
+        idx++;
+    }
+
+    *p_last   = idx;
+    *p_shorts = shorts;
+    return true;
+}
+
+static void msgs_chain_start(NRF_TWIM_Type * p_twim, twim_control_block_t * p_cb, bool resume)
+{
+    nrfx_twim_msg_t const * p_first = &p_cb->p_msgs[p_cb->msgs_first];
+    uint32_t                shorts  = 0;
+
+    // The list was validated before the transaction started, so the chain exists.
+    (void)msgs_chain_get(p_cb->p_msgs, p_cb->msgs_count, p_cb->msgs_first,
+                         &p_cb->msgs_last, &shorts);
+
+    for (size_t idx = p_cb->msgs_first; idx <= p_cb->msgs_last; idx++)
+    {
+        nrfy_twim_xfer_desc_t xfer = {
+            .p_buffer = p_cb->p_msgs[idx].p_data,
+            .length   = p_cb->p_msgs[idx].length,
+        };
+
+        if (p_cb->p_msgs[idx].read)
+        {
+            nrfy_twim_rx_buffer_set(p_twim, &xfer);
+        }
+        else
+        {
+            nrfy_twim_tx_buffer_set(p_twim, &xfer);
+        }
+    }
+
+    nrfy_twim_event_clear(p_twim, NRF_TWIM_EVENT_LASTTX);
+    nrfy_twim_event_clear(p_twim, NRF_TWIM_EVENT_LASTRX);
+    nrfy_twim_address_set(p_twim, p_first->address);
+    nrfy_twim_shorts_set(p_twim, shorts);
+
+    nrfy_twim_int_disable(p_twim, NRF_TWIM_ALL_INTS_MASK);
+    p_cb->int_mask = NRF_TWIM_INT_STOPPED_MASK | NRF_TWIM_INT_ERROR_MASK;
+    if (shorts & NRF_TWIM_SHORT_LASTTX_SUSPEND_MASK)
+    {
+        p_cb->int_mask |= NRF_TWIM_INT_SUSPENDED_MASK;
+    }
+    nrfy_twim_int_enable(p_twim, p_cb->int_mask);
+
+    nrfy_twim_task_trigger(p_twim, p_first->read ? NRF_TWIM_TASK_STARTRX :
+                                                   NRF_TWIM_TASK_STARTTX);
+    if (resume)
+    {
+        // Peripheral is suspended after the previous write, resuming it generates
+        // a repeated START condition.
+        nrfy_twim_task_trigger(p_twim, NRF_TWIM_TASK_RESUME);
+    }
+}
+
+/*
+ * Checks whether all messages of the ongoing chain were transferred completely.
+ * Stores the index of the first incomplete message, or of the last message
+ * of the chain if there is none, in @p p_idx.
+ */
+static bool msgs_chain_complete_check(NRF_TWIM_Type *              p_twim,
+                                      twim_control_block_t const * p_cb,
+                                      size_t *                     p_idx)
+{
+    for (size_t idx = p_cb->msgs_first; idx <= p_cb->msgs_last; idx++)
+    {
+        nrfx_twim_msg_t const * p_msg = &p_cb->p_msgs[idx];
+        size_t amount = p_msg->read ? nrfy_twim_rxd_amount_get(p_twim) :
+                                      nrfy_twim_txd_amount_get(p_twim);
+
+        if (amount != p_msg->length)
+        {
+            *p_idx = idx;
+            return false;
+        }
+        if (p_msg->read)
+        {
+            NRFY_CACHE_INV(p_msg->p_data, p_msg->length);
+        }
+    }
+
+    *p_idx = p_cb->msgs_last;
+    return true;
+}
+
+nrfx_err_t nrfx_twim_xfer_msgs(nrfx_twim_t     const * p_instance,
+                               nrfx_twim_msg_t const * p_msgs,
+                               size_t                  count)
+{
+    NRFX_ASSERT(p_msgs);
+
+    nrfx_err_t err_code;
+    twim_control_block_t * p_cb   = &m_cb[TWIM_IDX(p_instance)];
+    NRF_TWIM_Type *        p_twim = TWIM_REG(p_instance);
+
+    if (!p_cb->handler)
+    {
+        err_code = NRFX_ERROR_FORBIDDEN;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    if (count == 0)
+    {
+        err_code = NRFX_ERROR_INVALID_PARAM;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        size_t   last;
+        uint32_t shorts;
+
+        NRFX_ASSERT(TWIM_LENGTH_VALIDATE(p_instance->drv_inst_idx, p_msgs[idx].length, 0));
+
+        if (p_msgs[idx].length == 0 ||
+            !msgs_chain_get(p_msgs, count, idx, &last, &shorts))
+        {
+            err_code = NRFX_ERROR_INVALID_PARAM;
+            NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                             __func__,
+                             NRFX_LOG_ERROR_STRING_GET(err_code));
+            return err_code;
+        }
+
+        if (!nrfx_is_in_ram(p_msgs[idx].p_data))
+        {
+            err_code = NRFX_ERROR_INVALID_ADDR;
+            NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                             __func__,
+                             NRFX_LOG_ERROR_STRING_GET(err_code));
+            return err_code;
+        }
+    }
+
+    /* Block TWI interrupts to ensure that function is not interrupted by TWI interrupt. */
+    nrfy_twim_int_disable(p_twim, NRF_TWIM_ALL_INTS_MASK);
+    if (p_cb->busy)
+    {
+        nrfy_twim_int_enable(p_twim, p_cb->int_mask);
+        err_code = NRFX_ERROR_BUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    NRFX_LOG_INFO("Transaction of %d messages.", count);
+
+    p_cb->busy       = true;
+    p_cb->error      = false;
+    p_cb->repeated   = false;
+    p_cb->flags      = 0;
+    p_cb->p_msgs     = p_msgs;
+    p_cb->msgs_count = count;
+    p_cb->msgs_first = 0;
+
+    nrfy_twim_event_clear(p_twim, NRF_TWIM_EVENT_SUSPENDED);
+    nrfy_twim_event_clear(p_twim, NRF_TWIM_EVENT_ERROR);
+    nrfy_twim_event_clear(p_twim, NRF_TWIM_EVENT_STOPPED);
+    (void)nrfy_twim_errorsrc_get_and_clear(p_twim);
+#if NRFY_TWIM_HAS_ARRAY_LIST
+    nrfy_twim_tx_list_set(p_twim, false);
+    nrfy_twim_rx_list_set(p_twim, false);
+#endif
+
+    // Peripheral may be left suspended by a previous TX transfer without STOP condition.
+    nrfy_twim_task_trigger(p_twim, NRF_TWIM_TASK_RESUME);
+    msgs_chain_start(p_twim, p_cb, false);
+
+    return NRFX_SUCCESS;
+}
+
+static void msgs_irq_handler(NRF_TWIM_Type * p_twim, twim_control_block_t * p_cb)
+{
+    size_t idx;
+
+    bool stopped = nrfy_twim_events_process(p_twim,
+                                            NRFY_EVENT_TO_INT_BITMASK(NRF_TWIM_EVENT_STOPPED),
+                                            NULL);
+
+    if (nrfy_twim_events_process(p_twim,
+                                 NRFY_EVENT_TO_INT_BITMASK(NRF_TWIM_EVENT_ERROR),
+                                 NULL))
+    {
+        NRFX_LOG_DEBUG("TWIM: Event: %s.", EVT_TO_STR_TWIM(NRF_TWIM_EVENT_ERROR));
+        p_cb->error = true;
+        if (!stopped)
+        {
+            nrfy_twim_int_disable(p_twim, p_cb->int_mask);
+            p_cb->int_mask = NRF_TWIM_INT_STOPPED_MASK;
+            nrfy_twim_int_enable(p_twim, p_cb->int_mask);
+
+            if (!(nrfy_twim_events_process(p_twim,
+                                           NRFY_EVENT_TO_INT_BITMASK(NRF_TWIM_EVENT_LASTTX),
+                                           NULL) &&
+                 (nrfy_twim_shorts_get(p_twim) & NRF_TWIM_SHORT_LASTTX_STOP_MASK)))
+            {
+                nrfy_twim_task_trigger(p_twim, NRF_TWIM_TASK_RESUME);
+                nrfy_twim_task_trigger(p_twim, NRF_TWIM_TASK_STOP);
+            }
+            return;
+        }
+    }
+
+    if (stopped)
+    {
+        NRFX_LOG_DEBUG("TWIM: Event: %s.", EVT_TO_STR_TWIM(NRF_TWIM_EVENT_STOPPED));
+
+        if (!msgs_chain_complete_check(p_twim, p_cb, &idx) && !p_cb->error)
+        {
+            // Premature STOP condition, see xfer_completeness_check().
+            nrfy_twim_disable(p_twim);
+            nrfy_twim_enable(p_twim);
+            p_cb->error = true;
+        }
+
+        if (!p_cb->error && (p_cb->msgs_last + 1 < p_cb->msgs_count))
+        {
+            p_cb->msgs_first = p_cb->msgs_last + 1;
+            msgs_chain_start(p_twim, p_cb, false);
+            return;
+        }
+    }
+    else if (nrfy_twim_events_process(p_twim,
+                                      NRFY_EVENT_TO_INT_BITMASK(NRF_TWIM_EVENT_SUSPENDED),
+                                      NULL))
+    {
+        NRFX_LOG_DEBUG("TWIM: Event: %s.", EVT_TO_STR_TWIM(NRF_TWIM_EVENT_SUSPENDED));
+
+        // Chains ending with suspending the peripheral are never the last ones.
+        p_cb->msgs_first = p_cb->msgs_last + 1;
+        msgs_chain_start(p_twim, p_cb, true);
+        return;
+    }
+    else
+    {
+        return;
+    }
+
+    nrfy_twim_shorts_set(p_twim, 0);
+    p_cb->int_mask = 0;
+    nrfy_twim_int_disable(p_twim, NRF_TWIM_ALL_INTS_MASK);
+    NRFY_IRQ_PENDING_CLEAR(nrfx_get_irq_number(p_twim));
+
+    nrfx_twim_msg_t const * p_msg = &p_cb->p_msgs[idx];
+    nrfx_twim_evt_t event = {
+        .xfer_desc = {
+            .type           = p_msg->read ? NRFX_TWIM_XFER_RX : NRFX_TWIM_XFER_TX,
+            .address        = p_msg->address,
+            .primary_length = p_msg->length,
+            .p_primary_buf  = p_msg->p_data,
+        },
+    };
+
+    uint32_t errorsrc = nrfy_twim_errorsrc_get_and_clear(p_twim);
+    if (errorsrc & NRF_TWIM_ERROR_ADDRESS_NACK)
+    {
+        event.type = NRFX_TWIM_EVT_ADDRESS_NACK;
+    }
+    else if (errorsrc & NRF_TWIM_ERROR_DATA_NACK)
+    {
+        event.type = NRFX_TWIM_EVT_DATA_NACK;
+    }
+    else if (errorsrc & NRF_TWIM_ERROR_OVERRUN)
+    {
+        event.type = NRFX_TWIM_EVT_OVERRUN;
+    }
+    else if (p_cb->error)
+    {
+        event.type = NRFX_TWIM_EVT_BUS_ERROR;
+    }
+    else
+    {
+        event.type = NRFX_TWIM_EVT_DONE;
+    }
+    NRFX_LOG_DEBUG("Event: %s.", EVT_TO_STR(event.type));
+
+    p_cb->p_msgs = NULL;
+    p_cb->busy   = false;
+    p_cb->handler(&event, p_cb->p_context);
+}
+#endif // NRFX_CHECK(NRFX_TWIM_CONFIG_MSG_LIST_ENABLED)
+
+#if NRFX_CHECK(NRFX_TWIM_CONFIG_STREAM_ENABLED)
+static size_t twim_stream_block_size_get(nrfx_twim_stream_config_t const * p_config)
+{
+    return p_config->sample_length * p_config->block_samples;
+}
+
+static void twim_stream_end(NRF_TWIM_Type * p_twim, twim_control_block_t * p_cb)
+{
+    twim_stream_t * p_stream = &p_cb->stream;
+
+    nrfy_timer_task_trigger(p_stream->config.p_sample_timer, NRF_TIMER_TASK_STOP);
+    nrfy_timer_task_trigger(p_stream->config.p_count_timer, NRF_TIMER_TASK_STOP);
+    nrfy_timer_int_disable(p_stream->config.p_count_timer, NRF_TIMER_INT_COMPARE0_MASK);
+    nrfy_timer_int_uninit(p_stream->config.p_count_timer);
+
+    nrfx_gppi_channels_disable(NRFX_BIT(p_stream->start_channel) |
+                               NRFX_BIT(p_stream->count_channel));
+    (void)nrfx_gppi_channel_free(p_stream->start_channel);
+    (void)nrfx_gppi_channel_free(p_stream->count_channel);
+
+    p_cb->int_mask = 0;
+    nrfy_twim_int_disable(p_twim, NRF_TWIM_ALL_INTS_MASK);
+    NRFY_IRQ_PENDING_CLEAR(nrfx_get_irq_number(p_twim));
+    nrfy_twim_rx_list_set(p_twim, false);
+
+    p_stream->active = false;
+    p_cb->busy       = false;
+}
+
+nrfx_err_t nrfx_twim_stream_start(nrfx_twim_t const *               p_instance,
+                                  nrfx_twim_stream_config_t const * p_config)
+{
+    twim_control_block_t * p_cb     = &m_cb[TWIM_IDX(p_instance)];
+    twim_stream_t *        p_stream = &p_cb->stream;
+    NRF_TWIM_Type *        p_twim   = TWIM_REG(p_instance);
+    NRFX_ASSERT(p_cb->state == NRFX_DRV_STATE_POWERED_ON);
+    NRFX_ASSERT(p_config->p_buffer);
+    NRFX_ASSERT(p_config->p_cmd != NULL || p_config->cmd_length == 0);
+    NRFX_ASSERT(p_config->sample_length > 0);
+    NRFX_ASSERT(p_config->block_samples > 0);
+    NRFX_ASSERT(p_config->block_count >= 2);
+    NRFX_ASSERT(p_config->p_sample_timer && p_config->p_count_timer);
+    NRFX_ASSERT(TWIM_LENGTH_VALIDATE(p_instance->drv_inst_idx,
+                                     p_config->cmd_length,
+                                     p_config->sample_length));
+
+    nrfx_err_t err_code = NRFX_SUCCESS;
+    uint32_t   base     = NRF_TIMER_BASE_FREQUENCY_GET(p_config->p_sample_timer);
+
+    if (!p_cb->handler)
+    {
+        err_code = NRFX_ERROR_FORBIDDEN;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    if ((p_config->sample_rate == 0) || (p_config->sample_rate > base))
+    {
+        err_code = NRFX_ERROR_INVALID_PARAM;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    if ((p_config->cmd_length != 0 && !nrfx_is_in_ram(p_config->p_cmd)) ||
+        !nrfx_is_in_ram(p_config->p_buffer))
+    {
+        err_code = NRFX_ERROR_INVALID_ADDR;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    /* Block TWI interrupts to ensure that function is not interrupted by TWI interrupt. */
+    nrfy_twim_int_disable(p_twim, NRF_TWIM_ALL_INTS_MASK);
+    if (p_cb->busy)
+    {
+        nrfy_twim_int_enable(p_twim, p_cb->int_mask);
+        err_code = NRFX_ERROR_BUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    if (nrfx_gppi_channel_alloc(&p_stream->start_channel) != NRFX_SUCCESS)
+    {
+        err_code = NRFX_ERROR_NO_MEM;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+    if (nrfx_gppi_channel_alloc(&p_stream->count_channel) != NRFX_SUCCESS)
+    {
+        (void)nrfx_gppi_channel_free(p_stream->start_channel);
+        err_code = NRFX_ERROR_NO_MEM;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    p_cb->busy          = true;
+    p_cb->error         = false;
+    p_stream->config    = *p_config;
+    p_stream->block_idx = 0;
+    p_stream->active    = true;
+
+    // The command is written from the same place in each transfer, while ArrayList moves
+    // the reception by one sample after each transfer.
+    nrfy_twim_xfer_desc_t tx_desc = {
+        .p_buffer = (uint8_t *)p_config->p_cmd,
+        .length   = p_config->cmd_length
+    };
+    nrfy_twim_xfer_desc_t rx_desc = {
+        .p_buffer = p_config->p_buffer,
+        .length   = p_config->sample_length
+    };
+    bool            has_cmd    = (p_config->cmd_length != 0);
+    nrf_twim_task_t start_task = has_cmd ? NRF_TWIM_TASK_STARTTX : NRF_TWIM_TASK_STARTRX;
+
+    nrfy_twim_address_set(p_twim, p_config->address);
+    nrfy_twim_tx_list_set(p_twim, false);
+    nrfy_twim_rx_list_set(p_twim, true);
+    if (has_cmd)
+    {
+        nrfy_twim_tx_buffer_set(p_twim, &tx_desc);
+    }
+    nrfy_twim_rx_buffer_set(p_twim, &rx_desc);
+    nrfy_twim_shorts_set(p_twim, (has_cmd ? NRF_TWIM_SHORT_LASTTX_STARTRX_MASK : 0) |
+                                 NRF_TWIM_SHORT_LASTRX_STOP_MASK);
+    nrfy_twim_event_clear(p_twim, NRF_TWIM_EVENT_ERROR);
+    nrfy_twim_event_clear(p_twim, NRF_TWIM_EVENT_STOPPED);
+    (void)nrfy_twim_errorsrc_get_and_clear(p_twim);
+    // Peripheral may be left suspended by a previous TX transfer without STOP condition.
+    nrfy_twim_task_trigger(p_twim, NRF_TWIM_TASK_RESUME);
+
+    // Only errors wake up the CPU, samples are counted by the TIMER.
+    p_cb->int_mask = NRF_TWIM_INT_ERROR_MASK;
+    nrfy_twim_int_enable(p_twim, p_cb->int_mask);
+
+    nrfy_timer_config_t count_config = {
+        .prescaler = 0,
+        .mode      = NRF_TIMER_MODE_COUNTER,
+        .bit_width = NRF_TIMER_BIT_WIDTH_32
+    };
+    nrfy_timer_task_trigger(p_config->p_count_timer, NRF_TIMER_TASK_STOP);
+    nrfy_timer_periph_configure(p_config->p_count_timer, &count_config);
+    nrfy_timer_task_trigger(p_config->p_count_timer, NRF_TIMER_TASK_CLEAR);
+    nrfy_timer_cc_set(p_config->p_count_timer, NRF_TIMER_CC_CHANNEL0, p_config->block_samples);
+    nrfy_timer_shorts_enable(p_config->p_count_timer, NRF_TIMER_SHORT_COMPARE0_CLEAR_MASK);
+    nrfy_timer_int_init(p_config->p_count_timer,
+                        NRF_TIMER_INT_COMPARE0_MASK,
+                        p_config->irq_priority,
+                        true);
+    nrfy_timer_task_trigger(p_config->p_count_timer, NRF_TIMER_TASK_START);
+
+    nrfy_timer_config_t sample_config = {
+        .prescaler = 0,
+        .mode      = NRF_TIMER_MODE_TIMER,
+        .bit_width = NRF_TIMER_BIT_WIDTH_32
+    };
+    nrfy_timer_task_trigger(p_config->p_sample_timer, NRF_TIMER_TASK_STOP);
+    nrfy_timer_periph_configure(p_config->p_sample_timer, &sample_config);
+    nrfy_timer_task_trigger(p_config->p_sample_timer, NRF_TIMER_TASK_CLEAR);
+    nrfy_timer_cc_set(p_config->p_sample_timer, NRF_TIMER_CC_CHANNEL0,
+                      base / p_config->sample_rate);
+    nrfy_timer_shorts_enable(p_config->p_sample_timer, NRF_TIMER_SHORT_COMPARE0_CLEAR_MASK);
+
+    nrfx_gppi_channel_endpoints_setup(p_stream->start_channel,
+        nrfy_timer_event_address_get(p_config->p_sample_timer, NRF_TIMER_EVENT_COMPARE0),
+        nrfy_twim_task_address_get(p_twim, start_task));
+    nrfx_gppi_channel_endpoints_setup(p_stream->count_channel,
+        nrfy_twim_event_address_get(p_twim, NRF_TWIM_EVENT_STOPPED),
+        nrfy_timer_task_address_get(p_config->p_count_timer, NRF_TIMER_TASK_COUNT));
+    nrfx_gppi_channels_enable(NRFX_BIT(p_stream->start_channel) |
+                              NRFX_BIT(p_stream->count_channel));
+
+    NRFX_LOG_INFO("Stream: %d Hz, %d blocks of %d samples.", p_config->sample_rate,
+                  p_config->block_count, p_config->block_samples);
+
+    nrfy_timer_task_trigger(p_config->p_sample_timer, NRF_TIMER_TASK_START);
+
+    return err_code;
+}
+
+void nrfx_twim_stream_stop(nrfx_twim_t const * p_instance)
+{
+    twim_control_block_t * p_cb = &m_cb[TWIM_IDX(p_instance)];
+    NRFX_ASSERT(p_cb->stream.active);
+
+    twim_stream_end(TWIM_REG(p_instance), p_cb);
+    // Finish the sample transfer that may be in progress.
+    nrfy_twim_task_trigger(TWIM_REG(p_instance), NRF_TWIM_TASK_STOP);
+    nrfy_twim_shorts_set(TWIM_REG(p_instance), 0);
+    NRFX_LOG_INFO("Stream stopped.");
+}
+
+void nrfx_twim_stream_irq_handler(nrfx_twim_t const * p_instance)
+{
+    twim_control_block_t * p_cb     = &m_cb[TWIM_IDX(p_instance)];
+    twim_stream_t *        p_stream = &p_cb->stream;
+
+    if (!p_stream->active ||
+        !nrfy_timer_events_process(p_stream->config.p_count_timer,
+                                   NRFY_EVENT_TO_INT_BITMASK(NRF_TIMER_EVENT_COMPARE0)))
+    {
+        return;
+    }
+
+    size_t    block_size = twim_stream_block_size_get(&p_stream->config);
+    uint8_t * p_block    = p_stream->config.p_buffer + p_stream->block_idx * block_size;
+
+    p_stream->block_idx = (uint8_t)((p_stream->block_idx + 1) % p_stream->config.block_count);
+    if (p_stream->block_idx == 0)
+    {
+        // ArrayList would continue past the ring, so the next sample goes to its beginning.
+        nrfy_twim_xfer_desc_t rx_desc = {
+            .p_buffer = p_stream->config.p_buffer,
+            .length   = p_stream->config.sample_length
+        };
+        nrfy_twim_rx_buffer_set(TWIM_REG(p_instance), &rx_desc);
+    }
+
+    NRFY_CACHE_INV(p_block, block_size);
+
+    nrfx_twim_evt_t event = {
+        .type      = NRFX_TWIM_EVT_BLOCK_DONE,
+        .xfer_desc = NRFX_TWIM_XFER_DESC_TXRX(p_stream->config.address,
+                                              (uint8_t *)p_stream->config.p_cmd,
+                                              p_stream->config.cmd_length,
+                                              p_block,
+                                              block_size),
+    };
+    p_cb->handler(&event, p_cb->p_context);
+}
+
+static void twim_stream_irq_handler(NRF_TWIM_Type * p_twim, twim_control_block_t * p_cb)
+{
+    if (!nrfy_twim_events_process(p_twim,
+                                  NRFY_EVENT_TO_INT_BITMASK(NRF_TWIM_EVENT_ERROR),
+                                  NULL))
+    {
+        return;
+    }
+
+    NRFX_LOG_DEBUG("TWIM: Event: %s.", EVT_TO_STR_TWIM(NRF_TWIM_EVENT_ERROR));
+
+    nrfx_twim_stream_config_t const * p_config = &p_cb->stream.config;
+    nrfx_twim_evt_t event = {
+        .xfer_desc = NRFX_TWIM_XFER_DESC_TXRX(p_config->address,
+                                              (uint8_t *)p_config->p_cmd,
+                                              p_config->cmd_length,
+                                              p_config->p_buffer +
+                                              p_cb->stream.block_idx *
+                                              twim_stream_block_size_get(p_config),
+                                              twim_stream_block_size_get(p_config)),
+    };
+
+    twim_stream_end(p_twim, p_cb);
+    nrfy_twim_task_trigger(p_twim, NRF_TWIM_TASK_RESUME);
+    nrfy_twim_task_trigger(p_twim, NRF_TWIM_TASK_STOP);
+    nrfy_twim_shorts_set(p_twim, 0);
+
+    uint32_t errorsrc = nrfy_twim_errorsrc_get_and_clear(p_twim);
+    if (errorsrc & NRF_TWIM_ERROR_ADDRESS_NACK)
+    {
+        event.type = NRFX_TWIM_EVT_ADDRESS_NACK;
+    }
+    else if (errorsrc & NRF_TWIM_ERROR_DATA_NACK)
+    {
+        event.type = NRFX_TWIM_EVT_DATA_NACK;
+    }
+    else if (errorsrc & NRF_TWIM_ERROR_OVERRUN)
+    {
+        event.type = NRFX_TWIM_EVT_OVERRUN;
+    }
+    else
+    {
+        event.type = NRFX_TWIM_EVT_BUS_ERROR;
+    }
+    NRFX_LOG_DEBUG("Event: %s.", EVT_TO_STR(event.type));
+
+    p_cb->handler(&event, p_cb->p_context);
+}
+#endif // NRFX_CHECK(NRFX_TWIM_CONFIG_STREAM_ENABLED)
+
 uint32_t nrfx_twim_start_task_address_get(nrfx_twim_t const *   p_instance,
                                           nrfx_twim_xfer_type_t xfer_type)
 {
-    return nrfy_twim_task_address_get(p_instance->p_twim,
+    return nrfy_twim_task_address_get(TWIM_REG(p_instance),
         (xfer_type != NRFX_TWIM_XFER_RX) ? NRF_TWIM_TASK_STARTTX : NRF_TWIM_TASK_STARTRX);
 }
 
 uint32_t nrfx_twim_stopped_event_address_get(nrfx_twim_t const * p_instance)
 {
-    return nrfy_twim_event_address_get(p_instance->p_twim, NRF_TWIM_EVENT_STOPPED);
+    return nrfy_twim_event_address_get(TWIM_REG(p_instance), NRF_TWIM_EVENT_STOPPED);
 }
 
 static void irq_handler(NRF_TWIM_Type * p_twim, twim_control_block_t * p_cb)
@@ -662,6 +1335,21 @@ static void irq_handler(NRF_TWIM_Type * p_twim, twim_control_block_t * p_cb)
 #endif
     NRFX_ASSERT(p_cb->handler);
 
+#if NRFX_CHECK(NRFX_TWIM_CONFIG_MSG_LIST_ENABLED)
+    if (p_cb->p_msgs)
+    {
+        msgs_irq_handler(p_twim, p_cb);
+        return;
+    }
+#endif
+#if NRFX_CHECK(NRFX_TWIM_CONFIG_STREAM_ENABLED)
+    if (p_cb->stream.active)
+    {
+        twim_stream_irq_handler(p_twim, p_cb);
+        return;
+    }
+#endif
+
     bool stopped = nrfy_twim_events_process(p_twim,
                                             NRFY_EVENT_TO_INT_BITMASK(NRF_TWIM_EVENT_STOPPED),
                                             p_xfer);
@@ -83,6 +83,13 @@ typedef struct
 
     volatile bool                   semaphore;
     bool                            skip_gpio_cfg;
+
+    // Register map mode, active when p_regmap is not NULL.
+    uint8_t *                       p_regmap;
+    uint16_t                        regmap_size;
+    uint16_t                        reg_ptr;
+    uint8_t *                       p_regmap_rx;
+    size_t                          regmap_rx_size;
 } twis_control_block_t;
 static twis_control_block_t m_cb[NRFX_TWIS_ENABLED_COUNT];
 
@@ -214,6 +221,96 @@ static void call_event_handler(twis_control_block_t const * p_cb,
     }
 }
 
+/**
+ * @brief Auxiliary function for processing events in the register map mode
+ *
+ * Function prepares the buffers and moves the register pointer on its own,
+ * so that the event handler is called only when the map was written.
+ *
+ * @param p_reg TWIS register address
+ * @param p_cb  Pointer to the driver instance control block.
+ * @param p_evt Event to process
+ */
+static void regmap_event_process(NRF_TWIS_Type *         p_reg,
+                                 twis_control_block_t *  p_cb,
+                                 nrfx_twis_evt_t const * p_evt)
+{
+    switch (p_evt->type)
+    {
+        case NRFX_TWIS_EVT_READ_REQ:
+            if (p_evt->data.buf_req)
+            {
+                nrf_twis_tx_prepare(p_reg,
+                                    &p_cb->p_regmap[p_cb->reg_ptr],
+                                    (size_t)(p_cb->regmap_size - p_cb->reg_ptr));
+            }
+            break;
+
+        case NRFX_TWIS_EVT_READ_DONE:
+            p_cb->reg_ptr = (uint16_t)NRFX_MIN(p_cb->reg_ptr + p_evt->data.tx_amount,
+                                               p_cb->regmap_size);
+            break;
+
+        case NRFX_TWIS_EVT_WRITE_REQ:
+            if (p_evt->data.buf_req)
+            {
+                nrf_twis_rx_prepare(p_reg, p_cb->p_regmap_rx, p_cb->regmap_rx_size);
+            }
+            break;
+
+        case NRFX_TWIS_EVT_WRITE_DONE:
+            if (p_evt->data.rx_amount > 0)
+            {
+                uint16_t offset = NRFX_MIN(p_cb->p_regmap_rx[0], p_cb->regmap_size);
+                uint16_t length = (uint16_t)NRFX_MIN(p_evt->data.rx_amount - 1,
+                                                     (uint32_t)(p_cb->regmap_size - offset));
+
+                memcpy(&p_cb->p_regmap[offset], &p_cb->p_regmap_rx[1], length);
+                p_cb->reg_ptr = offset + length;
+
+                if (length > 0)
+                {
+                    nrfx_twis_evt_t evdata;
+                    evdata.type            = NRFX_TWIS_EVT_REG_WRITE;
+                    evdata.data.reg.offset = offset;
+                    evdata.data.reg.length = length;
+                    call_event_handler(p_cb, &evdata);
+                }
+            }
+            // Keep the receive buffer prepared, so the next write is not stretched.
+            nrf_twis_rx_prepare(p_reg, p_cb->p_regmap_rx, p_cb->regmap_rx_size);
+            break;
+
+        default:
+            call_event_handler(p_cb, p_evt);
+            break;
+    }
+}
+
+/**
+ * @brief Auxiliary function for passing the event further
+ *
+ * Function passes the event to the register map emulation if it is active
+ * or directly to the event handler otherwise.
+ *
+ * @param p_reg TWIS register address
+ * @param p_cb  Pointer to the driver instance control block.
+ * @param p_evt Event to pass
+ */
+static void event_dispatch(NRF_TWIS_Type *         p_reg,
+                           twis_control_block_t *  p_cb,
+                           nrfx_twis_evt_t const * p_evt)
+{
+    if (p_cb->p_regmap != NULL)
+    {
+        regmap_event_process(p_reg, p_cb, p_evt);
+    }
+    else
+    {
+        call_event_handler(p_cb, p_evt);
+    }
+}
+
 /**
  * @brief Auxiliary function for error processing
  *
@@ -294,7 +391,7 @@ static void irq_handler(NRF_TWIS_Type * p_reg, twis_control_block_t * p_cb)
                     substate = NRFX_TWIS_SUBSTATE_READ_WAITING;
                     evdata.data.buf_req = true;
                 }
-                call_event_handler(p_cb, &evdata);
+                event_dispatch(p_reg, p_cb, &evdata);
                 ev = nrfx_twis_clear_bit(ev, NRF_TWIS_EVENT_READ);
                 ev = nrfx_twis_clear_bit(ev, NRF_TWIS_EVENT_TXSTARTED);
                 ev = nrfx_twis_clear_bit(ev, NRF_TWIS_EVENT_WRITE);
@@ -313,7 +410,7 @@ static void irq_handler(NRF_TWIS_Type * p_reg, twis_control_block_t * p_cb)
                     substate = NRFX_TWIS_SUBSTATE_WRITE_WAITING;
                     evdata.data.buf_req = true;
                 }
-                call_event_handler(p_cb, &evdata);
+                event_dispatch(p_reg, p_cb, &evdata);
                 ev = nrfx_twis_clear_bit(ev, NRF_TWIS_EVENT_READ);
                 ev = nrfx_twis_clear_bit(ev, NRF_TWIS_EVENT_TXSTARTED);
                 ev = nrfx_twis_clear_bit(ev, NRF_TWIS_EVENT_WRITE);
@@ -357,7 +454,7 @@ static void irq_handler(NRF_TWIS_Type * p_reg, twis_control_block_t * p_cb)
                 NRFX_LOG_DEBUG("Tx data:");
                 NRFX_LOG_HEXDUMP_DEBUG((uint8_t const *)p_reg->TXD.PTR,
                                        evdata.data.tx_amount * sizeof(uint8_t));
-                call_event_handler(p_cb, &evdata);
+                event_dispatch(p_reg, p_cb, &evdata);
                 /* Go to idle and repeat the state machine if READ or WRITE events detected.
                  * This time READ or WRITE would be started */
                 substate = NRFX_TWIS_SUBSTATE_IDLE;
@@ -398,7 +495,7 @@ static void irq_handler(NRF_TWIS_Type * p_reg, twis_control_block_t * p_cb)
             {
                 evdata.type = NRFX_TWIS_EVT_WRITE_DONE;
                 evdata.data.rx_amount = nrf_twis_rx_amount_get(p_reg);
-                call_event_handler(p_cb, &evdata);
+                event_dispatch(p_reg, p_cb, &evdata);
                 /* Go to idle and repeat the state machine if READ or WRITE events detected.
                  * This time READ or WRITE would be started */
                 substate = NRFX_TWIS_SUBSTATE_IDLE;
@@ -547,6 +644,7 @@ nrfx_err_t nrfx_twis_init(nrfx_twis_t const *        p_instance,
         p_cb->semaphore = 0;
     }
     /* Set internal instance variables */
+    p_cb->p_regmap   = NULL;
     p_cb->substate   = NRFX_TWIS_SUBSTATE_IDLE;
     p_cb->state      = NRFX_DRV_STATE_INITIALIZED;
     err_code = NRFX_SUCCESS;
@@ -614,6 +712,11 @@ void nrfx_twis_enable(nrfx_twis_t const * p_instance)
     p_cb->error    = 0;
     p_cb->state    = NRFX_DRV_STATE_POWERED_ON;
     p_cb->substate = NRFX_TWIS_SUBSTATE_IDLE;
+
+    if (p_cb->p_regmap != NULL)
+    {
+        nrf_twis_rx_prepare(p_reg, p_cb->p_regmap_rx, p_cb->regmap_rx_size);
+    }
 }
 
 
@@ -811,6 +914,80 @@ nrfx_err_t nrfx_twis_rx_prepare(nrfx_twis_t const * p_instance,
 }
 
 
+nrfx_err_t nrfx_twis_regmap_set(nrfx_twis_t const *        p_instance,
+                                nrfx_twis_regmap_t const * p_regmap)
+{
+    nrfx_err_t err_code;
+    twis_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+
+    if ((p_cb->state == NRFX_DRV_STATE_UNINITIALIZED) || (p_cb->ev_handler == NULL))
+    {
+        err_code = NRFX_ERROR_INVALID_STATE;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+    if (p_cb->substate != NRFX_TWIS_SUBSTATE_IDLE)
+    {
+        err_code = NRFX_ERROR_BUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    if (p_regmap == NULL)
+    {
+        p_cb->p_regmap = NULL;
+        err_code = NRFX_SUCCESS;
+        NRFX_LOG_INFO("Function: %s, error code: %s.",
+                      __func__,
+                      NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+#if NRF_TWIS_HAS_DMA_REG
+    size_t maxsize = TWIS_DMA_RX_MAXCNT_MAXCNT_Msk;
+#else
+    size_t maxsize = TWIS_RXD_MAXCNT_MAXCNT_Msk;
+#endif
+    if ((p_regmap->p_map == NULL) || (p_regmap->size == 0) || (p_regmap->size > 256) ||
+        (p_regmap->p_rx_buf == NULL) || (p_regmap->rx_buf_size == 0) ||
+        ((p_regmap->rx_buf_size & maxsize) != p_regmap->rx_buf_size))
+    {
+        err_code = NRFX_ERROR_INVALID_PARAM;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+    if (!nrfx_is_in_ram(p_regmap->p_map) || !nrfx_is_in_ram(p_regmap->p_rx_buf))
+    {
+        err_code = NRFX_ERROR_INVALID_ADDR;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    p_cb->regmap_size    = (uint16_t)p_regmap->size;
+    p_cb->reg_ptr        = 0;
+    p_cb->p_regmap_rx    = p_regmap->p_rx_buf;
+    p_cb->regmap_rx_size = p_regmap->rx_buf_size;
+    p_cb->p_regmap       = p_regmap->p_map;
+
+    if (p_cb->state == NRFX_DRV_STATE_POWERED_ON)
+    {
+        nrf_twis_rx_prepare(p_instance->p_reg, p_cb->p_regmap_rx, p_cb->regmap_rx_size);
+    }
+
+    err_code = NRFX_SUCCESS;
+    NRFX_LOG_INFO("Function: %s, error code: %s.", __func__, NRFX_LOG_ERROR_STRING_GET(err_code));
+    return err_code;
+}
+
+
 bool nrfx_twis_is_busy(nrfx_twis_t const * p_instance)
 {
     nrfx_twis_preprocess_status(p_instance);
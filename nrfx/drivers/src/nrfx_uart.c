@@ -65,6 +65,12 @@ typedef struct
     size_t                    rx_secondary_buffer_length;
     volatile size_t           tx_counter;
     volatile size_t           rx_counter;
+    uint8_t                 * p_rx_ring;
+    size_t                    rx_ring_mask;
+    size_t                    rx_ring_threshold;
+    volatile size_t           rx_ring_head;
+    volatile size_t           rx_ring_tail;
+    volatile bool             rx_ring_notified;
     volatile bool             tx_abort;
     bool                      rx_enabled;
     nrfx_drv_state_t          state;
@@ -232,6 +238,7 @@ nrfx_err_t nrfx_uart_init(nrfx_uart_t const *        p_instance,
     p_cb->rx_buffer_length           = 0;
     p_cb->rx_secondary_buffer_length = 0;
     p_cb->rx_enabled                 = false;
+    p_cb->p_rx_ring                  = NULL;
     p_cb->tx_buffer_length           = 0;
     p_cb->state                      = NRFX_DRV_STATE_INITIALIZED;
     NRFX_LOG_INFO("Function: %s, error code: %s.",
@@ -281,8 +288,9 @@ void nrfx_uart_uninit(nrfx_uart_t const * p_instance)
     nrfx_prs_release(p_instance->p_reg);
 #endif
 
-    p_cb->state   = NRFX_DRV_STATE_UNINITIALIZED;
-    p_cb->handler = NULL;
+    p_cb->state     = NRFX_DRV_STATE_UNINITIALIZED;
+    p_cb->handler   = NULL;
+    p_cb->p_rx_ring = NULL;
     NRFX_LOG_INFO("Instance uninitialized: %d.", p_instance->drv_inst_idx);
 }
 
@@ -413,6 +421,15 @@ nrfx_err_t nrfx_uart_rx(nrfx_uart_t const * p_instance,
 
     bool second_buffer = false;
 
+    if (p_cb->p_rx_ring)
+    {
+        err_code = NRFX_ERROR_BUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
     if (p_cb->handler)
     {
         nrf_uart_int_disable(p_instance->p_reg, NRF_UART_INT_MASK_RXDRDY |
@@ -538,6 +555,87 @@ void nrfx_uart_rx_disable(nrfx_uart_t const * p_instance)
     m_cb[p_instance->drv_inst_idx].rx_enabled = false;
 }
 
+nrfx_err_t nrfx_uart_rx_ring_start(nrfx_uart_t const * p_instance,
+                                   uint8_t *           p_buffer,
+                                   size_t              size,
+                                   size_t              threshold)
+{
+    uart_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+
+    NRFX_ASSERT(p_cb->state == NRFX_DRV_STATE_INITIALIZED);
+    NRFX_ASSERT(p_cb->handler);
+    NRFX_ASSERT(p_buffer);
+    NRFX_ASSERT(NRFX_IS_POWER_OF_TWO(size));
+    NRFX_ASSERT((threshold > 0) && (threshold <= size));
+
+    nrfx_err_t err_code;
+
+    if ((p_cb->rx_buffer_length != 0) || p_cb->p_rx_ring)
+    {
+        err_code = NRFX_ERROR_BUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    p_cb->rx_ring_mask      = size - 1;
+    p_cb->rx_ring_threshold = threshold;
+    p_cb->rx_ring_head      = 0;
+    p_cb->rx_ring_tail      = 0;
+    p_cb->rx_ring_notified  = false;
+    p_cb->p_rx_ring         = p_buffer;
+
+    nrfx_uart_rx_enable(p_instance);
+    nrf_uart_int_enable(p_instance->p_reg, NRF_UART_INT_MASK_RXDRDY |
+                                           NRF_UART_INT_MASK_ERROR);
+
+    err_code = NRFX_SUCCESS;
+    NRFX_LOG_INFO("Function: %s, error code: %s.", __func__, NRFX_LOG_ERROR_STRING_GET(err_code));
+    return err_code;
+}
+
+size_t nrfx_uart_rx_ring_read(nrfx_uart_t const * p_instance,
+                              uint8_t *           p_data,
+                              size_t              length)
+{
+    uart_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+
+    NRFX_ASSERT(p_cb->p_rx_ring);
+    NRFX_ASSERT(p_data);
+
+    // The head is modified only in the interrupt context and the tail only here, so the bytes
+    // between them can be copied without locking.
+    size_t tail      = p_cb->rx_ring_tail;
+    size_t available = p_cb->rx_ring_head - tail;
+
+    if (length > available)
+    {
+        length = available;
+    }
+    for (size_t i = 0; i < length; i++)
+    {
+        p_data[i] = p_cb->p_rx_ring[(tail + i) & p_cb->rx_ring_mask];
+    }
+
+    p_cb->rx_ring_tail     = tail + length;
+    p_cb->rx_ring_notified = false;
+
+    return length;
+}
+
+void nrfx_uart_rx_ring_stop(nrfx_uart_t const * p_instance)
+{
+    uart_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+
+    nrf_uart_int_disable(p_instance->p_reg, NRF_UART_INT_MASK_RXDRDY |
+                                            NRF_UART_INT_MASK_ERROR);
+    nrfx_uart_rx_disable(p_instance);
+    p_cb->p_rx_ring = NULL;
+
+    NRFX_LOG_INFO("RX ring reception stopped.");
+}
+
 uint32_t nrfx_uart_errorsrc_get(nrfx_uart_t const * p_instance)
 {
     nrf_uart_event_clear(p_instance->p_reg, NRF_UART_EVENT_ERROR);
@@ -594,9 +692,72 @@ void nrfx_uart_rx_abort(nrfx_uart_t const * p_instance)
     NRFX_LOG_INFO("RX transaction aborted.");
 }
 
+static void rx_ring_irq_handler(NRF_UART_Type * p_uart, uart_control_block_t * p_cb)
+{
+    nrfx_uart_event_t event;
+    size_t            head    = p_cb->rx_ring_head;
+    size_t            dropped = 0;
+
+    // Move all bytes available in the RX FIFO to the ring buffer at once.
+    do
+    {
+        nrf_uart_event_clear(p_uart, NRF_UART_EVENT_RXDRDY);
+        uint8_t rxd = nrf_uart_rxd_get(p_uart);
+
+        if ((head - p_cb->rx_ring_tail) <= p_cb->rx_ring_mask)
+        {
+            p_cb->p_rx_ring[head & p_cb->rx_ring_mask] = rxd;
+            head++;
+        }
+        else
+        {
+            dropped++;
+        }
+    } while (nrf_uart_event_check(p_uart, NRF_UART_EVENT_RXDRDY));
+
+    p_cb->rx_ring_head = head;
+
+    if (dropped)
+    {
+        event.type                   = NRFX_UART_EVT_ERROR;
+        event.data.error.error_mask  = NRF_UART_ERROR_OVERRUN_MASK;
+        event.data.error.rxtx.bytes  = dropped;
+        event.data.error.rxtx.p_data = NULL;
+        p_cb->handler(&event, p_cb->p_context);
+    }
+
+    size_t available = p_cb->rx_ring_head - p_cb->rx_ring_tail;
+
+    if (!p_cb->rx_ring_notified && (available >= p_cb->rx_ring_threshold))
+    {
+        p_cb->rx_ring_notified = true;
+
+        event.type             = NRFX_UART_EVT_RX_RING;
+        event.data.rxtx.bytes  = available;
+        event.data.rxtx.p_data = NULL;
+        p_cb->handler(&event, p_cb->p_context);
+    }
+}
+
 static void irq_handler(NRF_UART_Type * p_uart, uart_control_block_t * p_cb)
 {
-    if (nrf_uart_int_enable_check(p_uart, NRF_UART_INT_MASK_ERROR) &&
+    if (p_cb->p_rx_ring &&
+        nrf_uart_int_enable_check(p_uart, NRF_UART_INT_MASK_ERROR) &&
+        nrf_uart_event_check(p_uart, NRF_UART_EVENT_ERROR))
+    {
+        nrfx_uart_event_t event;
+        nrf_uart_event_clear(p_uart, NRF_UART_EVENT_ERROR);
+        NRFX_LOG_DEBUG("Event: %s.", EVT_TO_STR(NRF_UART_EVENT_ERROR));
+
+        // The reception into the ring buffer continues after an error.
+        event.type                   = NRFX_UART_EVT_ERROR;
+        event.data.error.error_mask  = nrf_uart_errorsrc_get_and_clear(p_uart);
+        event.data.error.rxtx.bytes  = 0;
+        event.data.error.rxtx.p_data = NULL;
+
+        p_cb->handler(&event, p_cb->p_context);
+    }
+    else if (nrf_uart_int_enable_check(p_uart, NRF_UART_INT_MASK_ERROR) &&
         nrf_uart_event_check(p_uart, NRF_UART_EVENT_ERROR))
     {
         nrfx_uart_event_t event;
@@ -619,6 +780,12 @@ static void irq_handler(NRF_UART_Type * p_uart, uart_control_block_t * p_cb)
 
         p_cb->handler(&event,p_cb->p_context);
     }
+    else if (p_cb->p_rx_ring &&
+             nrf_uart_int_enable_check(p_uart, NRF_UART_INT_MASK_RXDRDY) &&
+             nrf_uart_event_check(p_uart, NRF_UART_EVENT_RXDRDY))
+    {
+        rx_ring_irq_handler(p_uart, p_cb);
+    }
     else if (nrf_uart_int_enable_check(p_uart, NRF_UART_INT_MASK_RXDRDY) &&
              nrf_uart_event_check(p_uart, NRF_UART_EVENT_RXDRDY))
     {
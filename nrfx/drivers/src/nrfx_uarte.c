@@ -43,6 +43,21 @@
 #include "prs/nrfx_prs.h"
 #include <haly/nrfy_gpio.h>
 
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_RX_RING_ENABLED)
+#include <haly/nrfy_timer.h>
+#endif
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_RX_WAKEUP_ENABLED)
+#include <nrfx_gpiote.h>
+#endif
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_RX_RING_ENABLED) ||   \
+    NRFX_CHECK(NRFX_UARTE_CONFIG_TX_LIST_ENABLED) ||   \
+    NRFX_CHECK(NRFX_UARTE_CONFIG_RX_WAKEUP_ENABLED)
+#include <helpers/nrfx_gppi.h>
+#endif
+#if NRFX_UARTE_CONFIG_TX_BOUNCE_SIZE > 0
+#include <string.h>
+#endif
+
 #define NRFX_LOG_MODULE UARTE
 #include <nrfx_log.h>
 
@@ -57,6 +72,43 @@
 #define UARTE_LENGTH_VALIDATE(drv_inst_idx, len)    \
         (NRFX_FOREACH_ENABLED(UARTE, UARTEX_LENGTH_VALIDATE, (||), (0), drv_inst_idx, len, 0))
 
+#if NRFX_UARTE_CONFIG_TX_BOUNCE_SIZE > 0
+#if (NRFX_UARTE_CONFIG_TX_BOUNCE_SIZE % 2) != 0
+#error "NRFX_UARTE_CONFIG_TX_BOUNCE_SIZE must be even."
+#endif
+// Each half of the bounce buffer holds one chunk, so that one is copied while the other is sent.
+#define TX_BOUNCE_CHUNK_SIZE (NRFX_UARTE_CONFIG_TX_BOUNCE_SIZE / 2)
+#endif
+
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_RX_RING_ENABLED)
+typedef struct
+{
+    nrfx_uarte_rx_ring_config_t config;
+    volatile bool               active;      ///< Continuous reception is ongoing.
+    bool                        stopping;    ///< STOPRX has been triggered by the user.
+    uint8_t                     fill_idx;    ///< Index of the buffer being filled by EasyDMA.
+    uint8_t                     ppi_channel; ///< (D)PPI channel connecting RXDRDY with TIMER COUNT.
+    size_t                      report_pos;  ///< Offset in the ring of the first unreported byte.
+    uint32_t                    reported;    ///< Number of reported bytes, compared with TIMER.
+} uarte_rx_ring_t;
+#endif
+
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_RX_WAKEUP_ENABLED)
+/* Value of the byte sent by the peer to wake up the receiver. */
+#define RX_WAKEUP_BYTE 0xFF
+
+typedef struct
+{
+    bool                      enabled;        ///< Reception is started by the start bit.
+    bool                      drop_byte;      ///< Leading wakeup byte is removed from received data.
+    bool                      stopping;       ///< STOPRX has been triggered after the buffer was filled.
+    uint32_t                  pin;            ///< RXD pin.
+    uint8_t                   gpiote_channel; ///< GPIOTE channel generating IN event on the start bit.
+    uint8_t                   ppi_channel;    ///< (D)PPI channel connecting IN event with STARTRX.
+    nrfx_gppi_channel_group_t group;          ///< Channel group disarming the (D)PPI channel.
+} uarte_rx_wakeup_t;
+#endif
+
 typedef struct
 {
     void                     * p_context;
@@ -71,9 +123,36 @@ typedef struct
     bool                       rx_aborted;
     bool                       skip_gpio_cfg : 1;
     bool                       skip_psel_cfg : 1;
+    uint8_t                    irq_priority;
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_RX_RING_ENABLED)
+    uarte_rx_ring_t            rx_ring;
+#endif
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_RX_WAKEUP_ENABLED)
+    uarte_rx_wakeup_t          rx_wakeup;
+#endif
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_TX_LIST_ENABLED)
+    nrfx_uarte_tx_segment_t const * p_tx_list;      ///< List being sent, NULL after the last
+                                                    ///< buffer has started.
+    size_t                          tx_list_count;  ///< Number of buffers in the list.
+    size_t                          tx_list_idx;    ///< Index of the buffer to start next.
+    size_t                          tx_list_bytes;  ///< Bytes of the buffers already sent.
+    uint8_t                         tx_ppi_channel; ///< (D)PPI channel from ENDTX to STARTTX.
+#endif
+#if NRFX_UARTE_CONFIG_TX_BOUNCE_SIZE > 0
+    uint8_t                    tx_bounce[NRFX_UARTE_CONFIG_TX_BOUNCE_SIZE];
+    uint8_t            const * p_tx_bounce_src;     ///< Next byte to copy to the bounce buffer.
+    size_t                     tx_bounce_remaining; ///< Number of bytes not copied yet.
+    size_t                     tx_bounce_pending;   ///< Length of the chunk ready to be sent.
+    size_t                     tx_bounce_bytes;     ///< Bytes of the chunks already sent.
+    uint8_t                    tx_bounce_next;      ///< Half holding the chunk ready to be sent.
+#endif
 } uarte_control_block_t;
 static uarte_control_block_t m_cb[NRFX_UARTE_ENABLED_COUNT];
 
+/* Index and registers of the instance, resolved at compile time if only one is enabled. */
+#define UARTE_IDX(p_instance) NRFX_INSTANCE_IDX_GET(UARTE, (p_instance)->drv_inst_idx)
+#define UARTE_REG(p_instance) NRFX_INSTANCE_REG_GET(UARTE, (p_instance)->p_reg)
+
 static void apply_workaround_for_enable_anomaly(nrfx_uarte_t const * p_instance);
 
 static void uarte_configure(nrfx_uarte_t        const * p_instance,
@@ -125,13 +204,14 @@ static void uarte_configure(nrfx_uarte_t        const * p_instance,
     };
     nrfy_config.config = p_config->config;
 
-    nrfy_uarte_periph_configure(p_instance->p_reg, &nrfy_config);
+    nrfy_uarte_periph_configure(UARTE_REG(p_instance), &nrfy_config);
 
     apply_workaround_for_enable_anomaly(p_instance);
 
-    if (m_cb[p_instance->drv_inst_idx].handler)
+    m_cb[UARTE_IDX(p_instance)].irq_priority = p_config->interrupt_priority;
+    if (m_cb[UARTE_IDX(p_instance)].handler)
     {
-        nrfy_uarte_int_init(p_instance->p_reg,
+        nrfy_uarte_int_init(UARTE_REG(p_instance),
                             NRFY_EVENT_TO_INT_BITMASK(NRF_UARTE_EVENT_ENDRX) |
                             NRFY_EVENT_TO_INT_BITMASK(NRF_UARTE_EVENT_ENDTX) |
                             NRFY_EVENT_TO_INT_BITMASK(NRF_UARTE_EVENT_ERROR) |
@@ -144,14 +224,14 @@ static void uarte_configure(nrfx_uarte_t        const * p_instance,
 
 static void pins_to_default(nrfx_uarte_t const * p_instance)
 {
-    uarte_control_block_t const * p_cb = &m_cb[p_instance->drv_inst_idx];
+    uarte_control_block_t const * p_cb = &m_cb[UARTE_IDX(p_instance)];
 
     /* Reset pins to default states */
     nrfy_uarte_pins_t pins;
-    nrfy_uarte_pins_get(p_instance->p_reg, &pins);
+    nrfy_uarte_pins_get(UARTE_REG(p_instance), &pins);
     if (!p_cb->skip_psel_cfg)
     {
-        nrfy_uarte_pins_disconnect(p_instance->p_reg);
+        nrfy_uarte_pins_disconnect(UARTE_REG(p_instance));
     }
     if (!p_cb->skip_gpio_cfg)
     {
@@ -181,19 +261,19 @@ static void apply_workaround_for_enable_anomaly(nrfx_uarte_t const * p_instance)
     // - nRF91 - anomaly 23
     // - nRF53 - anomaly 44
     volatile uint32_t const * rxenable_reg =
-        (volatile uint32_t *)(((uint32_t)p_instance->p_reg) + 0x564);
+        (volatile uint32_t *)(((uint32_t)UARTE_REG(p_instance)) + 0x564);
     volatile uint32_t const * txenable_reg =
-        (volatile uint32_t *)(((uint32_t)p_instance->p_reg) + 0x568);
+        (volatile uint32_t *)(((uint32_t)UARTE_REG(p_instance)) + 0x568);
 
     if (*txenable_reg == 1)
     {
-        nrfy_uarte_task_trigger(p_instance->p_reg, NRF_UARTE_TASK_STOPTX);
+        nrfy_uarte_task_trigger(UARTE_REG(p_instance), NRF_UARTE_TASK_STOPTX);
     }
 
     if (*rxenable_reg == 1)
     {
-        nrfy_uarte_enable(p_instance->p_reg);
-        nrfy_uarte_task_trigger(p_instance->p_reg, NRF_UARTE_TASK_STOPRX);
+        nrfy_uarte_enable(UARTE_REG(p_instance));
+        nrfy_uarte_task_trigger(UARTE_REG(p_instance), NRF_UARTE_TASK_STOPRX);
 
         bool workaround_succeded;
         // The UARTE is able to receive up to four bytes after the STOPRX task has been triggered.
@@ -203,11 +283,11 @@ static void apply_workaround_for_enable_anomaly(nrfx_uarte_t const * p_instance)
         if (!workaround_succeded)
         {
             NRFX_LOG_ERROR("Failed to apply workaround for instance with base address: %p.",
-                           (void *)p_instance->p_reg);
+                           (void *)UARTE_REG(p_instance));
         }
 
-        (void)nrfy_uarte_errorsrc_get_and_clear(p_instance->p_reg);
-        nrfy_uarte_disable(p_instance->p_reg);
+        (void)nrfy_uarte_errorsrc_get_and_clear(UARTE_REG(p_instance));
+        nrfy_uarte_disable(UARTE_REG(p_instance));
     }
 #else
     (void)(p_instance);
@@ -219,7 +299,7 @@ nrfx_err_t nrfx_uarte_init(nrfx_uarte_t const *        p_instance,
                            nrfx_uarte_event_handler_t  event_handler)
 {
     NRFX_ASSERT(p_config);
-    uarte_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    uarte_control_block_t * p_cb = &m_cb[UARTE_IDX(p_instance)];
     nrfx_err_t err_code = NRFX_SUCCESS;
 
     if (p_cb->state != NRFX_DRV_STATE_UNINITIALIZED)
@@ -235,8 +315,8 @@ nrfx_err_t nrfx_uarte_init(nrfx_uarte_t const *        p_instance,
     static nrfx_irq_handler_t const irq_handlers[NRFX_UARTE_ENABLED_COUNT] = {
         NRFX_INSTANCE_IRQ_HANDLERS_LIST(UARTE, uarte)
     };
-    if (nrfx_prs_acquire(p_instance->p_reg,
-            irq_handlers[p_instance->drv_inst_idx]) != NRFX_SUCCESS)
+    if (nrfx_prs_acquire(UARTE_REG(p_instance),
+            irq_handlers[UARTE_IDX(p_instance)]) != NRFX_SUCCESS)
     {
         err_code = NRFX_ERROR_BUSY;
         NRFX_LOG_WARNING("Function: %s, error code: %s.",
@@ -256,7 +336,7 @@ nrfx_err_t nrfx_uarte_init(nrfx_uarte_t const *        p_instance,
         uarte_configure(p_instance, p_config);
     }
 
-    nrfy_uarte_enable(p_instance->p_reg);
+    nrfy_uarte_enable(UARTE_REG(p_instance));
     p_cb->rx_buffer_length           = 0;
     p_cb->rx_secondary_buffer_length = 0;
     p_cb->tx_buffer_length           = 0;
@@ -271,7 +351,7 @@ nrfx_err_t nrfx_uarte_reconfigure(nrfx_uarte_t const *        p_instance,
                                   nrfx_uarte_config_t const * p_config)
 {
     NRFX_ASSERT(p_config);
-    uarte_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    uarte_control_block_t * p_cb = &m_cb[UARTE_IDX(p_instance)];
 
     if (p_cb->state == NRFX_DRV_STATE_UNINITIALIZED)
     {
@@ -281,45 +361,49 @@ nrfx_err_t nrfx_uarte_reconfigure(nrfx_uarte_t const *        p_instance,
     {
         return NRFX_ERROR_BUSY;
     }
-    nrfy_uarte_disable(p_instance->p_reg);
+    nrfy_uarte_disable(UARTE_REG(p_instance));
     if (p_cb->handler)
     {
         p_cb->p_context = p_config->p_context;
     }
     uarte_configure(p_instance, p_config);
-    nrfy_uarte_enable(p_instance->p_reg);
+    nrfy_uarte_enable(UARTE_REG(p_instance));
     return NRFX_SUCCESS;
 }
 
 void nrfx_uarte_uninit(nrfx_uarte_t const * p_instance)
 {
-    uarte_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    uarte_control_block_t * p_cb = &m_cb[UARTE_IDX(p_instance)];
 
     if (p_cb->handler)
     {
-        nrfy_uarte_int_disable(p_instance->p_reg,
+        nrfy_uarte_int_disable(UARTE_REG(p_instance),
                                NRF_UARTE_INT_ENDRX_MASK |
                                NRF_UARTE_INT_ENDTX_MASK |
                                NRF_UARTE_INT_ERROR_MASK |
                                NRF_UARTE_INT_RXTO_MASK  |
                                NRF_UARTE_INT_TXSTOPPED_MASK);
-        nrfy_uarte_int_uninit(p_instance->p_reg);
+        nrfy_uarte_int_uninit(UARTE_REG(p_instance));
     }
     // Make sure all transfers are finished before UARTE is disabled
     // to achieve the lowest power consumption.
-    nrfy_uarte_shorts_disable(p_instance->p_reg, NRF_UARTE_SHORT_ENDRX_STARTRX);
+    nrfy_uarte_shorts_disable(UARTE_REG(p_instance), NRF_UARTE_SHORT_ENDRX_STARTRX);
 
     nrfy_uarte_xfer_desc_t xfer_desc = {
         .p_buffer = p_cb->p_rx_buffer,
         .length   = p_cb->rx_buffer_length
     };
-    nrfy_uarte_stop(p_instance->p_reg, &xfer_desc);
+    nrfy_uarte_stop(UARTE_REG(p_instance), &xfer_desc);
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_RX_WAKEUP_ENABLED)
+    p_cb->rx_buffer_length = 0;
+    nrfx_uarte_rx_wakeup_disable(p_instance);
+#endif
 
-    nrfy_uarte_disable(p_instance->p_reg);
+    nrfy_uarte_disable(UARTE_REG(p_instance));
     pins_to_default(p_instance);
 
 #if NRFX_CHECK(NRFX_PRS_ENABLED)
-    nrfx_prs_release(p_instance->p_reg);
+    nrfx_prs_release(UARTE_REG(p_instance));
 #endif
 
     p_cb->state   = NRFX_DRV_STATE_UNINITIALIZED;
@@ -327,13 +411,208 @@ void nrfx_uarte_uninit(nrfx_uarte_t const * p_instance)
     NRFX_LOG_INFO("Instance uninitialized: %d.", p_instance->drv_inst_idx);
 }
 
+static uint8_t uarte_retained_regs_set(nrfy_reg_desc_t * p_regs)
+{
+    uint8_t count = 0;
+
+    p_regs[count++] = (nrfy_reg_desc_t)NRFY_REG_DESC(NRF_UARTE_Type, PSEL.TXD, 0);
+    p_regs[count++] = (nrfy_reg_desc_t)NRFY_REG_DESC(NRF_UARTE_Type, PSEL.RXD, 0);
+    p_regs[count++] = (nrfy_reg_desc_t)NRFY_REG_DESC(NRF_UARTE_Type, PSEL.RTS, 0);
+    p_regs[count++] = (nrfy_reg_desc_t)NRFY_REG_DESC(NRF_UARTE_Type, PSEL.CTS, 0);
+    p_regs[count++] = (nrfy_reg_desc_t)NRFY_REG_DESC(NRF_UARTE_Type, BAUDRATE, 0);
+    p_regs[count++] = (nrfy_reg_desc_t)NRFY_REG_DESC(NRF_UARTE_Type, CONFIG, 0);
+    // ENABLE must be written last.
+    p_regs[count++] = (nrfy_reg_desc_t)NRFY_REG_DESC(NRF_UARTE_Type, ENABLE, 0);
+
+    NRFX_ASSERT(count <= NRFX_UARTE_RETAINED_REGS_MAX);
+    return count;
+}
+
+nrfx_err_t nrfx_uarte_suspend(nrfx_uarte_t const *    p_instance,
+                              nrfx_uarte_retained_t * p_retained)
+{
+    NRFX_ASSERT(p_retained);
+    uarte_control_block_t * p_cb = &m_cb[UARTE_IDX(p_instance)];
+    nrfx_err_t err_code;
+
+    if (p_cb->state == NRFX_DRV_STATE_UNINITIALIZED)
+    {
+        err_code = NRFX_ERROR_INVALID_STATE;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+    if (nrfx_uarte_tx_in_progress(p_instance) || (p_cb->rx_buffer_length != 0)
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_RX_RING_ENABLED)
+        || p_cb->rx_ring.active
+#endif
+       )
+    {
+        err_code = NRFX_ERROR_BUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    p_retained->reg_count = uarte_retained_regs_set(p_retained->regs);
+    nrfy_regs_snapshot(UARTE_REG(p_instance), p_retained->regs, p_retained->reg_count);
+
+    p_retained->int_mask      = nrfy_uarte_int_enable_check(UARTE_REG(p_instance), UINT32_MAX);
+    p_retained->irq_priority  = p_cb->irq_priority;
+    p_retained->skip_gpio_cfg = p_cb->skip_gpio_cfg;
+    p_retained->skip_psel_cfg = p_cb->skip_psel_cfg;
+    p_retained->handler       = p_cb->handler;
+    p_retained->p_context     = p_cb->p_context;
+
+    if (p_cb->handler)
+    {
+        nrfy_uarte_int_disable(UARTE_REG(p_instance), p_retained->int_mask);
+        nrfy_uarte_int_uninit(UARTE_REG(p_instance));
+    }
+    nrfy_uarte_disable(UARTE_REG(p_instance));
+
+#if NRFX_CHECK(NRFX_PRS_ENABLED)
+    nrfx_prs_release(UARTE_REG(p_instance));
+#endif
+
+    p_cb->state = NRFX_DRV_STATE_UNINITIALIZED;
+
+    err_code = NRFX_SUCCESS;
+    NRFX_LOG_INFO("Function: %s, error code: %s.", __func__, NRFX_LOG_ERROR_STRING_GET(err_code));
+    return err_code;
+}
+
+nrfx_err_t nrfx_uarte_resume(nrfx_uarte_t const *          p_instance,
+                             nrfx_uarte_retained_t const * p_retained)
+{
+    NRFX_ASSERT(p_retained);
+    uarte_control_block_t * p_cb = &m_cb[UARTE_IDX(p_instance)];
+    nrfx_err_t err_code;
+
+    if (p_cb->state != NRFX_DRV_STATE_UNINITIALIZED)
+    {
+        err_code = NRFX_ERROR_INVALID_STATE;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+#if NRFX_CHECK(NRFX_PRS_ENABLED)
+    static nrfx_irq_handler_t const irq_handlers[NRFX_UARTE_ENABLED_COUNT] = {
+        NRFX_INSTANCE_IRQ_HANDLERS_LIST(UARTE, uarte)
+    };
+    if (nrfx_prs_acquire(UARTE_REG(p_instance),
+            irq_handlers[UARTE_IDX(p_instance)]) != NRFX_SUCCESS)
+    {
+        err_code = NRFX_ERROR_BUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+#endif // NRFX_CHECK(NRFX_PRS_ENABLED)
+
+    p_cb->handler       = p_retained->handler;
+    p_cb->p_context     = p_retained->p_context;
+    p_cb->irq_priority  = p_retained->irq_priority;
+    p_cb->skip_gpio_cfg = p_retained->skip_gpio_cfg;
+    p_cb->skip_psel_cfg = p_retained->skip_psel_cfg;
+
+    apply_workaround_for_enable_anomaly(p_instance);
+    if (p_cb->handler)
+    {
+        nrfy_uarte_int_init(UARTE_REG(p_instance),
+                            p_retained->int_mask,
+                            p_cb->irq_priority,
+                            true);
+    }
+    nrfy_regs_apply(UARTE_REG(p_instance), p_retained->regs, p_retained->reg_count);
+
+    p_cb->rx_buffer_length           = 0;
+    p_cb->rx_secondary_buffer_length = 0;
+    p_cb->tx_buffer_length           = 0;
+    p_cb->state                      = NRFX_DRV_STATE_INITIALIZED;
+
+    err_code = NRFX_SUCCESS;
+    NRFX_LOG_INFO("Function: %s, error code: %s.", __func__, NRFX_LOG_ERROR_STRING_GET(err_code));
+    return err_code;
+}
+
+#if NRFX_UARTE_CONFIG_TX_BOUNCE_SIZE > 0
+static size_t tx_bounce_fill(uarte_control_block_t * p_cb, uint8_t half)
+{
+    size_t chunk = NRFX_MIN(p_cb->tx_bounce_remaining, TX_BOUNCE_CHUNK_SIZE);
+
+    memcpy(&p_cb->tx_bounce[half * TX_BOUNCE_CHUNK_SIZE], p_cb->p_tx_bounce_src, chunk);
+    p_cb->p_tx_bounce_src     += chunk;
+    p_cb->tx_bounce_remaining -= chunk;
+
+    return chunk;
+}
+
+static nrfx_err_t tx_bounce_start(nrfx_uarte_t const * p_instance,
+                                  uint8_t const *      p_data,
+                                  size_t               length,
+                                  uint32_t             flags)
+{
+    uarte_control_block_t * p_cb = &m_cb[UARTE_IDX(p_instance)];
+    nrfx_err_t err_code = NRFX_SUCCESS;
+
+    if (nrfx_uarte_tx_in_progress(p_instance))
+    {
+        err_code = NRFX_ERROR_BUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    p_cb->p_tx_bounce_src     = p_data;
+    p_cb->tx_bounce_remaining = length;
+
+    if (p_cb->handler == NULL)
+    {
+        // In blocking mode the chunks are sent one after another from the first half.
+        while ((p_cb->tx_bounce_remaining != 0) && (err_code == NRFX_SUCCESS))
+        {
+            size_t chunk = tx_bounce_fill(p_cb, 0);
+
+            err_code = nrfx_uarte_tx(p_instance, p_cb->tx_bounce, chunk, flags);
+        }
+        return err_code;
+    }
+
+    // Both halves are filled before starting, so that the interrupt always finds
+    // the next chunk ready. Further chunks are copied while the previous one is sent.
+    size_t chunk = tx_bounce_fill(p_cb, 0);
+
+    p_cb->tx_bounce_pending = tx_bounce_fill(p_cb, 1);
+    p_cb->tx_bounce_next    = 1;
+    p_cb->tx_bounce_bytes   = 0;
+    p_cb->tx_buffer_length  = length;
+    p_cb->p_tx_buffer       = p_data;
+
+    NRFX_LOG_INFO("Transfer tx_len: %d through bounce buffer.", p_cb->tx_buffer_length);
+
+    nrfy_uarte_event_clear(UARTE_REG(p_instance), NRF_UARTE_EVENT_ENDTX);
+    nrfy_uarte_event_clear(UARTE_REG(p_instance), NRF_UARTE_EVENT_TXSTOPPED);
+    nrfy_uarte_tx_buffer_set(UARTE_REG(p_instance), p_cb->tx_bounce, chunk);
+    (void)nrfy_uarte_tx_start(UARTE_REG(p_instance), false);
+
+    return err_code;
+}
+#endif // NRFX_UARTE_CONFIG_TX_BOUNCE_SIZE > 0
+
 nrfx_err_t nrfx_uarte_tx(nrfx_uarte_t const * p_instance,
                          uint8_t const *      p_data,
                          size_t               length,
                          uint32_t             flags)
 {
     (void)flags;
-    uarte_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    uarte_control_block_t * p_cb = &m_cb[UARTE_IDX(p_instance)];
     NRFX_ASSERT(p_cb->state == NRFX_DRV_STATE_INITIALIZED);
     NRFX_ASSERT(p_data);
     NRFX_ASSERT(length > 0);
@@ -343,13 +622,17 @@ nrfx_err_t nrfx_uarte_tx(nrfx_uarte_t const * p_instance,
 
     // EasyDMA requires that transfer buffers are placed in DataRAM,
     // signal error if the are not.
-    if (!nrf_dma_accessible_check(p_instance->p_reg, p_data))
+    if (!nrf_dma_accessible_check(UARTE_REG(p_instance), p_data))
     {
+#if NRFX_UARTE_CONFIG_TX_BOUNCE_SIZE > 0
+        return tx_bounce_start(p_instance, p_data, length, flags);
+#else
         err_code = NRFX_ERROR_INVALID_ADDR;
         NRFX_LOG_WARNING("Function: %s, error code: %s.",
                          __func__,
                          NRFX_LOG_ERROR_STRING_GET(err_code));
         return err_code;
+#endif
     }
 
     if (nrfx_uarte_tx_in_progress(p_instance))
@@ -368,11 +651,11 @@ nrfx_err_t nrfx_uarte_tx(nrfx_uarte_t const * p_instance,
     NRFX_LOG_HEXDUMP_DEBUG(p_cb->p_tx_buffer,
                            p_cb->tx_buffer_length * sizeof(p_cb->p_tx_buffer[0]));
 
-    nrfy_uarte_event_clear(p_instance->p_reg, NRF_UARTE_EVENT_ENDTX);
-    nrfy_uarte_event_clear(p_instance->p_reg, NRF_UARTE_EVENT_TXSTOPPED);
-    nrfy_uarte_tx_buffer_set(p_instance->p_reg, p_cb->p_tx_buffer, p_cb->tx_buffer_length);
+    nrfy_uarte_event_clear(UARTE_REG(p_instance), NRF_UARTE_EVENT_ENDTX);
+    nrfy_uarte_event_clear(UARTE_REG(p_instance), NRF_UARTE_EVENT_TXSTOPPED);
+    nrfy_uarte_tx_buffer_set(UARTE_REG(p_instance), p_cb->p_tx_buffer, p_cb->tx_buffer_length);
 
-    uint32_t evt_mask = nrfy_uarte_tx_start(p_instance->p_reg, !p_cb->handler);
+    uint32_t evt_mask = nrfy_uarte_tx_start(UARTE_REG(p_instance), !p_cb->handler);
     if (p_cb->handler == NULL)
     {
         if (evt_mask & NRFY_EVENT_TO_INT_BITMASK(NRF_UARTE_EVENT_TXSTOPPED))
@@ -383,7 +666,7 @@ nrfx_err_t nrfx_uarte_tx(nrfx_uarte_t const * p_instance,
         {
             // Transmitter has to be stopped by triggering the STOPTX task to achieve
             // the lowest possible level of the UARTE power consumption.
-            nrfy_uarte_stop(p_instance->p_reg, NULL);
+            nrfy_uarte_stop(UARTE_REG(p_instance), NULL);
         }
         p_cb->tx_buffer_length = 0;
     }
@@ -393,14 +676,134 @@ nrfx_err_t nrfx_uarte_tx(nrfx_uarte_t const * p_instance,
 
 bool nrfx_uarte_tx_in_progress(nrfx_uarte_t const * p_instance)
 {
-    return (m_cb[p_instance->drv_inst_idx].tx_buffer_length != 0);
+    return (m_cb[UARTE_IDX(p_instance)].tx_buffer_length != 0);
+}
+
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_TX_LIST_ENABLED)
+nrfx_err_t nrfx_uarte_tx_list(nrfx_uarte_t const *            p_instance,
+                              nrfx_uarte_tx_segment_t const * p_list,
+                              size_t                          count)
+{
+    uarte_control_block_t * p_cb = &m_cb[UARTE_IDX(p_instance)];
+    NRFX_ASSERT(p_cb->state == NRFX_DRV_STATE_INITIALIZED);
+    NRFX_ASSERT(p_list);
+    NRFX_ASSERT(count > 0);
+
+    nrfx_err_t err_code = NRFX_SUCCESS;
+    size_t     length   = 0;
+
+    if (!p_cb->handler)
+    {
+        err_code = NRFX_ERROR_FORBIDDEN;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        NRFX_ASSERT(p_list[i].p_data);
+        NRFX_ASSERT(p_list[i].length > 0);
+        NRFX_ASSERT(UARTE_LENGTH_VALIDATE(p_instance->drv_inst_idx, p_list[i].length));
+
+        // EasyDMA requires that transfer buffers are placed in DataRAM,
+        // signal error if the are not.
+        if (!nrf_dma_accessible_check(UARTE_REG(p_instance), p_list[i].p_data))
+        {
+            err_code = NRFX_ERROR_INVALID_ADDR;
+            NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                             __func__,
+                             NRFX_LOG_ERROR_STRING_GET(err_code));
+            return err_code;
+        }
+        length += p_list[i].length;
+    }
+
+    if (nrfx_uarte_tx_in_progress(p_instance))
+    {
+        err_code = NRFX_ERROR_BUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    if ((count > 1) && (nrfx_gppi_channel_alloc(&p_cb->tx_ppi_channel) != NRFX_SUCCESS))
+    {
+        err_code = NRFX_ERROR_NO_MEM;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    p_cb->tx_buffer_length = length;
+    p_cb->p_tx_buffer      = p_list[0].p_data;
+    p_cb->p_tx_list        = (count > 1) ? p_list : NULL;
+    p_cb->tx_list_count    = count;
+    p_cb->tx_list_idx      = 0;
+    p_cb->tx_list_bytes    = 0;
+
+    NRFX_LOG_INFO("Transfer tx_list: %d buffers, %d bytes.", count, length);
+
+    nrfy_uarte_event_clear(UARTE_REG(p_instance), NRF_UARTE_EVENT_ENDTX);
+    nrfy_uarte_event_clear(UARTE_REG(p_instance), NRF_UARTE_EVENT_TXSTOPPED);
+    nrfy_uarte_event_clear(UARTE_REG(p_instance), NRF_UARTE_EVENT_TXSTARTED);
+    nrfy_uarte_tx_buffer_set(UARTE_REG(p_instance), p_list[0].p_data, p_list[0].length);
+
+    if (p_cb->p_tx_list)
+    {
+        // The UARTE has no ENDTX to STARTTX shortcut, (D)PPI provides it instead.
+        // Each next buffer is loaded into TXD.PTR on TXSTARTED of the previous one.
+        nrfx_gppi_channel_endpoints_setup(p_cb->tx_ppi_channel,
+            nrfy_uarte_event_address_get(UARTE_REG(p_instance), NRF_UARTE_EVENT_ENDTX),
+            nrfy_uarte_task_address_get(UARTE_REG(p_instance), NRF_UARTE_TASK_STARTTX));
+        nrfx_gppi_channels_enable(NRFX_BIT(p_cb->tx_ppi_channel));
+        nrfy_uarte_int_enable(UARTE_REG(p_instance), NRF_UARTE_INT_TXSTARTED_MASK);
+    }
+
+    (void)nrfy_uarte_tx_start(UARTE_REG(p_instance), false);
+
+    return err_code;
+}
+
+static void tx_list_end(NRF_UARTE_Type * p_reg, uarte_control_block_t * p_cb)
+{
+    uint32_t eep = nrfy_uarte_event_address_get(p_reg, NRF_UARTE_EVENT_ENDTX);
+    uint32_t tep = nrfy_uarte_task_address_get(p_reg, NRF_UARTE_TASK_STARTTX);
+
+    nrfy_uarte_int_disable(p_reg, NRF_UARTE_INT_TXSTARTED_MASK);
+    nrfx_gppi_channels_disable(NRFX_BIT(p_cb->tx_ppi_channel));
+    nrfx_gppi_channel_endpoints_clear(p_cb->tx_ppi_channel, eep, tep);
+    (void)nrfx_gppi_channel_free(p_cb->tx_ppi_channel);
+
+    p_cb->p_tx_list = NULL;
+}
+#endif // NRFX_CHECK(NRFX_UARTE_CONFIG_TX_LIST_ENABLED)
+
+static bool rx_wakeup_arm(NRF_UARTE_Type * p_reg, uarte_control_block_t * p_cb)
+{
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_RX_WAKEUP_ENABLED)
+    if (p_cb->rx_wakeup.enabled)
+    {
+        // STARTRX is triggered by the falling edge of the start bit.
+        nrfy_uarte_event_clear(p_reg, NRF_UARTE_EVENT_RXSTARTED);
+        nrfx_gppi_group_enable(p_cb->rx_wakeup.group);
+        return true;
+    }
+#else
+    (void)p_reg;
+    (void)p_cb;
+#endif
+    return false;
 }
 
 nrfx_err_t nrfx_uarte_rx(nrfx_uarte_t const * p_instance,
                          uint8_t *            p_data,
                          size_t               length)
 {
-    uarte_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    uarte_control_block_t * p_cb = &m_cb[UARTE_IDX(p_instance)];
 
     NRFX_ASSERT(p_cb->state == NRFX_DRV_STATE_INITIALIZED);
     NRFX_ASSERT(p_data);
@@ -411,7 +814,7 @@ nrfx_err_t nrfx_uarte_rx(nrfx_uarte_t const * p_instance,
 
     // EasyDMA requires that transfer buffers are placed in DataRAM,
     // signal error if the are not.
-    if (!nrf_dma_accessible_check(p_instance->p_reg, p_data))
+    if (!nrf_dma_accessible_check(UARTE_REG(p_instance), p_data))
     {
         err_code = NRFX_ERROR_INVALID_ADDR;
         NRFX_LOG_WARNING("Function: %s, error code: %s.",
@@ -420,12 +823,35 @@ nrfx_err_t nrfx_uarte_rx(nrfx_uarte_t const * p_instance,
         return err_code;
     }
 
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_RX_RING_ENABLED)
+    if (p_cb->rx_ring.active)
+    {
+        err_code = NRFX_ERROR_BUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+#endif
+
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_RX_WAKEUP_ENABLED)
+    // The buffer must not be replaced before the start bit latches it.
+    if (p_cb->rx_wakeup.enabled && (p_cb->rx_buffer_length != 0))
+    {
+        err_code = NRFX_ERROR_BUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+#endif
+
     bool second_buffer = false;
 
     if (p_cb->handler)
     {
-        nrfy_uarte_int_disable(p_instance->p_reg, NRF_UARTE_INT_ERROR_MASK |
-                                                  NRF_UARTE_INT_ENDRX_MASK);
+        nrfy_uarte_int_disable(UARTE_REG(p_instance), NRF_UARTE_INT_ERROR_MASK |
+                                                      NRF_UARTE_INT_ENDRX_MASK);
     }
     if (p_cb->rx_buffer_length != 0)
     {
@@ -433,8 +859,8 @@ nrfx_err_t nrfx_uarte_rx(nrfx_uarte_t const * p_instance,
         {
             if (p_cb->handler)
             {
-                nrfy_uarte_int_enable(p_instance->p_reg, NRF_UARTE_INT_ERROR_MASK |
-                                                         NRF_UARTE_INT_ENDRX_MASK);
+                nrfy_uarte_int_enable(UARTE_REG(p_instance), NRF_UARTE_INT_ERROR_MASK |
+                                                             NRF_UARTE_INT_ENDRX_MASK);
             }
             err_code = NRFX_ERROR_BUSY;
             NRFX_LOG_WARNING("Function: %s, error code: %s.",
@@ -459,13 +885,13 @@ nrfx_err_t nrfx_uarte_rx(nrfx_uarte_t const * p_instance,
 
     NRFX_LOG_INFO("Transfer rx_len: %d.", length);
 
-    nrfy_uarte_event_clear(p_instance->p_reg, NRF_UARTE_EVENT_ENDRX);
-    nrfy_uarte_event_clear(p_instance->p_reg, NRF_UARTE_EVENT_RXTO);
-    nrfy_uarte_rx_buffer_set(p_instance->p_reg, p_data, length);
+    nrfy_uarte_event_clear(UARTE_REG(p_instance), NRF_UARTE_EVENT_ENDRX);
+    nrfy_uarte_event_clear(UARTE_REG(p_instance), NRF_UARTE_EVENT_RXTO);
+    nrfy_uarte_rx_buffer_set(UARTE_REG(p_instance), p_data, length);
     uint32_t evt_mask = 0;
     if (second_buffer)
     {
-        nrfy_uarte_shorts_enable(p_instance->p_reg, NRF_UARTE_SHORT_ENDRX_STARTRX);
+        nrfy_uarte_shorts_enable(UARTE_REG(p_instance), NRF_UARTE_SHORT_ENDRX_STARTRX);
     }
     else
     {
@@ -474,7 +900,11 @@ nrfx_err_t nrfx_uarte_rx(nrfx_uarte_t const * p_instance,
             .length   = p_cb->rx_buffer_length
         };
 
-        evt_mask = nrfy_uarte_rx_start(p_instance->p_reg, !p_cb->handler ? &xfer_desc : NULL);
+        if (!rx_wakeup_arm(UARTE_REG(p_instance), p_cb))
+        {
+            evt_mask = nrfy_uarte_rx_start(UARTE_REG(p_instance),
+                                           !p_cb->handler ? &xfer_desc : NULL);
+        }
     }
 
     if (p_cb->handler == NULL)
@@ -494,8 +924,8 @@ nrfx_err_t nrfx_uarte_rx(nrfx_uarte_t const * p_instance,
     else
     {
         p_cb->rx_aborted = false;
-        nrfy_uarte_int_enable(p_instance->p_reg, NRF_UARTE_INT_ERROR_MASK |
-                                                 NRF_UARTE_INT_ENDRX_MASK);
+        nrfy_uarte_int_enable(UARTE_REG(p_instance), NRF_UARTE_INT_ERROR_MASK |
+                                                     NRF_UARTE_INT_ENDRX_MASK);
     }
     NRFX_LOG_INFO("Function: %s, error code: %s.", __func__, NRFX_LOG_ERROR_STRING_GET(err_code));
     return err_code;
@@ -505,14 +935,14 @@ nrfx_err_t nrfx_uarte_rx_ready(nrfx_uarte_t const * p_instance, size_t * p_rx_am
 {
     (void)p_rx_amount;
 
-    return nrfy_uarte_event_check(p_instance->p_reg, NRF_UARTE_EVENT_ENDRX) ?
+    return nrfy_uarte_event_check(UARTE_REG(p_instance), NRF_UARTE_EVENT_ENDRX) ?
             NRFX_SUCCESS : NRFX_ERROR_BUSY;
 }
 
 uint32_t nrfx_uarte_errorsrc_get(nrfx_uarte_t const * p_instance)
 {
-    nrfy_uarte_event_clear(p_instance->p_reg, NRF_UARTE_EVENT_ERROR);
-    return nrfy_uarte_errorsrc_get_and_clear(p_instance->p_reg);
+    nrfy_uarte_event_clear(UARTE_REG(p_instance), NRF_UARTE_EVENT_ERROR);
+    return nrfy_uarte_errorsrc_get_and_clear(UARTE_REG(p_instance));
 }
 
 static void rx_done_event(uarte_control_block_t * p_cb,
@@ -527,10 +957,61 @@ static void rx_done_event(uarte_control_block_t * p_cb,
     p_cb->handler(&event, p_cb->p_context);
 }
 
+static void rx_buffer_done(uarte_control_block_t * p_cb, size_t bytes, uint8_t * p_data)
+{
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_RX_WAKEUP_ENABLED)
+    if (p_cb->rx_wakeup.enabled && p_cb->rx_wakeup.drop_byte &&
+        (bytes > 0) && (p_data[0] == RX_WAKEUP_BYTE))
+    {
+        p_data++;
+        bytes--;
+    }
+#endif
+    rx_done_event(p_cb, bytes, p_data);
+}
+
+static void rx_wakeup_stop(NRF_UARTE_Type * p_reg, uarte_control_block_t * p_cb)
+{
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_RX_WAKEUP_ENABLED)
+    if (p_cb->rx_wakeup.enabled)
+    {
+        // Stop the receiver to release the clock until the next start bit.
+        p_cb->rx_wakeup.stopping = true;
+        nrfy_uarte_task_trigger(p_reg, NRF_UARTE_TASK_STOPRX);
+    }
+#else
+    (void)p_reg;
+    (void)p_cb;
+#endif
+}
+
+static bool rx_wakeup_stopped_check(uarte_control_block_t * p_cb)
+{
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_RX_WAKEUP_ENABLED)
+    if (p_cb->rx_wakeup.stopping)
+    {
+        p_cb->rx_wakeup.stopping = false;
+        return true;
+    }
+#else
+    (void)p_cb;
+#endif
+    return false;
+}
+
 static void tx_done_event(uarte_control_block_t * p_cb,
                           size_t                  bytes)
 {
     nrfx_uarte_event_t event;
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_TX_LIST_ENABLED)
+    bytes += p_cb->tx_list_bytes;
+    p_cb->tx_list_bytes = 0;
+#endif
+#if NRFX_UARTE_CONFIG_TX_BOUNCE_SIZE > 0
+    bytes += p_cb->tx_bounce_bytes;
+    p_cb->tx_bounce_bytes = 0;
+#endif
+
     event.type             = NRFX_UARTE_EVT_TX_DONE;
     event.data.tx.bytes  = bytes;
     event.data.tx.p_data = (uint8_t *)p_cb->p_tx_buffer;
@@ -542,8 +1023,20 @@ static void tx_done_event(uarte_control_block_t * p_cb,
 nrfx_err_t nrfx_uarte_tx_abort(nrfx_uarte_t const * p_instance, bool sync)
 {
     (void)sync;
-    uarte_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
-    nrfy_uarte_tx_abort(p_instance->p_reg, !p_cb->handler ? true : false);
+    uarte_control_block_t * p_cb = &m_cb[UARTE_IDX(p_instance)];
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_TX_LIST_ENABLED)
+    // ENDTX following STOPTX must not start the next buffer of the list.
+    if (p_cb->p_tx_list)
+    {
+        tx_list_end(UARTE_REG(p_instance), p_cb);
+    }
+#endif
+#if NRFX_UARTE_CONFIG_TX_BOUNCE_SIZE > 0
+    // ENDTX following STOPTX must complete the transfer instead of sending the next chunk.
+    p_cb->tx_bounce_pending   = 0;
+    p_cb->tx_bounce_remaining = 0;
+#endif
+    nrfy_uarte_tx_abort(UARTE_REG(p_instance), !p_cb->handler ? true : false);
     NRFX_LOG_INFO("TX transaction aborted.");
 
     return NRFX_SUCCESS;
@@ -553,35 +1046,409 @@ nrfx_err_t nrfx_uarte_rx_abort(nrfx_uarte_t const * p_instance, bool disable_all
 {
     (void)disable_all;
     (void)sync;
-    uarte_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    uarte_control_block_t * p_cb = &m_cb[UARTE_IDX(p_instance)];
 
     // Short between ENDRX event and STARTRX task must be disabled before
     // aborting transmission.
     if (p_cb->rx_secondary_buffer_length != 0)
     {
-        nrfy_uarte_shorts_disable(p_instance->p_reg, NRF_UARTE_SHORT_ENDRX_STARTRX);
+        nrfy_uarte_shorts_disable(UARTE_REG(p_instance), NRF_UARTE_SHORT_ENDRX_STARTRX);
     }
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_RX_WAKEUP_ENABLED)
+    if (p_cb->rx_wakeup.enabled && (p_cb->rx_buffer_length != 0))
+    {
+        nrfx_gppi_group_disable(p_cb->rx_wakeup.group);
+        if (!nrfy_uarte_event_check(UARTE_REG(p_instance), NRF_UARTE_EVENT_RXSTARTED))
+        {
+            // The start bit has not arrived, so there is no RXTO event to complete the abort.
+            p_cb->rx_buffer_length = 0;
+            rx_done_event(p_cb, 0, p_cb->p_rx_buffer);
+            return NRFX_SUCCESS;
+        }
+    }
+#endif
     p_cb->rx_aborted = true;
-    nrfy_uarte_task_trigger(p_instance->p_reg, NRF_UARTE_TASK_STOPRX);
+    nrfy_uarte_task_trigger(UARTE_REG(p_instance), NRF_UARTE_TASK_STOPRX);
     NRFX_LOG_INFO("RX transaction aborted.");
 
     return NRFX_SUCCESS;
 }
 
-static void irq_handler(NRF_UARTE_Type * p_reg, uarte_control_block_t * p_cb)
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_RX_WAKEUP_ENABLED)
+nrfx_err_t nrfx_uarte_rx_wakeup_enable(nrfx_uarte_t const * p_instance, bool drop_wakeup_byte)
+{
+    uarte_control_block_t * p_cb     = &m_cb[UARTE_IDX(p_instance)];
+    uarte_rx_wakeup_t *     p_wakeup = &p_cb->rx_wakeup;
+    NRF_UARTE_Type *        p_reg    = UARTE_REG(p_instance);
+    nrfx_err_t              err_code;
+
+    NRFX_ASSERT(p_cb->state == NRFX_DRV_STATE_INITIALIZED);
+    NRFX_ASSERT(nrfy_uarte_rx_pin_get(p_reg) != NRF_UARTE_PSEL_DISCONNECTED);
+
+    if (!p_cb->handler)
+    {
+        err_code = NRFX_ERROR_FORBIDDEN;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    if (p_cb->rx_buffer_length != 0)
+    {
+        err_code = NRFX_ERROR_BUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    if (p_wakeup->enabled)
+    {
+        p_wakeup->drop_byte = drop_wakeup_byte;
+        return NRFX_SUCCESS;
+    }
+
+    p_wakeup->pin = nrfy_uarte_rx_pin_get(p_reg);
+    if (nrfx_gpiote_channel_alloc(&p_wakeup->gpiote_channel) != NRFX_SUCCESS)
+    {
+        return NRFX_ERROR_NO_MEM;
+    }
+    if (nrfx_gppi_channel_alloc(&p_wakeup->ppi_channel) != NRFX_SUCCESS)
+    {
+        (void)nrfx_gpiote_channel_free(p_wakeup->gpiote_channel);
+        return NRFX_ERROR_NO_MEM;
+    }
+    if (nrfx_gppi_group_alloc(&p_wakeup->group) != NRFX_SUCCESS)
+    {
+        (void)nrfx_gppi_channel_free(p_wakeup->ppi_channel);
+        (void)nrfx_gpiote_channel_free(p_wakeup->gpiote_channel);
+        return NRFX_ERROR_NO_MEM;
+    }
+
+    static const nrfx_gpiote_input_config_t input_config = {
+        .pull = NRF_GPIO_PIN_NOPULL,
+    };
+    nrfx_gpiote_trigger_config_t trigger_config = {
+        .trigger      = NRFX_GPIOTE_TRIGGER_HITOLO,
+        .p_in_channel = &p_wakeup->gpiote_channel,
+    };
+    err_code = nrfx_gpiote_input_configure(p_wakeup->pin, &input_config, &trigger_config, NULL);
+    if (err_code != NRFX_SUCCESS)
+    {
+        (void)nrfx_gppi_group_free(p_wakeup->group);
+        (void)nrfx_gppi_channel_free(p_wakeup->ppi_channel);
+        (void)nrfx_gpiote_channel_free(p_wakeup->gpiote_channel);
+        return err_code;
+    }
+    nrfx_gpiote_trigger_enable(p_wakeup->pin, false);
+
+    // The first edge starts the receiver and disables the group, so later edges are ignored.
+    nrfx_gppi_channel_endpoints_setup(p_wakeup->ppi_channel,
+        nrfx_gpiote_in_event_address_get(p_wakeup->pin),
+        nrfy_uarte_task_address_get(p_reg, NRF_UARTE_TASK_STARTRX));
+    nrfx_gppi_fork_endpoint_setup(p_wakeup->ppi_channel,
+        nrfx_gppi_task_address_get(nrfx_gppi_group_disable_task_get(p_wakeup->group)));
+    nrfx_gppi_channels_include_in_group(NRFX_BIT(p_wakeup->ppi_channel), p_wakeup->group);
+
+    p_wakeup->drop_byte = drop_wakeup_byte;
+    p_wakeup->stopping  = false;
+    p_wakeup->enabled   = true;
+
+    return NRFX_SUCCESS;
+}
+
+void nrfx_uarte_rx_wakeup_disable(nrfx_uarte_t const * p_instance)
+{
+    uarte_control_block_t * p_cb     = &m_cb[UARTE_IDX(p_instance)];
+    uarte_rx_wakeup_t *     p_wakeup = &p_cb->rx_wakeup;
+    NRF_UARTE_Type *        p_reg    = UARTE_REG(p_instance);
+
+    NRFX_ASSERT(p_cb->rx_buffer_length == 0);
+
+    if (!p_wakeup->enabled)
+    {
+        return;
+    }
+
+    nrfx_gppi_group_disable(p_wakeup->group);
+    nrfx_gppi_channels_remove_from_group(NRFX_BIT(p_wakeup->ppi_channel), p_wakeup->group);
+    nrfx_gppi_fork_endpoint_clear(p_wakeup->ppi_channel,
+        nrfx_gppi_task_address_get(nrfx_gppi_group_disable_task_get(p_wakeup->group)));
+    nrfx_gppi_channel_endpoints_clear(p_wakeup->ppi_channel,
+        nrfx_gpiote_in_event_address_get(p_wakeup->pin),
+        nrfy_uarte_task_address_get(p_reg, NRF_UARTE_TASK_STARTRX));
+    (void)nrfx_gppi_group_free(p_wakeup->group);
+    (void)nrfx_gppi_channel_free(p_wakeup->ppi_channel);
+
+    (void)nrfx_gpiote_pin_uninit(p_wakeup->pin);
+    (void)nrfx_gpiote_channel_free(p_wakeup->gpiote_channel);
+    if (!p_cb->skip_gpio_cfg)
+    {
+        nrfy_gpio_cfg_input(p_wakeup->pin, NRF_GPIO_PIN_NOPULL);
+    }
+
+    p_wakeup->enabled = false;
+}
+#endif // NRFX_CHECK(NRFX_UARTE_CONFIG_RX_WAKEUP_ENABLED)
+
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_RX_RING_ENABLED)
+#define RX_RING_INT_MASK (NRF_UARTE_INT_ERROR_MASK     | \
+                          NRF_UARTE_INT_ENDRX_MASK     | \
+                          NRF_UARTE_INT_RXSTARTED_MASK | \
+                          NRF_UARTE_INT_RXTO_MASK)
+
+static uint8_t * rx_ring_buffer_get(uarte_rx_ring_t const * p_ring, uint8_t idx)
+{
+    return p_ring->config.p_buffer + (size_t)idx * p_ring->config.buffer_size;
+}
+
+// Number of bytes between the first unreported byte and the end of the buffer being filled.
+// Reports never cross the end of that buffer, so a report never wraps around the ring.
+static size_t rx_ring_fill_pending_get(uarte_rx_ring_t const * p_ring)
+{
+    return (size_t)(p_ring->fill_idx + 1) * p_ring->config.buffer_size - p_ring->report_pos;
+}
+
+static void rx_ring_report(uarte_control_block_t * p_cb, size_t length)
+{
+    uarte_rx_ring_t * p_ring    = &p_cb->rx_ring;
+    size_t            ring_size = p_ring->config.buffer_size * p_ring->config.buffer_count;
+    uint8_t *         p_data    = p_ring->config.p_buffer + p_ring->report_pos;
+
+    if (length == 0)
+    {
+        return;
+    }
+
+    NRFY_CACHE_INV(p_data, length);
+    p_ring->reported  += (uint32_t)length;
+    p_ring->report_pos = (p_ring->report_pos + length) % ring_size;
+
+    rx_done_event(p_cb, length, p_data);
+}
+
+static void rx_ring_teardown(NRF_UARTE_Type * p_reg, uarte_rx_ring_t * p_ring)
+{
+    uint32_t eep = nrfy_uarte_event_address_get(p_reg, NRF_UARTE_EVENT_RXDRDY);
+    uint32_t tep = nrfy_timer_task_address_get(p_ring->config.p_timer, NRF_TIMER_TASK_COUNT);
+
+    nrfy_uarte_int_disable(p_reg, NRF_UARTE_INT_RXSTARTED_MASK);
+    nrfx_gppi_channels_disable(NRFX_BIT(p_ring->ppi_channel));
+    nrfx_gppi_channel_endpoints_clear(p_ring->ppi_channel, eep, tep);
+    (void)nrfx_gppi_channel_free(p_ring->ppi_channel);
+    nrfy_timer_task_trigger(p_ring->config.p_timer, NRF_TIMER_TASK_STOP);
+
+    p_ring->active = false;
+}
+
+nrfx_err_t nrfx_uarte_rx_ring_start(nrfx_uarte_t const *                p_instance,
+                                    nrfx_uarte_rx_ring_config_t const * p_config)
+{
+    uarte_control_block_t * p_cb   = &m_cb[UARTE_IDX(p_instance)];
+    uarte_rx_ring_t *       p_ring = &p_cb->rx_ring;
+    nrfx_err_t              err_code;
+
+    NRFX_ASSERT(p_cb->state == NRFX_DRV_STATE_INITIALIZED);
+    NRFX_ASSERT(p_config->p_buffer);
+    NRFX_ASSERT(p_config->p_timer);
+    NRFX_ASSERT(p_config->buffer_count >= 2);
+    NRFX_ASSERT(UARTE_LENGTH_VALIDATE(p_instance->drv_inst_idx, p_config->buffer_size));
+
+    if (!p_cb->handler)
+    {
+        err_code = NRFX_ERROR_FORBIDDEN;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    // EasyDMA requires that transfer buffers are placed in DataRAM,
+    // signal error if the are not.
+    if (!nrf_dma_accessible_check(UARTE_REG(p_instance), p_config->p_buffer))
+    {
+        err_code = NRFX_ERROR_INVALID_ADDR;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    if (p_ring->active || (p_cb->rx_buffer_length != 0))
+    {
+        err_code = NRFX_ERROR_BUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    if (nrfx_gppi_channel_alloc(&p_ring->ppi_channel) != NRFX_SUCCESS)
+    {
+        err_code = NRFX_ERROR_NO_MEM;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    p_ring->config     = *p_config;
+    p_ring->stopping   = false;
+    p_ring->fill_idx   = 0;
+    p_ring->report_pos = 0;
+    p_ring->reported   = 0;
+
+    // Every byte moved from the receiver to RXD generates RXDRDY, which increments the counter.
+    // This tells how much of the buffer being filled is already received without interrupts.
+    nrfy_timer_task_trigger(p_config->p_timer, NRF_TIMER_TASK_STOP);
+    nrfy_timer_mode_set(p_config->p_timer, NRF_TIMER_MODE_COUNTER);
+    nrfy_timer_bit_width_set(p_config->p_timer, NRF_TIMER_BIT_WIDTH_32);
+    nrfy_timer_task_trigger(p_config->p_timer, NRF_TIMER_TASK_CLEAR);
+    nrfy_timer_task_trigger(p_config->p_timer, NRF_TIMER_TASK_START);
+
+    nrfx_gppi_channel_endpoints_setup(p_ring->ppi_channel,
+        nrfy_uarte_event_address_get(UARTE_REG(p_instance), NRF_UARTE_EVENT_RXDRDY),
+        nrfy_timer_task_address_get(p_config->p_timer, NRF_TIMER_TASK_COUNT));
+    nrfx_gppi_channels_enable(NRFX_BIT(p_ring->ppi_channel));
+
+    p_ring->active = true;
+
+    NRFX_LOG_INFO("Ring rx: %d buffers of %d bytes.", p_config->buffer_count,
+                  p_config->buffer_size);
+
+    nrfy_uarte_event_clear(UARTE_REG(p_instance), NRF_UARTE_EVENT_ENDRX);
+    nrfy_uarte_event_clear(UARTE_REG(p_instance), NRF_UARTE_EVENT_RXTO);
+    nrfy_uarte_event_clear(UARTE_REG(p_instance), NRF_UARTE_EVENT_RXSTARTED);
+    nrfy_uarte_rx_buffer_set(UARTE_REG(p_instance), rx_ring_buffer_get(p_ring, 0),
+                             p_config->buffer_size);
+    // Each next buffer is set on RXSTARTED, so that ENDRX restarts reception without delay.
+    nrfy_uarte_shorts_enable(UARTE_REG(p_instance), NRF_UARTE_SHORT_ENDRX_STARTRX);
+    nrfy_uarte_int_enable(UARTE_REG(p_instance), RX_RING_INT_MASK);
+    nrfy_uarte_task_trigger(UARTE_REG(p_instance), NRF_UARTE_TASK_STARTRX);
+
+    return NRFX_SUCCESS;
+}
+
+size_t nrfx_uarte_rx_ring_flush(nrfx_uarte_t const * p_instance)
+{
+    uarte_control_block_t * p_cb   = &m_cb[UARTE_IDX(p_instance)];
+    uarte_rx_ring_t *       p_ring = &p_cb->rx_ring;
+    size_t                  length = 0;
+
+    nrfy_uarte_int_disable(UARTE_REG(p_instance), RX_RING_INT_MASK);
+
+    // After STOPRX the remaining data is reported on RXTO.
+    if (p_ring->active && !p_ring->stopping)
+    {
+        uint32_t count = nrfy_timer_capture_get(p_ring->config.p_timer, NRF_TIMER_CC_CHANNEL0);
+
+        length = NRFX_MIN((size_t)(count - p_ring->reported), rx_ring_fill_pending_get(p_ring));
+        rx_ring_report(p_cb, length);
+    }
+
+    nrfy_uarte_int_enable(UARTE_REG(p_instance), p_ring->active ?
+                                                 RX_RING_INT_MASK :
+                                                 RX_RING_INT_MASK & ~NRF_UARTE_INT_RXSTARTED_MASK);
+    return length;
+}
+
+void nrfx_uarte_rx_ring_stop(nrfx_uarte_t const * p_instance)
 {
+    uarte_rx_ring_t * p_ring = &m_cb[UARTE_IDX(p_instance)].rx_ring;
+
+    NRFX_ASSERT(p_ring->active);
+
+    p_ring->stopping = true;
+    nrfy_uarte_shorts_disable(UARTE_REG(p_instance), NRF_UARTE_SHORT_ENDRX_STARTRX);
+    nrfy_uarte_task_trigger(UARTE_REG(p_instance), NRF_UARTE_TASK_STOPRX);
+    NRFX_LOG_INFO("Ring rx stopped.");
+}
+
+static void rx_ring_irq_handler(NRF_UARTE_Type * p_reg, uarte_control_block_t * p_cb)
+{
+    uarte_rx_ring_t *      p_ring    = &p_cb->rx_ring;
     nrfy_uarte_xfer_desc_t xfer_desc = {
-        .p_buffer = p_cb->p_rx_buffer,
-        .length   = p_cb->rx_buffer_length
+        .p_buffer = rx_ring_buffer_get(p_ring, p_ring->fill_idx),
+        .length   = p_ring->config.buffer_size
     };
     uint32_t evt_mask = nrfy_uarte_events_process(p_reg,
                                             NRFY_EVENT_TO_INT_BITMASK(NRF_UARTE_EVENT_ERROR) |
                                             NRFY_EVENT_TO_INT_BITMASK(NRF_UARTE_EVENT_ENDRX) |
-                                            NRFY_EVENT_TO_INT_BITMASK(NRF_UARTE_EVENT_ENDTX) |
-                                            NRFY_EVENT_TO_INT_BITMASK(NRF_UARTE_EVENT_RXTO)  |
-                                            NRFY_EVENT_TO_INT_BITMASK(NRF_UARTE_EVENT_TXSTOPPED),
+                                            NRFY_EVENT_TO_INT_BITMASK(NRF_UARTE_EVENT_RXSTARTED) |
+                                            NRFY_EVENT_TO_INT_BITMASK(NRF_UARTE_EVENT_RXTO),
                                             &xfer_desc);
 
+    if (evt_mask & NRFY_EVENT_TO_INT_BITMASK(NRF_UARTE_EVENT_ERROR))
+    {
+        // Reception continues after an error, only the error source is reported.
+        nrfx_uarte_event_t event;
+        event.type                   = NRFX_UARTE_EVT_ERROR;
+        event.data.error.error_mask  = nrfy_uarte_errorsrc_get_and_clear(p_reg);
+        event.data.error.rx.bytes    = 0;
+        event.data.error.rx.p_data   = p_ring->config.p_buffer + p_ring->report_pos;
+
+        p_cb->handler(&event, p_cb->p_context);
+    }
+
+    // On a stop ENDRX ends a partially filled buffer, which is reported on RXTO.
+    if ((evt_mask & NRFY_EVENT_TO_INT_BITMASK(NRF_UARTE_EVENT_ENDRX)) && !p_ring->stopping)
+    {
+        // RXDRDY may be counted before the byte reaches RAM, so full buffers are reported
+        // on ENDRX rather than from the counter.
+        rx_ring_report(p_cb, rx_ring_fill_pending_get(p_ring));
+        p_ring->fill_idx = (uint8_t)((p_ring->fill_idx + 1) % p_ring->config.buffer_count);
+    }
+
+    if ((evt_mask & NRFY_EVENT_TO_INT_BITMASK(NRF_UARTE_EVENT_RXSTARTED)) && !p_ring->stopping)
+    {
+        uint8_t next_idx = (uint8_t)((p_ring->fill_idx + 1) % p_ring->config.buffer_count);
+
+        nrfy_uarte_rx_buffer_set(p_reg, rx_ring_buffer_get(p_ring, next_idx),
+                                 p_ring->config.buffer_size);
+    }
+
+    if (evt_mask & NRFY_EVENT_TO_INT_BITMASK(NRF_UARTE_EVENT_RXTO))
+    {
+        size_t received = (size_t)p_ring->fill_idx * p_ring->config.buffer_size +
+                          nrfy_uarte_rx_amount_get(p_reg);
+
+        rx_ring_teardown(p_reg, p_ring);
+        if (received > p_ring->report_pos)
+        {
+            rx_ring_report(p_cb, received - p_ring->report_pos);
+        }
+    }
+}
+#endif // NRFX_CHECK(NRFX_UARTE_CONFIG_RX_RING_ENABLED)
+
+static void irq_handler(NRF_UARTE_Type * p_reg, uarte_control_block_t * p_cb)
+{
+    nrfy_uarte_xfer_desc_t xfer_desc = {
+        .p_buffer = p_cb->p_rx_buffer,
+        .length   = p_cb->rx_buffer_length
+    };
+    uint32_t rx_evt_mask = NRFY_EVENT_TO_INT_BITMASK(NRF_UARTE_EVENT_ERROR) |
+                           NRFY_EVENT_TO_INT_BITMASK(NRF_UARTE_EVENT_ENDRX) |
+                           NRFY_EVENT_TO_INT_BITMASK(NRF_UARTE_EVENT_RXTO);
+
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_RX_RING_ENABLED)
+    if (p_cb->rx_ring.active)
+    {
+        rx_ring_irq_handler(p_reg, p_cb);
+        rx_evt_mask = 0;
+    }
+#endif
+
+    uint32_t tx_evt_mask = NRFY_EVENT_TO_INT_BITMASK(NRF_UARTE_EVENT_ENDTX) |
+                           NRFY_EVENT_TO_INT_BITMASK(NRF_UARTE_EVENT_TXSTOPPED);
+
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_TX_LIST_ENABLED)
+    tx_evt_mask |= NRFY_EVENT_TO_INT_BITMASK(NRF_UARTE_EVENT_TXSTARTED);
+#endif
+
+    uint32_t evt_mask = nrfy_uarte_events_process(p_reg, rx_evt_mask | tx_evt_mask, &xfer_desc);
+
     if (evt_mask & NRFY_EVENT_TO_INT_BITMASK(NRF_UARTE_EVENT_ERROR))
     {
         nrfx_uarte_event_t event;
@@ -614,23 +1481,54 @@ static void irq_handler(NRF_UARTE_Type * p_reg, uarte_control_block_t * p_cb)
             else
             {
                 p_cb->rx_buffer_length = 0;
-                rx_done_event(p_cb, amount, p_cb->p_rx_buffer);
+                rx_wakeup_stop(p_reg, p_cb);
+                rx_buffer_done(p_cb, amount, p_cb->p_rx_buffer);
             }
         }
     }
 
     if (evt_mask & NRFY_EVENT_TO_INT_BITMASK(NRF_UARTE_EVENT_RXTO))
     {
-        if (p_cb->rx_buffer_length != 0)
+        // RXTO after the stop of a filled buffer does not belong to the next armed buffer.
+        if (!rx_wakeup_stopped_check(p_cb) && (p_cb->rx_buffer_length != 0))
         {
             p_cb->rx_buffer_length = 0;
             // In case of using double-buffered reception both variables storing buffer length
             // have to be cleared to prevent incorrect behaviour of the driver.
             p_cb->rx_secondary_buffer_length = 0;
-            rx_done_event(p_cb, nrfy_uarte_rx_amount_get(p_reg), p_cb->p_rx_buffer);
+            rx_buffer_done(p_cb, nrfy_uarte_rx_amount_get(p_reg), p_cb->p_rx_buffer);
         }
     }
 
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_TX_LIST_ENABLED)
+    // Until the last buffer of the list starts, ENDTX only restarts the transmitter.
+    if ((evt_mask & NRFY_EVENT_TO_INT_BITMASK(NRF_UARTE_EVENT_ENDTX)) && p_cb->p_tx_list)
+    {
+        evt_mask &= ~NRFY_EVENT_TO_INT_BITMASK(NRF_UARTE_EVENT_ENDTX);
+    }
+#endif
+
+#if NRFX_UARTE_CONFIG_TX_BOUNCE_SIZE > 0
+    // The last chunk of a bounced transfer completes it through the regular ENDTX path.
+    if ((evt_mask & NRFY_EVENT_TO_INT_BITMASK(NRF_UARTE_EVENT_ENDTX)) &&
+        (p_cb->tx_bounce_pending != 0))
+    {
+        uint8_t next = p_cb->tx_bounce_next;
+
+        p_cb->tx_bounce_bytes += nrfy_uarte_tx_amount_get(p_reg);
+        nrfy_uarte_tx_buffer_set(p_reg,
+                                 &p_cb->tx_bounce[next * TX_BOUNCE_CHUNK_SIZE],
+                                 p_cb->tx_bounce_pending);
+        (void)nrfy_uarte_tx_start(p_reg, false);
+
+        // The half that has just been sent is free, copy the following chunk into it.
+        p_cb->tx_bounce_next    = next ^ 1;
+        p_cb->tx_bounce_pending = tx_bounce_fill(p_cb, next ^ 1);
+
+        evt_mask &= ~NRFY_EVENT_TO_INT_BITMASK(NRF_UARTE_EVENT_ENDTX);
+    }
+#endif
+
     if (evt_mask & NRFY_EVENT_TO_INT_BITMASK(NRF_UARTE_EVENT_ENDTX))
     {
         // Transmitter has to be stopped by triggering STOPTX task to achieve
@@ -643,6 +1541,30 @@ static void irq_handler(NRF_UARTE_Type * p_reg, uarte_control_block_t * p_cb)
         }
     }
 
+#if NRFX_CHECK(NRFX_UARTE_CONFIG_TX_LIST_ENABLED)
+    if ((evt_mask & NRFY_EVENT_TO_INT_BITMASK(NRF_UARTE_EVENT_TXSTARTED)) && p_cb->p_tx_list)
+    {
+        size_t started = p_cb->tx_list_idx++;
+
+        if (started > 0)
+        {
+            p_cb->tx_list_bytes += p_cb->p_tx_list[started - 1].length;
+        }
+
+        if (p_cb->tx_list_idx < p_cb->tx_list_count)
+        {
+            nrfy_uarte_tx_buffer_set(p_reg,
+                                     p_cb->p_tx_list[p_cb->tx_list_idx].p_data,
+                                     p_cb->p_tx_list[p_cb->tx_list_idx].length);
+        }
+        else
+        {
+            // The last buffer is being sent, its ENDTX completes the transfer.
+            tx_list_end(p_reg, p_cb);
+        }
+    }
+#endif
+
     if (evt_mask & NRFY_EVENT_TO_INT_BITMASK(NRF_UARTE_EVENT_TXSTOPPED))
     {
         if (p_cb->tx_buffer_length != 0)
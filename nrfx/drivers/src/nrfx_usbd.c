@@ -62,6 +62,24 @@
 #define NRFX_USBD_CONFIG_ISO_IN_ZLP  0
 #endif
 
+#ifndef NRFX_USBD_CONFIG_DMASCHEDULER_MODE
+/*
+ * EasyDMA scheduling mode: 0 - prioritized, 1 - round robin.
+ */
+#define NRFX_USBD_CONFIG_DMASCHEDULER_MODE  0
+#endif
+
+#ifndef NRFX_USBD_CONFIG_DMASCHEDULER_BATCH_SIZE
+/*
+ * Maximum number of EasyDMA transfers started in a single interrupt.
+ */
+#define NRFX_USBD_CONFIG_DMASCHEDULER_BATCH_SIZE  1
+#endif
+
+#if NRFX_USBD_CONFIG_DMASCHEDULER_BATCH_SIZE < 1
+#error "NRFX_USBD_CONFIG_DMASCHEDULER_BATCH_SIZE must be at least 1."
+#endif
+
 #ifndef NRFX_USBD_ISO_DEBUG
 /* Also generate information about ISOCHRONOUS events and transfers.
  * Turn this off if no ISOCHRONOUS transfers are going to be debugged and this
@@ -280,6 +298,13 @@ static bool m_dma_pending;
  */
 static uint8_t m_dma_odd;
 
+#if (NRFX_USBD_CONFIG_DMASCHEDULER_MODE == 1)
+/**
+ * @brief Bit position of the endpoint served last by the round robin scheduler.
+ */
+static uint8_t m_dma_rr_last;
+#endif
+
 /**
  * @brief First time enabling after reset. Used in nRF52 errata 223.
  */
@@ -336,6 +361,50 @@ nrfx_usbd_transfer_t m_ep_feeder_state[NRF_USBD_EPIN_CNT];
  */
 nrfx_usbd_transfer_t m_ep_consumer_state[NRF_USBD_EPOUT_CNT];
 
+#if (NRFX_USBD_CONFIG_ISO_STREAM_MAX_BUFFERS > 0)
+/** @brief Isochronous stream data. */
+typedef struct
+{
+    uint8_t *                    p_buffers;    //!< Memory for the ring of buffers.
+    uint16_t                     buffer_size;  //!< Size of a single buffer.
+    uint8_t                      buffer_count; //!< Number of buffers in the ring.
+    bool                         dma_slot;     //!< EasyDMA transfer uses a buffer from the ring.
+    volatile uint32_t            wr;           //!< Number of buffers filled by the producer.
+    volatile uint32_t            rd;           //!< Number of buffers consumed by the consumer.
+    nrfx_usbd_iso_stream_stats_t stats;        //!< Stream statistics.
+    /** Amount of data in each buffer. */
+    uint16_t                     lengths[NRFX_USBD_CONFIG_ISO_STREAM_MAX_BUFFERS];
+} usbd_iso_stream_t;
+
+/**
+ * @brief Isochronous streams.
+ *
+ * Index 0 is used for the IN stream, index 1 for the OUT stream.
+ * For the IN stream, the application is the producer and the driver is the consumer.
+ * For the OUT stream, the roles are reversed.
+ */
+static usbd_iso_stream_t m_iso_stream[2];
+#endif
+
+#if (NRFX_USBD_CONFIG_OUT_RING_MAX_SLOTS > 0)
+/** @brief Ring of an OUT endpoint, filled directly by EasyDMA. */
+typedef struct
+{
+    uint8_t *         p_slots;      //!< Memory for the ring of slots, NULL if the ring is stopped.
+    uint16_t          slot_size;    //!< Size of a single slot.
+    uint8_t           slot_count;   //!< Number of slots in the ring.
+    uint16_t          packet_size;  //!< Maximum packet size of the endpoint.
+    uint16_t          dma_size;     //!< Size of the packet being transferred by EasyDMA.
+    volatile uint32_t wr;           //!< Number of slots filled by the driver.
+    volatile uint32_t rd;           //!< Number of slots released by the application.
+    /** Amount of data in each slot. */
+    uint16_t          lengths[NRFX_USBD_CONFIG_OUT_RING_MAX_SLOTS];
+} usbd_out_ring_t;
+
+/** @brief Rings of the OUT endpoints, indexed by the endpoint number. */
+static usbd_out_ring_t m_out_ring[NRF_USBD_EPOUT_CNT];
+#endif
+
 
 /**
  * @brief Buffer used to send data directly from FLASH.
@@ -627,6 +696,105 @@ bool nrfx_usbd_feeder_flash_zlp(nrfx_usbd_ep_transfer_t * p_next, void * p_conte
     return (tx_size != 0);
 }
 
+#if (NRFX_USBD_CONFIG_ISO_STREAM_MAX_BUFFERS > 0)
+static inline usbd_iso_stream_t * usbd_iso_stream_get(nrfx_usbd_ep_t ep)
+{
+    NRFX_ASSERT(NRF_USBD_EPISO_CHECK(ep));
+    return &m_iso_stream[NRF_USBD_EPIN_CHECK(ep) ? 0 : 1];
+}
+
+static inline uint8_t * usbd_iso_stream_slot_get(usbd_iso_stream_t const * p_stream,
+                                                 uint32_t                  index)
+{
+    return p_stream->p_buffers + ((index % p_stream->buffer_count) * p_stream->buffer_size);
+}
+
+/**
+ * @brief Feeder of the isochronous IN stream.
+ *
+ * The buffer is released when its EasyDMA transfer is finished,
+ * see @ref usbd_iso_stream_dma_end.
+ */
+static bool usbd_iso_stream_feeder(nrfx_usbd_ep_transfer_t * p_next,
+                                   void *                    p_context,
+                                   size_t                    ep_size)
+{
+    usbd_iso_stream_t * p_stream = (usbd_iso_stream_t *)p_context;
+
+    if (p_stream->wr != p_stream->rd)
+    {
+        size_t size = p_stream->lengths[p_stream->rd % p_stream->buffer_count];
+        p_next->p_data.tx  = usbd_iso_stream_slot_get(p_stream, p_stream->rd);
+        p_next->size       = NRFX_MIN(size, ep_size);
+        p_stream->dma_slot = true;
+    }
+    else
+    {
+        p_stream->stats.underruns++;
+        p_next->p_data.tx  = NULL;
+        p_next->size       = 0;
+        p_stream->dma_slot = false;
+    }
+    return true;
+}
+
+/**
+ * @brief Consumer of the isochronous OUT stream.
+ *
+ * The buffer is passed to the application when its EasyDMA transfer is finished,
+ * see @ref usbd_iso_stream_dma_end.
+ */
+static bool usbd_iso_stream_consumer(nrfx_usbd_ep_transfer_t * p_next,
+                                     void *                    p_context,
+                                     size_t                    ep_size,
+                                     size_t                    data_size)
+{
+    (void)ep_size;
+    usbd_iso_stream_t * p_stream = (usbd_iso_stream_t *)p_context;
+
+    if (((p_stream->wr - p_stream->rd) < p_stream->buffer_count) &&
+        (data_size <= p_stream->buffer_size))
+    {
+        p_stream->lengths[p_stream->wr % p_stream->buffer_count] = (uint16_t)data_size;
+        p_next->p_data.rx  = usbd_iso_stream_slot_get(p_stream, p_stream->wr);
+        p_next->size       = data_size;
+        p_stream->dma_slot = true;
+    }
+    else
+    {
+        /* Drop the packet. */
+        p_stream->stats.overruns++;
+        p_next->p_data.rx  = NULL;
+        p_next->size       = 0;
+        p_stream->dma_slot = false;
+    }
+    return true;
+}
+
+/**
+ * @brief Pass the buffer used in the finished EasyDMA transfer to the other side of the stream.
+ *
+ * @param ep ISO endpoint number.
+ */
+static void usbd_iso_stream_dma_end(nrfx_usbd_ep_t ep)
+{
+    usbd_iso_stream_t * p_stream = usbd_iso_stream_get(ep);
+
+    if (p_stream->dma_slot)
+    {
+        p_stream->dma_slot = false;
+        if (NRF_USBD_EPIN_CHECK(ep))
+        {
+            p_stream->rd++;
+        }
+        else
+        {
+            p_stream->wr++;
+        }
+    }
+}
+#endif // (NRFX_USBD_CONFIG_ISO_STREAM_MAX_BUFFERS > 0)
+
 /** @} */
 
 /**
@@ -875,6 +1043,68 @@ static inline void usbd_int_rise(void)
     NRFX_IRQ_PENDING_SET(USBD_IRQn);
 }
 
+#if (NRFX_USBD_CONFIG_OUT_RING_MAX_SLOTS > 0)
+static inline usbd_out_ring_t * usbd_out_ring_get(nrfx_usbd_ep_t ep)
+{
+    NRFX_ASSERT(NRF_USBD_EPOUT_CHECK(ep) && !NRF_USBD_EPISO_CHECK(ep));
+    NRFX_ASSERT(NRF_USBD_EP_NR_GET(ep) > 0);
+    return &m_out_ring[NRF_USBD_EP_NR_GET(ep)];
+}
+
+static inline uint8_t * usbd_out_ring_slot_get(usbd_out_ring_t const * p_ring, uint32_t index)
+{
+    return p_ring->p_slots + ((index % p_ring->slot_count) * p_ring->slot_size);
+}
+
+/**
+ * @brief Consumer of the OUT ring.
+ *
+ * The packet is placed after the data already stored in the slot. The consumer is called
+ * only if there is a free slot, see @ref usbd_out_ring_dma_end.
+ */
+static bool usbd_out_ring_consumer(nrfx_usbd_ep_transfer_t * p_next,
+                                   void *                    p_context,
+                                   size_t                    ep_size,
+                                   size_t                    data_size)
+{
+    (void)ep_size;
+    usbd_out_ring_t * p_ring = (usbd_out_ring_t *)p_context;
+    NRFX_ASSERT((p_ring->wr - p_ring->rd) < p_ring->slot_count);
+
+    uint16_t fill = p_ring->lengths[p_ring->wr % p_ring->slot_count];
+    p_next->p_data.rx = usbd_out_ring_slot_get(p_ring, p_ring->wr) + fill;
+    p_next->size      = NRFX_MIN(data_size, (size_t)(p_ring->slot_size - fill));
+    p_ring->dma_size  = (uint16_t)data_size;
+    return true;
+}
+
+/**
+ * @brief Account the packet stored by the finished EasyDMA transfer.
+ *
+ * When the ring becomes full, the endpoint is no longer served, so the peripheral
+ * responds with NAK until a slot is released.
+ *
+ * @param ep OUT endpoint number.
+ */
+static void usbd_out_ring_dma_end(nrfx_usbd_ep_t ep)
+{
+    usbd_out_ring_t * p_ring = usbd_out_ring_get(ep);
+    uint16_t *        p_fill = &p_ring->lengths[p_ring->wr % p_ring->slot_count];
+
+    *p_fill += p_ring->dma_size;
+    if ((p_ring->dma_size < p_ring->packet_size) || (*p_fill == p_ring->slot_size))
+    {
+        p_ring->wr++;
+        if ((p_ring->wr - p_ring->rd) == p_ring->slot_count)
+        {
+            (void)(NRFX_ATOMIC_FETCH_AND(&m_ep_dma_waiting, ~(1U << ep2bit(ep))));
+        }
+        NRFX_USBD_EP_TRANSFER_EVENT(evt, ep, NRFX_USBD_EP_OK);
+        m_event_handler(&evt);
+    }
+}
+#endif // (NRFX_USBD_CONFIG_OUT_RING_MAX_SLOTS > 0)
+
 /**
  * @name USBD interrupt runtimes.
  *
@@ -992,6 +1222,12 @@ static inline void nrf_usbd_epiniso_dma_handler(nrfx_usbd_ep_t ep)
         NRFX_USBD_EP_TRANSFER_EVENT(evt, ep, NRFX_USBD_EP_OK);
         m_event_handler(&evt);
     }
+#if (NRFX_USBD_CONFIG_ISO_STREAM_MAX_BUFFERS > 0)
+    else if (p_state->handler.feeder == usbd_iso_stream_feeder)
+    {
+        usbd_iso_stream_dma_end(ep);
+    }
+#endif
     else
     {
         /* Nothing to do */
@@ -1057,6 +1293,12 @@ static inline void nrf_usbd_epout_dma_handler(nrfx_usbd_ep_t ep)
         NRFX_USBD_EP_TRANSFER_EVENT(evt, ep, NRFX_USBD_EP_OK);
         m_event_handler(&evt);
     }
+#if (NRFX_USBD_CONFIG_OUT_RING_MAX_SLOTS > 0)
+    else if (p_state->handler.consumer == usbd_out_ring_consumer)
+    {
+        usbd_out_ring_dma_end(ep);
+    }
+#endif
     else
     {
         /* Nothing to do */
@@ -1092,6 +1334,12 @@ static inline void nrf_usbd_epoutiso_dma_handler(nrfx_usbd_ep_t ep)
         NRFX_USBD_EP_TRANSFER_EVENT(evt, ep, NRFX_USBD_EP_OK);
         m_event_handler(&evt);
     }
+#if (NRFX_USBD_CONFIG_ISO_STREAM_MAX_BUFFERS > 0)
+    else if (p_state->handler.consumer == usbd_iso_stream_consumer)
+    {
+        usbd_iso_stream_dma_end(ep);
+    }
+#endif
     else
     {
         /* Nothing to do */
@@ -1315,8 +1563,22 @@ static void ev_epdata_handler(void)
  */
 static uint8_t usbd_dma_scheduler_algorithm(uint32_t req)
 {
-    /* Only prioritized scheduling mode is supported. */
+#if (NRFX_USBD_CONFIG_DMASCHEDULER_MODE == 1)
+    /* The control endpoint is always served first. */
+    const uint32_t ep0_mask = (1U << ep2bit(NRFX_USBD_EPIN0)) | (1U << ep2bit(NRFX_USBD_EPOUT0));
+    if ((req & ep0_mask) != 0)
+    {
+        return NRF_CTZ(req & ep0_mask);
+    }
+
+    /* Other endpoints are served in turns, starting from the one after the last served. */
+    uint32_t req_next = req & ~((2UL << m_dma_rr_last) - 1UL);
+    m_dma_rr_last = NRF_CTZ((req_next != 0) ? req_next : req);
+    return m_dma_rr_last;
+#else
+    /* Prioritized scheduling mode. */
     return NRF_CTZ(req);
+#endif
 }
 
 /**
@@ -1341,6 +1603,46 @@ static inline size_t usbd_ep_iso_capacity(nrfx_usbd_ep_t ep)
     return NRFX_USBD_ISOSIZE;
 }
 
+#if (NRFX_USBD_CONFIG_DMASCHEDULER_BATCH_SIZE > 1)
+/**
+ * @brief Handle the end of EasyDMA transfer directly, without waiting for the interrupt.
+ *
+ * @param ep Endpoint number.
+ */
+static void usbd_dma_end_handle(nrfx_usbd_ep_t ep)
+{
+    nrf_usbd_event_clear(NRF_USBD, nrfx_usbd_ep_to_endevent(ep));
+
+    if (ep == NRFX_USBD_EPIN0)
+    {
+        nrf_usbd_ep0in_dma_handler();
+    }
+    else if (ep == NRFX_USBD_EPOUT0)
+    {
+        nrf_usbd_ep0out_dma_handler();
+    }
+    else if (NRF_USBD_EPISO_CHECK(ep))
+    {
+        if (NRF_USBD_EPIN_CHECK(ep))
+        {
+            nrf_usbd_epiniso_dma_handler(ep);
+        }
+        else
+        {
+            nrf_usbd_epoutiso_dma_handler(ep);
+        }
+    }
+    else if (NRF_USBD_EPIN_CHECK(ep))
+    {
+        nrf_usbd_epin_dma_handler(ep);
+    }
+    else
+    {
+        nrf_usbd_epout_dma_handler(ep);
+    }
+}
+#endif
+
 /**
  * @brief Process all DMA requests.
  *
@@ -1353,6 +1655,9 @@ static void usbd_dmareq_process(void)
     if (!m_dma_pending)
     {
         uint32_t req;
+#if (NRFX_USBD_CONFIG_DMASCHEDULER_BATCH_SIZE > 1)
+        uint32_t transfers = 0;
+#endif
         while (0 != (req = m_ep_dma_waiting & m_ep_ready))
         {
             uint8_t pos;
@@ -1449,6 +1754,15 @@ static void usbd_dmareq_process(void)
             /* DMA finished, track if total bytes transferred is even or odd */
             m_dma_odd ^= nrf_usbd_ep_amount_get(NRF_USBD, ep) & 1;
 
+#if (NRFX_USBD_CONFIG_DMASCHEDULER_BATCH_SIZE > 1)
+            /* The transfer is already finished, so its end can be handled here and
+             * the next ready endpoint can be served without another interrupt. */
+            usbd_dma_end_handle(ep);
+            if (++transfers < NRFX_USBD_CONFIG_DMASCHEDULER_BATCH_SIZE)
+            {
+                continue;
+            }
+#endif
             if (NRFX_USBD_DMAREQ_PROCESS_DEBUG)
             {
                 NRFX_LOG_DEBUG("USB DMA process - finishing");
@@ -1627,6 +1941,8 @@ static const nrfx_irq_handler_t m_isr[] =
  */
 void nrfx_usbd_irq_handler(void)
 {
+    NRFX_IRQ_ENTER(NRF_USBD);
+
     const uint32_t enabled = nrf_usbd_int_enable_get(NRF_USBD);
     uint32_t to_process = enabled;
     uint32_t active = 0;
@@ -1659,6 +1975,8 @@ void nrfx_usbd_irq_handler(void)
     {
         m_isr[USBD_INTEN_EP0SETUP_Pos]();
     }
+
+    NRFX_IRQ_EXIT(NRF_USBD);
 }
 
 /** @} */
@@ -2197,6 +2515,189 @@ void * nrfx_usbd_feeder_buffer_get(void)
     return m_tx_buffer;
 }
 
+#if (NRFX_USBD_CONFIG_ISO_STREAM_MAX_BUFFERS > 0)
+nrfx_err_t nrfx_usbd_iso_stream_start(nrfx_usbd_ep_t                        ep,
+                                      nrfx_usbd_iso_stream_config_t const * p_config)
+{
+    NRFX_ASSERT(NRF_USBD_EPISO_CHECK(ep));
+    NRFX_ASSERT(p_config);
+
+    if ((p_config->buffer_count == 0) ||
+        (p_config->buffer_count > NRFX_USBD_CONFIG_ISO_STREAM_MAX_BUFFERS) ||
+        (p_config->buffer_size == 0) ||
+        !nrfx_is_in_ram(p_config->p_buffers))
+    {
+        return NRFX_ERROR_INVALID_PARAM;
+    }
+
+    usbd_iso_stream_t * p_stream = usbd_iso_stream_get(ep);
+    p_stream->p_buffers       = (uint8_t *)p_config->p_buffers;
+    p_stream->buffer_size     = p_config->buffer_size;
+    p_stream->buffer_count    = p_config->buffer_count;
+    p_stream->dma_slot        = false;
+    p_stream->wr              = 0;
+    p_stream->rd              = 0;
+    p_stream->stats.underruns = 0;
+    p_stream->stats.overruns  = 0;
+
+    nrfx_usbd_handler_desc_t handler_desc = { .p_context = p_stream };
+    if (NRF_USBD_EPIN_CHECK(ep))
+    {
+        handler_desc.handler.feeder = usbd_iso_stream_feeder;
+    }
+    else
+    {
+        handler_desc.handler.consumer = usbd_iso_stream_consumer;
+    }
+
+    return nrfx_usbd_ep_handled_transfer(ep, &handler_desc);
+}
+
+void nrfx_usbd_iso_stream_stop(nrfx_usbd_ep_t ep)
+{
+    usbd_iso_stream_t * p_stream = usbd_iso_stream_get(ep);
+
+    usbd_ep_abort(ep);
+    p_stream->dma_slot = false;
+    p_stream->wr       = 0;
+    p_stream->rd       = 0;
+}
+
+void * nrfx_usbd_iso_stream_buffer_get(nrfx_usbd_ep_t ep, size_t * p_size)
+{
+    NRFX_ASSERT(p_size);
+    usbd_iso_stream_t const * p_stream = usbd_iso_stream_get(ep);
+    uint32_t filled = p_stream->wr - p_stream->rd;
+
+    if (NRF_USBD_EPIN_CHECK(ep))
+    {
+        if (filled >= p_stream->buffer_count)
+        {
+            return NULL;
+        }
+        *p_size = p_stream->buffer_size;
+        return usbd_iso_stream_slot_get(p_stream, p_stream->wr);
+    }
+    else
+    {
+        if (filled == 0)
+        {
+            return NULL;
+        }
+        *p_size = p_stream->lengths[p_stream->rd % p_stream->buffer_count];
+        return usbd_iso_stream_slot_get(p_stream, p_stream->rd);
+    }
+}
+
+void nrfx_usbd_iso_stream_buffer_release(nrfx_usbd_ep_t ep, size_t size)
+{
+    usbd_iso_stream_t * p_stream = usbd_iso_stream_get(ep);
+
+    if (NRF_USBD_EPIN_CHECK(ep))
+    {
+        NRFX_ASSERT((p_stream->wr - p_stream->rd) < p_stream->buffer_count);
+        NRFX_ASSERT(size <= p_stream->buffer_size);
+        p_stream->lengths[p_stream->wr % p_stream->buffer_count] = (uint16_t)size;
+        p_stream->wr++;
+    }
+    else
+    {
+        NRFX_ASSERT(p_stream->wr != p_stream->rd);
+        p_stream->rd++;
+    }
+}
+
+void nrfx_usbd_iso_stream_stats_get(nrfx_usbd_ep_t ep, nrfx_usbd_iso_stream_stats_t * p_stats)
+{
+    NRFX_ASSERT(p_stats);
+    usbd_iso_stream_t const * p_stream = usbd_iso_stream_get(ep);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    *p_stats = p_stream->stats;
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+#endif // (NRFX_USBD_CONFIG_ISO_STREAM_MAX_BUFFERS > 0)
+
+#if (NRFX_USBD_CONFIG_OUT_RING_MAX_SLOTS > 0)
+nrfx_err_t nrfx_usbd_out_ring_start(nrfx_usbd_ep_t                      ep,
+                                    nrfx_usbd_out_ring_config_t const * p_config)
+{
+    NRFX_ASSERT(p_config);
+    usbd_out_ring_t * p_ring = usbd_out_ring_get(ep);
+    uint16_t packet_size = nrfx_usbd_ep_max_packet_size_get(ep);
+
+    if ((p_config->slot_count == 0) ||
+        (p_config->slot_count > NRFX_USBD_CONFIG_OUT_RING_MAX_SLOTS) ||
+        (p_config->slot_size == 0) ||
+        ((p_config->slot_size % packet_size) != 0) ||
+        !nrfx_is_in_ram(p_config->p_slots) ||
+        !nrfx_is_word_aligned(p_config->p_slots))
+    {
+        return NRFX_ERROR_INVALID_PARAM;
+    }
+
+    p_ring->p_slots     = (uint8_t *)p_config->p_slots;
+    p_ring->slot_size   = p_config->slot_size;
+    p_ring->slot_count  = p_config->slot_count;
+    p_ring->packet_size = packet_size;
+    p_ring->wr          = 0;
+    p_ring->rd          = 0;
+    memset(p_ring->lengths, 0, sizeof(p_ring->lengths));
+
+    nrfx_usbd_handler_desc_t handler_desc = {
+        .handler.consumer = usbd_out_ring_consumer,
+        .p_context        = p_ring
+    };
+
+    nrfx_err_t err_code = nrfx_usbd_ep_handled_transfer(ep, &handler_desc);
+    if (err_code != NRFX_SUCCESS)
+    {
+        p_ring->p_slots = NULL;
+    }
+    return err_code;
+}
+
+void nrfx_usbd_out_ring_stop(nrfx_usbd_ep_t ep)
+{
+    usbd_out_ring_t * p_ring = usbd_out_ring_get(ep);
+
+    usbd_ep_abort(ep);
+    ep_state_access(ep)->handler.consumer = NULL;
+    p_ring->p_slots = NULL;
+    p_ring->wr      = 0;
+    p_ring->rd      = 0;
+}
+
+void * nrfx_usbd_out_ring_slot_get(nrfx_usbd_ep_t ep, size_t * p_size)
+{
+    NRFX_ASSERT(p_size);
+    usbd_out_ring_t const * p_ring = usbd_out_ring_get(ep);
+
+    if ((p_ring->p_slots == NULL) || (p_ring->wr == p_ring->rd))
+    {
+        return NULL;
+    }
+    *p_size = p_ring->lengths[p_ring->rd % p_ring->slot_count];
+    return usbd_out_ring_slot_get(p_ring, p_ring->rd);
+}
+
+void nrfx_usbd_out_ring_slot_release(nrfx_usbd_ep_t ep)
+{
+    usbd_out_ring_t * p_ring = usbd_out_ring_get(ep);
+    NRFX_ASSERT(p_ring->wr != p_ring->rd);
+
+    p_ring->lengths[p_ring->rd % p_ring->slot_count] = 0;
+    p_ring->rd++;
+
+    if (p_ring->p_slots)
+    {
+        /* Resume the reception held when the ring was full. */
+        (void)(NRFX_ATOMIC_FETCH_OR(&m_ep_dma_waiting, 1U << ep2bit(ep)));
+        usbd_int_rise();
+    }
+}
+#endif // (NRFX_USBD_CONFIG_OUT_RING_MAX_SLOTS > 0)
+
 nrfx_usbd_ep_status_t nrfx_usbd_ep_status_get(nrfx_usbd_ep_t ep, size_t * p_size)
 {
     nrfx_usbd_ep_status_t ret;
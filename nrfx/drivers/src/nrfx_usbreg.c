@@ -82,6 +82,8 @@ void nrfx_usbreg_uninit(void)
 
 void nrfx_usbreg_irq_handler(void)
 {
+    NRFX_IRQ_ENTER(NRF_USBREGULATOR);
+
     if (nrf_usbreg_event_check(NRF_USBREGULATOR, NRF_USBREG_EVENT_USBDETECTED))
     {
         nrf_usbreg_event_clear(NRF_USBREGULATOR, NRF_USBREG_EVENT_USBDETECTED);
@@ -97,6 +99,8 @@ void nrfx_usbreg_irq_handler(void)
         nrf_usbreg_event_clear(NRF_USBREGULATOR, NRF_USBREG_EVENT_USBPWRRDY);
         m_usbevt_handler(NRFX_USBREG_EVT_READY);
     }
+
+    NRFX_IRQ_EXIT(NRF_USBREGULATOR);
 }
 
 #endif // NRFX_CHECK(NRFX_USBREG_ENABLED)
@@ -49,6 +49,8 @@ typedef struct
 {
     nrfx_drv_state_t         state;
     uint8_t                  alloc_index;
+    nrfx_wdt_client_t *      p_clients;
+    volatile uint32_t        vtime;
 #if !NRFX_CHECK(NRFX_WDT_CONFIG_NO_IRQ)
     nrfx_wdt_event_handler_t wdt_event_handler;
 #endif
@@ -186,6 +188,82 @@ void nrfx_wdt_channel_feed(nrfx_wdt_t const * p_instance, nrfx_wdt_channel_id ch
     nrfy_wdt_reload_request_set(p_instance->p_reg, channel_id);
 }
 
+void nrfx_wdt_client_register(nrfx_wdt_t const *  p_instance,
+                              nrfx_wdt_client_t * p_client,
+                              uint32_t            timeout)
+{
+    wdt_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    NRFX_ASSERT(p_client);
+    NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
+
+    p_client->timeout = timeout;
+    p_client->fed_at  = p_cb->vtime;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    p_client->p_next = p_cb->p_clients;
+    p_cb->p_clients  = p_client;
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+void nrfx_wdt_client_unregister(nrfx_wdt_t const * p_instance, nrfx_wdt_client_t * p_client)
+{
+    wdt_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    NRFX_ASSERT(p_client);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    nrfx_wdt_client_t ** pp_item = &p_cb->p_clients;
+    while (*pp_item)
+    {
+        if (*pp_item == p_client)
+        {
+            *pp_item = p_client->p_next;
+            break;
+        }
+        pp_item = &(*pp_item)->p_next;
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+void nrfx_wdt_client_feed(nrfx_wdt_t const * p_instance, nrfx_wdt_client_t * p_client)
+{
+    p_client->fed_at = m_cb[p_instance->drv_inst_idx].vtime;
+}
+
+bool nrfx_wdt_clients_tick(nrfx_wdt_t const *  p_instance,
+                           nrfx_wdt_channel_id channel_id,
+                           uint32_t            elapsed)
+{
+    wdt_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    NRFX_ASSERT(p_cb->state == NRFX_DRV_STATE_POWERED_ON);
+
+    uint32_t vtime = p_cb->vtime + elapsed;
+    bool     alive = true;
+
+    p_cb->vtime = vtime;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    for (nrfx_wdt_client_t const * p_item = p_cb->p_clients; p_item; p_item = p_item->p_next)
+    {
+        // Unsigned arithmetic handles the wrap-around of the virtual time.
+        if ((uint32_t)(vtime - p_item->fed_at) > p_item->timeout)
+        {
+            alive = false;
+            break;
+        }
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    if (alive)
+    {
+        nrfy_wdt_reload_request_set(p_instance->p_reg, channel_id);
+    }
+    else
+    {
+        NRFX_LOG_WARNING("Client timed out, channel %d not fed.", channel_id);
+    }
+    return alive;
+}
+
 #if !NRFX_CHECK(NRFX_WDT_CONFIG_NO_IRQ)
 static void irq_handler(NRF_WDT_Type * p_reg, wdt_control_block_t * p_cb)
 {
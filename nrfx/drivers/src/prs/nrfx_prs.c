@@ -48,6 +48,9 @@
 typedef struct {
     nrfx_irq_handler_t handler;
     bool               acquired;
+    nrfx_prs_user_t *  p_owner;
+    nrfx_prs_user_t *  p_queue;
+    uint32_t           owned;
 } prs_box_t;
 
 #define PRS_BOX_DEFINE(n)                                                    \
@@ -182,5 +185,148 @@ void nrfx_prs_release(void const * p_base_addr)
     }
 }
 
+/* Must be called in a critical section. */
+static void queue_append(prs_box_t * p_box, nrfx_prs_user_t * p_user)
+{
+    nrfx_prs_user_t ** pp_item = &p_box->p_queue;
+
+    while (*pp_item)
+    {
+        pp_item = &(*pp_item)->p_next;
+    }
+    p_user->p_next = NULL;
+    *pp_item       = p_user;
+}
+
+/* Passes the ownership from the deactivated owner to the first queued user, if any. */
+static void box_handover(prs_box_t * p_box)
+{
+    nrfx_prs_user_t * p_next;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    p_next = p_box->p_queue;
+    if (p_next)
+    {
+        p_box->p_queue = p_next->p_next;
+    }
+    p_box->p_owner = p_next;
+    p_box->owned   = 0;
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    if (p_next)
+    {
+        NRFX_LOG_DEBUG("Box %p owner switched.", p_next->p_base_addr);
+        p_next->activate(p_next->p_context);
+    }
+}
+
+nrfx_err_t nrfx_prs_user_request(nrfx_prs_user_t * p_user)
+{
+    NRFX_ASSERT(p_user);
+    NRFX_ASSERT(p_user->activate);
+    NRFX_ASSERT(p_user->deactivate);
+
+    nrfx_err_t ret_code;
+
+    prs_box_t * p_box = prs_box_get(p_user->p_base_addr);
+    if (p_box == NULL)
+    {
+        ret_code = NRFX_ERROR_INVALID_PARAM;
+        LOG_FUNCTION_EXIT(WARNING, ret_code);
+        return ret_code;
+    }
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    if (p_box->p_owner)
+    {
+        queue_append(p_box, p_user);
+        ret_code = NRFX_ERROR_BUSY;
+    }
+    else
+    {
+        p_box->p_owner = p_user;
+        p_box->owned   = 0;
+        ret_code = NRFX_SUCCESS;
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    if (ret_code == NRFX_SUCCESS)
+    {
+        p_user->activate(p_user->p_context);
+    }
+
+    LOG_FUNCTION_EXIT(INFO, ret_code);
+    return ret_code;
+}
+
+void nrfx_prs_user_release(nrfx_prs_user_t * p_user)
+{
+    NRFX_ASSERT(p_user);
+
+    prs_box_t * p_box = prs_box_get(p_user->p_base_addr);
+    if (p_box == NULL)
+    {
+        return;
+    }
+
+    bool owner;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    owner = (p_box->p_owner == p_user);
+    if (!owner)
+    {
+        nrfx_prs_user_t ** pp_item = &p_box->p_queue;
+        while (*pp_item)
+        {
+            if (*pp_item == p_user)
+            {
+                *pp_item = p_user->p_next;
+                break;
+            }
+            pp_item = &(*pp_item)->p_next;
+        }
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    if (owner)
+    {
+        bool deactivated = p_user->deactivate(p_user->p_context, true);
+        NRFX_ASSERT(deactivated);
+        (void)deactivated;
+
+        box_handover(p_box);
+    }
+}
+
+void nrfx_prs_tick(void const * p_base_addr, uint32_t elapsed)
+{
+    prs_box_t * p_box = prs_box_get(p_base_addr);
+    if (p_box == NULL)
+    {
+        return;
+    }
+
+    nrfx_prs_user_t * p_owner = p_box->p_owner;
+    if (!p_owner || (p_owner->slice == 0))
+    {
+        return;
+    }
+
+    p_box->owned += elapsed;
+    if ((p_box->owned < p_owner->slice) || !p_box->p_queue)
+    {
+        return;
+    }
+
+    // The owner is switched out only between its operations.
+    if (p_owner->deactivate(p_owner->p_context, false))
+    {
+        NRFX_CRITICAL_SECTION_ENTER();
+        queue_append(p_box, p_owner);
+        NRFX_CRITICAL_SECTION_EXIT();
+
+        box_handover(p_box);
+    }
+}
 
 #endif // NRFX_CHECK(NRFX_PRS_ENABLED)
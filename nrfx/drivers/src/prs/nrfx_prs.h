@@ -146,6 +146,85 @@ nrfx_err_t nrfx_prs_acquire(void       const * p_base_addr,
  */
 void nrfx_prs_release(void const * p_base_addr);
 
+/**
+ * @brief Callback activating a user of a shared instance.
+ *
+ * Called when the user becomes the owner of the instance. Typically it initializes
+ * the driver with the configuration cached by the user or, when the previous owner
+ * used the same driver, only applies the cached configuration with the driver
+ * @c reconfigure function.
+ *
+ * @param[in] p_context Context of the user.
+ */
+typedef void (* nrfx_prs_activate_t)(void * p_context);
+
+/**
+ * @brief Callback deactivating a user of a shared instance.
+ *
+ * Called before another user takes over the instance.
+ *
+ * @param[in] p_context Context of the user.
+ * @param[in] forced    True if the user releases the instance by itself, false if its
+ *                      time slice expired.
+ *
+ * @retval true  The user was deactivated.
+ * @retval false The user is in the middle of an operation and cannot be deactivated now.
+ *               Not allowed when @p forced is true.
+ */
+typedef bool (* nrfx_prs_deactivate_t)(void * p_context, bool forced);
+
+/**
+ * @brief Structure of a user of a shared instance.
+ *
+ * The structure is linked into a queue by the PRS module, so it must stay valid as long as
+ * the user requests or owns the instance.
+ */
+typedef struct nrfx_prs_user_s
+{
+    void const *             p_base_addr; ///< Base address of the peripheral used.
+    nrfx_prs_activate_t      activate;    ///< Activation callback.
+    nrfx_prs_deactivate_t    deactivate;  ///< Deactivation callback.
+    void *                   p_context;   ///< Context passed to the callbacks.
+    uint32_t                 slice;       ///< Time slice, in units of @ref nrfx_prs_tick.
+                                          ///< 0 if the user is never preempted.
+    struct nrfx_prs_user_s * p_next;      ///< Internal. Next user in the queue.
+} nrfx_prs_user_t;
+
+/**
+ * @brief Function for requesting the ownership of a shared instance for a user.
+ *
+ * If the instance is not owned by another user, the activation callback is called
+ * immediately. Otherwise the user is queued and activated later, from the context of
+ * @ref nrfx_prs_user_release or @ref nrfx_prs_tick.
+ *
+ * @param[in] p_user Pointer to the user structure.
+ *
+ * @retval NRFX_SUCCESS             The user was activated.
+ * @retval NRFX_ERROR_BUSY          The user was queued.
+ * @retval NRFX_ERROR_INVALID_PARAM The peripheral does not share resources with others.
+ */
+nrfx_err_t nrfx_prs_user_request(nrfx_prs_user_t * p_user);
+
+/**
+ * @brief Function for releasing a shared instance owned or requested by a user.
+ *
+ * If the user owns the instance, it is deactivated and the next queued user is activated.
+ *
+ * @param[in] p_user Pointer to the user structure.
+ */
+void nrfx_prs_user_release(nrfx_prs_user_t * p_user);
+
+/**
+ * @brief Function for advancing time-sliced arbitration of a shared instance.
+ *
+ * To be called periodically. When the owner has used up its time slice and other users
+ * are queued, the owner is deactivated, queued again and the next user is activated.
+ *
+ * @param[in] p_base_addr Base address of any peripheral in the shared instance.
+ * @param[in] elapsed     Time elapsed since the previous call.
+ */
+void nrfx_prs_tick(void const * p_base_addr, uint32_t elapsed);
+
 /** @} */
 
 /*
@@ -265,6 +265,23 @@ NRF_STATIC_INLINE void nrf_dppi_channels_remove_from_group(NRF_DPPIC_Type *
                                                            uint32_t                 channel_mask,
                                                            nrf_dppi_channel_group_t channel_group);
 
+/**
+ * @brief Function for setting the channels included in a channel group.
+ *
+ * @details This function replaces the group configuration with a single register write.
+ * The bits in @p channel_mask value correspond to particular channels.
+ *
+ * @warning Channel group configuration can be modified only if subscriptions for tasks
+ *          associated with this group are disabled.
+ *
+ * @param[in] p_reg         Pointer to the structure of registers of the peripheral.
+ * @param[in] channel_mask  Channels to be included in the group.
+ * @param[in] channel_group Channel group.
+ */
+NRF_STATIC_INLINE void nrf_dppi_group_channels_set(NRF_DPPIC_Type *         p_reg,
+                                                   uint32_t                 channel_mask,
+                                                   nrf_dppi_channel_group_t channel_group);
+
 /**
  * @brief Function for removing all DPPI channels from a channel group.
  *
@@ -404,6 +421,13 @@ NRF_STATIC_INLINE void nrf_dppi_channels_remove_from_group(NRF_DPPIC_Type *
         p_reg->CHG[(uint32_t) channel_group] & ~(channel_mask);
 }
 
+NRF_STATIC_INLINE void nrf_dppi_group_channels_set(NRF_DPPIC_Type *         p_reg,
+                                                   uint32_t                 channel_mask,
+                                                   nrf_dppi_channel_group_t channel_group)
+{
+    p_reg->CHG[(uint32_t) channel_group] = channel_mask;
+}
+
 NRF_STATIC_INLINE void nrf_dppi_group_clear(NRF_DPPIC_Type *         p_reg,
                                             nrf_dppi_channel_group_t group)
 {
@@ -617,6 +617,31 @@ NRF_STATIC_INLINE void nrf_gpio_port_out_set(NRF_GPIO_Type * p_reg, uint32_t set
  */
 NRF_STATIC_INLINE void nrf_gpio_port_out_clear(NRF_GPIO_Type * p_reg, uint32_t clr_mask);
 
+/**
+ * @brief Function for toggling the selected GPIO pins on the given port.
+ *
+ * Pins going high are changed with one write and pins going low with the next one.
+ * Pins that are not selected are not affected.
+ *
+ * @param p_reg       Pointer to the structure of registers of the peripheral.
+ * @param toggle_mask Mask with pins to be toggled.
+ */
+NRF_STATIC_INLINE void nrf_gpio_port_out_toggle(NRF_GPIO_Type * p_reg, uint32_t toggle_mask);
+
+/**
+ * @brief Function for writing the output of the selected GPIO pins on the given port.
+ *
+ * Pins going high are changed with one write and pins going low with the next one.
+ * Pins that are not selected are not affected.
+ *
+ * @param p_reg Pointer to the structure of registers of the peripheral.
+ * @param mask  Mask with pins to be written.
+ * @param value Output levels of the pins. Bits not present in @p mask are ignored.
+ */
+NRF_STATIC_INLINE void nrf_gpio_port_out_masked_write(NRF_GPIO_Type * p_reg,
+                                                      uint32_t        mask,
+                                                      uint32_t        value);
+
 /**
  * @brief Function for reading pin state of multiple consecutive ports.
  *
@@ -1153,6 +1178,24 @@ NRF_STATIC_INLINE void nrf_gpio_port_out_clear(NRF_GPIO_Type * p_reg, uint32_t c
 }
 
 
+NRF_STATIC_INLINE void nrf_gpio_port_out_toggle(NRF_GPIO_Type * p_reg, uint32_t toggle_mask)
+{
+    uint32_t pins_state = p_reg->OUT;
+
+    p_reg->OUTSET = (~pins_state & toggle_mask);
+    p_reg->OUTCLR = (pins_state & toggle_mask);
+}
+
+
+NRF_STATIC_INLINE void nrf_gpio_port_out_masked_write(NRF_GPIO_Type * p_reg,
+                                                      uint32_t        mask,
+                                                      uint32_t        value)
+{
+    p_reg->OUTSET = (value & mask);
+    p_reg->OUTCLR = (~value & mask);
+}
+
+
 NRF_STATIC_INLINE void nrf_gpio_ports_read(uint32_t   start_port,
                                            uint32_t   length,
                                            uint32_t * p_masks)
@@ -90,6 +90,74 @@ extern "C" {
 /** @sa NRFX_CRITICAL_SECTION_EXIT */
 #define NRFY_CRITICAL_SECTION_EXIT() NRFX_CRITICAL_SECTION_EXIT()
 
+/**
+ * @brief Register descriptor.
+ *
+ * A table of descriptors expresses a whole peripheral configuration, so that it can be
+ * built at compile time, placed in flash, and applied with @ref nrfy_regs_apply in a single
+ * tight loop followed by one barrier. The same table, placed in RAM, can be filled with
+ * @ref nrfy_regs_snapshot to save the configuration before a low-power mode and restore
+ * it afterwards.
+ */
+typedef struct
+{
+    uint32_t offset; ///< Offset of the register from the peripheral base address.
+    uint32_t value;  ///< Value of the register.
+} nrfy_reg_desc_t;
+
+/**
+ * @brief Macro for initializing a register descriptor.
+ *
+ * @param[in] type   Type of the peripheral register structure, for example @c NRF_SPIM_Type.
+ * @param[in] member Register within the structure, for example @c FREQUENCY.
+ * @param[in] val    Value of the register.
+ */
+#define NRFY_REG_DESC(type, member, val) \
+    { .offset = (uint32_t)offsetof(type, member), .value = (uint32_t)(val) }
+
+/**
+ * @brief Function for writing registers described by a descriptor table.
+ *
+ * Registers are written in the order of the table, so registers that must be written
+ * last, such as ENABLE, are to be placed at the end.
+ *
+ * @param[in] p_reg  Peripheral base pointer.
+ * @param[in] p_desc Pointer to the descriptor table.
+ * @param[in] count  Number of descriptors in the table.
+ */
+NRFY_STATIC_INLINE void nrfy_regs_apply(void *                  p_reg,
+                                        nrfy_reg_desc_t const * p_desc,
+                                        size_t                  count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        *(volatile uint32_t *)((uint8_t *)p_reg + p_desc[i].offset) = p_desc[i].value;
+    }
+    nrf_barrier_w();
+}
+
+/**
+ * @brief Function for reading registers described by a descriptor table.
+ *
+ * Offsets in the table select the registers, and the read values are stored in the table.
+ *
+ * @param[in]     p_reg  Peripheral base pointer.
+ * @param[in,out] p_desc Pointer to the descriptor table.
+ * @param[in]     count  Number of descriptors in the table.
+ */
+NRFY_STATIC_INLINE void nrfy_regs_snapshot(void const *      p_reg,
+                                           nrfy_reg_desc_t * p_desc,
+                                           size_t            count)
+{
+    nrf_barrier_rw();
+    for (size_t i = 0; i < count; i++)
+    {
+        p_desc[i].value =
+            *(volatile uint32_t const *)((uint8_t const *)p_reg + p_desc[i].offset);
+    }
+    nrf_barrier_r();
+}
+
 /** @} */
 
 #ifdef __cplusplus
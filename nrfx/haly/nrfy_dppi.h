@@ -163,6 +163,15 @@ void nrfy_dppi_channels_remove_from_group(NRF_DPPIC_Type *         p_reg,
     nrf_barrier_w();
 }
 
+/** @refhal{nrf_dppi_group_channels_set} */
+NRFY_STATIC_INLINE void nrfy_dppi_group_channels_set(NRF_DPPIC_Type *         p_reg,
+                                                     uint32_t                 channel_mask,
+                                                     nrf_dppi_channel_group_t channel_group)
+{
+    nrf_dppi_group_channels_set(p_reg, channel_mask, channel_group);
+    nrf_barrier_w();
+}
+
 /** @refhal{nrf_dppi_group_clear} */
 NRFY_STATIC_INLINE void nrfy_dppi_group_clear(NRF_DPPIC_Type *         p_reg,
                                               nrf_dppi_channel_group_t group)
@@ -48,6 +48,42 @@ extern "C" {
  * @brief   Hardware access layer with cache and barrier support for managing the GPIO peripheral.
  */
 
+/**
+ * @brief Macro for getting the mask of the pin within its port.
+ *
+ * @param[in] pin Absolute pin number.
+ */
+#define NRFY_GPIO_PIN_MASK(pin) (1UL << NRF_PIN_NUMBER_TO_PIN(pin))
+
+/**
+ * @brief Macro for getting the mask of the pin if it belongs to the specified port.
+ *
+ * @param[in] pin  Absolute pin number.
+ * @param[in] port Port index.
+ *
+ * @return Mask of the pin within the port or 0 if the pin belongs to another port.
+ */
+#define NRFY_GPIO_PORT_PIN_MASK(pin, port) \
+    ((NRF_PIN_NUMBER_TO_PORT(pin) == (port)) ? NRFY_GPIO_PIN_MASK(pin) : 0UL)
+
+/**
+ * @brief Macro for building the mask of the listed pins that belong to the specified port.
+ *
+ * Pins belonging to other ports are skipped, so the same pin list can be used to build
+ * the masks of all ports. For constant pin numbers, the result is a constant expression.
+ *
+ * Example:
+ *
+ *     NRFY_GPIO_PORT_MASK(1, NRF_GPIO_PIN_MAP(0, 3), NRF_GPIO_PIN_MAP(1, 4))
+ *
+ * evaluates to (1UL << 4).
+ *
+ * @param[in] port Port index.
+ * @param[in] ...  Absolute pin numbers.
+ */
+#define NRFY_GPIO_PORT_MASK(port, ...) \
+    (NRFX_FOR_EACH_FIXED_ARG(NRFY_GPIO_PORT_PIN_MASK, (|), port, __VA_ARGS__))
+
 /** @refhal{nrf_gpio_range_cfg_output} */
 NRFY_STATIC_INLINE void nrfy_gpio_range_cfg_output(uint32_t pin_range_start,
                                                    uint32_t pin_range_end)
@@ -302,6 +338,134 @@ NRFY_STATIC_INLINE void nrfy_gpio_port_out_clear(NRF_GPIO_Type * p_reg, uint32_t
     nrf_barrier_w();
 }
 
+/** @refhal{nrf_gpio_port_out_toggle} */
+NRFY_STATIC_INLINE void nrfy_gpio_port_out_toggle(NRF_GPIO_Type * p_reg, uint32_t toggle_mask)
+{
+    nrf_barrier_r();
+    nrf_gpio_port_out_toggle(p_reg, toggle_mask);
+    nrf_barrier_w();
+}
+
+/** @refhal{nrf_gpio_port_out_masked_write} */
+NRFY_STATIC_INLINE void nrfy_gpio_port_out_masked_write(NRF_GPIO_Type * p_reg,
+                                                        uint32_t        mask,
+                                                        uint32_t        value)
+{
+    nrf_gpio_port_out_masked_write(p_reg, mask, value);
+    nrf_barrier_w();
+}
+
+/**
+ * @brief Function for setting high level on the selected pins of multiple consecutive ports.
+ *
+ * Each port is updated with a single write, so the selected pins of one port change
+ * simultaneously. The ports with an empty mask are not accessed.
+ *
+ * @param[in] start_port Index of the first port.
+ * @param[in] length     Number of ports.
+ * @param[in] p_masks    Array of @p length masks with pins to be set, one per port.
+ */
+NRFY_STATIC_INLINE void nrfy_gpio_ports_out_set(uint32_t         start_port,
+                                                uint32_t         length,
+                                                uint32_t const * p_masks)
+{
+    NRF_GPIO_Type * gpio_regs[GPIO_COUNT] = GPIO_REG_LIST;
+
+    NRFX_ASSERT(start_port + length <= GPIO_COUNT);
+    for (uint32_t i = 0; i < length; i++)
+    {
+        if (p_masks[i])
+        {
+            nrf_gpio_port_out_set(gpio_regs[start_port + i], p_masks[i]);
+        }
+    }
+    nrf_barrier_w();
+}
+
+/**
+ * @brief Function for setting low level on the selected pins of multiple consecutive ports.
+ *
+ * Each port is updated with a single write, so the selected pins of one port change
+ * simultaneously. The ports with an empty mask are not accessed.
+ *
+ * @param[in] start_port Index of the first port.
+ * @param[in] length     Number of ports.
+ * @param[in] p_masks    Array of @p length masks with pins to be cleared, one per port.
+ */
+NRFY_STATIC_INLINE void nrfy_gpio_ports_out_clear(uint32_t         start_port,
+                                                  uint32_t         length,
+                                                  uint32_t const * p_masks)
+{
+    NRF_GPIO_Type * gpio_regs[GPIO_COUNT] = GPIO_REG_LIST;
+
+    NRFX_ASSERT(start_port + length <= GPIO_COUNT);
+    for (uint32_t i = 0; i < length; i++)
+    {
+        if (p_masks[i])
+        {
+            nrf_gpio_port_out_clear(gpio_regs[start_port + i], p_masks[i]);
+        }
+    }
+    nrf_barrier_w();
+}
+
+/**
+ * @brief Function for toggling the selected pins of multiple consecutive ports.
+ *
+ * See @ref nrf_gpio_port_out_toggle for the order of the edges within a port.
+ * The ports with an empty mask are not accessed.
+ *
+ * @param[in] start_port Index of the first port.
+ * @param[in] length     Number of ports.
+ * @param[in] p_masks    Array of @p length masks with pins to be toggled, one per port.
+ */
+NRFY_STATIC_INLINE void nrfy_gpio_ports_out_toggle(uint32_t         start_port,
+                                                   uint32_t         length,
+                                                   uint32_t const * p_masks)
+{
+    NRF_GPIO_Type * gpio_regs[GPIO_COUNT] = GPIO_REG_LIST;
+
+    NRFX_ASSERT(start_port + length <= GPIO_COUNT);
+    nrf_barrier_r();
+    for (uint32_t i = 0; i < length; i++)
+    {
+        if (p_masks[i])
+        {
+            nrf_gpio_port_out_toggle(gpio_regs[start_port + i], p_masks[i]);
+        }
+    }
+    nrf_barrier_w();
+}
+
+/**
+ * @brief Function for writing the output of the selected pins of multiple consecutive ports.
+ *
+ * See @ref nrf_gpio_port_out_masked_write for the order of the edges within a port.
+ * The ports with an empty mask are not accessed.
+ *
+ * @param[in] start_port Index of the first port.
+ * @param[in] length     Number of ports.
+ * @param[in] p_masks    Array of @p length masks with pins to be written, one per port.
+ * @param[in] p_values   Array of @p length output levels, one per port.
+ */
+NRFY_STATIC_INLINE void nrfy_gpio_ports_out_masked_write(uint32_t         start_port,
+                                                         uint32_t         length,
+                                                         uint32_t const * p_masks,
+                                                         uint32_t const * p_values)
+{
+    NRF_GPIO_Type * gpio_regs[GPIO_COUNT] = GPIO_REG_LIST;
+
+    NRFX_ASSERT(start_port + length <= GPIO_COUNT);
+    for (uint32_t i = 0; i < length; i++)
+    {
+        if (p_masks[i])
+        {
+            nrf_gpio_port_out_masked_write(gpio_regs[start_port + i], p_masks[i], p_values[i]);
+        }
+    }
+    nrf_barrier_w();
+}
+
 /** @refhal{nrf_gpio_ports_read} */
 NRFY_STATIC_INLINE void nrfy_gpio_ports_read(uint32_t   start_port,
                                              uint32_t   length,
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_TIMER_ENABLED)
+
+#include <helpers/nrfx_edge_counter.h>
+#include <helpers/nrfx_timestamp.h>
+#include <helpers/nrfx_gppi.h>
+
+/* Capture/compare channel used for reading the counter. */
+#define READ_CC NRF_TIMER_CC_CHANNEL0
+
+/* Capture/compare channel capturing the counter on the snapshot event. */
+#define SNAPSHOT_CC NRF_TIMER_CC_CHANNEL1
+
+/* Extends the counter to 64 bits and returns its current value. */
+static uint32_t counter_update(nrfx_edge_counter_t * p_counter)
+{
+    uint32_t count = nrfx_timer_capture(&p_counter->timer, READ_CC);
+
+    /* Unsigned arithmetic handles the wrap-around of the counter. */
+    p_counter->total     += count - p_counter->last_count;
+    p_counter->last_count = count;
+
+    return count;
+}
+
+nrfx_err_t nrfx_edge_counter_init(nrfx_edge_counter_t *              p_counter,
+                                  nrfx_edge_counter_config_t const * p_config)
+{
+    NRFX_ASSERT(p_counter);
+    NRFX_ASSERT(p_config);
+    NRFX_ASSERT(p_config->eep);
+
+    nrfx_timer_config_t config =
+        NRFX_TIMER_DEFAULT_CONFIG(NRF_TIMER_BASE_FREQUENCY_GET(p_config->timer.p_reg));
+#if NRF_TIMER_HAS_LOW_POWER_MODE
+    config.mode      = NRF_TIMER_MODE_LOW_POWER_COUNTER;
+#else
+    config.mode      = NRF_TIMER_MODE_COUNTER;
+#endif
+    config.bit_width = NRF_TIMER_BIT_WIDTH_32;
+
+    nrfx_err_t err_code = nrfx_timer_init(&p_config->timer, &config, NULL);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    if (nrfx_gppi_channel_alloc(&p_counter->ppi_channel) != NRFX_SUCCESS)
+    {
+        nrfx_timer_uninit(&p_config->timer);
+        return NRFX_ERROR_NO_MEM;
+    }
+
+    p_counter->timer      = p_config->timer;
+    p_counter->eep          = p_config->eep;
+    p_counter->snapshot_eep = 0;
+    p_counter->last_count   = 0;
+    p_counter->total        = 0;
+    p_counter->timestamp    = p_config->timestamp;
+
+    if (p_counter->timestamp &&
+        (nrfx_timestamp_task_channel_alloc(&p_counter->ts_channel, &p_counter->ts_tep) !=
+         NRFX_SUCCESS))
+    {
+        (void)nrfx_gppi_channel_free(p_counter->ppi_channel);
+        nrfx_timer_uninit(&p_config->timer);
+        return NRFX_ERROR_NO_MEM;
+    }
+
+    nrfx_timer_enable(&p_counter->timer);
+
+    nrfx_gppi_channel_endpoints_setup(p_counter->ppi_channel,
+        p_counter->eep,
+        nrfx_timer_task_address_get(&p_counter->timer, NRF_TIMER_TASK_COUNT));
+    if (p_counter->timestamp)
+    {
+        nrfx_gppi_fork_endpoint_setup(p_counter->ppi_channel, p_counter->ts_tep);
+    }
+    nrfx_gppi_channels_enable(NRFX_BIT(p_counter->ppi_channel));
+
+    return NRFX_SUCCESS;
+}
+
+void nrfx_edge_counter_uninit(nrfx_edge_counter_t * p_counter)
+{
+    NRFX_ASSERT(p_counter);
+
+    nrfx_edge_counter_snapshot_disable(p_counter);
+
+    nrfx_gppi_channels_disable(NRFX_BIT(p_counter->ppi_channel));
+    if (p_counter->timestamp)
+    {
+        nrfx_gppi_fork_endpoint_clear(p_counter->ppi_channel, p_counter->ts_tep);
+        (void)nrfx_timestamp_channel_free(p_counter->ts_channel);
+    }
+    nrfx_gppi_channel_endpoints_clear(p_counter->ppi_channel,
+        p_counter->eep,
+        nrfx_timer_task_address_get(&p_counter->timer, NRF_TIMER_TASK_COUNT));
+    (void)nrfx_gppi_channel_free(p_counter->ppi_channel);
+
+    nrfx_timer_uninit(&p_counter->timer);
+}
+
+void nrfx_edge_counter_read(nrfx_edge_counter_t *        p_counter,
+                            nrfx_edge_counter_result_t * p_result)
+{
+    NRFX_ASSERT(p_counter);
+    NRFX_ASSERT(p_result);
+
+    uint64_t last_total = p_counter->total;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    (void)counter_update(p_counter);
+    p_result->total = p_counter->total;
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    p_result->count = (uint32_t)(p_result->total - last_total);
+
+    p_result->timestamp = (p_counter->timestamp && p_result->count) ?
+                          nrfx_timestamp_channel_get(p_counter->ts_channel) : 0;
+}
+
+nrfx_err_t nrfx_edge_counter_snapshot_enable(nrfx_edge_counter_t * p_counter, uint32_t eep)
+{
+    NRFX_ASSERT(p_counter);
+    NRFX_ASSERT(eep);
+
+    if (p_counter->snapshot_eep)
+    {
+        return NRFX_ERROR_INVALID_STATE;
+    }
+
+    if (nrfx_gppi_channel_alloc(&p_counter->snapshot_ppi) != NRFX_SUCCESS)
+    {
+        return NRFX_ERROR_NO_MEM;
+    }
+
+    p_counter->snapshot_eep = eep;
+
+    nrfx_gppi_channel_endpoints_setup(p_counter->snapshot_ppi,
+        eep,
+        nrfx_timer_capture_task_address_get(&p_counter->timer, SNAPSHOT_CC));
+    nrfx_gppi_channels_enable(NRFX_BIT(p_counter->snapshot_ppi));
+
+    return NRFX_SUCCESS;
+}
+
+void nrfx_edge_counter_snapshot_disable(nrfx_edge_counter_t * p_counter)
+{
+    NRFX_ASSERT(p_counter);
+
+    if (!p_counter->snapshot_eep)
+    {
+        return;
+    }
+
+    nrfx_gppi_channels_disable(NRFX_BIT(p_counter->snapshot_ppi));
+    nrfx_gppi_channel_endpoints_clear(p_counter->snapshot_ppi,
+        p_counter->snapshot_eep,
+        nrfx_timer_capture_task_address_get(&p_counter->timer, SNAPSHOT_CC));
+    (void)nrfx_gppi_channel_free(p_counter->snapshot_ppi);
+
+    p_counter->snapshot_eep = 0;
+}
+
+uint64_t nrfx_edge_counter_snapshot_get(nrfx_edge_counter_t * p_counter)
+{
+    NRFX_ASSERT(p_counter);
+    NRFX_ASSERT(p_counter->snapshot_eep);
+
+    uint64_t total;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    /* The snapshot is read before the counter, so it is never ahead of the counter. */
+    uint32_t snapshot = nrfx_timer_capture_get(&p_counter->timer, SNAPSHOT_CC);
+    uint32_t count    = counter_update(p_counter);
+
+    total = p_counter->total - (uint32_t)(count - snapshot);
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    return total;
+}
+
+#endif // NRFX_CHECK(NRFX_TIMER_ENABLED)
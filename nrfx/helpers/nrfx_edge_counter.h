@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_EDGE_COUNTER_H__
+#define NRFX_EDGE_COUNTER_H__
+
+#include <nrfx_timer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_edge_counter Edge counter
+ * @{
+ * @ingroup nrfx
+ *
+ * @brief Counting of peripheral events in hardware with a TIMER in counter mode.
+ *
+ * An event, for example UP, DOWN or CROSS of COMP or LPCOMP, is connected through
+ * a (D)PPI channel to the COUNT task of a TIMER instance, so that edges are counted
+ * without interrupts. Optionally, the same (D)PPI channel captures the time of each
+ * edge in a channel of the timestamp service (see @ref nrfx_timestamp). The user reads
+ * the batched results periodically, at a rate much lower than the rate of the events.
+ *
+ * The 32-bit count of the TIMER is extended to 64 bits on every read, so the counter must be
+ * read at least once per 2^32 edges. A second event can be connected to capture the count
+ * in hardware at the moment it occurs (see @ref nrfx_edge_counter_snapshot_enable), for example
+ * to measure the exact number of edges between two RTC ticks.
+ *
+ * The edge counter uses the TIMER driver for the selected instance, which must be enabled.
+ */
+
+/** @brief Edge counter configuration. */
+typedef struct
+{
+    nrfx_timer_t timer;     ///< TIMER instance used exclusively for counting.
+    uint32_t     eep;       ///< Address of the counted event.
+    bool         timestamp; ///< True to capture the time of the last edge.
+} nrfx_edge_counter_config_t;
+
+/** @brief Edge counter instance. Its content is handled by the helper. */
+typedef struct
+{
+    nrfx_timer_t timer;        ///< TIMER instance used for counting.
+    uint32_t     eep;          ///< Address of the counted event.
+    uint32_t     ts_tep;       ///< Capture task of the timestamp channel.
+    uint32_t     snapshot_eep; ///< Address of the event capturing snapshots, 0 if disabled.
+    uint32_t     last_count;   ///< Counter value at the previous read.
+    uint64_t     total;        ///< Number of edges counted until the previous read.
+    uint8_t      ppi_channel;  ///< (D)PPI channel carrying the event.
+    uint8_t      ts_channel;   ///< Timestamp channel.
+    uint8_t      snapshot_ppi; ///< (D)PPI channel carrying the snapshot event.
+    bool         timestamp;    ///< True if the time of edges is captured.
+} nrfx_edge_counter_t;
+
+/** @brief Results collected since the previous read. */
+typedef struct
+{
+    uint32_t count;     ///< Number of edges since the previous read.
+    uint64_t total;     ///< Number of edges since the initialization.
+    uint64_t timestamp; ///< Time of the last edge in microseconds, valid if @p count is not 0.
+} nrfx_edge_counter_result_t;
+
+/**
+ * @brief Function for initializing and starting an edge counter.
+ *
+ * @note When @p timestamp is set, the timestamp service must be initialized.
+ *
+ * @param[out] p_counter Pointer to the edge counter instance.
+ * @param[in]  p_config  Pointer to the configuration.
+ *
+ * @retval NRFX_SUCCESS             The edge counter is started.
+ * @retval NRFX_ERROR_INVALID_STATE The TIMER instance is already initialized.
+ * @retval NRFX_ERROR_NO_MEM        There is no (D)PPI channel or timestamp channel available.
+ */
+nrfx_err_t nrfx_edge_counter_init(nrfx_edge_counter_t *              p_counter,
+                                  nrfx_edge_counter_config_t const * p_config);
+
+/**
+ * @brief Function for stopping and uninitializing an edge counter.
+ *
+ * @param[in] p_counter Pointer to the edge counter instance.
+ */
+void nrfx_edge_counter_uninit(nrfx_edge_counter_t * p_counter);
+
+/**
+ * @brief Function for reading the results collected since the previous read.
+ *
+ * @note An edge occurring while the function executes can be included in the timestamp
+ *       but counted only in the next read.
+ *
+ * @param[in]  p_counter Pointer to the edge counter instance.
+ * @param[out] p_result  Pointer to the results.
+ */
+void nrfx_edge_counter_read(nrfx_edge_counter_t *        p_counter,
+                            nrfx_edge_counter_result_t * p_result);
+
+/**
+ * @brief Function for enabling the capture of the count on the specified event.
+ *
+ * The event is connected through a (D)PPI channel to a CAPTURE task of the TIMER, so the value
+ * is taken in hardware at the exact moment of the event.
+ *
+ * @param[in] p_counter Pointer to the edge counter instance.
+ * @param[in] eep       Address of the event capturing the count.
+ *
+ * @retval NRFX_SUCCESS             The snapshot capture is enabled.
+ * @retval NRFX_ERROR_INVALID_STATE The snapshot capture is already enabled.
+ * @retval NRFX_ERROR_NO_MEM        There is no (D)PPI channel available.
+ */
+nrfx_err_t nrfx_edge_counter_snapshot_enable(nrfx_edge_counter_t * p_counter, uint32_t eep);
+
+/**
+ * @brief Function for disabling the capture of the count.
+ *
+ * @param[in] p_counter Pointer to the edge counter instance.
+ */
+void nrfx_edge_counter_snapshot_disable(nrfx_edge_counter_t * p_counter);
+
+/**
+ * @brief Function for getting the count captured at the last snapshot event.
+ *
+ * The captured value is extended to 64 bits like the result of @ref nrfx_edge_counter_read,
+ * so fewer than 2^32 edges may occur between the snapshot event and this call. The value
+ * is valid only if the snapshot event occurred after the capture was enabled.
+ *
+ * @param[in] p_counter Pointer to the edge counter instance.
+ *
+ * @return Number of edges since the initialization until the last snapshot event.
+ */
+uint64_t nrfx_edge_counter_snapshot_get(nrfx_edge_counter_t * p_counter);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_EDGE_COUNTER_H__
@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_EGU_ENABLED)
+
+#include <helpers/nrfx_egu_bus.h>
+#include <helpers/nrfx_gppi.h>
+
+#if !defined(NRFX_ATOMIC_CAS)
+static bool egu_bus_atomic_cas(nrfx_atomic_t * p_data, uint32_t old_value, uint32_t new_value)
+{
+    bool status = false;
+    NRFX_CRITICAL_SECTION_ENTER();
+    if (*p_data == old_value)
+    {
+        *p_data = new_value;
+        status = true;
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+    return status;
+}
+
+#define NRFX_ATOMIC_CAS(p_data, old_value, new_value) \
+    egu_bus_atomic_cas(p_data, old_value, new_value)
+#endif // !defined(NRFX_ATOMIC_CAS)
+
+static uint32_t channel_mask_get(nrfx_egu_bus_t const * p_bus, uint8_t channel)
+{
+    NRFX_ASSERT(channel < nrf_egu_channel_count(p_bus->egu.p_reg));
+    (void)p_bus;
+    return NRFX_BIT(channel);
+}
+
+static void work_process(nrfx_egu_bus_t * p_bus)
+{
+    uint32_t head;
+
+    // Take the whole list at once, work posted from now on goes to a new list.
+    do {
+        head = p_bus->work_head;
+    } while (!NRFX_ATOMIC_CAS(&p_bus->work_head, head, 0));
+
+    // Items are pushed at the head, reverse the list to execute them in the order of posting.
+    nrfx_egu_bus_work_t * p_work = (nrfx_egu_bus_work_t *)head;
+    nrfx_egu_bus_work_t * p_list = NULL;
+    while (p_work)
+    {
+        nrfx_egu_bus_work_t * p_next = p_work->p_next;
+        p_work->p_next = p_list;
+        p_list = p_work;
+        p_work = p_next;
+    }
+
+    while (p_list)
+    {
+        p_work = p_list;
+        p_list = p_work->p_next;
+        // Clear the flag first, so that the handler can post the work again.
+        p_work->queued = 0;
+        p_work->handler(p_work);
+    }
+}
+
+static void egu_event_handler(uint8_t event_idx, void * p_context)
+{
+    nrfx_egu_bus_t * p_bus = (nrfx_egu_bus_t *)p_context;
+
+    if (event_idx == p_bus->work_channel)
+    {
+        work_process(p_bus);
+        return;
+    }
+
+    for (nrfx_egu_bus_sub_t * p_sub = p_bus->p_subs[event_idx]; p_sub; p_sub = p_sub->p_next)
+    {
+        p_sub->handler(event_idx, p_sub->p_context);
+    }
+}
+
+nrfx_err_t nrfx_egu_bus_init(nrfx_egu_bus_t *   p_bus,
+                             nrfx_egu_t const * p_egu,
+                             uint8_t            interrupt_priority,
+                             uint8_t            work_channel)
+{
+    NRFX_ASSERT(p_bus);
+    NRFX_ASSERT(p_egu);
+
+    if ((work_channel >= nrf_egu_channel_count(p_egu->p_reg)) ||
+        (work_channel >= NRFX_EGU_BUS_CHANNEL_MAX))
+    {
+        return NRFX_ERROR_INVALID_PARAM;
+    }
+
+    p_bus->egu          = *p_egu;
+    p_bus->work_head    = 0;
+    p_bus->work_channel = work_channel;
+    for (size_t i = 0; i < NRFX_ARRAY_SIZE(p_bus->p_subs); i++)
+    {
+        p_bus->p_subs[i] = NULL;
+    }
+
+    nrfx_err_t err_code = nrfx_egu_init(p_egu, interrupt_priority, egu_event_handler, p_bus);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    nrfx_egu_int_enable(p_egu, NRFX_BIT(work_channel));
+    return NRFX_SUCCESS;
+}
+
+void nrfx_egu_bus_uninit(nrfx_egu_bus_t * p_bus)
+{
+    NRFX_ASSERT(p_bus);
+
+    nrfx_egu_uninit(&p_bus->egu);
+    p_bus->work_head = 0;
+}
+
+void nrfx_egu_bus_subscribe(nrfx_egu_bus_t *     p_bus,
+                            uint8_t              channel,
+                            nrfx_egu_bus_sub_t * p_sub)
+{
+    NRFX_ASSERT(p_bus);
+    NRFX_ASSERT(p_sub);
+    NRFX_ASSERT(p_sub->handler);
+    NRFX_ASSERT(channel != p_bus->work_channel);
+
+    uint32_t mask = channel_mask_get(p_bus, channel);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    // Keep the list sorted, a subscriber goes after the ones with the same priority.
+    nrfx_egu_bus_sub_t ** pp_sub = &p_bus->p_subs[channel];
+    while (*pp_sub && ((*pp_sub)->priority <= p_sub->priority))
+    {
+        pp_sub = &(*pp_sub)->p_next;
+    }
+    p_sub->p_next = *pp_sub;
+    *pp_sub = p_sub;
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    nrfx_egu_int_enable(&p_bus->egu, mask);
+}
+
+void nrfx_egu_bus_unsubscribe(nrfx_egu_bus_t *     p_bus,
+                              uint8_t              channel,
+                              nrfx_egu_bus_sub_t * p_sub)
+{
+    NRFX_ASSERT(p_bus);
+    NRFX_ASSERT(p_sub);
+
+    uint32_t mask = channel_mask_get(p_bus, channel);
+    bool     empty;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    // The removed subscriber keeps its link, so a list walk in progress can still continue.
+    nrfx_egu_bus_sub_t ** pp_sub = &p_bus->p_subs[channel];
+    while (*pp_sub && (*pp_sub != p_sub))
+    {
+        pp_sub = &(*pp_sub)->p_next;
+    }
+    if (*pp_sub)
+    {
+        *pp_sub = p_sub->p_next;
+    }
+    empty = (p_bus->p_subs[channel] == NULL);
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    if (empty)
+    {
+        nrfx_egu_int_disable(&p_bus->egu, mask);
+    }
+}
+
+void nrfx_egu_bus_publish(nrfx_egu_bus_t * p_bus, uint8_t channel)
+{
+    NRFX_ASSERT(p_bus);
+    NRFX_ASSERT(channel != p_bus->work_channel);
+
+    (void)channel_mask_get(p_bus, channel);
+    nrfx_egu_trigger(&p_bus->egu, channel);
+}
+
+bool nrfx_egu_bus_work_post(nrfx_egu_bus_t * p_bus, nrfx_egu_bus_work_t * p_work)
+{
+    NRFX_ASSERT(p_bus);
+    NRFX_ASSERT(p_work);
+    NRFX_ASSERT(p_work->handler);
+
+    if (!NRFX_ATOMIC_CAS(&p_work->queued, 0, 1))
+    {
+        return false;
+    }
+
+    uint32_t head;
+    do {
+        head = p_bus->work_head;
+        p_work->p_next = (nrfx_egu_bus_work_t *)head;
+    } while (!NRFX_ATOMIC_CAS(&p_bus->work_head, head, (uint32_t)p_work));
+
+    nrfx_egu_trigger(&p_bus->egu, p_bus->work_channel);
+    return true;
+}
+
+nrfx_err_t nrfx_egu_bus_task_connect(nrfx_egu_bus_t * p_bus,
+                                     uint8_t          channel,
+                                     uint32_t         task_address,
+                                     uint8_t *        p_gppi_ch)
+{
+    NRFX_ASSERT(p_bus);
+    NRFX_ASSERT(p_gppi_ch);
+
+    (void)channel_mask_get(p_bus, channel);
+
+    nrfx_err_t err_code = nrfx_gppi_channel_alloc(p_gppi_ch);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    uint32_t eep = nrfx_egu_event_address_get(&p_bus->egu, nrf_egu_triggered_event_get(channel));
+    nrfx_gppi_channel_endpoints_setup(*p_gppi_ch, eep, task_address);
+    nrfx_gppi_channels_enable(NRFX_BIT(*p_gppi_ch));
+    return NRFX_SUCCESS;
+}
+
+void nrfx_egu_bus_task_disconnect(nrfx_egu_bus_t * p_bus,
+                                  uint8_t          channel,
+                                  uint32_t         task_address,
+                                  uint8_t          gppi_ch)
+{
+    NRFX_ASSERT(p_bus);
+
+    uint32_t eep = nrfx_egu_event_address_get(&p_bus->egu, nrf_egu_triggered_event_get(channel));
+    nrfx_gppi_channels_disable(NRFX_BIT(gppi_ch));
+    nrfx_gppi_channel_endpoints_clear(gppi_ch, eep, task_address);
+    (void)nrfx_gppi_channel_free(gppi_ch);
+}
+
+#endif // NRFX_CHECK(NRFX_EGU_ENABLED)
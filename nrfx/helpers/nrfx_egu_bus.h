@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_EGU_BUS_H__
+#define NRFX_EGU_BUS_H__
+
+#include <nrfx_egu.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_egu_bus EGU event bus
+ * @{
+ * @ingroup nrfx
+ *
+ * @brief Software event bus built on the channels of an EGU instance.
+ *
+ * Each EGU channel of a bus is an event that can have any number of subscribers, called in
+ * order of their priority from the EGU interrupt. One channel of the bus is reserved for
+ * a work queue. Work items can be posted from any context, including interrupts of higher
+ * priority, and are executed at the priority of the bus. Posting is lock-free.
+ * Events can also be connected to tasks of other peripherals through (D)PPI, so that
+ * publishing an event triggers the task in hardware.
+ *
+ * Several buses on different EGU instances can run at different interrupt priorities.
+ * The EGU driver must be enabled for the used instances.
+ */
+
+/** @brief Maximum number of EGU channels handled by the bus. */
+#define NRFX_EGU_BUS_CHANNEL_MAX 16
+
+/**
+ * @brief Subscriber handler prototype.
+ *
+ * @param[in] channel   Channel on which the event was published.
+ * @param[in] p_context User context.
+ */
+typedef void (*nrfx_egu_bus_handler_t)(uint8_t channel, void * p_context);
+
+/** @brief Subscriber. */
+typedef struct nrfx_egu_bus_sub_s
+{
+    nrfx_egu_bus_handler_t      handler;   ///< Handler called when the event is published.
+    void *                      p_context; ///< Context passed to the handler.
+    uint8_t                     priority;  ///< Subscribers with lower values are called first.
+    struct nrfx_egu_bus_sub_s * p_next;    ///< For internal use only.
+} nrfx_egu_bus_sub_t;
+
+/** @brief Work item. */
+typedef struct nrfx_egu_bus_work_s nrfx_egu_bus_work_t;
+
+/**
+ * @brief Work handler prototype.
+ *
+ * @param[in] p_work Work item that is executed.
+ */
+typedef void (*nrfx_egu_bus_work_handler_t)(nrfx_egu_bus_work_t * p_work);
+
+/** @brief Work item structure. Set @p handler before posting. */
+struct nrfx_egu_bus_work_s
+{
+    nrfx_egu_bus_work_handler_t handler; ///< Handler called when the work is executed.
+    nrfx_egu_bus_work_t *       p_next;  ///< For internal use only.
+    nrfx_atomic_t               queued;  ///< For internal use only.
+};
+
+/** @brief Event bus. The structure is set by @ref nrfx_egu_bus_init. */
+typedef struct
+{
+    nrfx_egu_t           egu;                                ///< EGU driver instance.
+    nrfx_egu_bus_sub_t * p_subs[NRFX_EGU_BUS_CHANNEL_MAX];   ///< Subscribers of each channel.
+    nrfx_atomic_t        work_head;                          ///< Last posted work item.
+    uint8_t              work_channel;                       ///< Channel of the work queue.
+} nrfx_egu_bus_t;
+
+/**
+ * @brief Function for initializing the event bus.
+ *
+ * @param[out] p_bus              Pointer to the bus.
+ * @param[in]  p_egu              Pointer to the EGU driver instance to be used.
+ * @param[in]  interrupt_priority Interrupt priority of the bus.
+ * @param[in]  work_channel       EGU channel reserved for the work queue.
+ *
+ * @retval NRFX_SUCCESS             The bus is initialized.
+ * @retval NRFX_ERROR_INVALID_PARAM The work channel is not available in the EGU instance.
+ * @retval NRFX_ERROR_INVALID_STATE The EGU instance is already initialized.
+ */
+nrfx_err_t nrfx_egu_bus_init(nrfx_egu_bus_t *   p_bus,
+                             nrfx_egu_t const * p_egu,
+                             uint8_t            interrupt_priority,
+                             uint8_t            work_channel);
+
+/**
+ * @brief Function for uninitializing the event bus.
+ *
+ * Subscribers are removed and queued work is discarded.
+ *
+ * @param[in] p_bus Pointer to the bus.
+ */
+void nrfx_egu_bus_uninit(nrfx_egu_bus_t * p_bus);
+
+/**
+ * @brief Function for subscribing to a channel.
+ *
+ * @param[in] p_bus   Pointer to the bus.
+ * @param[in] channel Channel to subscribe to. Must not be the work channel.
+ * @param[in] p_sub   Pointer to the subscriber. It must remain valid until it is unsubscribed.
+ */
+void nrfx_egu_bus_subscribe(nrfx_egu_bus_t *     p_bus,
+                            uint8_t              channel,
+                            nrfx_egu_bus_sub_t * p_sub);
+
+/**
+ * @brief Function for unsubscribing from a channel.
+ *
+ * @param[in] p_bus   Pointer to the bus.
+ * @param[in] channel Channel the subscriber was subscribed to.
+ * @param[in] p_sub   Pointer to the subscriber.
+ */
+void nrfx_egu_bus_unsubscribe(nrfx_egu_bus_t *     p_bus,
+                              uint8_t              channel,
+                              nrfx_egu_bus_sub_t * p_sub);
+
+/**
+ * @brief Function for publishing an event.
+ *
+ * Subscribers are called from the EGU interrupt. Events published again before
+ * the interrupt is handled are merged.
+ *
+ * @param[in] p_bus   Pointer to the bus.
+ * @param[in] channel Channel to publish on.
+ */
+void nrfx_egu_bus_publish(nrfx_egu_bus_t * p_bus, uint8_t channel);
+
+/**
+ * @brief Function for posting work to be executed at the bus priority.
+ *
+ * The function can be called from any context. Work that is already queued
+ * is not queued again. Work items are executed in the order of posting.
+ *
+ * @param[in] p_bus  Pointer to the bus.
+ * @param[in] p_work Pointer to the work item.
+ *
+ * @retval true  The work was queued.
+ * @retval false The work was already queued.
+ */
+bool nrfx_egu_bus_work_post(nrfx_egu_bus_t * p_bus, nrfx_egu_bus_work_t * p_work);
+
+/**
+ * @brief Function for connecting a channel to a hardware task through (D)PPI.
+ *
+ * @param[in]  p_bus        Pointer to the bus.
+ * @param[in]  channel      Channel whose event triggers the task.
+ * @param[in]  task_address Address of the task to be triggered.
+ * @param[out] p_gppi_ch    Allocated (D)PPI channel, needed to disconnect.
+ *
+ * @retval NRFX_SUCCESS             The task is connected.
+ * @retval NRFX_ERROR_NO_MEM        No (D)PPI channel available.
+ * @retval NRFX_ERROR_NOT_SUPPORTED The (D)PPI driver is not enabled.
+ */
+nrfx_err_t nrfx_egu_bus_task_connect(nrfx_egu_bus_t * p_bus,
+                                     uint8_t          channel,
+                                     uint32_t         task_address,
+                                     uint8_t *        p_gppi_ch);
+
+/**
+ * @brief Function for disconnecting a hardware task from a channel.
+ *
+ * @param[in] p_bus        Pointer to the bus.
+ * @param[in] channel      Channel the task was connected to.
+ * @param[in] task_address Address of the connected task.
+ * @param[in] gppi_ch      (D)PPI channel returned by @ref nrfx_egu_bus_task_connect.
+ */
+void nrfx_egu_bus_task_disconnect(nrfx_egu_bus_t * p_bus,
+                                  uint8_t          channel,
+                                  uint32_t         task_address,
+                                  uint8_t          gppi_ch);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_EGU_BUS_H__
@@ -50,45 +50,112 @@ static bool nrfx_flag32_atomic_cas(nrfx_atomic_t * p_data, uint32_t old_value, u
     nrfx_flag32_atomic_cas(p_data, old_value, new_value)
 #endif // !defined(NRFX_ATOMIC_CAS)
 
-bool nrfx_flag32_is_allocated(nrfx_atomic_t mask, uint8_t bitpos)
-{
-    return (mask & NRFX_BIT(bitpos)) ? false : true;
-}
-
-nrfx_err_t nrfx_flag32_alloc(nrfx_atomic_t * p_mask, uint8_t *p_flag)
+/* Function allocates the range of flags at the highest position of the mask. */
+static nrfx_err_t mask_range_alloc(nrfx_atomic_t * p_mask, uint8_t count, uint8_t * p_bitpos)
 {
     int8_t idx;
-    uint32_t new_mask, prev_mask;
+    uint32_t new_mask, prev_mask, starts;
 
     do {
         prev_mask = *p_mask;
-        if (prev_mask == 0)
+
+        /* Bit n of starts is set when flags from n to n + count - 1 are available. */
+        starts = prev_mask;
+        for (uint8_t i = 1; (i < count) && starts; i++)
+        {
+            starts &= prev_mask >> i;
+        }
+        if (starts == 0)
         {
             return NRFX_ERROR_NO_MEM;
         }
 
-        idx = 31 - NRF_CLZ(prev_mask);
-        new_mask = prev_mask & ~NRFX_BIT(idx);
+        idx = 31 - NRF_CLZ(starts);
+        new_mask = prev_mask & ~(NRFX_BIT_MASK(count) << idx);
     } while (!NRFX_ATOMIC_CAS(p_mask, prev_mask, new_mask));
 
-    *p_flag = idx;
+    *p_bitpos = idx;
 
     return NRFX_SUCCESS;
 }
 
-nrfx_err_t nrfx_flag32_free(nrfx_atomic_t * p_mask, uint8_t flag)
+static nrfx_err_t mask_range_free(nrfx_atomic_t * p_mask, uint32_t range)
 {
     uint32_t new_mask, prev_mask;
 
-    if ((NRFX_BIT(flag) & *p_mask))
+    if (range & *p_mask)
     {
         return NRFX_ERROR_INVALID_PARAM;
     }
 
     do {
         prev_mask = *p_mask;
-        new_mask = prev_mask | NRFX_BIT(flag);
+        new_mask = prev_mask | range;
     } while (!NRFX_ATOMIC_CAS(p_mask, prev_mask, new_mask));
 
     return NRFX_SUCCESS;
 }
+
+bool nrfx_flag32_is_allocated(nrfx_atomic_t mask, uint8_t bitpos)
+{
+    return (mask & NRFX_BIT(bitpos)) ? false : true;
+}
+
+nrfx_err_t nrfx_flag32_alloc(nrfx_atomic_t * p_mask, uint8_t *p_flag)
+{
+    return mask_range_alloc(p_mask, 1, p_flag);
+}
+
+nrfx_err_t nrfx_flag32_free(nrfx_atomic_t * p_mask, uint8_t flag)
+{
+    return mask_range_free(p_mask, NRFX_BIT(flag));
+}
+
+bool nrfx_flag32_array_is_allocated(nrfx_atomic_t const * p_masks, uint16_t flag)
+{
+    return nrfx_flag32_is_allocated(p_masks[flag / 32], flag % 32);
+}
+
+nrfx_err_t nrfx_flag32_array_alloc(nrfx_atomic_t * p_masks, size_t words, uint16_t * p_flag)
+{
+    return nrfx_flag32_array_range_alloc(p_masks, words, 1, p_flag);
+}
+
+nrfx_err_t nrfx_flag32_array_free(nrfx_atomic_t * p_masks, uint16_t flag)
+{
+    return nrfx_flag32_array_range_free(p_masks, flag, 1);
+}
+
+nrfx_err_t nrfx_flag32_array_range_alloc(nrfx_atomic_t * p_masks,
+                                         size_t          words,
+                                         uint8_t         count,
+                                         uint16_t *      p_first)
+{
+    NRFX_ASSERT((count > 0) && (count <= 32));
+
+    for (size_t i = 0; i < words; i++)
+    {
+        uint8_t bitpos;
+
+        /* Empty words are skipped without an atomic operation. */
+        if ((p_masks[i] != 0) && (mask_range_alloc(&p_masks[i], count, &bitpos) == NRFX_SUCCESS))
+        {
+            *p_first = (uint16_t)(i * 32 + bitpos);
+            return NRFX_SUCCESS;
+        }
+    }
+
+    return NRFX_ERROR_NO_MEM;
+}
+
+nrfx_err_t nrfx_flag32_array_range_free(nrfx_atomic_t * p_masks, uint16_t first, uint8_t count)
+{
+    uint8_t bitpos = first % 32;
+
+    if ((count == 0) || (bitpos + count > 32))
+    {
+        return NRFX_ERROR_INVALID_PARAM;
+    }
+
+    return mask_range_free(&p_masks[first / 32], NRFX_BIT_MASK(count) << bitpos);
+}
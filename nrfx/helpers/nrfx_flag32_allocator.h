@@ -111,6 +111,116 @@ nrfx_err_t nrfx_flag32_alloc(nrfx_atomic_t * p_mask, uint8_t * p_flag);
  */
 nrfx_err_t nrfx_flag32_free(nrfx_atomic_t * p_mask, uint8_t flag);
 
+/**
+ * @brief Macro for getting the number of mask words needed for the given number of flags.
+ *
+ * @param[in] count Number of flags.
+ */
+#define NRFX_FLAG32_ARRAY_WORDS(count) (((count) + 31) / 32)
+
+/**
+ * @brief Function for initializing an array of allocator masks.
+ *
+ * Flag n is held in bit (n % 32) of word (n / 32).
+ *
+ * @param[out] p_masks      Array of masks to be initialized.
+ * @param[in]  words        Number of words in the array.
+ * @param[in]  p_init_masks Array of @p words masks with pool of available flags.
+ */
+__STATIC_INLINE void nrfx_flag32_array_init(nrfx_atomic_t *  p_masks,
+                                            size_t           words,
+                                            uint32_t const * p_init_masks)
+{
+    for (size_t i = 0; i < words; i++)
+    {
+        p_masks[i] = p_init_masks[i];
+    }
+}
+
+/**
+ * @brief Function for checking if given flag of a mask array is allocated.
+ *
+ * @note This check may not be valid if context is preempted and state is changed.
+ *
+ * @param[in] p_masks Array of masks.
+ * @param[in] flag    Flag index.
+ *
+ * @return True if specified flag is allocated, false otherwise.
+ */
+bool nrfx_flag32_array_is_allocated(nrfx_atomic_t const * p_masks, uint16_t flag);
+
+/**
+ * @brief Function for allocating a flag in the array of masks.
+ *
+ * @note Function is thread safe, it uses @ref NRFX_ATOMIC_CAS macro on a single word.
+ *       No further synchronization mechanism is needed, provided the macro is properly
+ *       implemented (see @ref nrfx_glue).
+ *
+ * Flags are allocated from the highest bit position of the lowest word with any flag
+ * available, so an array of one word behaves as @ref nrfx_flag32_alloc.
+ *
+ * @param[in,out] p_masks Array of masks with available flags set.
+ *                        On successful allocation flag is cleared.
+ * @param[in]     words   Number of words in the array.
+ * @param[out]    p_flag  Index of the allocated flag.
+ *
+ * @retval NRFX_SUCCESS      Allocation was successful.
+ * @retval NRFX_ERROR_NO_MEM No resource available.
+ */
+nrfx_err_t nrfx_flag32_array_alloc(nrfx_atomic_t * p_masks, size_t words, uint16_t * p_flag);
+
+/**
+ * @brief Function for freeing a flag allocated with @ref nrfx_flag32_array_alloc.
+ *
+ * @note Function is thread safe, it uses @ref NRFX_ATOMIC_CAS macro on a single word.
+ *
+ * @param[in,out] p_masks Array of masks with available flags set.
+ *                        On successful freeing flag is set.
+ * @param[in]     flag    Flag index.
+ *
+ * @retval NRFX_SUCCESS             Freeing was successful.
+ * @retval NRFX_ERROR_INVALID_PARAM Flag was not allocated.
+ */
+nrfx_err_t nrfx_flag32_array_free(nrfx_atomic_t * p_masks, uint16_t flag);
+
+/**
+ * @brief Function for allocating a range of consecutive flags in the array of masks.
+ *
+ * The range is taken from a single word, so that it is allocated with one atomic
+ * operation. Within the word, the range at the highest position is allocated.
+ *
+ * @note Function is thread safe, it uses @ref NRFX_ATOMIC_CAS macro on a single word.
+ *
+ * @param[in,out] p_masks Array of masks with available flags set.
+ *                        On successful allocation flags are cleared.
+ * @param[in]     words   Number of words in the array.
+ * @param[in]     count   Number of flags in the range. From 1 to 32.
+ * @param[out]    p_first Index of the first flag of the allocated range.
+ *
+ * @retval NRFX_SUCCESS      Allocation was successful.
+ * @retval NRFX_ERROR_NO_MEM No word has enough consecutive flags available.
+ */
+nrfx_err_t nrfx_flag32_array_range_alloc(nrfx_atomic_t * p_masks,
+                                         size_t          words,
+                                         uint8_t         count,
+                                         uint16_t *      p_first);
+
+/**
+ * @brief Function for freeing a range allocated with @ref nrfx_flag32_array_range_alloc.
+ *
+ * @note Function is thread safe, it uses @ref NRFX_ATOMIC_CAS macro on a single word.
+ *
+ * @param[in,out] p_masks Array of masks with available flags set.
+ *                        On successful freeing flags are set.
+ * @param[in]     first   Index of the first flag of the range.
+ * @param[in]     count   Number of flags in the range.
+ *
+ * @retval NRFX_SUCCESS             Freeing was successful.
+ * @retval NRFX_ERROR_INVALID_PARAM Any flag of the range was not allocated or the range
+ *                                  spans more than one word.
+ */
+nrfx_err_t nrfx_flag32_array_range_free(nrfx_atomic_t * p_masks, uint16_t first, uint8_t count);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <helpers/nrfx_gppi_graph.h>
+
+#if defined(PPI_PRESENT) || (defined(DPPI_PRESENT) && !defined(NRF_DPPI_EXT))
+
+#if defined(DPPI_PRESENT)
+/* All tasks subscribe to the channel the event publishes to. */
+#define GRAPH_TEPS_PER_CHANNEL UINT8_MAX
+#elif defined(PPI_FEATURE_FORKS_PRESENT)
+/* Task and fork endpoint. */
+#define GRAPH_TEPS_PER_CHANNEL 2
+#else
+#define GRAPH_TEPS_PER_CHANNEL 1
+#endif
+
+#if defined(DPPI_PRESENT)
+/* Function checks that no event and no task is used in more than one edge,
+ * as a publish or subscribe register holds only one channel. */
+static bool graph_dppi_check(nrfx_gppi_edge_t const * p_edges, size_t edge_count)
+{
+    for (size_t i = 0; i < edge_count; i++)
+    {
+        for (size_t j = 0; j < i; j++)
+        {
+            if (p_edges[i].eep == p_edges[j].eep)
+            {
+                return false;
+            }
+
+            for (uint8_t k = 0; k < p_edges[i].tep_count; k++)
+            {
+                for (uint8_t l = 0; l < p_edges[j].tep_count; l++)
+                {
+                    if (p_edges[i].p_teps[k] == p_edges[j].p_teps[l])
+                    {
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+    return true;
+}
+#endif
+
+nrfx_err_t nrfx_gppi_graph_build(nrfx_gppi_graph_t *      p_graph,
+                                 nrfx_gppi_edge_t const * p_edges,
+                                 size_t                   edge_count)
+{
+    NRFX_ASSERT(p_graph);
+    NRFX_ASSERT(p_edges || (edge_count == 0));
+
+    for (size_t i = 0; i < edge_count; i++)
+    {
+        if ((p_edges[i].eep == 0) || (p_edges[i].tep_count == 0) || !p_edges[i].p_teps)
+        {
+            return NRFX_ERROR_INVALID_PARAM;
+        }
+    }
+#if defined(DPPI_PRESENT)
+    if (!graph_dppi_check(p_edges, edge_count))
+    {
+        return NRFX_ERROR_INVALID_PARAM;
+    }
+#endif
+
+    if (nrfx_gppi_group_alloc(&p_graph->group) != NRFX_SUCCESS)
+    {
+        return NRFX_ERROR_NO_MEM;
+    }
+
+    p_graph->p_edges    = p_edges;
+    p_graph->edge_count = 0;
+    p_graph->channels   = 0;
+
+    for (size_t i = 0; i < edge_count; i++)
+    {
+        nrfx_gppi_edge_t const * p_edge = &p_edges[i];
+        uint8_t                  channel = 0;
+
+        /* Counted before configuring the edge, so that freeing clears it if it fails. */
+        p_graph->edge_count = i + 1;
+        for (uint8_t t = 0; t < p_edge->tep_count; t++)
+        {
+            if ((t % GRAPH_TEPS_PER_CHANNEL) == 0)
+            {
+                if (nrfx_gppi_channel_alloc(&channel) != NRFX_SUCCESS)
+                {
+                    nrfx_gppi_graph_free(p_graph);
+                    return NRFX_ERROR_NO_MEM;
+                }
+                p_graph->channels |= NRFX_BIT(channel);
+                nrfx_gppi_channel_endpoints_setup(channel, p_edge->eep, p_edge->p_teps[t]);
+            }
+#if (GRAPH_TEPS_PER_CHANNEL > 1)
+            else
+            {
+                nrfx_gppi_fork_endpoint_setup(channel, p_edge->p_teps[t]);
+            }
+#endif
+        }
+    }
+
+    nrfx_gppi_channels_include_in_group(p_graph->channels, p_graph->group);
+    return NRFX_SUCCESS;
+}
+
+void nrfx_gppi_graph_free(nrfx_gppi_graph_t * p_graph)
+{
+    uint32_t channels = p_graph->channels;
+
+    nrfx_gppi_channels_disable(channels);
+    nrfx_gppi_group_clear(p_graph->group);
+
+#if defined(DPPI_PRESENT)
+    /* Endpoints are cleared by their addresses. */
+    for (size_t i = 0; i < p_graph->edge_count; i++)
+    {
+        nrfx_gppi_edge_t const * p_edge = &p_graph->p_edges[i];
+
+        nrfx_gppi_event_endpoint_clear(0, p_edge->eep);
+        for (uint8_t t = 0; t < p_edge->tep_count; t++)
+        {
+            nrfx_gppi_task_endpoint_clear(0, p_edge->p_teps[t]);
+        }
+    }
+#endif
+
+    while (channels)
+    {
+        uint8_t channel = (uint8_t)NRF_CTZ(channels);
+
+        channels &= ~NRFX_BIT(channel);
+#if !defined(DPPI_PRESENT)
+        /* Endpoints are cleared by their channels. */
+        nrfx_gppi_channel_endpoints_clear(channel, 0, 0);
+#if (GRAPH_TEPS_PER_CHANNEL > 1)
+        nrfx_gppi_fork_endpoint_clear(channel, 0);
+#endif
+#endif
+        (void)nrfx_gppi_channel_free(channel);
+    }
+    (void)nrfx_gppi_group_free(p_graph->group);
+
+    p_graph->channels   = 0;
+    p_graph->edge_count = 0;
+}
+
+void nrfx_gppi_graph_enable(nrfx_gppi_graph_t const * p_graph)
+{
+    nrfx_gppi_group_enable(p_graph->group);
+}
+
+void nrfx_gppi_graph_disable(nrfx_gppi_graph_t const * p_graph)
+{
+    nrfx_gppi_group_disable(p_graph->group);
+}
+
+uint32_t nrfx_gppi_graph_enable_task_address_get(nrfx_gppi_graph_t const * p_graph)
+{
+    return nrfx_gppi_task_address_get(nrfx_gppi_group_enable_task_get(p_graph->group));
+}
+
+uint32_t nrfx_gppi_graph_disable_task_address_get(nrfx_gppi_graph_t const * p_graph)
+{
+    return nrfx_gppi_task_address_get(nrfx_gppi_group_disable_task_get(p_graph->group));
+}
+
+#endif // defined(PPI_PRESENT) || (defined(DPPI_PRESENT) && !defined(NRF_DPPI_EXT))
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_GPPI_GRAPH_H
+#define NRFX_GPPI_GRAPH_H
+
+#include <helpers/nrfx_gppi.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_gppi_graph Generic PPI connection graph
+ * @{
+ * @ingroup nrfx_gppi
+ *
+ * @brief Helper layer that connects events to lists of tasks with the Generic PPI layer.
+ *
+ * The application declares the connections as edges, each being one event and the tasks
+ * it triggers. The helper allocates the channels, places additional tasks on forks, and puts
+ * all channels of the graph in one channel group, so that the whole graph is enabled and
+ * disabled at once. The number of channels used depends on the interface:
+ * one channel per edge in DPPI, and one channel per two tasks in PPI with forks.
+ *
+ * Limitations of DPPI apply to the graph: an event can be used in only one edge,
+ * and a task can be triggered by only one edge. Such graphs are rejected in DPPI.
+ */
+
+/** @brief Connection between an event and the tasks triggered by it. */
+typedef struct
+{
+    uint32_t         eep;       ///< Address of the event.
+    uint32_t const * p_teps;    ///< Addresses of the tasks.
+    uint8_t          tep_count; ///< Number of tasks. At least 1.
+} nrfx_gppi_edge_t;
+
+/** @brief Connection graph. */
+typedef struct
+{
+    nrfx_gppi_edge_t const *  p_edges;    ///< Edges of the graph.
+    size_t                    edge_count; ///< Number of edges.
+    uint32_t                  channels;   ///< Mask of channels used by the graph.
+    nrfx_gppi_channel_group_t group;      ///< Channel group of the graph.
+} nrfx_gppi_graph_t;
+
+/**
+ * @brief Function for building a connection graph.
+ *
+ * The graph is created disabled. The edges are not copied and must remain valid
+ * until the graph is freed.
+ *
+ * @param[out] p_graph    Pointer to the graph structure.
+ * @param[in]  p_edges    Array of edges.
+ * @param[in]  edge_count Number of edges.
+ *
+ * @retval NRFX_SUCCESS             The graph was successfully built.
+ * @retval NRFX_ERROR_INVALID_PARAM An edge has no task, or the graph uses an event or a task
+ *                                  in more than one edge, which is not supported in DPPI.
+ * @retval NRFX_ERROR_NO_MEM        There are not enough channels or no channel group available.
+ *                                  No resources remain allocated.
+ */
+nrfx_err_t nrfx_gppi_graph_build(nrfx_gppi_graph_t *      p_graph,
+                                 nrfx_gppi_edge_t const * p_edges,
+                                 size_t                   edge_count);
+
+/**
+ * @brief Function for freeing the resources of a connection graph.
+ *
+ * The graph is disabled and the endpoints of its channels are cleared.
+ *
+ * @param[in] p_graph Pointer to the graph structure.
+ */
+void nrfx_gppi_graph_free(nrfx_gppi_graph_t * p_graph);
+
+/**
+ * @brief Function for enabling all connections of the graph at once.
+ *
+ * @param[in] p_graph Pointer to the graph structure.
+ */
+void nrfx_gppi_graph_enable(nrfx_gppi_graph_t const * p_graph);
+
+/**
+ * @brief Function for disabling all connections of the graph at once.
+ *
+ * @param[in] p_graph Pointer to the graph structure.
+ */
+void nrfx_gppi_graph_disable(nrfx_gppi_graph_t const * p_graph);
+
+/**
+ * @brief Function for getting the address of the task that enables the graph.
+ *
+ * The task can be used as a task endpoint in another graph, so that an event
+ * enables the graph without CPU involvement.
+ *
+ * @param[in] p_graph Pointer to the graph structure.
+ *
+ * @return Task address.
+ */
+uint32_t nrfx_gppi_graph_enable_task_address_get(nrfx_gppi_graph_t const * p_graph);
+
+/**
+ * @brief Function for getting the address of the task that disables the graph.
+ *
+ * @param[in] p_graph Pointer to the graph structure.
+ *
+ * @return Task address.
+ */
+uint32_t nrfx_gppi_graph_disable_task_address_get(nrfx_gppi_graph_t const * p_graph);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_GPPI_GRAPH_H
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_IPC_ENABLED)
+
+#include <helpers/nrfx_ipc_msg.h>
+#include <string.h>
+
+/* Record header of the padding that fills the ring up to its end when a message does not fit. */
+#define RECORD_PAD UINT32_MAX
+
+/* Size of the header that precedes each message. */
+#define HEADER_SIZE sizeof(uint32_t)
+
+/* Size of the record holding a message, rounded up to keep the headers word aligned. */
+#define RECORD_SIZE(length) ((uint32_t)(HEADER_SIZE + (((length) + 3) & ~(size_t)3)))
+
+/* The other core observes the ring through shared RAM, so accesses must not be reordered. */
+static void ring_barrier(void)
+{
+#if defined(ISA_ARM)
+    __DMB();
+#else
+    nrf_barrier_rw();
+#endif
+}
+
+static uint8_t * ring_data_get(nrfx_ipc_msg_ring_t * p_ring)
+{
+    return (uint8_t *)(p_ring + 1);
+}
+
+nrfx_ipc_msg_ring_t * nrfx_ipc_msg_ring_init(void * p_mem, size_t mem_size)
+{
+    NRFX_ASSERT(p_mem);
+    NRFX_ASSERT(((uint32_t)p_mem & (sizeof(uint32_t) - 1)) == 0);
+    NRFX_ASSERT(mem_size > sizeof(nrfx_ipc_msg_ring_t) + HEADER_SIZE);
+
+    nrfx_ipc_msg_ring_t * p_ring = (nrfx_ipc_msg_ring_t *)p_mem;
+
+    p_ring->wr   = 0;
+    p_ring->rd   = 0;
+    p_ring->size = (uint32_t)((mem_size - sizeof(nrfx_ipc_msg_ring_t)) & ~(sizeof(uint32_t) - 1));
+    ring_barrier();
+    return p_ring;
+}
+
+nrfx_err_t nrfx_ipc_msg_send(nrfx_ipc_msg_channel_t const * p_channel,
+                             void const *                   p_data,
+                             size_t                         length)
+{
+    NRFX_ASSERT(p_channel);
+    NRFX_ASSERT(p_data || (length == 0));
+
+    nrfx_ipc_msg_ring_t * p_ring = p_channel->p_tx;
+    uint8_t *             p_mem  = ring_data_get(p_ring);
+    uint32_t              size   = p_ring->size;
+    uint32_t              wr     = p_ring->wr;
+    uint32_t              rd     = p_ring->rd;
+    uint32_t              record = RECORD_SIZE(length);
+
+    if (record >= size)
+    {
+        return NRFX_ERROR_INVALID_LENGTH;
+    }
+
+    // A record does not wrap, when it does not fit up to the ring end the rest is padded.
+    uint32_t tail = size - wr;
+    uint32_t used = (record > tail) ? (tail + record) : record;
+    uint32_t free = (rd > wr) ? (rd - wr) : (size - wr + rd);
+
+    // One word is always kept free, so that a full ring is not mistaken for an empty one.
+    if (used >= free)
+    {
+        return NRFX_ERROR_NO_MEM;
+    }
+
+    uint32_t start = wr;
+    if (record > tail)
+    {
+        *(uint32_t *)&p_mem[wr] = RECORD_PAD;
+        wr = 0;
+    }
+    *(uint32_t *)&p_mem[wr] = (uint32_t)length;
+    memcpy(&p_mem[wr + HEADER_SIZE], p_data, length);
+    wr += record;
+    if (wr == size)
+    {
+        wr = 0;
+    }
+
+    // Data must be visible before the write offset, and the write offset before the read
+    // offset is checked. Otherwise the consumer could go idle right after this check.
+    ring_barrier();
+    p_ring->wr = wr;
+    ring_barrier();
+
+    if (p_ring->rd == start)
+    {
+        nrfx_ipc_signal(p_channel->signal_index);
+    }
+    return NRFX_SUCCESS;
+}
+
+nrfx_err_t nrfx_ipc_msg_receive(nrfx_ipc_msg_channel_t const * p_channel,
+                                void *                         p_buf,
+                                size_t *                       p_length)
+{
+    NRFX_ASSERT(p_channel);
+    NRFX_ASSERT(p_length);
+    NRFX_ASSERT(p_buf || (*p_length == 0));
+
+    nrfx_ipc_msg_ring_t * p_ring = p_channel->p_rx;
+    uint8_t *             p_mem  = ring_data_get(p_ring);
+    uint32_t              rd     = p_ring->rd;
+
+    if (rd == p_ring->wr)
+    {
+        return NRFX_ERROR_INVALID_STATE;
+    }
+    ring_barrier();
+
+    uint32_t length = *(uint32_t *)&p_mem[rd];
+    if (length == RECORD_PAD)
+    {
+        rd = 0;
+        length = *(uint32_t *)&p_mem[rd];
+    }
+
+    if (length > *p_length)
+    {
+        *p_length = length;
+        return NRFX_ERROR_NO_MEM;
+    }
+
+    memcpy(p_buf, &p_mem[rd + HEADER_SIZE], length);
+    *p_length = length;
+
+    rd += RECORD_SIZE(length);
+    if (rd == p_ring->size)
+    {
+        rd = 0;
+    }
+
+    // Data must be read before the space is released, and the read offset must be visible
+    // before the write offset is checked again, which pairs with the check in the producer.
+    ring_barrier();
+    p_ring->rd = rd;
+    ring_barrier();
+    return NRFX_SUCCESS;
+}
+
+bool nrfx_ipc_msg_is_pending(nrfx_ipc_msg_channel_t const * p_channel)
+{
+    NRFX_ASSERT(p_channel);
+
+    return p_channel->p_rx->rd != p_channel->p_rx->wr;
+}
+
+#endif // NRFX_CHECK(NRFX_IPC_ENABLED)
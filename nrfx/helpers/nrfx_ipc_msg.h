@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_IPC_MSG_H__
+#define NRFX_IPC_MSG_H__
+
+#include <nrfx_ipc.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_ipc_msg IPC message channel
+ * @{
+ * @ingroup nrfx_ipc
+ *
+ * @brief Message transport between cores over rings in shared RAM.
+ *
+ * A channel consists of two single-producer single-consumer rings, one per direction.
+ * Each core must be the only writer of its transmit ring and the only reader of its receive
+ * ring, so no locking is needed. Messages are copied into the ring with a length header.
+ * The remote core is signaled with the IPC only when a message is written to an empty ring.
+ * Further messages written before the remote core has drained the ring do not generate
+ * further interrupts.
+ *
+ * On the receiving side, the IPC event handler is expected to call
+ * @ref nrfx_ipc_msg_receive until the ring is empty.
+ */
+
+/** @brief Ring header, placed at the start of the memory given to @ref nrfx_ipc_msg_ring_init. */
+typedef struct
+{
+    volatile uint32_t wr;   ///< Write offset. Modified only by the producer.
+    volatile uint32_t rd;   ///< Read offset. Modified only by the consumer.
+    uint32_t          size; ///< Size of the data area in bytes.
+} nrfx_ipc_msg_ring_t;
+
+/** @brief Message channel. */
+typedef struct
+{
+    nrfx_ipc_msg_ring_t * p_tx;         ///< Ring for messages sent to the remote core.
+    nrfx_ipc_msg_ring_t * p_rx;         ///< Ring for messages received from the remote core.
+    uint8_t               signal_index; ///< IPC send index used to notify the remote core.
+} nrfx_ipc_msg_channel_t;
+
+/**
+ * @brief Function for initializing a ring in shared memory.
+ *
+ * The ring must be initialized once, before any of the cores uses it, typically
+ * by the core that boots the other one.
+ *
+ * @param[in] p_mem    Pointer to the shared memory. Must be word aligned.
+ * @param[in] mem_size Size of the shared memory in bytes.
+ *
+ * @return Pointer to the ring.
+ */
+nrfx_ipc_msg_ring_t * nrfx_ipc_msg_ring_init(void * p_mem, size_t mem_size);
+
+/**
+ * @brief Function for sending a message.
+ *
+ * @param[in] p_channel Pointer to the channel.
+ * @param[in] p_data    Message data.
+ * @param[in] length    Message length in bytes.
+ *
+ * @retval NRFX_SUCCESS              The message was written to the ring.
+ * @retval NRFX_ERROR_NO_MEM         Not enough free space in the ring.
+ * @retval NRFX_ERROR_INVALID_LENGTH The message can never fit in the ring.
+ */
+nrfx_err_t nrfx_ipc_msg_send(nrfx_ipc_msg_channel_t const * p_channel,
+                             void const *                   p_data,
+                             size_t                         length);
+
+/**
+ * @brief Function for receiving a message.
+ *
+ * @param[in]     p_channel Pointer to the channel.
+ * @param[out]    p_buf     Buffer for the message.
+ * @param[in,out] p_length  Size of @p p_buf on input, message length on output.
+ *
+ * @retval NRFX_SUCCESS             The message was received.
+ * @retval NRFX_ERROR_NO_MEM        The buffer is too small. The message is left in the ring
+ *                                  and @p p_length is set to its length.
+ * @retval NRFX_ERROR_INVALID_STATE The ring is empty.
+ */
+nrfx_err_t nrfx_ipc_msg_receive(nrfx_ipc_msg_channel_t const * p_channel,
+                                void *                         p_buf,
+                                size_t *                       p_length);
+
+/**
+ * @brief Function for checking if there is a message to receive.
+ *
+ * @param[in] p_channel Pointer to the channel.
+ *
+ * @retval true  A message is pending.
+ * @retval false The receive ring is empty.
+ */
+bool nrfx_ipc_msg_is_pending(nrfx_ipc_msg_channel_t const * p_channel);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_IPC_MSG_H__
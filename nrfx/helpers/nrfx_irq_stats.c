@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+#include <helpers/nrfx_irq_stats.h>
+#include <soc/nrfx_cycle_counter.h>
+
+typedef struct
+{
+    nrfx_irq_stats_t stats;
+    uint32_t         start;        ///< Cycle counter value at the handler start.
+    uint32_t         nested_start; ///< Value of m_handler_cycles at the handler start.
+    uint8_t          depth;        ///< Nesting of the hooks for handlers sharing an interrupt.
+} irq_stats_entry_t;
+
+static irq_stats_entry_t m_entries[NRFX_IRQ_STATS_IRQ_COUNT];
+
+/* Cycles spent in all the handlers so far. The increase of this value during a handler
+ * is the time spent in the handlers that preempted it. */
+static uint32_t m_handler_cycles;
+
+void nrfx_irq_stats_reset(void)
+{
+    nrfx_cycle_counter_enable();
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    for (size_t i = 0; i < NRFX_ARRAY_SIZE(m_entries); i++)
+    {
+        m_entries[i].stats.count = 0;
+        m_entries[i].stats.max   = 0;
+        m_entries[i].stats.total = 0;
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+void nrfx_irq_stats_enter(void const * p_reg)
+{
+    uint32_t irq = (uint32_t)nrfx_get_irq_number(p_reg);
+
+    if (irq >= NRFX_ARRAY_SIZE(m_entries))
+    {
+        return;
+    }
+
+    irq_stats_entry_t * p_entry = &m_entries[irq];
+
+    // POWER and CLOCK handlers are called from the shared handler, which is also instrumented.
+    if (p_entry->depth++ == 0)
+    {
+        p_entry->start        = nrfx_cycle_counter_get();
+        p_entry->nested_start = m_handler_cycles;
+    }
+}
+
+void nrfx_irq_stats_exit(void const * p_reg)
+{
+    uint32_t now = nrfx_cycle_counter_get();
+    uint32_t irq = (uint32_t)nrfx_get_irq_number(p_reg);
+
+    if (irq >= NRFX_ARRAY_SIZE(m_entries))
+    {
+        return;
+    }
+
+    irq_stats_entry_t * p_entry = &m_entries[irq];
+
+    if (--p_entry->depth != 0)
+    {
+        return;
+    }
+
+    uint32_t elapsed = now - p_entry->start;
+    uint32_t nested  = m_handler_cycles - p_entry->nested_start;
+    uint32_t cycles  = (elapsed > nested) ? (elapsed - nested) : 0;
+
+    m_handler_cycles += cycles;
+
+    p_entry->stats.count++;
+    p_entry->stats.total += cycles;
+    p_entry->stats.max    = NRFX_MAX(p_entry->stats.max, cycles);
+}
+
+bool nrfx_irq_stats_get(IRQn_Type irq, nrfx_irq_stats_t * p_stats)
+{
+    NRFX_ASSERT(p_stats);
+
+    if ((uint32_t)irq >= NRFX_ARRAY_SIZE(m_entries))
+    {
+        return false;
+    }
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    *p_stats = m_entries[irq].stats;
+    NRFX_CRITICAL_SECTION_EXIT();
+    return true;
+}
+
+void nrfx_irq_stats_dump(nrfx_irq_stats_dump_handler_t handler, void * p_context)
+{
+    NRFX_ASSERT(handler);
+
+    for (size_t i = 0; i < NRFX_ARRAY_SIZE(m_entries); i++)
+    {
+        nrfx_irq_stats_t stats;
+
+        (void)nrfx_irq_stats_get((IRQn_Type)i, &stats);
+        if (stats.count != 0)
+        {
+            handler((IRQn_Type)i, &stats, p_context);
+        }
+    }
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_IRQ_STATS_H__
+#define NRFX_IRQ_STATS_H__
+
+#include <nrfx.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_irq_stats Interrupt handler statistics
+ * @{
+ * @ingroup nrfx
+ *
+ * @brief Module for measuring the time spent in the driver interrupt handlers.
+ *
+ * All driver interrupt handlers call @ref NRFX_IRQ_ENTER at their start and
+ * @ref NRFX_IRQ_EXIT at their end, with the register base address of the instance.
+ * The hooks can be defined in the glue layer. Otherwise, when @ref NRFX_IRQ_STATS_ENABLED
+ * is set, they record per-interrupt statistics in this module, and they are empty when it
+ * is not set. The time spent in handlers that preempted the given one is not included.
+ *
+ * Times are expressed in CPU cycles and obtained from @ref nrfx_cycle_counter,
+ * so on SoCs without the DWT unit only the number of calls is recorded.
+ */
+
+/** @brief Statistics of an interrupt handler. */
+typedef struct
+{
+    uint32_t count; ///< Number of calls.
+    uint32_t max;   ///< Longest call, in cycles.
+    uint64_t total; ///< Sum of all calls, in cycles.
+} nrfx_irq_stats_t;
+
+/**
+ * @brief Interrupt statistics dump handler prototype.
+ *
+ * @param[in] irq       Interrupt number.
+ * @param[in] p_stats   Pointer to the statistics of the interrupt handler.
+ * @param[in] p_context User context.
+ */
+typedef void (* nrfx_irq_stats_dump_handler_t)(IRQn_Type                irq,
+                                               nrfx_irq_stats_t const * p_stats,
+                                               void *                   p_context);
+
+/**
+ * @brief Function for clearing the statistics.
+ *
+ * The function also enables the cycle counter, so it must be called once before
+ * the statistics are collected.
+ */
+void nrfx_irq_stats_reset(void);
+
+/**
+ * @brief Function for recording the start of an interrupt handler.
+ *
+ * @param[in] p_reg Register base address of the peripheral instance.
+ */
+void nrfx_irq_stats_enter(void const * p_reg);
+
+/**
+ * @brief Function for recording the end of an interrupt handler.
+ *
+ * @param[in] p_reg Register base address of the peripheral instance.
+ */
+void nrfx_irq_stats_exit(void const * p_reg);
+
+/**
+ * @brief Function for getting the statistics of the specified interrupt.
+ *
+ * @param[in]  irq     Interrupt number.
+ * @param[out] p_stats Pointer to the structure to be filled with the statistics.
+ *
+ * @retval true  The statistics were retrieved.
+ * @retval false The interrupt number is outside of the recorded range.
+ */
+bool nrfx_irq_stats_get(IRQn_Type irq, nrfx_irq_stats_t * p_stats);
+
+/**
+ * @brief Function for passing the statistics of all interrupts that were handled
+ *        to the specified handler.
+ *
+ * @param[in] handler   Handler called for every interrupt with a non-zero call count.
+ * @param[in] p_context User context passed to the handler.
+ */
+void nrfx_irq_stats_dump(nrfx_irq_stats_dump_handler_t handler, void * p_context);
+
+#if defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Macro called at the start of every driver interrupt handler.
+ *
+ * @param[in] p_reg Register base address of the peripheral instance.
+ */
+#define NRFX_IRQ_ENTER(p_reg)
+
+/**
+ * @brief Macro called at the end of every driver interrupt handler.
+ *
+ * @param[in] p_reg Register base address of the peripheral instance.
+ */
+#define NRFX_IRQ_EXIT(p_reg)
+#elif !defined(NRFX_IRQ_ENTER)
+#if NRFX_CHECK(NRFX_IRQ_STATS_ENABLED)
+#define NRFX_IRQ_ENTER(p_reg) nrfx_irq_stats_enter(p_reg)
+#define NRFX_IRQ_EXIT(p_reg)  nrfx_irq_stats_exit(p_reg)
+#else
+#define NRFX_IRQ_ENTER(p_reg) (void)(p_reg)
+#define NRFX_IRQ_EXIT(p_reg)  (void)(p_reg)
+#endif
+#endif
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_IRQ_STATS_H__
@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_RTC_ENABLED)
+
+#include <helpers/nrfx_multitimer.h>
+
+/* Compare channel used by the service. */
+#define MULTITIMER_CC 0
+
+/* Heap position of a timer that is not active. */
+#define HEAP_IDX_INACTIVE UINT16_MAX
+
+/* COMPARE event is not guaranteed for values closer than 2 ticks to the counter value
+ * at the time of writing. One more tick covers the counter advancing since it was read. */
+#define MIN_DELTA 3
+
+/* Control block of the multi-timer service. */
+typedef struct
+{
+    nrfx_rtc_t           rtc;
+    nrfx_multitimer_t ** pp_heap;
+    uint16_t             heap_size;
+    uint16_t             count;
+    /* Ticks of all counter wraps observed so far. */
+    uint64_t             wrapped;
+    uint32_t             last_counter;
+    nrfx_drv_state_t     state;
+} multitimer_cb_t;
+
+static multitimer_cb_t m_cb;
+
+/* Function returns the 64-bit time. Must be called in a critical section,
+ * at least once per counter wrap, which is ensured by the OVERFLOW interrupt. */
+static uint64_t ticks_get(void)
+{
+    uint32_t counter = nrfx_rtc_counter_get(&m_cb.rtc);
+
+    if (counter < m_cb.last_counter)
+    {
+        m_cb.wrapped += (uint64_t)NRF_RTC_COUNTER_MAX + 1;
+    }
+    m_cb.last_counter = counter;
+    return m_cb.wrapped + counter;
+}
+
+static void heap_place(uint16_t idx, nrfx_multitimer_t * p_timer)
+{
+    m_cb.pp_heap[idx] = p_timer;
+    p_timer->heap_idx = idx;
+}
+
+static void heap_sift_up(uint16_t idx)
+{
+    nrfx_multitimer_t * p_timer = m_cb.pp_heap[idx];
+
+    while (idx > 0)
+    {
+        uint16_t parent = (uint16_t)((idx - 1) / 2);
+
+        if (m_cb.pp_heap[parent]->expiry <= p_timer->expiry)
+        {
+            break;
+        }
+        heap_place(idx, m_cb.pp_heap[parent]);
+        idx = parent;
+    }
+    heap_place(idx, p_timer);
+}
+
+static void heap_sift_down(uint16_t idx)
+{
+    nrfx_multitimer_t * p_timer = m_cb.pp_heap[idx];
+
+    for (;;)
+    {
+        uint32_t child = 2 * (uint32_t)idx + 1;
+
+        if (child >= m_cb.count)
+        {
+            break;
+        }
+        if ((child + 1 < m_cb.count) &&
+            (m_cb.pp_heap[child + 1]->expiry < m_cb.pp_heap[child]->expiry))
+        {
+            child++;
+        }
+        if (p_timer->expiry <= m_cb.pp_heap[child]->expiry)
+        {
+            break;
+        }
+        heap_place(idx, m_cb.pp_heap[child]);
+        idx = (uint16_t)child;
+    }
+    heap_place(idx, p_timer);
+}
+
+static nrfx_err_t heap_insert(nrfx_multitimer_t * p_timer)
+{
+    if (m_cb.count == m_cb.heap_size)
+    {
+        return NRFX_ERROR_NO_MEM;
+    }
+
+    heap_place(m_cb.count, p_timer);
+    heap_sift_up(m_cb.count++);
+    return NRFX_SUCCESS;
+}
+
+static void heap_remove(nrfx_multitimer_t * p_timer)
+{
+    uint16_t idx = p_timer->heap_idx;
+
+    p_timer->heap_idx = HEAP_IDX_INACTIVE;
+    if (idx != --m_cb.count)
+    {
+        /* The last timer fills the gap and moves up or down from there. */
+        nrfx_multitimer_t * p_last = m_cb.pp_heap[m_cb.count];
+
+        heap_place(idx, p_last);
+        heap_sift_up(idx);
+        heap_sift_down(p_last->heap_idx);
+    }
+}
+
+/* Function sets the compare channel to the earliest expiry. */
+static void compare_schedule(uint64_t now)
+{
+    if (m_cb.count == 0)
+    {
+        (void)nrfx_rtc_cc_disable(&m_cb.rtc, MULTITIMER_CC);
+        return;
+    }
+
+    uint64_t expiry = m_cb.pp_heap[0]->expiry;
+    uint64_t delta  = (expiry > now + MIN_DELTA) ? (expiry - now) : MIN_DELTA;
+
+    if (delta > NRF_RTC_COUNTER_MAX)
+    {
+        /* The counter wraps before the expiry, and the OVERFLOW interrupt schedules again. */
+        (void)nrfx_rtc_cc_disable(&m_cb.rtc, MULTITIMER_CC);
+        return;
+    }
+    (void)nrfx_rtc_cc_set(&m_cb.rtc, MULTITIMER_CC, NRF_RTC_WRAP((uint32_t)(now + delta)), true);
+}
+
+static void multitimer_rtc_handler(nrfx_rtc_int_type_t int_type)
+{
+    if (int_type == NRFX_RTC_INT_OVERFLOW)
+    {
+        NRFX_CRITICAL_SECTION_ENTER();
+        compare_schedule(ticks_get());
+        NRFX_CRITICAL_SECTION_EXIT();
+        return;
+    }
+    if (int_type != NRFX_RTC_INT_COMPARE0)
+    {
+        return;
+    }
+
+    for (;;)
+    {
+        nrfx_multitimer_t * p_timer = NULL;
+
+        NRFX_CRITICAL_SECTION_ENTER();
+        uint64_t now = ticks_get();
+
+        if ((m_cb.count > 0) && (m_cb.pp_heap[0]->expiry <= now))
+        {
+            p_timer = m_cb.pp_heap[0];
+            heap_remove(p_timer);
+            if (p_timer->period)
+            {
+                /* Restarted before the handler is called, so that the handler can stop it. */
+                p_timer->expiry += p_timer->period;
+                (void)heap_insert(p_timer);
+            }
+        }
+        else
+        {
+            compare_schedule(now);
+        }
+        NRFX_CRITICAL_SECTION_EXIT();
+
+        if (!p_timer)
+        {
+            break;
+        }
+        p_timer->handler(p_timer, p_timer->p_context);
+    }
+}
+
+nrfx_err_t nrfx_multitimer_init(nrfx_rtc_t const *        p_rtc,
+                                nrfx_rtc_config_t const * p_config,
+                                nrfx_multitimer_t **      pp_heap,
+                                uint16_t                  heap_size)
+{
+    NRFX_ASSERT(pp_heap);
+    NRFX_ASSERT((heap_size > 0) && (heap_size < HEAP_IDX_INACTIVE));
+
+    nrfx_err_t        err_code;
+    nrfx_rtc_config_t config = *p_config;
+
+    if (m_cb.state != NRFX_DRV_STATE_UNINITIALIZED)
+    {
+        return NRFX_ERROR_INVALID_STATE;
+    }
+
+    /* A compare value that is behind is handled by the minimum distance instead. */
+    config.reliable = false;
+    err_code = nrfx_rtc_init(p_rtc, &config, multitimer_rtc_handler);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    m_cb.rtc          = *p_rtc;
+    m_cb.pp_heap      = pp_heap;
+    m_cb.heap_size    = heap_size;
+    m_cb.count        = 0;
+    m_cb.wrapped      = 0;
+    m_cb.last_counter = 0;
+
+    nrfx_rtc_counter_clear(&m_cb.rtc);
+    nrfx_rtc_overflow_enable(&m_cb.rtc, true);
+    nrfx_rtc_enable(&m_cb.rtc);
+
+    m_cb.state = NRFX_DRV_STATE_INITIALIZED;
+    return NRFX_SUCCESS;
+}
+
+void nrfx_multitimer_uninit(void)
+{
+    NRFX_ASSERT(m_cb.state != NRFX_DRV_STATE_UNINITIALIZED);
+
+    nrfx_rtc_uninit(&m_cb.rtc);
+    for (uint16_t i = 0; i < m_cb.count; i++)
+    {
+        m_cb.pp_heap[i]->heap_idx = HEAP_IDX_INACTIVE;
+    }
+    m_cb.count = 0;
+    m_cb.state = NRFX_DRV_STATE_UNINITIALIZED;
+}
+
+void nrfx_multitimer_setup(nrfx_multitimer_t *       p_timer,
+                           nrfx_multitimer_handler_t handler,
+                           void *                    p_context)
+{
+    NRFX_ASSERT(handler);
+
+    p_timer->handler   = handler;
+    p_timer->p_context = p_context;
+    p_timer->heap_idx  = HEAP_IDX_INACTIVE;
+}
+
+nrfx_err_t nrfx_multitimer_start(nrfx_multitimer_t * p_timer, uint32_t ticks, uint32_t period)
+{
+    NRFX_ASSERT(m_cb.state != NRFX_DRV_STATE_UNINITIALIZED);
+    NRFX_ASSERT(p_timer->handler);
+
+    nrfx_err_t err_code;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    uint64_t now = ticks_get();
+
+    if (p_timer->heap_idx != HEAP_IDX_INACTIVE)
+    {
+        heap_remove(p_timer);
+    }
+    p_timer->expiry = now + ticks;
+    p_timer->period = period;
+    err_code = heap_insert(p_timer);
+    compare_schedule(now);
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    return err_code;
+}
+
+void nrfx_multitimer_stop(nrfx_multitimer_t * p_timer)
+{
+    NRFX_CRITICAL_SECTION_ENTER();
+    if (p_timer->heap_idx != HEAP_IDX_INACTIVE)
+    {
+        bool first = (p_timer->heap_idx == 0);
+
+        heap_remove(p_timer);
+        if (first)
+        {
+            compare_schedule(ticks_get());
+        }
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+bool nrfx_multitimer_is_active(nrfx_multitimer_t const * p_timer)
+{
+    return p_timer->heap_idx != HEAP_IDX_INACTIVE;
+}
+
+uint64_t nrfx_multitimer_ticks_get(void)
+{
+    uint64_t ticks;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    ticks = ticks_get();
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    return ticks;
+}
+
+#endif // NRFX_CHECK(NRFX_RTC_ENABLED)
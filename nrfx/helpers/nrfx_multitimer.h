@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_MULTITIMER_H__
+#define NRFX_MULTITIMER_H__
+
+#include <nrfx_rtc.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_multitimer RTC multi-timer service
+ * @{
+ * @ingroup nrfx
+ *
+ * @brief Software timers multiplexed on one compare channel of an RTC instance.
+ *
+ * Active timers are kept in a binary heap ordered by expiry time, so starting and
+ * stopping a timer takes O(log n). The compare channel is always set to the earliest
+ * expiry, so the RTC interrupt fires only when a timer expires, or on the counter overflow
+ * used to extend the 24-bit counter to 64 bits. The handlers are called from the RTC
+ * interrupt.
+ *
+ * The service uses the RTC driver for the selected instance, which must be enabled,
+ * and takes the compare channel 0 of the instance.
+ */
+
+/** @brief Software timer. */
+typedef struct nrfx_multitimer_s nrfx_multitimer_t;
+
+/**
+ * @brief Timer expiry handler prototype.
+ *
+ * @param[in] p_timer   Timer that expired.
+ * @param[in] p_context User context.
+ */
+typedef void (*nrfx_multitimer_handler_t)(nrfx_multitimer_t * p_timer, void * p_context);
+
+/** @brief Software timer structure. Fields are set by @ref nrfx_multitimer_setup. */
+struct nrfx_multitimer_s
+{
+    nrfx_multitimer_handler_t handler;   ///< Handler called when the timer expires.
+    void *                    p_context; ///< Context passed to the handler.
+    uint64_t                  expiry;    ///< Expiry time in ticks. For internal use only.
+    uint32_t                  period;    ///< Period in ticks. For internal use only.
+    uint16_t                  heap_idx;  ///< Position in the heap. For internal use only.
+};
+
+/**
+ * @brief Function for initializing the service.
+ *
+ * @param[in] p_rtc     Pointer to the RTC driver instance to be used.
+ * @param[in] p_config  Pointer to the RTC configuration. The prescaler sets the tick length.
+ *                      The reliable mode is not used by the service.
+ * @param[in] pp_heap   Memory for the heap, holding a pointer to each active timer.
+ * @param[in] heap_size Number of entries in @p pp_heap, that is the maximum number
+ *                      of timers active at the same time.
+ *
+ * @retval NRFX_SUCCESS             The service is initialized.
+ * @retval NRFX_ERROR_INVALID_STATE The service or the RTC instance is already initialized.
+ */
+nrfx_err_t nrfx_multitimer_init(nrfx_rtc_t const *        p_rtc,
+                                nrfx_rtc_config_t const * p_config,
+                                nrfx_multitimer_t **      pp_heap,
+                                uint16_t                  heap_size);
+
+/** @brief Function for uninitializing the service. Active timers are stopped. */
+void nrfx_multitimer_uninit(void);
+
+/**
+ * @brief Function for setting up a timer.
+ *
+ * The timer must not be active.
+ *
+ * @param[out] p_timer   Pointer to the timer.
+ * @param[in]  handler   Handler called when the timer expires.
+ * @param[in]  p_context Context passed to the handler.
+ */
+void nrfx_multitimer_setup(nrfx_multitimer_t *       p_timer,
+                           nrfx_multitimer_handler_t handler,
+                           void *                    p_context);
+
+/**
+ * @brief Function for starting a timer.
+ *
+ * A timer that is already active is restarted.
+ *
+ * @param[in] p_timer Pointer to the timer.
+ * @param[in] ticks   Number of ticks after which the timer expires.
+ * @param[in] period  Period in ticks with which the timer is restarted after expiry.
+ *                    0 for a single shot timer.
+ *
+ * @retval NRFX_SUCCESS      The timer is started.
+ * @retval NRFX_ERROR_NO_MEM The heap is full.
+ */
+nrfx_err_t nrfx_multitimer_start(nrfx_multitimer_t * p_timer, uint32_t ticks, uint32_t period);
+
+/**
+ * @brief Function for stopping a timer.
+ *
+ * Stopping a timer that is not active has no effect.
+ *
+ * @param[in] p_timer Pointer to the timer.
+ */
+void nrfx_multitimer_stop(nrfx_multitimer_t * p_timer);
+
+/**
+ * @brief Function for checking if a timer is active.
+ *
+ * @param[in] p_timer Pointer to the timer.
+ *
+ * @retval true  The timer is active.
+ * @retval false The timer is not active.
+ */
+bool nrfx_multitimer_is_active(nrfx_multitimer_t const * p_timer);
+
+/**
+ * @brief Function for getting the current time.
+ *
+ * @return Number of ticks since the service was initialized.
+ */
+uint64_t nrfx_multitimer_ticks_get(void);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_MULTITIMER_H__
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_PWM_ENABLED)
+
+#include <helpers/nrfx_parallel_out.h>
+
+/* Values keeping the output constant for the whole period, as the compare value is never
+ * reached. The polarity bit selects the level, with the falling edge polarity (bit 15 set)
+ * the output starts high. */
+#define VALUE_HIGH(top) (0x8000 | (top))
+#define VALUE_LOW(top)  (top)
+
+nrfx_err_t nrfx_parallel_out_init(nrfx_parallel_out_t *              p_out,
+                                  nrfx_parallel_out_config_t const * p_config,
+                                  nrfx_pwm_handler_t                 handler,
+                                  void *                             p_context)
+{
+    NRFX_ASSERT(p_out);
+    NRFX_ASSERT(p_config);
+    NRFX_ASSERT(p_config->clocks_per_word >= 3);
+
+    nrfx_pwm_config_t config = NRFX_PWM_DEFAULT_CONFIG(p_config->pins[0],
+                                                       p_config->pins[1],
+                                                       p_config->pins[2],
+                                                       p_config->pins[3]);
+    config.irq_priority = p_config->irq_priority;
+    config.base_clock   = p_config->base_clock;
+    config.count_mode   = NRF_PWM_MODE_UP;
+    config.top_value    = p_config->clocks_per_word;
+    config.load_mode    = NRF_PWM_LOAD_INDIVIDUAL;
+    config.step_mode    = p_config->triggered ? NRF_PWM_STEP_TRIGGERED : NRF_PWM_STEP_AUTO;
+
+    nrfx_err_t err_code = nrfx_pwm_init(&p_config->pwm, &config, handler, p_context);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    p_out->pwm       = p_config->pwm;
+    p_out->top_value = p_config->clocks_per_word;
+
+    return NRFX_SUCCESS;
+}
+
+void nrfx_parallel_out_uninit(nrfx_parallel_out_t * p_out)
+{
+    NRFX_ASSERT(p_out);
+
+    nrfx_pwm_uninit(&p_out->pwm);
+}
+
+void nrfx_parallel_out_encode(nrfx_parallel_out_t const *   p_out,
+                              uint8_t const *               p_words,
+                              size_t                        count,
+                              nrf_pwm_values_individual_t * p_values)
+{
+    NRFX_ASSERT(p_out);
+    NRFX_ASSERT(p_words);
+    NRFX_ASSERT(p_values);
+
+    uint16_t high = VALUE_HIGH(p_out->top_value);
+    uint16_t low  = VALUE_LOW(p_out->top_value);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        uint8_t word = p_words[i];
+
+        p_values[i].channel_0 = (word & NRFX_BIT(0)) ? high : low;
+        p_values[i].channel_1 = (word & NRFX_BIT(1)) ? high : low;
+        p_values[i].channel_2 = (word & NRFX_BIT(2)) ? high : low;
+        p_values[i].channel_3 = (word & NRFX_BIT(3)) ? high : low;
+    }
+}
+
+uint32_t nrfx_parallel_out_write(nrfx_parallel_out_t const *         p_out,
+                                 nrf_pwm_values_individual_t const * p_values,
+                                 uint16_t                            count,
+                                 uint32_t                            flags)
+{
+    NRFX_ASSERT(p_out);
+    NRFX_ASSERT(p_values);
+    NRFX_ASSERT(count && (count <= (UINT16_MAX / NRFX_PARALLEL_OUT_WIDTH)));
+
+    nrf_pwm_sequence_t const sequence = {
+        .values.p_individual = p_values,
+        .length              = (uint16_t)(count * NRFX_PARALLEL_OUT_WIDTH),
+        .repeats             = 0,
+        .end_delay           = 0,
+    };
+
+    return nrfx_pwm_simple_playback(&p_out->pwm, &sequence, 1, flags | NRFX_PWM_FLAG_STOP);
+}
+
+uint32_t nrfx_parallel_out_next_task_address_get(nrfx_parallel_out_t const * p_out)
+{
+    NRFX_ASSERT(p_out);
+
+    return nrfx_pwm_task_address_get(&p_out->pwm, NRF_PWM_TASK_NEXTSTEP);
+}
+
+#endif // NRFX_CHECK(NRFX_PWM_ENABLED)
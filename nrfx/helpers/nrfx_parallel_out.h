@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_PARALLEL_OUT_H__
+#define NRFX_PARALLEL_OUT_H__
+
+#include <nrfx_pwm.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_parallel_out Parallel output
+ * @{
+ * @ingroup nrfx
+ *
+ * @brief Streaming of words from RAM to a parallel bus of up to four pins with PWM and EasyDMA.
+ *
+ * The PWM instance runs in the individual load mode, with each channel driving one bit
+ * of the bus. Every value of a channel lasts exactly one PWM period and keeps the output
+ * constantly high or low, so the sequence played by EasyDMA becomes a stream of parallel
+ * words without any CPU activity. Words advance either every PWM period, which gives rates
+ * up to one word per three cycles of the 16 MHz clock, or on the NEXTSTEP task, which can be
+ * connected through (D)PPI to a TIMER or to a ready signal of the receiving device.
+ *
+ * Words are converted to the PWM format with @ref nrfx_parallel_out_encode. Each word
+ * takes 8 bytes of RAM, so static content should be encoded once and replayed.
+ *
+ * The parallel output uses the PWM driver for the selected instance, which must be enabled.
+ */
+
+/** @brief Number of bits in a word. */
+#define NRFX_PARALLEL_OUT_WIDTH NRF_PWM_CHANNEL_COUNT
+
+/** @brief Parallel output configuration. */
+typedef struct
+{
+    nrfx_pwm_t    pwm;                           ///< PWM instance used exclusively for the output.
+    uint32_t      pins[NRFX_PARALLEL_OUT_WIDTH]; ///< Pins of the bits, @ref NRF_PWM_PIN_NOT_CONNECTED if unused.
+    nrf_pwm_clk_t base_clock;                    ///< Base clock of the PWM.
+    uint16_t      clocks_per_word;               ///< Duration of a word in base clock cycles, at least 3.
+    bool          triggered;                     ///< True to advance words on the NEXTSTEP task.
+    uint8_t       irq_priority;                  ///< Interrupt priority.
+} nrfx_parallel_out_config_t;
+
+/** @brief Parallel output instance. Its content is handled by the helper. */
+typedef struct
+{
+    nrfx_pwm_t pwm;       ///< PWM instance.
+    uint16_t   top_value; ///< Top value of the PWM counter.
+} nrfx_parallel_out_t;
+
+/**
+ * @brief Function for initializing a parallel output.
+ *
+ * The pins are configured as outputs driven low.
+ *
+ * @param[out] p_out     Pointer to the parallel output instance.
+ * @param[in]  p_config  Pointer to the configuration.
+ * @param[in]  handler   PWM event handler, reporting the end of a write. Can be NULL.
+ * @param[in]  p_context Context passed to the event handler.
+ *
+ * @retval NRFX_SUCCESS             The parallel output is initialized.
+ * @retval NRFX_ERROR_INVALID_STATE The PWM instance is already initialized.
+ * @retval NRFX_ERROR_BUSY          The PWM peripheral is already in use.
+ */
+nrfx_err_t nrfx_parallel_out_init(nrfx_parallel_out_t *              p_out,
+                                  nrfx_parallel_out_config_t const * p_config,
+                                  nrfx_pwm_handler_t                 handler,
+                                  void *                             p_context);
+
+/**
+ * @brief Function for uninitializing a parallel output.
+ *
+ * @param[in] p_out Pointer to the parallel output instance.
+ */
+void nrfx_parallel_out_uninit(nrfx_parallel_out_t * p_out);
+
+/**
+ * @brief Function for converting words to the format played by the parallel output.
+ *
+ * Bit n of each word drives the pin with index n in the configuration. Bits above
+ * @ref NRFX_PARALLEL_OUT_WIDTH are ignored.
+ *
+ * @param[in]  p_out    Pointer to the parallel output instance.
+ * @param[in]  p_words  Words to be converted.
+ * @param[in]  count    Number of words.
+ * @param[out] p_values Converted values, @p count entries. Must be in Data RAM.
+ */
+void nrfx_parallel_out_encode(nrfx_parallel_out_t const *   p_out,
+                              uint8_t const *               p_words,
+                              size_t                        count,
+                              nrf_pwm_values_individual_t * p_values);
+
+/**
+ * @brief Function for writing encoded words to the bus.
+ *
+ * The last word is kept on the bus after the write is finished.
+ *
+ * @param[in] p_out    Pointer to the parallel output instance.
+ * @param[in] p_values Values converted by @ref nrfx_parallel_out_encode.
+ * @param[in] count    Number of words, up to 16383.
+ * @param[in] flags    Additional options, see @ref nrfx_pwm_flag_t.
+ *                     @ref NRFX_PWM_FLAG_STOP is always added.
+ *
+ * @return Address of the task starting the write if the @ref NRFX_PWM_FLAG_START_VIA_TASK
+ *         flag was used, 0 otherwise.
+ */
+uint32_t nrfx_parallel_out_write(nrfx_parallel_out_t const *         p_out,
+                                 nrf_pwm_values_individual_t const * p_values,
+                                 uint16_t                            count,
+                                 uint32_t                            flags);
+
+/**
+ * @brief Function for getting the address of the task advancing to the next word.
+ *
+ * Used when the parallel output is configured with @p triggered set.
+ *
+ * @param[in] p_out Pointer to the parallel output instance.
+ *
+ * @return Address of the NEXTSTEP task of the PWM instance.
+ */
+uint32_t nrfx_parallel_out_next_task_address_get(nrfx_parallel_out_t const * p_out);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_PARALLEL_OUT_H__
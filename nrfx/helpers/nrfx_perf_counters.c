@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+#include <helpers/nrfx_perf_counters.h>
+
+#if !defined(NRFX_PERF_COUNTERS_SECTION_START)
+#if defined(__ARMCC_VERSION)
+extern nrfx_perf_counter_t const m_section_start[] __asm("nrfx_perf_counters$$Base");
+extern nrfx_perf_counter_t const m_section_end[]   __asm("nrfx_perf_counters$$Limit");
+#elif defined(__GNUC__)
+/* Weak, so that an image with no counters registered still links. Both are then 0. */
+extern nrfx_perf_counter_t const __start_nrfx_perf_counters[] __attribute__((weak));
+extern nrfx_perf_counter_t const __stop_nrfx_perf_counters[]  __attribute__((weak));
+#define m_section_start __start_nrfx_perf_counters
+#define m_section_end   __stop_nrfx_perf_counters
+#else
+#error "Define NRFX_PERF_COUNTERS_SECTION_START and NRFX_PERF_COUNTERS_SECTION_END in the glue."
+#endif
+#define NRFX_PERF_COUNTERS_SECTION_START m_section_start
+#define NRFX_PERF_COUNTERS_SECTION_END   m_section_end
+#endif
+
+size_t nrfx_perf_counters_count(void)
+{
+    nrfx_perf_counter_t const * p_start = NRFX_PERF_COUNTERS_SECTION_START;
+    nrfx_perf_counter_t const * p_end   = NRFX_PERF_COUNTERS_SECTION_END;
+
+    return (size_t)(p_end - p_start);
+}
+
+nrfx_perf_counter_t const * nrfx_perf_counter_get(size_t index)
+{
+    if (index >= nrfx_perf_counters_count())
+    {
+        return NULL;
+    }
+
+    return &NRFX_PERF_COUNTERS_SECTION_START[index];
+}
+
+size_t nrfx_perf_counter_read(nrfx_perf_counter_t const * p_counter,
+                              uint32_t *                  p_values,
+                              size_t                      max_length)
+{
+    NRFX_ASSERT(p_counter);
+    NRFX_ASSERT(p_values || (max_length == 0));
+
+    size_t length = NRFX_MIN((size_t)p_counter->length, max_length);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    for (size_t i = 0; i < length; i++)
+    {
+        p_values[i] = p_counter->p_values[i];
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    return length;
+}
+
+void nrfx_perf_counters_dump(nrfx_perf_counters_dump_handler_t handler, void * p_context)
+{
+    NRFX_ASSERT(handler);
+
+    size_t count = nrfx_perf_counters_count();
+
+    for (size_t i = 0; i < count; i++)
+    {
+        handler(&NRFX_PERF_COUNTERS_SECTION_START[i], p_context);
+    }
+}
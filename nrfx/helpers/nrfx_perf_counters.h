@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_PERF_COUNTERS_H__
+#define NRFX_PERF_COUNTERS_H__
+
+#include <nrfx.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_perf_counters Performance counter registry
+ * @{
+ * @ingroup nrfx
+ *
+ * @brief Module for collecting performance counters of all modules in one place.
+ *
+ * A module registers its counters and histograms with @ref NRFX_PERF_COUNTER_REGISTER and
+ * @ref NRFX_PERF_HISTOGRAM_REGISTER. Each registration places a constant descriptor in the
+ * @c nrfx_perf_counters linker section, so the registry needs no RAM and no initialization,
+ * and a reader finds all counters of the image by walking that section. The values remain
+ * owned and updated by the registering module.
+ *
+ * The section boundaries are taken from the symbols generated by the GNU linker and by armlink.
+ * The glue layer can define @ref NRFX_PERF_COUNTERS_SECTION_START and
+ * @ref NRFX_PERF_COUNTERS_SECTION_END when the linker script places the section differently.
+ * The linker script must keep the section, as no code references the descriptors directly.
+ *
+ * When @ref NRFX_PERF_COUNTERS_ENABLED is not set, the registration macros are empty and
+ * the registry holds no counters.
+ */
+
+/** @brief Types of registered values. */
+typedef enum
+{
+    NRFX_PERF_COUNTER_TYPE_COUNTER,   ///< Single event counter.
+    NRFX_PERF_COUNTER_TYPE_HISTOGRAM, ///< Array of histogram bins.
+} nrfx_perf_counter_type_t;
+
+/** @brief Descriptor of a registered counter. */
+typedef struct
+{
+    char const *              p_name;   ///< Null-terminated name, unique in the image.
+    volatile uint32_t const * p_values; ///< Value of the counter or the bins of the histogram.
+    uint16_t                  length;   ///< Number of values pointed to by @p p_values.
+    uint8_t                   type;     ///< Type of the values, as @ref nrfx_perf_counter_type_t.
+} nrfx_perf_counter_t;
+
+/**
+ * @brief Performance counter dump handler prototype.
+ *
+ * @param[in] p_counter Pointer to the descriptor of the counter.
+ * @param[in] p_context User context.
+ */
+typedef void (* nrfx_perf_counters_dump_handler_t)(nrfx_perf_counter_t const * p_counter,
+                                                   void *                      p_context);
+
+/** @brief Name of the linker section holding the descriptors. */
+#define NRFX_PERF_COUNTERS_SECTION_NAME "nrfx_perf_counters"
+
+#if NRFX_CHECK(NRFX_PERF_COUNTERS_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Macro for defining a counter descriptor in the registry section.
+ *
+ * @param[in] _id       Identifier of the descriptor, unique in the translation unit.
+ * @param[in] _name     Name of the counter, as a string literal.
+ * @param[in] _p_values Address of the first value.
+ * @param[in] _length   Number of values.
+ * @param[in] _type     Type of the values, as @ref nrfx_perf_counter_type_t.
+ *
+ * The alignment is fixed to the natural one, as the compiler may otherwise pad the descriptors
+ * and the section could not be walked as an array.
+ */
+#define NRFX_PERF_COUNTER_DESCRIPTOR_DEF(_id, _name, _p_values, _length, _type) \
+    static nrfx_perf_counter_t const NRFX_CONCAT_2(m_nrfx_perf_counter_, _id)  \
+        __attribute__((used,                                                    \
+                       section(NRFX_PERF_COUNTERS_SECTION_NAME),                \
+                       aligned(__alignof__(nrfx_perf_counter_t)))) =            \
+    {                                                                           \
+        .p_name   = (_name),                                                    \
+        .p_values = (_p_values),                                                \
+        .length   = (_length),                                                  \
+        .type     = (_type),                                                    \
+    }
+#else
+#define NRFX_PERF_COUNTER_DESCRIPTOR_DEF(_id, _name, _p_values, _length, _type) \
+    extern nrfx_perf_counter_t const NRFX_CONCAT_2(m_nrfx_perf_counter_, _id)
+#endif
+
+/**
+ * @brief Macro for registering a counter.
+ *
+ * @param[in] _id    Identifier of the registration, unique in the translation unit.
+ * @param[in] _name  Name of the counter, as a string literal.
+ * @param[in] _value Variable of @c uint32_t type holding the counter.
+ */
+#define NRFX_PERF_COUNTER_REGISTER(_id, _name, _value) \
+    NRFX_PERF_COUNTER_DESCRIPTOR_DEF(_id, _name, &(_value), 1, NRFX_PERF_COUNTER_TYPE_COUNTER)
+
+/**
+ * @brief Macro for registering a histogram.
+ *
+ * @param[in] _id   Identifier of the registration, unique in the translation unit.
+ * @param[in] _name Name of the histogram, as a string literal.
+ * @param[in] _bins Array of @c uint32_t type holding the bins of the histogram.
+ */
+#define NRFX_PERF_HISTOGRAM_REGISTER(_id, _name, _bins)      \
+    NRFX_PERF_COUNTER_DESCRIPTOR_DEF(_id,                    \
+                                     _name,                  \
+                                     &(_bins)[0],            \
+                                     NRFX_ARRAY_SIZE(_bins), \
+                                     NRFX_PERF_COUNTER_TYPE_HISTOGRAM)
+
+/**
+ * @brief Function for getting the number of registered counters.
+ *
+ * @return Number of registered counters.
+ */
+size_t nrfx_perf_counters_count(void);
+
+/**
+ * @brief Function for getting the descriptor of a registered counter.
+ *
+ * The order of the counters is fixed for the given image.
+ *
+ * @param[in] index Index of the counter, lower than the value returned by
+ *                  @ref nrfx_perf_counters_count.
+ *
+ * @return Pointer to the descriptor or NULL if @p index is out of range.
+ */
+nrfx_perf_counter_t const * nrfx_perf_counter_get(size_t index);
+
+/**
+ * @brief Function for reading the values of a registered counter.
+ *
+ * The values are copied in a critical section, so the bins of a histogram are consistent
+ * with each other as long as they are updated in interrupt context.
+ *
+ * @param[in]  p_counter  Pointer to the descriptor of the counter.
+ * @param[out] p_values   Buffer to be filled with the values.
+ * @param[in]  max_length Size of the @p p_values buffer, in values.
+ *
+ * @return Number of values copied, which is the smaller of the length of the counter
+ *         and @p max_length.
+ */
+size_t nrfx_perf_counter_read(nrfx_perf_counter_t const * p_counter,
+                              uint32_t *                  p_values,
+                              size_t                      max_length);
+
+/**
+ * @brief Function for passing all registered counters to the specified handler.
+ *
+ * @param[in] handler   Handler called for every registered counter.
+ * @param[in] p_context User context passed to the handler.
+ */
+void nrfx_perf_counters_dump(nrfx_perf_counters_dump_handler_t handler, void * p_context);
+
+#if defined(__NRFX_DOXYGEN__)
+/** @brief Expression giving the address of the first descriptor in the registry section. */
+#define NRFX_PERF_COUNTERS_SECTION_START
+
+/** @brief Expression giving the address past the last descriptor in the registry section. */
+#define NRFX_PERF_COUNTERS_SECTION_END
+#endif
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_PERF_COUNTERS_H__
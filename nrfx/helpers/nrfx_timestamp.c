@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_TIMER_ENABLED)
+
+#include <helpers/nrfx_timestamp.h>
+#include <helpers/nrfx_gppi.h>
+#include <helpers/nrfx_flag32_allocator.h>
+
+/* Capture/compare channel counting overflows, placed last. */
+#define OVERFLOW_CC(p_timer) ((nrf_timer_cc_channel_t)((p_timer)->cc_channel_count - 1))
+
+/* Capture/compare channel used for reading the current time. */
+#define READ_CC(p_timer) ((nrf_timer_cc_channel_t)((p_timer)->cc_channel_count - 2))
+
+/* Control block of the timestamp service. */
+typedef struct
+{
+    nrfx_timer_t          timer;
+    /* Upper word of the time, incremented on each overflow. */
+    volatile uint32_t     overflows;
+    /* Incremented by each reader, to detect readers that preempted another one. */
+    nrfx_atomic_t         read_seq;
+    /* Mask of available timestamp channels. */
+    nrfx_atomic_t         available_channels;
+    uint32_t              eeps[NRF_TIMER_CC_COUNT_MAX];
+    uint8_t               ppi_channels[NRF_TIMER_CC_COUNT_MAX];
+    nrfx_drv_state_t      state;
+} timestamp_cb_t;
+
+static timestamp_cb_t m_cb;
+
+static void timestamp_timer_handler(nrf_timer_event_t event_type, void * p_context)
+{
+    (void)p_context;
+
+    if (event_type == nrf_timer_compare_event_get(OVERFLOW_CC(&m_cb.timer)))
+    {
+        m_cb.overflows++;
+    }
+}
+
+nrfx_err_t nrfx_timestamp_init(nrfx_timer_t const * p_timer, uint8_t irq_priority)
+{
+    nrfx_err_t err_code;
+
+    if (m_cb.state != NRFX_DRV_STATE_UNINITIALIZED)
+    {
+        return NRFX_ERROR_INVALID_STATE;
+    }
+    if (p_timer->cc_channel_count <= NRFX_TIMESTAMP_RESERVED_CC_COUNT)
+    {
+        return NRFX_ERROR_INVALID_PARAM;
+    }
+
+    nrfx_timer_config_t config = NRFX_TIMER_DEFAULT_CONFIG(NRFX_MHZ_TO_HZ(1));
+    config.bit_width          = NRF_TIMER_BIT_WIDTH_32;
+    config.interrupt_priority = irq_priority;
+
+    err_code = nrfx_timer_init(p_timer, &config, timestamp_timer_handler);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    m_cb.timer     = *p_timer;
+    m_cb.overflows = 0;
+    m_cb.read_seq  = 0;
+    nrfx_flag32_init(&m_cb.available_channels,
+                     NRFX_BIT_MASK((p_timer->cc_channel_count - NRFX_TIMESTAMP_RESERVED_CC_COUNT)));
+
+    /* The counter reaches 0 again only when it wraps around. */
+    nrfx_timer_compare(&m_cb.timer, OVERFLOW_CC(&m_cb.timer), 0, true);
+    nrfx_timer_enable(&m_cb.timer);
+
+    m_cb.state = NRFX_DRV_STATE_INITIALIZED;
+    return NRFX_SUCCESS;
+}
+
+void nrfx_timestamp_uninit(void)
+{
+    NRFX_ASSERT(m_cb.state != NRFX_DRV_STATE_UNINITIALIZED);
+
+    for (uint8_t ch = 0; ch < m_cb.timer.cc_channel_count - NRFX_TIMESTAMP_RESERVED_CC_COUNT; ch++)
+    {
+        (void)nrfx_timestamp_channel_free(ch);
+    }
+    nrfx_timer_uninit(&m_cb.timer);
+    m_cb.state = NRFX_DRV_STATE_UNINITIALIZED;
+}
+
+uint64_t nrfx_timestamp_get(void)
+{
+    NRFX_ASSERT(m_cb.state != NRFX_DRV_STATE_UNINITIALIZED);
+
+    uint32_t seq;
+    uint32_t overflows;
+    uint32_t hi;
+    uint32_t lo;
+
+    do {
+        seq       = NRFX_ATOMIC_FETCH_ADD(&m_cb.read_seq, 1) + 1;
+        overflows = m_cb.overflows;
+        lo        = nrfx_timer_capture(&m_cb.timer, READ_CC(&m_cb.timer));
+        hi        = overflows;
+
+        /* The counter has wrapped, but the interrupt did not count it yet. */
+        if (nrf_timer_event_check(m_cb.timer.p_reg,
+                                  nrf_timer_compare_event_get(OVERFLOW_CC(&m_cb.timer))) &&
+            (lo < (UINT32_MAX / 2)))
+        {
+            hi++;
+        }
+        /* Retry if the overflow was counted meanwhile or another reader
+         * overwrote the captured value. */
+    } while ((overflows != m_cb.overflows) || (seq != m_cb.read_seq));
+
+    return ((uint64_t)hi << 32) | lo;
+}
+
+nrfx_err_t nrfx_timestamp_channel_alloc(uint32_t eep, uint8_t * p_channel)
+{
+    NRFX_ASSERT(m_cb.state != NRFX_DRV_STATE_UNINITIALIZED);
+    NRFX_ASSERT(eep);
+
+    uint8_t ch;
+
+    if (nrfx_flag32_alloc(&m_cb.available_channels, &ch) != NRFX_SUCCESS)
+    {
+        return NRFX_ERROR_NO_MEM;
+    }
+    if (nrfx_gppi_channel_alloc(&m_cb.ppi_channels[ch]) != NRFX_SUCCESS)
+    {
+        (void)nrfx_flag32_free(&m_cb.available_channels, ch);
+        return NRFX_ERROR_NO_MEM;
+    }
+
+    m_cb.eeps[ch] = eep;
+    nrfx_gppi_channel_endpoints_setup(m_cb.ppi_channels[ch],
+        eep,
+        nrfx_timer_capture_task_address_get(&m_cb.timer, (nrf_timer_cc_channel_t)ch));
+    nrfx_gppi_channels_enable(NRFX_BIT(m_cb.ppi_channels[ch]));
+
+    *p_channel = ch;
+    return NRFX_SUCCESS;
+}
+
+nrfx_err_t nrfx_timestamp_task_channel_alloc(uint8_t * p_channel, uint32_t * p_tep)
+{
+    NRFX_ASSERT(m_cb.state != NRFX_DRV_STATE_UNINITIALIZED);
+
+    uint8_t ch;
+
+    if (nrfx_flag32_alloc(&m_cb.available_channels, &ch) != NRFX_SUCCESS)
+    {
+        return NRFX_ERROR_NO_MEM;
+    }
+
+    /* No event address marks a channel connected by the user. */
+    m_cb.eeps[ch] = 0;
+
+    *p_channel = ch;
+    *p_tep     = nrfx_timer_capture_task_address_get(&m_cb.timer, (nrf_timer_cc_channel_t)ch);
+    return NRFX_SUCCESS;
+}
+
+nrfx_err_t nrfx_timestamp_channel_free(uint8_t channel)
+{
+    if ((channel >= m_cb.timer.cc_channel_count - NRFX_TIMESTAMP_RESERVED_CC_COUNT) ||
+        !nrfx_flag32_is_allocated(m_cb.available_channels, channel))
+    {
+        return NRFX_ERROR_INVALID_PARAM;
+    }
+
+    if (m_cb.eeps[channel])
+    {
+        uint8_t ppi_channel = m_cb.ppi_channels[channel];
+
+        nrfx_gppi_channels_disable(NRFX_BIT(ppi_channel));
+        nrfx_gppi_channel_endpoints_clear(ppi_channel,
+            m_cb.eeps[channel],
+            nrfx_timer_capture_task_address_get(&m_cb.timer, (nrf_timer_cc_channel_t)channel));
+        (void)nrfx_gppi_channel_free(ppi_channel);
+    }
+
+    return nrfx_flag32_free(&m_cb.available_channels, channel);
+}
+
+uint64_t nrfx_timestamp_channel_get(uint8_t channel)
+{
+    uint32_t captured = nrfx_timer_capture_get(&m_cb.timer, (nrf_timer_cc_channel_t)channel);
+    uint64_t now      = nrfx_timestamp_get();
+    uint32_t hi       = (uint32_t)(now >> 32);
+
+    /* The event happened before the last overflow. */
+    if (captured > (uint32_t)now)
+    {
+        hi--;
+    }
+    return ((uint64_t)hi << 32) | captured;
+}
+
+#endif // NRFX_CHECK(NRFX_TIMER_ENABLED)
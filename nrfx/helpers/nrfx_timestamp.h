@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_TIMESTAMP_H__
+#define NRFX_TIMESTAMP_H__
+
+#include <nrfx_timer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_timestamp Timestamp service
+ * @{
+ * @ingroup nrfx
+ *
+ * @brief Shared 64-bit microsecond time base built on one TIMER instance.
+ *
+ * The TIMER runs freely at 1 MHz with 32-bit width, and overflows are counted
+ * in its interrupt to extend the time to 64 bits. Two capture/compare channels are
+ * used by the service, one for counting overflows and one for reading the time.
+ * The remaining channels are handed out as timestamp channels, each capturing
+ * the time of an event connected through a (D)PPI channel, so that several
+ * peripherals share one TIMER instance and one time base.
+ *
+ * The service uses the TIMER driver for the selected instance, which must be enabled.
+ */
+
+/** @brief Number of capture/compare channels used by the service. */
+#define NRFX_TIMESTAMP_RESERVED_CC_COUNT 2
+
+/**
+ * @brief Function for initializing the timestamp service and starting the time base.
+ *
+ * @param[in] p_timer      Pointer to the TIMER driver instance to be used.
+ * @param[in] irq_priority Interrupt priority of the TIMER instance.
+ *
+ * @retval NRFX_SUCCESS             The service is initialized.
+ * @retval NRFX_ERROR_INVALID_STATE The service or the TIMER instance is already initialized.
+ * @retval NRFX_ERROR_INVALID_PARAM The TIMER instance cannot run at 1 MHz or has too few
+ *                                  capture/compare channels.
+ */
+nrfx_err_t nrfx_timestamp_init(nrfx_timer_t const * p_timer, uint8_t irq_priority);
+
+/**
+ * @brief Function for uninitializing the timestamp service.
+ *
+ * All timestamp channels are freed.
+ */
+void nrfx_timestamp_uninit(void);
+
+/**
+ * @brief Function for reading the current time.
+ *
+ * The function does not use locks and can be called from thread context and from
+ * interrupts that preempt another reader. Interrupts with a priority higher than
+ * the TIMER interrupt may read a time that misses an overflow being counted.
+ *
+ * @return Time in microseconds since the service was initialized.
+ */
+uint64_t nrfx_timestamp_get(void);
+
+/**
+ * @brief Function for allocating a timestamp channel capturing the time of an event.
+ *
+ * @param[in]  eep       Address of the event.
+ * @param[out] p_channel Pointer to the allocated timestamp channel.
+ *
+ * @retval NRFX_SUCCESS      The channel is allocated and connected to the event.
+ * @retval NRFX_ERROR_NO_MEM There is no capture/compare channel or (D)PPI channel available.
+ */
+nrfx_err_t nrfx_timestamp_channel_alloc(uint32_t eep, uint8_t * p_channel);
+
+/**
+ * @brief Function for allocating a timestamp channel to be connected by the caller.
+ *
+ * Unlike @ref nrfx_timestamp_channel_alloc, no (D)PPI channel is allocated. The caller
+ * connects the returned capture task, typically as a fork of a (D)PPI channel that already
+ * carries the event. This is needed on DPPI, where an event is published on one channel only.
+ *
+ * @param[out] p_channel Pointer to the allocated timestamp channel.
+ * @param[out] p_tep     Pointer to the address of the capture task of the channel.
+ *
+ * @retval NRFX_SUCCESS      The channel is allocated.
+ * @retval NRFX_ERROR_NO_MEM There is no capture/compare channel available.
+ */
+nrfx_err_t nrfx_timestamp_task_channel_alloc(uint8_t * p_channel, uint32_t * p_tep);
+
+/**
+ * @brief Function for freeing a timestamp channel.
+ *
+ * @param[in] channel Timestamp channel.
+ *
+ * @retval NRFX_SUCCESS             The channel is freed.
+ * @retval NRFX_ERROR_INVALID_PARAM The channel is not allocated.
+ */
+nrfx_err_t nrfx_timestamp_channel_free(uint8_t channel);
+
+/**
+ * @brief Function for getting the time of the last event captured by a timestamp channel.
+ *
+ * The captured value is extended with the current overflow count, so the function
+ * must be called within 2^32 microseconds (about 71 minutes) from the event.
+ *
+ * @param[in] channel Timestamp channel.
+ *
+ * @return Time of the event in microseconds since the service was initialized.
+ */
+uint64_t nrfx_timestamp_channel_get(uint8_t channel);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_TIMESTAMP_H__
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_TIMER_ENABLED) && NRFX_CHECK(NRFX_GPIOTE_ENABLED)
+
+#include <helpers/nrfx_waveform.h>
+#include <helpers/nrfx_gppi.h>
+
+static uint32_t event_task_address_get(nrfx_gpiote_pin_t pin, nrfx_waveform_action_t action)
+{
+    switch (action)
+    {
+#if defined(GPIOTE_FEATURE_SET_PRESENT)
+        case NRFX_WAVEFORM_ACTION_SET:
+            return nrfx_gpiote_set_task_address_get(pin);
+#endif
+#if defined(GPIOTE_FEATURE_CLR_PRESENT)
+        case NRFX_WAVEFORM_ACTION_CLEAR:
+            return nrfx_gpiote_clr_task_address_get(pin);
+#endif
+        case NRFX_WAVEFORM_ACTION_TOGGLE:
+            return nrfx_gpiote_out_task_address_get(pin);
+
+        default:
+            return 0;
+    }
+}
+
+static nrfx_err_t pin_add(nrfx_waveform_t * p_waveform, nrfx_gpiote_pin_t pin)
+{
+    for (uint8_t i = 0; i < p_waveform->pin_count; i++)
+    {
+        if (p_waveform->pins[i] == pin)
+        {
+            return NRFX_SUCCESS;
+        }
+    }
+
+    uint8_t channel;
+    if (nrfx_gpiote_channel_alloc(&channel) != NRFX_SUCCESS)
+    {
+        return NRFX_ERROR_NO_MEM;
+    }
+
+    static const nrfx_gpiote_output_config_t output_config = NRFX_GPIOTE_DEFAULT_OUTPUT_CONFIG;
+    nrfx_gpiote_task_config_t task_config = {
+        .task_ch  = channel,
+        .polarity = NRF_GPIOTE_POLARITY_TOGGLE,
+        .init_val = NRF_GPIOTE_INITIAL_VALUE_LOW,
+    };
+    nrfx_err_t err_code = nrfx_gpiote_output_configure(pin, &output_config, &task_config);
+    if (err_code != NRFX_SUCCESS)
+    {
+        (void)nrfx_gpiote_channel_free(channel);
+        return err_code;
+    }
+    nrfx_gpiote_out_task_enable(pin);
+
+    p_waveform->pins[p_waveform->pin_count]            = pin;
+    p_waveform->gpiote_channels[p_waveform->pin_count] = channel;
+    p_waveform->pin_count++;
+
+    return NRFX_SUCCESS;
+}
+
+static void waveform_release(nrfx_waveform_t * p_waveform)
+{
+    for (uint8_t i = 0; i < p_waveform->event_count; i++)
+    {
+        nrfx_gppi_channels_disable(NRFX_BIT(p_waveform->ppi_channels[i]));
+        nrfx_gppi_channel_endpoints_clear(p_waveform->ppi_channels[i],
+            nrfx_timer_compare_event_address_get(&p_waveform->timer, i),
+            p_waveform->teps[i]);
+        (void)nrfx_gppi_channel_free(p_waveform->ppi_channels[i]);
+    }
+    p_waveform->event_count = 0;
+
+    for (uint8_t i = 0; i < p_waveform->pin_count; i++)
+    {
+        nrfx_gpiote_out_task_disable(p_waveform->pins[i]);
+        (void)nrfx_gpiote_pin_uninit(p_waveform->pins[i]);
+        (void)nrfx_gpiote_channel_free(p_waveform->gpiote_channels[i]);
+    }
+    p_waveform->pin_count = 0;
+
+    nrfx_timer_uninit(&p_waveform->timer);
+}
+
+nrfx_err_t nrfx_waveform_init(nrfx_waveform_t *              p_waveform,
+                              nrfx_waveform_config_t const * p_config)
+{
+    NRFX_ASSERT(p_waveform);
+    NRFX_ASSERT(p_config);
+    NRFX_ASSERT(p_config->p_events || !p_config->event_count);
+
+    /* The last capture/compare channel defines the period. */
+    if ((p_config->event_count > NRFX_WAVEFORM_EVENT_MAX) ||
+        (p_config->event_count >= p_config->timer.cc_channel_count))
+    {
+        return NRFX_ERROR_INVALID_PARAM;
+    }
+
+    nrfx_timer_config_t config = NRFX_TIMER_DEFAULT_CONFIG(p_config->frequency);
+    config.bit_width = NRF_TIMER_BIT_WIDTH_32;
+
+    nrfx_err_t err_code = nrfx_timer_init(&p_config->timer, &config, NULL);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    p_waveform->timer       = p_config->timer;
+    p_waveform->pin_count   = 0;
+    p_waveform->event_count = 0;
+
+    uint32_t ppi_mask = 0;
+    for (uint8_t i = 0; i < p_config->event_count; i++)
+    {
+        nrfx_waveform_event_t const * p_event = &p_config->p_events[i];
+        NRFX_ASSERT((p_event->time > 0) && (p_event->time < p_config->period));
+
+        err_code = pin_add(p_waveform, p_event->pin);
+        if (err_code != NRFX_SUCCESS)
+        {
+            waveform_release(p_waveform);
+            return err_code;
+        }
+
+        uint32_t tep = event_task_address_get(p_event->pin, p_event->action);
+        if (!tep)
+        {
+            waveform_release(p_waveform);
+            return NRFX_ERROR_NOT_SUPPORTED;
+        }
+
+        if (nrfx_gppi_channel_alloc(&p_waveform->ppi_channels[i]) != NRFX_SUCCESS)
+        {
+            waveform_release(p_waveform);
+            return NRFX_ERROR_NO_MEM;
+        }
+
+        p_waveform->teps[i] = tep;
+        p_waveform->event_count++;
+
+        nrfx_timer_compare(&p_waveform->timer, (nrf_timer_cc_channel_t)i, p_event->time, false);
+        nrfx_gppi_channel_endpoints_setup(p_waveform->ppi_channels[i],
+            nrfx_timer_compare_event_address_get(&p_waveform->timer, i),
+            tep);
+        ppi_mask |= NRFX_BIT(p_waveform->ppi_channels[i]);
+    }
+
+    uint8_t period_channel = (uint8_t)(p_waveform->timer.cc_channel_count - 1);
+    uint32_t shorts = nrf_timer_short_compare_clear_get(period_channel);
+    if (!p_config->repeat)
+    {
+        shorts |= nrf_timer_short_compare_stop_get(period_channel);
+    }
+    nrfx_timer_extended_compare(&p_waveform->timer,
+                                (nrf_timer_cc_channel_t)period_channel,
+                                p_config->period,
+                                (nrf_timer_short_mask_t)shorts,
+                                false);
+
+    nrfx_gppi_channels_enable(ppi_mask);
+
+    return NRFX_SUCCESS;
+}
+
+void nrfx_waveform_uninit(nrfx_waveform_t * p_waveform)
+{
+    NRFX_ASSERT(p_waveform);
+
+    nrfx_waveform_stop(p_waveform);
+    waveform_release(p_waveform);
+}
+
+void nrfx_waveform_start(nrfx_waveform_t * p_waveform)
+{
+    NRFX_ASSERT(p_waveform);
+
+    nrfx_timer_pause(&p_waveform->timer);
+    nrfx_timer_clear(&p_waveform->timer);
+    nrfx_timer_resume(&p_waveform->timer);
+}
+
+void nrfx_waveform_stop(nrfx_waveform_t * p_waveform)
+{
+    NRFX_ASSERT(p_waveform);
+
+    nrfx_timer_pause(&p_waveform->timer);
+    nrfx_timer_clear(&p_waveform->timer);
+}
+
+uint32_t nrfx_waveform_start_task_address_get(nrfx_waveform_t const * p_waveform)
+{
+    NRFX_ASSERT(p_waveform);
+
+    return nrfx_timer_task_address_get(&p_waveform->timer, NRF_TIMER_TASK_START);
+}
+
+#endif // NRFX_CHECK(NRFX_TIMER_ENABLED) && NRFX_CHECK(NRFX_GPIOTE_ENABLED)
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_WAVEFORM_H__
+#define NRFX_WAVEFORM_H__
+
+#include <nrfx_timer.h>
+#include <nrfx_gpiote.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_waveform Waveform generator
+ * @{
+ * @ingroup nrfx
+ *
+ * @brief Generation of GPIO waveforms in hardware with a TIMER and GPIOTE tasks.
+ *
+ * Each event of the waveform is assigned one capture/compare channel of a TIMER instance,
+ * whose COMPARE event is connected through a (D)PPI channel to the SET, CLR or OUT task
+ * of the GPIOTE channel of the given pin. The last capture/compare channel of the TIMER
+ * defines the period of the waveform and clears or stops the TIMER through a shortcut,
+ * so that the waveform runs without any interrupts.
+ *
+ * The number of events is limited by the number of capture/compare channels of the TIMER
+ * instance minus one. Longer waveforms repeating with a regular pattern are best split into
+ * such periods, while arbitrary long sequences on a single pin should use PWM instead.
+ *
+ * The waveform generator uses the TIMER driver for the selected instance, which must be
+ * enabled, and the GPIOTE driver, which must be initialized by the user.
+ */
+
+/** @brief Maximum number of events in a waveform. */
+#define NRFX_WAVEFORM_EVENT_MAX 5
+
+/** @brief Actions performed on a pin. */
+typedef enum
+{
+    NRFX_WAVEFORM_ACTION_SET,    ///< Drive the pin high.
+    NRFX_WAVEFORM_ACTION_CLEAR,  ///< Drive the pin low.
+    NRFX_WAVEFORM_ACTION_TOGGLE, ///< Toggle the pin.
+} nrfx_waveform_action_t;
+
+/** @brief Waveform event. */
+typedef struct
+{
+    uint32_t               time;   ///< Time of the event in TIMER ticks, from 1 to period - 1.
+    nrfx_gpiote_pin_t      pin;    ///< Pin to be driven.
+    nrfx_waveform_action_t action; ///< Action performed on the pin.
+} nrfx_waveform_event_t;
+
+/** @brief Waveform generator configuration. */
+typedef struct
+{
+    nrfx_timer_t                  timer;       ///< TIMER instance used exclusively for the waveform.
+    uint32_t                      frequency;   ///< TIMER frequency in Hz.
+    uint32_t                      period;      ///< Period of the waveform in TIMER ticks.
+    nrfx_waveform_event_t const * p_events;    ///< Events of the waveform.
+    uint8_t                       event_count; ///< Number of events.
+    bool                          repeat;      ///< True to repeat the waveform, false to stop after one period.
+} nrfx_waveform_config_t;
+
+/** @brief Waveform generator instance. Its content is handled by the helper. */
+typedef struct
+{
+    nrfx_timer_t      timer;                                    ///< TIMER instance.
+    nrfx_gpiote_pin_t pins[NRFX_WAVEFORM_EVENT_MAX];            ///< Pins driven by the waveform.
+    uint8_t           gpiote_channels[NRFX_WAVEFORM_EVENT_MAX]; ///< GPIOTE channels of the pins.
+    uint32_t          teps[NRFX_WAVEFORM_EVENT_MAX];            ///< GPIOTE tasks of the events.
+    uint8_t           ppi_channels[NRFX_WAVEFORM_EVENT_MAX];    ///< (D)PPI channels of the events.
+    uint8_t           pin_count;                                ///< Number of pins.
+    uint8_t           event_count;                              ///< Number of events.
+} nrfx_waveform_t;
+
+/**
+ * @brief Function for initializing a waveform generator.
+ *
+ * Pins are configured as outputs driven low. The waveform is started with
+ * @ref nrfx_waveform_start.
+ *
+ * @param[out] p_waveform Pointer to the waveform generator instance.
+ * @param[in]  p_config   Pointer to the configuration.
+ *
+ * @retval NRFX_SUCCESS             The waveform generator is initialized.
+ * @retval NRFX_ERROR_INVALID_PARAM There are too many events for the TIMER instance.
+ * @retval NRFX_ERROR_NOT_SUPPORTED The action is not supported by GPIOTE.
+ * @retval NRFX_ERROR_INVALID_STATE The TIMER instance is already initialized.
+ * @retval NRFX_ERROR_NO_MEM        There is no (D)PPI channel or GPIOTE channel available.
+ */
+nrfx_err_t nrfx_waveform_init(nrfx_waveform_t *              p_waveform,
+                              nrfx_waveform_config_t const * p_config);
+
+/**
+ * @brief Function for uninitializing a waveform generator.
+ *
+ * The waveform is stopped and the pins are restored to the default configuration.
+ *
+ * @param[in] p_waveform Pointer to the waveform generator instance.
+ */
+void nrfx_waveform_uninit(nrfx_waveform_t * p_waveform);
+
+/**
+ * @brief Function for starting the waveform from the beginning of the period.
+ *
+ * @param[in] p_waveform Pointer to the waveform generator instance.
+ */
+void nrfx_waveform_start(nrfx_waveform_t * p_waveform);
+
+/**
+ * @brief Function for stopping the waveform.
+ *
+ * The pins keep their current state.
+ *
+ * @param[in] p_waveform Pointer to the waveform generator instance.
+ */
+void nrfx_waveform_stop(nrfx_waveform_t * p_waveform);
+
+/**
+ * @brief Function for getting the address of the task starting the waveform.
+ *
+ * The task can be triggered through (D)PPI to start the waveform in sync with another event.
+ * The waveform starts from the current value of the TIMER, which is the beginning of the
+ * period after initialization or after a single period has elapsed.
+ *
+ * @param[in] p_waveform Pointer to the waveform generator instance.
+ *
+ * @return Address of the START task of the TIMER instance.
+ */
+uint32_t nrfx_waveform_start_task_address_get(nrfx_waveform_t const * p_waveform);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_WAVEFORM_H__
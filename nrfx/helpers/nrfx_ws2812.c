@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_PWM_ENABLED)
+
+#include <helpers/nrfx_ws2812.h>
+
+/* One bit lasts 1.25 us, 20 cycles of the 16 MHz clock. */
+#define WS2812_TOP_VALUE 20
+
+/* Duration of a buffer playback in microseconds. */
+#define WS2812_BUFFER_US (NRFX_WS2812_BUFFER_BYTES * 8 * 5 / 4)
+
+/* With the falling edge polarity (bit 15 set) the output is high until the compare value.
+ * A 0 is high for 0.375 us and a 1 for 0.8125 us. The reset value keeps the output low. */
+#define WS2812_VALUE_0     (0x8000 | 6)
+#define WS2812_VALUE_1     (0x8000 | 13)
+#define WS2812_VALUE_RESET (0x8000 | 0)
+
+static void ws2812_buffer_fill(nrfx_ws2812_t * p_strip, uint8_t seq_id)
+{
+    nrf_pwm_values_common_t * p_value = p_strip->buffers[seq_id];
+    size_t                    count   = NRFX_MIN(p_strip->size, NRFX_WS2812_BUFFER_BYTES);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        uint8_t byte = p_strip->p_data[i];
+
+        for (uint8_t mask = 0x80; mask; mask >>= 1)
+        {
+            *p_value++ = (byte & mask) ? WS2812_VALUE_1 : WS2812_VALUE_0;
+        }
+    }
+
+    // The rest of the buffer keeps the line low, which latches the frame.
+    for (size_t i = count * 8; i < NRFX_ARRAY_SIZE(p_strip->buffers[seq_id]); i++)
+    {
+        *p_value++ = WS2812_VALUE_RESET;
+    }
+
+    p_strip->p_data += count;
+    p_strip->size   -= count;
+}
+
+static void ws2812_pwm_handler(nrfx_pwm_evt_type_t event_type, void * p_context)
+{
+    nrfx_ws2812_t * p_strip = (nrfx_ws2812_t *)p_context;
+
+    switch (event_type)
+    {
+        case NRFX_PWM_EVT_END_SEQ0:
+            ws2812_buffer_fill(p_strip, 0);
+            break;
+
+        case NRFX_PWM_EVT_END_SEQ1:
+            ws2812_buffer_fill(p_strip, 1);
+            break;
+
+        case NRFX_PWM_EVT_STOPPED:
+            p_strip->busy = false;
+            if (p_strip->handler)
+            {
+                p_strip->handler(p_strip->p_context);
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+nrfx_err_t nrfx_ws2812_init(nrfx_ws2812_t *              p_strip,
+                            nrfx_ws2812_config_t const * p_config,
+                            nrfx_ws2812_handler_t        handler,
+                            void *                       p_context)
+{
+    NRFX_ASSERT(p_strip);
+    NRFX_ASSERT(p_config);
+    NRFX_ASSERT(nrfx_is_in_ram(p_strip));
+    NRFX_ASSERT(p_config->reset_us >= 50);
+
+    nrfx_pwm_config_t config = NRFX_PWM_DEFAULT_CONFIG(p_config->pin,
+                                                       NRF_PWM_PIN_NOT_CONNECTED,
+                                                       NRF_PWM_PIN_NOT_CONNECTED,
+                                                       NRF_PWM_PIN_NOT_CONNECTED);
+    config.irq_priority = p_config->irq_priority;
+    config.base_clock   = NRF_PWM_CLK_16MHz;
+    config.count_mode   = NRF_PWM_MODE_UP;
+    config.top_value    = WS2812_TOP_VALUE;
+    config.load_mode    = NRF_PWM_LOAD_COMMON;
+    config.step_mode    = NRF_PWM_STEP_AUTO;
+
+    nrfx_err_t err_code = nrfx_pwm_init(&p_config->pwm, &config, ws2812_pwm_handler, p_strip);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    p_strip->pwm         = p_config->pwm;
+    p_strip->handler     = handler;
+    p_strip->p_context   = p_context;
+    p_strip->reset_plays = (uint16_t)NRFX_CEIL_DIV(p_config->reset_us, WS2812_BUFFER_US);
+    p_strip->busy        = false;
+
+    return NRFX_SUCCESS;
+}
+
+void nrfx_ws2812_uninit(nrfx_ws2812_t * p_strip)
+{
+    NRFX_ASSERT(p_strip);
+
+    nrfx_pwm_uninit(&p_strip->pwm);
+    p_strip->busy = false;
+}
+
+nrfx_err_t nrfx_ws2812_write(nrfx_ws2812_t * p_strip, uint8_t const * p_data, size_t size)
+{
+    NRFX_ASSERT(p_strip);
+    NRFX_ASSERT(p_data);
+    NRFX_ASSERT(size > 0);
+
+    if (p_strip->busy)
+    {
+        return NRFX_ERROR_BUSY;
+    }
+
+    // Both buffers are played in each loop, the last one covers at least the reset time.
+    size_t plays = NRFX_CEIL_DIV(size, NRFX_WS2812_BUFFER_BYTES) + p_strip->reset_plays;
+    size_t loops = NRFX_CEIL_DIV(plays, 2);
+    if (loops > UINT16_MAX)
+    {
+        return NRFX_ERROR_INVALID_LENGTH;
+    }
+
+    p_strip->p_data = p_data;
+    p_strip->size   = size;
+    p_strip->busy   = true;
+    ws2812_buffer_fill(p_strip, 0);
+    ws2812_buffer_fill(p_strip, 1);
+
+    nrf_pwm_sequence_t const sequences[2] = {
+        {
+            .values.p_common = p_strip->buffers[0],
+            .length          = NRFX_ARRAY_SIZE(p_strip->buffers[0]),
+            .repeats         = 0,
+            .end_delay       = 0,
+        },
+        {
+            .values.p_common = p_strip->buffers[1],
+            .length          = NRFX_ARRAY_SIZE(p_strip->buffers[1]),
+            .repeats         = 0,
+            .end_delay       = 0,
+        },
+    };
+
+    (void)nrfx_pwm_complex_playback(&p_strip->pwm, &sequences[0], &sequences[1], (uint16_t)loops,
+                                    NRFX_PWM_FLAG_STOP             |
+                                    NRFX_PWM_FLAG_SIGNAL_END_SEQ0  |
+                                    NRFX_PWM_FLAG_SIGNAL_END_SEQ1  |
+                                    NRFX_PWM_FLAG_NO_EVT_FINISHED);
+
+    return NRFX_SUCCESS;
+}
+
+bool nrfx_ws2812_busy_check(nrfx_ws2812_t const * p_strip)
+{
+    NRFX_ASSERT(p_strip);
+
+    return p_strip->busy;
+}
+
+#endif // NRFX_CHECK(NRFX_PWM_ENABLED)
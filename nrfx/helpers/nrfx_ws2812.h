@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_WS2812_H__
+#define NRFX_WS2812_H__
+
+#include <nrfx_pwm.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_ws2812 WS2812 LED strip
+ * @{
+ * @ingroup nrfx
+ *
+ * @brief Driving of WS2812 and compatible addressable LEDs with PWM.
+ *
+ * Each bit sent to the strip is one 800 kHz PWM period with the duty cycle selecting
+ * a 0 or a 1. Instead of expanding the whole frame into PWM values, which takes 48 bytes
+ * of RAM per LED, the helper expands the colour data on the fly into two small buffers.
+ * They are played alternately as the two sequences of the PWM peripheral, and each buffer
+ * is filled again from the SEQEND interrupt while the other one is played. The colour data
+ * can therefore be kept in its compact form, even in flash. The frame is finished with
+ * the line kept low for the reset time, which latches the data in the LEDs.
+ *
+ * The interrupt must be serviced within the playback time of one buffer,
+ * that is 10 us per byte of @ref NRFX_WS2812_BUFFER_BYTES.
+ *
+ * The helper uses the PWM driver for the selected instance, which must be enabled.
+ */
+
+#ifndef NRFX_WS2812_BUFFER_BYTES
+/** @brief Number of colour bytes expanded into each of the two buffers. */
+#define NRFX_WS2812_BUFFER_BYTES 12
+#endif
+
+/**
+ * @brief WS2812 event handler type, called when a frame is latched.
+ *
+ * @param[in] p_context Context passed to @ref nrfx_ws2812_init.
+ */
+typedef void (* nrfx_ws2812_handler_t)(void * p_context);
+
+/** @brief WS2812 strip configuration. */
+typedef struct
+{
+    nrfx_pwm_t pwm;          ///< PWM instance used exclusively for the strip.
+    uint32_t   pin;          ///< Pin connected to the data input of the strip.
+    uint16_t   reset_us;     ///< Low time latching the frame, in microseconds. At least 50.
+    uint8_t    irq_priority; ///< Interrupt priority.
+} nrfx_ws2812_config_t;
+
+/** @brief WS2812 strip instance. Its content is handled by the helper. */
+typedef struct
+{
+    nrfx_pwm_t              pwm;          ///< PWM instance.
+    nrfx_ws2812_handler_t   handler;      ///< Event handler.
+    void *                  p_context;    ///< Context passed to the event handler.
+    uint8_t const *         p_data;       ///< Colour data not expanded yet.
+    size_t                  size;         ///< Number of bytes not expanded yet.
+    uint16_t                reset_plays;  ///< Number of buffer playbacks covering the reset time.
+    volatile bool           busy;         ///< A frame is being sent.
+    /** Buffers of PWM values, played alternately. */
+    nrf_pwm_values_common_t buffers[2][NRFX_WS2812_BUFFER_BYTES * 8];
+} nrfx_ws2812_t;
+
+/**
+ * @brief Function for initializing a WS2812 strip.
+ *
+ * @param[out] p_strip   Pointer to the strip instance. Must be placed in Data RAM.
+ * @param[in]  p_config  Pointer to the configuration.
+ * @param[in]  handler   Event handler, reporting that a frame is latched. Can be NULL.
+ * @param[in]  p_context Context passed to the event handler.
+ *
+ * @retval NRFX_SUCCESS             The strip is initialized.
+ * @retval NRFX_ERROR_INVALID_STATE The PWM instance is already initialized.
+ * @retval NRFX_ERROR_BUSY          The PWM peripheral is already in use.
+ */
+nrfx_err_t nrfx_ws2812_init(nrfx_ws2812_t *              p_strip,
+                            nrfx_ws2812_config_t const * p_config,
+                            nrfx_ws2812_handler_t        handler,
+                            void *                       p_context);
+
+/**
+ * @brief Function for uninitializing a WS2812 strip.
+ *
+ * @param[in] p_strip Pointer to the strip instance.
+ */
+void nrfx_ws2812_uninit(nrfx_ws2812_t * p_strip);
+
+/**
+ * @brief Function for sending a frame to the strip.
+ *
+ * The bytes are sent in the given order, most significant bit first, so for WS2812
+ * each LED takes three bytes in the green, red, blue order. The data must be kept intact
+ * until the frame is latched.
+ *
+ * @param[in] p_strip Pointer to the strip instance.
+ * @param[in] p_data  Colour data.
+ * @param[in] size    Number of bytes.
+ *
+ * @retval NRFX_SUCCESS              The frame is being sent.
+ * @retval NRFX_ERROR_BUSY           The previous frame is not latched yet.
+ * @retval NRFX_ERROR_INVALID_LENGTH The frame is too long to be played in a single
+ *                                   PWM playback.
+ */
+nrfx_err_t nrfx_ws2812_write(nrfx_ws2812_t * p_strip, uint8_t const * p_data, size_t size);
+
+/**
+ * @brief Function for checking whether a frame is being sent.
+ *
+ * @param[in] p_strip Pointer to the strip instance.
+ *
+ * @retval true  The frame is being sent or it is not latched yet.
+ * @retval false The strip is ready for a new frame.
+ */
+bool nrfx_ws2812_busy_check(nrfx_ws2812_t const * p_strip);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_WS2812_H__
@@ -124,6 +124,80 @@ void SystemCoreClockUpdate(void)
     SystemCoreClock = __SYSTEM_CLOCK_DEFAULT;
 }
 
+/* Workarounds for peripherals which are not used before the application starts executing. They are
+   performed from SystemInit, or postponed to SystemPostInit if NRF_FAST_BOOT is defined. */
+static void SystemDeferredInit(void)
+{
+    #if NRF52_ERRATA_12_ENABLE_WORKAROUND
+        /* Workaround for Errata 12 "COMP: Reference ladder not correctly calibrated" found at the Errata document
+           for your device located at https://infocenter.nordicsemi.com/index.jsp */
+        if (nrf52_errata_12()){
+            *(volatile uint32_t *)0x40013540 = (*(uint32_t *)0x10000324 & 0x00001F00) >> 8;
+        }
+    #endif
+
+    #if NRF52_ERRATA_57_ENABLE_WORKAROUND
+        /* Workaround for Errata 57 "NFCT: NFC Modulation amplitude" found at the Errata document
+           for your device located at https://infocenter.nordicsemi.com/index.jsp  */
+        if (nrf52_errata_57()){
+            *(volatile uint32_t *)0x40005610 = 0x00000005;
+            *(volatile uint32_t *)0x40005688 = 0x00000001;
+            *(volatile uint32_t *)0x40005618 = 0x00000000;
+            *(volatile uint32_t *)0x40005614 = 0x0000003F;
+        }
+    #endif
+
+    #if NRF52_ERRATA_66_ENABLE_WORKAROUND
+        /* Workaround for Errata 66 "TEMP: Linearity specification not met with default settings" found at the Errata document
+           for your device located at https://infocenter.nordicsemi.com/index.jsp  */
+        if (nrf52_errata_66()){
+            NRF_TEMP->A0 = NRF_FICR->TEMP.A0;
+            NRF_TEMP->A1 = NRF_FICR->TEMP.A1;
+            NRF_TEMP->A2 = NRF_FICR->TEMP.A2;
+            NRF_TEMP->A3 = NRF_FICR->TEMP.A3;
+            NRF_TEMP->A4 = NRF_FICR->TEMP.A4;
+            NRF_TEMP->A5 = NRF_FICR->TEMP.A5;
+            NRF_TEMP->B0 = NRF_FICR->TEMP.B0;
+            NRF_TEMP->B1 = NRF_FICR->TEMP.B1;
+            NRF_TEMP->B2 = NRF_FICR->TEMP.B2;
+            NRF_TEMP->B3 = NRF_FICR->TEMP.B3;
+            NRF_TEMP->B4 = NRF_FICR->TEMP.B4;
+            NRF_TEMP->B5 = NRF_FICR->TEMP.B5;
+            NRF_TEMP->T0 = NRF_FICR->TEMP.T0;
+            NRF_TEMP->T1 = NRF_FICR->TEMP.T1;
+            NRF_TEMP->T2 = NRF_FICR->TEMP.T2;
+            NRF_TEMP->T3 = NRF_FICR->TEMP.T3;
+            NRF_TEMP->T4 = NRF_FICR->TEMP.T4;
+        }
+    #endif
+
+    #if NRF52_ERRATA_98_ENABLE_WORKAROUND
+        /* Workaround for Errata 98 "NFCT: Not able to communicate with the peer" found at the Errata document
+           for your device located at https://infocenter.nordicsemi.com/index.jsp  */
+        if (nrf52_errata_98()){
+            *(volatile uint32_t *)0x4000568Cul = 0x00038148ul;
+        }
+    #endif
+
+    #if NRF52_ERRATA_120_ENABLE_WORKAROUND
+        /* Workaround for Errata 120 "QSPI: Data read or written is corrupted" found at the Errata document
+           for your device located at https://infocenter.nordicsemi.com/index.jsp  */
+        if (nrf52_errata_120()){
+            *(volatile uint32_t *)0x40029640ul = 0x200ul;
+        }
+    #endif
+
+    #if NRF52_ERRATA_136_ENABLE_WORKAROUND
+        /* Workaround for Errata 136 "System: Bits in RESETREAS are set when they should not be" found at the Errata document
+           for your device located at https://infocenter.nordicsemi.com/index.jsp  */
+        if (nrf52_errata_136()){
+            if (NRF_POWER->RESETREAS & POWER_RESETREAS_RESETPIN_Msk){
+                NRF_POWER->RESETREAS =  ~POWER_RESETREAS_RESETPIN_Msk;
+            }
+        }
+    #endif
+}
+
 void SystemInit(void)
 {
     /* Enable SWO trace functionality. If ENABLE_SWO is not defined, SWO pin will be used as GPIO (see Product
@@ -146,14 +220,6 @@ void SystemInit(void)
         TRACEDATA3_PIN_CNF = TRACE_PIN_CONFIG;
     #endif
 
-    #if NRF52_ERRATA_12_ENABLE_WORKAROUND
-        /* Workaround for Errata 12 "COMP: Reference ladder not correctly calibrated" found at the Errata document
-           for your device located at https://infocenter.nordicsemi.com/index.jsp */
-        if (nrf52_errata_12()){
-            *(volatile uint32_t *)0x40013540 = (*(uint32_t *)0x10000324 & 0x00001F00) >> 8;
-        }
-    #endif
-
     #if NRF52_ERRATA_16_ENABLE_WORKAROUND
         /* Workaround for Errata 16 "System: RAM may be corrupt on wakeup from CPU IDLE" found at the Errata document
            for your device located at https://infocenter.nordicsemi.com/index.jsp */
@@ -196,49 +262,6 @@ void SystemInit(void)
         }
     #endif
 
-    #if NRF52_ERRATA_57_ENABLE_WORKAROUND
-        /* Workaround for Errata 57 "NFCT: NFC Modulation amplitude" found at the Errata document
-           for your device located at https://infocenter.nordicsemi.com/index.jsp  */
-        if (nrf52_errata_57()){
-            *(volatile uint32_t *)0x40005610 = 0x00000005;
-            *(volatile uint32_t *)0x40005688 = 0x00000001;
-            *(volatile uint32_t *)0x40005618 = 0x00000000;
-            *(volatile uint32_t *)0x40005614 = 0x0000003F;
-        }
-    #endif
-
-    #if NRF52_ERRATA_66_ENABLE_WORKAROUND
-        /* Workaround for Errata 66 "TEMP: Linearity specification not met with default settings" found at the Errata document
-           for your device located at https://infocenter.nordicsemi.com/index.jsp  */
-        if (nrf52_errata_66()){
-            NRF_TEMP->A0 = NRF_FICR->TEMP.A0;
-            NRF_TEMP->A1 = NRF_FICR->TEMP.A1;
-            NRF_TEMP->A2 = NRF_FICR->TEMP.A2;
-            NRF_TEMP->A3 = NRF_FICR->TEMP.A3;
-            NRF_TEMP->A4 = NRF_FICR->TEMP.A4;
-            NRF_TEMP->A5 = NRF_FICR->TEMP.A5;
-            NRF_TEMP->B0 = NRF_FICR->TEMP.B0;
-            NRF_TEMP->B1 = NRF_FICR->TEMP.B1;
-            NRF_TEMP->B2 = NRF_FICR->TEMP.B2;
-            NRF_TEMP->B3 = NRF_FICR->TEMP.B3;
-            NRF_TEMP->B4 = NRF_FICR->TEMP.B4;
-            NRF_TEMP->B5 = NRF_FICR->TEMP.B5;
-            NRF_TEMP->T0 = NRF_FICR->TEMP.T0;
-            NRF_TEMP->T1 = NRF_FICR->TEMP.T1;
-            NRF_TEMP->T2 = NRF_FICR->TEMP.T2;
-            NRF_TEMP->T3 = NRF_FICR->TEMP.T3;
-            NRF_TEMP->T4 = NRF_FICR->TEMP.T4;
-        }
-    #endif
-
-    #if NRF52_ERRATA_98_ENABLE_WORKAROUND
-        /* Workaround for Errata 98 "NFCT: Not able to communicate with the peer" found at the Errata document
-           for your device located at https://infocenter.nordicsemi.com/index.jsp  */
-        if (nrf52_errata_98()){
-            *(volatile uint32_t *)0x4000568Cul = 0x00038148ul;
-        }
-    #endif
-
     #if NRF52_ERRATA_103_ENABLE_WORKAROUND && defined(CCM_MAXPACKETSIZE_MAXPACKETSIZE_Pos)
         /* Workaround for Errata 103 "CCM: Wrong reset value of CCM MAXPACKETSIZE" found at the Errata document
            for your device located at https://infocenter.nordicsemi.com/index.jsp  */
@@ -263,24 +286,6 @@ void SystemInit(void)
         }
     #endif
 
-    #if NRF52_ERRATA_120_ENABLE_WORKAROUND
-        /* Workaround for Errata 120 "QSPI: Data read or written is corrupted" found at the Errata document
-           for your device located at https://infocenter.nordicsemi.com/index.jsp  */
-        if (nrf52_errata_120()){
-            *(volatile uint32_t *)0x40029640ul = 0x200ul;
-        }
-    #endif
-
-    #if NRF52_ERRATA_136_ENABLE_WORKAROUND
-        /* Workaround for Errata 136 "System: Bits in RESETREAS are set when they should not be" found at the Errata document
-           for your device located at https://infocenter.nordicsemi.com/index.jsp  */
-        if (nrf52_errata_136()){
-            if (NRF_POWER->RESETREAS & POWER_RESETREAS_RESETPIN_Msk){
-                NRF_POWER->RESETREAS =  ~POWER_RESETREAS_RESETPIN_Msk;
-            }
-        }
-    #endif
-
     #if NRF52_ERRATA_182_ENABLE_WORKAROUND
         /* Workaround for Errata 182 "RADIO: Fixes for anomalies #102, #106, and #107 do not take effect" found at the Errata document
            for your device located at https://infocenter.nordicsemi.com/index.jsp  */
@@ -297,6 +302,10 @@ void SystemInit(void)
         }
     #endif
 
+    #if !defined(NRF_FAST_BOOT)
+        SystemDeferredInit();
+    #endif
+
     /* Enable the FPU if the compiler used floating point unit instructions. __FPU_USED is a MACRO defined by the
      * compiler. Since the FPU consumes energy, remember to disable FPU use in the compiler if floating point unit
      * operations are not used in your code. */
@@ -362,3 +371,10 @@ void SystemInit(void)
         }
     #endif
 }
+
+void SystemPostInit(void)
+{
+    #if defined(NRF_FAST_BOOT)
+        SystemDeferredInit();
+    #endif
+}
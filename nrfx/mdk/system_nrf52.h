@@ -53,6 +53,16 @@ extern void SystemInit (void);
 extern void SystemCoreClockUpdate (void);
 
 
+/**
+  \brief  Perform the initialization deferred by SystemInit.
+   When NRF_FAST_BOOT is defined, SystemInit performs only the work required before the application
+   starts executing and the remaining errata workarounds are postponed to this function. It must be
+   called early in main, before the affected peripherals or the reset reason are accessed.
+   When NRF_FAST_BOOT is not defined, this function does nothing.
+ */
+extern void SystemPostInit (void);
+
+
 #ifdef __cplusplus
 }
 #endif
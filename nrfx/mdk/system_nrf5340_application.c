@@ -67,6 +67,58 @@ void SystemCoreClockUpdate(void)
 #endif
 }
 
+#if !defined(NRF_TRUSTZONE_NONSECURE)
+/* Workarounds and setup which are not required before the application starts executing. They are
+   performed at the end of SystemInit, or postponed to SystemPostInit if NRF_FAST_BOOT is defined. */
+static void SystemDeferredInit(void)
+{
+    /* Workaround for Errata 46 "Higher power consumption of LFRC" found at the Errata document
+       for your device located at https://infocenter.nordicsemi.com/index.jsp  */
+    if (nrf53_errata_46())
+    {
+        *((volatile uint32_t *)0x5003254Cul) = 0;
+    }
+
+    /* Workaround for Errata 49 "SLEEPENTER and SLEEPEXIT events asserted after pin reset" found at the Errata document
+       for your device located at https://infocenter.nordicsemi.com/index.jsp  */
+    if (nrf53_errata_49())
+    {
+        if (NRF_RESET_S->RESETREAS & RESET_RESETREAS_RESETPIN_Msk)
+        {
+            NRF_POWER_S->EVENTS_SLEEPENTER = 0;
+            NRF_POWER_S->EVENTS_SLEEPEXIT = 0;
+        }
+    }
+
+    /* Workaround for Errata 55 "Bits in RESETREAS are set when they should not be" found at the Errata document
+       for your device located at https://infocenter.nordicsemi.com/index.jsp  */
+    if (nrf53_errata_55())
+    {
+        if (NRF_RESET_S->RESETREAS & RESET_RESETREAS_RESETPIN_Msk){
+            NRF_RESET_S->RESETREAS = ~RESET_RESETREAS_RESETPIN_Msk;
+        }
+    }
+
+    if (nrf53_errata_140())
+    {
+        if (*(volatile uint32_t *)0x50032420 & 0x80000000)
+        {
+            /* Reset occured during calibration */
+            NRF_CLOCK_S->LFCLKSRC = CLOCK_LFCLKSRC_SRC_LFSYNT;
+            NRF_CLOCK_S->TASKS_LFCLKSTART = 1;
+            while (NRF_CLOCK_S->EVENTS_LFCLKSTARTED == 0) {}
+            NRF_CLOCK_S->EVENTS_LFCLKSTARTED = 0;
+            NRF_CLOCK_S->TASKS_LFCLKSTOP = 1;
+            NRF_CLOCK_S->LFCLKSRC = CLOCK_LFCLKSRC_SRC_LFRC;
+        }
+    }
+
+    #if !defined(NRF_SKIP_FICR_NS_COPY_TO_RAM)
+        SystemStoreFICRNS();
+    #endif
+}
+#endif
+
 void SystemInit(void)
 {
     #if !defined(NRF_TRUSTZONE_NONSECURE)
@@ -121,33 +173,6 @@ void SystemInit(void)
             NRF_CLOCK_S->HFCLKCTRL = CLOCK_HFCLKCTRL_HCLK_Div2 << CLOCK_HFCLKCTRL_HCLK_Pos;
         }
 
-        /* Workaround for Errata 46 "Higher power consumption of LFRC" found at the Errata document
-           for your device located at https://infocenter.nordicsemi.com/index.jsp  */
-        if (nrf53_errata_46())
-        {
-            *((volatile uint32_t *)0x5003254Cul) = 0;
-        }
-
-        /* Workaround for Errata 49 "SLEEPENTER and SLEEPEXIT events asserted after pin reset" found at the Errata document
-           for your device located at https://infocenter.nordicsemi.com/index.jsp  */
-        if (nrf53_errata_49())
-        {
-            if (NRF_RESET_S->RESETREAS & RESET_RESETREAS_RESETPIN_Msk)
-            {
-                NRF_POWER_S->EVENTS_SLEEPENTER = 0;
-                NRF_POWER_S->EVENTS_SLEEPEXIT = 0;
-            }
-        }
-
-        /* Workaround for Errata 55 "Bits in RESETREAS are set when they should not be" found at the Errata document
-           for your device located at https://infocenter.nordicsemi.com/index.jsp  */
-        if (nrf53_errata_55())
-        {
-            if (NRF_RESET_S->RESETREAS & RESET_RESETREAS_RESETPIN_Msk){
-                NRF_RESET_S->RESETREAS = ~RESET_RESETREAS_RESETPIN_Msk;
-            }
-        }
-
         /* Workaround for Errata 69 "VREGMAIN configuration is not retained in System OFF" found at the Errata document
            for your device located at https://infocenter.nordicsemi.com/index.jsp  */
         if (nrf53_errata_69())
@@ -155,20 +180,6 @@ void SystemInit(void)
             *((volatile uint32_t *)0x5000470Cul) =0x65ul;
         }
 
-        if (nrf53_errata_140())
-        {
-            if (*(volatile uint32_t *)0x50032420 & 0x80000000)
-            {
-                /* Reset occured during calibration */
-                NRF_CLOCK_S->LFCLKSRC = CLOCK_LFCLKSRC_SRC_LFSYNT;
-                NRF_CLOCK_S->TASKS_LFCLKSTART = 1;
-                while (NRF_CLOCK_S->EVENTS_LFCLKSTARTED == 0) {}
-                NRF_CLOCK_S->EVENTS_LFCLKSTARTED = 0;
-                NRF_CLOCK_S->TASKS_LFCLKSTOP = 1;
-                NRF_CLOCK_S->LFCLKSRC = CLOCK_LFCLKSRC_SRC_LFRC;
-            }
-        }
-
         if (nrf53_errata_160())
         {
             *((volatile uint32_t *)0x5000470C) = 0x7Eul;
@@ -182,10 +193,10 @@ void SystemInit(void)
             *((volatile uint32_t *)0x502012A0) = 0x0ul;
         }
 
-        #if !defined(NRF_SKIP_FICR_NS_COPY_TO_RAM)
-            SystemStoreFICRNS();
+        #if !defined(NRF_FAST_BOOT)
+            SystemDeferredInit();
         #endif
-        
+
         #if defined(CONFIG_NFCT_PINS_AS_GPIOS)
 
             if ((NRF_UICR_S->NFCPINS & UICR_NFCPINS_PROTECT_Msk) == (UICR_NFCPINS_PROTECT_NFC << UICR_NFCPINS_PROTECT_Pos))
@@ -276,6 +287,13 @@ void SystemInit(void)
     #endif
 }
 
+void SystemPostInit(void)
+{
+    #if defined(NRF_FAST_BOOT) && !defined(NRF_TRUSTZONE_NONSECURE)
+        SystemDeferredInit();
+    #endif
+}
+
 /* Workaround to allow NS code to access FICR. Override NRF_FICR_NS to move FICR_NS buffer. */
 #define FICR_SIZE 0x1000ul
 #define RAM_BASE 0x20000000ul
@@ -46,22 +46,10 @@ void SystemCoreClockUpdate(void)
     SystemCoreClock = __SYSTEM_CLOCK_DEFAULT;
 }
 
-void SystemInit(void)
+/* Workarounds which are not required before the application starts executing. They are performed
+   at the end of SystemInit, or postponed to SystemPostInit if NRF_FAST_BOOT is defined. */
+static void SystemDeferredInit(void)
 {
-    /* Trimming of the device. Copy all the trimming values from FICR into the target addresses. Trim
-     until one ADDR is not initialized. */
-    uint32_t index = 0;
-    for (index = 0; index < 32ul && NRF_FICR_NS->TRIMCNF[index].ADDR != 0xFFFFFFFFul; index++){
-        #if defined ( __ICCARM__ )
-            /* IAR will complain about the order of volatile pointer accesses. */
-            #pragma diag_suppress=Pa082
-        #endif
-        *((volatile uint32_t *)NRF_FICR_NS->TRIMCNF[index].ADDR) = NRF_FICR_NS->TRIMCNF[index].DATA;
-        #if defined ( __ICCARM__ )
-            #pragma diag_default=Pa082
-        #endif
-    }
-
     /* Workaround for Errata 49 "SLEEPENTER and SLEEPEXIT events asserted after pin reset" found at the Errata document
        for your device located at https://infocenter.nordicsemi.com/index.jsp  */
     if (nrf53_errata_49())
@@ -81,6 +69,23 @@ void SystemInit(void)
             NRF_RESET_NS->RESETREAS = ~RESET_RESETREAS_RESETPIN_Msk;
         }
     }
+}
+
+void SystemInit(void)
+{
+    /* Trimming of the device. Copy all the trimming values from FICR into the target addresses. Trim
+     until one ADDR is not initialized. */
+    uint32_t index = 0;
+    for (index = 0; index < 32ul && NRF_FICR_NS->TRIMCNF[index].ADDR != 0xFFFFFFFFul; index++){
+        #if defined ( __ICCARM__ )
+            /* IAR will complain about the order of volatile pointer accesses. */
+            #pragma diag_suppress=Pa082
+        #endif
+        *((volatile uint32_t *)NRF_FICR_NS->TRIMCNF[index].ADDR) = NRF_FICR_NS->TRIMCNF[index].DATA;
+        #if defined ( __ICCARM__ )
+            #pragma diag_default=Pa082
+        #endif
+    }
 
     if (nrf53_errata_160())
     {
@@ -92,8 +97,19 @@ void SystemInit(void)
         *((volatile uint32_t *)0x41101110) = 0x0ul;
     }
 
+    #if !defined(NRF_FAST_BOOT)
+        SystemDeferredInit();
+    #endif
+
     /* Handle fw-branch APPROTECT setup. */
     nrf53_handle_approtect();
 }
 
+void SystemPostInit(void)
+{
+    #if defined(NRF_FAST_BOOT)
+        SystemDeferredInit();
+    #endif
+}
+
 /*lint --flb "Leave library region" */
@@ -40,5 +40,6 @@
 #include <hal/nrf_common.h>
 #include <haly/nrfy_common.h>
 #include <drivers/nrfx_errors.h>
+#include <helpers/nrfx_irq_stats.h>
 
 #endif // NRFX_H__
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <benchmark_common.h>
+#include <soc/nrfx_cycle_counter.h>
+
+#define NRFX_LOG_MODULE                 EXAMPLE
+#define NRFX_EXAMPLE_CONFIG_LOG_ENABLED 1
+#define NRFX_EXAMPLE_CONFIG_LOG_LEVEL   3
+#include <nrfx_log.h>
+
+static void irq_stats_sum(IRQn_Type irq, nrfx_irq_stats_t const * p_stats, void * p_context)
+{
+    benchmark_t * p_bench = p_context;
+
+    if (irq == p_bench->irq)
+    {
+        p_bench->irq_count = p_stats->count;
+    }
+    p_bench->irq_cycles += p_stats->total;
+}
+
+void benchmark_start(benchmark_t * p_bench, char const * p_name, IRQn_Type irq)
+{
+    p_bench->p_name     = p_name;
+    p_bench->irq        = irq;
+    p_bench->irq_count  = 0;
+    p_bench->irq_cycles = 0;
+
+    nrfx_irq_stats_reset();
+    p_bench->start_cycles = nrfx_cycle_counter_get();
+}
+
+void benchmark_stop(benchmark_t * p_bench, uint32_t units)
+{
+    p_bench->cycles = nrfx_cycle_counter_get() - p_bench->start_cycles;
+    p_bench->units  = units;
+
+    nrfx_irq_stats_dump(irq_stats_sum, p_bench);
+}
+
+void benchmark_report(benchmark_t const * p_bench, char const * p_unit)
+{
+    uint32_t cycles_per_us = SystemCoreClock / 1000000UL;
+    uint32_t time_us       = p_bench->cycles / cycles_per_us;
+    uint32_t per_second    = time_us ?
+                             (uint32_t)(((uint64_t)p_bench->units * 1000000UL) / time_us) : 0;
+    uint32_t load_permille = p_bench->cycles ?
+                             (uint32_t)((p_bench->irq_cycles * 1000UL) / p_bench->cycles) : 0;
+
+    NRFX_LOG_INFO("%s: %u %s in %u us, %u %s/s, %u IRQs, CPU load %u.%u%%",
+                  p_bench->p_name,
+                  p_bench->units,
+                  p_unit,
+                  time_us,
+                  per_second,
+                  p_unit,
+                  p_bench->irq_count,
+                  load_permille / 10,
+                  load_permille % 10);
+}
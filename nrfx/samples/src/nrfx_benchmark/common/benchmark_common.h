@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef BENCHMARK_COMMON_H__
+#define BENCHMARK_COMMON_H__
+
+#include <nrfx.h>
+#include <helpers/nrfx_irq_stats.h>
+
+/**
+ * @defgroup nrfx_benchmark_examples_common Common benchmark module
+ * @{
+ * @ingroup nrfx_benchmark_examples
+ *
+ * @brief Module with common functionalities used in nrfx benchmark examples.
+ *
+ * Time is measured with the DWT cycle counter, so a single measurement must not exceed
+ * 2^32 CPU cycles. The number of interrupts and the CPU load are taken from
+ * @p nrfx_irq_stats. The CPU load is the share of time spent in all driver interrupt handlers.
+ */
+
+/** @brief Structure holding a single measurement. */
+typedef struct
+{
+    char const * p_name;       ///< Name of the measured case.
+    IRQn_Type    irq;          ///< Interrupt of the measured peripheral.
+    uint32_t     start_cycles; ///< Cycle counter value at the start of the measurement.
+    uint32_t     cycles;       ///< Duration of the measurement, in CPU cycles.
+    uint32_t     units;        ///< Number of bytes or samples processed.
+    uint32_t     irq_count;    ///< Number of interrupts of the measured peripheral.
+    uint64_t     irq_cycles;   ///< Cycles spent in all driver interrupt handlers.
+} benchmark_t;
+
+/**
+ * @brief Function for starting the measurement.
+ *
+ * The interrupt statistics are cleared, so measurements cannot be nested.
+ *
+ * @param[out] p_bench Pointer to the measurement structure.
+ * @param[in]  p_name  Name of the measured case.
+ * @param[in]  irq     Interrupt of the measured peripheral.
+ */
+void benchmark_start(benchmark_t * p_bench, char const * p_name, IRQn_Type irq);
+
+/**
+ * @brief Function for ending the measurement.
+ *
+ * @param[in,out] p_bench Pointer to the measurement structure.
+ * @param[in]     units   Number of bytes or samples processed during the measurement.
+ */
+void benchmark_stop(benchmark_t * p_bench, uint32_t units);
+
+/**
+ * @brief Function for logging the result of the measurement.
+ *
+ * @param[in] p_bench Pointer to the measurement structure.
+ * @param[in] p_unit  Name of the unit processed, for example "B" or "samples".
+ */
+void benchmark_report(benchmark_t const * p_bench, char const * p_unit);
+
+/** @} */
+
+#endif // BENCHMARK_COMMON_H__
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx_example.h>
+#include <nrfx_qspi.h>
+#include <benchmark_common.h>
+
+#define NRFX_LOG_MODULE                 EXAMPLE
+#define NRFX_EXAMPLE_CONFIG_LOG_ENABLED 1
+#define NRFX_EXAMPLE_CONFIG_LOG_LEVEL   3
+#include <nrfx_log.h>
+
+/**
+ * @defgroup nrfx_benchmark_qspi_example QSPI benchmark example
+ * @{
+ * @ingroup nrfx_benchmark_examples
+ *
+ * @brief Example measuring the read and write throughput of nrfx_qspi driver.
+ *
+ * @details The application uses the MX25R64 flash memory mounted on the development kit.
+ *          The memory is switched to the quad mode and the high performance mode, then
+ *          a block of @ref TRANSFER_SIZE bytes at @ref FLASH_ADDRESS is erased, written
+ *          and read back. The write measurement includes the time needed by the memory
+ *          to finish programming.
+ */
+
+/* Pins of the MX25R64 memory on the development kit. */
+#if defined(NRF53_SERIES)
+#define QSPI_SCK_PIN 17
+#define QSPI_CSN_PIN 18
+#define QSPI_IO0_PIN 13
+#define QSPI_IO1_PIN 14
+#define QSPI_IO2_PIN 15
+#define QSPI_IO3_PIN 16
+#else
+#define QSPI_SCK_PIN 19
+#define QSPI_CSN_PIN 17
+#define QSPI_IO0_PIN 20
+#define QSPI_IO1_PIN 21
+#define QSPI_IO2_PIN 22
+#define QSPI_IO3_PIN 23
+#endif
+
+/** @brief Symbol specifying the flash address used for the measurements. */
+#define FLASH_ADDRESS 0
+
+/** @brief Symbol specifying the number of bytes transferred in each measurement. */
+#define TRANSFER_SIZE 4096
+
+/** @brief Flash command for write enable. */
+#define FLASH_CMD_WREN 0x06
+
+/** @brief Flash command for writing the status and configuration registers. */
+#define FLASH_CMD_WRSR 0x01
+
+/** @brief Transmit buffer. */
+static uint8_t m_tx_buffer[TRANSFER_SIZE];
+
+/** @brief Receive buffer. */
+static uint8_t m_rx_buffer[TRANSFER_SIZE];
+
+/** @brief Flag indicating that the requested operation is finished. */
+static volatile bool m_done;
+
+/**
+ * @brief Function for handling QSPI driver events.
+ *
+ * @param[in] event     Event type.
+ * @param[in] p_context Context passed to the event handler.
+ */
+static void qspi_handler(nrfx_qspi_evt_t event, void * p_context)
+{
+    (void)p_context;
+
+    if (event == NRFX_QSPI_EVENT_DONE)
+    {
+        m_done = true;
+    }
+}
+
+/**
+ * @brief Function for waiting until the started operation is finished and
+ *        the memory is ready for the next one.
+ */
+static void operation_wait(void)
+{
+    while (!m_done)
+    {}
+
+    while (nrfx_qspi_mem_busy_check() == NRFX_ERROR_BUSY)
+    {}
+}
+
+/**
+ * @brief Function for switching the memory to the quad mode and the high performance mode.
+ */
+static void flash_configure(void)
+{
+    nrfx_err_t status;
+    (void)status;
+
+    nrf_qspi_cinstr_conf_t cinstr_cfg = NRFX_QSPI_DEFAULT_CINSTR(FLASH_CMD_WREN,
+                                                                 NRF_QSPI_CINSTR_LEN_1B);
+    status = nrfx_qspi_cinstr_xfer(&cinstr_cfg, NULL, NULL);
+    NRFX_ASSERT(status == NRFX_SUCCESS);
+
+    // Status register: quad enable. Configuration register 2: high performance mode.
+    uint8_t regs[] = { 0x40, 0x00, 0x02 };
+    cinstr_cfg.opcode = FLASH_CMD_WRSR;
+    cinstr_cfg.length = NRF_QSPI_CINSTR_LEN_4B;
+    status = nrfx_qspi_cinstr_xfer(&cinstr_cfg, regs, NULL);
+    NRFX_ASSERT(status == NRFX_SUCCESS);
+
+    while (nrfx_qspi_mem_busy_check() == NRFX_ERROR_BUSY)
+    {}
+}
+
+/**
+ * @brief Function for application main entry.
+ *
+ * @return Nothing.
+ */
+int main(void)
+{
+    nrfx_err_t status;
+    (void)status;
+
+    NRFX_EXAMPLE_LOG_INIT();
+
+    NRFX_LOG_INFO("Starting nrfx_qspi benchmark.");
+    NRFX_EXAMPLE_LOG_PROCESS();
+
+    nrfx_qspi_config_t qspi_config = NRFX_QSPI_DEFAULT_CONFIG(QSPI_SCK_PIN, QSPI_CSN_PIN,
+                                                              QSPI_IO0_PIN, QSPI_IO1_PIN,
+                                                              QSPI_IO2_PIN, QSPI_IO3_PIN);
+    qspi_config.prot_if.readoc  = NRF_QSPI_READOC_READ4IO;
+    qspi_config.prot_if.writeoc = NRF_QSPI_WRITEOC_PP4IO;
+    qspi_config.phy_if.sck_freq = NRF_QSPI_FREQ_DIV2;
+    status = nrfx_qspi_init(&qspi_config, qspi_handler, NULL);
+    NRFX_ASSERT(status == NRFX_SUCCESS);
+
+#if defined(__ZEPHYR__)
+    IRQ_DIRECT_CONNECT(NRFX_IRQ_NUMBER_GET(NRF_QSPI), IRQ_PRIO_LOWEST, nrfx_qspi_irq_handler, 0);
+#endif
+
+    flash_configure();
+
+    for (size_t i = 0; i < sizeof(m_tx_buffer); i++)
+    {
+        m_tx_buffer[i] = (uint8_t)i;
+    }
+
+    m_done = false;
+    status = nrfx_qspi_erase(NRF_QSPI_ERASE_LEN_4KB, FLASH_ADDRESS);
+    NRFX_ASSERT(status == NRFX_SUCCESS);
+    operation_wait();
+
+    benchmark_t bench;
+    benchmark_start(&bench, "QSPI write", nrfx_get_irq_number(NRF_QSPI));
+    m_done = false;
+    status = nrfx_qspi_write(m_tx_buffer, sizeof(m_tx_buffer), FLASH_ADDRESS);
+    NRFX_ASSERT(status == NRFX_SUCCESS);
+    operation_wait();
+    benchmark_stop(&bench, TRANSFER_SIZE);
+    benchmark_report(&bench, "B");
+    NRFX_EXAMPLE_LOG_PROCESS();
+
+    benchmark_start(&bench, "QSPI read", nrfx_get_irq_number(NRF_QSPI));
+    m_done = false;
+    status = nrfx_qspi_read(m_rx_buffer, sizeof(m_rx_buffer), FLASH_ADDRESS);
+    NRFX_ASSERT(status == NRFX_SUCCESS);
+    operation_wait();
+    benchmark_stop(&bench, TRANSFER_SIZE);
+    benchmark_report(&bench, "B");
+
+    if (memcmp(m_tx_buffer, m_rx_buffer, TRANSFER_SIZE) != 0)
+    {
+        NRFX_LOG_INFO("QSPI: read data does not match");
+    }
+
+    NRFX_LOG_INFO("Benchmark finished.");
+
+    while (1)
+    {
+        NRFX_EXAMPLE_LOG_PROCESS();
+    }
+}
+
+/** @} */
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx_example.h>
+#include <nrfx_saadc.h>
+#include <benchmark_common.h>
+
+#define NRFX_LOG_MODULE                 EXAMPLE
+#define NRFX_EXAMPLE_CONFIG_LOG_ENABLED 1
+#define NRFX_EXAMPLE_CONFIG_LOG_LEVEL   3
+#include <nrfx_log.h>
+
+/**
+ * @defgroup nrfx_benchmark_saadc_example SAADC benchmark example
+ * @{
+ * @ingroup nrfx_benchmark_examples
+ *
+ * @brief Example measuring continuous sampling of nrfx_saadc driver at various sample rates.
+ *
+ * @details For every sample rate from @ref m_sample_rates, the application samples a single
+ *          channel with the internal timer of SAADC into @ref BUFFER_COUNT buffers used
+ *          alternately. Sampling is finished after @ref BUFFERS_PER_MEASUREMENT buffers
+ *          are filled, by not providing the next buffer on the @p NRFX_SAADC_EVT_BUF_REQ event.
+ *
+ *          Please note that the internal timer can only be used in the non-blocking mode with
+ *          only a single input channel enabled.
+ */
+
+/** @brief Symbol specifying analog input to be observed by SAADC channel 0. */
+#define CH0_AIN ANALOG_INPUT_TO_SAADC_AIN(ANALOG_INPUT_A0)
+
+/** @brief Internal timer frequency [Hz] is derived from PCLK16M (see SAMPLERATE register in SAADC). */
+#define INTERNAL_TIMER_FREQ 16000000UL
+
+/** @brief Symbol specifying the number of sample buffers used alternately. */
+#define BUFFER_COUNT 2UL
+
+/** @brief Symbol specifying the size of a single sample buffer. */
+#define BUFFER_SIZE 1024UL
+
+/** @brief Symbol specifying the number of buffers filled in each measurement. */
+#define BUFFERS_PER_MEASUREMENT 16UL
+
+/** @brief Sample rates to be measured, limited by 3 us acquisition and 2 us conversion time. */
+static const struct
+{
+    uint32_t     frequency;
+    char const * p_name;
+} m_sample_rates[] =
+{
+    { 50000UL,  "SAADC 50 kHz" },
+    { 100000UL, "SAADC 100 kHz" },
+    { 200000UL, "SAADC 200 kHz" },
+};
+
+/** @brief Sample buffers. */
+static nrf_saadc_value_t m_sample_buffers[BUFFER_COUNT][BUFFER_SIZE];
+
+/** @brief Number of buffers passed to the driver. */
+static uint32_t m_buffers_set;
+
+/** @brief Number of samples received. */
+static uint32_t m_samples;
+
+/** @brief Flag indicating that the sampling is finished. */
+static volatile bool m_done;
+
+/**
+ * @brief Function for handling SAADC driver events.
+ *
+ * @param[in] p_event Pointer to an SAADC driver event.
+ */
+static void saadc_handler(nrfx_saadc_evt_t const * p_event)
+{
+    nrfx_err_t status;
+    (void)status;
+
+    switch (p_event->type)
+    {
+        case NRFX_SAADC_EVT_BUF_REQ:
+            if (m_buffers_set < BUFFERS_PER_MEASUREMENT)
+            {
+                status = nrfx_saadc_buffer_set(m_sample_buffers[m_buffers_set % BUFFER_COUNT],
+                                               BUFFER_SIZE);
+                NRFX_ASSERT(status == NRFX_SUCCESS);
+                m_buffers_set++;
+            }
+            break;
+
+        case NRFX_SAADC_EVT_DONE:
+            m_samples += p_event->data.done.size;
+            break;
+
+        case NRFX_SAADC_EVT_FINISHED:
+            m_done = true;
+            break;
+
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief Function for measuring continuous sampling at the specified sample rate.
+ *
+ * @param[in] frequency Sample rate in Hz.
+ * @param[in] p_name    Name of the measured case.
+ */
+static void saadc_measure(uint32_t frequency, char const * p_name)
+{
+    nrfx_err_t status;
+    (void)status;
+
+    nrfx_saadc_adv_config_t adv_config = NRFX_SAADC_DEFAULT_ADV_CONFIG;
+    adv_config.internal_timer_cc = (uint16_t)(INTERNAL_TIMER_FREQ / frequency);
+    adv_config.start_on_end      = true;
+
+    status = nrfx_saadc_advanced_mode_set(nrfx_saadc_channels_configured_get(),
+                                          NRF_SAADC_RESOLUTION_12BIT,
+                                          &adv_config,
+                                          saadc_handler);
+    NRFX_ASSERT(status == NRFX_SUCCESS);
+
+    m_done        = false;
+    m_samples     = 0;
+    m_buffers_set = 1;
+    status = nrfx_saadc_buffer_set(m_sample_buffers[0], BUFFER_SIZE);
+    NRFX_ASSERT(status == NRFX_SUCCESS);
+
+    benchmark_t bench;
+    benchmark_start(&bench, p_name, nrfx_get_irq_number(NRF_SAADC));
+    status = nrfx_saadc_mode_trigger();
+    NRFX_ASSERT(status == NRFX_SUCCESS);
+
+    while (!m_done)
+    {}
+
+    benchmark_stop(&bench, m_samples);
+    benchmark_report(&bench, "samples");
+    NRFX_EXAMPLE_LOG_PROCESS();
+}
+
+/**
+ * @brief Function for application main entry.
+ *
+ * @return Nothing.
+ */
+int main(void)
+{
+    nrfx_err_t status;
+    (void)status;
+
+    NRFX_EXAMPLE_LOG_INIT();
+
+    NRFX_LOG_INFO("Starting nrfx_saadc benchmark.");
+    NRFX_EXAMPLE_LOG_PROCESS();
+
+    status = nrfx_saadc_init(NRFX_SAADC_DEFAULT_CONFIG_IRQ_PRIORITY);
+    NRFX_ASSERT(status == NRFX_SUCCESS);
+
+#if defined(__ZEPHYR__)
+    IRQ_DIRECT_CONNECT(NRFX_IRQ_NUMBER_GET(NRF_SAADC), IRQ_PRIO_LOWEST, nrfx_saadc_irq_handler, 0);
+#endif
+
+    nrfx_saadc_channel_t channel = NRFX_SAADC_DEFAULT_CHANNEL_SE(CH0_AIN, 0);
+    channel.channel_config.acq_time = NRF_SAADC_ACQTIME_3US;
+    status = nrfx_saadc_channel_config(&channel);
+    NRFX_ASSERT(status == NRFX_SUCCESS);
+
+    status = nrfx_saadc_offset_calibrate(NULL);
+    NRFX_ASSERT(status == NRFX_SUCCESS);
+
+    for (size_t i = 0; i < NRFX_ARRAY_SIZE(m_sample_rates); i++)
+    {
+        saadc_measure(m_sample_rates[i].frequency, m_sample_rates[i].p_name);
+    }
+
+    NRFX_LOG_INFO("Benchmark finished.");
+
+    while (1)
+    {
+        NRFX_EXAMPLE_LOG_PROCESS();
+    }
+}
+
+/** @} */
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx_example.h>
+#include <nrfx_spim.h>
+#include <benchmark_common.h>
+
+#define NRFX_LOG_MODULE                 EXAMPLE
+#define NRFX_EXAMPLE_CONFIG_LOG_ENABLED 1
+#define NRFX_EXAMPLE_CONFIG_LOG_LEVEL   3
+#include <nrfx_log.h>
+
+/**
+ * @defgroup nrfx_benchmark_spim_example SPIM benchmark example
+ * @{
+ * @ingroup nrfx_benchmark_examples
+ *
+ * @brief Example measuring the throughput of nrfx_spim driver at various frequencies.
+ *
+ * @details For every frequency from @ref m_frequencies supported by the SoC, the application
+ *          transfers @ref TRANSFER_SIZE bytes in chunks of @ref CHUNK_SIZE bytes. Every next
+ *          chunk is started from @ref spim_handler(). MOSI is looped back to MISO, so
+ *          the received data is compared with the sent data once all chunks are transferred.
+ */
+
+#if defined(NRF53_SERIES) || defined(__NRFX_DOXYGEN__)
+/** @brief Symbol specifying SPIM instance to be used, the one supporting the highest frequency. */
+#define SPIM_INST_IDX 4
+#else
+#define SPIM_INST_IDX 3
+#endif
+
+/** @brief Symbol specifying pin number for MOSI. */
+#define MOSI_PIN LOOPBACK_PIN_1A
+
+/** @brief Symbol specifying pin number for MISO. */
+#define MISO_PIN LOOPBACK_PIN_1B
+
+/** @brief Symbol specifying pin number for SCK. */
+#define SCK_PIN LOOPBACK_PIN_2A
+
+/** @brief Symbol specifying the number of bytes in a single transfer. */
+#define CHUNK_SIZE 1024
+
+/** @brief Symbol specifying the number of bytes transferred in each measurement. */
+#define TRANSFER_SIZE 16384
+
+NRFX_STATIC_ASSERT((TRANSFER_SIZE % CHUNK_SIZE) == 0);
+
+/** @brief Frequencies to be measured. */
+static const struct
+{
+    uint32_t     frequency;
+    char const * p_name;
+} m_frequencies[] =
+{
+    { NRFX_MHZ_TO_HZ(8),  "SPIM 8 MHz" },
+#if NRF_SPIM_HAS_16_MHZ_FREQ
+    { NRFX_MHZ_TO_HZ(16), "SPIM 16 MHz" },
+#endif
+#if NRF_SPIM_HAS_32_MHZ_FREQ
+    { NRFX_MHZ_TO_HZ(32), "SPIM 32 MHz" },
+#endif
+};
+
+/** @brief Structure containing SPIM driver instance. */
+static nrfx_spim_t m_spim_inst = NRFX_SPIM_INSTANCE(SPIM_INST_IDX);
+
+/** @brief Transmit buffer. */
+static uint8_t m_tx_buffer[TRANSFER_SIZE];
+
+/** @brief Receive buffer. */
+static uint8_t m_rx_buffer[TRANSFER_SIZE];
+
+/** @brief Number of bytes already passed to the driver. */
+static size_t m_offset;
+
+/** @brief Flag indicating that all chunks are transferred. */
+static volatile bool m_done;
+
+/**
+ * @brief Function for starting the transfer of the next chunk.
+ */
+static void chunk_xfer(void)
+{
+    nrfx_err_t status;
+    (void)status;
+
+    nrfx_spim_xfer_desc_t xfer_desc = NRFX_SPIM_XFER_TRX(&m_tx_buffer[m_offset], CHUNK_SIZE,
+                                                         &m_rx_buffer[m_offset], CHUNK_SIZE);
+    m_offset += CHUNK_SIZE;
+    status = nrfx_spim_xfer(&m_spim_inst, &xfer_desc, 0);
+    NRFX_ASSERT(status == NRFX_SUCCESS);
+}
+
+/**
+ * @brief Function for handling SPIM driver events.
+ *
+ * @param[in] p_event   Pointer to the SPIM driver event.
+ * @param[in] p_context Pointer to the context passed from the driver.
+ */
+static void spim_handler(nrfx_spim_evt_t const * p_event, void * p_context)
+{
+    (void)p_context;
+
+    if (p_event->type == NRFX_SPIM_EVENT_DONE)
+    {
+        if (m_offset < TRANSFER_SIZE)
+        {
+            chunk_xfer();
+        }
+        else
+        {
+            m_done = true;
+        }
+    }
+}
+
+/**
+ * @brief Function for measuring the throughput at the specified frequency.
+ *
+ * @param[in] frequency SCK frequency in Hz.
+ * @param[in] p_name    Name of the measured case.
+ */
+static void spim_measure(uint32_t frequency, char const * p_name)
+{
+    nrfx_err_t status;
+    (void)status;
+
+    nrfx_spim_config_t spim_config = NRFX_SPIM_DEFAULT_CONFIG(SCK_PIN,
+                                                              MOSI_PIN,
+                                                              MISO_PIN,
+                                                              NRF_SPIM_PIN_NOT_CONNECTED);
+    spim_config.frequency = frequency;
+    status = nrfx_spim_init(&m_spim_inst, &spim_config, spim_handler, NULL);
+    NRFX_ASSERT(status == NRFX_SUCCESS);
+
+    memset(m_rx_buffer, 0, sizeof(m_rx_buffer));
+    m_done   = false;
+    m_offset = 0;
+
+    benchmark_t bench;
+    benchmark_start(&bench, p_name, nrfx_get_irq_number(m_spim_inst.p_reg));
+    chunk_xfer();
+
+    while (!m_done)
+    {}
+
+    benchmark_stop(&bench, TRANSFER_SIZE);
+    benchmark_report(&bench, "B");
+    if (memcmp(m_tx_buffer, m_rx_buffer, TRANSFER_SIZE) != 0)
+    {
+        NRFX_LOG_INFO("%s: received data does not match", p_name);
+    }
+    NRFX_EXAMPLE_LOG_PROCESS();
+
+    nrfx_spim_uninit(&m_spim_inst);
+}
+
+/**
+ * @brief Function for application main entry.
+ *
+ * @return Nothing.
+ */
+int main(void)
+{
+    NRFX_EXAMPLE_LOG_INIT();
+
+    NRFX_LOG_INFO("Starting nrfx_spim benchmark.");
+    NRFX_EXAMPLE_LOG_PROCESS();
+
+#if defined(__ZEPHYR__)
+    IRQ_DIRECT_CONNECT(NRFX_IRQ_NUMBER_GET(NRF_SPIM_INST_GET(SPIM_INST_IDX)), IRQ_PRIO_LOWEST,
+                       NRFX_SPIM_INST_HANDLER_GET(SPIM_INST_IDX), 0);
+#endif
+
+    for (size_t i = 0; i < sizeof(m_tx_buffer); i++)
+    {
+        m_tx_buffer[i] = (uint8_t)i;
+    }
+
+    for (size_t i = 0; i < NRFX_ARRAY_SIZE(m_frequencies); i++)
+    {
+        spim_measure(m_frequencies[i].frequency, m_frequencies[i].p_name);
+    }
+
+    NRFX_LOG_INFO("Benchmark finished.");
+
+    while (1)
+    {
+        NRFX_EXAMPLE_LOG_PROCESS();
+    }
+}
+
+/** @} */
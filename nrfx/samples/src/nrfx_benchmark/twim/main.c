@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx_example.h>
+#include <nrfx_twim.h>
+#include <nrfx_twis.h>
+#include <benchmark_common.h>
+
+#define NRFX_LOG_MODULE                 EXAMPLE
+#define NRFX_EXAMPLE_CONFIG_LOG_ENABLED 1
+#define NRFX_EXAMPLE_CONFIG_LOG_LEVEL   3
+#include <nrfx_log.h>
+
+/**
+ * @defgroup nrfx_benchmark_twim_example TWIM benchmark example
+ * @{
+ * @ingroup nrfx_benchmark_examples
+ *
+ * @brief Example measuring the throughput of nrfx_twim driver at various frequencies.
+ *
+ * @details For every frequency from @ref m_frequencies supported by the SoC, the application
+ *          writes @ref TRANSFER_SIZE bytes in chunks of @ref CHUNK_SIZE bytes to the TWIS instance
+ *          of the same SoC. Every next chunk is started from @ref twim_handler(). The data received
+ *          by TWIS is compared with the sent data once all chunks are transferred.
+ *
+ *          Note that TWIS is specified for frequencies up to 400 kHz, so an external target
+ *          should be used to validate the results at 1 MHz.
+ */
+
+/** @brief Symbol specifying pin number of master SCL. */
+#define MASTER_SCL_PIN LOOPBACK_PIN_1A
+
+/** @brief Symbol specifying pin number of master SDA. */
+#define MASTER_SDA_PIN LOOPBACK_PIN_2A
+
+/** @brief Symbol specifying pin number of slave SCL. */
+#define SLAVE_SCL_PIN LOOPBACK_PIN_1B
+
+/** @brief Symbol specifying pin number of slave SDA. */
+#define SLAVE_SDA_PIN LOOPBACK_PIN_2B
+
+#if defined(NRF52_SERIES) || defined(__NRFX_DOXYGEN__)
+/** @brief Symbol specifying TWIM instance to be used. */
+#define TWIM_INST_IDX 0
+
+/** @brief Symbol specifying TWIS instance to be used. */
+#define TWIS_INST_IDX 1
+#else
+#define TWIM_INST_IDX 1
+#define TWIS_INST_IDX 2
+#endif
+
+/** @brief Symbol specifying slave address on TWI bus. */
+#define SLAVE_ADDR 0x0B
+
+/** @brief Symbol specifying the number of bytes in a single transfer. */
+#define CHUNK_SIZE 255
+
+/** @brief Symbol specifying the number of chunks transferred in each measurement. */
+#define CHUNK_COUNT 8
+
+/** @brief Symbol specifying the number of bytes transferred in each measurement. */
+#define TRANSFER_SIZE (CHUNK_SIZE * CHUNK_COUNT)
+
+/** @brief Frequencies to be measured. */
+static const struct
+{
+    nrf_twim_frequency_t frequency;
+    char const *         p_name;
+} m_frequencies[] =
+{
+    { NRF_TWIM_FREQ_400K,  "TWIM 400 kHz" },
+#if NRF_TWIM_HAS_1000_KHZ_FREQ
+    { NRF_TWIM_FREQ_1000K, "TWIM 1 MHz" },
+#endif
+};
+
+/** @brief Structure containing TWIS driver instance. */
+static nrfx_twis_t m_twis_inst = NRFX_TWIS_INSTANCE(TWIS_INST_IDX);
+
+/** @brief Structure containing TWIM driver instance. */
+static nrfx_twim_t m_twim_inst = NRFX_TWIM_INSTANCE(TWIM_INST_IDX);
+
+/** @brief TWIM transmit buffer. */
+static uint8_t m_tx_buffer[TRANSFER_SIZE];
+
+/** @brief TWIS receive buffer. */
+static uint8_t m_rx_buffer[TRANSFER_SIZE];
+
+/** @brief Number of bytes already passed to the TWIM driver. */
+static size_t m_tx_offset;
+
+/** @brief Number of bytes already passed to the TWIS driver. */
+static size_t m_rx_offset;
+
+/** @brief Flag indicating that all chunks are transferred. */
+static volatile bool m_done;
+
+/**
+ * @brief Function for starting the transfer of the next chunk.
+ */
+static void chunk_xfer(void)
+{
+    nrfx_err_t status;
+    (void)status;
+
+    nrfx_twim_xfer_desc_t xfer_desc = NRFX_TWIM_XFER_DESC_TX(SLAVE_ADDR,
+                                                             &m_tx_buffer[m_tx_offset],
+                                                             CHUNK_SIZE);
+    m_tx_offset += CHUNK_SIZE;
+    status = nrfx_twim_xfer(&m_twim_inst, &xfer_desc, 0);
+    NRFX_ASSERT(status == NRFX_SUCCESS);
+}
+
+/**
+ * @brief Function for handling TWIM driver events.
+ *
+ * @param[in] p_event   Event information structure.
+ * @param[in] p_context General purpose parameter set during initialization of the TWIM.
+ */
+static void twim_handler(nrfx_twim_evt_t const * p_event, void * p_context)
+{
+    (void)p_context;
+
+    if ((p_event->type == NRFX_TWIM_EVT_DONE) && (m_tx_offset < TRANSFER_SIZE))
+    {
+        chunk_xfer();
+    }
+    else
+    {
+        m_done = true;
+    }
+}
+
+/**
+ * @brief Function for handling TWIS driver events.
+ *
+ * @param[in] p_event Event information structure.
+ */
+static void twis_handler(nrfx_twis_evt_t const * p_event)
+{
+    nrfx_err_t status;
+    (void)status;
+
+    if ((p_event->type == NRFX_TWIS_EVT_WRITE_REQ) && (m_rx_offset < TRANSFER_SIZE))
+    {
+        status = nrfx_twis_rx_prepare(&m_twis_inst, &m_rx_buffer[m_rx_offset], CHUNK_SIZE);
+        NRFX_ASSERT(status == NRFX_SUCCESS);
+        m_rx_offset += CHUNK_SIZE;
+    }
+}
+
+/**
+ * @brief Function for measuring the throughput at the specified frequency.
+ *
+ * @param[in] frequency SCL frequency.
+ * @param[in] p_name    Name of the measured case.
+ */
+static void twim_measure(nrf_twim_frequency_t frequency, char const * p_name)
+{
+    nrfx_err_t status;
+    (void)status;
+
+    nrfx_twim_config_t twim_config = NRFX_TWIM_DEFAULT_CONFIG(MASTER_SCL_PIN, MASTER_SDA_PIN);
+    twim_config.frequency = frequency;
+    status = nrfx_twim_init(&m_twim_inst, &twim_config, twim_handler, NULL);
+    NRFX_ASSERT(status == NRFX_SUCCESS);
+    nrfx_twim_enable(&m_twim_inst);
+
+    memset(m_rx_buffer, 0, sizeof(m_rx_buffer));
+    m_done      = false;
+    m_tx_offset = 0;
+    m_rx_offset = 0;
+
+    benchmark_t bench;
+    benchmark_start(&bench, p_name, nrfx_get_irq_number(m_twim_inst.p_twim));
+    chunk_xfer();
+
+    while (!m_done)
+    {}
+
+    benchmark_stop(&bench, (uint32_t)m_tx_offset);
+    benchmark_report(&bench, "B");
+    if (memcmp(m_tx_buffer, m_rx_buffer, TRANSFER_SIZE) != 0)
+    {
+        NRFX_LOG_INFO("%s: received data does not match", p_name);
+    }
+    NRFX_EXAMPLE_LOG_PROCESS();
+
+    nrfx_twim_uninit(&m_twim_inst);
+}
+
+/**
+ * @brief Function for application main entry.
+ *
+ * @return Nothing.
+ */
+int main(void)
+{
+    nrfx_err_t status;
+    (void)status;
+
+    NRFX_EXAMPLE_LOG_INIT();
+
+    NRFX_LOG_INFO("Starting nrfx_twim benchmark.");
+    NRFX_EXAMPLE_LOG_PROCESS();
+
+    nrfx_twis_config_t twis_config = NRFX_TWIS_DEFAULT_CONFIG(SLAVE_SCL_PIN,
+                                                              SLAVE_SDA_PIN,
+                                                              SLAVE_ADDR);
+    status = nrfx_twis_init(&m_twis_inst, &twis_config, twis_handler);
+    NRFX_ASSERT(status == NRFX_SUCCESS);
+
+#if defined(__ZEPHYR__)
+    IRQ_DIRECT_CONNECT(NRFX_IRQ_NUMBER_GET(NRF_TWIM_INST_GET(TWIM_INST_IDX)), IRQ_PRIO_LOWEST,
+                       NRFX_TWIM_INST_HANDLER_GET(TWIM_INST_IDX), 0);
+
+    IRQ_DIRECT_CONNECT(NRFX_IRQ_NUMBER_GET(NRF_TWIS_INST_GET(TWIS_INST_IDX)), IRQ_PRIO_LOWEST,
+                       NRFX_TWIS_INST_HANDLER_GET(TWIS_INST_IDX), 0);
+#endif
+
+    nrfx_twis_enable(&m_twis_inst);
+
+    for (size_t i = 0; i < sizeof(m_tx_buffer); i++)
+    {
+        m_tx_buffer[i] = (uint8_t)i;
+    }
+
+    for (size_t i = 0; i < NRFX_ARRAY_SIZE(m_frequencies); i++)
+    {
+        twim_measure(m_frequencies[i].frequency, m_frequencies[i].p_name);
+    }
+
+    NRFX_LOG_INFO("Benchmark finished.");
+
+    while (1)
+    {
+        NRFX_EXAMPLE_LOG_PROCESS();
+    }
+}
+
+/** @} */
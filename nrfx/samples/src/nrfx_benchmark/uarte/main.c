@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx_example.h>
+#include <nrfx_uarte.h>
+#include <benchmark_common.h>
+
+#define NRFX_LOG_MODULE                 EXAMPLE
+#define NRFX_EXAMPLE_CONFIG_LOG_ENABLED 1
+#define NRFX_EXAMPLE_CONFIG_LOG_LEVEL   3
+#include <nrfx_log.h>
+
+/**
+ * @defgroup nrfx_benchmark_uarte_example UARTE benchmark example
+ * @{
+ * @ingroup nrfx_benchmark_examples
+ *
+ * @brief Example measuring the throughput of nrfx_uarte driver at various baud rates.
+ *
+ * @details For every baud rate from @ref m_baudrates, the application receives
+ *          @ref TRANSFER_SIZE bytes into @ref m_rx_buffer with a single reception, while
+ *          @ref m_tx_buffer is sent in chunks of @ref CHUNK_SIZE bytes that are started
+ *          from @ref uarte_handler(). TX is looped back to RX, so the received data is compared
+ *          with the sent data once the reception is finished.
+ */
+
+/** @brief Symbol specifying UARTE instance to be used. */
+#define UARTE_INST_IDX 1
+
+/** @brief Symbol specifying TX pin number of UARTE. */
+#define UARTE_TX_PIN LOOPBACK_PIN_1A
+
+/** @brief Symbol specifying RX pin number of UARTE. */
+#define UARTE_RX_PIN LOOPBACK_PIN_1B
+
+/** @brief Symbol specifying the number of bytes sent in a single transmission. */
+#define CHUNK_SIZE 256
+
+/** @brief Symbol specifying the number of bytes transferred in each measurement. */
+#define TRANSFER_SIZE 4096
+
+NRFX_STATIC_ASSERT((TRANSFER_SIZE % CHUNK_SIZE) == 0);
+
+/** @brief Baud rates to be measured. */
+static const struct
+{
+    nrf_uarte_baudrate_t baudrate;
+    char const *         p_name;
+} m_baudrates[] =
+{
+    { NRF_UARTE_BAUDRATE_115200,  "UARTE 115200 baud" },
+    { NRF_UARTE_BAUDRATE_460800,  "UARTE 460800 baud" },
+    { NRF_UARTE_BAUDRATE_1000000, "UARTE 1000000 baud" },
+};
+
+/** @brief Structure containing UARTE driver instance. */
+static nrfx_uarte_t m_uarte_inst = NRFX_UARTE_INSTANCE(UARTE_INST_IDX);
+
+/** @brief UARTE transmit buffer. */
+static uint8_t m_tx_buffer[TRANSFER_SIZE];
+
+/** @brief UARTE receive buffer. */
+static uint8_t m_rx_buffer[TRANSFER_SIZE];
+
+/** @brief Number of bytes from @ref m_tx_buffer already passed to the driver. */
+static size_t m_tx_offset;
+
+/** @brief Flag indicating that the reception is finished. */
+static volatile bool m_rx_done;
+
+/**
+ * @brief Function for handling UARTE driver events.
+ *
+ * @param[in] p_event   Pointer to event structure.
+ * @param[in] p_context Context passed to the event handler.
+ */
+static void uarte_handler(nrfx_uarte_event_t const * p_event, void * p_context)
+{
+    nrfx_err_t status;
+    (void)status;
+    (void)p_context;
+
+    switch (p_event->type)
+    {
+        case NRFX_UARTE_EVT_TX_DONE:
+            if (m_tx_offset < TRANSFER_SIZE)
+            {
+                status = nrfx_uarte_tx(&m_uarte_inst, &m_tx_buffer[m_tx_offset], CHUNK_SIZE, 0);
+                NRFX_ASSERT(status == NRFX_SUCCESS);
+                m_tx_offset += CHUNK_SIZE;
+            }
+            break;
+
+        case NRFX_UARTE_EVT_RX_DONE:
+            m_rx_done = true;
+            break;
+
+        case NRFX_UARTE_EVT_ERROR:
+            NRFX_LOG_INFO("UARTE error: 0x%08x", p_event->data.error.error_mask);
+            m_rx_done = true;
+            break;
+
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief Function for measuring the throughput at the specified baud rate.
+ *
+ * @param[in] baudrate Baud rate to be used.
+ * @param[in] p_name   Name of the measured case.
+ */
+static void uarte_measure(nrf_uarte_baudrate_t baudrate, char const * p_name)
+{
+    nrfx_err_t status;
+    (void)status;
+
+    nrfx_uarte_config_t uarte_config = NRFX_UARTE_DEFAULT_CONFIG(UARTE_TX_PIN, UARTE_RX_PIN);
+    uarte_config.baudrate = baudrate;
+    status = nrfx_uarte_init(&m_uarte_inst, &uarte_config, uarte_handler);
+    NRFX_ASSERT(status == NRFX_SUCCESS);
+
+    memset(m_rx_buffer, 0, sizeof(m_rx_buffer));
+    m_rx_done   = false;
+    m_tx_offset = CHUNK_SIZE;
+
+    benchmark_t bench;
+    benchmark_start(&bench, p_name, nrfx_get_irq_number(m_uarte_inst.p_reg));
+
+    status = nrfx_uarte_rx(&m_uarte_inst, m_rx_buffer, sizeof(m_rx_buffer));
+    NRFX_ASSERT(status == NRFX_SUCCESS);
+    status = nrfx_uarte_tx(&m_uarte_inst, m_tx_buffer, CHUNK_SIZE, 0);
+    NRFX_ASSERT(status == NRFX_SUCCESS);
+
+    while (!m_rx_done)
+    {}
+
+    benchmark_stop(&bench, TRANSFER_SIZE);
+    benchmark_report(&bench, "B");
+    if (memcmp(m_tx_buffer, m_rx_buffer, TRANSFER_SIZE) != 0)
+    {
+        NRFX_LOG_INFO("%s: received data does not match", p_name);
+    }
+    NRFX_EXAMPLE_LOG_PROCESS();
+
+    nrfx_uarte_uninit(&m_uarte_inst);
+}
+
+/**
+ * @brief Function for application main entry.
+ *
+ * @return Nothing.
+ */
+int main(void)
+{
+    NRFX_EXAMPLE_LOG_INIT();
+
+    NRFX_LOG_INFO("Starting nrfx_uarte benchmark.");
+    NRFX_EXAMPLE_LOG_PROCESS();
+
+#if defined(__ZEPHYR__)
+    IRQ_DIRECT_CONNECT(NRFX_IRQ_NUMBER_GET(NRF_UARTE_INST_GET(UARTE_INST_IDX)), IRQ_PRIO_LOWEST,
+                       NRFX_UARTE_INST_HANDLER_GET(UARTE_INST_IDX), 0);
+#endif
+
+    for (size_t i = 0; i < sizeof(m_tx_buffer); i++)
+    {
+        m_tx_buffer[i] = (uint8_t)i;
+    }
+
+    for (size_t i = 0; i < NRFX_ARRAY_SIZE(m_baudrates); i++)
+    {
+        uarte_measure(m_baudrates[i].baudrate, m_baudrates[i].p_name);
+    }
+
+    NRFX_LOG_INFO("Benchmark finished.");
+
+    while (1)
+    {
+        NRFX_EXAMPLE_LOG_PROCESS();
+    }
+}
+
+/** @} */
@@ -57,6 +57,16 @@
  */
 #define NRFX_COREDEP_DELAY_US_LOOP_CYCLES
 
+/**
+ * @brief Number of cycles consumed by the DWT-based @ref nrfx_coredep_delay_us
+ *        outside of its waiting loop.
+ *
+ * The value is subtracted from the requested delay, so that short delays are not extended
+ * by the setup of the DWT unit. It can be specified externally after measurement on
+ * the given target.
+ */
+#define NRFX_COREDEP_DELAY_US_DWT_OVERHEAD_CYCLES
+
 #elif defined(NRF51)
     #define NRFX_DELAY_CPU_FREQ_MHZ 16
     #define NRFX_DELAY_DWT_PRESENT  0
@@ -105,6 +115,11 @@ NRF_STATIC_INLINE void nrfx_coredep_delay_us(uint32_t time_us);
 #error "DWT unit not present in the SoC that is used."
 #endif
 
+#ifndef NRFX_COREDEP_DELAY_US_DWT_OVERHEAD_CYCLES
+// Saving and restoring DEMCR and DWT CTRL, the initial CYCCNT read, and the exit from the loop.
+#define NRFX_COREDEP_DELAY_US_DWT_OVERHEAD_CYCLES 16
+#endif
+
 NRF_STATIC_INLINE void nrfx_coredep_delay_us(uint32_t time_us)
 {
     if (time_us == 0)
@@ -112,6 +127,8 @@ NRF_STATIC_INLINE void nrfx_coredep_delay_us(uint32_t time_us)
         return;
     }
     uint32_t time_cycles = time_us * NRFX_DELAY_CPU_FREQ_MHZ;
+    time_cycles = (time_cycles > NRFX_COREDEP_DELAY_US_DWT_OVERHEAD_CYCLES) ?
+                  (time_cycles - NRFX_COREDEP_DELAY_US_DWT_OVERHEAD_CYCLES) : 0;
 
     // Save the current state of the DEMCR register to be able to restore it before exiting
     // this function. Enable the trace and debug blocks (including DWT).
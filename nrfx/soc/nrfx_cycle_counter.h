@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_CYCLE_COUNTER_H__
+#define NRFX_CYCLE_COUNTER_H__
+
+#include <nrfx.h>
+#include <soc/nrfx_coredep.h>
+
+/**
+ * @defgroup nrfx_cycle_counter Cycle counter profiling
+ * @{
+ * @ingroup nrfx
+ * @brief Module for measuring the execution time of code fragments in CPU cycles.
+ *
+ * The module uses the cycle counter of the Data Watchpoint and Trace (DWT) unit.
+ * The profiling macros are expanded only when @ref NRFX_CYCLE_COUNTER_PROFILING is set
+ * to a non-zero value and the DWT unit is present, so they can be left in driver hot paths
+ * at no cost otherwise.
+ *
+ * @code
+ * static nrfx_cycle_prof_t m_prof;
+ *
+ * nrfx_cycle_counter_enable();
+ * NRFX_CYCLE_PROF_START(&m_prof);
+ * // Code to be measured.
+ * NRFX_CYCLE_PROF_STOP(&m_prof);
+ * @endcode
+ */
+
+#if defined(__NRFX_DOXYGEN__)
+/** @brief Enable the profiling macros. */
+#define NRFX_CYCLE_COUNTER_PROFILING 0
+#elif !defined(NRFX_CYCLE_COUNTER_PROFILING)
+#define NRFX_CYCLE_COUNTER_PROFILING 0
+#endif
+
+#if NRFX_DELAY_DWT_PRESENT || defined(__NRFX_DOXYGEN__)
+/** @brief Symbol indicating whether the cycle counter is available. */
+#define NRFX_CYCLE_COUNTER_PRESENT 1
+#else
+#define NRFX_CYCLE_COUNTER_PRESENT 0
+#endif
+
+/**
+ * @brief Number of cycles consumed by @ref NRFX_CYCLE_PROF_START and @ref NRFX_CYCLE_PROF_STOP
+ *        themselves, subtracted from every measurement.
+ *
+ * This value can be specified externally, for example, after a measurement of an empty
+ * fragment on the given target.
+ */
+#ifndef NRFX_CYCLE_PROF_OVERHEAD_CYCLES
+#define NRFX_CYCLE_PROF_OVERHEAD_CYCLES 2
+#endif
+
+/** @brief Structure for accumulating the measurements of a code fragment. */
+typedef struct
+{
+    uint32_t start; ///< Counter value at the start of the current measurement.
+    uint32_t count; ///< Number of measurements.
+    uint32_t last;  ///< Length of the last measurement, in cycles.
+    uint32_t max;   ///< Length of the longest measurement, in cycles.
+    uint64_t total; ///< Sum of all the measurements, in cycles.
+} nrfx_cycle_prof_t;
+
+/**
+ * @brief Function for enabling the cycle counter.
+ *
+ * The counter is left running, so the function needs to be called only once.
+ * It has no effect if the cycle counter is not present.
+ */
+NRF_STATIC_INLINE void nrfx_cycle_counter_enable(void);
+
+/**
+ * @brief Function for getting the current value of the cycle counter.
+ *
+ * @return The counter value, or 0 if the cycle counter is not present.
+ */
+NRF_STATIC_INLINE uint32_t nrfx_cycle_counter_get(void);
+
+/**
+ * @brief Function for resetting the accumulated measurements.
+ *
+ * @param[out] p_prof Pointer to the measurement structure.
+ */
+NRF_STATIC_INLINE void nrfx_cycle_prof_reset(nrfx_cycle_prof_t * p_prof);
+
+/**
+ * @brief Function for adding the measurement that ends at the current moment.
+ *
+ * @param[in,out] p_prof Pointer to the measurement structure.
+ */
+NRF_STATIC_INLINE void nrfx_cycle_prof_stop(nrfx_cycle_prof_t * p_prof);
+
+/**
+ * @brief Function for getting the average length of the accumulated measurements.
+ *
+ * @param[in] p_prof Pointer to the measurement structure.
+ *
+ * @return Average length in cycles, or 0 if there are no measurements.
+ */
+NRF_STATIC_INLINE uint32_t nrfx_cycle_prof_avg_get(nrfx_cycle_prof_t const * p_prof);
+
+#if NRFX_CHECK(NRFX_CYCLE_COUNTER_PROFILING) && NRFX_CYCLE_COUNTER_PRESENT
+/**
+ * @brief Macro for starting the measurement.
+ *
+ * @param[in,out] p_prof Pointer to the measurement structure.
+ */
+#define NRFX_CYCLE_PROF_START(p_prof) ((p_prof)->start = nrfx_cycle_counter_get())
+
+/**
+ * @brief Macro for ending the measurement and accumulating its result.
+ *
+ * @param[in,out] p_prof Pointer to the measurement structure.
+ */
+#define NRFX_CYCLE_PROF_STOP(p_prof)  nrfx_cycle_prof_stop(p_prof)
+#else
+#define NRFX_CYCLE_PROF_START(p_prof) ((void)0)
+#define NRFX_CYCLE_PROF_STOP(p_prof)  ((void)0)
+#endif
+
+/** @} */
+
+#ifndef NRF_DECLARE_ONLY
+
+NRF_STATIC_INLINE void nrfx_cycle_counter_enable(void)
+{
+#if NRFX_CYCLE_COUNTER_PRESENT
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+NRF_STATIC_INLINE uint32_t nrfx_cycle_counter_get(void)
+{
+#if NRFX_CYCLE_COUNTER_PRESENT
+    return DWT->CYCCNT;
+#else
+    return 0;
+#endif
+}
+
+NRF_STATIC_INLINE void nrfx_cycle_prof_reset(nrfx_cycle_prof_t * p_prof)
+{
+    p_prof->count = 0;
+    p_prof->last  = 0;
+    p_prof->max   = 0;
+    p_prof->total = 0;
+}
+
+NRF_STATIC_INLINE void nrfx_cycle_prof_stop(nrfx_cycle_prof_t * p_prof)
+{
+    uint32_t cycles = nrfx_cycle_counter_get() - p_prof->start;
+
+    cycles = (cycles > NRFX_CYCLE_PROF_OVERHEAD_CYCLES) ?
+             (cycles - NRFX_CYCLE_PROF_OVERHEAD_CYCLES) : 0;
+    p_prof->last   = cycles;
+    p_prof->max    = NRFX_MAX(p_prof->max, cycles);
+    p_prof->total += cycles;
+    p_prof->count++;
+}
+
+NRF_STATIC_INLINE uint32_t nrfx_cycle_prof_avg_get(nrfx_cycle_prof_t const * p_prof)
+{
+    return p_prof->count ? (uint32_t)(p_prof->total / p_prof->count) : 0;
+}
+
+#endif // NRF_DECLARE_ONLY
+
+#endif // NRFX_CYCLE_COUNTER_H__
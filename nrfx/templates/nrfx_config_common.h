@@ -53,4 +53,19 @@
 #define NRFX_CONFIG_API_VER_MICRO 0
 #endif
 
+/** @brief Enable the recording of interrupt handler statistics by @ref nrfx_irq_stats. */
+#ifndef NRFX_IRQ_STATS_ENABLED
+#define NRFX_IRQ_STATS_ENABLED 0
+#endif
+
+/** @brief Number of interrupts, starting from 0, for which the statistics are recorded. */
+#ifndef NRFX_IRQ_STATS_IRQ_COUNT
+#define NRFX_IRQ_STATS_IRQ_COUNT 64
+#endif
+
+/** @brief Enable the registration of counters in @ref nrfx_perf_counters. */
+#ifndef NRFX_PERF_COUNTERS_ENABLED
+#define NRFX_PERF_COUNTERS_ENABLED 0
+#endif
+
 #endif /* NRFX_CONFIG_COMMON_H__ */
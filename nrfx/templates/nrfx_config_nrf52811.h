@@ -48,6 +48,90 @@
 #define NRFX_DEFAULT_IRQ_PRIORITY 7
 #endif
 
+/**
+ * @brief NRFX_AAR_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_AAR_ENABLED
+#define NRFX_AAR_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_AAR_DEFAULT_CONFIG_IRQ_PRIORITY
+ *
+ * Integer value. Minimum: 0 Maximum: 7
+ */
+#ifndef NRFX_AAR_DEFAULT_CONFIG_IRQ_PRIORITY
+#define NRFX_AAR_DEFAULT_CONFIG_IRQ_PRIORITY NRFX_DEFAULT_IRQ_PRIORITY
+#endif
+
+/**
+ * @brief NRFX_AAR_CONFIG_LOG_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_AAR_CONFIG_LOG_ENABLED
+#define NRFX_AAR_CONFIG_LOG_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_AAR_CONFIG_LOG_LEVEL
+ *
+ * Integer value.
+ * Supported values:
+ * - Off     = 0
+ * - Error   = 1
+ * - Warning = 2
+ * - Info    = 3
+ * - Debug   = 4
+ */
+#ifndef NRFX_AAR_CONFIG_LOG_LEVEL
+#define NRFX_AAR_CONFIG_LOG_LEVEL 3
+#endif
+
+/**
+ * @brief NRFX_CCM_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_CCM_ENABLED
+#define NRFX_CCM_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_CCM_DEFAULT_CONFIG_IRQ_PRIORITY
+ *
+ * Integer value. Minimum: 0 Maximum: 7
+ */
+#ifndef NRFX_CCM_DEFAULT_CONFIG_IRQ_PRIORITY
+#define NRFX_CCM_DEFAULT_CONFIG_IRQ_PRIORITY NRFX_DEFAULT_IRQ_PRIORITY
+#endif
+
+/**
+ * @brief NRFX_CCM_CONFIG_LOG_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_CCM_CONFIG_LOG_ENABLED
+#define NRFX_CCM_CONFIG_LOG_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_CCM_CONFIG_LOG_LEVEL
+ *
+ * Integer value.
+ * Supported values:
+ * - Off     = 0
+ * - Error   = 1
+ * - Warning = 2
+ * - Info    = 3
+ * - Debug   = 4
+ */
+#ifndef NRFX_CCM_CONFIG_LOG_LEVEL
+#define NRFX_CCM_CONFIG_LOG_LEVEL 3
+#endif
+
 /**
  * @brief NRFX_CLOCK_ENABLED
  *
@@ -81,6 +165,24 @@
 #define NRFX_CLOCK_CONFIG_LF_CAL_ENABLED 0
 #endif
 
+/**
+ * @brief NRFX_CLOCK_CONFIG_LF_CAL_TEMP_THRESHOLD
+ *
+ * Integer value in 0.01 degrees Celsius. Minimum: 0.
+ */
+#ifndef NRFX_CLOCK_CONFIG_LF_CAL_TEMP_THRESHOLD
+#define NRFX_CLOCK_CONFIG_LF_CAL_TEMP_THRESHOLD 50
+#endif
+
+/**
+ * @brief NRFX_CLOCK_CONFIG_LF_CAL_MAX_SKIP
+ *
+ * Integer value. Minimum: 0. Maximum: 255.
+ */
+#ifndef NRFX_CLOCK_CONFIG_LF_CAL_MAX_SKIP
+#define NRFX_CLOCK_CONFIG_LF_CAL_MAX_SKIP 2
+#endif
+
 /**
  * @brief NRFX_CLOCK_CONFIG_CT_ENABLED
  *
@@ -99,6 +201,24 @@
 #define NRFX_CLOCK_CONFIG_LFXO_TWO_STAGE_ENABLED 0
 #endif
 
+/**
+ * @brief NRFX_CLOCK_CONFIG_HFCLK_REQUEST_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_CLOCK_CONFIG_HFCLK_REQUEST_ENABLED
+#define NRFX_CLOCK_CONFIG_HFCLK_REQUEST_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_CLOCK_CONFIG_HFCLK_STARTUP_TIME_US
+ *
+ * Integer value. Minimum: 0. Maximum: 65535.
+ */
+#ifndef NRFX_CLOCK_CONFIG_HFCLK_STARTUP_TIME_US
+#define NRFX_CLOCK_CONFIG_HFCLK_STARTUP_TIME_US 1500
+#endif
+
 /**
  * @brief NRFX_CLOCK_DEFAULT_CONFIG_IRQ_PRIORITY
  *
@@ -174,6 +294,48 @@
 #define NRFX_COMP_CONFIG_LOG_LEVEL 3
 #endif
 
+/**
+ * @brief NRFX_ECB_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_ECB_ENABLED
+#define NRFX_ECB_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_ECB_DEFAULT_CONFIG_IRQ_PRIORITY
+ *
+ * Integer value. Minimum: 0 Maximum: 7
+ */
+#ifndef NRFX_ECB_DEFAULT_CONFIG_IRQ_PRIORITY
+#define NRFX_ECB_DEFAULT_CONFIG_IRQ_PRIORITY NRFX_DEFAULT_IRQ_PRIORITY
+#endif
+
+/**
+ * @brief NRFX_ECB_CONFIG_LOG_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_ECB_CONFIG_LOG_ENABLED
+#define NRFX_ECB_CONFIG_LOG_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_ECB_CONFIG_LOG_LEVEL
+ *
+ * Integer value.
+ * Supported values:
+ * - Off     = 0
+ * - Error   = 1
+ * - Warning = 2
+ * - Info    = 3
+ * - Debug   = 4
+ */
+#ifndef NRFX_ECB_CONFIG_LOG_LEVEL
+#define NRFX_ECB_CONFIG_LOG_LEVEL 3
+#endif
+
 /**
  * @brief NRFX_EGU_ENABLED
  *
@@ -237,6 +399,33 @@
 #define NRFX_GPIOTE_CONFIG_NUM_OF_EVT_HANDLERS 2
 #endif
 
+/**
+ * @brief NRFX_GPIOTE_CONFIG_NUM_OF_GROUP_HANDLERS
+ *
+ * Integer value. Minimum: 0 Maximum: 32
+ */
+#ifndef NRFX_GPIOTE_CONFIG_NUM_OF_GROUP_HANDLERS
+#define NRFX_GPIOTE_CONFIG_NUM_OF_GROUP_HANDLERS 0
+#endif
+
+/**
+ * @brief NRFX_GPIOTE_CONFIG_PORT_CALLBACK_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_GPIOTE_CONFIG_PORT_CALLBACK_ENABLED
+#define NRFX_GPIOTE_CONFIG_PORT_CALLBACK_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_GPIOTE_CONFIG_DEBOUNCE_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_GPIOTE_CONFIG_DEBOUNCE_ENABLED
+#define NRFX_GPIOTE_CONFIG_DEBOUNCE_ENABLED 0
+#endif
+
 /**
  * @brief NRFX_GPIOTE_CONFIG_LOG_ENABLED
  *
@@ -270,6 +459,24 @@
 #define NRFX_NVMC_ENABLED 0
 #endif
 
+/**
+ * @brief NRFX_NVMC_CONFIG_WRITER_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_NVMC_CONFIG_WRITER_ENABLED
+#define NRFX_NVMC_CONFIG_WRITER_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_NVMC_CONFIG_ERASE_SCHEDULER_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_NVMC_CONFIG_ERASE_SCHEDULER_ENABLED
+#define NRFX_NVMC_CONFIG_ERASE_SCHEDULER_ENABLED 0
+#endif
+
 /**
  * @brief NRFX_PDM_ENABLED
  *
@@ -288,6 +495,24 @@
 #define NRFX_PDM_DEFAULT_CONFIG_IRQ_PRIORITY NRFX_DEFAULT_IRQ_PRIORITY
 #endif
 
+/**
+ * @brief NRFX_PDM_CONFIG_BUFFER_QUEUE_SIZE
+ *
+ * Integer value. Minimum: 0. Maximum: 255.
+ */
+#ifndef NRFX_PDM_CONFIG_BUFFER_QUEUE_SIZE
+#define NRFX_PDM_CONFIG_BUFFER_QUEUE_SIZE 0
+#endif
+
+/**
+ * @brief NRFX_PDM_CONFIG_POSTPROC_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_PDM_CONFIG_POSTPROC_ENABLED
+#define NRFX_PDM_CONFIG_POSTPROC_ENABLED 0
+#endif
+
 /**
  * @brief NRFX_PDM_CONFIG_LOG_ENABLED
  *
@@ -330,6 +555,24 @@
 #define NRFX_POWER_DEFAULT_CONFIG_IRQ_PRIORITY NRFX_DEFAULT_IRQ_PRIORITY
 #endif
 
+/**
+ * @brief NRFX_POWER_CONFIG_RESIDENCY_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_POWER_CONFIG_RESIDENCY_ENABLED
+#define NRFX_POWER_CONFIG_RESIDENCY_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_POWER_CONFIG_RESIDENCY_WAKEUP_SOURCES
+ *
+ * Integer value. Minimum: 1 Maximum: 32
+ */
+#ifndef NRFX_POWER_CONFIG_RESIDENCY_WAKEUP_SOURCES
+#define NRFX_POWER_CONFIG_RESIDENCY_WAKEUP_SOURCES 8
+#endif
+
 /**
  * @brief NRFX_PPI_ENABLED
  *
@@ -450,6 +693,15 @@
 #define NRFX_PWM_DEFAULT_CONFIG_IRQ_PRIORITY NRFX_DEFAULT_IRQ_PRIORITY
 #endif
 
+/**
+ * @brief NRFX_PWM_CONFIG_STREAM_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_PWM_CONFIG_STREAM_ENABLED
+#define NRFX_PWM_CONFIG_STREAM_ENABLED 0
+#endif
+
 /**
  * @brief NRFX_PWM_CONFIG_LOG_ENABLED
  *
@@ -543,6 +795,15 @@
 #define NRFX_RNG_DEFAULT_CONFIG_IRQ_PRIORITY NRFX_DEFAULT_IRQ_PRIORITY
 #endif
 
+/**
+ * @brief NRFX_RNG_CONFIG_POOL_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_RNG_CONFIG_POOL_ENABLED
+#define NRFX_RNG_CONFIG_POOL_ENABLED 0
+#endif
+
 /**
  * @brief NRFX_RNG_CONFIG_LOG_ENABLED
  *
@@ -669,6 +930,60 @@
 #define NRFX_SAADC_CONFIG_LOG_LEVEL 3
 #endif
 
+/**
+ * @brief NRFX_SAADC_CONFIG_BUFFER_RING_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_SAADC_CONFIG_BUFFER_RING_ENABLED
+#define NRFX_SAADC_CONFIG_BUFFER_RING_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_SAADC_CONFIG_PROCESS_HANDLER_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_SAADC_CONFIG_PROCESS_HANDLER_ENABLED
+#define NRFX_SAADC_CONFIG_PROCESS_HANDLER_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_SAADC_CONFIG_TIMESTAMP_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_SAADC_CONFIG_TIMESTAMP_ENABLED
+#define NRFX_SAADC_CONFIG_TIMESTAMP_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_SAADC_CONFIG_TRIGGER_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_SAADC_CONFIG_TRIGGER_ENABLED
+#define NRFX_SAADC_CONFIG_TRIGGER_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_SAADC_CONFIG_AUTO_CALIBRATION_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_SAADC_CONFIG_AUTO_CALIBRATION_ENABLED
+#define NRFX_SAADC_CONFIG_AUTO_CALIBRATION_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_SAADC_CONFIG_SCAN_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_SAADC_CONFIG_SCAN_ENABLED
+#define NRFX_SAADC_CONFIG_SCAN_ENABLED 0
+#endif
+
 /**
  * @brief NRFX_SPI_ENABLED
  *
@@ -771,6 +1086,33 @@
 #define NRFX_SPIM_CONFIG_LOG_LEVEL 3
 #endif
 
+/**
+ * @brief NRFX_SPIM_CONFIG_XFER_LIST_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_SPIM_CONFIG_XFER_LIST_ENABLED
+#define NRFX_SPIM_CONFIG_XFER_LIST_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_SPIM_CONFIG_DISPLAY_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_SPIM_CONFIG_DISPLAY_ENABLED
+#define NRFX_SPIM_CONFIG_DISPLAY_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_SPIM_CONFIG_STREAM_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_SPIM_CONFIG_STREAM_ENABLED
+#define NRFX_SPIM_CONFIG_STREAM_ENABLED 0
+#endif
+
 /**
  * @brief NRFX_SPIM1_ENABLED
  *
@@ -1062,6 +1404,24 @@
 #define NRFX_TWIM_CONFIG_LOG_LEVEL 3
 #endif
 
+/**
+ * @brief NRFX_TWIM_CONFIG_MSG_LIST_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_TWIM_CONFIG_MSG_LIST_ENABLED
+#define NRFX_TWIM_CONFIG_MSG_LIST_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_TWIM_CONFIG_STREAM_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_TWIM_CONFIG_STREAM_ENABLED
+#define NRFX_TWIM_CONFIG_STREAM_ENABLED 0
+#endif
+
 /**
  * @brief NRFX_TWIM0_ENABLED
  *
@@ -1233,6 +1593,42 @@
 #define NRFX_UARTE_CONFIG_LOG_LEVEL 3
 #endif
 
+/**
+ * @brief NRFX_UARTE_CONFIG_RX_RING_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_UARTE_CONFIG_RX_RING_ENABLED
+#define NRFX_UARTE_CONFIG_RX_RING_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_UARTE_CONFIG_RX_WAKEUP_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_UARTE_CONFIG_RX_WAKEUP_ENABLED
+#define NRFX_UARTE_CONFIG_RX_WAKEUP_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_UARTE_CONFIG_TX_LIST_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_UARTE_CONFIG_TX_LIST_ENABLED
+#define NRFX_UARTE_CONFIG_TX_LIST_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_UARTE_CONFIG_TX_BOUNCE_SIZE
+ *
+ * Integer value. Minimum: 0. Even values only.
+ */
+#ifndef NRFX_UARTE_CONFIG_TX_BOUNCE_SIZE
+#define NRFX_UARTE_CONFIG_TX_BOUNCE_SIZE 0
+#endif
+
 /**
  * @brief NRFX_UARTE0_ENABLED
  *
@@ -150,6 +150,15 @@
 #define NRFX_DEFAULT_IRQ_PRIORITY 7
 #endif
 
+/**
+ * @brief NRFX_CACHE_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_CACHE_ENABLED
+#define NRFX_CACHE_ENABLED 0
+#endif
+
 /**
  * @brief NRFX_CLOCK_ENABLED
  *
@@ -193,6 +202,24 @@
 #define NRFX_CLOCK_CONFIG_LF_CAL_ENABLED 0
 #endif
 
+/**
+ * @brief NRFX_CLOCK_CONFIG_LF_CAL_TEMP_THRESHOLD
+ *
+ * Integer value in 0.01 degrees Celsius. Minimum: 0.
+ */
+#ifndef NRFX_CLOCK_CONFIG_LF_CAL_TEMP_THRESHOLD
+#define NRFX_CLOCK_CONFIG_LF_CAL_TEMP_THRESHOLD 50
+#endif
+
+/**
+ * @brief NRFX_CLOCK_CONFIG_LF_CAL_MAX_SKIP
+ *
+ * Integer value. Minimum: 0. Maximum: 255.
+ */
+#ifndef NRFX_CLOCK_CONFIG_LF_CAL_MAX_SKIP
+#define NRFX_CLOCK_CONFIG_LF_CAL_MAX_SKIP 2
+#endif
+
 /**
  * @brief NRFX_CLOCK_CONFIG_LFXO_TWO_STAGE_ENABLED
  *
@@ -202,6 +229,24 @@
 #define NRFX_CLOCK_CONFIG_LFXO_TWO_STAGE_ENABLED 0
 #endif
 
+/**
+ * @brief NRFX_CLOCK_CONFIG_HFCLK_REQUEST_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_CLOCK_CONFIG_HFCLK_REQUEST_ENABLED
+#define NRFX_CLOCK_CONFIG_HFCLK_REQUEST_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_CLOCK_CONFIG_HFCLK_STARTUP_TIME_US
+ *
+ * Integer value. Minimum: 0. Maximum: 65535.
+ */
+#ifndef NRFX_CLOCK_CONFIG_HFCLK_STARTUP_TIME_US
+#define NRFX_CLOCK_CONFIG_HFCLK_STARTUP_TIME_US 1500
+#endif
+
 /**
  * @brief NRFX_CLOCK_DEFAULT_CONFIG_IRQ_PRIORITY
  *
@@ -409,6 +454,33 @@
 #define NRFX_GPIOTE_CONFIG_NUM_OF_EVT_HANDLERS 2
 #endif
 
+/**
+ * @brief NRFX_GPIOTE_CONFIG_NUM_OF_GROUP_HANDLERS
+ *
+ * Integer value. Minimum: 0 Maximum: 32
+ */
+#ifndef NRFX_GPIOTE_CONFIG_NUM_OF_GROUP_HANDLERS
+#define NRFX_GPIOTE_CONFIG_NUM_OF_GROUP_HANDLERS 0
+#endif
+
+/**
+ * @brief NRFX_GPIOTE_CONFIG_PORT_CALLBACK_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_GPIOTE_CONFIG_PORT_CALLBACK_ENABLED
+#define NRFX_GPIOTE_CONFIG_PORT_CALLBACK_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_GPIOTE_CONFIG_DEBOUNCE_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_GPIOTE_CONFIG_DEBOUNCE_ENABLED
+#define NRFX_GPIOTE_CONFIG_DEBOUNCE_ENABLED 0
+#endif
+
 /**
  * @brief NRFX_GPIOTE_CONFIG_LOG_ENABLED
  *
@@ -451,6 +523,24 @@
 #define NRFX_I2S_DEFAULT_CONFIG_IRQ_PRIORITY NRFX_DEFAULT_IRQ_PRIORITY
 #endif
 
+/**
+ * @brief NRFX_I2S_CONFIG_RING_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_I2S_CONFIG_RING_ENABLED
+#define NRFX_I2S_CONFIG_RING_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_I2S_CONFIG_DRIFT_COMP_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_I2S_CONFIG_DRIFT_COMP_ENABLED
+#define NRFX_I2S_CONFIG_DRIFT_COMP_ENABLED 0
+#endif
+
 /**
  * @brief NRFX_I2S_CONFIG_LOG_ENABLED
  *
@@ -493,6 +583,39 @@
 #define NRFX_IPC_ENABLED 0
 #endif
 
+/**
+ * @brief NRFX_KMU_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_KMU_ENABLED
+#define NRFX_KMU_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_KMU_CONFIG_LOG_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_KMU_CONFIG_LOG_ENABLED
+#define NRFX_KMU_CONFIG_LOG_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_KMU_CONFIG_LOG_LEVEL
+ *
+ * Integer value.
+ * Supported values:
+ * - Off     = 0
+ * - Error   = 1
+ * - Warning = 2
+ * - Info    = 3
+ * - Debug   = 4
+ */
+#ifndef NRFX_KMU_CONFIG_LOG_LEVEL
+#define NRFX_KMU_CONFIG_LOG_LEVEL 3
+#endif
+
 /**
  * @brief NRFX_LPCOMP_ENABLED
  *
@@ -535,6 +658,48 @@
 #define NRFX_LPCOMP_CONFIG_LOG_LEVEL 3
 #endif
 
+/**
+ * @brief NRFX_MUTEX_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_MUTEX_ENABLED
+#define NRFX_MUTEX_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_MUTEX_CONFIG_BACKOFF_MAX_US
+ *
+ * Integer value. Minimum: 1 Maximum: 1000
+ */
+#ifndef NRFX_MUTEX_CONFIG_BACKOFF_MAX_US
+#define NRFX_MUTEX_CONFIG_BACKOFF_MAX_US 8
+#endif
+
+/**
+ * @brief NRFX_MUTEX_CONFIG_LOG_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_MUTEX_CONFIG_LOG_ENABLED
+#define NRFX_MUTEX_CONFIG_LOG_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_MUTEX_CONFIG_LOG_LEVEL
+ *
+ * Integer value.
+ * Supported values:
+ * - Off     = 0
+ * - Error   = 1
+ * - Warning = 2
+ * - Info    = 3
+ * - Debug   = 4
+ */
+#ifndef NRFX_MUTEX_CONFIG_LOG_LEVEL
+#define NRFX_MUTEX_CONFIG_LOG_LEVEL 3
+#endif
+
 /**
  * @brief NRFX_NFCT_ENABLED
  *
@@ -562,6 +727,15 @@
 #define NRFX_NFCT_CONFIG_TIMER_INSTANCE_ID 2
 #endif
 
+/**
+ * @brief NRFX_NFCT_CONFIG_AUTORESPONSE_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_NFCT_CONFIG_AUTORESPONSE_ENABLED
+#define NRFX_NFCT_CONFIG_AUTORESPONSE_ENABLED 0
+#endif
+
 /**
  * @brief NRFX_NFCT_CONFIG_LOG_ENABLED
  *
@@ -595,6 +769,24 @@
 #define NRFX_NVMC_ENABLED 0
 #endif
 
+/**
+ * @brief NRFX_NVMC_CONFIG_WRITER_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_NVMC_CONFIG_WRITER_ENABLED
+#define NRFX_NVMC_CONFIG_WRITER_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_NVMC_CONFIG_ERASE_SCHEDULER_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_NVMC_CONFIG_ERASE_SCHEDULER_ENABLED
+#define NRFX_NVMC_CONFIG_ERASE_SCHEDULER_ENABLED 0
+#endif
+
 /**
  * @brief NRFX_PDM_ENABLED
  *
@@ -613,6 +805,24 @@
 #define NRFX_PDM_DEFAULT_CONFIG_IRQ_PRIORITY NRFX_DEFAULT_IRQ_PRIORITY
 #endif
 
+/**
+ * @brief NRFX_PDM_CONFIG_BUFFER_QUEUE_SIZE
+ *
+ * Integer value. Minimum: 0. Maximum: 255.
+ */
+#ifndef NRFX_PDM_CONFIG_BUFFER_QUEUE_SIZE
+#define NRFX_PDM_CONFIG_BUFFER_QUEUE_SIZE 0
+#endif
+
+/**
+ * @brief NRFX_PDM_CONFIG_POSTPROC_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_PDM_CONFIG_POSTPROC_ENABLED
+#define NRFX_PDM_CONFIG_POSTPROC_ENABLED 0
+#endif
+
 /**
  * @brief NRFX_PDM_CONFIG_LOG_ENABLED
  *
@@ -655,6 +865,24 @@
 #define NRFX_POWER_DEFAULT_CONFIG_IRQ_PRIORITY NRFX_DEFAULT_IRQ_PRIORITY
 #endif
 
+/**
+ * @brief NRFX_POWER_CONFIG_RESIDENCY_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_POWER_CONFIG_RESIDENCY_ENABLED
+#define NRFX_POWER_CONFIG_RESIDENCY_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_POWER_CONFIG_RESIDENCY_WAKEUP_SOURCES
+ *
+ * Integer value. Minimum: 1 Maximum: 32
+ */
+#ifndef NRFX_POWER_CONFIG_RESIDENCY_WAKEUP_SOURCES
+#define NRFX_POWER_CONFIG_RESIDENCY_WAKEUP_SOURCES 8
+#endif
+
 /**
  * @brief NRFX_PRS_ENABLED
  *
@@ -751,6 +979,15 @@
 #define NRFX_PWM_DEFAULT_CONFIG_IRQ_PRIORITY NRFX_DEFAULT_IRQ_PRIORITY
 #endif
 
+/**
+ * @brief NRFX_PWM_CONFIG_STREAM_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_PWM_CONFIG_STREAM_ENABLED
+#define NRFX_PWM_CONFIG_STREAM_ENABLED 0
+#endif
+
 /**
  * @brief NRFX_PWM_CONFIG_LOG_ENABLED
  *
@@ -889,6 +1126,96 @@
 #define NRFX_QSPI_DEFAULT_CONFIG_IRQ_PRIORITY NRFX_DEFAULT_IRQ_PRIORITY
 #endif
 
+/**
+ * @brief NRFX_QSPI_CONFIG_QUEUE_SIZE
+ *
+ * Integer value. Minimum: 0.
+ */
+#ifndef NRFX_QSPI_CONFIG_QUEUE_SIZE
+#define NRFX_QSPI_CONFIG_QUEUE_SIZE 0
+#endif
+
+/**
+ * @brief NRFX_QSPI_CONFIG_READ_AHEAD_SIZE
+ *
+ * Integer value. Minimum: 0. Multiples of 4 only.
+ */
+#ifndef NRFX_QSPI_CONFIG_READ_AHEAD_SIZE
+#define NRFX_QSPI_CONFIG_READ_AHEAD_SIZE 0
+#endif
+
+/**
+ * @brief NRFX_QSPI_CONFIG_READ_CACHE_LINES
+ *
+ * Integer value. Minimum: 0.
+ */
+#ifndef NRFX_QSPI_CONFIG_READ_CACHE_LINES
+#define NRFX_QSPI_CONFIG_READ_CACHE_LINES 0
+#endif
+
+/**
+ * @brief NRFX_QSPI_CONFIG_READ_CACHE_LINE_SIZE
+ *
+ * Integer value. Minimum: 4. Multiples of 4 only.
+ */
+#ifndef NRFX_QSPI_CONFIG_READ_CACHE_LINE_SIZE
+#define NRFX_QSPI_CONFIG_READ_CACHE_LINE_SIZE 32
+#endif
+
+/**
+ * @brief NRFX_QSPI_CONFIG_STREAM_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_QSPI_CONFIG_STREAM_ENABLED
+#define NRFX_QSPI_CONFIG_STREAM_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_QSPI_CONFIG_SUSPEND_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_QSPI_CONFIG_SUSPEND_ENABLED
+#define NRFX_QSPI_CONFIG_SUSPEND_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_QSPI_CONFIG_SUSPEND_OPCODE
+ *
+ * Integer value. Minimum: 0 Maximum: 255
+ */
+#ifndef NRFX_QSPI_CONFIG_SUSPEND_OPCODE
+#define NRFX_QSPI_CONFIG_SUSPEND_OPCODE 0x75
+#endif
+
+/**
+ * @brief NRFX_QSPI_CONFIG_RESUME_OPCODE
+ *
+ * Integer value. Minimum: 0 Maximum: 255
+ */
+#ifndef NRFX_QSPI_CONFIG_RESUME_OPCODE
+#define NRFX_QSPI_CONFIG_RESUME_OPCODE 0x7A
+#endif
+
+/**
+ * @brief NRFX_QSPI_CONFIG_XIP_CACHE_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_QSPI_CONFIG_XIP_CACHE_ENABLED
+#define NRFX_QSPI_CONFIG_XIP_CACHE_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_RAM_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_RAM_ENABLED
+#define NRFX_RAM_ENABLED 0
+#endif
+
 /**
  * @brief NRFX_RTC_ENABLED
  *
@@ -991,6 +1318,60 @@
 #define NRFX_SAADC_CONFIG_LOG_LEVEL 3
 #endif
 
+/**
+ * @brief NRFX_SAADC_CONFIG_BUFFER_RING_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_SAADC_CONFIG_BUFFER_RING_ENABLED
+#define NRFX_SAADC_CONFIG_BUFFER_RING_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_SAADC_CONFIG_PROCESS_HANDLER_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_SAADC_CONFIG_PROCESS_HANDLER_ENABLED
+#define NRFX_SAADC_CONFIG_PROCESS_HANDLER_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_SAADC_CONFIG_TIMESTAMP_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_SAADC_CONFIG_TIMESTAMP_ENABLED
+#define NRFX_SAADC_CONFIG_TIMESTAMP_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_SAADC_CONFIG_TRIGGER_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_SAADC_CONFIG_TRIGGER_ENABLED
+#define NRFX_SAADC_CONFIG_TRIGGER_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_SAADC_CONFIG_AUTO_CALIBRATION_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_SAADC_CONFIG_AUTO_CALIBRATION_ENABLED
+#define NRFX_SAADC_CONFIG_AUTO_CALIBRATION_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_SAADC_CONFIG_SCAN_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_SAADC_CONFIG_SCAN_ENABLED
+#define NRFX_SAADC_CONFIG_SCAN_ENABLED 0
+#endif
+
 /**
  * @brief NRFX_SPIM_ENABLED
  *
@@ -1033,6 +1414,33 @@
 #define NRFX_SPIM_CONFIG_LOG_LEVEL 3
 #endif
 
+/**
+ * @brief NRFX_SPIM_CONFIG_XFER_LIST_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_SPIM_CONFIG_XFER_LIST_ENABLED
+#define NRFX_SPIM_CONFIG_XFER_LIST_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_SPIM_CONFIG_DISPLAY_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_SPIM_CONFIG_DISPLAY_ENABLED
+#define NRFX_SPIM_CONFIG_DISPLAY_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_SPIM_CONFIG_STREAM_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_SPIM_CONFIG_STREAM_ENABLED
+#define NRFX_SPIM_CONFIG_STREAM_ENABLED 0
+#endif
+
 /**
  * @brief NRFX_SPIM0_ENABLED
  *
@@ -1276,6 +1684,24 @@
 #define NRFX_TWIM_CONFIG_LOG_LEVEL 3
 #endif
 
+/**
+ * @brief NRFX_TWIM_CONFIG_MSG_LIST_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_TWIM_CONFIG_MSG_LIST_ENABLED
+#define NRFX_TWIM_CONFIG_MSG_LIST_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_TWIM_CONFIG_STREAM_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_TWIM_CONFIG_STREAM_ENABLED
+#define NRFX_TWIM_CONFIG_STREAM_ENABLED 0
+#endif
+
 /**
  * @brief NRFX_TWIM0_ENABLED
  *
@@ -1450,6 +1876,42 @@
 #define NRFX_UARTE_CONFIG_LOG_LEVEL 3
 #endif
 
+/**
+ * @brief NRFX_UARTE_CONFIG_RX_RING_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_UARTE_CONFIG_RX_RING_ENABLED
+#define NRFX_UARTE_CONFIG_RX_RING_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_UARTE_CONFIG_RX_WAKEUP_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_UARTE_CONFIG_RX_WAKEUP_ENABLED
+#define NRFX_UARTE_CONFIG_RX_WAKEUP_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_UARTE_CONFIG_TX_LIST_ENABLED
+ *
+ * Boolean. Accepted values 0 and 1.
+ */
+#ifndef NRFX_UARTE_CONFIG_TX_LIST_ENABLED
+#define NRFX_UARTE_CONFIG_TX_LIST_ENABLED 0
+#endif
+
+/**
+ * @brief NRFX_UARTE_CONFIG_TX_BOUNCE_SIZE
+ *
+ * Integer value. Minimum: 0. Even values only.
+ */
+#ifndef NRFX_UARTE_CONFIG_TX_BOUNCE_SIZE
+#define NRFX_UARTE_CONFIG_TX_BOUNCE_SIZE 0
+#endif
+
 /**
  * @brief NRFX_UARTE0_ENABLED
  *
@@ -1513,6 +1975,24 @@
 #define NRFX_USBD_CONFIG_DMASCHEDULER_ISO_BOOST 1
 #endif
 
+/**
+ * @brief NRFX_USBD_CONFIG_DMASCHEDULER_MODE
+ *
+ * Integer value. Accepted values: 0 (prioritized) and 1 (round robin).
+ */
+#ifndef NRFX_USBD_CONFIG_DMASCHEDULER_MODE
+#define NRFX_USBD_CONFIG_DMASCHEDULER_MODE 0
+#endif
+
+/**
+ * @brief NRFX_USBD_CONFIG_DMASCHEDULER_BATCH_SIZE
+ *
+ * Integer value. Minimum: 1.
+ */
+#ifndef NRFX_USBD_CONFIG_DMASCHEDULER_BATCH_SIZE
+#define NRFX_USBD_CONFIG_DMASCHEDULER_BATCH_SIZE 1
+#endif
+
 /**
  * @brief NRFX_USBD_CONFIG_ISO_IN_ZLP - Respond to an IN token on ISO IN endpoint with ZLP when no data is ready.
  *
@@ -1522,6 +2002,24 @@
 #define NRFX_USBD_CONFIG_ISO_IN_ZLP 0
 #endif
 
+/**
+ * @brief NRFX_USBD_CONFIG_ISO_STREAM_MAX_BUFFERS
+ *
+ * Integer value. Minimum: 0 Maximum: 255
+ */
+#ifndef NRFX_USBD_CONFIG_ISO_STREAM_MAX_BUFFERS
+#define NRFX_USBD_CONFIG_ISO_STREAM_MAX_BUFFERS 0
+#endif
+
+/**
+ * @brief NRFX_USBD_CONFIG_OUT_RING_MAX_SLOTS
+ *
+ * Integer value. Minimum: 0 Maximum: 255
+ */
+#ifndef NRFX_USBD_CONFIG_OUT_RING_MAX_SLOTS
+#define NRFX_USBD_CONFIG_OUT_RING_MAX_SLOTS 0
+#endif
+
 /**
  * @brief NRFX_USBD_CONFIG_LOG_ENABLED
  *
@@ -145,6 +145,13 @@ extern "C" {
  */
 #define NRFX_DELAY_DWT_BASED    0
 
+/**
+ * @brief When set to a non-zero value, this macro specifies that the profiling macros
+ *        from @ref nrfx_cycle_counter are expanded. They have no effect
+ *        if the DWT unit is not present in the SoC used.
+ */
+#define NRFX_CYCLE_COUNTER_PROFILING 0
+
 /**
  * @brief Macro for delaying the code execution for at least the specified time.
  *
@@ -324,6 +331,9 @@ extern "C" {
 /** @brief Bitmask that defines TIMER instances that are reserved for use outside of the nrfx library. */
 #define NRFX_TIMERS_USED          0
 
+/** @brief Bitmask that defines MUTEX mutexes that are reserved for use outside of the nrfx library. */
+#define NRFX_MUTEXES_USED         0
+
 /** @} */
 
 #ifdef __cplusplus